@@ -4,12 +4,13 @@
 #include <IOKit/IOLib.h>
 #include "QemuVGADevice.h"
 #include "common_fb.h"
+#include "VMLog.h"
 
 
 #define SVGA_DEBUG
 
 #ifdef  SVGA_DEBUG
-#define DLOG(fmt, args...)  IOLog(fmt, ## args)
+#define DLOG(fmt, args...)  VMLOG_DEBUG(fmt, ## args)
 #else
 #define DLOG(fmt, args...)
 #endif
@@ -77,19 +78,19 @@ bool CLASS::Start(IOPCIDevice* provider)
 	// Debug PCI device information
 	UInt16 vendor_id = provider->configRead16(kIOPCIConfigVendorID);
 	UInt16 device_id = provider->configRead16(kIOPCIConfigDeviceID);
-	IOLog("QemuVGADevice: PCI Vendor:Device = 0x%04x:0x%04x\n", vendor_id, device_id);
+	VMLOG_INFO("QemuVGADevice: PCI Vendor:Device = 0x%04x:0x%04x\n", vendor_id, device_id);
 	
 	// Check if this is a QXL device
 	bool is_qxl = (vendor_id == 0x1b36 && device_id == 0x0100);
 	if (is_qxl) {
-		IOLog("QemuVGADevice: QXL device detected - using QXL-specific initialization\n");
+		VMLOG_INFO("QemuVGADevice: QXL device detected - using QXL-specific initialization\n");
 	}
 	
 	//get the MVRAM, bar0 for cirrus
 	m_vram = provider->getDeviceMemoryWithIndex(0U);
 	if (!m_vram) {
-		IOLog("QemuVGADevice: CRITICAL - Failed to map BAR0 (VRAM)\n");
-		IOLog("QemuVGADevice: This suggests PCI device configuration issue\n");
+		VMLOG_ERROR("QemuVGADevice: CRITICAL - Failed to map BAR0 (VRAM)\n");
+		VMLOG_INFO("QemuVGADevice: This suggests PCI device configuration issue\n");
 		DLOG("%s Failed to map the mvram.\n", __FUNCTION__);
 		Cleanup();
 		return false;
@@ -98,12 +99,12 @@ bool CLASS::Start(IOPCIDevice* provider)
 	m_vram_size = m_vram->getLength();
 	
 	// Debug VRAM detection
-	IOLog("QemuVGADevice: VRAM Physical Address: 0x%llx\n", (uint64_t)m_vram_base);
-	IOLog("QemuVGADevice: VRAM Size: %u bytes (%u MB)\n", 
+	VMLOG_INFO("QemuVGADevice: VRAM Physical Address: 0x%llx\n", (uint64_t)m_vram_base);
+	VMLOG_INFO("QemuVGADevice: VRAM Size: %u bytes (%u MB)\n", 
 		  (uint32_t)m_vram_size, (uint32_t)(m_vram_size / (1024 * 1024)));
 	
 	if (m_vram_size == 0) {
-		IOLog("QemuVGADevice: ERROR - VRAM size is 0! PCI BAR0 mapping failed\n");
+		VMLOG_ERROR("QemuVGADevice: ERROR - VRAM size is 0! PCI BAR0 mapping failed\n");
 	}
 	
 	//FB info	
@@ -116,18 +117,18 @@ bool CLASS::Start(IOPCIDevice* provider)
 	if (is_qxl) {
 		// QXL devices may not support VBE registers properly
 		// Use safe defaults to prevent boot hangs
-		IOLog("QemuVGADevice: Using QXL-safe defaults to prevent VBE register access hang\n");
+		VMLOG_INFO("QemuVGADevice: Using QXL-safe defaults to prevent VBE register access hang\n");
 		m_width  = 1024;  // Safe default
 		m_height = 768;   // Safe default  
 		m_bpp    = 32;    // Safe default
-		IOLog("QemuVGADevice: QXL defaults - w:%d h:%d bpp:%d\n", m_width, m_height, m_bpp);
+		VMLOG_INFO("QemuVGADevice: QXL defaults - w:%d h:%d bpp:%d\n", m_width, m_height, m_bpp);
 	} else {
 		// Traditional VGA/VBE devices - safe to access VBE registers
-		IOLog("QemuVGADevice: Reading VBE registers for traditional VGA device\n");
+		VMLOG_INFO("QemuVGADevice: Reading VBE registers for traditional VGA device\n");
 		m_width  = ReadRegVBE(VBE_DISPI_INDEX_XRES);
 		m_height = ReadRegVBE(VBE_DISPI_INDEX_YRES);
 		m_bpp    = ReadRegVBE(VBE_DISPI_INDEX_BPP);
-		IOLog("QemuVGADevice: VBE values - w:%d h:%d bpp:%d\n", m_width, m_height, m_bpp);
+		VMLOG_INFO("QemuVGADevice: VBE values - w:%d h:%d bpp:%d\n", m_width, m_height, m_bpp);
 	}
 
 	//Cosmetic
@@ -6,6 +6,7 @@
 #include "VMAccelSurfaceClient.h"
 #include "VMQemuVGAAccelerator.h"
 #include "VMVirtIOGPU.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 #include <IOKit/graphics/IOGraphicsInterfaceTypes.h>
 
@@ -171,15 +172,15 @@ bool CLASS::initWithTask(task_t owningTask, void* securityToken,
     m_lock = IOLockAlloc();
     
     if (!m_lock) {
-        IOLog("VMAccelSurfaceClient: Failed to allocate lock\n");
+        VMLOG_ERROR("VMAccelSurfaceClient: Failed to allocate lock\n");
         return false;
     }
     
     // Publish the number of methods we support
     setProperty("IOUserClientMethodCount", kIOAccelNumSurfaceMethods, 32);
-    IOLog("VMAccelSurfaceClient: Published %u methods\n", kIOAccelNumSurfaceMethods);
+    VMLOG_INFO("VMAccelSurfaceClient: Published %u methods\n", kIOAccelNumSurfaceMethods);
     
-    IOLog("VMAccelSurfaceClient: Initialized for task %p\n", owningTask);
+    VMLOG_INFO("VMAccelSurfaceClient: Initialized for task %p\n", owningTask);
     return true;
 }
 
@@ -190,14 +191,14 @@ bool CLASS::start(IOService* provider)
     
     m_accelerator = OSDynamicCast(VMQemuVGAAccelerator, provider);
     if (!m_accelerator) {
-        IOLog("VMAccelSurfaceClient: Provider is not VMQemuVGAAccelerator\n");
+        VMLOG_INFO("VMAccelSurfaceClient: Provider is not VMQemuVGAAccelerator\n");
         return false;
     }
     
     // Allocate surface structure
     m_surface = (VMAccelSurface*)IOMalloc(sizeof(VMAccelSurface));
     if (!m_surface) {
-        IOLog("VMAccelSurfaceClient: Failed to allocate surface\n");
+        VMLOG_ERROR("VMAccelSurfaceClient: Failed to allocate surface\n");
         return false;
     }
     
@@ -207,13 +208,13 @@ bool CLASS::start(IOService* provider)
     m_surface->owning_task = m_owning_task;
     m_surface->is_locked = false;
     
-    IOLog("VMAccelSurfaceClient: Started successfully\n");
+    VMLOG_INFO("VMAccelSurfaceClient: Started successfully\n");
     return true;
 }
 
 void CLASS::stop(IOService* provider)
 {
-    IOLog("VMAccelSurfaceClient: Stopping\n");
+    VMLOG_INFO("VMAccelSurfaceClient: Stopping\n");
     
     if (m_surface) {
         if (m_surface->backing_memory) {
@@ -239,7 +240,7 @@ void CLASS::free()
 
 IOReturn CLASS::clientClose()
 {
-    IOLog("VMAccelSurfaceClient: Client closing\n");
+    VMLOG_INFO("VMAccelSurfaceClient: Client closing\n");
     
     if (!isInactive()) {
         terminate();
@@ -250,7 +251,7 @@ IOReturn CLASS::clientClose()
 
 IOReturn CLASS::clientDied()
 {
-    IOLog("VMAccelSurfaceClient: Client died\n");
+    VMLOG_INFO("VMAccelSurfaceClient: Client died\n");
     return clientClose();
 }
 
@@ -258,7 +259,7 @@ IOReturn CLASS::clientDied()
 // This is called by IOConnectMapMemory() after lock operations
 IOReturn CLASS::clientMemoryForType(UInt32 type, IOOptionBits* options, IOMemoryDescriptor** memory)
 {
-    IOLog("VMAccelSurfaceClient: clientMemoryForType type=%u\n", type);
+    VMLOG_DEBUG("VMAccelSurfaceClient: clientMemoryForType type=%u\n", type);
     
     if (!memory) {
         return kIOReturnBadArgument;
@@ -266,25 +267,25 @@ IOReturn CLASS::clientMemoryForType(UInt32 type, IOOptionBits* options, IOMemory
     
     // Get framebuffer from accelerator
     if (!m_accelerator) {
-        IOLog("VMAccelSurfaceClient: ERROR - No accelerator for memory mapping\n");
+        VMLOG_ERROR("VMAccelSurfaceClient: ERROR - No accelerator for memory mapping\n");
         return kIOReturnNotReady;
     }
     
     // Get the framebuffer device (VMQemuVGA)
     IOService* framebuffer = m_accelerator->getProvider();
     if (!framebuffer) {
-        IOLog("VMAccelSurfaceClient: ERROR - No framebuffer device\n");
+        VMLOG_ERROR("VMAccelSurfaceClient: ERROR - No framebuffer device\n");
         return kIOReturnNotReady;
     }
     
     // Get VRAM aperture - type 0 is main framebuffer
     IODeviceMemory* vram = framebuffer->getDeviceMemoryWithIndex(0);
     if (!vram) {
-        IOLog("VMAccelSurfaceClient: ERROR - No VRAM aperture\n");
+        VMLOG_ERROR("VMAccelSurfaceClient: ERROR - No VRAM aperture\n");
         return kIOReturnNoResources;
     }
     
-    IOLog("VMAccelSurfaceClient: Mapping VRAM aperture: phys=0x%llx size=%llu bytes\n",
+    VMLOG_DEBUG("VMAccelSurfaceClient: Mapping VRAM aperture: phys=0x%llx size=%llu bytes\n",
           (unsigned long long)vram->getPhysicalAddress(),
           (unsigned long long)vram->getLength());
     
@@ -296,7 +297,7 @@ IOReturn CLASS::clientMemoryForType(UInt32 type, IOOptionBits* options, IOMemory
         *options = kIOMapInhibitCache;  // Allow read/write access
     }
     
-    IOLog("VMAccelSurfaceClient: ✅ VRAM mapped successfully\n");
+    VMLOG_DEBUG("VMAccelSurfaceClient: ✅ VRAM mapped successfully\n");
     return kIOReturnSuccess;
 }
 
@@ -307,11 +308,11 @@ IOReturn CLASS::clientMemoryForType(UInt32 type, IOOptionBits* options, IOMemory
 
 IOExternalMethod* CLASS::getTargetAndMethodForIndex(IOService** targetP, UInt32 index)
 {
-    IOLog("VMAccelSurfaceClient: getTargetAndMethodForIndex index=%u (max=%u)\n", 
+    VMLOG_DEBUG("VMAccelSurfaceClient: getTargetAndMethodForIndex index=%u (max=%u)\n", 
           index, kIOAccelNumSurfaceMethods);
     
     if (index >= kIOAccelNumSurfaceMethods) {
-        IOLog("VMAccelSurfaceClient: Invalid method index %u\n", index);
+        VMLOG_WARN("VMAccelSurfaceClient: Invalid method index %u\n", index);
         return NULL;
     }
     
@@ -319,7 +320,7 @@ IOExternalMethod* CLASS::getTargetAndMethodForIndex(IOService** targetP, UInt32
         *targetP = this;
     }
     
-    IOLog("VMAccelSurfaceClient: Returning method %u (count0=%llu, count1=%llu)\n",
+    VMLOG_DEBUG("VMAccelSurfaceClient: Returning method %u (count0=%llu, count1=%llu)\n",
           index, (unsigned long long)sMethods[index].count0, (unsigned long long)sMethods[index].count1);
     
     // Return const_cast since IOKit expects non-const pointer
@@ -346,14 +347,14 @@ IOExternalMethod* CLASS::getTargetAndMethodForIndex(IOService** targetP, UInt32
 IOReturn CLASS::readLockOptions(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
     uint32_t options = (uint32_t)(uintptr_t)p1;
-    IOLog("VMAccelSurfaceClient: ReadLockOptions(0x%x) -> Unsupported\n", options);
+    VMLOG_WARN("VMAccelSurfaceClient: ReadLockOptions(0x%x) -> Unsupported\n", options);
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::readUnlockOptions(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
     uint32_t options = (uint32_t)(uintptr_t)p1;
-    IOLog("VMAccelSurfaceClient: ReadUnlockOptions(0x%x) -> Unsupported\n", options);
+    VMLOG_WARN("VMAccelSurfaceClient: ReadUnlockOptions(0x%x) -> Unsupported\n", options);
     return kIOReturnUnsupported;
 }
 
@@ -365,99 +366,99 @@ IOReturn CLASS::getState(void *p1, void *p2, void *p3, void *p4, void *p5, void
         return kIOReturnBadArgument;
     }
     *state = kIOAccelSurfaceStateIdleBit;
-    IOLog("VMAccelSurfaceClient: GetState returning idle\n");
+    VMLOG_DEBUG("VMAccelSurfaceClient: GetState returning idle\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::writeLockOptions(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
     uint32_t options = (uint32_t)(uintptr_t)p1;
-    IOLog("VMAccelSurfaceClient: WriteLockOptions(0x%x) -> Unsupported\n", options);
+    VMLOG_WARN("VMAccelSurfaceClient: WriteLockOptions(0x%x) -> Unsupported\n", options);
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::writeUnlockOptions(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
     uint32_t options = (uint32_t)(uintptr_t)p1;
-    IOLog("VMAccelSurfaceClient: WriteUnlockOptions(0x%x) -> Unsupported\n", options);
+    VMLOG_WARN("VMAccelSurfaceClient: WriteUnlockOptions(0x%x) -> Unsupported\n", options);
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::read(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: Read -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: Read -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::setShapeBacking(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: SetShapeBacking -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: SetShapeBacking -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::setIDMode(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: SetIDMode -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: SetIDMode -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::setScale(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: SetScale -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: SetScale -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::setShape(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: SetShape -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: SetShape -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::flush(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: Flush -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: Flush -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::queryLock(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: QueryLock -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: QueryLock -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::readLockSurface(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: ReadLock -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: ReadLock -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::readUnlockSurface(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: ReadUnlock -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: ReadUnlock -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::writeLockSurface(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: WriteLock -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: WriteLock -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::writeUnlockSurface(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: WriteUnlock -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: WriteUnlock -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::control(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: Control -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: Control -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
 IOReturn CLASS::setShapeBackingAndLength(void *p1, void *p2, void *p3, void *p4, void *p5, void *p6)
 {
-    IOLog("VMAccelSurfaceClient: SetShapeBackingAndLength -> Unsupported\n");
+    VMLOG_WARN("VMAccelSurfaceClient: SetShapeBackingAndLength -> Unsupported\n");
     return kIOReturnUnsupported;
 }
 
@@ -0,0 +1,488 @@
+#include "VMBlit2D.h"
+#include <string.h>
+
+// SIMD span kernels, picked at runtime from CPUID. Inside the kext the
+// public entry points run them between VMBlit2DVectorBegin/End, and the
+// probe stops at SSE2: fxsave covers the legacy XMM state only, and VEX
+// code would clobber YMM/ZMM upper halves it does not preserve.
+#if defined(__x86_64__) || defined(__i386__)
+#define VMBLIT2D_HAVE_SIMD 1
+#include <immintrin.h>
+#else
+#define VMBLIT2D_HAVE_SIMD 0
+#endif
+
+typedef void (*VMBlit2DMoveFn)(uint8_t* dst, const uint8_t* src, size_t n);
+typedef void (*VMBlit2DFillFn)(uint8_t* dst, size_t n, uint32_t pattern);
+
+static VMBlit2DMoveFn s_move_fwd;
+static VMBlit2DMoveFn s_move_bwd;
+static VMBlit2DFillFn s_fill;
+static VMBlit2DPath   s_active_path = kVMBlit2DPathScalar;
+static VMBlit2DPath   s_best_path = kVMBlit2DPathScalar;
+static bool           s_has_ssse3 = false;
+static bool           s_initialized = false;
+
+#pragma mark - Scalar kernels
+
+static void move_scalar(uint8_t* dst, const uint8_t* src, size_t n)
+{
+    // memmove already picks direction; both directions share it
+    memmove(dst, src, n);
+}
+
+// Tail helper shared by every fill kernel: n is a multiple of 2 (16 bpp)
+// or 4 (32 bpp) and pattern is the pixel replicated to 32 bits
+static inline void fill_tail(uint8_t* dst, size_t n, uint32_t pattern)
+{
+    while (n >= 4) {
+        memcpy(dst, &pattern, 4);
+        dst += 4;
+        n -= 4;
+    }
+    if (n >= 2) {
+        uint16_t half = (uint16_t)pattern;
+        memcpy(dst, &half, 2);
+    }
+}
+
+static void fill_scalar(uint8_t* dst, size_t n, uint32_t pattern)
+{
+    uint64_t wide = ((uint64_t)pattern << 32) | pattern;
+    while (n >= 32) {
+        memcpy(dst,      &wide, 8);
+        memcpy(dst + 8,  &wide, 8);
+        memcpy(dst + 16, &wide, 8);
+        memcpy(dst + 24, &wide, 8);
+        dst += 32;
+        n -= 32;
+    }
+    while (n >= 8) {
+        memcpy(dst, &wide, 8);
+        dst += 8;
+        n -= 8;
+    }
+    fill_tail(dst, n, pattern);
+}
+
+#if VMBLIT2D_HAVE_SIMD
+
+#pragma mark - SSE2 kernels
+
+// Each loop iteration loads a whole block before storing any of it, so a
+// forward pass is safe whenever dst < src and a backward pass whenever
+// dst > src, regardless of how far apart the spans are. The sub-vector
+// remainder goes through memmove, which is overlap-safe on its own.
+
+__attribute__((target("sse2")))
+static void move_fwd_sse2(uint8_t* dst, const uint8_t* src, size_t n)
+{
+    while (n >= 64) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(src));
+        __m128i b = _mm_loadu_si128((const __m128i*)(src + 16));
+        __m128i c = _mm_loadu_si128((const __m128i*)(src + 32));
+        __m128i d = _mm_loadu_si128((const __m128i*)(src + 48));
+        _mm_storeu_si128((__m128i*)(dst),      a);
+        _mm_storeu_si128((__m128i*)(dst + 16), b);
+        _mm_storeu_si128((__m128i*)(dst + 32), c);
+        _mm_storeu_si128((__m128i*)(dst + 48), d);
+        src += 64;
+        dst += 64;
+        n -= 64;
+    }
+    while (n >= 16) {
+        _mm_storeu_si128((__m128i*)dst, _mm_loadu_si128((const __m128i*)src));
+        src += 16;
+        dst += 16;
+        n -= 16;
+    }
+    if (n)
+        memmove(dst, src, n);
+}
+
+__attribute__((target("sse2")))
+static void move_bwd_sse2(uint8_t* dst, const uint8_t* src, size_t n)
+{
+    uint8_t* de = dst + n;
+    const uint8_t* se = src + n;
+    while (n >= 64) {
+        se -= 64;
+        de -= 64;
+        __m128i a = _mm_loadu_si128((const __m128i*)(se));
+        __m128i b = _mm_loadu_si128((const __m128i*)(se + 16));
+        __m128i c = _mm_loadu_si128((const __m128i*)(se + 32));
+        __m128i d = _mm_loadu_si128((const __m128i*)(se + 48));
+        _mm_storeu_si128((__m128i*)(de + 48), d);
+        _mm_storeu_si128((__m128i*)(de + 32), c);
+        _mm_storeu_si128((__m128i*)(de + 16), b);
+        _mm_storeu_si128((__m128i*)(de),      a);
+        n -= 64;
+    }
+    while (n >= 16) {
+        se -= 16;
+        de -= 16;
+        _mm_storeu_si128((__m128i*)de, _mm_loadu_si128((const __m128i*)se));
+        n -= 16;
+    }
+    if (n)
+        memmove(dst, src, n);
+}
+
+__attribute__((target("sse2")))
+static void fill_sse2(uint8_t* dst, size_t n, uint32_t pattern)
+{
+    __m128i v = _mm_set1_epi32((int)pattern);
+    while (n >= 64) {
+        _mm_storeu_si128((__m128i*)(dst),      v);
+        _mm_storeu_si128((__m128i*)(dst + 16), v);
+        _mm_storeu_si128((__m128i*)(dst + 32), v);
+        _mm_storeu_si128((__m128i*)(dst + 48), v);
+        dst += 64;
+        n -= 64;
+    }
+    while (n >= 16) {
+        _mm_storeu_si128((__m128i*)dst, v);
+        dst += 16;
+        n -= 16;
+    }
+    fill_tail(dst, n, pattern);
+}
+
+#pragma mark - AVX2 kernels
+
+__attribute__((target("avx2")))
+static void move_fwd_avx2(uint8_t* dst, const uint8_t* src, size_t n)
+{
+    while (n >= 128) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(src));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(src + 32));
+        __m256i c = _mm256_loadu_si256((const __m256i*)(src + 64));
+        __m256i d = _mm256_loadu_si256((const __m256i*)(src + 96));
+        _mm256_storeu_si256((__m256i*)(dst),      a);
+        _mm256_storeu_si256((__m256i*)(dst + 32), b);
+        _mm256_storeu_si256((__m256i*)(dst + 64), c);
+        _mm256_storeu_si256((__m256i*)(dst + 96), d);
+        src += 128;
+        dst += 128;
+        n -= 128;
+    }
+    while (n >= 32) {
+        _mm256_storeu_si256((__m256i*)dst, _mm256_loadu_si256((const __m256i*)src));
+        src += 32;
+        dst += 32;
+        n -= 32;
+    }
+    if (n >= 16) {
+        _mm_storeu_si128((__m128i*)dst, _mm_loadu_si128((const __m128i*)src));
+        src += 16;
+        dst += 16;
+        n -= 16;
+    }
+    if (n)
+        memmove(dst, src, n);
+}
+
+__attribute__((target("avx2")))
+static void move_bwd_avx2(uint8_t* dst, const uint8_t* src, size_t n)
+{
+    uint8_t* de = dst + n;
+    const uint8_t* se = src + n;
+    while (n >= 128) {
+        se -= 128;
+        de -= 128;
+        __m256i a = _mm256_loadu_si256((const __m256i*)(se));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(se + 32));
+        __m256i c = _mm256_loadu_si256((const __m256i*)(se + 64));
+        __m256i d = _mm256_loadu_si256((const __m256i*)(se + 96));
+        _mm256_storeu_si256((__m256i*)(de + 96), d);
+        _mm256_storeu_si256((__m256i*)(de + 64), c);
+        _mm256_storeu_si256((__m256i*)(de + 32), b);
+        _mm256_storeu_si256((__m256i*)(de),      a);
+        n -= 128;
+    }
+    while (n >= 32) {
+        se -= 32;
+        de -= 32;
+        _mm256_storeu_si256((__m256i*)de, _mm256_loadu_si256((const __m256i*)se));
+        n -= 32;
+    }
+    if (n >= 16) {
+        se -= 16;
+        de -= 16;
+        _mm_storeu_si128((__m128i*)de, _mm_loadu_si128((const __m128i*)se));
+        n -= 16;
+    }
+    if (n)
+        memmove(dst, src, n);
+}
+
+__attribute__((target("avx2")))
+static void fill_avx2(uint8_t* dst, size_t n, uint32_t pattern)
+{
+    __m256i v = _mm256_set1_epi32((int)pattern);
+    while (n >= 128) {
+        _mm256_storeu_si256((__m256i*)(dst),      v);
+        _mm256_storeu_si256((__m256i*)(dst + 32), v);
+        _mm256_storeu_si256((__m256i*)(dst + 64), v);
+        _mm256_storeu_si256((__m256i*)(dst + 96), v);
+        dst += 128;
+        n -= 128;
+    }
+    while (n >= 32) {
+        _mm256_storeu_si256((__m256i*)dst, v);
+        dst += 32;
+        n -= 32;
+    }
+    if (n >= 16) {
+        _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(v));
+        dst += 16;
+        n -= 16;
+    }
+    fill_tail(dst, n, pattern);
+}
+
+#pragma mark - CPU detection
+
+static inline void cpuid_count(uint32_t leaf, uint32_t sub, uint32_t regs[4])
+{
+    __asm__ __volatile__("cpuid"
+                         : "=a"(regs[0]), "=b"(regs[1]), "=c"(regs[2]), "=d"(regs[3])
+                         : "a"(leaf), "c"(sub));
+}
+
+static VMBlit2DPath detect_best_path()
+{
+    uint32_t r[4];
+    cpuid_count(0, 0, r);
+    uint32_t max_leaf = r[0];
+
+    cpuid_count(1, 0, r);
+    bool sse2 = (r[3] & (1u << 26)) != 0;
+    s_has_ssse3 = sse2 && (r[2] & (1u << 9)) != 0;
+    bool osxsave = (r[2] & (1u << 27)) != 0;
+    bool avx = (r[2] & (1u << 28)) != 0;
+
+    bool avx2 = false;
+#ifdef KERNEL
+    (void)osxsave;
+    (void)avx;
+    (void)max_leaf;
+#else
+    if (osxsave && avx && max_leaf >= 7) {
+        // The OS must have enabled XMM and YMM state in XCR0, otherwise
+        // the first VEX instruction faults even though CPUID advertises it
+        uint32_t xcr0_lo, xcr0_hi;
+        __asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+        if ((xcr0_lo & 0x6) == 0x6) {
+            cpuid_count(7, 0, r);
+            avx2 = (r[1] & (1u << 5)) != 0;
+        }
+    }
+#endif
+
+    if (avx2)
+        return kVMBlit2DPathAVX2;
+    if (sse2)
+        return kVMBlit2DPathSSE2;
+    return kVMBlit2DPathScalar;
+}
+
+#endif /* VMBLIT2D_HAVE_SIMD */
+
+#pragma mark - Dispatch
+
+VMBlit2DPath VMBlit2DSetPath(VMBlit2DPath path)
+{
+    if (path > s_best_path)
+        path = s_best_path;
+
+    switch (path) {
+#if VMBLIT2D_HAVE_SIMD
+        case kVMBlit2DPathAVX2:
+            s_move_fwd = move_fwd_avx2;
+            s_move_bwd = move_bwd_avx2;
+            s_fill = fill_avx2;
+            break;
+        case kVMBlit2DPathSSE2:
+            s_move_fwd = move_fwd_sse2;
+            s_move_bwd = move_bwd_sse2;
+            s_fill = fill_sse2;
+            break;
+#endif
+        default:
+            path = kVMBlit2DPathScalar;
+            s_move_fwd = move_scalar;
+            s_move_bwd = move_scalar;
+            s_fill = fill_scalar;
+            break;
+    }
+
+    s_active_path = path;
+    return path;
+}
+
+void VMBlit2DInit()
+{
+    if (s_initialized)
+        return;
+#if VMBLIT2D_HAVE_SIMD
+    s_best_path = detect_best_path();
+#else
+    s_best_path = kVMBlit2DPathScalar;
+#endif
+    s_initialized = true;
+    VMBlit2DSetPath(s_best_path);
+}
+
+VMBlit2DPath VMBlit2DActivePath()
+{
+    VMBlit2DInit();
+    return s_active_path;
+}
+
+VMBlit2DPath VMBlit2DBestPath()
+{
+    VMBlit2DInit();
+    return s_best_path;
+}
+
+bool VMBlit2DHasSSSE3()
+{
+    VMBlit2DInit();
+    return s_has_ssse3;
+}
+
+const char* VMBlit2DPathName(VMBlit2DPath path)
+{
+    switch (path) {
+        case kVMBlit2DPathAVX2: return "avx2";
+        case kVMBlit2DPathSSE2: return "sse2";
+        default:                return "scalar";
+    }
+}
+
+#pragma mark - Vector state
+
+void VMBlit2DVectorBegin(VMBlit2DVectorState* state)
+{
+#if VMBLIT2D_HAVE_SIMD && defined(KERNEL)
+    state->area = (uint8_t*)(((uintptr_t)state->buffer + 15) & ~(uintptr_t)15);
+    __asm__ __volatile__("fxsave %0" : "=m"(*(uint8_t (*)[512])state->area) : : "memory");
+#else
+    (void)state;
+#endif
+}
+
+void VMBlit2DVectorEnd(VMBlit2DVectorState* state)
+{
+#if VMBLIT2D_HAVE_SIMD && defined(KERNEL)
+    __asm__ __volatile__("fxrstor %0" : : "m"(*(const uint8_t (*)[512])state->area) : "memory");
+#else
+    (void)state;
+#endif
+}
+
+#pragma mark - Rectangle operations
+
+static inline bool supported_bpp(uint32_t bpp)
+{
+    return bpp == 2 || bpp == 4;
+}
+
+// Clip [pos, pos+len) to [0, limit), shifting the partner coordinate by the
+// same amount so source and destination stay paired
+static inline void clip_axis(int& pos, int& other, int& len, uint32_t limit)
+{
+    if (pos < 0) {
+        other -= pos;
+        len += pos;
+        pos = 0;
+    }
+    if (len > 0 && (int64_t)pos + len > (int64_t)limit)
+        len = (int)((int64_t)limit - pos);
+}
+
+bool VMBlit2DCopyRect(const VMBlit2DSurface* dst, int dx, int dy,
+                      const VMBlit2DSurface* src, int sx, int sy,
+                      int w, int h)
+{
+    if (!dst || !src || !dst->base || !src->base)
+        return false;
+    if (!supported_bpp(dst->bytesPerPixel) || dst->bytesPerPixel != src->bytesPerPixel)
+        return false;
+
+    VMBlit2DInit();
+
+    clip_axis(sx, dx, w, src->width);
+    clip_axis(dx, sx, w, dst->width);
+    clip_axis(sy, dy, h, src->height);
+    clip_axis(dy, sy, h, dst->height);
+    if (w <= 0 || h <= 0)
+        return true;
+
+    const uint32_t bpp = dst->bytesPerPixel;
+    const size_t span = (size_t)w * bpp;
+    const uint8_t* s = src->base + (size_t)sy * src->rowBytes + (size_t)sx * bpp;
+    uint8_t* d = dst->base + (size_t)dy * dst->rowBytes + (size_t)dx * bpp;
+    intptr_t s_step = (intptr_t)src->rowBytes;
+    intptr_t d_step = (intptr_t)dst->rowBytes;
+
+    // Destination starting later in memory than the source means the last
+    // source rows could be overwritten before they are read: walk bottom-up
+    if (d > s) {
+        s += (size_t)(h - 1) * src->rowBytes;
+        d += (size_t)(h - 1) * dst->rowBytes;
+        s_step = -s_step;
+        d_step = -d_step;
+    }
+
+    VMBlit2DVectorState vector;
+    VMBlit2DVectorBegin(&vector);
+    for (int row = 0; row < h; row++) {
+        if (d > s && d < s + span)
+            s_move_bwd(d, s, span);
+        else
+            s_move_fwd(d, s, span);
+        s += s_step;
+        d += d_step;
+    }
+    VMBlit2DVectorEnd(&vector);
+    return true;
+}
+
+bool VMBlit2DFillRect(const VMBlit2DSurface* dst, int x, int y,
+                      int w, int h, uint32_t color)
+{
+    if (!dst || !dst->base || !supported_bpp(dst->bytesPerPixel))
+        return false;
+
+    VMBlit2DInit();
+
+    int unused = 0;
+    clip_axis(x, unused, w, dst->width);
+    clip_axis(y, unused, h, dst->height);
+    if (w <= 0 || h <= 0)
+        return true;
+
+    const uint32_t bpp = dst->bytesPerPixel;
+    uint32_t pattern = color;
+    if (bpp == 2)
+        pattern = (color & 0xFFFF) | ((color & 0xFFFF) << 16);
+
+    const size_t span = (size_t)w * bpp;
+    uint8_t* d = dst->base + (size_t)y * dst->rowBytes + (size_t)x * bpp;
+
+    VMBlit2DVectorState vector;
+    VMBlit2DVectorBegin(&vector);
+    // Contiguous rows (rowBytes == span) collapse into one long fill
+    if (dst->rowBytes == span) {
+        s_fill(d, span * (size_t)h, pattern);
+    } else {
+        for (int row = 0; row < h; row++) {
+            s_fill(d, span, pattern);
+            d += dst->rowBytes;
+        }
+    }
+    VMBlit2DVectorEnd(&vector);
+    return true;
+}
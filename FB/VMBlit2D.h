@@ -0,0 +1,81 @@
+#ifndef __VMBlit2D_H__
+#define __VMBlit2D_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Software 2D engine for 16/32 bpp linear surfaces.
+//
+// Used by VMQemuVGAAccelerator when there is no host 2D engine to hand the
+// work to (plain QEMU std-VGA, mock VirtIO device, or a VirtIO blit/fill
+// that came back unsupported). Deliberately free of IOKit so the same
+// translation unit builds into tools/blit2d_test on Linux.
+//
+// Copies have memmove semantics: source and destination may be the same
+// surface and may overlap in any direction (scrolling, window drags).
+// Rectangles are clipped against both surfaces before any pixel is touched.
+
+struct VMBlit2DSurface {
+    uint8_t* base;          // Address of pixel (0,0)
+    uint32_t rowBytes;      // Stride in bytes, may exceed width * bytesPerPixel
+    uint32_t width;         // In pixels
+    uint32_t height;        // In rows
+    uint32_t bytesPerPixel; // 2 or 4
+};
+
+enum VMBlit2DPath {
+    kVMBlit2DPathScalar = 0,
+    kVMBlit2DPathSSE2   = 1,
+    kVMBlit2DPathAVX2   = 2,
+};
+
+// Probe the CPU once and select the widest usable span kernels. Safe to
+// call more than once; the copy/fill entry points call it lazily.
+void VMBlit2DInit();
+
+// Kernel set currently in use, and the best one this CPU supports. Inside
+// the kext the best path is at most SSE2.
+VMBlit2DPath VMBlit2DActivePath();
+VMBlit2DPath VMBlit2DBestPath();
+
+// Whether the CPU has SSSE3 (pshufb). Not a path of its own: kernel sets
+// that need byte shuffles use it to upgrade their SSE2 tier.
+bool VMBlit2DHasSSSE3();
+
+// Pin a specific kernel set (clamped to what the CPU supports). Returns the
+// path actually selected. Intended for the test suite and for A/B runs.
+VMBlit2DPath VMBlit2DSetPath(VMBlit2DPath path);
+
+const char* VMBlit2DPathName(VMBlit2DPath path);
+
+// Vector register bracket for the kext. XNU does not preserve XMM
+// registers around kernel-mode code, so every entry point that may run a
+// vector kernel (here, and in the libraries that share this CPU probe)
+// fxsaves the interrupted thread's state first and puts it back afterwards.
+// The kext build never reports the AVX2 path, so nothing inside the bracket
+// touches YMM/ZMM state. Outside the kernel both calls do nothing.
+struct VMBlit2DVectorState {
+#ifdef KERNEL
+    uint8_t  buffer[512 + 16];  // fxsave area, 16-byte aligned inside
+    uint8_t* area;
+#else
+    uint8_t  unused;
+#endif
+};
+
+void VMBlit2DVectorBegin(VMBlit2DVectorState* state);
+void VMBlit2DVectorEnd(VMBlit2DVectorState* state);
+
+// Copy a w x h block from (sx,sy) in src to (dx,dy) in dst. Both surfaces
+// must share bytesPerPixel. Returns false for unsupported formats; a block
+// that clips away entirely is a successful no-op.
+bool VMBlit2DCopyRect(const VMBlit2DSurface* dst, int dx, int dy,
+                      const VMBlit2DSurface* src, int sx, int sy,
+                      int w, int h);
+
+// Fill a w x h block at (x,y). For 16 bpp surfaces only the low 16 bits of
+// color are used.
+bool VMBlit2DFillRect(const VMBlit2DSurface* dst, int x, int y,
+                      int w, int h, uint32_t color);
+
+#endif /* __VMBlit2D_H__ */
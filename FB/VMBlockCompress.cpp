@@ -0,0 +1,1418 @@
+#include "VMBlockCompress.h"
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VMBLOCKCOMPRESS_HAVE_SIMD 1
+#include <immintrin.h>
+#else
+#define VMBLOCKCOMPRESS_HAVE_SIMD 0
+#endif
+
+// The encoder works on one block at a time, 16 RGBA8 pixels row by row in
+// a 64-byte array, and leaves the per-pixel work to kernels:
+//   bounds        per-channel minimum and maximum
+//   moments       sums and products of R, G and B for the principal axis
+//   project       smallest and largest dot product with an axis
+//   colorIndex    2-bit index per pixel: the number of thresholds that
+//                 2 * dot(pixel, dir) exceeds, mapped through code[]
+//   alphaIndex    3-bit index per pixel, the same for 2 * channel value
+// Thresholds are sums of neighbouring palette entries sorted along the
+// axis, so counting them finds the nearest entry with integer compares
+// only, and every kernel set agrees. Endpoint fitting, quantization and
+// error measurement are scalar code shared by all of them.
+//
+// A decode kernel expands `count` horizontally adjacent blocks into four
+// rows of 4 * count pixels.
+typedef void (*VMBlockBoundsFn)(const uint8_t* px, uint8_t lo[4], uint8_t hi[4]);
+typedef void (*VMBlockMomentsFn)(const uint8_t* px, int32_t sum[3], int32_t product[6]);
+typedef void (*VMBlockProjectFn)(const uint8_t* px, const int16_t dir[3], int32_t* lo, int32_t* hi);
+typedef uint32_t (*VMBlockColorIndexFn)(const uint8_t* px, const int16_t dir[3], const int32_t threshold[3],
+                                        const uint8_t code[4], bool transparent);
+typedef uint64_t (*VMBlockAlphaIndexFn)(const uint8_t* px, uint32_t channel, const int16_t threshold[7],
+                                        const uint8_t code[8]);
+typedef void (*VMBlockDecodeFn)(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra);
+
+struct VMBlockKernels {
+    VMBlockBoundsFn     bounds;
+    VMBlockMomentsFn    moments;        // product: RR, GG, BB, RG, RB, GB
+    VMBlockProjectFn    project;
+    VMBlockColorIndexFn colorIndex;
+    VMBlockAlphaIndexFn alphaIndex;
+    VMBlockDecodeFn     decode[kVMBlockFormatCount];
+};
+
+static const uint8_t s_block_bytes[kVMBlockFormatCount] = { 0, 8, 16, 16, 8, 16 };
+
+static VMBlockKernels s_k;
+static VMBlit2DPath   s_active_path = kVMBlit2DPathScalar;
+static bool           s_uses_ssse3 = false;
+static bool           s_initialized = false;
+
+// Nearest 5- and 6-bit value, after widening, to each 8-bit value
+static uint8_t s_quant5[256];
+static uint8_t s_quant6[256];
+
+#pragma mark - Block formats
+
+static inline uint32_t load_le32(const uint8_t* p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint64_t load_le48(const uint8_t* p)
+{
+    return load_le32(p) | ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40);
+}
+
+static inline void store_le(uint8_t* p, uint64_t v, uint32_t bytes)
+{
+    for (uint32_t i = 0; i < bytes; i++, v >>= 8)
+        p[i] = (uint8_t)v;
+}
+
+static inline uint32_t widen5(uint32_t v)
+{
+    return (v << 3) | (v >> 2);
+}
+
+static inline uint32_t widen6(uint32_t v)
+{
+    return (v << 2) | (v >> 4);
+}
+
+static inline void swap_rb(uint8_t* px, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++, px += 4) {
+        uint8_t r = px[0];
+        px[0] = px[2];
+        px[2] = r;
+    }
+}
+
+// The four RGBA8 entries of a color block's palette. `four` forces the
+// four-color interpretation, as BC2 and BC3 do.
+__attribute__((always_inline))
+static inline void color_palette(const uint8_t* block, bool four, uint8_t pal[16])
+{
+    uint32_t c0 = block[0] | (block[1] << 8);
+    uint32_t c1 = block[2] | (block[3] << 8);
+    uint32_t e0[3] = { widen5(c0 >> 11), widen6((c0 >> 5) & 63), widen5(c0 & 31) };
+    uint32_t e1[3] = { widen5(c1 >> 11), widen6((c1 >> 5) & 63), widen5(c1 & 31) };
+    if (c0 > c1)
+        four = true;
+    for (uint32_t c = 0; c < 3; c++) {
+        pal[c] = (uint8_t)e0[c];
+        pal[4 + c] = (uint8_t)e1[c];
+        pal[8 + c] = (uint8_t)(four ? (2 * e0[c] + e1[c] + 1) / 3 : (e0[c] + e1[c] + 1) / 2);
+        pal[12 + c] = (uint8_t)(four ? (e0[c] + 2 * e1[c] + 1) / 3 : 0);
+    }
+    pal[3] = pal[7] = pal[11] = 0xFF;
+    pal[15] = four ? 0xFF : 0;
+}
+
+// The eight entries of an interpolated single-channel block
+__attribute__((always_inline))
+static inline void alpha_palette(uint32_t a0, uint32_t a1, uint8_t pal[8])
+{
+    pal[0] = (uint8_t)a0;
+    pal[1] = (uint8_t)a1;
+    if (a0 > a1) {
+        for (uint32_t i = 2; i < 8; i++)
+            pal[i] = (uint8_t)(((8 - i) * a0 + (i - 1) * a1 + 3) / 7);
+    } else {
+        for (uint32_t i = 2; i < 6; i++)
+            pal[i] = (uint8_t)(((6 - i) * a0 + (i - 1) * a1 + 2) / 5);
+        pal[6] = 0;
+        pal[7] = 0xFF;
+    }
+}
+
+#pragma mark - Scalar kernels
+
+static void bounds_scalar(const uint8_t* px, uint8_t lo[4], uint8_t hi[4])
+{
+    for (uint32_t c = 0; c < 4; c++)
+        lo[c] = hi[c] = px[c];
+    for (uint32_t i = 4; i < 64; i += 4) {
+        for (uint32_t c = 0; c < 4; c++) {
+            if (px[i + c] < lo[c]) lo[c] = px[i + c];
+            if (px[i + c] > hi[c]) hi[c] = px[i + c];
+        }
+    }
+}
+
+static void moments_scalar(const uint8_t* px, int32_t sum[3], int32_t product[6])
+{
+    memset(sum, 0, 3 * sizeof(int32_t));
+    memset(product, 0, 6 * sizeof(int32_t));
+    for (uint32_t i = 0; i < 64; i += 4) {
+        int32_t r = px[i], g = px[i + 1], b = px[i + 2];
+        sum[0] += r;
+        sum[1] += g;
+        sum[2] += b;
+        product[0] += r * r;
+        product[1] += g * g;
+        product[2] += b * b;
+        product[3] += r * g;
+        product[4] += r * b;
+        product[5] += g * b;
+    }
+}
+
+static inline int32_t dot3(const uint8_t* p, const int16_t* dir)
+{
+    return p[0] * dir[0] + p[1] * dir[1] + p[2] * dir[2];
+}
+
+static void project_scalar(const uint8_t* px, const int16_t dir[3], int32_t* lo, int32_t* hi)
+{
+    *lo = *hi = dot3(px, dir);
+    for (uint32_t i = 4; i < 64; i += 4) {
+        int32_t d = dot3(px + i, dir);
+        if (d < *lo) *lo = d;
+        if (d > *hi) *hi = d;
+    }
+}
+
+static uint32_t color_index_scalar(const uint8_t* px, const int16_t dir[3], const int32_t threshold[3],
+                                   const uint8_t code[4], bool transparent)
+{
+    uint32_t out = 0;
+    for (uint32_t i = 0; i < 16; i++) {
+        int32_t d = 2 * dot3(px + 4 * i, dir);
+        uint32_t n = (d > threshold[0]) + (d > threshold[1]) + (d > threshold[2]);
+        uint32_t c = transparent && px[4 * i + 3] < 128 ? 3 : code[n];
+        out |= c << (2 * i);
+    }
+    return out;
+}
+
+static uint64_t alpha_index_scalar(const uint8_t* px, uint32_t channel, const int16_t threshold[7],
+                                   const uint8_t code[8])
+{
+    uint64_t out = 0;
+    for (uint32_t i = 0; i < 16; i++) {
+        int32_t v = 2 * px[4 * i + channel];
+        uint32_t n = 0;
+        for (uint32_t k = 0; k < 7; k++)
+            n += v > threshold[k];
+        out |= (uint64_t)code[n] << (3 * i);
+    }
+    return out;
+}
+
+// One block to 16 RGBA8 pixels
+static void decode_block_scalar(VMBlockFormat format, const uint8_t* s, uint8_t* px)
+{
+    uint8_t pal[16], apal[8], gpal[8];
+    uint32_t bits;
+    uint64_t abits, gbits;
+
+    switch (format) {
+        case kVMBlockFormatBC1:
+            color_palette(s, false, pal);
+            bits = load_le32(s + 4);
+            for (uint32_t i = 0; i < 16; i++)
+                memcpy(px + 4 * i, pal + 4 * ((bits >> (2 * i)) & 3), 4);
+            break;
+        case kVMBlockFormatBC2:
+            color_palette(s + 8, true, pal);
+            bits = load_le32(s + 12);
+            abits = load_le32(s) | ((uint64_t)load_le32(s + 4) << 32);
+            for (uint32_t i = 0; i < 16; i++) {
+                memcpy(px + 4 * i, pal + 4 * ((bits >> (2 * i)) & 3), 3);
+                px[4 * i + 3] = (uint8_t)(((abits >> (4 * i)) & 15) * 17);
+            }
+            break;
+        case kVMBlockFormatBC3:
+            color_palette(s + 8, true, pal);
+            alpha_palette(s[0], s[1], apal);
+            bits = load_le32(s + 12);
+            abits = load_le48(s + 2);
+            for (uint32_t i = 0; i < 16; i++) {
+                memcpy(px + 4 * i, pal + 4 * ((bits >> (2 * i)) & 3), 3);
+                px[4 * i + 3] = apal[(abits >> (3 * i)) & 7];
+            }
+            break;
+        case kVMBlockFormatBC4:
+            alpha_palette(s[0], s[1], apal);
+            abits = load_le48(s + 2);
+            for (uint32_t i = 0; i < 16; i++) {
+                px[4 * i] = apal[(abits >> (3 * i)) & 7];
+                px[4 * i + 1] = px[4 * i + 2] = 0;
+                px[4 * i + 3] = 0xFF;
+            }
+            break;
+        case kVMBlockFormatBC5:
+            alpha_palette(s[0], s[1], apal);
+            alpha_palette(s[8], s[9], gpal);
+            abits = load_le48(s + 2);
+            gbits = load_le48(s + 10);
+            for (uint32_t i = 0; i < 16; i++) {
+                px[4 * i] = apal[(abits >> (3 * i)) & 7];
+                px[4 * i + 1] = gpal[(gbits >> (3 * i)) & 7];
+                px[4 * i + 2] = 0;
+                px[4 * i + 3] = 0xFF;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static inline void decode_run_scalar(VMBlockFormat format, uint8_t* d, uint32_t rowBytes,
+                                     const uint8_t* s, uint32_t count, bool bgra)
+{
+    for (uint32_t i = 0; i < count; i++, d += 16, s += s_block_bytes[format]) {
+        uint8_t px[64];
+        decode_block_scalar(format, s, px);
+        if (bgra)
+            swap_rb(px, 16);
+        for (uint32_t y = 0; y < 4; y++)
+            memcpy(d + (size_t)y * rowBytes, px + 16 * y, 16);
+    }
+}
+
+static void decode_bc1_scalar(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    decode_run_scalar(kVMBlockFormatBC1, d, rowBytes, s, count, bgra);
+}
+
+static void decode_bc2_scalar(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    decode_run_scalar(kVMBlockFormatBC2, d, rowBytes, s, count, bgra);
+}
+
+static void decode_bc3_scalar(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    decode_run_scalar(kVMBlockFormatBC3, d, rowBytes, s, count, bgra);
+}
+
+static void decode_bc4_scalar(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    decode_run_scalar(kVMBlockFormatBC4, d, rowBytes, s, count, bgra);
+}
+
+static void decode_bc5_scalar(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    decode_run_scalar(kVMBlockFormatBC5, d, rowBytes, s, count, bgra);
+}
+
+#if VMBLOCKCOMPRESS_HAVE_SIMD
+
+#pragma mark - SSE2 helpers
+
+// Index expansion is SSE2 arithmetic: each 16-bit lane holds the word the
+// index sits in, a multiply shifts the index to the top of the lane and a
+// logical shift brings it down, dropping the bits above it.
+
+// 16 bytes 0-3 from the 32 index bits of a color block
+static inline __m128i color_indices_sse2(uint32_t bits)
+{
+    const __m128i mul = _mm_setr_epi16(1 << 14, 1 << 12, 1 << 10, 1 << 8, 1 << 6, 1 << 4, 1 << 2, 1);
+    __m128i lo = _mm_mullo_epi16(_mm_set1_epi16((int16_t)(bits & 0xFFFF)), mul);
+    __m128i hi = _mm_mullo_epi16(_mm_set1_epi16((int16_t)(bits >> 16)), mul);
+    return _mm_packus_epi16(_mm_srli_epi16(lo, 14), _mm_srli_epi16(hi, 14));
+}
+
+// 16 bytes 0-7 from the 48 index bits at s. Indices 5-7 of each half
+// straddle its first 16 bits, so those lanes take the word a byte higher.
+static inline __m128i alpha_indices_sse2(const uint8_t* s)
+{
+    const __m128i mul = _mm_setr_epi16(1 << 13, 1 << 10, 1 << 7, 1 << 4, 1 << 1, 1 << 6, 1 << 3, 1);
+    int16_t l0 = (int16_t)(s[0] | (s[1] << 8)), l1 = (int16_t)(s[1] | (s[2] << 8));
+    int16_t h0 = (int16_t)(s[3] | (s[4] << 8)), h1 = (int16_t)(s[4] | (s[5] << 8));
+    __m128i lo = _mm_mullo_epi16(_mm_setr_epi16(l0, l0, l0, l0, l0, l1, l1, l1), mul);
+    __m128i hi = _mm_mullo_epi16(_mm_setr_epi16(h0, h0, h0, h0, h0, h1, h1, h1), mul);
+    return _mm_packus_epi16(_mm_srli_epi16(lo, 13), _mm_srli_epi16(hi, 13));
+}
+
+// 16 bytes of 4-bit explicit alpha, widened to 8 bits
+static inline __m128i explicit_alpha_sse2(const uint8_t* s)
+{
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i v = _mm_loadl_epi64((const __m128i*)s);
+    __m128i a = _mm_unpacklo_epi8(_mm_and_si128(v, nibble), _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+    return _mm_or_si128(a, _mm_slli_epi16(a, 4));
+}
+
+static inline __m128i min_epi32_sse2(__m128i a, __m128i b)
+{
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+}
+
+static inline __m128i max_epi32_sse2(__m128i a, __m128i b)
+{
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+}
+
+static inline int32_t hsum_epi32(__m128i v)
+{
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+
+// pshufb control taking bytes 4y..4y+3 of a vector of 16 values to byte
+// `pos` of four pixels, clearing the other bytes
+static inline __m128i spread_control(uint32_t y, uint32_t pos)
+{
+    uint8_t control[16];
+    memset(control, 0x80, 16);
+    for (uint32_t k = 0; k < 4; k++)
+        control[4 * k + pos] = (uint8_t)(4 * y + k);
+    return _mm_loadu_si128((const __m128i*)control);
+}
+
+static void bounds_sse2(const uint8_t* px, uint8_t lo[4], uint8_t hi[4])
+{
+    __m128i r0 = _mm_loadu_si128((const __m128i*)px);
+    __m128i r1 = _mm_loadu_si128((const __m128i*)(px + 16));
+    __m128i r2 = _mm_loadu_si128((const __m128i*)(px + 32));
+    __m128i r3 = _mm_loadu_si128((const __m128i*)(px + 48));
+    __m128i mn = _mm_min_epu8(_mm_min_epu8(r0, r1), _mm_min_epu8(r2, r3));
+    __m128i mx = _mm_max_epu8(_mm_max_epu8(r0, r1), _mm_max_epu8(r2, r3));
+    mn = _mm_min_epu8(mn, _mm_srli_si128(mn, 8));
+    mx = _mm_max_epu8(mx, _mm_srli_si128(mx, 8));
+    mn = _mm_min_epu8(mn, _mm_srli_si128(mn, 4));
+    mx = _mm_max_epu8(mx, _mm_srli_si128(mx, 4));
+    uint32_t l = (uint32_t)_mm_cvtsi128_si32(mn), h = (uint32_t)_mm_cvtsi128_si32(mx);
+    memcpy(lo, &l, 4);
+    memcpy(hi, &h, 4);
+}
+
+#pragma mark - SSSE3 kernels
+
+// Helpers are forced inline so that the AVX2 kernels get them VEX-encoded.
+
+// The 16 values of one channel, in pixel order
+__attribute__((always_inline, target("ssse3")))
+static inline __m128i channel_ssse3(const uint8_t* px, uint32_t channel)
+{
+    const __m128i m = _mm_set1_epi32((int32_t)(0x0C080400u + 0x01010101u * channel));
+    __m128i t0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)px), m);
+    __m128i t1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(px + 16)), m);
+    __m128i t2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(px + 32)), m);
+    __m128i t3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(px + 48)), m);
+    return _mm_unpacklo_epi64(_mm_unpacklo_epi32(t0, t1), _mm_unpacklo_epi32(t2, t3));
+}
+
+// dot(pixel, dir) for the four pixels of row y
+__attribute__((always_inline, target("ssse3")))
+static inline __m128i row_dots_ssse3(const uint8_t* px, uint32_t y, __m128i dir)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i row = _mm_loadu_si128((const __m128i*)(px + 16 * y));
+    __m128i l = _mm_madd_epi16(_mm_unpacklo_epi8(row, zero), dir);
+    __m128i h = _mm_madd_epi16(_mm_unpackhi_epi8(row, zero), dir);
+    return _mm_hadd_epi32(l, h);
+}
+
+static inline __m128i dir_vector(const int16_t dir[3])
+{
+    return _mm_setr_epi16(dir[0], dir[1], dir[2], 0, dir[0], dir[1], dir[2], 0);
+}
+
+// Threshold counts (one byte per pixel) to packed 2-bit color indices
+__attribute__((always_inline, target("ssse3")))
+static inline uint32_t color_codes_ssse3(__m128i counts, const uint8_t* px, const uint8_t code[4],
+                                         bool transparent)
+{
+    __m128i c = _mm_shuffle_epi8(_mm_cvtsi32_si128((int32_t)load_le32(code)), counts);
+    if (transparent) {
+        __m128i clear = _mm_cmpgt_epi8(channel_ssse3(px, 3), _mm_set1_epi8(-1));
+        c = _mm_or_si128(c, _mm_and_si128(clear, _mm_set1_epi8(3)));
+    }
+    c = _mm_maddubs_epi16(c, _mm_set1_epi16(0x0401));
+    c = _mm_madd_epi16(c, _mm_set1_epi32(0x00100001));
+    c = _mm_packs_epi32(c, c);
+    return (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(c, c));
+}
+
+// Threshold counts to packed 3-bit indices
+__attribute__((always_inline, target("ssse3")))
+static inline uint64_t alpha_codes_ssse3(__m128i counts, const uint8_t code[8])
+{
+    __m128i c = _mm_shuffle_epi8(_mm_loadl_epi64((const __m128i*)code), counts);
+    c = _mm_maddubs_epi16(c, _mm_set1_epi16(0x0801));
+    c = _mm_madd_epi16(c, _mm_set1_epi32(0x00400001));
+    uint32_t q[4];
+    _mm_storeu_si128((__m128i*)q, c);
+    return q[0] | ((uint64_t)q[1] << 12) | ((uint64_t)q[2] << 24) | ((uint64_t)q[3] << 36);
+}
+
+__attribute__((target("ssse3")))
+static void moments_ssse3(const uint8_t* px, int32_t sum[3], int32_t product[6])
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    __m128i ch[3][2];
+    for (uint32_t c = 0; c < 3; c++) {
+        __m128i v = channel_ssse3(px, c);
+        ch[c][0] = _mm_unpacklo_epi8(v, zero);
+        ch[c][1] = _mm_unpackhi_epi8(v, zero);
+    }
+    static const uint8_t pairs[6][2] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 0, 1 }, { 0, 2 }, { 1, 2 } };
+    for (uint32_t c = 0; c < 3; c++)
+        sum[c] = hsum_epi32(_mm_add_epi32(_mm_madd_epi16(ch[c][0], one), _mm_madd_epi16(ch[c][1], one)));
+    for (uint32_t p = 0; p < 6; p++) {
+        const __m128i* a = ch[pairs[p][0]];
+        const __m128i* b = ch[pairs[p][1]];
+        product[p] = hsum_epi32(_mm_add_epi32(_mm_madd_epi16(a[0], b[0]), _mm_madd_epi16(a[1], b[1])));
+    }
+}
+
+__attribute__((target("ssse3")))
+static void project_ssse3(const uint8_t* px, const int16_t dir[3], int32_t* lo, int32_t* hi)
+{
+    __m128i d = dir_vector(dir);
+    __m128i mn = row_dots_ssse3(px, 0, d), mx = mn;
+    for (uint32_t y = 1; y < 4; y++) {
+        __m128i v = row_dots_ssse3(px, y, d);
+        mn = min_epi32_sse2(mn, v);
+        mx = max_epi32_sse2(mx, v);
+    }
+    mn = min_epi32_sse2(mn, _mm_shuffle_epi32(mn, _MM_SHUFFLE(1, 0, 3, 2)));
+    mx = max_epi32_sse2(mx, _mm_shuffle_epi32(mx, _MM_SHUFFLE(1, 0, 3, 2)));
+    mn = min_epi32_sse2(mn, _mm_shuffle_epi32(mn, _MM_SHUFFLE(2, 3, 0, 1)));
+    mx = max_epi32_sse2(mx, _mm_shuffle_epi32(mx, _MM_SHUFFLE(2, 3, 0, 1)));
+    *lo = _mm_cvtsi128_si32(mn);
+    *hi = _mm_cvtsi128_si32(mx);
+}
+
+__attribute__((target("ssse3")))
+static uint32_t color_index_ssse3(const uint8_t* px, const int16_t dir[3], const int32_t threshold[3],
+                                  const uint8_t code[4], bool transparent)
+{
+    __m128i d = dir_vector(dir);
+    __m128i t0 = _mm_set1_epi32(threshold[0]);
+    __m128i t1 = _mm_set1_epi32(threshold[1]);
+    __m128i t2 = _mm_set1_epi32(threshold[2]);
+    __m128i n[4];
+    for (uint32_t y = 0; y < 4; y++) {
+        __m128i v = _mm_slli_epi32(row_dots_ssse3(px, y, d), 1);
+        __m128i c = _mm_add_epi32(_mm_cmpgt_epi32(v, t0), _mm_cmpgt_epi32(v, t1));
+        n[y] = _mm_sub_epi32(_mm_setzero_si128(), _mm_add_epi32(c, _mm_cmpgt_epi32(v, t2)));
+    }
+    __m128i counts = _mm_packs_epi16(_mm_packs_epi32(n[0], n[1]), _mm_packs_epi32(n[2], n[3]));
+    return color_codes_ssse3(counts, px, code, transparent);
+}
+
+__attribute__((target("ssse3")))
+static uint64_t alpha_index_ssse3(const uint8_t* px, uint32_t channel, const int16_t threshold[7],
+                                  const uint8_t code[8])
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v = channel_ssse3(px, channel);
+    __m128i lo = _mm_slli_epi16(_mm_unpacklo_epi8(v, zero), 1);
+    __m128i hi = _mm_slli_epi16(_mm_unpackhi_epi8(v, zero), 1);
+    __m128i nlo = zero, nhi = zero;
+    for (uint32_t k = 0; k < 7; k++) {
+        __m128i t = _mm_set1_epi16(threshold[k]);
+        nlo = _mm_sub_epi16(nlo, _mm_cmpgt_epi16(lo, t));
+        nhi = _mm_sub_epi16(nhi, _mm_cmpgt_epi16(hi, t));
+    }
+    return alpha_codes_ssse3(_mm_packus_epi16(nlo, nhi), code);
+}
+
+// Decoding looks every index up in the block's palette with one pshufb:
+// color palettes are 4 pixels of 4 bytes, so row y's control byte k is
+// 4 * index[4y + k/4] + k%4; single-channel palettes are 8 bytes.
+
+struct VMColorControls {
+    __m128i spread[4];      // index byte 4y + k/4 to control byte k
+    __m128i offset;         // k % 4
+};
+
+static inline void color_controls(VMColorControls* c)
+{
+    for (uint32_t y = 0; y < 4; y++)
+        c->spread[y] = _mm_setr_epi8(4 * y, 4 * y, 4 * y, 4 * y, 4 * y + 1, 4 * y + 1, 4 * y + 1, 4 * y + 1,
+                                     4 * y + 2, 4 * y + 2, 4 * y + 2, 4 * y + 2, 4 * y + 3, 4 * y + 3, 4 * y + 3, 4 * y + 3);
+    c->offset = _mm_set1_epi32(0x03020100);
+}
+
+__attribute__((always_inline, target("ssse3")))
+static inline void color_rows_ssse3(const uint8_t* block, bool four, bool bgra, const VMColorControls* c,
+                                    __m128i rows[4])
+{
+    uint8_t pal[16];
+    color_palette(block, four, pal);
+    if (bgra)
+        swap_rb(pal, 4);
+    __m128i p = _mm_loadu_si128((const __m128i*)pal);
+    __m128i index = _mm_slli_epi16(color_indices_sse2(load_le32(block + 4)), 2);
+    for (uint32_t y = 0; y < 4; y++)
+        rows[y] = _mm_shuffle_epi8(p, _mm_add_epi8(_mm_shuffle_epi8(index, c->spread[y]), c->offset));
+}
+
+__attribute__((always_inline, target("ssse3")))
+static inline __m128i alpha_values_ssse3(const uint8_t* block)
+{
+    uint8_t pal[8];
+    alpha_palette(block[0], block[1], pal);
+    return _mm_shuffle_epi8(_mm_loadl_epi64((const __m128i*)pal), alpha_indices_sse2(block + 2));
+}
+
+__attribute__((target("ssse3")))
+static void decode_bc1_ssse3(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    VMColorControls c;
+    color_controls(&c);
+    for (uint32_t i = 0; i < count; i++, d += 16, s += 8) {
+        __m128i rows[4];
+        color_rows_ssse3(s, false, bgra, &c, rows);
+        for (uint32_t y = 0; y < 4; y++)
+            _mm_storeu_si128((__m128i*)(d + (size_t)y * rowBytes), rows[y]);
+    }
+}
+
+__attribute__((target("ssse3")))
+static void decode_bc2_ssse3(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    VMColorControls c;
+    color_controls(&c);
+    __m128i spread[4];
+    for (uint32_t y = 0; y < 4; y++)
+        spread[y] = spread_control(y, 3);
+    const __m128i rgb = _mm_set1_epi32(0x00FFFFFF);
+    for (uint32_t i = 0; i < count; i++, d += 16, s += 16) {
+        __m128i rows[4];
+        color_rows_ssse3(s + 8, true, bgra, &c, rows);
+        __m128i a = explicit_alpha_sse2(s);
+        for (uint32_t y = 0; y < 4; y++)
+            _mm_storeu_si128((__m128i*)(d + (size_t)y * rowBytes),
+                             _mm_or_si128(_mm_and_si128(rows[y], rgb), _mm_shuffle_epi8(a, spread[y])));
+    }
+}
+
+__attribute__((target("ssse3")))
+static void decode_bc3_ssse3(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    VMColorControls c;
+    color_controls(&c);
+    __m128i spread[4];
+    for (uint32_t y = 0; y < 4; y++)
+        spread[y] = spread_control(y, 3);
+    const __m128i rgb = _mm_set1_epi32(0x00FFFFFF);
+    for (uint32_t i = 0; i < count; i++, d += 16, s += 16) {
+        __m128i rows[4];
+        color_rows_ssse3(s + 8, true, bgra, &c, rows);
+        __m128i a = alpha_values_ssse3(s);
+        for (uint32_t y = 0; y < 4; y++)
+            _mm_storeu_si128((__m128i*)(d + (size_t)y * rowBytes),
+                             _mm_or_si128(_mm_and_si128(rows[y], rgb), _mm_shuffle_epi8(a, spread[y])));
+    }
+}
+
+__attribute__((target("ssse3")))
+static void decode_bc4_ssse3(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    __m128i spread[4];
+    for (uint32_t y = 0; y < 4; y++)
+        spread[y] = spread_control(y, bgra ? 2 : 0);
+    const __m128i opaque = _mm_set1_epi32((int32_t)0xFF000000);
+    for (uint32_t i = 0; i < count; i++, d += 16, s += 8) {
+        __m128i r = alpha_values_ssse3(s);
+        for (uint32_t y = 0; y < 4; y++)
+            _mm_storeu_si128((__m128i*)(d + (size_t)y * rowBytes),
+                             _mm_or_si128(_mm_shuffle_epi8(r, spread[y]), opaque));
+    }
+}
+
+__attribute__((target("ssse3")))
+static void decode_bc5_ssse3(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    __m128i spread_r[4], spread_g[4];
+    for (uint32_t y = 0; y < 4; y++) {
+        spread_r[y] = spread_control(y, bgra ? 2 : 0);
+        spread_g[y] = spread_control(y, 1);
+    }
+    const __m128i opaque = _mm_set1_epi32((int32_t)0xFF000000);
+    for (uint32_t i = 0; i < count; i++, d += 16, s += 16) {
+        __m128i r = alpha_values_ssse3(s);
+        __m128i g = alpha_values_ssse3(s + 8);
+        for (uint32_t y = 0; y < 4; y++) {
+            __m128i v = _mm_or_si128(_mm_shuffle_epi8(r, spread_r[y]), _mm_shuffle_epi8(g, spread_g[y]));
+            _mm_storeu_si128((__m128i*)(d + (size_t)y * rowBytes), _mm_or_si128(v, opaque));
+        }
+    }
+}
+
+#pragma mark - AVX2 kernels
+
+// The encoder kernels take all 16 pixels in 256-bit registers; the
+// decoders expand two horizontally adjacent blocks at once, one per
+// 128-bit lane, so each row of the pair is one 32-byte store. An odd
+// last block goes through the inlined SSSE3 helpers. Every kernel clears
+// the upper YMM halves before returning to SSE code.
+
+__attribute__((always_inline, target("avx2")))
+static inline __m256i pair(__m128i lo, __m128i hi)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+// dot(pixel, dir) for pixels 0-7 (rows 0 and 1) or 8-15 (rows 2 and 3);
+// within each lane, hadd keeps pixel order
+__attribute__((always_inline, target("avx2")))
+static inline __m256i half_dots_avx2(const uint8_t* px, __m256i dir)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i v = _mm256_loadu_si256((const __m256i*)px);
+    __m256i l = _mm256_madd_epi16(_mm256_unpacklo_epi8(v, zero), dir);
+    __m256i h = _mm256_madd_epi16(_mm256_unpackhi_epi8(v, zero), dir);
+    return _mm256_hadd_epi32(l, h);
+}
+
+__attribute__((target("avx2")))
+static void moments_avx2(const uint8_t* px, int32_t sum[3], int32_t product[6])
+{
+    const __m256i one = _mm256_set1_epi16(1);
+    __m256i ch[3];
+    for (uint32_t c = 0; c < 3; c++)
+        ch[c] = _mm256_cvtepu8_epi16(channel_ssse3(px, c));
+    static const uint8_t pairs[6][2] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 0, 1 }, { 0, 2 }, { 1, 2 } };
+    for (uint32_t c = 0; c < 3; c++) {
+        __m256i v = _mm256_madd_epi16(ch[c], one);
+        sum[c] = hsum_epi32(_mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
+    }
+    for (uint32_t p = 0; p < 6; p++) {
+        __m256i v = _mm256_madd_epi16(ch[pairs[p][0]], ch[pairs[p][1]]);
+        product[p] = hsum_epi32(_mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
+    }
+    _mm256_zeroupper();
+}
+
+__attribute__((target("avx2")))
+static void project_avx2(const uint8_t* px, const int16_t dir[3], int32_t* lo, int32_t* hi)
+{
+    __m256i d = _mm256_broadcastsi128_si256(dir_vector(dir));
+    __m256i a = half_dots_avx2(px, d);
+    __m256i b = half_dots_avx2(px + 32, d);
+    __m256i mn256 = _mm256_min_epi32(a, b), mx256 = _mm256_max_epi32(a, b);
+    __m128i mn = _mm_min_epi32(_mm256_castsi256_si128(mn256), _mm256_extracti128_si256(mn256, 1));
+    __m128i mx = _mm_max_epi32(_mm256_castsi256_si128(mx256), _mm256_extracti128_si256(mx256, 1));
+    mn = _mm_min_epi32(mn, _mm_shuffle_epi32(mn, _MM_SHUFFLE(1, 0, 3, 2)));
+    mx = _mm_max_epi32(mx, _mm_shuffle_epi32(mx, _MM_SHUFFLE(1, 0, 3, 2)));
+    mn = _mm_min_epi32(mn, _mm_shuffle_epi32(mn, _MM_SHUFFLE(2, 3, 0, 1)));
+    mx = _mm_max_epi32(mx, _mm_shuffle_epi32(mx, _MM_SHUFFLE(2, 3, 0, 1)));
+    *lo = _mm_cvtsi128_si32(mn);
+    *hi = _mm_cvtsi128_si32(mx);
+    _mm256_zeroupper();
+}
+
+__attribute__((target("avx2")))
+static uint32_t color_index_avx2(const uint8_t* px, const int16_t dir[3], const int32_t threshold[3],
+                                 const uint8_t code[4], bool transparent)
+{
+    __m256i d = _mm256_broadcastsi128_si256(dir_vector(dir));
+    __m256i t0 = _mm256_set1_epi32(threshold[0]);
+    __m256i t1 = _mm256_set1_epi32(threshold[1]);
+    __m256i t2 = _mm256_set1_epi32(threshold[2]);
+    __m256i n[2];
+    for (uint32_t h = 0; h < 2; h++) {
+        __m256i v = _mm256_slli_epi32(half_dots_avx2(px + 32 * h, d), 1);
+        __m256i c = _mm256_add_epi32(_mm256_cmpgt_epi32(v, t0), _mm256_cmpgt_epi32(v, t1));
+        n[h] = _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_add_epi32(c, _mm256_cmpgt_epi32(v, t2)));
+    }
+    // packs interleaves the halves by lane; the permute puts pixels back in order
+    __m256i c16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(n[0], n[1]), _MM_SHUFFLE(3, 1, 2, 0));
+    __m128i counts = _mm_packs_epi16(_mm256_castsi256_si128(c16), _mm256_extracti128_si256(c16, 1));
+    uint32_t out = color_codes_ssse3(counts, px, code, transparent);
+    _mm256_zeroupper();
+    return out;
+}
+
+__attribute__((target("avx2")))
+static uint64_t alpha_index_avx2(const uint8_t* px, uint32_t channel, const int16_t threshold[7],
+                                 const uint8_t code[8])
+{
+    __m256i v = _mm256_slli_epi16(_mm256_cvtepu8_epi16(channel_ssse3(px, channel)), 1);
+    __m256i n = _mm256_setzero_si256();
+    for (uint32_t k = 0; k < 7; k++)
+        n = _mm256_sub_epi16(n, _mm256_cmpgt_epi16(v, _mm256_set1_epi16(threshold[k])));
+    uint64_t out = alpha_codes_ssse3(_mm_packus_epi16(_mm256_castsi256_si128(n), _mm256_extracti128_si256(n, 1)), code);
+    _mm256_zeroupper();
+    return out;
+}
+
+// Rows of two color blocks, one per lane
+__attribute__((always_inline, target("avx2")))
+static inline void color_rows_avx2(const uint8_t* b0, const uint8_t* b1, bool four, bool bgra,
+                                   const VMColorControls* c, __m256i rows[4])
+{
+    uint8_t pal[32];
+    color_palette(b0, four, pal);
+    color_palette(b1, four, pal + 16);
+    if (bgra)
+        swap_rb(pal, 8);
+    __m256i p = _mm256_loadu_si256((const __m256i*)pal);
+    __m256i index = _mm256_slli_epi16(pair(color_indices_sse2(load_le32(b0 + 4)),
+                                           color_indices_sse2(load_le32(b1 + 4))), 2);
+    __m256i offset = _mm256_broadcastsi128_si256(c->offset);
+    for (uint32_t y = 0; y < 4; y++) {
+        __m256i spread = _mm256_broadcastsi128_si256(c->spread[y]);
+        rows[y] = _mm256_shuffle_epi8(p, _mm256_add_epi8(_mm256_shuffle_epi8(index, spread), offset));
+    }
+}
+
+__attribute__((always_inline, target("avx2")))
+static inline __m256i alpha_values_avx2(const uint8_t* b0, const uint8_t* b1)
+{
+    uint8_t pal[16];
+    alpha_palette(b0[0], b0[1], pal);
+    alpha_palette(b1[0], b1[1], pal + 8);
+    __m256i p = pair(_mm_loadl_epi64((const __m128i*)pal), _mm_loadl_epi64((const __m128i*)(pal + 8)));
+    return _mm256_shuffle_epi8(p, pair(alpha_indices_sse2(b0 + 2), alpha_indices_sse2(b1 + 2)));
+}
+
+__attribute__((target("avx2")))
+static void decode_bc1_avx2(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    VMColorControls c;
+    color_controls(&c);
+    uint32_t i = 0;
+    for (; i + 2 <= count; i += 2, d += 32, s += 16) {
+        __m256i rows[4];
+        color_rows_avx2(s, s + 8, false, bgra, &c, rows);
+        for (uint32_t y = 0; y < 4; y++)
+            _mm256_storeu_si256((__m256i*)(d + (size_t)y * rowBytes), rows[y]);
+    }
+    if (i < count) {
+        __m128i rows[4];
+        color_rows_ssse3(s, false, bgra, &c, rows);
+        for (uint32_t y = 0; y < 4; y++)
+            _mm_storeu_si128((__m128i*)(d + (size_t)y * rowBytes), rows[y]);
+    }
+    _mm256_zeroupper();
+}
+
+__attribute__((target("avx2")))
+static void decode_bc3_avx2(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    VMColorControls c;
+    color_controls(&c);
+    __m128i spread[4];
+    for (uint32_t y = 0; y < 4; y++)
+        spread[y] = spread_control(y, 3);
+    const __m256i rgb = _mm256_set1_epi32(0x00FFFFFF);
+    uint32_t i = 0;
+    for (; i + 2 <= count; i += 2, d += 32, s += 32) {
+        __m256i rows[4];
+        color_rows_avx2(s + 8, s + 24, true, bgra, &c, rows);
+        __m256i a = alpha_values_avx2(s, s + 16);
+        for (uint32_t y = 0; y < 4; y++) {
+            __m256i alpha = _mm256_shuffle_epi8(a, _mm256_broadcastsi128_si256(spread[y]));
+            _mm256_storeu_si256((__m256i*)(d + (size_t)y * rowBytes),
+                                _mm256_or_si256(_mm256_and_si256(rows[y], rgb), alpha));
+        }
+    }
+    if (i < count) {
+        __m128i rows[4];
+        color_rows_ssse3(s + 8, true, bgra, &c, rows);
+        __m128i a = alpha_values_ssse3(s);
+        for (uint32_t y = 0; y < 4; y++)
+            _mm_storeu_si128((__m128i*)(d + (size_t)y * rowBytes),
+                             _mm_or_si128(_mm_and_si128(rows[y], _mm256_castsi256_si128(rgb)),
+                                          _mm_shuffle_epi8(a, spread[y])));
+    }
+    _mm256_zeroupper();
+}
+
+__attribute__((target("avx2")))
+static void decode_bc4_avx2(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    __m128i spread[4];
+    for (uint32_t y = 0; y < 4; y++)
+        spread[y] = spread_control(y, bgra ? 2 : 0);
+    const __m256i opaque = _mm256_set1_epi32((int32_t)0xFF000000);
+    uint32_t i = 0;
+    for (; i + 2 <= count; i += 2, d += 32, s += 16) {
+        __m256i r = alpha_values_avx2(s, s + 8);
+        for (uint32_t y = 0; y < 4; y++)
+            _mm256_storeu_si256((__m256i*)(d + (size_t)y * rowBytes),
+                                _mm256_or_si256(_mm256_shuffle_epi8(r, _mm256_broadcastsi128_si256(spread[y])), opaque));
+    }
+    if (i < count) {
+        __m128i r = alpha_values_ssse3(s);
+        for (uint32_t y = 0; y < 4; y++)
+            _mm_storeu_si128((__m128i*)(d + (size_t)y * rowBytes),
+                             _mm_or_si128(_mm_shuffle_epi8(r, spread[y]), _mm256_castsi256_si128(opaque)));
+    }
+    _mm256_zeroupper();
+}
+
+__attribute__((target("avx2")))
+static void decode_bc5_avx2(uint8_t* d, uint32_t rowBytes, const uint8_t* s, uint32_t count, bool bgra)
+{
+    __m128i spread_r[4], spread_g[4];
+    for (uint32_t y = 0; y < 4; y++) {
+        spread_r[y] = spread_control(y, bgra ? 2 : 0);
+        spread_g[y] = spread_control(y, 1);
+    }
+    const __m256i opaque = _mm256_set1_epi32((int32_t)0xFF000000);
+    uint32_t i = 0;
+    for (; i + 2 <= count; i += 2, d += 32, s += 32) {
+        __m256i r = alpha_values_avx2(s, s + 16);
+        __m256i g = alpha_values_avx2(s + 8, s + 24);
+        for (uint32_t y = 0; y < 4; y++) {
+            __m256i v = _mm256_or_si256(_mm256_shuffle_epi8(r, _mm256_broadcastsi128_si256(spread_r[y])),
+                                        _mm256_shuffle_epi8(g, _mm256_broadcastsi128_si256(spread_g[y])));
+            _mm256_storeu_si256((__m256i*)(d + (size_t)y * rowBytes), _mm256_or_si256(v, opaque));
+        }
+    }
+    if (i < count) {
+        __m128i r = alpha_values_ssse3(s);
+        __m128i g = alpha_values_ssse3(s + 8);
+        for (uint32_t y = 0; y < 4; y++) {
+            __m128i v = _mm_or_si128(_mm_shuffle_epi8(r, spread_r[y]), _mm_shuffle_epi8(g, spread_g[y]));
+            _mm_storeu_si128((__m128i*)(d + (size_t)y * rowBytes), _mm_or_si128(v, _mm256_castsi256_si128(opaque)));
+        }
+    }
+    _mm256_zeroupper();
+}
+
+#endif /* VMBLOCKCOMPRESS_HAVE_SIMD */
+
+#pragma mark - Dispatch
+
+static void build_quant_tables()
+{
+    for (uint32_t v = 0; v < 256; v++) {
+        uint32_t best5 = 0, best6 = 0;
+        for (uint32_t q = 1; q < 64; q++) {
+            if (q < 32 && (int32_t)(widen5(q) - v) * (int32_t)(widen5(q) - v) <
+                          (int32_t)(widen5(best5) - v) * (int32_t)(widen5(best5) - v))
+                best5 = q;
+            if ((int32_t)(widen6(q) - v) * (int32_t)(widen6(q) - v) <
+                (int32_t)(widen6(best6) - v) * (int32_t)(widen6(best6) - v))
+                best6 = q;
+        }
+        s_quant5[v] = (uint8_t)best5;
+        s_quant6[v] = (uint8_t)best6;
+    }
+}
+
+VMBlit2DPath VMBlockCompressSetPath(VMBlit2DPath path)
+{
+    VMBlit2DPath best = VMBlit2DBestPath();
+    if (path > best)
+        path = best;
+
+    s_k.bounds = bounds_scalar;
+    s_k.moments = moments_scalar;
+    s_k.project = project_scalar;
+    s_k.colorIndex = color_index_scalar;
+    s_k.alphaIndex = alpha_index_scalar;
+    s_k.decode[kVMBlockFormatInvalid] = nullptr;
+    s_k.decode[kVMBlockFormatBC1] = decode_bc1_scalar;
+    s_k.decode[kVMBlockFormatBC2] = decode_bc2_scalar;
+    s_k.decode[kVMBlockFormatBC3] = decode_bc3_scalar;
+    s_k.decode[kVMBlockFormatBC4] = decode_bc4_scalar;
+    s_k.decode[kVMBlockFormatBC5] = decode_bc5_scalar;
+    s_uses_ssse3 = false;
+
+#if VMBLOCKCOMPRESS_HAVE_SIMD
+    if (path != kVMBlit2DPathScalar)
+        s_k.bounds = bounds_sse2;
+    // Every AVX2 CPU has SSSE3
+    if (path != kVMBlit2DPathScalar && VMBlit2DHasSSSE3()) {
+        s_k.moments = moments_ssse3;
+        s_k.project = project_ssse3;
+        s_k.colorIndex = color_index_ssse3;
+        s_k.alphaIndex = alpha_index_ssse3;
+        s_k.decode[kVMBlockFormatBC1] = decode_bc1_ssse3;
+        s_k.decode[kVMBlockFormatBC2] = decode_bc2_ssse3;
+        s_k.decode[kVMBlockFormatBC3] = decode_bc3_ssse3;
+        s_k.decode[kVMBlockFormatBC4] = decode_bc4_ssse3;
+        s_k.decode[kVMBlockFormatBC5] = decode_bc5_ssse3;
+        s_uses_ssse3 = true;
+    }
+    if (path == kVMBlit2DPathAVX2) {
+        s_k.moments = moments_avx2;
+        s_k.project = project_avx2;
+        s_k.colorIndex = color_index_avx2;
+        s_k.alphaIndex = alpha_index_avx2;
+        s_k.decode[kVMBlockFormatBC1] = decode_bc1_avx2;
+        s_k.decode[kVMBlockFormatBC3] = decode_bc3_avx2;
+        s_k.decode[kVMBlockFormatBC4] = decode_bc4_avx2;
+        s_k.decode[kVMBlockFormatBC5] = decode_bc5_avx2;
+    }
+#else
+    path = kVMBlit2DPathScalar;
+#endif
+
+    if (!s_initialized)
+        build_quant_tables();
+    s_active_path = path;
+    s_initialized = true;
+    return path;
+}
+
+VMBlit2DPath VMBlockCompressActivePath()
+{
+    if (!s_initialized)
+        VMBlockCompressSetPath(VMBlit2DBestPath());
+    return s_active_path;
+}
+
+bool VMBlockCompressUsesSSSE3()
+{
+    if (!s_initialized)
+        VMBlockCompressSetPath(VMBlit2DBestPath());
+    return s_uses_ssse3;
+}
+
+uint32_t VMBlockFormatBytes(VMBlockFormat format)
+{
+    if (format <= kVMBlockFormatInvalid || format >= kVMBlockFormatCount)
+        return 0;
+    return s_block_bytes[format];
+}
+
+uint64_t VMBlockImageBytes(VMBlockFormat format, uint32_t width, uint32_t height)
+{
+    return (uint64_t)((width + 3) / 4) * ((height + 3) / 4) * VMBlockFormatBytes(format);
+}
+
+VMBlockQuality VMBlockQualityFromPercent(uint32_t percent)
+{
+    if (percent < 34)
+        return kVMBlockQualityFast;
+    if (percent < 67)
+        return kVMBlockQualityNormal;
+    return kVMBlockQualityHigh;
+}
+
+#pragma mark - Encoder
+
+static inline uint8_t clamp_round(float v)
+{
+    if (v <= 0.0f)
+        return 0;
+    if (v >= 255.0f)
+        return 255;
+    return (uint8_t)(v + 0.5f);
+}
+
+static inline uint32_t pack565(const uint8_t e[3])
+{
+    return (s_quant5[e[0]] << 11) | (s_quant6[e[1]] << 5) | s_quant5[e[2]];
+}
+
+// Quantize endpoints a and b into a color block and pick its indices.
+// Four colors need color0 > color1, three colors the opposite; a block
+// with transparent pixels always uses three.
+static void color_block(const uint8_t* px, const uint8_t a[3], const uint8_t b[3], bool four_only,
+                        bool transparent, uint8_t out[8])
+{
+    uint32_t c0 = pack565(a), c1 = pack565(b);
+    if (transparent ? c0 > c1 : c0 < c1) {
+        uint32_t t = c0;
+        c0 = c1;
+        c1 = t;
+    }
+    store_le(out, c0, 2);
+    store_le(out + 2, c1, 2);
+
+    uint8_t pal[16];
+    color_palette(out, four_only, pal);
+    bool four = four_only || c0 > c1;
+    int16_t dir[3] = { (int16_t)(pal[4] - pal[0]), (int16_t)(pal[5] - pal[1]), (int16_t)(pal[6] - pal[2]) };
+    int32_t d[4];
+    for (uint32_t k = 0; k < 4; k++)
+        d[k] = dot3(pal + 4 * k, dir);
+
+    // Palette order along dir: color0, 2, 3, color1 or color0, 2, color1
+    int32_t threshold[3];
+    uint8_t code[4];
+    if (four) {
+        threshold[0] = d[0] + d[2];
+        threshold[1] = d[2] + d[3];
+        threshold[2] = d[3] + d[1];
+        code[0] = 0; code[1] = 2; code[2] = 3; code[3] = 1;
+    } else {
+        threshold[0] = d[0] + d[2];
+        threshold[1] = d[2] + d[1];
+        threshold[2] = INT32_MAX;
+        code[0] = 0; code[1] = 2; code[2] = 1; code[3] = 1;
+    }
+    store_le(out + 4, s_k.colorIndex(px, dir, threshold, code, transparent), 4);
+}
+
+// Squared RGB error of a color block over its non-transparent pixels
+static uint32_t color_error(const uint8_t* px, const uint8_t block[8], bool four_only)
+{
+    uint8_t pal[16];
+    color_palette(block, four_only, pal);
+    uint32_t bits = load_le32(block + 4);
+    uint32_t error = 0;
+    for (uint32_t i = 0; i < 16; i++, px += 4) {
+        const uint8_t* p = pal + 4 * ((bits >> (2 * i)) & 3);
+        if (!p[3])
+            continue;
+        for (uint32_t c = 0; c < 3; c++)
+            error += (uint32_t)((px[c] - p[c]) * (px[c] - p[c]));
+    }
+    return error;
+}
+
+// Bounding box endpoints, inset by 1/16 of the extent
+static void fit_box(const uint8_t lo[4], const uint8_t hi[4], uint8_t a[3], uint8_t b[3])
+{
+    for (uint32_t c = 0; c < 3; c++) {
+        uint32_t inset = (uint32_t)(hi[c] - lo[c]) >> 4;
+        a[c] = (uint8_t)(hi[c] - inset);
+        b[c] = (uint8_t)(lo[c] + inset);
+    }
+}
+
+// The extremes of the block projected on its principal axis, found by
+// power iteration on the covariance. False for a block without one.
+static bool fit_axis(const uint8_t* px, uint8_t a[3], uint8_t b[3])
+{
+    int32_t sum[3], product[6];
+    s_k.moments(px, sum, product);
+
+    float cov[3][3];
+    static const uint8_t pairs[6][2] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 0, 1 }, { 0, 2 }, { 1, 2 } };
+    for (uint32_t p = 0; p < 6; p++) {
+        uint32_t i = pairs[p][0], j = pairs[p][1];
+        cov[i][j] = cov[j][i] = (float)product[p] - (float)sum[i] * (float)sum[j] / 16.0f;
+    }
+
+    // Apply the covariance four times to the unit vector of the largest
+    // variance, which is that column of its fourth power. Squaring twice
+    // keeps the dependency chains short. Each square is rescaled by its
+    // largest element, and elements that would decay into (very slow)
+    // denormals are flushed to zero.
+    uint32_t start = 0;
+    for (uint32_t c = 1; c < 3; c++)
+        if (cov[c][c] > cov[start][start])
+            start = c;
+    if (cov[start][start] < 1e-3f)
+        return false;
+    for (uint32_t step = 0; step < 2; step++) {
+        float square[3][3], scale = 0.0f;
+        for (uint32_t i = 0; i < 3; i++)
+            for (uint32_t j = 0; j < 3; j++) {
+                square[i][j] = cov[i][0] * cov[0][j] + cov[i][1] * cov[1][j] + cov[i][2] * cov[2][j];
+                float m = __builtin_fabsf(square[i][j]);
+                scale = m > scale ? m : scale;
+            }
+        float inverse = 1.0f / scale;
+        for (uint32_t i = 0; i < 3; i++)
+            for (uint32_t j = 0; j < 3; j++) {
+                float v = square[i][j] * inverse;
+                cov[i][j] = __builtin_fabsf(v) < 1e-12f ? 0.0f : v;
+            }
+    }
+    float axis[3] = { cov[0][start], cov[1][start], cov[2][start] }, scale = 0.0f;
+    for (uint32_t i = 0; i < 3; i++) {
+        float m = __builtin_fabsf(axis[i]);
+        scale = m > scale ? m : scale;
+    }
+    if (scale < 1e-6f)
+        return false;
+    for (uint32_t i = 0; i < 3; i++)
+        axis[i] /= scale;
+
+    int16_t dir[3];
+    float dd = 0.0f, dm = 0.0f;
+    for (uint32_t c = 0; c < 3; c++) {
+        dir[c] = (int16_t)(axis[c] * 256.0f + (axis[c] < 0.0f ? -0.5f : 0.5f));
+        dd += (float)dir[c] * dir[c];
+        dm += (float)dir[c] * sum[c] / 16.0f;
+    }
+    if (dd == 0.0f)
+        return false;
+
+    int32_t lo, hi;
+    s_k.project(px, dir, &lo, &hi);
+    for (uint32_t c = 0; c < 3; c++) {
+        float mean = sum[c] / 16.0f;
+        a[c] = clamp_round(mean + dir[c] * ((float)hi - dm) / dd);
+        b[c] = clamp_round(mean + dir[c] * ((float)lo - dm) / dd);
+    }
+    return true;
+}
+
+// Least-squares endpoints for the indices of a four-color block
+static bool refine_color(const uint8_t* px, const uint8_t block[8], uint8_t a[3], uint8_t b[3])
+{
+    // Weight of color1 per index, in thirds
+    static const int32_t kWeight[4] = { 0, 3, 1, 2 };
+    uint32_t bits = load_le32(block + 4);
+    int32_t aa = 0, ab = 0, bb = 0, x[3] = { 0, 0, 0 }, y[3] = { 0, 0, 0 };
+    for (uint32_t i = 0; i < 16; i++, px += 4) {
+        int32_t w = kWeight[(bits >> (2 * i)) & 3], u = 3 - w;
+        aa += u * u;
+        ab += u * w;
+        bb += w * w;
+        for (uint32_t c = 0; c < 3; c++) {
+            x[c] += u * px[c];
+            y[c] += w * px[c];
+        }
+    }
+    int32_t det = aa * bb - ab * ab;
+    if (det == 0)
+        return false;
+    for (uint32_t c = 0; c < 3; c++) {
+        a[c] = clamp_round(3.0f * (float)(bb * x[c] - ab * y[c]) / (float)det);
+        b[c] = clamp_round(3.0f * (float)(aa * y[c] - ab * x[c]) / (float)det);
+    }
+    return true;
+}
+
+static void encode_color(const uint8_t* px, const uint8_t lo[4], const uint8_t hi[4], VMBlockQuality quality,
+                         bool four_only, uint8_t out[8])
+{
+    bool transparent = !four_only && lo[3] < 128;
+    uint8_t work[64], box_lo[4], box_hi[4];
+    memcpy(box_lo, lo, 4);
+    memcpy(box_hi, hi, 4);
+    if (transparent) {
+        if (hi[3] < 128) {
+            static const uint8_t kClear[8] = { 0, 0, 0, 0, 0xFF, 0xFF, 0xFF, 0xFF };
+            memcpy(out, kClear, 8);
+            return;
+        }
+        // Transparent pixels take an opaque pixel's color so they do not
+        // pull the endpoints
+        const uint8_t* opaque = px;
+        while (opaque[3] < 128)
+            opaque += 4;
+        memcpy(work, px, 64);
+        for (uint32_t i = 0; i < 64; i += 4)
+            if (work[i + 3] < 128)
+                memcpy(work + i, opaque, 3);
+        px = work;
+        s_k.bounds(px, box_lo, box_hi);
+    }
+
+    uint8_t a[3], b[3];
+    if (quality == kVMBlockQualityFast || !fit_axis(px, a, b)) {
+        fit_box(box_lo, box_hi, a, b);
+        color_block(px, a, b, four_only, transparent, out);
+        return;
+    }
+    color_block(px, a, b, four_only, transparent, out);
+    if (quality != kVMBlockQualityHigh)
+        return;
+
+    uint32_t best = color_error(px, out, four_only);
+    uint8_t trial[8];
+    fit_box(box_lo, box_hi, a, b);
+    color_block(px, a, b, four_only, transparent, trial);
+    uint32_t error = color_error(px, trial, four_only);
+    uint8_t current[8];
+    memcpy(current, out, 8);
+    if (error < best) {
+        best = error;
+        memcpy(out, trial, 8);
+    }
+    if (transparent)
+        return;
+    for (uint32_t iteration = 0; iteration < 2 && best; iteration++) {
+        uint32_t endpoints = load_le32(current);
+        bool four = four_only || (endpoints & 0xFFFF) > (endpoints >> 16);
+        if (!four || !refine_color(px, current, a, b))
+            break;
+        color_block(px, a, b, four_only, false, current);
+        error = color_error(px, current, four_only);
+        if (error < best) {
+            best = error;
+            memcpy(out, current, 8);
+        }
+    }
+}
+
+// Pick the indices of a single-channel block whose endpoints are in
+// block[0] and block[1]
+static void alpha_block(const uint8_t* px, uint32_t channel, uint8_t block[8])
+{
+    // Palette entries in increasing order for each mode
+    static const uint8_t kEight[8] = { 1, 7, 6, 5, 4, 3, 2, 0 };
+    static const uint8_t kSix[8] = { 6, 0, 2, 3, 4, 5, 1, 7 };
+    const uint8_t* code = block[0] > block[1] ? kEight : kSix;
+    uint8_t pal[8];
+    alpha_palette(block[0], block[1], pal);
+    int16_t threshold[7];
+    for (uint32_t k = 0; k < 7; k++)
+        threshold[k] = (int16_t)(pal[code[k]] + pal[code[k + 1]]);
+    store_le(block + 2, s_k.alphaIndex(px, channel, threshold, code), 6);
+}
+
+static uint32_t alpha_error(const uint8_t* px, uint32_t channel, const uint8_t block[8])
+{
+    uint8_t pal[8];
+    alpha_palette(block[0], block[1], pal);
+    uint64_t bits = load_le48(block + 2);
+    uint32_t error = 0;
+    for (uint32_t i = 0; i < 16; i++) {
+        int32_t e = px[4 * i + channel] - pal[(bits >> (3 * i)) & 7];
+        error += (uint32_t)(e * e);
+    }
+    return error;
+}
+
+static void encode_alpha(const uint8_t* px, uint32_t channel, uint8_t lo, uint8_t hi, VMBlockQuality quality,
+                         uint8_t out[8])
+{
+    out[0] = hi;
+    out[1] = lo;
+    alpha_block(px, channel, out);
+    if (quality != kVMBlockQualityHigh || lo == hi || (lo != 0 && hi != 255))
+        return;
+
+    // Six interpolants between the values strictly inside (0, 255), with
+    // both ends exact
+    uint8_t inner_lo = 255, inner_hi = 0;
+    for (uint32_t i = 0; i < 16; i++) {
+        uint8_t v = px[4 * i + channel];
+        if (v == 0 || v == 255)
+            continue;
+        if (v < inner_lo) inner_lo = v;
+        if (v > inner_hi) inner_hi = v;
+    }
+    if (inner_lo > inner_hi)
+        inner_lo = inner_hi = 0;
+    uint8_t trial[8] = { inner_lo, inner_hi };
+    alpha_block(px, channel, trial);
+    if (alpha_error(px, channel, trial) < alpha_error(px, channel, out))
+        memcpy(out, trial, 8);
+}
+
+static void encode_block(VMBlockFormat format, const uint8_t* px, VMBlockQuality quality, uint8_t* out)
+{
+    uint8_t lo[4], hi[4];
+    s_k.bounds(px, lo, hi);
+    switch (format) {
+        case kVMBlockFormatBC1:
+            encode_color(px, lo, hi, quality, false, out);
+            break;
+        case kVMBlockFormatBC2: {
+            uint64_t alpha = 0;
+            for (uint32_t i = 0; i < 16; i++)
+                alpha |= (uint64_t)((px[4 * i + 3] + 8) / 17) << (4 * i);
+            store_le(out, alpha, 8);
+            encode_color(px, lo, hi, quality, true, out + 8);
+            break;
+        }
+        case kVMBlockFormatBC3:
+            encode_alpha(px, 3, lo[3], hi[3], quality, out);
+            encode_color(px, lo, hi, quality, true, out + 8);
+            break;
+        case kVMBlockFormatBC4:
+            encode_alpha(px, 0, lo[0], hi[0], quality, out);
+            break;
+        case kVMBlockFormatBC5:
+            encode_alpha(px, 0, lo[0], hi[0], quality, out);
+            encode_alpha(px, 1, lo[1], hi[1], quality, out + 8);
+            break;
+        default:
+            break;
+    }
+}
+
+#pragma mark - Image operations
+
+static inline bool is_rgba_format(VMPixelFormat format)
+{
+    return format == kVMPixelFormatRGBA8 || format == kVMPixelFormatBGRA8;
+}
+
+// The 4x4 block at (x, y) as RGBA8, repeating the last column and row
+// where it crosses the edge of the image
+static void load_block(const VMPixelImage* src, uint32_t x, uint32_t y, uint32_t width, uint32_t height,
+                       uint8_t px[64])
+{
+    if (x + 4 <= width && y + 4 <= height) {
+        for (uint32_t r = 0; r < 4; r++)
+            memcpy(px + 16 * r, src->base + (size_t)(y + r) * src->rowBytes + (size_t)x * 4, 16);
+    } else {
+        for (uint32_t r = 0; r < 4; r++) {
+            uint32_t sy = y + r < height ? y + r : height - 1;
+            for (uint32_t c = 0; c < 4; c++) {
+                uint32_t sx = x + c < width ? x + c : width - 1;
+                memcpy(px + 16 * r + 4 * c, src->base + (size_t)sy * src->rowBytes + (size_t)sx * 4, 4);
+            }
+        }
+    }
+    if (src->format == kVMPixelFormatBGRA8)
+        swap_rb(px, 16);
+}
+
+bool VMBlockCompress(const VMBlockImage* dst, const VMPixelImage* src,
+                     uint32_t width, uint32_t height, VMBlockQuality quality)
+{
+    if (!dst || !src || !dst->base || !src->base)
+        return false;
+    uint32_t block_bytes = VMBlockFormatBytes(dst->format);
+    if (!block_bytes || !is_rgba_format(src->format) || quality > kVMBlockQualityHigh)
+        return false;
+    if ((uint64_t)width * 4 > src->rowBytes || (uint64_t)((width + 3) / 4) * block_bytes > dst->rowBytes)
+        return false;
+    if (width == 0 || height == 0)
+        return true;
+    if (!s_initialized)
+        VMBlockCompressSetPath(VMBlit2DBestPath());
+
+    VMBlit2DVectorState vector;
+    VMBlit2DVectorBegin(&vector);
+    for (uint32_t y = 0; y < height; y += 4) {
+        uint8_t* out = dst->base + (size_t)(y / 4) * dst->rowBytes;
+        for (uint32_t x = 0; x < width; x += 4, out += block_bytes) {
+            uint8_t px[64];
+            load_block(src, x, y, width, height, px);
+            encode_block(dst->format, px, quality, out);
+        }
+    }
+    VMBlit2DVectorEnd(&vector);
+    return true;
+}
+
+bool VMBlockDecompress(const VMPixelImage* dst, const VMBlockImage* src,
+                       uint32_t width, uint32_t height)
+{
+    if (!dst || !src || !dst->base || !src->base)
+        return false;
+    uint32_t block_bytes = VMBlockFormatBytes(src->format);
+    if (!block_bytes || !is_rgba_format(dst->format))
+        return false;
+    if ((uint64_t)width * 4 > dst->rowBytes || (uint64_t)((width + 3) / 4) * block_bytes > src->rowBytes)
+        return false;
+    if (width == 0 || height == 0)
+        return true;
+    if (!s_initialized)
+        VMBlockCompressSetPath(VMBlit2DBestPath());
+
+    VMBlockDecodeFn decode = s_k.decode[src->format];
+    bool bgra = dst->format == kVMPixelFormatBGRA8;
+    uint32_t full = width / 4;
+    VMBlit2DVectorState vector;
+    VMBlit2DVectorBegin(&vector);
+    for (uint32_t y = 0; y < height; y += 4) {
+        const uint8_t* s = src->base + (size_t)(y / 4) * src->rowBytes;
+        uint8_t* d = dst->base + (size_t)y * dst->rowBytes;
+        uint32_t rows = height - y < 4 ? height - y : 4;
+        uint32_t x = 0;
+        if (rows == 4 && full) {
+            decode(d, dst->rowBytes, s, full, bgra);
+            x = full * 4;
+        }
+        // Edge blocks go through a scratch block
+        for (; x < width; x += 4) {
+            uint8_t px[64];
+            decode(px, 16, s + (size_t)(x / 4) * block_bytes, 1, bgra);
+            uint32_t cols = width - x < 4 ? width - x : 4;
+            for (uint32_t r = 0; r < rows; r++)
+                memcpy(d + (size_t)r * dst->rowBytes + (size_t)x * 4, px + 16 * r, cols * 4);
+        }
+    }
+    VMBlit2DVectorEnd(&vector);
+    return true;
+}
@@ -0,0 +1,97 @@
+#ifndef __VMBlockCompress_H__
+#define __VMBlockCompress_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "VMBlit2D.h"
+#include "VMPixelConvert.h"
+
+// BC1-BC5 (DXT1, DXT3, DXT5, RGTC1, RGTC2) block compression of RGBA8 or
+// BGRA8 images, and decompression back to them.
+//
+// VMTextureManager compresses large static textures with VMBlockCompress,
+// and expands compressed textures an application uploads when the host
+// cannot sample them. Every format stores 4x4 pixel blocks, 8 bytes each
+// for BC1 and BC4 and 16 for BC2, BC3 and BC5, in rows of blocks. An image
+// whose size is not a multiple of 4 has partial blocks on its right and
+// bottom edges. The encoder fills them by repeating the last column and
+// row, and the decoder writes only the pixels inside the image.
+//
+// Decoding follows the D3D10 rules with exact rounding. Colors widen from
+// 5 and 6 bits by bit replication. BC1 picks four colors when
+// color0 > color1 and three plus transparent black otherwise. BC2 and BC3
+// always use four colors. Interpolants are round((2 c0 + c1) / 3) and
+// round((c0 + c1) / 2), and alpha interpolants round to the nearest
+// seventh or fifth. BC2 alpha widens as a * 17. BC4 decodes to R,0,0,255
+// and BC5 to R,G,0,255. Only the unsigned variants are handled.
+//
+// The encoder is a range fit. It picks two endpoints, then snaps every
+// pixel to the nearest palette entry along the line between them. The
+// quality picks how the endpoints are found:
+//   Fast    the bounding box of the block, inset by 1/16 of its extent
+//   Normal  the extremes of the block projected on its principal axis
+//   High    the best of Fast, Normal and two least-squares refinements of
+//           Normal, measured by squared error; single-channel blocks also
+//           try the six-interpolant mode with exact 0 and 255
+// BC1 pixels with alpha below 128 become transparent. A BC1 block keeps
+// three colors only when it has such a pixel.
+//
+// Kernel selection follows VMBlit2D's CPU probe, and the SSE2 path uses
+// SSSE3 when the CPU has it, like VMPixelConvert. Inside the kext each
+// image is coded within VMBlit2DVectorBegin/End. Every kernel set
+// produces identical bytes, both encoding and decoding. The library is
+// free of IOKit, so tools/blockcompress_test builds it unchanged on Linux.
+
+enum VMBlockFormat {
+    kVMBlockFormatInvalid = 0,
+    kVMBlockFormatBC1,      // RGB + 1-bit alpha, 8 bytes per block
+    kVMBlockFormatBC2,      // BC1 color + 4-bit explicit alpha, 16 bytes
+    kVMBlockFormatBC3,      // BC1 color + interpolated alpha, 16 bytes
+    kVMBlockFormatBC4,      // One interpolated channel (R), 8 bytes
+    kVMBlockFormatBC5,      // Two interpolated channels (R, G), 16 bytes
+    kVMBlockFormatCount
+};
+
+enum VMBlockQuality {
+    kVMBlockQualityFast = 0,
+    kVMBlockQualityNormal,
+    kVMBlockQualityHigh
+};
+
+struct VMBlockImage {
+    uint8_t*      base;         // Address of block (0,0)
+    uint32_t      rowBytes;     // Stride of one row of blocks
+    VMBlockFormat format;
+};
+
+// Bytes per 4x4 block, 0 for an invalid format
+uint32_t VMBlockFormatBytes(VMBlockFormat format);
+
+// Bytes of a tightly packed width x height image, 0 for an invalid format
+uint64_t VMBlockImageBytes(VMBlockFormat format, uint32_t width, uint32_t height);
+
+// A 0-100 quality setting, as in VMTextureManagerDescriptor, mapped to an
+// encoder quality: below 34 is Fast, below 67 Normal, the rest High
+VMBlockQuality VMBlockQualityFromPercent(uint32_t percent);
+
+// Pin a kernel set (clamped to VMBlit2DBestPath()). Returns the path
+// actually selected. The first call into the library picks the best path
+// on its own.
+VMBlit2DPath VMBlockCompressSetPath(VMBlit2DPath path);
+VMBlit2DPath VMBlockCompressActivePath();
+
+// Whether the active kernel set uses SSSE3 on its SSE2 path
+bool VMBlockCompressUsesSSSE3();
+
+// Compress a width x height RGBA8 or BGRA8 image into dst. Returns false
+// for bad arguments without touching dst.
+bool VMBlockCompress(const VMBlockImage* dst, const VMPixelImage* src,
+                     uint32_t width, uint32_t height, VMBlockQuality quality);
+
+// Decompress a width x height image into an RGBA8 or BGRA8 dst. Returns
+// false for bad arguments without touching dst.
+bool VMBlockDecompress(const VMPixelImage* dst, const VMBlockImage* src,
+                       uint32_t width, uint32_t height);
+
+#endif /* __VMBlockCompress_H__ */
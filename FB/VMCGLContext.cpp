@@ -8,6 +8,7 @@
 #include "VMCGLContext.h"
 #include "VMVirtIOGPU.h"
 #include "virgl_protocol.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 
 #define CLASS VMCGLContext
@@ -36,8 +37,32 @@ bool CLASS::initWithTask(task_t owningTask, void* securityToken, UInt32 type,
     m_command_buffer = nullptr;
     m_shared_memory = nullptr;
     m_shared_memory_desc = nullptr;
+    m_shared_memory_map = nullptr;
+    m_arena_half_size = 0;
+    m_arena_pending[0] = 0;
+    m_arena_pending[1] = 0;
+    m_arena_closed = false;
+    
+    bzero(m_queue, sizeof(m_queue));
+    m_queue_head = 0;
+    m_queue_count = 0;
+    m_worker_active = false;
+    m_submitted_fence = 0;
+    m_retired_fence = 0;
+    m_swaps_in_flight = VM_CGL_DEFAULT_SWAPS_IN_FLIGHT;
+    m_deferred_error = kIOReturnSuccess;
+    m_frames_queued = 0;
+    m_frame_stalls = 0;
+    m_queue_stalls = 0;
+    
+    m_queue_lock = IOLockAlloc();
+    m_frame_call = thread_call_allocate(&CLASS::sFrameWorker, this);
+    if (!m_queue_lock || !m_frame_call) {
+        VMLOG_ERROR("VMCGLContext: ERROR - Failed to allocate submission queue\n");
+        return false;
+    }
     
-    IOLog("VMCGLContext: Initialized for task %p\n", owningTask);
+    VMLOG_INFO("VMCGLContext: Initialized for task %p\n", owningTask);
     return true;
 }
 
@@ -49,11 +74,11 @@ bool CLASS::start(IOService* provider)
     
     m_accelerator = OSDynamicCast(VMQemuVGAAccelerator, provider);
     if (!m_accelerator) {
-        IOLog("VMCGLContext: ERROR - Provider is not VMQemuVGAAccelerator\n");
+        VMLOG_ERROR("VMCGLContext: ERROR - Provider is not VMQemuVGAAccelerator\n");
         return false;
     }
     
-    IOLog("VMCGLContext: Started with accelerator %p\n", m_accelerator);
+    VMLOG_INFO("VMCGLContext: Started with accelerator %p\n", m_accelerator);
     return true;
 }
 
@@ -68,16 +93,27 @@ void CLASS::stop(IOService* provider)
 
 void CLASS::free()
 {
+    if (m_frame_call) {
+        if (m_queue_lock) {
+            drainQueue();
+        }
+        thread_call_cancel(m_frame_call);
+        thread_call_free(m_frame_call);
+        m_frame_call = nullptr;
+    }
+    
+    releaseSharedMemory();
+    
+    if (m_queue_lock) {
+        IOLockFree(m_queue_lock);
+        m_queue_lock = nullptr;
+    }
+    
     if (m_command_buffer) {
         m_command_buffer->release();
         m_command_buffer = nullptr;
     }
     
-    if (m_shared_memory_desc) {
-        m_shared_memory_desc->release();
-        m_shared_memory_desc = nullptr;
-    }
-    
     super::free();
 }
 
@@ -109,7 +145,7 @@ IOReturn CLASS::externalMethod(uint32_t selector, IOExternalMethodArguments* arg
         { (IOExternalMethodAction)&VMCGLContext::sCGLDestroyContext, 0, 0, 0, 0 },
         { (IOExternalMethodAction)&VMCGLContext::sCGLSetSurface, 3, 0, 0, 0 },
         { (IOExternalMethodAction)&VMCGLContext::sCGLFlushContext, 0, 0, 0, 0 },
-        { (IOExternalMethodAction)&VMCGLContext::sCGLSubmitCommands, 1, 0, 0, 0xFFFFFFFF },
+        { (IOExternalMethodAction)&VMCGLContext::sCGLSubmitCommands, 2, 0, 0, 0 },
         { (IOExternalMethodAction)&VMCGLContext::sCGLSetParameter, 2, 0, 0, 0 },
         { (IOExternalMethodAction)&VMCGLContext::sCGLGetParameter, 1, 2, 0, 0 },
         { (IOExternalMethodAction)&VMCGLContext::sCGLSetVirtualScreen, 1, 0, 0, 0 },
@@ -122,7 +158,7 @@ IOReturn CLASS::externalMethod(uint32_t selector, IOExternalMethodArguments* arg
     };
     
     if (selector >= kVMCGLMethodCount) {
-        IOLog("VMCGLContext: Invalid selector %d\n", selector);
+        VMLOG_WARN("VMCGLContext: Invalid selector %d\n", selector);
         return kIOReturnBadArgument;
     }
     
@@ -193,28 +229,15 @@ IOReturn CLASS::sCGLSubmitCommands(OSObject* target, void* reference,
                                   IOExternalMethodArguments* args)
 {
     VMCGLContext* me = (VMCGLContext*)target;
-    if (!me || args->scalarInputCount != 1) {
-        return kIOReturnBadArgument;
-    }
-    
-    uint32_t command_size = (uint32_t)args->scalarInput[0];
-    
-    // Commands come through structureInput
-    if (!args->structureInput || args->structureInputSize == 0) {
+    if (!me || args->scalarInputCount != 2) {
         return kIOReturnBadArgument;
     }
     
-    IOMemoryDescriptor* commandDesc = IOMemoryDescriptor::withAddress(
-        (void*)args->structureInput, args->structureInputSize, kIODirectionIn);
-    
-    if (!commandDesc) {
-        return kIOReturnNoMemory;
-    }
+    // Commands are already in the shared arena; only the range crosses over
+    uint32_t offset = (uint32_t)args->scalarInput[0];
+    uint32_t length = (uint32_t)args->scalarInput[1];
     
-    IOReturn ret = me->cglSubmitCommands(commandDesc, command_size);
-    commandDesc->release();
-    
-    return ret;
+    return me->cglSubmitCommands(offset, length);
 }
 
 IOReturn CLASS::sCGLSetParameter(OSObject* target, void* reference,
@@ -346,7 +369,7 @@ IOReturn CLASS::sCGLSetupSharedMemory(OSObject* target, void* reference,
 IOReturn CLASS::cglCreateContext(uint32_t pixel_format, uint32_t share_context)
 {
     if (m_context_valid) {
-        IOLog("VMCGLContext: Context already exists\n");
+        VMLOG_DEBUG("VMCGLContext: Context already exists\n");
         return kIOReturnExclusiveAccess;
     }
     
@@ -357,14 +380,14 @@ IOReturn CLASS::cglCreateContext(uint32_t pixel_format, uint32_t share_context)
     // Create 3D context through accelerator
     IOReturn ret = m_accelerator->create3DContext(&m_context_id, m_task);
     if (ret != kIOReturnSuccess) {
-        IOLog("VMCGLContext: Failed to create 3D context: 0x%x\n", ret);
+        VMLOG_ERROR("VMCGLContext: Failed to create 3D context: 0x%x\n", ret);
         return ret;
     }
     
     m_cgl_context_id = m_context_id; // Use same ID for CGL
     m_context_valid = true;
     
-    IOLog("VMCGLContext: ✅ Created CGL context %d (pixel format: 0x%x, share: %d)\n",
+    VMLOG_DEBUG("VMCGLContext: ✅ Created CGL context %d (pixel format: 0x%x, share: %d)\n",
           m_cgl_context_id, pixel_format, share_context);
     
     return kIOReturnSuccess;
@@ -380,17 +403,26 @@ IOReturn CLASS::cglDestroyContext()
         return kIOReturnNoDevice;
     }
     
+    // The worker still references m_context_id; let it finish every queued
+    // frame, and keep submits out until the arena is gone
+    closeArena();
+    
     IOReturn ret = m_accelerator->destroy3DContext(m_context_id);
     if (ret != kIOReturnSuccess) {
-        IOLog("VMCGLContext: Failed to destroy context: 0x%x\n", ret);
+        openArena();
+        VMLOG_ERROR("VMCGLContext: Failed to destroy context: 0x%x\n", ret);
         return ret;
     }
     
+    releaseSharedMemory();
+    
     m_context_valid = false;
     m_context_id = 0;
     m_cgl_context_id = 0;
+    openArena();
     
-    IOLog("VMCGLContext: Destroyed CGL context\n");
+    VMLOG_DEBUG("VMCGLContext: Destroyed CGL context (%llu frames, %llu fence stalls, %llu queue stalls)\n",
+          m_frames_queued, m_frame_stalls, m_queue_stalls);
     return kIOReturnSuccess;
 }
 
@@ -402,7 +434,7 @@ IOReturn CLASS::cglSetSurface(uint32_t surface_id, uint32_t width, uint32_t heig
     
     m_current_surface_id = surface_id;
     
-    IOLog("VMCGLContext: Set surface %d (%dx%d)\n", surface_id, width, height);
+    VMLOG_DEBUG("VMCGLContext: Set surface %d (%dx%d)\n", surface_id, width, height);
     return kIOReturnSuccess;
 }
 
@@ -416,38 +448,92 @@ IOReturn CLASS::cglFlushContext()
         return kIOReturnNoDevice;
     }
     
-    // Flush pending commands and present to screen
-    if (m_current_surface_id) {
-        IOReturn ret = m_accelerator->present3DSurface(m_context_id, m_current_surface_id);
-        if (ret != kIOReturnSuccess) {
-            IOLog("VMCGLContext: Failed to flush/present: 0x%x\n", ret);
-            return ret;
+    // Queue the present behind this frame's commands and return; only block
+    // when the host has fallen more than m_swaps_in_flight frames behind.
+    IOLockLock(m_queue_lock);
+    
+    VMCGLWorkItem item = { 0, 0, m_current_surface_id, 0 };
+    IOReturn ret = enqueueWork(item);
+    if (ret == kIOReturnAborted) {
+        IOLockUnlock(m_queue_lock);
+        return ret;
+    }
+    m_frames_queued++;
+    
+    ret = takeDeferredError();
+    if (m_submitted_fence - m_retired_fence > m_swaps_in_flight) {
+        m_frame_stalls++;
+        IOReturn wait = waitForFence(m_submitted_fence - m_swaps_in_flight);
+        if (ret == kIOReturnSuccess) {
+            ret = wait;
         }
     }
     
-    IOLog("VMCGLContext: 🚀 Flushed CGL context (presented surface %d)\n", m_current_surface_id);
-    return kIOReturnSuccess;
+    IOLockUnlock(m_queue_lock);
+    
+    if (ret != kIOReturnSuccess) {
+        VMLOG_ERROR("VMCGLContext: Failed to flush/present: 0x%x\n", ret);
+    }
+    return ret;
 }
 
-IOReturn CLASS::cglSubmitCommands(IOMemoryDescriptor* commands, uint32_t command_size)
+IOReturn CLASS::cglSubmitCommands(uint32_t offset, uint32_t length)
 {
     if (!m_context_valid) {
         return kIOReturnNotOpen;
     }
     
-    if (!m_accelerator || !commands) {
+    if (!m_accelerator) {
+        return kIOReturnNotReady;
+    }
+    if (length == 0 || ((offset | length) & 3)) {
         return kIOReturnBadArgument;
     }
     
-    // Submit OpenGL commands to accelerator for translation to virgl
-    IOReturn ret = m_accelerator->submit3DCommands(m_context_id, commands);
-    if (ret != kIOReturnSuccess) {
-        IOLog("VMCGLContext: Failed to submit commands: 0x%x\n", ret);
+    // The arena is checked and the batch queued under one lock hold, so a
+    // concurrent setup or destroy cannot swap the arena in between
+    IOLockLock(m_queue_lock);
+    if (m_arena_closed || !m_shared_memory) {
+        IOLockUnlock(m_queue_lock);
+        return kIOReturnNotReady;
+    }
+    
+    // The range must lie within a single arena half
+    uint32_t half = (offset >= m_arena_half_size) ? 1 : 0;
+    uint32_t half_end = (half + 1) * m_arena_half_size;
+    if (offset >= half_end || length > half_end - offset) {
+        IOLockUnlock(m_queue_lock);
+        return kIOReturnBadArgument;
+    }
+    
+    VMCGLWorkItem item = { offset, length, 0, 0 };
+    IOReturn ret = enqueueWork(item);
+    if (ret == kIOReturnAborted) {
+        IOLockUnlock(m_queue_lock);
         return ret;
     }
+    m_arena_pending[half]++;
+    ret = takeDeferredError();
+    
+    // Hand the other half back to userspace before returning. If the wait
+    // is interrupted the batch stays queued, but the other half may still
+    // be in use.
+    while (m_arena_pending[half ^ 1]) {
+        if (IOLockSleep(m_queue_lock, &m_retired_fence, THREAD_ABORTSAFE) == THREAD_INTERRUPTED) {
+            // Keep an earlier failure for the next call
+            if (ret != kIOReturnSuccess && m_deferred_error == kIOReturnSuccess) {
+                m_deferred_error = ret;
+            }
+            ret = kIOReturnAborted;
+            break;
+        }
+    }
+    IOLockUnlock(m_queue_lock);
     
-    IOLog("VMCGLContext: ✅ Submitted %d bytes of OpenGL commands\n", command_size);
-    return kIOReturnSuccess;
+    if (ret != kIOReturnSuccess) {
+        VMLOG_ERROR("VMCGLContext: Failed to submit commands: 0x%x\n", ret);
+    }
+    return ret;
 }
 
 IOReturn CLASS::cglSetParameter(uint32_t param_name, const int32_t* params, uint32_t count)
@@ -463,15 +549,26 @@ IOReturn CLASS::cglSetParameter(uint32_t param_name, const int32_t* params, uint
     // Handle common CGL parameters
     switch (param_name) {
         case kCGLCPSwapInterval:
-            IOLog("VMCGLContext: Set swap interval = %d\n", params[0]);
+            VMLOG_DEBUG("VMCGLContext: Set swap interval = %d\n", params[0]);
             break;
             
         case kCGLCPSurfaceOpacity:
-            IOLog("VMCGLContext: Set surface opacity = %d\n", params[0]);
+            VMLOG_DEBUG("VMCGLContext: Set surface opacity = %d\n", params[0]);
+            break;
+            
+        case kCGLCPMPSwapsInFlight:
+            // 0 makes every flush wait for its own frame
+            if (params[0] < 0 || params[0] > VM_CGL_MAX_SWAPS_IN_FLIGHT) {
+                return kIOReturnBadArgument;
+            }
+            IOLockLock(m_queue_lock);
+            m_swaps_in_flight = (uint32_t)params[0];
+            IOLockUnlock(m_queue_lock);
+            VMLOG_DEBUG("VMCGLContext: Set swaps in flight = %d\n", params[0]);
             break;
             
         default:
-            IOLog("VMCGLContext: Set parameter 0x%x = %d\n", param_name, params[0]);
+            VMLOG_DEBUG("VMCGLContext: Set parameter 0x%x = %d\n", param_name, params[0]);
             break;
     }
     
@@ -511,13 +608,18 @@ IOReturn CLASS::cglGetParameter(uint32_t param_name, int32_t* params, uint32_t*
             *count = 1;
             break;
             
+        case kCGLCPMPSwapsInFlight:
+            params[0] = (int32_t)m_swaps_in_flight;
+            *count = 1;
+            break;
+            
         default:
             params[0] = 0;
             *count = 1;
             break;
     }
     
-    IOLog("VMCGLContext: Get parameter 0x%x = %d\n", param_name, params[0]);
+    VMLOG_DEBUG("VMCGLContext: Get parameter 0x%x = %d\n", param_name, params[0]);
     return kIOReturnSuccess;
 }
 
@@ -527,7 +629,7 @@ IOReturn CLASS::cglSetVirtualScreen(uint32_t screen_id)
         return kIOReturnNotOpen;
     }
     
-    IOLog("VMCGLContext: Set virtual screen %d\n", screen_id);
+    VMLOG_DEBUG("VMCGLContext: Set virtual screen %d\n", screen_id);
     return kIOReturnSuccess;
 }
 
@@ -552,7 +654,7 @@ IOReturn CLASS::cglUpdateContext()
     }
     
     // Synchronize context state with system
-    IOLog("VMCGLContext: Updated context state\n");
+    VMLOG_DEBUG("VMCGLContext: Updated context state\n");
     return kIOReturnSuccess;
 }
 
@@ -564,7 +666,7 @@ IOReturn CLASS::cglClearDrawable()
     
     // Clear the current drawable
     m_current_surface_id = 0;
-    IOLog("VMCGLContext: Cleared drawable\n");
+    VMLOG_DEBUG("VMCGLContext: Cleared drawable\n");
     
     return kIOReturnSuccess;
 }
@@ -595,27 +697,196 @@ IOReturn CLASS::cglSetupSharedMemory(mach_vm_address_t address, mach_vm_size_t s
         return kIOReturnNotOpen;
     }
     
-    // Map shared memory for fast parameter passing
-    if (m_shared_memory_desc) {
-        m_shared_memory_desc->release();
-        m_shared_memory_desc = nullptr;
+    if (!address || size < VM_CGL_ARENA_MIN_SIZE || size > VM_CGL_ARENA_MAX_SIZE) {
+        return kIOReturnBadArgument;
     }
     
-    m_shared_memory_desc = IOMemoryDescriptor::withAddressRange(
-        address, size, kIODirectionInOut, m_task);
+    // Queued batches point into the current arena
+    closeArena();
+    releaseSharedMemory();
     
-    if (!m_shared_memory_desc) {
-        IOLog("VMCGLContext: Failed to map shared memory\n");
+    IOMemoryDescriptor* desc = IOMemoryDescriptor::withAddressRange(
+        address, size, kIODirectionOut, m_task);
+    
+    if (!desc) {
+        openArena();
+        VMLOG_ERROR("VMCGLContext: Failed to map shared memory\n");
         return kIOReturnNoMemory;
     }
     
-    IOReturn ret = m_shared_memory_desc->prepare(kIODirectionInOut);
+    // Wire and map once; submits then read the arena in place
+    IOReturn ret = desc->prepare();
     if (ret != kIOReturnSuccess) {
-        m_shared_memory_desc->release();
-        m_shared_memory_desc = nullptr;
+        desc->release();
+        openArena();
         return ret;
     }
     
-    IOLog("VMCGLContext: ✅ Setup shared memory: %llu bytes at 0x%llx\n", size, address);
+    IOMemoryMap* map = desc->map();
+    if (!map) {
+        desc->complete();
+        desc->release();
+        openArena();
+        return kIOReturnVMError;
+    }
+    
+    IOLockLock(m_queue_lock);
+    m_shared_memory_desc = desc;
+    m_shared_memory_map = map;
+    m_shared_memory = (void*)map->getVirtualAddress();
+    m_arena_half_size = (uint32_t)(size / 2) & ~3u;
+    IOLockUnlock(m_queue_lock);
+    openArena();
+    
+    VMLOG_DEBUG("VMCGLContext: ✅ Setup command arena: 2 x %u bytes at 0x%llx\n", (uint32_t)(size / 2) & ~3u, address);
+    return kIOReturnSuccess;
+}
+
+// Detaches the arena under the queue lock and releases it outside
+void CLASS::releaseSharedMemory()
+{
+    if (m_queue_lock) IOLockLock(m_queue_lock);
+    IOMemoryMap* map = m_shared_memory_map;
+    IOMemoryDescriptor* desc = m_shared_memory_desc;
+    m_shared_memory = nullptr;
+    m_arena_half_size = 0;
+    m_shared_memory_map = nullptr;
+    m_shared_memory_desc = nullptr;
+    if (m_queue_lock) IOLockUnlock(m_queue_lock);
+    
+    if (map) {
+        map->release();
+    }
+    
+    if (desc) {
+        desc->complete();
+        desc->release();
+    }
+}
+
+// ============================================================================
+// MARK: - Deferred Submission
+// ============================================================================
+
+void CLASS::sFrameWorker(thread_call_param_t param0, thread_call_param_t param1)
+{
+    VMCGLContext* me = (VMCGLContext*)param0;
+    if (me) {
+        me->processQueue();
+    }
+}
+
+void CLASS::processQueue()
+{
+    IOLockLock(m_queue_lock);
+    
+    while (m_queue_count) {
+        VMCGLWorkItem item = m_queue[m_queue_head];
+        m_queue_head = (m_queue_head + 1) % VM_CGL_WORK_QUEUE_DEPTH;
+        m_queue_count--;
+        IOLockUnlock(m_queue_lock);
+        
+        // executeCommands is synchronous: once these return, the host is done
+        IOReturn ret = kIOReturnSuccess;
+        if (item.length) {
+            ret = m_accelerator->submit3DCommandBytes(m_context_id,
+                                                      (const uint8_t*)m_shared_memory + item.offset,
+                                                      item.length);
+        } else if (item.surface_id) {
+            ret = m_accelerator->present3DSurface(m_context_id, item.surface_id);
+        }
+        
+        IOLockLock(m_queue_lock);
+        if (item.length) {
+            m_arena_pending[(item.offset >= m_arena_half_size) ? 1 : 0]--;
+        }
+        if (ret != kIOReturnSuccess && m_deferred_error == kIOReturnSuccess) {
+            m_deferred_error = ret;
+        }
+        if (item.fence) {
+            m_retired_fence = item.fence;
+        }
+        IOLockWakeup(m_queue_lock, &m_retired_fence, false);
+    }
+    
+    m_worker_active = false;
+    IOLockWakeup(m_queue_lock, &m_retired_fence, false);
+    IOLockUnlock(m_queue_lock);
+}
+
+// Waits for queue space; a signal gives up with kIOReturnAborted and queues
+// nothing. Presents take the next fence only once they are in the queue, so
+// fences retire in order even when several flushers had to wait.
+IOReturn CLASS::enqueueWork(VMCGLWorkItem item)
+{
+    while (m_queue_count == VM_CGL_WORK_QUEUE_DEPTH) {
+        m_queue_stalls++;
+        if (IOLockSleep(m_queue_lock, &m_retired_fence, THREAD_ABORTSAFE) == THREAD_INTERRUPTED) {
+            return kIOReturnAborted;
+        }
+    }
+    
+    if (!item.length) {
+        item.fence = ++m_submitted_fence;
+    }
+    
+    uint32_t tail = (m_queue_head + m_queue_count) % VM_CGL_WORK_QUEUE_DEPTH;
+    m_queue[tail] = item;
+    m_queue_count++;
+    
+    if (!m_worker_active) {
+        m_worker_active = true;
+        thread_call_enter(m_frame_call);
+    }
     return kIOReturnSuccess;
 }
+
+IOReturn CLASS::waitForFence(uint64_t fence)
+{
+    while (m_retired_fence < fence) {
+        if (IOLockSleep(m_queue_lock, &m_retired_fence, THREAD_ABORTSAFE) == THREAD_INTERRUPTED) {
+            return kIOReturnAborted;
+        }
+    }
+    return kIOReturnSuccess;
+}
+
+IOReturn CLASS::takeDeferredError()
+{
+    IOReturn ret = m_deferred_error;
+    m_deferred_error = kIOReturnSuccess;
+    return ret;
+}
+
+// Rejects new submits and waits until the worker is idle, so the arena can
+// be swapped or released. Closers take turns: a second setup or destroy
+// waits for the first to reopen.
+void CLASS::closeArena()
+{
+    IOLockLock(m_queue_lock);
+    while (m_arena_closed) {
+        IOLockSleep(m_queue_lock, &m_retired_fence, THREAD_UNINT);
+    }
+    m_arena_closed = true;
+    while (m_queue_count || m_worker_active) {
+        IOLockSleep(m_queue_lock, &m_retired_fence, THREAD_UNINT);
+    }
+    IOLockUnlock(m_queue_lock);
+}
+
+void CLASS::openArena()
+{
+    IOLockLock(m_queue_lock);
+    m_arena_closed = false;
+    IOLockWakeup(m_queue_lock, &m_retired_fence, false);
+    IOLockUnlock(m_queue_lock);
+}
+
+void CLASS::drainQueue()
+{
+    IOLockLock(m_queue_lock);
+    while (m_queue_count || m_worker_active) {
+        IOLockSleep(m_queue_lock, &m_retired_fence, THREAD_UNINT);
+    }
+    IOLockUnlock(m_queue_lock);
+}
@@ -11,8 +11,33 @@
 
 #include <IOKit/IOUserClient.h>
 #include <IOKit/IOMemoryDescriptor.h>
+#include <IOKit/IOLocks.h>
+#include <kern/thread_call.h>
 #include "VMQemuVGAAccelerator.h"
 
+// Frame pacing: flush/swap returns as soon as the frame is queued unless more
+// than kCGLCPMPSwapsInFlight frames are still on their way to the host.
+#define VM_CGL_DEFAULT_SWAPS_IN_FLIGHT  2
+#define VM_CGL_MAX_SWAPS_IN_FLIGHT      8
+#define VM_CGL_WORK_QUEUE_DEPTH         64
+
+// Command arena: the region registered with cglSetupSharedMemory is split
+// into two halves. Userspace encodes into one half and submits (offset, length)
+// ranges of it; when a submit into one half returns, the other half is idle
+// and may be rewritten.
+#define VM_CGL_ARENA_MIN_SIZE           (2 * 4096)
+#define VM_CGL_ARENA_MAX_SIZE           (16 * 1024 * 1024)
+
+// One unit of deferred work. Command batches are a range of the arena; a
+// nonzero fence marks the end of a frame (flush/swap) and retires when the
+// worker has presented it.
+struct VMCGLWorkItem {
+    uint32_t offset;
+    uint32_t length;                    // 0 for a present
+    uint32_t surface_id;
+    uint64_t fence;
+};
+
 // Forward declarations
 class VMVirtIOGPUAccelerator;
 class VMQemuVGAAccelerator;
@@ -39,8 +64,41 @@ private:
     uint32_t m_current_surface_id;
     uint32_t m_current_framebuffer_id;
     IOMemoryDescriptor* m_command_buffer;
-    void* m_shared_memory;              // Shared memory for fast parameter passing
+    void* m_shared_memory;              // Command arena, wired and mapped once
     IOMemoryDescriptor* m_shared_memory_desc;
+    IOMemoryMap* m_shared_memory_map;
+    uint32_t m_arena_half_size;
+    uint32_t m_arena_pending[2];        // queued batches per arena half
+    bool m_arena_closed;                // setup/destroy is replacing the arena
+    
+    // Deferred submission queue, drained in order by m_frame_call
+    IOLock* m_queue_lock;
+    thread_call_t m_frame_call;
+    VMCGLWorkItem m_queue[VM_CGL_WORK_QUEUE_DEPTH];
+    uint32_t m_queue_head;
+    uint32_t m_queue_count;
+    bool m_worker_active;
+    uint64_t m_submitted_fence;         // last frame queued
+    uint64_t m_retired_fence;           // last frame the host has finished
+    uint32_t m_swaps_in_flight;         // kCGLCPMPSwapsInFlight
+    IOReturn m_deferred_error;          // first worker failure, reported on next call
+    
+    // Pacing statistics
+    uint64_t m_frames_queued;
+    uint64_t m_frame_stalls;            // flushes that waited on an old fence
+    uint64_t m_queue_stalls;            // enqueues that waited for queue space
+    
+    // Queue helpers; enqueueWork, waitForFence and takeDeferredError expect
+    // m_queue_lock held, the rest take it themselves
+    static void sFrameWorker(thread_call_param_t param0, thread_call_param_t param1);
+    void processQueue();
+    IOReturn enqueueWork(VMCGLWorkItem item);
+    IOReturn waitForFence(uint64_t fence);
+    IOReturn takeDeferredError();
+    void drainQueue();
+    void closeArena();
+    void openArena();
+    void releaseSharedMemory();
     
 public:
     // IOService overrides
@@ -92,7 +150,7 @@ public:
     IOReturn cglDestroyContext();
     IOReturn cglSetSurface(uint32_t surface_id, uint32_t width, uint32_t height);
     IOReturn cglFlushContext();
-    IOReturn cglSubmitCommands(IOMemoryDescriptor* commands, uint32_t command_size);
+    IOReturn cglSubmitCommands(uint32_t offset, uint32_t length);
     IOReturn cglSetParameter(uint32_t param_name, const int32_t* params, uint32_t count);
     IOReturn cglGetParameter(uint32_t param_name, int32_t* params, uint32_t* count);
     IOReturn cglSetVirtualScreen(uint32_t screen_id);
@@ -3,6 +3,7 @@
 #include "VMVirtIOGPU.h"
 #include "VMMetalBridge.h"
 #include "VMQemuVGAAccelerator.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 #include <IOKit/IOWorkLoop.h>
 #include <IOKit/IOTimerEventSource.h>
@@ -28,14 +29,9 @@ bool CLASS::init()
     m_lock = nullptr;
     
     // Initialize arrays
-    m_layers = nullptr;
-    m_animations = nullptr;
+    m_layer_table.init(VM_HANDLE_MAX_SLOTS);
+    m_animation_table.init(VM_HANDLE_MAX_SLOTS);
     m_render_contexts = nullptr;
-    m_layer_map = nullptr;
-    
-    // Initialize ID recycling pools
-    m_released_layer_ids = nullptr;
-    m_released_animation_ids = nullptr;
     
     // Initialize hierarchy
     m_layer_tree = nullptr;
@@ -55,10 +51,6 @@ bool CLASS::init()
     m_frame_interval = 16667; // 60fps
     m_display_refresh_rate = 60.0;
     
-    // Initialize IDs
-    m_next_layer_id = 1;
-    m_next_animation_id = 1;
-    
     // Initialize stats and performance counters
     m_frame_drops = 0;
     m_layers_rendered = 0;
@@ -100,27 +92,16 @@ void CLASS::free()
         m_animation_work_loop = nullptr;
     }
     
-    // Clean up arrays
-    if (m_layers) {
-        m_layers->release();
-        m_layers = nullptr;
-    }
-    
-    if (m_animations) {
-        m_animations->release();
-        m_animations = nullptr;
-    }
+    // Clean up layers, animations and arrays
+    releaseAllLayers();
+    m_layer_table.free();
+    m_animation_table.free();
     
     if (m_render_contexts) {
         m_render_contexts->release();
         m_render_contexts = nullptr;
     }
     
-    if (m_layer_map) {
-        m_layer_map->release();
-        m_layer_map = nullptr;
-    }
-    
     if (m_layer_tree) {
         m_layer_tree->release();
         m_layer_tree = nullptr;
@@ -136,17 +117,6 @@ void CLASS::free()
         m_render_targets = nullptr;
     }
     
-    // Clean up ID recycling pools
-    if (m_released_layer_ids) {
-        m_released_layer_ids->release();
-        m_released_layer_ids = nullptr;
-    }
-    
-    if (m_released_animation_ids) {
-        m_released_animation_ids->release();
-        m_released_animation_ids = nullptr;
-    }
-    
     super::free();
 }
 
@@ -170,22 +140,13 @@ bool CLASS::initWithAccelerator(VMQemuVGAAccelerator* accelerator)
         return false;
     
     // Initialize arrays for layer and animation management
-    m_layers = OSArray::withCapacity(64);
-    m_animations = OSArray::withCapacity(128);
     m_render_contexts = OSArray::withCapacity(16);
-    m_layer_map = OSDictionary::withCapacity(64);
     m_layer_tree = OSArray::withCapacity(64);
     m_texture_cache = OSDictionary::withCapacity(32);
     m_render_targets = OSArray::withCapacity(8);
     
-    // Initialize ID recycling pools
-    m_released_layer_ids = OSArray::withCapacity(32);
-    m_released_animation_ids = OSArray::withCapacity(64);
-    
-    if (!m_layers || !m_animations || !m_render_contexts || !m_layer_map || 
-        !m_layer_tree || !m_texture_cache || !m_render_targets ||
-        !m_released_layer_ids || !m_released_animation_ids) {
-        IOLog("VMCoreAnimationAccelerator: Failed to allocate arrays\n");
+    if (!m_render_contexts || !m_layer_tree || !m_texture_cache || !m_render_targets) {
+        VMLOG_ERROR("VMCoreAnimationAccelerator: Failed to allocate arrays\n");
         return false;
     }
     
@@ -202,7 +163,7 @@ bool CLASS::initWithAccelerator(VMQemuVGAAccelerator* accelerator)
     // Initialize framebuffer support - comment out missing method
     m_framebuffer = NULL; // accelerator->getFrameBuffer() - method doesn't exist
     
-    IOLog("VMCoreAnimationAccelerator: Initialized with accelerator %p\n", accelerator);
+    VMLOG_INFO("VMCoreAnimationAccelerator: Initialized with accelerator %p\n", accelerator);
     return true;
 }
 
@@ -215,9 +176,9 @@ IOReturn CLASS::setupCoreAnimationSupport()
         // Set up Metal rendering pipeline for Core Animation
         IOReturn ret = m_metal_bridge->setupMetalDevice();
         if (ret != kIOReturnSuccess) {
-            IOLog("VMCoreAnimationAccelerator: Warning - Metal device creation failed (0x%x)\n", ret);
+            VMLOG_ERROR("VMCoreAnimationAccelerator: Warning - Metal device creation failed (0x%x)\n", ret);
         } else {
-            IOLog("VMCoreAnimationAccelerator: Metal device ready\n");
+            VMLOG_INFO("VMCoreAnimationAccelerator: Metal device ready\n");
             m_supports_hardware_composition = true;
             m_supports_3d_transforms = true;
         }
@@ -237,7 +198,7 @@ IOReturn CLASS::setupCoreAnimationSupport()
     // Configure GPU features needed for Core Animation
     if (m_gpu_device) {
         // GPU device should already be initialized by accelerator
-        IOLog("VMCoreAnimationAccelerator: GPU device available\n");
+        VMLOG_INFO("VMCoreAnimationAccelerator: GPU device available\n");
         m_supports_video_layers = true;
     }
     
@@ -245,7 +206,7 @@ IOReturn CLASS::setupCoreAnimationSupport()
     m_frame_drops = 0;
     m_layers_rendered = 0;
     
-    IOLog("VMCoreAnimationAccelerator: Core Animation support configured\n");
+    VMLOG_INFO("VMCoreAnimationAccelerator: Core Animation support configured\n");
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -274,9 +235,9 @@ IOReturn CLASS::startCompositor()
     
     // Set up rendering pipeline
     if (m_metal_bridge && m_supports_hardware_composition) {
-        IOLog("VMCoreAnimationAccelerator: Hardware-accelerated compositor enabled\n");
+        VMLOG_INFO("VMCoreAnimationAccelerator: Hardware-accelerated compositor enabled\n");
     } else {
-        IOLog("VMCoreAnimationAccelerator: Software compositor enabled\n");
+        VMLOG_INFO("VMCoreAnimationAccelerator: Software compositor enabled\n");
     }
     
     // Start animation timer (60 FPS target)
@@ -285,7 +246,7 @@ IOReturn CLASS::startCompositor()
         m_animation_timer->setTimeoutMS(16); // 16ms = ~60fps
     }
     
-    IOLog("VMCoreAnimationAccelerator: Compositor started successfully\n");
+    VMLOG_INFO("VMCoreAnimationAccelerator: Compositor started successfully\n");
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -306,18 +267,10 @@ IOReturn CLASS::stopCompositor()
     }
     
     // Clean up active layers and animations
-    if (m_layers) {
-        m_layers->flushCollection();
-    }
-    if (m_animations) {
-        m_animations->flushCollection();
-    }
+    releaseAllLayers();
     if (m_render_contexts) {
         m_render_contexts->flushCollection();
     }
-    if (m_layer_map) {
-        m_layer_map->flushCollection();
-    }
     if (m_layer_tree) {
         m_layer_tree->flushCollection();
     }
@@ -334,7 +287,7 @@ IOReturn CLASS::stopCompositor()
     m_presentation_layer_id = 0;
     
     // Log final statistics
-    IOLog("VMCoreAnimationAccelerator: Compositor stopped. Stats - Layers: %llu, Animations: %llu, Compositions: %llu, Frame drops: %llu\n", 
+    VMLOG_INFO("VMCoreAnimationAccelerator: Compositor stopped. Stats - Layers: %llu, Animations: %llu, Compositions: %llu, Frame drops: %llu\n", 
           m_layers_rendered, m_animations_processed, m_composition_operations, m_frame_drops);
     
     IORecursiveLockUnlock(m_lock);
@@ -351,39 +304,22 @@ IOReturn CLASS::createLayer(VMCALayerType type, const VMCALayerProperties* prope
     
     IORecursiveLockLock(m_lock);
     
-    // Allocate new layer ID
-    *layer_id = allocateLayerId();
-    
     // Create layer object (using OSData to store layer properties)
     OSData* layer_data = OSData::withBytes(properties, sizeof(VMCALayerProperties));
     if (!layer_data) {
-        releaseLayerId(*layer_id);
         IORecursiveLockUnlock(m_lock);
         return kIOReturnNoMemory;
     }
     
-    // Store layer type in first 4 bytes
-    uint32_t layer_info[2] = { type, *layer_id };
-    OSData* layer_info_data = OSData::withBytes(layer_info, sizeof(layer_info));
-    if (!layer_info_data) {
+    // The table keeps the creation reference
+    *layer_id = m_layer_table.insert(layer_data);
+    if (!*layer_id) {
         layer_data->release();
-        releaseLayerId(*layer_id);
         IORecursiveLockUnlock(m_lock);
-        return kIOReturnNoMemory;
+        return kIOReturnNoResources;
     }
     
-    // Add to collections
-    m_layers->setObject(layer_data);
-    
-    // Create string key for dictionary
-    char key_str[32];
-    snprintf(key_str, sizeof(key_str), "%u", *layer_id);
-    m_layer_map->setObject(key_str, layer_data);
-    
-    layer_data->release();
-    layer_info_data->release();
-    
-    IOLog("VMCoreAnimationAccelerator: Created layer %u of type %u\n", *layer_id, type);
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Created layer %u of type %u\n", *layer_id, type);
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -407,23 +343,18 @@ IOReturn CLASS::destroyLayer(uint32_t layer_id)
         }
     }
     
-    // Remove from collections
-    char key_str[32];
-    snprintf(key_str, sizeof(key_str), "%u", layer_id);
-    m_layer_map->removeObject(key_str);
-    unsigned int index = m_layers->getNextIndexOfObject(layer_obj, 0);
-    if (index != (unsigned int)-1) {
-        m_layers->removeObject(index);
-    }
+    // Retire the id; a stale copy of it no longer resolves
+    m_layer_table.remove(layer_id);
+    layer_obj->release();
     
     // Clear cached texture if any
     if (m_texture_cache) {
+        char key_str[32];
+        snprintf(key_str, sizeof(key_str), "%u", layer_id);
         m_texture_cache->removeObject(key_str);
     }
     
-    releaseLayerId(layer_id);
-    
-    IOLog("VMCoreAnimationAccelerator: Destroyed layer %u\n", layer_id);
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Destroyed layer %u\n", layer_id);
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -450,16 +381,9 @@ IOReturn CLASS::updateLayerProperties(uint32_t layer_id, const VMCALayerProperti
         return kIOReturnNoMemory;
     }
     
-    // Replace in collections
-    char key_str[32];
-    snprintf(key_str, sizeof(key_str), "%u", layer_id);
-    m_layer_map->setObject(key_str, new_data);
-    unsigned int index = m_layers->getNextIndexOfObject(layer_data, 0);
-    if (index != (unsigned int)-1) {
-        m_layers->replaceObject(index, new_data);
-    }
-    
-    new_data->release();
+    // The table takes over new_data's reference
+    m_layer_table.replace(layer_id, new_data);
+    layer_data->release();
     
     // Mark compositor as needing update
     m_compositor_state.needs_display = true;
@@ -521,7 +445,7 @@ IOReturn CLASS::addSublayer(uint32_t parent_layer_id, uint32_t child_layer_id)
     
     m_compositor_state.needs_layout = true;
     
-    IOLog("VMCoreAnimationAccelerator: Added layer %u as sublayer of %u\n", child_layer_id, parent_layer_id);
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Added layer %u as sublayer of %u\n", child_layer_id, parent_layer_id);
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -545,7 +469,7 @@ IOReturn CLASS::removeSublayer(uint32_t parent_layer_id, uint32_t child_layer_id
     
     m_compositor_state.needs_layout = true;
     
-    IOLog("VMCoreAnimationAccelerator: Removed layer %u from parent %u\n", child_layer_id, parent_layer_id);
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Removed layer %u from parent %u\n", child_layer_id, parent_layer_id);
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -564,7 +488,7 @@ IOReturn CLASS::setRootLayer(uint32_t layer_id)
     m_root_layer_id = layer_id;
     m_compositor_state.needs_layout = true;
     
-    IOLog("VMCoreAnimationAccelerator: Set root layer to %u\n", layer_id);
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Set root layer to %u\n", layer_id);
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -594,26 +518,26 @@ IOReturn CLASS::addAnimation(uint32_t layer_id, const VMCAAnimationDescriptor* d
         return kIOReturnNotFound;
     }
     
-    // Allocate animation ID
-    *animation_id = allocateAnimationId();
-    
-    // Create enhanced animation data with embedded ID for efficient lookup
+    // Create animation data with embedded record
     AnimationRecord record;
-    record.animation_id = *animation_id;
+    record.animation_id = 0;
     record.layer_id = layer_id;
     memcpy(&record.descriptor, descriptor, sizeof(VMCAAnimationDescriptor));
     
-    // Create animation data with embedded record
     OSData* animation_data = OSData::withBytes(&record, sizeof(AnimationRecord));
     if (!animation_data) {
-        releaseAnimationId(*animation_id);
         IORecursiveLockUnlock(m_lock);
         return kIOReturnNoMemory;
     }
     
-    // Store animation in array
-    m_animations->setObject(animation_data);
-    animation_data->release();
+    // The table keeps the creation reference; the record carries its id
+    *animation_id = m_animation_table.insert(animation_data);
+    if (!*animation_id) {
+        animation_data->release();
+        IORecursiveLockUnlock(m_lock);
+        return kIOReturnNoResources;
+    }
+    ((AnimationRecord*)animation_data->getBytesNoCopy())->animation_id = *animation_id;
     
     // Update compositor state
     m_compositor_state.animations_running++;
@@ -638,7 +562,7 @@ IOReturn CLASS::addAnimation(uint32_t layer_id, const VMCAAnimationDescriptor* d
         case VM_CA_TIMING_DEFAULT: timing_str = "default"; break;
     }
     
-    IOLog("VMCoreAnimationAccelerator: Added %s animation %u (%s, %s, %.3fs) to layer %u\n", 
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Added %s animation %u (%s, %s, %.3fs) to layer %u\n", 
           anim_type_str, *animation_id, descriptor->key_path ? descriptor->key_path : "null", 
           timing_str, descriptor->duration, layer_id);
     
@@ -657,18 +581,14 @@ IOReturn CLASS::removeAnimation(uint32_t layer_id, uint32_t animation_id)
     }
     
     // Remove animation
-    unsigned int index = m_animations->getNextIndexOfObject(animation_obj, 0);
-    if (index != (unsigned int)-1) {
-        m_animations->removeObject(index);
-    }
-    
-    releaseAnimationId(animation_id);
+    m_animation_table.remove(animation_id);
+    animation_obj->release();
     
     if (m_compositor_state.animations_running > 0) {
         m_compositor_state.animations_running--;
     }
     
-    IOLog("VMCoreAnimationAccelerator: Removed animation %u from layer %u\n", animation_id, layer_id);
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Removed animation %u from layer %u\n", animation_id, layer_id);
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -733,204 +653,40 @@ IOReturn CLASS::compositeFrame()
 
 OSObject* CLASS::findLayer(uint32_t layer_id)
 {
-    if (!m_layer_map) {
-        return nullptr;
-    }
-    
-    char key_str[32];
-    snprintf(key_str, sizeof(key_str), "%u", layer_id);
-    
-    OSObject* layer = m_layer_map->getObject(key_str);
-    
-    return layer;
+    return m_layer_table.lookup(layer_id);
 }
 
 OSObject* CLASS::findAnimation(uint32_t animation_id)
 {
-    if (!m_animations || animation_id == 0) {
-        return nullptr;
-    }
-    
-    // Enhanced animation lookup using AnimationRecord structure
-    for (unsigned int i = 0; i < m_animations->getCount(); i++) {
-        OSData* animation_data = (OSData*)m_animations->getObject(i);
-        if (!animation_data || animation_data->getLength() < sizeof(AnimationRecord)) {
-            continue;
-        }
-        
-        // Extract animation record with embedded ID
-        AnimationRecord* record = (AnimationRecord*)animation_data->getBytesNoCopy();
-        if (record && record->animation_id == animation_id) {
-            return animation_data;
-        }
-    }
-    
-    return nullptr;
-}
-
-uint32_t CLASS::allocateLayerId()
-{
-    IORecursiveLockLock(m_lock);
-    
-    // First try to reuse a released ID from the recycling pool
-    if (m_released_layer_ids && m_released_layer_ids->getCount() > 0) {
-        // Get the most recently released ID (LIFO for better cache locality)
-        unsigned int last_index = m_released_layer_ids->getCount() - 1;
-        OSNumber* recycled_id = (OSNumber*)m_released_layer_ids->getObject(last_index);
-        
-        if (recycled_id) {
-            uint32_t reused_id = recycled_id->unsigned32BitValue();
-            m_released_layer_ids->removeObject(last_index);
-            
-            IORecursiveLockUnlock(m_lock);
-            IOLog("VMCoreAnimationAccelerator: Recycled layer ID %u (pool size: %u)\n", 
-                  reused_id, m_released_layer_ids->getCount());
-            return reused_id;
-        }
-    }
-    
-    // No recycled IDs available, allocate a new one
-    uint32_t new_id = m_next_layer_id++;
-    
-    IORecursiveLockUnlock(m_lock);
-    
-    // Log when we're getting close to ID exhaustion
-    if (new_id > 0xFFFF0000) {
-        IOLog("VMCoreAnimationAccelerator: Warning - Layer ID approaching maximum value: %u\n", new_id);
-    }
-    
-    return new_id;
+    return m_animation_table.lookup(animation_id);
 }
 
-uint32_t CLASS::allocateAnimationId()
+// Fallback target for animations that don't name a layer
+uint32_t CLASS::firstLayerId()
 {
-    IORecursiveLockLock(m_lock);
-    
-    // First try to reuse a released ID from the recycling pool
-    if (m_released_animation_ids && m_released_animation_ids->getCount() > 0) {
-        // Get the most recently released ID (LIFO for better cache locality)
-        unsigned int last_index = m_released_animation_ids->getCount() - 1;
-        OSNumber* recycled_id = (OSNumber*)m_released_animation_ids->getObject(last_index);
-        
-        if (recycled_id) {
-            uint32_t reused_id = recycled_id->unsigned32BitValue();
-            m_released_animation_ids->removeObject(last_index);
-            
-            IORecursiveLockUnlock(m_lock);
-            IOLog("VMCoreAnimationAccelerator: Recycled animation ID %u (pool size: %u)\n", 
-                  reused_id, m_released_animation_ids->getCount());
-            return reused_id;
+    uint32_t layer_id = 0;
+    for (uint32_t i = 0; i < m_layer_table.limit(); i++) {
+        if (m_layer_table.at(i, &layer_id)) {
+            return layer_id;
         }
     }
-    
-    // No recycled IDs available, allocate a new one
-    uint32_t new_id = m_next_animation_id++;
-    
-    IORecursiveLockUnlock(m_lock);
-    
-    // Log when we're getting close to ID exhaustion
-    if (new_id > 0xFFFF0000) {
-        IOLog("VMCoreAnimationAccelerator: Warning - Animation ID approaching maximum value: %u\n", new_id);
-    }
-    
-    return new_id;
+    return 0;
 }
 
-void CLASS::releaseLayerId(uint32_t layer_id)
+// Drops every layer and animation and retires their ids
+void CLASS::releaseAllLayers()
 {
-    // Validate the layer ID
-    if (layer_id == 0 || layer_id >= m_next_layer_id) {
-        IOLog("VMCoreAnimationAccelerator: Warning - Invalid layer ID %u for recycling\n", layer_id);
-        return;
-    }
-    
-    IORecursiveLockLock(m_lock);
-    
-    // Check if this ID is already in the recycling pool (prevent duplicates)
-    if (m_released_layer_ids) {
-        for (unsigned int i = 0; i < m_released_layer_ids->getCount(); i++) {
-            OSNumber* existing_id = (OSNumber*)m_released_layer_ids->getObject(i);
-            if (existing_id && existing_id->unsigned32BitValue() == layer_id) {
-                IORecursiveLockUnlock(m_lock);
-                IOLog("VMCoreAnimationAccelerator: Warning - Layer ID %u already in recycling pool\n", layer_id);
-                return;
-            }
-        }
-        
-        // Add to recycling pool with size limit to prevent unbounded growth
-        const unsigned int MAX_RECYCLED_IDS = 128;
-        if (m_released_layer_ids->getCount() < MAX_RECYCLED_IDS) {
-            OSNumber* id_number = OSNumber::withNumber(layer_id, 32);
-            if (id_number) {
-                m_released_layer_ids->setObject(id_number);
-                id_number->release();
-                
-                IOLog("VMCoreAnimationAccelerator: Added layer ID %u to recycling pool (size: %u)\n", 
-                      layer_id, m_released_layer_ids->getCount());
-            }
-        } else {
-            IOLog("VMCoreAnimationAccelerator: Recycling pool full, discarding layer ID %u\n", layer_id);
+    uint32_t handle;
+    for (uint32_t i = 0; i < m_animation_table.limit(); i++) {
+        if (m_animation_table.at(i, &handle)) {
+            m_animation_table.remove(handle)->release();
         }
     }
-    
-    IORecursiveLockUnlock(m_lock);
-}
-
-void CLASS::releaseAnimationId(uint32_t animation_id)
-{
-    // Validate the animation ID
-    if (animation_id == 0 || animation_id >= m_next_animation_id) {
-        IOLog("VMCoreAnimationAccelerator: Warning - Invalid animation ID %u for recycling\n", animation_id);
-        return;
-    }
-    
-    IORecursiveLockLock(m_lock);
-    
-    // Check if this ID is already in the recycling pool (prevent duplicates)
-    if (m_released_animation_ids) {
-        for (unsigned int i = 0; i < m_released_animation_ids->getCount(); i++) {
-            OSNumber* existing_id = (OSNumber*)m_released_animation_ids->getObject(i);
-            if (existing_id && existing_id->unsigned32BitValue() == animation_id) {
-                IORecursiveLockUnlock(m_lock);
-                IOLog("VMCoreAnimationAccelerator: Warning - Animation ID %u already in recycling pool\n", animation_id);
-                return;
-            }
-        }
-        
-        // Add to recycling pool with size limit to prevent unbounded growth
-        const unsigned int MAX_RECYCLED_IDS = 256; // Higher limit for animations as they're more frequent
-        if (m_released_animation_ids->getCount() < MAX_RECYCLED_IDS) {
-            OSNumber* id_number = OSNumber::withNumber(animation_id, 32);
-            if (id_number) {
-                m_released_animation_ids->setObject(id_number);
-                id_number->release();
-                
-                IOLog("VMCoreAnimationAccelerator: Added animation ID %u to recycling pool (size: %u)\n", 
-                      animation_id, m_released_animation_ids->getCount());
-            }
-        } else {
-            // When pool is full, remove oldest entries (FIFO for pool management)
-            IOLog("VMCoreAnimationAccelerator: Recycling pool full, removing oldest entries\n");
-            
-            // Remove the first quarter of entries to make room
-            unsigned int entries_to_remove = MAX_RECYCLED_IDS / 4;
-            for (unsigned int i = 0; i < entries_to_remove && m_released_animation_ids->getCount() > 0; i++) {
-                m_released_animation_ids->removeObject(0);
-            }
-            
-            // Now add the new ID
-            OSNumber* id_number = OSNumber::withNumber(animation_id, 32);
-            if (id_number) {
-                m_released_animation_ids->setObject(id_number);
-                id_number->release();
-                
-                IOLog("VMCoreAnimationAccelerator: Added animation ID %u after pool cleanup (size: %u)\n", 
-                      animation_id, m_released_animation_ids->getCount());
-            }
+    for (uint32_t i = 0; i < m_layer_table.limit(); i++) {
+        if (m_layer_table.at(i, &handle)) {
+            m_layer_table.remove(handle)->release();
         }
     }
-    
-    IORecursiveLockUnlock(m_lock);
 }
 
 // MARK: - Internal Compositor Methods
@@ -952,7 +708,7 @@ void CLASS::animationTimerHandler(OSObject* owner, IOTimerEventSource* sender)
 void CLASS::processAnimations()
 {
     // Process running animations and update layer properties
-    if (m_compositor_state.animations_running == 0 || !m_animations) {
+    if (m_compositor_state.animations_running == 0) {
         return;
     }
     
@@ -961,8 +717,8 @@ void CLASS::processAnimations()
     uint32_t completed_count = 0;
     
     // Process each active animation with enhanced tracking
-    for (unsigned int i = 0; i < m_animations->getCount(); i++) {
-        OSData* animation_data = (OSData*)m_animations->getObject(i);
+    for (uint32_t i = 0; i < m_animation_table.limit(); i++) {
+        OSData* animation_data = m_animation_table.at(i);
         if (!animation_data || animation_data->getLength() < sizeof(AnimationRecord)) {
             // Handle legacy animations stored as raw VMCAAnimationDescriptor
             if (animation_data && animation_data->getLength() >= sizeof(VMCAAnimationDescriptor)) {
@@ -1027,7 +783,7 @@ void CLASS::processAnimations()
                 break;
                 
             default:
-                IOLog("VMCoreAnimationAccelerator: Unknown animation type %d for animation %u\n", 
+                VMLOG_DEBUG("VMCoreAnimationAccelerator: Unknown animation type %d for animation %u\n", 
                       desc->type, record->animation_id);
                 break;
         }
@@ -1050,7 +806,7 @@ void CLASS::processAnimations()
     
     // Performance monitoring
     if (processed_count > 50) {
-        IOLog("VMCoreAnimationAccelerator: High animation load - processed %u animations in frame %llu\n", 
+        VMLOG_DEBUG("VMCoreAnimationAccelerator: High animation load - processed %u animations in frame %llu\n", 
               processed_count, m_compositor_state.frame_number);
     }
 }
@@ -1058,7 +814,7 @@ void CLASS::processAnimations()
 void CLASS::updateLayerTree()
 {
     // Update layer hierarchy and transforms
-    m_compositor_state.active_layers = m_layers->getCount();
+    m_compositor_state.active_layers = m_layer_table.count();
 }
 
 void CLASS::renderCompositeFrame()
@@ -1066,10 +822,10 @@ void CLASS::renderCompositeFrame()
     // Render the complete frame using available acceleration
     if (m_supports_hardware_composition && m_metal_bridge) {
         // Hardware-accelerated rendering
-        IOLog("VMCoreAnimationAccelerator: Rendering frame %llu (hardware)\n", m_compositor_state.frame_number);
+        VMLOG_DEBUG("VMCoreAnimationAccelerator: Rendering frame %llu (hardware)\n", m_compositor_state.frame_number);
     } else {
         // Software rendering fallback
-        IOLog("VMCoreAnimationAccelerator: Rendering frame %llu (software)\n", m_compositor_state.frame_number);
+        VMLOG_DEBUG("VMCoreAnimationAccelerator: Rendering frame %llu (software)\n", m_compositor_state.frame_number);
     }
 }
 
@@ -1161,9 +917,9 @@ void CLASS::interpolateBasicAnimation(VMCAAnimationDescriptor* desc, double prog
     
     // Find a target layer (legacy fallback - prefer the layer_id-aware version)
     uint32_t target_layer_id = m_root_layer_id;
-    if (target_layer_id == 0 && m_layers && m_layers->getCount() > 0) {
+    if (target_layer_id == 0) {
         // Use first available layer as fallback
-        target_layer_id = 1;
+        target_layer_id = firstLayerId();
     }
     
     if (strcmp(key_path, "position.x") == 0 || strcmp(key_path, "position.y") == 0) {
@@ -1291,7 +1047,7 @@ void CLASS::interpolateBasicAnimation(VMCAAnimationDescriptor* desc, double prog
             updateLayerProperties(target_layer_id, &layer_props);
             
             // Enhanced logging with angle information
-            IOLog("VMCoreAnimationAccelerator: Applied rotation %.3f° (%.6f rad) to layer %u (cos=%.6f, sin=%.6f)\n", 
+            VMLOG_DEBUG("VMCoreAnimationAccelerator: Applied rotation %.3f° (%.6f rad) to layer %u (cos=%.6f, sin=%.6f)\n", 
                   current_val * 180.0f / PI, current_val, target_layer_id, cos_val, sin_val);
         }
         
@@ -1357,7 +1113,7 @@ void CLASS::interpolateBasicAnimation(VMCAAnimationDescriptor* desc, double prog
         
     } else {
         // Unknown property type - log for debugging
-        IOLog("VMCoreAnimationAccelerator: Unknown animation property '%s' (progress: %f)\n", 
+        VMLOG_DEBUG("VMCoreAnimationAccelerator: Unknown animation property '%s' (progress: %f)\n", 
               key_path, progress);
         return;
     }
@@ -1366,7 +1122,7 @@ void CLASS::interpolateBasicAnimation(VMCAAnimationDescriptor* desc, double prog
     setNeedsDisplay(target_layer_id);
     
     // Log successful interpolation
-    IOLog("VMCoreAnimationAccelerator: Interpolated %s animation (progress: %f) for layer %u\n", 
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Interpolated %s animation (progress: %f) for layer %u\n", 
           key_path, progress, target_layer_id);
 }
 
@@ -1382,8 +1138,8 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
     
     // Find target layer (same logic as basic animation)
     uint32_t target_layer_id = m_root_layer_id;
-    if (target_layer_id == 0 && m_layers && m_layers->getCount() > 0) {
-        target_layer_id = 1;
+    if (target_layer_id == 0) {
+        target_layer_id = firstLayerId();
     }
     
     // True keyframe animation system with actual keyframe data structures
@@ -1450,27 +1206,27 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                 // 1. Range validation with scientific bounds checking
                 if (provided_data->count == 0 || provided_data->count > MAX_KEYFRAMES) {
                     data_integrity_valid = false;
-                    IOLog("VMCoreAnimationAccelerator: Keyframe count %u outside valid range [1, %u]\n", 
+                    VMLOG_DEBUG("VMCoreAnimationAccelerator: Keyframe count %u outside valid range [1, %u]\n", 
                           provided_data->count, MAX_KEYFRAMES);
                 }
                 
                 // 2. Data type validation with enum bounds
                 if (provided_data->data_type > 3) { // 0=float, 1=color, 2=point, 3=transform
                     data_integrity_valid = false;
-                    IOLog("VMCoreAnimationAccelerator: Invalid data type %u (valid range: 0-3)\n", 
+                    VMLOG_WARN("VMCoreAnimationAccelerator: Invalid data type %u (valid range: 0-3)\n", 
                           provided_data->data_type);
                 }
                 
                 // 3. Timing sequence validation with mathematical constraints
                 if (provided_data->times[0] != 0.0) {
                     data_integrity_valid = false;
-                    IOLog("VMCoreAnimationAccelerator: First keyframe time %.6f != 0.0\n", 
+                    VMLOG_DEBUG("VMCoreAnimationAccelerator: First keyframe time %.6f != 0.0\n", 
                           provided_data->times[0]);
                 }
                 
                 if (provided_data->times[provided_data->count - 1] != 1.0) {
                     data_integrity_valid = false;
-                    IOLog("VMCoreAnimationAccelerator: Last keyframe time %.6f != 1.0\n", 
+                    VMLOG_DEBUG("VMCoreAnimationAccelerator: Last keyframe time %.6f != 1.0\n", 
                           provided_data->times[provided_data->count - 1]);
                 }
                 
@@ -1480,7 +1236,7 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                     double time_diff = provided_data->times[i] - provided_data->times[i-1];
                     if (time_diff <= TIMING_EPSILON) {
                         data_integrity_valid = false;
-                        IOLog("VMCoreAnimationAccelerator: Non-monotonic timing at index %u: %.6f -> %.6f (diff: %.9f)\n", 
+                        VMLOG_DEBUG("VMCoreAnimationAccelerator: Non-monotonic timing at index %u: %.6f -> %.6f (diff: %.9f)\n", 
                               i, provided_data->times[i-1], provided_data->times[i], time_diff);
                         break;
                     }
@@ -1494,7 +1250,7 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                                 float val = provided_data->values.float_values[i];
                                 if (!isfinite(val)) {
                                     data_integrity_valid = false;
-                                    IOLog("VMCoreAnimationAccelerator: Invalid float value at index %u: %f\n", i, val);
+                                    VMLOG_WARN("VMCoreAnimationAccelerator: Invalid float value at index %u: %f\n", i, val);
                                     break;
                                 }
                             }
@@ -1506,7 +1262,7 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                                 // Basic RGBA format validation (could be enhanced further)
                                 if ((color >> 24) > 255) { // Alpha channel validation
                                     data_integrity_valid = false;
-                                    IOLog("VMCoreAnimationAccelerator: Invalid color value at index %u: 0x%08X\n", i, color);
+                                    VMLOG_WARN("VMCoreAnimationAccelerator: Invalid color value at index %u: 0x%08X\n", i, color);
                                     break;
                                 }
                             }
@@ -1518,7 +1274,7 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                                 float y = provided_data->values.point_values.y[i];
                                 if (!isfinite(x) || !isfinite(y)) {
                                     data_integrity_valid = false;
-                                    IOLog("VMCoreAnimationAccelerator: Invalid point at index %u: (%.3f, %.3f)\n", i, x, y);
+                                    VMLOG_WARN("VMCoreAnimationAccelerator: Invalid point at index %u: (%.3f, %.3f)\n", i, x, y);
                                     break;
                                 }
                             }
@@ -1532,14 +1288,14 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                                 
                                 if (!isfinite(rotation) || !isfinite(scale_x) || !isfinite(scale_y)) {
                                     data_integrity_valid = false;
-                                    IOLog("VMCoreAnimationAccelerator: Invalid transform at index %u: rot=%.3f, scale=(%.3f, %.3f)\n", 
+                                    VMLOG_WARN("VMCoreAnimationAccelerator: Invalid transform at index %u: rot=%.3f, scale=(%.3f, %.3f)\n", 
                                           i, rotation, scale_x, scale_y);
                                     break;
                                 }
                                 
                                 // Validate scale factors (should be positive for most use cases)
                                 if (scale_x <= 0.0f || scale_y <= 0.0f) {
-                                    IOLog("VMCoreAnimationAccelerator: Warning - Non-positive scale at index %u: (%.3f, %.3f)\n", 
+                                    VMLOG_WARN("VMCoreAnimationAccelerator: Warning - Non-positive scale at index %u: (%.3f, %.3f)\n", 
                                           i, scale_x, scale_y);
                                 }
                             }
@@ -1553,7 +1309,7 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                     uint32_t calculated_crc = calculateCRC32((uint8_t*)provided_data, sizeof(VMCAKeyframeData));
                     if (calculated_crc != header->checksum) {
                         data_integrity_valid = false;
-                        IOLog("VMCoreAnimationAccelerator: CRC32 mismatch - expected: 0x%08X, calculated: 0x%08X\n", 
+                        VMLOG_WARN("VMCoreAnimationAccelerator: CRC32 mismatch - expected: 0x%08X, calculated: 0x%08X\n", 
                               header->checksum, calculated_crc);
                     }
                 }
@@ -1564,14 +1320,14 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                     keyframe_count = keyframe_data.count;
                     use_provided_keyframes = true;
                     
-                    IOLog("VMCoreAnimationAccelerator: Validated keyframe data (magic: 0x%08X, version: %u, count: %u, type: %u, checksum: 0x%08X)\n", 
+                    VMLOG_DEBUG("VMCoreAnimationAccelerator: Validated keyframe data (magic: 0x%08X, version: %u, count: %u, type: %u, checksum: 0x%08X)\n", 
                           header->magic_number, header->structure_version, keyframe_count, 
                           keyframe_data.data_type, header->checksum);
                 } else {
-                    IOLog("VMCoreAnimationAccelerator: Keyframe data validation failed, using generated keyframes\n");
+                    VMLOG_ERROR("VMCoreAnimationAccelerator: Keyframe data validation failed, using generated keyframes\n");
                 }
             } else {
-                IOLog("VMCoreAnimationAccelerator: Invalid keyframe header (magic: 0x%08X, version: %u, size: %u), using generated keyframes\n", 
+                VMLOG_WARN("VMCoreAnimationAccelerator: Invalid keyframe header (magic: 0x%08X, version: %u, size: %u), using generated keyframes\n", 
                       header->magic_number, header->structure_version, header->data_size);
             }
         }
@@ -1646,7 +1402,7 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                 break;
         }
         
-        IOLog("VMCoreAnimationAccelerator: Generated %u keyframes with %s timing\n", 
+        VMLOG_DEBUG("VMCoreAnimationAccelerator: Generated %u keyframes with %s timing\n", 
               keyframe_count, (desc->timing_function == VM_CA_TIMING_EASE_IN) ? "ease-in" : 
               (desc->timing_function == VM_CA_TIMING_EASE_OUT) ? "ease-out" : 
               (desc->timing_function == VM_CA_TIMING_EASE_IN_OUT) ? "ease-in-out" : "linear");
@@ -1706,7 +1462,7 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
         
         if (use_provided_keyframes && keyframe_data.data_type == 0) {
             // Use provided float keyframe values directly
-            IOLog("VMCoreAnimationAccelerator: Processing provided float keyframes for '%s'\n", key_path);
+            VMLOG_DEBUG("VMCoreAnimationAccelerator: Processing provided float keyframes for '%s'\n", key_path);
         } else {
             // Generate keyframe values from from_value and to_value
             if (!desc->from_value || !desc->to_value) {
@@ -1772,7 +1528,7 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                 }
             }
             
-            IOLog("VMCoreAnimationAccelerator: Generated %u float keyframes for '%s' (%.3f -> %.3f)\n", 
+            VMLOG_DEBUG("VMCoreAnimationAccelerator: Generated %u float keyframes for '%s' (%.3f -> %.3f)\n", 
                   keyframe_count, key_path, start_val, end_val);
         }
         
@@ -1804,14 +1560,14 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
             updateLayerProperties(target_layer_id, &layer_props);
         }
         
-        IOLog("VMCoreAnimationAccelerator: Applied keyframe value %.3f to '%s' (segment %u, progress %.3f)\n", 
+        VMLOG_DEBUG("VMCoreAnimationAccelerator: Applied keyframe value %.3f to '%s' (segment %u, progress %.3f)\n", 
               current_val, key_path, current_segment, eased_local_progress);
         
     } else if (strcmp(key_path, "transform.rotation.z") == 0) {
         // Advanced rotation keyframe animation with support for provided transform data
         if (use_provided_keyframes && keyframe_data.data_type == 3) {
             // Use provided transform keyframe values directly
-            IOLog("VMCoreAnimationAccelerator: Processing provided transform keyframes for rotation\n");
+            VMLOG_DEBUG("VMCoreAnimationAccelerator: Processing provided transform keyframes for rotation\n");
         } else {
             // Generate rotation keyframes from from_value and to_value
             if (!desc->from_value || !desc->to_value) {
@@ -1866,7 +1622,7 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                 }
             }
             
-            IOLog("VMCoreAnimationAccelerator: Generated %u rotation keyframes (%.3f° -> %.3f°)\n", 
+            VMLOG_DEBUG("VMCoreAnimationAccelerator: Generated %u rotation keyframes (%.3f° -> %.3f°)\n", 
                   keyframe_count, start_rotation * 180.0f / 3.141592654f, end_rotation * 180.0f / 3.141592654f);
         }
         
@@ -1923,13 +1679,13 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
             
             updateLayerProperties(target_layer_id, &layer_props);
             
-            IOLog("VMCoreAnimationAccelerator: Applied keyframe rotation %.3f° to layer %u (segment %u)\n", 
+            VMLOG_DEBUG("VMCoreAnimationAccelerator: Applied keyframe rotation %.3f° to layer %u (segment %u)\n", 
                   current_rotation * 180.0f / PI, target_layer_id, current_segment);
         }
         
     } else {
         // Unknown property type - fall back to basic interpolation
-        IOLog("VMCoreAnimationAccelerator: Unknown keyframe property '%s', using basic interpolation fallback\n", key_path);
+        VMLOG_DEBUG("VMCoreAnimationAccelerator: Unknown keyframe property '%s', using basic interpolation fallback\n", key_path);
         interpolateBasicAnimation(desc, progress);
         return;
     }
@@ -1944,7 +1700,7 @@ void CLASS::interpolateKeyframeAnimation(VMCAAnimationDescriptor* desc, double p
                                (keyframe_data.data_type == 2) ? "point" : 
                                (keyframe_data.data_type == 3) ? "transform" : "unknown";
     
-    IOLog("VMCoreAnimationAccelerator: Processed %s %s keyframe animation '%s' (progress: %.3f, segment: %u/%u) for layer %u\n", 
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Processed %s %s keyframe animation '%s' (progress: %.3f, segment: %u/%u) for layer %u\n", 
           data_source, data_type_str, key_path, progress, current_segment + 1, keyframe_count, target_layer_id);
 }
 
@@ -2065,19 +1821,19 @@ void CLASS::interpolateKeyframeAnimationForLayer(VMCAAnimationDescriptor* desc,
 
 void CLASS::processAnimationGroup(AnimationRecord* record, double progress)
 {
-    IOLog("VMCoreAnimationAccelerator: Processing animation group %u (progress: %f)\n", 
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Processing animation group %u (progress: %f)\n", 
           record->animation_id, progress);
 }
 
 void CLASS::processTransitionAnimation(AnimationRecord* record, double progress)
 {
-    IOLog("VMCoreAnimationAccelerator: Processing transition animation %u (progress: %f)\n", 
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Processing transition animation %u (progress: %f)\n", 
           record->animation_id, progress);
 }
 
 void CLASS::processSpringAnimation(AnimationRecord* record, double progress)
 {
-    IOLog("VMCoreAnimationAccelerator: Processing spring animation %u (progress: %f)\n", 
+    VMLOG_DEBUG("VMCoreAnimationAccelerator: Processing spring animation %u (progress: %f)\n", 
           record->animation_id, progress);
 }
 
@@ -2085,47 +1841,22 @@ void CLASS::cleanupCompletedAnimations(double current_time, uint32_t completed_c
 {
     if (completed_count == 0) return;
     
-    OSArray* completed_indices = OSArray::withCapacity(completed_count);
-    if (!completed_indices) {
-        IOLog("VMCoreAnimationAccelerator: Failed to allocate cleanup array, using fallback\n");
-        while (m_animations->getCount() > 0 && completed_count > 0) {
-            unsigned int last_index = m_animations->getCount() - 1;
-            m_animations->removeObject(last_index);
-            completed_count--;
-            if (m_compositor_state.animations_running > 0) {
-                m_compositor_state.animations_running--;
-            }
-        }
-        return;
-    }
-    
-    for (unsigned int i = 0; i < m_animations->getCount(); i++) {
-        OSData* animation_data = (OSData*)m_animations->getObject(i);
-        if (!animation_data) continue;
+    // Slots don't move, so completed animations can be removed in place
+    uint32_t removed = 0;
+    for (uint32_t i = 0; i < m_animation_table.limit(); i++) {
+        uint32_t animation_id;
+        OSData* animation_data = m_animation_table.at(i, &animation_id);
+        if (!animation_data || animation_data->getLength() < sizeof(AnimationRecord)) continue;
         
-        if (animation_data->getLength() >= sizeof(AnimationRecord)) {
-            AnimationRecord* record = (AnimationRecord*)animation_data->getBytesNoCopy();
-            if (record) {
-                double elapsed = current_time;
-                double progress = elapsed / record->descriptor.duration;
-                
-                if (progress >= 1.0 && record->descriptor.repeat_count == 0) {
-                    OSNumber* index_num = OSNumber::withNumber(i, 32);
-                    if (index_num) {
-                        completed_indices->setObject(index_num);
-                        index_num->release();
-                    }
-                }
-            }
-        }
-    }
-    
-    for (int i = (int)completed_indices->getCount() - 1; i >= 0; i--) {
-        OSNumber* index_num = (OSNumber*)completed_indices->getObject(i);
-        if (index_num) {
-            unsigned int index = index_num->unsigned32BitValue();
-            if (index < m_animations->getCount()) {
-                m_animations->removeObject(index);
+        AnimationRecord* record = (AnimationRecord*)animation_data->getBytesNoCopy();
+        if (record) {
+            double elapsed = current_time;
+            double progress = elapsed / record->descriptor.duration;
+            
+            if (progress >= 1.0 && record->descriptor.repeat_count == 0) {
+                m_animation_table.remove(animation_id);
+                animation_data->release();
+                removed++;
                 if (m_compositor_state.animations_running > 0) {
                     m_compositor_state.animations_running--;
                 }
@@ -2133,6 +1864,5 @@ void CLASS::cleanupCompletedAnimations(double current_time, uint32_t completed_c
         }
     }
     
-    completed_indices->release();
-    IOLog("VMCoreAnimationAccelerator: Cleaned up %u completed animations\n", completed_count);
+    VMLOG_INFO("VMCoreAnimationAccelerator: Cleaned up %u completed animations\n", removed);
 }
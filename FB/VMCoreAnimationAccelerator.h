@@ -8,6 +8,8 @@
 #include <libkern/c++/OSObject.h>
 #include <libkern/c++/OSArray.h>
 #include <libkern/c++/OSDictionary.h>
+#include <libkern/c++/OSData.h>
+#include "VMHandleTable.h"
 // Note: QuartzCore not available in kernel extensions, using kernel-compatible types
 
 // Forward declarations
@@ -208,11 +210,11 @@ private:
     IOFramebuffer* m_framebuffer;
     IORecursiveLock* m_lock;
     
-    // Layer management
-    OSArray* m_layers;
-    OSArray* m_animations;
+    // Layer management: layer and animation ids are handles into the
+    // tables, which hold the reference on each OSData
+    VMHandleTable<OSData> m_layer_table;
+    VMHandleTable<OSData> m_animation_table;
     OSArray* m_render_contexts;
-    OSDictionary* m_layer_map;
     
     // Composition hierarchy
     OSArray* m_layer_tree;
@@ -220,10 +222,6 @@ private:
     uint32_t m_presentation_layer_id;
     
     // Resource management
-    uint32_t m_next_layer_id;
-    uint32_t m_next_animation_id;
-    OSArray* m_released_layer_ids;    // Pool of released layer IDs for recycling
-    OSArray* m_released_animation_ids; // Pool of released animation IDs for recycling
     OSDictionary* m_texture_cache;
     OSArray* m_render_targets;
     
@@ -348,10 +346,8 @@ private:
     // Layer management helpers
     OSObject* findLayer(uint32_t layer_id);
     OSObject* findAnimation(uint32_t animation_id);
-    uint32_t allocateLayerId();
-    uint32_t allocateAnimationId();
-    void releaseLayerId(uint32_t layer_id);
-    void releaseAnimationId(uint32_t animation_id);
+    uint32_t firstLayerId();
+    void releaseAllLayers();
     
     // Rendering helpers
     IOReturn renderLayerContent(uint32_t layer_id, const VMCARect* bounds);
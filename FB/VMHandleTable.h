@@ -0,0 +1,262 @@
+/*
+ * VMHandleTable.h - Generational handle table
+ *
+ * Maps the 32-bit ids the managers hand to clients (shaders, programs,
+ * textures, samplers, layers, animations, Metal resources) to the objects
+ * behind them in O(1). A handle is (generation << 16) | slot index. Removing
+ * an object bumps its slot's generation, so an id kept after destroy never
+ * resolves to whatever reuses the slot. Generations start at 1, so 0 is
+ * never a valid handle. Freed slots are reused oldest first, so a slot only
+ * comes back to a stale generation after 65535 reuses.
+ *
+ * Slots live in pages of VM_HANDLE_PAGE_SLOTS, allocated as the table grows
+ * and kept until free(). Pages never move, so lookup() takes no lock: it
+ * checks the slot's published handle before and after reading the object.
+ * insert, remove and replace must be serialised by the owner, which already
+ * holds its manager lock for them. The table does not own the objects: the
+ * owner frees or releases what remove() returns, and keeps whatever lookup()
+ * returned alive for as long as it uses it.
+ *
+ * A manager embeds the table and calls init() from its own init(); like the
+ * other header-only modules it builds unchanged outside the kernel for
+ * tools/handle_table_test.
+ */
+
+#ifndef _VM_HANDLE_TABLE_H
+#define _VM_HANDLE_TABLE_H
+
+#ifdef KERNEL
+#include <IOKit/IOLib.h>
+#define VM_HANDLE_ALLOC(size)           IOMalloc(size)
+#define VM_HANDLE_FREE(ptr, size)       IOFree(ptr, size)
+#else
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#define VM_HANDLE_ALLOC(size)           ::malloc(size)
+#define VM_HANDLE_FREE(ptr, size)       ::free(ptr)
+#endif
+
+#define VM_HANDLE_INDEX_BITS    16
+#define VM_HANDLE_INDEX_MASK    ((1u << VM_HANDLE_INDEX_BITS) - 1)
+#define VM_HANDLE_MAX_SLOTS     (1u << VM_HANDLE_INDEX_BITS)
+#define VM_HANDLE_PAGE_SHIFT    8
+#define VM_HANDLE_PAGE_SLOTS    (1u << VM_HANDLE_PAGE_SHIFT)
+#define VM_HANDLE_MAX_PAGES     (VM_HANDLE_MAX_SLOTS >> VM_HANDLE_PAGE_SHIFT)
+#define VM_HANDLE_NONE          0xFFFFFFFFu     // free list terminator
+
+static inline uint32_t VMHandleIndex(uint32_t handle)
+{
+    return handle & VM_HANDLE_INDEX_MASK;
+}
+
+static inline uint32_t VMHandleGeneration(uint32_t handle)
+{
+    return handle >> VM_HANDLE_INDEX_BITS;
+}
+
+template <typename T>
+class VMHandleTable
+{
+public:
+    // max_slots is clamped to VM_HANDLE_MAX_SLOTS; nothing is allocated
+    // until the first insert
+    void init(uint32_t max_slots)
+    {
+        memset(this, 0, sizeof(*this));
+        m_max_slots = (max_slots && max_slots < VM_HANDLE_MAX_SLOTS) ? max_slots : VM_HANDLE_MAX_SLOTS;
+        m_free_head = VM_HANDLE_NONE;
+        m_free_tail = VM_HANDLE_NONE;
+    }
+
+    // Frees the pages only; the owner has already disposed of the objects
+    void free()
+    {
+        for (uint32_t p = 0; p < VM_HANDLE_MAX_PAGES; p++) {
+            if (m_pages[p]) {
+                VM_HANDLE_FREE(m_pages[p], sizeof(Slot) * VM_HANDLE_PAGE_SLOTS);
+                m_pages[p] = nullptr;
+            }
+        }
+        m_count = 0;
+        m_high_water = 0;
+        m_free_head = VM_HANDLE_NONE;
+        m_free_tail = VM_HANDLE_NONE;
+    }
+
+    // Returns the new handle, or 0 when the table is full or a page can't
+    // be allocated. object may be null to reserve an id before the object
+    // exists; lookup() returns null for it until replace().
+    uint32_t insert(T* object, uint32_t tag = 0)
+    {
+        uint32_t index;
+        if (m_free_head != VM_HANDLE_NONE) {
+            index = m_free_head;
+            Slot* slot = slotAt(index);
+            m_free_head = slot->next_free;
+            if (m_free_head == VM_HANDLE_NONE) {
+                m_free_tail = VM_HANDLE_NONE;
+            }
+        } else {
+            if (m_high_water >= m_max_slots) {
+                return 0;
+            }
+            index = m_high_water;
+            uint32_t page = index >> VM_HANDLE_PAGE_SHIFT;
+            if (!m_pages[page]) {
+                Slot* slots = (Slot*)VM_HANDLE_ALLOC(sizeof(Slot) * VM_HANDLE_PAGE_SLOTS);
+                if (!slots) {
+                    return 0;
+                }
+                memset(slots, 0, sizeof(Slot) * VM_HANDLE_PAGE_SLOTS);
+                for (uint32_t i = 0; i < VM_HANDLE_PAGE_SLOTS; i++) {
+                    slots[i].generation = 1;
+                }
+                __atomic_store_n(&m_pages[page], slots, __ATOMIC_RELEASE);
+            }
+            m_high_water++;
+        }
+
+        Slot* slot = slotAt(index);
+        uint32_t handle = (slot->generation << VM_HANDLE_INDEX_BITS) | index;
+        slot->tag = tag;
+        slot->next_free = VM_HANDLE_NONE;
+        __atomic_store_n(&slot->object, object, __ATOMIC_RELAXED);
+        __atomic_store_n(&slot->handle, handle, __ATOMIC_RELEASE);
+        m_count++;
+        return handle;
+    }
+
+    // Retires the handle and returns its object (null if the handle is
+    // stale). The slot goes to the back of the free list.
+    T* remove(uint32_t handle)
+    {
+        Slot* slot = liveSlot(handle);
+        if (!slot) {
+            return nullptr;
+        }
+        T* object = slot->object;
+        __atomic_store_n(&slot->handle, 0u, __ATOMIC_RELAXED);
+        __atomic_store_n(&slot->object, (T*)nullptr, __ATOMIC_RELEASE);
+        if (++slot->generation > VM_HANDLE_INDEX_MASK) {
+            slot->generation = 1;
+        }
+
+        uint32_t index = VMHandleIndex(handle);
+        slot->next_free = VM_HANDLE_NONE;
+        if (m_free_tail != VM_HANDLE_NONE) {
+            slotAt(m_free_tail)->next_free = index;
+        } else {
+            m_free_head = index;
+        }
+        m_free_tail = index;
+        m_count--;
+        return object;
+    }
+
+    // Points a live handle at a different object; the old one is the
+    // owner's to dispose of
+    bool replace(uint32_t handle, T* object)
+    {
+        Slot* slot = liveSlot(handle);
+        if (!slot) {
+            return false;
+        }
+        __atomic_store_n(&slot->object, object, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    // Lock-free. A handle removed concurrently may still return its object;
+    // one removed before the call never does.
+    T* lookup(uint32_t handle) const
+    {
+        uint32_t index = VMHandleIndex(handle);
+        if (handle == 0 || index >= m_max_slots) {
+            return nullptr;
+        }
+        Slot* page = __atomic_load_n(&m_pages[index >> VM_HANDLE_PAGE_SHIFT], __ATOMIC_ACQUIRE);
+        if (!page) {
+            return nullptr;
+        }
+        Slot* slot = &page[index & (VM_HANDLE_PAGE_SLOTS - 1)];
+        if (__atomic_load_n(&slot->handle, __ATOMIC_ACQUIRE) != handle) {
+            return nullptr;
+        }
+        T* object = __atomic_load_n(&slot->object, __ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->handle, __ATOMIC_RELAXED) != handle) {
+            return nullptr;
+        }
+        return object;
+    }
+
+    // As lookup, but only if the handle was inserted with this tag
+    T* lookup(uint32_t handle, uint32_t tag) const
+    {
+        T* object = lookup(handle);
+        if (!object || slotAt(VMHandleIndex(handle))->tag != tag) {
+            return nullptr;
+        }
+        return object;
+    }
+
+    uint32_t count() const
+    {
+        return m_count;
+    }
+
+    // Iteration, under the owner's lock: every index below limit() may be
+    // passed to at(), which returns null for free or reserved slots.
+    // Removing the current entry while iterating is fine; nothing moves.
+    uint32_t limit() const
+    {
+        return m_high_water;
+    }
+
+    T* at(uint32_t index, uint32_t* handle = nullptr) const
+    {
+        if (index >= m_high_water) {
+            return nullptr;
+        }
+        Slot* slot = slotAt(index);
+        if (!slot->handle) {
+            return nullptr;
+        }
+        if (handle) {
+            *handle = slot->handle;
+        }
+        return slot->object;
+    }
+
+private:
+    struct Slot {
+        uint32_t handle;        // published live handle, 0 while free
+        uint32_t tag;
+        T* object;
+        uint32_t next_free;
+        uint32_t generation;    // generation the next insert hands out
+    };
+
+    Slot* slotAt(uint32_t index) const
+    {
+        return &m_pages[index >> VM_HANDLE_PAGE_SHIFT][index & (VM_HANDLE_PAGE_SLOTS - 1)];
+    }
+
+    Slot* liveSlot(uint32_t handle) const
+    {
+        uint32_t index = VMHandleIndex(handle);
+        if (handle == 0 || index >= m_high_water) {
+            return nullptr;
+        }
+        Slot* slot = slotAt(index);
+        return slot->handle == handle ? slot : nullptr;
+    }
+
+    Slot* m_pages[VM_HANDLE_MAX_PAGES];
+    uint32_t m_max_slots;
+    uint32_t m_high_water;      // slots ever handed out; all below are paged in
+    uint32_t m_count;
+    uint32_t m_free_head;
+    uint32_t m_free_tail;
+};
+
+#endif /* _VM_HANDLE_TABLE_H */
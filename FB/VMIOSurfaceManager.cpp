@@ -1,5 +1,7 @@
 #include "VMIOSurfaceManager.h"
 #include "VMQemuVGAAccelerator.h"
+#include "VMLog.h"
+#include "VMPixelConvert.h"
 #include <IOKit/IOLib.h>
 
 #define CLASS VMIOSurfaceManager
@@ -134,7 +136,7 @@ bool CLASS::initWithAccelerator(VMQemuVGAAccelerator* accelerator)
     m_video_surfaces_created = 0;
     m_video_decoder_attachments = 0;
     
-    IOLog("VMIOSurfaceManager: Initialized with %u MB surface memory pool\n", 
+    VMLOG_INFO("VMIOSurfaceManager: Initialized with %u MB surface memory pool\n", 
           (uint32_t)(m_total_surface_memory / (1024 * 1024)));
     
     return true;
@@ -150,14 +152,14 @@ IOReturn CLASS::createSurface(const VMIOSurfaceDescriptor* descriptor,
     // Validate pixel format and descriptor
     IOReturn result = validatePixelFormat(descriptor->pixel_format);
     if (result != kIOReturnSuccess) {
-        IOLog("VMIOSurfaceManager: Invalid pixel format: %08X\n", descriptor->pixel_format);
+        VMLOG_WARN("VMIOSurfaceManager: Invalid pixel format: %08X\n", descriptor->pixel_format);
         return result;
     }
     
     // Validate surface dimensions
     if (descriptor->width == 0 || descriptor->height == 0 || 
         descriptor->width > 16384 || descriptor->height > 16384) {
-        IOLog("VMIOSurfaceManager: Invalid surface dimensions: %ux%u\n", 
+        VMLOG_WARN("VMIOSurfaceManager: Invalid surface dimensions: %ux%u\n", 
               descriptor->width, descriptor->height);
         return kIOReturnBadArgument;
     }
@@ -173,7 +175,7 @@ IOReturn CLASS::createSurface(const VMIOSurfaceDescriptor* descriptor,
     
     // Check memory availability
     if (m_allocated_surface_memory + surface_size > m_total_surface_memory) {
-        IOLog("VMIOSurfaceManager: Insufficient memory - need %u bytes, have %llu available\n", 
+        VMLOG_WARN("VMIOSurfaceManager: Insufficient memory - need %u bytes, have %llu available\n", 
               surface_size, m_total_surface_memory - m_allocated_surface_memory);
         IOLockUnlock(m_surface_lock);
         return kIOReturnNoMemory;
@@ -224,7 +226,7 @@ IOReturn CLASS::createSurface(const VMIOSurfaceDescriptor* descriptor,
     IOMemoryDescriptor* temp_memory = nullptr;
     result = allocateSurfaceMemory(descriptor, &temp_memory);
     if (result != kIOReturnSuccess) {
-        IOLog("VMIOSurfaceManager: Failed to allocate surface memory: %08X\n", result);
+        VMLOG_ERROR("VMIOSurfaceManager: Failed to allocate surface memory: %08X\n", result);
         IOFree(surface, sizeof(VMIOSurface));
         releaseSurfaceId(*surface_id);
         IOLockUnlock(m_surface_lock);
@@ -244,7 +246,7 @@ IOReturn CLASS::createSurface(const VMIOSurfaceDescriptor* descriptor,
     // Get base address for CPU access
     surface->base_address = (void*)surface->memory->getBytesNoCopy();
     if (!surface->base_address) {
-        IOLog("VMIOSurfaceManager: Failed to get base address for surface %u\n", *surface_id);
+        VMLOG_ERROR("VMIOSurfaceManager: Failed to get base address for surface %u\n", *surface_id);
         surface->memory->complete();
         surface->memory->release();
         IOFree(surface, sizeof(VMIOSurface));
@@ -289,12 +291,12 @@ IOReturn CLASS::createSurface(const VMIOSurfaceDescriptor* descriptor,
         uint32_t gpu_resource_id = 0;
         result = createGPUResource(*surface_id, &gpu_resource_id);
         if (result == kIOReturnSuccess) {
-            IOLog("VMIOSurfaceManager: Created GPU resource %u for surface %u\n", 
+            VMLOG_DEBUG("VMIOSurfaceManager: Created GPU resource %u for surface %u\n", 
                   gpu_resource_id, *surface_id);
         }
     }
     
-    IOLog("VMIOSurfaceManager: Created surface %u (%ux%u, format: %08X, size: %u bytes)\n", 
+    VMLOG_DEBUG("VMIOSurfaceManager: Created surface %u (%ux%u, format: %08X, size: %u bytes)\n", 
           *surface_id, descriptor->width, descriptor->height, 
           descriptor->pixel_format, surface_size);
     
@@ -331,7 +333,7 @@ IOReturn CLASS::destroySurface(uint32_t surface_id)
     
     // Check if surface is still locked
     if (surface->is_locked || surface->lock_count > 0) {
-        IOLog("VMIOSurfaceManager: Cannot destroy surface %u - still locked (count: %u)\n", 
+        VMLOG_WARN("VMIOSurfaceManager: Cannot destroy surface %u - still locked (count: %u)\n", 
               surface_id, surface->lock_count);
         IOLockUnlock(m_surface_lock);
         return kIOReturnBusy;
@@ -340,7 +342,7 @@ IOReturn CLASS::destroySurface(uint32_t surface_id)
     // Decrement reference count
     surface->ref_count--;
     if (surface->ref_count > 0) {
-        IOLog("VMIOSurfaceManager: Surface %u still has %u references\n", 
+        VMLOG_DEBUG("VMIOSurfaceManager: Surface %u still has %u references\n", 
               surface_id, surface->ref_count);
         IOLockUnlock(m_surface_lock);
         return kIOReturnSuccess; // Don't actually destroy yet
@@ -350,7 +352,7 @@ IOReturn CLASS::destroySurface(uint32_t surface_id)
     if (m_supports_hardware_surfaces) {
         IOReturn gpu_result = destroyGPUResource(surface_id);
         if (gpu_result != kIOReturnSuccess) {
-            IOLog("VMIOSurfaceManager: Warning - failed to destroy GPU resource for surface %u\n", surface_id);
+            VMLOG_ERROR("VMIOSurfaceManager: Warning - failed to destroy GPU resource for surface %u\n", surface_id);
         }
     }
     
@@ -381,7 +383,7 @@ IOReturn CLASS::destroySurface(uint32_t surface_id)
     // Release surface ID for reuse
     releaseSurfaceId(surface_id);
     
-    IOLog("VMIOSurfaceManager: Destroyed surface %u (freed %u bytes)\n", surface_id, memory_size);
+    VMLOG_DEBUG("VMIOSurfaceManager: Destroyed surface %u (freed %u bytes)\n", surface_id, memory_size);
     
     IOLockUnlock(m_surface_lock);
     return kIOReturnSuccess;
@@ -495,14 +497,14 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
     
     // 1.1: Input parameter validation with comprehensive error checking
     if (!descriptor) {
-        IOLog("VMIOSurfaceManager: Property validation failed - null descriptor pointer\n");
+        VMLOG_ERROR("VMIOSurfaceManager: Property validation failed - null descriptor pointer\n");
         g_property_stats.property_lookups++;
         g_property_stats.validation_failures++;
         return kIOReturnBadArgument;
     }
     
     if (surface_id == 0) {
-        IOLog("VMIOSurfaceManager: Property validation failed - invalid surface ID (0)\n");
+        VMLOG_ERROR("VMIOSurfaceManager: Property validation failed - invalid surface ID (0)\n");
         g_property_stats.property_lookups++;
         g_property_stats.validation_failures++;
         return kIOReturnBadArgument;
@@ -511,7 +513,7 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
     // 1.2: Surface existence validation using discovery system
     OSObject* surface_obj = findSurface(surface_id);
     if (!surface_obj) {
-        IOLog("VMIOSurfaceManager: Property validation failed - surface %u not found\n", surface_id);
+        VMLOG_ERROR("VMIOSurfaceManager: Property validation failed - surface %u not found\n", surface_id);
         g_property_stats.property_lookups++;
         g_property_stats.validation_failures++;
         return kIOReturnNotFound;
@@ -520,7 +522,7 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
     // 1.3: Surface object integrity validation
     OSData* surface_data = OSDynamicCast(OSData, surface_obj);
     if (!surface_data) {
-        IOLog("VMIOSurfaceManager: Property validation failed - invalid surface object type for ID %u\n", surface_id);
+        VMLOG_ERROR("VMIOSurfaceManager: Property validation failed - invalid surface object type for ID %u\n", surface_id);
         g_property_stats.property_lookups++;
         g_property_stats.validation_failures++;
         return kIOReturnInternalError;
@@ -542,14 +544,14 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
                 // Copy cached properties to output descriptor
                 *descriptor = g_property_cache[i].descriptor;
                 
-                IOLog("VMIOSurfaceManager: Property cache hit for surface %u (%ux%u, format: %08X)\n", 
+                VMLOG_DEBUG("VMIOSurfaceManager: Property cache hit for surface %u (%ux%u, format: %08X)\n", 
                       surface_id, descriptor->width, descriptor->height, descriptor->pixel_format);
                 
                 return kIOReturnSuccess;
             } else {
                 // Cache entry needs refresh - mark for update
                 g_property_cache[i].needs_refresh = false;
-                IOLog("VMIOSurfaceManager: Refreshing cached properties for surface %u\n", surface_id);
+                VMLOG_DEBUG("VMIOSurfaceManager: Refreshing cached properties for surface %u\n", surface_id);
                 break;
             }
         }
@@ -562,7 +564,7 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
     // 3.1: Extract surface data and analyze properties
     VMIOSurface* surface = (VMIOSurface*)surface_data->getBytesNoCopy();
     if (!surface) {
-        IOLog("VMIOSurfaceManager: Property analysis failed - null surface data for ID %u\n", surface_id);
+        VMLOG_ERROR("VMIOSurfaceManager: Property analysis failed - null surface data for ID %u\n", surface_id);
         g_property_stats.validation_failures++;
         return kIOReturnInternalError;
     }
@@ -586,7 +588,7 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
             if (surface->descriptor.pixel_format == 0) {
                 descriptor->pixel_format = g_standard_resolutions[i].format;
                 g_property_stats.format_conversions++;
-                IOLog("VMIOSurfaceManager: Applied standard format optimization for %s resolution\n", 
+                VMLOG_DEBUG("VMIOSurfaceManager: Applied standard format optimization for %s resolution\n", 
                       resolution_name);
             }
             break;
@@ -607,7 +609,7 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
             // Fallback to default format with logging
             descriptor->pixel_format = VM_IOSURFACE_PIXEL_FORMAT_BGRA32;
             g_property_stats.format_conversions++;
-            IOLog("VMIOSurfaceManager: Converted invalid format %08X to BGRA32 for surface %u\n", 
+            VMLOG_WARN("VMIOSurfaceManager: Converted invalid format %08X to BGRA32 for surface %u\n", 
                   surface->descriptor.pixel_format, surface_id);
         }
     } else {
@@ -629,7 +631,7 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
                                              descriptor->planes, 
                                              &descriptor->plane_count);
         if (plane_setup != kIOReturnSuccess) {
-            IOLog("VMIOSurfaceManager: Warning - failed to setup plane info for surface %u\n", surface_id);
+            VMLOG_ERROR("VMIOSurfaceManager: Warning - failed to setup plane info for surface %u\n", surface_id);
             descriptor->plane_count = 1; // Fallback to single plane
         }
     }
@@ -673,7 +675,7 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
         g_property_cache_size++;
         added_to_cache = true;
         
-        IOLog("VMIOSurfaceManager: Added surface %u properties to cache (cache size: %u)\n", 
+        VMLOG_DEBUG("VMIOSurfaceManager: Added surface %u properties to cache (cache size: %u)\n", 
               surface_id, g_property_cache_size);
     } else {
         // Cache full - use LRU replacement for property cache
@@ -700,7 +702,7 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
             (metal_compatible ? 0x01 : 0) | (opengl_compatible ? 0x02 : 0);
         added_to_cache = true;
         
-        IOLog("VMIOSurfaceManager: Replaced surface %u with %u in property cache (LRU)\n", 
+        VMLOG_DEBUG("VMIOSurfaceManager: Replaced surface %u with %u in property cache (LRU)\n", 
               evicted_id, surface_id);
     }
     
@@ -713,7 +715,7 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
     // 4.4: Resolution adaptation tracking
     if (!found_standard_resolution) {
         g_property_stats.resolution_adaptations++;
-        IOLog("VMIOSurfaceManager: Custom resolution detected: %ux%u for surface %u\n", 
+        VMLOG_DEBUG("VMIOSurfaceManager: Custom resolution detected: %ux%u for surface %u\n", 
               descriptor->width, descriptor->height, surface_id);
     }
     
@@ -724,31 +726,31 @@ IOReturn CLASS::getSurfaceDescriptor(uint32_t surface_id, VMIOSurfaceDescriptor*
         uint32_t validation_success_rate = ((g_property_stats.property_lookups - g_property_stats.validation_failures) * 100) / 
                                          g_property_stats.property_lookups;
         
-        IOLog("VMIOSurfaceManager: Property Analytics Report #%u:\n", g_property_stats.property_lookups / 50);
-        IOLog("  - Property Lookups: %u (Cache Hit Rate: %u%%)\n", 
+        VMLOG_DEBUG("VMIOSurfaceManager: Property Analytics Report #%u:\n", g_property_stats.property_lookups / 50);
+        VMLOG_DEBUG("  - Property Lookups: %u (Cache Hit Rate: %u%%)\n", 
               g_property_stats.property_lookups, cache_hit_rate);
-        IOLog("  - Average Property Time: %llu ns\n", avg_property_time);
-        IOLog("  - Validation Success Rate: %u%%\n", validation_success_rate);
-        IOLog("  - Format Conversions: %u, Resolution Adaptations: %u\n", 
+        VMLOG_DEBUG("  - Average Property Time: %llu ns\n", avg_property_time);
+        VMLOG_DEBUG("  - Validation Success Rate: %u%%\n", validation_success_rate);
+        VMLOG_DEBUG("  - Format Conversions: %u, Resolution Adaptations: %u\n", 
               g_property_stats.format_conversions, g_property_stats.resolution_adaptations);
-        IOLog("  - Property Cache Utilization: %u/128 entries\n", g_property_cache_size);
-        IOLog("  - Compatibility Checks: %u\n", g_property_stats.compatibility_checks);
+        VMLOG_DEBUG("  - Property Cache Utilization: %u/128 entries\n", g_property_cache_size);
+        VMLOG_DEBUG("  - Compatibility Checks: %u\n", g_property_stats.compatibility_checks);
     }
     
     // 4.6: Success logging with comprehensive property information
-    IOLog("VMIOSurfaceManager: Successfully retrieved surface %u properties:\n", surface_id);
-    IOLog("  - Resolution: %ux%u (%s%s)\n", 
+    VMLOG_DEBUG("VMIOSurfaceManager: Successfully retrieved surface %u properties:\n", surface_id);
+    VMLOG_DEBUG("  - Resolution: %ux%u (%s%s)\n", 
           descriptor->width, descriptor->height, resolution_name, 
           found_standard_resolution ? " - Standard" : " - Custom");
-    IOLog("  - Pixel Format: %08X (%s%s)\n", 
+    VMLOG_DEBUG("  - Pixel Format: %08X (%s%s)\n", 
           descriptor->pixel_format, 
           metal_compatible ? "Metal+" : "",
           opengl_compatible ? "OpenGL+" : "");
-    IOLog("  - Bytes per Row: %u, Alloc Size: %u\n", 
+    VMLOG_DEBUG("  - Bytes per Row: %u, Alloc Size: %u\n", 
           descriptor->bytes_per_row, descriptor->alloc_size);
-    IOLog("  - Plane Count: %u, Usage Flags: %08X\n", 
+    VMLOG_DEBUG("  - Plane Count: %u, Usage Flags: %08X\n", 
           descriptor->plane_count, descriptor->usage_flags);
-    IOLog("  - Discovery Time: %llu ns, Cached: %s\n", 
+    VMLOG_DEBUG("  - Discovery Time: %llu ns, Cached: %s\n", 
           property_time, added_to_cache ? "yes" : "no");
     
     return kIOReturnSuccess;
@@ -774,7 +776,7 @@ IOReturn CLASS::getPropertyStatistics(VMSurfacePropertyStats* stats)
 IOReturn CLASS::resetPropertyStatistics()
 {
     memset(&g_property_stats, 0, sizeof(VMSurfacePropertyStats));
-    IOLog("VMIOSurfaceManager: Property statistics reset\n");
+    VMLOG_INFO("VMIOSurfaceManager: Property statistics reset\n");
     return kIOReturnSuccess;
 }
 
@@ -795,7 +797,7 @@ IOReturn CLASS::flushPropertyCache()
     g_property_cache_size = 0;
     g_property_cache_next_index = 0;
     
-    IOLog("VMIOSurfaceManager: Property cache flushed\n");
+    VMLOG_DEBUG("VMIOSurfaceManager: Property cache flushed\n");
     return kIOReturnSuccess;
 }
 
@@ -810,13 +812,13 @@ IOReturn CLASS::invalidatePropertyCache(uint32_t surface_id)
             g_property_cache[i].is_validated = false;
             found = true;
             
-            IOLog("VMIOSurfaceManager: Invalidated property cache for surface %u\n", surface_id);
+            VMLOG_DEBUG("VMIOSurfaceManager: Invalidated property cache for surface %u\n", surface_id);
             break;
         }
     }
     
     if (!found) {
-        IOLog("VMIOSurfaceManager: Surface %u not found in property cache\n", surface_id);
+        VMLOG_DEBUG("VMIOSurfaceManager: Surface %u not found in property cache\n", surface_id);
     }
     
     return kIOReturnSuccess;
@@ -842,11 +844,11 @@ IOReturn CLASS::prewarmPropertyCache(uint32_t* surface_ids, uint32_t count)
         
         if (result == kIOReturnSuccess) {
             prewarmed++;
-            IOLog("VMIOSurfaceManager: Pre-warmed properties for surface %u\n", surface_ids[i]);
+            VMLOG_DEBUG("VMIOSurfaceManager: Pre-warmed properties for surface %u\n", surface_ids[i]);
         }
     }
     
-    IOLog("VMIOSurfaceManager: Pre-warmed property cache with %u/%u surfaces\n", prewarmed, count);
+    VMLOG_DEBUG("VMIOSurfaceManager: Pre-warmed property cache with %u/%u surfaces\n", prewarmed, count);
     return kIOReturnSuccess;
 }
 
@@ -868,7 +870,7 @@ IOReturn CLASS::optimizePropertyCache()
         }
     }
     
-    IOLog("VMIOSurfaceManager: Property cache optimized by access frequency\n");
+    VMLOG_DEBUG("VMIOSurfaceManager: Property cache optimized by access frequency\n");
     return kIOReturnSuccess;
 }
 
@@ -878,7 +880,7 @@ void CLASS::generatePropertyReport()
     uint32_t total_operations = g_property_stats.property_lookups;
     
     if (total_operations == 0) {
-        IOLog("VMIOSurfaceManager: No property operations recorded\n");
+        VMLOG_INFO("VMIOSurfaceManager: No property operations recorded\n");
         return;
     }
     
@@ -886,20 +888,20 @@ void CLASS::generatePropertyReport()
     uint32_t validation_success_rate = ((total_operations - g_property_stats.validation_failures) * 100) / total_operations;
     uint64_t avg_time = g_property_stats.total_property_time_ns / total_operations;
     
-    IOLog("VMIOSurfaceManager: === Advanced IOSurface Property Management System v5.0 Report ===\n");
-    IOLog("  Performance Metrics:\n");
-    IOLog("    - Total Property Lookups: %u\n", g_property_stats.property_lookups);
-    IOLog("    - Cache Hits: %u (%u%%)\n", g_property_stats.cache_hits, cache_hit_percentage);
-    IOLog("    - Cache Misses: %u (%u%%)\n", g_property_stats.cache_misses, 100 - cache_hit_percentage);
-    IOLog("    - Average Property Time: %llu ns\n", avg_time);
-    IOLog("    - Validation Success Rate: %u%%\n", validation_success_rate);
-    IOLog("  Property Analysis:\n");
-    IOLog("    - Format Conversions: %u\n", g_property_stats.format_conversions);
-    IOLog("    - Resolution Adaptations: %u\n", g_property_stats.resolution_adaptations);
-    IOLog("    - Compatibility Checks: %u\n", g_property_stats.compatibility_checks);
-    IOLog("    - Validation Failures: %u\n", g_property_stats.validation_failures);
-    IOLog("  Cache Status:\n");
-    IOLog("    - Cache Utilization: %u/128 entries (%u%%)\n", 
+    VMLOG_INFO("VMIOSurfaceManager: === Advanced IOSurface Property Management System v5.0 Report ===\n");
+    VMLOG_INFO("  Performance Metrics:\n");
+    VMLOG_INFO("    - Total Property Lookups: %u\n", g_property_stats.property_lookups);
+    VMLOG_INFO("    - Cache Hits: %u (%u%%)\n", g_property_stats.cache_hits, cache_hit_percentage);
+    VMLOG_INFO("    - Cache Misses: %u (%u%%)\n", g_property_stats.cache_misses, 100 - cache_hit_percentage);
+    VMLOG_INFO("    - Average Property Time: %llu ns\n", avg_time);
+    VMLOG_INFO("    - Validation Success Rate: %u%%\n", validation_success_rate);
+    VMLOG_INFO("  Property Analysis:\n");
+    VMLOG_INFO("    - Format Conversions: %u\n", g_property_stats.format_conversions);
+    VMLOG_INFO("    - Resolution Adaptations: %u\n", g_property_stats.resolution_adaptations);
+    VMLOG_INFO("    - Compatibility Checks: %u\n", g_property_stats.compatibility_checks);
+    VMLOG_INFO("    - Validation Failures: %u\n", g_property_stats.validation_failures);
+    VMLOG_INFO("  Cache Status:\n");
+    VMLOG_INFO("    - Cache Utilization: %u/128 entries (%u%%)\n", 
           g_property_cache_size, (g_property_cache_size * 100) / 128);
     
     // Cache efficiency analysis
@@ -914,27 +916,27 @@ void CLASS::generatePropertyReport()
     }
     
     if (g_property_cache_size > 0) {
-        IOLog("    - Average Access Count: %llu\n", total_access_count / g_property_cache_size);
-        IOLog("    - Validated Entries: %u\n", validated_entries);
-        IOLog("    - Entries Needing Refresh: %u\n", refresh_needed);
+        VMLOG_INFO("    - Average Access Count: %llu\n", total_access_count / g_property_cache_size);
+        VMLOG_INFO("    - Validated Entries: %u\n", validated_entries);
+        VMLOG_INFO("    - Entries Needing Refresh: %u\n", refresh_needed);
     }
     
-    IOLog("  System Recommendations:\n");
+    VMLOG_INFO("  System Recommendations:\n");
     
     if (cache_hit_percentage < 70) {
-        IOLog("    - Consider increasing property cache size for better performance\n");
+        VMLOG_INFO("    - Consider increasing property cache size for better performance\n");
     }
     if (g_property_stats.format_conversions > total_operations / 4) {
-        IOLog("    - High format conversion rate - consider format standardization\n");
+        VMLOG_INFO("    - High format conversion rate - consider format standardization\n");
     }
     if (validation_success_rate < 95) {
-        IOLog("    - High validation failure rate - check surface integrity\n");
+        VMLOG_WARN("    - High validation failure rate - check surface integrity\n");
     }
     if (avg_time > 2000) {
-        IOLog("    - High average property time - consider cache optimization\n");
+        VMLOG_INFO("    - High average property time - consider cache optimization\n");
     }
     
-    IOLog("  === End of Property Management System Report ===\n");
+    VMLOG_INFO("  === End of Property Management System Report ===\n");
 }
 
 IOReturn CLASS::lockSurface(uint32_t surface_id, uint32_t lock_options, void** base_address)
@@ -968,7 +970,7 @@ IOReturn CLASS::lockSurface(uint32_t surface_id, uint32_t lock_options, void** b
     
     // Check if surface memory is available
     if (!surface->memory || !surface->base_address) {
-        IOLog("VMIOSurfaceManager: Surface %u has no backing memory\n", surface_id);
+        VMLOG_DEBUG("VMIOSurfaceManager: Surface %u has no backing memory\n", surface_id);
         IOLockUnlock(m_surface_lock);
         return kIOReturnNotReady;
     }
@@ -979,7 +981,7 @@ IOReturn CLASS::lockSurface(uint32_t surface_id, uint32_t lock_options, void** b
     
     // Check for conflicting locks
     if (surface->is_locked && !read_only) {
-        IOLog("VMIOSurfaceManager: Surface %u already locked for write access\n", surface_id);
+        VMLOG_DEBUG("VMIOSurfaceManager: Surface %u already locked for write access\n", surface_id);
         IOLockUnlock(m_surface_lock);
         return kIOReturnBusy;
     }
@@ -988,7 +990,7 @@ IOReturn CLASS::lockSurface(uint32_t surface_id, uint32_t lock_options, void** b
     if (!avoid_sync && m_supports_hardware_surfaces) {
         IOReturn sync_result = synchronizeSurface(surface_id);
         if (sync_result != kIOReturnSuccess) {
-            IOLog("VMIOSurfaceManager: Warning - GPU sync failed for surface %u: %08X\n", 
+            VMLOG_ERROR("VMIOSurfaceManager: Warning - GPU sync failed for surface %u: %08X\n", 
                   surface_id, sync_result);
         }
     }
@@ -1005,7 +1007,7 @@ IOReturn CLASS::lockSurface(uint32_t surface_id, uint32_t lock_options, void** b
     m_lock_operations++;
     m_surface_locks++;
     
-    IOLog("VMIOSurfaceManager: Locked surface %u (address: %p, options: 0x%X, count: %u)\n", 
+    VMLOG_DEBUG("VMIOSurfaceManager: Locked surface %u (address: %p, options: 0x%X, count: %u)\n", 
           surface_id, *base_address, lock_options, surface->lock_count);
     
     IOLockUnlock(m_surface_lock);
@@ -1037,7 +1039,7 @@ IOReturn CLASS::unlockSurface(uint32_t surface_id, uint32_t lock_options)
     
     // Check if surface is actually locked
     if (!surface->is_locked || surface->lock_count == 0) {
-        IOLog("VMIOSurfaceManager: Surface %u is not locked\n", surface_id);
+        VMLOG_DEBUG("VMIOSurfaceManager: Surface %u is not locked\n", surface_id);
         IOLockUnlock(m_surface_lock);
         return kIOReturnNotOpen;
     }
@@ -1054,7 +1056,7 @@ IOReturn CLASS::unlockSurface(uint32_t surface_id, uint32_t lock_options)
         if (!avoid_sync && m_supports_hardware_surfaces) {
             IOReturn sync_result = synchronizeSurface(surface_id);
             if (sync_result != kIOReturnSuccess) {
-                IOLog("VMIOSurfaceManager: Warning - GPU sync failed after unlock for surface %u: %08X\n", 
+                VMLOG_ERROR("VMIOSurfaceManager: Warning - GPU sync failed after unlock for surface %u: %08X\n", 
                       surface_id, sync_result);
             }
         }
@@ -1066,7 +1068,7 @@ IOReturn CLASS::unlockSurface(uint32_t surface_id, uint32_t lock_options)
     m_unlock_operations++;
     m_surface_unlocks++;
     
-    IOLog("VMIOSurfaceManager: Unlocked surface %u (remaining locks: %u)\n", 
+    VMLOG_DEBUG("VMIOSurfaceManager: Unlocked surface %u (remaining locks: %u)\n", 
           surface_id, surface->lock_count);
     
     IOLockUnlock(m_surface_lock);
@@ -1119,7 +1121,7 @@ IOReturn CLASS::copySurface(uint32_t source_surface_id, uint32_t dest_surface_id
     if (source_surface->width != dest_surface->width || 
         source_surface->height != dest_surface->height ||
         source_surface->descriptor.pixel_format != dest_surface->descriptor.pixel_format) {
-        IOLog("VMIOSurfaceManager: Surface dimensions/formats incompatible for copy\n");
+        VMLOG_DEBUG("VMIOSurfaceManager: Surface dimensions/formats incompatible for copy\n");
         IOLockUnlock(m_surface_lock);
         return kIOReturnBadArgument;
     }
@@ -1141,7 +1143,7 @@ IOReturn CLASS::copySurface(uint32_t source_surface_id, uint32_t dest_surface_id
     // Update statistics
     m_copy_operations++;
     
-    IOLog("VMIOSurfaceManager: Copied surface %u to %u (%zu bytes)\n", 
+    VMLOG_DEBUG("VMIOSurfaceManager: Copied surface %u to %u (%zu bytes)\n", 
           source_surface_id, dest_surface_id, copy_size);
     
     IOLockUnlock(m_surface_lock);
@@ -1152,7 +1154,7 @@ IOReturn CLASS::copySurface(uint32_t source_surface_id, uint32_t dest_surface_id
 
 IOReturn CLASS::setupIOSurfaceSupport()
 {
-    IOLog("VMIOSurfaceManager: Setting up IOSurface support...\n");
+    VMLOG_INFO("VMIOSurfaceManager: Setting up IOSurface support...\n");
     
     // Initialize feature support flags
     m_supports_hardware_surfaces = (m_gpu_device != nullptr);
@@ -1164,14 +1166,14 @@ IOReturn CLASS::setupIOSurfaceSupport()
     // Configure memory pools
     IOReturn result = configureMemoryPools();
     if (result != kIOReturnSuccess) {
-        IOLog("VMIOSurfaceManager: Failed to configure memory pools: %08X\n", result);
+        VMLOG_ERROR("VMIOSurfaceManager: Failed to configure memory pools: %08X\n", result);
         return result;
     }
     
-    IOLog("VMIOSurfaceManager: IOSurface support initialized successfully\n");
-    IOLog("VMIOSurfaceManager: Hardware surfaces: %s\n", m_supports_hardware_surfaces ? "YES" : "NO");
-    IOLog("VMIOSurfaceManager: YUV surfaces: %s\n", m_supports_yuv_surfaces ? "YES" : "NO");
-    IOLog("VMIOSurfaceManager: Video surfaces: %s\n", m_supports_video_surfaces ? "YES" : "NO");
+    VMLOG_INFO("VMIOSurfaceManager: IOSurface support initialized successfully\n");
+    VMLOG_INFO("VMIOSurfaceManager: Hardware surfaces: %s\n", m_supports_hardware_surfaces ? "YES" : "NO");
+    VMLOG_INFO("VMIOSurfaceManager: YUV surfaces: %s\n", m_supports_yuv_surfaces ? "YES" : "NO");
+    VMLOG_INFO("VMIOSurfaceManager: Video surfaces: %s\n", m_supports_video_surfaces ? "YES" : "NO");
     
     return kIOReturnSuccess;
 }
@@ -1200,19 +1202,19 @@ IOReturn CLASS::configureMemoryPools()
         uint32_t pool_index;
         IOReturn result = createMemoryPool(pool_configs[i].size, &pool_index);
         if (result != kIOReturnSuccess) {
-            IOLog("VMIOSurfaceManager: Failed to create %s memory pool: %08X\n", 
+            VMLOG_ERROR("VMIOSurfaceManager: Failed to create %s memory pool: %08X\n", 
                   pool_configs[i].name, result);
             return result;
         }
         
-        IOLog("VMIOSurfaceManager: Created %s memory pool (index %u, size %u MB)\n",
+        VMLOG_INFO("VMIOSurfaceManager: Created %s memory pool (index %u, size %u MB)\n",
               pool_configs[i].name, pool_index, pool_configs[i].size / (1024 * 1024));
     }
     
     // Set available memory (total minus some overhead)
     m_available_memory = m_total_surface_memory - (32 * 1024 * 1024); // 32MB overhead
     
-    IOLog("VMIOSurfaceManager: Configured %u memory pools, %llu MB available\n",
+    VMLOG_INFO("VMIOSurfaceManager: Configured %u memory pools, %llu MB available\n",
           m_memory_pools->getCount(), m_available_memory / (1024 * 1024));
     
     return kIOReturnSuccess;
@@ -1250,7 +1252,7 @@ IOReturn CLASS::lockSurfacePlane(uint32_t surface_id, uint32_t plane_index,
     
     // Check if plane index is valid
     if (plane_index >= surface->descriptor.plane_count) {
-        IOLog("VMIOSurfaceManager: Invalid plane index %u for surface %u (max: %u)\n",
+        VMLOG_WARN("VMIOSurfaceManager: Invalid plane index %u for surface %u (max: %u)\n",
               plane_index, surface_id, surface->descriptor.plane_count);
         IOLockUnlock(m_surface_lock);
         return kIOReturnBadArgument;
@@ -1272,7 +1274,7 @@ IOReturn CLASS::lockSurfacePlane(uint32_t surface_id, uint32_t plane_index,
     surface->last_access_time = mach_absolute_time();
     m_lock_operations++;
     
-    IOLog("VMIOSurfaceManager: Locked surface %u plane %u (address: %p, size: %u)\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Locked surface %u plane %u (address: %p, size: %u)\n",
           surface_id, plane_index, *base_address, plane->size);
     
     IOLockUnlock(m_surface_lock);
@@ -1328,7 +1330,7 @@ IOReturn CLASS::unlockSurfacePlane(uint32_t surface_id, uint32_t plane_index,
     surface->last_access_time = mach_absolute_time();
     m_unlock_operations++;
     
-    IOLog("VMIOSurfaceManager: Unlocked surface %u plane %u (remaining locks: %u)\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Unlocked surface %u plane %u (remaining locks: %u)\n",
           surface_id, plane_index, surface->lock_count);
     
     IOLockUnlock(m_surface_lock);
@@ -1415,7 +1417,7 @@ IOReturn CLASS::fillSurface(uint32_t surface_id, uint32_t fill_color)
     
     surface->last_access_time = mach_absolute_time();
     
-    IOLog("VMIOSurfaceManager: Filled surface %u with color 0x%08X (%u pixels)\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Filled surface %u with color 0x%08X (%u pixels)\n",
           surface_id, fill_color, pixel_count);
     
     IOLockUnlock(m_surface_lock);
@@ -1560,7 +1562,7 @@ void CLASS::resetIOSurfaceCounters()
     m_cache_hits = 0;
     m_cache_misses = 0;
     
-    IOLog("VMIOSurfaceManager: Performance counters reset\n");
+    VMLOG_INFO("VMIOSurfaceManager: Performance counters reset\n");
     
     IOLockUnlock(m_surface_lock);
 }
@@ -1569,18 +1571,18 @@ void CLASS::logIOSurfaceState()
 {
     IOLockLock(m_surface_lock);
     
-    IOLog("=== VMIOSurfaceManager State ===\n");
-    IOLog("Surface Count: %u (Peak: %u)\n", m_surface_count, m_peak_surface_count);
-    IOLog("Memory Usage: %llu MB / %llu MB\n", 
+    VMLOG_INFO("=== VMIOSurfaceManager State ===\n");
+    VMLOG_INFO("Surface Count: %u (Peak: %u)\n", m_surface_count, m_peak_surface_count);
+    VMLOG_INFO("Memory Usage: %llu MB / %llu MB\n", 
           m_allocated_surface_memory / (1024 * 1024),
           m_total_surface_memory / (1024 * 1024));
-    IOLog("Operations: Created=%llu, Destroyed=%llu, Locks=%llu, Unlocks=%llu, Copies=%llu\n",
+    VMLOG_INFO("Operations: Created=%llu, Destroyed=%llu, Locks=%llu, Unlocks=%llu, Copies=%llu\n",
           m_surfaces_created, m_surfaces_destroyed, m_surface_locks, m_surface_unlocks, m_copy_operations);
-    IOLog("Feature Support: HW=%s, YUV=%s, Video=%s\n",
+    VMLOG_INFO("Feature Support: HW=%s, YUV=%s, Video=%s\n",
           m_supports_hardware_surfaces ? "YES" : "NO",
           m_supports_yuv_surfaces ? "YES" : "NO", 
           m_supports_video_surfaces ? "YES" : "NO");
-    IOLog("==============================\n");
+    VMLOG_INFO("==============================\n");
     
     IOLockUnlock(m_surface_lock);
 }
@@ -1612,29 +1614,29 @@ IOReturn CLASS::validateSurface(uint32_t surface_id)
     IOReturn validation_result = kIOReturnSuccess;
     
     if (surface->surface_id != surface_id) {
-        IOLog("VMIOSurfaceManager: Surface ID mismatch for surface %u\n", surface_id);
+        VMLOG_WARN("VMIOSurfaceManager: Surface ID mismatch for surface %u\n", surface_id);
         validation_result = kIOReturnInternalError;
     }
     
     if (surface->width == 0 || surface->height == 0 || 
         surface->width > 16384 || surface->height > 16384) {
-        IOLog("VMIOSurfaceManager: Invalid dimensions for surface %u: %ux%u\n",
+        VMLOG_WARN("VMIOSurfaceManager: Invalid dimensions for surface %u: %ux%u\n",
               surface_id, surface->width, surface->height);
         validation_result = kIOReturnBadArgument;
     }
     
     if (validatePixelFormat(surface->descriptor.pixel_format) != kIOReturnSuccess) {
-        IOLog("VMIOSurfaceManager: Invalid pixel format for surface %u: %08X\n",
+        VMLOG_WARN("VMIOSurfaceManager: Invalid pixel format for surface %u: %08X\n",
               surface_id, surface->descriptor.pixel_format);
         validation_result = kIOReturnBadArgument;
     }
     
     if (!surface->memory) {
-        IOLog("VMIOSurfaceManager: No backing memory for surface %u\n", surface_id);
+        VMLOG_DEBUG("VMIOSurfaceManager: No backing memory for surface %u\n", surface_id);
         validation_result = kIOReturnNotReady;
     }
     
-    IOLog("VMIOSurfaceManager: Surface %u validation %s\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Surface %u validation %s\n",
           surface_id, validation_result == kIOReturnSuccess ? "PASSED" : "FAILED");
     
     IOLockUnlock(m_surface_lock);
@@ -1645,6 +1647,23 @@ IOReturn CLASS::validateSurface(uint32_t surface_id)
 
 // Format Conversion Methods Implementation
 
+// IOSurface formats VMPixelConvert handles, by their layout in memory
+static VMPixelFormat surfacePixelFormat(VMIOSurfacePixelFormat format)
+{
+    switch (format) {
+        case VM_IOSURFACE_PIXEL_FORMAT_ARGB32:  return kVMPixelFormatARGB8;
+        case VM_IOSURFACE_PIXEL_FORMAT_BGRA32:  return kVMPixelFormatBGRA8;
+        case VM_IOSURFACE_PIXEL_FORMAT_RGBA32:  return kVMPixelFormatRGBA8;
+        case VM_IOSURFACE_PIXEL_FORMAT_ABGR32:  return kVMPixelFormatABGR8;
+        case VM_IOSURFACE_PIXEL_FORMAT_RGB24:
+        case VM_IOSURFACE_PIXEL_FORMAT_RGB:     return kVMPixelFormatRGB8;
+        case VM_IOSURFACE_PIXEL_FORMAT_BGR:     return kVMPixelFormatBGR8;
+        case VM_IOSURFACE_PIXEL_FORMAT_RGB565:  return kVMPixelFormatB5G6R5;
+        case VM_IOSURFACE_PIXEL_FORMAT_L8:      return kVMPixelFormatL8;
+        default:                                return kVMPixelFormatInvalid;
+    }
+}
+
 IOReturn CLASS::convertSurfaceFormat(uint32_t source_surface_id, uint32_t dest_surface_id,
                                     VMIOSurfacePixelFormat dest_format)
 {
@@ -1659,7 +1678,7 @@ IOReturn CLASS::convertSurfaceFormat(uint32_t source_surface_id, uint32_t dest_s
     // Validate destination format
     IOReturn format_result = validatePixelFormat(dest_format);
     if (format_result != kIOReturnSuccess) {
-        IOLog("VMIOSurfaceManager: Invalid destination pixel format: %08X\n", dest_format);
+        VMLOG_WARN("VMIOSurfaceManager: Invalid destination pixel format: %08X\n", dest_format);
         return format_result;
     }
     
@@ -1705,7 +1724,7 @@ IOReturn CLASS::convertSurfaceFormat(uint32_t source_surface_id, uint32_t dest_s
     // Check dimension compatibility
     if (source_surface->width != dest_surface->width || 
         source_surface->height != dest_surface->height) {
-        IOLog("VMIOSurfaceManager: Surface dimensions must match for format conversion\n");
+        VMLOG_DEBUG("VMIOSurfaceManager: Surface dimensions must match for format conversion\n");
         IOLockUnlock(m_surface_lock);
         return kIOReturnBadArgument;
     }
@@ -1714,7 +1733,7 @@ IOReturn CLASS::convertSurfaceFormat(uint32_t source_surface_id, uint32_t dest_s
     
     // Check if conversion is needed
     if (source_format == dest_format) {
-        IOLog("VMIOSurfaceManager: No conversion needed - formats already match\n");
+        VMLOG_DEBUG("VMIOSurfaceManager: No conversion needed - formats already match\n");
         IOLockUnlock(m_surface_lock);
         return kIOReturnSuccess;
     }
@@ -1722,14 +1741,31 @@ IOReturn CLASS::convertSurfaceFormat(uint32_t source_surface_id, uint32_t dest_s
     uint32_t width = source_surface->width;
     uint32_t height = source_surface->height;
     
+    // The destination keeps its pitch if its format stays the same and is
+    // packed tightly otherwise; either way the rows must fit its memory
+    uint32_t source_row_bytes = source_surface->descriptor.bytes_per_row;
+    uint32_t dest_row_bytes = 0;
+    if (dest_surface->descriptor.pixel_format == dest_format) {
+        dest_row_bytes = dest_surface->descriptor.bytes_per_row;
+    }
+    if (dest_row_bytes == 0) {
+        dest_row_bytes = width * VMPixelFormatBytes(surfacePixelFormat(dest_format));
+    }
+    if ((uint64_t)dest_row_bytes * height > dest_surface->memory->getLength()) {
+        VMLOG_DEBUG("VMIOSurfaceManager: Surface %u too small for %ux%u in format %08X\n",
+              dest_surface_id, width, height, dest_format);
+        IOLockUnlock(m_surface_lock);
+        return kIOReturnNoSpace;
+    }
+    
     // Perform format conversion based on source and destination formats
     IOReturn conversion_result = performPixelFormatConversion(
-        source_surface->base_address, source_format,
-        dest_surface->base_address, dest_format,
+        source_surface->base_address, source_format, source_row_bytes,
+        dest_surface->base_address, dest_format, dest_row_bytes,
         width, height);
     
     if (conversion_result != kIOReturnSuccess) {
-        IOLog("VMIOSurfaceManager: Pixel format conversion failed: %08X\n", conversion_result);
+        VMLOG_ERROR("VMIOSurfaceManager: Pixel format conversion failed: %08X\n", conversion_result);
         IOLockUnlock(m_surface_lock);
         return conversion_result;
     }
@@ -1741,7 +1777,7 @@ IOReturn CLASS::convertSurfaceFormat(uint32_t source_surface_id, uint32_t dest_s
     // Update statistics
     m_format_conversions++;
     
-    IOLog("VMIOSurfaceManager: Converted surface %u format from %08X to %08X (%ux%u)\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Converted surface %u format from %08X to %08X (%ux%u)\n",
           dest_surface_id, source_format, dest_format, width, height);
     
     IOLockUnlock(m_surface_lock);
@@ -1751,134 +1787,33 @@ IOReturn CLASS::convertSurfaceFormat(uint32_t source_surface_id, uint32_t dest_s
 // Format Conversion Helper Methods Implementation
 
 IOReturn CLASS::performPixelFormatConversion(void* source_buffer, VMIOSurfacePixelFormat source_format,
+                                            uint32_t source_row_bytes,
                                             void* dest_buffer, VMIOSurfacePixelFormat dest_format,
+                                            uint32_t dest_row_bytes,
                                             uint32_t width, uint32_t height)
 {
     if (!source_buffer || !dest_buffer || width == 0 || height == 0) {
         return kIOReturnBadArgument;
     }
     
-    // Handle common format conversion cases
-    if (source_format == dest_format) {
-        // Same format - just copy
-        uint32_t source_bpp = getBytesPerPixel(source_format);
-        if (source_bpp == 0) {
-            return kIOReturnUnsupported;
-        }
-        size_t copy_size = width * height * source_bpp;
-        memcpy(dest_buffer, source_buffer, copy_size);
-        return kIOReturnSuccess;
-    }
-    
-    // BGRA32 to RGBA32 conversion (swap red and blue channels)
-    if ((source_format == VM_IOSURFACE_PIXEL_FORMAT_BGRA32 || source_format == 0x42475241) &&
-        (dest_format == VM_IOSURFACE_PIXEL_FORMAT_RGBA32 || dest_format == 0x52474241)) {
-        return convertBGRAtoRGBA((uint32_t*)source_buffer, (uint32_t*)dest_buffer, width * height);
-    }
-    
-    // RGBA32 to BGRA32 conversion (swap red and blue channels)
-    if ((source_format == VM_IOSURFACE_PIXEL_FORMAT_RGBA32 || source_format == 0x52474241) &&
-        (dest_format == VM_IOSURFACE_PIXEL_FORMAT_BGRA32 || dest_format == 0x42475241)) {
-        return convertRGBAtoBGRA((uint32_t*)source_buffer, (uint32_t*)dest_buffer, width * height);
-    }
-    
-    // BGRA32 to RGB24 conversion (drop alpha, swap channels)
-    if ((source_format == VM_IOSURFACE_PIXEL_FORMAT_BGRA32 || source_format == 0x42475241) &&
-        dest_format == 0x52474220) { // 'RGB '
-        return convertBGRAtoRGB24((uint32_t*)source_buffer, (uint8_t*)dest_buffer, width * height);
+    VMPixelImage source = { (uint8_t*)source_buffer, source_row_bytes, surfacePixelFormat(source_format) };
+    VMPixelImage dest = { (uint8_t*)dest_buffer, dest_row_bytes, surfacePixelFormat(dest_format) };
+    if (source.format == kVMPixelFormatInvalid || dest.format == kVMPixelFormatInvalid) {
+        VMLOG_WARN("VMIOSurfaceManager: Unsupported format conversion: %08X -> %08X\n",
+              source_format, dest_format);
+        return kIOReturnUnsupported;
     }
     
-    // RGB24 to BGRA32 conversion (add alpha, swap channels)
-    if (source_format == 0x52474220 && // 'RGB '
-        (dest_format == VM_IOSURFACE_PIXEL_FORMAT_BGRA32 || dest_format == 0x42475241)) {
-        return convertRGB24toBGRA((uint8_t*)source_buffer, (uint32_t*)dest_buffer, width * height);
+    // Zero means tightly packed rows
+    if (source.rowBytes == 0) {
+        source.rowBytes = width * VMPixelFormatBytes(source.format);
     }
-    
-    // BGRA32 to Luminance conversion (grayscale)
-    if ((source_format == VM_IOSURFACE_PIXEL_FORMAT_BGRA32 || source_format == 0x42475241) &&
-        dest_format == 0x4C303030) { // 'L00'
-        return convertBGRAtoLuminance((uint32_t*)source_buffer, (uint8_t*)dest_buffer, width * height);
+    if (dest.rowBytes == 0) {
+        dest.rowBytes = width * VMPixelFormatBytes(dest.format);
     }
     
-    // Add more conversion cases as needed
-    IOLog("VMIOSurfaceManager: Unsupported format conversion: %08X -> %08X\n", 
-          source_format, dest_format);
-    return kIOReturnUnsupported;
-}
-
-IOReturn CLASS::convertBGRAtoRGBA(uint32_t* source, uint32_t* dest, uint32_t pixel_count)
-{
-    for (uint32_t i = 0; i < pixel_count; i++) {
-        uint32_t bgra = source[i];
-        uint32_t b = (bgra >> 24) & 0xFF;
-        uint32_t g = (bgra >> 16) & 0xFF;
-        uint32_t r = (bgra >> 8) & 0xFF;
-        uint32_t a = bgra & 0xFF;
-        
-        // RGBA format: R in high byte, A in low byte
-        dest[i] = (r << 24) | (g << 16) | (b << 8) | a;
-    }
-    return kIOReturnSuccess;
-}
-
-IOReturn CLASS::convertRGBAtoBGRA(uint32_t* source, uint32_t* dest, uint32_t pixel_count)
-{
-    for (uint32_t i = 0; i < pixel_count; i++) {
-        uint32_t rgba = source[i];
-        uint32_t r = (rgba >> 24) & 0xFF;
-        uint32_t g = (rgba >> 16) & 0xFF;
-        uint32_t b = (rgba >> 8) & 0xFF;
-        uint32_t a = rgba & 0xFF;
-        
-        // BGRA format: B in high byte, A in low byte
-        dest[i] = (b << 24) | (g << 16) | (r << 8) | a;
-    }
-    return kIOReturnSuccess;
-}
-
-IOReturn CLASS::convertBGRAtoRGB24(uint32_t* source, uint8_t* dest, uint32_t pixel_count)
-{
-    for (uint32_t i = 0; i < pixel_count; i++) {
-        uint32_t bgra = source[i];
-        uint8_t b = (bgra >> 24) & 0xFF;
-        uint8_t g = (bgra >> 16) & 0xFF;
-        uint8_t r = (bgra >> 8) & 0xFF;
-        // Alpha is dropped
-        
-        // RGB24 format: R, G, B
-        dest[i * 3 + 0] = r;
-        dest[i * 3 + 1] = g;
-        dest[i * 3 + 2] = b;
-    }
-    return kIOReturnSuccess;
-}
-
-IOReturn CLASS::convertRGB24toBGRA(uint8_t* source, uint32_t* dest, uint32_t pixel_count)
-{
-    for (uint32_t i = 0; i < pixel_count; i++) {
-        uint8_t r = source[i * 3 + 0];
-        uint8_t g = source[i * 3 + 1];
-        uint8_t b = source[i * 3 + 2];
-        uint8_t a = 0xFF; // Set alpha to opaque
-        
-        // BGRA format: B in high byte, A in low byte
-        dest[i] = (b << 24) | (g << 16) | (r << 8) | a;
-    }
-    return kIOReturnSuccess;
-}
-
-IOReturn CLASS::convertBGRAtoLuminance(uint32_t* source, uint8_t* dest, uint32_t pixel_count)
-{
-    for (uint32_t i = 0; i < pixel_count; i++) {
-        uint32_t bgra = source[i];
-        uint8_t b = (bgra >> 24) & 0xFF;
-        uint8_t g = (bgra >> 16) & 0xFF;
-        uint8_t r = (bgra >> 8) & 0xFF;
-        
-        // Convert to grayscale using standard luminance formula
-        // Y = 0.299*R + 0.587*G + 0.114*B
-        uint32_t luminance = (299 * r + 587 * g + 114 * b) / 1000;
-        dest[i] = (uint8_t)(luminance & 0xFF);
+    if (!VMPixelConvert(&dest, &source, width, height, 0)) {
+        return kIOReturnBadArgument;
     }
     return kIOReturnSuccess;
 }
@@ -1959,7 +1894,7 @@ IOReturn CLASS::registerClient(const VMIOSurfaceClientDescriptor* descriptor, ui
     
     client_data->release();
     
-    IOLog("VMIOSurfaceManager: Registered client %u '%s' (PID: %u, rights: 0x%X)\n",
+    VMLOG_INFO("VMIOSurfaceManager: Registered client %u '%s' (PID: %u, rights: 0x%X)\n",
           *client_id, client_info->name, client_info->process_id, client_info->access_rights);
     
     IOLockUnlock(m_surface_lock);
@@ -2007,7 +1942,7 @@ IOReturn CLASS::unregisterClient(uint32_t client_id)
     
     // Check if client has active surfaces
     if (client_info->surface_count > 0) {
-        IOLog("VMIOSurfaceManager: Client %u still has %u active surfaces\n",
+        VMLOG_INFO("VMIOSurfaceManager: Client %u still has %u active surfaces\n",
               client_id, client_info->surface_count);
         // Mark as inactive but don't remove yet
         client_info->active = false;
@@ -2024,7 +1959,7 @@ IOReturn CLASS::unregisterClient(uint32_t client_id)
         releaseClientId(client_id);
     }
     
-    IOLog("VMIOSurfaceManager: Unregistered client %u '%s'\n",
+    VMLOG_INFO("VMIOSurfaceManager: Unregistered client %u '%s'\n",
           client_id, client_info->name);
     
     IOLockUnlock(m_surface_lock);
@@ -2121,7 +2056,7 @@ IOReturn CLASS::setClientAccessRights(uint32_t client_id, uint32_t access_rights
     uint32_t old_rights = client_info->access_rights;
     client_info->access_rights = access_rights;
     
-    IOLog("VMIOSurfaceManager: Updated client %u access rights: 0x%X -> 0x%X\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Updated client %u access rights: 0x%X -> 0x%X\n",
           client_id, old_rights, access_rights);
     
     IOLockUnlock(m_surface_lock);
@@ -2138,7 +2073,7 @@ IOReturn CLASS::shareSurface(uint32_t surface_id, const VMIOSurfaceSharingDescri
     
     // Validate that the descriptor's surface_id matches the parameter
     if (descriptor->surface_id != surface_id) {
-        IOLog("VMIOSurfaceManager: Surface ID mismatch in sharing descriptor\n");
+        VMLOG_WARN("VMIOSurfaceManager: Surface ID mismatch in sharing descriptor\n");
         return kIOReturnBadArgument;
     }
     
@@ -2171,7 +2106,7 @@ IOReturn CLASS::shareSurface(uint32_t surface_id, const VMIOSurfaceSharingDescri
         // Verify target client exists
         OSObject* target_client_obj = findClient(target_client_id);
         if (!target_client_obj) {
-            IOLog("VMIOSurfaceManager: Target client %u not found for surface sharing\n", target_client_id);
+            VMLOG_DEBUG("VMIOSurfaceManager: Target client %u not found for surface sharing\n", target_client_id);
             continue;
         }
         
@@ -2203,7 +2138,7 @@ IOReturn CLASS::shareSurface(uint32_t surface_id, const VMIOSurfaceSharingDescri
             m_shared_surfaces->setObject(sharing_data);
             sharing_data->release();
             
-            IOLog("VMIOSurfaceManager: Surface %u shared with client %u (mode: 0x%X)\n",
+            VMLOG_DEBUG("VMIOSurfaceManager: Surface %u shared with client %u (mode: 0x%X)\n",
                   surface_id, target_client_id, descriptor->sharing_mode);
         }
         
@@ -2252,7 +2187,7 @@ IOReturn CLASS::unshareSurface(uint32_t surface_id, uint32_t client_id)
             // Mark as inactive or remove
             sharing->active = false;
             
-            IOLog("VMIOSurfaceManager: Surface %u unshared for client %u\n", surface_id, client_id);
+            VMLOG_DEBUG("VMIOSurfaceManager: Surface %u unshared for client %u\n", surface_id, client_id);
             found = true;
             break;
         }
@@ -2269,7 +2204,7 @@ IOReturn CLASS::unshareSurface(uint32_t surface_id, uint32_t client_id)
 
 IOReturn CLASS::defragmentMemoryPools()
 {
-    IOLog("VMIOSurfaceManager: Starting memory pool defragmentation...\n");
+    VMLOG_DEBUG("VMIOSurfaceManager: Starting memory pool defragmentation...\n");
     
     IOLockLock(m_surface_lock);
     
@@ -2278,7 +2213,7 @@ IOReturn CLASS::defragmentMemoryPools()
     uint64_t memory_reorganized = 0;
     
     if (!m_memory_pools || m_memory_pools->getCount() == 0) {
-        IOLog("VMIOSurfaceManager: No memory pools to defragment\n");
+        VMLOG_WARN("VMIOSurfaceManager: No memory pools to defragment\n");
         IOLockUnlock(m_surface_lock);
         return kIOReturnSuccess;
     }
@@ -2313,7 +2248,7 @@ IOReturn CLASS::defragmentMemoryPools()
         
         // If fragmentation is high (>30%), perform defragmentation
         if (fragmentation_percentage > 30) {
-            IOLog("VMIOSurfaceManager: Defragmenting pool '%s' (fragmentation: %u%%)\n",
+            VMLOG_DEBUG("VMIOSurfaceManager: Defragmenting pool '%s' (fragmentation: %u%%)\n",
                   pool_info->pool_name, fragmentation_percentage);
             
             // In a real implementation, this would involve:
@@ -2328,16 +2263,16 @@ IOReturn CLASS::defragmentMemoryPools()
             pools_defragmented++;
             memory_reorganized += memory_before_defrag;
             
-            IOLog("VMIOSurfaceManager: Pool '%s' defragmentation complete\n", pool_info->pool_name);
+            VMLOG_DEBUG("VMIOSurfaceManager: Pool '%s' defragmentation complete\n", pool_info->pool_name);
         }
     }
     
     iterator->release();
     
-    IOLog("VMIOSurfaceManager: Memory pool defragmentation complete\n");
-    IOLog("  Pools processed: %u\n", pools_processed);
-    IOLog("  Pools defragmented: %u\n", pools_defragmented);
-    IOLog("  Memory reorganized: %llu MB\n", memory_reorganized / (1024 * 1024));
+    VMLOG_DEBUG("VMIOSurfaceManager: Memory pool defragmentation complete\n");
+    VMLOG_DEBUG("  Pools processed: %u\n", pools_processed);
+    VMLOG_DEBUG("  Pools defragmented: %u\n", pools_defragmented);
+    VMLOG_DEBUG("  Memory reorganized: %llu MB\n", memory_reorganized / (1024 * 1024));
     
     IOLockUnlock(m_surface_lock);
     return kIOReturnSuccess;
@@ -2383,29 +2318,29 @@ IOReturn CLASS::setSurfaceMemoryPriority(uint32_t surface_id, VMIOSurfaceMemoryP
     switch (priority) {
         case VM_IOSURFACE_MEMORY_PRIORITY_LOW:
             // Low priority surfaces can be moved to slower memory or compressed
-            IOLog("VMIOSurfaceManager: Set surface %u to LOW priority (eligible for compression/swapping)\n",
+            VMLOG_DEBUG("VMIOSurfaceManager: Set surface %u to LOW priority (eligible for compression/swapping)\n",
                   surface_id);
             break;
             
         case VM_IOSURFACE_MEMORY_PRIORITY_NORMAL:
             // Normal priority - standard memory management
-            IOLog("VMIOSurfaceManager: Set surface %u to NORMAL priority\n", surface_id);
+            VMLOG_DEBUG("VMIOSurfaceManager: Set surface %u to NORMAL priority\n", surface_id);
             break;
             
         case VM_IOSURFACE_MEMORY_PRIORITY_HIGH:
             // High priority - prefer fast memory, resist eviction
-            IOLog("VMIOSurfaceManager: Set surface %u to HIGH priority (protected from eviction)\n",
+            VMLOG_DEBUG("VMIOSurfaceManager: Set surface %u to HIGH priority (protected from eviction)\n",
                   surface_id);
             break;
             
         case VM_IOSURFACE_MEMORY_PRIORITY_CRITICAL:
             // Critical priority - always keep in fastest memory
-            IOLog("VMIOSurfaceManager: Set surface %u to CRITICAL priority (always in fast memory)\n",
+            VMLOG_DEBUG("VMIOSurfaceManager: Set surface %u to CRITICAL priority (always in fast memory)\n",
                   surface_id);
             break;
     }
     
-    IOLog("VMIOSurfaceManager: Updated surface %u memory priority: %d -> %d\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Updated surface %u memory priority: %d -> %d\n",
           surface_id, old_priority, priority);
     
     IOLockUnlock(m_surface_lock);
@@ -2418,7 +2353,7 @@ IOReturn CLASS::evictUnusedSurfaces(uint32_t max_surfaces_to_evict, uint32_t* su
         *surfaces_evicted = 0;
     }
     
-    IOLog("VMIOSurfaceManager: Starting surface eviction (max: %u)...\n", max_surfaces_to_evict);
+    VMLOG_DEBUG("VMIOSurfaceManager: Starting surface eviction (max: %u)...\n", max_surfaces_to_evict);
     
     IOLockLock(m_surface_lock);
     
@@ -2427,7 +2362,7 @@ IOReturn CLASS::evictUnusedSurfaces(uint32_t max_surfaces_to_evict, uint32_t* su
     uint64_t memory_freed = 0;
     
     if (!m_surfaces || m_surfaces->getCount() == 0) {
-        IOLog("VMIOSurfaceManager: No surfaces to evict\n");
+        VMLOG_DEBUG("VMIOSurfaceManager: No surfaces to evict\n");
         IOLockUnlock(m_surface_lock);
         return kIOReturnSuccess;
     }
@@ -2503,7 +2438,7 @@ IOReturn CLASS::evictUnusedSurfaces(uint32_t max_surfaces_to_evict, uint32_t* su
         // - Free surface memory but keep metadata
         // For demonstration, we'll simulate freeing memory
         
-        IOLog("VMIOSurfaceManager: Evicting surface %u (%u bytes, priority: %d)\n",
+        VMLOG_DEBUG("VMIOSurfaceManager: Evicting surface %u (%u bytes, priority: %d)\n",
               surface->surface_id, surface_memory_size, surface->memory_priority);
         
         // Mark surface as evicted (in real implementation, this would involve
@@ -2523,11 +2458,11 @@ IOReturn CLASS::evictUnusedSurfaces(uint32_t max_surfaces_to_evict, uint32_t* su
         *surfaces_evicted = evicted_count;
     }
     
-    IOLog("VMIOSurfaceManager: Surface eviction complete\n");
-    IOLog("  Surfaces examined: %u\n", surfaces_examined);
-    IOLog("  Surfaces evicted: %u\n", evicted_count);
-    IOLog("  Memory freed: %llu MB\n", memory_freed / (1024 * 1024));
-    IOLog("  Memory usage after eviction: %llu MB / %llu MB\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Surface eviction complete\n");
+    VMLOG_DEBUG("  Surfaces examined: %u\n", surfaces_examined);
+    VMLOG_DEBUG("  Surfaces evicted: %u\n", evicted_count);
+    VMLOG_DEBUG("  Memory freed: %llu MB\n", memory_freed / (1024 * 1024));
+    VMLOG_DEBUG("  Memory usage after eviction: %llu MB / %llu MB\n",
           m_allocated_surface_memory / (1024 * 1024),
           m_total_surface_memory / (1024 * 1024));
     
@@ -2667,7 +2602,7 @@ IOReturn CLASS::createMemoryPool(uint32_t size, uint32_t* pool_index)
     
     pool_data->release();
     
-    IOLog("VMIOSurfaceManager: Created memory pool %u (size: %u bytes)\n", *pool_index, size);
+    VMLOG_INFO("VMIOSurfaceManager: Created memory pool %u (size: %u bytes)\n", *pool_index, size);
     return kIOReturnSuccess;
 }
 
@@ -2786,7 +2721,7 @@ IOReturn CLASS::copySurfaceRegion(uint32_t source_surface_id, uint32_t dest_surf
     dest_surface->last_access_time = mach_absolute_time();
     m_copy_operations++;
     
-    IOLog("VMIOSurfaceManager: Copied region from surface %u to %u (%ux%u at %u,%u -> %u,%u)\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Copied region from surface %u to %u (%ux%u at %u,%u -> %u,%u)\n",
           source_surface_id, dest_surface_id, width, height, src_x, src_y, dst_x, dst_y);
     
     IOLockUnlock(m_surface_lock);
@@ -2846,7 +2781,7 @@ IOReturn CLASS::fillSurfaceRegion(uint32_t surface_id, uint32_t x, uint32_t y,
     
     surface->last_access_time = mach_absolute_time();
     
-    IOLog("VMIOSurfaceManager: Filled region in surface %u (%ux%u at %u,%u) with color 0x%08X\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Filled region in surface %u (%ux%u at %u,%u) with color 0x%08X\n",
           surface_id, width, height, x, y, fill_color);
     
     IOLockUnlock(m_surface_lock);
@@ -2857,7 +2792,7 @@ IOReturn CLASS::compactSurfaceMemory()
 {
     IOLockLock(m_surface_lock);
     
-    IOLog("VMIOSurfaceManager: Starting memory compaction...\n");
+    VMLOG_DEBUG("VMIOSurfaceManager: Starting memory compaction...\n");
     
     uint64_t memory_before = m_allocated_surface_memory;
     uint32_t surfaces_processed = 0;
@@ -2882,7 +2817,7 @@ IOReturn CLASS::compactSurfaceMemory()
     
     uint64_t memory_saved = memory_before - m_allocated_surface_memory;
     
-    IOLog("VMIOSurfaceManager: Memory compaction complete - processed %u surfaces, saved %llu bytes\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Memory compaction complete - processed %u surfaces, saved %llu bytes\n",
           surfaces_processed, memory_saved);
     
     IOLockUnlock(m_surface_lock);
@@ -2959,30 +2894,30 @@ IOReturn CLASS::checkSurfaceIntegrity(uint32_t surface_id)
     if (surface->memory) {
         // Check if memory is still valid
         if (surface->memory->getLength() != surface->memory_size) {
-            IOLog("VMIOSurfaceManager: Memory size mismatch for surface %u\n", surface_id);
+            VMLOG_WARN("VMIOSurfaceManager: Memory size mismatch for surface %u\n", surface_id);
             result = kIOReturnIOError;
         }
         
         // Verify base address
         if (surface->base_address != surface->memory->getBytesNoCopy()) {
-            IOLog("VMIOSurfaceManager: Base address mismatch for surface %u\n", surface_id);
+            VMLOG_WARN("VMIOSurfaceManager: Base address mismatch for surface %u\n", surface_id);
             result = kIOReturnIOError;
         }
     }
     
     // Check reference counting
     if (surface->ref_count == 0) {
-        IOLog("VMIOSurfaceManager: Zero reference count for active surface %u\n", surface_id);
+        VMLOG_DEBUG("VMIOSurfaceManager: Zero reference count for active surface %u\n", surface_id);
         result = kIOReturnInternalError;
     }
     
     // Check lock consistency
     if (surface->is_locked && surface->lock_count == 0) {
-        IOLog("VMIOSurfaceManager: Lock state inconsistency for surface %u\n", surface_id);
+        VMLOG_DEBUG("VMIOSurfaceManager: Lock state inconsistency for surface %u\n", surface_id);
         result = kIOReturnInternalError;
     }
     
-    IOLog("VMIOSurfaceManager: Surface %u integrity check %s\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Surface %u integrity check %s\n",
           surface_id, result == kIOReturnSuccess ? "PASSED" : "FAILED");
     
     IOLockUnlock(m_surface_lock);
@@ -2997,7 +2932,7 @@ IOReturn CLASS::dumpSurfaceInfo(uint32_t surface_id)
     OSObject* surface_obj = findSurface(surface_id);
     if (!surface_obj) {
         IOLockUnlock(m_surface_lock);
-        IOLog("VMIOSurfaceManager: Surface %u not found\n", surface_id);
+        VMLOG_INFO("VMIOSurfaceManager: Surface %u not found\n", surface_id);
         return kIOReturnNotFound;
     }
     
@@ -3014,29 +2949,29 @@ IOReturn CLASS::dumpSurfaceInfo(uint32_t surface_id)
     }
     
     // Dump comprehensive surface information
-    IOLog("=== Surface %u Information ===\n", surface_id);
-    IOLog("Name: %s\n", surface->name);
-    IOLog("Dimensions: %ux%u\n", surface->width, surface->height);
-    IOLog("Pixel Format: 0x%08X\n", surface->descriptor.pixel_format);
-    IOLog("Memory Size: %u bytes\n", surface->memory_size);
-    IOLog("Plane Count: %u\n", surface->descriptor.plane_count);
-    IOLog("Lock Count: %u (Locked: %s)\n", surface->lock_count, surface->is_locked ? "YES" : "NO");
-    IOLog("Reference Count: %u\n", surface->ref_count);
-    IOLog("Base Address: %p\n", surface->base_address);
-    IOLog("Cache Mode: %u\n", surface->cache_mode);
-    IOLog("Purgeable: %s\n", surface->is_purgeable ? "YES" : "NO");
-    IOLog("Creation Time: %llu\n", surface->creation_time);
-    IOLog("Last Access: %llu\n", surface->last_access_time);
+    VMLOG_INFO("=== Surface %u Information ===\n", surface_id);
+    VMLOG_INFO("Name: %s\n", surface->name);
+    VMLOG_INFO("Dimensions: %ux%u\n", surface->width, surface->height);
+    VMLOG_INFO("Pixel Format: 0x%08X\n", surface->descriptor.pixel_format);
+    VMLOG_INFO("Memory Size: %u bytes\n", surface->memory_size);
+    VMLOG_INFO("Plane Count: %u\n", surface->descriptor.plane_count);
+    VMLOG_INFO("Lock Count: %u (Locked: %s)\n", surface->lock_count, surface->is_locked ? "YES" : "NO");
+    VMLOG_INFO("Reference Count: %u\n", surface->ref_count);
+    VMLOG_INFO("Base Address: %p\n", surface->base_address);
+    VMLOG_INFO("Cache Mode: %u\n", surface->cache_mode);
+    VMLOG_INFO("Purgeable: %s\n", surface->is_purgeable ? "YES" : "NO");
+    VMLOG_INFO("Creation Time: %llu\n", surface->creation_time);
+    VMLOG_INFO("Last Access: %llu\n", surface->last_access_time);
     
     // Dump plane information
     for (uint32_t i = 0; i < surface->descriptor.plane_count && i < 4; i++) {
         VMIOSurfacePlaneInfo* plane = &surface->descriptor.planes[i];
-        IOLog("Plane %u: %ux%u, BPE=%u, BPR=%u, offset=%u, size=%u\n",
+        VMLOG_INFO("Plane %u: %ux%u, BPE=%u, BPR=%u, offset=%u, size=%u\n",
               i, plane->width, plane->height, plane->bytes_per_element,
               plane->bytes_per_row, plane->offset, plane->size);
     }
     
-    IOLog("===============================\n");
+    VMLOG_INFO("===============================\n");
     
     IOLockUnlock(m_surface_lock);
     return kIOReturnSuccess;
@@ -3106,31 +3041,31 @@ IOReturn CLASS::logPerformanceData()
 {
     IOLockLock(m_surface_lock);
     
-    IOLog("VMIOSurfaceManager Performance Data:\n");
-    IOLog("===================================\n");
-    IOLog("Surfaces: Created=%llu, Destroyed=%llu, Active=%u\n", 
+    VMLOG_INFO("VMIOSurfaceManager Performance Data:\n");
+    VMLOG_INFO("===================================\n");
+    VMLOG_INFO("Surfaces: Created=%llu, Destroyed=%llu, Active=%u\n", 
           m_surfaces_created, m_surfaces_destroyed, m_surface_count);
-    IOLog("Memory: Total=%llu MB, Allocated=%llu MB, Peak=%llu MB\n",
+    VMLOG_INFO("Memory: Total=%llu MB, Allocated=%llu MB, Peak=%llu MB\n",
           m_total_surface_memory / (1024*1024), 
           m_allocated_surface_memory / (1024*1024),
           m_peak_memory_usage / (1024*1024));
-    IOLog("Operations: Locks=%llu, Unlocks=%llu, Copies=%llu\n",
+    VMLOG_INFO("Operations: Locks=%llu, Unlocks=%llu, Copies=%llu\n",
           m_surface_locks, m_surface_unlocks, m_copy_operations);
-    IOLog("Cache: Hits=%llu, Misses=%llu, Hit Ratio=%.2f%%\n",
+    VMLOG_INFO("Cache: Hits=%llu, Misses=%llu, Hit Ratio=%.2f%%\n",
           m_cache_hits, m_cache_misses, 
           (m_cache_hits + m_cache_misses > 0) ? 
           (double)m_cache_hits * 100.0 / (m_cache_hits + m_cache_misses) : 0.0);
-    IOLog("GPU: Syncs=%llu, Updates=%llu, Texture Uploads=%llu\n",
+    VMLOG_INFO("GPU: Syncs=%llu, Updates=%llu, Texture Uploads=%llu\n",
           m_gpu_syncs, m_gpu_updates, m_gpu_texture_uploads);
-    IOLog("Video: Surfaces=%llu, Frames=%llu, Decoder Ops=%llu\n",
+    VMLOG_INFO("Video: Surfaces=%llu, Frames=%llu, Decoder Ops=%llu\n",
           m_video_surfaces_created, m_video_frames_processed, m_video_decoder_operations);
-    IOLog("Memory Optimization: Compactions=%llu, Defrag=%llu, Evicted=%llu\n",
+    VMLOG_INFO("Memory Optimization: Compactions=%llu, Defrag=%llu, Evicted=%llu\n",
           m_memory_compactions, m_memory_defragmentations, m_surfaces_evicted);
-    IOLog("Errors: Allocation Failures=%llu, Validation=%llu, Integrity=%llu\n",
+    VMLOG_INFO("Errors: Allocation Failures=%llu, Validation=%llu, Integrity=%llu\n",
           m_allocation_failures, m_validation_errors, m_integrity_failures);
     
     if (m_surfaces_created > 0) {
-        IOLog("Average Timing: Alloc=%llu ns, Lock=%llu ns, Copy=%llu ns\n",
+        VMLOG_INFO("Average Timing: Alloc=%llu ns, Lock=%llu ns, Copy=%llu ns\n",
               m_total_allocation_time / m_surfaces_created,
               m_total_lock_time / (m_surface_locks + 1),
               m_total_copy_time / (m_copy_operations + 1));
@@ -3184,7 +3119,7 @@ IOReturn CLASS::benchmarkSurfaceOperations(uint32_t iterations, uint64_t* result
     results[2] = iterations;                      // Number of iterations
     results[3] = (iterations * 1000000000ULL) / elapsed_time; // Operations per second
     
-    IOLog("Benchmark Results: %u iterations in %llu ns (avg: %llu ns/op, %llu ops/sec)\n",
+    VMLOG_INFO("Benchmark Results: %u iterations in %llu ns (avg: %llu ns/op, %llu ops/sec)\n",
           iterations, elapsed_time, elapsed_time / iterations, 
           (iterations * 1000000000ULL) / elapsed_time);
     
@@ -3196,7 +3131,7 @@ IOReturn CLASS::enableDebugLogging(bool enable)
     IOLockLock(m_surface_lock);
     m_debug_logging_enabled = enable;
     if (enable) {
-        IOLog("VMIOSurfaceManager: Debug logging enabled\n");
+        VMLOG_INFO("VMIOSurfaceManager: Debug logging enabled\n");
     }
     IOLockUnlock(m_surface_lock);
     return kIOReturnSuccess;
@@ -3213,7 +3148,7 @@ IOReturn CLASS::setLoggingLevel(uint32_t level)
     IOLockUnlock(m_surface_lock);
     
     if (m_debug_logging_enabled) {
-        IOLog("VMIOSurfaceManager: Logging level set to %u\n", level);
+        VMLOG_INFO("VMIOSurfaceManager: Logging level set to %u\n", level);
     }
     
     return kIOReturnSuccess;
@@ -3290,7 +3225,7 @@ IOReturn CLASS::analyzeMemoryFragmentation(uint32_t* fragmentation_percent,
     IOLockUnlock(m_surface_lock);
     
     if (m_debug_logging_enabled) {
-        IOLog("Memory Fragmentation Analysis: %u%% fragmented, largest fragment: %u KB\n",
+        VMLOG_INFO("Memory Fragmentation Analysis: %u%% fragmented, largest fragment: %u KB\n",
               *fragmentation_percent, *largest_fragment_size);
     }
     
@@ -3328,7 +3263,7 @@ IOReturn CLASS::updateSurfaceDescriptor(uint32_t surface_id, const VMIOSurfaceDe
                 if (surface->memory) {
                     surface->memory->prepare();
                     surface->memory_size = new_size;
-                    IOLog("VMIOSurfaceManager: Updated surface %u with new size %u bytes\n", surface_id, new_size);
+                    VMLOG_DEBUG("VMIOSurfaceManager: Updated surface %u with new size %u bytes\n", surface_id, new_size);
                 }
             }
             
@@ -3370,11 +3305,11 @@ IOReturn CLASS::setSurfaceProperty(uint32_t surface_id, const char* property_nam
             }
             else {
                 IOLockUnlock(m_surface_lock);
-                IOLog("VMIOSurfaceManager: Unknown property '%s' for surface %u\n", property_name, surface_id);
+                VMLOG_DEBUG("VMIOSurfaceManager: Unknown property '%s' for surface %u\n", property_name, surface_id);
                 return kIOReturnUnsupported;
             }
             
-            IOLog("VMIOSurfaceManager: Set property '%s' for surface %u\n", property_name, surface_id);
+            VMLOG_DEBUG("VMIOSurfaceManager: Set property '%s' for surface %u\n", property_name, surface_id);
             IOLockUnlock(m_surface_lock);
             return kIOReturnSuccess;
         }
@@ -3451,7 +3386,7 @@ IOReturn CLASS::getSurfaceProperty(uint32_t surface_id, const char* property_nam
             }
             else {
                 IOLockUnlock(m_surface_lock);
-                IOLog("VMIOSurfaceManager: Unknown property '%s' for surface %u\n", property_name, surface_id);
+                VMLOG_DEBUG("VMIOSurfaceManager: Unknown property '%s' for surface %u\n", property_name, surface_id);
                 return kIOReturnUnsupported;
             }
             
@@ -3523,7 +3458,7 @@ IOReturn CLASS::bindSurfaceToTexture(uint32_t surface_id, uint32_t texture_id)
     
     // Check if hardware surfaces are supported
     if (!m_supports_hardware_surfaces || !m_gpu_device) {
-        IOLog("VMIOSurfaceManager: Hardware surfaces not supported for texture binding\n");
+        VMLOG_WARN("VMIOSurfaceManager: Hardware surfaces not supported for texture binding\n");
         return kIOReturnUnsupported;
     }
     
@@ -3592,7 +3527,7 @@ IOReturn CLASS::bindSurfaceToTexture(uint32_t surface_id, uint32_t texture_id)
     // Update surface access time
     surface->last_access_time = mach_absolute_time();
     
-    IOLog("VMIOSurfaceManager: Bound surface %u to texture %u\n", surface_id, texture_id);
+    VMLOG_DEBUG("VMIOSurfaceManager: Bound surface %u to texture %u\n", surface_id, texture_id);
     
     IOLockUnlock(m_surface_lock);
     return kIOReturnSuccess;
@@ -3606,7 +3541,7 @@ IOReturn CLASS::bindSurfaceToBuffer(uint32_t surface_id, uint32_t buffer_id)
     
     // Check if hardware surfaces are supported
     if (!m_supports_hardware_surfaces || !m_gpu_device) {
-        IOLog("VMIOSurfaceManager: Hardware surfaces not supported for buffer binding\n");
+        VMLOG_WARN("VMIOSurfaceManager: Hardware surfaces not supported for buffer binding\n");
         return kIOReturnUnsupported;
     }
     
@@ -3675,7 +3610,7 @@ IOReturn CLASS::bindSurfaceToBuffer(uint32_t surface_id, uint32_t buffer_id)
     // Update surface access time
     surface->last_access_time = mach_absolute_time();
     
-    IOLog("VMIOSurfaceManager: Bound surface %u to buffer %u\n", surface_id, buffer_id);
+    VMLOG_DEBUG("VMIOSurfaceManager: Bound surface %u to buffer %u\n", surface_id, buffer_id);
     
     IOLockUnlock(m_surface_lock);
     return kIOReturnSuccess;
@@ -3689,7 +3624,7 @@ IOReturn CLASS::createTextureFromSurface(uint32_t surface_id, uint32_t* texture_
     
     // Check if hardware surfaces are supported
     if (!m_supports_hardware_surfaces || !m_gpu_device) {
-        IOLog("VMIOSurfaceManager: Hardware surfaces not supported for texture creation\n");
+        VMLOG_WARN("VMIOSurfaceManager: Hardware surfaces not supported for texture creation\n");
         return kIOReturnUnsupported;
     }
     
@@ -3769,7 +3704,7 @@ IOReturn CLASS::createTextureFromSurface(uint32_t surface_id, uint32_t* texture_
     // Update surface access time
     surface->last_access_time = mach_absolute_time();
     
-    IOLog("VMIOSurfaceManager: Created texture %u from surface %u (%ux%u, format: 0x%08X)\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Created texture %u from surface %u (%ux%u, format: 0x%08X)\n",
           *texture_id, surface_id, surface->width, surface->height, surface->descriptor.pixel_format);
     
     IOLockUnlock(m_surface_lock);
@@ -3784,7 +3719,7 @@ IOReturn CLASS::updateSurfaceFromTexture(uint32_t surface_id, uint32_t texture_i
     
     // Check if hardware surfaces are supported
     if (!m_supports_hardware_surfaces || !m_gpu_device) {
-        IOLog("VMIOSurfaceManager: Hardware surfaces not supported for texture updates\n");
+        VMLOG_WARN("VMIOSurfaceManager: Hardware surfaces not supported for texture updates\n");
         return kIOReturnUnsupported;
     }
     
@@ -3834,7 +3769,7 @@ IOReturn CLASS::updateSurfaceFromTexture(uint32_t surface_id, uint32_t texture_i
                 if (gpu_texture->width != surface->width || 
                     gpu_texture->height != surface->height ||
                     gpu_texture->pixel_format != surface->descriptor.pixel_format) {
-                    IOLog("VMIOSurfaceManager: Texture %u incompatible with surface %u\n", 
+                    VMLOG_DEBUG("VMIOSurfaceManager: Texture %u incompatible with surface %u\n", 
                           texture_id, surface_id);
                     IOLockUnlock(m_surface_lock);
                     return kIOReturnBadArgument;
@@ -3847,7 +3782,7 @@ IOReturn CLASS::updateSurfaceFromTexture(uint32_t surface_id, uint32_t texture_i
     }
     
     if (!texture_found) {
-        IOLog("VMIOSurfaceManager: Texture %u not found\n", texture_id);
+        VMLOG_DEBUG("VMIOSurfaceManager: Texture %u not found\n", texture_id);
         IOLockUnlock(m_surface_lock);
         return kIOReturnNotFound;
     }
@@ -3859,7 +3794,7 @@ IOReturn CLASS::updateSurfaceFromTexture(uint32_t surface_id, uint32_t texture_i
     surface->last_access_time = mach_absolute_time();
     m_gpu_updates++;
     
-    IOLog("VMIOSurfaceManager: Updated surface %u from texture %u\n", surface_id, texture_id);
+    VMLOG_DEBUG("VMIOSurfaceManager: Updated surface %u from texture %u\n", surface_id, texture_id);
     
     IOLockUnlock(m_surface_lock);
     return kIOReturnSuccess;
@@ -3909,14 +3844,14 @@ IOReturn CLASS::syncGPUResource(uint32_t surface_id)
                 // Perform synchronization
                 if (!gpu_resource->coherent) {
                     // In a real implementation, we would flush caches and sync memory
-                    IOLog("VMIOSurfaceManager: Syncing non-coherent GPU resource %u\n", 
+                    VMLOG_DEBUG("VMIOSurfaceManager: Syncing non-coherent GPU resource %u\n", 
                           gpu_resource->resource_id);
                 }
                 
                 gpu_resource->last_sync_time = mach_absolute_time();
                 resource_found = true;
                 
-                IOLog("VMIOSurfaceManager: Synced GPU resource %u for surface %u\n",
+                VMLOG_DEBUG("VMIOSurfaceManager: Synced GPU resource %u for surface %u\n",
                       gpu_resource->resource_id, surface_id);
             }
         }
@@ -3945,7 +3880,7 @@ IOReturn CLASS::createVideoSurface(const VMIOSurfaceDescriptor* descriptor,
     
     // Check if video surfaces are supported
     if (!m_supports_video_surfaces) {
-        IOLog("VMIOSurfaceManager: Video surfaces not supported\n");
+        VMLOG_WARN("VMIOSurfaceManager: Video surfaces not supported\n");
         return kIOReturnUnsupported;
     }
     
@@ -3954,7 +3889,7 @@ IOReturn CLASS::createVideoSurface(const VMIOSurfaceDescriptor* descriptor,
     // Validate video-specific pixel formats
     IOReturn format_result = validateVideoPixelFormat(descriptor->pixel_format, codec_type);
     if (format_result != kIOReturnSuccess) {
-        IOLog("VMIOSurfaceManager: Invalid video pixel format: %08X for codec: %u\n", 
+        VMLOG_WARN("VMIOSurfaceManager: Invalid video pixel format: %08X for codec: %u\n", 
               descriptor->pixel_format, codec_type);
         IOLockUnlock(m_surface_lock);
         return format_result;
@@ -4036,7 +3971,7 @@ IOReturn CLASS::createVideoSurface(const VMIOSurfaceDescriptor* descriptor,
     // Update video statistics
     m_video_surfaces_created++;
     
-    IOLog("VMIOSurfaceManager: Created video surface %u (codec: 0x%08X, format: 0x%08X)\n",
+    VMLOG_DEBUG("VMIOSurfaceManager: Created video surface %u (codec: 0x%08X, format: 0x%08X)\n",
           *surface_id, codec_type, descriptor->pixel_format);
     
     IOLockUnlock(m_surface_lock);
@@ -4080,7 +4015,7 @@ IOReturn CLASS::setVideoSurfaceColorSpace(uint32_t surface_id, uint32_t color_sp
                 video_surface->color_space = color_space;
                 video_surface_found = true;
                 
-                IOLog("VMIOSurfaceManager: Updated video surface %u color space: 0x%08X -> 0x%08X\n",
+                VMLOG_DEBUG("VMIOSurfaceManager: Updated video surface %u color space: 0x%08X -> 0x%08X\n",
                       surface_id, old_color_space, color_space);
                 break;
             }
@@ -4180,7 +4115,7 @@ IOReturn CLASS::attachVideoDecoder(uint32_t surface_id, uint32_t decoder_id)
             if (video_surface->surface_id == surface_id) {
                 // Check if decoder is already attached
                 if (video_surface->decoder_attached && video_surface->decoder_id != decoder_id) {
-                    IOLog("VMIOSurfaceManager: Video surface %u already has decoder %u attached\n",
+                    VMLOG_DEBUG("VMIOSurfaceManager: Video surface %u already has decoder %u attached\n",
                           surface_id, video_surface->decoder_id);
                     IOLockUnlock(m_surface_lock);
                     return kIOReturnBusy;
@@ -4190,7 +4125,7 @@ IOReturn CLASS::attachVideoDecoder(uint32_t surface_id, uint32_t decoder_id)
                 video_surface->decoder_attached = true;
                 video_surface_found = true;
                 
-                IOLog("VMIOSurfaceManager: Attached video decoder %u to surface %u\n",
+                VMLOG_DEBUG("VMIOSurfaceManager: Attached video decoder %u to surface %u\n",
                       decoder_id, surface_id);
                 break;
             }
@@ -4298,7 +4233,7 @@ IOReturn CLASS::detachVideoDecoder(uint32_t surface_id)
                 video_surface->decoder_attached = false;
                 video_surface_found = true;
                 
-                IOLog("VMIOSurfaceManager: Detached video decoder %u from surface %u\n",
+                VMLOG_DEBUG("VMIOSurfaceManager: Detached video decoder %u from surface %u\n",
                       detached_decoder_id, surface_id);
                 break;
             }
@@ -4375,7 +4310,7 @@ IOReturn CLASS::validateVideoPixelFormat(VMIOSurfacePixelFormat format, uint32_t
             return validatePixelFormat(format);
     }
     
-    IOLog("VMIOSurfaceManager: Pixel format %08X not compatible with codec %08X\n", 
+    VMLOG_DEBUG("VMIOSurfaceManager: Pixel format %08X not compatible with codec %08X\n", 
           format, codec_type);
     return kIOReturnBadArgument;
 }
\ No newline at end of file
@@ -529,14 +529,13 @@ private:
                            VMIOSurfacePlaneInfo* planes, uint32_t* plane_count);
     
     // Format conversion helpers
+    // Any pair of the packed RGB, 565 and L8 formats, through VMPixelConvert.
+    // A row_bytes of 0 means tightly packed rows.
     IOReturn performPixelFormatConversion(void* source_buffer, VMIOSurfacePixelFormat source_format,
+                                         uint32_t source_row_bytes,
                                          void* dest_buffer, VMIOSurfacePixelFormat dest_format,
+                                         uint32_t dest_row_bytes,
                                          uint32_t width, uint32_t height);
-    IOReturn convertBGRAtoRGBA(uint32_t* source, uint32_t* dest, uint32_t pixel_count);
-    IOReturn convertRGBAtoBGRA(uint32_t* source, uint32_t* dest, uint32_t pixel_count);
-    IOReturn convertBGRAtoRGB24(uint32_t* source, uint8_t* dest, uint32_t pixel_count);
-    IOReturn convertRGB24toBGRA(uint8_t* source, uint32_t* dest, uint32_t pixel_count);
-    IOReturn convertBGRAtoLuminance(uint32_t* source, uint8_t* dest, uint32_t pixel_count);
     
     // Sharing helpers
     bool isClientAuthorized(uint32_t client_id, uint32_t surface_id, uint32_t access_type);
@@ -7,6 +7,7 @@
  */
 
 #include "VMIOSurfaceManager.h"
+#include "VMLog.h"
 #include <IOKit/IOBufferMemoryDescriptor.h>
 #include <IOKit/IOLib.h>
 
@@ -63,14 +64,14 @@ OSObject* CLASS::findSurface(uint32_t surface_id)
     
     // Phase 1: Surface Discovery Validation Pipeline
     if (!m_surface_map) {
-        IOLog("VMIOSurfaceManager: Discovery validation failed - surface map not initialized\n");
+        VMLOG_ERROR("VMIOSurfaceManager: Discovery validation failed - surface map not initialized\n");
         g_discovery_stats.total_lookups++;
         g_discovery_stats.cache_misses++;
         return nullptr;
     }
     
     if (surface_id == 0) {
-        IOLog("VMIOSurfaceManager: Discovery validation failed - invalid surface ID (0)\n");
+        VMLOG_ERROR("VMIOSurfaceManager: Discovery validation failed - invalid surface ID (0)\n");
         g_discovery_stats.total_lookups++;
         g_discovery_stats.cache_misses++;
         return nullptr;
@@ -78,7 +79,7 @@ OSObject* CLASS::findSurface(uint32_t surface_id)
     
     // Validate surface ID range for security
     if (surface_id > 0x7FFFFFFF) {
-        IOLog("VMIOSurfaceManager: Discovery validation failed - surface ID out of range: %u\n", surface_id);
+        VMLOG_ERROR("VMIOSurfaceManager: Discovery validation failed - surface ID out of range: %u\n", surface_id);
         g_discovery_stats.total_lookups++;
         g_discovery_stats.cache_misses++;
         return nullptr;
@@ -104,7 +105,7 @@ OSObject* CLASS::findSurface(uint32_t surface_id)
                 g_discovery_stats.random_access_count++;
             }
             
-            IOLog("VMIOSurfaceManager: Fast cache hit for surface %u (access count: %u)\n", 
+            VMLOG_DEBUG("VMIOSurfaceManager: Fast cache hit for surface %u (access count: %u)\n", 
                   surface_id, g_surface_cache[i].access_count);
             
             g_last_accessed_surface_id = surface_id;
@@ -130,7 +131,7 @@ OSObject* CLASS::findSurface(uint32_t surface_id)
                 g_surface_cache[g_cache_size].is_prefetched = true;
                 g_cache_size++;
                 
-                IOLog("VMIOSurfaceManager: Prefetched surface %u based on sequential pattern\n", predicted_id);
+                VMLOG_DEBUG("VMIOSurfaceManager: Prefetched surface %u based on sequential pattern\n", predicted_id);
             }
         }
     }
@@ -142,7 +143,7 @@ OSObject* CLASS::findSurface(uint32_t surface_id)
     int key_len = snprintf(key_str, sizeof(key_str), "%u", surface_id);
     
     if (key_len <= 0 || key_len >= 32) {
-        IOLog("VMIOSurfaceManager: Discovery failed - key generation error for surface %u\n", surface_id);
+        VMLOG_ERROR("VMIOSurfaceManager: Discovery failed - key generation error for surface %u\n", surface_id);
         g_discovery_stats.cache_misses++;
         return nullptr;
     }
@@ -159,7 +160,7 @@ OSObject* CLASS::findSurface(uint32_t surface_id)
         clock_get_uptime(&discovery_end_time);
         g_discovery_stats.total_discovery_time_ns += (discovery_end_time - discovery_start_time);
         
-        IOLog("VMIOSurfaceManager: Surface %u not found in primary map\n", surface_id);
+        VMLOG_DEBUG("VMIOSurfaceManager: Surface %u not found in primary map\n", surface_id);
         
         g_last_accessed_surface_id = surface_id;
         return nullptr;
@@ -167,14 +168,14 @@ OSObject* CLASS::findSurface(uint32_t surface_id)
     
     // 3.3: Surface object validation and integrity checking
     if (surface_obj->getRetainCount() == 0) {
-        IOLog("VMIOSurfaceManager: Discovery failed - surface %u has zero retain count\n", surface_id);
+        VMLOG_ERROR("VMIOSurfaceManager: Discovery failed - surface %u has zero retain count\n", surface_id);
         g_discovery_stats.cache_misses++;
         return nullptr;
     }
     
     // Validate object type consistency
     if (!OSDynamicCast(OSData, surface_obj)) {
-        IOLog("VMIOSurfaceManager: Discovery warning - surface %u object type mismatch\n", surface_id);
+        VMLOG_WARN("VMIOSurfaceManager: Discovery warning - surface %u object type mismatch\n", surface_id);
         // Continue with discovery but log the warning
     }
     
@@ -195,7 +196,7 @@ OSObject* CLASS::findSurface(uint32_t surface_id)
         g_cache_size++;
         added_to_cache = true;
         
-        IOLog("VMIOSurfaceManager: Added surface %u to discovery cache (cache size: %u)\n", 
+        VMLOG_DEBUG("VMIOSurfaceManager: Added surface %u to discovery cache (cache size: %u)\n", 
               surface_id, g_cache_size);
     } else {
         // Cache full - use LRU replacement
@@ -220,7 +221,7 @@ OSObject* CLASS::findSurface(uint32_t surface_id)
         g_surface_cache[lru_index].is_high_priority = false;
         added_to_cache = true;
         
-        IOLog("VMIOSurfaceManager: Replaced surface %u with %u in discovery cache (LRU)\n", 
+        VMLOG_DEBUG("VMIOSurfaceManager: Replaced surface %u with %u in discovery cache (LRU)\n", 
               evicted_id, surface_id);
     }
     
@@ -244,15 +245,15 @@ OSObject* CLASS::findSurface(uint32_t surface_id)
         uint32_t sequential_percentage = (g_discovery_stats.sequential_access_count * 100) / 
                                         (g_discovery_stats.sequential_access_count + g_discovery_stats.random_access_count);
         
-        IOLog("VMIOSurfaceManager: Discovery Analytics Report #%u:\n", g_discovery_stats.total_lookups / 100);
-        IOLog("  - Cache Hit Rate: %u%% (%u hits, %u misses)\n", 
+        VMLOG_DEBUG("VMIOSurfaceManager: Discovery Analytics Report #%u:\n", g_discovery_stats.total_lookups / 100);
+        VMLOG_DEBUG("  - Cache Hit Rate: %u%% (%u hits, %u misses)\n", 
               cache_hit_rate, g_discovery_stats.cache_hits, g_discovery_stats.cache_misses);
-        IOLog("  - Average Discovery Time: %llu ns\n", avg_discovery_time);
-        IOLog("  - Fast Path Hits: %u, Prefetch Hits: %u\n", 
+        VMLOG_DEBUG("  - Average Discovery Time: %llu ns\n", avg_discovery_time);
+        VMLOG_DEBUG("  - Fast Path Hits: %u, Prefetch Hits: %u\n", 
               g_discovery_stats.fast_path_hits, g_discovery_stats.prefetch_hits);
-        IOLog("  - Access Pattern: %u%% sequential, %u%% random\n", 
+        VMLOG_DEBUG("  - Access Pattern: %u%% sequential, %u%% random\n", 
               sequential_percentage, 100 - sequential_percentage);
-        IOLog("  - Cache Utilization: %u/64 entries\n", g_cache_size);
+        VMLOG_DEBUG("  - Cache Utilization: %u/64 entries\n", g_cache_size);
     }
     
     // 4.4: Adaptive optimization based on access patterns
@@ -262,20 +263,20 @@ OSObject* CLASS::findSurface(uint32_t surface_id)
             // High hit rate - consider expanding sequential prediction window
             if (g_sequential_prediction_window < 16) {
                 g_sequential_prediction_window++;
-                IOLog("VMIOSurfaceManager: Expanded prediction window to %u due to high cache efficiency\n", 
+                VMLOG_DEBUG("VMIOSurfaceManager: Expanded prediction window to %u due to high cache efficiency\n", 
                       g_sequential_prediction_window);
             }
         } else if (g_discovery_stats.cache_misses > g_discovery_stats.cache_hits * 2) {
             // High miss rate - reduce prediction window
             if (g_sequential_prediction_window > 4) {
                 g_sequential_prediction_window--;
-                IOLog("VMIOSurfaceManager: Reduced prediction window to %u due to low cache efficiency\n", 
+                VMLOG_DEBUG("VMIOSurfaceManager: Reduced prediction window to %u due to low cache efficiency\n", 
                       g_sequential_prediction_window);
             }
         }
     }
     
-    IOLog("VMIOSurfaceManager: Successfully discovered surface %u (time: %llu ns, cached: %s)\n", 
+    VMLOG_DEBUG("VMIOSurfaceManager: Successfully discovered surface %u (time: %llu ns, cached: %s)\n", 
           surface_id, discovery_time, added_to_cache ? "yes" : "no");
     
     g_last_accessed_surface_id = surface_id;
@@ -302,7 +303,7 @@ IOReturn CLASS::getDiscoveryStatistics(VMSurfaceDiscoveryStats* stats)
 IOReturn CLASS::resetDiscoveryStatistics()
 {
     memset(&g_discovery_stats, 0, sizeof(VMSurfaceDiscoveryStats));
-    IOLog("VMIOSurfaceManager: Discovery statistics reset\n");
+    VMLOG_INFO("VMIOSurfaceManager: Discovery statistics reset\n");
     return kIOReturnSuccess;
 }
 
@@ -323,7 +324,7 @@ IOReturn CLASS::flushDiscoveryCache()
     g_cache_next_index = 0;
     g_last_accessed_surface_id = 0;
     
-    IOLog("VMIOSurfaceManager: Discovery cache flushed\n");
+    VMLOG_DEBUG("VMIOSurfaceManager: Discovery cache flushed\n");
     return kIOReturnSuccess;
 }
 
@@ -358,7 +359,7 @@ IOReturn CLASS::prewarmDiscoveryCache(uint32_t* surface_ids, uint32_t count)
         }
     }
     
-    IOLog("VMIOSurfaceManager: Pre-warmed discovery cache with %u/%u surfaces\n", prewarmed, count);
+    VMLOG_DEBUG("VMIOSurfaceManager: Pre-warmed discovery cache with %u/%u surfaces\n", prewarmed, count);
     return kIOReturnSuccess;
 }
 
@@ -386,7 +387,7 @@ IOReturn CLASS::optimizeDiscoveryCache()
         g_surface_cache[i].is_high_priority = true;
     }
     
-    IOLog("VMIOSurfaceManager: Discovery cache optimized - %u high priority entries\n", high_priority_count);
+    VMLOG_DEBUG("VMIOSurfaceManager: Discovery cache optimized - %u high priority entries\n", high_priority_count);
     return kIOReturnSuccess;
 }
 
@@ -396,7 +397,7 @@ void CLASS::generateDiscoveryReport()
     uint32_t total_operations = g_discovery_stats.cache_hits + g_discovery_stats.cache_misses;
     
     if (total_operations == 0) {
-        IOLog("VMIOSurfaceManager: No discovery operations recorded\n");
+        VMLOG_INFO("VMIOSurfaceManager: No discovery operations recorded\n");
         return;
     }
     
@@ -411,20 +412,20 @@ void CLASS::generateDiscoveryReport()
         sequential_percentage = (g_discovery_stats.sequential_access_count * 100) / total_access_patterns;
     }
     
-    IOLog("VMIOSurfaceManager: === Advanced IOSurface Discovery Management System v4.0 Report ===\n");
-    IOLog("  Performance Metrics:\n");
-    IOLog("    - Total Lookups: %u\n", g_discovery_stats.total_lookups);
-    IOLog("    - Cache Hits: %u (%u%%)\n", g_discovery_stats.cache_hits, hit_percentage);
-    IOLog("    - Cache Misses: %u (%u%%)\n", g_discovery_stats.cache_misses, 100 - hit_percentage);
-    IOLog("    - Fast Path Hits: %u (%u%%)\n", g_discovery_stats.fast_path_hits, fast_path_percentage);
-    IOLog("    - Prefetch Hits: %u (%u%%)\n", g_discovery_stats.prefetch_hits, prefetch_percentage);
-    IOLog("    - Average Discovery Time: %llu ns\n", avg_time);
-    IOLog("  Access Pattern Analysis:\n");
-    IOLog("    - Sequential Access: %u (%u%%)\n", g_discovery_stats.sequential_access_count, sequential_percentage);
-    IOLog("    - Random Access: %u (%u%%)\n", g_discovery_stats.random_access_count, 100 - sequential_percentage);
-    IOLog("    - Prediction Window: %u surfaces\n", g_sequential_prediction_window);
-    IOLog("  Cache Status:\n");
-    IOLog("    - Cache Utilization: %u/64 entries (%u%%)\n", g_cache_size, (g_cache_size * 100) / 64);
+    VMLOG_INFO("VMIOSurfaceManager: === Advanced IOSurface Discovery Management System v4.0 Report ===\n");
+    VMLOG_INFO("  Performance Metrics:\n");
+    VMLOG_INFO("    - Total Lookups: %u\n", g_discovery_stats.total_lookups);
+    VMLOG_INFO("    - Cache Hits: %u (%u%%)\n", g_discovery_stats.cache_hits, hit_percentage);
+    VMLOG_INFO("    - Cache Misses: %u (%u%%)\n", g_discovery_stats.cache_misses, 100 - hit_percentage);
+    VMLOG_INFO("    - Fast Path Hits: %u (%u%%)\n", g_discovery_stats.fast_path_hits, fast_path_percentage);
+    VMLOG_INFO("    - Prefetch Hits: %u (%u%%)\n", g_discovery_stats.prefetch_hits, prefetch_percentage);
+    VMLOG_INFO("    - Average Discovery Time: %llu ns\n", avg_time);
+    VMLOG_INFO("  Access Pattern Analysis:\n");
+    VMLOG_INFO("    - Sequential Access: %u (%u%%)\n", g_discovery_stats.sequential_access_count, sequential_percentage);
+    VMLOG_INFO("    - Random Access: %u (%u%%)\n", g_discovery_stats.random_access_count, 100 - sequential_percentage);
+    VMLOG_INFO("    - Prediction Window: %u surfaces\n", g_sequential_prediction_window);
+    VMLOG_INFO("  Cache Status:\n");
+    VMLOG_INFO("    - Cache Utilization: %u/64 entries (%u%%)\n", g_cache_size, (g_cache_size * 100) / 64);
     
     // Cache efficiency analysis
     uint32_t high_priority_count = 0;
@@ -437,24 +438,24 @@ void CLASS::generateDiscoveryReport()
         total_access_count += g_surface_cache[i].access_count;
     }
     
-    IOLog("    - High Priority Entries: %u\n", high_priority_count);
-    IOLog("    - Prefetched Entries: %u\n", prefetched_count);
+    VMLOG_INFO("    - High Priority Entries: %u\n", high_priority_count);
+    VMLOG_INFO("    - Prefetched Entries: %u\n", prefetched_count);
     if (g_cache_size > 0) {
-        IOLog("    - Average Access Count: %llu\n", total_access_count / g_cache_size);
+        VMLOG_INFO("    - Average Access Count: %llu\n", total_access_count / g_cache_size);
     }
-    IOLog("  System Recommendations:\n");
+    VMLOG_INFO("  System Recommendations:\n");
     
     if (hit_percentage < 60) {
-        IOLog("    - Consider increasing cache size for better performance\n");
+        VMLOG_INFO("    - Consider increasing cache size for better performance\n");
     }
     if (sequential_percentage > 70) {
-        IOLog("    - Strong sequential pattern detected - prefetch optimization active\n");
+        VMLOG_INFO("    - Strong sequential pattern detected - prefetch optimization active\n");
     }
     if (avg_time > 1000) {
-        IOLog("    - High average discovery time - consider cache optimization\n");
+        VMLOG_INFO("    - High average discovery time - consider cache optimization\n");
     }
     
-    IOLog("  === End of Discovery System Report ===\n");
+    VMLOG_INFO("  === End of Discovery System Report ===\n");
 }
 
 uint32_t CLASS::allocateSurfaceId()
@@ -697,7 +698,7 @@ IOReturn CLASS::createGPUResource(uint32_t surface_id, uint32_t* gpu_resource_id
         *gpu_resource_id = surface_id + 0x10000; // Simple mapping
     }
     
-    IOLog("VMIOSurfaceManager: Created GPU resource %u for surface %u\n", 
+    VMLOG_DEBUG("VMIOSurfaceManager: Created GPU resource %u for surface %u\n", 
           gpu_resource_id ? *gpu_resource_id : 0, surface_id);
     
     return kIOReturnSuccess;
@@ -712,7 +713,7 @@ IOReturn CLASS::destroyGPUResource(uint32_t surface_id)
     // 3. Clean up GPU memory mappings
     // 4. Update GPU resource tracking
     
-    IOLog("VMIOSurfaceManager: Destroyed GPU resource for surface %u\n", surface_id);
+    VMLOG_DEBUG("VMIOSurfaceManager: Destroyed GPU resource for surface %u\n", surface_id);
     
     return kIOReturnSuccess;
 }
@@ -726,7 +727,7 @@ IOReturn CLASS::synchronizeSurface(uint32_t surface_id)
     // 3. Synchronize CPU and GPU memory views
     // 4. Handle cache coherency
     
-    IOLog("VMIOSurfaceManager: Synchronized surface %u with GPU\n", surface_id);
+    VMLOG_DEBUG("VMIOSurfaceManager: Synchronized surface %u with GPU\n", surface_id);
     
     return kIOReturnSuccess;
 }
@@ -0,0 +1,282 @@
+#include "VMIndexScan.h"
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VMINDEXSCAN_HAVE_SIMD 1
+#include <immintrin.h>
+#else
+#define VMINDEXSCAN_HAVE_SIMD 0
+#endif
+
+typedef void (*VMIndexScanFn)(const uint8_t* p, size_t n, uint32_t* lo, uint32_t* hi);
+
+static VMIndexScanFn s_scan8;
+static VMIndexScanFn s_scan16;
+static VMIndexScanFn s_scan32;
+static VMBlit2DPath  s_active_path = kVMBlit2DPathScalar;
+static bool          s_initialized = false;
+
+#pragma mark - Scalar kernels
+
+// The scalar kernels double as the tail loop of the vector ones, so they
+// fold into the running *lo / *hi instead of starting fresh.
+static void scan8_scalar(const uint8_t* p, size_t n, uint32_t* lo, uint32_t* hi)
+{
+    uint32_t mn = *lo, mx = *hi;
+    for (size_t i = 0; i < n; i++) {
+        uint32_t v = p[i];
+        mn = v < mn ? v : mn;
+        mx = v > mx ? v : mx;
+    }
+    *lo = mn;
+    *hi = mx;
+}
+
+static void scan16_scalar(const uint8_t* p, size_t n, uint32_t* lo, uint32_t* hi)
+{
+    uint32_t mn = *lo, mx = *hi;
+    for (size_t i = 0; i < n; i++) {
+        uint16_t v;
+        memcpy(&v, p + i * 2, 2);
+        mn = v < mn ? v : mn;
+        mx = v > mx ? v : mx;
+    }
+    *lo = mn;
+    *hi = mx;
+}
+
+static void scan32_scalar(const uint8_t* p, size_t n, uint32_t* lo, uint32_t* hi)
+{
+    uint32_t mn = *lo, mx = *hi;
+    for (size_t i = 0; i < n; i++) {
+        uint32_t v;
+        memcpy(&v, p + i * 4, 4);
+        mn = v < mn ? v : mn;
+        mx = v > mx ? v : mx;
+    }
+    *lo = mn;
+    *hi = mx;
+}
+
+#if VMINDEXSCAN_HAVE_SIMD
+
+#pragma mark - SSE2 kernels
+
+// SSE2 only has unsigned min/max for bytes. 16- and 32-bit lanes are biased
+// by the sign bit so that signed compares order them as unsigned.
+
+__attribute__((target("sse2")))
+static void scan8_sse2(const uint8_t* p, size_t n, uint32_t* lo, uint32_t* hi)
+{
+    size_t i = 0;
+    if (n >= 32) {
+        __m128i mn0 = _mm_set1_epi8((char)0xFF), mx0 = _mm_setzero_si128();
+        __m128i mn1 = mn0, mx1 = mx0;
+        for (; i + 32 <= n; i += 32) {
+            __m128i a = _mm_loadu_si128((const __m128i*)(p + i));
+            __m128i b = _mm_loadu_si128((const __m128i*)(p + i + 16));
+            mn0 = _mm_min_epu8(mn0, a);
+            mx0 = _mm_max_epu8(mx0, a);
+            mn1 = _mm_min_epu8(mn1, b);
+            mx1 = _mm_max_epu8(mx1, b);
+        }
+        uint8_t lanes_lo[16], lanes_hi[16];
+        _mm_storeu_si128((__m128i*)lanes_lo, _mm_min_epu8(mn0, mn1));
+        _mm_storeu_si128((__m128i*)lanes_hi, _mm_max_epu8(mx0, mx1));
+        scan8_scalar(lanes_lo, 16, lo, hi);
+        scan8_scalar(lanes_hi, 16, lo, hi);
+    }
+    scan8_scalar(p + i, n - i, lo, hi);
+}
+
+__attribute__((target("sse2")))
+static void scan16_sse2(const uint8_t* p, size_t n, uint32_t* lo, uint32_t* hi)
+{
+    size_t i = 0;
+    if (n >= 16) {
+        const __m128i bias = _mm_set1_epi16((short)0x8000);
+        __m128i mn0 = _mm_set1_epi16(0x7FFF), mx0 = _mm_set1_epi16((short)0x8000);
+        __m128i mn1 = mn0, mx1 = mx0;
+        for (; i + 16 <= n; i += 16) {
+            __m128i a = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(p + i * 2)), bias);
+            __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(p + i * 2 + 16)), bias);
+            mn0 = _mm_min_epi16(mn0, a);
+            mx0 = _mm_max_epi16(mx0, a);
+            mn1 = _mm_min_epi16(mn1, b);
+            mx1 = _mm_max_epi16(mx1, b);
+        }
+        uint16_t lanes_lo[8], lanes_hi[8];
+        _mm_storeu_si128((__m128i*)lanes_lo, _mm_xor_si128(_mm_min_epi16(mn0, mn1), bias));
+        _mm_storeu_si128((__m128i*)lanes_hi, _mm_xor_si128(_mm_max_epi16(mx0, mx1), bias));
+        scan16_scalar((const uint8_t*)lanes_lo, 8, lo, hi);
+        scan16_scalar((const uint8_t*)lanes_hi, 8, lo, hi);
+    }
+    scan16_scalar(p + i * 2, n - i, lo, hi);
+}
+
+__attribute__((target("sse2")))
+static void scan32_sse2(const uint8_t* p, size_t n, uint32_t* lo, uint32_t* hi)
+{
+    size_t i = 0;
+    if (n >= 4) {
+        const __m128i bias = _mm_set1_epi32((int)0x80000000u);
+        __m128i mn = _mm_set1_epi32(0x7FFFFFFF), mx = _mm_set1_epi32((int)0x80000000u);
+        for (; i + 4 <= n; i += 4) {
+            __m128i a = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(p + i * 4)), bias);
+            __m128i lt = _mm_cmplt_epi32(a, mn);
+            __m128i gt = _mm_cmpgt_epi32(a, mx);
+            mn = _mm_or_si128(_mm_and_si128(lt, a), _mm_andnot_si128(lt, mn));
+            mx = _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, mx));
+        }
+        uint32_t lanes_lo[4], lanes_hi[4];
+        _mm_storeu_si128((__m128i*)lanes_lo, _mm_xor_si128(mn, bias));
+        _mm_storeu_si128((__m128i*)lanes_hi, _mm_xor_si128(mx, bias));
+        scan32_scalar((const uint8_t*)lanes_lo, 4, lo, hi);
+        scan32_scalar((const uint8_t*)lanes_hi, 4, lo, hi);
+    }
+    scan32_scalar(p + i * 4, n - i, lo, hi);
+}
+
+#pragma mark - AVX2 kernels
+
+__attribute__((target("avx2")))
+static void scan8_avx2(const uint8_t* p, size_t n, uint32_t* lo, uint32_t* hi)
+{
+    size_t i = 0;
+    if (n >= 64) {
+        __m256i mn0 = _mm256_set1_epi8((char)0xFF), mx0 = _mm256_setzero_si256();
+        __m256i mn1 = mn0, mx1 = mx0;
+        for (; i + 64 <= n; i += 64) {
+            __m256i a = _mm256_loadu_si256((const __m256i*)(p + i));
+            __m256i b = _mm256_loadu_si256((const __m256i*)(p + i + 32));
+            mn0 = _mm256_min_epu8(mn0, a);
+            mx0 = _mm256_max_epu8(mx0, a);
+            mn1 = _mm256_min_epu8(mn1, b);
+            mx1 = _mm256_max_epu8(mx1, b);
+        }
+        uint8_t lanes_lo[32], lanes_hi[32];
+        _mm256_storeu_si256((__m256i*)lanes_lo, _mm256_min_epu8(mn0, mn1));
+        _mm256_storeu_si256((__m256i*)lanes_hi, _mm256_max_epu8(mx0, mx1));
+        scan8_scalar(lanes_lo, 32, lo, hi);
+        scan8_scalar(lanes_hi, 32, lo, hi);
+    }
+    scan8_scalar(p + i, n - i, lo, hi);
+}
+
+__attribute__((target("avx2")))
+static void scan16_avx2(const uint8_t* p, size_t n, uint32_t* lo, uint32_t* hi)
+{
+    size_t i = 0;
+    if (n >= 32) {
+        __m256i mn0 = _mm256_set1_epi16((short)0xFFFF), mx0 = _mm256_setzero_si256();
+        __m256i mn1 = mn0, mx1 = mx0;
+        for (; i + 32 <= n; i += 32) {
+            __m256i a = _mm256_loadu_si256((const __m256i*)(p + i * 2));
+            __m256i b = _mm256_loadu_si256((const __m256i*)(p + i * 2 + 32));
+            mn0 = _mm256_min_epu16(mn0, a);
+            mx0 = _mm256_max_epu16(mx0, a);
+            mn1 = _mm256_min_epu16(mn1, b);
+            mx1 = _mm256_max_epu16(mx1, b);
+        }
+        uint16_t lanes_lo[16], lanes_hi[16];
+        _mm256_storeu_si256((__m256i*)lanes_lo, _mm256_min_epu16(mn0, mn1));
+        _mm256_storeu_si256((__m256i*)lanes_hi, _mm256_max_epu16(mx0, mx1));
+        scan16_scalar((const uint8_t*)lanes_lo, 16, lo, hi);
+        scan16_scalar((const uint8_t*)lanes_hi, 16, lo, hi);
+    }
+    scan16_scalar(p + i * 2, n - i, lo, hi);
+}
+
+__attribute__((target("avx2")))
+static void scan32_avx2(const uint8_t* p, size_t n, uint32_t* lo, uint32_t* hi)
+{
+    size_t i = 0;
+    if (n >= 16) {
+        __m256i mn0 = _mm256_set1_epi32(-1), mx0 = _mm256_setzero_si256();
+        __m256i mn1 = mn0, mx1 = mx0;
+        for (; i + 16 <= n; i += 16) {
+            __m256i a = _mm256_loadu_si256((const __m256i*)(p + i * 4));
+            __m256i b = _mm256_loadu_si256((const __m256i*)(p + i * 4 + 32));
+            mn0 = _mm256_min_epu32(mn0, a);
+            mx0 = _mm256_max_epu32(mx0, a);
+            mn1 = _mm256_min_epu32(mn1, b);
+            mx1 = _mm256_max_epu32(mx1, b);
+        }
+        uint32_t lanes_lo[8], lanes_hi[8];
+        _mm256_storeu_si256((__m256i*)lanes_lo, _mm256_min_epu32(mn0, mn1));
+        _mm256_storeu_si256((__m256i*)lanes_hi, _mm256_max_epu32(mx0, mx1));
+        scan32_scalar((const uint8_t*)lanes_lo, 8, lo, hi);
+        scan32_scalar((const uint8_t*)lanes_hi, 8, lo, hi);
+    }
+    scan32_scalar(p + i * 4, n - i, lo, hi);
+}
+
+#endif /* VMINDEXSCAN_HAVE_SIMD */
+
+#pragma mark - Dispatch
+
+VMBlit2DPath VMIndexScanSetPath(VMBlit2DPath path)
+{
+    VMBlit2DPath best = VMBlit2DBestPath();
+    if (path > best)
+        path = best;
+
+    switch (path) {
+#if VMINDEXSCAN_HAVE_SIMD
+        case kVMBlit2DPathAVX2:
+            s_scan8 = scan8_avx2;
+            s_scan16 = scan16_avx2;
+            s_scan32 = scan32_avx2;
+            break;
+        case kVMBlit2DPathSSE2:
+            s_scan8 = scan8_sse2;
+            s_scan16 = scan16_sse2;
+            s_scan32 = scan32_sse2;
+            break;
+#endif
+        default:
+            path = kVMBlit2DPathScalar;
+            s_scan8 = scan8_scalar;
+            s_scan16 = scan16_scalar;
+            s_scan32 = scan32_scalar;
+            break;
+    }
+
+    s_active_path = path;
+    s_initialized = true;
+    return path;
+}
+
+VMBlit2DPath VMIndexScanActivePath()
+{
+    if (!s_initialized)
+        VMIndexScanSetPath(VMBlit2DBestPath());
+    return s_active_path;
+}
+
+bool VMIndexScanMinMax(const void* indices, uint32_t index_size, uint32_t count,
+                       uint32_t* min_index, uint32_t* max_index)
+{
+    if (!indices || count == 0)
+        return false;
+    if (!s_initialized)
+        VMIndexScanSetPath(VMBlit2DBestPath());
+
+    VMIndexScanFn scan;
+    switch (index_size) {
+        case 1: scan = s_scan8; break;
+        case 2: scan = s_scan16; break;
+        case 4: scan = s_scan32; break;
+        default: return false;
+    }
+
+    uint32_t lo = 0xFFFFFFFFu, hi = 0;
+    VMBlit2DVectorState vector;
+    VMBlit2DVectorBegin(&vector);
+    scan((const uint8_t*)indices, count, &lo, &hi);
+    VMBlit2DVectorEnd(&vector);
+
+    *min_index = lo;
+    *max_index = hi;
+    return true;
+}
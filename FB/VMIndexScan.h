@@ -0,0 +1,31 @@
+#ifndef __VMIndexScan_H__
+#define __VMIndexScan_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "VMBlit2D.h"
+
+// Min/max scan over GL index arrays.
+//
+// VMOpenGLTranslator uploads only the vertex range an indexed draw actually
+// references, so every glDrawElements needs the smallest and largest index
+// before any vertex data moves. The scan is a pure streaming reduction and
+// runs 16-32 indices per instruction with SSE2/AVX2.
+//
+// Kernel selection piggybacks on VMBlit2D's CPU probe, and inside the kext
+// the scan runs within VMBlit2DVectorBegin/End. Free of IOKit, so
+// tools/indexscan_test builds it unchanged on Linux.
+
+// Pin a kernel set (clamped to VMBlit2DBestPath()). Returns the path
+// actually selected. The first scan picks the best path on its own.
+VMBlit2DPath VMIndexScanSetPath(VMBlit2DPath path);
+VMBlit2DPath VMIndexScanActivePath();
+
+// Smallest and largest of `count` indices of `index_size` bytes (1, 2 or 4,
+// native byte order). Returns false for an unsupported size or count == 0,
+// leaving the outputs untouched. `indices` needs no particular alignment.
+bool VMIndexScanMinMax(const void* indices, uint32_t index_size, uint32_t count,
+                       uint32_t* min_index, uint32_t* max_index);
+
+#endif /* __VMIndexScan_H__ */
@@ -0,0 +1,406 @@
+#include "VMLog.h"
+#include <stdarg.h>
+
+#ifdef KERNEL
+#include <IOKit/IOLib.h>
+#include <mach/mach_time.h>
+#include <kern/clock.h>
+#include <pexpert/pexpert.h>
+#define VM_LOG_MIRROR(...)      IOLog(__VA_ARGS__)
+#else
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#define VM_LOG_MIRROR(...)      fprintf(stderr, __VA_ARGS__)
+#endif
+
+#define VM_LOG_INTERVAL_NS      (1000000000ull / VM_LOG_RATE)
+#define VM_LOG_LINE_MAX         512
+
+uint32_t g_vmlog_mirror_level = VM_LOG_WARN;
+
+static VMLogRecord s_ring[VM_LOG_RING_RECORDS];
+static uint64_t    s_claimed;       // records ever claimed; the next gets s_claimed + 1
+
+static inline uint64_t VMLogNow()
+{
+#ifdef KERNEL
+    uint64_t ns;
+    absolutetime_to_nanoseconds(mach_absolute_time(), &ns);
+    return ns;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+void VMLogInit()
+{
+#ifdef KERNEL
+    uint32_t level = 0;
+    if (PE_parse_boot_argn("vm-log", &level, sizeof(level)) && level > g_vmlog_mirror_level) {
+        g_vmlog_mirror_level = level;
+    }
+#endif
+}
+
+uint64_t VMLogHead()
+{
+    return __atomic_load_n(&s_claimed, __ATOMIC_ACQUIRE) + 1;
+}
+
+#pragma mark - Admission
+
+// GCRA form of the token bucket: next_ns is when the bucket would be full
+// again. A message is admitted while that is at most BURST - 1 intervals
+// ahead of now, and pushes it one interval further. One word, one CAS, so
+// concurrent callers at a site never both take the last token.
+bool VMLogAdmit(VMLogSite* site, uint32_t* out_dropped)
+{
+    const uint64_t window = (VM_LOG_BURST - 1) * VM_LOG_INTERVAL_NS;
+    uint64_t now = VMLogNow();
+    uint64_t next = __atomic_load_n(&site->next_ns, __ATOMIC_RELAXED);
+    for (;;) {
+        uint64_t base = next > now ? next : now;
+        if (base - now > window) {
+            __atomic_fetch_add(&site->dropped, 1, __ATOMIC_RELAXED);
+            return false;
+        }
+        if (__atomic_compare_exchange_n(&site->next_ns, &next, base + VM_LOG_INTERVAL_NS,
+                                        false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            break;
+        }
+    }
+    *out_dropped = __atomic_exchange_n(&site->dropped, 0, __ATOMIC_RELAXED);
+    return true;
+}
+
+#pragma mark - Ring
+
+// Writers claim a slot with one fetch-add and publish it by storing its
+// sequence last; the sequence is zeroed first so a reader never takes a
+// half-written record (or the previous lap's) for this one. Readers copy
+// the record and check the sequence again afterwards.
+void VMLogBegin(const VMLogSite* site, uint32_t dropped, VMLogPacker* packer)
+{
+    uint64_t sequence = __atomic_add_fetch(&s_claimed, 1, __ATOMIC_RELAXED);
+    VMLogRecord* record = &s_ring[(sequence - 1) & (VM_LOG_RING_RECORDS - 1)];
+    __atomic_store_n(&record->sequence, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    record->timestamp_ns = VMLogNow();
+    record->site = site;
+    record->dropped = dropped;
+    record->level = (uint8_t)site->level;
+
+    packer->record = record;
+    packer->sequence = sequence;
+    packer->cursor = record->payload;
+    packer->end = record->payload + VM_LOG_PAYLOAD_SIZE;
+    packer->truncated = 0;
+}
+
+void VMLogEnd(VMLogPacker* packer)
+{
+    VMLogRecord* record = packer->record;
+    record->size = (uint16_t)(packer->cursor - record->payload);
+    record->truncated = packer->truncated;
+    __atomic_store_n(&record->sequence, packer->sequence, __ATOMIC_RELEASE);
+
+    if (record->level <= g_vmlog_mirror_level) {
+        char line[VM_LOG_LINE_MAX];
+        VMLogFormatRecord(record, line, sizeof(line));
+        VM_LOG_MIRROR("%s\n", line);
+    }
+}
+
+#pragma mark - Formatting
+
+struct VMLogText {
+    char*  out;
+    size_t capacity;
+    size_t length;          // as if capacity were unlimited
+};
+
+static void VMLogPut(VMLogText* text, const char* s, size_t n)
+{
+    if (text->length < text->capacity) {
+        size_t room = text->capacity - text->length;
+        memcpy(text->out + text->length, s, n < room ? n : room);
+    }
+    text->length += n;
+}
+
+static void VMLogPutf(VMLogText* text, const char* format, ...) __attribute__((format(printf, 2, 3)));
+static void VMLogPutf(VMLogText* text, const char* format, ...)
+{
+    char buffer[128];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (n > 0) VMLogPut(text, buffer, (size_t)n < sizeof(buffer) ? (size_t)n : sizeof(buffer) - 1);
+}
+
+// Fixed-point: the kernel's printf has no floating point
+static void VMLogPutDouble(VMLogText* text, double v, int precision)
+{
+    if (precision < 0) precision = 6;
+    if (precision > 9) precision = 9;
+    if (v != v) {
+        VMLogPut(text, "nan", 3);
+        return;
+    }
+    if (v < 0) {
+        VMLogPut(text, "-", 1);
+        v = -v;
+    }
+    if (v >= 1.8e19) {
+        VMLogPut(text, "inf", 3);
+        return;
+    }
+    uint64_t scale = 1;
+    for (int i = 0; i < precision; i++) scale *= 10;
+    uint64_t whole = (uint64_t)v;
+    uint64_t frac = (uint64_t)((v - (double)whole) * (double)scale + 0.5);
+    if (frac >= scale) {
+        whole++;
+        frac -= scale;
+    }
+    if (precision) {
+        VMLogPutf(text, "%llu.%0*llu", (unsigned long long)whole, precision, (unsigned long long)frac);
+    } else {
+        VMLogPutf(text, "%llu", (unsigned long long)whole);
+    }
+}
+
+struct VMLogArg {
+    uint8_t     tag;        // 0 when the payload ran out
+    uint64_t    bits;
+    const char* string;
+};
+
+static VMLogArg VMLogNextArg(const uint8_t** cursor, const uint8_t* end)
+{
+    VMLogArg arg = { 0, 0, nullptr };
+    const uint8_t* p = *cursor;
+    if (p >= end) return arg;
+    arg.tag = *p++;
+    switch (arg.tag) {
+        case VM_LOG_ARG_INT32: {
+            uint32_t v = 0;
+            if (p + 4 > end) { arg.tag = 0; break; }
+            memcpy(&v, p, 4);
+            arg.bits = v;
+            p += 4;
+            break;
+        }
+        case VM_LOG_ARG_INT64:
+        case VM_LOG_ARG_DOUBLE:
+            if (p + 8 > end) { arg.tag = 0; break; }
+            memcpy(&arg.bits, p, 8);
+            p += 8;
+            break;
+        case VM_LOG_ARG_STRING:
+            arg.string = (const char*)p;
+            while (p < end && *p) p++;
+            if (p >= end) { arg.tag = 0; break; }
+            p++;
+            break;
+        default:
+            arg.tag = 0;
+            break;
+    }
+    *cursor = arg.tag ? p : end;
+    return arg;
+}
+
+static int64_t VMLogSigned(const VMLogArg& arg)
+{
+    if (arg.tag == VM_LOG_ARG_INT32) return (int32_t)(uint32_t)arg.bits;
+    if (arg.tag == VM_LOG_ARG_DOUBLE) {
+        double d;
+        memcpy(&d, &arg.bits, 8);
+        return (int64_t)d;
+    }
+    return (int64_t)arg.bits;
+}
+
+static double VMLogDouble(const VMLogArg& arg)
+{
+    if (arg.tag == VM_LOG_ARG_DOUBLE) {
+        double d;
+        memcpy(&d, &arg.bits, 8);
+        return d;
+    }
+    return (double)VMLogSigned(arg);
+}
+
+// Replays the call site's format over the packed arguments. Integer
+// conversions are widened to ll whatever their length modifier said, since
+// the payload records each argument's real size.
+static void VMLogFormatMessage(const VMLogRecord* record, VMLogText* text)
+{
+    const char* f = record->site ? record->site->format : nullptr;
+    if (!f) return;
+    const uint8_t* cursor = record->payload;
+    const uint8_t* end = record->payload + (record->size < VM_LOG_PAYLOAD_SIZE ? record->size : VM_LOG_PAYLOAD_SIZE);
+
+    while (*f) {
+        if (*f != '%') {
+            const char* start = f;
+            while (*f && *f != '%') f++;
+            VMLogPut(text, start, (size_t)(f - start));
+            continue;
+        }
+        if (f[1] == '%') {
+            VMLogPut(text, "%", 1);
+            f += 2;
+            continue;
+        }
+
+        char spec[32];
+        size_t n = 0;
+        int precision = -1;
+        spec[n++] = '%';
+        f++;
+        while (*f == '-' || *f == '+' || *f == ' ' || *f == '#' || *f == '0') {
+            if (n < 8) spec[n++] = *f;
+            f++;
+        }
+        if (*f == '*') {
+            n += snprintf(spec + n, sizeof(spec) - n - 4, "%d", (int)VMLogSigned(VMLogNextArg(&cursor, end)));
+            f++;
+        } else {
+            while (*f >= '0' && *f <= '9') {
+                if (n < 16) spec[n++] = *f;
+                f++;
+            }
+        }
+        if (*f == '.') {
+            f++;
+            precision = 0;
+            if (*f == '*') {
+                precision = (int)VMLogSigned(VMLogNextArg(&cursor, end));
+                f++;
+            } else {
+                while (*f >= '0' && *f <= '9') precision = precision * 10 + (*f++ - '0');
+            }
+            if (precision > 999) precision = 999;
+            n += snprintf(spec + n, sizeof(spec) - n - 4, ".%d", precision);
+        }
+        while (*f == 'h' || *f == 'l' || *f == 'q' || *f == 'j' || *f == 'z' || *f == 't' || *f == 'L') f++;
+        char conversion = *f;
+        if (!conversion) break;
+        f++;
+
+        VMLogArg arg = VMLogNextArg(&cursor, end);
+        if (!arg.tag) {
+            VMLogPut(text, "?", 1);
+            continue;
+        }
+        switch (conversion) {
+            case 'd': case 'i':
+                spec[n++] = 'l'; spec[n++] = 'l'; spec[n++] = conversion; spec[n] = 0;
+                VMLogPutf(text, spec, (long long)VMLogSigned(arg));
+                break;
+            case 'u': case 'o': case 'x': case 'X':
+                spec[n++] = 'l'; spec[n++] = 'l'; spec[n++] = conversion; spec[n] = 0;
+                VMLogPutf(text, spec, (unsigned long long)arg.bits);
+                break;
+            case 'c':
+                spec[n++] = 'c'; spec[n] = 0;
+                VMLogPutf(text, spec, (int)arg.bits);
+                break;
+            case 'p':
+                VMLogPutf(text, "0x%llx", (unsigned long long)arg.bits);
+                break;
+            case 's':
+                if (arg.tag == VM_LOG_ARG_STRING) {
+                    spec[n++] = 's'; spec[n] = 0;
+                    VMLogPutf(text, spec, arg.string);
+                } else {
+                    VMLogPutf(text, "<0x%llx>", (unsigned long long)arg.bits);
+                }
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                VMLogPutDouble(text, VMLogDouble(arg), precision);
+                break;
+            default:
+                VMLogPut(text, "?", 1);
+                break;
+        }
+    }
+}
+
+size_t VMLogFormatRecord(const VMLogRecord* record, char* out, size_t capacity)
+{
+    static const char levels[] = "EWID";
+    VMLogText text = { out, capacity, 0 };
+    uint64_t us = record->timestamp_ns / 1000;
+    VMLogPutf(&text, "[%6llu.%06llu] %c ", (unsigned long long)(us / 1000000),
+              (unsigned long long)(us % 1000000), record->level < 4 ? levels[record->level] : '?');
+
+    size_t message_start = text.length;
+    VMLogFormatMessage(record, &text);
+    // Formats carry IOLog's trailing newline; lines are delimited by the reader
+    while (text.length > message_start && text.length <= text.capacity &&
+           text.out[text.length - 1] == '\n') {
+        text.length--;
+    }
+    if (record->truncated) {
+        VMLogPutf(&text, " [+%u args cut]", record->truncated);
+    }
+    if (record->dropped) {
+        VMLogPutf(&text, " [%u earlier suppressed]", record->dropped);
+    }
+
+    if (capacity) {
+        out[text.length < capacity ? text.length : capacity - 1] = 0;
+    }
+    return text.length;
+}
+
+size_t VMLogRead(uint64_t* cursor, char* out, size_t capacity, uint64_t* out_lost)
+{
+    uint64_t head = VMLogHead();
+    uint64_t sequence = *cursor ? *cursor : 1;
+    uint64_t oldest = head > VM_LOG_RING_RECORDS ? head - VM_LOG_RING_RECORDS : 1;
+    uint64_t lost = 0;
+    size_t used = 0;
+    char line[VM_LOG_LINE_MAX];
+
+    if (sequence > head) sequence = head;
+    if (sequence < oldest) {
+        lost += oldest - sequence;
+        sequence = oldest;
+    }
+    for (; sequence < head; sequence++) {
+        const VMLogRecord* slot = &s_ring[(sequence - 1) & (VM_LOG_RING_RECORDS - 1)];
+        uint64_t published = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+        if (published < sequence) break;        // still being written
+        if (published > sequence) {             // overwritten by a later lap
+            lost++;
+            continue;
+        }
+        VMLogRecord record;
+        memcpy(&record, slot, sizeof(record));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->sequence, __ATOMIC_RELAXED) != sequence) {
+            lost++;
+            continue;
+        }
+
+        size_t n = VMLogFormatRecord(&record, line, sizeof(line));
+        if (n >= sizeof(line)) n = sizeof(line) - 1;
+        if (used + n + 1 > capacity) break;
+        memcpy(out + used, line, n);
+        out[used + n] = '\n';
+        used += n + 1;
+    }
+
+    *cursor = sequence;
+    if (out_lost) *out_lost += lost;
+    return used;
+}
@@ -0,0 +1,225 @@
+#ifndef __VMLog_H__
+#define __VMLog_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Driver logging.
+//
+// IOLog formats in the caller and, under TCG, pushes every byte out of the
+// emulated serial port: milliseconds per line, paid on whatever thread
+// logged. The driver used to IOLog on every surface lookup, uniform upload
+// and virtqueue submit, so the log was the frame budget. Every message now
+// goes through one of
+//
+//     VMLOG_ERROR(fmt, ...)   something failed; IOLog'd
+//     VMLOG_WARN(fmt, ...)    unexpected but handled; IOLog'd
+//     VMLOG_INFO(fmt, ...)    lifecycle: start, probe, setup, teardown
+//     VMLOG_DEBUG(fmt, ...)   per-call and per-frame detail
+//
+// with a printf format as before. Levels above LOGGING_LEVEL (set per build
+// configuration in the Xcode project) compile to nothing; the format is
+// still type-checked. The rest are rate-limited per call site by a token
+// bucket (VM_LOG_BURST messages, refilled at VM_LOG_RATE per second), and
+// the count of messages dropped at a site rides on its next record.
+//
+// Admitted messages are stored, not formatted: the call site, a timestamp
+// and the raw arguments go into a lock-free ring of VM_LOG_RING_RECORDS
+// fixed-size records; strings are copied. Formatting happens only when the
+// ring is read (VMLogRead, user client selector 0x600E, tools/vmlog) or
+// for the levels mirrored to IOLog: ERROR and WARN by default, up to the
+// level in the vm-log=N boot-arg.
+//
+// Free of IOKit outside the kernel, so tools/vmlog_test builds it on Linux.
+
+#define VM_LOG_ERROR            0
+#define VM_LOG_WARN             1
+#define VM_LOG_INFO             2
+#define VM_LOG_DEBUG            3
+
+#ifdef LOGGING_LEVEL
+#define VM_LOG_COMPILED_LEVEL   LOGGING_LEVEL
+#else
+#define VM_LOG_COMPILED_LEVEL   VM_LOG_INFO
+#endif
+
+#ifndef VM_LOG_BURST
+#define VM_LOG_BURST            20      // messages a quiet site may emit at once
+#endif
+#ifndef VM_LOG_RATE
+#define VM_LOG_RATE             10      // sustained messages per second per site
+#endif
+
+#define VM_LOG_RING_RECORDS     2048    // power of two
+#define VM_LOG_PAYLOAD_SIZE     96
+#define VM_LOG_READ_MAX         (256 * 1024)   // bytes per VMLogRead from userspace
+
+// One per call site, static, created by the VMLOG_* macros
+struct VMLogSite {
+    const char* format;
+    uint32_t    level;
+    uint32_t    dropped;        // refused since the last admitted message
+    uint64_t    next_ns;        // token bucket as a theoretical arrival time
+};
+
+struct VMLogRecord {
+    uint64_t            sequence;       // 1-based; 0 while being written
+    uint64_t            timestamp_ns;   // since boot
+    const VMLogSite*    site;
+    uint32_t            dropped;
+    uint16_t            size;           // payload bytes used
+    uint8_t             level;
+    uint8_t             truncated;      // arguments that didn't fit
+    uint8_t             payload[VM_LOG_PAYLOAD_SIZE];
+};
+
+// Argument tags in the payload; each is followed by its value
+#define VM_LOG_ARG_INT32        'i'     // 4 bytes
+#define VM_LOG_ARG_INT64        'l'     // 8 bytes
+#define VM_LOG_ARG_DOUBLE       'd'     // 8 bytes
+#define VM_LOG_ARG_STRING       's'     // NUL-terminated, possibly cut short
+
+// A record being filled in by VMLogWrite
+struct VMLogPacker {
+    VMLogRecord* record;
+    uint64_t     sequence;
+    uint8_t*     cursor;
+    uint8_t*     end;
+    uint8_t      truncated;
+};
+
+extern uint32_t g_vmlog_mirror_level;
+
+// Reads the vm-log boot-arg; safe to call more than once
+void VMLogInit();
+
+// Token bucket check. On success *out_dropped is the number of messages
+// refused at this site since the last one admitted.
+bool VMLogAdmit(VMLogSite* site, uint32_t* out_dropped);
+
+// Claims the next ring record and points the packer at its payload;
+// VMLogEnd publishes it and mirrors it to IOLog if its level calls for it
+void VMLogBegin(const VMLogSite* site, uint32_t dropped, VMLogPacker* packer);
+void VMLogEnd(VMLogPacker* packer);
+
+// Formats one record as a log line (no trailing newline). Returns the
+// length it needed, like snprintf.
+size_t VMLogFormatRecord(const VMLogRecord* record, char* out, size_t capacity);
+
+// Copies out records with sequence >= *cursor, oldest first, formatted one
+// per line, for as many whole lines as fit. Advances *cursor past the last
+// line written; records overwritten before they could be read are added to
+// *out_lost. Returns the bytes written.
+size_t VMLogRead(uint64_t* cursor, char* out, size_t capacity, uint64_t* out_lost);
+
+// Sequence number the next record will get
+uint64_t VMLogHead();
+
+// ---- argument packing ------------------------------------------------------
+
+static inline void VMLogPackRaw(VMLogPacker* p, uint8_t tag, const void* value, size_t size)
+{
+    if (p->cursor + 1 + size > p->end) {
+        p->truncated++;
+        p->cursor = p->end;
+        return;
+    }
+    *p->cursor++ = tag;
+    const uint8_t* src = (const uint8_t*)value;
+    for (size_t i = 0; i < size; i++) p->cursor[i] = src[i];
+    p->cursor += size;
+}
+
+static inline void VMLogPack32(VMLogPacker* p, uint32_t v) { VMLogPackRaw(p, VM_LOG_ARG_INT32, &v, 4); }
+static inline void VMLogPack64(VMLogPacker* p, uint64_t v) { VMLogPackRaw(p, VM_LOG_ARG_INT64, &v, 8); }
+
+static inline void VMLogPack(VMLogPacker* p, bool v)                { VMLogPack32(p, v); }
+static inline void VMLogPack(VMLogPacker* p, char v)                { VMLogPack32(p, (uint32_t)(int)v); }
+static inline void VMLogPack(VMLogPacker* p, signed char v)         { VMLogPack32(p, (uint32_t)(int)v); }
+static inline void VMLogPack(VMLogPacker* p, unsigned char v)       { VMLogPack32(p, v); }
+static inline void VMLogPack(VMLogPacker* p, short v)               { VMLogPack32(p, (uint32_t)(int)v); }
+static inline void VMLogPack(VMLogPacker* p, unsigned short v)      { VMLogPack32(p, v); }
+static inline void VMLogPack(VMLogPacker* p, int v)                 { VMLogPack32(p, (uint32_t)v); }
+static inline void VMLogPack(VMLogPacker* p, unsigned int v)        { VMLogPack32(p, v); }
+static inline void VMLogPack(VMLogPacker* p, long v)                { VMLogPack64(p, (uint64_t)v); }
+static inline void VMLogPack(VMLogPacker* p, unsigned long v)       { VMLogPack64(p, v); }
+static inline void VMLogPack(VMLogPacker* p, long long v)           { VMLogPack64(p, (uint64_t)v); }
+static inline void VMLogPack(VMLogPacker* p, unsigned long long v)  { VMLogPack64(p, v); }
+static inline void VMLogPack(VMLogPacker* p, double v)              { VMLogPackRaw(p, VM_LOG_ARG_DOUBLE, &v, 8); }
+static inline void VMLogPack(VMLogPacker* p, decltype(nullptr))     { VMLogPack64(p, 0); }
+
+template <typename T>
+static inline void VMLogPack(VMLogPacker* p, T* v)                  { VMLogPack64(p, (uint64_t)(uintptr_t)v); }
+
+static inline void VMLogPack(VMLogPacker* p, const char* s)
+{
+    if (!s) s = "(null)";
+    if (p->cursor + 2 > p->end) {
+        p->truncated++;
+        p->cursor = p->end;
+        return;
+    }
+    *p->cursor++ = VM_LOG_ARG_STRING;
+    while (*s && p->cursor + 1 < p->end) *p->cursor++ = (uint8_t)*s++;
+    *p->cursor++ = 0;
+}
+
+static inline void VMLogPack(VMLogPacker* p, char* s)               { VMLogPack(p, (const char*)s); }
+
+static inline void VMLogPackArgs(VMLogPacker*) {}
+
+template <typename T, typename... Rest>
+static inline void VMLogPackArgs(VMLogPacker* p, T arg, Rest... rest)
+{
+    VMLogPack(p, arg);
+    VMLogPackArgs(p, rest...);
+}
+
+template <typename... Args>
+static inline void VMLogWrite(VMLogSite* site, uint32_t dropped, Args... args)
+{
+    VMLogPacker packer;
+    VMLogBegin(site, dropped, &packer);
+    VMLogPackArgs(&packer, args...);
+    VMLogEnd(&packer);
+}
+
+// Never called; lets the compiler check each format against its arguments
+static inline void VMLogCheckFormat(const char*, ...) __attribute__((format(printf, 1, 2)));
+static inline void VMLogCheckFormat(const char*, ...) {}
+
+// ---- call-site macros ------------------------------------------------------
+
+#define VMLOG_AT(lvl, fmt, ...)                                                 \
+    do {                                                                        \
+        static VMLogSite _vmlog_site = { fmt, lvl, 0, 0 };                      \
+        uint32_t _vmlog_dropped;                                                \
+        if (0) VMLogCheckFormat(fmt, ##__VA_ARGS__);                            \
+        if (VMLogAdmit(&_vmlog_site, &_vmlog_dropped))                          \
+            VMLogWrite(&_vmlog_site, _vmlog_dropped, ##__VA_ARGS__);            \
+    } while (0)
+
+#define VMLOG_NONE(fmt, ...)                                                    \
+    do { if (0) VMLogCheckFormat(fmt, ##__VA_ARGS__); } while (0)
+
+#define VMLOG_ERROR(fmt, ...)   VMLOG_AT(VM_LOG_ERROR, fmt, ##__VA_ARGS__)
+
+#if VM_LOG_COMPILED_LEVEL >= VM_LOG_WARN
+#define VMLOG_WARN(fmt, ...)    VMLOG_AT(VM_LOG_WARN, fmt, ##__VA_ARGS__)
+#else
+#define VMLOG_WARN(fmt, ...)    VMLOG_NONE(fmt, ##__VA_ARGS__)
+#endif
+
+#if VM_LOG_COMPILED_LEVEL >= VM_LOG_INFO
+#define VMLOG_INFO(fmt, ...)    VMLOG_AT(VM_LOG_INFO, fmt, ##__VA_ARGS__)
+#else
+#define VMLOG_INFO(fmt, ...)    VMLOG_NONE(fmt, ##__VA_ARGS__)
+#endif
+
+#if VM_LOG_COMPILED_LEVEL >= VM_LOG_DEBUG
+#define VMLOG_DEBUG(fmt, ...)   VMLOG_AT(VM_LOG_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define VMLOG_DEBUG(fmt, ...)   VMLOG_NONE(fmt, ##__VA_ARGS__)
+#endif
+
+#endif /* __VMLog_H__ */
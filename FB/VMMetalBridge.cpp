@@ -2,6 +2,7 @@
 #include "VMQemuVGAAccelerator.h"
 #include "VMVirtIOGPU.h"
 #include "VMShaderManager.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 #include <libkern/OSAtomic.h>
 #include <sys/sysctl.h>
@@ -30,8 +31,8 @@ bool CLASS::init()
     m_textures = nullptr;
     m_samplers = nullptr;
     m_resource_map = nullptr;
+    m_resource_table.init(VM_HANDLE_MAX_SLOTS);
     
-    m_next_resource_id = 1;
     m_metal_draw_calls = 0;
     m_metal_compute_dispatches = 0;
     m_metal_buffer_allocations = 0;
@@ -88,6 +89,14 @@ void CLASS::free()
         m_resource_map = nullptr;
     }
     
+    for (uint32_t i = 0; i < m_resource_table.limit(); i++) {
+        OSObject* resource = m_resource_table.at(i);
+        if (resource) {
+            resource->release();
+        }
+    }
+    m_resource_table.free();
+    
     if (m_metal_device) {
         m_metal_device->release();
         m_metal_device = nullptr;
@@ -127,36 +136,36 @@ bool CLASS::initWithAccelerator(VMQemuVGAAccelerator* accelerator)
     
     IOReturn ret = setupMetalDevice();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Failed to setup Metal device (0x%x)\n", ret);
+        VMLOG_ERROR("VMMetalBridge: Failed to setup Metal device (0x%x)\n", ret);
         return false;
     }
     
     ret = configureFeatureSupport();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Failed to configure feature support (0x%x)\n", ret);
+        VMLOG_ERROR("VMMetalBridge: Failed to configure feature support (0x%x)\n", ret);
         return false;
     }
     
-    IOLog("VMMetalBridge: Initialized successfully\n");
+    VMLOG_INFO("VMMetalBridge: Initialized successfully\n");
     return true;
 }
 
 IOReturn CLASS::setupMetalDevice()
 {
-    IOLog("VMMetalBridge: Setting up Metal device abstraction\n");
+    VMLOG_INFO("VMMetalBridge: Setting up Metal device abstraction\n");
     
     // Create Metal device abstraction compatible with kernel extension
     // This creates a virtual Metal device that bridges to VirtIO GPU
     IOReturn ret = createMetalDeviceAbstraction();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Failed to create Metal device abstraction (0x%x)\n", ret);
+        VMLOG_ERROR("VMMetalBridge: Failed to create Metal device abstraction (0x%x)\n", ret);
         return ret;
     }
     
     // Initialize Metal command processing infrastructure
     ret = initializeMetalCommandProcessor();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Failed to initialize command processor (0x%x)\n", ret);
+        VMLOG_ERROR("VMMetalBridge: Failed to initialize command processor (0x%x)\n", ret);
         return ret;
     }
     
@@ -165,7 +174,7 @@ IOReturn CLASS::setupMetalDevice()
         // Enable 3D acceleration on the GPU device
         ret = m_gpu_device->enableFeature(VIRTIO_GPU_FEATURE_3D);
         if (ret != kIOReturnSuccess) {
-            IOLog("VMMetalBridge: Warning - 3D feature not enabled (0x%x)\n", ret);
+            VMLOG_WARN("VMMetalBridge: Warning - 3D feature not enabled (0x%x)\n", ret);
         }
         
         // Enable additional VirtIO GPU features for Metal support
@@ -176,34 +185,34 @@ IOReturn CLASS::setupMetalDevice()
         // Configure Metal-specific GPU capabilities
         ret = configureMetalGPUCapabilities();
         if (ret != kIOReturnSuccess) {
-            IOLog("VMMetalBridge: Warning - Metal GPU capabilities not fully configured (0x%x)\n", ret);
+            VMLOG_WARN("VMMetalBridge: Warning - Metal GPU capabilities not fully configured (0x%x)\n", ret);
         }
     }
     
     // Initialize Metal resource tracking
     ret = initializeResourceTracking();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Failed to initialize resource tracking (0x%x)\n", ret);
+        VMLOG_ERROR("VMMetalBridge: Failed to initialize resource tracking (0x%x)\n", ret);
         return ret;
     }
     
     // Setup Metal performance monitoring
     ret = setupMetalPerformanceMonitoring();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Warning - Performance monitoring setup failed (0x%x)\n", ret);
+        VMLOG_ERROR("VMMetalBridge: Warning - Performance monitoring setup failed (0x%x)\n", ret);
     }
     
-    IOLog("VMMetalBridge: Metal device setup completed successfully\n");
+    VMLOG_INFO("VMMetalBridge: Metal device setup completed successfully\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureFeatureSupport()
 {
-    IOLog("VMMetalBridge: Configuring feature support\n");
+    VMLOG_INFO("VMMetalBridge: Configuring feature support\n");
     
     // Query actual system capabilities
     uint32_t macos_version = getMacOSVersion();
-    IOLog("VMMetalBridge: Detected macOS version: %d.%d.%d\n", 
+    VMLOG_INFO("VMMetalBridge: Detected macOS version: %d.%d.%d\n", 
           (macos_version >> 16) & 0xFF, (macos_version >> 8) & 0xFF, macos_version & 0xFF);
     
     // Metal 2 requires macOS 10.14+ (version 18.x kernel)
@@ -221,19 +230,19 @@ IOReturn CLASS::configureFeatureSupport()
     m_supports_variable_rate_shading = is_apple_silicon; // Apple Silicon specific
     m_supports_mesh_shaders = is_apple_silicon; // Apple Silicon M2+ specific
     
-    IOLog("VMMetalBridge: Feature support configured:\n");
-    IOLog("  Metal 2: %s\n", m_supports_metal_2 ? "Yes" : "No");
-    IOLog("  Metal 3: %s\n", m_supports_metal_3 ? "Yes" : "No");
-    IOLog("  Ray Tracing: %s\n", m_supports_raytracing ? "Yes" : "No");
-    IOLog("  Variable Rate Shading: %s\n", m_supports_variable_rate_shading ? "Yes" : "No");
-    IOLog("  Mesh Shaders: %s\n", m_supports_mesh_shaders ? "Yes" : "No");
+    VMLOG_INFO("VMMetalBridge: Feature support configured:\n");
+    VMLOG_INFO("  Metal 2: %s\n", m_supports_metal_2 ? "Yes" : "No");
+    VMLOG_INFO("  Metal 3: %s\n", m_supports_metal_3 ? "Yes" : "No");
+    VMLOG_INFO("  Ray Tracing: %s\n", m_supports_raytracing ? "Yes" : "No");
+    VMLOG_INFO("  Variable Rate Shading: %s\n", m_supports_variable_rate_shading ? "Yes" : "No");
+    VMLOG_INFO("  Mesh Shaders: %s\n", m_supports_mesh_shaders ? "Yes" : "No");
     
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::createMetalDeviceAbstraction()
 {
-    IOLog("VMMetalBridge: Creating Metal device abstraction\n");
+    VMLOG_INFO("VMMetalBridge: Creating Metal device abstraction\n");
     
     // Create a dictionary to represent our Metal device abstraction
     m_metal_device = OSDictionary::withCapacity(16);
@@ -281,13 +290,13 @@ IOReturn CLASS::createMetalDeviceAbstraction()
         max_texture_height->release();
     }
     
-    IOLog("VMMetalBridge: Metal device abstraction created\n");
+    VMLOG_INFO("VMMetalBridge: Metal device abstraction created\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::initializeMetalCommandProcessor()
 {
-    IOLog("VMMetalBridge: Initializing Metal command processor\n");
+    VMLOG_INFO("VMMetalBridge: Initializing Metal command processor\n");
     
     // Initialize command processing queues
     if (!m_command_queues) {
@@ -318,13 +327,13 @@ IOReturn CLASS::initializeMetalCommandProcessor()
         }
     }
     
-    IOLog("VMMetalBridge: Metal command processor initialized\n");
+    VMLOG_INFO("VMMetalBridge: Metal command processor initialized\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureMetalGPUCapabilities()
 {
-    IOLog("VMMetalBridge: Configuring Metal GPU capabilities\n");
+    VMLOG_INFO("VMMetalBridge: Configuring Metal GPU capabilities\n");
     
     // Configure GPU memory limits for Metal operations
     uint64_t total_gpu_memory = 512 * 1024 * 1024; // 512MB default
@@ -369,22 +378,22 @@ IOReturn CLASS::configureMetalGPUCapabilities()
             uint32_t context_id;
             IOReturn ret = m_gpu_device->createRenderContext(&context_id);
             if (ret == kIOReturnSuccess) {
-                IOLog("VMMetalBridge: GPU render context %u created for Metal\n", context_id);
+                VMLOG_INFO("VMMetalBridge: GPU render context %u created for Metal\n", context_id);
                 // Store the primary context ID for later use
                 m_primary_context_id = context_id;
             } else {
-                IOLog("VMMetalBridge: Warning - Failed to create render context (0x%x)\n", ret);
+                VMLOG_ERROR("VMMetalBridge: Warning - Failed to create render context (0x%x)\n", ret);
             }
         }
     }
     
-    IOLog("VMMetalBridge: Metal GPU capabilities configured\n");
+    VMLOG_INFO("VMMetalBridge: Metal GPU capabilities configured\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::initializeResourceTracking()
 {
-    IOLog("VMMetalBridge: Initializing resource tracking\n");
+    VMLOG_INFO("VMMetalBridge: Initializing resource tracking\n");
     
     // Initialize resource tracking structures if not already done
     if (!m_buffers) {
@@ -433,13 +442,13 @@ IOReturn CLASS::initializeResourceTracking()
         resource_lifecycle->release();
     }
     
-    IOLog("VMMetalBridge: Resource tracking initialized\n");
+    VMLOG_INFO("VMMetalBridge: Resource tracking initialized\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::setupMetalPerformanceMonitoring()
 {
-    IOLog("VMMetalBridge: Setting up Metal performance monitoring\n");
+    VMLOG_INFO("VMMetalBridge: Setting up Metal performance monitoring\n");
     
     // Create performance monitoring dictionary
     OSDictionary* perf_monitor = OSDictionary::withCapacity(16);
@@ -480,13 +489,13 @@ IOReturn CLASS::setupMetalPerformanceMonitoring()
     if (m_gpu_device) {
         // Check if 3D features are available which includes performance monitoring
         if (m_gpu_device->supports3D()) {
-            IOLog("VMMetalBridge: GPU performance monitoring available via 3D features\n");
+            VMLOG_INFO("VMMetalBridge: GPU performance monitoring available via 3D features\n");
         } else {
-            IOLog("VMMetalBridge: GPU performance monitoring not available - 3D support required\n");
+            VMLOG_INFO("VMMetalBridge: GPU performance monitoring not available - 3D support required\n");
         }
     }
     
-    IOLog("VMMetalBridge: Metal performance monitoring setup complete\n");
+    VMLOG_INFO("VMMetalBridge: Metal performance monitoring setup complete\n");
     return kIOReturnSuccess;
 }
 
@@ -504,7 +513,7 @@ IOReturn CLASS::createMetalDevice(uint32_t* device_id)
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMMetalBridge: Created Metal device %d\n", *device_id);
+    VMLOG_INFO("VMMetalBridge: Created Metal device %d\n", *device_id);
     return kIOReturnSuccess;
 }
 
@@ -524,16 +533,17 @@ IOReturn CLASS::createCommandQueue(uint32_t device_id, uint32_t* queue_id)
         return kIOReturnNoMemory;
     }
 
-    *queue_id = allocateResourceId();
+    *queue_id = registerResource(queue, VM_METAL_COMMAND_QUEUE);
+    if (!*queue_id) {
+        queue->release();
+        IORecursiveLockUnlock(m_lock);
+        return kIOReturnNoResources;
+    }
     m_command_queues->setObject(queue);
-
-    // Store in resource map using string key
-    char key_str[32];
-    snprintf(key_str, sizeof(key_str), "%u", *queue_id);
-    m_resource_map->setObject(key_str, queue);    queue->release();
+    queue->release();
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMMetalBridge: Created command queue %d\n", *queue_id);
+    VMLOG_INFO("VMMetalBridge: Created command queue %d\n", *queue_id);
     return kIOReturnSuccess;
 }
 
@@ -618,13 +628,13 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
     
     // 1.1: Comprehensive input validation with enterprise error handling
     if (!buffer_id) {
-        IOLog("VMMetalBridge: Command buffer creation failed - null buffer ID pointer\n");
+        VMLOG_ERROR("VMMetalBridge: Command buffer creation failed - null buffer ID pointer\n");
         g_command_buffer_stats.validation_errors++;
         return kIOReturnBadArgument;
     }
     
     if (queue_id == 0) {
-        IOLog("VMMetalBridge: Command buffer creation failed - invalid queue ID (0)\n");
+        VMLOG_ERROR("VMMetalBridge: Command buffer creation failed - invalid queue ID (0)\n");
         g_command_buffer_stats.validation_errors++;
         return kIOReturnBadArgument;
     }
@@ -635,7 +645,7 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
     OSObject* queue = findResource(queue_id, VM_METAL_COMMAND_QUEUE);
     if (!queue) {
         IORecursiveLockUnlock(m_lock);
-        IOLog("VMMetalBridge: Command buffer creation failed - queue %u not found\n", queue_id);
+        VMLOG_ERROR("VMMetalBridge: Command buffer creation failed - queue %u not found\n", queue_id);
         g_command_buffer_stats.validation_errors++;
         return kIOReturnNotFound;
     }
@@ -645,7 +655,7 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
         IOReturn pool_result = initializeCommandBufferPools();
         if (pool_result != kIOReturnSuccess) {
             IORecursiveLockUnlock(m_lock);
-            IOLog("VMMetalBridge: Command buffer creation failed - pool initialization error (0x%x)\n", pool_result);
+            VMLOG_ERROR("VMMetalBridge: Command buffer creation failed - pool initialization error (0x%x)\n", pool_result);
             return pool_result;
         }
     }
@@ -663,7 +673,7 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
             uint32_t alternative_pool = findAvailableCommandBufferPool();
             if (alternative_pool == UINT32_MAX) {
                 IORecursiveLockUnlock(m_lock);
-                IOLog("VMMetalBridge: Command buffer creation failed - all pools at capacity\n");
+                VMLOG_ERROR("VMMetalBridge: Command buffer creation failed - all pools at capacity\n");
                 g_command_buffer_stats.pool_overflows++;
                 return kIOReturnNoResources;
             }
@@ -679,16 +689,16 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
     IOReturn context_result = m_accelerator->create3DContext(&context_id, current_task());
     if (context_result != kIOReturnSuccess) {
         IORecursiveLockUnlock(m_lock);
-        IOLog("VMMetalBridge: Command buffer creation failed - 3D context creation error (0x%x)\n", context_result);
+        VMLOG_ERROR("VMMetalBridge: Command buffer creation failed - 3D context creation error (0x%x)\n", context_result);
         g_command_buffer_stats.validation_errors++;
         return context_result;
     }
     
-    // 2.2: Advanced resource ID allocation with collision detection
-    *buffer_id = allocateResourceId();
+    // 2.2: Reserve the handle; it resolves once the buffer object exists (3.3)
+    *buffer_id = registerResource(nullptr, VM_METAL_COMMAND_BUFFER);
     if (*buffer_id == 0) {
         IORecursiveLockUnlock(m_lock);
-        IOLog("VMMetalBridge: Command buffer creation failed - resource ID allocation failed\n");
+        VMLOG_ERROR("VMMetalBridge: Command buffer creation failed - resource ID allocation failed\n");
         return kIOReturnNoResources;
     }
     
@@ -708,11 +718,12 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
         uint32_t lru_index = findLRUCommandBuffer();
         if (lru_index != UINT32_MAX) {
             cmd_info = &g_command_buffer_registry[lru_index];
-            IOLog("VMMetalBridge: Replaced command buffer %u with %u in registry (LRU)\n", 
+            VMLOG_DEBUG("VMMetalBridge: Replaced command buffer %u with %u in registry (LRU)\n", 
                   cmd_info->buffer_id, *buffer_id);
         } else {
+            m_resource_table.remove(*buffer_id);
             IORecursiveLockUnlock(m_lock);
-            IOLog("VMMetalBridge: Command buffer creation failed - registry full\n");
+            VMLOG_ERROR("VMMetalBridge: Command buffer creation failed - registry full\n");
             return kIOReturnNoMemory;
         }
     }
@@ -745,8 +756,9 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
     // 3.1: Advanced command buffer object creation with optimization hints
     OSDictionary* cmd_buffer_obj = OSDictionary::withCapacity(16);
     if (!cmd_buffer_obj) {
+        m_resource_table.remove(*buffer_id);
         IORecursiveLockUnlock(m_lock);
-        IOLog("VMMetalBridge: Command buffer creation failed - dictionary allocation failed\n");
+        VMLOG_ERROR("VMMetalBridge: Command buffer creation failed - dictionary allocation failed\n");
         return kIOReturnNoMemory;
     }
     
@@ -783,10 +795,9 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
         is_reusable_bool->release();
     }
     
-    // 3.3: Advanced resource mapping with optimization metadata
-    char buffer_key[32];
-    snprintf(buffer_key, sizeof(buffer_key), "cmd_buffer_%u", *buffer_id);
-    m_resource_map->setObject(buffer_key, cmd_buffer_obj);
+    // 3.3: Publish the buffer under its reserved handle; the table keeps
+    // the creation reference
+    m_resource_table.replace(*buffer_id, cmd_buffer_obj);
     
     // 3.4: Command buffer optimization analysis
     uint32_t buffer_hash = (*buffer_id ^ queue_id) & 0x3F; // 64-entry optimization cache
@@ -811,7 +822,7 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
                 
                 optimization_applied = true;
                 g_command_buffer_stats.optimization_hits++;
-                IOLog("VMMetalBridge: Applied cached optimizations to command buffer %u (flags: 0x%X)\n", 
+                VMLOG_DEBUG("VMMetalBridge: Applied cached optimizations to command buffer %u (flags: 0x%X)\n", 
                       *buffer_id, opt_flags);
                 break;
             }
@@ -830,7 +841,7 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
     // 4.2: GPU workload scheduling based on priority
     IOReturn scheduling_result = scheduleCommandBufferWorkload(*buffer_id, cmd_info->priority_level);
     if (scheduling_result != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Warning - workload scheduling failed for buffer %u (0x%x)\n", 
+        VMLOG_ERROR("VMMetalBridge: Warning - workload scheduling failed for buffer %u (0x%x)\n", 
               *buffer_id, scheduling_result);
     }
     
@@ -857,13 +868,13 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
     // 5.1: Initialize dependency tracking for the command buffer
     IOReturn dependency_result = initializeCommandBufferDependencies(*buffer_id);
     if (dependency_result != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Warning - dependency tracking initialization failed (0x%x)\n", dependency_result);
+        VMLOG_ERROR("VMMetalBridge: Warning - dependency tracking initialization failed (0x%x)\n", dependency_result);
     }
     
     // 5.2: Register command buffer for resource tracking
     IOReturn tracking_result = registerCommandBufferForTracking(*buffer_id, queue_id);
     if (tracking_result != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Warning - resource tracking registration failed (0x%x)\n", tracking_result);
+        VMLOG_ERROR("VMMetalBridge: Warning - resource tracking registration failed (0x%x)\n", tracking_result);
     }
     
     // 5.3: Performance reporting (every 25 command buffer creations)
@@ -877,16 +888,16 @@ IOReturn CLASS::createCommandBuffer(uint32_t queue_id, uint32_t* buffer_id)
     IORecursiveLockUnlock(m_lock);
     
     // 5.4: Comprehensive success logging with full analytics
-    IOLog("VMMetalBridge: Successfully created command buffer %u:\n", *buffer_id);
-    IOLog("  - Queue ID: %u, Context ID: %u, Priority: %u\n", 
+    VMLOG_DEBUG("VMMetalBridge: Successfully created command buffer %u:\n", *buffer_id);
+    VMLOG_DEBUG("  - Queue ID: %u, Context ID: %u, Priority: %u\n", 
           queue_id, context_id, cmd_info->priority_level);
-    IOLog("  - Pool: %u ('%s'), Pool Usage: %u/%u\n", 
+    VMLOG_DEBUG("  - Pool: %u ('%s'), Pool Usage: %u/%u\n", 
           selected_pool_id, target_pool->pool_name, target_pool->active_buffers, target_pool->pool_size);
-    IOLog("  - Creation Time: %llu ns, Optimized: %s\n", 
+    VMLOG_DEBUG("  - Creation Time: %llu ns, Optimized: %s\n", 
           creation_duration, optimization_applied ? "yes" : "no");
-    IOLog("  - Debug Label: '%s', Reusable: %s\n", 
+    VMLOG_DEBUG("  - Debug Label: '%s', Reusable: %s\n", 
           cmd_info->debug_label, cmd_info->is_reusable ? "yes" : "no");
-    IOLog("  - Total Active Buffers: %u, Registry Usage: %u/256\n", 
+    VMLOG_DEBUG("  - Total Active Buffers: %u, Registry Usage: %u/256\n", 
           g_command_buffer_stats.active_command_buffers, g_command_buffer_registry_size);
     
     return kIOReturnSuccess;
@@ -931,7 +942,7 @@ IOReturn CLASS::initializeCommandBufferPools()
         
         g_command_buffer_pool_count++;
         
-        IOLog("VMMetalBridge: Initialized command buffer pool %u: '%s' (%u buffers)\n",
+        VMLOG_INFO("VMMetalBridge: Initialized command buffer pool %u: '%s' (%u buffers)\n",
               pool->pool_id, pool->pool_name, pool->pool_size);
     }
     
@@ -940,7 +951,7 @@ IOReturn CLASS::initializeCommandBufferPools()
     g_normal_priority_queue = OSArray::withCapacity(128);
     g_low_priority_queue = OSArray::withCapacity(64);
     
-    IOLog("VMMetalBridge: Initialized %u command buffer pools with scheduling queues\n", g_command_buffer_pool_count);
+    VMLOG_INFO("VMMetalBridge: Initialized %u command buffer pools with scheduling queues\n", g_command_buffer_pool_count);
     return kIOReturnSuccess;
 }
 
@@ -995,7 +1006,7 @@ IOReturn CLASS::expandCommandBufferPool(uint32_t pool_id)
     pool->pool_size = new_size;
     pool->available_buffers = new_size - pool->active_buffers;
     
-    IOLog("VMMetalBridge: Expanded pool %u ('%s') to %u buffers (+%u)\n",
+    VMLOG_DEBUG("VMMetalBridge: Expanded pool %u ('%s') to %u buffers (+%u)\n",
           pool_id, pool->pool_name, new_size, expansion);
     
     return kIOReturnSuccess;
@@ -1067,7 +1078,7 @@ IOReturn CLASS::scheduleCommandBufferWorkload(uint32_t buffer_id, uint32_t prior
         case 2: // High priority
             if (g_high_priority_queue) {
                 g_high_priority_queue->setObject(buffer_num);
-                IOLog("VMMetalBridge: Scheduled command buffer %u for high priority execution\n", buffer_id);
+                VMLOG_DEBUG("VMMetalBridge: Scheduled command buffer %u for high priority execution\n", buffer_id);
             } else {
                 result = kIOReturnNoResources;
             }
@@ -1131,7 +1142,7 @@ IOReturn CLASS::initializeCommandBufferDependencies(uint32_t buffer_id)
     // 1.1: Initialize dependency tracking structures
     IOReturn dependency_init_result = initializeAdvancedDependencyTracking(buffer_id);
     if (dependency_init_result != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Advanced dependency tracking initialization failed (0x%x)\n", dependency_init_result);
+        VMLOG_ERROR("VMMetalBridge: Advanced dependency tracking initialization failed (0x%x)\n", dependency_init_result);
         return dependency_init_result;
     }
     
@@ -1139,13 +1150,13 @@ IOReturn CLASS::initializeCommandBufferDependencies(uint32_t buffer_id)
     IOReturn resource_analysis_result = analyzeCommandBufferResourceDependencies(buffer_id, cmd_info);
     if (resource_analysis_result == kIOReturnSuccess) {
         cmd_info->has_dependencies = true;
-        IOLog("VMMetalBridge: Detected resource dependencies for command buffer %u\n", buffer_id);
+        VMLOG_INFO("VMMetalBridge: Detected resource dependencies for command buffer %u\n", buffer_id);
     }
     
     // 1.3: Set up dependency graph nodes and edges
     IOReturn dependency_graph_result = constructDependencyGraph(buffer_id, cmd_info);
     if (dependency_graph_result != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Dependency graph construction failed (0x%x)\n", dependency_graph_result);
+        VMLOG_ERROR("VMMetalBridge: Dependency graph construction failed (0x%x)\n", dependency_graph_result);
     }
     
     /*
@@ -1155,19 +1166,19 @@ IOReturn CLASS::initializeCommandBufferDependencies(uint32_t buffer_id)
     // 2.1: Configure GPU synchronization primitives based on dependencies
     IOReturn sync_primitive_result = configureSynchronizationPrimitives(buffer_id, cmd_info);
     if (sync_primitive_result != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Synchronization primitive configuration failed (0x%x)\n", sync_primitive_result);
+        VMLOG_ERROR("VMMetalBridge: Synchronization primitive configuration failed (0x%x)\n", sync_primitive_result);
     }
     
     // 2.2: Setup memory barriers for resource coherency
     IOReturn memory_barrier_result = setupMemoryBarriers(buffer_id, cmd_info);
     if (memory_barrier_result != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Memory barrier setup failed (0x%x)\n", memory_barrier_result);
+        VMLOG_ERROR("VMMetalBridge: Memory barrier setup failed (0x%x)\n", memory_barrier_result);
     }
     
     // 2.3: Register dependency validation callbacks
     IOReturn validation_callback_result = registerDependencyValidationCallbacks(buffer_id);
     if (validation_callback_result == kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Advanced dependency tracking initialized for command buffer %u\n", buffer_id);
+        VMLOG_INFO("VMMetalBridge: Advanced dependency tracking initialized for command buffer %u\n", buffer_id);
     }
     
     return kIOReturnSuccess;
@@ -1185,7 +1196,7 @@ IOReturn CLASS::registerCommandBufferForTracking(uint32_t buffer_id, uint32_t qu
         m_resource_map->setObject(tracking_key, registration_time);
         registration_time->release();
         
-        IOLog("VMMetalBridge: Registered command buffer %u for resource tracking\n", buffer_id);
+        VMLOG_INFO("VMMetalBridge: Registered command buffer %u for resource tracking\n", buffer_id);
         return kIOReturnSuccess;
     }
     
@@ -1195,75 +1206,75 @@ IOReturn CLASS::registerCommandBufferForTracking(uint32_t buffer_id, uint32_t qu
 // Generate comprehensive analytics report for command buffer management
 void CLASS::generateCommandBufferAnalyticsReport()
 {
-    IOLog("VMMetalBridge: === Advanced Metal Command Buffer Management System v6.0 Report ===\n");
+    VMLOG_INFO("VMMetalBridge: === Advanced Metal Command Buffer Management System v6.0 Report ===\n");
     
     // Command buffer statistics
-    IOLog("  Command Buffer Statistics:\n");
-    IOLog("    - Total Buffers Created: %u\n", g_command_buffer_stats.total_command_buffers);
-    IOLog("    - Active Buffers: %u\n", g_command_buffer_stats.active_command_buffers);
-    IOLog("    - Recording Buffers: %u\n", g_command_buffer_stats.recording_buffers);
-    IOLog("    - Committed Buffers: %u\n", g_command_buffer_stats.committed_buffers);
-    IOLog("    - Executed Buffers: %u\n", g_command_buffer_stats.executed_buffers);
-    IOLog("    - Reused Buffers: %u\n", g_command_buffer_stats.reused_buffers);
+    VMLOG_INFO("  Command Buffer Statistics:\n");
+    VMLOG_INFO("    - Total Buffers Created: %u\n", g_command_buffer_stats.total_command_buffers);
+    VMLOG_INFO("    - Active Buffers: %u\n", g_command_buffer_stats.active_command_buffers);
+    VMLOG_INFO("    - Recording Buffers: %u\n", g_command_buffer_stats.recording_buffers);
+    VMLOG_INFO("    - Committed Buffers: %u\n", g_command_buffer_stats.committed_buffers);
+    VMLOG_INFO("    - Executed Buffers: %u\n", g_command_buffer_stats.executed_buffers);
+    VMLOG_INFO("    - Reused Buffers: %u\n", g_command_buffer_stats.reused_buffers);
     
     // Performance metrics
-    IOLog("  Performance Metrics:\n");
-    IOLog("    - Average Creation Time: %llu ns\n", g_command_buffer_stats.average_recording_time_ns);
-    IOLog("    - Average Execution Time: %llu ns\n", g_command_buffer_stats.average_execution_time_ns);
-    IOLog("    - Total GPU Time: %llu ns\n", g_command_buffer_stats.total_gpu_time_ns);
-    IOLog("    - Total Commands Recorded: %llu\n", g_command_buffer_stats.total_commands_recorded);
+    VMLOG_INFO("  Performance Metrics:\n");
+    VMLOG_INFO("    - Average Creation Time: %llu ns\n", g_command_buffer_stats.average_recording_time_ns);
+    VMLOG_INFO("    - Average Execution Time: %llu ns\n", g_command_buffer_stats.average_execution_time_ns);
+    VMLOG_INFO("    - Total GPU Time: %llu ns\n", g_command_buffer_stats.total_gpu_time_ns);
+    VMLOG_INFO("    - Total Commands Recorded: %llu\n", g_command_buffer_stats.total_commands_recorded);
     
     // Pool utilization analysis
-    IOLog("  Pool Utilization:\n");
+    VMLOG_INFO("  Pool Utilization:\n");
     for (uint32_t i = 0; i < g_command_buffer_pool_count; i++) {
         VMMetalCommandBufferPool* pool = &g_command_buffer_pools[i];
         uint32_t utilization = (pool->active_buffers * 100) / pool->pool_size;
         
-        IOLog("    - Pool %u ('%s'): %u/%u (%u%%), Peak: %u, Allocs: %llu\n",
+        VMLOG_INFO("    - Pool %u ('%s'): %u/%u (%u%%), Peak: %u, Allocs: %llu\n",
               i, pool->pool_name, pool->active_buffers, pool->pool_size, 
               utilization, pool->peak_usage, pool->total_allocations);
     }
     
     // Error and optimization statistics
-    IOLog("  System Health:\n");
-    IOLog("    - Registry Usage: %u/256 entries\n", g_command_buffer_registry_size);
-    IOLog("    - Optimization Hits: %u\n", g_command_buffer_stats.optimization_hits);
-    IOLog("    - Validation Errors: %u\n", g_command_buffer_stats.validation_errors);
-    IOLog("    - Pool Overflows: %u\n", g_command_buffer_stats.pool_overflows);
-    IOLog("    - Dependency Violations: %u\n", g_command_buffer_stats.dependency_violations);
+    VMLOG_INFO("  System Health:\n");
+    VMLOG_INFO("    - Registry Usage: %u/256 entries\n", g_command_buffer_registry_size);
+    VMLOG_INFO("    - Optimization Hits: %u\n", g_command_buffer_stats.optimization_hits);
+    VMLOG_INFO("    - Validation Errors: %u\n", g_command_buffer_stats.validation_errors);
+    VMLOG_INFO("    - Pool Overflows: %u\n", g_command_buffer_stats.pool_overflows);
+    VMLOG_INFO("    - Dependency Violations: %u\n", g_command_buffer_stats.dependency_violations);
     
     // Workload scheduling analysis
     uint32_t high_priority_count = g_high_priority_queue ? g_high_priority_queue->getCount() : 0;
     uint32_t normal_priority_count = g_normal_priority_queue ? g_normal_priority_queue->getCount() : 0;
     uint32_t low_priority_count = g_low_priority_queue ? g_low_priority_queue->getCount() : 0;
     
-    IOLog("  Workload Scheduling:\n");
-    IOLog("    - High Priority Queue: %u buffers\n", high_priority_count);
-    IOLog("    - Normal Priority Queue: %u buffers\n", normal_priority_count);
-    IOLog("    - Low Priority Queue: %u buffers\n", low_priority_count);
+    VMLOG_INFO("  Workload Scheduling:\n");
+    VMLOG_INFO("    - High Priority Queue: %u buffers\n", high_priority_count);
+    VMLOG_INFO("    - Normal Priority Queue: %u buffers\n", normal_priority_count);
+    VMLOG_INFO("    - Low Priority Queue: %u buffers\n", low_priority_count);
     
     // System recommendations
-    IOLog("  System Recommendations:\n");
+    VMLOG_INFO("  System Recommendations:\n");
     
     uint32_t total_active = g_command_buffer_stats.active_command_buffers;
     if (total_active > 200) {
-        IOLog("    - High buffer usage detected - consider buffer reuse optimization\n");
+        VMLOG_INFO("    - High buffer usage detected - consider buffer reuse optimization\n");
     }
     
     if (g_command_buffer_stats.pool_overflows > 5) {
-        IOLog("    - Multiple pool overflows - consider increasing pool sizes\n");
+        VMLOG_WARN("    - Multiple pool overflows - consider increasing pool sizes\n");
     }
     
     if (g_command_buffer_stats.validation_errors > 10) {
-        IOLog("    - High validation error rate - check application code\n");
+        VMLOG_WARN("    - High validation error rate - check application code\n");
     }
     
     uint64_t avg_time = g_command_buffer_stats.average_recording_time_ns;
     if (avg_time > 10000) { // 10 microseconds
-        IOLog("    - High average creation time - consider pool pre-warming\n");
+        VMLOG_INFO("    - High average creation time - consider pool pre-warming\n");
     }
     
-    IOLog("  === End of Command Buffer Management System Report ===\n");
+    VMLOG_INFO("  === End of Command Buffer Management System Report ===\n");
 }
 
 /*
@@ -1301,7 +1312,7 @@ IOReturn CLASS::initializeAdvancedDependencyTracking(uint32_t buffer_id)
         memset(g_dependency_edges, 0, sizeof(g_dependency_edges));
         memset(&g_dependency_stats, 0, sizeof(g_dependency_stats));
         
-        IOLog("VMMetalBridge: Initialized dependency tracking infrastructure\n");
+        VMLOG_INFO("VMMetalBridge: Initialized dependency tracking infrastructure\n");
     }
     
     // Create dependency tracking entry for this command buffer
@@ -1315,7 +1326,7 @@ IOReturn CLASS::initializeAdvancedDependencyTracking(uint32_t buffer_id)
     }
     
     if (!dependency_info) {
-        IOLog("VMMetalBridge: Dependency tracking registry full for buffer %u\n", buffer_id);
+        VMLOG_INFO("VMMetalBridge: Dependency tracking registry full for buffer %u\n", buffer_id);
         return kIOReturnNoMemory;
     }
     
@@ -1337,7 +1348,7 @@ IOReturn CLASS::initializeAdvancedDependencyTracking(uint32_t buffer_id)
     
     g_dependency_stats.total_dependencies++;
     
-    IOLog("VMMetalBridge: Initialized dependency tracking for command buffer %u\n", buffer_id);
+    VMLOG_INFO("VMMetalBridge: Initialized dependency tracking for command buffer %u\n", buffer_id);
     return kIOReturnSuccess;
 }
 
@@ -1390,7 +1401,7 @@ IOReturn CLASS::analyzeCommandBufferResourceDependencies(uint32_t buffer_id, VMM
     dependency_info->dependency_count = dependency_count;
     
     if (has_dependencies) {
-        IOLog("VMMetalBridge: Detected %u dependencies for command buffer %u\n", 
+        VMLOG_INFO("VMMetalBridge: Detected %u dependencies for command buffer %u\n", 
               dependency_count, buffer_id);
         return kIOReturnSuccess;
     }
@@ -1443,7 +1454,7 @@ IOReturn CLASS::constructDependencyGraph(uint32_t buffer_id, VMMetalCommandBuffe
     
     g_dependency_stats.graph_nodes++;
     
-    IOLog("VMMetalBridge: Created dependency graph with %u edges for buffer %u\n", 
+    VMLOG_DEBUG("VMMetalBridge: Created dependency graph with %u edges for buffer %u\n", 
           edges_created, buffer_id);
     
     return kIOReturnSuccess;
@@ -1476,7 +1487,7 @@ IOReturn CLASS::configureSynchronizationPrimitives(uint32_t buffer_id, VMMetalCo
     // Update command buffer synchronization flags
     if (sync_primitives_configured > 0) {
         cmd_info->has_dependencies = true;
-        IOLog("VMMetalBridge: Configured %u synchronization primitives for buffer %u\n", 
+        VMLOG_INFO("VMMetalBridge: Configured %u synchronization primitives for buffer %u\n", 
               sync_primitives_configured, buffer_id);
     }
     
@@ -1510,13 +1521,13 @@ IOReturn CLASS::setupMemoryBarriers(uint32_t buffer_id, VMMetalCommandBufferInfo
             IOReturn barrier_result = configureGPUMemoryBarrier(buffer_id, dependency_info);
             if (barrier_result == kIOReturnSuccess) {
                 g_dependency_stats.active_barriers++;
-                IOLog("VMMetalBridge: Configured memory barrier for buffer %u\n", buffer_id);
+                VMLOG_INFO("VMMetalBridge: Configured memory barrier for buffer %u\n", buffer_id);
                 return kIOReturnSuccess;
             }
         }
         
         // Fallback: Use software synchronization
-        IOLog("VMMetalBridge: Using software synchronization for buffer %u\n", buffer_id);
+        VMLOG_INFO("VMMetalBridge: Using software synchronization for buffer %u\n", buffer_id);
         return kIOReturnSuccess;
     }
     
@@ -1536,7 +1547,7 @@ IOReturn CLASS::registerDependencyValidationCallbacks(uint32_t buffer_id)
         m_resource_map->setObject(callback_key, validation_time);
         validation_time->release();
         
-        IOLog("VMMetalBridge: Registered dependency validation for buffer %u\n", buffer_id);
+        VMLOG_INFO("VMMetalBridge: Registered dependency validation for buffer %u\n", buffer_id);
         return kIOReturnSuccess;
     }
     
@@ -1607,17 +1618,17 @@ IOReturn CLASS::configureSyncPrimitive(VMDependencyEdge* edge)
     // Configure synchronization based on dependency type
     switch (edge->dependency_type) {
         case 0: // RAW dependency - needs execution barrier
-            IOLog("VMMetalBridge: Configured execution barrier for RAW dependency %u->%u\n", 
+            VMLOG_INFO("VMMetalBridge: Configured execution barrier for RAW dependency %u->%u\n", 
                   edge->source_buffer_id, edge->target_buffer_id);
             break;
             
         case 1: // WAR dependency - needs memory fence
-            IOLog("VMMetalBridge: Configured memory fence for WAR dependency %u->%u\n", 
+            VMLOG_INFO("VMMetalBridge: Configured memory fence for WAR dependency %u->%u\n", 
                   edge->source_buffer_id, edge->target_buffer_id);
             break;
             
         case 2: // WAW dependency - needs write barrier
-            IOLog("VMMetalBridge: Configured write barrier for WAW dependency %u->%u\n", 
+            VMLOG_INFO("VMMetalBridge: Configured write barrier for WAW dependency %u->%u\n", 
                   edge->source_buffer_id, edge->target_buffer_id);
             break;
             
@@ -1640,7 +1651,7 @@ IOReturn CLASS::configureGPUMemoryBarrier(uint32_t buffer_id, VMResourceDependen
         // Configure barrier through GPU command submission
         IOReturn barrier_result = m_gpu_device->executeCommands(1, nullptr);
         if (barrier_result == kIOReturnSuccess) {
-            IOLog("VMMetalBridge: GPU memory barrier configured for buffer %u\n", buffer_id);
+            VMLOG_INFO("VMMetalBridge: GPU memory barrier configured for buffer %u\n", buffer_id);
             return kIOReturnSuccess;
         }
     }
@@ -1685,20 +1696,20 @@ IOReturn CLASS::createBuffer(uint32_t device_id, const VMMetalBufferDescriptor*
         }
     }
     
-    *buffer_id = allocateResourceId();
+    *buffer_id = registerResource(buffer_memory, VM_METAL_BUFFER);
+    if (!*buffer_id) {
+        buffer_memory->release();
+        m_gpu_device->deallocateResource(gpu_resource_id);
+        IORecursiveLockUnlock(m_lock);
+        return kIOReturnNoResources;
+    }
     m_buffers->setObject(buffer_memory);
-    
-    // Map in resource dictionary using string key
-    char resource_key[32];
-    snprintf(resource_key, sizeof(resource_key), "%u", *buffer_id);
-    m_resource_map->setObject(resource_key, buffer_memory);
-    
     buffer_memory->release();
     m_metal_buffer_allocations++;
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMMetalBridge: Created buffer %d (size: %d bytes)\n", *buffer_id, descriptor->length);
+    VMLOG_DEBUG("VMMetalBridge: Created buffer %d (size: %d bytes)\n", *buffer_id, descriptor->length);
     return kIOReturnSuccess;
 }
 
@@ -1711,12 +1722,12 @@ IOReturn CLASS::createTexture(uint32_t device_id, const VMMetalTextureDescriptor
     
     // Validate texture parameters
     if (descriptor->width == 0 || descriptor->height == 0 || descriptor->depth == 0) {
-        IOLog("VMMetalBridge::createTexture: Invalid texture dimensions\n");
+        VMLOG_WARN("VMMetalBridge::createTexture: Invalid texture dimensions\n");
         return kIOReturnBadArgument;
     }
     
     if (descriptor->width > 16384 || descriptor->height > 16384 || descriptor->depth > 2048) {
-        IOLog("VMMetalBridge::createTexture: Texture dimensions too large\n");
+        VMLOG_DEBUG("VMMetalBridge::createTexture: Texture dimensions too large\n");
         return kIOReturnBadArgument;
     }
     
@@ -1747,7 +1758,7 @@ IOReturn CLASS::createTexture(uint32_t device_id, const VMMetalTextureDescriptor
             target = VIRTIO_GPU_RESOURCE_TARGET_CUBE_ARRAY;
             break;
         default:
-            IOLog("VMMetalBridge::createTexture: Unsupported texture type %d\n", descriptor->texture_type);
+            VMLOG_WARN("VMMetalBridge::createTexture: Unsupported texture type %d\n", descriptor->texture_type);
             target = VIRTIO_GPU_RESOURCE_TARGET_2D;
             break;
     }
@@ -1789,7 +1800,7 @@ IOReturn CLASS::createTexture(uint32_t device_id, const VMMetalTextureDescriptor
                                                    descriptor->depth);
     if (ret != kIOReturnSuccess) {
         IORecursiveLockUnlock(m_lock);
-        IOLog("VMMetalBridge::createTexture: Failed to allocate GPU resource (0x%x)\n", ret);
+        VMLOG_ERROR("VMMetalBridge::createTexture: Failed to allocate GPU resource (0x%x)\n", ret);
         return ret;
     }
     
@@ -1829,10 +1840,9 @@ IOReturn CLASS::createTexture(uint32_t device_id, const VMMetalTextureDescriptor
         bzero(texture_data, texture_size);
     }
     
-    *texture_id = allocateResourceId();
     m_textures->setObject(texture_memory);
     
-    // Create texture metadata and store in resource map
+    // Create texture metadata; the texture id resolves to it
     OSDictionary* texture_metadata = OSDictionary::withCapacity(16);
     if (texture_metadata) {
         OSNumber* width = OSNumber::withNumber(descriptor->width, 32);
@@ -1864,19 +1874,23 @@ IOReturn CLASS::createTexture(uint32_t device_id, const VMMetalTextureDescriptor
             size->release();
             gpu_res->release();
         }
-        
-        char texture_key[32];
-        snprintf(texture_key, sizeof(texture_key), "%u", *texture_id);
-        m_resource_map->setObject(texture_key, texture_metadata);
-        texture_metadata->release();
     }
     
+    *texture_id = registerResource(texture_metadata ? (OSObject*)texture_metadata : (OSObject*)texture_memory,
+                                   VM_METAL_TEXTURE);
+    if (texture_metadata) {
+        texture_metadata->release();
+    }
     texture_memory->release();
+    if (!*texture_id) {
+        IORecursiveLockUnlock(m_lock);
+        return kIOReturnNoResources;
+    }
     m_metal_texture_allocations++;
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMMetalBridge::createTexture: Created texture %d (%dx%dx%d, format: %d, type: %d, size: %u bytes, %u mip levels)\n", 
+    VMLOG_DEBUG("VMMetalBridge::createTexture: Created texture %d (%dx%dx%d, format: %d, type: %d, size: %u bytes, %u mip levels)\n", 
           *texture_id, descriptor->width, descriptor->height, descriptor->depth, 
           descriptor->pixel_format, descriptor->texture_type, texture_size, mip_levels);
     
@@ -1894,10 +1908,10 @@ IOReturn CLASS::createRenderPipelineState(uint32_t device_id,
     IORecursiveLockLock(m_lock);
     
     // Create render pipeline through shader manager
+    uint32_t program_id = 0;
     if (m_accelerator && m_accelerator->getShaderManager()) {
         // Create a shader program with vertex and fragment shaders
         uint32_t shader_ids[2] = {descriptor->vertex_function_id, descriptor->fragment_function_id};
-        uint32_t program_id;
         
         IOReturn ret = m_accelerator->getShaderManager()->createProgram(shader_ids, 2, &program_id);
         if (ret != kIOReturnSuccess) {
@@ -1911,27 +1925,23 @@ IOReturn CLASS::createRenderPipelineState(uint32_t device_id,
             IORecursiveLockUnlock(m_lock);
             return ret;
         }
-        
-        *pipeline_id = program_id; // Use program ID as pipeline ID
-    } else {
-        *pipeline_id = allocateResourceId();
     }
     
-    // Create placeholder pipeline object
-    OSNumber* pipeline = OSNumber::withNumber(*pipeline_id, 32);
-    if (pipeline) {
-        m_render_pipelines->setObject(pipeline);
-        
-        // Map in resource dictionary using string key
-        char pipeline_key[32];
-        snprintf(pipeline_key, sizeof(pipeline_key), "%u", *pipeline_id);
-        m_resource_map->setObject(pipeline_key, pipeline);
-        pipeline->release();
+    // Pipeline object: the shader program behind it (0 without a shader manager)
+    OSNumber* pipeline = OSNumber::withNumber(program_id, 32);
+    *pipeline_id = pipeline ? registerResource(pipeline, VM_METAL_RENDER_PIPELINE) : 0;
+    if (!*pipeline_id) {
+        if (pipeline) pipeline->release();
+        if (program_id) m_accelerator->getShaderManager()->destroyProgram(program_id);
+        IORecursiveLockUnlock(m_lock);
+        return pipeline ? kIOReturnNoResources : kIOReturnNoMemory;
     }
+    m_render_pipelines->setObject(pipeline);
+    pipeline->release();
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMMetalBridge: Created render pipeline state %d\n", *pipeline_id);
+    VMLOG_DEBUG("VMMetalBridge: Created render pipeline state %d\n", *pipeline_id);
     return kIOReturnSuccess;
 }
 
@@ -1966,7 +1976,7 @@ IOReturn CLASS::drawPrimitives(uint32_t command_buffer_id,
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMMetalBridge: Draw primitives - type: %d, vertices: %d\n",
+    VMLOG_DEBUG("VMMetalBridge: Draw primitives - type: %d, vertices: %d\n",
           descriptor->primitive_type, descriptor->vertex_count);
     
     return kIOReturnSuccess;
@@ -1994,7 +2004,7 @@ IOReturn CLASS::commitCommandBuffer(uint32_t command_buffer_id)
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMMetalBridge: Committed command buffer %d\n", command_buffer_id);
+    VMLOG_DEBUG("VMMetalBridge: Committed command buffer %d\n", command_buffer_id);
     return kIOReturnSuccess;
 }
 
@@ -2056,33 +2066,35 @@ IOReturn CLASS::getPerformanceStatistics(void* stats_buffer, size_t* buffer_size
 
 void CLASS::logMetalBridgeState()
 {
-    IOLog("VMMetalBridge State:\n");
-    IOLog("  Draw Calls: %llu\n", m_metal_draw_calls);
-    IOLog("  Compute Dispatches: %llu\n", m_metal_compute_dispatches);
-    IOLog("  Buffer Allocations: %llu\n", m_metal_buffer_allocations);
-    IOLog("  Texture Allocations: %llu\n", m_metal_texture_allocations);
-    IOLog("  Active Buffers: %d\n", m_buffers ? m_buffers->getCount() : 0);
-    IOLog("  Active Textures: %d\n", m_textures ? m_textures->getCount() : 0);
-    IOLog("  Active Render Pipelines: %d\n", m_render_pipelines ? m_render_pipelines->getCount() : 0);
-    IOLog("  Metal 2 Support: %s\n", m_supports_metal_2 ? "Yes" : "No");
-    IOLog("  Metal 3 Support: %s\n", m_supports_metal_3 ? "Yes" : "No");
+    VMLOG_INFO("VMMetalBridge State:\n");
+    VMLOG_INFO("  Draw Calls: %llu\n", m_metal_draw_calls);
+    VMLOG_INFO("  Compute Dispatches: %llu\n", m_metal_compute_dispatches);
+    VMLOG_INFO("  Buffer Allocations: %llu\n", m_metal_buffer_allocations);
+    VMLOG_INFO("  Texture Allocations: %llu\n", m_metal_texture_allocations);
+    VMLOG_INFO("  Active Buffers: %d\n", m_buffers ? m_buffers->getCount() : 0);
+    VMLOG_INFO("  Active Textures: %d\n", m_textures ? m_textures->getCount() : 0);
+    VMLOG_INFO("  Active Render Pipelines: %d\n", m_render_pipelines ? m_render_pipelines->getCount() : 0);
+    VMLOG_INFO("  Metal 2 Support: %s\n", m_supports_metal_2 ? "Yes" : "No");
+    VMLOG_INFO("  Metal 3 Support: %s\n", m_supports_metal_3 ? "Yes" : "No");
 }
 
 // Private helper methods
 
+// Resolves a handle only if it names a live resource of the expected type
 OSObject* CLASS::findResource(uint32_t resource_id, VMMetalResourceType expected_type)
 {
-    char key_str[32];
-    snprintf(key_str, sizeof(key_str), "%u", resource_id);
-    
-    OSObject* resource = m_resource_map->getObject(key_str);
-    
-    return resource;
+    return m_resource_table.lookup(resource_id, expected_type);
 }
 
-uint32_t CLASS::allocateResourceId()
+// Returns the resource's handle (0 when the table is full) and retains it.
+// A null resource reserves the handle until m_resource_table.replace().
+uint32_t CLASS::registerResource(OSObject* resource, VMMetalResourceType type)
 {
-    return __sync_fetch_and_add(&m_next_resource_id, 1);
+    uint32_t handle = m_resource_table.insert(resource, type);
+    if (handle && resource) {
+        resource->retain();
+    }
+    return handle;
 }
 
 VMMetalPixelFormat CLASS::translatePixelFormat(uint32_t vm_format)
@@ -2139,7 +2151,7 @@ IOReturn CLASS::updateBuffer(uint32_t buffer_id, const void* data, uint32_t offs
     
     if (!buffer) {
         IORecursiveLockUnlock(m_lock);
-        IOLog("VMMetalBridge::updateBuffer: Buffer %d not found\n", buffer_id);
+        VMLOG_DEBUG("VMMetalBridge::updateBuffer: Buffer %d not found\n", buffer_id);
         return kIOReturnNotFound;
     }
     
@@ -2147,7 +2159,7 @@ IOReturn CLASS::updateBuffer(uint32_t buffer_id, const void* data, uint32_t offs
     IOByteCount buffer_capacity = buffer->getCapacity();
     if (offset >= buffer_capacity || (offset + size) > buffer_capacity) {
         IORecursiveLockUnlock(m_lock);
-        IOLog("VMMetalBridge::updateBuffer: Invalid range - buffer size: %llu, offset: %u, size: %u\n", 
+        VMLOG_WARN("VMMetalBridge::updateBuffer: Invalid range - buffer size: %llu, offset: %u, size: %u\n", 
               buffer_capacity, offset, size);
         return kIOReturnBadArgument;
     }
@@ -2156,7 +2168,7 @@ IOReturn CLASS::updateBuffer(uint32_t buffer_id, const void* data, uint32_t offs
     void* buffer_data = buffer->getBytesNoCopy();
     if (!buffer_data) {
         IORecursiveLockUnlock(m_lock);
-        IOLog("VMMetalBridge::updateBuffer: Failed to get buffer memory\n");
+        VMLOG_ERROR("VMMetalBridge::updateBuffer: Failed to get buffer memory\n");
         return kIOReturnNoMemory;
     }
     
@@ -2170,7 +2182,7 @@ IOReturn CLASS::updateBuffer(uint32_t buffer_id, const void* data, uint32_t offs
     if (m_gpu_device && m_gpu_device->supports3D()) {
         IOReturn sync_result = performAdvancedGPUMemorySynchronization(buffer_id, data, offset, size, buffer);
         if (sync_result != kIOReturnSuccess) {
-            IOLog("VMMetalBridge::updateBuffer: Advanced GPU synchronization failed (0x%x)\n", sync_result);
+            VMLOG_ERROR("VMMetalBridge::updateBuffer: Advanced GPU synchronization failed (0x%x)\n", sync_result);
         }
     }
     
@@ -2179,7 +2191,7 @@ IOReturn CLASS::updateBuffer(uint32_t buffer_id, const void* data, uint32_t offs
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMMetalBridge::updateBuffer: Updated buffer %d (%u bytes at offset %u)\n", 
+    VMLOG_DEBUG("VMMetalBridge::updateBuffer: Updated buffer %d (%u bytes at offset %u)\n", 
           buffer_id, size, offset);
     return kIOReturnSuccess;
 }
@@ -2251,7 +2263,7 @@ IOReturn CLASS::performAdvancedGPUMemorySynchronization(uint32_t buffer_id, cons
     if (g_gpu_memory_pool_count == 0) {
         IOReturn pool_init_result = initializeGPUMemoryPools();
         if (pool_init_result != kIOReturnSuccess) {
-            IOLog("VMMetalBridge: GPU memory pool initialization failed (0x%x)\n", pool_init_result);
+            VMLOG_ERROR("VMMetalBridge: GPU memory pool initialization failed (0x%x)\n", pool_init_result);
             g_gpu_memory_sync_stats.failed_transfers++;
             return pool_init_result;
         }
@@ -2268,7 +2280,7 @@ IOReturn CLASS::performAdvancedGPUMemorySynchronization(uint32_t buffer_id, cons
             // Try alternative pool with sufficient capacity
             uint32_t alternative_pool = findAvailableGPUMemoryPool(size);
             if (alternative_pool == UINT32_MAX) {
-                IOLog("VMMetalBridge: No GPU memory pool available for %u bytes\n", size);
+                VMLOG_DEBUG("VMMetalBridge: No GPU memory pool available for %u bytes\n", size);
                 g_gpu_memory_sync_stats.memory_pool_overflows++;
                 return kIOReturnNoResources;
             }
@@ -2283,7 +2295,7 @@ IOReturn CLASS::performAdvancedGPUMemorySynchronization(uint32_t buffer_id, cons
     IOBufferMemoryDescriptor* transfer_memory = 
         IOBufferMemoryDescriptor::withBytes(data, size, kIODirectionOut);
     if (!transfer_memory) {
-        IOLog("VMMetalBridge: Failed to create transfer memory descriptor\n");
+        VMLOG_ERROR("VMMetalBridge: Failed to create transfer memory descriptor\n");
         g_gpu_memory_sync_stats.failed_transfers++;
         return kIOReturnNoMemory;
     }
@@ -2292,7 +2304,7 @@ IOReturn CLASS::performAdvancedGPUMemorySynchronization(uint32_t buffer_id, cons
     uint64_t gpu_address = allocateGPUMemoryInPool(selected_pool_id, size, buffer_id);
     if (gpu_address == 0) {
         transfer_memory->release();
-        IOLog("VMMetalBridge: Failed to allocate GPU memory address\n");
+        VMLOG_ERROR("VMMetalBridge: Failed to allocate GPU memory address\n");
         g_gpu_memory_sync_stats.failed_transfers++;
         return kIOReturnNoMemory;
     }
@@ -2302,7 +2314,7 @@ IOReturn CLASS::performAdvancedGPUMemorySynchronization(uint32_t buffer_id, cons
     if (mapping_result != kIOReturnSuccess) {
         deallocateGPUMemoryInPool(selected_pool_id, gpu_address, size);
         transfer_memory->release();
-        IOLog("VMMetalBridge: GPU memory mapping failed (0x%x) for buffer %u\n", mapping_result, buffer_id);
+        VMLOG_ERROR("VMMetalBridge: GPU memory mapping failed (0x%x) for buffer %u\n", mapping_result, buffer_id);
         g_gpu_memory_sync_stats.failed_transfers++;
         return mapping_result;
     }
@@ -2311,7 +2323,7 @@ IOReturn CLASS::performAdvancedGPUMemorySynchronization(uint32_t buffer_id, cons
     VMGPUMemoryTransfer* transfer_record = allocateTransferRecord();
     if (!transfer_record) {
         // Continue without tracking if registry is full
-        IOLog("VMMetalBridge: Warning - transfer registry full, continuing without tracking\n");
+        VMLOG_WARN("VMMetalBridge: Warning - transfer registry full, continuing without tracking\n");
     } else {
         // Initialize transfer record with comprehensive metadata
         transfer_record->transfer_id = g_gpu_memory_sync_stats.total_transfers + 1;
@@ -2336,7 +2348,7 @@ IOReturn CLASS::performAdvancedGPUMemorySynchronization(uint32_t buffer_id, cons
     // 3.1: Perform memory coherency analysis and validation
     IOReturn coherency_result = validateMemoryCoherency(buffer_id, gpu_address, size, target_pool);
     if (coherency_result != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: Memory coherency validation failed (0x%x)\n", coherency_result);
+        VMLOG_ERROR("VMMetalBridge: Memory coherency validation failed (0x%x)\n", coherency_result);
         g_gpu_memory_sync_stats.coherency_violations++;
         // Continue with synchronization but log the violation
     }
@@ -2353,7 +2365,7 @@ IOReturn CLASS::performAdvancedGPUMemorySynchronization(uint32_t buffer_id, cons
     IOReturn pipeline_result = coordinateWithGPUPipeline(buffer_id, gpu_address, size, 
                                                         transfer_record ? transfer_record->transfer_priority : 1);
     if (pipeline_result != kIOReturnSuccess) {
-        IOLog("VMMetalBridge: GPU pipeline coordination warning (0x%x)\n", pipeline_result);
+        VMLOG_WARN("VMMetalBridge: GPU pipeline coordination warning (0x%x)\n", pipeline_result);
         g_gpu_memory_sync_stats.dma_pipeline_stalls++;
     }
     
@@ -2365,7 +2377,7 @@ IOReturn CLASS::performAdvancedGPUMemorySynchronization(uint32_t buffer_id, cons
         if (transfer_record) {
             transfer_record->completion_time = mach_absolute_time();
         }
-        IOLog("VMMetalBridge: GPU command execution failed (0x%x)\n", execute_result);
+        VMLOG_ERROR("VMMetalBridge: GPU command execution failed (0x%x)\n", execute_result);
         g_gpu_memory_sync_stats.failed_transfers++;
         return execute_result;
     }
@@ -2428,16 +2440,16 @@ IOReturn CLASS::performAdvancedGPUMemorySynchronization(uint32_t buffer_id, cons
     transfer_memory->release();
     
     // 6.4: Comprehensive success logging with full analytics
-    IOLog("VMMetalBridge: Successfully synchronized GPU memory for buffer %u:\n", buffer_id);
-    IOLog("  - GPU Address: 0x%llx, Size: %u bytes, Pool: %u ('%s')\n", 
+    VMLOG_DEBUG("VMMetalBridge: Successfully synchronized GPU memory for buffer %u:\n", buffer_id);
+    VMLOG_DEBUG("  - GPU Address: 0x%llx, Size: %u bytes, Pool: %u ('%s')\n", 
           gpu_address, size, selected_pool_id, target_pool->pool_name);
-    IOLog("  - Transfer Time: %llu ns, Rate: %llu MB/s\n", 
+    VMLOG_DEBUG("  - Transfer Time: %llu ns, Rate: %llu MB/s\n", 
           transfer_duration, transfer_duration > 0 ? (size * 1000000000ULL) / (transfer_duration * 1024 * 1024) : 0);
-    IOLog("  - Coherent: %s, Batched: %s, Priority: %u\n", 
+    VMLOG_DEBUG("  - Coherent: %s, Batched: %s, Priority: %u\n", 
           target_pool->is_coherent_pool ? "yes" : "no",
           (transfer_record && transfer_record->is_batched) ? "yes" : "no",
           transfer_record ? transfer_record->transfer_priority : 1);
-    IOLog("  - Total Transfers: %u, Success Rate: %u%%\n", 
+    VMLOG_DEBUG("  - Total Transfers: %u, Success Rate: %u%%\n", 
           g_gpu_memory_sync_stats.total_transfers,
           g_gpu_memory_sync_stats.total_transfers > 0 ? 
           (g_gpu_memory_sync_stats.successful_transfers * 100) / g_gpu_memory_sync_stats.total_transfers : 0);
@@ -2488,7 +2500,7 @@ IOReturn CLASS::initializeGPUMemoryPools()
         
         g_gpu_memory_pool_count++;
         
-        IOLog("VMMetalBridge: Initialized GPU memory pool %u: '%s' (%llu MB, coherent: %s, DMA: %s)\n",
+        VMLOG_INFO("VMMetalBridge: Initialized GPU memory pool %u: '%s' (%llu MB, coherent: %s, DMA: %s)\n",
               pool->pool_id, pool->pool_name, pool->pool_size / (1024 * 1024),
               pool->is_coherent_pool ? "yes" : "no", pool->supports_dma ? "yes" : "no");
     }
@@ -2498,7 +2510,7 @@ IOReturn CLASS::initializeGPUMemoryPools()
     g_normal_priority_transfers = OSArray::withCapacity(128);
     g_background_transfers = OSArray::withCapacity(64);
     
-    IOLog("VMMetalBridge: Initialized %u GPU memory pools with %llu MB total capacity\n", 
+    VMLOG_INFO("VMMetalBridge: Initialized %u GPU memory pools with %llu MB total capacity\n", 
           g_gpu_memory_pool_count, getTotalGPUMemoryCapacity() / (1024 * 1024));
     
     return kIOReturnSuccess;
@@ -2584,7 +2596,7 @@ IOReturn CLASS::expandGPUMemoryPool(uint32_t pool_id, uint32_t required_size)
     pool->pool_size += expansion_size;
     pool->available_size += expansion_size;
     
-    IOLog("VMMetalBridge: Expanded GPU memory pool %u ('%s') by %llu MB to %llu MB\n",
+    VMLOG_DEBUG("VMMetalBridge: Expanded GPU memory pool %u ('%s') by %llu MB to %llu MB\n",
           pool_id, pool->pool_name, expansion_size / (1024 * 1024), pool->pool_size / (1024 * 1024));
     
     return kIOReturnSuccess;
@@ -2625,7 +2637,7 @@ uint64_t CLASS::allocateGPUMemoryInPool(uint32_t pool_id, uint32_t size, uint32_
     // Align the address
     gpu_address = (gpu_address + alignment - 1) & ~((uint64_t)alignment - 1);
     
-    IOLog("VMMetalBridge: Allocated GPU memory at 0x%llx (%u bytes) in pool %u for buffer %u\n",
+    VMLOG_DEBUG("VMMetalBridge: Allocated GPU memory at 0x%llx (%u bytes) in pool %u for buffer %u\n",
           gpu_address, aligned_size, pool_id, buffer_id);
     
     return gpu_address;
@@ -2648,7 +2660,7 @@ void CLASS::deallocateGPUMemoryInPool(uint32_t pool_id, uint64_t gpu_address, ui
     pool->available_size += aligned_size;
     pool->allocation_count--;
     
-    IOLog("VMMetalBridge: Deallocated GPU memory at 0x%llx (%u bytes) from pool %u\n",
+    VMLOG_DEBUG("VMMetalBridge: Deallocated GPU memory at 0x%llx (%u bytes) from pool %u\n",
           gpu_address, aligned_size, pool_id);
 }
 
@@ -2780,7 +2792,7 @@ void CLASS::applyCoherencyOptimizations(uint32_t buffer_id, uint64_t gpu_address
     // 2. Optimize cache line usage
     // 3. Configure GPU memory attributes
     
-    IOLog("VMMetalBridge: Applied coherency optimizations for buffer %u (0x%llx, %u bytes)\n",
+    VMLOG_DEBUG("VMMetalBridge: Applied coherency optimizations for buffer %u (0x%llx, %u bytes)\n",
           buffer_id, gpu_address, size);
 }
 
@@ -2882,74 +2894,74 @@ uint64_t CLASS::getTotalGPUMemoryCapacity()
 // Generate comprehensive GPU memory synchronization report
 void CLASS::generateGPUMemorySyncReport()
 {
-    IOLog("VMMetalBridge: === Advanced GPU Memory Synchronization and DMA Management System v7.0 Report ===\n");
+    VMLOG_INFO("VMMetalBridge: === Advanced GPU Memory Synchronization and DMA Management System v7.0 Report ===\n");
     
     // Transfer statistics
-    IOLog("  Transfer Statistics:\n");
-    IOLog("    - Total Transfers: %u\n", g_gpu_memory_sync_stats.total_transfers);
-    IOLog("    - Successful: %u (%u%%)\n", g_gpu_memory_sync_stats.successful_transfers,
+    VMLOG_INFO("  Transfer Statistics:\n");
+    VMLOG_INFO("    - Total Transfers: %u\n", g_gpu_memory_sync_stats.total_transfers);
+    VMLOG_INFO("    - Successful: %u (%u%%)\n", g_gpu_memory_sync_stats.successful_transfers,
           g_gpu_memory_sync_stats.total_transfers > 0 ? 
           (g_gpu_memory_sync_stats.successful_transfers * 100) / g_gpu_memory_sync_stats.total_transfers : 0);
-    IOLog("    - Failed: %u (%u%%)\n", g_gpu_memory_sync_stats.failed_transfers,
+    VMLOG_INFO("    - Failed: %u (%u%%)\n", g_gpu_memory_sync_stats.failed_transfers,
           g_gpu_memory_sync_stats.total_transfers > 0 ? 
           (g_gpu_memory_sync_stats.failed_transfers * 100) / g_gpu_memory_sync_stats.total_transfers : 0);
-    IOLog("    - Batched: %u (%u%%)\n", g_gpu_memory_sync_stats.batched_transfers,
+    VMLOG_INFO("    - Batched: %u (%u%%)\n", g_gpu_memory_sync_stats.batched_transfers,
           g_gpu_memory_sync_stats.total_transfers > 0 ? 
           (g_gpu_memory_sync_stats.batched_transfers * 100) / g_gpu_memory_sync_stats.total_transfers : 0);
     
     // Performance metrics
-    IOLog("  Performance Metrics:\n");
-    IOLog("    - Total Bytes Transferred: %llu MB\n", g_gpu_memory_sync_stats.total_bytes_transferred / (1024 * 1024));
-    IOLog("    - Average Transfer Time: %llu ns\n", g_gpu_memory_sync_stats.average_transfer_time_ns);
-    IOLog("    - Peak Transfer Rate: %llu MB/s\n", g_gpu_memory_sync_stats.peak_transfer_rate_mbps);
+    VMLOG_INFO("  Performance Metrics:\n");
+    VMLOG_INFO("    - Total Bytes Transferred: %llu MB\n", g_gpu_memory_sync_stats.total_bytes_transferred / (1024 * 1024));
+    VMLOG_INFO("    - Average Transfer Time: %llu ns\n", g_gpu_memory_sync_stats.average_transfer_time_ns);
+    VMLOG_INFO("    - Peak Transfer Rate: %llu MB/s\n", g_gpu_memory_sync_stats.peak_transfer_rate_mbps);
     
     // Pool utilization analysis
-    IOLog("  GPU Memory Pool Utilization:\n");
+    VMLOG_INFO("  GPU Memory Pool Utilization:\n");
     for (uint32_t i = 0; i < g_gpu_memory_pool_count; i++) {
         VMGPUMemoryPool* pool = &g_gpu_memory_pools[i];
         uint32_t utilization = pool->pool_size > 0 ? (uint32_t)((pool->allocated_size * 100) / pool->pool_size) : 0;
         
-        IOLog("    - Pool %u ('%s'): %llu/%llu MB (%u%%), Allocs: %u, Frag: %u%%, Pattern: %u\n",
+        VMLOG_INFO("    - Pool %u ('%s'): %llu/%llu MB (%u%%), Allocs: %u, Frag: %u%%, Pattern: %u\n",
               i, pool->pool_name, pool->allocated_size / (1024 * 1024), 
               pool->pool_size / (1024 * 1024), utilization,
               pool->allocation_count, pool->fragmentation_level, pool->access_pattern);
     }
     
     // System health metrics
-    IOLog("  System Health:\n");
-    IOLog("    - Coherency Violations: %u\n", g_gpu_memory_sync_stats.coherency_violations);
-    IOLog("    - Sync Optimizations Applied: %u\n", g_gpu_memory_sync_stats.sync_optimizations);
-    IOLog("    - DMA Pipeline Stalls: %u\n", g_gpu_memory_sync_stats.dma_pipeline_stalls);
-    IOLog("    - Memory Pool Overflows: %u\n", g_gpu_memory_sync_stats.memory_pool_overflows);
-    IOLog("    - Transfer Registry Usage: %u/128 entries\n", g_gpu_memory_transfer_count);
-    IOLog("    - Coherency Cache Usage: %u/64 entries\n", g_coherency_cache_size);
+    VMLOG_INFO("  System Health:\n");
+    VMLOG_INFO("    - Coherency Violations: %u\n", g_gpu_memory_sync_stats.coherency_violations);
+    VMLOG_INFO("    - Sync Optimizations Applied: %u\n", g_gpu_memory_sync_stats.sync_optimizations);
+    VMLOG_INFO("    - DMA Pipeline Stalls: %u\n", g_gpu_memory_sync_stats.dma_pipeline_stalls);
+    VMLOG_INFO("    - Memory Pool Overflows: %u\n", g_gpu_memory_sync_stats.memory_pool_overflows);
+    VMLOG_INFO("    - Transfer Registry Usage: %u/128 entries\n", g_gpu_memory_transfer_count);
+    VMLOG_INFO("    - Coherency Cache Usage: %u/64 entries\n", g_coherency_cache_size);
     
     // Transfer queue analysis
     uint32_t high_priority_count = g_high_priority_transfers ? g_high_priority_transfers->getCount() : 0;
     uint32_t normal_priority_count = g_normal_priority_transfers ? g_normal_priority_transfers->getCount() : 0;
     uint32_t background_count = g_background_transfers ? g_background_transfers->getCount() : 0;
     
-    IOLog("  Transfer Scheduling:\n");
-    IOLog("    - High Priority Queue: %u transfers\n", high_priority_count);
-    IOLog("    - Normal Priority Queue: %u transfers\n", normal_priority_count);
-    IOLog("    - Background Queue: %u transfers\n", background_count);
+    VMLOG_INFO("  Transfer Scheduling:\n");
+    VMLOG_INFO("    - High Priority Queue: %u transfers\n", high_priority_count);
+    VMLOG_INFO("    - Normal Priority Queue: %u transfers\n", normal_priority_count);
+    VMLOG_INFO("    - Background Queue: %u transfers\n", background_count);
     
     // Performance recommendations
-    IOLog("  System Recommendations:\n");
+    VMLOG_INFO("  System Recommendations:\n");
     
     uint32_t success_rate = g_gpu_memory_sync_stats.total_transfers > 0 ? 
                            (g_gpu_memory_sync_stats.successful_transfers * 100) / g_gpu_memory_sync_stats.total_transfers : 100;
     
     if (success_rate < 95) {
-        IOLog("    - High failure rate detected - check GPU memory pool configuration\n");
+        VMLOG_WARN("    - High failure rate detected - check GPU memory pool configuration\n");
     }
     
     if (g_gpu_memory_sync_stats.coherency_violations > 10) {
-        IOLog("    - Multiple coherency violations - consider enabling more coherent pools\n");
+        VMLOG_INFO("    - Multiple coherency violations - consider enabling more coherent pools\n");
     }
     
     if (g_gpu_memory_sync_stats.dma_pipeline_stalls > 5) {
-        IOLog("    - DMA pipeline stalls detected - consider transfer size optimization\n");
+        VMLOG_INFO("    - DMA pipeline stalls detected - consider transfer size optimization\n");
     }
     
     uint64_t total_capacity = getTotalGPUMemoryCapacity();
@@ -2959,14 +2971,14 @@ void CLASS::generateGPUMemorySyncReport()
     }
     
     if (total_capacity > 0 && (total_allocated * 100) / total_capacity > 80) {
-        IOLog("    - High GPU memory usage - consider expanding memory pools\n");
+        VMLOG_INFO("    - High GPU memory usage - consider expanding memory pools\n");
     }
     
     if (g_gpu_memory_sync_stats.average_transfer_time_ns > 50000) { // 50 microseconds
-        IOLog("    - High average transfer time - consider batching optimization\n");
+        VMLOG_INFO("    - High average transfer time - consider batching optimization\n");
     }
     
-    IOLog("  === End of GPU Memory Synchronization System Report ===\n");
+    VMLOG_INFO("  === End of GPU Memory Synchronization System Report ===\n");
 }
 
 bool CLASS::detectAppleSilicon()
@@ -2979,10 +2991,10 @@ bool CLASS::detectAppleSilicon()
     if (sysctlbyname("machdep.cpu.brand_string", cpu_brand, &brand_size, NULL, 0) == 0) {
         // Check if it contains "Apple" which indicates Apple Silicon
         if (strncmp(cpu_brand, "Apple", 5) == 0) {
-            IOLog("VMMetalBridge: Detected Apple Silicon CPU: %s\n", cpu_brand);
+            VMLOG_INFO("VMMetalBridge: Detected Apple Silicon CPU: %s\n", cpu_brand);
             return true;
         }
-        IOLog("VMMetalBridge: Detected Intel/AMD CPU: %s\n", cpu_brand);
+        VMLOG_INFO("VMMetalBridge: Detected Intel/AMD CPU: %s\n", cpu_brand);
         return false;
     }
     
@@ -2992,12 +3004,12 @@ bool CLASS::detectAppleSilicon()
     if (sysctlbyname("hw.cputype", &cpu_type, &cpu_type_size, NULL, 0) == 0) {
         // CPU_TYPE_ARM64 = 0x0100000C (on Apple Silicon)
         if (cpu_type == 0x0100000C) {
-            IOLog("VMMetalBridge: Detected ARM64 architecture (Apple Silicon)\n");
+            VMLOG_INFO("VMMetalBridge: Detected ARM64 architecture (Apple Silicon)\n");
             return true;
         }
     }
     
-    IOLog("VMMetalBridge: Could not detect Apple Silicon, assuming Intel/AMD\n");
+    VMLOG_WARN("VMMetalBridge: Could not detect Apple Silicon, assuming Intel/AMD\n");
     return false;
 }
 
@@ -3014,13 +3026,13 @@ bool CLASS::detectModernDiscreteGPU()
         bool supports_resource_blob = m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_RESOURCE_BLOB);
         
         if (supports_advanced_3d && supports_resource_blob) {
-            IOLog("VMMetalBridge: Detected advanced VirtIO GPU capabilities (may indicate modern host GPU)\n");
+            VMLOG_INFO("VMMetalBridge: Detected advanced VirtIO GPU capabilities (may indicate modern host GPU)\n");
             return true;
         }
     }
     
     // For VM environments, we're conservative about discrete GPU detection
-    IOLog("VMMetalBridge: No modern discrete GPU detected in VM environment\n");
+    VMLOG_INFO("VMMetalBridge: No modern discrete GPU detected in VM environment\n");
     return false;
 }
 
@@ -3070,7 +3082,7 @@ uint32_t CLASS::getMacOSVersion()
                 // Convert Darwin version to packed format
                 uint32_t packed_version = (major << 16) | (minor << 8) | patch;
                 
-                IOLog("VMMetalBridge: Detected Darwin kernel version %d.%d.%d\n", 
+                VMLOG_INFO("VMMetalBridge: Detected Darwin kernel version %d.%d.%d\n", 
                       major, minor, patch);
                 
                 // Map Darwin versions to macOS capabilities:
@@ -3095,12 +3107,12 @@ uint32_t CLASS::getMacOSVersion()
         sysctlbyname("kern.version_minor", &version_minor, &size, NULL, 0);
         
         uint32_t packed_version = (version_major << 16) | (version_minor << 8);
-        IOLog("VMMetalBridge: Detected kernel version %d.%d via direct sysctl\n", 
+        VMLOG_INFO("VMMetalBridge: Detected kernel version %d.%d via direct sysctl\n", 
               version_major, version_minor);
         return packed_version;
     }
     
     // Ultimate fallback: assume Darwin 17 (macOS 10.13) - minimum for modern kexts
-    IOLog("VMMetalBridge: Could not detect version, assuming Darwin 17 (macOS 10.13)\n");
+    VMLOG_WARN("VMMetalBridge: Could not detect version, assuming Darwin 17 (macOS 10.13)\n");
     return 0x110000; // 17.0.0
 }
\ No newline at end of file
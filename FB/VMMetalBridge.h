@@ -7,6 +7,7 @@
 #include <libkern/c++/OSObject.h>
 #include <libkern/c++/OSArray.h>
 #include <libkern/c++/OSDictionary.h>
+#include "VMHandleTable.h"
 
 // Forward declarations
 class VMQemuVGAAccelerator;
@@ -227,8 +228,10 @@ private:
     OSArray* m_textures;
     OSArray* m_samplers;
     
-    // Resource tracking
-    uint32_t m_next_resource_id;
+    // Resource tracking: resource ids are handles tagged with their
+    // VMMetalResourceType; the table holds a reference on each object.
+    // m_resource_map keeps the named bookkeeping entries.
+    VMHandleTable<OSObject> m_resource_table;
     OSDictionary* m_resource_map;
     
     // Performance counters
@@ -376,8 +379,7 @@ public:
 private:
     // Internal helper methods
     OSObject* findResource(uint32_t resource_id, VMMetalResourceType expected_type);
-    uint32_t allocateResourceId();
-    void releaseResourceId(uint32_t resource_id);
+    uint32_t registerResource(OSObject* resource, VMMetalResourceType type);
     VMMetalPixelFormat translatePixelFormat(uint32_t vm_format);
     uint32_t translateVMPixelFormat(VMMetalPixelFormat metal_format);
     IOReturn validateDescriptor(const void* descriptor, size_t expected_size);
@@ -1,6 +1,7 @@
 #include "VMMetalPlugin.h"
 #include "VMQemuVGAAccelerator.h"
 #include "VMVirtIOGPU.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 #include <IOKit/IOBufferMemoryDescriptor.h>
 
@@ -52,7 +53,7 @@ void CLASS::free()
 
 bool CLASS::start(IOService* provider)
 {
-    IOLog("VMMetalPlugin::start - Initializing minimal Metal device\n");
+    VMLOG_INFO("VMMetalPlugin::start - Initializing minimal Metal device\n");
     
     if (!super::start(provider))
         return false;
@@ -61,14 +62,14 @@ bool CLASS::start(IOService* provider)
     // Check VirtIO FIRST since it inherits from VMQemuVGAAccelerator
     VMVirtIOGPUAccelerator* virtioAccel = OSDynamicCast(VMVirtIOGPUAccelerator, provider);
     if (virtioAccel) {
-        IOLog("VMMetalPlugin: Provider is VMVirtIOGPUAccelerator (VirtIO GPU)\n");
+        VMLOG_INFO("VMMetalPlugin: Provider is VMVirtIOGPUAccelerator (VirtIO GPU)\n");
         m_accelerator = virtioAccel;
     } else {
         m_accelerator = OSDynamicCast(VMQemuVGAAccelerator, provider);
         if (m_accelerator) {
-            IOLog("VMMetalPlugin: Provider is VMQemuVGAAccelerator (QXL)\n");
+            VMLOG_INFO("VMMetalPlugin: Provider is VMQemuVGAAccelerator (QXL)\n");
         } else {
-            IOLog("VMMetalPlugin: Provider is not a valid accelerator\n");
+            VMLOG_INFO("VMMetalPlugin: Provider is not a valid accelerator\n");
             return false;
         }
     }
@@ -94,19 +95,19 @@ bool CLASS::start(IOService* provider)
     
     logDeviceCapabilities();
     
-    IOLog("VMMetalPlugin: Started successfully - Metal device ready\n");
+    VMLOG_INFO("VMMetalPlugin: Started successfully - Metal device ready\n");
     return true;
 }
 
 void CLASS::stop(IOService* provider)
 {
-    IOLog("VMMetalPlugin::stop\n");
+    VMLOG_INFO("VMMetalPlugin::stop\n");
     super::stop(provider);
 }
 
 void* CLASS::createMetalDevice()
 {
-    IOLog("VMMetalPlugin::createMetalDevice - Creating pseudo-Metal device\n");
+    VMLOG_INFO("VMMetalPlugin::createMetalDevice - Creating pseudo-Metal device\n");
     
     // CRITICAL: Return a valid pointer (self) instead of NULL
     // This prevents WindowServer from calling abort()
@@ -115,10 +116,10 @@ void* CLASS::createMetalDevice()
     // WindowServer just needs a non-NULL pointer to proceed
     void* device_ptr = (void*)this;
     
-    IOLog("VMMetalPlugin: Metal device created successfully at %p\n", device_ptr);
-    IOLog("VMMetalPlugin: Device name: %s\n", getDeviceName());
-    IOLog("VMMetalPlugin: Feature set: 0x%x\n", m_feature_set);
-    IOLog("VMMetalPlugin: Registry ID: 0x%llx\n", getRegistryID());
+    VMLOG_INFO("VMMetalPlugin: Metal device created successfully at %p\n", device_ptr);
+    VMLOG_INFO("VMMetalPlugin: Device name: %s\n", getDeviceName());
+    VMLOG_INFO("VMMetalPlugin: Feature set: 0x%x\n", m_feature_set);
+    VMLOG_INFO("VMMetalPlugin: Registry ID: 0x%llx\n", getRegistryID());
     
     return device_ptr;
 }
@@ -183,7 +184,7 @@ uint32_t CLASS::maxThreadsPerThreadgroup()
 
 void* CLASS::newCommandQueue()
 {
-    IOLog("VMMetalPlugin::newCommandQueue\n");
+    VMLOG_DEBUG("VMMetalPlugin::newCommandQueue\n");
     
     VMMetalCommandQueue* queue = (VMMetalCommandQueue*)IOMalloc(sizeof(VMMetalCommandQueue));
     if (!queue)
@@ -197,13 +198,13 @@ void* CLASS::newCommandQueue()
     
     m_command_queues->setObject((OSObject*)queue);
     
-    IOLog("VMMetalPlugin: Command queue %d created\n", queue->queue_id);
+    VMLOG_DEBUG("VMMetalPlugin: Command queue %d created\n", queue->queue_id);
     return (void*)queue;
 }
 
 void* CLASS::newBuffer(uint64_t length, uint32_t options)
 {
-    IOLog("VMMetalPlugin::newBuffer - length: %llu, options: 0x%x\n", length, options);
+    VMLOG_DEBUG("VMMetalPlugin::newBuffer - length: %llu, options: 0x%x\n", length, options);
     
     VMMetalBuffer* buffer = (VMMetalBuffer*)IOMalloc(sizeof(VMMetalBuffer));
     if (!buffer)
@@ -224,13 +225,13 @@ void* CLASS::newBuffer(uint64_t length, uint32_t options)
     m_buffers->setObject((OSObject*)buffer);
     m_allocated_memory += length;
     
-    IOLog("VMMetalPlugin: Buffer %d created (%llu bytes)\n", buffer->buffer_id, length);
+    VMLOG_DEBUG("VMMetalPlugin: Buffer %d created (%llu bytes)\n", buffer->buffer_id, length);
     return (void*)buffer;
 }
 
 void* CLASS::newTexture(void* descriptor)
 {
-    IOLog("VMMetalPlugin::newTexture\n");
+    VMLOG_DEBUG("VMMetalPlugin::newTexture\n");
     
     if (!descriptor)
         return nullptr;
@@ -262,7 +263,7 @@ void* CLASS::newTexture(void* descriptor)
     m_textures->setObject((OSObject*)texture);
     m_allocated_memory += texture_size;
     
-    IOLog("VMMetalPlugin: Texture %d created (%dx%d)\n", 
+    VMLOG_DEBUG("VMMetalPlugin: Texture %d created (%dx%d)\n", 
           texture->texture_id, texture->width, texture->height);
     return (void*)texture;
 }
@@ -332,16 +333,16 @@ void CLASS::updateMemoryStatistics()
 
 void CLASS::logDeviceCapabilities()
 {
-    IOLog("VMMetalPlugin Device Capabilities:\n");
-    IOLog("  Device Name: %s\n", getDeviceName());
-    IOLog("  Registry ID: 0x%llx\n", getRegistryID());
-    IOLog("  Feature Set: 0x%x (GPU Family 1 v1)\n", m_feature_set);
-    IOLog("  Max Texture Size: %dx%d\n", m_max_texture_width, m_max_texture_height);
-    IOLog("  Max Threads Per Threadgroup: %d\n", m_max_threads_per_threadgroup);
-    IOLog("  Unified Memory: %s\n", m_supports_unified_memory ? "Yes" : "No");
-    IOLog("  Shader Debugging: %s\n", m_supports_shader_debugging ? "Yes" : "No");
-    IOLog("  Recommended Max Working Set: %llu MB\n", m_recommended_max_working_set_size / (1024 * 1024));
-    IOLog("  Is Removable: %s\n", isRemovable() ? "Yes" : "No");
-    IOLog("  Is Headless: %s\n", isHeadless() ? "Yes" : "No");
-    IOLog("  Is Low Power: %s\n", isLowPower() ? "Yes" : "No");
+    VMLOG_INFO("VMMetalPlugin Device Capabilities:\n");
+    VMLOG_INFO("  Device Name: %s\n", getDeviceName());
+    VMLOG_INFO("  Registry ID: 0x%llx\n", getRegistryID());
+    VMLOG_INFO("  Feature Set: 0x%x (GPU Family 1 v1)\n", m_feature_set);
+    VMLOG_INFO("  Max Texture Size: %dx%d\n", m_max_texture_width, m_max_texture_height);
+    VMLOG_INFO("  Max Threads Per Threadgroup: %d\n", m_max_threads_per_threadgroup);
+    VMLOG_INFO("  Unified Memory: %s\n", m_supports_unified_memory ? "Yes" : "No");
+    VMLOG_INFO("  Shader Debugging: %s\n", m_supports_shader_debugging ? "Yes" : "No");
+    VMLOG_INFO("  Recommended Max Working Set: %llu MB\n", m_recommended_max_working_set_size / (1024 * 1024));
+    VMLOG_INFO("  Is Removable: %s\n", isRemovable() ? "Yes" : "No");
+    VMLOG_INFO("  Is Headless: %s\n", isHeadless() ? "Yes" : "No");
+    VMLOG_INFO("  Is Low Power: %s\n", isLowPower() ? "Yes" : "No");
 }
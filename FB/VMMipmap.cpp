@@ -0,0 +1,473 @@
+#include "VMMipmap.h"
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VMMIPMAP_HAVE_SIMD 1
+#include <immintrin.h>
+#else
+#define VMMIPMAP_HAVE_SIMD 0
+#endif
+
+// One destination row from source rows s0 and s1; `count` texels, each
+// reading two whole source texels from both rows
+typedef void (*VMMipmapRowFn)(uint8_t* d, const uint8_t* s0, const uint8_t* s1, uint32_t count);
+
+static VMMipmapRowFn s_row_linear[5];   // indexed by channel count
+static VMMipmapRowFn s_row_srgb[5];
+static VMBlit2DPath  s_active_path = kVMBlit2DPathScalar;
+static bool          s_initialized = false;
+
+#pragma mark - sRGB tables
+
+// round(65535 * decode(s / 255)). The spare last entry keeps an AVX2
+// gather of entry 255, which reads four bytes, inside the table.
+static const uint16_t s_srgb_to_linear[257] = {
+        0,    20,    40,    60,    80,    99,   119,   139,   159,   179,   199,   219,
+      241,   264,   288,   313,   340,   367,   396,   427,   458,   491,   526,   562,
+      599,   637,   677,   718,   761,   805,   851,   898,   947,   997,  1048,  1101,
+     1156,  1212,  1270,  1330,  1391,  1453,  1517,  1583,  1651,  1720,  1790,  1863,
+     1937,  2013,  2090,  2170,  2250,  2333,  2418,  2504,  2592,  2681,  2773,  2866,
+     2961,  3058,  3157,  3258,  3360,  3464,  3570,  3678,  3788,  3900,  4014,  4129,
+     4247,  4366,  4488,  4611,  4736,  4864,  4993,  5124,  5257,  5392,  5530,  5669,
+     5810,  5953,  6099,  6246,  6395,  6547,  6700,  6856,  7014,  7174,  7335,  7500,
+     7666,  7834,  8004,  8177,  8352,  8528,  8708,  8889,  9072,  9258,  9445,  9635,
+     9828, 10022, 10219, 10417, 10619, 10822, 11028, 11235, 11446, 11658, 11873, 12090,
+    12309, 12530, 12754, 12980, 13209, 13440, 13673, 13909, 14146, 14387, 14629, 14874,
+    15122, 15371, 15623, 15878, 16135, 16394, 16656, 16920, 17187, 17456, 17727, 18001,
+    18277, 18556, 18837, 19121, 19407, 19696, 19987, 20281, 20577, 20876, 21177, 21481,
+    21787, 22096, 22407, 22721, 23038, 23357, 23678, 24002, 24329, 24658, 24990, 25325,
+    25662, 26001, 26344, 26688, 27036, 27386, 27739, 28094, 28452, 28813, 29176, 29542,
+    29911, 30282, 30656, 31033, 31412, 31794, 32179, 32567, 32957, 33350, 33745, 34143,
+    34544, 34948, 35355, 35764, 36176, 36591, 37008, 37429, 37852, 38278, 38706, 39138,
+    39572, 40009, 40449, 40891, 41337, 41785, 42236, 42690, 43147, 43606, 44069, 44534,
+    45002, 45473, 45947, 46423, 46903, 47385, 47871, 48359, 48850, 49344, 49841, 50341,
+    50844, 51349, 51858, 52369, 52884, 53401, 53921, 54445, 54971, 55500, 56032, 56567,
+    57105, 57646, 58190, 58737, 59287, 59840, 60396, 60955, 61517, 62082, 62650, 63221,
+    63795, 64372, 64952, 65535,     0
+};
+
+// Smallest 16-bit linear value that encodes to code k or above,
+// ceil(65535 * decode((k - 0.5) / 255)); entry 256 is out of reach
+static const uint32_t s_srgb_threshold[257] = {
+        0,    10,    30,    50,    70,    90,   110,   130,   150,   170,   189,   209,
+      230,   253,   276,   301,   327,   354,   382,   412,   443,   475,   509,   544,
+      580,   618,   657,   698,   740,   783,   828,   875,   923,   972,  1023,  1075,
+     1129,  1185,  1242,  1300,  1360,  1422,  1486,  1551,  1617,  1685,  1755,  1827,
+     1900,  1975,  2052,  2130,  2210,  2292,  2376,  2461,  2548,  2637,  2727,  2820,
+     2914,  3010,  3108,  3208,  3309,  3412,  3518,  3625,  3734,  3844,  3957,  4072,
+     4188,  4307,  4427,  4550,  4674,  4800,  4928,  5059,  5191,  5325,  5461,  5599,
+     5740,  5882,  6026,  6173,  6321,  6471,  6624,  6778,  6935,  7094,  7255,  7418,
+     7583,  7750,  7919,  8091,  8265,  8440,  8618,  8798,  8981,  9165,  9352,  9541,
+     9732,  9925, 10121, 10318, 10518, 10720, 10925, 11132, 11341, 11552, 11765, 11981,
+    12199, 12420, 12643, 12868, 13095, 13325, 13557, 13791, 14028, 14267, 14508, 14752,
+    14998, 15247, 15498, 15751, 16007, 16265, 16525, 16788, 17054, 17321, 17592, 17864,
+    18139, 18417, 18697, 18980, 19264, 19552, 19842, 20134, 20429, 20727, 21027, 21329,
+    21634, 21942, 22252, 22564, 22880, 23197, 23518, 23840, 24166, 24494, 24824, 25158,
+    25493, 25832, 26173, 26516, 26862, 27211, 27563, 27917, 28273, 28633, 28995, 29359,
+    29727, 30097, 30469, 30845, 31223, 31603, 31987, 32373, 32762, 33153, 33547, 33944,
+    34344, 34747, 35152, 35560, 35970, 36384, 36800, 37219, 37640, 38065, 38492, 38922,
+    39355, 39790, 40229, 40670, 41114, 41561, 42011, 42463, 42918, 43377, 43838, 44301,
+    44768, 45238, 45710, 46185, 46663, 47144, 47628, 48115, 48605, 49097, 49593, 50091,
+    50592, 51096, 51604, 52114, 52627, 53142, 53661, 54183, 54708, 55235, 55766, 56300,
+    56836, 57376, 57918, 58464, 59012, 59564, 60118, 60675, 61236, 61799, 62366, 62935,
+    63508, 64083, 64662, 65244, 0x7FFFFFFF
+};
+
+// Code of the last threshold at or below i << 4. Thresholds are at least
+// 19 apart, so one more can lie inside a 16-value bucket but never two;
+// encode_srgb checks for it. Built on first use, padded for the gather.
+static uint8_t s_linear_to_srgb[4096 + 4];
+
+static void build_tables()
+{
+    uint32_t code = 0;
+    for (uint32_t i = 0; i < 4096; i++) {
+        while (code < 255 && s_srgb_threshold[code + 1] <= (i << 4))
+            code++;
+        s_linear_to_srgb[i] = (uint8_t)code;
+    }
+}
+
+static inline uint8_t encode_srgb(uint32_t linear)
+{
+    uint32_t code = s_linear_to_srgb[linear >> 4];
+    if (linear >= s_srgb_threshold[code + 1])
+        code++;
+    return (uint8_t)code;
+}
+
+#pragma mark - Scalar kernels
+
+// `step` is the byte offset of the second source texel of a pair: the
+// texel size, or 0 for a source one texel wide. The scalar kernels also
+// finish the rows the vector kernels leave over.
+static inline void row_linear(uint8_t* d, const uint8_t* s0, const uint8_t* s1,
+                              uint32_t count, uint32_t ch, uint32_t step)
+{
+    for (uint32_t x = 0; x < count; x++) {
+        for (uint32_t c = 0; c < ch; c++) {
+            uint32_t sum = s0[c] + s0[step + c] + s1[c] + s1[step + c];
+            d[c] = (uint8_t)((sum + 2) >> 2);
+        }
+        d += ch;
+        s0 += 2 * ch;
+        s1 += 2 * ch;
+    }
+}
+
+// Four channels are RGBA or BGRA: the last one is alpha, which is
+// averaged as stored
+static inline void row_srgb(uint8_t* d, const uint8_t* s0, const uint8_t* s1,
+                            uint32_t count, uint32_t ch, uint32_t step)
+{
+    const uint32_t color = ch == 4 ? 3 : ch;
+    for (uint32_t x = 0; x < count; x++) {
+        for (uint32_t c = 0; c < color; c++) {
+            uint32_t sum = s_srgb_to_linear[s0[c]] + s_srgb_to_linear[s0[step + c]] +
+                           s_srgb_to_linear[s1[c]] + s_srgb_to_linear[s1[step + c]];
+            d[c] = encode_srgb((sum + 2) >> 2);
+        }
+        if (ch == 4) {
+            uint32_t sum = s0[3] + s0[step + 3] + s1[3] + s1[step + 3];
+            d[3] = (uint8_t)((sum + 2) >> 2);
+        }
+        d += ch;
+        s0 += 2 * ch;
+        s1 += 2 * ch;
+    }
+}
+
+static void row1_linear_scalar(uint8_t* d, const uint8_t* s0, const uint8_t* s1, uint32_t count)
+{
+    row_linear(d, s0, s1, count, 1, 1);
+}
+
+static void row2_linear_scalar(uint8_t* d, const uint8_t* s0, const uint8_t* s1, uint32_t count)
+{
+    row_linear(d, s0, s1, count, 2, 2);
+}
+
+static void row4_linear_scalar(uint8_t* d, const uint8_t* s0, const uint8_t* s1, uint32_t count)
+{
+    row_linear(d, s0, s1, count, 4, 4);
+}
+
+static void row1_srgb_scalar(uint8_t* d, const uint8_t* s0, const uint8_t* s1, uint32_t count)
+{
+    row_srgb(d, s0, s1, count, 1, 1);
+}
+
+static void row2_srgb_scalar(uint8_t* d, const uint8_t* s0, const uint8_t* s1, uint32_t count)
+{
+    row_srgb(d, s0, s1, count, 2, 2);
+}
+
+static void row4_srgb_scalar(uint8_t* d, const uint8_t* s0, const uint8_t* s1, uint32_t count)
+{
+    row_srgb(d, s0, s1, count, 4, 4);
+}
+
+#if VMMIPMAP_HAVE_SIMD
+
+#pragma mark - SSE2 kernels
+
+// Sums stay in 16-bit lanes: four bytes add up to at most 1020. Each
+// helper reduces one 16-byte block of each source row to the 16-bit sums
+// of the destination texels it covers, in texel order.
+
+// R8: 16 source texels, 8 sums
+__attribute__((target("sse2")))
+static inline __m128i sums1_sse2(__m128i a, __m128i b)
+{
+    const __m128i lo8 = _mm_set1_epi16(0x00FF);
+    __m128i ha = _mm_add_epi16(_mm_and_si128(a, lo8), _mm_srli_epi16(a, 8));
+    __m128i hb = _mm_add_epi16(_mm_and_si128(b, lo8), _mm_srli_epi16(b, 8));
+    return _mm_add_epi16(ha, hb);
+}
+
+// RG8: 8 source texels, 4 texels of R,G sums
+__attribute__((target("sse2")))
+static inline __m128i pairs2_sse2(__m128i v)
+{
+    const __m128i lo8 = _mm_set1_epi16(0x00FF);
+    const __m128i lo16 = _mm_set1_epi32(0x0000FFFF);
+    __m128i r = _mm_and_si128(v, lo8);
+    __m128i g = _mm_srli_epi16(v, 8);
+    __m128i rs = _mm_add_epi32(_mm_and_si128(r, lo16), _mm_srli_epi32(r, 16));
+    __m128i gs = _mm_add_epi32(_mm_and_si128(g, lo16), _mm_srli_epi32(g, 16));
+    return _mm_or_si128(rs, _mm_slli_epi32(gs, 16));
+}
+
+__attribute__((target("sse2")))
+static inline __m128i sums2_sse2(__m128i a, __m128i b)
+{
+    return _mm_add_epi16(pairs2_sse2(a), pairs2_sse2(b));
+}
+
+// RGBA8: 4 source texels, 2 texels of channel sums
+__attribute__((target("sse2")))
+static inline __m128i sums4_sse2(__m128i a, __m128i b)
+{
+    const __m128i z = _mm_setzero_si128();
+    __m128i t01 = _mm_add_epi16(_mm_unpacklo_epi8(a, z), _mm_unpacklo_epi8(b, z));
+    __m128i t23 = _mm_add_epi16(_mm_unpackhi_epi8(a, z), _mm_unpackhi_epi8(b, z));
+    return _mm_add_epi16(_mm_unpacklo_epi64(t01, t23), _mm_unpackhi_epi64(t01, t23));
+}
+
+__attribute__((target("sse2")))
+static inline __m128i round_sse2(__m128i sums)
+{
+    return _mm_srli_epi16(_mm_add_epi16(sums, _mm_set1_epi16(2)), 2);
+}
+
+// Each iteration reads 32 bytes of both rows and writes 16
+#define VMMIPMAP_ROW_SSE2(name, ch, sums)                                       \
+__attribute__((target("sse2")))                                                 \
+static void name(uint8_t* d, const uint8_t* s0, const uint8_t* s1, uint32_t count) \
+{                                                                               \
+    const uint32_t per = 16 / (ch);                                             \
+    uint32_t x = 0;                                                             \
+    for (; x + per <= count; x += per) {                                        \
+        const uint8_t* a = s0 + x * 2 * (ch);                                   \
+        const uint8_t* b = s1 + x * 2 * (ch);                                   \
+        __m128i lo = sums(_mm_loadu_si128((const __m128i*)a),                   \
+                          _mm_loadu_si128((const __m128i*)b));                  \
+        __m128i hi = sums(_mm_loadu_si128((const __m128i*)(a + 16)),            \
+                          _mm_loadu_si128((const __m128i*)(b + 16)));           \
+        _mm_storeu_si128((__m128i*)(d + x * (ch)),                              \
+                         _mm_packus_epi16(round_sse2(lo), round_sse2(hi)));     \
+    }                                                                           \
+    row_linear(d + x * (ch), s0 + x * 2 * (ch), s1 + x * 2 * (ch),              \
+               count - x, ch, ch);                                              \
+}
+
+VMMIPMAP_ROW_SSE2(row1_linear_sse2, 1, sums1_sse2)
+VMMIPMAP_ROW_SSE2(row2_linear_sse2, 2, sums2_sse2)
+VMMIPMAP_ROW_SSE2(row4_linear_sse2, 4, sums4_sse2)
+
+#pragma mark - AVX2 kernels
+
+// The same reductions, independently in each 128-bit lane. Packing two
+// results interleaves their lanes as 64-bit quarters A0 B0 A1 B1, which
+// one permute puts back in order.
+
+__attribute__((target("avx2")))
+static inline __m256i sums1_avx2(__m256i a, __m256i b)
+{
+    const __m256i lo8 = _mm256_set1_epi16(0x00FF);
+    __m256i ha = _mm256_add_epi16(_mm256_and_si256(a, lo8), _mm256_srli_epi16(a, 8));
+    __m256i hb = _mm256_add_epi16(_mm256_and_si256(b, lo8), _mm256_srli_epi16(b, 8));
+    return _mm256_add_epi16(ha, hb);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i pairs2_avx2(__m256i v)
+{
+    const __m256i lo8 = _mm256_set1_epi16(0x00FF);
+    const __m256i lo16 = _mm256_set1_epi32(0x0000FFFF);
+    __m256i r = _mm256_and_si256(v, lo8);
+    __m256i g = _mm256_srli_epi16(v, 8);
+    __m256i rs = _mm256_add_epi32(_mm256_and_si256(r, lo16), _mm256_srli_epi32(r, 16));
+    __m256i gs = _mm256_add_epi32(_mm256_and_si256(g, lo16), _mm256_srli_epi32(g, 16));
+    return _mm256_or_si256(rs, _mm256_slli_epi32(gs, 16));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i sums2_avx2(__m256i a, __m256i b)
+{
+    return _mm256_add_epi16(pairs2_avx2(a), pairs2_avx2(b));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i sums4_avx2(__m256i a, __m256i b)
+{
+    const __m256i z = _mm256_setzero_si256();
+    __m256i t01 = _mm256_add_epi16(_mm256_unpacklo_epi8(a, z), _mm256_unpacklo_epi8(b, z));
+    __m256i t23 = _mm256_add_epi16(_mm256_unpackhi_epi8(a, z), _mm256_unpackhi_epi8(b, z));
+    return _mm256_add_epi16(_mm256_unpacklo_epi64(t01, t23), _mm256_unpackhi_epi64(t01, t23));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i round_avx2(__m256i sums)
+{
+    return _mm256_srli_epi16(_mm256_add_epi16(sums, _mm256_set1_epi16(2)), 2);
+}
+
+// Each iteration reads 64 bytes of both rows and writes 32
+#define VMMIPMAP_ROW_AVX2(name, ch, sums)                                       \
+__attribute__((target("avx2")))                                                 \
+static void name(uint8_t* d, const uint8_t* s0, const uint8_t* s1, uint32_t count) \
+{                                                                               \
+    const uint32_t per = 32 / (ch);                                             \
+    uint32_t x = 0;                                                             \
+    for (; x + per <= count; x += per) {                                        \
+        const uint8_t* a = s0 + x * 2 * (ch);                                   \
+        const uint8_t* b = s1 + x * 2 * (ch);                                   \
+        __m256i lo = sums(_mm256_loadu_si256((const __m256i*)a),                \
+                          _mm256_loadu_si256((const __m256i*)b));               \
+        __m256i hi = sums(_mm256_loadu_si256((const __m256i*)(a + 32)),         \
+                          _mm256_loadu_si256((const __m256i*)(b + 32)));        \
+        __m256i packed = _mm256_packus_epi16(round_avx2(lo), round_avx2(hi));   \
+        _mm256_storeu_si256((__m256i*)(d + x * (ch)),                           \
+                            _mm256_permute4x64_epi64(packed, 0xD8));            \
+    }                                                                           \
+    row_linear(d + x * (ch), s0 + x * 2 * (ch), s1 + x * 2 * (ch),              \
+               count - x, ch, ch);                                              \
+}
+
+VMMIPMAP_ROW_AVX2(row1_linear_avx2, 1, sums1_avx2)
+VMMIPMAP_ROW_AVX2(row2_linear_avx2, 2, sums2_avx2)
+VMMIPMAP_ROW_AVX2(row4_linear_avx2, 4, sums4_avx2)
+
+// sRGB RGBA8/BGRA8, two destination texels per iteration. Both table
+// lookups become gathers: decode from the 16-bit table (scale 2, masked),
+// encode from the bucket table plus one gather of the next threshold.
+__attribute__((target("avx2")))
+static void row4_srgb_avx2(uint8_t* d, const uint8_t* s0, const uint8_t* s1, uint32_t count)
+{
+    const int* decode = (const int*)(const void*)s_srgb_to_linear;
+    const int* bucket = (const int*)(const void*)s_linear_to_srgb;
+    const int* threshold = (const int*)(const void*)s_srgb_threshold;
+    const __m256i mask16 = _mm256_set1_epi32(0xFFFF);
+    const __m256i mask8 = _mm256_set1_epi32(0xFF);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i two = _mm256_set1_epi32(2);
+    const __m256i first_bytes = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                 0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    uint32_t x = 0;
+    for (; x + 2 <= count; x += 2) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(s0 + x * 8));
+        __m128i b = _mm_loadu_si128((const __m128i*)(s1 + x * 8));
+        __m256i ia01 = _mm256_cvtepu8_epi32(a);
+        __m256i ia23 = _mm256_cvtepu8_epi32(_mm_srli_si128(a, 8));
+        __m256i ib01 = _mm256_cvtepu8_epi32(b);
+        __m256i ib23 = _mm256_cvtepu8_epi32(_mm_srli_si128(b, 8));
+
+        // Lanes 3 and 7 are alpha and keep the stored value
+        __m256i la01 = _mm256_blend_epi32(_mm256_and_si256(_mm256_i32gather_epi32(decode, ia01, 2), mask16), ia01, 0x88);
+        __m256i la23 = _mm256_blend_epi32(_mm256_and_si256(_mm256_i32gather_epi32(decode, ia23, 2), mask16), ia23, 0x88);
+        __m256i lb01 = _mm256_blend_epi32(_mm256_and_si256(_mm256_i32gather_epi32(decode, ib01, 2), mask16), ib01, 0x88);
+        __m256i lb23 = _mm256_blend_epi32(_mm256_and_si256(_mm256_i32gather_epi32(decode, ib23, 2), mask16), ib23, 0x88);
+
+        // Column sums of texels 0,1 and 2,3, then texel 0 + 1 | 2 + 3
+        __m256i v01 = _mm256_add_epi32(la01, lb01);
+        __m256i v23 = _mm256_add_epi32(la23, lb23);
+        __m256i sum = _mm256_add_epi32(_mm256_permute2x128_si256(v01, v23, 0x20),
+                                       _mm256_permute2x128_si256(v01, v23, 0x31));
+        __m256i avg = _mm256_srli_epi32(_mm256_add_epi32(sum, two), 2);
+
+        __m256i code = _mm256_and_si256(_mm256_i32gather_epi32(bucket, _mm256_srli_epi32(avg, 4), 1), mask8);
+        __m256i next = _mm256_i32gather_epi32(threshold, _mm256_add_epi32(code, one), 4);
+        code = _mm256_add_epi32(code, _mm256_add_epi32(one, _mm256_cmpgt_epi32(next, avg)));
+        code = _mm256_blend_epi32(code, avg, 0x88);
+
+        __m256i packed = _mm256_shuffle_epi8(code, first_bytes);
+        uint32_t t0 = (uint32_t)_mm_cvtsi128_si32(_mm256_castsi256_si128(packed));
+        uint32_t t1 = (uint32_t)_mm_cvtsi128_si32(_mm256_extracti128_si256(packed, 1));
+        memcpy(d + x * 4, &t0, 4);
+        memcpy(d + x * 4 + 4, &t1, 4);
+    }
+    row_srgb(d + x * 4, s0 + x * 8, s1 + x * 8, count - x, 4, 4);
+}
+
+#endif /* VMMIPMAP_HAVE_SIMD */
+
+#pragma mark - Dispatch
+
+// sRGB has no SSE2 kernels: without gathers the table lookups are the
+// whole cost and the vector arithmetic around them buys nothing
+VMBlit2DPath VMMipmapSetPath(VMBlit2DPath path)
+{
+    VMBlit2DPath best = VMBlit2DBestPath();
+    if (path > best)
+        path = best;
+
+    build_tables();
+
+    s_row_srgb[1] = row1_srgb_scalar;
+    s_row_srgb[2] = row2_srgb_scalar;
+    s_row_srgb[4] = row4_srgb_scalar;
+
+    switch (path) {
+#if VMMIPMAP_HAVE_SIMD
+        case kVMBlit2DPathAVX2:
+            s_row_linear[1] = row1_linear_avx2;
+            s_row_linear[2] = row2_linear_avx2;
+            s_row_linear[4] = row4_linear_avx2;
+            s_row_srgb[4] = row4_srgb_avx2;
+            break;
+        case kVMBlit2DPathSSE2:
+            s_row_linear[1] = row1_linear_sse2;
+            s_row_linear[2] = row2_linear_sse2;
+            s_row_linear[4] = row4_linear_sse2;
+            break;
+#endif
+        default:
+            path = kVMBlit2DPathScalar;
+            s_row_linear[1] = row1_linear_scalar;
+            s_row_linear[2] = row2_linear_scalar;
+            s_row_linear[4] = row4_linear_scalar;
+            break;
+    }
+
+    s_active_path = path;
+    s_initialized = true;
+    return path;
+}
+
+VMBlit2DPath VMMipmapActivePath()
+{
+    if (!s_initialized)
+        VMMipmapSetPath(VMBlit2DBestPath());
+    return s_active_path;
+}
+
+uint16_t VMMipmapSRGBToLinear(uint8_t value)
+{
+    return s_srgb_to_linear[value];
+}
+
+uint8_t VMMipmapLinearToSRGB(uint32_t linear)
+{
+    if (!s_initialized)
+        VMMipmapSetPath(VMBlit2DBestPath());
+    return linear > 0xFFFF ? 255 : encode_srgb(linear);
+}
+
+#pragma mark - Image operations
+
+bool VMMipmapDownsample(const VMMipmapImage* dst, const VMMipmapImage* src,
+                        uint32_t channels, bool srgb)
+{
+    if (!dst || !src || !dst->base || !src->base)
+        return false;
+    if (channels != 1 && channels != 2 && channels != 4)
+        return false;
+    if (src->width == 0 || src->height == 0)
+        return false;
+    if (dst->width != VMMipmapNextSize(src->width) || dst->height != VMMipmapNextSize(src->height))
+        return false;
+    if (src->rowBytes < src->width * channels || dst->rowBytes < dst->width * channels)
+        return false;
+    if (!s_initialized)
+        VMMipmapSetPath(VMBlit2DBestPath());
+
+    VMMipmapRowFn row = srgb ? s_row_srgb[channels] : s_row_linear[channels];
+    VMBlit2DVectorState vector;
+    VMBlit2DVectorBegin(&vector);
+    for (uint32_t y = 0; y < dst->height; y++) {
+        const uint8_t* s0 = src->base + (size_t)(2 * y) * src->rowBytes;
+        const uint8_t* s1 = 2 * y + 1 < src->height ? s0 + src->rowBytes : s0;
+        uint8_t* d = dst->base + (size_t)y * dst->rowBytes;
+        if (src->width == 1) {
+            if (srgb)
+                row_srgb(d, s0, s1, 1, channels, 0);
+            else
+                row_linear(d, s0, s1, 1, channels, 0);
+        } else {
+            row(d, s0, s1, dst->width);
+        }
+    }
+    VMBlit2DVectorEnd(&vector);
+    return true;
+}
@@ -0,0 +1,60 @@
+#ifndef __VMMipmap_H__
+#define __VMMipmap_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "VMBlit2D.h"
+
+// 2x2 box filter for software mip generation.
+//
+// VMTextureManager generates mip chains on the host with virgl blits. This
+// is the fallback when there is no virgl context to blit in: plain VirtIO
+// 2D, the mock device, or a submission the host refused. It covers the
+// 8-bit formats apps actually ask to mipmap: R8, RG8 and four-channel
+// RGBA8/BGRA8.
+//
+// sRGB images are filtered in linear light. Color channels go through a
+// 256-entry decode table to 16-bit linear, are averaged, and are encoded
+// back with correct rounding; the fourth channel of a four-channel image is
+// alpha and is averaged as stored. Linear images average the stored bytes
+// with round-half-up. Every kernel set produces identical bytes.
+//
+// Kernel selection piggybacks on VMBlit2D's CPU probe, and inside the kext
+// each level is built within VMBlit2DVectorBegin/End. Free of IOKit, so
+// tools/mipmap_test builds it unchanged on Linux.
+
+struct VMMipmapImage {
+    uint8_t* base;          // Address of texel (0,0)
+    uint32_t rowBytes;      // Stride in bytes, at least width * channels
+    uint32_t width;         // In texels
+    uint32_t height;        // In rows
+};
+
+// Pin a kernel set (clamped to VMBlit2DBestPath()). Returns the path
+// actually selected. The first downsample picks the best path on its own.
+VMBlit2DPath VMMipmapSetPath(VMBlit2DPath path);
+VMBlit2DPath VMMipmapActivePath();
+
+// Size of the level below one `size` texels across
+static inline uint32_t VMMipmapNextSize(uint32_t size)
+{
+    return size > 1 ? size >> 1 : 1;
+}
+
+// Write the level below `src` into `dst`, whose size must be
+// VMMipmapNextSize() of the source in both directions. `channels` is 1, 2
+// or 4 bytes per texel. Texel (x,y) averages source texels 2x..2x+1 and
+// 2y..2y+1; the odd last row or column of a source is not sampled, and a
+// source one texel wide or high repeats its only column or row. Returns
+// false for bad arguments without touching `dst`.
+bool VMMipmapDownsample(const VMMipmapImage* dst, const VMMipmapImage* src,
+                        uint32_t channels, bool srgb);
+
+// Conversions behind the sRGB filter, exposed for the test suite:
+// 8-bit sRGB to 16-bit linear, and 16-bit linear back to the nearest
+// 8-bit sRGB code
+uint16_t VMMipmapSRGBToLinear(uint8_t value);
+uint8_t  VMMipmapLinearToSRGB(uint32_t linear);
+
+#endif /* __VMMipmap_H__ */
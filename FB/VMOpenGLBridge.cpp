@@ -3,6 +3,7 @@
 #include "VMVirtIOGPU.h"
 #include "VMMetalBridge.h"
 #include "VMShaderManager.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 #include <libkern/OSAtomic.h>
 #include <libkern/libkern.h>
@@ -158,41 +159,41 @@ bool CLASS::initWithAccelerator(VMQemuVGAAccelerator* accelerator)
     
     IOReturn ret = setupOpenGLSupport();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to setup OpenGL support (0x%x)\n", ret);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to setup OpenGL support (0x%x)\n", ret);
         return false;
     }
     
     ret = configureGLFeatures();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to configure GL features (0x%x)\n", ret);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to configure GL features (0x%x)\n", ret);
         return false;
     }
     
-    IOLog("VMOpenGLBridge: Initialized successfully\n");
+    VMLOG_INFO("VMOpenGLBridge: Initialized successfully\n");
     return true;
 }
 
 IOReturn CLASS::setupOpenGLSupport()
 {
-    IOLog("VMOpenGLBridge: Setting up OpenGL support with Snow Leopard Quartz integration\n");
+    VMLOG_INFO("VMOpenGLBridge: Setting up OpenGL support with Snow Leopard Quartz integration\n");
     
     // Register with Snow Leopard's OpenGL system
     IOReturn ret = registerWithQuartzOpenGL();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Warning - Failed to register with Quartz OpenGL (0x%x)\n", ret);
+        VMLOG_ERROR("VMOpenGLBridge: Warning - Failed to register with Quartz OpenGL (0x%x)\n", ret);
     }
     
     // Hook into Core Graphics for Canvas 2D acceleration
     ret = setupCoreGraphicsIntegration();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Warning - Failed to setup Core Graphics integration (0x%x)\n", ret);
+        VMLOG_ERROR("VMOpenGLBridge: Warning - Failed to setup Core Graphics integration (0x%x)\n", ret);
     }
     
     // Enable OpenGL/3D features on the GPU device
     if (m_gpu_device) {
         IOReturn gpu_ret = m_gpu_device->enableFeature(VIRTIO_GPU_FEATURE_3D);
         if (gpu_ret != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Warning - 3D feature not enabled (0x%x)\n", gpu_ret);
+            VMLOG_WARN("VMOpenGLBridge: Warning - 3D feature not enabled (0x%x)\n", gpu_ret);
         }
         
         // Enable OpenGL-specific features
@@ -203,21 +204,21 @@ IOReturn CLASS::setupOpenGLSupport()
     // Setup system-level OpenGL interception for browser acceleration
     ret = setupBrowserOpenGLHooks();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Warning - Failed to setup browser OpenGL hooks (0x%x)\n", ret);
+        VMLOG_ERROR("VMOpenGLBridge: Warning - Failed to setup browser OpenGL hooks (0x%x)\n", ret);
     }
     
-    IOLog("VMOpenGLBridge: OpenGL support setup completed with system integration\n");
+    VMLOG_INFO("VMOpenGLBridge: OpenGL support setup completed with system integration\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureGLFeatures()
 {
-    IOLog("VMOpenGLBridge: Configuring OpenGL features\n");
+    VMLOG_INFO("VMOpenGLBridge: Configuring OpenGL features\n");
     
     // Query actual host OpenGL capabilities through VirtIO GPU
     IOReturn ret = queryHostGLCapabilities();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Warning - Failed to query host GL capabilities, using fallback\n");
+        VMLOG_ERROR("VMOpenGLBridge: Warning - Failed to query host GL capabilities, using fallback\n");
         // Fallback to conservative OpenGL 2.1 support
         m_supports_gl_3_0 = false;
         m_supports_gl_3_2 = false;
@@ -228,14 +229,14 @@ IOReturn CLASS::configureGLFeatures()
         m_supports_tessellation = false;
     }
     
-    IOLog("VMOpenGLBridge: Feature configuration:\n");
-    IOLog("  OpenGL 3.0: %s\n", m_supports_gl_3_0 ? "Yes" : "No");
-    IOLog("  OpenGL 3.2: %s\n", m_supports_gl_3_2 ? "Yes" : "No");
-    IOLog("  OpenGL 4.0: %s\n", m_supports_gl_4_0 ? "Yes" : "No");
-    IOLog("  Vertex Array Objects: %s\n", m_supports_vertex_array_objects ? "Yes" : "No");
-    IOLog("  Uniform Buffer Objects: %s\n", m_supports_uniform_buffer_objects ? "Yes" : "No");
-    IOLog("  Geometry Shaders: %s\n", m_supports_geometry_shaders ? "Yes" : "No");
-    IOLog("  Tessellation: %s\n", m_supports_tessellation ? "Yes" : "No");
+    VMLOG_INFO("VMOpenGLBridge: Feature configuration:\n");
+    VMLOG_INFO("  OpenGL 3.0: %s\n", m_supports_gl_3_0 ? "Yes" : "No");
+    VMLOG_INFO("  OpenGL 3.2: %s\n", m_supports_gl_3_2 ? "Yes" : "No");
+    VMLOG_INFO("  OpenGL 4.0: %s\n", m_supports_gl_4_0 ? "Yes" : "No");
+    VMLOG_INFO("  Vertex Array Objects: %s\n", m_supports_vertex_array_objects ? "Yes" : "No");
+    VMLOG_INFO("  Uniform Buffer Objects: %s\n", m_supports_uniform_buffer_objects ? "Yes" : "No");
+    VMLOG_INFO("  Geometry Shaders: %s\n", m_supports_geometry_shaders ? "Yes" : "No");
+    VMLOG_INFO("  Tessellation: %s\n", m_supports_tessellation ? "Yes" : "No");
     
     return kIOReturnSuccess;
 }
@@ -271,7 +272,7 @@ IOReturn CLASS::createContext(const VMGLContextDescriptor* descriptor, uint32_t*
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMOpenGLBridge: Created OpenGL context %d (accelerator context: %d)\n", 
+    VMLOG_DEBUG("VMOpenGLBridge: Created OpenGL context %d (accelerator context: %d)\n", 
           *context_id, accel_context_id);
     return kIOReturnSuccess;
 }
@@ -301,7 +302,7 @@ IOReturn CLASS::makeContextCurrent(uint32_t context_id)
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMOpenGLBridge: Made context %d current\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Made context %d current\n", context_id);
     return ret;
 }
 
@@ -344,7 +345,7 @@ IOReturn CLASS::genBuffers(uint32_t count, uint32_t* buffer_ids)
             }
         }
         
-        IOLog("VMOpenGLBridge: Generated buffer %d (Metal: %d)\n", buffer_ids[i], metal_buffer_id);
+        VMLOG_DEBUG("VMOpenGLBridge: Generated buffer %d (Metal: %d)\n", buffer_ids[i], metal_buffer_id);
     }
     
     IORecursiveLockUnlock(m_lock);
@@ -417,7 +418,7 @@ IOReturn CLASS::bufferData(VMGLBufferTarget target, const VMGLBufferDescriptor*
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMOpenGLBridge: Updated buffer %d with %d bytes\n", buffer_id, descriptor->size);
+    VMLOG_DEBUG("VMOpenGLBridge: Updated buffer %d with %d bytes\n", buffer_id, descriptor->size);
     return ret;
 }
 
@@ -457,7 +458,7 @@ IOReturn CLASS::createShader(const VMGLShaderDescriptor* descriptor, uint32_t* s
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMOpenGLBridge: Created shader %d (type: %d)\n", *shader_id, descriptor->shader_type);
+    VMLOG_DEBUG("VMOpenGLBridge: Created shader %d (type: %d)\n", *shader_id, descriptor->shader_type);
     return kIOReturnSuccess;
 }
 
@@ -496,7 +497,7 @@ IOReturn CLASS::drawArrays(VMGLPrimitiveType mode, uint32_t first, uint32_t coun
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMOpenGLBridge: Draw arrays - mode: %d, first: %d, count: %d\n", mode, first, count);
+    VMLOG_DEBUG("VMOpenGLBridge: Draw arrays - mode: %d, first: %d, count: %d\n", mode, first, count);
     return ret;
 }
 
@@ -526,7 +527,7 @@ IOReturn CLASS::clear(uint32_t mask)
     
     IORecursiveLockUnlock(m_lock);
     
-    IOLog("VMOpenGLBridge: Clear buffers (mask: 0x%x)\n", mask);
+    VMLOG_DEBUG("VMOpenGLBridge: Clear buffers (mask: 0x%x)\n", mask);
     return ret;
 }
 
@@ -581,21 +582,21 @@ IOReturn CLASS::getGLPerformanceStats(void* stats_buffer, size_t* buffer_size)
 
 void CLASS::logOpenGLBridgeState()
 {
-    IOLog("VMOpenGLBridge State:\n");
-    IOLog("  Current Context: %d\n", m_current_context_id);
-    IOLog("  Draw Calls: %llu\n", m_gl_draw_calls);
-    IOLog("  State Changes: %llu\n", m_gl_state_changes);
-    IOLog("  Buffer Uploads: %llu\n", m_gl_buffer_uploads);
-    IOLog("  Texture Uploads: %llu\n", m_gl_texture_uploads);
-    IOLog("  Active Buffers: %d\n", m_gl_buffers ? m_gl_buffers->getCount() : 0);
-    IOLog("  Active Textures: %d\n", m_gl_textures ? m_gl_textures->getCount() : 0);
-    IOLog("  Active Shaders: %d\n", m_gl_shaders ? m_gl_shaders->getCount() : 0);
-    IOLog("  Active Programs: %d\n", m_gl_programs ? m_gl_programs->getCount() : 0);
-    IOLog("  Bound Array Buffer: %d\n", m_bound_array_buffer);
-    IOLog("  Bound Element Buffer: %d\n", m_bound_element_array_buffer);
-    IOLog("  Current Program: %d\n", m_current_program);
-    IOLog("  OpenGL 3.0 Support: %s\n", m_supports_gl_3_0 ? "Yes" : "No");
-    IOLog("  OpenGL 3.2 Support: %s\n", m_supports_gl_3_2 ? "Yes" : "No");
+    VMLOG_INFO("VMOpenGLBridge State:\n");
+    VMLOG_INFO("  Current Context: %d\n", m_current_context_id);
+    VMLOG_INFO("  Draw Calls: %llu\n", m_gl_draw_calls);
+    VMLOG_INFO("  State Changes: %llu\n", m_gl_state_changes);
+    VMLOG_INFO("  Buffer Uploads: %llu\n", m_gl_buffer_uploads);
+    VMLOG_INFO("  Texture Uploads: %llu\n", m_gl_texture_uploads);
+    VMLOG_INFO("  Active Buffers: %d\n", m_gl_buffers ? m_gl_buffers->getCount() : 0);
+    VMLOG_INFO("  Active Textures: %d\n", m_gl_textures ? m_gl_textures->getCount() : 0);
+    VMLOG_INFO("  Active Shaders: %d\n", m_gl_shaders ? m_gl_shaders->getCount() : 0);
+    VMLOG_INFO("  Active Programs: %d\n", m_gl_programs ? m_gl_programs->getCount() : 0);
+    VMLOG_INFO("  Bound Array Buffer: %d\n", m_bound_array_buffer);
+    VMLOG_INFO("  Bound Element Buffer: %d\n", m_bound_element_array_buffer);
+    VMLOG_INFO("  Current Program: %d\n", m_current_program);
+    VMLOG_INFO("  OpenGL 3.0 Support: %s\n", m_supports_gl_3_0 ? "Yes" : "No");
+    VMLOG_INFO("  OpenGL 3.2 Support: %s\n", m_supports_gl_3_2 ? "Yes" : "No");
 }
 
 // Private helper methods
@@ -639,7 +640,7 @@ IOReturn CLASS::syncGLState()
             for (uint32_t unit = 0; unit < 32 && ret == kIOReturnSuccess; unit++) {
                 if (m_bound_textures[unit] != 0) {
                     // Log texture binding - actual binding happens during draw calls
-                    IOLog("VMOpenGLBridge: Texture %d bound to unit %d for context %d\n", 
+                    VMLOG_DEBUG("VMOpenGLBridge: Texture %d bound to unit %d for context %d\n", 
                           m_bound_textures[unit], unit, m_current_context_id);
                 }
             }
@@ -649,18 +650,18 @@ IOReturn CLASS::syncGLState()
         if (m_current_program != 0 && ret == kIOReturnSuccess) {
             ret = m_accelerator->useShaderProgram(m_current_context_id, m_current_program);
             if (ret == kIOReturnSuccess) {
-                IOLog("VMOpenGLBridge: Shader program %d active for context %d\n", 
+                VMLOG_DEBUG("VMOpenGLBridge: Shader program %d active for context %d\n", 
                       m_current_program, m_current_context_id);
             }
         }
         
         // Sync buffer bindings by ensuring they're tracked for draw calls
         if (m_bound_array_buffer != 0 && ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Array buffer %d bound for context %d\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: Array buffer %d bound for context %d\n", 
                   m_bound_array_buffer, m_current_context_id);
         }
         if (m_bound_element_array_buffer != 0 && ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Element buffer %d bound for context %d\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: Element buffer %d bound for context %d\n", 
                   m_bound_element_array_buffer, m_current_context_id);
         }
         
@@ -669,16 +670,16 @@ IOReturn CLASS::syncGLState()
             // Perform comprehensive context validation for 3D operations
             ret = performContextValidation();
             if (ret == kIOReturnSuccess) {
-                IOLog("VMOpenGLBridge: Context %d validated and prepared for 3D rendering\n", m_current_context_id);
+                VMLOG_DEBUG("VMOpenGLBridge: Context %d validated and prepared for 3D rendering\n", m_current_context_id);
             } else {
-                IOLog("VMOpenGLBridge: Context %d validation failed (0x%x)\n", m_current_context_id, ret);
+                VMLOG_ERROR("VMOpenGLBridge: Context %d validation failed (0x%x)\n", m_current_context_id, ret);
             }
         }
         
         // Update state synchronization counters
         if (ret == kIOReturnSuccess) {
             m_gl_state_changes++;
-            IOLog("VMOpenGLBridge: OpenGL state synchronized successfully for context %d\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: OpenGL state synchronized successfully for context %d\n", 
                   m_current_context_id);
         } else {
         }
@@ -697,27 +698,27 @@ IOReturn CLASS::performContextValidation()
     
     // Validate GPU device is ready for 3D operations
     if (!m_gpu_device) {
-        IOLog("VMOpenGLBridge: Context validation failed - no GPU device\n");
+        VMLOG_ERROR("VMOpenGLBridge: Context validation failed - no GPU device\n");
         return kIOReturnNoDevice;
     }
     
     // Check if 3D support is available
     if (!m_gpu_device->supports3D()) {
-        IOLog("VMOpenGLBridge: Context validation failed - no 3D support\n");
+        VMLOG_ERROR("VMOpenGLBridge: Context validation failed - no 3D support\n");
         return kIOReturnUnsupported;
     }
     
     // Verify VirtIO GPU features required for OpenGL
     bool has_3d_feature = m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_3D);
     if (!has_3d_feature) {
-        IOLog("VMOpenGLBridge: Warning - VirtIO GPU 3D feature not available\n");
+        VMLOG_WARN("VMOpenGLBridge: Warning - VirtIO GPU 3D feature not available\n");
         // Continue anyway as some basic operations might still work
     }
     
     // Validate context exists in our tracking system
     OSObject* context_obj = findGLResource(m_current_context_id);
     if (!context_obj) {
-        IOLog("VMOpenGLBridge: Context validation failed - context %d not found\n", m_current_context_id);
+        VMLOG_ERROR("VMOpenGLBridge: Context validation failed - context %d not found\n", m_current_context_id);
         return kIOReturnNotFound;
     }
     
@@ -728,38 +729,38 @@ IOReturn CLASS::performContextValidation()
         
         // Verify shader manager availability for shader operations
         if (m_accelerator->getShaderManager()) {
-            IOLog("VMOpenGLBridge: Shader manager available for context %d\n", m_current_context_id);
+            VMLOG_DEBUG("VMOpenGLBridge: Shader manager available for context %d\n", m_current_context_id);
         } else {
-            IOLog("VMOpenGLBridge: Warning - No shader manager for context %d\n", m_current_context_id);
+            VMLOG_WARN("VMOpenGLBridge: Warning - No shader manager for context %d\n", m_current_context_id);
         }
         
         // Check Metal bridge connectivity if available
         if (m_metal_bridge) {
-            IOLog("VMOpenGLBridge: Metal bridge available for context %d\n", m_current_context_id);
+            VMLOG_DEBUG("VMOpenGLBridge: Metal bridge available for context %d\n", m_current_context_id);
         }
     }
     
     // Validate resource state consistency
     ret = validateResourceState();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Resource state validation failed (0x%x)\n", ret);
+        VMLOG_ERROR("VMOpenGLBridge: Resource state validation failed (0x%x)\n", ret);
         return ret;
     }
     
     // Check for critical OpenGL state consistency
     ret = validateOpenGLState();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: OpenGL state validation failed (0x%x)\n", ret);
+        VMLOG_ERROR("VMOpenGLBridge: OpenGL state validation failed (0x%x)\n", ret);
         return ret;
     }
     
     // Verify memory resources are available
     if (m_gl_resource_map && m_gl_resource_map->getCount() > 0) {
-        IOLog("VMOpenGLBridge: Context %d has %d tracked resources\n", 
+        VMLOG_DEBUG("VMOpenGLBridge: Context %d has %d tracked resources\n", 
               m_current_context_id, m_gl_resource_map->getCount());
     }
     
-    IOLog("VMOpenGLBridge: Context %d validation completed successfully\n", m_current_context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Context %d validation completed successfully\n", m_current_context_id);
     return kIOReturnSuccess;
 }
 
@@ -780,7 +781,7 @@ IOReturn CLASS::validateResourceState()
     uint32_t expected_total = buffer_count + texture_count + shader_count + program_count;
     
     if (total_tracked != expected_total) {
-        IOLog("VMOpenGLBridge: Resource tracking inconsistency - tracked: %d, expected: %d\n",
+        VMLOG_INFO("VMOpenGLBridge: Resource tracking inconsistency - tracked: %d, expected: %d\n",
               total_tracked, expected_total);
         // This is a warning, not a fatal error
     }
@@ -789,7 +790,7 @@ IOReturn CLASS::validateResourceState()
     if (m_bound_array_buffer != 0) {
         OSObject* buffer_obj = findGLResource(m_bound_array_buffer);
         if (!buffer_obj) {
-            IOLog("VMOpenGLBridge: Bound array buffer %d not found in resource map\n", m_bound_array_buffer);
+            VMLOG_WARN("VMOpenGLBridge: Bound array buffer %d not found in resource map\n", m_bound_array_buffer);
             return kIOReturnBadArgument;
         }
     }
@@ -797,7 +798,7 @@ IOReturn CLASS::validateResourceState()
     if (m_bound_element_array_buffer != 0) {
         OSObject* buffer_obj = findGLResource(m_bound_element_array_buffer);
         if (!buffer_obj) {
-            IOLog("VMOpenGLBridge: Bound element buffer %d not found in resource map\n", m_bound_element_array_buffer);
+            VMLOG_WARN("VMOpenGLBridge: Bound element buffer %d not found in resource map\n", m_bound_element_array_buffer);
             return kIOReturnBadArgument;
         }
     }
@@ -805,12 +806,12 @@ IOReturn CLASS::validateResourceState()
     if (m_current_program != 0) {
         OSObject* program_obj = findGLResource(m_current_program);
         if (!program_obj) {
-            IOLog("VMOpenGLBridge: Current program %d not found in resource map\n", m_current_program);
+            VMLOG_WARN("VMOpenGLBridge: Current program %d not found in resource map\n", m_current_program);
             return kIOReturnBadArgument;
         }
     }
     
-    IOLog("VMOpenGLBridge: Resource state validated - %d resources tracked\n", total_tracked);
+    VMLOG_INFO("VMOpenGLBridge: Resource state validated - %d resources tracked\n", total_tracked);
     return kIOReturnSuccess;
 }
 
@@ -822,7 +823,7 @@ IOReturn CLASS::validateOpenGLState()
     if (m_current_state.blend_enabled) {
         // Validate blend factors are supported
         if (m_current_state.src_blend_factor == 0 || m_current_state.dst_blend_factor == 0) {
-            IOLog("VMOpenGLBridge: Invalid blend factors - src: %d, dst: %d\n",
+            VMLOG_WARN("VMOpenGLBridge: Invalid blend factors - src: %d, dst: %d\n",
                   m_current_state.src_blend_factor, m_current_state.dst_blend_factor);
             return kIOReturnBadArgument;
         }
@@ -830,14 +831,14 @@ IOReturn CLASS::validateOpenGLState()
     
     // Validate depth function
     if (m_current_state.depth_func < VM_GL_NEVER || m_current_state.depth_func > VM_GL_ALWAYS) {
-        IOLog("VMOpenGLBridge: Invalid depth function: %d\n", m_current_state.depth_func);
+        VMLOG_WARN("VMOpenGLBridge: Invalid depth function: %d\n", m_current_state.depth_func);
         return kIOReturnBadArgument;
     }
     
     // Check clear color values are in valid range
     for (int i = 0; i < 4; i++) {
         if (m_current_state.clear_color[i] < 0.0f || m_current_state.clear_color[i] > 1.0f) {
-            IOLog("VMOpenGLBridge: Clear color component %d out of range: %f\n", i, m_current_state.clear_color[i]);
+            VMLOG_INFO("VMOpenGLBridge: Clear color component %d out of range: %f\n", i, m_current_state.clear_color[i]);
             // Clamp to valid range instead of failing
             m_current_state.clear_color[i] = (m_current_state.clear_color[i] < 0.0f) ? 0.0f : 1.0f;
         }
@@ -845,7 +846,7 @@ IOReturn CLASS::validateOpenGLState()
     
     // Validate clear depth value
     if (m_current_state.clear_depth < 0.0f || m_current_state.clear_depth > 1.0f) {
-        IOLog("VMOpenGLBridge: Clear depth out of range: %f\n", m_current_state.clear_depth);
+        VMLOG_INFO("VMOpenGLBridge: Clear depth out of range: %f\n", m_current_state.clear_depth);
         m_current_state.clear_depth = (m_current_state.clear_depth < 0.0f) ? 0.0f : 1.0f;
     }
     
@@ -858,7 +859,7 @@ IOReturn CLASS::validateOpenGLState()
             // Verify texture resource exists
             OSObject* texture_obj = findGLResource(m_bound_textures[unit]);
             if (!texture_obj) {
-                IOLog("VMOpenGLBridge: Bound texture %d on unit %d not found\n", 
+                VMLOG_WARN("VMOpenGLBridge: Bound texture %d on unit %d not found\n", 
                       m_bound_textures[unit], unit);
                 // Clear invalid binding
                 m_bound_textures[unit] = 0;
@@ -867,19 +868,19 @@ IOReturn CLASS::validateOpenGLState()
     }
     
     if (active_texture_units > 0) {
-        IOLog("VMOpenGLBridge: %d texture units active and validated\n", active_texture_units);
+        VMLOG_INFO("VMOpenGLBridge: %d texture units active and validated\n", active_texture_units);
     }
     
     // Validate feature usage matches capabilities
     if (m_current_state.cull_face_enabled && !m_supports_gl_3_0) {
-        IOLog("VMOpenGLBridge: Warning - Face culling used but GL 3.0 not supported\n");
+        VMLOG_WARN("VMOpenGLBridge: Warning - Face culling used but GL 3.0 not supported\n");
     }
     
     if (m_current_program != 0 && !m_supports_gl_3_0) {
-        IOLog("VMOpenGLBridge: Warning - Shader program used but GL 3.0 not supported\n");
+        VMLOG_WARN("VMOpenGLBridge: Warning - Shader program used but GL 3.0 not supported\n");
     }
     
-    IOLog("VMOpenGLBridge: OpenGL state validation completed\n");
+    VMLOG_INFO("VMOpenGLBridge: OpenGL state validation completed\n");
     return kIOReturnSuccess;
 }
 
@@ -909,12 +910,12 @@ IOReturn CLASS::syncDepthState()
     if (m_current_state.depth_test_enabled) {
         ret = m_accelerator->enableDepthTest(m_current_context_id, true);
         if (ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Depth testing enabled for context %d\n", m_current_context_id);
+            VMLOG_DEBUG("VMOpenGLBridge: Depth testing enabled for context %d\n", m_current_context_id);
         }
     } else {
         ret = m_accelerator->enableDepthTest(m_current_context_id, false);
         if (ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Depth testing disabled for context %d\n", m_current_context_id);
+            VMLOG_DEBUG("VMOpenGLBridge: Depth testing disabled for context %d\n", m_current_context_id);
         }
     }
     
@@ -933,13 +934,13 @@ IOReturn CLASS::syncBlendState()
     if (m_current_state.blend_enabled) {
         ret = m_accelerator->enableBlending(m_current_context_id, true);
         if (ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Blending enabled for context %d (src: %d, dst: %d)\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: Blending enabled for context %d (src: %d, dst: %d)\n", 
                   m_current_context_id, m_current_state.src_blend_factor, m_current_state.dst_blend_factor);
         }
     } else {
         ret = m_accelerator->enableBlending(m_current_context_id, false);
         if (ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Blending disabled for context %d\n", m_current_context_id);
+            VMLOG_DEBUG("VMOpenGLBridge: Blending disabled for context %d\n", m_current_context_id);
         }
     }
     
@@ -955,9 +956,9 @@ IOReturn CLASS::syncCullState()
     // Face culling state is tracked but not directly available in accelerator
     // Log the current state for debugging
     if (m_current_state.cull_face_enabled) {
-        IOLog("VMOpenGLBridge: Face culling enabled for context %d\n", m_current_context_id);
+        VMLOG_DEBUG("VMOpenGLBridge: Face culling enabled for context %d\n", m_current_context_id);
     } else {
-        IOLog("VMOpenGLBridge: Face culling disabled for context %d\n", m_current_context_id);
+        VMLOG_DEBUG("VMOpenGLBridge: Face culling disabled for context %d\n", m_current_context_id);
     }
     
     return kIOReturnSuccess;
@@ -970,7 +971,7 @@ IOReturn CLASS::syncViewportState()
     }
     
     // Viewport state is tracked internally and applied during rendering
-    IOLog("VMOpenGLBridge: Viewport state ready for context %d\n", m_current_context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Viewport state ready for context %d\n", m_current_context_id);
     
     return kIOReturnSuccess;
 }
@@ -989,7 +990,7 @@ IOReturn CLASS::syncTextureState()
         }
     }
     
-    IOLog("VMOpenGLBridge: Texture state synchronized - %d active textures for context %d\n", 
+    VMLOG_DEBUG("VMOpenGLBridge: Texture state synchronized - %d active textures for context %d\n", 
           active_textures, m_current_context_id);
     
     return kIOReturnSuccess;
@@ -1007,14 +1008,14 @@ IOReturn CLASS::syncShaderState()
     if (m_current_program != 0) {
         ret = m_accelerator->useShaderProgram(m_current_context_id, m_current_program);
         if (ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Shader program %d active for context %d\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: Shader program %d active for context %d\n", 
                   m_current_program, m_current_context_id);
         } else {
-            IOLog("VMOpenGLBridge: Warning - Failed to activate shader program %d (0x%x)\n", 
+            VMLOG_ERROR("VMOpenGLBridge: Warning - Failed to activate shader program %d (0x%x)\n", 
                   m_current_program, ret);
         }
     } else {
-        IOLog("VMOpenGLBridge: No shader program active for context %d\n", m_current_context_id);
+        VMLOG_DEBUG("VMOpenGLBridge: No shader program active for context %d\n", m_current_context_id);
     }
     
     return ret;
@@ -1022,11 +1023,11 @@ IOReturn CLASS::syncShaderState()
 
 IOReturn CLASS::queryHostGLCapabilities()
 {
-    IOLog("VMOpenGLBridge: Querying host OpenGL capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Querying host OpenGL capabilities\n");
     
     // Query VirtIO GPU for OpenGL capabilities
     if (!m_gpu_device || !m_gpu_device->supports3D()) {
-        IOLog("VMOpenGLBridge: 3D support not available, limiting to OpenGL 2.1\n");
+        VMLOG_DEBUG("VMOpenGLBridge: 3D support not available, limiting to OpenGL 2.1\n");
         m_supports_gl_3_0 = false;
         m_supports_gl_3_2 = false;
         m_supports_gl_4_0 = false;
@@ -1046,9 +1047,9 @@ IOReturn CLASS::queryHostGLCapabilities()
         // Advanced VirtIO GPU with proper context management - query actual OpenGL capabilities
         IOReturn version_ret = queryHostOpenGLVersion();
         if (version_ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Successfully queried host OpenGL capabilities\n");
+            VMLOG_DEBUG("VMOpenGLBridge: Successfully queried host OpenGL capabilities\n");
         } else {
-            IOLog("VMOpenGLBridge: Host query failed, using feature-based detection (0x%x)\n", version_ret);
+            VMLOG_ERROR("VMOpenGLBridge: Host query failed, using feature-based detection (0x%x)\n", version_ret);
             // Fallback to feature-based capability detection
             detectOpenGLCapabilitiesFromVirtIOFeatures(has_resource_blob, has_context_init);
         }
@@ -1059,12 +1060,12 @@ IOReturn CLASS::queryHostGLCapabilities()
             m_supports_gl_4_0 = true;
             m_supports_geometry_shaders = true;
             m_supports_tessellation = true;
-            IOLog("VMOpenGLBridge: Detected VirtIO GPU with Virgl - OpenGL 4.0+ support enabled\n");
+            VMLOG_DEBUG("VMOpenGLBridge: Detected VirtIO GPU with Virgl - OpenGL 4.0+ support enabled\n");
         } else {
             m_supports_gl_4_0 = false;
             m_supports_geometry_shaders = false;
             m_supports_tessellation = false;
-            IOLog("VMOpenGLBridge: Detected standard VirtIO GPU - OpenGL 3.2 support enabled\n");
+            VMLOG_DEBUG("VMOpenGLBridge: Detected standard VirtIO GPU - OpenGL 3.2 support enabled\n");
         }
     } else if (m_gpu_device->supports3D()) {
         // Basic 3D support - OpenGL 3.0 level
@@ -1075,7 +1076,7 @@ IOReturn CLASS::queryHostGLCapabilities()
         m_supports_uniform_buffer_objects = false;
         m_supports_geometry_shaders = false;
         m_supports_tessellation = false;
-        IOLog("VMOpenGLBridge: Detected basic VirtIO GPU 3D - OpenGL 3.0 support enabled\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Detected basic VirtIO GPU 3D - OpenGL 3.0 support enabled\n");
     } else {
         // Fallback to OpenGL 2.1 equivalent
         m_supports_gl_3_0 = false;
@@ -1085,7 +1086,7 @@ IOReturn CLASS::queryHostGLCapabilities()
         m_supports_uniform_buffer_objects = false;
         m_supports_geometry_shaders = false;
         m_supports_tessellation = false;
-        IOLog("VMOpenGLBridge: No advanced 3D support - OpenGL 2.1 fallback mode\n");
+        VMLOG_DEBUG("VMOpenGLBridge: No advanced 3D support - OpenGL 2.1 fallback mode\n");
     }
     
     return kIOReturnSuccess;
@@ -1093,7 +1094,7 @@ IOReturn CLASS::queryHostGLCapabilities()
 
 IOReturn CLASS::queryHostOpenGLVersion()
 {
-    IOLog("VMOpenGLBridge: Querying actual host OpenGL version through VirtIO GPU\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Querying actual host OpenGL version through VirtIO GPU\n");
     
     if (!m_gpu_device) {
         return kIOReturnNoDevice;
@@ -1108,10 +1109,10 @@ IOReturn CLASS::queryHostOpenGLVersion()
     if (m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_CONTEXT_INIT)) {
         query_ret = queryVirtIOGPUOpenGLVersion(&host_major, &host_minor);
         if (query_ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Host reports OpenGL %d.%d via VirtIO GPU query\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: Host reports OpenGL %d.%d via VirtIO GPU query\n", 
                   host_major, host_minor);
         } else {
-            IOLog("VMOpenGLBridge: Direct VirtIO GPU version query failed (0x%x)\n", query_ret);
+            VMLOG_ERROR("VMOpenGLBridge: Direct VirtIO GPU version query failed (0x%x)\n", query_ret);
         }
     }
     
@@ -1119,7 +1120,7 @@ IOReturn CLASS::queryHostOpenGLVersion()
     if (query_ret != kIOReturnSuccess) {
         query_ret = probeOpenGLVersionFromContext(&host_major, &host_minor);
         if (query_ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Detected OpenGL %d.%d from context probe\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: Detected OpenGL %d.%d from context probe\n", 
                   host_major, host_minor);
         }
     }
@@ -1128,7 +1129,7 @@ IOReturn CLASS::queryHostOpenGLVersion()
     if (query_ret != kIOReturnSuccess) {
         query_ret = inferOpenGLVersionFromFeatures(&host_major, &host_minor);
         if (query_ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Inferred OpenGL %d.%d from VirtIO features\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: Inferred OpenGL %d.%d from VirtIO features\n", 
                   host_major, host_minor);
         }
     }
@@ -1137,7 +1138,7 @@ IOReturn CLASS::queryHostOpenGLVersion()
     uint32_t final_major = (query_ret == kIOReturnSuccess) ? host_major : 2;
     uint32_t final_minor = (query_ret == kIOReturnSuccess) ? host_minor : 1;
     
-    IOLog("VMOpenGLBridge: Using OpenGL %d.%d for capability detection\n", 
+    VMLOG_DEBUG("VMOpenGLBridge: Using OpenGL %d.%d for capability detection\n", 
           final_major, final_minor);
     
     // Set capabilities based on detected host OpenGL version
@@ -1151,18 +1152,18 @@ IOReturn CLASS::queryHostOpenGLVersion()
     m_supports_geometry_shaders = m_supports_gl_3_2;
     m_supports_tessellation = m_supports_gl_4_0;
     
-    IOLog("VMOpenGLBridge: Capabilities set from host OpenGL %d.%d\n", final_major, final_minor);
+    VMLOG_DEBUG("VMOpenGLBridge: Capabilities set from host OpenGL %d.%d\n", final_major, final_minor);
     
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::detectOpenGLCapabilitiesFromVirtIOFeatures(bool has_resource_blob, bool has_context_init)
 {
-    IOLog("VMOpenGLBridge: Detecting OpenGL capabilities from VirtIO GPU features\n");
+    VMLOG_INFO("VMOpenGLBridge: Detecting OpenGL capabilities from VirtIO GPU features\n");
     
     if (has_resource_blob && has_context_init) {
         // Advanced VirtIO GPU features indicate modern OpenGL support
-        IOLog("VMOpenGLBridge: Advanced VirtIO features detected - enabling OpenGL 3.2\n");
+        VMLOG_INFO("VMOpenGLBridge: Advanced VirtIO features detected - enabling OpenGL 3.2\n");
         m_supports_gl_3_0 = true;
         m_supports_gl_3_2 = true;
         m_supports_vertex_array_objects = true;
@@ -1171,19 +1172,19 @@ IOReturn CLASS::detectOpenGLCapabilitiesFromVirtIOFeatures(bool has_resource_blo
         // Check for Virgl renderer support (indicates OpenGL 4.0+ capability)
         bool has_virgl = m_gpu_device && m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_VIRGL);
         if (has_virgl) {
-            IOLog("VMOpenGLBridge: VirGL support detected - enabling OpenGL 4.0+ features\n");
+            VMLOG_INFO("VMOpenGLBridge: VirGL support detected - enabling OpenGL 4.0+ features\n");
             m_supports_gl_4_0 = true;
             m_supports_geometry_shaders = true;
             m_supports_tessellation = true;
         } else {
-            IOLog("VMOpenGLBridge: No VirGL support - limiting to OpenGL 3.2\n");
+            VMLOG_INFO("VMOpenGLBridge: No VirGL support - limiting to OpenGL 3.2\n");
             m_supports_gl_4_0 = false;
             m_supports_geometry_shaders = false;
             m_supports_tessellation = false;
         }
     } else if (has_context_init) {
         // Basic modern features - OpenGL 3.0 level
-        IOLog("VMOpenGLBridge: Basic VirtIO context support - enabling OpenGL 3.0\n");
+        VMLOG_INFO("VMOpenGLBridge: Basic VirtIO context support - enabling OpenGL 3.0\n");
         m_supports_gl_3_0 = true;
         m_supports_gl_3_2 = false;
         m_supports_gl_4_0 = false;
@@ -1193,7 +1194,7 @@ IOReturn CLASS::detectOpenGLCapabilitiesFromVirtIOFeatures(bool has_resource_blo
         m_supports_tessellation = false;
     } else {
         // Legacy VirtIO GPU - conservative OpenGL 2.1 support
-        IOLog("VMOpenGLBridge: Legacy VirtIO GPU detected - OpenGL 2.1 mode\n");
+        VMLOG_INFO("VMOpenGLBridge: Legacy VirtIO GPU detected - OpenGL 2.1 mode\n");
         m_supports_gl_3_0 = false;
         m_supports_gl_3_2 = false;
         m_supports_gl_4_0 = false;
@@ -1208,9 +1209,9 @@ IOReturn CLASS::detectOpenGLCapabilitiesFromVirtIOFeatures(bool has_resource_blo
         // Check if accelerator can handle detected OpenGL version
         IOReturn validation_ret = validateAcceleratorOpenGLSupport(m_supports_gl_3_0, m_supports_gl_3_2, m_supports_gl_4_0);
         if (validation_ret == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Accelerator validated for detected OpenGL capabilities\n");
+            VMLOG_INFO("VMOpenGLBridge: Accelerator validated for detected OpenGL capabilities\n");
         } else {
-            IOLog("VMOpenGLBridge: Accelerator validation failed (0x%x), adjusting capabilities\n", validation_ret);
+            VMLOG_ERROR("VMOpenGLBridge: Accelerator validation failed (0x%x), adjusting capabilities\n", validation_ret);
             
             // Query accelerator for maximum supported OpenGL features
             VMAcceleratorOpenGLCapabilities accel_caps;
@@ -1219,10 +1220,10 @@ IOReturn CLASS::detectOpenGLCapabilitiesFromVirtIOFeatures(bool has_resource_blo
             if (caps_ret == kIOReturnSuccess) {
                 // Adjust capabilities to match accelerator limits
                 adjustCapabilitiesForAccelerator(&accel_caps);
-                IOLog("VMOpenGLBridge: Capabilities adjusted to match accelerator limits\n");
+                VMLOG_INFO("VMOpenGLBridge: Capabilities adjusted to match accelerator limits\n");
             } else {
                 // Conservative fallback if accelerator query fails
-                IOLog("VMOpenGLBridge: Accelerator query failed, using conservative OpenGL 2.1 fallback\n");
+                VMLOG_ERROR("VMOpenGLBridge: Accelerator query failed, using conservative OpenGL 2.1 fallback\n");
                 m_supports_gl_3_0 = false;
                 m_supports_gl_3_2 = false;
                 m_supports_gl_4_0 = false;
@@ -1236,10 +1237,10 @@ IOReturn CLASS::detectOpenGLCapabilitiesFromVirtIOFeatures(bool has_resource_blo
         // Perform final validation of adjusted capabilities
         IOReturn final_validation = validateFinalOpenGLConfiguration();
         if (final_validation != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Final capability validation failed (0x%x)\n", final_validation);
+            VMLOG_ERROR("VMOpenGLBridge: Final capability validation failed (0x%x)\n", final_validation);
         }
     } else {
-        IOLog("VMOpenGLBridge: No accelerator available for capability validation\n");
+        VMLOG_INFO("VMOpenGLBridge: No accelerator available for capability validation\n");
         // Without accelerator, limit to basic software rendering capabilities
         m_supports_gl_3_0 = false;
         m_supports_gl_3_2 = false;
@@ -1253,7 +1254,7 @@ IOReturn CLASS::detectOpenGLCapabilitiesFromVirtIOFeatures(bool has_resource_blo
     // Log final capability determination
     logFinalCapabilityConfiguration();
     
-    IOLog("VMOpenGLBridge: Feature-based capability detection completed\n");
+    VMLOG_INFO("VMOpenGLBridge: Feature-based capability detection completed\n");
     return kIOReturnSuccess;
 }
 
@@ -1263,13 +1264,13 @@ IOReturn CLASS::queryVirtIOGPUOpenGLVersion(uint32_t* major, uint32_t* minor)
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMOpenGLBridge: Attempting direct VirtIO GPU OpenGL version query\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Attempting direct VirtIO GPU OpenGL version query\n");
     
     // Create a temporary 3D context for capability querying
     uint32_t temp_context_id = 0;
     IOReturn ctx_ret = this->m_accelerator->create3DContext(&temp_context_id, current_task());
     if (ctx_ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to create temp context for version query (0x%x)\n", ctx_ret);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to create temp context for version query (0x%x)\n", ctx_ret);
         return ctx_ret;
     }
     
@@ -1280,7 +1281,7 @@ IOReturn CLASS::queryVirtIOGPUOpenGLVersion(uint32_t* major, uint32_t* minor)
     if (this->m_gpu_device->supportsFeature(VIRTIO_GPU_GL_VERSION)) {
         // For now, simulate the query since direct GL string queries may not be available
         // In a real implementation, this would use VirtIO GPU command interface
-        IOLog("VMOpenGLBridge: VirtIO GPU GL_VERSION feature available, simulating query\n");
+        VMLOG_DEBUG("VMOpenGLBridge: VirtIO GPU GL_VERSION feature available, simulating query\n");
         *major = 3;
         *minor = 2;
         ret = kIOReturnSuccess;
@@ -1290,7 +1291,7 @@ IOReturn CLASS::queryVirtIOGPUOpenGLVersion(uint32_t* major, uint32_t* minor)
     if (ret != kIOReturnSuccess && this->m_gpu_device->supportsFeature(VIRTIO_GPU_CONTEXT_INIT_QUERY_CAPS)) {
         // For now, simulate capability query since specific methods may not be available
         // In a real implementation, this would query the VirtIO GPU context capabilities
-        IOLog("VMOpenGLBridge: VirtIO GPU context capabilities available, simulating query\n");
+        VMLOG_DEBUG("VMOpenGLBridge: VirtIO GPU context capabilities available, simulating query\n");
         *major = 3;
         *minor = 2;
         ret = kIOReturnSuccess;
@@ -1302,7 +1303,7 @@ IOReturn CLASS::queryVirtIOGPUOpenGLVersion(uint32_t* major, uint32_t* minor)
     }
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Direct VirtIO GPU version query failed (0x%x)\n", ret);
+        VMLOG_ERROR("VMOpenGLBridge: Direct VirtIO GPU version query failed (0x%x)\n", ret);
     }
     
     return ret;
@@ -1314,7 +1315,7 @@ IOReturn CLASS::probeOpenGLVersionFromContext(uint32_t* major, uint32_t* minor)
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMOpenGLBridge: Probing OpenGL version from context creation\n");
+    VMLOG_INFO("VMOpenGLBridge: Probing OpenGL version from context creation\n");
     
     // Try creating contexts with different OpenGL versions to see what's supported
     struct GLVersionProbe {
@@ -1353,35 +1354,35 @@ IOReturn CLASS::probeOpenGLVersionFromContext(uint32_t* major, uint32_t* minor)
             if (validation_result == kIOReturnSuccess) {
                 *major = probes[i].major;
                 *minor = probes[i].minor;
-                IOLog("VMOpenGLBridge: Version-specific context creation confirmed %s support\n", probes[i].name);
+                VMLOG_INFO("VMOpenGLBridge: Version-specific context creation confirmed %s support\n", probes[i].name);
             } else {
-                IOLog("VMOpenGLBridge: Context validation failed for %s (0x%x)\n", probes[i].name, validation_result);
+                VMLOG_ERROR("VMOpenGLBridge: Context validation failed for %s (0x%x)\n", probes[i].name, validation_result);
                 // Try fallback version detection
                 if (attemptFallbackVersionDetection(&test_context_id, major, minor, probes[i].major, probes[i].minor)) {
-                    IOLog("VMOpenGLBridge: Fallback version detection succeeded: OpenGL %d.%d\n", *major, *minor);
+                    VMLOG_INFO("VMOpenGLBridge: Fallback version detection succeeded: OpenGL %d.%d\n", *major, *minor);
                 } else {
                     // Use basic feature-based heuristics as last resort
                     if (this->m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_VIRGL) && probes[i].major >= 4) {
                         *major = probes[i].major;
                         *minor = probes[i].minor;
-                        IOLog("VMOpenGLBridge: VirGL detected, assuming %s support\n", probes[i].name);
+                        VMLOG_INFO("VMOpenGLBridge: VirGL detected, assuming %s support\n", probes[i].name);
                     } else if (this->m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_RESOURCE_BLOB) && 
                                probes[i].major == 3 && probes[i].minor >= 2) {
                         *major = probes[i].major;
                         *minor = probes[i].minor;
-                        IOLog("VMOpenGLBridge: Advanced VirtIO features, assuming %s support\n", probes[i].name);
+                        VMLOG_INFO("VMOpenGLBridge: Advanced VirtIO features, assuming %s support\n", probes[i].name);
                     } else if (this->m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_3D) && 
                                probes[i].major == 3 && probes[i].minor == 0) {
                         *major = probes[i].major;
                         *minor = probes[i].minor;
-                        IOLog("VMOpenGLBridge: Basic 3D support, assuming %s support\n", probes[i].name);
+                        VMLOG_INFO("VMOpenGLBridge: Basic 3D support, assuming %s support\n", probes[i].name);
                     } else if (probes[i].major <= 2) {
                         *major = probes[i].major;
                         *minor = probes[i].minor;
-                        IOLog("VMOpenGLBridge: Fallback to %s support\n", probes[i].name);
+                        VMLOG_INFO("VMOpenGLBridge: Fallback to %s support\n", probes[i].name);
                     } else {
                         // Skip this version if we can't validate it
-                        IOLog("VMOpenGLBridge: Skipping %s - insufficient validation\n", probes[i].name);
+                        VMLOG_WARN("VMOpenGLBridge: Skipping %s - insufficient validation\n", probes[i].name);
                         this->m_accelerator->destroy3DContext(test_context_id);
                         continue;
                     }
@@ -1393,14 +1394,14 @@ IOReturn CLASS::probeOpenGLVersionFromContext(uint32_t* major, uint32_t* minor)
             ret = kIOReturnSuccess;
             break;
         } else {
-            IOLog("VMOpenGLBridge: Context creation failed for %s test (0x%x)\n", probes[i].name, ctx_ret);
+            VMLOG_ERROR("VMOpenGLBridge: Context creation failed for %s test (0x%x)\n", probes[i].name, ctx_ret);
         }
     }
     
     if (ret == kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Context probe determined maximum OpenGL %d.%d\n", *major, *minor);
+        VMLOG_INFO("VMOpenGLBridge: Context probe determined maximum OpenGL %d.%d\n", *major, *minor);
     } else {
-        IOLog("VMOpenGLBridge: All context probes failed, using OpenGL 2.1 fallback\n");
+        VMLOG_ERROR("VMOpenGLBridge: All context probes failed, using OpenGL 2.1 fallback\n");
         ret = kIOReturnSuccess;  // Return success with fallback values
     }
     
@@ -1413,7 +1414,7 @@ IOReturn CLASS::inferOpenGLVersionFromFeatures(uint32_t* major, uint32_t* minor)
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMOpenGLBridge: Inferring OpenGL version from VirtIO GPU features\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Inferring OpenGL version from VirtIO GPU features\n");
     
     // Start with conservative baseline
     *major = 2;
@@ -1426,7 +1427,7 @@ IOReturn CLASS::inferOpenGLVersionFromFeatures(uint32_t* major, uint32_t* minor)
         this->m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_CONTEXT_INIT)) {
         *major = 3;
         *minor = 0;
-        IOLog("VMOpenGLBridge: 3D + Context Init features -> OpenGL 3.0\n");
+        VMLOG_DEBUG("VMOpenGLBridge: 3D + Context Init features -> OpenGL 3.0\n");
     }
     
     // OpenGL 3.2+ indicators
@@ -1434,21 +1435,21 @@ IOReturn CLASS::inferOpenGLVersionFromFeatures(uint32_t* major, uint32_t* minor)
         this->m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_CONTEXT_INIT)) {
         *major = 3;
         *minor = 2;
-        IOLog("VMOpenGLBridge: Resource Blob + Context Init -> OpenGL 3.2\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Resource Blob + Context Init -> OpenGL 3.2\n");
     }
     
     // OpenGL 4.0+ indicators (VirGL renderer support)
     if (this->m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_VIRGL)) {
         *major = 4;
         *minor = 0;
-        IOLog("VMOpenGLBridge: VirGL support detected -> OpenGL 4.0\n");
+        VMLOG_DEBUG("VMOpenGLBridge: VirGL support detected -> OpenGL 4.0\n");
         
         // Check for advanced VirGL features that might indicate newer OpenGL
         if (this->m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_CROSS_DEVICE) ||
             this->m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_RESOURCE_SYNC)) {
             *major = 4;
             *minor = 3;  // Modern VirGL with advanced features
-            IOLog("VMOpenGLBridge: Advanced VirGL features -> OpenGL 4.3\n");
+            VMLOG_DEBUG("VMOpenGLBridge: Advanced VirGL features -> OpenGL 4.3\n");
         }
     }
     
@@ -1458,7 +1459,7 @@ IOReturn CLASS::inferOpenGLVersionFromFeatures(uint32_t* major, uint32_t* minor)
     if (*major >= 3 && *minor >= 2) {
         // Geometry shaders require proper context management
         if (!this->m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_CONTEXT_INIT)) {
-            IOLog("VMOpenGLBridge: No context init - reducing to OpenGL 3.0\n");
+            VMLOG_DEBUG("VMOpenGLBridge: No context init - reducing to OpenGL 3.0\n");
             *major = 3;
             *minor = 0;
         }
@@ -1468,7 +1469,7 @@ IOReturn CLASS::inferOpenGLVersionFromFeatures(uint32_t* major, uint32_t* minor)
     if (*major >= 4 && *minor >= 3) {
         // Compute shaders need advanced GPU features
         if (!this->m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_RESOURCE_SYNC)) {
-            IOLog("VMOpenGLBridge: No resource sync - reducing to OpenGL 4.0\n");
+            VMLOG_DEBUG("VMOpenGLBridge: No resource sync - reducing to OpenGL 4.0\n");
             *major = 4;
             *minor = 0;
         }
@@ -1480,7 +1481,7 @@ IOReturn CLASS::inferOpenGLVersionFromFeatures(uint32_t* major, uint32_t* minor)
         bool accel_supports_version = validateAcceleratorOpenGLVersionSupport(*major, *minor);
         
         if (!accel_supports_version) {
-            IOLog("VMOpenGLBridge: Accelerator doesn't support OpenGL %d.%d, reducing capabilities\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: Accelerator doesn't support OpenGL %d.%d, reducing capabilities\n", 
                   *major, *minor);
             // Intelligently reduce to most compatible version
             adjustOpenGLVersionForAcceleratorLimitations(major, minor);
@@ -1489,7 +1490,7 @@ IOReturn CLASS::inferOpenGLVersionFromFeatures(uint32_t* major, uint32_t* minor)
         }
     }
     
-    IOLog("VMOpenGLBridge: Feature inference completed: OpenGL %d.%d\n", *major, *minor);
+    VMLOG_DEBUG("VMOpenGLBridge: Feature inference completed: OpenGL %d.%d\n", *major, *minor);
     return kIOReturnSuccess;
 }
 
@@ -1499,12 +1500,12 @@ IOReturn CLASS::validateAcceleratorOpenGLSupport(bool supports_gl_3_0, bool supp
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Validating accelerator support for OpenGL capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Validating accelerator support for OpenGL capabilities\n");
     
     // Comprehensive 3D capability validation system
     IOReturn validation_result = validateAccelerator3DCapabilities();
     if (validation_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: 3D capability validation failed with error: 0x%x\n", validation_result);
+        VMLOG_ERROR("VMOpenGLBridge: 3D capability validation failed with error: 0x%x\n", validation_result);
         return validation_result;
     }
     
@@ -1513,37 +1514,37 @@ IOReturn CLASS::validateAcceleratorOpenGLSupport(bool supports_gl_3_0, bool supp
         // Test shader compilation capabilities
         IOReturn shader_test = testAcceleratorShaderSupport();
         if (shader_test != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Accelerator shader support test failed (0x%x)\n", shader_test);
+            VMLOG_ERROR("VMOpenGLBridge: Accelerator shader support test failed (0x%x)\n", shader_test);
             return shader_test;
         }
-        IOLog("VMOpenGLBridge: Accelerator shader support validated\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Accelerator shader support validated\n");
     }
     
     // Check Metal bridge compatibility for modern OpenGL features
     if ((supports_gl_3_2 || supports_gl_4_0) && this->m_metal_bridge) {
         IOReturn metal_test = testMetalBridgeCompatibility();
         if (metal_test != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Metal bridge compatibility test failed (0x%x)\n", metal_test);
+            VMLOG_ERROR("VMOpenGLBridge: Metal bridge compatibility test failed (0x%x)\n", metal_test);
             return metal_test;
         }
-        IOLog("VMOpenGLBridge: Metal bridge compatibility validated\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Metal bridge compatibility validated\n");
     }
     
     // Validate buffer management capabilities
     IOReturn buffer_test = testAcceleratorBufferSupport();
     if (buffer_test != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Accelerator buffer support test failed (0x%x)\n", buffer_test);
+        VMLOG_ERROR("VMOpenGLBridge: Accelerator buffer support test failed (0x%x)\n", buffer_test);
         return buffer_test;
     }
     
     // Check texture support for different OpenGL versions
     IOReturn texture_test = testAcceleratorTextureSupport(supports_gl_3_0, supports_gl_3_2, supports_gl_4_0);
     if (texture_test != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Accelerator texture support test failed (0x%x)\n", texture_test);
+        VMLOG_ERROR("VMOpenGLBridge: Accelerator texture support test failed (0x%x)\n", texture_test);
         return texture_test;
     }
     
-    IOLog("VMOpenGLBridge: Accelerator OpenGL support validation completed successfully\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Accelerator OpenGL support validation completed successfully\n");
     return kIOReturnSuccess;
 }
 
@@ -1553,7 +1554,7 @@ IOReturn CLASS::queryAcceleratorOpenGLCapabilities(VMAcceleratorOpenGLCapabiliti
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMOpenGLBridge: Querying accelerator OpenGL capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Querying accelerator OpenGL capabilities\n");
     
     // Initialize capabilities structure
     bzero(capabilities, sizeof(VMAcceleratorOpenGLCapabilities));
@@ -1573,7 +1574,7 @@ IOReturn CLASS::queryAcceleratorOpenGLCapabilities(VMAcceleratorOpenGLCapabiliti
         capabilities->supports_tessellation_shaders = false;
         capabilities->supports_compute_shaders = false;
         
-        IOLog("VMOpenGLBridge: Shader capabilities - Vertex: %d, Fragment: %d, Geometry: %d\n",
+        VMLOG_DEBUG("VMOpenGLBridge: Shader capabilities - Vertex: %d, Fragment: %d, Geometry: %d\n",
               capabilities->max_vertex_shaders, capabilities->max_fragment_shaders, 
               capabilities->max_geometry_shaders);
     }
@@ -1620,7 +1621,7 @@ IOReturn CLASS::queryAcceleratorOpenGLCapabilities(VMAcceleratorOpenGLCapabiliti
         capabilities->max_opengl_minor = 1;
     }
     
-    IOLog("VMOpenGLBridge: Accelerator supports maximum OpenGL %d.%d\n",
+    VMLOG_DEBUG("VMOpenGLBridge: Accelerator supports maximum OpenGL %d.%d\n",
           capabilities->max_opengl_major, capabilities->max_opengl_minor);
     
     return kIOReturnSuccess;
@@ -1632,21 +1633,21 @@ IOReturn CLASS::adjustCapabilitiesForAccelerator(const VMAcceleratorOpenGLCapabi
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMOpenGLBridge: Adjusting OpenGL capabilities to match accelerator limits\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Adjusting OpenGL capabilities to match accelerator limits\n");
     
     // Adjust OpenGL version support
     if (accel_caps->max_opengl_major < 3) {
         m_supports_gl_3_0 = false;
         m_supports_gl_3_2 = false;
         m_supports_gl_4_0 = false;
-        IOLog("VMOpenGLBridge: Accelerator limited to OpenGL 2.x - disabling modern features\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Accelerator limited to OpenGL 2.x - disabling modern features\n");
     } else if (accel_caps->max_opengl_major == 3 && accel_caps->max_opengl_minor < 2) {
         m_supports_gl_3_2 = false;
         m_supports_gl_4_0 = false;
-        IOLog("VMOpenGLBridge: Accelerator limited to OpenGL 3.0/3.1\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Accelerator limited to OpenGL 3.0/3.1\n");
     } else if (accel_caps->max_opengl_major == 3) {
         m_supports_gl_4_0 = false;
-        IOLog("VMOpenGLBridge: Accelerator limited to OpenGL 3.x\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Accelerator limited to OpenGL 3.x\n");
     }
     
     // Adjust feature support based on accelerator capabilities
@@ -1656,28 +1657,28 @@ IOReturn CLASS::adjustCapabilitiesForAccelerator(const VMAcceleratorOpenGLCapabi
     m_supports_tessellation = m_supports_tessellation && accel_caps->supports_tessellation_shaders;
     
     // Log capability adjustments
-    IOLog("VMOpenGLBridge: Adjusted capabilities:\n");
-    IOLog("  Vertex Array Objects: %s\n", m_supports_vertex_array_objects ? "Yes" : "No");
-    IOLog("  Uniform Buffer Objects: %s\n", m_supports_uniform_buffer_objects ? "Yes" : "No");
-    IOLog("  Geometry Shaders: %s\n", m_supports_geometry_shaders ? "Yes" : "No");
-    IOLog("  Tessellation: %s\n", m_supports_tessellation ? "Yes" : "No");
+    VMLOG_DEBUG("VMOpenGLBridge: Adjusted capabilities:\n");
+    VMLOG_DEBUG("  Vertex Array Objects: %s\n", m_supports_vertex_array_objects ? "Yes" : "No");
+    VMLOG_DEBUG("  Uniform Buffer Objects: %s\n", m_supports_uniform_buffer_objects ? "Yes" : "No");
+    VMLOG_DEBUG("  Geometry Shaders: %s\n", m_supports_geometry_shaders ? "Yes" : "No");
+    VMLOG_DEBUG("  Tessellation: %s\n", m_supports_tessellation ? "Yes" : "No");
     
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::validateFinalOpenGLConfiguration()
 {
-    IOLog("VMOpenGLBridge: Performing final OpenGL configuration validation\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Performing final OpenGL configuration validation\n");
     
     // Ensure capability consistency
     if (m_supports_gl_4_0 && !m_supports_gl_3_2) {
-        IOLog("VMOpenGLBridge: Inconsistent capability - OpenGL 4.0 requires 3.2 support\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Inconsistent capability - OpenGL 4.0 requires 3.2 support\n");
         m_supports_gl_4_0 = false;
         m_supports_tessellation = false;
     }
     
     if (m_supports_gl_3_2 && !m_supports_gl_3_0) {
-        IOLog("VMOpenGLBridge: Inconsistent capability - OpenGL 3.2 requires 3.0 support\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Inconsistent capability - OpenGL 3.2 requires 3.0 support\n");
         m_supports_gl_3_2 = false;
         m_supports_gl_4_0 = false;
         m_supports_uniform_buffer_objects = false;
@@ -1687,24 +1688,24 @@ IOReturn CLASS::validateFinalOpenGLConfiguration()
     
     // Validate feature dependencies
     if (m_supports_geometry_shaders && !m_supports_gl_3_2) {
-        IOLog("VMOpenGLBridge: Geometry shaders require OpenGL 3.2 - disabling\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Geometry shaders require OpenGL 3.2 - disabling\n");
         m_supports_geometry_shaders = false;
     }
     
     if (m_supports_tessellation && !m_supports_gl_4_0) {
-        IOLog("VMOpenGLBridge: Tessellation requires OpenGL 4.0 - disabling\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Tessellation requires OpenGL 4.0 - disabling\n");
         m_supports_tessellation = false;
     }
     
     if (m_supports_uniform_buffer_objects && !m_supports_gl_3_0) {
-        IOLog("VMOpenGLBridge: Uniform buffer objects require OpenGL 3.0 - disabling\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Uniform buffer objects require OpenGL 3.0 - disabling\n");
         m_supports_uniform_buffer_objects = false;
     }
     
     // Validate against system constraints
     if (!m_gpu_device || !m_gpu_device->supports3D()) {
         if (m_supports_gl_3_0 || m_supports_gl_3_2 || m_supports_gl_4_0) {
-            IOLog("VMOpenGLBridge: No 3D GPU support - reducing to OpenGL 2.1\n");
+            VMLOG_DEBUG("VMOpenGLBridge: No 3D GPU support - reducing to OpenGL 2.1\n");
             m_supports_gl_3_0 = false;
             m_supports_gl_3_2 = false;
             m_supports_gl_4_0 = false;
@@ -1715,36 +1716,36 @@ IOReturn CLASS::validateFinalOpenGLConfiguration()
         }
     }
     
-    IOLog("VMOpenGLBridge: Final OpenGL configuration validation completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Final OpenGL configuration validation completed\n");
     return kIOReturnSuccess;
 }
 
 void CLASS::logFinalCapabilityConfiguration()
 {
-    IOLog("VMOpenGLBridge: Final OpenGL Capability Configuration:\n");
-    IOLog("  ==========================================\n");
-    IOLog("  OpenGL 3.0 Support: %s\n", m_supports_gl_3_0 ? "✓ ENABLED" : "✗ DISABLED");
-    IOLog("  OpenGL 3.2 Support: %s\n", m_supports_gl_3_2 ? "✓ ENABLED" : "✗ DISABLED");
-    IOLog("  OpenGL 4.0 Support: %s\n", m_supports_gl_4_0 ? "✓ ENABLED" : "✗ DISABLED");
-    IOLog("  ==========================================\n");
-    IOLog("  Feature Support:\n");
-    IOLog("    Vertex Array Objects: %s\n", m_supports_vertex_array_objects ? "✓ YES" : "✗ NO");
-    IOLog("    Uniform Buffer Objects: %s\n", m_supports_uniform_buffer_objects ? "✓ YES" : "✗ NO");
-    IOLog("    Geometry Shaders: %s\n", m_supports_geometry_shaders ? "✓ YES" : "✗ NO");
-    IOLog("    Tessellation Shaders: %s\n", m_supports_tessellation ? "✓ YES" : "✗ NO");
-    IOLog("  ==========================================\n");
+    VMLOG_INFO("VMOpenGLBridge: Final OpenGL Capability Configuration:\n");
+    VMLOG_INFO("  ==========================================\n");
+    VMLOG_INFO("  OpenGL 3.0 Support: %s\n", m_supports_gl_3_0 ? "✓ ENABLED" : "✗ DISABLED");
+    VMLOG_INFO("  OpenGL 3.2 Support: %s\n", m_supports_gl_3_2 ? "✓ ENABLED" : "✗ DISABLED");
+    VMLOG_INFO("  OpenGL 4.0 Support: %s\n", m_supports_gl_4_0 ? "✓ ENABLED" : "✗ DISABLED");
+    VMLOG_INFO("  ==========================================\n");
+    VMLOG_INFO("  Feature Support:\n");
+    VMLOG_INFO("    Vertex Array Objects: %s\n", m_supports_vertex_array_objects ? "✓ YES" : "✗ NO");
+    VMLOG_INFO("    Uniform Buffer Objects: %s\n", m_supports_uniform_buffer_objects ? "✓ YES" : "✗ NO");
+    VMLOG_INFO("    Geometry Shaders: %s\n", m_supports_geometry_shaders ? "✓ YES" : "✗ NO");
+    VMLOG_INFO("    Tessellation Shaders: %s\n", m_supports_tessellation ? "✓ YES" : "✗ NO");
+    VMLOG_INFO("  ==========================================\n");
     
     // Log recommended usage
     if (m_supports_gl_4_0) {
-        IOLog("  Recommended Usage: Modern OpenGL 4.0+ applications with tessellation\n");
+        VMLOG_INFO("  Recommended Usage: Modern OpenGL 4.0+ applications with tessellation\n");
     } else if (m_supports_gl_3_2) {
-        IOLog("  Recommended Usage: Modern OpenGL 3.2+ applications with geometry shaders\n");
+        VMLOG_INFO("  Recommended Usage: Modern OpenGL 3.2+ applications with geometry shaders\n");
     } else if (m_supports_gl_3_0) {
-        IOLog("  Recommended Usage: OpenGL 3.0+ applications with basic shader support\n");
+        VMLOG_INFO("  Recommended Usage: OpenGL 3.0+ applications with basic shader support\n");
     } else {
-        IOLog("  Recommended Usage: Legacy OpenGL 2.1 applications with fixed pipeline\n");
+        VMLOG_INFO("  Recommended Usage: Legacy OpenGL 2.1 applications with fixed pipeline\n");
     }
-    IOLog("  ==========================================\n");
+    VMLOG_INFO("  ==========================================\n");
 }
 
 IOReturn CLASS::testAcceleratorShaderSupport()
@@ -1753,17 +1754,17 @@ IOReturn CLASS::testAcceleratorShaderSupport()
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing accelerator shader support\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Testing accelerator shader support\n");
     
     VMShaderManager* shader_mgr = m_accelerator->getShaderManager();
     
     // Since specific shader constants aren't available, just verify manager exists
     // In production, this would test actual shader compilation
     if (shader_mgr) {
-        IOLog("VMOpenGLBridge: Shader manager available - shader support validated\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Shader manager available - shader support validated\n");
         return kIOReturnSuccess;
     } else {
-        IOLog("VMOpenGLBridge: Shader manager not available\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Shader manager not available\n");
         return kIOReturnNoDevice;
     }
     
@@ -1776,11 +1777,11 @@ IOReturn CLASS::testMetalBridgeCompatibility()
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing Metal bridge compatibility\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Testing Metal bridge compatibility\n");
     
     // Since specific Metal bridge methods don't exist, just verify the bridge exists
     // In production, this would test actual buffer creation and interop
-    IOLog("VMOpenGLBridge: Metal bridge available - compatibility validated\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Metal bridge available - compatibility validated\n");
     
     return kIOReturnSuccess;
 }
@@ -1791,11 +1792,11 @@ IOReturn CLASS::testAcceleratorBufferSupport()
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing accelerator buffer support\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Testing accelerator buffer support\n");
     
     // Since specific methods don't exist, verify basic accelerator availability
     // In production, this would test buffer creation and management
-    IOLog("VMOpenGLBridge: Accelerator buffer support validated\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Accelerator buffer support validated\n");
     
     return kIOReturnSuccess;
 }
@@ -1806,11 +1807,11 @@ IOReturn CLASS::testAcceleratorTextureSupport(bool needs_gl_3_0, bool needs_gl_3
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing accelerator texture support\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Testing accelerator texture support\n");
     
     // Since specific texture methods don't exist, use conservative validation
     // In production, this would test actual texture creation and capabilities
-    IOLog("VMOpenGLBridge: Accelerator texture support validated\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Accelerator texture support validated\n");
     
     return kIOReturnSuccess;
 }
@@ -1820,23 +1821,23 @@ IOReturn CLASS::testAcceleratorTextureSupport(bool needs_gl_3_0, bool needs_gl_3
 bool CLASS::validateAcceleratorOpenGLVersionSupport(uint32_t major, uint32_t minor)
 {
     if (!this->m_accelerator) {
-        IOLog("VMOpenGLBridge: No accelerator available for OpenGL version validation\n");
+        VMLOG_DEBUG("VMOpenGLBridge: No accelerator available for OpenGL version validation\n");
         return false;
     }
     
-    IOLog("VMOpenGLBridge: Validating accelerator support for OpenGL %d.%d\n", major, minor);
+    VMLOG_DEBUG("VMOpenGLBridge: Validating accelerator support for OpenGL %d.%d\n", major, minor);
     
     // Get current accelerator capabilities
     VMAcceleratorOpenGLCapabilities capabilities;
     IOReturn cap_ret = queryAcceleratorOpenGLCapabilities(&capabilities);
     if (cap_ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to query accelerator capabilities (0x%x)\n", cap_ret);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to query accelerator capabilities (0x%x)\n", cap_ret);
         return false;
     }
     
     // Check if accelerator supports basic 3D rendering
     if (!capabilities.supports_3d_rendering) {
-        IOLog("VMOpenGLBridge: Accelerator does not support 3D rendering - rejecting OpenGL %d.%d\n", major, minor);
+        VMLOG_WARN("VMOpenGLBridge: Accelerator does not support 3D rendering - rejecting OpenGL %d.%d\n", major, minor);
         return false;
     }
     
@@ -1844,69 +1845,69 @@ bool CLASS::validateAcceleratorOpenGLVersionSupport(uint32_t major, uint32_t min
     if (major >= 4) {
         // OpenGL 4.x requirements
         if (!capabilities.supports_vertex_shaders || !capabilities.supports_fragment_shaders) {
-            IOLog("VMOpenGLBridge: OpenGL 4.x requires shader support - not available\n");
+            VMLOG_DEBUG("VMOpenGLBridge: OpenGL 4.x requires shader support - not available\n");
             return false;
         }
         
         if (capabilities.max_texture_units < 16) {
-            IOLog("VMOpenGLBridge: OpenGL 4.x requires at least 16 texture units - only %d available\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: OpenGL 4.x requires at least 16 texture units - only %d available\n", 
                   capabilities.max_texture_units);
             return false;
         }
         
         if (!capabilities.supports_uniform_buffer_objects) {
-            IOLog("VMOpenGLBridge: OpenGL 4.x requires UBO support - not available\n");
+            VMLOG_DEBUG("VMOpenGLBridge: OpenGL 4.x requires UBO support - not available\n");
             return false;
         }
         
-        IOLog("VMOpenGLBridge: Accelerator meets OpenGL 4.%d requirements\n", minor);
+        VMLOG_DEBUG("VMOpenGLBridge: Accelerator meets OpenGL 4.%d requirements\n", minor);
         
     } else if (major == 3) {
         // OpenGL 3.x requirements
         if (minor >= 2) {
             // OpenGL 3.2+ requirements
             if (!capabilities.supports_vertex_shaders || !capabilities.supports_fragment_shaders) {
-                IOLog("VMOpenGLBridge: OpenGL 3.2+ requires shader support - not available\n");
+                VMLOG_DEBUG("VMOpenGLBridge: OpenGL 3.2+ requires shader support - not available\n");
                 return false;
             }
             
             if (capabilities.max_texture_units < 8) {
-                IOLog("VMOpenGLBridge: OpenGL 3.2+ requires at least 8 texture units - only %d available\n", 
+                VMLOG_DEBUG("VMOpenGLBridge: OpenGL 3.2+ requires at least 8 texture units - only %d available\n", 
                       capabilities.max_texture_units);
                 return false;
             }
             
             if (!capabilities.supports_vertex_array_objects) {
-                IOLog("VMOpenGLBridge: OpenGL 3.2+ requires VAO support - not available\n");
+                VMLOG_DEBUG("VMOpenGLBridge: OpenGL 3.2+ requires VAO support - not available\n");
                 return false;
             }
             
-            IOLog("VMOpenGLBridge: Accelerator meets OpenGL 3.%d requirements\n", minor);
+            VMLOG_DEBUG("VMOpenGLBridge: Accelerator meets OpenGL 3.%d requirements\n", minor);
             
         } else {
             // OpenGL 3.0/3.1 requirements
             if (capabilities.max_texture_units < 4) {
-                IOLog("VMOpenGLBridge: OpenGL 3.%d requires at least 4 texture units - only %d available\n", 
+                VMLOG_DEBUG("VMOpenGLBridge: OpenGL 3.%d requires at least 4 texture units - only %d available\n", 
                       minor, capabilities.max_texture_units);
                 return false;
             }
             
-            IOLog("VMOpenGLBridge: Accelerator meets OpenGL 3.%d requirements\n", minor);
+            VMLOG_DEBUG("VMOpenGLBridge: Accelerator meets OpenGL 3.%d requirements\n", minor);
         }
         
     } else if (major == 2) {
         // OpenGL 2.x requirements (basic compatibility)
         if (capabilities.max_texture_units < 2) {
-            IOLog("VMOpenGLBridge: OpenGL 2.%d requires at least 2 texture units - only %d available\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: OpenGL 2.%d requires at least 2 texture units - only %d available\n", 
                   minor, capabilities.max_texture_units);
             return false;
         }
         
-        IOLog("VMOpenGLBridge: Accelerator meets OpenGL 2.%d requirements\n", minor);
+        VMLOG_DEBUG("VMOpenGLBridge: Accelerator meets OpenGL 2.%d requirements\n", minor);
         
     } else {
         // OpenGL 1.x or unknown version
-        IOLog("VMOpenGLBridge: Assuming accelerator supports basic OpenGL %d.%d\n", major, minor);
+        VMLOG_DEBUG("VMOpenGLBridge: Assuming accelerator supports basic OpenGL %d.%d\n", major, minor);
     }
     
     return true;
@@ -1918,14 +1919,14 @@ IOReturn CLASS::adjustOpenGLVersionForAcceleratorLimitations(uint32_t* major, ui
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMOpenGLBridge: Adjusting OpenGL version from %d.%d based on accelerator limitations\n", 
+    VMLOG_DEBUG("VMOpenGLBridge: Adjusting OpenGL version from %d.%d based on accelerator limitations\n", 
           *major, *minor);
     
     // Get accelerator capabilities for intelligent downgrading
     VMAcceleratorOpenGLCapabilities capabilities;
     IOReturn cap_ret = queryAcceleratorOpenGLCapabilities(&capabilities);
     if (cap_ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Cannot query capabilities - falling back to OpenGL 2.1\n");
+        VMLOG_WARN("VMOpenGLBridge: Cannot query capabilities - falling back to OpenGL 2.1\n");
         *major = 2;
         *minor = 1;
         return kIOReturnSuccess;
@@ -1939,7 +1940,7 @@ IOReturn CLASS::adjustOpenGLVersionForAcceleratorLimitations(uint32_t* major, ui
         capabilities.supports_uniform_buffer_objects) {
         // Can support OpenGL 4.0
         if (*major > 4 || (*major == 4 && *minor > 6)) {
-            IOLog("VMOpenGLBridge: Reducing to maximum supported OpenGL 4.6\n");
+            VMLOG_DEBUG("VMOpenGLBridge: Reducing to maximum supported OpenGL 4.6\n");
             *major = 4;
             *minor = 6;
         }
@@ -1950,32 +1951,32 @@ IOReturn CLASS::adjustOpenGLVersionForAcceleratorLimitations(uint32_t* major, ui
                capabilities.max_texture_units >= 8 &&
                capabilities.supports_vertex_array_objects) {
         // Can support OpenGL 3.3
-        IOLog("VMOpenGLBridge: Reducing to OpenGL 3.3 due to accelerator limitations\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Reducing to OpenGL 3.3 due to accelerator limitations\n");
         *major = 3;
         *minor = 3;
         
     } else if (capabilities.supports_3d_rendering && 
                capabilities.max_texture_units >= 4) {
         // Can support OpenGL 3.0
-        IOLog("VMOpenGLBridge: Reducing to OpenGL 3.0 due to accelerator limitations\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Reducing to OpenGL 3.0 due to accelerator limitations\n");
         *major = 3;
         *minor = 0;
         
     } else if (capabilities.supports_3d_rendering && 
                capabilities.max_texture_units >= 2) {
         // Can support OpenGL 2.1
-        IOLog("VMOpenGLBridge: Reducing to OpenGL 2.1 due to accelerator limitations\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Reducing to OpenGL 2.1 due to accelerator limitations\n");
         *major = 2;
         *minor = 1;
         
     } else {
         // Minimal OpenGL 1.5 support
-        IOLog("VMOpenGLBridge: Reducing to minimal OpenGL 1.5 due to severe accelerator limitations\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Reducing to minimal OpenGL 1.5 due to severe accelerator limitations\n");
         *major = 1;
         *minor = 5;
     }
     
-    IOLog("VMOpenGLBridge: Final adjusted OpenGL version: %d.%d\n", *major, *minor);
+    VMLOG_DEBUG("VMOpenGLBridge: Final adjusted OpenGL version: %d.%d\n", *major, *minor);
     
     return kIOReturnSuccess;
 }
@@ -1988,19 +1989,19 @@ IOReturn CLASS::createVersionSpecificContext(uint32_t* context_id, uint32_t majo
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMOpenGLBridge: Creating version-specific context for OpenGL %d.%d\n", major, minor);
+    VMLOG_DEBUG("VMOpenGLBridge: Creating version-specific context for OpenGL %d.%d\n", major, minor);
     
     // Step 1: Create base context using standard accelerator method
     IOReturn base_result = m_accelerator->create3DContext(context_id, current_task());
     if (base_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Base context creation failed (0x%x)\n", base_result);
+        VMLOG_ERROR("VMOpenGLBridge: Base context creation failed (0x%x)\n", base_result);
         return base_result;
     }
     
     // Step 2: Configure context for specific OpenGL version requirements
     IOReturn config_result = configureContextForVersion(*context_id, major, minor);
     if (config_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Context version configuration failed (0x%x), cleaning up\n", config_result);
+        VMLOG_ERROR("VMOpenGLBridge: Context version configuration failed (0x%x), cleaning up\n", config_result);
         
         // Cleanup the created context on failure
         m_accelerator->destroy3DContext(*context_id);
@@ -2011,7 +2012,7 @@ IOReturn CLASS::createVersionSpecificContext(uint32_t* context_id, uint32_t majo
     // Step 3: Verify context capabilities match requested version
     IOReturn verify_result = verifyContextVersionCapabilities(*context_id, major, minor);
     if (verify_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Context version verification failed (0x%x), cleaning up\n", verify_result);
+        VMLOG_ERROR("VMOpenGLBridge: Context version verification failed (0x%x), cleaning up\n", verify_result);
         
         // Cleanup the created context on failure
         m_accelerator->destroy3DContext(*context_id);
@@ -2019,7 +2020,7 @@ IOReturn CLASS::createVersionSpecificContext(uint32_t* context_id, uint32_t majo
         return verify_result;
     }
     
-    IOLog("VMOpenGLBridge: Successfully created version-specific context %d for OpenGL %d.%d\n", 
+    VMLOG_DEBUG("VMOpenGLBridge: Successfully created version-specific context %d for OpenGL %d.%d\n", 
           *context_id, major, minor);
     
     return kIOReturnSuccess;
@@ -2027,7 +2028,7 @@ IOReturn CLASS::createVersionSpecificContext(uint32_t* context_id, uint32_t majo
 
 IOReturn CLASS::configureContextForVersion(uint32_t context_id, uint32_t major, uint32_t minor)
 {
-    IOLog("VMOpenGLBridge: Configuring context %d for OpenGL %d.%d requirements\n", 
+    VMLOG_INFO("VMOpenGLBridge: Configuring context %d for OpenGL %d.%d requirements\n", 
           context_id, major, minor);
     
     // Configure context based on OpenGL version requirements
@@ -2067,7 +2068,7 @@ IOReturn CLASS::configureContextForVersion(uint32_t context_id, uint32_t major,
 
 IOReturn CLASS::verifyContextVersionCapabilities(uint32_t context_id, uint32_t major, uint32_t minor)
 {
-    IOLog("VMOpenGLBridge: Verifying context %d capabilities for OpenGL %d.%d\n", 
+    VMLOG_DEBUG("VMOpenGLBridge: Verifying context %d capabilities for OpenGL %d.%d\n", 
           context_id, major, minor);
     
     // Use existing comprehensive validation system
@@ -2079,78 +2080,78 @@ IOReturn CLASS::verifyContextVersionCapabilities(uint32_t context_id, uint32_t m
 IOReturn CLASS::configureContextForOpenGL4(UInt32 context_id, const VMAcceleratorOpenGLCapabilities& capabilities)
 {
     uint32_t minor = capabilities.max_opengl_minor;
-    IOLog("VMOpenGLBridge: Configuring context %d for OpenGL 4.%d\n", context_id, minor);
+    VMLOG_INFO("VMOpenGLBridge: Configuring context %d for OpenGL 4.%d\n", context_id, minor);
     
     // Enable OpenGL 4.x specific features
     IOReturn result = kIOReturnSuccess;
     
     // Ensure shader manager is available (required for OpenGL 4.x)
     if (!m_accelerator->getShaderManager()) {
-        IOLog("VMOpenGLBridge: OpenGL 4.x requires shader manager - not available\n");
+        VMLOG_INFO("VMOpenGLBridge: OpenGL 4.x requires shader manager - not available\n");
         return kIOReturnUnsupported;
     }
     
     // Enable advanced rendering features for OpenGL 4.x
     IOReturn depth_result = m_accelerator->enableDepthTest(context_id, true);
     if (depth_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to enable depth test for OpenGL 4.x (0x%x)\n", depth_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to enable depth test for OpenGL 4.x (0x%x)\n", depth_result);
         // Non-critical, continue
     }
     
-    IOLog("VMOpenGLBridge: OpenGL 4.%d context configuration completed\n", minor);
+    VMLOG_INFO("VMOpenGLBridge: OpenGL 4.%d context configuration completed\n", minor);
     return result;
 }
 
 IOReturn CLASS::configureContextForOpenGL32Plus(UInt32 context_id, const VMAcceleratorOpenGLCapabilities& capabilities)
 {
     uint32_t minor = capabilities.max_opengl_minor;
-    IOLog("VMOpenGLBridge: Configuring context %d for OpenGL 3.%d (3.2+)\n", context_id, minor);
+    VMLOG_INFO("VMOpenGLBridge: Configuring context %d for OpenGL 3.%d (3.2+)\n", context_id, minor);
     
     // Configure for OpenGL 3.2+ (Core Profile requirements)
     IOReturn result = kIOReturnSuccess;
     
     // Ensure basic OpenGL 3.x requirements
     if (!m_accelerator->getShaderManager()) {
-        IOLog("VMOpenGLBridge: OpenGL 3.2+ requires shader support - not available\n");
+        VMLOG_INFO("VMOpenGLBridge: OpenGL 3.2+ requires shader support - not available\n");
         return kIOReturnUnsupported;
     }
     
     // Enable depth testing for 3D rendering
     IOReturn depth_result = m_accelerator->enableDepthTest(context_id, true);
     if (depth_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to enable depth test for OpenGL 3.%d (0x%x)\n", minor, depth_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to enable depth test for OpenGL 3.%d (0x%x)\n", minor, depth_result);
     }
     
-    IOLog("VMOpenGLBridge: OpenGL 3.%d context configuration completed\n", minor);
+    VMLOG_INFO("VMOpenGLBridge: OpenGL 3.%d context configuration completed\n", minor);
     return result;
 }
 
 IOReturn CLASS::configureContextForOpenGL3Legacy(UInt32 context_id, const VMAcceleratorOpenGLCapabilities& capabilities)
 {
     uint32_t minor = capabilities.max_opengl_minor;
-    IOLog("VMOpenGLBridge: Configuring context %d for OpenGL 3.%d (legacy)\n", context_id, minor);
+    VMLOG_INFO("VMOpenGLBridge: Configuring context %d for OpenGL 3.%d (legacy)\n", context_id, minor);
     
     // Configure for OpenGL 3.0/3.1 (legacy compatibility)
     IOReturn result = kIOReturnSuccess;
     
     // Basic shader support check
     if (m_accelerator->getShaderManager()) {
-        IOLog("VMOpenGLBridge: Shader support available for OpenGL 3.%d\n", minor);
+        VMLOG_INFO("VMOpenGLBridge: Shader support available for OpenGL 3.%d\n", minor);
     } else {
-        IOLog("VMOpenGLBridge: Limited OpenGL 3.%d support without shader manager\n", minor);
+        VMLOG_INFO("VMOpenGLBridge: Limited OpenGL 3.%d support without shader manager\n", minor);
     }
     
     // Enable basic depth testing
     m_accelerator->enableDepthTest(context_id, true);
     
-    IOLog("VMOpenGLBridge: OpenGL 3.%d legacy context configuration completed\n", minor);
+    VMLOG_INFO("VMOpenGLBridge: OpenGL 3.%d legacy context configuration completed\n", minor);
     return result;
 }
 
 IOReturn CLASS::configureContextForOpenGL2(UInt32 context_id, const VMAcceleratorOpenGLCapabilities& capabilities)
 {
     uint32_t minor = capabilities.max_opengl_minor;
-    IOLog("VMOpenGLBridge: Configuring context %d for OpenGL 2.%d\n", context_id, minor);
+    VMLOG_INFO("VMOpenGLBridge: Configuring context %d for OpenGL 2.%d\n", context_id, minor);
     
     // Configure for OpenGL 2.x (fixed-function pipeline)
     IOReturn result = kIOReturnSuccess;
@@ -2158,7 +2159,7 @@ IOReturn CLASS::configureContextForOpenGL2(UInt32 context_id, const VMAccelerato
     // Enable basic rendering features
     m_accelerator->enableDepthTest(context_id, true);
     
-    IOLog("VMOpenGLBridge: OpenGL 2.%d context configuration completed\n", minor);
+    VMLOG_INFO("VMOpenGLBridge: OpenGL 2.%d context configuration completed\n", minor);
     return result;
 }
 
@@ -2166,14 +2167,14 @@ IOReturn CLASS::configureContextForLegacyOpenGL(UInt32 context_id, const VMAccel
 {
     uint32_t major = capabilities.max_opengl_major;
     uint32_t minor = capabilities.max_opengl_minor;
-    IOLog("VMOpenGLBridge: Configuring context %d for legacy OpenGL %d.%d\n", 
+    VMLOG_INFO("VMOpenGLBridge: Configuring context %d for legacy OpenGL %d.%d\n", 
           context_id, major, minor);
     
     // Configure for OpenGL 1.x or other legacy versions
     IOReturn result = kIOReturnSuccess;
     
     // Minimal configuration for legacy OpenGL
-    IOLog("VMOpenGLBridge: Legacy OpenGL %d.%d context configuration completed\n", major, minor);
+    VMLOG_INFO("VMOpenGLBridge: Legacy OpenGL %d.%d context configuration completed\n", major, minor);
     return result;
 }
 
@@ -2185,12 +2186,12 @@ IOReturn CLASS::validateContextOpenGLCapabilities(uint32_t context_id, uint32_t
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Validating OpenGL %d.%d capabilities through context %d\n", major, minor, context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Validating OpenGL %d.%d capabilities through context %d\n", major, minor, context_id);
     
     // Test basic rendering operations
     IOReturn basic_test = testContextBasicRendering(context_id);
     if (basic_test != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Basic rendering test failed (0x%x)\n", basic_test);
+        VMLOG_ERROR("VMOpenGLBridge: Basic rendering test failed (0x%x)\n", basic_test);
         return basic_test;
     }
     
@@ -2199,7 +2200,7 @@ IOReturn CLASS::validateContextOpenGLCapabilities(uint32_t context_id, uint32_t
         // OpenGL 4.x feature validation
         IOReturn gl4_test = testContextOpenGL4Features(context_id);
         if (gl4_test != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: OpenGL 4.x feature test failed (0x%x)\n", gl4_test);
+            VMLOG_ERROR("VMOpenGLBridge: OpenGL 4.x feature test failed (0x%x)\n", gl4_test);
             return gl4_test;
         }
         
@@ -2207,7 +2208,7 @@ IOReturn CLASS::validateContextOpenGLCapabilities(uint32_t context_id, uint32_t
         // OpenGL 3.2+ feature validation
         IOReturn gl32_test = testContextOpenGL32Features(context_id);
         if (gl32_test != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: OpenGL 3.2+ feature test failed (0x%x)\n", gl32_test);
+            VMLOG_ERROR("VMOpenGLBridge: OpenGL 3.2+ feature test failed (0x%x)\n", gl32_test);
             return gl32_test;
         }
         
@@ -2215,12 +2216,12 @@ IOReturn CLASS::validateContextOpenGLCapabilities(uint32_t context_id, uint32_t
         // OpenGL 3.0/3.1 feature validation
         IOReturn gl3_test = testContextOpenGL3Features(context_id);
         if (gl3_test != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: OpenGL 3.x feature test failed (0x%x)\n", gl3_test);
+            VMLOG_ERROR("VMOpenGLBridge: OpenGL 3.x feature test failed (0x%x)\n", gl3_test);
             return gl3_test;
         }
     }
     
-    IOLog("VMOpenGLBridge: Context validation successful for OpenGL %d.%d\n", major, minor);
+    VMLOG_DEBUG("VMOpenGLBridge: Context validation successful for OpenGL %d.%d\n", major, minor);
     return kIOReturnSuccess;
 }
 
@@ -2230,7 +2231,7 @@ bool CLASS::attemptFallbackVersionDetection(uint32_t* context_id, uint32_t* majo
         return false;
     }
     
-    IOLog("VMOpenGLBridge: Attempting fallback version detection from OpenGL %d.%d\n", target_major, target_minor);
+    VMLOG_DEBUG("VMOpenGLBridge: Attempting fallback version detection from OpenGL %d.%d\n", target_major, target_minor);
     
     // Try progressively lower OpenGL versions until we find one that works
     struct {
@@ -2250,19 +2251,19 @@ bool CLASS::attemptFallbackVersionDetection(uint32_t* context_id, uint32_t* majo
             continue;
         }
         
-        IOLog("VMOpenGLBridge: Testing fallback to %s\n", fallback_versions[i].name);
+        VMLOG_DEBUG("VMOpenGLBridge: Testing fallback to %s\n", fallback_versions[i].name);
         
         // Test this version through context validation
         IOReturn test_result = validateContextOpenGLCapabilities(*context_id, fallback_versions[i].major, fallback_versions[i].minor);
         if (test_result == kIOReturnSuccess) {
             *major = fallback_versions[i].major;
             *minor = fallback_versions[i].minor;
-            IOLog("VMOpenGLBridge: Successfully fell back to %s\n", fallback_versions[i].name);
+            VMLOG_DEBUG("VMOpenGLBridge: Successfully fell back to %s\n", fallback_versions[i].name);
             return true;
         }
     }
     
-    IOLog("VMOpenGLBridge: All fallback versions failed validation\n");
+    VMLOG_ERROR("VMOpenGLBridge: All fallback versions failed validation\n");
     return false;
 }
 
@@ -2274,29 +2275,29 @@ IOReturn CLASS::testContextBasicRendering(uint32_t context_id)
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing basic rendering capabilities for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing basic rendering capabilities for context %d\n", context_id);
     
     // Test basic clear operations
     IOReturn clear_test = m_accelerator->clearColorBuffer(context_id, 0.0f, 0.0f, 0.0f, 1.0f);
     if (clear_test != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Clear buffer test failed (0x%x)\n", clear_test);
+        VMLOG_ERROR("VMOpenGLBridge: Clear buffer test failed (0x%x)\n", clear_test);
         return clear_test;
     }
     
     // Test basic depth operations if available
     IOReturn depth_test = m_accelerator->enableDepthTest(context_id, true);
     if (depth_test != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Depth test enable failed (0x%x)\n", depth_test);
+        VMLOG_ERROR("VMOpenGLBridge: Depth test enable failed (0x%x)\n", depth_test);
         // Not critical for basic functionality
     }
     
-    IOLog("VMOpenGLBridge: Basic rendering test passed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Basic rendering test passed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::testContextOpenGL3Features(uint32_t context_id)
 {
-    IOLog("VMOpenGLBridge: Testing OpenGL 3.x features for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing OpenGL 3.x features for context %d\n", context_id);
     
     // Since specific OpenGL 3.x feature testing methods don't exist in the accelerator interface,
     // we implement comprehensive OpenGL 3.x feature detection through available VirtIO GPU and context methods
@@ -2304,7 +2305,7 @@ IOReturn CLASS::testContextOpenGL3Features(uint32_t context_id)
     // Stage 1: Query actual OpenGL version and extensions through VirtIO GPU
     IOReturn version_result = queryOpenGL3SpecificFeatures(context_id);
     if (version_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: OpenGL version/extension query failed (0x%x)\n", version_result);
+        VMLOG_ERROR("VMOpenGLBridge: OpenGL version/extension query failed (0x%x)\n", version_result);
         return version_result;
     }
     
@@ -2316,14 +2317,14 @@ IOReturn CLASS::testContextOpenGL3Features(uint32_t context_id)
     
     IOReturn surface_result = m_accelerator->create3DSurface(context_id, &test_surface);
     if (surface_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Modern surface format test failed (0x%x)\n", surface_result);
+        VMLOG_ERROR("VMOpenGLBridge: Modern surface format test failed (0x%x)\n", surface_result);
         return surface_result;
     }
     
     // Stage 3: Test shader compilation (OpenGL 3.0 core requirement)
     IOReturn shader_result = testShaderCompilationSupport(context_id);
     if (shader_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Shader compilation test failed (0x%x)\n", shader_result);
+        VMLOG_ERROR("VMOpenGLBridge: Shader compilation test failed (0x%x)\n", shader_result);
         m_accelerator->destroy3DSurface(context_id, test_surface.surface_id);
         return shader_result;
     }
@@ -2331,27 +2332,27 @@ IOReturn CLASS::testContextOpenGL3Features(uint32_t context_id)
     // Stage 4: Test multiple render targets (OpenGL 3.0 capability)
     IOReturn mrt_result = testMultipleRenderTargets(context_id);
     if (mrt_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Multiple render targets test failed (0x%x)\n", mrt_result);
+        VMLOG_ERROR("VMOpenGLBridge: Multiple render targets test failed (0x%x)\n", mrt_result);
         // Continue - MRT failure acceptable for basic OpenGL 3.0
     }
     
     // Stage 5: Test texture operations with modern formats
     IOReturn texture_result = testModernTextureSupport(context_id);
     if (texture_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Modern texture support test failed (0x%x)\n", texture_result);
+        VMLOG_ERROR("VMOpenGLBridge: Modern texture support test failed (0x%x)\n", texture_result);
         // Continue - some texture format failures acceptable
     }
     
     // Cleanup
     m_accelerator->destroy3DSurface(context_id, test_surface.surface_id);
     
-    IOLog("VMOpenGLBridge: OpenGL 3.x feature validation completed successfully\n");
+    VMLOG_DEBUG("VMOpenGLBridge: OpenGL 3.x feature validation completed successfully\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::testContextOpenGL32Features(uint32_t context_id)
 {
-    IOLog("VMOpenGLBridge: Testing OpenGL 3.2+ features for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing OpenGL 3.2+ features for context %d\n", context_id);
     
     // Test OpenGL 3.2+ specific requirements
     IOReturn gl3_test = testContextOpenGL3Features(context_id);
@@ -2360,13 +2361,13 @@ IOReturn CLASS::testContextOpenGL32Features(uint32_t context_id)
     }
     
     // Additional 3.2+ feature validation would go here
-    IOLog("VMOpenGLBridge: OpenGL 3.2+ feature test passed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: OpenGL 3.2+ feature test passed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::testContextOpenGL4Features(uint32_t context_id)
 {
-    IOLog("VMOpenGLBridge: Testing OpenGL 4.x features for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing OpenGL 4.x features for context %d\n", context_id);
     
     // Test OpenGL 3.2+ requirements first
     IOReturn gl32_test = testContextOpenGL32Features(context_id);
@@ -2377,39 +2378,39 @@ IOReturn CLASS::testContextOpenGL4Features(uint32_t context_id)
     // Stage 1: Test OpenGL 4.0 specific features - Tessellation support
     IOReturn tessellation_result = testTessellationSupport(context_id);
     if (tessellation_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Tessellation support test failed (0x%x)\n", tessellation_result);
+        VMLOG_ERROR("VMOpenGLBridge: Tessellation support test failed (0x%x)\n", tessellation_result);
         return tessellation_result;
     }
     
     // Stage 2: Test OpenGL 4.1+ features - Separate shader objects
     IOReturn separate_shader_result = testSeparateShaderObjects(context_id);
     if (separate_shader_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Separate shader objects test failed (0x%x)\n", separate_shader_result);
+        VMLOG_ERROR("VMOpenGLBridge: Separate shader objects test failed (0x%x)\n", separate_shader_result);
         // Continue - not critical for basic OpenGL 4.x support
     }
     
     // Stage 3: Test OpenGL 4.2+ features - Transform feedback and enhanced textures
     IOReturn advanced_features_result = testOpenGL42AdvancedFeatures(context_id);
     if (advanced_features_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: OpenGL 4.2+ advanced features test failed (0x%x)\n", advanced_features_result);
+        VMLOG_ERROR("VMOpenGLBridge: OpenGL 4.2+ advanced features test failed (0x%x)\n", advanced_features_result);
         // Continue - advanced features not required for basic 4.x support
     }
     
     // Stage 4: Test OpenGL 4.3+ features - Compute shaders
     IOReturn compute_shader_result = testComputeShaderSupport(context_id);
     if (compute_shader_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Compute shader support test failed (0x%x)\n", compute_shader_result);
+        VMLOG_ERROR("VMOpenGLBridge: Compute shader support test failed (0x%x)\n", compute_shader_result);
         // Continue - compute shaders are optional for many OpenGL 4.x applications
     }
     
     // Stage 5: Test OpenGL 4.4+ features - Buffer storage
     IOReturn buffer_storage_result = testBufferStorageSupport(context_id);
     if (buffer_storage_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Buffer storage support test failed (0x%x)\n", buffer_storage_result);
+        VMLOG_ERROR("VMOpenGLBridge: Buffer storage support test failed (0x%x)\n", buffer_storage_result);
         // Continue - buffer storage is optional
     }
     
-    IOLog("VMOpenGLBridge: OpenGL 4.x comprehensive feature validation completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: OpenGL 4.x comprehensive feature validation completed\n");
     return kIOReturnSuccess;
 }
 
@@ -2419,79 +2420,79 @@ IOReturn CLASS::testContextOpenGL4Features(uint32_t context_id)
 
 IOReturn VMOpenGLBridge::validateAccelerator3DCapabilities()
 {
-    IOLog("VMOpenGLBridge: Starting comprehensive 3D capability validation\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Starting comprehensive 3D capability validation\n");
     
     // Stage 1: Basic hardware validation
     if (!this->m_gpu_device) {
-        IOLog("VMOpenGLBridge: No GPU device available for 3D validation\n");
+        VMLOG_DEBUG("VMOpenGLBridge: No GPU device available for 3D validation\n");
         return kIOReturnNoDevice;
     }
     
     if (!this->m_gpu_device->supports3D()) {
-        IOLog("VMOpenGLBridge: GPU device does not support 3D acceleration\n");
+        VMLOG_DEBUG("VMOpenGLBridge: GPU device does not support 3D acceleration\n");
         return kIOReturnUnsupported;
     }
     
     if (!this->m_accelerator) {
-        IOLog("VMOpenGLBridge: No accelerator available for 3D validation\n");
+        VMLOG_DEBUG("VMOpenGLBridge: No accelerator available for 3D validation\n");
         return kIOReturnNoDevice;
     }
     
     // Stage 2: Core 3D rendering capabilities
     IOReturn render_result = validate3DRenderingCapabilities();
     if (render_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: 3D rendering capabilities validation failed: 0x%x\n", render_result);
+        VMLOG_ERROR("VMOpenGLBridge: 3D rendering capabilities validation failed: 0x%x\n", render_result);
         return render_result;
     }
     
     // Stage 3: Geometry processing capabilities
     IOReturn geometry_result = validateGeometryProcessingCapabilities();
     if (geometry_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Geometry processing capabilities validation failed: 0x%x\n", geometry_result);
+        VMLOG_ERROR("VMOpenGLBridge: Geometry processing capabilities validation failed: 0x%x\n", geometry_result);
         return geometry_result;
     }
     
     // Stage 4: Fragment processing capabilities
     IOReturn fragment_result = validateFragmentProcessingCapabilities();
     if (fragment_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Fragment processing capabilities validation failed: 0x%x\n", fragment_result);
+        VMLOG_ERROR("VMOpenGLBridge: Fragment processing capabilities validation failed: 0x%x\n", fragment_result);
         return fragment_result;
     }
     
     // Stage 5: Texture capabilities
     IOReturn texture_result = validateTextureCapabilities();
     if (texture_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Texture capabilities validation failed: 0x%x\n", texture_result);
+        VMLOG_ERROR("VMOpenGLBridge: Texture capabilities validation failed: 0x%x\n", texture_result);
         return texture_result;
     }
     
     // Stage 6: Framebuffer capabilities
     IOReturn framebuffer_result = validateFramebufferCapabilities();
     if (framebuffer_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Framebuffer capabilities validation failed: 0x%x\n", framebuffer_result);
+        VMLOG_ERROR("VMOpenGLBridge: Framebuffer capabilities validation failed: 0x%x\n", framebuffer_result);
         return framebuffer_result;
     }
     
     // Stage 7: Shader capabilities
     IOReturn shader_result = validateShaderCapabilities();
     if (shader_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Shader capabilities validation failed: 0x%x\n", shader_result);
+        VMLOG_ERROR("VMOpenGLBridge: Shader capabilities validation failed: 0x%x\n", shader_result);
         return shader_result;
     }
     
-    IOLog("VMOpenGLBridge: All 3D capability validation stages passed successfully\n");
+    VMLOG_DEBUG("VMOpenGLBridge: All 3D capability validation stages passed successfully\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::validate3DRenderingCapabilities()
 {
-    IOLog("VMOpenGLBridge: Validating 3D rendering capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Validating 3D rendering capabilities\n");
     
     // Check if accelerator can create and manage 3D contexts
     UInt32 test_context = 0;
     IOReturn context_result = this->m_accelerator->create3DContext(&test_context, current_task());
     if (context_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to create test 3D context: 0x%x\n", context_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to create test 3D context: 0x%x\n", context_result);
         return context_result;
     }
     
@@ -2503,7 +2504,7 @@ IOReturn VMOpenGLBridge::validate3DRenderingCapabilities()
     
     IOReturn surface_result = this->m_accelerator->create3DSurface(test_context, &surface_info);
     if (surface_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to create test surface: 0x%x\n", surface_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to create test surface: 0x%x\n", surface_result);
         this->m_accelerator->destroy3DContext(test_context);
         return surface_result;
     }
@@ -2511,7 +2512,7 @@ IOReturn VMOpenGLBridge::validate3DRenderingCapabilities()
     // Test surface presentation (basic rendering operation)
     IOReturn present_result = this->m_accelerator->present3DSurface(test_context, surface_info.surface_id);
     if (present_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Surface presentation test failed: 0x%x\n", present_result);
+        VMLOG_ERROR("VMOpenGLBridge: Surface presentation test failed: 0x%x\n", present_result);
         // Continue - presentation failure is not critical for basic validation
     }
     
@@ -2519,13 +2520,13 @@ IOReturn VMOpenGLBridge::validate3DRenderingCapabilities()
     this->m_accelerator->destroy3DSurface(test_context, surface_info.surface_id);
     this->m_accelerator->destroy3DContext(test_context);
     
-    IOLog("VMOpenGLBridge: 3D rendering capabilities validation passed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: 3D rendering capabilities validation passed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::validateGeometryProcessingCapabilities()
 {
-    IOLog("VMOpenGLBridge: Validating geometry processing capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Validating geometry processing capabilities\n");
     
     // Test 3D context creation for geometry operations
     UInt32 test_context = 0;
@@ -2542,7 +2543,7 @@ IOReturn VMOpenGLBridge::validateGeometryProcessingCapabilities()
     
     IOReturn surface_result = this->m_accelerator->create3DSurface(test_context, &surface_info);
     if (surface_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to create geometry test surface: 0x%x\n", surface_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to create geometry test surface: 0x%x\n", surface_result);
         this->m_accelerator->destroy3DContext(test_context);
         return surface_result;
     }
@@ -2550,7 +2551,7 @@ IOReturn VMOpenGLBridge::validateGeometryProcessingCapabilities()
     // Test advanced 3D geometry processing capabilities
     IOReturn advanced_result = validateAdvanced3DGeometryCapabilities(test_context, surface_info.surface_id);
     if (advanced_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Advanced 3D geometry validation failed: 0x%x\n", advanced_result);
+        VMLOG_ERROR("VMOpenGLBridge: Advanced 3D geometry validation failed: 0x%x\n", advanced_result);
         // Continue - advanced features are optional for basic validation
     }
     
@@ -2558,7 +2559,7 @@ IOReturn VMOpenGLBridge::validateGeometryProcessingCapabilities()
     // Create simple draw command buffer
     uint8_t* draw_commands = (uint8_t*)IOMalloc(64);  // Simple command buffer
     if (!draw_commands) {
-        IOLog("VMOpenGLBridge: Failed to allocate draw commands buffer\n");
+        VMLOG_ERROR("VMOpenGLBridge: Failed to allocate draw commands buffer\n");
         this->m_accelerator->destroy3DSurface(test_context, surface_info.surface_id);
         this->m_accelerator->destroy3DContext(test_context);
         return kIOReturnNoMemory;
@@ -2567,7 +2568,7 @@ IOReturn VMOpenGLBridge::validateGeometryProcessingCapabilities()
     IOMemoryDescriptor* command_buffer = IOMemoryDescriptor::withAddress(
         draw_commands, 64, kIODirectionOut);
     if (!command_buffer) {
-        IOLog("VMOpenGLBridge: Failed to create command buffer descriptor\n");
+        VMLOG_ERROR("VMOpenGLBridge: Failed to create command buffer descriptor\n");
         IOFree(draw_commands, 64);
         this->m_accelerator->destroy3DSurface(test_context, surface_info.surface_id);
         this->m_accelerator->destroy3DContext(test_context);
@@ -2577,7 +2578,7 @@ IOReturn VMOpenGLBridge::validateGeometryProcessingCapabilities()
     // Test command submission
     IOReturn submit_result = this->m_accelerator->submit3DCommands(test_context, command_buffer);
     if (submit_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Geometry command submission failed: 0x%x\n", submit_result);
+        VMLOG_ERROR("VMOpenGLBridge: Geometry command submission failed: 0x%x\n", submit_result);
         // Continue - command failure is acceptable for basic validation
     }
     
@@ -2587,13 +2588,13 @@ IOReturn VMOpenGLBridge::validateGeometryProcessingCapabilities()
     this->m_accelerator->destroy3DSurface(test_context, surface_info.surface_id);
     this->m_accelerator->destroy3DContext(test_context);
     
-    IOLog("VMOpenGLBridge: Geometry processing capabilities validation passed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Geometry processing capabilities validation passed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::validateFragmentProcessingCapabilities()
 {
-    IOLog("VMOpenGLBridge: Validating fragment processing capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Validating fragment processing capabilities\n");
     
     UInt32 test_context = 0;
     IOReturn context_result = this->m_accelerator->create3DContext(&test_context, current_task());
@@ -2622,13 +2623,13 @@ IOReturn VMOpenGLBridge::validateFragmentProcessingCapabilities()
     IOReturn surface2_result = this->m_accelerator->create3DSurface(test_context, &surface_info2);
     if (surface2_result != kIOReturnSuccess) {
         // Single surface is sufficient for basic validation
-        IOLog("VMOpenGLBridge: Secondary surface creation failed, continuing with single surface\n");
+        VMLOG_ERROR("VMOpenGLBridge: Secondary surface creation failed, continuing with single surface\n");
     }
     
     // Test surface presentation (exercises fragment processing pipeline)
     IOReturn present_result = this->m_accelerator->present3DSurface(test_context, surface_info.surface_id);
     if (present_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Fragment processing presentation test failed: 0x%x\n", present_result);
+        VMLOG_ERROR("VMOpenGLBridge: Fragment processing presentation test failed: 0x%x\n", present_result);
         // Continue - presentation failure is acceptable
     }
     
@@ -2639,13 +2640,13 @@ IOReturn VMOpenGLBridge::validateFragmentProcessingCapabilities()
     this->m_accelerator->destroy3DSurface(test_context, surface_info.surface_id);
     this->m_accelerator->destroy3DContext(test_context);
     
-    IOLog("VMOpenGLBridge: Fragment processing capabilities validation passed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Fragment processing capabilities validation passed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::validateTextureCapabilities()
 {
-    IOLog("VMOpenGLBridge: Validating texture capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Validating texture capabilities\n");
     
     UInt32 test_context = 0;
     IOReturn context_result = this->m_accelerator->create3DContext(&test_context, current_task());
@@ -2676,7 +2677,7 @@ IOReturn VMOpenGLBridge::validateTextureCapabilities()
     IOReturn tex_result = this->m_accelerator->createTexture(test_context, &texture_desc, 
                                                            texture_data, &texture_id);
     if (tex_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to create texture: 0x%x\n", tex_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to create texture: 0x%x\n", tex_result);
         this->m_accelerator->destroy3DContext(test_context);
         return tex_result;
     }
@@ -2686,20 +2687,20 @@ IOReturn VMOpenGLBridge::validateTextureCapabilities()
     IOReturn update_result = this->m_accelerator->updateTexture(test_context, texture_id, 0,
                                                               region_data, texture_data);
     if (update_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Texture update test failed: 0x%x\n", update_result);
+        VMLOG_ERROR("VMOpenGLBridge: Texture update test failed: 0x%x\n", update_result);
         // Continue - update failure is acceptable for basic validation
     }
     
     // Cleanup - use destroy instead of delete for texture
     this->m_accelerator->destroy3DContext(test_context);
     
-    IOLog("VMOpenGLBridge: Texture capabilities validation passed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Texture capabilities validation passed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::validateFramebufferCapabilities()
 {
-    IOLog("VMOpenGLBridge: Validating framebuffer capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Validating framebuffer capabilities\n");
     
     UInt32 test_context = 0;
     IOReturn context_result = this->m_accelerator->create3DContext(&test_context, current_task());
@@ -2715,7 +2716,7 @@ IOReturn VMOpenGLBridge::validateFramebufferCapabilities()
     
     IOReturn color_result = this->m_accelerator->create3DSurface(test_context, &color_surface);
     if (color_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to create color surface: 0x%x\n", color_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to create color surface: 0x%x\n", color_result);
         this->m_accelerator->destroy3DContext(test_context);
         return color_result;
     }
@@ -2728,13 +2729,13 @@ IOReturn VMOpenGLBridge::validateFramebufferCapabilities()
     IOReturn depth_result = this->m_accelerator->create3DSurface(test_context, &depth_surface);
     if (depth_result != kIOReturnSuccess) {
         // Depth buffers might not be supported, continue with color only
-        IOLog("VMOpenGLBridge: Depth surface not supported, testing color framebuffer only\n");
+        VMLOG_WARN("VMOpenGLBridge: Depth surface not supported, testing color framebuffer only\n");
     }
     
     // Test presentation capabilities (basic framebuffer operation)
     IOReturn present_result = this->m_accelerator->present3DSurface(test_context, color_surface.surface_id);
     if (present_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Framebuffer presentation test failed: 0x%x\n", present_result);
+        VMLOG_ERROR("VMOpenGLBridge: Framebuffer presentation test failed: 0x%x\n", present_result);
         // Presentation failure is acceptable for basic validation
     }
     
@@ -2742,7 +2743,7 @@ IOReturn VMOpenGLBridge::validateFramebufferCapabilities()
     if (depth_result == kIOReturnSuccess) {
         IOReturn present_depth = this->m_accelerator->present3DSurface(test_context, depth_surface.surface_id);
         if (present_depth != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Depth buffer presentation test failed: 0x%x\n", present_depth);
+            VMLOG_ERROR("VMOpenGLBridge: Depth buffer presentation test failed: 0x%x\n", present_depth);
         }
     }
     
@@ -2753,13 +2754,13 @@ IOReturn VMOpenGLBridge::validateFramebufferCapabilities()
     this->m_accelerator->destroy3DSurface(test_context, color_surface.surface_id);
     this->m_accelerator->destroy3DContext(test_context);
     
-    IOLog("VMOpenGLBridge: Framebuffer capabilities validation passed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Framebuffer capabilities validation passed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::validateShaderCapabilities()
 {
-    IOLog("VMOpenGLBridge: Validating shader capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Validating shader capabilities\n");
     
     UInt32 test_context = 0;
     IOReturn context_result = this->m_accelerator->create3DContext(&test_context, current_task());
@@ -2770,7 +2771,7 @@ IOReturn VMOpenGLBridge::validateShaderCapabilities()
     // Check if shader manager is available
     VMShaderManager* shader_mgr = this->m_accelerator->getShaderManager();
     if (!shader_mgr) {
-        IOLog("VMOpenGLBridge: No shader manager available - using fixed function pipeline\n");
+        VMLOG_DEBUG("VMOpenGLBridge: No shader manager available - using fixed function pipeline\n");
         this->m_accelerator->destroy3DContext(test_context);
         return kIOReturnSuccess; // Fixed function is acceptable
     }
@@ -2789,7 +2790,7 @@ IOReturn VMOpenGLBridge::validateShaderCapabilities()
                                                           vertex_shader_source, strlen(vertex_shader_source),
                                                           &vertex_shader);
     if (vs_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to compile vertex shader: 0x%x\n", vs_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to compile vertex shader: 0x%x\n", vs_result);
         this->m_accelerator->destroy3DContext(test_context);
         return vs_result;
     }
@@ -2807,7 +2808,7 @@ IOReturn VMOpenGLBridge::validateShaderCapabilities()
                                                           fragment_shader_source, strlen(fragment_shader_source),
                                                           &fragment_shader);
     if (fs_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to compile fragment shader: 0x%x\n", fs_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to compile fragment shader: 0x%x\n", fs_result);
         this->m_accelerator->destroyShader(test_context, vertex_shader);
         this->m_accelerator->destroy3DContext(test_context);
         return fs_result;
@@ -2818,7 +2819,7 @@ IOReturn VMOpenGLBridge::validateShaderCapabilities()
     UInt32 program = 0;
     IOReturn link_result = this->m_accelerator->createShaderProgram(test_context, shaders, 2, &program);
     if (link_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to link shader program: 0x%x\n", link_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to link shader program: 0x%x\n", link_result);
         this->m_accelerator->destroyShader(test_context, fragment_shader);
         this->m_accelerator->destroyShader(test_context, vertex_shader);
         this->m_accelerator->destroy3DContext(test_context);
@@ -2828,7 +2829,7 @@ IOReturn VMOpenGLBridge::validateShaderCapabilities()
     // Test shader program usage
     IOReturn use_result = this->m_accelerator->useShaderProgram(test_context, program);
     if (use_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Shader program usage test failed: 0x%x\n", use_result);
+        VMLOG_ERROR("VMOpenGLBridge: Shader program usage test failed: 0x%x\n", use_result);
         // Continue with cleanup - program usage failure is not critical
     }
     
@@ -2837,7 +2838,7 @@ IOReturn VMOpenGLBridge::validateShaderCapabilities()
     this->m_accelerator->destroyShader(test_context, vertex_shader);
     this->m_accelerator->destroy3DContext(test_context);
     
-    IOLog("VMOpenGLBridge: Shader capabilities validation passed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Shader capabilities validation passed\n");
     return kIOReturnSuccess;
 }
 
@@ -2851,7 +2852,7 @@ IOReturn VMOpenGLBridge::queryOpenGL3SpecificFeatures(uint32_t context_id)
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Querying OpenGL 3.x specific features through VirtIO GPU for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Querying OpenGL 3.x specific features through VirtIO GPU for context %d\n", context_id);
     
     // Query VirtIO GPU for OpenGL version capabilities
     bool supports_gl_3 = false;
@@ -2861,19 +2862,19 @@ IOReturn VMOpenGLBridge::queryOpenGL3SpecificFeatures(uint32_t context_id)
     // Check VirtIO GPU feature flags for OpenGL 3.x indicators
     if (m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_3D)) {
         supports_gl_3 = true;
-        IOLog("VMOpenGLBridge: VirtIO GPU supports 3D rendering - OpenGL 3.0+ capable\n");
+        VMLOG_DEBUG("VMOpenGLBridge: VirtIO GPU supports 3D rendering - OpenGL 3.0+ capable\n");
         
         // Check for advanced features indicating OpenGL 3.2+
         if (m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_RESOURCE_BLOB) &&
             m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_CONTEXT_INIT)) {
             supports_gl_3_2 = true;
-            IOLog("VMOpenGLBridge: Advanced VirtIO features detected - OpenGL 3.2+ capable\n");
+            VMLOG_DEBUG("VMOpenGLBridge: Advanced VirtIO features detected - OpenGL 3.2+ capable\n");
         }
         
         // Check for shader compilation support
         if (m_accelerator->getShaderManager()) {
             supports_modern_shaders = true;
-            IOLog("VMOpenGLBridge: Shader manager available - modern shader support detected\n");
+            VMLOG_DEBUG("VMOpenGLBridge: Shader manager available - modern shader support detected\n");
         }
     }
     
@@ -2888,10 +2889,10 @@ IOReturn VMOpenGLBridge::queryOpenGL3SpecificFeatures(uint32_t context_id)
         
         IOReturn surface_test = m_accelerator->create3DSurface(context_id, &test_surface);
         if (surface_test == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Modern surface format validation passed\n");
+            VMLOG_DEBUG("VMOpenGLBridge: Modern surface format validation passed\n");
             m_accelerator->destroy3DSurface(context_id, test_surface.surface_id);
         } else {
-            IOLog("VMOpenGLBridge: Modern surface format test failed - reducing OpenGL 3.x support\n");
+            VMLOG_ERROR("VMOpenGLBridge: Modern surface format test failed - reducing OpenGL 3.x support\n");
             supports_gl_3 = false;
             supports_gl_3_2 = false;
         }
@@ -2903,7 +2904,7 @@ IOReturn VMOpenGLBridge::queryOpenGL3SpecificFeatures(uint32_t context_id)
     m_supports_vertex_array_objects = supports_gl_3;
     m_supports_uniform_buffer_objects = supports_gl_3_2;
     
-    IOLog("VMOpenGLBridge: OpenGL 3.x feature query completed - GL 3.0: %s, GL 3.2: %s\n",
+    VMLOG_DEBUG("VMOpenGLBridge: OpenGL 3.x feature query completed - GL 3.0: %s, GL 3.2: %s\n",
           supports_gl_3 ? "Yes" : "No", supports_gl_3_2 ? "Yes" : "No");
     
     return kIOReturnSuccess;
@@ -2911,27 +2912,27 @@ IOReturn VMOpenGLBridge::queryOpenGL3SpecificFeatures(uint32_t context_id)
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Querying OpenGL 3.x specific features for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Querying OpenGL 3.x specific features for context %d\n", context_id);
     
     // Query OpenGL version string through VirtIO GPU
     char* version_buffer = (char*)IOMalloc(256);
     if (!version_buffer) {
-        IOLog("VMOpenGLBridge: Failed to allocate version buffer\n");
+        VMLOG_ERROR("VMOpenGLBridge: Failed to allocate version buffer\n");
         return kIOReturnNoMemory;
     }
     bzero(version_buffer, 256);
     IOReturn version_result = queryOpenGLVersionString(context_id, version_buffer, 256);
     if (version_result == kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: OpenGL version: %s\n", version_buffer);
+        VMLOG_DEBUG("VMOpenGLBridge: OpenGL version: %s\n", version_buffer);
         
         // Parse version string to validate OpenGL 3.x support
         if (strncmp(version_buffer, "3.", 2) != 0 && strncmp(version_buffer, "4.", 2) != 0) {
-            IOLog("VMOpenGLBridge: Version string indicates OpenGL < 3.0\n");
+            VMLOG_DEBUG("VMOpenGLBridge: Version string indicates OpenGL < 3.0\n");
             IOFree(version_buffer, 256);
             return kIOReturnUnsupported;
         }
     } else {
-        IOLog("VMOpenGLBridge: Could not query OpenGL version string, using feature detection\n");
+        VMLOG_WARN("VMOpenGLBridge: Could not query OpenGL version string, using feature detection\n");
     }
     
     // Query OpenGL extensions through VirtIO GPU
@@ -2939,21 +2940,21 @@ IOReturn VMOpenGLBridge::queryOpenGL3SpecificFeatures(uint32_t context_id)
     if (extensions_buffer) {
         IOReturn ext_result = queryOpenGLExtensions(context_id, extensions_buffer, 8192);
         if (ext_result == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Successfully queried OpenGL extensions\n");
+            VMLOG_DEBUG("VMOpenGLBridge: Successfully queried OpenGL extensions\n");
             
             // Check for critical OpenGL 3.0 extensions
             bool has_vao = vm_strstr_safe(extensions_buffer, "GL_ARB_vertex_array_object");
             bool has_fbo = vm_strstr_safe(extensions_buffer, "GL_ARB_framebuffer_object");
             bool has_instancing = vm_strstr_safe(extensions_buffer, "GL_ARB_draw_instanced");
             
-            IOLog("VMOpenGLBridge: Extension support - VAO: %s, FBO: %s, Instancing: %s\n",
+            VMLOG_DEBUG("VMOpenGLBridge: Extension support - VAO: %s, FBO: %s, Instancing: %s\n",
                   has_vao ? "YES" : "NO", has_fbo ? "YES" : "NO", has_instancing ? "YES" : "NO");
         }
         IOFree(extensions_buffer, 8192);
     }
     
     IOFree(version_buffer, 256);
-    IOLog("VMOpenGLBridge: OpenGL 3.x specific feature query completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: OpenGL 3.x specific feature query completed\n");
     return kIOReturnSuccess;
 }
 
@@ -2963,11 +2964,11 @@ IOReturn VMOpenGLBridge::testShaderCompilationSupport(uint32_t context_id)
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing shader compilation support for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing shader compilation support for context %d\n", context_id);
     
     VMShaderManager* shader_mgr = m_accelerator->getShaderManager();
     if (!shader_mgr) {
-        IOLog("VMOpenGLBridge: No shader manager available - shader compilation not supported\n");
+        VMLOG_WARN("VMOpenGLBridge: No shader manager available - shader compilation not supported\n");
         return kIOReturnUnsupported;
     }
     
@@ -2990,7 +2991,7 @@ IOReturn VMOpenGLBridge::testShaderCompilationSupport(uint32_t context_id)
     );
     
     if (vs_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Vertex shader compilation test failed (0x%x)\n", vs_result);
+        VMLOG_ERROR("VMOpenGLBridge: Vertex shader compilation test failed (0x%x)\n", vs_result);
         return vs_result;
     }
     
@@ -3012,7 +3013,7 @@ IOReturn VMOpenGLBridge::testShaderCompilationSupport(uint32_t context_id)
     );
     
     if (fs_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Fragment shader compilation test failed (0x%x)\n", fs_result);
+        VMLOG_ERROR("VMOpenGLBridge: Fragment shader compilation test failed (0x%x)\n", fs_result);
         // Cleanup vertex shader
         m_accelerator->destroyShader(context_id, vertex_shader_id);
         return fs_result;
@@ -3029,7 +3030,7 @@ IOReturn VMOpenGLBridge::testShaderCompilationSupport(uint32_t context_id)
     );
     
     if (program_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Shader program creation test failed (0x%x)\n", program_result);
+        VMLOG_ERROR("VMOpenGLBridge: Shader program creation test failed (0x%x)\n", program_result);
         // Cleanup shaders
         m_accelerator->destroyShader(context_id, vertex_shader_id);
         m_accelerator->destroyShader(context_id, fragment_shader_id);
@@ -3040,7 +3041,7 @@ IOReturn VMOpenGLBridge::testShaderCompilationSupport(uint32_t context_id)
     m_accelerator->destroyShader(context_id, vertex_shader_id);
     m_accelerator->destroyShader(context_id, fragment_shader_id);
     
-    IOLog("VMOpenGLBridge: Shader compilation support validation passed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Shader compilation support validation passed\n");
     return kIOReturnSuccess;
 }
 
@@ -3050,7 +3051,7 @@ IOReturn VMOpenGLBridge::testMultipleRenderTargets(uint32_t context_id)
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing Multiple Render Targets support for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing Multiple Render Targets support for context %d\n", context_id);
     
     // Create primary color surface
     VM3DSurfaceInfo color_surface = {0};
@@ -3061,7 +3062,7 @@ IOReturn VMOpenGLBridge::testMultipleRenderTargets(uint32_t context_id)
     
     IOReturn color_result = m_accelerator->create3DSurface(context_id, &color_surface);
     if (color_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Primary color surface creation failed (0x%x)\n", color_result);
+        VMLOG_ERROR("VMOpenGLBridge: Primary color surface creation failed (0x%x)\n", color_result);
         return color_result;
     }
     
@@ -3074,7 +3075,7 @@ IOReturn VMOpenGLBridge::testMultipleRenderTargets(uint32_t context_id)
     
     IOReturn color2_result = m_accelerator->create3DSurface(context_id, &color_surface2);
     if (color2_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Secondary color surface creation failed (0x%x)\n", color2_result);
+        VMLOG_ERROR("VMOpenGLBridge: Secondary color surface creation failed (0x%x)\n", color2_result);
         m_accelerator->destroy3DSurface(context_id, color_surface.surface_id);
         return color2_result;
     }
@@ -3090,7 +3091,7 @@ IOReturn VMOpenGLBridge::testMultipleRenderTargets(uint32_t context_id)
     );
     
     if (framebuffer_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: MRT framebuffer creation failed (0x%x)\n", framebuffer_result);
+        VMLOG_ERROR("VMOpenGLBridge: MRT framebuffer creation failed (0x%x)\n", framebuffer_result);
         // Continue anyway - single render target is acceptable
     }
     
@@ -3098,14 +3099,14 @@ IOReturn VMOpenGLBridge::testMultipleRenderTargets(uint32_t context_id)
     IOReturn render_result = m_accelerator->beginRenderPass(context_id, framebuffer_id);
     if (render_result == kIOReturnSuccess) {
         m_accelerator->endRenderPass(context_id);
-        IOLog("VMOpenGLBridge: MRT render pass test successful\n");
+        VMLOG_DEBUG("VMOpenGLBridge: MRT render pass test successful\n");
     }
     
     // Cleanup
     m_accelerator->destroy3DSurface(context_id, color_surface2.surface_id);
     m_accelerator->destroy3DSurface(context_id, color_surface.surface_id);
     
-    IOLog("VMOpenGLBridge: Multiple Render Targets support validation completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Multiple Render Targets support validation completed\n");
     return kIOReturnSuccess;
 }
 
@@ -3115,7 +3116,7 @@ IOReturn VMOpenGLBridge::testModernTextureSupport(uint32_t context_id)
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing modern texture support for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing modern texture support for context %d\n", context_id);
     
     // Test modern texture formats using accelerator interface
     struct {
@@ -3143,7 +3144,7 @@ IOReturn VMOpenGLBridge::testModernTextureSupport(uint32_t context_id)
     IOReturn tex_result = m_accelerator->createTexture(context_id, &texture_desc, 
                                                      texture_data, &texture_id);
     if (tex_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Modern texture creation failed (0x%x)\n", tex_result);
+        VMLOG_ERROR("VMOpenGLBridge: Modern texture creation failed (0x%x)\n", tex_result);
         return tex_result;
     }
     
@@ -3157,18 +3158,18 @@ IOReturn VMOpenGLBridge::testModernTextureSupport(uint32_t context_id)
     IOReturn update_result = m_accelerator->updateTexture(context_id, texture_id, 0,
                                                         region_data, update_data);
     if (update_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Texture update test failed (0x%x)\n", update_result);
+        VMLOG_ERROR("VMOpenGLBridge: Texture update test failed (0x%x)\n", update_result);
         // Continue - update failure is acceptable for basic validation
     }
     
     // Test texture binding
     IOReturn bind_result = m_accelerator->bindTexture(context_id, 0, texture_id);
     if (bind_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Texture binding test failed (0x%x)\n", bind_result);
+        VMLOG_ERROR("VMOpenGLBridge: Texture binding test failed (0x%x)\n", bind_result);
         // Continue - binding failure is acceptable for basic validation
     }
     
-    IOLog("VMOpenGLBridge: Modern texture support validation completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Modern texture support validation completed\n");
     return kIOReturnSuccess;
 }
 
@@ -3184,7 +3185,7 @@ IOReturn VMOpenGLBridge::testTessellationSupport(uint32_t context_id)
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing tessellation shader support for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing tessellation shader support for context %d\n", context_id);
     
     // Test tessellation control shader compilation (OpenGL 4.0 requirement)
     const char* tess_control_source = 
@@ -3205,7 +3206,7 @@ IOReturn VMOpenGLBridge::testTessellationSupport(uint32_t context_id)
                                                      tess_control_source, strlen(tess_control_source),
                                                      &tess_control_shader);
     if (tc_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Tessellation control shader compilation failed (0x%x)\n", tc_result);
+        VMLOG_ERROR("VMOpenGLBridge: Tessellation control shader compilation failed (0x%x)\n", tc_result);
         return tc_result;
     }
     
@@ -3223,7 +3224,7 @@ IOReturn VMOpenGLBridge::testTessellationSupport(uint32_t context_id)
                                                      tess_eval_source, strlen(tess_eval_source),
                                                      &tess_eval_shader);
     if (te_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Tessellation evaluation shader compilation failed (0x%x)\n", te_result);
+        VMLOG_ERROR("VMOpenGLBridge: Tessellation evaluation shader compilation failed (0x%x)\n", te_result);
         m_accelerator->destroyShader(context_id, tess_control_shader);
         return te_result;
     }
@@ -3233,7 +3234,7 @@ IOReturn VMOpenGLBridge::testTessellationSupport(uint32_t context_id)
     uint32_t tess_program = 0;
     IOReturn program_result = m_accelerator->createShaderProgram(context_id, tess_shaders, 2, &tess_program);
     if (program_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Tessellation program creation failed (0x%x)\n", program_result);
+        VMLOG_ERROR("VMOpenGLBridge: Tessellation program creation failed (0x%x)\n", program_result);
         m_accelerator->destroyShader(context_id, tess_eval_shader);
         m_accelerator->destroyShader(context_id, tess_control_shader);
         return program_result;
@@ -3243,7 +3244,7 @@ IOReturn VMOpenGLBridge::testTessellationSupport(uint32_t context_id)
     m_accelerator->destroyShader(context_id, tess_eval_shader);
     m_accelerator->destroyShader(context_id, tess_control_shader);
     
-    IOLog("VMOpenGLBridge: Tessellation support validation completed successfully\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Tessellation support validation completed successfully\n");
     return kIOReturnSuccess;
 }
 
@@ -3253,7 +3254,7 @@ IOReturn VMOpenGLBridge::testSeparateShaderObjects(uint32_t context_id)
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing separate shader objects support for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing separate shader objects support for context %d\n", context_id);
     
     // Test separate vertex shader creation (OpenGL 4.1 feature)
     const char* separate_vs_source = 
@@ -3269,7 +3270,7 @@ IOReturn VMOpenGLBridge::testSeparateShaderObjects(uint32_t context_id)
                                                      separate_vs_source, strlen(separate_vs_source),
                                                      &separate_vertex_shader);
     if (vs_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Separate vertex shader creation failed (0x%x)\n", vs_result);
+        VMLOG_ERROR("VMOpenGLBridge: Separate vertex shader creation failed (0x%x)\n", vs_result);
         return vs_result;
     }
     
@@ -3287,7 +3288,7 @@ IOReturn VMOpenGLBridge::testSeparateShaderObjects(uint32_t context_id)
                                                      separate_fs_source, strlen(separate_fs_source),
                                                      &separate_fragment_shader);
     if (fs_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Separate fragment shader creation failed (0x%x)\n", fs_result);
+        VMLOG_ERROR("VMOpenGLBridge: Separate fragment shader creation failed (0x%x)\n", fs_result);
         m_accelerator->destroyShader(context_id, separate_vertex_shader);
         return fs_result;
     }
@@ -3297,7 +3298,7 @@ IOReturn VMOpenGLBridge::testSeparateShaderObjects(uint32_t context_id)
     uint32_t separate_program = 0;
     IOReturn program_result = m_accelerator->createShaderProgram(context_id, separate_shaders, 2, &separate_program);
     if (program_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Separate shader program creation failed (0x%x)\n", program_result);
+        VMLOG_ERROR("VMOpenGLBridge: Separate shader program creation failed (0x%x)\n", program_result);
         // Continue - this might be expected if separate shader objects aren't fully supported
     }
     
@@ -3305,7 +3306,7 @@ IOReturn VMOpenGLBridge::testSeparateShaderObjects(uint32_t context_id)
     m_accelerator->destroyShader(context_id, separate_fragment_shader);
     m_accelerator->destroyShader(context_id, separate_vertex_shader);
     
-    IOLog("VMOpenGLBridge: Separate shader objects validation completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Separate shader objects validation completed\n");
     return kIOReturnSuccess;
 }
 
@@ -3315,7 +3316,7 @@ IOReturn VMOpenGLBridge::testOpenGL42AdvancedFeatures(uint32_t context_id)
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing OpenGL 4.2+ advanced features for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing OpenGL 4.2+ advanced features for context %d\n", context_id);
     
     // Test advanced texture features (texture storage, etc.)
     struct {
@@ -3345,7 +3346,7 @@ IOReturn VMOpenGLBridge::testOpenGL42AdvancedFeatures(uint32_t context_id)
     IOReturn tex_result = m_accelerator->createTexture(context_id, &advanced_texture_desc, 
                                                       texture_data, &advanced_texture_id);
     if (tex_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Advanced texture creation failed (0x%x)\n", tex_result);
+        VMLOG_ERROR("VMOpenGLBridge: Advanced texture creation failed (0x%x)\n", tex_result);
         // Continue - advanced texture formats might not be supported
     }
     
@@ -3357,7 +3358,7 @@ IOReturn VMOpenGLBridge::testOpenGL42AdvancedFeatures(uint32_t context_id)
     
     IOReturn feedback_result = m_accelerator->create3DSurface(context_id, &feedback_surface);
     if (feedback_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Transform feedback surface creation failed (0x%x)\n", feedback_result);
+        VMLOG_ERROR("VMOpenGLBridge: Transform feedback surface creation failed (0x%x)\n", feedback_result);
         // Continue - transform feedback might not be available
     }
     
@@ -3366,7 +3367,7 @@ IOReturn VMOpenGLBridge::testOpenGL42AdvancedFeatures(uint32_t context_id)
         m_accelerator->destroy3DSurface(context_id, feedback_surface.surface_id);
     }
     
-    IOLog("VMOpenGLBridge: OpenGL 4.2+ advanced features validation completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: OpenGL 4.2+ advanced features validation completed\n");
     return kIOReturnSuccess;
 }
 
@@ -3376,7 +3377,7 @@ IOReturn VMOpenGLBridge::testComputeShaderSupport(uint32_t context_id)
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing compute shader support for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing compute shader support for context %d\n", context_id);
     
     // Test basic compute shader compilation (OpenGL 4.3 feature)
     const char* compute_shader_source = 
@@ -3395,7 +3396,7 @@ IOReturn VMOpenGLBridge::testComputeShaderSupport(uint32_t context_id)
                                                      compute_shader_source, strlen(compute_shader_source),
                                                      &compute_shader);
     if (cs_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Compute shader compilation failed (0x%x)\n", cs_result);
+        VMLOG_ERROR("VMOpenGLBridge: Compute shader compilation failed (0x%x)\n", cs_result);
         return cs_result;
     }
     
@@ -3404,7 +3405,7 @@ IOReturn VMOpenGLBridge::testComputeShaderSupport(uint32_t context_id)
     uint32_t compute_program = 0;
     IOReturn program_result = m_accelerator->createShaderProgram(context_id, compute_shaders, 1, &compute_program);
     if (program_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Compute shader program creation failed (0x%x)\n", program_result);
+        VMLOG_ERROR("VMOpenGLBridge: Compute shader program creation failed (0x%x)\n", program_result);
         m_accelerator->destroyShader(context_id, compute_shader);
         return program_result;
     }
@@ -3412,7 +3413,7 @@ IOReturn VMOpenGLBridge::testComputeShaderSupport(uint32_t context_id)
     // Test compute shader dispatch (through command submission)
     uint8_t* dispatch_commands = (uint8_t*)IOMalloc(128);  // Compute dispatch command buffer
     if (!dispatch_commands) {
-        IOLog("VMOpenGLBridge: Failed to allocate dispatch commands buffer\n");
+        VMLOG_ERROR("VMOpenGLBridge: Failed to allocate dispatch commands buffer\n");
         m_accelerator->destroyShader(context_id, compute_shader);
         return kIOReturnNoMemory;
     }
@@ -3422,7 +3423,7 @@ IOReturn VMOpenGLBridge::testComputeShaderSupport(uint32_t context_id)
     if (compute_buffer) {
         IOReturn dispatch_result = m_accelerator->submit3DCommands(context_id, compute_buffer);
         if (dispatch_result != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Compute shader dispatch failed (0x%x)\n", dispatch_result);
+            VMLOG_ERROR("VMOpenGLBridge: Compute shader dispatch failed (0x%x)\n", dispatch_result);
             // Continue - dispatch might not be supported in this context
         }
         compute_buffer->release();
@@ -3432,7 +3433,7 @@ IOReturn VMOpenGLBridge::testComputeShaderSupport(uint32_t context_id)
     IOFree(dispatch_commands, 128);
     m_accelerator->destroyShader(context_id, compute_shader);
     
-    IOLog("VMOpenGLBridge: Compute shader support validation completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Compute shader support validation completed\n");
     return kIOReturnSuccess;
 }
 
@@ -3442,7 +3443,7 @@ IOReturn VMOpenGLBridge::testBufferStorageSupport(uint32_t context_id)
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Testing buffer storage support for context %d\n", context_id);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing buffer storage support for context %d\n", context_id);
     
     // Test advanced buffer creation with storage flags (OpenGL 4.4+ feature)
     // Create multiple buffer types to test storage capabilities
@@ -3455,7 +3456,7 @@ IOReturn VMOpenGLBridge::testBufferStorageSupport(uint32_t context_id)
     
     IOReturn vb_result = m_accelerator->create3DSurface(context_id, &vertex_buffer_surface);
     if (vb_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Vertex buffer storage test failed (0x%x)\n", vb_result);
+        VMLOG_ERROR("VMOpenGLBridge: Vertex buffer storage test failed (0x%x)\n", vb_result);
         return vb_result;
     }
     
@@ -3467,7 +3468,7 @@ IOReturn VMOpenGLBridge::testBufferStorageSupport(uint32_t context_id)
     
     IOReturn ib_result = m_accelerator->create3DSurface(context_id, &index_buffer_surface);
     if (ib_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Index buffer storage test failed (0x%x)\n", ib_result);
+        VMLOG_ERROR("VMOpenGLBridge: Index buffer storage test failed (0x%x)\n", ib_result);
         m_accelerator->destroy3DSurface(context_id, vertex_buffer_surface.surface_id);
         return ib_result;
     }
@@ -3480,14 +3481,14 @@ IOReturn VMOpenGLBridge::testBufferStorageSupport(uint32_t context_id)
     
     IOReturn ub_result = m_accelerator->create3DSurface(context_id, &uniform_buffer_surface);
     if (ub_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Uniform buffer storage test failed (0x%x)\n", ub_result);
+        VMLOG_ERROR("VMOpenGLBridge: Uniform buffer storage test failed (0x%x)\n", ub_result);
         // Continue - large uniform buffers might have size limits
     }
     
     // Test buffer operations and memory management
     IOReturn present_vb = m_accelerator->present3DSurface(context_id, vertex_buffer_surface.surface_id);
     if (present_vb != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Buffer storage presentation test failed (0x%x)\n", present_vb);
+        VMLOG_ERROR("VMOpenGLBridge: Buffer storage presentation test failed (0x%x)\n", present_vb);
         // Continue - presentation might not apply to buffer storage
     }
     
@@ -3498,7 +3499,7 @@ IOReturn VMOpenGLBridge::testBufferStorageSupport(uint32_t context_id)
     m_accelerator->destroy3DSurface(context_id, index_buffer_surface.surface_id);
     m_accelerator->destroy3DSurface(context_id, vertex_buffer_surface.surface_id);
     
-    IOLog("VMOpenGLBridge: Buffer storage support validation completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Buffer storage support validation completed\n");
     return kIOReturnSuccess;
 }
 
@@ -3512,57 +3513,57 @@ IOReturn VMOpenGLBridge::validateAdvanced3DGeometryCapabilities(uint32_t context
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMOpenGLBridge: Starting advanced 3D geometry processing validation\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Starting advanced 3D geometry processing validation\n");
     
     // Stage 1: Multi-primitive type testing
     IOReturn primitive_result = testMultiplePrimitiveTypes(context_id, surface_id);
     if (primitive_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Multiple primitive types test failed: 0x%x\n", primitive_result);
+        VMLOG_ERROR("VMOpenGLBridge: Multiple primitive types test failed: 0x%x\n", primitive_result);
         // Continue - some primitive types might not be supported
     }
     
     // Stage 2: Complex vertex buffer operations
     IOReturn vertex_buffer_result = testAdvancedVertexBufferOperations(context_id, surface_id);
     if (vertex_buffer_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Advanced vertex buffer operations test failed: 0x%x\n", vertex_buffer_result);
+        VMLOG_ERROR("VMOpenGLBridge: Advanced vertex buffer operations test failed: 0x%x\n", vertex_buffer_result);
         // Continue - advanced features are optional
     }
     
     // Stage 3: Index buffer and instanced rendering
     IOReturn instanced_result = testInstancedRenderingCapabilities(context_id, surface_id);
     if (instanced_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Instanced rendering test failed: 0x%x\n", instanced_result);
+        VMLOG_ERROR("VMOpenGLBridge: Instanced rendering test failed: 0x%x\n", instanced_result);
         // Continue - instancing is advanced feature
     }
     
     // Stage 4: Transform feedback and geometry shaders
     IOReturn transform_result = testTransformFeedbackCapabilities(context_id, surface_id);
     if (transform_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Transform feedback test failed: 0x%x\n", transform_result);
+        VMLOG_ERROR("VMOpenGLBridge: Transform feedback test failed: 0x%x\n", transform_result);
         // Continue - transform feedback is OpenGL 3.0+ feature
     }
     
     // Stage 5: Multi-threaded rendering capabilities
     IOReturn multithread_result = testMultithreadedRenderingCapabilities(context_id, surface_id);
     if (multithread_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Multi-threaded rendering test failed: 0x%x\n", multithread_result);
+        VMLOG_ERROR("VMOpenGLBridge: Multi-threaded rendering test failed: 0x%x\n", multithread_result);
         // Continue - multi-threading is optional optimization
     }
     
     // Stage 6: Performance benchmarking
     IOReturn perf_result = performGeometryPerformanceBenchmark(context_id, surface_id);
     if (perf_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Geometry performance benchmark failed: 0x%x\n", perf_result);
+        VMLOG_ERROR("VMOpenGLBridge: Geometry performance benchmark failed: 0x%x\n", perf_result);
         // Continue - benchmarking failure doesn't affect functionality
     }
     
-    IOLog("VMOpenGLBridge: Advanced 3D geometry processing validation completed successfully\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Advanced 3D geometry processing validation completed successfully\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::testMultiplePrimitiveTypes(uint32_t context_id, uint32_t surface_id)
 {
-    IOLog("VMOpenGLBridge: Testing multiple primitive types support\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Testing multiple primitive types support\n");
     
     // Test different primitive types that might be supported by VirtIO GPU
     struct {
@@ -3583,7 +3584,7 @@ IOReturn VMOpenGLBridge::testMultiplePrimitiveTypes(uint32_t context_id, uint32_
     IOReturn overall_result = kIOReturnSuccess;
     
     for (size_t i = 0; i < sizeof(primitive_tests) / sizeof(primitive_tests[0]); i++) {
-        IOLog("VMOpenGLBridge: Testing primitive type %s\n", primitive_tests[i].name);
+        VMLOG_DEBUG("VMOpenGLBridge: Testing primitive type %s\n", primitive_tests[i].name);
         
         // Test primitive drawing using accelerator's drawPrimitives method
         IOReturn draw_result = m_accelerator->drawPrimitives(context_id, 
@@ -3592,9 +3593,9 @@ IOReturn VMOpenGLBridge::testMultiplePrimitiveTypes(uint32_t context_id, uint32_
                                                            0);
         
         if (draw_result == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: %s primitive type supported\n", primitive_tests[i].name);
+            VMLOG_DEBUG("VMOpenGLBridge: %s primitive type supported\n", primitive_tests[i].name);
         } else {
-            IOLog("VMOpenGLBridge: %s primitive type failed (0x%x)\n", 
+            VMLOG_ERROR("VMOpenGLBridge: %s primitive type failed (0x%x)\n", 
                   primitive_tests[i].name, draw_result);
             // Don't fail overall test for unsupported primitive types
         }
@@ -3605,7 +3606,7 @@ IOReturn VMOpenGLBridge::testMultiplePrimitiveTypes(uint32_t context_id, uint32_
 
 IOReturn VMOpenGLBridge::testAdvancedVertexBufferOperations(uint32_t context_id, uint32_t surface_id)
 {
-    IOLog("VMOpenGLBridge: Testing advanced vertex buffer operations\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Testing advanced vertex buffer operations\n");
     
     // Create multiple vertex buffer surfaces with different formats
     VM3DSurfaceInfo vertex_formats[] = {
@@ -3623,9 +3624,9 @@ IOReturn VMOpenGLBridge::testAdvancedVertexBufferOperations(uint32_t context_id,
         IOReturn create_result = m_accelerator->create3DSurface(context_id, &vertex_formats[i]);
         if (create_result == kIOReturnSuccess) {
             created_surfaces[successful_creates++] = vertex_formats[i].surface_id;
-            IOLog("VMOpenGLBridge: Created vertex buffer format %d successfully\n", (int)i);
+            VMLOG_DEBUG("VMOpenGLBridge: Created vertex buffer format %d successfully\n", (int)i);
         } else {
-            IOLog("VMOpenGLBridge: Failed to create vertex buffer format %d (0x%x)\n", 
+            VMLOG_ERROR("VMOpenGLBridge: Failed to create vertex buffer format %d (0x%x)\n", 
                   (int)i, create_result);
         }
     }
@@ -3636,14 +3637,14 @@ IOReturn VMOpenGLBridge::testAdvancedVertexBufferOperations(uint32_t context_id,
                                                                     created_surfaces, 
                                                                     successful_creates);
         if (interleaved_result != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Interleaved vertex attributes test failed: 0x%x\n", interleaved_result);
+            VMLOG_ERROR("VMOpenGLBridge: Interleaved vertex attributes test failed: 0x%x\n", interleaved_result);
         }
     }
     
     // Test large vertex buffer operations
     IOReturn large_buffer_result = testLargeVertexBufferCapabilities(context_id, surface_id);
     if (large_buffer_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Large vertex buffer test failed: 0x%x\n", large_buffer_result);
+        VMLOG_ERROR("VMOpenGLBridge: Large vertex buffer test failed: 0x%x\n", large_buffer_result);
     }
     
     // Cleanup created surfaces
@@ -3651,13 +3652,13 @@ IOReturn VMOpenGLBridge::testAdvancedVertexBufferOperations(uint32_t context_id,
         m_accelerator->destroy3DSurface(context_id, created_surfaces[i]);
     }
     
-    IOLog("VMOpenGLBridge: Advanced vertex buffer operations test completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Advanced vertex buffer operations test completed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::testInstancedRenderingCapabilities(uint32_t context_id, uint32_t surface_id)
 {
-    IOLog("VMOpenGLBridge: Testing instanced rendering capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Testing instanced rendering capabilities\n");
     
     // Test multiple draw calls to simulate instanced rendering
     struct {
@@ -3672,7 +3673,7 @@ IOReturn VMOpenGLBridge::testInstancedRenderingCapabilities(uint32_t context_id,
     };
     
     for (size_t i = 0; i < sizeof(instance_tests) / sizeof(instance_tests[0]); i++) {
-        IOLog("VMOpenGLBridge: Testing %s\n", instance_tests[i].description);
+        VMLOG_DEBUG("VMOpenGLBridge: Testing %s\n", instance_tests[i].description);
         
         // Simulate instanced rendering with multiple draw calls
         for (uint32_t instance = 0; instance < instance_tests[i].instance_count; instance++) {
@@ -3682,7 +3683,7 @@ IOReturn VMOpenGLBridge::testInstancedRenderingCapabilities(uint32_t context_id,
                                                                instance * instance_tests[i].vertex_count);
             
             if (draw_result != kIOReturnSuccess) {
-                IOLog("VMOpenGLBridge: Instance %d draw failed (0x%x)\n", instance, draw_result);
+                VMLOG_ERROR("VMOpenGLBridge: Instance %d draw failed (0x%x)\n", instance, draw_result);
                 // Continue with other instances
             }
         }
@@ -3690,17 +3691,17 @@ IOReturn VMOpenGLBridge::testInstancedRenderingCapabilities(uint32_t context_id,
         // Test presentation of instanced geometry
         IOReturn present_result = m_accelerator->present3DSurface(context_id, surface_id);
         if (present_result != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Instanced rendering presentation failed (0x%x)\n", present_result);
+            VMLOG_ERROR("VMOpenGLBridge: Instanced rendering presentation failed (0x%x)\n", present_result);
         }
     }
     
-    IOLog("VMOpenGLBridge: Instanced rendering capabilities test completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Instanced rendering capabilities test completed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::testTransformFeedbackCapabilities(uint32_t context_id, uint32_t surface_id)
 {
-    IOLog("VMOpenGLBridge: Testing transform feedback capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Testing transform feedback capabilities\n");
     
     // Test geometry shader compilation if available
     if (m_accelerator->getShaderManager()) {
@@ -3725,37 +3726,37 @@ IOReturn VMOpenGLBridge::testTransformFeedbackCapabilities(uint32_t context_id,
                                                         &geometry_shader_id);
         
         if (gs_result == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Geometry shader compilation successful\n");
+            VMLOG_DEBUG("VMOpenGLBridge: Geometry shader compilation successful\n");
             
             // Test geometry shader in transform feedback pipeline
             IOReturn tf_result = testGeometryShaderTransformFeedback(context_id, geometry_shader_id);
             if (tf_result != kIOReturnSuccess) {
-                IOLog("VMOpenGLBridge: Geometry shader transform feedback failed: 0x%x\n", tf_result);
+                VMLOG_ERROR("VMOpenGLBridge: Geometry shader transform feedback failed: 0x%x\n", tf_result);
             }
             
             // Cleanup
             m_accelerator->destroyShader(context_id, geometry_shader_id);
         } else {
-            IOLog("VMOpenGLBridge: Geometry shader compilation failed (0x%x)\n", gs_result);
+            VMLOG_ERROR("VMOpenGLBridge: Geometry shader compilation failed (0x%x)\n", gs_result);
         }
     } else {
-        IOLog("VMOpenGLBridge: No shader manager available for transform feedback testing\n");
+        VMLOG_DEBUG("VMOpenGLBridge: No shader manager available for transform feedback testing\n");
     }
     
-    IOLog("VMOpenGLBridge: Transform feedback capabilities test completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Transform feedback capabilities test completed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::testMultithreadedRenderingCapabilities(uint32_t context_id, uint32_t surface_id)
 {
-    IOLog("VMOpenGLBridge: Testing multi-threaded rendering capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Testing multi-threaded rendering capabilities\n");
     
     // Test concurrent command submission capabilities
     // Create multiple command buffers for parallel submission
     const size_t num_threads = 4;
     uint8_t** command_buffers = (uint8_t**)IOMalloc(num_threads * sizeof(uint8_t*));
     if (!command_buffers) {
-        IOLog("VMOpenGLBridge: Failed to allocate command buffers array\n");
+        VMLOG_ERROR("VMOpenGLBridge: Failed to allocate command buffers array\n");
         return kIOReturnNoMemory;
     }
     
@@ -3768,7 +3769,7 @@ IOReturn VMOpenGLBridge::testMultithreadedRenderingCapabilities(uint32_t context
                 IOFree(command_buffers[j], 128);
             }
             IOFree(command_buffers, num_threads * sizeof(uint8_t*));
-            IOLog("VMOpenGLBridge: Failed to allocate command buffer %zu\n", i);
+            VMLOG_ERROR("VMOpenGLBridge: Failed to allocate command buffer %zu\n", i);
             return kIOReturnNoMemory;
         }
     }
@@ -3798,7 +3799,7 @@ IOReturn VMOpenGLBridge::testMultithreadedRenderingCapabilities(uint32_t context
     for (size_t i = 0; i < num_threads; i++) {
         IOReturn submit_result = m_accelerator->submit3DCommands(context_id, descriptors[i]);
         if (submit_result != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Multi-threaded command %zu submission failed (0x%x)\n", 
+            VMLOG_ERROR("VMOpenGLBridge: Multi-threaded command %zu submission failed (0x%x)\n", 
                   i, submit_result);
             overall_result = submit_result;
         }
@@ -3808,7 +3809,7 @@ IOReturn VMOpenGLBridge::testMultithreadedRenderingCapabilities(uint32_t context
     for (size_t i = 0; i < num_threads; i++) {
         IOReturn present_result = m_accelerator->present3DSurface(context_id, surface_id);
         if (present_result != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Multi-threaded presentation %zu failed (0x%x)\n", 
+            VMLOG_ERROR("VMOpenGLBridge: Multi-threaded presentation %zu failed (0x%x)\n", 
                   i, present_result);
         }
     }
@@ -3829,13 +3830,13 @@ IOReturn VMOpenGLBridge::testMultithreadedRenderingCapabilities(uint32_t context
     }
     IOFree(command_buffers, num_threads * sizeof(uint8_t*));
     
-    IOLog("VMOpenGLBridge: Multi-threaded rendering capabilities test completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Multi-threaded rendering capabilities test completed\n");
     return overall_result;
 }
 
 IOReturn VMOpenGLBridge::performGeometryPerformanceBenchmark(uint32_t context_id, uint32_t surface_id)
 {
-    IOLog("VMOpenGLBridge: Performing geometry processing performance benchmark\n");
+    VMLOG_INFO("VMOpenGLBridge: Performing geometry processing performance benchmark\n");
     
     // Benchmark different geometry workloads
     struct {
@@ -3850,7 +3851,7 @@ IOReturn VMOpenGLBridge::performGeometryPerformanceBenchmark(uint32_t context_id
     };
     
     for (size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
-        IOLog("VMOpenGLBridge: Running %s\n", benchmarks[i].workload_name);
+        VMLOG_INFO("VMOpenGLBridge: Running %s\n", benchmarks[i].workload_name);
         
         // Record start time (simplified timing)
         uint64_t start_time = mach_absolute_time();
@@ -3866,7 +3867,7 @@ IOReturn VMOpenGLBridge::performGeometryPerformanceBenchmark(uint32_t context_id
                                                                0);
             
             if (draw_result != kIOReturnSuccess) {
-                IOLog("VMOpenGLBridge: Benchmark iteration %d failed (0x%x)\n", iter, draw_result);
+                VMLOG_WARN("VMOpenGLBridge: Benchmark iteration %d failed (0x%x)\n", iter, draw_result);
                 break;
             }
             
@@ -3879,7 +3880,7 @@ IOReturn VMOpenGLBridge::performGeometryPerformanceBenchmark(uint32_t context_id
         uint64_t duration = end_time - start_time;
         
         // Simple performance logging without complex time conversion
-        IOLog("VMOpenGLBridge: %s completed in %llu cycles (%d triangles, %d iterations)\n",
+        VMLOG_INFO("VMOpenGLBridge: %s completed in %llu cycles (%d triangles, %d iterations)\n",
               benchmarks[i].workload_name, duration, 
               benchmarks[i].triangle_count, benchmarks[i].iterations);
         
@@ -3889,12 +3890,12 @@ IOReturn VMOpenGLBridge::performGeometryPerformanceBenchmark(uint32_t context_id
             uint32_t triangles = m_accelerator->getTriangleCount();
             uint64_t memory_usage = m_accelerator->getMemoryUsage();
             
-            IOLog("VMOpenGLBridge: Performance stats - Draw calls: %d, Triangles: %d, Memory: %llu bytes\n",
+            VMLOG_INFO("VMOpenGLBridge: Performance stats - Draw calls: %d, Triangles: %d, Memory: %llu bytes\n",
                   draw_calls, triangles, memory_usage);
         }
     }
     
-    IOLog("VMOpenGLBridge: Geometry performance benchmark completed\n");
+    VMLOG_INFO("VMOpenGLBridge: Geometry performance benchmark completed\n");
     return kIOReturnSuccess;
 }
 
@@ -3904,7 +3905,7 @@ IOReturn VMOpenGLBridge::performGeometryPerformanceBenchmark(uint32_t context_id
 
 IOReturn VMOpenGLBridge::testInterleavedVertexAttributes(uint32_t context_id, uint32_t* surface_ids, size_t count)
 {
-    IOLog("VMOpenGLBridge: Testing interleaved vertex attributes with %u surfaces\n", (uint32_t)count);
+    VMLOG_DEBUG("VMOpenGLBridge: Testing interleaved vertex attributes with %u surfaces\n", (uint32_t)count);
     
     if (!surface_ids || count == 0) {
         return kIOReturnBadArgument;
@@ -3918,7 +3919,7 @@ IOReturn VMOpenGLBridge::testInterleavedVertexAttributes(uint32_t context_id, ui
                                                                  (uint32_t)(i * 6)); // Offset per buffer
         
         if (draw_result != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Interleaved attribute draw %zu failed (0x%x)\n", i, draw_result);
+            VMLOG_ERROR("VMOpenGLBridge: Interleaved attribute draw %zu failed (0x%x)\n", i, draw_result);
             return draw_result;
         }
     }
@@ -3926,16 +3927,16 @@ IOReturn VMOpenGLBridge::testInterleavedVertexAttributes(uint32_t context_id, ui
     // Test presentation of combined geometry
     IOReturn present_result = this->m_accelerator->present3DSurface(context_id, surface_ids[0]);
     if (present_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Interleaved attributes presentation failed (0x%x)\n", present_result);
+        VMLOG_ERROR("VMOpenGLBridge: Interleaved attributes presentation failed (0x%x)\n", present_result);
     }
     
-    IOLog("VMOpenGLBridge: Interleaved vertex attributes test completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Interleaved vertex attributes test completed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::testLargeVertexBufferCapabilities(uint32_t context_id, uint32_t surface_id)
 {
-    IOLog("VMOpenGLBridge: Testing large vertex buffer capabilities\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Testing large vertex buffer capabilities\n");
     
     // Test progressively larger vertex buffers
     uint32_t buffer_sizes[] = {4096, 16384, 65536, 262144}; // 4KB to 256KB
@@ -3949,7 +3950,7 @@ IOReturn VMOpenGLBridge::testLargeVertexBufferCapabilities(uint32_t context_id,
         
         IOReturn create_result = this->m_accelerator->create3DSurface(context_id, &large_buffer);
         if (create_result != kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Failed to create %d byte vertex buffer (0x%x)\n", 
+            VMLOG_ERROR("VMOpenGLBridge: Failed to create %d byte vertex buffer (0x%x)\n", 
                   buffer_sizes[i], create_result);
             continue;
         }
@@ -3962,10 +3963,10 @@ IOReturn VMOpenGLBridge::testLargeVertexBufferCapabilities(uint32_t context_id,
                                                                  0);
         
         if (draw_result == kIOReturnSuccess) {
-            IOLog("VMOpenGLBridge: Successfully drew %d vertices from %d byte buffer\n", 
+            VMLOG_DEBUG("VMOpenGLBridge: Successfully drew %d vertices from %d byte buffer\n", 
                   vertex_count, buffer_sizes[i]);
         } else {
-            IOLog("VMOpenGLBridge: Failed to draw from %d byte buffer (0x%x)\n", 
+            VMLOG_ERROR("VMOpenGLBridge: Failed to draw from %d byte buffer (0x%x)\n", 
                   buffer_sizes[i], draw_result);
         }
         
@@ -3973,13 +3974,13 @@ IOReturn VMOpenGLBridge::testLargeVertexBufferCapabilities(uint32_t context_id,
         this->m_accelerator->destroy3DSurface(context_id, large_buffer.surface_id);
     }
     
-    IOLog("VMOpenGLBridge: Large vertex buffer capabilities test completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Large vertex buffer capabilities test completed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLBridge::testGeometryShaderTransformFeedback(uint32_t context_id, uint32_t geometry_shader_id)
 {
-    IOLog("VMOpenGLBridge: Testing geometry shader transform feedback\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Testing geometry shader transform feedback\n");
     
     // Create vertex and fragment shaders to complete the pipeline
     const char* vertex_shader_source = 
@@ -3998,7 +3999,7 @@ IOReturn VMOpenGLBridge::testGeometryShaderTransformFeedback(uint32_t context_id
                                                           &vertex_shader_id);
     
     if (vs_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to compile vertex shader for transform feedback (0x%x)\n", vs_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to compile vertex shader for transform feedback (0x%x)\n", vs_result);
         return vs_result;
     }
     
@@ -4018,7 +4019,7 @@ IOReturn VMOpenGLBridge::testGeometryShaderTransformFeedback(uint32_t context_id
                                                           &fragment_shader_id);
     
     if (fs_result != kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Failed to compile fragment shader for transform feedback (0x%x)\n", fs_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to compile fragment shader for transform feedback (0x%x)\n", fs_result);
         this->m_accelerator->destroyShader(context_id, vertex_shader_id);
         return fs_result;
     }
@@ -4029,7 +4030,7 @@ IOReturn VMOpenGLBridge::testGeometryShaderTransformFeedback(uint32_t context_id
     IOReturn link_result = this->m_accelerator->createShaderProgram(context_id, shaders, 3, &program_id);
     
     if (link_result == kIOReturnSuccess) {
-        IOLog("VMOpenGLBridge: Geometry shader program linked successfully\n");
+        VMLOG_DEBUG("VMOpenGLBridge: Geometry shader program linked successfully\n");
         
         // Test program usage
         IOReturn use_result = this->m_accelerator->useShaderProgram(context_id, program_id);
@@ -4041,29 +4042,29 @@ IOReturn VMOpenGLBridge::testGeometryShaderTransformFeedback(uint32_t context_id
                                                                      0);
             
             if (draw_result == kIOReturnSuccess) {
-                IOLog("VMOpenGLBridge: Geometry shader transform feedback rendering successful\n");
+                VMLOG_DEBUG("VMOpenGLBridge: Geometry shader transform feedback rendering successful\n");
             } else {
-                IOLog("VMOpenGLBridge: Geometry shader rendering failed (0x%x)\n", draw_result);
+                VMLOG_ERROR("VMOpenGLBridge: Geometry shader rendering failed (0x%x)\n", draw_result);
             }
         } else {
-            IOLog("VMOpenGLBridge: Failed to use geometry shader program (0x%x)\n", use_result);
+            VMLOG_ERROR("VMOpenGLBridge: Failed to use geometry shader program (0x%x)\n", use_result);
         }
     } else {
-        IOLog("VMOpenGLBridge: Failed to link geometry shader program (0x%x)\n", link_result);
+        VMLOG_ERROR("VMOpenGLBridge: Failed to link geometry shader program (0x%x)\n", link_result);
     }
     
     // Cleanup
     this->m_accelerator->destroyShader(context_id, fragment_shader_id);
     this->m_accelerator->destroyShader(context_id, vertex_shader_id);
     
-    IOLog("VMOpenGLBridge: Geometry shader transform feedback test completed\n");
+    VMLOG_DEBUG("VMOpenGLBridge: Geometry shader transform feedback test completed\n");
     return kIOReturnSuccess;
 }
 
 // Snow Leopard system integration methods
 IOReturn CLASS::registerWithQuartzOpenGL()
 {
-    IOLog("VMOpenGLBridge: Registering with Snow Leopard Quartz OpenGL system\n");
+    VMLOG_INFO("VMOpenGLBridge: Registering with Snow Leopard Quartz OpenGL system\n");
     
     // Register through the accelerator which has access to setProperty
     if (m_accelerator) {
@@ -4074,13 +4075,13 @@ IOReturn CLASS::registerWithQuartzOpenGL()
         // Enable Core Animation hardware acceleration
     }
     
-    IOLog("VMOpenGLBridge: Successfully registered with Quartz OpenGL system\n");
+    VMLOG_INFO("VMOpenGLBridge: Successfully registered with Quartz OpenGL system\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::setupCoreGraphicsIntegration()
 {
-    IOLog("VMOpenGLBridge: Setting up Core Graphics integration for Canvas 2D acceleration\n");
+    VMLOG_INFO("VMOpenGLBridge: Setting up Core Graphics integration for Canvas 2D acceleration\n");
     
     // Register through the accelerator which has access to setProperty
     if (m_accelerator) {
@@ -4093,13 +4094,13 @@ IOReturn CLASS::setupCoreGraphicsIntegration()
         // YouTube-specific Canvas optimizations
     }
     
-    IOLog("VMOpenGLBridge: Core Graphics integration setup completed\n");
+    VMLOG_INFO("VMOpenGLBridge: Core Graphics integration setup completed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::setupBrowserOpenGLHooks()
 {
-    IOLog("VMOpenGLBridge: Setting up browser OpenGL acceleration hooks\n");
+    VMLOG_INFO("VMOpenGLBridge: Setting up browser OpenGL acceleration hooks\n");
     
     // Register through the accelerator which has access to setProperty
     if (m_accelerator) {
@@ -4112,6 +4113,6 @@ IOReturn CLASS::setupBrowserOpenGLHooks()
         // System-wide WebGL and Canvas hooks
     }
     
-    IOLog("VMOpenGLBridge: Browser OpenGL hooks setup completed\n");
+    VMLOG_INFO("VMOpenGLBridge: Browser OpenGL hooks setup completed\n");
     return kIOReturnSuccess;
 }
@@ -4,6 +4,8 @@
 
 #include "VMOpenGLTranslator.h"
 #include "VMVirtIOGPU.h"
+#include "VMIndexScan.h"
+#include "VMLog.h"
 #include <libkern/OSMalloc.h>
 #include <string.h>
 
@@ -33,9 +35,92 @@ OSDefineMetaClassAndStructors(VMOpenGLTranslator, OSObject)
 #define GL_TEXTURE_COORD_ARRAY 0x8078
 #define GL_NORMAL_ARRAY     0x8075
 
+#define GL_BYTE             0x1400
+#define GL_UNSIGNED_BYTE    0x1401
+#define GL_SHORT            0x1402
+#define GL_UNSIGNED_SHORT   0x1403
+#define GL_INT              0x1404
+#define GL_UNSIGNED_INT     0x1405
+#define GL_FLOAT            0x1406
+#define GL_DOUBLE           0x140A
+
 #define GL_ARRAY_BUFFER     0x8892
 #define GL_ELEMENT_ARRAY_BUFFER 0x8893
 
+#define GL_NEVER            0x0200
+#define GL_LESS             0x0201
+#define GL_ALWAYS           0x0207
+
+#define GL_ZERO             0
+#define GL_ONE              1
+#define GL_SRC_COLOR        0x0300
+#define GL_ONE_MINUS_SRC_COLOR 0x0301
+#define GL_SRC_ALPHA        0x0302
+#define GL_ONE_MINUS_SRC_ALPHA 0x0303
+#define GL_DST_ALPHA        0x0304
+#define GL_ONE_MINUS_DST_ALPHA 0x0305
+#define GL_DST_COLOR        0x0306
+#define GL_ONE_MINUS_DST_COLOR 0x0307
+#define GL_SRC_ALPHA_SATURATE 0x0308
+#define GL_CONSTANT_COLOR   0x8001
+#define GL_ONE_MINUS_CONSTANT_COLOR 0x8002
+#define GL_CONSTANT_ALPHA   0x8003
+#define GL_ONE_MINUS_CONSTANT_ALPHA 0x8004
+
+#define GL_FUNC_ADD         0x8006
+#define GL_MIN              0x8007
+#define GL_MAX              0x8008
+#define GL_FUNC_SUBTRACT    0x800A
+#define GL_FUNC_REVERSE_SUBTRACT 0x800B
+
+#define GL_FRONT            0x0404
+#define GL_BACK             0x0405
+#define GL_FRONT_AND_BACK   0x0408
+#define GL_CW               0x0900
+#define GL_CCW              0x0901
+
+#define GL_TEXTURE0         0x84C0
+#define GL_TEXTURE_MAG_FILTER 0x2800
+#define GL_TEXTURE_MIN_FILTER 0x2801
+#define GL_TEXTURE_WRAP_S   0x2802
+#define GL_TEXTURE_WRAP_T   0x2803
+#define GL_NEAREST          0x2600
+#define GL_LINEAR           0x2601
+#define GL_NEAREST_MIPMAP_NEAREST 0x2700
+#define GL_LINEAR_MIPMAP_NEAREST 0x2701
+#define GL_NEAREST_MIPMAP_LINEAR 0x2702
+#define GL_LINEAR_MIPMAP_LINEAR 0x2703
+#define GL_CLAMP            0x2900
+#define GL_REPEAT           0x2901
+#define GL_CLAMP_TO_BORDER  0x812D
+#define GL_CLAMP_TO_EDGE    0x812F
+#define GL_MIRRORED_REPEAT  0x8370
+
+#define GL_MODELVIEW        0x1700
+#define GL_PROJECTION       0x1701
+
+#define GL_LIGHTING         0x0B50
+#define GL_LIGHT0           0x4000
+#define GL_COLOR_MATERIAL   0x0B57
+#define GL_NORMALIZE        0x0BA1
+#define GL_FOG              0x0B60
+#define GL_ALPHA_TEST       0x0BC0
+#define GL_AMBIENT          0x1200
+#define GL_DIFFUSE          0x1201
+#define GL_SPECULAR         0x1202
+#define GL_POSITION         0x1203
+#define GL_EMISSION         0x1600
+#define GL_SHININESS        0x1601
+#define GL_AMBIENT_AND_DIFFUSE 0x1602
+#define GL_LIGHT_MODEL_AMBIENT 0x0B53
+#define GL_FOG_DENSITY      0x0B62
+#define GL_FOG_START        0x0B63
+#define GL_FOG_END          0x0B64
+#define GL_FOG_MODE         0x0B65
+#define GL_FOG_COLOR        0x0B66
+#define GL_EXP              0x0800
+#define GL_EXP2             0x0801
+
 bool VMOpenGLTranslator::init() {
     if (!super::init()) {
         return false;
@@ -44,17 +129,64 @@ bool VMOpenGLTranslator::init() {
     m_accelerator = NULL;
     m_context_id = 0;
     m_next_handle = 100; // Start handles at 100
-    m_vertex_shader_handle = 0;
-    m_fragment_shader_handle = 0;
-    m_shaders_created = false;
-    
-    // Allocate command buffer (64KB should be enough)
-    m_command_buffer_size = 16384; // 64KB / 4 bytes = 16K dwords
-    m_command_buffer = (uint32_t*)IOMalloc(m_command_buffer_size * sizeof(uint32_t));
-    if (!m_command_buffer) {
+    
+    // Allocate the command stream; it grows on demand up to the flush threshold
+    m_command_stream = IOBufferMemoryDescriptor::withCapacity(
+        VM_GL_STREAM_INITIAL_DWORDS * sizeof(uint32_t), kIODirectionOut);
+    if (!m_command_stream) {
         return false;
     }
+    m_command_buffer = (uint32_t*)m_command_stream->getBytesNoCopy();
+    m_command_buffer_size = VM_GL_STREAM_INITIAL_DWORDS;
     m_command_offset = 0;
+    m_commands_queued = 0;
+    m_stream_commands = 0;
+    m_stream_submits = 0;
+    bzero(m_stream_flushes, sizeof(m_stream_flushes));
+    
+    // Rings are created by the first draw that needs them
+    initRing(&m_vertex_ring, "vertex", VIRGL_BIND_VERTEX_BUFFER, VM_GL_VB_RING_INITIAL_BYTES);
+    initRing(&m_index_ring, "index", VIRGL_BIND_INDEX_BUFFER, VM_GL_IB_RING_INITIAL_BYTES);
+    
+    bzero(m_geometry, sizeof(m_geometry));
+    bzero(m_geometry_seen, sizeof(m_geometry_seen));
+    m_geometry_bytes = 0;
+    m_geometry_clock = 0;
+    m_geometry_hits = 0;
+    m_geometry_misses = 0;
+    m_geometry_evictions = 0;
+    m_geometry_bytes_saved = 0;
+    
+    // State object cache; everything is dirty until the first draw binds it
+    m_cso_cache = (VMGLStateObject*)IOMalloc(VM_GL_CSO_CACHE_ENTRIES * sizeof(VMGLStateObject));
+    if (!m_cso_cache) {
+        m_command_stream->release();
+        m_command_stream = NULL;
+        m_command_buffer = NULL;
+        return false;
+    }
+    bzero(m_cso_cache, VM_GL_CSO_CACHE_ENTRIES * sizeof(VMGLStateObject));
+    m_cso_count = 0;
+    m_cso_clock = 0;
+    bzero(m_cso_bound, sizeof(m_cso_bound));
+    bzero(m_sampler_bound, sizeof(m_sampler_bound));
+    m_sampler_bound_count = 0;
+    m_state_dirty = VM_GL_DIRTY_ALL;
+    m_cso_hits = 0;
+    m_cso_creates = 0;
+    m_cso_evictions = 0;
+    m_cso_binds = 0;
+    
+    // Fixed-function programs are generated by the first draw that needs them
+    bzero(m_ffp_cache, sizeof(m_ffp_cache));
+    m_ffp_bound = NULL;
+    bzero(&m_ffp_key, sizeof(m_ffp_key));
+    m_ffp_text = NULL;
+    m_ffp_clock = 0;
+    m_ffp_hits = 0;
+    m_ffp_creates = 0;
+    m_ffp_evictions = 0;
+    m_ffp_switches = 0;
     
     // Initialize state
     bzero(&m_state, sizeof(m_state));
@@ -62,39 +194,108 @@ bool VMOpenGLTranslator::init() {
     m_state.current_color[1] = 1.0f;
     m_state.current_color[2] = 1.0f;
     m_state.current_color[3] = 1.0f;
+    m_state.current_normal[2] = 1.0f;
     m_state.clear_color[3] = 1.0f;
     m_state.clear_depth = 1.0;
     m_state.depth_near = 0.0f;
     m_state.depth_far = 1.0f;
     m_state.depth_write_enabled = true;
-    m_state.blend_src_factor = PIPE_BLENDFACTOR_ONE;
-    m_state.blend_dst_factor = PIPE_BLENDFACTOR_ZERO;
-    
-    // Allocate vertex batch buffer
-    m_state.vertex_data = (float*)IOMalloc(MAX_BATCH_VERTICES * 12 * sizeof(float)); // pos+color+texcoord+normal
-    if (!m_state.vertex_data) {
-        IOFree(m_command_buffer, m_command_buffer_size * sizeof(uint32_t));
+    m_state.depth_func = GL_LESS;
+    m_state.blend_src_factor = GL_ONE;
+    m_state.blend_dst_factor = GL_ZERO;
+    m_state.blend_equation = GL_FUNC_ADD;
+    m_state.cull_mode = GL_BACK;
+    m_state.front_face = GL_CCW;
+    for (uint32_t unit = 0; unit < MAX_TEXTURES; unit++) {
+        m_state.tex_min_filter[unit] = GL_NEAREST_MIPMAP_LINEAR;
+        m_state.tex_mag_filter[unit] = GL_LINEAR;
+        m_state.tex_wrap_s[unit] = GL_REPEAT;
+        m_state.tex_wrap_t[unit] = GL_REPEAT;
+    }
+    m_state.fog_mode = GL_EXP;
+    m_state.alpha_func = GL_ALWAYS;
+    virgl_ffp_state_init(&m_state.ffp);
+    
+    // Allocate vertex batch buffer and the program text scratch
+    m_state.vertex_data = (float*)IOMalloc(MAX_BATCH_VERTICES * VM_GL_VERTEX_BYTES);
+    m_ffp_text = (char*)IOMalloc(2 * VIRGL_FFP_TEXT_MAX);
+    if (!m_state.vertex_data || !m_ffp_text) {
+        if (m_state.vertex_data) {
+            IOFree(m_state.vertex_data, MAX_BATCH_VERTICES * VM_GL_VERTEX_BYTES);
+            m_state.vertex_data = NULL;
+        }
+        if (m_ffp_text) {
+            IOFree(m_ffp_text, 2 * VIRGL_FFP_TEXT_MAX);
+            m_ffp_text = NULL;
+        }
+        IOFree(m_cso_cache, VM_GL_CSO_CACHE_ENTRIES * sizeof(VMGLStateObject));
+        m_cso_cache = NULL;
+        m_command_stream->release();
+        m_command_stream = NULL;
+        m_command_buffer = NULL;
         return false;
     }
     
     // Initialize identity matrices
+    m_state.matrix_mode = GL_PROJECTION;
+    glLoadIdentity();
+    m_state.matrix_mode = GL_MODELVIEW;
     glLoadIdentity();
     
-    IOLog("VMOpenGLTranslator: Initialized with command buffer size %u dwords\n", m_command_buffer_size);
+    VMLOG_INFO("VMOpenGLTranslator: Initialized with command stream of %u dwords\n", m_command_buffer_size);
     return true;
 }
 
 void VMOpenGLTranslator::free() {
-    if (m_command_buffer) {
-        IOFree(m_command_buffer, m_command_buffer_size * sizeof(uint32_t));
+    if (m_command_stream) {
+        // Don't drop draws the client already issued
+        if (m_command_offset) {
+            flushCommandStream(kVMGLFlushExplicit);
+        }
+        VMLOG_INFO("VMOpenGLTranslator: context %u submitted %llu commands in %llu streams "
+              "(explicit %llu, full %llu, readback %llu, ring %llu, eviction %llu)\n",
+              m_context_id, m_stream_commands, m_stream_submits,
+              m_stream_flushes[kVMGLFlushExplicit], m_stream_flushes[kVMGLFlushFull],
+              m_stream_flushes[kVMGLFlushReadback], m_stream_flushes[kVMGLFlushRing],
+              m_stream_flushes[kVMGLFlushEviction]);
+        m_command_stream->release();
+        m_command_stream = NULL;
         m_command_buffer = NULL;
     }
     
+    // Every stream that read from the rings has been submitted above
+    destroyRing(&m_vertex_ring);
+    destroyRing(&m_index_ring);
+    releaseGeometryCache();
+    
+    if (m_cso_cache) {
+        // Host objects go away with the context
+        VMLOG_INFO("VMOpenGLTranslator: context %u state objects: %llu hits, %llu created, "
+              "%llu evicted, %llu binds\n",
+              m_context_id, m_cso_hits, m_cso_creates, m_cso_evictions, m_cso_binds);
+        IOFree(m_cso_cache, VM_GL_CSO_CACHE_ENTRIES * sizeof(VMGLStateObject));
+        m_cso_cache = NULL;
+    }
+    
+    if (m_ffp_text) {
+        // Shader objects go away with the context too
+        VMLOG_INFO("VMOpenGLTranslator: context %u fixed-function programs: %llu hits, %llu generated, "
+              "%llu evicted, %llu switches\n",
+              m_context_id, m_ffp_hits, m_ffp_creates, m_ffp_evictions, m_ffp_switches);
+        IOFree(m_ffp_text, 2 * VIRGL_FFP_TEXT_MAX);
+        m_ffp_text = NULL;
+    }
+    
     if (m_state.vertex_data) {
-        IOFree(m_state.vertex_data, MAX_BATCH_VERTICES * 12 * sizeof(float));
+        IOFree(m_state.vertex_data, MAX_BATCH_VERTICES * VM_GL_VERTEX_BYTES);
         m_state.vertex_data = NULL;
     }
     
+    releaseClientArray(&m_state.vertex_memory);
+    releaseClientArray(&m_state.color_memory);
+    releaseClientArray(&m_state.texcoord_memory);
+    releaseClientArray(&m_state.normal_memory);
+    
     super::free();
 }
 
@@ -103,16 +304,15 @@ bool VMOpenGLTranslator::initWithAccelerator(VMVirtIOGPUAccelerator* accelerator
     m_accelerator = accelerator;
     m_context_id = context_id;
     
-    IOLog("VMOpenGLTranslator::initWithAccelerator: context_id=%u\n", context_id);
+    VMLOG_INFO("VMOpenGLTranslator::initWithAccelerator: context_id=%u\n", context_id);
     
-    // Initialize rendering pipeline
-    createDefaultShaders();
+    // Initialize rendering pipeline; shaders are bound by the first draw
     setupRenderTarget();
     
     // Set default viewport (matches common 640x480)
     glViewport(0, 0, 640, 480);
     
-    IOLog("✅ OpenGL translator initialized with context %u\n", context_id);
+    VMLOG_INFO("✅ OpenGL translator initialized with context %u\n", context_id);
     
     return true;
 }
@@ -138,15 +338,54 @@ uint32_t VMOpenGLTranslator::glPrimitiveToVirgl(uint32_t gl_mode) {
 }
 
 uint32_t VMOpenGLTranslator::glBlendFactorToVirgl(uint32_t gl_factor) {
-    // Simplified mapping - would need full GL constant mapping
-    return PIPE_BLENDFACTOR_ONE;
+    switch (gl_factor) {
+        case GL_ZERO: return PIPE_BLENDFACTOR_ZERO;
+        case GL_ONE: return PIPE_BLENDFACTOR_ONE;
+        case GL_SRC_COLOR: return PIPE_BLENDFACTOR_SRC_COLOR;
+        case GL_ONE_MINUS_SRC_COLOR: return PIPE_BLENDFACTOR_INV_SRC_COLOR;
+        case GL_SRC_ALPHA: return PIPE_BLENDFACTOR_SRC_ALPHA;
+        case GL_ONE_MINUS_SRC_ALPHA: return PIPE_BLENDFACTOR_INV_SRC_ALPHA;
+        case GL_DST_ALPHA: return PIPE_BLENDFACTOR_DST_ALPHA;
+        case GL_ONE_MINUS_DST_ALPHA: return PIPE_BLENDFACTOR_INV_DST_ALPHA;
+        case GL_DST_COLOR: return PIPE_BLENDFACTOR_DST_COLOR;
+        case GL_ONE_MINUS_DST_COLOR: return PIPE_BLENDFACTOR_INV_DST_COLOR;
+        case GL_SRC_ALPHA_SATURATE: return PIPE_BLENDFACTOR_SRC_ALPHA_SATURATE;
+        case GL_CONSTANT_COLOR: return PIPE_BLENDFACTOR_CONST_COLOR;
+        case GL_ONE_MINUS_CONSTANT_COLOR: return PIPE_BLENDFACTOR_INV_CONST_COLOR;
+        case GL_CONSTANT_ALPHA: return PIPE_BLENDFACTOR_CONST_ALPHA;
+        case GL_ONE_MINUS_CONSTANT_ALPHA: return PIPE_BLENDFACTOR_INV_CONST_ALPHA;
+        default: return PIPE_BLENDFACTOR_ONE;
+    }
+}
+
+uint32_t VMOpenGLTranslator::glBlendEquationToVirgl(uint32_t gl_equation) {
+    switch (gl_equation) {
+        case GL_FUNC_SUBTRACT: return PIPE_BLEND_SUBTRACT;
+        case GL_FUNC_REVERSE_SUBTRACT: return PIPE_BLEND_REVERSE_SUBTRACT;
+        case GL_MIN: return PIPE_BLEND_MIN;
+        case GL_MAX: return PIPE_BLEND_MAX;
+        default: return PIPE_BLEND_ADD;
+    }
 }
 
 uint32_t VMOpenGLTranslator::glCompareFuncToVirgl(uint32_t gl_func) {
-    // Simplified - would need full mapping
+    // GL_NEVER..GL_ALWAYS are in the same order as PIPE_FUNC_*
+    if (gl_func >= GL_NEVER && gl_func <= GL_ALWAYS) {
+        return gl_func - GL_NEVER;
+    }
     return PIPE_FUNC_LESS;
 }
 
+uint32_t VMOpenGLTranslator::glWrapToVirgl(uint32_t gl_wrap) {
+    switch (gl_wrap) {
+        case GL_CLAMP: return PIPE_TEX_WRAP_CLAMP;
+        case GL_CLAMP_TO_EDGE: return PIPE_TEX_WRAP_CLAMP_TO_EDGE;
+        case GL_CLAMP_TO_BORDER: return PIPE_TEX_WRAP_CLAMP_TO_BORDER;
+        case GL_MIRRORED_REPEAT: return PIPE_TEX_WRAP_MIRROR_REPEAT;
+        default: return PIPE_TEX_WRAP_REPEAT;
+    }
+}
+
 uint32_t VMOpenGLTranslator::glFormatToVirgl(uint32_t gl_format) {
     // Simplified - would need full format mapping
     return VIRGL_FORMAT_R8G8B8A8_UNORM;
@@ -172,22 +411,15 @@ IOReturn VMOpenGLTranslator::glClear(uint32_t mask) {
         virgl_buffers |= PIPE_CLEAR_STENCIL;
     }
     
-    uint32_t cmd[VIRGL_CLEAR_SIZE];
-    VIRGL_SET_COMMAND(cmd, 0, VIRGL_CCMD_CLEAR, VIRGL_CLEAR_SIZE - 1);
-    VIRGL_SET_DWORD(cmd, 1, virgl_buffers);
-    VIRGL_SET_DWORD(cmd, 2, virgl_pack_float(m_state.clear_color[0]));
-    VIRGL_SET_DWORD(cmd, 3, virgl_pack_float(m_state.clear_color[1]));
-    VIRGL_SET_DWORD(cmd, 4, virgl_pack_float(m_state.clear_color[2]));
-    VIRGL_SET_DWORD(cmd, 5, virgl_pack_float(m_state.clear_color[3]));
-    
-    uint32_t depth_lo, depth_hi;
-    virgl_pack_double(m_state.clear_depth, &depth_lo, &depth_hi);
-    VIRGL_SET_DWORD(cmd, 6, depth_lo);
-    VIRGL_SET_DWORD(cmd, 7, depth_hi);
-    VIRGL_SET_DWORD(cmd, 8, m_state.clear_stencil);
+    VMLOG_DEBUG("VMOpenGLTranslator::glClear: mask=0x%x, virgl_buffers=0x%x\n", mask, virgl_buffers);
     
-    IOLog("VMOpenGLTranslator::glClear: mask=0x%x, virgl_buffers=0x%x\n", mask, virgl_buffers);
-    return submitVirglCommand(cmd, VIRGL_CLEAR_SIZE);
+    struct virgl_encoder enc;
+    if (!beginEncode(&enc, VIRGL_CLEAR_SIZE)) {
+        return kIOReturnNoSpace;
+    }
+    virgl_encode_clear(&enc, virgl_buffers, m_state.clear_color, m_state.clear_depth,
+                       m_state.clear_stencil);
+    return endEncode(&enc);
 }
 
 IOReturn VMOpenGLTranslator::glClearColor(float r, float g, float b, float a) {
@@ -219,36 +451,33 @@ IOReturn VMOpenGLTranslator::updateViewport() {
         return kIOReturnNotReady;
     }
     
-    float scale_x = m_state.viewport_width / 2.0f;
-    float scale_y = m_state.viewport_height / 2.0f;
-    float scale_z = (m_state.depth_far - m_state.depth_near) / 2.0f;
-    
-    float trans_x = m_state.viewport_x + scale_x;
-    float trans_y = m_state.viewport_y + scale_y;
-    float trans_z = (m_state.depth_far + m_state.depth_near) / 2.0f;
+    float scale[3];
+    scale[0] = m_state.viewport_width / 2.0f;
+    scale[1] = m_state.viewport_height / 2.0f;
+    scale[2] = (m_state.depth_far - m_state.depth_near) / 2.0f;
     
-    uint32_t cmd[8];
-    VIRGL_SET_COMMAND(cmd, 0, VIRGL_CCMD_SET_VIEWPORT_STATE, 7);
-    VIRGL_SET_DWORD(cmd, 1, 0); // start_slot
-    VIRGL_SET_DWORD(cmd, 2, virgl_pack_float(scale_x));
-    VIRGL_SET_DWORD(cmd, 3, virgl_pack_float(scale_y));
-    VIRGL_SET_DWORD(cmd, 4, virgl_pack_float(scale_z));
-    VIRGL_SET_DWORD(cmd, 5, virgl_pack_float(trans_x));
-    VIRGL_SET_DWORD(cmd, 6, virgl_pack_float(trans_y));
-    VIRGL_SET_DWORD(cmd, 7, virgl_pack_float(trans_z));
+    float translate[3];
+    translate[0] = m_state.viewport_x + scale[0];
+    translate[1] = m_state.viewport_y + scale[1];
+    translate[2] = (m_state.depth_far + m_state.depth_near) / 2.0f;
     
-    IOLog("VMOpenGLTranslator::updateViewport: %dx%d at (%d,%d)\n", 
+    VMLOG_DEBUG("VMOpenGLTranslator::updateViewport: %dx%d at (%d,%d)\n", 
           m_state.viewport_width, m_state.viewport_height,
           m_state.viewport_x, m_state.viewport_y);
     
-    return submitVirglCommand(cmd, 8);
+    struct virgl_encoder enc;
+    if (!beginEncode(&enc, VIRGL_VIEWPORT_SIZE(1))) {
+        return kIOReturnNoSpace;
+    }
+    virgl_encode_set_viewport(&enc, 0, scale, translate);
+    return endEncode(&enc);
 }
 
 // ============ Immediate Mode (glBegin/glEnd) ============
 
 IOReturn VMOpenGLTranslator::glBegin(uint32_t mode) {
     if (m_state.in_begin_end) {
-        IOLog("VMOpenGLTranslator::glBegin: ERROR - nested glBegin!\n");
+        VMLOG_ERROR("VMOpenGLTranslator::glBegin: ERROR - nested glBegin!\n");
         return kIOReturnError;
     }
     
@@ -256,19 +485,19 @@ IOReturn VMOpenGLTranslator::glBegin(uint32_t mode) {
     m_state.primitive_mode = mode;
     m_state.vertex_count = 0;
     
-    IOLog("VMOpenGLTranslator::glBegin: mode=0x%x\n", mode);
+    VMLOG_DEBUG("VMOpenGLTranslator::glBegin: mode=0x%x\n", mode);
     return kIOReturnSuccess;
 }
 
 IOReturn VMOpenGLTranslator::glEnd() {
     if (!m_state.in_begin_end) {
-        IOLog("VMOpenGLTranslator::glEnd: ERROR - glEnd without glBegin!\n");
+        VMLOG_ERROR("VMOpenGLTranslator::glEnd: ERROR - glEnd without glBegin!\n");
         return kIOReturnError;
     }
     
     m_state.in_begin_end = false;
     
-    IOLog("VMOpenGLTranslator::glEnd: Flushing %u vertices\n", m_state.vertex_count);
+    VMLOG_DEBUG("VMOpenGLTranslator::glEnd: Flushing %u vertices\n", m_state.vertex_count);
     return flushVertexBatch();
 }
 
@@ -282,18 +511,18 @@ IOReturn VMOpenGLTranslator::glVertex3f(float x, float y, float z) {
 
 IOReturn VMOpenGLTranslator::glVertex4f(float x, float y, float z, float w) {
     if (!m_state.in_begin_end) {
-        IOLog("VMOpenGLTranslator::glVertex: ERROR - vertex outside glBegin/glEnd!\n");
+        VMLOG_ERROR("VMOpenGLTranslator::glVertex: ERROR - vertex outside glBegin/glEnd!\n");
         return kIOReturnError;
     }
     
     if (m_state.vertex_count >= MAX_BATCH_VERTICES) {
-        IOLog("VMOpenGLTranslator::glVertex: Batch full, flushing...\n");
+        VMLOG_DEBUG("VMOpenGLTranslator::glVertex: Batch full, flushing...\n");
         flushVertexBatch();
         m_state.vertex_count = 0;
     }
     
-    // Pack vertex data: position (4) + color (4) + texcoord (4) = 12 floats
-    uint32_t offset = m_state.vertex_count * 12;
+    // Pack vertex data: position, color, texcoord and normal (see VM_GL_VERTEX_FLOATS)
+    uint32_t offset = m_state.vertex_count * VM_GL_VERTEX_FLOATS;
     m_state.vertex_data[offset + 0] = x;
     m_state.vertex_data[offset + 1] = y;
     m_state.vertex_data[offset + 2] = z;
@@ -309,6 +538,11 @@ IOReturn VMOpenGLTranslator::glVertex4f(float x, float y, float z, float w) {
     m_state.vertex_data[offset + 10] = m_state.current_texcoord[2];
     m_state.vertex_data[offset + 11] = m_state.current_texcoord[3];
     
+    m_state.vertex_data[offset + 12] = m_state.current_normal[0];
+    m_state.vertex_data[offset + 13] = m_state.current_normal[1];
+    m_state.vertex_data[offset + 14] = m_state.current_normal[2];
+    m_state.vertex_data[offset + 15] = 0.0f;
+    
     m_state.vertex_count++;
     return kIOReturnSuccess;
 }
@@ -355,361 +589,1948 @@ IOReturn VMOpenGLTranslator::flushVertexBatch() {
         return kIOReturnNotReady;
     }
     
-    IOLog("VMOpenGLTranslator::flushVertexBatch: %u vertices, mode=0x%x\n",
+    VMLOG_DEBUG("VMOpenGLTranslator::flushVertexBatch: %u vertices, mode=0x%x\n",
           m_state.vertex_count, m_state.primitive_mode);
     
-    // 1. Create/update vertex buffer with data
-    uint32_t vbo_handle = allocateHandle();
-    uint32_t data_size = m_state.vertex_count * 12 * sizeof(float);
-    
-    IOReturn ret = createVirglBuffer(data_size, VIRGL_BIND_VERTEX_BUFFER, &vbo_handle);
-    if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLTranslator::flushVertexBatch: Failed to create VBO\n");
-        return ret;
+    uint32_t data_size = m_state.vertex_count * VM_GL_VERTEX_BYTES;
+    uint32_t vb_resource = 0;
+    uint32_t vb_offset = 0;
+    
+    // 1. Static geometry: a batch already resident on the host is drawn in
+    // place, one that has been seen before is promoted into its own buffer
+    VMGLGeometryEntry* geometry = NULL;
+    uint64_t fingerprint = 0;
+    if (m_state.vertex_count >= VM_GL_GEOMETRY_MIN_VERTICES) {
+        fingerprint = fingerprintGeometry(m_state.vertex_data, data_size,
+                                          m_state.vertex_count, m_state.primitive_mode);
+        geometry = findGeometry(fingerprint, data_size);
+        if (geometry) {
+            m_geometry_hits++;
+            m_geometry_bytes_saved += data_size;
+        } else {
+            m_geometry_misses++;
+            geometry = admitGeometry(fingerprint, data_size);
+            if (geometry &&
+                uploadBufferData(geometry->resource, m_state.vertex_data, data_size, 0) != kIOReturnSuccess) {
+                evictGeometry(geometry);
+                geometry = NULL;
+            }
+        }
     }
     
-    ret = uploadBufferData(vbo_handle, m_state.vertex_data, data_size, 0);
-    if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLTranslator::flushVertexBatch: Failed to upload vertex data\n");
-        return ret;
+    if (geometry) {
+        geometry->last_used = ++m_geometry_clock;
+        geometry->fence = currentStreamFence();
+        vb_resource = geometry->resource;
+    } else {
+        // 2. Otherwise stream the vertices into the per-context vertex ring
+        IOReturn ret = allocateRing(&m_vertex_ring, data_size, &vb_offset);
+        if (ret != kIOReturnSuccess) {
+            VMLOG_DEBUG("VMOpenGLTranslator::flushVertexBatch: No vertex ring space for %u bytes\n", data_size);
+            return ret;
+        }
+        
+        ret = uploadBufferData(m_vertex_ring.resource, m_state.vertex_data, data_size, vb_offset);
+        if (ret != kIOReturnSuccess) {
+            VMLOG_ERROR("VMOpenGLTranslator::flushVertexBatch: Failed to upload vertex data\n");
+            return ret;
+        }
+        vb_resource = m_vertex_ring.resource;
     }
     
-    // 2. Create vertex element state (vertex format)
-    uint32_t ve_handle = allocateHandle();
-    ret = createVertexElements(&ve_handle);
+    // 3. Bring the host's state objects (vertex format included) up to date
+    IOReturn ret = emitDirtyState();
     if (ret != kIOReturnSuccess) {
-        IOLog("VMOpenGLTranslator::flushVertexBatch: Failed to create vertex elements\n");
+        VMLOG_ERROR("VMOpenGLTranslator::flushVertexBatch: Failed to emit state objects\n");
         return ret;
     }
     
-    // 3. Bind vertex elements
-    uint32_t bind_ve_cmd[3];
-    VIRGL_SET_COMMAND(bind_ve_cmd, 0, VIRGL_CCMD_BIND_OBJECT, 2);
-    VIRGL_SET_DWORD(bind_ve_cmd, 1, ve_handle);
-    VIRGL_SET_DWORD(bind_ve_cmd, 2, VIRGL_OBJECT_VERTEX_ELEMENTS);
-    submitVirglCommand(bind_ve_cmd, 3);
-    
-    // 4. Set vertex buffers
-    uint32_t vb_cmd[5];
-    VIRGL_SET_COMMAND(vb_cmd, 0, VIRGL_CCMD_SET_VERTEX_BUFFERS, 4);
-    VIRGL_SET_DWORD(vb_cmd, 1, 12 * sizeof(float)); // stride
-    VIRGL_SET_DWORD(vb_cmd, 2, 0); // offset
-    VIRGL_SET_DWORD(vb_cmd, 3, vbo_handle);
-    VIRGL_SET_DWORD(vb_cmd, 4, 0); // padding/reserved
-    submitVirglCommand(vb_cmd, 5);
-    
-    // 5. Submit draw command
-    uint32_t draw_cmd[VIRGL_DRAW_VBO_SIZE];
-    VIRGL_SET_COMMAND(draw_cmd, 0, VIRGL_CCMD_DRAW_VBO, VIRGL_DRAW_VBO_SIZE - 1);
-    VIRGL_SET_DWORD(draw_cmd, 1, 0); // start
-    VIRGL_SET_DWORD(draw_cmd, 2, m_state.vertex_count); // count
-    VIRGL_SET_DWORD(draw_cmd, 3, glPrimitiveToVirgl(m_state.primitive_mode)); // mode
-    VIRGL_SET_DWORD(draw_cmd, 4, 0); // indexed (false)
-    VIRGL_SET_DWORD(draw_cmd, 5, 1); // instance_count
-    VIRGL_SET_DWORD(draw_cmd, 6, 0); // index_bias
-    VIRGL_SET_DWORD(draw_cmd, 7, 0); // start_instance
-    VIRGL_SET_DWORD(draw_cmd, 8, 0); // primitive_restart
-    VIRGL_SET_DWORD(draw_cmd, 9, 0); // restart_index
-    VIRGL_SET_DWORD(draw_cmd, 10, 0); // min_index
-    VIRGL_SET_DWORD(draw_cmd, 11, m_state.vertex_count - 1); // max_index
-    
-    ret = submitVirglCommand(draw_cmd, VIRGL_DRAW_VBO_SIZE);
-    
-    IOLog("VMOpenGLTranslator::flushVertexBatch: ✅ Submitted draw command for %u vertices\n",
-          m_state.vertex_count);
+    // 4. Point the vertex buffer at this batch's vertices and draw
+    setVertexBuffer(vb_resource, vb_offset);
+    ret = queueDraw(glPrimitiveToVirgl(m_state.primitive_mode), 0, m_state.vertex_count,
+                    false, 0, 0, m_state.vertex_count - 1);
+    
+    VMLOG_DEBUG("VMOpenGLTranslator::flushVertexBatch: ✅ Queued draw command for %u vertices%s\n",
+          m_state.vertex_count, geometry ? " (cached geometry)" : "");
     
     return ret;
 }
 
-// ============ Helper Functions ============
+IOReturn VMOpenGLTranslator::setVertexBuffer(uint32_t resource, uint32_t offset) {
+    struct virgl_vertex_buffer vb = { VM_GL_VERTEX_BYTES, offset, resource };
+    struct virgl_encoder enc;
+    if (!beginEncode(&enc, VIRGL_ENC_VERTEX_BUFFERS_DWORDS(1))) {
+        return kIOReturnNoSpace;
+    }
+    virgl_encode_set_vertex_buffers(&enc, 1, &vb);
+    return endEncode(&enc);
+}
 
-IOReturn VMOpenGLTranslator::submitVirglCommand(uint32_t* cmd_buffer, uint32_t size) {
-    if (!m_accelerator) {
-        return kIOReturnNotReady;
+IOReturn VMOpenGLTranslator::queueDraw(uint32_t mode, uint32_t start, uint32_t count, bool indexed,
+                                       int32_t index_bias, uint32_t min_index, uint32_t max_index) {
+    struct virgl_draw_info info = {};
+    info.start = start;
+    info.count = count;
+    info.mode = mode;
+    info.indexed = indexed ? 1 : 0;
+    info.index_bias = index_bias;
+    info.min_index = min_index;
+    info.max_index = max_index;
+    
+    struct virgl_encoder enc;
+    if (!beginEncode(&enc, VIRGL_DRAW_VBO_SIZE)) {
+        return kIOReturnNoSpace;
     }
-    
-    VMVirtIOGPU* gpu = m_accelerator->getVirtIOGPUDevice();
-    if (!gpu) {
-        IOLog("VMOpenGLTranslator::submitVirglCommand: No VirtIO GPU device\n");
-        return kIOReturnNotReady;
+    virgl_encode_draw_vbo(&enc, &info);
+    return endEncode(&enc);
+}
+
+// ============ Client Arrays ============
+//
+// Enabled arrays are gathered straight into the command stream in the
+// translator's interleaved vertex layout, so client-array draws share the
+// immediate-mode vertex elements and shaders. Only the vertices a draw can
+// reference are converted and uploaded: [first, first + count) for
+// glDrawArrays, [min index, max index] for glDrawElements.
+
+static uint32_t glTypeSize(uint32_t type) {
+    switch (type) {
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE: return 1;
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT: return 2;
+        case GL_INT:
+        case GL_UNSIGNED_INT:
+        case GL_FLOAT: return 4;
+        case GL_DOUBLE: return 8;
+        default: return 0;
     }
-    
-    // Create memory descriptor for command
-    IOBufferMemoryDescriptor* cmdDesc = IOBufferMemoryDescriptor::withBytes(
-        cmd_buffer, size * sizeof(uint32_t), kIODirectionOut);
-    
-    if (!cmdDesc) {
-        IOLog("VMOpenGLTranslator::submitVirglCommand: Failed to create command descriptor\n");
-        return kIOReturnNoMemory;
+}
+
+template <typename T>
+static void gatherAttribute(float* dst, const uint8_t* src, uint32_t stride, uint32_t size,
+                            uint32_t count, float scale) {
+    for (uint32_t v = 0; v < count; v++, src += stride, dst += VM_GL_VERTEX_FLOATS) {
+        T c[4];
+        memcpy(c, src, size * sizeof(T));
+        for (uint32_t i = 0; i < size; i++) {
+            dst[i] = (float)c[i] * scale;
+        }
     }
-    
-    IOReturn ret = gpu->executeCommands(m_context_id, cmdDesc);
-    cmdDesc->release();
-    
-    return ret;
 }
 
-IOReturn VMOpenGLTranslator::createVirglBuffer(uint32_t size, uint32_t bind_flags, uint32_t* handle) {
-    if (!m_accelerator) {
-        return kIOReturnNotReady;
+// Convert `count` elements of one client array, starting at element `first`,
+// into the components at dst[0 .. size) of consecutive translator vertices
+static void gatherClientArray(float* dst, const void* pointer, uint32_t type, uint32_t size,
+                              uint32_t stride, uint32_t first, uint32_t count, bool normalized) {
+    if (!stride) {
+        stride = size * glTypeSize(type);
     }
+    const uint8_t* src = (const uint8_t*)pointer + (size_t)first * stride;
     
-    VMVirtIOGPU* gpu = m_accelerator->getVirtIOGPUDevice();
-    if (!gpu) {
-        return kIOReturnNotReady;
+    switch (type) {
+        case GL_FLOAT: gatherAttribute<float>(dst, src, stride, size, count, 1.0f); break;
+        case GL_DOUBLE: gatherAttribute<double>(dst, src, stride, size, count, 1.0f); break;
+        case GL_UNSIGNED_BYTE:
+            gatherAttribute<uint8_t>(dst, src, stride, size, count, normalized ? 1.0f / 255.0f : 1.0f);
+            break;
+        case GL_BYTE:
+            gatherAttribute<int8_t>(dst, src, stride, size, count, normalized ? 1.0f / 127.0f : 1.0f);
+            break;
+        case GL_UNSIGNED_SHORT:
+            gatherAttribute<uint16_t>(dst, src, stride, size, count, normalized ? 1.0f / 65535.0f : 1.0f);
+            break;
+        case GL_SHORT:
+            gatherAttribute<int16_t>(dst, src, stride, size, count, normalized ? 1.0f / 32767.0f : 1.0f);
+            break;
+        case GL_UNSIGNED_INT:
+            gatherAttribute<uint32_t>(dst, src, stride, size, count, normalized ? 1.0f / 4294967295.0f : 1.0f);
+            break;
+        case GL_INT:
+            gatherAttribute<int32_t>(dst, src, stride, size, count, normalized ? 1.0f / 2147483647.0f : 1.0f);
+            break;
     }
-    
-    // Use the existing createResource3D from VirtIO GPU device
-    return gpu->createResource3D(*handle, VIRGL_TARGET_BUFFER,
-                                 VIRGL_FORMAT_R8G8B8A8_UNORM,
-                                 bind_flags, size, 1, 1);
 }
 
-IOReturn VMOpenGLTranslator::uploadBufferData(uint32_t handle, const void* data, uint32_t size, uint32_t offset) {
-    if (!m_accelerator || !data) {
-        return kIOReturnBadArgument;
+static const uint8_t* clientArrayBase(const VMGLClientArray* array) {
+    return (const uint8_t*)array->map->getVirtualAddress() + array->offset;
+}
+
+// Whether elements [first, first + count) of one array, count >= 1, lie
+// inside its mapping
+static bool clientArrayCovers(const VMGLClientArray* array, uint32_t type, uint32_t size,
+                              uint32_t stride, uint32_t first, uint32_t count) {
+    if (!array->map) {
+        return false;
     }
-    
-    // Calculate command size: header (12 dwords) + data
-    uint32_t data_dwords = (size + 3) / 4; // Round up to dwords
-    uint32_t total_size = VIRGL_INLINE_WRITE_HDR_SIZE + data_dwords;
-    
-    uint32_t* cmd = (uint32_t*)IOMalloc(total_size * sizeof(uint32_t));
-    if (!cmd) {
-        return kIOReturnNoMemory;
+    uint64_t element = (uint64_t)size * glTypeSize(type);
+    if (!stride) {
+        stride = (uint32_t)element;
     }
-    
-    VIRGL_SET_COMMAND(cmd, 0, VIRGL_CCMD_RESOURCE_INLINE_WRITE, total_size - 1);
-    VIRGL_SET_DWORD(cmd, 1, handle);
-    VIRGL_SET_DWORD(cmd, 2, 0); // level
-    VIRGL_SET_DWORD(cmd, 3, 0); // usage
-    VIRGL_SET_DWORD(cmd, 4, 0); // stride
-    VIRGL_SET_DWORD(cmd, 5, 0); // layer_stride
-    VIRGL_SET_DWORD(cmd, 6, offset); // x (offset)
-    VIRGL_SET_DWORD(cmd, 7, 0); // y
-    VIRGL_SET_DWORD(cmd, 8, 0); // z
-    VIRGL_SET_DWORD(cmd, 9, size); // width (size)
-    VIRGL_SET_DWORD(cmd, 10, 1); // height
-    VIRGL_SET_DWORD(cmd, 11, 1); // depth
-    
-    // Copy data
-    memcpy(&cmd[VIRGL_INLINE_WRITE_HDR_SIZE], data, size);
-    
-    IOReturn ret = submitVirglCommand(cmd, total_size);
-    IOFree(cmd, total_size * sizeof(uint32_t));
-    
-    return ret;
+    uint64_t length = array->map->getLength();
+    if (array->offset > length || element > length - array->offset) {
+        return false;
+    }
+    uint64_t last = (uint64_t)first + count - 1;
+    return last <= (length - array->offset - element) / stride;
 }
 
-IOReturn VMOpenGLTranslator::createVertexElements(uint32_t* handle) {
-    // Define vertex format: position (vec4) + color (vec4) + texcoord (vec4)
-    uint32_t cmd[15];
-    *handle = allocateHandle();
-    
-    VIRGL_SET_COMMAND(cmd, 0, VIRGL_CCMD_CREATE_OBJECT, 14);
-    VIRGL_SET_DWORD(cmd, 1, *handle);
-    VIRGL_SET_DWORD(cmd, 2, VIRGL_OBJECT_VERTEX_ELEMENTS);
-    
-    // Element 0: position (vec4 float)
-    VIRGL_SET_DWORD(cmd, 3, 0); // src_offset
-    VIRGL_SET_DWORD(cmd, 4, 0); // instance_divisor
-    VIRGL_SET_DWORD(cmd, 5, 0); // vertex_buffer_index
-    VIRGL_SET_DWORD(cmd, 6, PIPE_FORMAT_R32G32B32A32_FLOAT); // src_format
-    
-    // Element 1: color (vec4 float)
-    VIRGL_SET_DWORD(cmd, 7, 16); // src_offset (4 floats = 16 bytes)
-    VIRGL_SET_DWORD(cmd, 8, 0); // instance_divisor
-    VIRGL_SET_DWORD(cmd, 9, 0); // vertex_buffer_index
-    VIRGL_SET_DWORD(cmd, 10, PIPE_FORMAT_R32G32B32A32_FLOAT); // src_format
-    
-    // Element 2: texcoord (vec4 float)
-    VIRGL_SET_DWORD(cmd, 11, 32); // src_offset (8 floats = 32 bytes)
-    VIRGL_SET_DWORD(cmd, 12, 0); // instance_divisor
-    VIRGL_SET_DWORD(cmd, 13, 0); // vertex_buffer_index
-    VIRGL_SET_DWORD(cmd, 14, PIPE_FORMAT_R32G32B32A32_FLOAT); // src_format
+// Wire and map `memory` once; draws then read the array in place
+IOReturn VMOpenGLTranslator::setClientArray(VMGLClientArray* array, IOMemoryDescriptor* memory,
+                                            uint64_t offset) {
+    IOMemoryMap* map = NULL;
+    if (memory) {
+        IOReturn ret = memory->prepare();
+        if (ret != kIOReturnSuccess) {
+            return ret;
+        }
+        map = memory->map();
+        if (!map) {
+            memory->complete();
+            return kIOReturnVMError;
+        }
+        memory->retain();
+    }
     
-    return submitVirglCommand(cmd, 15);
+    releaseClientArray(array);
+    array->memory = memory;
+    array->map = map;
+    array->offset = offset;
+    return kIOReturnSuccess;
 }
 
-// ============ Matrix Operations ============
+void VMOpenGLTranslator::releaseClientArray(VMGLClientArray* array) {
+    if (array->map) {
+        array->map->release();
+        array->map = NULL;
+    }
+    if (array->memory) {
+        array->memory->complete();
+        array->memory->release();
+        array->memory = NULL;
+    }
+    array->offset = 0;
+}
 
-IOReturn VMOpenGLTranslator::glLoadIdentity() {
-    float* matrix = (m_state.matrix_mode == 0x1700) ? // GL_MODELVIEW
-                    m_state.modelview_matrix : m_state.projection_matrix;
-    
-    bzero(matrix, 16 * sizeof(float));
-    matrix[0] = matrix[5] = matrix[10] = matrix[15] = 1.0f;
-    
+IOReturn VMOpenGLTranslator::glVertexPointer(uint32_t size, uint32_t type, uint32_t stride,
+                                             IOMemoryDescriptor* memory, uint64_t offset) {
+    if (size < 2 || size > 4 || !glTypeSize(type)) {
+        return kIOReturnBadArgument;
+    }
+    IOReturn ret = setClientArray(&m_state.vertex_memory, memory, offset);
+    if (ret != kIOReturnSuccess) {
+        return ret;
+    }
+    m_state.vertex_size = size;
+    m_state.vertex_type = type;
+    m_state.vertex_pointer_stride = stride;
     return kIOReturnSuccess;
 }
 
-IOReturn VMOpenGLTranslator::glMatrixMode(uint32_t mode) {
-    m_state.matrix_mode = mode;
+IOReturn VMOpenGLTranslator::glColorPointer(uint32_t size, uint32_t type, uint32_t stride,
+                                            IOMemoryDescriptor* memory, uint64_t offset) {
+    if (size < 3 || size > 4 || !glTypeSize(type)) {
+        return kIOReturnBadArgument;
+    }
+    IOReturn ret = setClientArray(&m_state.color_memory, memory, offset);
+    if (ret != kIOReturnSuccess) {
+        return ret;
+    }
+    m_state.color_size = size;
+    m_state.color_type = type;
+    m_state.color_pointer_stride = stride;
     return kIOReturnSuccess;
 }
 
-// ============ State Management ============
-
-IOReturn VMOpenGLTranslator::glEnable(uint32_t cap) {
-    switch (cap) {
-        case GL_BLEND:
-            m_state.blend_enabled = true;
-            break;
-        case GL_DEPTH_TEST:
-            m_state.depth_test_enabled = true;
-            break;
-        case GL_CULL_FACE:
-            m_state.cull_face_enabled = true;
-            break;
-        case GL_TEXTURE_2D:
-            m_state.texture_enabled[m_state.current_texture_unit] = true;
-            break;
+IOReturn VMOpenGLTranslator::glTexCoordPointer(uint32_t size, uint32_t type, uint32_t stride,
+                                               IOMemoryDescriptor* memory, uint64_t offset) {
+    if (size < 1 || size > 4 || !glTypeSize(type)) {
+        return kIOReturnBadArgument;
     }
-    
-    IOLog("VMOpenGLTranslator::glEnable: cap=0x%x\n", cap);
+    IOReturn ret = setClientArray(&m_state.texcoord_memory, memory, offset);
+    if (ret != kIOReturnSuccess) {
+        return ret;
+    }
+    m_state.texcoord_size = size;
+    m_state.texcoord_type = type;
+    m_state.texcoord_pointer_stride = stride;
     return kIOReturnSuccess;
 }
 
-IOReturn VMOpenGLTranslator::glDisable(uint32_t cap) {
-    switch (cap) {
-        case GL_BLEND:
-            m_state.blend_enabled = false;
-            break;
-        case GL_DEPTH_TEST:
-            m_state.depth_test_enabled = false;
-            break;
-        case GL_CULL_FACE:
-            m_state.cull_face_enabled = false;
-            break;
-        case GL_TEXTURE_2D:
-            m_state.texture_enabled[m_state.current_texture_unit] = false;
-            break;
+IOReturn VMOpenGLTranslator::glNormalPointer(uint32_t type, uint32_t stride,
+                                             IOMemoryDescriptor* memory, uint64_t offset) {
+    if (!glTypeSize(type) || type == GL_UNSIGNED_BYTE || type == GL_UNSIGNED_SHORT ||
+        type == GL_UNSIGNED_INT) {
+        return kIOReturnBadArgument;
     }
-    
-    IOLog("VMOpenGLTranslator::glDisable: cap=0x%x\n", cap);
+    IOReturn ret = setClientArray(&m_state.normal_memory, memory, offset);
+    if (ret != kIOReturnSuccess) {
+        return ret;
+    }
+    m_state.normal_type = type;
+    m_state.normal_pointer_stride = stride;
     return kIOReturnSuccess;
 }
 
-// ============ Flush/Finish ============
-
-IOReturn VMOpenGLTranslator::glFlush() {
-    IOLog("VMOpenGLTranslator::glFlush\n");
-    // In virgl, flush happens automatically on command submission
+IOReturn VMOpenGLTranslator::glEnableClientState(uint32_t array) {
+    switch (array) {
+        case GL_VERTEX_ARRAY: m_state.vertex_array_enabled = true; break;
+        case GL_COLOR_ARRAY: m_state.color_array_enabled = true; break;
+        case GL_TEXTURE_COORD_ARRAY: m_state.texcoord_array_enabled = true; break;
+        case GL_NORMAL_ARRAY: m_state.normal_array_enabled = true; break;
+        default: return kIOReturnBadArgument;
+    }
     return kIOReturnSuccess;
 }
 
-IOReturn VMOpenGLTranslator::glFinish() {
-    IOLog("VMOpenGLTranslator::glFinish\n");
-    // Would need to implement synchronization with host
+IOReturn VMOpenGLTranslator::glDisableClientState(uint32_t array) {
+    switch (array) {
+        case GL_VERTEX_ARRAY: m_state.vertex_array_enabled = false; break;
+        case GL_COLOR_ARRAY: m_state.color_array_enabled = false; break;
+        case GL_TEXTURE_COORD_ARRAY: m_state.texcoord_array_enabled = false; break;
+        case GL_NORMAL_ARRAY: m_state.normal_array_enabled = false; break;
+        default: return kIOReturnBadArgument;
+    }
     return kIOReturnSuccess;
 }
 
-// ============ Shader and Framebuffer Setup ============
-
-IOReturn VMOpenGLTranslator::createDefaultShaders() {
-    if (m_shaders_created) {
-        return kIOReturnSuccess;  // Already created
+// Fill `count` translator vertices from the enabled arrays, starting at
+// array element `first`. Attributes without an enabled array take the
+// current value, as in immediate mode.
+void VMOpenGLTranslator::gatherClientVertices(float* dst, uint32_t first, uint32_t count) {
+    bool color_array = m_state.color_array_enabled && m_state.color_memory.map;
+    bool texcoord_array = m_state.texcoord_array_enabled && m_state.texcoord_memory.map;
+    bool normal_array = m_state.normal_array_enabled && m_state.normal_memory.map;
+    
+    // Components an array leaves out default to (0, 0, 0, 1)
+    float* v = dst;
+    for (uint32_t i = 0; i < count; i++, v += VM_GL_VERTEX_FLOATS) {
+        v[0] = 0.0f; v[1] = 0.0f; v[2] = 0.0f; v[3] = 1.0f;
+        if (color_array) {
+            v[4] = 0.0f; v[5] = 0.0f; v[6] = 0.0f; v[7] = 1.0f;
+        } else {
+            memcpy(&v[4], m_state.current_color, 4 * sizeof(float));
+        }
+        if (texcoord_array) {
+            v[8] = 0.0f; v[9] = 0.0f; v[10] = 0.0f; v[11] = 1.0f;
+        } else {
+            memcpy(&v[8], m_state.current_texcoord, 4 * sizeof(float));
+        }
+        if (!normal_array) {
+            memcpy(&v[12], m_state.current_normal, 3 * sizeof(float));
+        }
+        v[15] = 0.0f;
     }
     
-    if (!m_accelerator) {
-        return kIOReturnNotReady;
+    gatherClientArray(dst, clientArrayBase(&m_state.vertex_memory), m_state.vertex_type, m_state.vertex_size,
+                      m_state.vertex_pointer_stride, first, count, false);
+    if (color_array) {
+        gatherClientArray(dst + 4, clientArrayBase(&m_state.color_memory), m_state.color_type, m_state.color_size,
+                          m_state.color_pointer_stride, first, count, true);
     }
-    
-    VMVirtIOGPU* gpu = m_accelerator->getVirtIOGPUDevice();
-    if (!gpu) {
-        return kIOReturnNotReady;
+    if (texcoord_array) {
+        gatherClientArray(dst + 8, clientArrayBase(&m_state.texcoord_memory), m_state.texcoord_type,
+                          m_state.texcoord_size, m_state.texcoord_pointer_stride, first, count, false);
     }
-    
-    // For now, just log that we would create shaders
-    // Real shader compilation requires TGSI bytecode generation
-    // which is complex - we'll rely on host-side shader compilation for now
-    IOLog("VMOpenGLTranslator::createDefaultShaders: Shaders will be compiled on host\n");
-    
-    m_vertex_shader_handle = 0;     // Host will assign
-    m_fragment_shader_handle = 0;   // Host will assign
-    m_shaders_created = true;
-    
-    return kIOReturnSuccess;
+    if (normal_array) {
+        // Integer normals are signed and normalized, as with glNormal3b/s/i
+        gatherClientArray(dst + 12, clientArrayBase(&m_state.normal_memory), m_state.normal_type, 3,
+                          m_state.normal_pointer_stride, first, count, true);
+    }
+}
+
+// Whether every array a draw of vertices [first, first + count) reads has
+// those elements
+bool VMOpenGLTranslator::clientArraysCover(uint32_t first, uint32_t count) {
+    if (!clientArrayCovers(&m_state.vertex_memory, m_state.vertex_type, m_state.vertex_size,
+                           m_state.vertex_pointer_stride, first, count)) {
+        return false;
+    }
+    if (m_state.color_array_enabled && m_state.color_memory.map &&
+        !clientArrayCovers(&m_state.color_memory, m_state.color_type, m_state.color_size,
+                           m_state.color_pointer_stride, first, count)) {
+        return false;
+    }
+    if (m_state.texcoord_array_enabled && m_state.texcoord_memory.map &&
+        !clientArrayCovers(&m_state.texcoord_memory, m_state.texcoord_type, m_state.texcoord_size,
+                           m_state.texcoord_pointer_stride, first, count)) {
+        return false;
+    }
+    if (m_state.normal_array_enabled && m_state.normal_memory.map &&
+        !clientArrayCovers(&m_state.normal_memory, m_state.normal_type, 3,
+                           m_state.normal_pointer_stride, first, count)) {
+        return false;
+    }
+    return true;
 }
 
-IOReturn VMOpenGLTranslator::bindDefaultShaders() {
-    // For virgl, shader binding happens implicitly through draw state
-    // The vertex format definition acts as the "shader" specification
-    // for fixed-function-like rendering
+// Gather vertices [first, first + count) into the vertex ring at
+// `ring_offset`, converting straight into INLINE_WRITE payloads
+IOReturn VMOpenGLTranslator::uploadClientVertices(uint32_t first, uint32_t count, uint32_t ring_offset) {
+    const uint32_t max_chunk_vertices =
+        (VM_GL_STREAM_FLUSH_DWORDS / 4) * sizeof(uint32_t) / VM_GL_VERTEX_BYTES;
+    
+    while (count) {
+        uint32_t n = count < max_chunk_vertices ? count : max_chunk_vertices;
+        uint32_t bytes = n * VM_GL_VERTEX_BYTES;
+        
+        struct virgl_encoder enc;
+        if (!beginEncode(&enc, VIRGL_ENC_INLINE_WRITE_DWORDS(bytes))) {
+            return kIOReturnNoSpace;
+        }
+        uint32_t* payload = virgl_encode_inline_write_buffer(&enc, m_vertex_ring.resource,
+                                                             ring_offset, bytes);
+        gatherClientVertices((float*)payload, first, n);
+        endEncode(&enc);
+        
+        first += n;
+        count -= n;
+        ring_offset += bytes;
+    }
     return kIOReturnSuccess;
 }
 
-IOReturn VMOpenGLTranslator::setupRenderTarget() {
+IOReturn VMOpenGLTranslator::glDrawArrays(uint32_t mode, uint32_t first, uint32_t count) {
+    if (m_state.in_begin_end) {
+        return kIOReturnError;
+    }
     if (!m_accelerator) {
         return kIOReturnNotReady;
     }
+    // Without a position array GL draws nothing
+    if (count == 0 || !m_state.vertex_array_enabled || !m_state.vertex_memory.map) {
+        return kIOReturnSuccess;
+    }
+    if (!clientArraysCover(first, count)) {
+        VMLOG_ERROR("VMOpenGLTranslator::glDrawArrays: vertices [%u, +%u) run past a client array\n",
+              first, count);
+        return kIOReturnBadArgument;
+    }
+    if (count > VM_GL_RING_MAX_BYTES / VM_GL_VERTEX_BYTES) {
+        VMLOG_WARN("VMOpenGLTranslator::glDrawArrays: %u vertices exceed the vertex ring\n", count);
+        return kIOReturnNoSpace;
+    }
     
-    VMVirtIOGPU* gpu = m_accelerator->getVirtIOGPUDevice();
-    if (!gpu) {
+    uint32_t vb_offset;
+    IOReturn ret = allocateRing(&m_vertex_ring, count * VM_GL_VERTEX_BYTES, &vb_offset);
+    if (ret == kIOReturnSuccess) {
+        ret = uploadClientVertices(first, count, vb_offset);
+    }
+    if (ret == kIOReturnSuccess) {
+        ret = emitDirtyState();
+    }
+    if (ret != kIOReturnSuccess) {
+        VMLOG_ERROR("VMOpenGLTranslator::glDrawArrays: Failed to stage %u vertices: 0x%x\n", count, ret);
+        return ret;
+    }
+    
+    setVertexBuffer(m_vertex_ring.resource, vb_offset);
+    return queueDraw(glPrimitiveToVirgl(mode), 0, count, false, 0, 0, count - 1);
+}
+
+IOReturn VMOpenGLTranslator::glDrawElements(uint32_t mode, uint32_t count, uint32_t type,
+                                            IOMemoryDescriptor* indices, uint64_t offset) {
+    if (m_state.in_begin_end) {
+        return kIOReturnError;
+    }
+    if (!m_accelerator) {
         return kIOReturnNotReady;
     }
     
-    // Get the render target and depth buffer resource IDs from the GPU device
-    // These were created in initializeWebGLAcceleration()
-    // We need to bind them to the framebuffer
+    uint32_t index_size;
+    switch (type) {
+        case GL_UNSIGNED_BYTE: index_size = 1; break;
+        case GL_UNSIGNED_SHORT: index_size = 2; break;
+        case GL_UNSIGNED_INT: index_size = 4; break;
+        default: return kIOReturnBadArgument;
+    }
+    // Element array buffers are not tracked yet, so indices are client memory
+    if (!indices) {
+        return kIOReturnBadArgument;
+    }
+    if (count == 0 || !m_state.vertex_array_enabled || !m_state.vertex_memory.map) {
+        return kIOReturnSuccess;
+    }
+    if (count > VM_GL_RING_MAX_BYTES / index_size) {
+        VMLOG_WARN("VMOpenGLTranslator::glDrawElements: %u indices exceed the index ring\n", count);
+        return kIOReturnNoSpace;
+    }
+    uint64_t length = indices->getLength();
+    if (offset > length || (uint64_t)count * index_size > length - offset) {
+        return kIOReturnBadArgument;
+    }
     
-    // For now, we'll use resource ID 2 (canvas) and 3 (depth) which were
-    // created during initialization
-    uint32_t color_handle = 2;  // Canvas resource from initializeWebGLAcceleration
-    uint32_t depth_handle = 3;  // Depth resource from initializeWebGLAcceleration
+    VMGLClientArray index_memory = {};
+    IOReturn ret = setClientArray(&index_memory, indices, offset);
+    if (ret != kIOReturnSuccess) {
+        return ret;
+    }
+    ret = drawIndexed(mode, count, index_size, clientArrayBase(&index_memory));
+    releaseClientArray(&index_memory);
+    return ret;
+}
+
+// glDrawElements once the indices are mapped and known to hold `count`
+// entries
+IOReturn VMOpenGLTranslator::drawIndexed(uint32_t mode, uint32_t count, uint32_t index_size,
+                                         const void* indices) {
+    // Only [min_index, max_index] is referenced; that is all that moves
+    uint32_t min_index, max_index;
+    VMIndexScanMinMax(indices, index_size, count, &min_index, &max_index);
+    uint32_t vertex_count = max_index - min_index + 1;
+    if (max_index - min_index >= VM_GL_RING_MAX_BYTES / VM_GL_VERTEX_BYTES) {
+        VMLOG_WARN("VMOpenGLTranslator::glDrawElements: index range [%u, %u] exceeds the vertex ring\n",
+              min_index, max_index);
+        return kIOReturnNoSpace;
+    }
+    if (!clientArraysCover(min_index, vertex_count)) {
+        VMLOG_ERROR("VMOpenGLTranslator::glDrawElements: index range [%u, %u] runs past a client array\n",
+              min_index, max_index);
+        return kIOReturnBadArgument;
+    }
     
-    // Create SET_FRAMEBUFFER_STATE command
-    uint32_t fb_cmd[VIRGL_SET_FRAMEBUFFER_STATE_SIZE];
-    VIRGL_SET_COMMAND(fb_cmd, 0, VIRGL_CCMD_SET_FRAMEBUFFER_STATE, VIRGL_SET_FRAMEBUFFER_STATE_SIZE - 1);
-    VIRGL_SET_DWORD(fb_cmd, 1, 1); // nr_cbufs = 1 color buffer
-    VIRGL_SET_DWORD(fb_cmd, 2, depth_handle); // zsurf_handle = depth buffer
-    VIRGL_SET_DWORD(fb_cmd, 3, color_handle); // cbufs[0] = color buffer
-    VIRGL_SET_DWORD(fb_cmd, 4, 0); // cbufs[1-7] = 0
-    VIRGL_SET_DWORD(fb_cmd, 5, 0);
-    VIRGL_SET_DWORD(fb_cmd, 6, 0);
-    VIRGL_SET_DWORD(fb_cmd, 7, 0);
-    VIRGL_SET_DWORD(fb_cmd, 8, 0);
-    VIRGL_SET_DWORD(fb_cmd, 9, 0);
-    VIRGL_SET_DWORD(fb_cmd, 10, 0);
-    
-    IOReturn ret = submitVirglCommand(fb_cmd, VIRGL_SET_FRAMEBUFFER_STATE_SIZE);
+    uint32_t vb_offset, ib_offset;
+    IOReturn ret = allocateRing(&m_vertex_ring, vertex_count * VM_GL_VERTEX_BYTES, &vb_offset);
+    if (ret == kIOReturnSuccess) {
+        ret = uploadClientVertices(min_index, vertex_count, vb_offset);
+    }
+    if (ret == kIOReturnSuccess) {
+        ret = allocateRing(&m_index_ring, count * index_size, &ib_offset);
+    }
+    if (ret == kIOReturnSuccess) {
+        ret = uploadBufferData(m_index_ring.resource, indices, count * index_size, ib_offset);
+    }
+    if (ret == kIOReturnSuccess) {
+        ret = emitDirtyState();
+    }
+    if (ret != kIOReturnSuccess) {
+        VMLOG_ERROR("VMOpenGLTranslator::glDrawElements: Failed to stage %u indices: 0x%x\n", count, ret);
+        return ret;
+    }
+    
+    setVertexBuffer(m_vertex_ring.resource, vb_offset);
+    
+    struct virgl_encoder enc;
+    if (!beginEncode(&enc, 1 + VIRGL_SET_INDEX_BUFFER_SIZE)) {
+        return kIOReturnNoSpace;
+    }
+    virgl_encode_set_index_buffer(&enc, m_index_ring.resource, index_size, ib_offset);
+    endEncode(&enc);
+    
+    // The uploaded range starts at min_index, so bias every index down by it
+    return queueDraw(glPrimitiveToVirgl(mode), 0, count, true,
+                     -(int32_t)min_index, min_index, max_index);
+}
+
+// ============ Helper Functions ============
+
+// Return space for a command of `dwords` dwords at the end of the stream, or
+// NULL if it can never fit. Submits the stream first when the new command
+// would carry it past the flush threshold, otherwise grows it in place.
+uint32_t* VMOpenGLTranslator::reserveCommandSpace(uint32_t dwords) {
+    if (!m_command_buffer || dwords == 0 || dwords > VM_GL_STREAM_MAX_DWORDS) {
+        return NULL;
+    }
+    
+    if (m_command_offset && m_command_offset + dwords > VM_GL_STREAM_FLUSH_DWORDS) {
+        // A failed partial flush has already dropped the stream; carry on
+        // so the caller's command still lands in the next one
+        flushCommandStream(kVMGLFlushFull);
+    }
+    
+    if (m_command_offset + dwords > m_command_buffer_size &&
+        growCommandStream(m_command_offset + dwords) != kIOReturnSuccess) {
+        return NULL;
+    }
+    
+    return m_command_buffer + m_command_offset;
+}
+
+void VMOpenGLTranslator::commitCommand(uint32_t dwords) {
+    m_command_offset += dwords;
+    m_commands_queued++;
+}
+
+// Point `enc` at room for exactly `dwords` dwords at the end of the stream;
+// endEncode commits whatever the emitters wrote there
+bool VMOpenGLTranslator::beginEncode(struct virgl_encoder* enc, uint32_t dwords) {
+    uint32_t* dst = m_accelerator ? reserveCommandSpace(dwords) : NULL;
+    if (!dst) {
+        VMLOG_DEBUG("VMOpenGLTranslator::beginEncode: No room for %u dwords\n", dwords);
+        return false;
+    }
+    virgl_encoder_init(enc, dst, dwords);
+    return true;
+}
+
+IOReturn VMOpenGLTranslator::endEncode(const struct virgl_encoder* enc) {
+    if (enc->overflow || enc->len == 0) {
+        VMLOG_DEBUG("VMOpenGLTranslator::endEncode: Command did not fit its reservation\n");
+        return kIOReturnNoSpace;
+    }
+    commitCommand(enc->len);
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::queueVirglCommand(const uint32_t* cmd, uint32_t size) {
+    if (!m_accelerator) {
+        return kIOReturnNotReady;
+    }
+    
+    uint32_t* dst = reserveCommandSpace(size);
+    if (!dst) {
+        VMLOG_DEBUG("VMOpenGLTranslator::queueVirglCommand: No room for %u dwords\n", size);
+        return kIOReturnNoSpace;
+    }
+    
+    memcpy(dst, cmd, size * sizeof(uint32_t));
+    commitCommand(size);
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::growCommandStream(uint32_t min_dwords) {
+    uint32_t new_size = m_command_buffer_size;
+    while (new_size < min_dwords) {
+        new_size *= 2;
+    }
+    if (new_size > VM_GL_STREAM_MAX_DWORDS) {
+        new_size = VM_GL_STREAM_MAX_DWORDS;
+    }
+    if (new_size < min_dwords) {
+        return kIOReturnNoSpace;
+    }
+    
+    IOBufferMemoryDescriptor* stream = IOBufferMemoryDescriptor::withCapacity(
+        new_size * sizeof(uint32_t), kIODirectionOut);
+    if (!stream) {
+        VMLOG_ERROR("VMOpenGLTranslator::growCommandStream: Failed to grow to %u dwords\n", new_size);
+        return kIOReturnNoMemory;
+    }
+    
+    uint32_t* buffer = (uint32_t*)stream->getBytesNoCopy();
+    memcpy(buffer, m_command_buffer, m_command_offset * sizeof(uint32_t));
+    
+    m_command_stream->release();
+    m_command_stream = stream;
+    m_command_buffer = buffer;
+    m_command_buffer_size = new_size;
+    return kIOReturnSuccess;
+}
+
+// Hand everything queued to the host as a single SUBMIT_3D. The stream is
+// reset whether or not the host accepted it: a rejected stream would only
+// be rejected again.
+IOReturn VMOpenGLTranslator::flushCommandStream(VMGLFlushReason reason) {
+    if (m_command_offset == 0) {
+        return kIOReturnSuccess;
+    }
+    
+    VMVirtIOGPU* gpu = m_accelerator ? m_accelerator->getVirtIOGPUDevice() : NULL;
+    if (!gpu) {
+        VMLOG_DEBUG("VMOpenGLTranslator::flushCommandStream: No VirtIO GPU device, dropping %u commands\n",
+              m_commands_queued);
+        m_command_offset = 0;
+        m_commands_queued = 0;
+        return kIOReturnNotReady;
+    }
+    
+    m_command_stream->setLength(m_command_offset * sizeof(uint32_t));
+    IOReturn ret = gpu->executeCommands(m_context_id, m_command_stream);
+    m_command_stream->setLength(m_command_buffer_size * sizeof(uint32_t));
+    
+    if (ret != kIOReturnSuccess) {
+        VMLOG_ERROR("VMOpenGLTranslator::flushCommandStream: SUBMIT_3D of %u commands (%u dwords) failed: 0x%x\n",
+              m_commands_queued, m_command_offset, ret);
+    }
+    
+    m_stream_commands += m_commands_queued;
+    m_stream_submits++;
+    m_stream_flushes[reason]++;
+    m_command_offset = 0;
+    m_commands_queued = 0;
+    return ret;
+}
+
+// ============ Context Buffers ============
+
+// Create a `size`-byte buffer resource and attach it to this context, which
+// can only name resources attached to it
+IOReturn VMOpenGLTranslator::createContextBuffer(uint32_t bind, uint32_t size, uint32_t* resource_id) {
+    VMVirtIOGPU* gpu = m_accelerator ? m_accelerator->getVirtIOGPUDevice() : NULL;
+    if (!gpu) {
+        return kIOReturnNotReady;
+    }
+    
+    uint32_t id = gpu->allocateUserResourceId();
+    IOReturn ret = gpu->createResource3D(id, VIRGL_TARGET_BUFFER, VIRGL_FORMAT_R8G8B8A8_UNORM,
+                                         bind, size, 1, 1);
+    if (ret != kIOReturnSuccess) {
+        return ret;
+    }
+    
+    struct virtio_gpu_ctx_resource cmd = {};
+    gpu->initializeCommandHeader(&cmd.hdr, VIRTIO_GPU_CMD_CTX_ATTACH_RESOURCE,
+                                 m_context_id, false);
+    cmd.resource_id = id;
+    struct virtio_gpu_ctrl_hdr resp = {};
+    ret = gpu->sendDisplayCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
+    if (ret != kIOReturnSuccess) {
+        VMLOG_ERROR("VMOpenGLTranslator::createContextBuffer: CTX_ATTACH_RESOURCE failed: 0x%x\n", ret);
+        gpu->deallocateResource(id);
+        return ret;
+    }
+    
+    *resource_id = id;
+    return kIOReturnSuccess;
+}
+
+// Callers make sure no queued command still references the buffer
+void VMOpenGLTranslator::releaseContextBuffer(uint32_t resource_id) {
+    VMVirtIOGPU* gpu = m_accelerator ? m_accelerator->getVirtIOGPUDevice() : NULL;
+    if (gpu && resource_id) {
+        gpu->deallocateResource(resource_id);
+    }
+}
+
+// ============ Static Geometry Cache ============
+
+static inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+// 64-bit fingerprint of a vertex batch: four independent multiply-rotate
+// lanes over 32-byte blocks (the xxHash64 round), so the scan runs at memory
+// speed without keeping a CPU-side copy to compare against. Count and mode
+// go into the seed; a collision would need equal length, mode and hash.
+uint64_t VMOpenGLTranslator::fingerprintGeometry(const void* data, uint32_t bytes,
+                                                 uint32_t count, uint32_t mode) {
+    static const uint64_t P1 = 0x9E3779B185EBCA87ULL;
+    static const uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+    static const uint64_t P3 = 0x165667B19E3779F9ULL;
+    
+    const uint8_t* p = (const uint8_t*)data;
+    const uint8_t* end = p + bytes;
+    uint64_t seed = ((uint64_t)mode << 32) | count;
+    uint64_t v[4] = { seed + P1 + P2, seed + P2, seed, seed - P1 };
+    
+    while (end - p >= 32) {
+        for (int i = 0; i < 4; i++) {
+            uint64_t lane;
+            memcpy(&lane, p + i * 8, sizeof(lane));
+            v[i] = rotl64(v[i] + lane * P2, 31) * P1;
+        }
+        p += 32;
+    }
+    
+    uint64_t h = rotl64(v[0], 1) + rotl64(v[1], 7) + rotl64(v[2], 12) + rotl64(v[3], 18);
+    for (int i = 0; i < 4; i++) {
+        h = (h ^ (rotl64(v[i] * P2, 31) * P1)) * P1 + P3;
+    }
+    h += bytes;
+    
+    // Vertex sizes are multiples of 16 bytes, so the tail is whole dwords
+    while (end - p >= 4) {
+        uint32_t word;
+        memcpy(&word, p, sizeof(word));
+        h = rotl64(h ^ (word * P1), 23) * P2 + P3;
+        p += 4;
+    }
+    
+    h ^= h >> 33;
+    h *= P2;
+    h ^= h >> 29;
+    h *= P3;
+    h ^= h >> 32;
+    return h;
+}
+
+VMGLGeometryEntry* VMOpenGLTranslator::findGeometry(uint64_t fingerprint, uint32_t bytes) {
+    for (uint32_t i = 0; i < VM_GL_GEOMETRY_CACHE_ENTRIES; i++) {
+        VMGLGeometryEntry* entry = &m_geometry[i];
+        if (entry->resource && entry->fingerprint == fingerprint && entry->bytes == bytes) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Give a batch its own buffer on its second sighting. One-off geometry only
+// costs a slot in the seen filter; repeats evict least recently drawn
+// batches until both the slot count and the byte budget allow the new one.
+VMGLGeometryEntry* VMOpenGLTranslator::admitGeometry(uint64_t fingerprint, uint32_t bytes) {
+    if (bytes > VM_GL_GEOMETRY_CACHE_BUDGET / 4) {
+        return NULL;
+    }
+    
+    uint64_t* seen = &m_geometry_seen[fingerprint % VM_GL_GEOMETRY_SEEN_SLOTS];
+    if (*seen != fingerprint) {
+        *seen = fingerprint;
+        return NULL;
+    }
+    
+    VMGLGeometryEntry* slot = NULL;
+    for (;;) {
+        VMGLGeometryEntry* lru = NULL;
+        slot = NULL;
+        for (uint32_t i = 0; i < VM_GL_GEOMETRY_CACHE_ENTRIES; i++) {
+            VMGLGeometryEntry* entry = &m_geometry[i];
+            if (!entry->resource) {
+                slot = slot ? slot : entry;
+            } else if (!lru || entry->last_used < lru->last_used) {
+                lru = entry;
+            }
+        }
+        if (slot && m_geometry_bytes + bytes <= VM_GL_GEOMETRY_CACHE_BUDGET) {
+            break;
+        }
+        if (!lru) {
+            return NULL;
+        }
+        evictGeometry(lru);
+        m_geometry_evictions++;
+    }
+    
+    uint32_t resource_id;
+    IOReturn ret = createContextBuffer(VIRGL_BIND_VERTEX_BUFFER, bytes, &resource_id);
+    if (ret != kIOReturnSuccess) {
+        VMLOG_ERROR("VMOpenGLTranslator::admitGeometry: Failed to create %u-byte buffer: 0x%x\n", bytes, ret);
+        return NULL;
+    }
+    
+    slot->fingerprint = fingerprint;
+    slot->resource = resource_id;
+    slot->bytes = bytes;
+    slot->vertex_count = m_state.vertex_count;
+    slot->mode = m_state.primitive_mode;
+    slot->last_used = ++m_geometry_clock;
+    slot->fence = currentStreamFence();
+    m_geometry_bytes += bytes;
+    *seen = 0;
+    return slot;
+}
+
+void VMOpenGLTranslator::evictGeometry(VMGLGeometryEntry* entry) {
+    // Draws still queued in this stream read from the buffer
+    if (entry->fence == currentStreamFence() && m_command_offset) {
+        flushCommandStream(kVMGLFlushEviction);
+    }
+    
+    releaseContextBuffer(entry->resource);
+    m_geometry_bytes -= entry->bytes;
+    bzero(entry, sizeof(*entry));
+}
+
+// Callers make sure no queued command still reads from the cache
+void VMOpenGLTranslator::releaseGeometryCache() {
+    uint32_t resident = 0;
+    for (uint32_t i = 0; i < VM_GL_GEOMETRY_CACHE_ENTRIES; i++) {
+        if (m_geometry[i].resource) {
+            resident++;
+            releaseContextBuffer(m_geometry[i].resource);
+        }
+    }
+    
+    if (m_geometry_hits || m_geometry_misses) {
+        VMLOG_DEBUG("VMOpenGLTranslator: context %u geometry cache: %llu hits, %llu misses, "
+              "%llu evicted, %llu KB uploads saved, %u batches / %u KB resident\n",
+              m_context_id, m_geometry_hits, m_geometry_misses, m_geometry_evictions,
+              m_geometry_bytes_saved / 1024, resident, m_geometry_bytes / 1024);
+    }
+    bzero(m_geometry, sizeof(m_geometry));
+    m_geometry_bytes = 0;
+}
+
+// ============ Streaming Rings ============
+
+void VMOpenGLTranslator::initRing(VMGLStreamRing* ring, const char* name, uint32_t bind,
+                                  uint32_t initial_size) {
+    bzero(ring, sizeof(*ring));
+    ring->name = name;
+    ring->bind = bind;
+    ring->initial_size = initial_size;
+}
+
+// Hand out `size` bytes of `ring` for the stream being built. The ring is a
+// plain bump allocator that wraps to 0; the only hazard is overwriting data
+// a queued draw has yet to read, and those all belong to the current stream
+// (older streams have retired). So a stream may use at most one ring's worth
+// of bytes. Past that it is submitted early and the ring doubled, so the
+// next frame of the same shape fits.
+IOReturn VMOpenGLTranslator::allocateRing(VMGLStreamRing* ring, uint32_t size, uint32_t* offset) {
+    if (size == 0 || size > VM_GL_RING_MAX_BYTES) {
+        return kIOReturnBadArgument;
+    }
+    
+    uint32_t need = (size + VM_GL_RING_ALIGN - 1) & ~(VM_GL_RING_ALIGN - 1);
+    
+    if (ring->stream_fence != currentStreamFence()) {
+        // The stream that last read from the ring has retired
+        ring->stream_fence = currentStreamFence();
+        ring->stream_bytes = 0;
+    }
+    
+    if (!ring->resource || need > ring->size) {
+        uint32_t new_size = ring->size ? ring->size : ring->initial_size;
+        while (new_size < need) {
+            new_size *= 2;
+        }
+        IOReturn ret = resizeRing(ring, new_size);
+        if (ret != kIOReturnSuccess) {
+            return ret;
+        }
+    }
+    
+    // Bytes skipped at the tail on wrap count against the stream as well
+    uint32_t cost = need;
+    if (ring->head + need > ring->size) {
+        cost += ring->size - ring->head;
+    }
+    
+    if (ring->stream_bytes + cost > ring->size) {
+        // This stream would overwrite its own data: retire it, then grow so
+        // that a repeat of this frame stays in one stream
+        if (ring->size < VM_GL_RING_MAX_BYTES) {
+            IOReturn ret = resizeRing(ring, ring->size * 2);
+            if (ret != kIOReturnSuccess) {
+                return ret;
+            }
+        } else {
+            flushCommandStream(kVMGLFlushRing);
+        }
+        ring->stream_fence = currentStreamFence();
+        ring->stream_bytes = 0;
+        cost = need;
+    }
+    
+    if (ring->head + need > ring->size) {
+        ring->head = 0;
+        ring->wraps++;
+    }
+    
+    *offset = ring->head;
+    ring->head += need;
+    ring->stream_bytes += cost;
+    return kIOReturnSuccess;
+}
+
+// Replace the ring with a fresh `size`-byte buffer resource attached to this
+// context. Queued commands may still reference the old one, so the stream is
+// submitted before it is released.
+IOReturn VMOpenGLTranslator::resizeRing(VMGLStreamRing* ring, uint32_t size) {
+    if (size > VM_GL_RING_MAX_BYTES) {
+        size = VM_GL_RING_MAX_BYTES;
+    }
+    
+    if (ring->resource) {
+        flushCommandStream(kVMGLFlushRing);
+        destroyRing(ring);
+        ring->grows++;
+    }
+    
+    uint32_t resource_id;
+    IOReturn ret = createContextBuffer(ring->bind, size, &resource_id);
+    if (ret != kIOReturnSuccess) {
+        VMLOG_ERROR("VMOpenGLTranslator::resizeRing: Failed to create %u-byte %s ring: 0x%x\n",
+              size, ring->name, ret);
+        return ret;
+    }
+    
+    ring->resource = resource_id;
+    ring->size = size;
+    ring->head = 0;
+    ring->stream_fence = currentStreamFence();
+    ring->stream_bytes = 0;
+    
+    VMLOG_DEBUG("VMOpenGLTranslator: context %u %s ring is resource %u, %u KB\n",
+          m_context_id, ring->name, resource_id, size / 1024);
+    return kIOReturnSuccess;
+}
+
+// Callers make sure no queued command still reads from the ring
+void VMOpenGLTranslator::destroyRing(VMGLStreamRing* ring) {
+    if (!ring->resource) {
+        return;
+    }
+    
+    releaseContextBuffer(ring->resource);
+    
+    VMLOG_INFO("VMOpenGLTranslator: context %u released %u KB %s ring (%llu wraps, %llu grows)\n",
+          m_context_id, ring->size / 1024, ring->name, ring->wraps, ring->grows);
+    ring->resource = 0;
+    ring->size = 0;
+    ring->head = 0;
+}
+
+IOReturn VMOpenGLTranslator::createVirglBuffer(uint32_t size, uint32_t bind_flags, uint32_t* handle) {
+    if (!m_accelerator) {
+        return kIOReturnNotReady;
+    }
+    
+    VMVirtIOGPU* gpu = m_accelerator->getVirtIOGPUDevice();
+    if (!gpu) {
+        return kIOReturnNotReady;
+    }
+    
+    // Use the existing createResource3D from VirtIO GPU device
+    return gpu->createResource3D(*handle, VIRGL_TARGET_BUFFER,
+                                 VIRGL_FORMAT_R8G8B8A8_UNORM,
+                                 bind_flags, size, 1, 1);
+}
+
+IOReturn VMOpenGLTranslator::uploadBufferData(uint32_t handle, const void* data, uint32_t size, uint32_t offset) {
+    if (!m_accelerator || !data) {
+        return kIOReturnBadArgument;
+    }
+    
+    // Encode straight into the stream. Large uploads are split so that no
+    // single INLINE_WRITE forces the stream past its flush threshold.
+    const uint32_t max_chunk = (VM_GL_STREAM_FLUSH_DWORDS / 4) * sizeof(uint32_t);
+    const uint8_t* src = (const uint8_t*)data;
+    
+    while (size) {
+        uint32_t chunk = size < max_chunk ? size : max_chunk;
+        
+        struct virgl_encoder enc;
+        if (!beginEncode(&enc, VIRGL_ENC_INLINE_WRITE_DWORDS(chunk))) {
+            return kIOReturnNoSpace;
+        }
+        virgl_encode_inline_write(&enc, handle, offset, src, chunk);
+        endEncode(&enc);
+        
+        src += chunk;
+        offset += chunk;
+        size -= chunk;
+    }
+    
+    return kIOReturnSuccess;
+}
+
+// ============ Matrix Operations ============
+
+// Matrices are column-major as in GL; the fixed-function vertex shader
+// reads projection * modelview from its constants, re-uploaded on change.
+
+float* VMOpenGLTranslator::currentMatrix() {
+    return m_state.matrix_mode == GL_MODELVIEW ? m_state.modelview_matrix : m_state.projection_matrix;
+}
+
+IOReturn VMOpenGLTranslator::glLoadIdentity() {
+    float* matrix = currentMatrix();
+    
+    bzero(matrix, 16 * sizeof(float));
+    matrix[0] = matrix[5] = matrix[10] = matrix[15] = 1.0f;
+    markStateDirty(VM_GL_DIRTY_VS_CONSTANTS);
+    
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glMatrixMode(uint32_t mode) {
+    if (mode != GL_MODELVIEW && mode != GL_PROJECTION) {
+        return kIOReturnUnsupported;
+    }
+    m_state.matrix_mode = mode;
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glLoadMatrixf(const float* m) {
+    if (!m) {
+        return kIOReturnBadArgument;
+    }
+    memcpy(currentMatrix(), m, 16 * sizeof(float));
+    markStateDirty(VM_GL_DIRTY_VS_CONSTANTS);
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glMultMatrixf(const float* m) {
+    if (!m) {
+        return kIOReturnBadArgument;
+    }
+    float* matrix = currentMatrix();
+    float product[16];
+    for (uint32_t col = 0; col < 4; col++) {
+        for (uint32_t row = 0; row < 4; row++) {
+            float sum = 0.0f;
+            for (uint32_t k = 0; k < 4; k++) {
+                sum += matrix[k * 4 + row] * m[col * 4 + k];
+            }
+            product[col * 4 + row] = sum;
+        }
+    }
+    memcpy(matrix, product, sizeof(product));
+    markStateDirty(VM_GL_DIRTY_VS_CONSTANTS);
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glOrtho(double left, double right, double bottom, double top,
+                                     double near, double far) {
+    if (left == right || bottom == top || near == far) {
+        return kIOReturnBadArgument;
+    }
+    float m[16] = { 0 };
+    m[0] = (float)(2.0 / (right - left));
+    m[5] = (float)(2.0 / (top - bottom));
+    m[10] = (float)(-2.0 / (far - near));
+    m[12] = (float)(-(right + left) / (right - left));
+    m[13] = (float)(-(top + bottom) / (top - bottom));
+    m[14] = (float)(-(far + near) / (far - near));
+    m[15] = 1.0f;
+    return glMultMatrixf(m);
+}
+
+IOReturn VMOpenGLTranslator::glFrustum(double left, double right, double bottom, double top,
+                                       double near, double far) {
+    if (near <= 0.0 || far <= 0.0 || left == right || bottom == top || near == far) {
+        return kIOReturnBadArgument;
+    }
+    float m[16] = { 0 };
+    m[0] = (float)(2.0 * near / (right - left));
+    m[5] = (float)(2.0 * near / (top - bottom));
+    m[8] = (float)((right + left) / (right - left));
+    m[9] = (float)((top + bottom) / (top - bottom));
+    m[10] = (float)(-(far + near) / (far - near));
+    m[11] = -1.0f;
+    m[14] = (float)(-2.0 * far * near / (far - near));
+    return glMultMatrixf(m);
+}
+
+// ============ State Management ============
+//
+// Setters only record GL state and mark the affected state object dirty;
+// nothing reaches the host until the next draw calls emitDirtyState().
+
+IOReturn VMOpenGLTranslator::glEnable(uint32_t cap) {
+    switch (cap) {
+        case GL_BLEND:
+            m_state.blend_enabled = true;
+            markStateDirty(VM_GL_DIRTY(kVMGLStateBlend));
+            break;
+        case GL_DEPTH_TEST:
+            m_state.depth_test_enabled = true;
+            markStateDirty(VM_GL_DIRTY(kVMGLStateDSA));
+            break;
+        case GL_CULL_FACE:
+            m_state.cull_face_enabled = true;
+            markStateDirty(VM_GL_DIRTY(kVMGLStateRasterizer));
+            break;
+        case GL_TEXTURE_2D:
+            m_state.texture_enabled[m_state.current_texture_unit] = true;
+            markStateDirty(VM_GL_DIRTY(kVMGLStateSampler) | VM_GL_DIRTY_PROGRAM);
+            break;
+        case GL_LIGHTING:
+            m_state.lighting_enabled = true;
+            markStateDirty(VM_GL_DIRTY_PROGRAM);
+            break;
+        case GL_COLOR_MATERIAL:
+            m_state.color_material_enabled = true;
+            markStateDirty(VM_GL_DIRTY_PROGRAM);
+            break;
+        case GL_FOG:
+            m_state.fog_enabled = true;
+            markStateDirty(VM_GL_DIRTY_PROGRAM);
+            break;
+        case GL_ALPHA_TEST:
+            m_state.alpha_test_enabled = true;
+            markStateDirty(VM_GL_DIRTY_PROGRAM);
+            break;
+        case GL_NORMALIZE:
+            // Normals are always renormalised in the vertex shader
+            break;
+        default:
+            if (cap >= GL_LIGHT0 && cap < GL_LIGHT0 + VIRGL_FFP_MAX_LIGHTS) {
+                m_state.light_enabled[cap - GL_LIGHT0] = true;
+                markStateDirty(VM_GL_DIRTY_PROGRAM);
+            }
+            break;
+    }
+    
+    VMLOG_DEBUG("VMOpenGLTranslator::glEnable: cap=0x%x\n", cap);
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glDisable(uint32_t cap) {
+    switch (cap) {
+        case GL_BLEND:
+            m_state.blend_enabled = false;
+            markStateDirty(VM_GL_DIRTY(kVMGLStateBlend));
+            break;
+        case GL_DEPTH_TEST:
+            m_state.depth_test_enabled = false;
+            markStateDirty(VM_GL_DIRTY(kVMGLStateDSA));
+            break;
+        case GL_CULL_FACE:
+            m_state.cull_face_enabled = false;
+            markStateDirty(VM_GL_DIRTY(kVMGLStateRasterizer));
+            break;
+        case GL_TEXTURE_2D:
+            m_state.texture_enabled[m_state.current_texture_unit] = false;
+            markStateDirty(VM_GL_DIRTY(kVMGLStateSampler) | VM_GL_DIRTY_PROGRAM);
+            break;
+        case GL_LIGHTING:
+            m_state.lighting_enabled = false;
+            markStateDirty(VM_GL_DIRTY_PROGRAM);
+            break;
+        case GL_COLOR_MATERIAL:
+            m_state.color_material_enabled = false;
+            markStateDirty(VM_GL_DIRTY_PROGRAM);
+            break;
+        case GL_FOG:
+            m_state.fog_enabled = false;
+            markStateDirty(VM_GL_DIRTY_PROGRAM);
+            break;
+        case GL_ALPHA_TEST:
+            m_state.alpha_test_enabled = false;
+            markStateDirty(VM_GL_DIRTY_PROGRAM);
+            break;
+        case GL_NORMALIZE:
+            // Normals are always renormalised in the vertex shader
+            break;
+        default:
+            if (cap >= GL_LIGHT0 && cap < GL_LIGHT0 + VIRGL_FFP_MAX_LIGHTS) {
+                m_state.light_enabled[cap - GL_LIGHT0] = false;
+                markStateDirty(VM_GL_DIRTY_PROGRAM);
+            }
+            break;
+    }
+    
+    VMLOG_DEBUG("VMOpenGLTranslator::glDisable: cap=0x%x\n", cap);
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glBlendFunc(uint32_t sfactor, uint32_t dfactor) {
+    m_state.blend_src_factor = sfactor;
+    m_state.blend_dst_factor = dfactor;
+    markStateDirty(VM_GL_DIRTY(kVMGLStateBlend));
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glDepthFunc(uint32_t func) {
+    m_state.depth_func = func;
+    markStateDirty(VM_GL_DIRTY(kVMGLStateDSA));
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glDepthMask(bool flag) {
+    m_state.depth_write_enabled = flag;
+    markStateDirty(VM_GL_DIRTY(kVMGLStateDSA));
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glCullFace(uint32_t mode) {
+    m_state.cull_mode = mode;
+    markStateDirty(VM_GL_DIRTY(kVMGLStateRasterizer));
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glFrontFace(uint32_t mode) {
+    m_state.front_face = mode;
+    markStateDirty(VM_GL_DIRTY(kVMGLStateRasterizer));
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glActiveTexture(uint32_t texture) {
+    if (texture < GL_TEXTURE0 || texture >= GL_TEXTURE0 + MAX_TEXTURES) {
+        return kIOReturnBadArgument;
+    }
+    m_state.current_texture_unit = texture - GL_TEXTURE0;
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glTexParameteri(uint32_t target, uint32_t pname, uint32_t param) {
+    uint32_t unit = m_state.current_texture_unit;
+    switch (pname) {
+        case GL_TEXTURE_MIN_FILTER:
+            m_state.tex_min_filter[unit] = param;
+            break;
+        case GL_TEXTURE_MAG_FILTER:
+            m_state.tex_mag_filter[unit] = param;
+            break;
+        case GL_TEXTURE_WRAP_S:
+            m_state.tex_wrap_s[unit] = param;
+            break;
+        case GL_TEXTURE_WRAP_T:
+            m_state.tex_wrap_t[unit] = param;
+            break;
+        default:
+            return kIOReturnSuccess;
+    }
+    markStateDirty(VM_GL_DIRTY(kVMGLStateSampler));
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glLightfv(uint32_t light, uint32_t pname, const float* params) {
+    if (light < GL_LIGHT0 || light >= GL_LIGHT0 + VIRGL_FFP_MAX_LIGHTS || !params) {
+        return kIOReturnBadArgument;
+    }
+    struct virgl_ffp_light* l = &m_state.ffp.lights[light - GL_LIGHT0];
+    switch (pname) {
+        case GL_AMBIENT: memcpy(l->ambient, params, 4 * sizeof(float)); break;
+        case GL_DIFFUSE: memcpy(l->diffuse, params, 4 * sizeof(float)); break;
+        case GL_SPECULAR: memcpy(l->specular, params, 4 * sizeof(float)); break;
+        case GL_POSITION: {
+            // Kept in eye space, transformed by the modelview current now
+            const float* mv = m_state.modelview_matrix;
+            for (uint32_t row = 0; row < 4; row++) {
+                l->position[row] = mv[row] * params[0] + mv[4 + row] * params[1] +
+                                   mv[8 + row] * params[2] + mv[12 + row] * params[3];
+            }
+            // Directional and point lights are different programs
+            markStateDirty(VM_GL_DIRTY_PROGRAM);
+            break;
+        }
+        default:
+            // Spot lights and attenuation are not emulated
+            return kIOReturnUnsupported;
+    }
+    markStateDirty(VM_GL_DIRTY_VS_CONSTANTS);
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glLightModelfv(uint32_t pname, const float* params) {
+    if (!params) {
+        return kIOReturnBadArgument;
+    }
+    if (pname != GL_LIGHT_MODEL_AMBIENT) {
+        // Local viewer and two-sided lighting are not emulated
+        return kIOReturnUnsupported;
+    }
+    memcpy(m_state.ffp.light_model_ambient, params, 4 * sizeof(float));
+    markStateDirty(VM_GL_DIRTY_VS_CONSTANTS);
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glMaterialfv(uint32_t face, uint32_t pname, const float* params) {
+    if (!params) {
+        return kIOReturnBadArgument;
+    }
+    if (face == GL_BACK) {
+        // Lighting is one-sided, so the back material is never read
+        return kIOReturnSuccess;
+    }
+    struct virgl_ffp_state* ffp = &m_state.ffp;
+    switch (pname) {
+        case GL_AMBIENT: memcpy(ffp->material_ambient, params, 4 * sizeof(float)); break;
+        case GL_DIFFUSE: memcpy(ffp->material_diffuse, params, 4 * sizeof(float)); break;
+        case GL_AMBIENT_AND_DIFFUSE:
+            memcpy(ffp->material_ambient, params, 4 * sizeof(float));
+            memcpy(ffp->material_diffuse, params, 4 * sizeof(float));
+            break;
+        case GL_SPECULAR: memcpy(ffp->material_specular, params, 4 * sizeof(float)); break;
+        case GL_EMISSION: memcpy(ffp->material_emission, params, 4 * sizeof(float)); break;
+        case GL_SHININESS:
+            if (params[0] < 0.0f || params[0] > 128.0f) {
+                return kIOReturnBadArgument;
+            }
+            ffp->material_shininess = params[0];
+            break;
+        default:
+            return kIOReturnBadArgument;
+    }
+    markStateDirty(VM_GL_DIRTY_VS_CONSTANTS);
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glFogf(uint32_t pname, float param) {
+    switch (pname) {
+        case GL_FOG_MODE: {
+            uint32_t mode = (uint32_t)param;
+            if (mode != GL_LINEAR && mode != GL_EXP && mode != GL_EXP2) {
+                return kIOReturnBadArgument;
+            }
+            m_state.fog_mode = mode;
+            markStateDirty(VM_GL_DIRTY_PROGRAM);
+            return kIOReturnSuccess;
+        }
+        case GL_FOG_DENSITY:
+            if (param < 0.0f) {
+                return kIOReturnBadArgument;
+            }
+            m_state.ffp.fog_density = param;
+            break;
+        case GL_FOG_START: m_state.ffp.fog_start = param; break;
+        case GL_FOG_END: m_state.ffp.fog_end = param; break;
+        default:
+            return kIOReturnBadArgument;
+    }
+    markStateDirty(VM_GL_DIRTY_VS_CONSTANTS);
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glFogfv(uint32_t pname, const float* params) {
+    if (!params) {
+        return kIOReturnBadArgument;
+    }
+    if (pname != GL_FOG_COLOR) {
+        return glFogf(pname, params[0]);
+    }
+    memcpy(m_state.ffp.fog_color, params, 4 * sizeof(float));
+    markStateDirty(VM_GL_DIRTY_FS_CONSTANTS);
+    return kIOReturnSuccess;
+}
+
+IOReturn VMOpenGLTranslator::glAlphaFunc(uint32_t func, float ref) {
+    if (func < GL_NEVER || func > GL_ALWAYS) {
+        return kIOReturnBadArgument;
+    }
+    m_state.alpha_func = func;
+    m_state.ffp.alpha_ref = ref < 0.0f ? 0.0f : (ref > 1.0f ? 1.0f : ref);
+    markStateDirty(VM_GL_DIRTY_PROGRAM | VM_GL_DIRTY_FS_CONSTANTS);
+    return kIOReturnSuccess;
+}
+
+// ============ State Objects ============
+
+// virgl object type for each VMGLStateKind
+static const uint32_t kStateObjectTypes[kVMGLStateKindCount] = {
+    VIRGL_OBJECT_BLEND, VIRGL_OBJECT_DSA, VIRGL_OBJECT_RASTERIZER,
+    VIRGL_OBJECT_SAMPLER_STATE, VIRGL_OBJECT_VERTEX_ELEMENTS
+};
+
+uint32_t VMOpenGLTranslator::packBlendState(uint32_t* out) {
+    uint32_t func = glBlendEquationToVirgl(m_state.blend_equation);
+    uint32_t src = glBlendFactorToVirgl(m_state.blend_src_factor);
+    uint32_t dst = glBlendFactorToVirgl(m_state.blend_dst_factor);
+    
+    // Only RT 0 matters while independent blend is off; the rest stay zero
+    // so that equal state always packs to equal bytes
+    bzero(out, (VIRGL_OBJ_BLEND_SIZE - 1) * sizeof(uint32_t));
+    out[0] = VIRGL_OBJ_BLEND_S0_DITHER(1);
+    out[1] = 0; // logicop func
+    out[2] = VIRGL_OBJ_BLEND_S2_RT_BLEND_ENABLE(m_state.blend_enabled) |
+             VIRGL_OBJ_BLEND_S2_RT_COLORMASK(PIPE_MASK_RGBA);
+    if (m_state.blend_enabled) {
+        out[2] |= VIRGL_OBJ_BLEND_S2_RT_RGB_FUNC(func) |
+                  VIRGL_OBJ_BLEND_S2_RT_RGB_SRC_FACTOR(src) |
+                  VIRGL_OBJ_BLEND_S2_RT_RGB_DST_FACTOR(dst) |
+                  VIRGL_OBJ_BLEND_S2_RT_ALPHA_FUNC(func) |
+                  VIRGL_OBJ_BLEND_S2_RT_ALPHA_SRC_FACTOR(src) |
+                  VIRGL_OBJ_BLEND_S2_RT_ALPHA_DST_FACTOR(dst);
+    }
+    return VIRGL_OBJ_BLEND_SIZE - 1;
+}
+
+uint32_t VMOpenGLTranslator::packDSAState(uint32_t* out) {
+    out[0] = 0;
+    if (m_state.depth_test_enabled) {
+        out[0] = VIRGL_OBJ_DSA_S0_DEPTH_ENABLE(1) |
+                 VIRGL_OBJ_DSA_S0_DEPTH_WRITEMASK(m_state.depth_write_enabled) |
+                 VIRGL_OBJ_DSA_S0_DEPTH_FUNC(glCompareFuncToVirgl(m_state.depth_func));
+    }
+    out[1] = 0; // front stencil
+    out[2] = 0; // back stencil
+    out[3] = virgl_pack_float(0.0f); // alpha ref
+    return VIRGL_OBJ_DSA_SIZE - 1;
+}
+
+uint32_t VMOpenGLTranslator::packRasterizerState(uint32_t* out) {
+    uint32_t cull = PIPE_FACE_NONE;
+    if (m_state.cull_face_enabled) {
+        switch (m_state.cull_mode) {
+            case GL_FRONT: cull = PIPE_FACE_FRONT; break;
+            case GL_FRONT_AND_BACK: cull = PIPE_FACE_FRONT_AND_BACK; break;
+            default: cull = PIPE_FACE_BACK; break;
+        }
+    }
+    
+    out[0] = VIRGL_OBJ_RS_S0_DEPTH_CLIP(1) |
+             VIRGL_OBJ_RS_S0_CULL_FACE(cull) |
+             VIRGL_OBJ_RS_S0_FRONT_CCW(m_state.front_face != GL_CW) |
+             VIRGL_OBJ_RS_S0_HALF_PIXEL_CENTER(1) |
+             VIRGL_OBJ_RS_S0_BOTTOM_EDGE_RULE(1);
+    out[1] = virgl_pack_float(1.0f); // point size
+    out[2] = 0; // sprite coord enable
+    out[3] = 0; // line stipple, clip planes
+    out[4] = virgl_pack_float(1.0f); // line width
+    out[5] = virgl_pack_float(0.0f); // offset units
+    out[6] = virgl_pack_float(0.0f); // offset scale
+    out[7] = virgl_pack_float(0.0f); // offset clamp
+    return VIRGL_OBJ_RS_SIZE - 1;
+}
+
+uint32_t VMOpenGLTranslator::packSamplerState(uint32_t unit, uint32_t* out) {
+    uint32_t min_filter = PIPE_TEX_FILTER_NEAREST;
+    uint32_t mip_filter = PIPE_TEX_MIPFILTER_NONE;
+    switch (m_state.tex_min_filter[unit]) {
+        case GL_LINEAR: min_filter = PIPE_TEX_FILTER_LINEAR; break;
+        case GL_NEAREST_MIPMAP_NEAREST: mip_filter = PIPE_TEX_MIPFILTER_NEAREST; break;
+        case GL_LINEAR_MIPMAP_NEAREST:
+            min_filter = PIPE_TEX_FILTER_LINEAR;
+            mip_filter = PIPE_TEX_MIPFILTER_NEAREST;
+            break;
+        case GL_NEAREST_MIPMAP_LINEAR: mip_filter = PIPE_TEX_MIPFILTER_LINEAR; break;
+        case GL_LINEAR_MIPMAP_LINEAR:
+            min_filter = PIPE_TEX_FILTER_LINEAR;
+            mip_filter = PIPE_TEX_MIPFILTER_LINEAR;
+            break;
+    }
+    uint32_t mag_filter = m_state.tex_mag_filter[unit] == GL_NEAREST ?
+                          PIPE_TEX_FILTER_NEAREST : PIPE_TEX_FILTER_LINEAR;
+    
+    out[0] = VIRGL_OBJ_SAMPLE_STATE_S0_WRAP_S(glWrapToVirgl(m_state.tex_wrap_s[unit])) |
+             VIRGL_OBJ_SAMPLE_STATE_S0_WRAP_T(glWrapToVirgl(m_state.tex_wrap_t[unit])) |
+             VIRGL_OBJ_SAMPLE_STATE_S0_WRAP_R(PIPE_TEX_WRAP_REPEAT) |
+             VIRGL_OBJ_SAMPLE_STATE_S0_MIN_IMG_FILTER(min_filter) |
+             VIRGL_OBJ_SAMPLE_STATE_S0_MIN_MIP_FILTER(mip_filter) |
+             VIRGL_OBJ_SAMPLE_STATE_S0_MAG_IMG_FILTER(mag_filter);
+    out[1] = virgl_pack_float(0.0f);    // lod bias
+    out[2] = virgl_pack_float(0.0f);    // min lod
+    out[3] = virgl_pack_float(1000.0f); // max lod
+    out[4] = out[5] = out[6] = out[7] = 0; // border color
+    return VIRGL_OBJ_SAMPLER_STATE_SIZE - 1;
+}
+
+uint32_t VMOpenGLTranslator::packVertexElements(uint32_t* out) {
+    // Translator layout: position, color, texcoord and normal as vec4
+    // floats in one interleaved buffer (see VM_GL_VERTEX_FLOATS)
+    for (uint32_t i = 0; i < VM_GL_VERTEX_ATTRIBS; i++) {
+        uint32_t* element = &out[i * VIRGL_VERTEX_ELEMENT_SIZE];
+        element[0] = i * 4 * sizeof(float); // src_offset
+        element[1] = 0; // instance_divisor
+        element[2] = 0; // vertex_buffer_index
+        element[3] = PIPE_FORMAT_R32G32B32A32_FLOAT; // src_format
+    }
+    return VM_GL_VERTEX_ATTRIBS * VIRGL_VERTEX_ELEMENT_SIZE;
+}
+
+bool VMOpenGLTranslator::isStateObjectBound(const VMGLStateObject* obj) const {
+    if (obj->kind == kVMGLStateSampler) {
+        for (uint32_t i = 0; i < m_sampler_bound_count; i++) {
+            if (m_sampler_bound[i] == obj->handle) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return m_cso_bound[obj->kind] == obj->handle;
+}
+
+// Return the host handle of an object with exactly this payload, creating it
+// if needed. On a full cache the least recently used object that is not
+// bound is destroyed first; the destroy is queued behind any draw that used
+// it, so the host never sees a dangling handle. Returns 0 on failure.
+uint32_t VMOpenGLTranslator::findOrCreateStateObject(VMGLStateKind kind, const uint32_t* data,
+                                                    uint32_t dwords) {
+    if (dwords > VM_GL_CSO_MAX_DWORDS) {
+        return 0;
+    }
+    
+    // FNV-1a over the kind and the packed payload
+    uint32_t hash = 2166136261u ^ kind;
+    hash *= 16777619u;
+    for (uint32_t i = 0; i < dwords; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    
+    VMGLStateObject* victim = NULL;
+    VMGLStateObject* free_slot = NULL;
+    for (uint32_t i = 0; i < VM_GL_CSO_CACHE_ENTRIES; i++) {
+        VMGLStateObject* obj = &m_cso_cache[i];
+        if (obj->handle == 0) {
+            if (!free_slot) {
+                free_slot = obj;
+            }
+            continue;
+        }
+        if (obj->hash == hash && obj->kind == kind && obj->dwords == dwords &&
+            memcmp(obj->data, data, dwords * sizeof(uint32_t)) == 0) {
+            obj->last_used = ++m_cso_clock;
+            m_cso_hits++;
+            return obj->handle;
+        }
+        if (!isStateObjectBound(obj) && (!victim || obj->last_used < victim->last_used)) {
+            victim = obj;
+        }
+    }
+    
+    VMGLStateObject* slot = free_slot;
+    if (!slot) {
+        if (!victim) {
+            VMLOG_DEBUG("VMOpenGLTranslator::findOrCreateStateObject: Cache full of bound objects\n");
+            return 0;
+        }
+        struct virgl_encoder enc;
+        if (!beginEncode(&enc, 2)) {
+            return 0;
+        }
+        virgl_encode_destroy_object(&enc, kStateObjectTypes[victim->kind], victim->handle);
+        endEncode(&enc);
+        victim->handle = 0;
+        m_cso_count--;
+        m_cso_evictions++;
+        slot = victim;
+    }
+    
+    struct virgl_encoder enc;
+    if (!beginEncode(&enc, 2 + dwords)) {
+        return 0;
+    }
+    uint32_t handle = allocateHandle();
+    virgl_encode_create_object(&enc, kStateObjectTypes[kind], handle, data, dwords);
+    endEncode(&enc);
+    
+    slot->handle = handle;
+    slot->hash = hash;
+    slot->kind = (uint16_t)kind;
+    slot->dwords = (uint16_t)dwords;
+    slot->last_used = ++m_cso_clock;
+    memcpy(slot->data, data, dwords * sizeof(uint32_t));
+    m_cso_count++;
+    m_cso_creates++;
+    return handle;
+}
+
+IOReturn VMOpenGLTranslator::bindStateObject(VMGLStateKind kind, uint32_t handle) {
+    if (m_cso_bound[kind] == handle) {
+        return kIOReturnSuccess;
+    }
+    
+    struct virgl_encoder enc;
+    if (!beginEncode(&enc, 2)) {
+        return kIOReturnNoSpace;
+    }
+    virgl_encode_bind_object(&enc, kStateObjectTypes[kind], handle);
+    IOReturn ret = endEncode(&enc);
+    if (ret == kIOReturnSuccess) {
+        m_cso_bound[kind] = handle;
+        m_cso_binds++;
+    }
+    return ret;
+}
+
+// Re-pack only the state groups touched since the last draw. A group whose
+// packed form matches what is already bound costs no commands at all.
+IOReturn VMOpenGLTranslator::emitDirtyState() {
+    if (!m_state_dirty) {
+        return kIOReturnSuccess;
+    }
+    
+    uint32_t data[VM_GL_CSO_MAX_DWORDS];
+    uint32_t dwords;
+    uint32_t handle;
+    IOReturn ret;
+    
+    for (uint32_t kind = 0; kind < kVMGLStateKindCount; kind++) {
+        if (!(m_state_dirty & VM_GL_DIRTY(kind)) || kind == kVMGLStateSampler) {
+            continue;
+        }
+        switch (kind) {
+            case kVMGLStateBlend: dwords = packBlendState(data); break;
+            case kVMGLStateDSA: dwords = packDSAState(data); break;
+            case kVMGLStateRasterizer: dwords = packRasterizerState(data); break;
+            default: dwords = packVertexElements(data); break;
+        }
+        handle = findOrCreateStateObject((VMGLStateKind)kind, data, dwords);
+        if (!handle) {
+            return kIOReturnNoResources;
+        }
+        ret = bindStateObject((VMGLStateKind)kind, handle);
+        if (ret != kIOReturnSuccess) {
+            return ret;
+        }
+        m_state_dirty &= ~VM_GL_DIRTY(kind);
+    }
+    
+    if (m_state_dirty & VM_GL_DIRTY(kVMGLStateSampler)) {
+        // Fragment samplers for units 0 .. highest enabled unit
+        uint32_t count = 0;
+        for (uint32_t unit = 0; unit < VM_GL_MAX_SAMPLER_UNITS; unit++) {
+            if (m_state.texture_enabled[unit]) {
+                count = unit + 1;
+            }
+        }
+        
+        uint32_t handles[VM_GL_MAX_SAMPLER_UNITS];
+        for (uint32_t unit = 0; unit < count; unit++) {
+            dwords = packSamplerState(unit, data);
+            handles[unit] = findOrCreateStateObject(kVMGLStateSampler, data, dwords);
+            if (!handles[unit]) {
+                return kIOReturnNoResources;
+            }
+        }
+        
+        if (count && (count != m_sampler_bound_count ||
+                      memcmp(handles, m_sampler_bound, count * sizeof(uint32_t)) != 0)) {
+            struct virgl_encoder enc;
+            if (!beginEncode(&enc, 1 + VIRGL_BIND_SAMPLER_STATES(count))) {
+                return kIOReturnNoSpace;
+            }
+            virgl_encode_bind_sampler_states(&enc, PIPE_SHADER_FRAGMENT, 0, count, handles);
+            ret = endEncode(&enc);
+            if (ret != kIOReturnSuccess) {
+                return ret;
+            }
+            memcpy(m_sampler_bound, handles, count * sizeof(uint32_t));
+            m_sampler_bound_count = count;
+            m_cso_binds++;
+        }
+        m_state_dirty &= ~VM_GL_DIRTY(kVMGLStateSampler);
+    }
+    
+    if (m_state_dirty & VM_GL_DIRTY_PROGRAM) {
+        struct virgl_ffp_key key;
+        buildProgramKey(&key);
+        if (!m_ffp_bound || virgl_ffp_key_bits(&key) != virgl_ffp_key_bits(&m_ffp_key)) {
+            VMGLProgramVariant* program = findOrCreateProgram(&key);
+            if (!program) {
+                return kIOReturnNoResources;
+            }
+            ret = bindProgram(program);
+            if (ret != kIOReturnSuccess) {
+                return ret;
+            }
+            // The new program may read a different constant range
+            m_ffp_key = key;
+            markStateDirty(VM_GL_DIRTY_VS_CONSTANTS | VM_GL_DIRTY_FS_CONSTANTS);
+        }
+        m_state_dirty &= ~VM_GL_DIRTY_PROGRAM;
+    }
+    
+    if (m_state_dirty & (VM_GL_DIRTY_VS_CONSTANTS | VM_GL_DIRTY_FS_CONSTANTS)) {
+        ret = uploadProgramConstants();
+        if (ret != kIOReturnSuccess) {
+            return ret;
+        }
+    }
+    
+    return kIOReturnSuccess;
+}
+
+// ============ Flush/Finish ============
+
+IOReturn VMOpenGLTranslator::glFlush() {
+    // Everything since the last flush goes to the host as one SUBMIT_3D
+    return flushCommandStream(kVMGLFlushExplicit);
+}
+
+IOReturn VMOpenGLTranslator::glFinish() {
+    // executeCommands waits for the host's response to SUBMIT_3D, so once
+    // the stream is submitted the host has consumed every queued command.
+    // Callers use glFinish to wait before looking at rendered results.
+    return flushForReadback();
+}
+
+IOReturn VMOpenGLTranslator::flushForReadback() {
+    return flushCommandStream(kVMGLFlushReadback);
+}
+
+// ============ Fixed-Function Programs ============
+//
+// The GL 1.x pipeline runs as TGSI programs generated by virgl_ffp.h,
+// specialised on a key of the enables that change the program text. Values
+// that only change inputs (matrices, colors, fog range, alpha reference) are
+// constants, so they never cause a shader switch.
+
+void VMOpenGLTranslator::buildProgramKey(struct virgl_ffp_key* key) {
+    bzero(key, sizeof(*key));
+    
+    // As in GL, an enabled unit without a texture does not texture
+    for (uint32_t unit = 0; unit < VIRGL_FFP_MAX_TEXTURE_UNITS; unit++) {
+        if (m_state.texture_enabled[unit] && m_state.texture_handles[unit]) {
+            key->texture_units |= (uint8_t)(1u << unit);
+        }
+    }
+    
+    if (m_state.lighting_enabled) {
+        key->flags |= VIRGL_FFP_LIGHTING;
+        if (m_state.color_material_enabled) {
+            key->flags |= VIRGL_FFP_COLOR_MATERIAL;
+        }
+        for (uint32_t i = 0; i < VIRGL_FFP_MAX_LIGHTS; i++) {
+            if (!m_state.light_enabled[i]) {
+                continue;
+            }
+            key->lights |= (uint8_t)(1u << i);
+            if (m_state.ffp.lights[i].position[3] != 0.0f) {
+                key->point_lights |= (uint8_t)(1u << i);
+            }
+        }
+    }
+    
+    key->alpha_func = (uint8_t)(m_state.alpha_test_enabled ?
+                                glCompareFuncToVirgl(m_state.alpha_func) : PIPE_FUNC_ALWAYS);
+    
+    if (m_state.fog_enabled) {
+        switch (m_state.fog_mode) {
+            case GL_LINEAR: key->fog_mode = VIRGL_FFP_FOG_LINEAR; break;
+            case GL_EXP2: key->fog_mode = VIRGL_FFP_FOG_EXP2; break;
+            default: key->fog_mode = VIRGL_FFP_FOG_EXP; break;
+        }
+    }
+}
+
+// Return the cached program for `key`, generating and creating both shaders
+// if needed. Same eviction rule as the CSO cache: the least recently used
+// program that is not bound is destroyed behind any draw that used it.
+VMGLProgramVariant* VMOpenGLTranslator::findOrCreateProgram(const struct virgl_ffp_key* key) {
+    uint64_t bits = virgl_ffp_key_bits(key);
+    VMGLProgramVariant* victim = NULL;
+    VMGLProgramVariant* free_slot = NULL;
+    
+    for (uint32_t i = 0; i < VM_GL_FFP_CACHE_ENTRIES; i++) {
+        VMGLProgramVariant* program = &m_ffp_cache[i];
+        if (program->vs_handle == 0) {
+            if (!free_slot) {
+                free_slot = program;
+            }
+            continue;
+        }
+        if (program->key == bits) {
+            program->last_used = ++m_ffp_clock;
+            m_ffp_hits++;
+            return program;
+        }
+        if (program != m_ffp_bound && (!victim || program->last_used < victim->last_used)) {
+            victim = program;
+        }
+    }
+    
+    VMGLProgramVariant* slot = free_slot ? free_slot : victim;
+    if (!slot) {
+        return NULL;
+    }
+    
+    char* vs_text = m_ffp_text;
+    char* fs_text = m_ffp_text + VIRGL_FFP_TEXT_MAX;
+    uint32_t vs_len = virgl_ffp_vertex_shader(key, vs_text, VIRGL_FFP_TEXT_MAX);
+    uint32_t fs_len = virgl_ffp_fragment_shader(key, fs_text, VIRGL_FFP_TEXT_MAX);
+    if (!vs_len || !fs_len) {
+        VMLOG_DEBUG("VMOpenGLTranslator::findOrCreateProgram: program for key %016llx does not fit\n", bits);
+        return NULL;
+    }
+    struct virgl_encoder enc;
+    if (!beginEncode(&enc, VIRGL_ENC_SHADER_DWORDS(vs_len) + VIRGL_ENC_SHADER_DWORDS(fs_len) +
+                           (slot == victim ? 4 : 0))) {
+        return NULL;
+    }
+    if (slot == victim) {
+        virgl_encode_destroy_object(&enc, VIRGL_OBJECT_SHADER, victim->vs_handle);
+        virgl_encode_destroy_object(&enc, VIRGL_OBJECT_SHADER, victim->fs_handle);
+        victim->vs_handle = 0;
+        m_ffp_evictions++;
+    }
+    
+    // The text length bounds the token count the host has to allocate
+    uint32_t vs_handle = allocateHandle();
+    uint32_t fs_handle = allocateHandle();
+    virgl_encode_create_shader(&enc, vs_handle, PIPE_SHADER_VERTEX, vs_text, vs_len, vs_len);
+    virgl_encode_create_shader(&enc, fs_handle, PIPE_SHADER_FRAGMENT, fs_text, fs_len, fs_len);
+    if (endEncode(&enc) != kIOReturnSuccess) {
+        return NULL;
+    }
+    
+    slot->key = bits;
+    slot->vs_handle = vs_handle;
+    slot->fs_handle = fs_handle;
+    slot->last_used = ++m_ffp_clock;
+    m_ffp_creates++;
+    return slot;
+}
+
+IOReturn VMOpenGLTranslator::bindProgram(VMGLProgramVariant* program) {
+    if (m_ffp_bound == program) {
+        return kIOReturnSuccess;
+    }
+    
+    struct virgl_encoder enc;
+    if (!beginEncode(&enc, 2 * VIRGL_BIND_SHADER_SIZE)) {
+        return kIOReturnNoSpace;
+    }
+    virgl_encode_bind_shader(&enc, program->vs_handle, PIPE_SHADER_VERTEX);
+    virgl_encode_bind_shader(&enc, program->fs_handle, PIPE_SHADER_FRAGMENT);
+    IOReturn ret = endEncode(&enc);
+    if (ret == kIOReturnSuccess) {
+        m_ffp_bound = program;
+        m_ffp_switches++;
+    }
+    return ret;
+}
+
+// Only the range the bound program declares is sent
+IOReturn VMOpenGLTranslator::uploadProgramConstants() {
+    float constants[VIRGL_FFP_VS_MAX_CONSTANTS * 4];
+    uint32_t vs_count = 0;
+    uint32_t fs_count = 0;
+    
+    if (m_state_dirty & VM_GL_DIRTY_VS_CONSTANTS) {
+        vs_count = virgl_ffp_vs_constants(&m_ffp_key);
+    }
+    if (m_state_dirty & VM_GL_DIRTY_FS_CONSTANTS) {
+        fs_count = virgl_ffp_fs_constants(&m_ffp_key);
+    }
+    
+    uint32_t dwords = (vs_count ? VIRGL_ENC_CONSTANT_BUFFER_DWORDS(vs_count * 4) : 0) +
+                      (fs_count ? VIRGL_ENC_CONSTANT_BUFFER_DWORDS(fs_count * 4) : 0);
+    if (!dwords) {
+        m_state_dirty &= ~(VM_GL_DIRTY_VS_CONSTANTS | VM_GL_DIRTY_FS_CONSTANTS);
+        return kIOReturnSuccess;
+    }
+    
+    struct virgl_encoder enc;
+    if (!beginEncode(&enc, dwords)) {
+        return kIOReturnNoSpace;
+    }
+    if (vs_count) {
+        virgl_ffp_pack_vs_constants(&m_ffp_key, &m_state.ffp, m_state.modelview_matrix,
+                                    m_state.projection_matrix, constants);
+        virgl_encode_set_constant_buffer(&enc, PIPE_SHADER_VERTEX, constants, vs_count * 4);
+    }
+    if (fs_count) {
+        virgl_ffp_pack_fs_constants(&m_ffp_key, &m_state.ffp, constants);
+        virgl_encode_set_constant_buffer(&enc, PIPE_SHADER_FRAGMENT, constants, fs_count * 4);
+    }
+    IOReturn ret = endEncode(&enc);
+    if (ret == kIOReturnSuccess) {
+        m_state_dirty &= ~(VM_GL_DIRTY_VS_CONSTANTS | VM_GL_DIRTY_FS_CONSTANTS);
+    }
+    return ret;
+}
+
+// ============ Framebuffer Setup ============
+
+IOReturn VMOpenGLTranslator::setupRenderTarget() {
+    if (!m_accelerator) {
+        return kIOReturnNotReady;
+    }
+    
+    VMVirtIOGPU* gpu = m_accelerator->getVirtIOGPUDevice();
+    if (!gpu) {
+        return kIOReturnNotReady;
+    }
+    
+    // Get the render target and depth buffer resource IDs from the GPU device
+    // These were created in initializeWebGLAcceleration()
+    // We need to bind them to the framebuffer
+    
+    // For now, we'll use resource ID 2 (canvas) and 3 (depth) which were
+    // created during initialization
+    uint32_t color_handle = 2;  // Canvas resource from initializeWebGLAcceleration
+    uint32_t depth_handle = 3;  // Depth resource from initializeWebGLAcceleration
+    
+    // SET_FRAMEBUFFER_STATE with one color buffer. The host requires the
+    // length to be exactly nr_cbufs + 2, so unused slots are not padded.
+    struct virgl_encoder enc;
+    if (!beginEncode(&enc, VIRGL_ENC_FRAMEBUFFER_DWORDS(1))) {
+        return kIOReturnNoSpace;
+    }
+    virgl_encode_set_framebuffer_state(&enc, 1, &color_handle, depth_handle);
+    IOReturn ret = endEncode(&enc);
     
     if (ret == kIOReturnSuccess) {
         m_state.current_fbo = 1; // Mark as bound
         m_state.color_buffer_handle = color_handle;
         m_state.depth_buffer_handle = depth_handle;
-        IOLog("VMOpenGLTranslator::setupRenderTarget: ✅ Bound color=%u depth=%u to framebuffer\n",
+        VMLOG_INFO("VMOpenGLTranslator::setupRenderTarget: ✅ Bound color=%u depth=%u to framebuffer\n",
               color_handle, depth_handle);
     } else {
-        IOLog("VMOpenGLTranslator::setupRenderTarget: ❌ Failed to bind framebuffer\n");
+        VMLOG_ERROR("VMOpenGLTranslator::setupRenderTarget: ❌ Failed to bind framebuffer\n");
     }
     
     return ret;
 }
 
 // Stubs for unimplemented functions (to be completed)
-IOReturn VMOpenGLTranslator::glVertexPointer(uint32_t size, uint32_t type, uint32_t stride, const void* pointer) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glColorPointer(uint32_t size, uint32_t type, uint32_t stride, const void* pointer) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glTexCoordPointer(uint32_t size, uint32_t type, uint32_t stride, const void* pointer) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glNormalPointer(uint32_t type, uint32_t stride, const void* pointer) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glEnableClientState(uint32_t array) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glDisableClientState(uint32_t array) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glDrawArrays(uint32_t mode, uint32_t first, uint32_t count) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glDrawElements(uint32_t mode, uint32_t count, uint32_t type, const void* indices) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glLoadMatrixf(const float* m) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glMultMatrixf(const float* m) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glOrtho(double left, double right, double bottom, double top, double near, double far) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glFrustum(double left, double right, double bottom, double top, double near, double far) { return kIOReturnSuccess; }
 IOReturn VMOpenGLTranslator::glGenTextures(uint32_t n, uint32_t* textures) { return kIOReturnSuccess; }
 IOReturn VMOpenGLTranslator::glBindTexture(uint32_t target, uint32_t texture) { return kIOReturnSuccess; }
 IOReturn VMOpenGLTranslator::glTexImage2D(uint32_t target, uint32_t level, uint32_t internal_format, uint32_t width, uint32_t height, uint32_t border, uint32_t format, uint32_t type, const void* pixels) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glTexParameteri(uint32_t target, uint32_t pname, uint32_t param) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glActiveTexture(uint32_t texture) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glBlendFunc(uint32_t sfactor, uint32_t dfactor) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glDepthFunc(uint32_t func) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glDepthMask(bool flag) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glCullFace(uint32_t mode) { return kIOReturnSuccess; }
-IOReturn VMOpenGLTranslator::glFrontFace(uint32_t mode) { return kIOReturnSuccess; }
 IOReturn VMOpenGLTranslator::glGenBuffers(uint32_t n, uint32_t* buffers) { return kIOReturnSuccess; }
 IOReturn VMOpenGLTranslator::glBindBuffer(uint32_t target, uint32_t buffer) { return kIOReturnSuccess; }
 IOReturn VMOpenGLTranslator::glBufferData(uint32_t target, uint32_t size, const void* data, uint32_t usage) { return kIOReturnSuccess; }
@@ -11,6 +11,8 @@
 #include <IOKit/IOService.h>
 #include <IOKit/IOBufferMemoryDescriptor.h>
 #include "virgl_protocol.h"
+#include "virgl_encode.h"
+#include "virgl_ffp.h"
 
 // Maximum vertices we can batch before flushing
 #define MAX_BATCH_VERTICES 10000
@@ -18,6 +20,136 @@
 #define MAX_SHADERS 256
 #define MAX_VERTEX_BUFFERS 16
 
+// Per-context virgl command stream. Commands are appended and reach the host
+// as one SUBMIT_3D; the stream grows geometrically up to the flush threshold,
+// past which it is submitted early (partial flush). The hard cap matches the
+// user client's 1 MB SUBMIT_3D limit.
+#define VM_GL_STREAM_INITIAL_DWORDS     16384       // 64 KB
+#define VM_GL_STREAM_FLUSH_DWORDS       65536       // 256 KB
+#define VM_GL_STREAM_MAX_DWORDS         262144      // 1 MB
+
+// Per-context streaming buffers. Vertex and index data for each draw are
+// sub-allocated from one buffer resource per kind with wrap-around; a region
+// may be reused once the stream that read it has retired. When a single
+// stream needs more than the whole ring, the ring doubles up to the cap.
+#define VM_GL_VB_RING_INITIAL_BYTES     (256 * 1024)
+#define VM_GL_IB_RING_INITIAL_BYTES     (64 * 1024)
+#define VM_GL_RING_MAX_BYTES            (16 * 1024 * 1024)
+#define VM_GL_RING_ALIGN                256
+
+// Static geometry cache. Immediate-mode batches seen twice (same vertex
+// bytes, count and primitive mode) get a dedicated buffer resource; later
+// repeats draw from it without uploading anything. Total resident bytes are
+// capped by the budget, evicting least recently drawn batches first.
+#define VM_GL_GEOMETRY_CACHE_ENTRIES    64
+#define VM_GL_GEOMETRY_CACHE_BUDGET     (8 * 1024 * 1024)
+#define VM_GL_GEOMETRY_MIN_VERTICES     16
+#define VM_GL_GEOMETRY_SEEN_SLOTS       256     // first-sighting filter, direct mapped
+
+// Translator vertex layout: position, color, texcoord and normal as vec4
+// floats, in the order of the fixed-function shader inputs (VIRGL_FFP_IN_*)
+#define VM_GL_VERTEX_FLOATS             16
+#define VM_GL_VERTEX_ATTRIBS            4
+#define VM_GL_VERTEX_BYTES              (VM_GL_VERTEX_FLOATS * sizeof(float))
+
+// Per-context constant state object (CSO) cache. Host objects are keyed by
+// their full packed contents, so identical state rebinds an existing handle
+// instead of creating another; the least recently used unbound object is
+// destroyed once the cache is full.
+#define VM_GL_CSO_CACHE_ENTRIES         128
+#define VM_GL_MAX_VERTEX_ELEMENTS       8
+#define VM_GL_CSO_MAX_DWORDS            (VM_GL_MAX_VERTEX_ELEMENTS * VIRGL_VERTEX_ELEMENT_SIZE)
+#define VM_GL_MAX_SAMPLER_UNITS         16
+
+enum VMGLStateKind {
+    kVMGLStateBlend = 0,
+    kVMGLStateDSA,
+    kVMGLStateRasterizer,
+    kVMGLStateSampler,
+    kVMGLStateVertexElements,
+    kVMGLStateKindCount
+};
+
+#define VM_GL_DIRTY(kind)               (1u << (kind))
+
+// Dirty bits past the state objects: which fixed-function program is
+// bound, and the constants it reads
+#define VM_GL_DIRTY_PROGRAM             (1u << (kVMGLStateKindCount + 0))
+#define VM_GL_DIRTY_VS_CONSTANTS        (1u << (kVMGLStateKindCount + 1))
+#define VM_GL_DIRTY_FS_CONSTANTS        (1u << (kVMGLStateKindCount + 2))
+#define VM_GL_DIRTY_ALL                 ((1u << (kVMGLStateKindCount + 3)) - 1)
+
+// Fixed-function program cache. Each distinct virgl_ffp_key gets its own
+// specialised vertex/fragment shader pair (see FB/virgl_ffp.h); draws only
+// rebind shaders when the key changes, and the least recently used pair
+// that is not bound is destroyed once the cache is full.
+#define VM_GL_FFP_CACHE_ENTRIES         32
+
+// One cached host object; the payload excludes the handle dword
+struct VMGLStateObject {
+    uint32_t handle;                    // 0 = free slot
+    uint32_t hash;
+    uint16_t kind;                      // VMGLStateKind
+    uint16_t dwords;
+    uint64_t last_used;
+    uint32_t data[VM_GL_CSO_MAX_DWORDS];
+};
+
+// One cached fixed-function program
+struct VMGLProgramVariant {
+    uint64_t key;                       // virgl_ffp_key_bits()
+    uint32_t vs_handle;                 // 0 = free slot
+    uint32_t fs_handle;
+    uint64_t last_used;
+};
+
+// One streaming buffer (see VM_GL_RING_*). Fences are stream sequence
+// numbers: stream N has retired once m_stream_submits >= N, since
+// executeCommands waits for the host to consume it.
+struct VMGLStreamRing {
+    const char* name;
+    uint32_t bind;                      // VIRGL_BIND_* of the buffer
+    uint32_t initial_size;              // bytes
+    uint32_t resource;                  // 0 until first use
+    uint32_t size;                      // bytes
+    uint32_t head;                      // next free offset
+    uint32_t stream_bytes;              // bytes handed out to the current stream
+    uint64_t stream_fence;              // stream that stream_bytes belongs to
+    uint64_t wraps;
+    uint64_t grows;
+};
+
+// One resident immediate-mode batch
+struct VMGLGeometryEntry {
+    uint64_t fingerprint;               // of vertex bytes, count and mode
+    uint32_t resource;                  // 0 = free slot
+    uint32_t bytes;
+    uint32_t vertex_count;
+    uint32_t mode;                      // GL primitive mode
+    uint64_t last_used;                 // LRU clock
+    uint64_t fence;                     // last stream that drew from it
+};
+
+// Why a command stream went to the host
+enum VMGLFlushReason {
+    kVMGLFlushExplicit = 0,     // glFlush / teardown
+    kVMGLFlushFull,             // next command would pass the flush threshold
+    kVMGLFlushReadback,         // glFinish, or caller is about to read host-side results
+    kVMGLFlushRing,             // a streaming ring must be reused or replaced
+    kVMGLFlushEviction,         // a cached buffer queued draws use is released
+    kVMGLFlushReasonCount
+};
+
+// Backing of one client array: a caller-supplied descriptor, wired and
+// mapped into the kernel once when the array is specified, and the byte
+// offset of element 0 within it. Draws check every element they read
+// against the mapping's length.
+struct VMGLClientArray {
+    IOMemoryDescriptor* memory;
+    IOMemoryMap* map;
+    uint64_t offset;
+};
+
 // OpenGL state that we need to track
 struct VMGLState {
     // Current primitive mode (GL_TRIANGLES, GL_QUADS, etc.)
@@ -81,6 +213,13 @@ struct VMGLState {
     float clear_depth;
     uint32_t clear_stencil;
     
+    // Sampler parameters (GL enums). There are no texture objects yet, so
+    // these follow the texture unit rather than the bound texture.
+    uint32_t tex_min_filter[MAX_TEXTURES];
+    uint32_t tex_mag_filter[MAX_TEXTURES];
+    uint32_t tex_wrap_s[MAX_TEXTURES];
+    uint32_t tex_wrap_t[MAX_TEXTURES];
+    
     // Vertex buffer objects
     uint32_t bound_array_buffer;
     uint32_t bound_element_buffer;
@@ -92,10 +231,10 @@ struct VMGLState {
     bool texcoord_array_enabled;
     bool normal_array_enabled;
     
-    void* vertex_pointer;
-    void* color_pointer;
-    void* texcoord_pointer;
-    void* normal_pointer;
+    VMGLClientArray vertex_memory;
+    VMGLClientArray color_memory;
+    VMGLClientArray texcoord_memory;
+    VMGLClientArray normal_memory;
     
     uint32_t vertex_size;
     uint32_t vertex_type;
@@ -111,6 +250,17 @@ struct VMGLState {
     
     uint32_t normal_type;
     uint32_t normal_pointer_stride;
+    
+    // Fixed-function lighting, fog and alpha test; the values the programs
+    // read as constants live in `ffp`
+    bool lighting_enabled;
+    bool light_enabled[VIRGL_FFP_MAX_LIGHTS];
+    bool color_material_enabled;
+    bool fog_enabled;
+    uint32_t fog_mode;           // GL_EXP, GL_EXP2 or GL_LINEAR
+    bool alpha_test_enabled;
+    uint32_t alpha_func;
+    struct virgl_ffp_state ffp;
 };
 
 class VMQemuVGAAccelerator;
@@ -127,10 +277,56 @@ private:
     // Resource allocation
     uint32_t m_next_handle;
     
-    // Command buffer for batching
+    // Command stream for batching (see VM_GL_STREAM_*). m_command_buffer
+    // points into m_command_stream, which is handed to executeCommands as-is.
+    IOBufferMemoryDescriptor* m_command_stream;
     uint32_t* m_command_buffer;
-    uint32_t m_command_buffer_size;
-    uint32_t m_command_offset;
+    uint32_t m_command_buffer_size;     // capacity in dwords
+    uint32_t m_command_offset;          // dwords queued since last flush
+    uint32_t m_commands_queued;         // commands queued since last flush
+    
+    // Stream statistics
+    uint64_t m_stream_commands;
+    uint64_t m_stream_submits;
+    uint64_t m_stream_flushes[kVMGLFlushReasonCount];
+    
+    // Streaming vertex and index buffers
+    VMGLStreamRing m_vertex_ring;
+    VMGLStreamRing m_index_ring;
+    
+    // Static geometry cache (see VM_GL_GEOMETRY_*)
+    VMGLGeometryEntry m_geometry[VM_GL_GEOMETRY_CACHE_ENTRIES];
+    uint64_t m_geometry_seen[VM_GL_GEOMETRY_SEEN_SLOTS];
+    uint32_t m_geometry_bytes;
+    uint64_t m_geometry_clock;
+    uint64_t m_geometry_hits;
+    uint64_t m_geometry_misses;
+    uint64_t m_geometry_evictions;
+    uint64_t m_geometry_bytes_saved;
+    
+    // CSO cache (see VM_GL_CSO_*) and what is currently bound on the host
+    VMGLStateObject* m_cso_cache;
+    uint32_t m_cso_count;
+    uint64_t m_cso_clock;
+    uint32_t m_cso_bound[kVMGLStateKindCount];
+    uint32_t m_sampler_bound[VM_GL_MAX_SAMPLER_UNITS];
+    uint32_t m_sampler_bound_count;
+    uint32_t m_state_dirty;             // VM_GL_DIRTY bits
+    uint64_t m_cso_hits;
+    uint64_t m_cso_creates;
+    uint64_t m_cso_evictions;
+    uint64_t m_cso_binds;
+    
+    // Fixed-function programs (see VM_GL_FFP_*)
+    VMGLProgramVariant m_ffp_cache[VM_GL_FFP_CACHE_ENTRIES];
+    VMGLProgramVariant* m_ffp_bound;
+    struct virgl_ffp_key m_ffp_key;     // key of m_ffp_bound
+    char* m_ffp_text;                   // VS and FS text, VIRGL_FFP_TEXT_MAX each
+    uint64_t m_ffp_clock;
+    uint64_t m_ffp_hits;
+    uint64_t m_ffp_creates;
+    uint64_t m_ffp_evictions;
+    uint64_t m_ffp_switches;
     
 public:
     // Initialization
@@ -160,15 +356,26 @@ public:
     IOReturn glTexCoord3f(float s, float t, float r);
     IOReturn glNormal3f(float x, float y, float z);
     
-    // Vertex arrays
-    IOReturn glVertexPointer(uint32_t size, uint32_t type, uint32_t stride, const void* pointer);
-    IOReturn glColorPointer(uint32_t size, uint32_t type, uint32_t stride, const void* pointer);
-    IOReturn glTexCoordPointer(uint32_t size, uint32_t type, uint32_t stride, const void* pointer);
-    IOReturn glNormalPointer(uint32_t type, uint32_t stride, const void* pointer);
+    // Vertex arrays. Client memory never arrives as a raw pointer: each
+    // array is `offset` bytes into `memory` (typically the app's buffer,
+    // created for its task by the user client), which the translator
+    // prepares, maps and retains until the array is respecified or the
+    // translator is freed. A null descriptor clears the array. Draws that
+    // would read past the end of an array or of the indices fail with
+    // kIOReturnBadArgument. glDrawElements maps `indices` for the call only.
+    IOReturn glVertexPointer(uint32_t size, uint32_t type, uint32_t stride,
+                             IOMemoryDescriptor* memory, uint64_t offset);
+    IOReturn glColorPointer(uint32_t size, uint32_t type, uint32_t stride,
+                            IOMemoryDescriptor* memory, uint64_t offset);
+    IOReturn glTexCoordPointer(uint32_t size, uint32_t type, uint32_t stride,
+                               IOMemoryDescriptor* memory, uint64_t offset);
+    IOReturn glNormalPointer(uint32_t type, uint32_t stride,
+                             IOMemoryDescriptor* memory, uint64_t offset);
     IOReturn glEnableClientState(uint32_t array);
     IOReturn glDisableClientState(uint32_t array);
     IOReturn glDrawArrays(uint32_t mode, uint32_t first, uint32_t count);
-    IOReturn glDrawElements(uint32_t mode, uint32_t count, uint32_t type, const void* indices);
+    IOReturn glDrawElements(uint32_t mode, uint32_t count, uint32_t type,
+                            IOMemoryDescriptor* indices, uint64_t offset);
     
     // Viewport and transformations
     IOReturn glViewport(int x, int y, int width, int height);
@@ -179,6 +386,14 @@ public:
     IOReturn glOrtho(double left, double right, double bottom, double top, double near, double far);
     IOReturn glFrustum(double left, double right, double bottom, double top, double near, double far);
     
+    // Fixed-function lighting, fog and alpha test
+    IOReturn glLightfv(uint32_t light, uint32_t pname, const float* params);
+    IOReturn glLightModelfv(uint32_t pname, const float* params);
+    IOReturn glMaterialfv(uint32_t face, uint32_t pname, const float* params);
+    IOReturn glFogf(uint32_t pname, float param);
+    IOReturn glFogfv(uint32_t pname, const float* params);
+    IOReturn glAlphaFunc(uint32_t func, float ref);
+    
     // Texture operations
     IOReturn glGenTextures(uint32_t n, uint32_t* textures);
     IOReturn glBindTexture(uint32_t target, uint32_t texture);
@@ -212,30 +427,88 @@ public:
     IOReturn glFlush();
     IOReturn glFinish();
     
+    // Submit everything queued so far before reading back host-side results
+    // (transfers from host, query results) that depend on it. glFinish goes
+    // through here too.
+    IOReturn flushForReadback();
+    bool hasPendingCommands() const { return m_command_offset != 0; }
+    
 private:
     // Internal helpers
     IOReturn flushVertexBatch();
-    IOReturn submitVirglCommand(uint32_t* cmd_buffer, uint32_t size);
+    
+    // Command stream encoder
+    uint32_t* reserveCommandSpace(uint32_t dwords);
+    void commitCommand(uint32_t dwords);
+    IOReturn queueVirglCommand(const uint32_t* cmd, uint32_t size);
+    bool beginEncode(struct virgl_encoder* enc, uint32_t dwords);
+    IOReturn endEncode(const struct virgl_encoder* enc);
+    IOReturn growCommandStream(uint32_t min_dwords);
+    IOReturn flushCommandStream(VMGLFlushReason reason);
+    uint64_t currentStreamFence() const { return m_stream_submits + 1; }
+    
+    // Context-owned buffer resources
+    IOReturn createContextBuffer(uint32_t bind, uint32_t size, uint32_t* resource_id);
+    void releaseContextBuffer(uint32_t resource_id);
+    
+    // Static geometry cache
+    static uint64_t fingerprintGeometry(const void* data, uint32_t bytes, uint32_t count, uint32_t mode);
+    VMGLGeometryEntry* findGeometry(uint64_t fingerprint, uint32_t bytes);
+    VMGLGeometryEntry* admitGeometry(uint64_t fingerprint, uint32_t bytes);
+    void evictGeometry(VMGLGeometryEntry* entry);
+    void releaseGeometryCache();
+    
+    // Streaming rings
+    void initRing(VMGLStreamRing* ring, const char* name, uint32_t bind, uint32_t initial_size);
+    IOReturn allocateRing(VMGLStreamRing* ring, uint32_t size, uint32_t* offset);
+    IOReturn resizeRing(VMGLStreamRing* ring, uint32_t size);
+    void destroyRing(VMGLStreamRing* ring);
+    
+    // Client arrays
+    IOReturn setClientArray(VMGLClientArray* array, IOMemoryDescriptor* memory, uint64_t offset);
+    void releaseClientArray(VMGLClientArray* array);
+    bool clientArraysCover(uint32_t first, uint32_t count);
+    IOReturn drawIndexed(uint32_t mode, uint32_t count, uint32_t index_size, const void* indices);
+    IOReturn uploadClientVertices(uint32_t first, uint32_t count, uint32_t ring_offset);
+    void gatherClientVertices(float* dst, uint32_t first, uint32_t count);
+    IOReturn setVertexBuffer(uint32_t resource, uint32_t offset);
+    IOReturn queueDraw(uint32_t mode, uint32_t start, uint32_t count, bool indexed,
+                       int32_t index_bias, uint32_t min_index, uint32_t max_index);
     IOReturn createVirglBuffer(uint32_t size, uint32_t bind_flags, uint32_t* handle);
     IOReturn uploadBufferData(uint32_t handle, const void* data, uint32_t size, uint32_t offset);
-    IOReturn createVertexElements(uint32_t* handle);
+    
+    // State objects: pack the current GL state, then find or create the
+    // matching host object and bind it if it is not bound already
+    IOReturn emitDirtyState();
+    uint32_t findOrCreateStateObject(VMGLStateKind kind, const uint32_t* data, uint32_t dwords);
+    IOReturn bindStateObject(VMGLStateKind kind, uint32_t handle);
+    bool isStateObjectBound(const VMGLStateObject* obj) const;
+    void markStateDirty(uint32_t bits) { m_state_dirty |= bits; }
+    uint32_t packBlendState(uint32_t* out);
+    uint32_t packDSAState(uint32_t* out);
+    uint32_t packRasterizerState(uint32_t* out);
+    uint32_t packSamplerState(uint32_t unit, uint32_t* out);
+    uint32_t packVertexElements(uint32_t* out);
     IOReturn setVertexBuffers();
     IOReturn setupFramebuffer();
     IOReturn updateViewport();
-    IOReturn createDefaultShaders();
-    IOReturn bindDefaultShaders();
+    float* currentMatrix();
+    
+    // Fixed-function programs: build the key from the GL state, then find or
+    // generate the matching program and bind it if it is not bound already
+    void buildProgramKey(struct virgl_ffp_key* key);
+    VMGLProgramVariant* findOrCreateProgram(const struct virgl_ffp_key* key);
+    IOReturn bindProgram(VMGLProgramVariant* program);
+    IOReturn uploadProgramConstants();
     IOReturn setupRenderTarget();
     
     uint32_t allocateHandle();
     uint32_t glPrimitiveToVirgl(uint32_t gl_mode);
     uint32_t glBlendFactorToVirgl(uint32_t gl_factor);
+    uint32_t glBlendEquationToVirgl(uint32_t gl_equation);
     uint32_t glCompareFuncToVirgl(uint32_t gl_func);
+    uint32_t glWrapToVirgl(uint32_t gl_wrap);
     uint32_t glFormatToVirgl(uint32_t gl_format);
-    
-    // Default shader handles
-    uint32_t m_vertex_shader_handle;
-    uint32_t m_fragment_shader_handle;
-    bool m_shaders_created;
 };
 
 #endif /* _VM_OPENGL_TRANSLATOR_H */
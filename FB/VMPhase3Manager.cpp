@@ -6,6 +6,7 @@
 #include "VMIOSurfaceManager.h"
 #include "VMVirtIOGPU.h"
 #include "virtio_gpu.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 
 #define CLASS VMPhase3Manager
@@ -119,15 +120,15 @@ IOReturn CLASS::initializePhase3Components()
         
     IORecursiveLockLock(m_lock);
     
-    IOLog("VMPhase3Manager: Initializing Phase 3 Advanced 3D Acceleration components\n");
+    VMLOG_INFO("VMPhase3Manager: Initializing Phase 3 Advanced 3D Acceleration components\n");
     
     // Initialize Metal Bridge if available
     if (m_metal_bridge) {
         IOReturn ret = kIOReturnSuccess; // Use basic success - no init method available
         if (ret != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Warning - Metal Bridge initialization failed (0x%x)\n", ret);
+            VMLOG_ERROR("VMPhase3Manager: Warning - Metal Bridge initialization failed (0x%x)\n", ret);
         } else {
-            IOLog("VMPhase3Manager: Metal Bridge initialized successfully\n");
+            VMLOG_INFO("VMPhase3Manager: Metal Bridge initialized successfully\n");
             m_initialized_components |= 0x01; // Metal bridge bit
         }
         
@@ -135,9 +136,9 @@ IOReturn CLASS::initializePhase3Components()
         if (m_metal_bridge) {
             IOReturn metal_config = configureMetalBridgeFeatures();
             if (metal_config != kIOReturnSuccess) {
-                IOLog("VMPhase3Manager: Metal Bridge feature configuration failed (0x%x)\n", metal_config);
+                VMLOG_ERROR("VMPhase3Manager: Metal Bridge feature configuration failed (0x%x)\n", metal_config);
             } else {
-                IOLog("VMPhase3Manager: Metal Bridge features configured successfully\n");
+                VMLOG_INFO("VMPhase3Manager: Metal Bridge features configured successfully\n");
             }
         }
     }
@@ -146,25 +147,25 @@ IOReturn CLASS::initializePhase3Components()
     if (m_opengl_bridge) {
         IOReturn ret = kIOReturnSuccess; // Use basic success - no init method available
         if (ret != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Warning - OpenGL Bridge initialization failed (0x%x)\n", ret);
+            VMLOG_ERROR("VMPhase3Manager: Warning - OpenGL Bridge initialization failed (0x%x)\n", ret);
         } else {
-            IOLog("VMPhase3Manager: OpenGL Bridge initialized successfully\n");
+            VMLOG_INFO("VMPhase3Manager: OpenGL Bridge initialized successfully\n");
             m_initialized_components |= 0x02; // OpenGL bridge bit
         }
         
         // Set up OpenGL context and capabilities
         IOReturn gl_setup = m_opengl_bridge->setupOpenGLSupport();
         if (gl_setup != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: OpenGL Bridge setup failed (0x%x)\n", gl_setup);
+            VMLOG_ERROR("VMPhase3Manager: OpenGL Bridge setup failed (0x%x)\n", gl_setup);
         } else {
-            IOLog("VMPhase3Manager: OpenGL Bridge capabilities configured successfully\n");
+            VMLOG_INFO("VMPhase3Manager: OpenGL Bridge capabilities configured successfully\n");
             
             // Configure OpenGL features based on VirtIO GPU capabilities
             IOReturn gl_features = m_opengl_bridge->configureGLFeatures();
             if (gl_features != kIOReturnSuccess) {
-                IOLog("VMPhase3Manager: OpenGL feature configuration failed (0x%x)\n", gl_features);
+                VMLOG_ERROR("VMPhase3Manager: OpenGL feature configuration failed (0x%x)\n", gl_features);
             } else {
-                IOLog("VMPhase3Manager: OpenGL features enabled successfully\n");
+                VMLOG_INFO("VMPhase3Manager: OpenGL features enabled successfully\n");
             }
         }
     }
@@ -173,9 +174,9 @@ IOReturn CLASS::initializePhase3Components()
     if (m_iosurface_manager) {
         IOReturn ret = kIOReturnSuccess; // Use basic init from OSObject
         if (ret != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Warning - IOSurface Manager initialization failed (0x%x)\n", ret);
+            VMLOG_ERROR("VMPhase3Manager: Warning - IOSurface Manager initialization failed (0x%x)\n", ret);
         } else {
-            IOLog("VMPhase3Manager: IOSurface Manager initialized successfully\n");
+            VMLOG_INFO("VMPhase3Manager: IOSurface Manager initialized successfully\n");
             m_initialized_components |= 0x04; // IOSurface manager bit
         }
     }
@@ -184,9 +185,9 @@ IOReturn CLASS::initializePhase3Components()
     if (m_coreanimation_accelerator) {
         IOReturn ret = m_coreanimation_accelerator->setupCoreAnimationSupport();
         if (ret != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Warning - Core Animation Accelerator setup failed (0x%x)\n", ret);
+            VMLOG_ERROR("VMPhase3Manager: Warning - Core Animation Accelerator setup failed (0x%x)\n", ret);
         } else {
-            IOLog("VMPhase3Manager: Core Animation Accelerator initialized successfully\n");
+            VMLOG_INFO("VMPhase3Manager: Core Animation Accelerator initialized successfully\n");
             m_initialized_components |= 0x08; // Core Animation bit
         }
     }
@@ -195,9 +196,9 @@ IOReturn CLASS::initializePhase3Components()
     if (m_shader_manager) {
         IOReturn ret = kIOReturnSuccess; // Use basic init
         if (ret != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Warning - Shader Manager initialization failed (0x%x)\n", ret);
+            VMLOG_ERROR("VMPhase3Manager: Warning - Shader Manager initialization failed (0x%x)\n", ret);
         } else {
-            IOLog("VMPhase3Manager: Shader Manager initialized successfully\n");
+            VMLOG_INFO("VMPhase3Manager: Shader Manager initialized successfully\n");
             m_initialized_components |= 0x10; // Shader manager bit
         }
     }
@@ -206,9 +207,9 @@ IOReturn CLASS::initializePhase3Components()
     if (m_texture_manager) {
         IOReturn ret = kIOReturnSuccess; // Use basic init
         if (ret != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Warning - Texture Manager initialization failed (0x%x)\n", ret);
+            VMLOG_ERROR("VMPhase3Manager: Warning - Texture Manager initialization failed (0x%x)\n", ret);
         } else {
-            IOLog("VMPhase3Manager: Texture Manager initialized successfully\n");
+            VMLOG_INFO("VMPhase3Manager: Texture Manager initialized successfully\n");
             m_initialized_components |= 0x20; // Texture manager bit
         }
     }
@@ -216,43 +217,43 @@ IOReturn CLASS::initializePhase3Components()
     // Initialize Command Buffer Pool
     if (m_command_buffer_pool) {
         // Command buffer pool is already initialized in init() method
-        IOLog("VMPhase3Manager: Command Buffer Pool is ready\n");
+        VMLOG_INFO("VMPhase3Manager: Command Buffer Pool is ready\n");
         m_initialized_components |= 0x40; // Command buffer pool bit
     }
     
     // Enable cross-component integration
     if ((m_initialized_components & 0x03) == 0x03) { // Both Metal and OpenGL
-        IOLog("VMPhase3Manager: Enabling Metal-OpenGL interoperability\n");
+        VMLOG_INFO("VMPhase3Manager: Enabling Metal-OpenGL interoperability\n");
         if (m_metal_bridge && m_opengl_bridge) {
             // Set up resource sharing between Metal and OpenGL for optimal performance
-            IOLog("VMPhase3Manager: Configuring Metal-OpenGL resource sharing\n");
+            VMLOG_INFO("VMPhase3Manager: Configuring Metal-OpenGL resource sharing\n");
             
             // Enable shared buffers between Metal and OpenGL contexts
-            IOLog("VMPhase3Manager: Setting up shared buffer objects between Metal and OpenGL\n");
+            VMLOG_INFO("VMPhase3Manager: Setting up shared buffer objects between Metal and OpenGL\n");
             
             // Configure texture sharing for efficient render target interop
-            IOLog("VMPhase3Manager: Enabling Metal-OpenGL texture sharing\n");
+            VMLOG_INFO("VMPhase3Manager: Enabling Metal-OpenGL texture sharing\n");
             
             // Set up synchronization objects for cross-API resource access
-            IOLog("VMPhase3Manager: Configuring Metal-OpenGL synchronization primitives\n");
+            VMLOG_INFO("VMPhase3Manager: Configuring Metal-OpenGL synchronization primitives\n");
             
-            IOLog("VMPhase3Manager: Metal-OpenGL interoperability configured successfully\n");
+            VMLOG_INFO("VMPhase3Manager: Metal-OpenGL interoperability configured successfully\n");
         }
     }
     
     // Configure performance optimizations based on initialized components
     if (m_initialized_components & 0x01) { // Metal available
         m_performance_tier = kVMPerformanceTierHigh;
-        IOLog("VMPhase3Manager: Using high performance tier with Metal acceleration\n");
+        VMLOG_INFO("VMPhase3Manager: Using high performance tier with Metal acceleration\n");
     } else if (m_initialized_components & 0x02) { // OpenGL available
         m_performance_tier = kVMPerformanceTierMedium;
-        IOLog("VMPhase3Manager: Using medium performance tier with OpenGL acceleration\n");
+        VMLOG_INFO("VMPhase3Manager: Using medium performance tier with OpenGL acceleration\n");
     } else {
         m_performance_tier = kVMPerformanceTierLow;
-        IOLog("VMPhase3Manager: Using low performance tier with software rendering\n");
+        VMLOG_INFO("VMPhase3Manager: Using low performance tier with software rendering\n");
     }
     
-    IOLog("VMPhase3Manager: Phase 3 initialization complete - Components: 0x%02x\n", m_initialized_components);
+    VMLOG_INFO("VMPhase3Manager: Phase 3 initialization complete - Components: 0x%02x\n", m_initialized_components);
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -262,13 +263,13 @@ IOReturn CLASS::configurePerformanceTier(VMPerformanceTier tier)
 {
     if (!m_lock) return kIOReturnNotReady;
     
-    IOLog("VMPhase3Manager::configurePerformanceTier: Configuring performance tier %u\n", (uint32_t)tier);
+    VMLOG_INFO("VMPhase3Manager::configurePerformanceTier: Configuring performance tier %u\n", (uint32_t)tier);
     
     IORecursiveLockLock(m_lock);
     
     // Validate performance tier
     if (tier > kVMPerformanceTierMax) {
-        IOLog("VMPhase3Manager::configurePerformanceTier: Invalid performance tier %u\n", (uint32_t)tier);
+        VMLOG_WARN("VMPhase3Manager::configurePerformanceTier: Invalid performance tier %u\n", (uint32_t)tier);
         IORecursiveLockUnlock(m_lock);
         return kIOReturnBadArgument;
     }
@@ -280,24 +281,24 @@ IOReturn CLASS::configurePerformanceTier(VMPerformanceTier tier)
     if (m_gpu_device) {
         switch (tier) {
             case kVMPerformanceTierLow:
-                IOLog("VMPhase3Manager: Configuring power-saving mode - reduced GPU clocks\n");
+                VMLOG_INFO("VMPhase3Manager: Configuring power-saving mode - reduced GPU clocks\n");
                 // Power management feature may not be available in VirtIO GPU
                 break;
                 
             case kVMPerformanceTierMedium:
-                IOLog("VMPhase3Manager: Configuring balanced performance mode\n");
+                VMLOG_INFO("VMPhase3Manager: Configuring balanced performance mode\n");
                 break;
                 
             case kVMPerformanceTierHigh:
             case kVMPerformanceTierMax:
-                IOLog("VMPhase3Manager: Configuring high-performance mode - maximum GPU utilization\n");
+                VMLOG_INFO("VMPhase3Manager: Configuring high-performance mode - maximum GPU utilization\n");
                 if (m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_3D)) {
                     m_gpu_device->enable3DAcceleration();
                 }
                 break;
                 
             default:
-                IOLog("VMPhase3Manager: Using default performance configuration\n");
+                VMLOG_INFO("VMPhase3Manager: Using default performance configuration\n");
                 break;
         }
     }
@@ -305,10 +306,10 @@ IOReturn CLASS::configurePerformanceTier(VMPerformanceTier tier)
     // Update component performance settings
     if (m_metal_bridge) {
         // Adjust Metal performance based on tier
-        IOLog("VMPhase3Manager: Updating Metal bridge performance settings\n");
+        VMLOG_INFO("VMPhase3Manager: Updating Metal bridge performance settings\n");
     }
     
-    IOLog("VMPhase3Manager::configurePerformanceTier: Performance tier updated from %u to %u\n", 
+    VMLOG_INFO("VMPhase3Manager::configurePerformanceTier: Performance tier updated from %u to %u\n", 
           (uint32_t)old_tier, (uint32_t)tier);
     
     IORecursiveLockUnlock(m_lock);
@@ -319,7 +320,7 @@ IOReturn CLASS::enableFeatures(uint32_t feature_mask)
 {
     if (!m_lock) return kIOReturnNotReady;
     
-    IOLog("VMPhase3Manager::enableFeatures: Enabling feature mask 0x%08x\n", feature_mask);
+    VMLOG_INFO("VMPhase3Manager::enableFeatures: Enabling feature mask 0x%08x\n", feature_mask);
     
     IORecursiveLockLock(m_lock);
     
@@ -330,7 +331,7 @@ IOReturn CLASS::enableFeatures(uint32_t feature_mask)
                                   VM_PHASE3_MULTI_DISPLAY | VM_PHASE3_HDR_SUPPORT;
     
     if (feature_mask & ~all_features) {
-        IOLog("VMPhase3Manager::enableFeatures: Invalid features in mask 0x%08x\n", feature_mask);
+        VMLOG_WARN("VMPhase3Manager::enableFeatures: Invalid features in mask 0x%08x\n", feature_mask);
         IORecursiveLockUnlock(m_lock);
         return kIOReturnBadArgument;
     }
@@ -342,33 +343,33 @@ IOReturn CLASS::enableFeatures(uint32_t feature_mask)
     
     // Initialize newly enabled features
     if (new_features) {
-        IOLog("VMPhase3Manager: Initializing newly enabled features: 0x%08x\n", new_features);
+        VMLOG_INFO("VMPhase3Manager: Initializing newly enabled features: 0x%08x\n", new_features);
         
         // Initialize GPU features if available
         if (m_gpu_device && (new_features & VM_PHASE3_ASYNC_RENDERING)) {
-            IOLog("VMPhase3Manager: Enabling async rendering acceleration on GPU device\n");
+            VMLOG_INFO("VMPhase3Manager: Enabling async rendering acceleration on GPU device\n");
             m_gpu_device->enable3DAcceleration();
         }
         
         // Initialize component-specific features
         if ((new_features & VM_PHASE3_METAL_BRIDGE) && m_metal_bridge) {
-            IOLog("VMPhase3Manager: Configuring Metal bridge features\n");
+            VMLOG_INFO("VMPhase3Manager: Configuring Metal bridge features\n");
         }
         
         if ((new_features & VM_PHASE3_OPENGL_BRIDGE) && m_opengl_bridge) {
-            IOLog("VMPhase3Manager: Configuring OpenGL bridge features\n");
+            VMLOG_INFO("VMPhase3Manager: Configuring OpenGL bridge features\n");
         }
         
         if ((new_features & VM_PHASE3_COREANIMATION) && m_coreanimation_accelerator) {
-            IOLog("VMPhase3Manager: Configuring CoreAnimation acceleration features\n");
+            VMLOG_INFO("VMPhase3Manager: Configuring CoreAnimation acceleration features\n");
         }
         
         if ((new_features & VM_PHASE3_IOSURFACE) && m_iosurface_manager) {
-            IOLog("VMPhase3Manager: Configuring IOSurface management features\n");
+            VMLOG_INFO("VMPhase3Manager: Configuring IOSurface management features\n");
         }
     }
     
-    IOLog("VMPhase3Manager::enableFeatures: Features updated from 0x%08x to 0x%08x\n", 
+    VMLOG_INFO("VMPhase3Manager::enableFeatures: Features updated from 0x%08x to 0x%08x\n", 
           old_features, m_enabled_features);
     
     IORecursiveLockUnlock(m_lock);
@@ -379,7 +380,7 @@ IOReturn CLASS::disableFeatures(uint32_t feature_mask)
 {
     if (!m_lock) return kIOReturnNotReady;
     
-    IOLog("VMPhase3Manager::disableFeatures: Disabling feature mask 0x%08x\n", feature_mask);
+    VMLOG_INFO("VMPhase3Manager::disableFeatures: Disabling feature mask 0x%08x\n", feature_mask);
     
     IORecursiveLockLock(m_lock);
     
@@ -390,7 +391,7 @@ IOReturn CLASS::disableFeatures(uint32_t feature_mask)
                                   VM_PHASE3_MULTI_DISPLAY | VM_PHASE3_HDR_SUPPORT;
     
     if (feature_mask & ~all_features) {
-        IOLog("VMPhase3Manager::disableFeatures: Invalid features in mask 0x%08x\n", feature_mask);
+        VMLOG_WARN("VMPhase3Manager::disableFeatures: Invalid features in mask 0x%08x\n", feature_mask);
         IORecursiveLockUnlock(m_lock);
         return kIOReturnBadArgument;
     }
@@ -402,38 +403,38 @@ IOReturn CLASS::disableFeatures(uint32_t feature_mask)
     
     // Clean up disabled features
     if (disabled_features) {
-        IOLog("VMPhase3Manager: Cleaning up disabled features: 0x%08x\n", disabled_features);
+        VMLOG_INFO("VMPhase3Manager: Cleaning up disabled features: 0x%08x\n", disabled_features);
         
         // Disable component-specific features first
         if ((disabled_features & VM_PHASE3_IOSURFACE) && m_iosurface_manager) {
-            IOLog("VMPhase3Manager: Disabling IOSurface management features\n");
+            VMLOG_INFO("VMPhase3Manager: Disabling IOSurface management features\n");
         }
         
         if ((disabled_features & VM_PHASE3_COREANIMATION) && m_coreanimation_accelerator) {
-            IOLog("VMPhase3Manager: Disabling CoreAnimation acceleration features\n");
+            VMLOG_INFO("VMPhase3Manager: Disabling CoreAnimation acceleration features\n");
         }
         
         if ((disabled_features & VM_PHASE3_OPENGL_BRIDGE) && m_opengl_bridge) {
-            IOLog("VMPhase3Manager: Disabling OpenGL bridge features\n");
+            VMLOG_INFO("VMPhase3Manager: Disabling OpenGL bridge features\n");
         }
         
         if ((disabled_features & VM_PHASE3_METAL_BRIDGE) && m_metal_bridge) {
-            IOLog("VMPhase3Manager: Disabling Metal bridge features\n");
+            VMLOG_INFO("VMPhase3Manager: Disabling Metal bridge features\n");
         }
         
         // Disable GPU features last
         if (m_gpu_device && (disabled_features & VM_PHASE3_ASYNC_RENDERING)) {
-            IOLog("VMPhase3Manager: Disabling async rendering acceleration on GPU device\n");
+            VMLOG_INFO("VMPhase3Manager: Disabling async rendering acceleration on GPU device\n");
             // Note: VirtIO GPU doesn't typically support dynamic 3D disable
         }
     }
     
     // Verify critical features aren't disabled inappropriately
     if (!(m_enabled_features & (VM_PHASE3_METAL_BRIDGE | VM_PHASE3_OPENGL_BRIDGE))) {
-        IOLog("VMPhase3Manager::disableFeatures: Warning - all rendering bridges disabled!\n");
+        VMLOG_WARN("VMPhase3Manager::disableFeatures: Warning - all rendering bridges disabled!\n");
     }
     
-    IOLog("VMPhase3Manager::disableFeatures: Features updated from 0x%08x to 0x%08x\n", 
+    VMLOG_INFO("VMPhase3Manager::disableFeatures: Features updated from 0x%08x to 0x%08x\n", 
           old_features, m_enabled_features);
     
     IORecursiveLockUnlock(m_lock);
@@ -454,7 +455,7 @@ IOReturn CLASS::startAllComponents()
     if (!(m_initialized_components & VM_PHASE3_METAL_BRIDGE) && m_metal_bridge) {
         if (enableMetalSupport() == kIOReturnSuccess) {
             m_initialized_components |= VM_PHASE3_METAL_BRIDGE;
-            IOLog("VMPhase3Manager: Metal support component started\n");
+            VMLOG_INFO("VMPhase3Manager: Metal support component started\n");
         } else {
             failed_components++;
         }
@@ -463,7 +464,7 @@ IOReturn CLASS::startAllComponents()
     if (!(m_initialized_components & VM_PHASE3_OPENGL_BRIDGE) && m_opengl_bridge) {
         if (enableOpenGLSupport() == kIOReturnSuccess) {
             m_initialized_components |= VM_PHASE3_OPENGL_BRIDGE;
-            IOLog("VMPhase3Manager: OpenGL support component started\n");
+            VMLOG_INFO("VMPhase3Manager: OpenGL support component started\n");
         } else {
             failed_components++;
         }
@@ -472,7 +473,7 @@ IOReturn CLASS::startAllComponents()
     if (!(m_initialized_components & VM_PHASE3_COREANIMATION)) {
         if (enableCoreAnimationSupport() == kIOReturnSuccess) {
             m_initialized_components |= VM_PHASE3_COREANIMATION;
-            IOLog("VMPhase3Manager: CoreAnimation support component started\n");
+            VMLOG_INFO("VMPhase3Manager: CoreAnimation support component started\n");
         } else {
             failed_components++;
         }
@@ -481,13 +482,13 @@ IOReturn CLASS::startAllComponents()
     if (!(m_initialized_components & VM_PHASE3_IOSURFACE)) {
         if (enableIOSurfaceSupport() == kIOReturnSuccess) {
             m_initialized_components |= VM_PHASE3_IOSURFACE;
-            IOLog("VMPhase3Manager: IOSurface support component started\n");
+            VMLOG_INFO("VMPhase3Manager: IOSurface support component started\n");
         } else {
             failed_components++;
         }
     }
     
-    IOLog("VMPhase3Manager: Started all components - active: 0x%02x, failed: %u\n", 
+    VMLOG_INFO("VMPhase3Manager: Started all components - active: 0x%02x, failed: %u\n", 
           m_initialized_components, failed_components);
     
     if (failed_components > 0) {
@@ -512,31 +513,31 @@ IOReturn CLASS::stopAllComponents()
         disableMetalSupport();
         m_initialized_components &= ~VM_PHASE3_METAL_BRIDGE;
         stopped_components++;
-        IOLog("VMPhase3Manager: Metal support component stopped\n");
+        VMLOG_INFO("VMPhase3Manager: Metal support component stopped\n");
     }
     
     if (m_initialized_components & VM_PHASE3_OPENGL_BRIDGE) {
         disableOpenGLSupport();
         m_initialized_components &= ~VM_PHASE3_OPENGL_BRIDGE;
         stopped_components++;
-        IOLog("VMPhase3Manager: OpenGL support component stopped\n");
+        VMLOG_INFO("VMPhase3Manager: OpenGL support component stopped\n");
     }
     
     if (m_initialized_components & VM_PHASE3_COREANIMATION) {
         disableCoreAnimationSupport();
         m_initialized_components &= ~VM_PHASE3_COREANIMATION;
         stopped_components++;
-        IOLog("VMPhase3Manager: CoreAnimation support component stopped\n");
+        VMLOG_INFO("VMPhase3Manager: CoreAnimation support component stopped\n");
     }
     
     if (m_initialized_components & VM_PHASE3_IOSURFACE) {
         disableIOSurfaceSupport();
         m_initialized_components &= ~VM_PHASE3_IOSURFACE;
         stopped_components++;
-        IOLog("VMPhase3Manager: IOSurface support component stopped\n");
+        VMLOG_INFO("VMPhase3Manager: IOSurface support component stopped\n");
     }
     
-    IOLog("VMPhase3Manager: Stopped %u components - remaining active: 0x%02x\n", 
+    VMLOG_INFO("VMPhase3Manager: Stopped %u components - remaining active: 0x%02x\n", 
           stopped_components, m_initialized_components);
     
     IORecursiveLockUnlock(m_lock);
@@ -559,10 +560,10 @@ IOReturn CLASS::restartComponent(uint32_t component_id)
             }
             if (m_metal_bridge && enableMetalSupport() == kIOReturnSuccess) {
                 m_initialized_components |= VM_PHASE3_METAL_BRIDGE;
-                IOLog("VMPhase3Manager: Metal component restarted successfully\n");
+                VMLOG_DEBUG("VMPhase3Manager: Metal component restarted successfully\n");
             } else {
                 result = kIOReturnError;
-                IOLog("VMPhase3Manager: Failed to restart Metal component\n");
+                VMLOG_ERROR("VMPhase3Manager: Failed to restart Metal component\n");
             }
             break;
             
@@ -573,10 +574,10 @@ IOReturn CLASS::restartComponent(uint32_t component_id)
             }
             if (m_opengl_bridge && enableOpenGLSupport() == kIOReturnSuccess) {
                 m_initialized_components |= VM_PHASE3_OPENGL_BRIDGE;
-                IOLog("VMPhase3Manager: OpenGL component restarted successfully\n");
+                VMLOG_DEBUG("VMPhase3Manager: OpenGL component restarted successfully\n");
             } else {
                 result = kIOReturnError;
-                IOLog("VMPhase3Manager: Failed to restart OpenGL component\n");
+                VMLOG_ERROR("VMPhase3Manager: Failed to restart OpenGL component\n");
             }
             break;
             
@@ -587,10 +588,10 @@ IOReturn CLASS::restartComponent(uint32_t component_id)
             }
             if (enableCoreAnimationSupport() == kIOReturnSuccess) {
                 m_initialized_components |= VM_PHASE3_COREANIMATION;
-                IOLog("VMPhase3Manager: CoreAnimation component restarted successfully\n");
+                VMLOG_DEBUG("VMPhase3Manager: CoreAnimation component restarted successfully\n");
             } else {
                 result = kIOReturnError;
-                IOLog("VMPhase3Manager: Failed to restart CoreAnimation component\n");
+                VMLOG_ERROR("VMPhase3Manager: Failed to restart CoreAnimation component\n");
             }
             break;
             
@@ -601,16 +602,16 @@ IOReturn CLASS::restartComponent(uint32_t component_id)
             }
             if (enableIOSurfaceSupport() == kIOReturnSuccess) {
                 m_initialized_components |= VM_PHASE3_IOSURFACE;
-                IOLog("VMPhase3Manager: IOSurface component restarted successfully\n");
+                VMLOG_DEBUG("VMPhase3Manager: IOSurface component restarted successfully\n");
             } else {
                 result = kIOReturnError;
-                IOLog("VMPhase3Manager: Failed to restart IOSurface component\n");
+                VMLOG_ERROR("VMPhase3Manager: Failed to restart IOSurface component\n");
             }
             break;
             
         default:
             result = kIOReturnBadArgument;
-            IOLog("VMPhase3Manager: Invalid component ID %u for restart\n", component_id);
+            VMLOG_WARN("VMPhase3Manager: Invalid component ID %u for restart\n", component_id);
             break;
     }
     
@@ -634,16 +635,16 @@ IOReturn CLASS::enableMetalSupport()
     
     if (!m_metal_bridge) {
         result = kIOReturnNoDevice;
-        IOLog("VMPhase3Manager: No Metal bridge available\n");
+        VMLOG_INFO("VMPhase3Manager: No Metal bridge available\n");
     } else if (!(m_enabled_features & VM_PHASE3_METAL_BRIDGE)) {
         m_enabled_features |= VM_PHASE3_METAL_BRIDGE;
         
         // Configure Metal bridge for hardware acceleration
         // In production this would call specific Metal bridge configuration methods
         
-        IOLog("VMPhase3Manager: Metal support enabled - hardware acceleration active\n");
+        VMLOG_INFO("VMPhase3Manager: Metal support enabled - hardware acceleration active\n");
     } else {
-        IOLog("VMPhase3Manager: Metal support already enabled\n");
+        VMLOG_INFO("VMPhase3Manager: Metal support already enabled\n");
     }
     
     IORecursiveLockUnlock(m_lock);
@@ -664,9 +665,9 @@ IOReturn CLASS::disableMetalSupport()
         // Disable Metal bridge hardware acceleration
         // In production this would call specific Metal bridge cleanup methods
         
-        IOLog("VMPhase3Manager: Metal support disabled - hardware acceleration inactive\n");
+        VMLOG_INFO("VMPhase3Manager: Metal support disabled - hardware acceleration inactive\n");
     } else {
-        IOLog("VMPhase3Manager: Metal support already disabled\n");
+        VMLOG_INFO("VMPhase3Manager: Metal support already disabled\n");
     }
     
     IORecursiveLockUnlock(m_lock);
@@ -689,16 +690,16 @@ IOReturn CLASS::enableOpenGLSupport()
     
     if (!m_opengl_bridge) {
         result = kIOReturnNoDevice;
-        IOLog("VMPhase3Manager: No OpenGL bridge available\n");
+        VMLOG_INFO("VMPhase3Manager: No OpenGL bridge available\n");
     } else if (!(m_enabled_features & VM_PHASE3_OPENGL_BRIDGE)) {
         m_enabled_features |= VM_PHASE3_OPENGL_BRIDGE;
         
         // Configure OpenGL bridge for hardware acceleration
         // In production this would initialize OpenGL contexts and buffers
         
-        IOLog("VMPhase3Manager: OpenGL support enabled - hardware acceleration active\n");
+        VMLOG_INFO("VMPhase3Manager: OpenGL support enabled - hardware acceleration active\n");
     } else {
-        IOLog("VMPhase3Manager: OpenGL support already enabled\n");
+        VMLOG_INFO("VMPhase3Manager: OpenGL support already enabled\n");
     }
     
     IORecursiveLockUnlock(m_lock);
@@ -719,9 +720,9 @@ IOReturn CLASS::disableOpenGLSupport()
         // Disable OpenGL bridge hardware acceleration
         // In production this would cleanup OpenGL contexts and buffers
         
-        IOLog("VMPhase3Manager: OpenGL support disabled - hardware acceleration inactive\n");
+        VMLOG_INFO("VMPhase3Manager: OpenGL support disabled - hardware acceleration inactive\n");
     } else {
-        IOLog("VMPhase3Manager: OpenGL support already disabled\n");
+        VMLOG_INFO("VMPhase3Manager: OpenGL support already disabled\n");
     }
     
     IORecursiveLockUnlock(m_lock);
@@ -748,9 +749,9 @@ IOReturn CLASS::enableCoreAnimationSupport()
         // Enable CoreAnimation hardware acceleration
         // In production this would initialize CALayer acceleration and compositor
         
-        IOLog("VMPhase3Manager: CoreAnimation support enabled - layer acceleration active\n");
+        VMLOG_INFO("VMPhase3Manager: CoreAnimation support enabled - layer acceleration active\n");
     } else {
-        IOLog("VMPhase3Manager: CoreAnimation support already enabled\n");
+        VMLOG_INFO("VMPhase3Manager: CoreAnimation support already enabled\n");
     }
     
     IORecursiveLockUnlock(m_lock);
@@ -771,9 +772,9 @@ IOReturn CLASS::disableCoreAnimationSupport()
         // Disable CoreAnimation hardware acceleration
         // In production this would cleanup CALayer acceleration and compositor
         
-        IOLog("VMPhase3Manager: CoreAnimation support disabled - layer acceleration inactive\n");
+        VMLOG_INFO("VMPhase3Manager: CoreAnimation support disabled - layer acceleration inactive\n");
     } else {
-        IOLog("VMPhase3Manager: CoreAnimation support already disabled\n");
+        VMLOG_INFO("VMPhase3Manager: CoreAnimation support already disabled\n");
     }
     
     IORecursiveLockUnlock(m_lock);
@@ -800,9 +801,9 @@ IOReturn CLASS::enableIOSurfaceSupport()
         // Enable IOSurface hardware acceleration
         // In production this would initialize surface management and GPU memory mapping
         
-        IOLog("VMPhase3Manager: IOSurface support enabled - surface acceleration active\n");
+        VMLOG_INFO("VMPhase3Manager: IOSurface support enabled - surface acceleration active\n");
     } else {
-        IOLog("VMPhase3Manager: IOSurface support already enabled\n");
+        VMLOG_INFO("VMPhase3Manager: IOSurface support already enabled\n");
     }
     
     IORecursiveLockUnlock(m_lock);
@@ -823,9 +824,9 @@ IOReturn CLASS::disableIOSurfaceSupport()
         // Disable IOSurface hardware acceleration
         // In production this would cleanup surface management and GPU memory mappings
         
-        IOLog("VMPhase3Manager: IOSurface support disabled - surface acceleration inactive\n");
+        VMLOG_INFO("VMPhase3Manager: IOSurface support disabled - surface acceleration inactive\n");
     } else {
-        IOLog("VMPhase3Manager: IOSurface support already disabled\n");
+        VMLOG_INFO("VMPhase3Manager: IOSurface support already disabled\n");
     }
     
     IORecursiveLockUnlock(m_lock);
@@ -844,33 +845,33 @@ bool CLASS::isIOSurfaceSupported()
 IOReturn CLASS::configureDisplay(uint32_t display_id, const VMDisplayConfiguration* config)
 {
     if (!config) {
-        IOLog("VMPhase3Manager: Invalid display configuration provided\n");
+        VMLOG_WARN("VMPhase3Manager: Invalid display configuration provided\n");
         return kIOReturnBadArgument;
     }
     
     if (!m_lock) return kIOReturnNotReady;
     IORecursiveLockLock(m_lock);
     
-    IOLog("VMPhase3Manager: Configuring display %u - %ux%u@%uHz, %u-bit, Scale: %.2f\n",
+    VMLOG_INFO("VMPhase3Manager: Configuring display %u - %ux%u@%uHz, %u-bit, Scale: %.2f\n",
           display_id, config->width, config->height, config->refresh_rate, 
           config->bit_depth, config->scale_factor);
     
     // Stage 1: Validate display configuration parameters
     IOReturn validation_result = validateDisplayConfiguration(display_id, config);
     if (validation_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Display configuration validation failed (0x%x)\n", validation_result);
+        VMLOG_ERROR("VMPhase3Manager: Display configuration validation failed (0x%x)\n", validation_result);
         IORecursiveLockUnlock(m_lock);
         return validation_result;
     }
     
     // Stage 2: Configure VirtIO GPU display mode with advanced features
     if (m_gpu_device) {
-        IOLog("VMPhase3Manager: Setting VirtIO GPU display mode for display %u\n", display_id);
+        VMLOG_INFO("VMPhase3Manager: Setting VirtIO GPU display mode for display %u\n", display_id);
         
         // Configure VirtIO GPU scanout with optimal settings
         IOReturn scanout_result = configureVirtIOGPUScanout(display_id, config);
         if (scanout_result != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: VirtIO GPU scanout configuration failed (0x%x)\n", scanout_result);
+            VMLOG_ERROR("VMPhase3Manager: VirtIO GPU scanout configuration failed (0x%x)\n", scanout_result);
             IORecursiveLockUnlock(m_lock);
             return scanout_result;
         }
@@ -878,7 +879,7 @@ IOReturn CLASS::configureDisplay(uint32_t display_id, const VMDisplayConfigurati
         // Configure advanced display features
         IOReturn advanced_result = configureAdvancedDisplayFeatures(display_id, config);
         if (advanced_result != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Advanced display features configuration failed (0x%x)\n", advanced_result);
+            VMLOG_ERROR("VMPhase3Manager: Advanced display features configuration failed (0x%x)\n", advanced_result);
             // Continue - advanced features are optional
         }
     }
@@ -886,7 +887,7 @@ IOReturn CLASS::configureDisplay(uint32_t display_id, const VMDisplayConfigurati
     // Stage 3: Update rendering bridges for new display configuration
     IOReturn bridge_result = updateRenderingBridgesForDisplay(display_id, config);
     if (bridge_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Rendering bridge update failed (0x%x)\n", bridge_result);
+        VMLOG_ERROR("VMPhase3Manager: Rendering bridge update failed (0x%x)\n", bridge_result);
         IORecursiveLockUnlock(m_lock);
         return bridge_result;
     }
@@ -894,11 +895,11 @@ IOReturn CLASS::configureDisplay(uint32_t display_id, const VMDisplayConfigurati
     // Stage 4: Configure display-specific performance optimizations
     IOReturn perf_result = configureDisplayPerformanceOptimizations(display_id, config);
     if (perf_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Display performance optimization failed (0x%x)\n", perf_result);
+        VMLOG_ERROR("VMPhase3Manager: Display performance optimization failed (0x%x)\n", perf_result);
         // Continue - performance optimizations are optional
     }
     
-    IOLog("VMPhase3Manager: Display %u configuration completed successfully\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: Display %u configuration completed successfully\n", display_id);
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -907,23 +908,23 @@ IOReturn CLASS::configureDisplay(uint32_t display_id, const VMDisplayConfigurati
 IOReturn CLASS::getDisplayConfiguration(uint32_t display_id, VMDisplayConfiguration* config)
 {
     if (!config) {
-        IOLog("VMPhase3Manager: Invalid configuration buffer provided\n");
+        VMLOG_WARN("VMPhase3Manager: Invalid configuration buffer provided\n");
         return kIOReturnBadArgument;
     }
     
     if (!m_lock) return kIOReturnNotReady;
     IORecursiveLockLock(m_lock);
     
-    IOLog("VMPhase3Manager: Querying display %u configuration\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Querying display %u configuration\n", display_id);
     
     // Query current display configuration from VirtIO GPU with advanced capabilities
     if (m_gpu_device) {
-        IOLog("VMPhase3Manager: Retrieving comprehensive VirtIO GPU display mode for display %u\n", display_id);
+        VMLOG_DEBUG("VMPhase3Manager: Retrieving comprehensive VirtIO GPU display mode for display %u\n", display_id);
         
         // Query actual display mode from VirtIO GPU
         IOReturn query_result = queryVirtIOGPUDisplayMode(display_id, config);
         if (query_result != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: VirtIO GPU display mode query failed (0x%x)\n", query_result);
+            VMLOG_ERROR("VMPhase3Manager: VirtIO GPU display mode query failed (0x%x)\n", query_result);
             
             // Fall back to default configuration
             IOReturn default_result = setDefaultDisplayConfiguration(display_id, config);
@@ -936,17 +937,17 @@ IOReturn CLASS::getDisplayConfiguration(uint32_t display_id, VMDisplayConfigurat
         // Query advanced display capabilities
         IOReturn caps_result = queryAdvancedDisplayCapabilities(display_id, config);
         if (caps_result != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Advanced display capabilities query failed (0x%x)\n", caps_result);
+            VMLOG_ERROR("VMPhase3Manager: Advanced display capabilities query failed (0x%x)\n", caps_result);
             // Continue with basic configuration
         }
         
-        IOLog("VMPhase3Manager: Display %u - %ux%u@%uHz, HDR: %s, VRR: %s, Color Space: %u\n",
+        VMLOG_DEBUG("VMPhase3Manager: Display %u - %ux%u@%uHz, HDR: %s, VRR: %s, Color Space: %u\n",
               display_id, config->width, config->height, config->refresh_rate,
               config->hdr_supported ? "Yes" : "No",
               config->variable_refresh_rate ? "Yes" : "No",
               config->color_space);
     } else {
-        IOLog("VMPhase3Manager: VirtIO GPU not available for display configuration query\n");
+        VMLOG_DEBUG("VMPhase3Manager: VirtIO GPU not available for display configuration query\n");
         IORecursiveLockUnlock(m_lock);
         return kIOReturnNoDevice;
     }
@@ -960,12 +961,12 @@ IOReturn CLASS::enableMultiDisplay()
     if (!m_lock) return kIOReturnNotReady;
     IORecursiveLockLock(m_lock);
     
-    IOLog("VMPhase3Manager: Enabling advanced multi-display support\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling advanced multi-display support\n");
     
     // Stage 1: Validate multi-display capabilities
     IOReturn validation_result = validateMultiDisplayCapabilities();
     if (validation_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Multi-display capability validation failed (0x%x)\n", validation_result);
+        VMLOG_ERROR("VMPhase3Manager: Multi-display capability validation failed (0x%x)\n", validation_result);
         IORecursiveLockUnlock(m_lock);
         return validation_result;
     }
@@ -973,7 +974,7 @@ IOReturn CLASS::enableMultiDisplay()
     // Stage 2: Configure VirtIO GPU for advanced multi-display
     IOReturn virtio_result = configureVirtIOGPUMultiDisplay();
     if (virtio_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: VirtIO GPU multi-display configuration failed (0x%x)\n", virtio_result);
+        VMLOG_ERROR("VMPhase3Manager: VirtIO GPU multi-display configuration failed (0x%x)\n", virtio_result);
         IORecursiveLockUnlock(m_lock);
         return virtio_result;
     }
@@ -981,7 +982,7 @@ IOReturn CLASS::enableMultiDisplay()
     // Stage 3: Set up cross-bridge multi-display coordination
     IOReturn bridge_result = enableCrossBridgeMultiDisplay();
     if (bridge_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Cross-bridge multi-display setup failed (0x%x)\n", bridge_result);
+        VMLOG_ERROR("VMPhase3Manager: Cross-bridge multi-display setup failed (0x%x)\n", bridge_result);
         IORecursiveLockUnlock(m_lock);
         return bridge_result;
     }
@@ -989,14 +990,14 @@ IOReturn CLASS::enableMultiDisplay()
     // Stage 4: Enable multi-display performance optimizations
     IOReturn perf_result = enableMultiDisplayPerformanceOptimizations();
     if (perf_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Multi-display performance optimizations failed (0x%x)\n", perf_result);
+        VMLOG_ERROR("VMPhase3Manager: Multi-display performance optimizations failed (0x%x)\n", perf_result);
         // Continue - performance optimizations are optional
     }
     
     // Update feature flags
     m_enabled_features |= VM_PHASE3_MULTI_DISPLAY;
     
-    IOLog("VMPhase3Manager: Advanced multi-display support enabled successfully\n");
+    VMLOG_INFO("VMPhase3Manager: Advanced multi-display support enabled successfully\n");
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -1007,31 +1008,31 @@ IOReturn CLASS::disableMultiDisplay()
     if (!m_lock) return kIOReturnNotReady;
     IORecursiveLockLock(m_lock);
     
-    IOLog("VMPhase3Manager: Disabling multi-display support with graceful cleanup\n");
+    VMLOG_INFO("VMPhase3Manager: Disabling multi-display support with graceful cleanup\n");
     
     // Stage 1: Gracefully shutdown multi-display rendering
     IOReturn shutdown_result = shutdownMultiDisplayRendering();
     if (shutdown_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Multi-display rendering shutdown failed (0x%x)\n", shutdown_result);
+        VMLOG_ERROR("VMPhase3Manager: Multi-display rendering shutdown failed (0x%x)\n", shutdown_result);
         // Continue with cleanup attempt
     }
     
     // Stage 2: Disable VirtIO GPU multi-scanout mode
     IOReturn virtio_result = disableVirtIOGPUMultiDisplay();
     if (virtio_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: VirtIO GPU multi-display disable failed (0x%x)\n", virtio_result);
+        VMLOG_ERROR("VMPhase3Manager: VirtIO GPU multi-display disable failed (0x%x)\n", virtio_result);
     }
     
     // Stage 3: Clean up cross-bridge resources
     IOReturn cleanup_result = cleanupCrossBridgeMultiDisplay();
     if (cleanup_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Cross-bridge cleanup failed (0x%x)\n", cleanup_result);
+        VMLOG_ERROR("VMPhase3Manager: Cross-bridge cleanup failed (0x%x)\n", cleanup_result);
     }
     
     // Update feature flags
     m_enabled_features &= ~VM_PHASE3_MULTI_DISPLAY;
     
-    IOLog("VMPhase3Manager: Multi-display support disabled successfully\n");
+    VMLOG_INFO("VMPhase3Manager: Multi-display support disabled successfully\n");
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -1042,12 +1043,12 @@ IOReturn CLASS::setPrimaryDisplay(uint32_t display_id)
     if (!m_lock) return kIOReturnNotReady;
     IORecursiveLockLock(m_lock);
     
-    IOLog("VMPhase3Manager: Setting display %u as primary display with advanced configuration\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Setting display %u as primary display with advanced configuration\n", display_id);
     
     // Stage 1: Validate primary display configuration
     IOReturn validation_result = validatePrimaryDisplayConfiguration(display_id);
     if (validation_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Primary display validation failed (0x%x)\n", validation_result);
+        VMLOG_ERROR("VMPhase3Manager: Primary display validation failed (0x%x)\n", validation_result);
         IORecursiveLockUnlock(m_lock);
         return validation_result;
     }
@@ -1055,7 +1056,7 @@ IOReturn CLASS::setPrimaryDisplay(uint32_t display_id)
     // Stage 2: Configure VirtIO GPU primary scanout with advanced settings
     IOReturn virtio_result = configureVirtIOGPUPrimaryDisplay(display_id);
     if (virtio_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: VirtIO GPU primary display configuration failed (0x%x)\n", virtio_result);
+        VMLOG_ERROR("VMPhase3Manager: VirtIO GPU primary display configuration failed (0x%x)\n", virtio_result);
         IORecursiveLockUnlock(m_lock);
         return virtio_result;
     }
@@ -1063,7 +1064,7 @@ IOReturn CLASS::setPrimaryDisplay(uint32_t display_id)
     // Stage 3: Update all rendering bridges for primary display
     IOReturn bridge_result = updateBridgesForPrimaryDisplay(display_id);
     if (bridge_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Bridge primary display update failed (0x%x)\n", bridge_result);
+        VMLOG_ERROR("VMPhase3Manager: Bridge primary display update failed (0x%x)\n", bridge_result);
         IORecursiveLockUnlock(m_lock);
         return bridge_result;
     }
@@ -1071,11 +1072,11 @@ IOReturn CLASS::setPrimaryDisplay(uint32_t display_id)
     // Stage 4: Optimize performance for primary display
     IOReturn perf_result = optimizePerformanceForPrimaryDisplay(display_id);
     if (perf_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Primary display performance optimization failed (0x%x)\n", perf_result);
+        VMLOG_ERROR("VMPhase3Manager: Primary display performance optimization failed (0x%x)\n", perf_result);
         // Continue - performance optimizations are optional
     }
     
-    IOLog("VMPhase3Manager: Primary display set to %u successfully with advanced features\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Primary display set to %u successfully with advanced features\n", display_id);
     
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
@@ -1088,11 +1089,11 @@ IOReturn CLASS::setPrimaryDisplay(uint32_t display_id)
 IOReturn CLASS::configureMetalBridgeFeatures()
 {
     if (!m_metal_bridge || !m_gpu_device) {
-        IOLog("VMPhase3Manager: Metal Bridge or GPU device not available for configuration\n");
+        VMLOG_INFO("VMPhase3Manager: Metal Bridge or GPU device not available for configuration\n");
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMPhase3Manager: Configuring Metal Bridge features with VirtIO GPU capabilities\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring Metal Bridge features with VirtIO GPU capabilities\n");
     
     // Stage 1: Query VirtIO GPU capabilities for Metal translation
     bool supports_virgl = m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_VIRGL);
@@ -1100,12 +1101,12 @@ IOReturn CLASS::configureMetalBridgeFeatures()
     bool supports_resource_blob = m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_RESOURCE_BLOB);
     bool supports_context_init = m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_CONTEXT_INIT);
     
-    IOLog("VMPhase3Manager: VirtIO GPU Features - Virgl: %s, 3D: %s, Resource Blob: %s, Context Init: %s\n",
+    VMLOG_INFO("VMPhase3Manager: VirtIO GPU Features - Virgl: %s, 3D: %s, Resource Blob: %s, Context Init: %s\n",
           supports_virgl ? "Yes" : "No", supports_3d ? "Yes" : "No", 
           supports_resource_blob ? "Yes" : "No", supports_context_init ? "Yes" : "No");
     
     if (!supports_virgl || !supports_3d) {
-        IOLog("VMPhase3Manager: Warning - VirtIO GPU lacks required features for optimal Metal translation\n");
+        VMLOG_WARN("VMPhase3Manager: Warning - VirtIO GPU lacks required features for optimal Metal translation\n");
         return kIOReturnUnsupported;
     }
     
@@ -1114,136 +1115,136 @@ IOReturn CLASS::configureMetalBridgeFeatures()
     
     // Enable Metal 2.0+ features if VirtIO GPU supports advanced capabilities
     if (supports_resource_blob && supports_context_init) {
-        IOLog("VMPhase3Manager: Enabling advanced Metal features with resource blob support\n");
+        VMLOG_INFO("VMPhase3Manager: Enabling advanced Metal features with resource blob support\n");
         // Configure for Metal 2.0+ features: argument buffers, indirect command buffers, etc.
         config_result = configureAdvancedMetalFeatures();
         if (config_result != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Advanced Metal feature configuration failed (0x%x)\n", config_result);
+            VMLOG_ERROR("VMPhase3Manager: Advanced Metal feature configuration failed (0x%x)\n", config_result);
         }
     }
     
     // Stage 3: Configure Metal texture and buffer translation
     config_result = configureMetalResourceTranslation();
     if (config_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Metal resource translation configuration failed (0x%x)\n", config_result);
+        VMLOG_ERROR("VMPhase3Manager: Metal resource translation configuration failed (0x%x)\n", config_result);
         return config_result;
     }
     
     // Stage 4: Configure Metal shader translation to SPIR-V/GLSL for Virgl
     config_result = configureMetalShaderTranslation();
     if (config_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Metal shader translation configuration failed (0x%x)\n", config_result);
+        VMLOG_ERROR("VMPhase3Manager: Metal shader translation configuration failed (0x%x)\n", config_result);
         return config_result;
     }
     
     // Stage 5: Configure Metal compute pipeline for GPU compute through Virgl
     config_result = configureMetalComputePipeline();
     if (config_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Metal compute pipeline configuration failed (0x%x)\n", config_result);
+        VMLOG_ERROR("VMPhase3Manager: Metal compute pipeline configuration failed (0x%x)\n", config_result);
         // Continue - compute is optional for basic Metal functionality
     }
     
     // Stage 6: Enable Metal-Virgl command buffer optimization
     config_result = enableMetalCommandBufferOptimization();
     if (config_result != kIOReturnSuccess) {
-        IOLog("VMPhase3Manager: Metal command buffer optimization failed (0x%x)\n", config_result);
+        VMLOG_ERROR("VMPhase3Manager: Metal command buffer optimization failed (0x%x)\n", config_result);
         // Continue - optimization failure doesn't break functionality
     }
     
-    IOLog("VMPhase3Manager: Metal Bridge feature configuration completed successfully\n");
+    VMLOG_INFO("VMPhase3Manager: Metal Bridge feature configuration completed successfully\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureAdvancedMetalFeatures()
 {
-    IOLog("VMPhase3Manager: Configuring advanced Metal 2.0+ features\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring advanced Metal 2.0+ features\n");
     
     // Configure argument buffers for efficient resource binding
     // This translates Metal argument buffers to VirtIO GPU descriptor sets
-    IOLog("VMPhase3Manager: Enabling Metal argument buffer translation to VirtIO GPU descriptors\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling Metal argument buffer translation to VirtIO GPU descriptors\n");
     
     // Configure indirect command buffers for GPU-driven rendering
     // This translates Metal indirect commands to VirtIO GPU command streams
-    IOLog("VMPhase3Manager: Enabling Metal indirect command buffer translation\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling Metal indirect command buffer translation\n");
     
     // Configure tessellation pipeline if supported by host GPU through Virgl
-    IOLog("VMPhase3Manager: Configuring Metal tessellation pipeline translation\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring Metal tessellation pipeline translation\n");
     
     // Configure raytracing pipeline if supported (Metal 3.0+ feature)
-    IOLog("VMPhase3Manager: Checking Metal raytracing translation capabilities\n");
+    VMLOG_INFO("VMPhase3Manager: Checking Metal raytracing translation capabilities\n");
     
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureMetalResourceTranslation()
 {
-    IOLog("VMPhase3Manager: Configuring Metal resource translation to VirtIO GPU resources\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring Metal resource translation to VirtIO GPU resources\n");
     
     // Configure Metal buffer translation to VirtIO GPU buffers
     // Metal buffers -> VirtIO GPU buffer objects -> Host GPU buffers
-    IOLog("VMPhase3Manager: Setting up Metal buffer to VirtIO GPU buffer translation\n");
+    VMLOG_INFO("VMPhase3Manager: Setting up Metal buffer to VirtIO GPU buffer translation\n");
     
     // Configure Metal texture translation to VirtIO GPU textures
     // Metal textures -> VirtIO GPU texture resources -> Host GPU textures
-    IOLog("VMPhase3Manager: Setting up Metal texture to VirtIO GPU texture translation\n");
+    VMLOG_INFO("VMPhase3Manager: Setting up Metal texture to VirtIO GPU texture translation\n");
     
     // Configure Metal sampler translation to VirtIO GPU samplers
-    IOLog("VMPhase3Manager: Setting up Metal sampler to VirtIO GPU sampler translation\n");
+    VMLOG_INFO("VMPhase3Manager: Setting up Metal sampler to VirtIO GPU sampler translation\n");
     
     // Configure heap and resource sharing between Metal and host GPU
-    IOLog("VMPhase3Manager: Enabling Metal heap translation for efficient memory management\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling Metal heap translation for efficient memory management\n");
     
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureMetalShaderTranslation()
 {
-    IOLog("VMPhase3Manager: Configuring Metal shader translation to Virgl-compatible formats\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring Metal shader translation to Virgl-compatible formats\n");
     
     // Configure Metal Shading Language (MSL) to SPIR-V translation
     // MSL shaders -> SPIR-V bytecode -> Virgl -> Host GPU shaders
-    IOLog("VMPhase3Manager: Enabling MSL to SPIR-V translation for Virgl compatibility\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling MSL to SPIR-V translation for Virgl compatibility\n");
     
     // Configure Metal vertex/fragment shader translation
-    IOLog("VMPhase3Manager: Setting up Metal graphics shader translation pipeline\n");
+    VMLOG_INFO("VMPhase3Manager: Setting up Metal graphics shader translation pipeline\n");
     
     // Configure Metal compute shader translation
-    IOLog("VMPhase3Manager: Setting up Metal compute shader translation pipeline\n");
+    VMLOG_INFO("VMPhase3Manager: Setting up Metal compute shader translation pipeline\n");
     
     // Configure Metal function specialization translation
-    IOLog("VMPhase3Manager: Enabling Metal function specialization translation\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling Metal function specialization translation\n");
     
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureMetalComputePipeline()
 {
-    IOLog("VMPhase3Manager: Configuring Metal compute pipeline for GPU compute through Virgl\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring Metal compute pipeline for GPU compute through Virgl\n");
     
     // Configure Metal compute command encoding translation
-    IOLog("VMPhase3Manager: Setting up Metal compute command translation\n");
+    VMLOG_INFO("VMPhase3Manager: Setting up Metal compute command translation\n");
     
     // Configure Metal threadgroup and grid size translation
-    IOLog("VMPhase3Manager: Configuring Metal dispatch parameter translation\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring Metal dispatch parameter translation\n");
     
     // Configure Metal compute buffer binding translation
-    IOLog("VMPhase3Manager: Setting up Metal compute resource binding translation\n");
+    VMLOG_INFO("VMPhase3Manager: Setting up Metal compute resource binding translation\n");
     
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::enableMetalCommandBufferOptimization()
 {
-    IOLog("VMPhase3Manager: Enabling Metal command buffer optimization for VirtIO GPU\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling Metal command buffer optimization for VirtIO GPU\n");
     
     // Configure command buffer batching for reduced VirtIO GPU overhead
-    IOLog("VMPhase3Manager: Enabling Metal command buffer batching optimization\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling Metal command buffer batching optimization\n");
     
     // Configure parallel command buffer encoding
-    IOLog("VMPhase3Manager: Setting up parallel Metal command buffer translation\n");
+    VMLOG_INFO("VMPhase3Manager: Setting up parallel Metal command buffer translation\n");
     
     // Configure command buffer synchronization with VirtIO GPU
-    IOLog("VMPhase3Manager: Configuring Metal-VirtIO GPU synchronization\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring Metal-VirtIO GPU synchronization\n");
     
     return kIOReturnSuccess;
 }
@@ -1254,205 +1255,205 @@ IOReturn CLASS::enableMetalCommandBufferOptimization()
 
 IOReturn CLASS::validateDisplayConfiguration(uint32_t display_id, const VMDisplayConfiguration* config)
 {
-    IOLog("VMPhase3Manager: Validating display %u configuration\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Validating display %u configuration\n", display_id);
     
     // Validate resolution bounds
     if (config->width < 640 || config->width > 7680 || config->height < 480 || config->height > 4320) {
-        IOLog("VMPhase3Manager: Invalid resolution %ux%u (bounds: 640x480 to 7680x4320)\n", 
+        VMLOG_WARN("VMPhase3Manager: Invalid resolution %ux%u (bounds: 640x480 to 7680x4320)\n", 
               config->width, config->height);
         return kIOReturnBadArgument;
     }
     
     // Validate refresh rate
     if (config->refresh_rate < 24 || config->refresh_rate > 240) {
-        IOLog("VMPhase3Manager: Invalid refresh rate %u (bounds: 24-240 Hz)\n", config->refresh_rate);
+        VMLOG_WARN("VMPhase3Manager: Invalid refresh rate %u (bounds: 24-240 Hz)\n", config->refresh_rate);
         return kIOReturnBadArgument;
     }
     
     // Validate bit depth
     if (config->bit_depth != 16 && config->bit_depth != 24 && config->bit_depth != 32) {
-        IOLog("VMPhase3Manager: Unsupported bit depth %u (supported: 16, 24, 32)\n", config->bit_depth);
+        VMLOG_WARN("VMPhase3Manager: Unsupported bit depth %u (supported: 16, 24, 32)\n", config->bit_depth);
         return kIOReturnBadArgument;
     }
     
     // Validate scale factor
     if (config->scale_factor < 0.5f || config->scale_factor > 4.0f) {
-        IOLog("VMPhase3Manager: Invalid scale factor %.2f (bounds: 0.5-4.0)\n", config->scale_factor);
+        VMLOG_WARN("VMPhase3Manager: Invalid scale factor %.2f (bounds: 0.5-4.0)\n", config->scale_factor);
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMPhase3Manager: Display %u configuration validation passed\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Display %u configuration validation passed\n", display_id);
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureVirtIOGPUScanout(uint32_t display_id, const VMDisplayConfiguration* config)
 {
-    IOLog("VMPhase3Manager: Configuring VirtIO GPU scanout for display %u\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: Configuring VirtIO GPU scanout for display %u\n", display_id);
     
     if (!m_gpu_device) {
-        IOLog("VMPhase3Manager: VirtIO GPU device not available\n");
+        VMLOG_INFO("VMPhase3Manager: VirtIO GPU device not available\n");
         return kIOReturnNoDevice;
     }
     
     // Configure primary scanout resolution
-    IOLog("VMPhase3Manager: Setting scanout resolution %ux%u for display %u\n", 
+    VMLOG_INFO("VMPhase3Manager: Setting scanout resolution %ux%u for display %u\n", 
           config->width, config->height, display_id);
     
     // Allocate framebuffer resources
     uint32_t framebuffer_size = config->width * config->height * (config->bit_depth / 8);
-    IOLog("VMPhase3Manager: Allocating %u bytes framebuffer for display %u\n", 
+    VMLOG_INFO("VMPhase3Manager: Allocating %u bytes framebuffer for display %u\n", 
           framebuffer_size, display_id);
     
     // Configure VirtIO GPU resource for scanout
-    IOLog("VMPhase3Manager: Creating VirtIO GPU resource for display %u scanout\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: Creating VirtIO GPU resource for display %u scanout\n", display_id);
     
     // Set scanout configuration in VirtIO GPU
-    IOLog("VMPhase3Manager: VirtIO GPU scanout %u configured successfully\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: VirtIO GPU scanout %u configured successfully\n", display_id);
     
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureAdvancedDisplayFeatures(uint32_t display_id, const VMDisplayConfiguration* config)
 {
-    IOLog("VMPhase3Manager: Configuring advanced display features for display %u\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: Configuring advanced display features for display %u\n", display_id);
     
     // Configure HDR support if requested
     if (config->hdr_supported) {
-        IOLog("VMPhase3Manager: Enabling HDR10 support for display %u\n", display_id);
+        VMLOG_INFO("VMPhase3Manager: Enabling HDR10 support for display %u\n", display_id);
         IOReturn hdr_result = enableHDRSupport();
         if (hdr_result != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: HDR support configuration failed (0x%x)\n", hdr_result);
+            VMLOG_ERROR("VMPhase3Manager: HDR support configuration failed (0x%x)\n", hdr_result);
             return hdr_result;
         }
     }
     
     // Configure variable refresh rate if requested
     if (config->variable_refresh_rate) {
-        IOLog("VMPhase3Manager: Enabling variable refresh rate for display %u\n", display_id);
+        VMLOG_INFO("VMPhase3Manager: Enabling variable refresh rate for display %u\n", display_id);
         IOReturn vrr_result = enableVariableRefreshRate();
         if (vrr_result != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Variable refresh rate configuration failed (0x%x)\n", vrr_result);
+            VMLOG_ERROR("VMPhase3Manager: Variable refresh rate configuration failed (0x%x)\n", vrr_result);
             return vrr_result;
         }
     }
     
     // Configure color space
     if (config->color_space != 0) {
-        IOLog("VMPhase3Manager: Configuring color space %u for display %u\n", 
+        VMLOG_INFO("VMPhase3Manager: Configuring color space %u for display %u\n", 
               config->color_space, display_id);
         IOReturn color_result = configureColorSpace(config->color_space);
         if (color_result != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Color space configuration failed (0x%x)\n", color_result);
+            VMLOG_ERROR("VMPhase3Manager: Color space configuration failed (0x%x)\n", color_result);
             return color_result;
         }
     }
     
     // Configure display scaling if needed
     if (config->scale_factor != 1.0f) {
-        IOLog("VMPhase3Manager: Configuring display scaling %.2f for display %u\n", 
+        VMLOG_INFO("VMPhase3Manager: Configuring display scaling %.2f for display %u\n", 
               config->scale_factor, display_id);
         IOReturn scale_result = setDisplayScaling(config->scale_factor);
         if (scale_result != kIOReturnSuccess) {
-            IOLog("VMPhase3Manager: Display scaling configuration failed (0x%x)\n", scale_result);
+            VMLOG_ERROR("VMPhase3Manager: Display scaling configuration failed (0x%x)\n", scale_result);
             return scale_result;
         }
     }
     
-    IOLog("VMPhase3Manager: Advanced display features configured for display %u\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: Advanced display features configured for display %u\n", display_id);
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::updateRenderingBridgesForDisplay(uint32_t display_id, const VMDisplayConfiguration* config)
 {
-    IOLog("VMPhase3Manager: Updating rendering bridges for display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Updating rendering bridges for display %u\n", display_id);
     
     // Update Metal Bridge for new display configuration
     if (m_metal_bridge) {
-        IOLog("VMPhase3Manager: Updating Metal Bridge render targets for display %u\n", display_id);
+        VMLOG_DEBUG("VMPhase3Manager: Updating Metal Bridge render targets for display %u\n", display_id);
         // Configure Metal render targets for new display resolution
-        IOLog("VMPhase3Manager: Metal Bridge updated for %ux%u resolution\n", 
+        VMLOG_DEBUG("VMPhase3Manager: Metal Bridge updated for %ux%u resolution\n", 
               config->width, config->height);
     }
     
     // Update OpenGL Bridge for new display configuration
     if (m_opengl_bridge) {
-        IOLog("VMPhase3Manager: Updating OpenGL Bridge viewport for display %u\n", display_id);
+        VMLOG_DEBUG("VMPhase3Manager: Updating OpenGL Bridge viewport for display %u\n", display_id);
         // Configure OpenGL viewport and framebuffer for new display
-        IOLog("VMPhase3Manager: OpenGL Bridge updated for %ux%u resolution\n", 
+        VMLOG_DEBUG("VMPhase3Manager: OpenGL Bridge updated for %ux%u resolution\n", 
               config->width, config->height);
     }
     
     // Update CoreAnimation for display scaling
     if (m_coreanimation_accelerator && config->scale_factor != 1.0f) {
-        IOLog("VMPhase3Manager: Updating CoreAnimation scaling %.2f for display %u\n", 
+        VMLOG_DEBUG("VMPhase3Manager: Updating CoreAnimation scaling %.2f for display %u\n", 
               config->scale_factor, display_id);
         // Configure CoreAnimation layer scaling
-        IOLog("VMPhase3Manager: CoreAnimation scaling updated for display %u\n", display_id);
+        VMLOG_DEBUG("VMPhase3Manager: CoreAnimation scaling updated for display %u\n", display_id);
     }
     
     // Update IOSurface Manager for new display format
     if (m_iosurface_manager) {
-        IOLog("VMPhase3Manager: Updating IOSurface Manager for display %u format\n", display_id);
+        VMLOG_DEBUG("VMPhase3Manager: Updating IOSurface Manager for display %u format\n", display_id);
         // Configure IOSurface allocation for new display parameters
-        IOLog("VMPhase3Manager: IOSurface Manager updated for %u-bit depth\n", config->bit_depth);
+        VMLOG_DEBUG("VMPhase3Manager: IOSurface Manager updated for %u-bit depth\n", config->bit_depth);
     }
     
-    IOLog("VMPhase3Manager: All rendering bridges updated for display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: All rendering bridges updated for display %u\n", display_id);
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureDisplayPerformanceOptimizations(uint32_t display_id, const VMDisplayConfiguration* config)
 {
-    IOLog("VMPhase3Manager: Configuring performance optimizations for display %u\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: Configuring performance optimizations for display %u\n", display_id);
     
     // Optimize VirtIO GPU performance for resolution
     uint32_t pixel_count = config->width * config->height;
     if (pixel_count > 2073600) { // 1920x1080
-        IOLog("VMPhase3Manager: High resolution detected - enabling performance optimizations\n");
+        VMLOG_INFO("VMPhase3Manager: High resolution detected - enabling performance optimizations\n");
         
         // Enable command buffer batching for high resolution
-        IOLog("VMPhase3Manager: Enabling VirtIO GPU command batching for display %u\n", display_id);
+        VMLOG_INFO("VMPhase3Manager: Enabling VirtIO GPU command batching for display %u\n", display_id);
         
         // Configure parallel rendering if supported
         if (m_metal_bridge) {
-            IOLog("VMPhase3Manager: Enabling Metal parallel command encoding for display %u\n", display_id);
+            VMLOG_INFO("VMPhase3Manager: Enabling Metal parallel command encoding for display %u\n", display_id);
         }
     }
     
     // Optimize for high refresh rate
     if (config->refresh_rate > 60) {
-        IOLog("VMPhase3Manager: High refresh rate detected - optimizing frame timing\n");
+        VMLOG_INFO("VMPhase3Manager: High refresh rate detected - optimizing frame timing\n");
         
         // Configure VSync optimization
-        IOLog("VMPhase3Manager: Optimizing VSync timing for %u Hz\n", config->refresh_rate);
+        VMLOG_INFO("VMPhase3Manager: Optimizing VSync timing for %u Hz\n", config->refresh_rate);
         
         // Enable fast path rendering
-        IOLog("VMPhase3Manager: Enabling fast path rendering for high refresh rate\n");
+        VMLOG_INFO("VMPhase3Manager: Enabling fast path rendering for high refresh rate\n");
     }
     
     // Optimize for HDR if enabled
     if (config->hdr_supported) {
-        IOLog("VMPhase3Manager: HDR enabled - configuring tone mapping performance\n");
+        VMLOG_INFO("VMPhase3Manager: HDR enabled - configuring tone mapping performance\n");
         
         // Configure HDR tone mapping acceleration
-        IOLog("VMPhase3Manager: Enabling HDR tone mapping acceleration\n");
+        VMLOG_INFO("VMPhase3Manager: Enabling HDR tone mapping acceleration\n");
     }
     
-    IOLog("VMPhase3Manager: Performance optimizations configured for display %u\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: Performance optimizations configured for display %u\n", display_id);
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::queryVirtIOGPUDisplayMode(uint32_t display_id, VMDisplayConfiguration* config)
 {
-    IOLog("VMPhase3Manager: Querying VirtIO GPU display mode for display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Querying VirtIO GPU display mode for display %u\n", display_id);
     
     if (!m_gpu_device) {
-        IOLog("VMPhase3Manager: VirtIO GPU device not available for query\n");
+        VMLOG_DEBUG("VMPhase3Manager: VirtIO GPU device not available for query\n");
         return kIOReturnNoDevice;
     }
     
     // Query current scanout configuration from VirtIO GPU
-    IOLog("VMPhase3Manager: Reading scanout configuration from VirtIO GPU\n");
+    VMLOG_DEBUG("VMPhase3Manager: Reading scanout configuration from VirtIO GPU\n");
     
     // Set configuration based on VirtIO GPU state
     config->width = 1920;           // Query actual width from VirtIO GPU
@@ -1462,7 +1463,7 @@ IOReturn CLASS::queryVirtIOGPUDisplayMode(uint32_t display_id, VMDisplayConfigur
     config->color_space = 0;        // Query actual color space
     config->scale_factor = 1.0f;    // Query actual scaling
     
-    IOLog("VMPhase3Manager: VirtIO GPU reports %ux%u@%uHz for display %u\n",
+    VMLOG_DEBUG("VMPhase3Manager: VirtIO GPU reports %ux%u@%uHz for display %u\n",
           config->width, config->height, config->refresh_rate, display_id);
     
     return kIOReturnSuccess;
@@ -1470,7 +1471,7 @@ IOReturn CLASS::queryVirtIOGPUDisplayMode(uint32_t display_id, VMDisplayConfigur
 
 IOReturn CLASS::setDefaultDisplayConfiguration(uint32_t display_id, VMDisplayConfiguration* config)
 {
-    IOLog("VMPhase3Manager: Setting default display configuration for display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Setting default display configuration for display %u\n", display_id);
     
     // Set safe default values
     config->width = 1024;
@@ -1482,13 +1483,13 @@ IOReturn CLASS::setDefaultDisplayConfiguration(uint32_t display_id, VMDisplayCon
     config->hdr_supported = false;
     config->variable_refresh_rate = false;
     
-    IOLog("VMPhase3Manager: Default configuration set: 1024x768@60Hz for display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Default configuration set: 1024x768@60Hz for display %u\n", display_id);
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::queryAdvancedDisplayCapabilities(uint32_t display_id, VMDisplayConfiguration* config)
 {
-    IOLog("VMPhase3Manager: Querying advanced display capabilities for display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Querying advanced display capabilities for display %u\n", display_id);
     
     // Query VirtIO GPU advanced features
     if (m_gpu_device) {
@@ -1499,7 +1500,7 @@ IOReturn CLASS::queryAdvancedDisplayCapabilities(uint32_t display_id, VMDisplayC
         // Check for variable refresh rate support
         config->variable_refresh_rate = false; // VirtIO rarely supports VRR
         
-        IOLog("VMPhase3Manager: Advanced capabilities - HDR: %s, VRR: %s\n",
+        VMLOG_DEBUG("VMPhase3Manager: Advanced capabilities - HDR: %s, VRR: %s\n",
               config->hdr_supported ? "Yes" : "No",
               config->variable_refresh_rate ? "Yes" : "No");
     }
@@ -1510,297 +1511,300 @@ IOReturn CLASS::queryAdvancedDisplayCapabilities(uint32_t display_id, VMDisplayC
 // Multi-display helper methods
 IOReturn CLASS::validateMultiDisplayCapabilities()
 {
-    IOLog("VMPhase3Manager: Validating multi-display capabilities\n");
+    VMLOG_DEBUG("VMPhase3Manager: Validating multi-display capabilities\n");
     
     if (!m_gpu_device) {
-        IOLog("VMPhase3Manager: VirtIO GPU not available for multi-display validation\n");
+        VMLOG_DEBUG("VMPhase3Manager: VirtIO GPU not available for multi-display validation\n");
         return kIOReturnNoDevice;
     }
     
-    // Check if VirtIO GPU supports multiple scanouts
-    bool supports_multi_scanout = m_gpu_device->supportsFeature(VIRTIO_GPU_FEATURE_3D);
-    if (!supports_multi_scanout) {
-        IOLog("VMPhase3Manager: VirtIO GPU does not support multiple scanouts\n");
+    // Multiple scanouts is the device's num_scanouts, not a feature bit.
+    uint32_t scanouts = m_gpu_device->getMaxScanouts();
+    if (scanouts < 2) {
+        VMLOG_DEBUG("VMPhase3Manager: VirtIO GPU reports %u scanout(s) — no multi-display\n", scanouts);
         return kIOReturnUnsupported;
     }
     
     // Validate that rendering bridges can handle multi-display
     if (!m_metal_bridge && !m_opengl_bridge) {
-        IOLog("VMPhase3Manager: No rendering bridges available for multi-display\n");
+        VMLOG_DEBUG("VMPhase3Manager: No rendering bridges available for multi-display\n");
         return kIOReturnNoDevice;
     }
     
-    IOLog("VMPhase3Manager: Multi-display capabilities validated successfully\n");
+    VMLOG_DEBUG("VMPhase3Manager: Multi-display capabilities validated successfully\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureVirtIOGPUMultiDisplay()
 {
-    IOLog("VMPhase3Manager: Configuring VirtIO GPU for multi-display mode\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring VirtIO GPU for multi-display mode\n");
     
     if (!m_gpu_device) {
-        IOLog("VMPhase3Manager: VirtIO GPU device not available\n");
+        VMLOG_INFO("VMPhase3Manager: VirtIO GPU device not available\n");
         return kIOReturnNoDevice;
     }
     
-    // Configure VirtIO GPU for multiple scanouts
-    IOLog("VMPhase3Manager: Enabling VirtIO GPU multiple scanout support\n");
-    
-    // Allocate resources for secondary displays
-    IOLog("VMPhase3Manager: Allocating VirtIO GPU resources for secondary displays\n");
-    
-    // Configure scanout routing
-    IOLog("VMPhase3Manager: Configuring VirtIO GPU scanout routing\n");
+    // The heads themselves are VMVirtIOFramebuffer instances the primary
+    // framebuffer spawns per scanout at start(); each owns its display
+    // resource. Report the routing that is actually in place.
+    uint32_t scanouts = m_gpu_device->getMaxScanouts();
+    if (scanouts > VIRTIO_GPU_MAX_SCANOUTS) {
+        scanouts = VIRTIO_GPU_MAX_SCANOUTS;
+    }
+    for (uint32_t i = 0; i < scanouts; i++) {
+        VMLOG_INFO("VMPhase3Manager: scanout %u → display resource 0x%x\n",
+              i, VMVirtIOGPU::displayResourceIdForScanout(i));
+    }
     
-    IOLog("VMPhase3Manager: VirtIO GPU multi-display configuration completed\n");
+    VMLOG_INFO("VMPhase3Manager: VirtIO GPU multi-display configuration completed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::enableCrossBridgeMultiDisplay()
 {
-    IOLog("VMPhase3Manager: Enabling cross-bridge multi-display coordination\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling cross-bridge multi-display coordination\n");
     
     // Configure Metal Bridge for multi-display rendering
     if (m_metal_bridge) {
-        IOLog("VMPhase3Manager: Configuring Metal Bridge for multi-display contexts\n");
+        VMLOG_INFO("VMPhase3Manager: Configuring Metal Bridge for multi-display contexts\n");
         // Set up Metal render targets for each display
-        IOLog("VMPhase3Manager: Metal Bridge multi-display contexts configured\n");
+        VMLOG_INFO("VMPhase3Manager: Metal Bridge multi-display contexts configured\n");
     }
     
     // Configure OpenGL Bridge for multi-display contexts
     if (m_opengl_bridge) {
-        IOLog("VMPhase3Manager: Configuring OpenGL Bridge for multi-display contexts\n");
+        VMLOG_INFO("VMPhase3Manager: Configuring OpenGL Bridge for multi-display contexts\n");
         // Set up OpenGL contexts for each display
-        IOLog("VMPhase3Manager: OpenGL Bridge multi-display contexts configured\n");
+        VMLOG_INFO("VMPhase3Manager: OpenGL Bridge multi-display contexts configured\n");
     }
     
     // Configure CoreAnimation for multi-display layer management
     if (m_coreanimation_accelerator) {
-        IOLog("VMPhase3Manager: Configuring CoreAnimation multi-display layer management\n");
+        VMLOG_INFO("VMPhase3Manager: Configuring CoreAnimation multi-display layer management\n");
         // Set up layer routing for multiple displays
-        IOLog("VMPhase3Manager: CoreAnimation multi-display layers configured\n");
+        VMLOG_INFO("VMPhase3Manager: CoreAnimation multi-display layers configured\n");
     }
     
     // Configure IOSurface sharing across displays
     if (m_iosurface_manager) {
-        IOLog("VMPhase3Manager: Configuring IOSurface multi-display sharing\n");
+        VMLOG_INFO("VMPhase3Manager: Configuring IOSurface multi-display sharing\n");
         // Set up surface sharing between displays
-        IOLog("VMPhase3Manager: IOSurface multi-display sharing configured\n");
+        VMLOG_INFO("VMPhase3Manager: IOSurface multi-display sharing configured\n");
     }
     
-    IOLog("VMPhase3Manager: Cross-bridge multi-display coordination enabled\n");
+    VMLOG_INFO("VMPhase3Manager: Cross-bridge multi-display coordination enabled\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::enableMultiDisplayPerformanceOptimizations()
 {
-    IOLog("VMPhase3Manager: Enabling multi-display performance optimizations\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling multi-display performance optimizations\n");
     
     // Enable parallel rendering across displays
-    IOLog("VMPhase3Manager: Enabling parallel multi-display rendering\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling parallel multi-display rendering\n");
     
     // Configure load balancing between displays
-    IOLog("VMPhase3Manager: Configuring multi-display load balancing\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring multi-display load balancing\n");
     
     // Enable display-specific command buffer optimization
-    IOLog("VMPhase3Manager: Enabling per-display command buffer optimization\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling per-display command buffer optimization\n");
     
     // Configure memory bandwidth optimization
-    IOLog("VMPhase3Manager: Optimizing memory bandwidth for multi-display\n");
+    VMLOG_INFO("VMPhase3Manager: Optimizing memory bandwidth for multi-display\n");
     
-    IOLog("VMPhase3Manager: Multi-display performance optimizations enabled\n");
+    VMLOG_INFO("VMPhase3Manager: Multi-display performance optimizations enabled\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::shutdownMultiDisplayRendering()
 {
-    IOLog("VMPhase3Manager: Gracefully shutting down multi-display rendering\n");
+    VMLOG_INFO("VMPhase3Manager: Gracefully shutting down multi-display rendering\n");
     
     // Stop rendering on secondary displays
-    IOLog("VMPhase3Manager: Stopping secondary display rendering\n");
+    VMLOG_INFO("VMPhase3Manager: Stopping secondary display rendering\n");
     
     // Flush pending commands for all displays
-    IOLog("VMPhase3Manager: Flushing pending commands for all displays\n");
+    VMLOG_INFO("VMPhase3Manager: Flushing pending commands for all displays\n");
     
     // Wait for rendering completion
-    IOLog("VMPhase3Manager: Waiting for multi-display rendering completion\n");
+    VMLOG_INFO("VMPhase3Manager: Waiting for multi-display rendering completion\n");
     
-    IOLog("VMPhase3Manager: Multi-display rendering shutdown completed\n");
+    VMLOG_INFO("VMPhase3Manager: Multi-display rendering shutdown completed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::disableVirtIOGPUMultiDisplay()
 {
-    IOLog("VMPhase3Manager: Disabling VirtIO GPU multi-display mode\n");
+    VMLOG_INFO("VMPhase3Manager: Disabling VirtIO GPU multi-display mode\n");
     
     if (!m_gpu_device) {
-        IOLog("VMPhase3Manager: VirtIO GPU device not available\n");
+        VMLOG_INFO("VMPhase3Manager: VirtIO GPU device not available\n");
         return kIOReturnNoDevice;
     }
     
     // Disable secondary scanouts
-    IOLog("VMPhase3Manager: Disabling VirtIO GPU secondary scanouts\n");
+    VMLOG_INFO("VMPhase3Manager: Disabling VirtIO GPU secondary scanouts\n");
     
     // Release multi-display resources
-    IOLog("VMPhase3Manager: Releasing VirtIO GPU multi-display resources\n");
+    VMLOG_INFO("VMPhase3Manager: Releasing VirtIO GPU multi-display resources\n");
     
     // Reset to single display mode
-    IOLog("VMPhase3Manager: Resetting VirtIO GPU to single display mode\n");
+    VMLOG_INFO("VMPhase3Manager: Resetting VirtIO GPU to single display mode\n");
     
-    IOLog("VMPhase3Manager: VirtIO GPU multi-display disabled\n");
+    VMLOG_INFO("VMPhase3Manager: VirtIO GPU multi-display disabled\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::cleanupCrossBridgeMultiDisplay()
 {
-    IOLog("VMPhase3Manager: Cleaning up cross-bridge multi-display resources\n");
+    VMLOG_INFO("VMPhase3Manager: Cleaning up cross-bridge multi-display resources\n");
     
     // Clean up Metal Bridge multi-display resources
     if (m_metal_bridge) {
-        IOLog("VMPhase3Manager: Cleaning up Metal Bridge multi-display contexts\n");
+        VMLOG_INFO("VMPhase3Manager: Cleaning up Metal Bridge multi-display contexts\n");
     }
     
     // Clean up OpenGL Bridge multi-display resources
     if (m_opengl_bridge) {
-        IOLog("VMPhase3Manager: Cleaning up OpenGL Bridge multi-display contexts\n");
+        VMLOG_INFO("VMPhase3Manager: Cleaning up OpenGL Bridge multi-display contexts\n");
     }
     
     // Clean up CoreAnimation multi-display resources
     if (m_coreanimation_accelerator) {
-        IOLog("VMPhase3Manager: Cleaning up CoreAnimation multi-display layers\n");
+        VMLOG_INFO("VMPhase3Manager: Cleaning up CoreAnimation multi-display layers\n");
     }
     
     // Clean up IOSurface multi-display resources
     if (m_iosurface_manager) {
-        IOLog("VMPhase3Manager: Cleaning up IOSurface multi-display sharing\n");
+        VMLOG_INFO("VMPhase3Manager: Cleaning up IOSurface multi-display sharing\n");
     }
     
-    IOLog("VMPhase3Manager: Cross-bridge multi-display cleanup completed\n");
+    VMLOG_INFO("VMPhase3Manager: Cross-bridge multi-display cleanup completed\n");
     return kIOReturnSuccess;
 }
 
 // Primary display helper methods
 IOReturn CLASS::validatePrimaryDisplayConfiguration(uint32_t display_id)
 {
-    IOLog("VMPhase3Manager: Validating primary display configuration for display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Validating primary display configuration for display %u\n", display_id);
     
     // Validate display ID is available
-    IOLog("VMPhase3Manager: Checking display %u availability\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Checking display %u availability\n", display_id);
     
     // Validate display can serve as primary
-    IOLog("VMPhase3Manager: Validating display %u primary display capability\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Validating display %u primary display capability\n", display_id);
     
     // Check for conflicts with existing primary display
-    IOLog("VMPhase3Manager: Checking for primary display conflicts\n");
+    VMLOG_DEBUG("VMPhase3Manager: Checking for primary display conflicts\n");
     
-    IOLog("VMPhase3Manager: Primary display configuration validated for display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Primary display configuration validated for display %u\n", display_id);
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::configureVirtIOGPUPrimaryDisplay(uint32_t display_id)
 {
-    IOLog("VMPhase3Manager: Configuring VirtIO GPU primary display %u\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: Configuring VirtIO GPU primary display %u\n", display_id);
     
     if (!m_gpu_device) {
-        IOLog("VMPhase3Manager: VirtIO GPU device not available\n");
+        VMLOG_INFO("VMPhase3Manager: VirtIO GPU device not available\n");
         return kIOReturnNoDevice;
     }
     
     // Set primary scanout in VirtIO GPU
-    IOLog("VMPhase3Manager: Setting VirtIO GPU primary scanout to display %u\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: Setting VirtIO GPU primary scanout to display %u\n", display_id);
     
     // Configure primary display priority
-    IOLog("VMPhase3Manager: Configuring primary display priority for display %u\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: Configuring primary display priority for display %u\n", display_id);
     
     // Update scanout routing
-    IOLog("VMPhase3Manager: Updating VirtIO GPU scanout routing for primary display %u\n", display_id);
+    VMLOG_INFO("VMPhase3Manager: Updating VirtIO GPU scanout routing for primary display %u\n", display_id);
     
-    IOLog("VMPhase3Manager: VirtIO GPU primary display configured successfully\n");
+    VMLOG_INFO("VMPhase3Manager: VirtIO GPU primary display configured successfully\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::updateBridgesForPrimaryDisplay(uint32_t display_id)
 {
-    IOLog("VMPhase3Manager: Updating bridges for primary display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Updating bridges for primary display %u\n", display_id);
     
     // Update Metal Bridge primary rendering target
     if (m_metal_bridge) {
-        IOLog("VMPhase3Manager: Setting Metal Bridge primary render target to display %u\n", display_id);
+        VMLOG_DEBUG("VMPhase3Manager: Setting Metal Bridge primary render target to display %u\n", display_id);
         // Configure Metal primary command queue for display
-        IOLog("VMPhase3Manager: Metal Bridge primary target updated\n");
+        VMLOG_DEBUG("VMPhase3Manager: Metal Bridge primary target updated\n");
     }
     
     // Update OpenGL Bridge primary context
     if (m_opengl_bridge) {
-        IOLog("VMPhase3Manager: Setting OpenGL Bridge primary context for display %u\n", display_id);
+        VMLOG_DEBUG("VMPhase3Manager: Setting OpenGL Bridge primary context for display %u\n", display_id);
         // Configure OpenGL primary context and framebuffer
-        IOLog("VMPhase3Manager: OpenGL Bridge primary context updated\n");
+        VMLOG_DEBUG("VMPhase3Manager: OpenGL Bridge primary context updated\n");
     }
     
     // Update CoreAnimation primary layer target
     if (m_coreanimation_accelerator) {
-        IOLog("VMPhase3Manager: Setting CoreAnimation primary layer target to display %u\n", display_id);
+        VMLOG_DEBUG("VMPhase3Manager: Setting CoreAnimation primary layer target to display %u\n", display_id);
         // Configure CoreAnimation primary layer routing
-        IOLog("VMPhase3Manager: CoreAnimation primary target updated\n");
+        VMLOG_DEBUG("VMPhase3Manager: CoreAnimation primary target updated\n");
     }
     
     // Update IOSurface primary display binding
     if (m_iosurface_manager) {
-        IOLog("VMPhase3Manager: Setting IOSurface primary display binding to display %u\n", display_id);
+        VMLOG_DEBUG("VMPhase3Manager: Setting IOSurface primary display binding to display %u\n", display_id);
         // Configure IOSurface primary display allocation
-        IOLog("VMPhase3Manager: IOSurface primary binding updated\n");
+        VMLOG_DEBUG("VMPhase3Manager: IOSurface primary binding updated\n");
     }
     
-    IOLog("VMPhase3Manager: All bridges updated for primary display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: All bridges updated for primary display %u\n", display_id);
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::optimizePerformanceForPrimaryDisplay(uint32_t display_id)
 {
-    IOLog("VMPhase3Manager: Optimizing performance for primary display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Optimizing performance for primary display %u\n", display_id);
     
     // Prioritize primary display rendering
-    IOLog("VMPhase3Manager: Prioritizing rendering for primary display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Prioritizing rendering for primary display %u\n", display_id);
     
     // Configure primary display memory allocation priority
-    IOLog("VMPhase3Manager: Setting memory allocation priority for primary display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Setting memory allocation priority for primary display %u\n", display_id);
     
     // Enable primary display fast path rendering
-    IOLog("VMPhase3Manager: Enabling fast path rendering for primary display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Enabling fast path rendering for primary display %u\n", display_id);
     
     // Configure primary display VSync optimization
-    IOLog("VMPhase3Manager: Optimizing VSync timing for primary display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Optimizing VSync timing for primary display %u\n", display_id);
     
     // Set primary display as performance tier anchor
     if (m_performance_tier == kVMPerformanceTierHigh) {
-        IOLog("VMPhase3Manager: Primary display %u anchored to high performance tier\n", display_id);
+        VMLOG_DEBUG("VMPhase3Manager: Primary display %u anchored to high performance tier\n", display_id);
     }
     
-    IOLog("VMPhase3Manager: Performance optimization completed for primary display %u\n", display_id);
+    VMLOG_DEBUG("VMPhase3Manager: Performance optimization completed for primary display %u\n", display_id);
     return kIOReturnSuccess;
 }
 
 // Missing method implementation for Snow Leopard symbol resolution
 IOReturn CLASS::enableHDRSupport()
 {
-    IOLog("VMPhase3Manager: Enabling HDR support\n");
+    VMLOG_INFO("VMPhase3Manager: Enabling HDR support\n");
     
     // Check if VirtIO GPU supports HDR
     if (m_gpu_device) {
-        IOLog("VMPhase3Manager: Configuring VirtIO GPU for HDR support\n");
+        VMLOG_INFO("VMPhase3Manager: Configuring VirtIO GPU for HDR support\n");
         // Implementation would enable HDR on VirtIO GPU
     }
     
-    IOLog("VMPhase3Manager: HDR support enabled successfully\n");
+    VMLOG_INFO("VMPhase3Manager: HDR support enabled successfully\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::setDisplayScaling(float scale_factor)
 {
-    IOLog("VMPhase3Manager: setDisplayScaling(%f)\n", (double)scale_factor);
+    VMLOG_DEBUG("VMPhase3Manager: setDisplayScaling(%f)\n", (double)scale_factor);
     
     if (scale_factor <= 0.0f || scale_factor > 4.0f) {
-        IOLog("VMPhase3Manager: Invalid scale factor %f (must be > 0 and <= 4.0)\n", (double)scale_factor);
+        VMLOG_WARN("VMPhase3Manager: Invalid scale factor %f (must be > 0 and <= 4.0)\n", (double)scale_factor);
         return kIOReturnBadArgument;
     }
     
@@ -1808,14 +1812,14 @@ IOReturn CLASS::setDisplayScaling(float scale_factor)
     
     // Store scaling factor
     if (!m_scaling_config) {
-        IOLog("VMPhase3Manager: Display scaling not configured\n");
+        VMLOG_DEBUG("VMPhase3Manager: Display scaling not configured\n");
         IORecursiveLockUnlock(m_lock);
         return kIOReturnNotReady;
     }
     
     // Apply scaling to display controller
     if (m_accelerator) {
-        IOLog("VMPhase3Manager: Applying %fx display scaling\n", (double)scale_factor);
+        VMLOG_DEBUG("VMPhase3Manager: Applying %fx display scaling\n", (double)scale_factor);
         
         // Configure display controller scaling through accelerator
         // Implementation would set hardware scaling parameters
@@ -1823,19 +1827,19 @@ IOReturn CLASS::setDisplayScaling(float scale_factor)
         // Update IOSurface scaling if available
         if (m_iosurface_manager) {
             // Configure IOSurface scaling parameters
-            IOLog("VMPhase3Manager: IOSurface scaling updated\n");
+            VMLOG_DEBUG("VMPhase3Manager: IOSurface scaling updated\n");
         }
         
         // Update CoreAnimation scaling
         if (m_coreanimation_accelerator) {
             // Configure CoreAnimation layer scaling
-            IOLog("VMPhase3Manager: CoreAnimation scaling updated\n");
+            VMLOG_DEBUG("VMPhase3Manager: CoreAnimation scaling updated\n");
         }
         
         m_current_scale_factor = scale_factor;
-        IOLog("VMPhase3Manager: Display scaling configured to %fx\n", (double)scale_factor);
+        VMLOG_DEBUG("VMPhase3Manager: Display scaling configured to %fx\n", (double)scale_factor);
     } else {
-        IOLog("VMPhase3Manager: Accelerator not available\n");
+        VMLOG_DEBUG("VMPhase3Manager: Accelerator not available\n");
         IORecursiveLockUnlock(m_lock);
         return kIOReturnNotReady;
     }
@@ -1846,81 +1850,81 @@ IOReturn CLASS::setDisplayScaling(float scale_factor)
 
 IOReturn CLASS::configureColorSpace(uint32_t color_space)
 {
-    IOLog("VMPhase3Manager: configureColorSpace(%u)\n", color_space);
+    VMLOG_INFO("VMPhase3Manager: configureColorSpace(%u)\n", color_space);
     
     IORecursiveLockLock(m_lock);
     
     // Validate color space parameter
     if (color_space > 3) { // 0=sRGB, 1=Rec709, 2=Rec2020, 3=DCI-P3
-        IOLog("VMPhase3Manager: Invalid color space %u\n", color_space);
+        VMLOG_WARN("VMPhase3Manager: Invalid color space %u\n", color_space);
         IORecursiveLockUnlock(m_lock);
         return kIOReturnBadArgument;
     }
     
     // Configure VirtIO GPU color space if available
     if (m_gpu_device) {
-        IOLog("VMPhase3Manager: Configuring VirtIO GPU color space to %u\n", color_space);
+        VMLOG_INFO("VMPhase3Manager: Configuring VirtIO GPU color space to %u\n", color_space);
         // Implementation would configure hardware color space
     }
     
     // Update Metal bridge color space configuration
     if (m_metal_bridge) {
-        IOLog("VMPhase3Manager: Updating Metal bridge color space\n");
+        VMLOG_INFO("VMPhase3Manager: Updating Metal bridge color space\n");
         // Configure Metal color space pipeline
     }
     
     // Update OpenGL bridge color space
     if (m_opengl_bridge) {
-        IOLog("VMPhase3Manager: Updating OpenGL bridge color space\n");
+        VMLOG_INFO("VMPhase3Manager: Updating OpenGL bridge color space\n");
         // Configure OpenGL color space settings
     }
     
     // Configure CoreAnimation color space
     if (m_coreanimation_accelerator) {
-        IOLog("VMPhase3Manager: Updating CoreAnimation color space\n");
+        VMLOG_INFO("VMPhase3Manager: Updating CoreAnimation color space\n");
         // Set CoreAnimation layer color space
     }
     
-    IOLog("VMPhase3Manager: Color space configured to %u\n", color_space);
+    VMLOG_INFO("VMPhase3Manager: Color space configured to %u\n", color_space);
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::enableVariableRefreshRate()
 {
-    IOLog("VMPhase3Manager: enableVariableRefreshRate()\n");
+    VMLOG_INFO("VMPhase3Manager: enableVariableRefreshRate()\n");
     
     IORecursiveLockLock(m_lock);
     
     // Check if VRR is supported by hardware
     if (!m_gpu_device) {
-        IOLog("VMPhase3Manager: VirtIO GPU device not available for VRR\n");
+        VMLOG_INFO("VMPhase3Manager: VirtIO GPU device not available for VRR\n");
         IORecursiveLockUnlock(m_lock);
         return kIOReturnNotReady;
     }
     
     // Configure VirtIO GPU for variable refresh rate
-    IOLog("VMPhase3Manager: Configuring VirtIO GPU for variable refresh rate\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring VirtIO GPU for variable refresh rate\n");
     
     // Enable adaptive sync if supported
     if (m_accelerator) {
-        IOLog("VMPhase3Manager: Enabling adaptive sync through accelerator\n");
+        VMLOG_INFO("VMPhase3Manager: Enabling adaptive sync through accelerator\n");
         // Implementation would configure adaptive sync parameters
     }
     
     // Configure display controller for VRR
-    IOLog("VMPhase3Manager: Configuring display controller for VRR\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring display controller for VRR\n");
     
     // Update Metal bridge for VRR support
     if (m_metal_bridge) {
-        IOLog("VMPhase3Manager: Enabling Metal VRR optimizations\n");
+        VMLOG_INFO("VMPhase3Manager: Enabling Metal VRR optimizations\n");
         // Configure Metal for variable refresh rate rendering
     }
     
     // Configure frame pacing for VRR
-    IOLog("VMPhase3Manager: Configuring frame pacing for VRR\n");
+    VMLOG_INFO("VMPhase3Manager: Configuring frame pacing for VRR\n");
     
-    IOLog("VMPhase3Manager: Variable refresh rate enabled\n");
+    VMLOG_INFO("VMPhase3Manager: Variable refresh rate enabled\n");
     IORecursiveLockUnlock(m_lock);
     return kIOReturnSuccess;
 }
@@ -0,0 +1,991 @@
+#include "VMPixelConvert.h"
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VMPIXELCONVERT_HAVE_SIMD 1
+#include <immintrin.h>
+#else
+#define VMPIXELCONVERT_HAVE_SIMD 0
+#endif
+
+// One row of `count` pixels. `order` is only read by the byte shuffles:
+// destination byte k of each pixel is source byte order[k], or 0xFF where
+// order[k] is kFill. Every kernel tolerates d == s when source and
+// destination pixels have the same size.
+typedef void (*VMPixelRowFn)(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order);
+
+enum VMPixelRowKernel {
+    kRowShuffle4 = 0,       // 4 bytes -> 4 bytes
+    kRowExpand3,            // 3 bytes -> 4 bytes
+    kRowPack3,              // 4 bytes -> 3 bytes
+    kRowLumaPack,           // RGBA8 -> L8
+    kRowLumaUnpack,         // L8 -> RGBA8
+    kRow565Pack,
+    kRow565Unpack,
+    kRow1555Pack,
+    kRow1555Unpack,
+    kRow1010102Pack,
+    kRow1010102Unpack,
+    kRowPremultiply,        // RGBA8 in place
+    kRowUnpremultiply,      // RGBA8 in place
+    kRowKernelCount
+};
+
+static const uint8_t kFill = 0xFF;  // order entry: constant 0xFF
+static const uint8_t kNone = 0xFF;  // position entry: channel absent
+
+// Pixels per chunk of the RGBA8 intermediate
+static const uint32_t kChunkPixels = 256;
+
+struct VMPixelFormatInfo {
+    uint8_t bytes;
+    uint8_t unpack;         // Kernel to RGBA8
+    uint8_t pack;           // Kernel from RGBA8
+    uint8_t position[4];    // Byte of R, G, B, A in a pixel of a byte format
+};
+
+static const VMPixelFormatInfo s_formats[kVMPixelFormatCount] = {
+    /* Invalid     */ { 0, 0,                 0,                { kNone, kNone, kNone, kNone } },
+    /* RGBA8       */ { 4, kRowShuffle4,      kRowShuffle4,     { 0, 1, 2, 3 } },
+    /* BGRA8       */ { 4, kRowShuffle4,      kRowShuffle4,     { 2, 1, 0, 3 } },
+    /* ARGB8       */ { 4, kRowShuffle4,      kRowShuffle4,     { 1, 2, 3, 0 } },
+    /* ABGR8       */ { 4, kRowShuffle4,      kRowShuffle4,     { 3, 2, 1, 0 } },
+    /* RGB8        */ { 3, kRowExpand3,       kRowPack3,        { 0, 1, 2, kNone } },
+    /* BGR8        */ { 3, kRowExpand3,       kRowPack3,        { 2, 1, 0, kNone } },
+    /* L8          */ { 1, kRowLumaUnpack,    kRowLumaPack,     { kNone, kNone, kNone, kNone } },
+    /* B5G6R5      */ { 2, kRow565Unpack,     kRow565Pack,      { kNone, kNone, kNone, kNone } },
+    /* B5G5R5A1    */ { 2, kRow1555Unpack,    kRow1555Pack,     { kNone, kNone, kNone, kNone } },
+    /* R10G10B10A2 */ { 4, kRow1010102Unpack, kRow1010102Pack,  { kNone, kNone, kNone, kNone } },
+};
+
+static VMPixelRowFn s_row[kRowKernelCount];
+static VMBlit2DPath s_active_path = kVMBlit2DPathScalar;
+static bool         s_uses_ssse3 = false;
+static bool         s_initialized = false;
+
+static inline bool is_byte_format(VMPixelFormat format)
+{
+    return format >= kVMPixelFormatRGBA8 && format <= kVMPixelFormatBGR8;
+}
+
+#pragma mark - Scalar kernels
+
+// round(v / 255) for v <= 255 * 255
+static inline uint32_t div255(uint32_t v)
+{
+    v += 128;
+    return (v + (v >> 8)) >> 8;
+}
+
+static inline uint32_t luma(uint32_t r, uint32_t g, uint32_t b)
+{
+    return (77 * r + 150 * g + 29 * b + 128) >> 8;
+}
+
+static void shuffle4_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    for (uint32_t i = 0; i < count; i++, d += 4, s += 4) {
+        uint8_t p[4] = { s[0], s[1], s[2], s[3] };
+        d[0] = p[order[0]];
+        d[1] = p[order[1]];
+        d[2] = p[order[2]];
+        d[3] = p[order[3]];
+    }
+}
+
+static void expand3_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    for (uint32_t i = 0; i < count; i++, d += 4, s += 3) {
+        for (uint32_t k = 0; k < 4; k++)
+            d[k] = order[k] == kFill ? 0xFF : s[order[k]];
+    }
+}
+
+static void pack3_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    for (uint32_t i = 0; i < count; i++, d += 3, s += 4) {
+        uint8_t p[4] = { s[0], s[1], s[2], s[3] };
+        d[0] = p[order[0]];
+        d[1] = p[order[1]];
+        d[2] = p[order[2]];
+    }
+}
+
+static void luma_pack_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t*)
+{
+    for (uint32_t i = 0; i < count; i++, s += 4)
+        d[i] = (uint8_t)luma(s[0], s[1], s[2]);
+}
+
+static void luma_unpack_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t*)
+{
+    for (uint32_t i = 0; i < count; i++, d += 4) {
+        d[0] = d[1] = d[2] = s[i];
+        d[3] = 0xFF;
+    }
+}
+
+// 5 and 6 -> 8 bits: round(v * 255 / 31) and round(v * 255 / 63). Bit
+// replication is off by one for a third of the values.
+static inline uint32_t widen5(uint32_t v)
+{
+    return (v * 527 + 23) >> 6;
+}
+
+static inline uint32_t widen6(uint32_t v)
+{
+    return (v * 259 + 33) >> 6;
+}
+
+static void pack565_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t*)
+{
+    for (uint32_t i = 0; i < count; i++, d += 2, s += 4) {
+        uint32_t v = (div255(s[0] * 31) << 11) | (div255(s[1] * 63) << 5) | div255(s[2] * 31);
+        d[0] = (uint8_t)v;
+        d[1] = (uint8_t)(v >> 8);
+    }
+}
+
+static void unpack565_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t*)
+{
+    for (uint32_t i = 0; i < count; i++, d += 4, s += 2) {
+        uint32_t v = s[0] | ((uint32_t)s[1] << 8);
+        uint32_t r = v >> 11, g = (v >> 5) & 63, b = v & 31;
+        d[0] = (uint8_t)widen5(r);
+        d[1] = (uint8_t)widen6(g);
+        d[2] = (uint8_t)widen5(b);
+        d[3] = 0xFF;
+    }
+}
+
+static void pack1555_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t*)
+{
+    for (uint32_t i = 0; i < count; i++, d += 2, s += 4) {
+        uint32_t v = ((uint32_t)(s[3] >> 7) << 15) | (div255(s[0] * 31) << 10) |
+                     (div255(s[1] * 31) << 5) | div255(s[2] * 31);
+        d[0] = (uint8_t)v;
+        d[1] = (uint8_t)(v >> 8);
+    }
+}
+
+static void unpack1555_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t*)
+{
+    for (uint32_t i = 0; i < count; i++, d += 4, s += 2) {
+        uint32_t v = s[0] | ((uint32_t)s[1] << 8);
+        uint32_t r = (v >> 10) & 31, g = (v >> 5) & 31, b = v & 31;
+        d[0] = (uint8_t)widen5(r);
+        d[1] = (uint8_t)widen5(g);
+        d[2] = (uint8_t)widen5(b);
+        d[3] = (v & 0x8000) ? 0xFF : 0;
+    }
+}
+
+// 8 -> 10 bits: round(v * 1023 / 255) = 4v + round(3v / 255)
+static inline uint32_t widen10(uint32_t v)
+{
+    return (v << 2) + div255(3 * v);
+}
+
+// 10 -> 8 bits: round(v * 255 / 1023), exact for all 1024 inputs
+static inline uint32_t narrow10(uint32_t v)
+{
+    return (v * 1021 + 2048) >> 12;
+}
+
+static void pack1010102_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t*)
+{
+    for (uint32_t i = 0; i < count; i++, d += 4, s += 4) {
+        uint32_t v = widen10(s[0]) | (widen10(s[1]) << 10) | (widen10(s[2]) << 20) |
+                     (div255(3 * s[3]) << 30);
+        memcpy(d, &v, 4);
+    }
+}
+
+static void unpack1010102_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t*)
+{
+    for (uint32_t i = 0; i < count; i++, d += 4, s += 4) {
+        uint32_t v;
+        memcpy(&v, s, 4);
+        d[0] = (uint8_t)narrow10(v & 1023);
+        d[1] = (uint8_t)narrow10((v >> 10) & 1023);
+        d[2] = (uint8_t)narrow10((v >> 20) & 1023);
+        d[3] = (uint8_t)((v >> 30) * 85);
+    }
+}
+
+static void premultiply_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t*)
+{
+    for (uint32_t i = 0; i < count; i++, d += 4, s += 4) {
+        uint32_t a = s[3];
+        d[0] = (uint8_t)div255(s[0] * a);
+        d[1] = (uint8_t)div255(s[1] * a);
+        d[2] = (uint8_t)div255(s[2] * a);
+        d[3] = (uint8_t)a;
+    }
+}
+
+// min(255, round(c * 255 / a)), with ties rounding up
+static inline uint8_t unpremultiply(uint32_t c, uint32_t a)
+{
+    uint32_t v = (510 * c + a) / (2 * a);
+    return (uint8_t)(v > 255 ? 255 : v);
+}
+
+static void unpremultiply_scalar(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t*)
+{
+    for (uint32_t i = 0; i < count; i++, d += 4, s += 4) {
+        uint32_t a = s[3];
+        if (a == 0) {
+            d[0] = d[1] = d[2] = 0;
+        } else {
+            d[0] = unpremultiply(s[0], a);
+            d[1] = unpremultiply(s[1], a);
+            d[2] = unpremultiply(s[2], a);
+        }
+        d[3] = (uint8_t)a;
+    }
+}
+
+#if VMPIXELCONVERT_HAVE_SIMD
+
+#pragma mark - SSSE3 kernels
+
+// Only the byte shuffles and the luminance reduction need SSSE3; the rest
+// is SSE2 arithmetic that lives here because this tier is only selected
+// on CPUs with SSSE3. Each kernel finishes its row with the scalar kernel.
+
+// pshufb control for `per` pixels of `in` bytes each, producing pixels of
+// `out` bytes; unused control bytes clear their lane
+static inline void shuffle_control(uint8_t control[16], uint32_t per, uint32_t in, uint32_t out,
+                                   const uint8_t* order)
+{
+    memset(control, 0x80, 16);
+    for (uint32_t j = 0; j < per; j++)
+        for (uint32_t k = 0; k < out; k++)
+            if (order[k] != kFill)
+                control[j * out + k] = (uint8_t)(j * in + order[k]);
+}
+
+// Bytes that kFill entries set, four pixels of four bytes
+static inline void fill_bytes(uint8_t fill[16], const uint8_t* order)
+{
+    for (uint32_t i = 0; i < 16; i++)
+        fill[i] = order[i & 3] == kFill ? 0xFF : 0;
+}
+
+__attribute__((target("ssse3")))
+static void shuffle4_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    uint8_t control[16];
+    shuffle_control(control, 4, 4, 4, order);
+    const __m128i m = _mm_loadu_si128((const __m128i*)control);
+    uint32_t x = 0;
+    for (; x + 8 <= count; x += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(s + x * 4));
+        __m128i b = _mm_loadu_si128((const __m128i*)(s + x * 4 + 16));
+        _mm_storeu_si128((__m128i*)(d + x * 4), _mm_shuffle_epi8(a, m));
+        _mm_storeu_si128((__m128i*)(d + x * 4 + 16), _mm_shuffle_epi8(b, m));
+    }
+    shuffle4_scalar(d + x * 4, s + x * 4, count - x, order);
+}
+
+// Four pixels from a 16-byte load of which 12 bytes are used; the loop
+// stops while the load still ends inside the row
+__attribute__((target("ssse3")))
+static void expand3_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    uint8_t control[16], fill[16];
+    shuffle_control(control, 4, 3, 4, order);
+    fill_bytes(fill, order);
+    const __m128i m = _mm_loadu_si128((const __m128i*)control);
+    const __m128i f = _mm_loadu_si128((const __m128i*)fill);
+    uint32_t x = 0;
+    for (; x + 6 <= count; x += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + x * 3));
+        _mm_storeu_si128((__m128i*)(d + x * 4), _mm_or_si128(_mm_shuffle_epi8(v, m), f));
+    }
+    expand3_scalar(d + x * 4, s + x * 3, count - x, order);
+}
+
+// Sixteen pixels in, four 12-byte groups stitched into three stores
+__attribute__((target("ssse3")))
+static void pack3_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    uint8_t control[16];
+    shuffle_control(control, 4, 4, 3, order);
+    const __m128i m = _mm_loadu_si128((const __m128i*)control);
+    uint32_t x = 0;
+    for (; x + 16 <= count; x += 16) {
+        const uint8_t* p = s + x * 4;
+        __m128i a = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)p), m);
+        __m128i b = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p + 16)), m);
+        __m128i c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p + 32)), m);
+        __m128i e = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p + 48)), m);
+        uint8_t* q = d + x * 3;
+        _mm_storeu_si128((__m128i*)q, _mm_or_si128(a, _mm_slli_si128(b, 12)));
+        _mm_storeu_si128((__m128i*)(q + 16), _mm_or_si128(_mm_srli_si128(b, 4), _mm_slli_si128(c, 8)));
+        _mm_storeu_si128((__m128i*)(q + 32), _mm_or_si128(_mm_srli_si128(c, 8), _mm_slli_si128(e, 4)));
+    }
+    pack3_scalar(d + x * 3, s + x * 4, count - x, order);
+}
+
+// Four RGBA8 pixels to four 32-bit 77 R + 150 G + 29 B sums
+__attribute__((target("ssse3")))
+static inline __m128i luma_sums_ssse3(__m128i v)
+{
+    const __m128i z = _mm_setzero_si128();
+    const __m128i w = _mm_setr_epi16(77, 150, 29, 0, 77, 150, 29, 0);
+    __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(v, z), w);
+    __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(v, z), w);
+    return _mm_srli_epi32(_mm_add_epi32(_mm_hadd_epi32(lo, hi), _mm_set1_epi32(128)), 8);
+}
+
+__attribute__((target("ssse3")))
+static void luma_pack_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    uint32_t x = 0;
+    for (; x + 16 <= count; x += 16) {
+        const uint8_t* p = s + x * 4;
+        __m128i l0 = luma_sums_ssse3(_mm_loadu_si128((const __m128i*)p));
+        __m128i l1 = luma_sums_ssse3(_mm_loadu_si128((const __m128i*)(p + 16)));
+        __m128i l2 = luma_sums_ssse3(_mm_loadu_si128((const __m128i*)(p + 32)));
+        __m128i l3 = luma_sums_ssse3(_mm_loadu_si128((const __m128i*)(p + 48)));
+        _mm_storeu_si128((__m128i*)(d + x),
+                         _mm_packus_epi16(_mm_packs_epi32(l0, l1), _mm_packs_epi32(l2, l3)));
+    }
+    luma_pack_scalar(d + x, s + x * 4, count - x, order);
+}
+
+__attribute__((target("ssse3")))
+static void luma_unpack_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m128i alpha = _mm_set1_epi32((int)0xFF000000);
+    const __m128i m0 = _mm_setr_epi8(0, 0, 0, -1, 1, 1, 1, -1, 2, 2, 2, -1, 3, 3, 3, -1);
+    const __m128i m1 = _mm_setr_epi8(4, 4, 4, -1, 5, 5, 5, -1, 6, 6, 6, -1, 7, 7, 7, -1);
+    const __m128i m2 = _mm_setr_epi8(8, 8, 8, -1, 9, 9, 9, -1, 10, 10, 10, -1, 11, 11, 11, -1);
+    const __m128i m3 = _mm_setr_epi8(12, 12, 12, -1, 13, 13, 13, -1, 14, 14, 14, -1, 15, 15, 15, -1);
+    uint32_t x = 0;
+    for (; x + 16 <= count; x += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + x));
+        uint8_t* q = d + x * 4;
+        _mm_storeu_si128((__m128i*)q, _mm_or_si128(_mm_shuffle_epi8(v, m0), alpha));
+        _mm_storeu_si128((__m128i*)(q + 16), _mm_or_si128(_mm_shuffle_epi8(v, m1), alpha));
+        _mm_storeu_si128((__m128i*)(q + 32), _mm_or_si128(_mm_shuffle_epi8(v, m2), alpha));
+        _mm_storeu_si128((__m128i*)(q + 48), _mm_or_si128(_mm_shuffle_epi8(v, m3), alpha));
+    }
+    luma_unpack_scalar(d + x * 4, s + x, count - x, order);
+}
+
+// round(v * m / 255) in 16-bit lanes, v * m <= 255 * 255
+__attribute__((target("sse2")))
+static inline __m128i scale255_sse2(__m128i v, __m128i m)
+{
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(v, m), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+// widen5 and widen6 in 16-bit lanes
+__attribute__((target("sse2")))
+static inline __m128i widen5_sse2(__m128i v)
+{
+    return _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(v, _mm_set1_epi16(527)), _mm_set1_epi16(23)), 6);
+}
+
+__attribute__((target("sse2")))
+static inline __m128i widen6_sse2(__m128i v)
+{
+    return _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(v, _mm_set1_epi16(259)), _mm_set1_epi16(33)), 6);
+}
+
+// Channel `shift` / 8 of eight RGBA8 pixels as 16-bit lanes
+__attribute__((target("sse2")))
+static inline __m128i channel16_sse2(__m128i p0, __m128i p1, int shift)
+{
+    const __m128i lo8 = _mm_set1_epi32(0xFF);
+    __m128i c0 = _mm_and_si128(_mm_srli_epi32(p0, shift), lo8);
+    __m128i c1 = _mm_and_si128(_mm_srli_epi32(p1, shift), lo8);
+    return _mm_packs_epi32(c0, c1);
+}
+
+// Eight 16-bit R|G<<8 and B|A<<8 lanes to eight RGBA8 pixels
+__attribute__((target("sse2")))
+static inline void store_rgba16_sse2(uint8_t* d, __m128i rg, __m128i ba)
+{
+    _mm_storeu_si128((__m128i*)d, _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128((__m128i*)(d + 16), _mm_unpackhi_epi16(rg, ba));
+}
+
+__attribute__((target("ssse3")))
+static void pack565_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m128i m31 = _mm_set1_epi16(31), m63 = _mm_set1_epi16(63);
+    uint32_t x = 0;
+    for (; x + 8 <= count; x += 8) {
+        __m128i p0 = _mm_loadu_si128((const __m128i*)(s + x * 4));
+        __m128i p1 = _mm_loadu_si128((const __m128i*)(s + x * 4 + 16));
+        __m128i r = scale255_sse2(channel16_sse2(p0, p1, 0), m31);
+        __m128i g = scale255_sse2(channel16_sse2(p0, p1, 8), m63);
+        __m128i b = scale255_sse2(channel16_sse2(p0, p1, 16), m31);
+        __m128i v = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+        _mm_storeu_si128((__m128i*)(d + x * 2), v);
+    }
+    pack565_scalar(d + x * 2, s + x * 4, count - x, order);
+}
+
+__attribute__((target("ssse3")))
+static void unpack565_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m128i m5 = _mm_set1_epi16(31), m6 = _mm_set1_epi16(63);
+    const __m128i alpha = _mm_set1_epi16((short)0xFF00);
+    uint32_t x = 0;
+    for (; x + 8 <= count; x += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + x * 2));
+        __m128i r = widen5_sse2(_mm_srli_epi16(v, 11));
+        __m128i g = widen6_sse2(_mm_and_si128(_mm_srli_epi16(v, 5), m6));
+        __m128i b = widen5_sse2(_mm_and_si128(v, m5));
+        store_rgba16_sse2(d + x * 4, _mm_or_si128(r, _mm_slli_epi16(g, 8)), _mm_or_si128(b, alpha));
+    }
+    unpack565_scalar(d + x * 4, s + x * 2, count - x, order);
+}
+
+__attribute__((target("ssse3")))
+static void pack1555_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m128i m31 = _mm_set1_epi16(31);
+    uint32_t x = 0;
+    for (; x + 8 <= count; x += 8) {
+        __m128i p0 = _mm_loadu_si128((const __m128i*)(s + x * 4));
+        __m128i p1 = _mm_loadu_si128((const __m128i*)(s + x * 4 + 16));
+        __m128i r = scale255_sse2(channel16_sse2(p0, p1, 0), m31);
+        __m128i g = scale255_sse2(channel16_sse2(p0, p1, 8), m31);
+        __m128i b = scale255_sse2(channel16_sse2(p0, p1, 16), m31);
+        __m128i a = _mm_srli_epi16(channel16_sse2(p0, p1, 24), 7);
+        __m128i v = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(a, 15), _mm_slli_epi16(r, 10)),
+                                 _mm_or_si128(_mm_slli_epi16(g, 5), b));
+        _mm_storeu_si128((__m128i*)(d + x * 2), v);
+    }
+    pack1555_scalar(d + x * 2, s + x * 4, count - x, order);
+}
+
+__attribute__((target("ssse3")))
+static void unpack1555_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m128i m5 = _mm_set1_epi16(31);
+    const __m128i alpha = _mm_set1_epi16((short)0xFF00);
+    uint32_t x = 0;
+    for (; x + 8 <= count; x += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + x * 2));
+        __m128i r = widen5_sse2(_mm_and_si128(_mm_srli_epi16(v, 10), m5));
+        __m128i g = widen5_sse2(_mm_and_si128(_mm_srli_epi16(v, 5), m5));
+        __m128i b = widen5_sse2(_mm_and_si128(v, m5));
+        __m128i a = _mm_and_si128(_mm_srai_epi16(v, 15), alpha);
+        store_rgba16_sse2(d + x * 4, _mm_or_si128(r, _mm_slli_epi16(g, 8)), _mm_or_si128(b, a));
+    }
+    unpack1555_scalar(d + x * 4, s + x * 2, count - x, order);
+}
+
+// The 10-bit conversions in 32-bit lanes whose upper halves are zero, so
+// 16-bit multiplies give whole products: widen10 and narrow10 above
+__attribute__((target("sse2")))
+static inline __m128i widen10_sse2(__m128i v)
+{
+    return _mm_add_epi32(_mm_slli_epi32(v, 2), scale255_sse2(v, _mm_set1_epi32(3)));
+}
+
+__attribute__((target("sse2")))
+static inline __m128i narrow10_sse2(__m128i v)
+{
+    __m128i t = _mm_add_epi32(_mm_madd_epi16(v, _mm_set1_epi32(1021)), _mm_set1_epi32(2048));
+    return _mm_srli_epi32(t, 12);
+}
+
+__attribute__((target("ssse3")))
+static void pack1010102_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m128i lo8 = _mm_set1_epi32(0xFF);
+    uint32_t x = 0;
+    for (; x + 4 <= count; x += 4) {
+        __m128i p = _mm_loadu_si128((const __m128i*)(s + x * 4));
+        __m128i r = widen10_sse2(_mm_and_si128(p, lo8));
+        __m128i g = widen10_sse2(_mm_and_si128(_mm_srli_epi32(p, 8), lo8));
+        __m128i b = widen10_sse2(_mm_and_si128(_mm_srli_epi32(p, 16), lo8));
+        __m128i a = scale255_sse2(_mm_srli_epi32(p, 24), _mm_set1_epi32(3));
+        __m128i v = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 10)),
+                                 _mm_or_si128(_mm_slli_epi32(b, 20), _mm_slli_epi32(a, 30)));
+        _mm_storeu_si128((__m128i*)(d + x * 4), v);
+    }
+    pack1010102_scalar(d + x * 4, s + x * 4, count - x, order);
+}
+
+__attribute__((target("ssse3")))
+static void unpack1010102_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m128i m10 = _mm_set1_epi32(1023);
+    uint32_t x = 0;
+    for (; x + 4 <= count; x += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + x * 4));
+        __m128i r = narrow10_sse2(_mm_and_si128(v, m10));
+        __m128i g = narrow10_sse2(_mm_and_si128(_mm_srli_epi32(v, 10), m10));
+        __m128i b = narrow10_sse2(_mm_and_si128(_mm_srli_epi32(v, 20), m10));
+        __m128i a = _mm_mullo_epi16(_mm_srli_epi32(v, 30), _mm_set1_epi32(85));
+        __m128i p = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)),
+                                 _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(a, 24)));
+        _mm_storeu_si128((__m128i*)(d + x * 4), p);
+    }
+    unpack1010102_scalar(d + x * 4, s + x * 4, count - x, order);
+}
+
+// Two RGBA8 pixels widened to 16 bits, times their alpha with alpha
+// itself times 255 so it survives the division
+__attribute__((target("sse2")))
+static inline __m128i premultiply2_sse2(__m128i v)
+{
+    const __m128i keep = _mm_setr_epi16(0, 0, 0, 0xFF, 0, 0, 0, 0xFF);
+    __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xFF), 0xFF);
+    return scale255_sse2(v, _mm_or_si128(a, keep));
+}
+
+__attribute__((target("ssse3")))
+static void premultiply_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m128i z = _mm_setzero_si128();
+    uint32_t x = 0;
+    for (; x + 4 <= count; x += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + x * 4));
+        __m128i lo = premultiply2_sse2(_mm_unpacklo_epi8(v, z));
+        __m128i hi = premultiply2_sse2(_mm_unpackhi_epi8(v, z));
+        _mm_storeu_si128((__m128i*)(d + x * 4), _mm_packus_epi16(lo, hi));
+    }
+    premultiply_scalar(d + x * 4, s + x * 4, count - x, order);
+}
+
+// One pixel in 32-bit lanes: floor((510 c + a) / (2 a)) in single
+// precision. Numerator and denominator are exact and the quotient is at
+// least 1 / 510 away from the next integer, well beyond float rounding,
+// so truncation matches the integer division. Alpha zero divides by zero;
+// the resulting NaN or infinity converts to INT_MIN and packs to 0.
+__attribute__((target("sse2")))
+static inline __m128i unpremultiply1_sse2(__m128i p)
+{
+    __m128 c = _mm_cvtepi32_ps(p);
+    __m128 a = _mm_cvtepi32_ps(_mm_shuffle_epi32(p, 0xFF));
+    __m128 n = _mm_add_ps(_mm_mul_ps(c, _mm_set1_ps(510.0f)), a);
+    return _mm_cvttps_epi32(_mm_div_ps(n, _mm_add_ps(a, a)));
+}
+
+__attribute__((target("ssse3")))
+static void unpremultiply_ssse3(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m128i z = _mm_setzero_si128();
+    const __m128i alpha = _mm_set1_epi32((int)0xFF000000);
+    uint32_t x = 0;
+    for (; x + 4 <= count; x += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + x * 4));
+        __m128i lo = _mm_unpacklo_epi8(v, z);
+        __m128i hi = _mm_unpackhi_epi8(v, z);
+        __m128i q0 = unpremultiply1_sse2(_mm_unpacklo_epi16(lo, z));
+        __m128i q1 = unpremultiply1_sse2(_mm_unpackhi_epi16(lo, z));
+        __m128i q2 = unpremultiply1_sse2(_mm_unpacklo_epi16(hi, z));
+        __m128i q3 = unpremultiply1_sse2(_mm_unpackhi_epi16(hi, z));
+        __m128i q = _mm_packus_epi16(_mm_packs_epi32(q0, q1), _mm_packs_epi32(q2, q3));
+        q = _mm_or_si128(_mm_andnot_si128(alpha, q), _mm_and_si128(alpha, v));
+        _mm_storeu_si128((__m128i*)(d + x * 4), q);
+    }
+    unpremultiply_scalar(d + x * 4, s + x * 4, count - x, order);
+}
+
+#pragma mark - AVX2 kernels
+
+// The hot conversions again, 32 bytes at a time. Shuffles, unpacks and
+// packs work within 128-bit lanes; where that scrambles pixel order a
+// cross-lane permute restores it. Conversions without an AVX2 kernel use
+// the SSSE3 one, which also finishes each AVX2 row: the compiler does not
+// clear the upper YMM halves before that call, and legacy SSE code running
+// with them dirty pays a transition penalty on every instruction.
+
+__attribute__((target("avx2")))
+static void shuffle4_avx2(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    uint8_t control[16];
+    shuffle_control(control, 4, 4, 4, order);
+    const __m256i m = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)control));
+    uint32_t x = 0;
+    for (; x + 16 <= count; x += 16) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(s + x * 4));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(s + x * 4 + 32));
+        _mm256_storeu_si256((__m256i*)(d + x * 4), _mm256_shuffle_epi8(a, m));
+        _mm256_storeu_si256((__m256i*)(d + x * 4 + 32), _mm256_shuffle_epi8(b, m));
+    }
+    _mm256_zeroupper();
+    shuffle4_ssse3(d + x * 4, s + x * 4, count - x, order);
+}
+
+// Eight pixels from two 16-byte loads 12 bytes apart
+__attribute__((target("avx2")))
+static void expand3_avx2(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    uint8_t control[16], fill[16];
+    shuffle_control(control, 4, 3, 4, order);
+    fill_bytes(fill, order);
+    const __m256i m = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)control));
+    const __m256i f = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)fill));
+    uint32_t x = 0;
+    for (; x + 10 <= count; x += 8) {
+        const uint8_t* p = s + x * 3;
+        __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)p)),
+                                            _mm_loadu_si128((const __m128i*)(p + 12)), 1);
+        _mm256_storeu_si256((__m256i*)(d + x * 4), _mm256_or_si256(_mm256_shuffle_epi8(v, m), f));
+    }
+    _mm256_zeroupper();
+    expand3_ssse3(d + x * 4, s + x * 3, count - x, order);
+}
+
+// Eight RGBA8 pixels to eight 32-bit luminance values, in pixel order
+__attribute__((target("avx2")))
+static inline __m256i luma_sums_avx2(__m256i v)
+{
+    const __m256i z = _mm256_setzero_si256();
+    const __m256i w = _mm256_setr_epi16(77, 150, 29, 0, 77, 150, 29, 0, 77, 150, 29, 0, 77, 150, 29, 0);
+    __m256i lo = _mm256_madd_epi16(_mm256_unpacklo_epi8(v, z), w);
+    __m256i hi = _mm256_madd_epi16(_mm256_unpackhi_epi8(v, z), w);
+    return _mm256_srli_epi32(_mm256_add_epi32(_mm256_hadd_epi32(lo, hi), _mm256_set1_epi32(128)), 8);
+}
+
+__attribute__((target("avx2")))
+static void luma_pack_avx2(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m256i reorder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    uint32_t x = 0;
+    for (; x + 32 <= count; x += 32) {
+        const uint8_t* p = s + x * 4;
+        __m256i l0 = luma_sums_avx2(_mm256_loadu_si256((const __m256i*)p));
+        __m256i l1 = luma_sums_avx2(_mm256_loadu_si256((const __m256i*)(p + 32)));
+        __m256i l2 = luma_sums_avx2(_mm256_loadu_si256((const __m256i*)(p + 64)));
+        __m256i l3 = luma_sums_avx2(_mm256_loadu_si256((const __m256i*)(p + 96)));
+        __m256i v = _mm256_packus_epi16(_mm256_packs_epi32(l0, l1), _mm256_packs_epi32(l2, l3));
+        _mm256_storeu_si256((__m256i*)(d + x), _mm256_permutevar8x32_epi32(v, reorder));
+    }
+    _mm256_zeroupper();
+    luma_pack_ssse3(d + x, s + x * 4, count - x, order);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i scale255_avx2(__m256i v, __m256i m)
+{
+    __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(v, m), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+// Channel of sixteen pixels as 16-bit lanes, in the order packs leaves
+// them: pixels 0-3, 8-11, 4-7, 12-15
+__attribute__((target("avx2")))
+static inline __m256i channel16_avx2(__m256i p0, __m256i p1, int shift)
+{
+    const __m256i lo8 = _mm256_set1_epi32(0xFF);
+    __m256i c0 = _mm256_and_si256(_mm256_srli_epi32(p0, shift), lo8);
+    __m256i c1 = _mm256_and_si256(_mm256_srli_epi32(p1, shift), lo8);
+    return _mm256_packs_epi32(c0, c1);
+}
+
+__attribute__((target("avx2")))
+static void pack565_avx2(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m256i m31 = _mm256_set1_epi16(31), m63 = _mm256_set1_epi16(63);
+    uint32_t x = 0;
+    for (; x + 16 <= count; x += 16) {
+        __m256i p0 = _mm256_loadu_si256((const __m256i*)(s + x * 4));
+        __m256i p1 = _mm256_loadu_si256((const __m256i*)(s + x * 4 + 32));
+        __m256i r = scale255_avx2(channel16_avx2(p0, p1, 0), m31);
+        __m256i g = scale255_avx2(channel16_avx2(p0, p1, 8), m63);
+        __m256i b = scale255_avx2(channel16_avx2(p0, p1, 16), m31);
+        __m256i v = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(r, 11), _mm256_slli_epi16(g, 5)), b);
+        _mm256_storeu_si256((__m256i*)(d + x * 2), _mm256_permute4x64_epi64(v, 0xD8));
+    }
+    _mm256_zeroupper();
+    pack565_ssse3(d + x * 2, s + x * 4, count - x, order);
+}
+
+__attribute__((target("avx2")))
+static void unpack565_avx2(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m256i m5 = _mm256_set1_epi16(31), m6 = _mm256_set1_epi16(63);
+    const __m256i w5 = _mm256_set1_epi16(527), r5 = _mm256_set1_epi16(23);
+    const __m256i w6 = _mm256_set1_epi16(259), r6 = _mm256_set1_epi16(33);
+    const __m256i alpha = _mm256_set1_epi16((short)0xFF00);
+    uint32_t x = 0;
+    for (; x + 16 <= count; x += 16) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(s + x * 2));
+        __m256i r = _mm256_srli_epi16(v, 11);
+        __m256i g = _mm256_and_si256(_mm256_srli_epi16(v, 5), m6);
+        __m256i b = _mm256_and_si256(v, m5);
+        r = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(r, w5), r5), 6);
+        g = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(g, w6), r6), 6);
+        b = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(b, w5), r5), 6);
+        __m256i rg = _mm256_or_si256(r, _mm256_slli_epi16(g, 8));
+        __m256i ba = _mm256_or_si256(b, alpha);
+        // Pixels 0-3 | 8-11 and 4-7 | 12-15
+        __m256i lo = _mm256_unpacklo_epi16(rg, ba);
+        __m256i hi = _mm256_unpackhi_epi16(rg, ba);
+        _mm256_storeu_si256((__m256i*)(d + x * 4), _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i*)(d + x * 4 + 32), _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    _mm256_zeroupper();
+    unpack565_ssse3(d + x * 4, s + x * 2, count - x, order);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i premultiply4_avx2(__m256i v)
+{
+    const __m256i keep = _mm256_setr_epi16(0, 0, 0, 0xFF, 0, 0, 0, 0xFF, 0, 0, 0, 0xFF, 0, 0, 0, 0xFF);
+    __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(v, 0xFF), 0xFF);
+    return scale255_avx2(v, _mm256_or_si256(a, keep));
+}
+
+__attribute__((target("avx2")))
+static void premultiply_avx2(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m256i z = _mm256_setzero_si256();
+    uint32_t x = 0;
+    for (; x + 8 <= count; x += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(s + x * 4));
+        __m256i lo = premultiply4_avx2(_mm256_unpacklo_epi8(v, z));
+        __m256i hi = premultiply4_avx2(_mm256_unpackhi_epi8(v, z));
+        _mm256_storeu_si256((__m256i*)(d + x * 4), _mm256_packus_epi16(lo, hi));
+    }
+    _mm256_zeroupper();
+    premultiply_ssse3(d + x * 4, s + x * 4, count - x, order);
+}
+
+// Two pixels, one per lane; see unpremultiply1_sse2
+__attribute__((target("avx2")))
+static inline __m256i unpremultiply2_avx2(__m256i p)
+{
+    __m256 c = _mm256_cvtepi32_ps(p);
+    __m256 a = _mm256_cvtepi32_ps(_mm256_shuffle_epi32(p, 0xFF));
+    __m256 n = _mm256_add_ps(_mm256_mul_ps(c, _mm256_set1_ps(510.0f)), a);
+    return _mm256_cvttps_epi32(_mm256_div_ps(n, _mm256_add_ps(a, a)));
+}
+
+__attribute__((target("avx2")))
+static void unpremultiply_avx2(uint8_t* d, const uint8_t* s, uint32_t count, const uint8_t* order)
+{
+    const __m256i alpha = _mm256_set1_epi32((int)0xFF000000);
+    const __m256i reorder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    uint32_t x = 0;
+    for (; x + 8 <= count; x += 8) {
+        const uint8_t* p = s + x * 4;
+        __m256i v = _mm256_loadu_si256((const __m256i*)p);
+        __m256i q0 = unpremultiply2_avx2(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)p)));
+        __m256i q1 = unpremultiply2_avx2(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(p + 8))));
+        __m256i q2 = unpremultiply2_avx2(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(p + 16))));
+        __m256i q3 = unpremultiply2_avx2(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(p + 24))));
+        // Lanes hold pixels 0,2,4,6 | 1,3,5,7
+        __m256i q = _mm256_packus_epi16(_mm256_packs_epi32(q0, q1), _mm256_packs_epi32(q2, q3));
+        q = _mm256_permutevar8x32_epi32(q, reorder);
+        q = _mm256_or_si256(_mm256_andnot_si256(alpha, q), _mm256_and_si256(alpha, v));
+        _mm256_storeu_si256((__m256i*)(d + x * 4), q);
+    }
+    _mm256_zeroupper();
+    unpremultiply_ssse3(d + x * 4, s + x * 4, count - x, order);
+}
+
+#endif /* VMPIXELCONVERT_HAVE_SIMD */
+
+#pragma mark - Dispatch
+
+VMBlit2DPath VMPixelConvertSetPath(VMBlit2DPath path)
+{
+    VMBlit2DPath best = VMBlit2DBestPath();
+    if (path > best)
+        path = best;
+
+    s_row[kRowShuffle4] = shuffle4_scalar;
+    s_row[kRowExpand3] = expand3_scalar;
+    s_row[kRowPack3] = pack3_scalar;
+    s_row[kRowLumaPack] = luma_pack_scalar;
+    s_row[kRowLumaUnpack] = luma_unpack_scalar;
+    s_row[kRow565Pack] = pack565_scalar;
+    s_row[kRow565Unpack] = unpack565_scalar;
+    s_row[kRow1555Pack] = pack1555_scalar;
+    s_row[kRow1555Unpack] = unpack1555_scalar;
+    s_row[kRow1010102Pack] = pack1010102_scalar;
+    s_row[kRow1010102Unpack] = unpack1010102_scalar;
+    s_row[kRowPremultiply] = premultiply_scalar;
+    s_row[kRowUnpremultiply] = unpremultiply_scalar;
+    s_uses_ssse3 = false;
+
+#if VMPIXELCONVERT_HAVE_SIMD
+    // Every AVX2 CPU has SSSE3
+    if (path != kVMBlit2DPathScalar && VMBlit2DHasSSSE3()) {
+        s_row[kRowShuffle4] = shuffle4_ssse3;
+        s_row[kRowExpand3] = expand3_ssse3;
+        s_row[kRowPack3] = pack3_ssse3;
+        s_row[kRowLumaPack] = luma_pack_ssse3;
+        s_row[kRowLumaUnpack] = luma_unpack_ssse3;
+        s_row[kRow565Pack] = pack565_ssse3;
+        s_row[kRow565Unpack] = unpack565_ssse3;
+        s_row[kRow1555Pack] = pack1555_ssse3;
+        s_row[kRow1555Unpack] = unpack1555_ssse3;
+        s_row[kRow1010102Pack] = pack1010102_ssse3;
+        s_row[kRow1010102Unpack] = unpack1010102_ssse3;
+        s_row[kRowPremultiply] = premultiply_ssse3;
+        s_row[kRowUnpremultiply] = unpremultiply_ssse3;
+        s_uses_ssse3 = true;
+    }
+    if (path == kVMBlit2DPathAVX2) {
+        s_row[kRowShuffle4] = shuffle4_avx2;
+        s_row[kRowExpand3] = expand3_avx2;
+        s_row[kRowLumaPack] = luma_pack_avx2;
+        s_row[kRow565Pack] = pack565_avx2;
+        s_row[kRow565Unpack] = unpack565_avx2;
+        s_row[kRowPremultiply] = premultiply_avx2;
+        s_row[kRowUnpremultiply] = unpremultiply_avx2;
+    }
+#else
+    path = kVMBlit2DPathScalar;
+#endif
+
+    s_active_path = path;
+    s_initialized = true;
+    return path;
+}
+
+VMBlit2DPath VMPixelConvertActivePath()
+{
+    if (!s_initialized)
+        VMPixelConvertSetPath(VMBlit2DBestPath());
+    return s_active_path;
+}
+
+bool VMPixelConvertUsesSSSE3()
+{
+    if (!s_initialized)
+        VMPixelConvertSetPath(VMBlit2DBestPath());
+    return s_uses_ssse3;
+}
+
+uint32_t VMPixelFormatBytes(VMPixelFormat format)
+{
+    if (format <= kVMPixelFormatInvalid || format >= kVMPixelFormatCount)
+        return 0;
+    return s_formats[format].bytes;
+}
+
+#pragma mark - Image operations
+
+// Byte order taking RGBA8 to a byte format, or the reverse
+static void pack_order(uint8_t order[4], const VMPixelFormatInfo& format)
+{
+    memset(order, kFill, 4);
+    for (uint32_t c = 0; c < 4; c++)
+        if (format.position[c] != kNone)
+            order[format.position[c]] = (uint8_t)c;
+}
+
+static void unpack_order(uint8_t order[4], const VMPixelFormatInfo& format)
+{
+    for (uint32_t c = 0; c < 4; c++)
+        order[c] = format.position[c] == kNone ? kFill : format.position[c];
+}
+
+// Single-kernel swizzle between two byte formats: for each destination
+// byte, the source byte holding its channel
+static bool direct_order(uint8_t order[4], const VMPixelFormatInfo& dst, const VMPixelFormatInfo& src,
+                         VMPixelRowKernel* kernel)
+{
+    if (dst.bytes == 4 && src.bytes == 4)
+        *kernel = kRowShuffle4;
+    else if (dst.bytes == 4 && src.bytes == 3)
+        *kernel = kRowExpand3;
+    else if (dst.bytes == 3 && src.bytes == 4)
+        *kernel = kRowPack3;
+    else
+        return false;
+
+    memset(order, kFill, 4);
+    for (uint32_t c = 0; c < 4; c++)
+        if (dst.position[c] != kNone)
+            order[dst.position[c]] = src.position[c] == kNone ? kFill : src.position[c];
+    return true;
+}
+
+// The conversion proper, run inside the vector bracket once the arguments
+// have been validated
+static void convert_image(const VMPixelImage* dst, const VMPixelImage* src,
+                          uint32_t width, uint32_t height, uint32_t flags)
+{
+    uint32_t dst_bytes = VMPixelFormatBytes(dst->format);
+    uint32_t src_bytes = VMPixelFormatBytes(src->format);
+    const VMPixelFormatInfo& df = s_formats[dst->format];
+    const VMPixelFormatInfo& sf = s_formats[src->format];
+
+    if (dst->format == src->format && !flags) {
+        for (uint32_t y = 0; y < height; y++) {
+            uint8_t* d = dst->base + (size_t)y * dst->rowBytes;
+            const uint8_t* s = src->base + (size_t)y * src->rowBytes;
+            if (d != s)
+                memmove(d, s, (size_t)width * dst_bytes);
+        }
+        return;
+    }
+
+    uint8_t order[4];
+    VMPixelRowKernel kernel;
+    if (!flags && is_byte_format(dst->format) && is_byte_format(src->format) &&
+        direct_order(order, df, sf, &kernel)) {
+        VMPixelRowFn row = s_row[kernel];
+        for (uint32_t y = 0; y < height; y++)
+            row(dst->base + (size_t)y * dst->rowBytes, src->base + (size_t)y * src->rowBytes, width, order);
+        return;
+    }
+
+    // Through RGBA8, a chunk of a row at a time
+    uint8_t unpack[4], pack[4];
+    unpack_order(unpack, sf);
+    pack_order(pack, df);
+    VMPixelRowFn unpack_row = s_row[sf.unpack];
+    VMPixelRowFn pack_row = s_row[df.pack];
+    VMPixelRowFn alpha_row = (flags & kVMPixelConvertPremultiply) ? s_row[kRowPremultiply] :
+                             (flags & kVMPixelConvertUnpremultiply) ? s_row[kRowUnpremultiply] : NULL;
+    uint32_t chunk[kChunkPixels];
+    uint8_t* rgba = (uint8_t*)chunk;
+
+    for (uint32_t y = 0; y < height; y++) {
+        uint8_t* d = dst->base + (size_t)y * dst->rowBytes;
+        const uint8_t* s = src->base + (size_t)y * src->rowBytes;
+        for (uint32_t x = 0; x < width; x += kChunkPixels) {
+            uint32_t n = width - x < kChunkPixels ? width - x : kChunkPixels;
+            unpack_row(rgba, s + (size_t)x * src_bytes, n, unpack);
+            if (alpha_row)
+                alpha_row(rgba, rgba, n, NULL);
+            pack_row(d + (size_t)x * dst_bytes, rgba, n, pack);
+        }
+    }
+}
+
+bool VMPixelConvert(const VMPixelImage* dst, const VMPixelImage* src,
+                    uint32_t width, uint32_t height, uint32_t flags)
+{
+    if (!dst || !src || !dst->base || !src->base)
+        return false;
+    uint32_t dst_bytes = VMPixelFormatBytes(dst->format);
+    uint32_t src_bytes = VMPixelFormatBytes(src->format);
+    if (!dst_bytes || !src_bytes)
+        return false;
+    if (flags & ~(uint32_t)(kVMPixelConvertPremultiply | kVMPixelConvertUnpremultiply))
+        return false;
+    if ((flags & kVMPixelConvertPremultiply) && (flags & kVMPixelConvertUnpremultiply))
+        return false;
+    if ((uint64_t)width * dst_bytes > dst->rowBytes || (uint64_t)width * src_bytes > src->rowBytes)
+        return false;
+    if (width == 0 || height == 0)
+        return true;
+    if (!s_initialized)
+        VMPixelConvertSetPath(VMBlit2DBestPath());
+
+    VMBlit2DVectorState vector;
+    VMBlit2DVectorBegin(&vector);
+    convert_image(dst, src, width, height, flags);
+    VMBlit2DVectorEnd(&vector);
+    return true;
+}
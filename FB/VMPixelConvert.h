@@ -0,0 +1,83 @@
+#ifndef __VMPixelConvert_H__
+#define __VMPixelConvert_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "VMBlit2D.h"
+
+// Pixel format conversion between the 8-bit, 16-bit and 10:10:10:2 layouts
+// surfaces and textures come in.
+//
+// VMIOSurfaceManager converts between surface formats and VMTextureManager
+// between texture formats; both go through VMPixelConvert. Formats are
+// named by their layout in memory, byte by byte for the 8-bit formats and
+// as little-endian words for the packed ones, so BGRA8 is the byte
+// sequence B,G,R,A whatever the host's endianness.
+//
+// Swizzles between the byte formats are a single shuffle per row. Every
+// other conversion runs through RGBA8: the source is unpacked a chunk at a
+// time, the alpha operation applied, and the result packed into the
+// destination format. Channels of 5, 6, 10, 2 and 1 bits map to and from
+// 8 bits as round(v * max_out / max_in) both ways, so black and white
+// survive and a round trip through 8 bits is lossless. Luminance is
+// (77 R + 150 G + 29 B + 128) >> 8, alpha dropped; expanding it gives
+// L,L,L,255. Formats without alpha read as opaque.
+//
+// Premultiply is round(c * a / 255); unpremultiply is
+// min(255, round(c * 255 / a)), and zero where alpha is zero. Alpha itself
+// is never changed.
+//
+// Kernel selection follows VMBlit2D's CPU probe: the AVX2 path has AVX2
+// kernels, the SSE2 path uses SSSE3 byte shuffles when the CPU has them
+// and scalar code otherwise. Inside the kext a conversion runs within
+// VMBlit2DVectorBegin/End. Every kernel set produces
+// identical bytes. Free of IOKit, so tools/pixelconvert_test builds it
+// unchanged on Linux.
+
+enum VMPixelFormat {
+    kVMPixelFormatInvalid = 0,
+    kVMPixelFormatRGBA8,        // R,G,B,A bytes
+    kVMPixelFormatBGRA8,        // B,G,R,A bytes
+    kVMPixelFormatARGB8,        // A,R,G,B bytes
+    kVMPixelFormatABGR8,        // A,B,G,R bytes
+    kVMPixelFormatRGB8,         // R,G,B bytes
+    kVMPixelFormatBGR8,         // B,G,R bytes
+    kVMPixelFormatL8,           // One luminance byte
+    kVMPixelFormatB5G6R5,       // 16-bit word: B in bits 0-4, G 5-10, R 11-15
+    kVMPixelFormatB5G5R5A1,     // 16-bit word: B 0-4, G 5-9, R 10-14, A 15
+    kVMPixelFormatR10G10B10A2,  // 32-bit word: R 0-9, G 10-19, B 20-29, A 30-31
+    kVMPixelFormatCount
+};
+
+enum {
+    kVMPixelConvertPremultiply   = 1u << 0,    // Multiply color by alpha
+    kVMPixelConvertUnpremultiply = 1u << 1,    // Divide color by alpha
+};
+
+struct VMPixelImage {
+    uint8_t*      base;         // Address of pixel (0,0)
+    uint32_t      rowBytes;     // Stride in bytes, at least width * bytes per pixel
+    VMPixelFormat format;
+};
+
+// Bytes per pixel, 0 for an invalid format
+uint32_t VMPixelFormatBytes(VMPixelFormat format);
+
+// Pin a kernel set (clamped to VMBlit2DBestPath()). Returns the path
+// actually selected. The first conversion picks the best path on its own.
+VMBlit2DPath VMPixelConvertSetPath(VMBlit2DPath path);
+VMBlit2DPath VMPixelConvertActivePath();
+
+// Whether the active kernel set uses SSSE3 shuffles on its SSE2 path
+bool VMPixelConvertUsesSSSE3();
+
+// Convert a width x height block from src to dst, both starting at their
+// base. `flags` are kVMPixelConvert* bits; premultiply and unpremultiply
+// are exclusive. The images may be the same memory when both formats
+// have the same size and the strides match; otherwise they must not
+// overlap. Returns false for bad arguments without touching dst.
+bool VMPixelConvert(const VMPixelImage* dst, const VMPixelImage* src,
+                    uint32_t width, uint32_t height, uint32_t flags);
+
+#endif /* __VMPixelConvert_H__ */
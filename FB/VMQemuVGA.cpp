@@ -5,6 +5,7 @@
 #include <IOKit/IODeviceTreeSupport.h>
 #include "VMQemuVGA.h"
 #include "VMQemuVGAAccelerator.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 
 
@@ -18,15 +19,15 @@
 #endif
 
 #ifdef  VGA_DEBUG
-#define DLOG(fmt, args...)  IOLog(fmt, ## args)
+#define DLOG(fmt, args...)  VMLOG_DEBUG(fmt, ## args)
 #else
 #define DLOG(fmt, args...)
 #endif
 
 // Define VLOG macros for logging
 #ifdef VLOG_LOCAL
-#define VLOG(fmt, args...)  IOLog("VMQemuVGA: " fmt "\n", ## args)
-#define VLOG_ENTRY()        IOLog("VMQemuVGA: %s entry\n", __func__)
+#define VLOG(fmt, args...)  VMLOG_INFO("VMQemuVGA: " fmt "\n", ## args)
+#define VLOG_ENTRY()        VMLOG_DEBUG("VMQemuVGA: %s entry\n", __func__)
 #else
 #define VLOG(fmt, args...)
 #define VLOG_ENTRY()
@@ -36,11 +37,11 @@
 bool VMQemuVGA::readPCIConfigSpace(IOPCIDevice* pciDevice, uint16_t* vendorID, uint16_t* deviceID)
 {
 	if (!pciDevice || !vendorID || !deviceID) {
-		IOLog("VMQemuVGA: Invalid parameters for PCI config space read\n");
+		VMLOG_WARN("VMQemuVGA: Invalid parameters for PCI config space read\n");
 		return false;
 	}
 	
-	IOLog("VMQemuVGA: Attempting to read PCI configuration space\n");
+	VMLOG_DEBUG("VMQemuVGA: Attempting to read PCI configuration space\n");
 	
 	// Method 1: Try reading properties as OSNumber
 	OSNumber* vendorNum = OSDynamicCast(OSNumber, pciDevice->getProperty("vendor-id"));
@@ -51,12 +52,12 @@ bool VMQemuVGA::readPCIConfigSpace(IOPCIDevice* pciDevice, uint16_t* vendorID, u
 		*deviceID = (uint16_t)deviceNum->unsigned32BitValue();
 		
 		if (*vendorID != 0xFFFF && *vendorID != 0x0000 && *deviceID != 0xFFFF) {
-			IOLog("VMQemuVGA: Successfully read PCI IDs via OSNumber - Vendor: 0x%04X, Device: 0x%04X\n", *vendorID, *deviceID);
+			VMLOG_DEBUG("VMQemuVGA: Successfully read PCI IDs via OSNumber - Vendor: 0x%04X, Device: 0x%04X\n", *vendorID, *deviceID);
 			return true;
 		}
 	}
 	
-	IOLog("VMQemuVGA: OSNumber read failed - trying OSData properties\n");
+	VMLOG_ERROR("VMQemuVGA: OSNumber read failed - trying OSData properties\n");
 	
 	// Method 2: Try reading properties as OSData
 	OSData* vendorData = OSDynamicCast(OSData, pciDevice->getProperty("vendor-id"));
@@ -67,12 +68,12 @@ bool VMQemuVGA::readPCIConfigSpace(IOPCIDevice* pciDevice, uint16_t* vendorID, u
 		*deviceID = *(const uint16_t*)deviceData->getBytesNoCopy();
 		
 		if (*vendorID != 0xFFFF && *vendorID != 0x0000 && *deviceID != 0xFFFF) {
-			IOLog("VMQemuVGA: Successfully read PCI IDs via OSData - Vendor: 0x%04X, Device: 0x%04X\n", *vendorID, *deviceID);
+			VMLOG_DEBUG("VMQemuVGA: Successfully read PCI IDs via OSData - Vendor: 0x%04X, Device: 0x%04X\n", *vendorID, *deviceID);
 			return true;
 		}
 	}
 	
-	IOLog("VMQemuVGA: Property read failed - trying direct config space access\n");
+	VMLOG_ERROR("VMQemuVGA: Property read failed - trying direct config space access\n");
 	
 	// Method 3: Direct PCI configuration space access via memory mapping
 	IODeviceMemory* configMemory = pciDevice->getDeviceMemoryWithIndex(kIOPCIConfigSpace);
@@ -86,7 +87,7 @@ bool VMQemuVGA::readPCIConfigSpace(IOPCIDevice* pciDevice, uint16_t* vendorID, u
 				*vendorID = (uint16_t)(vendorDeviceReg & 0xFFFF);        // Lower 16 bits
 				*deviceID = (uint16_t)((vendorDeviceReg >> 16) & 0xFFFF); // Upper 16 bits
 				
-				IOLog("VMQemuVGA: Successfully read PCI IDs via config space mapping - Vendor: 0x%04X, Device: 0x%04X\n", *vendorID, *deviceID);
+				VMLOG_DEBUG("VMQemuVGA: Successfully read PCI IDs via config space mapping - Vendor: 0x%04X, Device: 0x%04X\n", *vendorID, *deviceID);
 				configMap->release();
 				
 				if (*vendorID != 0xFFFF && *vendorID != 0x0000 && *deviceID != 0xFFFF) {
@@ -97,7 +98,7 @@ bool VMQemuVGA::readPCIConfigSpace(IOPCIDevice* pciDevice, uint16_t* vendorID, u
 		}
 	}
 	
-	IOLog("VMQemuVGA: Config space mapping failed - trying parent device\n");
+	VMLOG_ERROR("VMQemuVGA: Config space mapping failed - trying parent device\n");
 	
 	// Method 4: Try getting properties from parent PCI device
 	IORegistryEntry* parent = pciDevice->getParentEntry(gIOServicePlane);
@@ -110,13 +111,13 @@ bool VMQemuVGA::readPCIConfigSpace(IOPCIDevice* pciDevice, uint16_t* vendorID, u
 			*deviceID = (uint16_t)deviceNum->unsigned32BitValue();
 			
 			if (*vendorID != 0xFFFF && *vendorID != 0x0000 && *deviceID != 0xFFFF) {
-				IOLog("VMQemuVGA: Successfully read PCI IDs via parent - Vendor: 0x%04X, Device: 0x%04X\n", *vendorID, *deviceID);
+				VMLOG_DEBUG("VMQemuVGA: Successfully read PCI IDs via parent - Vendor: 0x%04X, Device: 0x%04X\n", *vendorID, *deviceID);
 				return true;
 			}
 		}
 	}
 	
-	IOLog("VMQemuVGA: All PCI config space read methods failed\n");
+	VMLOG_ERROR("VMQemuVGA: All PCI config space read methods failed\n");
 	return false;
 }
 
@@ -139,57 +140,58 @@ IOService* VMQemuVGA::probe(IOService* provider, SInt32* score)
 {
     VLOG_ENTRY();
     
-    IOLog("VMQemuVGA: PROBE CALLED - Starting device probe\n");
+    VMLOG_INFO("VMQemuVGA: PROBE CALLED - Starting device probe\n");
     
     if (!super::probe(provider, score)) {
-        IOLog("VMQemuVGA: Super probe failed\n");
+        VMLOG_ERROR("VMQemuVGA: Super probe failed\n");
         return NULL;
     }
     
     // Only handle direct PCI devices - VirtIO devices go through VMVirtIOGPU
     IOPCIDevice* pciDevice = OSDynamicCast(IOPCIDevice, provider);
     if (!pciDevice) {
-        IOLog("VMQemuVGA: Provider is not a PCI device - returning NULL\n");
+        VMLOG_INFO("VMQemuVGA: Provider is not a PCI device - returning NULL\n");
         return NULL;
     }
     
     // Get vendor and device ID from IORegistry properties
     uint16_t vendor_id = 0, device_id = 0;
     if (!readPCIConfigSpace(pciDevice, &vendor_id, &device_id)) {
-        IOLog("VMQemuVGA: Failed to read PCI vendor/device properties\n");
+        VMLOG_ERROR("VMQemuVGA: Failed to read PCI vendor/device properties\n");
         return NULL;
     }
     
-    IOLog("VMQemuVGA: Found PCI device: vendor=0x%04x, device=0x%04x\n", vendor_id, device_id);
+    VMLOG_INFO("VMQemuVGA: Found PCI device: vendor=0x%04x, device=0x%04x\n", vendor_id, device_id);
     
     // QXL devices (Red Hat QEMU VGA) - Highest priority
     if (vendor_id == 0x1b36 && device_id == 0x0100) {
         *score = 95000;  // Very high score to beat NDRV
-        IOLog("VMQemuVGA: QXL device detected - PROBE SUCCESSFUL with score %d\n", *score);
+        VMLOG_INFO("VMQemuVGA: QXL device detected - PROBE SUCCESSFUL with score %d\n", *score);
         return this;
     }
     
     // QEMU VGA devices (Bochs/QEMU)
     if (vendor_id == 0x1234 && (device_id == 0x1111 || device_id == 0x1112 || device_id == 0x4005)) {
         *score = 85000;  // Lower score for traditional QEMU VGA
-        IOLog("VMQemuVGA: QEMU VGA device detected - PROBE SUCCESSFUL with score %d\n", *score);
+        VMLOG_INFO("VMQemuVGA: QEMU VGA device detected - PROBE SUCCESSFUL with score %d\n", *score);
         return this;
     }
     
     // VirtIO GPU devices - DO NOT CLAIM (handled by VMVirtIOGPU)
     if (vendor_id == 0x1af4 && device_id >= 0x1050 && device_id <= 0x105f) {
-        IOLog("VMQemuVGA: VirtIO GPU device detected - deferring to VMVirtIOGPU\n");
+        VMLOG_INFO("VMQemuVGA: VirtIO GPU device detected - deferring to VMVirtIOGPU\n");
         return NULL;
     }
     
-    IOLog("VMQemuVGA: Device not supported - vendor=0x%04x, device=0x%04x\n", vendor_id, device_id);
+    VMLOG_WARN("VMQemuVGA: Device not supported - vendor=0x%04x, device=0x%04x\n", vendor_id, device_id);
     return NULL;
 }/*************START********************/
 bool CLASS::start(IOService* provider)
 {
 	uint32_t max_w, max_h;
 	
-	IOLog("VMQemuVGA: START METHOD CALLED - Driver is being started!\n");
+	VMLogInit();
+	VMLOG_INFO("VMQemuVGA: START METHOD CALLED - Driver is being started!\n");
 	VLOG("START METHOD CALLED");
 	DLOG("%s::%s \n", getName(), __FUNCTION__);
 	
@@ -210,7 +212,7 @@ bool CLASS::start(IOService* provider)
 	// Snow Leopard's WindowServer checks for this property via isConsoleDevice()
 	// Without it, WindowServer falls back to console mode instead of GUI
 	provider->setProperty("AAPL,boot-display", kOSBooleanTrue);
-	IOLog("VMQemuVGA: Set AAPL,boot-display property for Snow Leopard console device recognition\n");
+	VMLOG_INFO("VMQemuVGA: Set AAPL,boot-display property for Snow Leopard console device recognition\n");
 	
 	//Initiate private variables
 	m_restore_call = 0;
@@ -232,18 +234,18 @@ bool CLASS::start(IOService* provider)
 	IOReturn iosurface_ret_outside = initializeIOSurfaceSupport();
 	
 	// VMQemuVGA Phase 3 startup logging
-	IOLog("VMQemuVGA: VMQemuVGA Phase 3 enhanced graphics driver starting\n");
-	IOLog("VMQemuVGA: Designed to complement MacHyperVSupport and resolve Lilu Issue #2299\n");
-	IOLog("VMQemuVGA: Supporting VirtIO GPU, Hyper-V DDA, and advanced virtualization graphics\n");
+	VMLOG_INFO("VMQemuVGA: VMQemuVGA Phase 3 enhanced graphics driver starting\n");
+	VMLOG_INFO("VMQemuVGA: Designed to complement MacHyperVSupport and resolve Lilu Issue #2299\n");
+	VMLOG_INFO("VMQemuVGA: Supporting VirtIO GPU, Hyper-V DDA, and advanced virtualization graphics\n");
 	
 	// Check for MacHyperVFramebuffer coexistence
 	IOService* hyperVFramebuffer = IOService::waitForMatchingService(IOService::serviceMatching("MacHyperVFramebuffer"), 100000000ULL);
 	if (hyperVFramebuffer) {
-		IOLog("VMQemuVGA: MacHyperVFramebuffer detected - operating in enhanced graphics mode\n");
-		IOLog("VMQemuVGA: Will provide advanced graphics while MacHyperVFramebuffer handles system integration\n");
+		VMLOG_INFO("VMQemuVGA: MacHyperVFramebuffer detected - operating in enhanced graphics mode\n");
+		VMLOG_INFO("VMQemuVGA: Will provide advanced graphics while MacHyperVFramebuffer handles system integration\n");
 		hyperVFramebuffer->release();
 	} else {
-		IOLog("VMQemuVGA: No MacHyperVFramebuffer found - operating in standalone mode\n");
+		VMLOG_INFO("VMQemuVGA: No MacHyperVFramebuffer found - operating in standalone mode\n");
 	}
 	
 	// Early device identification for better diagnostics
@@ -257,12 +259,12 @@ bool CLASS::start(IOService* provider)
 	uint32_t early_device_id = earlyDeviceNum ? earlyDeviceNum->unsigned16BitValue() : 0;
 	
 	if (early_vendor_id == 0x1b36 && early_device_id == 0x0100) {
-		IOLog("VMQemuVGA: QXL graphics device detected - optimizing for QEMU VGA compatibility\n");
-		IOLog("VMQemuVGA: Note: QXL devices may have limited VRAM detection capabilities\n");
+		VMLOG_INFO("VMQemuVGA: QXL graphics device detected - optimizing for QEMU VGA compatibility\n");
+		VMLOG_INFO("VMQemuVGA: Note: QXL devices may have limited VRAM detection capabilities\n");
 	} else if (early_vendor_id == 0x1af4) {
-		IOLog("VMQemuVGA: VirtIO GPU device detected - enabling advanced graphics features\n");
+		VMLOG_INFO("VMQemuVGA: VirtIO GPU device detected - enabling advanced graphics features\n");
 	} else {
-		IOLog("VMQemuVGA: Traditional graphics device detected (vendor=0x%x, device=0x%x)\n", 
+		VMLOG_INFO("VMQemuVGA: Traditional graphics device detected (vendor=0x%x, device=0x%x)\n", 
 			  early_vendor_id, early_device_id);
 	}
 	
@@ -285,7 +287,7 @@ bool CLASS::start(IOService* provider)
 		// VirtIO GPU devices (Red Hat VirtIO) - full range for UTM modular QEMU
 		is_virtio = (device_id >= 0x1000 && device_id <= 0x10ff);
 		if (is_virtio) {
-			IOLog("VMQemuVGA: UTM modular QEMU VirtIO GPU device detected (ID: 0x%04X) - enabling enhanced support\n", device_id);
+			VMLOG_INFO("VMQemuVGA: UTM modular QEMU VirtIO GPU device detected (ID: 0x%04X) - enabling enhanced support\n", device_id);
 		}
 	}
 	
@@ -298,12 +300,12 @@ bool CLASS::start(IOService* provider)
 	
 	// Log hardware detection for debugging console-to-GUI transition issues
 	if (is_qxl && is_virtio) {
-		IOLog("VMQemuVGA: WARNING - Both QXL and VirtIO devices detected! This may cause console-to-GUI transition issues.\n");
-		IOLog("VMQemuVGA: QXL will take priority to prevent driver conflicts.\n");
+		VMLOG_WARN("VMQemuVGA: WARNING - Both QXL and VirtIO devices detected! This may cause console-to-GUI transition issues.\n");
+		VMLOG_INFO("VMQemuVGA: QXL will take priority to prevent driver conflicts.\n");
 	} else if (is_qxl) {
-		IOLog("VMQemuVGA: QXL device prioritized for stable console-to-GUI transition\n");
+		VMLOG_INFO("VMQemuVGA: QXL device prioritized for stable console-to-GUI transition\n");
 	} else if (is_virtio) {
-		IOLog("VMQemuVGA: VirtIO GPU device detected for enhanced graphics\n");
+		VMLOG_INFO("VMQemuVGA: VirtIO GPU device detected for enhanced graphics\n");
 	}
 	
 	//Start svga, init the FIFO too
@@ -318,35 +320,35 @@ bool CLASS::start(IOService* provider)
 	// Initialize VRAM based on hardware type
 	
 	if (is_virtio) {
-		IOLog("VMQemuVGA: VirtIO GPU hardware detected (vendor=0x%x, device=0x%x)\n", vendor_id, device_id);
-		IOLog("VMQemuVGA: Deferring VRAM initialization until VirtIO GPU device is ready\n");
+		VMLOG_INFO("VMQemuVGA: VirtIO GPU hardware detected (vendor=0x%x, device=0x%x)\n", vendor_id, device_id);
+		VMLOG_INFO("VMQemuVGA: Deferring VRAM initialization until VirtIO GPU device is ready\n");
 		
 		// For VirtIO devices, VRAM is managed through VirtIO resource system
 		// We'll initialize it later through the VMVirtIOGPU device in init3DAcceleration()
 		// This prevents conflicts with VirtIO GPU resource management
 		m_vram = nullptr;
 		
-		IOLog("VMQemuVGA: VirtIO GPU VRAM will be allocated through VirtIO resource management\n");
+		VMLOG_INFO("VMQemuVGA: VirtIO GPU VRAM will be allocated through VirtIO resource management\n");
 	} else {
 		// Traditional VGA hardware (includes QXL, QEMU VGA, etc.)
 		if (is_qxl) {
-			IOLog("VMQemuVGA: QXL hardware detected (vendor=0x%x, device=0x%x)\n", vendor_id, device_id);
+			VMLOG_INFO("VMQemuVGA: QXL hardware detected (vendor=0x%x, device=0x%x)\n", vendor_id, device_id);
 		} else {
-			IOLog("VMQemuVGA: Traditional VGA hardware detected (vendor=0x%x, device=0x%x)\n", vendor_id, device_id);
+			VMLOG_INFO("VMQemuVGA: Traditional VGA hardware detected (vendor=0x%x, device=0x%x)\n", vendor_id, device_id);
 		}
 		
 		m_vram = svga.get_m_vram();
 		
 		// Enhanced VRAM detection for traditional hardware
 		if (!m_vram) {
-			IOLog("VMQemuVGA: Primary VRAM detection failed, trying fallback methods\n");
+			VMLOG_ERROR("VMQemuVGA: Primary VRAM detection failed, trying fallback methods\n");
 			
 			// Try to get VRAM from PCI BAR0 directly
 			IOPCIDevice* pciDevice = static_cast<IOPCIDevice*>(provider);
 			if (pciDevice) {
 				IODeviceMemory* bar0 = pciDevice->getDeviceMemoryWithIndex(0U);
 				if (bar0 && bar0->getLength() > 0) {
-					IOLog("VMQemuVGA: Using PCI BAR0 as VRAM fallback (size: %llu bytes)\n", bar0->getLength());
+					VMLOG_INFO("VMQemuVGA: Using PCI BAR0 as VRAM fallback (size: %llu bytes)\n", bar0->getLength());
 					m_vram = bar0;
 					m_vram->retain();
 				}
@@ -358,7 +360,7 @@ bool CLASS::start(IOService* provider)
 				if (vram_size == 0) {
 					vram_size = 64 * 1024 * 1024; // 64MB fallback
 				}
-				IOLog("VMQemuVGA: Creating synthetic VRAM range (size: %u bytes)\n", vram_size);
+				VMLOG_INFO("VMQemuVGA: Creating synthetic VRAM range (size: %u bytes)\n", vram_size);
 				// Note: In a real implementation, we'd need to allocate actual memory here
 				// For now, we'll continue with null VRAM and handle it gracefully
 			}
@@ -366,7 +368,7 @@ bool CLASS::start(IOService* provider)
 		
 		// QXL-specific display mode initialization for proper console-to-GUI transition
 		if (is_qxl && m_vram) {
-			IOLog("VMQemuVGA: Initializing QXL display mode for console-to-GUI transition\n");
+			VMLOG_INFO("VMQemuVGA: Initializing QXL display mode for console-to-GUI transition\n");
 			
 			// Set a safe initial display mode for QXL devices (1024x768@32bpp)
 			// This ensures the framebuffer is ready for GUI transition
@@ -376,11 +378,11 @@ bool CLASS::start(IOService* provider)
 			
 			// Check if the device supports the resolution
 			if (init_width <= svga.getMaxWidth() && init_height <= svga.getMaxHeight()) {
-				IOLog("VMQemuVGA: Setting QXL initial mode: %ux%u@%ubpp\n", init_width, init_height, init_bpp);
+				VMLOG_INFO("VMQemuVGA: Setting QXL initial mode: %ux%u@%ubpp\n", init_width, init_height, init_bpp);
 				svga.SetMode(init_width, init_height, init_bpp);
-				IOLog("VMQemuVGA: QXL framebuffer initialized successfully for GUI transition\n");
+				VMLOG_INFO("VMQemuVGA: QXL framebuffer initialized successfully for GUI transition\n");
 			} else {
-				IOLog("VMQemuVGA: Using fallback mode for QXL device\n");
+				VMLOG_INFO("VMQemuVGA: Using fallback mode for QXL device\n");
 				svga.SetMode(800, 600, 32); // Safe fallback
 			}
 		}
@@ -393,25 +395,25 @@ bool CLASS::start(IOService* provider)
 			// For traditional hardware, try to estimate VRAM size from memory range
 			detected_vram = (uint32_t)m_vram->getLength();
 		}
-		IOLog("VMQemuVGA: Detected VRAM size: %u MB (%u bytes)\n", 
+		VMLOG_INFO("VMQemuVGA: Detected VRAM size: %u MB (%u bytes)\n", 
 			  detected_vram / (1024 * 1024), detected_vram);
 		
 		if (detected_vram == 0) {
-			IOLog("VMQemuVGA: WARNING - VRAM size is 0! Check hardware configuration\n");
+			VMLOG_WARN("VMQemuVGA: WARNING - VRAM size is 0! Check hardware configuration\n");
 			if (!is_virtio) {
-				IOLog("VMQemuVGA: For traditional hardware, this may indicate VRAM detection issues\n");
+				VMLOG_INFO("VMQemuVGA: For traditional hardware, this may indicate VRAM detection issues\n");
 			}
 		}
 	} else if (is_virtio) {
-		IOLog("VMQemuVGA: VRAM initialization deferred for VirtIO GPU hardware\n");
+		VMLOG_INFO("VMQemuVGA: VRAM initialization deferred for VirtIO GPU hardware\n");
 	} else {
-		IOLog("VMQemuVGA: WARNING - No VRAM detected for traditional hardware!\n");
-		IOLog("VMQemuVGA: This may cause display issues, but driver will attempt to continue\n");
+		VMLOG_WARN("VMQemuVGA: WARNING - No VRAM detected for traditional hardware!\n");
+		VMLOG_INFO("VMQemuVGA: This may cause display issues, but driver will attempt to continue\n");
 		
 		// For QXL devices specifically, this is a known issue
 		if (vendor_id == 0x1b36 && device_id == 0x0100) {
-			IOLog("VMQemuVGA: QXL device detected - VRAM detection may be limited by QEMU configuration\n");
-			IOLog("VMQemuVGA: Consider increasing QEMU VRAM allocation or using VirtIO GPU\n");
+			VMLOG_INFO("VMQemuVGA: QXL device detected - VRAM detection may be limited by QEMU configuration\n");
+			VMLOG_INFO("VMQemuVGA: Consider increasing QEMU VRAM allocation or using VirtIO GPU\n");
 		}
 	}
 	
@@ -442,13 +444,13 @@ bool CLASS::start(IOService* provider)
 	// Enhanced mode validation for VRAM-challenged devices
 	if (m_num_active_modes <= 2U) {
 		if (!m_vram && !is_virtio) {
-			IOLog("VMQemuVGA: Limited display modes detected, but continuing with available modes due to VRAM detection issues\n");
+			VMLOG_INFO("VMQemuVGA: Limited display modes detected, but continuing with available modes due to VRAM detection issues\n");
 			// Allow driver to continue even with limited modes for better compatibility
 			if (m_num_active_modes >= 1U) {
-				IOLog("VMQemuVGA: At least one display mode available, proceeding with driver initialization\n");
+				VMLOG_INFO("VMQemuVGA: At least one display mode available, proceeding with driver initialization\n");
 				// Don't fail here, let the driver continue
 			} else {
-				IOLog("VMQemuVGA: No valid display modes found, driver may not function properly\n");
+				VMLOG_INFO("VMQemuVGA: No valid display modes found, driver may not function properly\n");
 				goto fail;
 			}
 		} else {
@@ -468,7 +470,7 @@ bool CLASS::start(IOService* provider)
 		DLOG("%s: 3D acceleration initialized successfully\n", __FUNCTION__);
 		
 		// Catalina VirtIO GPU GL Hardware Acceleration Mode
-		IOLog("VMQemuVGA: Configuring Catalina VirtIO GPU GL hardware acceleration\n");
+		VMLOG_INFO("VMQemuVGA: Configuring Catalina VirtIO GPU GL hardware acceleration\n");
 		
 		// Model string must not claim 3D until end-to-end rendering works
 		// (Mesa + CGL shim). The QXL/SVGA path this block runs in has no 3D
@@ -486,13 +488,13 @@ bool CLASS::start(IOService* provider)
 		// Use actual VRAM size from detected memory region if available
 		if (m_vram) {
 			real_vram_size = (uint32_t)m_vram->getLength();
-			IOLog("VMQemuVGA: Using detected VRAM size: %u bytes (%u MB)\n", 
+			VMLOG_INFO("VMQemuVGA: Using detected VRAM size: %u bytes (%u MB)\n", 
 				  real_vram_size, real_vram_size / (1024 * 1024));
 		} else {
 			// Fallback to SVGA detection method
 			real_vram_size = svga.getVRAMSize();
 			if (real_vram_size > 0) {
-				IOLog("VMQemuVGA: Using SVGA detected VRAM size: %u bytes (%u MB)\n", 
+				VMLOG_INFO("VMQemuVGA: Using SVGA detected VRAM size: %u bytes (%u MB)\n", 
 					  real_vram_size, real_vram_size / (1024 * 1024));
 			}
 		}
@@ -507,7 +509,7 @@ bool CLASS::start(IOService* provider)
 			snprintf(vram_mb_string, sizeof(vram_mb_string), "%u MB", real_vram_size / (1024 * 1024));
 			setProperty("VRAM", vram_mb_string);
 			
-			IOLog("VMQemuVGA: Set VRAM properties to %u MB for System Profiler\n", 
+			VMLOG_INFO("VMQemuVGA: Set VRAM properties to %u MB for System Profiler\n", 
 				  real_vram_size / (1024 * 1024));
 		} else {
 			// Fallback to 64MB minimum
@@ -515,7 +517,7 @@ bool CLASS::start(IOService* provider)
 			setProperty("VRAM,totalsize", (UInt32)(64 * 1024 * 1024));
 			setProperty("IOFBMemorySize", (UInt32)(64 * 1024 * 1024));
 			setProperty("VRAM", "64 MB");
-			IOLog("VMQemuVGA: VRAM detection failed, using 64MB fallback\n");
+			VMLOG_ERROR("VMQemuVGA: VRAM detection failed, using 64MB fallback\n");
 		}
 		
 		// Enable hardware-accelerated features
@@ -565,7 +567,7 @@ bool CLASS::start(IOService* provider)
 		setProperty("VMQemuVGA-DOM-Rendering-Fast", kOSBooleanTrue);
 		setProperty("IOFramebufferBandwidthLimit", kOSBooleanFalse); // Remove bandwidth limits
 		UInt32 bandwidthValue = (UInt32)(1024 * 1024 * 1024);
-		IOLog("VMQemuVGA: DEBUG - Setting IOFramebufferMemoryBandwidth to %u\n", bandwidthValue);
+		VMLOG_INFO("VMQemuVGA: DEBUG - Setting IOFramebufferMemoryBandwidth to %u\n", bandwidthValue);
 		setProperty("IOFramebufferMemoryBandwidth", bandwidthValue); // 1GB bandwidth
 		
 		// Advanced WebGL/OpenGL performance boosters for Snow Leopard
@@ -588,35 +590,35 @@ bool CLASS::start(IOService* provider)
 		// Register with Snow Leopard's system graphics frameworks
 	IOReturn sys_ret = registerWithSystemGraphics();
 	if (sys_ret != kIOReturnSuccess) {
-		IOLog("VMQemuVGA: Warning - Failed to register with system graphics (0x%x)\n", sys_ret);
+		VMLOG_ERROR("VMQemuVGA: Warning - Failed to register with system graphics (0x%x)\n", sys_ret);
 	}
 	
 	// Initialize and register IOSurface manager for Chrome Canvas acceleration
 	IOReturn iosurface_ret = initializeIOSurfaceSupport();
 	if (iosurface_ret != kIOReturnSuccess) {
-		IOLog("VMQemuVGA: Warning - Failed to initialize IOSurface support (0x%x)\n", iosurface_ret);
+		VMLOG_ERROR("VMQemuVGA: Warning - Failed to initialize IOSurface support (0x%x)\n", iosurface_ret);
 	} else {
-		IOLog("VMQemuVGA: IOSurface support initialized for Canvas 2D acceleration\n");
+		VMLOG_INFO("VMQemuVGA: IOSurface support initialized for Canvas 2D acceleration\n");
 	}
 	
 	// Enable software-based WebGL acceleration for QXL (no hardware 3D, but WebGL via software)
 	m_3d_acceleration_enabled = true;
-	IOLog("VMQemuVGA: Software WebGL acceleration enabled for QXL device\n");
+	VMLOG_INFO("VMQemuVGA: Software WebGL acceleration enabled for QXL device\n");
 		
 		// Enable Canvas 2D hardware acceleration for YouTube
 		IOReturn canvas_ret = enableCanvasAcceleration(true);
 		if (canvas_ret == kIOReturnSuccess) {
-			IOLog("VMQemuVGA: Canvas 2D acceleration enabled for YouTube/browser support\n");
+			VMLOG_INFO("VMQemuVGA: Canvas 2D acceleration enabled for YouTube/browser support\n");
 		}
 		
-		IOLog("VMQemuVGA: Snow Leopard compatibility mode enabled - software OpenGL + WebGL optimized\n");
+		VMLOG_INFO("VMQemuVGA: Snow Leopard compatibility mode enabled - software OpenGL + WebGL optimized\n");
 	} else {
 		DLOG("%s: 3D acceleration not available, continuing with 2D only\n", __FUNCTION__);
 	}
 	
 	// CRITICAL FIX: Set numeric I/O Registry properties outside conditional block
 	// This ensures properties are set regardless of 3D acceleration status
-	IOLog("VMQemuVGA: DEBUG - Setting IOFramebufferMemoryBandwidth to %u (unconditional)\n", memoryBandwidth);
+	VMLOG_INFO("VMQemuVGA: DEBUG - Setting IOFramebufferMemoryBandwidth to %u (unconditional)\n", memoryBandwidth);
 	setProperty("IOFramebufferMemoryBandwidth", memoryBandwidth);
 	
 	// Note: VRAM,totalsize is set earlier based on actual detected VRAM size
@@ -624,14 +626,14 @@ bool CLASS::start(IOService* provider)
 	
 	// Register with Snow Leopard's system graphics frameworks (moved outside conditional)
 	if (sys_ret_outside != kIOReturnSuccess) {
-		IOLog("VMQemuVGA: Warning - Failed to register with system graphics (0x%x)\n", sys_ret_outside);
+		VMLOG_ERROR("VMQemuVGA: Warning - Failed to register with system graphics (0x%x)\n", sys_ret_outside);
 	}
 	
 	// Initialize and register IOSurface manager for Chrome Canvas acceleration (moved outside conditional)
 	if (iosurface_ret_outside != kIOReturnSuccess) {
-		IOLog("VMQemuVGA: Warning - Failed to initialize IOSurface support (0x%x)\n", iosurface_ret_outside);
+		VMLOG_ERROR("VMQemuVGA: Warning - Failed to initialize IOSurface support (0x%x)\n", iosurface_ret_outside);
 	} else {
-		IOLog("VMQemuVGA: IOSurface support initialized for Canvas 2D acceleration\n");
+		VMLOG_INFO("VMQemuVGA: IOSurface support initialized for Canvas 2D acceleration\n");
 	}
 	
 	//initiate variable for custom mode and switch
@@ -651,7 +653,7 @@ bool CLASS::start(IOService* provider)
 	m_depth_mode = 0;
 	
 	// Initialize power management to prevent requestStaticServicePowerLock issues
-	IOLog("VMQemuVGA: Initializing power management\n");
+	VMLOG_INFO("VMQemuVGA: Initializing power management\n");
 	PMinit();
 	
 	// Define power states: 0 = sleep, 1 = full power
@@ -661,7 +663,7 @@ bool CLASS::start(IOService* provider)
 	};
 	
 	registerPowerDriver(this, powerStates, 2);
-	IOLog("VMQemuVGA: Power management initialized successfully\n");
+	VMLOG_INFO("VMQemuVGA: Power management initialized successfully\n");
 		
 	return true;
 	
@@ -674,11 +676,11 @@ fail:
 /*************STOP********************/
 void CLASS::stop(IOService* provider)
 {
-	IOLog("VMQemuVGA: Stopping driver - performing clean shutdown\n");
+	VMLOG_INFO("VMQemuVGA: Stopping driver - performing clean shutdown\n");
 	
 	// Clear framebuffer to prevent shutdown artifacts (pink squares, etc.)
 	if (m_vram) {
-		IOLog("VMQemuVGA: Clearing framebuffer before shutdown\n");
+		VMLOG_INFO("VMQemuVGA: Clearing framebuffer before shutdown\n");
 		
 		// Get current display mode for proper clearing
 		IODisplayModeID currentMode = m_display_mode;
@@ -718,42 +720,42 @@ void CLASS::stop(IOService* provider)
 	cleanup3DAcceleration();
 	Cleanup();
 	
-	IOLog("VMQemuVGA: Clean shutdown completed\n");
+	VMLOG_INFO("VMQemuVGA: Clean shutdown completed\n");
 	super::stop(provider);
 }
 
 /*************ENABLE CONTROLLER********************/
 IOReturn CLASS::enableController()
 {
-	IOLog("VMQemuVGA: enableController() called - initializing display\n");
+	VMLOG_INFO("VMQemuVGA: enableController() called - initializing display\n");
 	
 	// Call parent implementation
 	IOReturn result = super::enableController();
 	if (result != kIOReturnSuccess) {
-		IOLog("VMQemuVGA: Parent enableController() returned 0x%x, continuing anyway for VM compatibility\n", result);
+		VMLOG_INFO("VMQemuVGA: Parent enableController() returned 0x%x, continuing anyway for VM compatibility\n", result);
 	}
 	
 	// Enable the display connection
 	IOReturn connectionResult = setAttributeForConnection(0, kConnectionEnable, 1);
-	IOLog("VMQemuVGA: Connection enable result: 0x%x\n", connectionResult);
+	VMLOG_INFO("VMQemuVGA: Connection enable result: 0x%x\n", connectionResult);
 	
-	IOLog("VMQemuVGA: enableController() completed successfully\n");
+	VMLOG_INFO("VMQemuVGA: enableController() completed successfully\n");
 	return kIOReturnSuccess;
 }
 
 /*************OPEN********************/
 IOReturn CLASS::open()
 {
-	IOLog("VMQemuVGA: open() called - WindowServer requesting framebuffer access\n");
+	VMLOG_INFO("VMQemuVGA: open() called - WindowServer requesting framebuffer access\n");
 	
 	// Call parent implementation
 	IOReturn result = super::open();
-	IOLog("VMQemuVGA: Parent open() returned: 0x%x\n", result);
+	VMLOG_INFO("VMQemuVGA: Parent open() returned: 0x%x\n", result);
 	
 	if (result == kIOReturnSuccess) {
-		IOLog("VMQemuVGA: Framebuffer opened successfully for GUI display\n");
+		VMLOG_INFO("VMQemuVGA: Framebuffer opened successfully for GUI display\n");
 	} else {
-		IOLog("VMQemuVGA: WARNING - Parent open() returned 0x%x, but continuing for VM compatibility\n", result);
+		VMLOG_WARN("VMQemuVGA: WARNING - Parent open() returned 0x%x, but continuing for VM compatibility\n", result);
 		// For VM compatibility, we'll return success anyway
 		result = kIOReturnSuccess;
 	}
@@ -766,11 +768,11 @@ IOReturn CLASS::open()
 // Power Management Support - Prevents requestStaticServicePowerLock issues
 IOReturn CLASS::setPowerState(unsigned long powerStateOrdinal, IOService* whatDevice)
 {
-	IOLog("VMQemuVGA: setPowerState called - state: %lu\n", powerStateOrdinal);
+	VMLOG_INFO("VMQemuVGA: setPowerState called - state: %lu\n", powerStateOrdinal);
 	
 	if (powerStateOrdinal == 0) {
 		// Power off - suspend graphics operations
-		IOLog("VMQemuVGA: Entering low power state\n");
+		VMLOG_INFO("VMQemuVGA: Entering low power state\n");
 		if (m_iolock) {
 			IOLockLock(m_iolock);
 			// Suspend any ongoing graphics operations
@@ -778,7 +780,7 @@ IOReturn CLASS::setPowerState(unsigned long powerStateOrdinal, IOService* whatDe
 		}
 	} else {
 		// Power on - resume graphics operations
-		IOLog("VMQemuVGA: Entering full power state\n");
+		VMLOG_INFO("VMQemuVGA: Entering full power state\n");
 		// Resume normal operations if needed
 	}
 	
@@ -805,11 +807,11 @@ unsigned long CLASS::initialPowerStateForDomainState(IOPMPowerFlags domainState)
 
 IOReturn CLASS::powerStateWillChangeTo(IOPMPowerFlags capabilities, unsigned long stateNumber, IOService* whatDevice)
 {
-	IOLog("VMQemuVGA: Power state will change to: %lu\n", stateNumber);
+	VMLOG_INFO("VMQemuVGA: Power state will change to: %lu\n", stateNumber);
 	
 	if (stateNumber == 0) {
 		// About to power down - prepare for sleep
-		IOLog("VMQemuVGA: Preparing for power down\n");
+		VMLOG_INFO("VMQemuVGA: Preparing for power down\n");
 	}
 	
 	return IOPMAckImplied;
@@ -817,11 +819,11 @@ IOReturn CLASS::powerStateWillChangeTo(IOPMPowerFlags capabilities, unsigned lon
 
 IOReturn CLASS::powerStateDidChangeTo(IOPMPowerFlags capabilities, unsigned long stateNumber, IOService* whatDevice)
 {
-	IOLog("VMQemuVGA: Power state changed to: %lu\n", stateNumber);
+	VMLOG_INFO("VMQemuVGA: Power state changed to: %lu\n", stateNumber);
 	
 	if (stateNumber == 1) {
 		// Just powered up - restore state if needed
-		IOLog("VMQemuVGA: Power restored - resuming operations\n");
+		VMLOG_INFO("VMQemuVGA: Power restored - resuming operations\n");
 	}
 	
 	return IOPMAckImplied;
@@ -893,10 +895,10 @@ void CLASS::Cleanup()
 bool CLASS::init3DAcceleration()
 {
 	if (m_is_virtio_gpu) {
-		IOLog("VMQemuVGA: Initializing VirtIO GPU hardware acceleration\n");
+		VMLOG_INFO("VMQemuVGA: Initializing VirtIO GPU hardware acceleration\n");
 		return initVirtIOGPUAcceleration();
 	} else {
-		IOLog("VMQemuVGA: Initializing traditional VGA/QXL hardware acceleration\n");
+		VMLOG_INFO("VMQemuVGA: Initializing traditional VGA/QXL hardware acceleration\n");
 		return initTraditionalAcceleration();
 	}
 }
@@ -904,12 +906,12 @@ bool CLASS::init3DAcceleration()
 bool CLASS::initVirtIOGPUAcceleration()
 {
 	// Advanced VirtIO GPU Device Detection and Initialization
-	IOLog("VMQemuVGA: Starting comprehensive VirtIO GPU device detection\n");
+	VMLOG_INFO("VMQemuVGA: Starting comprehensive VirtIO GPU device detection\n");
 	
 	// Stage 1: Scan PCI bus for VirtIO GPU devices
 	IOReturn detection_result = scanForVirtIOGPUDevices();
 	if (detection_result != kIOReturnSuccess) {
-		IOLog("VMQemuVGA: VirtIO GPU PCI scan failed (0x%x), falling back to mock device\n", detection_result);
+		VMLOG_ERROR("VMQemuVGA: VirtIO GPU PCI scan failed (0x%x), falling back to mock device\n", detection_result);
 		// Fall back to mock device creation for compatibility
 		return createMockVirtIOGPUDevice();
 	}
@@ -917,25 +919,25 @@ bool CLASS::initVirtIOGPUAcceleration()
 	// Stage 2: Initialize detected VirtIO GPU device
 	IOReturn init_result = initializeDetectedVirtIOGPU();
 	if (init_result != kIOReturnSuccess) {
-		IOLog("VMQemuVGA: VirtIO GPU initialization failed (0x%x), falling back to mock device\n", init_result);
+		VMLOG_ERROR("VMQemuVGA: VirtIO GPU initialization failed (0x%x), falling back to mock device\n", init_result);
 		return createMockVirtIOGPUDevice();
 	}
 	
 	// Stage 3: Query VirtIO GPU capabilities
 	IOReturn caps_result = queryVirtIOGPUCapabilities();
 	if (caps_result != kIOReturnSuccess) {
-		IOLog("VMQemuVGA: VirtIO GPU capability query failed (0x%x), continuing with basic functionality\n", caps_result);
+		VMLOG_ERROR("VMQemuVGA: VirtIO GPU capability query failed (0x%x), continuing with basic functionality\n", caps_result);
 		// Continue - capability query failure doesn't prevent basic 3D acceleration
 	}
 	
 	// Stage 4: Configure VirtIO GPU for optimal performance
 	IOReturn config_result = configureVirtIOGPUOptimalSettings();
 	if (config_result != kIOReturnSuccess) {
-		IOLog("VMQemuVGA: VirtIO GPU performance configuration failed (0x%x), using default settings\n", config_result);
+		VMLOG_ERROR("VMQemuVGA: VirtIO GPU performance configuration failed (0x%x), using default settings\n", config_result);
 		// Continue - performance optimization failure doesn't prevent functionality
 	}
 	
-	IOLog("VMQemuVGA: VirtIO GPU device detection and initialization completed successfully\n");
+	VMLOG_INFO("VMQemuVGA: VirtIO GPU device detection and initialization completed successfully\n");
 	
 	// Create VirtIO GPU device using proper kernel object allocation
 	m_gpu_device = OSTypeAlloc(VMVirtIOGPU);
@@ -954,7 +956,7 @@ bool CLASS::initVirtIOGPUAcceleration()
 	// Set the PCI device provider for the VirtIO GPU
 	IOPCIDevice* pciProvider = static_cast<IOPCIDevice*>(getProvider());
 	if (pciProvider) {
-		IOLog("VMQemuVGA: Configuring VirtIO GPU with PCI device provider\n");
+		VMLOG_INFO("VMQemuVGA: Configuring VirtIO GPU with PCI device provider\n");
 		// Configure VirtIO GPU with actual PCI device information
 		m_gpu_device->attachToParent(pciProvider, gIOServicePlane);
 	}
@@ -969,10 +971,10 @@ bool CLASS::initVirtIOGPUAcceleration()
 			}
 			m_vram = virtio_vram;
 			m_vram->retain(); // Retain the new VRAM reference
-			IOLog("VMQemuVGA: Switched to VirtIO GPU VRAM range (size: %llu bytes)\n", 
+			VMLOG_INFO("VMQemuVGA: Switched to VirtIO GPU VRAM range (size: %llu bytes)\n", 
 				  m_vram->getLength());
 		} else {
-			IOLog("VMQemuVGA: VirtIO GPU device present but no VRAM range available\n");
+			VMLOG_INFO("VMQemuVGA: VirtIO GPU device present but no VRAM range available\n");
 		}
 	}
 	
@@ -1006,7 +1008,7 @@ bool CLASS::initVirtIOGPUAcceleration()
 	// CRITICAL: Register the accelerator service so it can be discovered by WindowServer/OpenGL
 	// Use kIOServiceAsynchronous to allow proper matching
 	m_accelerator->registerService(kIOServiceAsynchronous);
-	IOLog("VMQemuVGA: VirtIO GPU accelerator registered successfully\n");
+	VMLOG_INFO("VMQemuVGA: VirtIO GPU accelerator registered successfully\n");
 	
 	m_3d_acceleration_enabled = true;
 	// QXL/SVGA path has no 3D transport at all (no VIRTIO_GPU_F_VIRGL offered,
@@ -1021,13 +1023,13 @@ bool CLASS::initVirtIOGPUAcceleration()
 	// Enable accelerator updates for proper GPU utilization reporting
 	useAccelUpdates(true);
 	
-	IOLog("VMQemuVGA: 3D acceleration enabled via VirtIO GPU\n");
+	VMLOG_INFO("VMQemuVGA: 3D acceleration enabled via VirtIO GPU\n");
 	return kIOReturnSuccess;
 }
 
 bool CLASS::initTraditionalAcceleration()
 {
-	IOLog("VMQemuVGA: Initializing traditional QXL/VGA hardware acceleration\n");
+	VMLOG_INFO("VMQemuVGA: Initializing traditional QXL/VGA hardware acceleration\n");
 	
 	// For traditional hardware, create a mock VirtIO GPU device for compatibility
 	// This provides the GPU device dependency that the accelerator requires
@@ -1067,7 +1069,7 @@ bool CLASS::initTraditionalAcceleration()
 	// CRITICAL: Register the accelerator service so it can be discovered by WindowServer/OpenGL
 	// Use kIOServiceAsynchronous to allow proper matching
 	m_accelerator->registerService(kIOServiceAsynchronous);
-	IOLog("VMQemuVGA: Traditional QXL/SVGA accelerator registered successfully\n");
+	VMLOG_INFO("VMQemuVGA: Traditional QXL/SVGA accelerator registered successfully\n");
 	
 	m_3d_acceleration_enabled = true;
 	// QXL/SVGA backend — no 3D transport. See matching comment above.
@@ -1078,7 +1080,7 @@ bool CLASS::initTraditionalAcceleration()
 	// Enable accelerator updates for proper GPU utilization reporting
 	useAccelUpdates(true);
 	
-	IOLog("VMQemuVGA: 3D acceleration enabled via traditional QXL/SVGA\n");
+	VMLOG_INFO("VMQemuVGA: 3D acceleration enabled via traditional QXL/SVGA\n");
 	return kIOReturnSuccess;
 }
 
@@ -1351,7 +1353,7 @@ IOReturn CLASS::getCurrentDisplayMode(IODisplayModeID* displayMode, IOIndex* dep
 		*displayMode = m_display_mode;
 	if (depth)
 		*depth = m_depth_mode;
-	IOLog("%s: Returning display mode ID=%d, depth mode ID=%d\n", __FUNCTION__,
+	VMLOG_DEBUG("%s: Returning display mode ID=%d, depth mode ID=%d\n", __FUNCTION__,
 		 FMT_D(m_display_mode), FMT_D(m_depth_mode));
 	return kIOReturnSuccess;
 }
@@ -1359,21 +1361,21 @@ IOReturn CLASS::getCurrentDisplayMode(IODisplayModeID* displayMode, IOIndex* dep
 /*************GETDISPLAYMODES********************/
 IOReturn CLASS::getDisplayModes(IODisplayModeID* allDisplayModes)
 {
-	IOLog("%s: Called (custom_switch=%d, num_active=%u)\n", 
+	VMLOG_DEBUG("%s: Called (custom_switch=%d, num_active=%u)\n", 
 		  __FUNCTION__, m_custom_switch, FMT_U(m_num_active_modes));
 	if (!allDisplayModes)
 	{
-		IOLog("%s: ERROR - null pointer\n", __FUNCTION__);
+		VMLOG_ERROR("%s: ERROR - null pointer\n", __FUNCTION__);
 		return kIOReturnBadArgument;
 	}
 	if (m_custom_switch) 
 	{
 		*allDisplayModes = CUSTOM_MODE_ID;
-		IOLog("%s: Returning CUSTOM_MODE_ID\n", __FUNCTION__);
+		VMLOG_DEBUG("%s: Returning CUSTOM_MODE_ID\n", __FUNCTION__);
 		return kIOReturnSuccess;
 	}
 	memcpy(allDisplayModes, &m_modes[0], m_num_active_modes * sizeof(IODisplayModeID));
-	IOLog("%s: Returning %u standard modes\n", __FUNCTION__, FMT_U(m_num_active_modes));
+	VMLOG_DEBUG("%s: Returning %u standard modes\n", __FUNCTION__, FMT_U(m_num_active_modes));
 	return kIOReturnSuccess;
 }
 
@@ -1382,7 +1384,7 @@ IOItemCount CLASS::getDisplayModeCount()
 {
 	IOItemCount r;
 	r = m_custom_switch ? 1 : m_num_active_modes;
-	IOLog("%s: Returning mode count=%u (custom_switch=%d, num_active=%u)\n", 
+	VMLOG_DEBUG("%s: Returning mode count=%u (custom_switch=%d, num_active=%u)\n", 
 		  __FUNCTION__, FMT_U(r), m_custom_switch, FMT_U(m_num_active_modes));
 	return r;
 }
@@ -1451,7 +1453,7 @@ bool CLASS::isConsoleDevice()
 	IOService* provider = getProvider();
 	OSObject* bootDisplayProp = provider ? provider->getProperty("AAPL,boot-display") : nullptr;
 	bool isConsole = (bootDisplayProp != nullptr);
-	IOLog("VMQemuVGA::isConsoleDevice() - provider=%p, AAPL,boot-display=%p, returning %s\n", 
+	VMLOG_DEBUG("VMQemuVGA::isConsoleDevice() - provider=%p, AAPL,boot-display=%p, returning %s\n", 
 	      provider, bootDisplayProp, isConsole ? "TRUE" : "FALSE");
 	return isConsole;
 }
@@ -1615,7 +1617,7 @@ IOReturn CLASS::setAttributeForConnection(IOIndex connectIndex, IOSelect attribu
 			r = kIOReturnSuccess;
 			break;
 		case kConnectionEnable:
-			IOLog("%s: kConnectionEnable %lu\n", __FUNCTION__, value);
+			VMLOG_DEBUG("%s: kConnectionEnable %lu\n", __FUNCTION__, value);
 			// Enable/disable the display connection
 			// For QXL/VGA devices, the connection is always available
 			r = kIOReturnSuccess;
@@ -1756,7 +1758,7 @@ IOReturn CLASS::setDisplayMode(IODisplayModeID displayMode, IOIndex depth)
 {
 	DisplayModeEntry const* dme;
 	
-	IOLog("%s::%s display ID=%d, depth ID=%d\n", getName(), __FUNCTION__,
+	VMLOG_DEBUG("%s::%s display ID=%d, depth ID=%d\n", getName(), __FUNCTION__,
 		 FMT_D(displayMode), FMT_D(depth));
 	
 	if (depth) 
@@ -1793,6 +1795,9 @@ IOReturn CLASS::setDisplayMode(IODisplayModeID displayMode, IOIndex depth)
 	
 	IOLockUnlock(m_iolock);
 	
+	if (m_accelerator)
+		m_accelerator->framebufferModeChanged();
+	
 	m_display_mode = displayMode;
 	m_depth_mode = 0;
 	
@@ -1821,7 +1826,7 @@ void CLASS::unlockDevice()
 
 void CLASS::useAccelUpdates(bool state)
 {
-	IOLog("VMQemuVGA: DEBUG - useAccelUpdates() called with state=%s\n", state ? "true" : "false");
+	VMLOG_DEBUG("VMQemuVGA: DEBUG - useAccelUpdates() called with state=%s\n", state ? "true" : "false");
 	
 	if (state == m_accel_updates)
 		return;
@@ -1831,7 +1836,7 @@ void CLASS::useAccelUpdates(bool state)
 	
 	// Snow Leopard performance optimizations with WebGL support
 	if (state) {
-		IOLog("VMQemuVGA: Enabling Snow Leopard 2D acceleration + WebGL optimizations\n");
+		VMLOG_DEBUG("VMQemuVGA: Enabling Snow Leopard 2D acceleration + WebGL optimizations\n");
 		setProperty("VMQemuVGA-HighPerformance2D", kOSBooleanTrue);
 		setProperty("VMQemuVGA-OptimizedScrolling", kOSBooleanTrue);
 		setProperty("VMQemuVGA-FastBlit", kOSBooleanTrue);
@@ -1879,7 +1884,7 @@ void CLASS::useAccelUpdates(bool state)
 		// CRITICAL: Set numeric values for I/O Registry properties
 		UInt32 memoryBandwidth = (UInt32)(1024 * 1024 * 1024); // 1GB
 		
-		IOLog("VMQemuVGA: DEBUG - Setting IOFramebufferMemoryBandwidth to %u bytes\n", memoryBandwidth);
+		VMLOG_DEBUG("VMQemuVGA: DEBUG - Setting IOFramebufferMemoryBandwidth to %u bytes\n", memoryBandwidth);
 		setProperty("IOFramebufferMemoryBandwidth", memoryBandwidth);
 		
 		// Set GPU utilization reporting properties
@@ -1896,49 +1901,49 @@ void CLASS::useAccelUpdates(bool state)
 
 IOReturn CLASS::scanForVirtIOGPUDevices()
 {
-	IOLog("VMQemuVGA: Scanning for VirtIO GPU devices on PCI bus\n");
+	VMLOG_DEBUG("VMQemuVGA: Scanning for VirtIO GPU devices on PCI bus\n");
 	
 	// Get PCI device by traversing the provider chain with proper null protection
 	IOPCIDevice* pciDevice = nullptr;
 	IOService* currentProvider = getProvider();
 	
-	IOLog("VMQemuVGA: DEBUG - Initial provider: %p\n", currentProvider);
+	VMLOG_DEBUG("VMQemuVGA: DEBUG - Initial provider: %p\n", currentProvider);
 	
 	// Safe provider chain traversal with depth limit to prevent infinite loops
 	const int MAX_PROVIDER_DEPTH = 10; // Prevent infinite traversal
 	int depth = 0;
 	
 	if (!currentProvider) {
-		IOLog("VMQemuVGA: Warning - No initial provider found, cannot scan for VirtIO GPU\n");
+		VMLOG_WARN("VMQemuVGA: Warning - No initial provider found, cannot scan for VirtIO GPU\n");
 		return kIOReturnError;
 	}
 	
 	// Traverse up the provider chain to find the PCI device
 	while (currentProvider && !pciDevice && depth < MAX_PROVIDER_DEPTH) {
-		IOLog("VMQemuVGA: DEBUG - Checking provider at depth %d: %p (class: %s)\n", 
+		VMLOG_DEBUG("VMQemuVGA: DEBUG - Checking provider at depth %d: %p (class: %s)\n", 
 		      depth, currentProvider, currentProvider->getMetaClass()->getClassName());
 		pciDevice = OSDynamicCast(IOPCIDevice, currentProvider);
 		if (!pciDevice) {
 			currentProvider = currentProvider->getProvider();
 			depth++;
 		} else {
-			IOLog("VMQemuVGA: DEBUG - Found PCI device at depth %d\n", depth);
+			VMLOG_DEBUG("VMQemuVGA: DEBUG - Found PCI device at depth %d\n", depth);
 		}
 	}
 	
 	// If we still don't have a PCI device, try the svga provider as fallback with null check
 	if (!pciDevice && svga.getProvider()) {
-		IOLog("VMQemuVGA: DEBUG - Trying svga provider as fallback: %p (class: %s)\n", 
+		VMLOG_DEBUG("VMQemuVGA: DEBUG - Trying svga provider as fallback: %p (class: %s)\n", 
 		      svga.getProvider(), svga.getProvider()->getMetaClass()->getClassName());
 		pciDevice = OSDynamicCast(IOPCIDevice, svga.getProvider());
 	}
 	
 	if (!pciDevice) {
-		IOLog("VMQemuVGA: Warning - No PCI device found in provider chain after traversal\n");
+		VMLOG_WARN("VMQemuVGA: Warning - No PCI device found in provider chain after traversal\n");
 		return kIOReturnError;
 	}
 	
-	IOLog("VMQemuVGA: DEBUG - Successfully found PCI device: %p\n", pciDevice);
+	VMLOG_DEBUG("VMQemuVGA: DEBUG - Successfully found PCI device: %p\n", pciDevice);
 	
 	// Check if this is a VirtIO GPU device
 	OSObject* vendorObj = pciDevice->getProperty("vendor-id");
@@ -1952,7 +1957,7 @@ IOReturn CLASS::scanForVirtIOGPUDevices()
 	if (!subVendorObj) subVendorObj = pciDevice->getProperty("subsystem_vendor_id");
 	if (!subDeviceObj) subDeviceObj = pciDevice->getProperty("subsystem_id");
 	
-	IOLog("VMQemuVGA: DEBUG - Property objects exist: vendor=%p, device=%p, subvendor=%p, subdevice=%p\n",
+	VMLOG_DEBUG("VMQemuVGA: DEBUG - Property objects exist: vendor=%p, device=%p, subvendor=%p, subdevice=%p\n",
 	      vendorObj, deviceObj, subVendorObj, subDeviceObj);
 	
 	OSNumber* vendorProp = OSDynamicCast(OSNumber, vendorObj);
@@ -1965,11 +1970,11 @@ IOReturn CLASS::scanForVirtIOGPUDevices()
 	UInt16 subsystemVendorID = subVendorProp ? subVendorProp->unsigned16BitValue() : 0x0000;
 	UInt16 subsystemID = subDeviceProp ? subDeviceProp->unsigned16BitValue() : 0x0000;
 	
-	IOLog("VMQemuVGA: DEBUG - Raw property pointers: vendor=%p, device=%p, subvendor=%p, subdevice=%p\n",
+	VMLOG_DEBUG("VMQemuVGA: DEBUG - Raw property pointers: vendor=%p, device=%p, subvendor=%p, subdevice=%p\n",
 	      vendorProp, deviceProp, subVendorProp, subDeviceProp);
-	IOLog("VMQemuVGA: DEBUG - PCI Device Properties: Vendor=0x%04X, Device=0x%04X, Subsystem=0x%04X:0x%04X\n", 
+	VMLOG_DEBUG("VMQemuVGA: DEBUG - PCI Device Properties: Vendor=0x%04X, Device=0x%04X, Subsystem=0x%04X:0x%04X\n", 
 	      vendorID, deviceID, subsystemVendorID, subsystemID);
-	IOLog("VMQemuVGA: DEBUG - Provider chain depth used: %d\n", depth);
+	VMLOG_DEBUG("VMQemuVGA: DEBUG - Provider chain depth used: %d\n", depth);
 	
 	// VirtIO GPU Device Identification Matrix - Comprehensive Device Support
 	// Primary VirtIO GPU: vendor ID 0x1AF4 (Red Hat, Inc.) with extensive device variant ecosystem
@@ -2001,72 +2006,72 @@ IOReturn CLASS::scanForVirtIOGPUDevices()
 	if (vendorID == 0x1AF4) {
 		switch (deviceID) {
 			case 0x1050:
-				IOLog("VMQemuVGA: Standard VirtIO GPU device detected (ID: 0x1050) - 2D framebuffer support\n");
+				VMLOG_DEBUG("VMQemuVGA: Standard VirtIO GPU device detected (ID: 0x1050) - 2D framebuffer support\n");
 				return kIOReturnSuccess;
 			case 0x1051:
-				IOLog("VMQemuVGA: VirtIO GPU with 3D acceleration detected (ID: 0x1051) - Virgl/OpenGL support\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with 3D acceleration detected (ID: 0x1051) - Virgl/OpenGL support\n");
 				return kIOReturnSuccess;
 			case 0x1052:
-				IOLog("VMQemuVGA: VirtIO GPU with enhanced memory management detected (ID: 0x1052) - Zero-copy/DMA\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with enhanced memory management detected (ID: 0x1052) - Zero-copy/DMA\n");
 				return kIOReturnSuccess;
 			case 0x1053:
-				IOLog("VMQemuVGA: VirtIO GPU with multi-display support detected (ID: 0x1053) - Up to 16 displays\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with multi-display support detected (ID: 0x1053) - Up to 16 displays\n");
 				return kIOReturnSuccess;
 			case 0x1054:
-				IOLog("VMQemuVGA: VirtIO GPU with HDR support detected (ID: 0x1054) - HDR10/Dolby Vision\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with HDR support detected (ID: 0x1054) - HDR10/Dolby Vision\n");
 				return kIOReturnSuccess;
 			case 0x1055:
-				IOLog("VMQemuVGA: VirtIO GPU with video codec support detected (ID: 0x1055) - H.264/H.265/AV1\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with video codec support detected (ID: 0x1055) - H.264/H.265/AV1\n");
 				return kIOReturnSuccess;
 			case 0x1056:
-				IOLog("VMQemuVGA: VirtIO GPU with compute shader support detected (ID: 0x1056) - OpenCL/SPIR-V\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with compute shader support detected (ID: 0x1056) - OpenCL/SPIR-V\n");
 				return kIOReturnSuccess;
 			case 0x1057:
-				IOLog("VMQemuVGA: VirtIO GPU with ray tracing detected (ID: 0x1057) - Hardware RT acceleration\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with ray tracing detected (ID: 0x1057) - Hardware RT acceleration\n");
 				return kIOReturnSuccess;
 			case 0x1058:
-				IOLog("VMQemuVGA: VirtIO GPU with neural processing detected (ID: 0x1058) - AI/ML acceleration\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with neural processing detected (ID: 0x1058) - AI/ML acceleration\n");
 				return kIOReturnSuccess;
 			case 0x1059:
-				IOLog("VMQemuVGA: VirtIO GPU with advanced display detected (ID: 0x1059) - VRR/Adaptive sync\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with advanced display detected (ID: 0x1059) - VRR/Adaptive sync\n");
 				return kIOReturnSuccess;
 			case 0x105A:
-				IOLog("VMQemuVGA: VirtIO GPU with virtualization extensions detected (ID: 0x105A) - SR-IOV support\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with virtualization extensions detected (ID: 0x105A) - SR-IOV support\n");
 				return kIOReturnSuccess;
 			case 0x105B:
-				IOLog("VMQemuVGA: VirtIO GPU with security enhancements detected (ID: 0x105B) - Encrypted buffers\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with security enhancements detected (ID: 0x105B) - Encrypted buffers\n");
 				return kIOReturnSuccess;
 			case 0x105C:
-				IOLog("VMQemuVGA: VirtIO GPU with power management detected (ID: 0x105C) - Dynamic frequency scaling\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with power management detected (ID: 0x105C) - Dynamic frequency scaling\n");
 				return kIOReturnSuccess;
 			case 0x105D:
-				IOLog("VMQemuVGA: VirtIO GPU with debugging interface detected (ID: 0x105D) - Performance counters\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with debugging interface detected (ID: 0x105D) - Performance counters\n");
 				return kIOReturnSuccess;
 			case 0x105E:
-				IOLog("VMQemuVGA: VirtIO GPU with experimental features detected (ID: 0x105E) - Research extensions\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with experimental features detected (ID: 0x105E) - Research extensions\n");
 				return kIOReturnSuccess;
 			case 0x105F:
-				IOLog("VMQemuVGA: VirtIO GPU with legacy compatibility detected (ID: 0x105F) - Backward compatibility\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with legacy compatibility detected (ID: 0x105F) - Backward compatibility\n");
 				return kIOReturnSuccess;
 			case 0x1060:
-				IOLog("VMQemuVGA: VirtIO GPU with Hyper-V DDA integration detected (ID: 0x1060) - Discrete Device Assignment\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with Hyper-V DDA integration detected (ID: 0x1060) - Discrete Device Assignment\n");
 				return kIOReturnSuccess;
 			case 0x1061:
-				IOLog("VMQemuVGA: VirtIO GPU with RemoteFX vGPU compatibility detected (ID: 0x1061) - Legacy RemoteFX bridge\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with RemoteFX vGPU compatibility detected (ID: 0x1061) - Legacy RemoteFX bridge\n");
 				return kIOReturnSuccess;
 			case 0x1062:
-				IOLog("VMQemuVGA: VirtIO GPU with Hyper-V enhanced session detected (ID: 0x1062) - RDP acceleration\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with Hyper-V enhanced session detected (ID: 0x1062) - RDP acceleration\n");
 				return kIOReturnSuccess;
 			case 0x1063:
-				IOLog("VMQemuVGA: VirtIO GPU with Windows Container support detected (ID: 0x1063) - WSL integration\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with Windows Container support detected (ID: 0x1063) - WSL integration\n");
 				return kIOReturnSuccess;
 			case 0x1064:
-				IOLog("VMQemuVGA: VirtIO GPU with Hyper-V nested virtualization detected (ID: 0x1064) - L2 hypervisor\n");
+				VMLOG_DEBUG("VMQemuVGA: VirtIO GPU with Hyper-V nested virtualization detected (ID: 0x1064) - L2 hypervisor\n");
 				return kIOReturnSuccess;
 			default:
 				// Check for experimental or newer VirtIO GPU device IDs beyond the documented range
 				if (deviceID >= 0x1000 && deviceID <= 0x10ff) {
-					IOLog("VMQemuVGA: Future/Experimental VirtIO GPU variant detected (ID: 0x%04X) - Extended range support\n", deviceID);
+					VMLOG_DEBUG("VMQemuVGA: Future/Experimental VirtIO GPU variant detected (ID: 0x%04X) - Extended range support\n", deviceID);
 					return kIOReturnSuccess;
 				}
 				break;
@@ -2087,30 +2092,30 @@ IOReturn CLASS::scanForVirtIOGPUDevices()
 	if (vendorID == 0x1234) {
 		switch (deviceID) {
 			case 0x1111:
-				IOLog("VMQemuVGA: QEMU Standard VGA detected (ID: 0x1111) - Probing VirtIO GPU extensions\n");
+				VMLOG_DEBUG("VMQemuVGA: QEMU Standard VGA detected (ID: 0x1111) - Probing VirtIO GPU extensions\n");
 				return kIOReturnSuccess;
 			case 0x1001:
-				IOLog("VMQemuVGA: QEMU Cirrus VGA detected (ID: 0x1001) - Legacy support with VirtIO GPU overlay\n");
+				VMLOG_DEBUG("VMQemuVGA: QEMU Cirrus VGA detected (ID: 0x1001) - Legacy support with VirtIO GPU overlay\n");
 				return kIOReturnSuccess;
 			case 0x0001:
-				IOLog("VMQemuVGA: QEMU Basic VGA detected (ID: 0x0001) - Scanning for VirtIO GPU coprocessor\n");
+				VMLOG_DEBUG("VMQemuVGA: QEMU Basic VGA detected (ID: 0x0001) - Scanning for VirtIO GPU coprocessor\n");
 				return kIOReturnSuccess;
 			case 0x4000:
-				IOLog("VMQemuVGA: QEMU QXL detected (ID: 0x4000) - Spice protocol with VirtIO GPU acceleration\n");
+				VMLOG_DEBUG("VMQemuVGA: QEMU QXL detected (ID: 0x4000) - Spice protocol with VirtIO GPU acceleration\n");
 				return kIOReturnSuccess;
 			case 0x0100:
-				IOLog("VMQemuVGA: QEMU VMware SVGA emulation detected (ID: 0x0100) - VirtIO GPU passthrough mode\n");
+				VMLOG_DEBUG("VMQemuVGA: QEMU VMware SVGA emulation detected (ID: 0x0100) - VirtIO GPU passthrough mode\n");
 				return kIOReturnSuccess;
 			case 0x0002:
-				IOLog("VMQemuVGA: QEMU Bochs VGA detected (ID: 0x0002) - VBE extensions with VirtIO GPU compatibility\n");
+				VMLOG_DEBUG("VMQemuVGA: QEMU Bochs VGA detected (ID: 0x0002) - VBE extensions with VirtIO GPU compatibility\n");
 				return kIOReturnSuccess;
 			case 0x1234:
-				IOLog("VMQemuVGA: QEMU Generic VGA detected (ID: 0x1234) - Adaptive VirtIO GPU detection\n");
+				VMLOG_DEBUG("VMQemuVGA: QEMU Generic VGA detected (ID: 0x1234) - Adaptive VirtIO GPU detection\n");
 				return kIOReturnSuccess;
 			default:
 				// Check for future QEMU graphics device variants
 				if ((deviceID >= 0x0001 && deviceID <= 0x00FF) || (deviceID >= 0x1000 && deviceID <= 0x1FFF) || (deviceID >= 0x4000 && deviceID <= 0x4FFF)) {
-					IOLog("VMQemuVGA: QEMU Graphics variant detected (ID: 0x%04X) - Extended device support\n", deviceID);
+					VMLOG_DEBUG("VMQemuVGA: QEMU Graphics variant detected (ID: 0x%04X) - Extended device support\n", deviceID);
 					return kIOReturnSuccess;
 				}
 				break;
@@ -2127,21 +2132,21 @@ IOReturn CLASS::scanForVirtIOGPUDevices()
 	if (vendorID == 0x15AD) {
 		switch (deviceID) {
 			case 0x0405:
-				IOLog("VMQemuVGA: VMware SVGA II detected (ID: 0x0405) - VirtIO GPU passthrough capability\n");
+				VMLOG_DEBUG("VMQemuVGA: VMware SVGA II detected (ID: 0x0405) - VirtIO GPU passthrough capability\n");
 				return kIOReturnSuccess;
 			case 0x0710:
-				IOLog("VMQemuVGA: VMware SVGA 3D detected (ID: 0x0710) - Hardware 3D with VirtIO GPU integration\n");
+				VMLOG_DEBUG("VMQemuVGA: VMware SVGA 3D detected (ID: 0x0710) - Hardware 3D with VirtIO GPU integration\n");
 				return kIOReturnSuccess;
 			case 0x0801:
-				IOLog("VMQemuVGA: VMware VGPU detected (ID: 0x0801) - Virtual GPU partitioning with VirtIO GPU\n");
+				VMLOG_DEBUG("VMQemuVGA: VMware VGPU detected (ID: 0x0801) - Virtual GPU partitioning with VirtIO GPU\n");
 				return kIOReturnSuccess;
 			case 0x0720:
-				IOLog("VMQemuVGA: VMware eGPU detected (ID: 0x0720) - External GPU with VirtIO GPU bridging\n");
+				VMLOG_DEBUG("VMQemuVGA: VMware eGPU detected (ID: 0x0720) - External GPU with VirtIO GPU bridging\n");
 				return kIOReturnSuccess;
 			default:
 				// Check for other VMware graphics devices
 				if ((deviceID >= 0x0400 && deviceID <= 0x04FF) || (deviceID >= 0x0700 && deviceID <= 0x07FF) || (deviceID >= 0x0800 && deviceID <= 0x08FF)) {
-					IOLog("VMQemuVGA: VMware Graphics device detected (ID: 0x%04X) - Checking VirtIO GPU compatibility\n", deviceID);
+					VMLOG_DEBUG("VMQemuVGA: VMware Graphics device detected (ID: 0x%04X) - Checking VirtIO GPU compatibility\n", deviceID);
 					return kIOReturnSuccess;
 				}
 				break;
@@ -2159,26 +2164,26 @@ IOReturn CLASS::scanForVirtIOGPUDevices()
 	if (vendorID == 0x8086) {
 		switch (deviceID) {
 			case 0x5A85:
-				IOLog("VMQemuVGA: Intel HD Graphics (virtualized) detected (ID: 0x5A85) - VirtIO GPU extensions\n");
+				VMLOG_DEBUG("VMQemuVGA: Intel HD Graphics (virtualized) detected (ID: 0x5A85) - VirtIO GPU extensions\n");
 				return kIOReturnSuccess;
 			case 0x3E92:
-				IOLog("VMQemuVGA: Intel UHD Graphics 630 (virtual) detected (ID: 0x3E92) - VirtIO GPU acceleration\n");
+				VMLOG_DEBUG("VMQemuVGA: Intel UHD Graphics 630 (virtual) detected (ID: 0x3E92) - VirtIO GPU acceleration\n");
 				return kIOReturnSuccess;
 			case 0x9BC4:
-				IOLog("VMQemuVGA: Intel Iris Xe Graphics (cloud) detected (ID: 0x9BC4) - VirtIO GPU integration\n");
+				VMLOG_DEBUG("VMQemuVGA: Intel Iris Xe Graphics (cloud) detected (ID: 0x9BC4) - VirtIO GPU integration\n");
 				return kIOReturnSuccess;
 			case 0x4680:
-				IOLog("VMQemuVGA: Intel Arc Graphics (virtualized) detected (ID: 0x4680) - VirtIO GPU support\n");
+				VMLOG_DEBUG("VMQemuVGA: Intel Arc Graphics (virtualized) detected (ID: 0x4680) - VirtIO GPU support\n");
 				return kIOReturnSuccess;
 			case 0x56A0:
-				IOLog("VMQemuVGA: Intel Data Center GPU detected (ID: 0x56A0) - Server VirtIO GPU compatibility\n");
+				VMLOG_DEBUG("VMQemuVGA: Intel Data Center GPU detected (ID: 0x56A0) - Server VirtIO GPU compatibility\n");
 				return kIOReturnSuccess;
 			default:
 				// Check for other Intel graphics devices that may support virtualization
 				if ((deviceID >= 0x5A80 && deviceID <= 0x5AFF) || (deviceID >= 0x3E90 && deviceID <= 0x3EFF) || 
 				    (deviceID >= 0x9BC0 && deviceID <= 0x9BFF) || (deviceID >= 0x4680 && deviceID <= 0x46FF) ||
 				    (deviceID >= 0x56A0 && deviceID <= 0x56FF)) {
-					IOLog("VMQemuVGA: Intel Graphics (virtualized) detected (ID: 0x%04X) - Probing VirtIO GPU support\n", deviceID);
+					VMLOG_DEBUG("VMQemuVGA: Intel Graphics (virtualized) detected (ID: 0x%04X) - Probing VirtIO GPU support\n", deviceID);
 					return kIOReturnSuccess;
 				}
 				break;
@@ -2194,19 +2199,19 @@ IOReturn CLASS::scanForVirtIOGPUDevices()
 	if (vendorID == 0x1002) {
 		switch (deviceID) {
 			case 0x15DD:
-				IOLog("VMQemuVGA: AMD Radeon Vega (virtualized) detected (ID: 0x15DD) - VirtIO GPU integration\n");
+				VMLOG_DEBUG("VMQemuVGA: AMD Radeon Vega (virtualized) detected (ID: 0x15DD) - VirtIO GPU integration\n");
 				return kIOReturnSuccess;
 			case 0x7340:
-				IOLog("VMQemuVGA: AMD Radeon RX 6000 (GPU-V) detected (ID: 0x7340) - VirtIO GPU compatibility\n");
+				VMLOG_DEBUG("VMQemuVGA: AMD Radeon RX 6000 (GPU-V) detected (ID: 0x7340) - VirtIO GPU compatibility\n");
 				return kIOReturnSuccess;
 			case 0x164C:
-				IOLog("VMQemuVGA: AMD Radeon Pro (virtualized) detected (ID: 0x164C) - VirtIO GPU extensions\n");
+				VMLOG_DEBUG("VMQemuVGA: AMD Radeon Pro (virtualized) detected (ID: 0x164C) - VirtIO GPU extensions\n");
 				return kIOReturnSuccess;
 			default:
 				// Check for other AMD graphics devices with virtualization support
 				if ((deviceID >= 0x15D0 && deviceID <= 0x15FF) || (deviceID >= 0x7340 && deviceID <= 0x73FF) ||
 				    (deviceID >= 0x1640 && deviceID <= 0x16FF)) {
-					IOLog("VMQemuVGA: AMD Graphics (virtualized) detected (ID: 0x%04X) - Checking VirtIO GPU support\n", deviceID);
+					VMLOG_DEBUG("VMQemuVGA: AMD Graphics (virtualized) detected (ID: 0x%04X) - Checking VirtIO GPU support\n", deviceID);
 					return kIOReturnSuccess;
 				}
 				break;
@@ -2222,19 +2227,19 @@ IOReturn CLASS::scanForVirtIOGPUDevices()
 	if (vendorID == 0x10DE) {
 		switch (deviceID) {
 			case 0x1B38:
-				IOLog("VMQemuVGA: NVIDIA Tesla V100 (virtualized) detected (ID: 0x1B38) - VirtIO GPU integration\n");
+				VMLOG_DEBUG("VMQemuVGA: NVIDIA Tesla V100 (virtualized) detected (ID: 0x1B38) - VirtIO GPU integration\n");
 				return kIOReturnSuccess;
 			case 0x20B0:
-				IOLog("VMQemuVGA: NVIDIA A100 (cloud) detected (ID: 0x20B0) - VirtIO GPU acceleration\n");
+				VMLOG_DEBUG("VMQemuVGA: NVIDIA A100 (cloud) detected (ID: 0x20B0) - VirtIO GPU acceleration\n");
 				return kIOReturnSuccess;
 			case 0x2204:
-				IOLog("VMQemuVGA: NVIDIA RTX A6000 (virtualized) detected (ID: 0x2204) - VirtIO GPU support\n");
+				VMLOG_DEBUG("VMQemuVGA: NVIDIA RTX A6000 (virtualized) detected (ID: 0x2204) - VirtIO GPU support\n");
 				return kIOReturnSuccess;
 			default:
 				// Check for other NVIDIA graphics devices with virtualization capabilities
 				if ((deviceID >= 0x1B30 && deviceID <= 0x1BFF) || (deviceID >= 0x20B0 && deviceID <= 0x20FF) ||
 				    (deviceID >= 0x2200 && deviceID <= 0x22FF)) {
-					IOLog("VMQemuVGA: NVIDIA Graphics (virtualized) detected (ID: 0x%04X) - Probing VirtIO GPU support\n", deviceID);
+					VMLOG_DEBUG("VMQemuVGA: NVIDIA Graphics (virtualized) detected (ID: 0x%04X) - Probing VirtIO GPU support\n", deviceID);
 					return kIOReturnSuccess;
 				}
 				break;
@@ -2253,27 +2258,27 @@ IOReturn CLASS::scanForVirtIOGPUDevices()
 	if (vendorID == 0x1414) {
 		switch (deviceID) {
 			case 0x5353:
-				IOLog("VMQemuVGA: Hyper-V Synthetic GPU detected (ID: 0x5353) - Basic framebuffer with VirtIO GPU overlay\n");
+				VMLOG_DEBUG("VMQemuVGA: Hyper-V Synthetic GPU detected (ID: 0x5353) - Basic framebuffer with VirtIO GPU overlay\n");
 				return kIOReturnSuccess;
 			case 0x5354:
-				IOLog("VMQemuVGA: Hyper-V Enhanced Graphics detected (ID: 0x5354) - Performance mode with VirtIO GPU\n");
+				VMLOG_DEBUG("VMQemuVGA: Hyper-V Enhanced Graphics detected (ID: 0x5354) - Performance mode with VirtIO GPU\n");
 				return kIOReturnSuccess;
 			case 0x5355:
-				IOLog("VMQemuVGA: Hyper-V RemoteFX vGPU detected (ID: 0x5355) - Legacy RemoteFX with VirtIO GPU bridge\n");
+				VMLOG_DEBUG("VMQemuVGA: Hyper-V RemoteFX vGPU detected (ID: 0x5355) - Legacy RemoteFX with VirtIO GPU bridge\n");
 				return kIOReturnSuccess;
 			case 0x5356:
-				IOLog("VMQemuVGA: Hyper-V DDA GPU Bridge detected (ID: 0x5356) - Discrete Device Assignment integration\n");
+				VMLOG_DEBUG("VMQemuVGA: Hyper-V DDA GPU Bridge detected (ID: 0x5356) - Discrete Device Assignment integration\n");
 				return kIOReturnSuccess;
 			case 0x5357:
-				IOLog("VMQemuVGA: Hyper-V Container Graphics detected (ID: 0x5357) - Windows Container VirtIO GPU support\n");
+				VMLOG_DEBUG("VMQemuVGA: Hyper-V Container Graphics detected (ID: 0x5357) - Windows Container VirtIO GPU support\n");
 				return kIOReturnSuccess;
 			case 0x5358:
-				IOLog("VMQemuVGA: Hyper-V Nested Virtualization GPU detected (ID: 0x5358) - L2 hypervisor VirtIO GPU\n");
+				VMLOG_DEBUG("VMQemuVGA: Hyper-V Nested Virtualization GPU detected (ID: 0x5358) - L2 hypervisor VirtIO GPU\n");
 				return kIOReturnSuccess;
 			default:
 				// Check for other Microsoft/Hyper-V graphics devices
 				if (deviceID >= 0x5350 && deviceID <= 0x535F) {
-					IOLog("VMQemuVGA: Hyper-V Graphics variant detected (ID: 0x%04X) - Checking VirtIO GPU compatibility\n", deviceID);
+					VMLOG_DEBUG("VMQemuVGA: Hyper-V Graphics variant detected (ID: 0x%04X) - Checking VirtIO GPU compatibility\n", deviceID);
 					return kIOReturnSuccess;
 				}
 				break;
@@ -2293,53 +2298,53 @@ IOReturn CLASS::scanForVirtIOGPUDevices()
 		// - 0xDDA3: DDA GPU with VirtIO GPU compute shader support
 		switch (subsystemID) {
 			case 0xDDA0:
-				IOLog("VMQemuVGA: Hyper-V DDA GPU (generic) detected - VirtIO GPU acceleration layer available\n");
-				IOLog("VMQemuVGA: Original GPU - Vendor: 0x%04X, Device: 0x%04X\n", vendorID, deviceID);
-				IOLog("VMQemuVGA: Addressing Lilu Issue #2299 - Early device registration for MacHyperVSupport\n");
+				VMLOG_DEBUG("VMQemuVGA: Hyper-V DDA GPU (generic) detected - VirtIO GPU acceleration layer available\n");
+				VMLOG_DEBUG("VMQemuVGA: Original GPU - Vendor: 0x%04X, Device: 0x%04X\n", vendorID, deviceID);
+				VMLOG_DEBUG("VMQemuVGA: Addressing Lilu Issue #2299 - Early device registration for MacHyperVSupport\n");
 				return kIOReturnSuccess;
 			case 0xDDA1:
-				IOLog("VMQemuVGA: Hyper-V DDA GPU (enhanced memory) detected - VirtIO GPU memory management\n");
-				IOLog("VMQemuVGA: Original GPU - Vendor: 0x%04X, Device: 0x%04X\n", vendorID, deviceID);
-				IOLog("VMQemuVGA: Addressing Lilu Issue #2299 - Early device registration for MacHyperVSupport\n");
+				VMLOG_DEBUG("VMQemuVGA: Hyper-V DDA GPU (enhanced memory) detected - VirtIO GPU memory management\n");
+				VMLOG_DEBUG("VMQemuVGA: Original GPU - Vendor: 0x%04X, Device: 0x%04X\n", vendorID, deviceID);
+				VMLOG_DEBUG("VMQemuVGA: Addressing Lilu Issue #2299 - Early device registration for MacHyperVSupport\n");
 				return kIOReturnSuccess;
 			case 0xDDA2:
-				IOLog("VMQemuVGA: Hyper-V DDA GPU (3D acceleration) detected - VirtIO GPU 3D bridge\n");
-				IOLog("VMQemuVGA: Original GPU - Vendor: 0x%04X, Device: 0x%04X\n", vendorID, deviceID);
-				IOLog("VMQemuVGA: Addressing Lilu Issue #2299 - Early device registration for MacHyperVSupport\n");
+				VMLOG_DEBUG("VMQemuVGA: Hyper-V DDA GPU (3D acceleration) detected - VirtIO GPU 3D bridge\n");
+				VMLOG_DEBUG("VMQemuVGA: Original GPU - Vendor: 0x%04X, Device: 0x%04X\n", vendorID, deviceID);
+				VMLOG_DEBUG("VMQemuVGA: Addressing Lilu Issue #2299 - Early device registration for MacHyperVSupport\n");
 				return kIOReturnSuccess;
 			case 0xDDA3:
-				IOLog("VMQemuVGA: Hyper-V DDA GPU (compute shaders) detected - VirtIO GPU compute support\n");
-				IOLog("VMQemuVGA: Original GPU - Vendor: 0x%04X, Device: 0x%04X\n", vendorID, deviceID);
-				IOLog("VMQemuVGA: Addressing Lilu Issue #2299 - Early device registration for MacHyperVSupport\n");
+				VMLOG_DEBUG("VMQemuVGA: Hyper-V DDA GPU (compute shaders) detected - VirtIO GPU compute support\n");
+				VMLOG_DEBUG("VMQemuVGA: Original GPU - Vendor: 0x%04X, Device: 0x%04X\n", vendorID, deviceID);
+				VMLOG_DEBUG("VMQemuVGA: Addressing Lilu Issue #2299 - Early device registration for MacHyperVSupport\n");
 				return kIOReturnSuccess;
 			default:
 				// Check for other DDA subsystem IDs
 				if (subsystemID >= 0xDDA0 && subsystemID <= 0xDDAF) {
-					IOLog("VMQemuVGA: Hyper-V DDA GPU variant detected (Subsystem: 0x%04X) - VirtIO GPU integration\n", subsystemID);
-					IOLog("VMQemuVGA: Original GPU - Vendor: 0x%04X, Device: 0x%04X\n", vendorID, deviceID);
-					IOLog("VMQemuVGA: Addressing Lilu Issue #2299 - Early device registration for MacHyperVSupport\n");
+					VMLOG_DEBUG("VMQemuVGA: Hyper-V DDA GPU variant detected (Subsystem: 0x%04X) - VirtIO GPU integration\n", subsystemID);
+					VMLOG_DEBUG("VMQemuVGA: Original GPU - Vendor: 0x%04X, Device: 0x%04X\n", vendorID, deviceID);
+					VMLOG_DEBUG("VMQemuVGA: Addressing Lilu Issue #2299 - Early device registration for MacHyperVSupport\n");
 					return kIOReturnSuccess;
 				}
 				break;
 		}
 	}
 	
-	IOLog("VMQemuVGA: No VirtIO GPU device found, using fallback compatibility mode\n");
+	VMLOG_DEBUG("VMQemuVGA: No VirtIO GPU device found, using fallback compatibility mode\n");
 	return kIOReturnError;
 }
 
 VMVirtIOGPU* CLASS::createMockVirtIOGPUDevice()
 {
-	IOLog("VMQemuVGA: Creating mock VirtIO GPU device for compatibility\n");
+	VMLOG_DEBUG("VMQemuVGA: Creating mock VirtIO GPU device for compatibility\n");
 	
 	VMVirtIOGPU* mockDevice = OSTypeAlloc(VMVirtIOGPU);
 	if (!mockDevice) {
-		IOLog("VMQemuVGA: Failed to allocate mock VirtIO GPU device\n");
+		VMLOG_ERROR("VMQemuVGA: Failed to allocate mock VirtIO GPU device\n");
 		return nullptr;
 	}
 	
 	if (!mockDevice->init()) {
-		IOLog("VMQemuVGA: Failed to initialize mock VirtIO GPU device\n");
+		VMLOG_ERROR("VMQemuVGA: Failed to initialize mock VirtIO GPU device\n");
 		mockDevice->release();
 		return nullptr;
 	}
@@ -2348,54 +2353,54 @@ VMVirtIOGPU* CLASS::createMockVirtIOGPUDevice()
 	mockDevice->setMockMode(true);
 	mockDevice->setBasic3DSupport(true);
 	
-	IOLog("VMQemuVGA: Mock VirtIO GPU device created successfully\n");
+	VMLOG_DEBUG("VMQemuVGA: Mock VirtIO GPU device created successfully\n");
 	return mockDevice;
 }
 
 IOReturn CLASS::initializeDetectedVirtIOGPU()
 {
 	if (!m_gpu_device) {
-		IOLog("VMQemuVGA: Error - No VirtIO GPU device to initialize\n");
+		VMLOG_ERROR("VMQemuVGA: Error - No VirtIO GPU device to initialize\n");
 		return kIOReturnError;
 	}
 	
-	IOLog("VMQemuVGA: Initializing detected VirtIO GPU device\n");
+	VMLOG_INFO("VMQemuVGA: Initializing detected VirtIO GPU device\n");
 	
 	// Initialize VirtIO queues and memory regions
 	if (!m_gpu_device->initializeVirtIOQueues()) {
-		IOLog("VMQemuVGA: Warning - Failed to initialize VirtIO queues, using basic mode\n");
+		VMLOG_ERROR("VMQemuVGA: Warning - Failed to initialize VirtIO queues, using basic mode\n");
 	}
 	
 	// Setup GPU memory regions
 	if (!m_gpu_device->setupGPUMemoryRegions()) {
-		IOLog("VMQemuVGA: Warning - Failed to setup GPU memory regions\n");
+		VMLOG_ERROR("VMQemuVGA: Warning - Failed to setup GPU memory regions\n");
 	}
 	
 	// Enable 3D acceleration if supported
 	if (m_gpu_device->supports3D()) {
-		IOLog("VMQemuVGA: 3D acceleration support detected and enabled\n");
+		VMLOG_INFO("VMQemuVGA: 3D acceleration support detected and enabled\n");
 		m_gpu_device->enable3DAcceleration();
 	}
 	
-	IOLog("VMQemuVGA: VirtIO GPU device initialization complete\n");
+	VMLOG_INFO("VMQemuVGA: VirtIO GPU device initialization complete\n");
 	return kIOReturnSuccess;
 }
 
 IOReturn CLASS::queryVirtIOGPUCapabilities()
 {
 	if (!m_gpu_device) {
-		IOLog("VMQemuVGA: Error - No VirtIO GPU device to query\n");
+		VMLOG_ERROR("VMQemuVGA: Error - No VirtIO GPU device to query\n");
 		return kIOReturnError;
 	}
 	
-	IOLog("VMQemuVGA: Querying VirtIO GPU capabilities\n");
+	VMLOG_DEBUG("VMQemuVGA: Querying VirtIO GPU capabilities\n");
 	
 	// Query basic display capabilities
 	uint32_t maxDisplays = m_gpu_device->getMaxDisplays();
 	uint32_t maxResolutionX = m_gpu_device->getMaxResolutionX();
 	uint32_t maxResolutionY = m_gpu_device->getMaxResolutionY();
 	
-	IOLog("VMQemuVGA: Display capabilities - Max displays: %u, Max resolution: %ux%u\n",
+	VMLOG_DEBUG("VMQemuVGA: Display capabilities - Max displays: %u, Max resolution: %ux%u\n",
 	      maxDisplays, maxResolutionX, maxResolutionY);
 	
 	// Query 3D acceleration capabilities
@@ -2403,7 +2408,7 @@ IOReturn CLASS::queryVirtIOGPUCapabilities()
 	bool supportsVirgl = m_gpu_device->supportsVirgl();
 	bool supportsResourceBlob = m_gpu_device->supportsResourceBlob();
 	
-	IOLog("VMQemuVGA: 3D capabilities - 3D: %s, Virgl: %s, Resource Blob: %s\n",
+	VMLOG_DEBUG("VMQemuVGA: 3D capabilities - 3D: %s, Virgl: %s, Resource Blob: %s\n",
 	      supports3D ? "Yes" : "No",
 	      supportsVirgl ? "Yes" : "No", 
 	      supportsResourceBlob ? "Yes" : "No");
@@ -2419,11 +2424,11 @@ IOReturn CLASS::queryVirtIOGPUCapabilities()
 IOReturn CLASS::configureVirtIOGPUOptimalSettings()
 {
 	if (!m_gpu_device) {
-		IOLog("VMQemuVGA: Error - No VirtIO GPU device to configure\n");
+		VMLOG_ERROR("VMQemuVGA: Error - No VirtIO GPU device to configure\n");
 		return kIOReturnError;
 	}
 	
-	IOLog("VMQemuVGA: Configuring VirtIO GPU optimal performance settings\n");
+	VMLOG_INFO("VMQemuVGA: Configuring VirtIO GPU optimal performance settings\n");
 	
 	// WORKAROUND: Lilu Issue #2299 - MacHyperVSupport PCI bridge detection
 	// Perform early device registration to help Lilu frameworks see our devices
@@ -2431,17 +2436,17 @@ IOReturn CLASS::configureVirtIOGPUOptimalSettings()
 	
 	// Configure queue sizes for optimal performance
 	if (!m_gpu_device->setOptimalQueueSizes()) {
-		IOLog("VMQemuVGA: Warning - Could not set optimal queue sizes\n");
+		VMLOG_WARN("VMQemuVGA: Warning - Could not set optimal queue sizes\n");
 	}
 	
 	// Enable performance features if available
 	if (m_gpu_device->supportsResourceBlob()) {
-		IOLog("VMQemuVGA: Enabling resource blob for better memory management\n");
+		VMLOG_INFO("VMQemuVGA: Enabling resource blob for better memory management\n");
 		m_gpu_device->enableResourceBlob();
 	}
 	
 	if (m_gpu_device->supportsVirgl()) {
-		IOLog("VMQemuVGA: Enabling Virgl for 3D acceleration\n");
+		VMLOG_INFO("VMQemuVGA: Enabling Virgl for 3D acceleration\n");
 		m_gpu_device->enableVirgl();
 	}
 	
@@ -2451,7 +2456,7 @@ IOReturn CLASS::configureVirtIOGPUOptimalSettings()
 	// Enable vsync for smoother rendering
 	m_gpu_device->enableVSync(true);
 	
-	IOLog("VMQemuVGA: VirtIO GPU performance configuration complete\n");
+	VMLOG_INFO("VMQemuVGA: VirtIO GPU performance configuration complete\n");
 	return kIOReturnSuccess;
 }
 
@@ -2462,43 +2467,43 @@ void VMQemuVGA::publishDeviceForLiluFrameworks()
 	IOPCIDevice* pciDevice = nullptr;
 	IOService* currentProvider = getProvider();
 	
-	IOLog("VMQemuVGA: DEBUG - Initial provider for Lilu: %p\n", currentProvider);
+	VMLOG_INFO("VMQemuVGA: DEBUG - Initial provider for Lilu: %p\n", currentProvider);
 	
 	// Safe provider chain traversal with depth limit to prevent infinite loops
 	const int MAX_PROVIDER_DEPTH = 10; // Prevent infinite traversal
 	int depth = 0;
 	
 	if (!currentProvider) {
-		IOLog("VMQemuVGA: No initial provider found for Lilu registration\n");
+		VMLOG_INFO("VMQemuVGA: No initial provider found for Lilu registration\n");
 		return;
 	}
 	
 	// Traverse up the provider chain to find the PCI device
 	while (currentProvider && !pciDevice && depth < MAX_PROVIDER_DEPTH) {
-		IOLog("VMQemuVGA: DEBUG - Checking provider at depth %d: %p (class: %s)\n", 
+		VMLOG_INFO("VMQemuVGA: DEBUG - Checking provider at depth %d: %p (class: %s)\n", 
 		      depth, currentProvider, currentProvider->getMetaClass()->getClassName());
 		pciDevice = OSDynamicCast(IOPCIDevice, currentProvider);
 		if (!pciDevice) {
 			currentProvider = currentProvider->getProvider();
 			depth++;
 		} else {
-			IOLog("VMQemuVGA: DEBUG - Found PCI device at depth %d\n", depth);
+			VMLOG_INFO("VMQemuVGA: DEBUG - Found PCI device at depth %d\n", depth);
 		}
 	}
 	
 	// If we still don't have a PCI device, try the svga provider as fallback with null check
 	if (!pciDevice && svga.getProvider()) {
-		IOLog("VMQemuVGA: DEBUG - Trying svga provider as fallback: %p (class: %s)\n", 
+		VMLOG_INFO("VMQemuVGA: DEBUG - Trying svga provider as fallback: %p (class: %s)\n", 
 		      svga.getProvider(), svga.getProvider()->getMetaClass()->getClassName());
 		pciDevice = OSDynamicCast(IOPCIDevice, svga.getProvider());
 	}
 	
 	if (!pciDevice) {
-		IOLog("VMQemuVGA: No PCI device found for Lilu registration\n");
+		VMLOG_INFO("VMQemuVGA: No PCI device found for Lilu registration\n");
 		return;
 	}
 	
-	IOLog("VMQemuVGA: DEBUG - Successfully found PCI device for Lilu: %p\n", pciDevice);
+	VMLOG_INFO("VMQemuVGA: DEBUG - Successfully found PCI device for Lilu: %p\n", pciDevice);
 	
 	// Get device properties for Lilu frameworks from I/O Registry
 	OSObject* vendorObj = pciDevice->getProperty("vendor-id");
@@ -2512,7 +2517,7 @@ void VMQemuVGA::publishDeviceForLiluFrameworks()
 	if (!subVendorObj) subVendorObj = pciDevice->getProperty("subsystem_vendor_id");
 	if (!subDeviceObj) subDeviceObj = pciDevice->getProperty("subsystem_id");
 	
-	IOLog("VMQemuVGA: DEBUG - Property objects exist: vendor=%p, device=%p, subvendor=%p, subdevice=%p\n",
+	VMLOG_INFO("VMQemuVGA: DEBUG - Property objects exist: vendor=%p, device=%p, subvendor=%p, subdevice=%p\n",
 	      vendorObj, deviceObj, subVendorObj, subDeviceObj);
 	
 	OSNumber* vendorProp = OSDynamicCast(OSNumber, vendorObj);
@@ -2527,17 +2532,17 @@ void VMQemuVGA::publishDeviceForLiluFrameworks()
 	
 	// If properties are all zeros, this indicates a problem reading device info
 	if (vendorID == 0x0000 && deviceID == 0x0000) {
-		IOLog("VMQemuVGA: ERROR - Cannot determine device vendor/device ID for Lilu integration\n");
-		IOLog("VMQemuVGA: Device identification failed - Lilu integration will be disabled\n");
+		VMLOG_ERROR("VMQemuVGA: ERROR - Cannot determine device vendor/device ID for Lilu integration\n");
+		VMLOG_ERROR("VMQemuVGA: Device identification failed - Lilu integration will be disabled\n");
 		// Don't assume device type - just disable Lilu integration
 		return; // Exit function without proceeding
 	}
 	
-	IOLog("VMQemuVGA: DEBUG - Raw property pointers: vendor=%p, device=%p, subvendor=%p, subdevice=%p\n",
+	VMLOG_INFO("VMQemuVGA: DEBUG - Raw property pointers: vendor=%p, device=%p, subvendor=%p, subdevice=%p\n",
 	      vendorProp, deviceProp, subVendorProp, subDeviceProp);
-	IOLog("VMQemuVGA: DEBUG - PCI Device Properties: Vendor=0x%04X, Device=0x%04X, Subsystem=0x%04X:0x%04X\n", 
+	VMLOG_INFO("VMQemuVGA: DEBUG - PCI Device Properties: Vendor=0x%04X, Device=0x%04X, Subsystem=0x%04X:0x%04X\n", 
 	      vendorID, deviceID, subsystemVendorID, subsystemID);
-	IOLog("VMQemuVGA: DEBUG - Provider chain depth used: %d\n", depth);
+	VMLOG_INFO("VMQemuVGA: DEBUG - Provider chain depth used: %d\n", depth);
 	
 	// Create device info array for Lilu frameworks
 	OSArray* liluProps = OSArray::withCapacity(4);
@@ -2574,13 +2579,13 @@ void VMQemuVGA::publishDeviceForLiluFrameworks()
 	// Publish device in I/O Registry for better visibility
 	registerService(kIOServiceAsynchronous);
 	
-	IOLog("VMQemuVGA: Device published for Lilu frameworks - Vendor: 0x%04X, Device: 0x%04X, Subsystem: 0x%04X:0x%04X\n", 
+	VMLOG_INFO("VMQemuVGA: Device published for Lilu frameworks - Vendor: 0x%04X, Device: 0x%04X, Subsystem: 0x%04X:0x%04X\n", 
 	      vendorID, deviceID, subsystemVendorID, subsystemID);
 }
 
 IOReturn CLASS::registerWithSystemGraphics()
 {
-	IOLog("VMQemuVGA: DEBUG - registerWithSystemGraphics() called\n");
+	VMLOG_INFO("VMQemuVGA: DEBUG - registerWithSystemGraphics() called\n");
 	
 	// Register with system as an accelerated graphics device
 	setProperty("com.apple.iokit.IOGraphicsFamily", kOSBooleanTrue);
@@ -2640,13 +2645,13 @@ IOReturn CLASS::registerWithSystemGraphics()
 	setProperty("GPUUtilizationReporting", kOSBooleanTrue);
 	setProperty("GPUMemoryTracking", kOSBooleanTrue);
 	
-	IOLog("VMQemuVGA: Successfully registered with system graphics frameworks\n");
+	VMLOG_INFO("VMQemuVGA: Successfully registered with system graphics frameworks\n");
 	return kIOReturnSuccess;
 }
 
 IOReturn CLASS::initializeIOSurfaceSupport()
 {
-	IOLog("VMQemuVGA: Initializing IOSurface support for Canvas 2D acceleration\n");
+	VMLOG_INFO("VMQemuVGA: Initializing IOSurface support for Canvas 2D acceleration\n");
 	
 	// Register as the system IOSurface provider
 	setProperty("IOSurfaceRoot", kOSBooleanTrue);
@@ -2658,13 +2663,13 @@ IOReturn CLASS::initializeIOSurfaceSupport()
 	UInt32 maxHeight = (UInt32)16384;
 	UInt32 memoryPool = (UInt32)(512 * 1024 * 1024);
 	
-	IOLog("VMQemuVGA: DEBUG - Setting IOSurfaceMaxWidth to %u\n", maxWidth);
+	VMLOG_INFO("VMQemuVGA: DEBUG - Setting IOSurfaceMaxWidth to %u\n", maxWidth);
 	setProperty("IOSurfaceMaxWidth", maxWidth);  // 16K width for modern displays
 	
-	IOLog("VMQemuVGA: DEBUG - Setting IOSurfaceMaxHeight to %u\n", maxHeight);
+	VMLOG_INFO("VMQemuVGA: DEBUG - Setting IOSurfaceMaxHeight to %u\n", maxHeight);
 	setProperty("IOSurfaceMaxHeight", maxHeight); // 16K height for modern displays
 	
-	IOLog("VMQemuVGA: DEBUG - Setting IOSurfaceMemoryPool to %u\n", memoryPool);
+	VMLOG_INFO("VMQemuVGA: DEBUG - Setting IOSurfaceMemoryPool to %u\n", memoryPool);
 	setProperty("IOSurfaceMemoryPool", memoryPool); // 512MB
 	
 	// Register supported pixel formats
@@ -2694,7 +2699,7 @@ IOReturn CLASS::initializeIOSurfaceSupport()
 	setProperty("com.apple.WebKit.IOSurface.Canvas", kOSBooleanTrue);
 	setProperty("com.apple.WebKit.IOSurface.VideoLayer", kOSBooleanTrue);
 	
-	IOLog("VMQemuVGA: IOSurface support initialized - Chrome Canvas 2D should now be accelerated\n");
+	VMLOG_INFO("VMQemuVGA: IOSurface support initialized - Chrome Canvas 2D should now be accelerated\n");
 	return kIOReturnSuccess;
 }
 
@@ -2706,7 +2711,7 @@ IOReturn CLASS::acceleratedCanvasDrawImage(const void* imageData, size_t imageSi
 		return kIOReturnBadArgument;
 	}
 	
-	IOLog("VMQemuVGA: Accelerated Canvas drawImage: src(%d,%d,%d,%d) -> dst(%d,%d,%d,%d)\n",
+	VMLOG_DEBUG("VMQemuVGA: Accelerated Canvas drawImage: src(%d,%d,%d,%d) -> dst(%d,%d,%d,%d)\n",
 		  srcX, srcY, srcW, srcH, dstX, dstY, dstW, dstH);
 	
 	// Simple framebuffer-based image blit for Canvas acceleration
@@ -2716,7 +2721,7 @@ IOReturn CLASS::acceleratedCanvasDrawImage(const void* imageData, size_t imageSi
 		// Get current display mode for bounds checking
 		DisplayModeEntry const* dme = GetDisplayMode(m_display_mode);
 		if (dme && dstX >= 0 && dstY >= 0 && (dstX + dstW) <= (int32_t)dme->width && (dstY + dstH) <= (int32_t)dme->height) {
-			IOLog("VMQemuVGA: Canvas image blit within bounds, performing accelerated copy\n");
+			VMLOG_DEBUG("VMQemuVGA: Canvas image blit within bounds, performing accelerated copy\n");
 			// Basic success - more complex implementation would copy actual image data
 			IOLockUnlock(m_iolock);
 			return kIOReturnSuccess;
@@ -2734,7 +2739,7 @@ IOReturn CLASS::acceleratedCanvasFillRect(int32_t x, int32_t y, int32_t width, i
 		return kIOReturnNotReady;
 	}
 	
-	IOLog("VMQemuVGA: Accelerated Canvas fillRect: (%d,%d,%d,%d) color=0x%08x\n", x, y, width, height, color);
+	VMLOG_DEBUG("VMQemuVGA: Accelerated Canvas fillRect: (%d,%d,%d,%d) color=0x%08x\n", x, y, width, height, color);
 	
 	// Direct VRAM fill for Canvas rectangle acceleration
 	if (m_vram && m_iolock) {
@@ -2756,7 +2761,7 @@ IOReturn CLASS::acceleratedCanvasFillRect(int32_t x, int32_t y, int32_t width, i
 				}
 				vramMap->release();
 				
-				IOLog("VMQemuVGA: Canvas fillRect accelerated successfully\n");
+				VMLOG_DEBUG("VMQemuVGA: Canvas fillRect accelerated successfully\n");
 				IOLockUnlock(m_iolock);
 				return kIOReturnSuccess;
 			}
@@ -2774,7 +2779,7 @@ IOReturn CLASS::acceleratedCanvasDrawText(const char* text, int32_t x, int32_t y
 		return kIOReturnBadArgument;
 	}
 
-	IOLog("VMQemuVGA: Accelerated Canvas drawText: '%s' at (%d,%d) size=%u color=0x%08x\n",
+	VMLOG_DEBUG("VMQemuVGA: Accelerated Canvas drawText: '%s' at (%d,%d) size=%u color=0x%08x\n",
 		  text, x, y, fontSize, color);
 
 	// Implement basic bitmap font rendering for ASCII characters
@@ -2924,7 +2929,7 @@ IOReturn CLASS::acceleratedCanvasDrawText(const char* text, int32_t x, int32_t y
 					}
 
 					vramMap->release();
-					IOLog("VMQemuVGA: Canvas text rendering completed successfully\n");
+					VMLOG_DEBUG("VMQemuVGA: Canvas text rendering completed successfully\n");
 					IOLockUnlock(m_iolock);
 					return kIOReturnSuccess;
 				}
@@ -2936,13 +2941,13 @@ IOReturn CLASS::acceleratedCanvasDrawText(const char* text, int32_t x, int32_t y
 	}
 
 	// Fallback to software rendering if hardware acceleration fails
-	IOLog("VMQemuVGA: Canvas text rendering using software fallback\n");
+	VMLOG_DEBUG("VMQemuVGA: Canvas text rendering using software fallback\n");
 	return kIOReturnSuccess;
 }
 
 IOReturn CLASS::enableCanvasAcceleration(bool enable)
 {
-	IOLog("VMQemuVGA: %s Canvas 2D hardware acceleration\n", enable ? "Enabling" : "Disabling");
+	VMLOG_INFO("VMQemuVGA: %s Canvas 2D hardware acceleration\n", enable ? "Enabling" : "Disabling");
 	
 	if (enable && m_3d_acceleration_enabled) {
 		// Enable Canvas acceleration properties
@@ -2956,12 +2961,12 @@ IOReturn CLASS::enableCanvasAcceleration(bool enable)
 		setProperty("YouTube-Canvas-Acceleration", kOSBooleanTrue);
 		setProperty("Chrome-Canvas-HardwareBacking", kOSBooleanTrue);
 		
-		IOLog("VMQemuVGA: Canvas 2D hardware acceleration enabled\n");
+		VMLOG_INFO("VMQemuVGA: Canvas 2D hardware acceleration enabled\n");
 		return kIOReturnSuccess;
 	} else {
 		// Disable acceleration, fall back to software
 		setProperty("Canvas2D-HardwareAccelerated", kOSBooleanFalse);
-		IOLog("VMQemuVGA: Canvas 2D acceleration disabled, using software fallback\n");
+		VMLOG_INFO("VMQemuVGA: Canvas 2D acceleration disabled, using software fallback\n");
 		return kIOReturnSuccess;
 	}
 }
@@ -2972,15 +2977,15 @@ IOReturn CLASS::enableCanvasAcceleration(bool enable)
 
 IOReturn CLASS::createRenderContext(uint32_t* context_id)
 {
-	IOLog("VMQemuVGA::createRenderContext: Creating WebGL rendering context\n");
+	VMLOG_DEBUG("VMQemuVGA::createRenderContext: Creating WebGL rendering context\n");
 	
 	if (!context_id) {
-		IOLog("VMQemuVGA::createRenderContext: Invalid context_id parameter\n");
+		VMLOG_WARN("VMQemuVGA::createRenderContext: Invalid context_id parameter\n");
 		return kIOReturnBadArgument;
 	}
 	
 	if (!m_3d_acceleration_enabled) {
-		IOLog("VMQemuVGA::createRenderContext: 3D acceleration not available\n");
+		VMLOG_DEBUG("VMQemuVGA::createRenderContext: 3D acceleration not available\n");
 		return kIOReturnUnsupported;
 	}
 	
@@ -2988,7 +2993,7 @@ IOReturn CLASS::createRenderContext(uint32_t* context_id)
 	static uint32_t s_next_context_id = 1000; // Start with higher numbers to avoid conflicts
 	*context_id = ++s_next_context_id;
 	
-	IOLog("VMQemuVGA::createRenderContext: Created WebGL context ID: %u\n", *context_id);
+	VMLOG_DEBUG("VMQemuVGA::createRenderContext: Created WebGL context ID: %u\n", *context_id);
 	
 	// Set WebGL context properties
 	char context_key[64];
@@ -3000,64 +3005,64 @@ IOReturn CLASS::createRenderContext(uint32_t* context_id)
 
 IOReturn CLASS::executeCommands(uint32_t context_id, IOMemoryDescriptor* commands)
 {
-	IOLog("VMQemuVGA::executeCommands: Executing WebGL commands for context %u\n", context_id);
+	VMLOG_DEBUG("VMQemuVGA::executeCommands: Executing WebGL commands for context %u\n", context_id);
 	
 	if (!commands) {
-		IOLog("VMQemuVGA::executeCommands: Invalid commands parameter\n");
+		VMLOG_WARN("VMQemuVGA::executeCommands: Invalid commands parameter\n");
 		return kIOReturnBadArgument;
 	}
 	
 	if (!m_3d_acceleration_enabled) {
-		IOLog("VMQemuVGA::executeCommands: 3D acceleration not available\n");
+		VMLOG_DEBUG("VMQemuVGA::executeCommands: 3D acceleration not available\n");
 		return kIOReturnUnsupported;
 	}
 	
 	// Map command buffer for processing
 	IOMemoryMap* command_map = commands->map();
 	if (!command_map) {
-		IOLog("VMQemuVGA::executeCommands: Failed to map command buffer\n");
+		VMLOG_ERROR("VMQemuVGA::executeCommands: Failed to map command buffer\n");
 		return kIOReturnNoMemory;
 	}
 	
 	void* command_data = (void*)command_map->getVirtualAddress();
 	size_t command_size = commands->getLength();
 	
-	IOLog("VMQemuVGA::executeCommands: Processing %zu bytes of WebGL commands\n", command_size);
+	VMLOG_DEBUG("VMQemuVGA::executeCommands: Processing %zu bytes of WebGL commands\n", command_size);
 	
 	// For QXL/VGA devices, we simulate WebGL command execution
 	// In a real implementation, this would translate WebGL commands to the device's API
 	
 	// Process commands (simplified simulation)
 	if (command_data && command_size > 0) {
-		IOLog("VMQemuVGA::executeCommands: WebGL commands processed successfully\n");
+		VMLOG_DEBUG("VMQemuVGA::executeCommands: WebGL commands processed successfully\n");
 		command_map->release();
 		return kIOReturnSuccess;
 	}
 	
 	command_map->release();
-	IOLog("VMQemuVGA::executeCommands: Invalid command data\n");
+	VMLOG_WARN("VMQemuVGA::executeCommands: Invalid command data\n");
 	return kIOReturnBadArgument;
 }
 
 IOReturn CLASS::allocateResource3D(uint32_t* resource_id, uint32_t target, uint32_t format,
 								  uint32_t width, uint32_t height, uint32_t depth)
 {
-	IOLog("VMQemuVGA::allocateResource3D: Allocating 3D resource %ux%ux%u, target=%u, format=%u\n", 
+	VMLOG_DEBUG("VMQemuVGA::allocateResource3D: Allocating 3D resource %ux%ux%u, target=%u, format=%u\n", 
 		  width, height, depth, target, format);
 	
 	if (!resource_id) {
-		IOLog("VMQemuVGA::allocateResource3D: Invalid resource_id parameter\n");
+		VMLOG_WARN("VMQemuVGA::allocateResource3D: Invalid resource_id parameter\n");
 		return kIOReturnBadArgument;
 	}
 	
 	if (!m_3d_acceleration_enabled) {
-		IOLog("VMQemuVGA::allocateResource3D: 3D acceleration not available\n");
+		VMLOG_DEBUG("VMQemuVGA::allocateResource3D: 3D acceleration not available\n");
 		return kIOReturnUnsupported;
 	}
 	
 	// Validate dimensions
 	if (width == 0 || height == 0 || depth == 0) {
-		IOLog("VMQemuVGA::allocateResource3D: Invalid dimensions\n");
+		VMLOG_WARN("VMQemuVGA::allocateResource3D: Invalid dimensions\n");
 		return kIOReturnBadArgument;
 	}
 	
@@ -3068,7 +3073,7 @@ IOReturn CLASS::allocateResource3D(uint32_t* resource_id, uint32_t target, uint3
 	// Calculate resource memory size
 	size_t resource_size = width * height * depth * 4; // Assume 4 bytes per pixel
 	
-	IOLog("VMQemuVGA::allocateResource3D: Created resource ID %u, size: %zu bytes\n", 
+	VMLOG_DEBUG("VMQemuVGA::allocateResource3D: Created resource ID %u, size: %zu bytes\n", 
 		  *resource_id, resource_size);
 	
 	// Store resource properties
@@ -3081,106 +3086,106 @@ IOReturn CLASS::allocateResource3D(uint32_t* resource_id, uint32_t target, uint3
 
 IOReturn CLASS::deallocateResource(uint32_t resource_id)
 {
-	IOLog("VMQemuVGA::deallocateResource: Deallocating resource ID %u\n", resource_id);
+	VMLOG_DEBUG("VMQemuVGA::deallocateResource: Deallocating resource ID %u\n", resource_id);
 	
 	// Remove resource properties
 	char resource_key[64];
 	snprintf(resource_key, sizeof(resource_key), "3D-Resource-%u", resource_id);
 	removeProperty(resource_key);
 	
-	IOLog("VMQemuVGA::deallocateResource: Resource ID %u deallocated\n", resource_id);
+	VMLOG_DEBUG("VMQemuVGA::deallocateResource: Resource ID %u deallocated\n", resource_id);
 	return kIOReturnSuccess;
 }
 
 IOReturn CLASS::destroyRenderContext(uint32_t context_id)
 {
-	IOLog("VMQemuVGA::destroyRenderContext: Destroying WebGL context ID %u\n", context_id);
+	VMLOG_DEBUG("VMQemuVGA::destroyRenderContext: Destroying WebGL context ID %u\n", context_id);
 	
 	// Remove context properties
 	char context_key[64];
 	snprintf(context_key, sizeof(context_key), "WebGL-Context-%u", context_id);
 	removeProperty(context_key);
 	
-	IOLog("VMQemuVGA::destroyRenderContext: Context ID %u destroyed\n", context_id);
+	VMLOG_DEBUG("VMQemuVGA::destroyRenderContext: Context ID %u destroyed\n", context_id);
 	return kIOReturnSuccess;
 }
 
 IOReturn CLASS::allocateGPUMemory(size_t size, IOMemoryDescriptor** memory)
 {
-	IOLog("VMQemuVGA::allocateGPUMemory: Allocating %zu bytes of GPU memory\n", size);
+	VMLOG_DEBUG("VMQemuVGA::allocateGPUMemory: Allocating %zu bytes of GPU memory\n", size);
 	
 	if (!memory) {
-		IOLog("VMQemuVGA::allocateGPUMemory: Invalid memory parameter\n");
+		VMLOG_WARN("VMQemuVGA::allocateGPUMemory: Invalid memory parameter\n");
 		return kIOReturnBadArgument;
 	}
 	
 	if (size == 0) {
-		IOLog("VMQemuVGA::allocateGPUMemory: Invalid size\n");
+		VMLOG_WARN("VMQemuVGA::allocateGPUMemory: Invalid size\n");
 		return kIOReturnBadArgument;
 	}
 	
 	*memory = IOBufferMemoryDescriptor::withCapacity(size, kIODirectionInOut);
 	if (!*memory) {
-		IOLog("VMQemuVGA::allocateGPUMemory: Failed to allocate memory\n");
+		VMLOG_ERROR("VMQemuVGA::allocateGPUMemory: Failed to allocate memory\n");
 		return kIOReturnNoMemory;
 	}
 	
-	IOLog("VMQemuVGA::allocateGPUMemory: Allocated %zu bytes successfully\n", size);
+	VMLOG_DEBUG("VMQemuVGA::allocateGPUMemory: Allocated %zu bytes successfully\n", size);
 	return kIOReturnSuccess;
 }
 
 IOReturn CLASS::updateDisplay(uint32_t scanout_id, uint32_t resource_id, uint32_t x, uint32_t y, 
 							 uint32_t width, uint32_t height)
 {
-	IOLog("VMQemuVGA::updateDisplay: Updating display scanout=%u resource=%u rect=[%u,%u,%u,%u]\n", 
+	VMLOG_DEBUG("VMQemuVGA::updateDisplay: Updating display scanout=%u resource=%u rect=[%u,%u,%u,%u]\n", 
 		  scanout_id, resource_id, x, y, width, height);
 	
 	if (width == 0 || height == 0) {
-		IOLog("VMQemuVGA::updateDisplay: Invalid dimensions\n");
+		VMLOG_WARN("VMQemuVGA::updateDisplay: Invalid dimensions\n");
 		return kIOReturnBadArgument;
 	}
 	
 	// For QXL/VGA devices, this would trigger actual display updates
 	// For now, we simulate successful display update
 	
-	IOLog("VMQemuVGA::updateDisplay: Display update completed successfully\n");
+	VMLOG_DEBUG("VMQemuVGA::updateDisplay: Display update completed successfully\n");
 	return kIOReturnSuccess;
 }
 
 IOReturn CLASS::mapGuestMemory(IOMemoryDescriptor* guest_memory, uint64_t* gpu_addr)
 {
-	IOLog("VMQemuVGA::mapGuestMemory: Mapping guest memory to GPU address space\n");
+	VMLOG_INFO("VMQemuVGA::mapGuestMemory: Mapping guest memory to GPU address space\n");
 	
 	if (!guest_memory || !gpu_addr) {
-		IOLog("VMQemuVGA::mapGuestMemory: Invalid parameters\n");
+		VMLOG_WARN("VMQemuVGA::mapGuestMemory: Invalid parameters\n");
 		return kIOReturnBadArgument;
 	}
 	
 	// Get memory properties
 	IOByteCount memory_length = guest_memory->getLength();
 	if (memory_length == 0) {
-		IOLog("VMQemuVGA::mapGuestMemory: Invalid memory length\n");
+		VMLOG_WARN("VMQemuVGA::mapGuestMemory: Invalid memory length\n");
 		return kIOReturnBadArgument;
 	}
 	
 	// Prepare memory for access
 	IOReturn prepare_ret = guest_memory->prepare(kIODirectionOutIn);
 	if (prepare_ret != kIOReturnSuccess) {
-		IOLog("VMQemuVGA::mapGuestMemory: Failed to prepare memory: 0x%x\n", prepare_ret);
+		VMLOG_ERROR("VMQemuVGA::mapGuestMemory: Failed to prepare memory: 0x%x\n", prepare_ret);
 		return prepare_ret;
 	}
 	
 	// Get physical address
 	IOPhysicalAddress phys_addr = guest_memory->getPhysicalSegment(0, nullptr, kIOMemoryMapperNone);
 	if (phys_addr == 0) {
-		IOLog("VMQemuVGA::mapGuestMemory: Failed to get physical address\n");
+		VMLOG_ERROR("VMQemuVGA::mapGuestMemory: Failed to get physical address\n");
 		guest_memory->complete(kIODirectionOutIn);
 		return kIOReturnNoMemory;
 	}
 	
 	*gpu_addr = phys_addr;
 	
-	IOLog("VMQemuVGA::mapGuestMemory: Mapped %llu bytes at GPU address 0x%llx\n", 
+	VMLOG_INFO("VMQemuVGA::mapGuestMemory: Mapped %llu bytes at GPU address 0x%llx\n", 
 		  (uint64_t)memory_length, *gpu_addr);
 	
 	return kIOReturnSuccess;
@@ -3188,35 +3193,35 @@ IOReturn CLASS::mapGuestMemory(IOMemoryDescriptor* guest_memory, uint64_t* gpu_a
 
 void CLASS::enableVSync(bool enabled)
 {
-	IOLog("VMQemuVGA::enableVSync: %s VSync for display synchronization\n", 
+	VMLOG_INFO("VMQemuVGA::enableVSync: %s VSync for display synchronization\n", 
 		  enabled ? "Enabling" : "Disabling");
 	
 	
-	IOLog("VMQemuVGA::enableVSync: VSync %s\n", enabled ? "enabled" : "disabled");
+	VMLOG_INFO("VMQemuVGA::enableVSync: VSync %s\n", enabled ? "enabled" : "disabled");
 }
 
 void CLASS::enableVirgl()
 {
-	IOLog("VMQemuVGA::enableVirgl: Enabling Virgil 3D renderer simulation\n");
+	VMLOG_INFO("VMQemuVGA::enableVirgl: Enabling Virgil 3D renderer simulation\n");
 	
 	if (!m_3d_acceleration_enabled) {
-		IOLog("VMQemuVGA::enableVirgl: 3D acceleration not available\n");
+		VMLOG_INFO("VMQemuVGA::enableVirgl: 3D acceleration not available\n");
 		return;
 	}
 	
 	// Set Virgl properties for WebGL compatibility
 	
-	IOLog("VMQemuVGA::enableVirgl: Virgil 3D renderer simulation enabled\n");
+	VMLOG_INFO("VMQemuVGA::enableVirgl: Virgil 3D renderer simulation enabled\n");
 }
 
 void CLASS::setMockMode(bool enabled)
 {
-	IOLog("VMQemuVGA::setMockMode: %s mock mode for testing\n", enabled ? "Enabling" : "Disabling");
+	VMLOG_DEBUG("VMQemuVGA::setMockMode: %s mock mode for testing\n", enabled ? "Enabling" : "Disabling");
 }
 
 void CLASS::setBasic3DSupport(bool enabled)
 {
-	IOLog("VMQemuVGA::setBasic3DSupport: %s basic 3D support\n", enabled ? "Enabling" : "Disabling");
+	VMLOG_DEBUG("VMQemuVGA::setBasic3DSupport: %s basic 3D support\n", enabled ? "Enabling" : "Disabling");
 	
 	if (enabled) {
 		m_3d_acceleration_enabled = true;
@@ -3225,22 +3230,22 @@ void CLASS::setBasic3DSupport(bool enabled)
 
 void CLASS::enableResourceBlob()
 {
-	IOLog("VMQemuVGA::enableResourceBlob: Enabling resource blob support simulation\n");
+	VMLOG_INFO("VMQemuVGA::enableResourceBlob: Enabling resource blob support simulation\n");
 	
 	
-	IOLog("VMQemuVGA::enableResourceBlob: Resource blob support enabled\n");
+	VMLOG_INFO("VMQemuVGA::enableResourceBlob: Resource blob support enabled\n");
 }
 
 bool CLASS::supportsFeature(uint32_t feature_flags) const
 {
-	IOLog("VMQemuVGA::supportsFeature: Checking feature support for flags=0x%x\n", feature_flags);
+	VMLOG_DEBUG("VMQemuVGA::supportsFeature: Checking feature support for flags=0x%x\n", feature_flags);
 	
 	// For QXL/VGA devices, we can simulate basic 3D support
 	bool supports_basic_3d = m_3d_acceleration_enabled;
 	bool supports_webgl = m_3d_acceleration_enabled;
 	bool supports_canvas = true; // Canvas 2D is always supported
 	
-	IOLog("VMQemuVGA::supportsFeature: Basic 3D: %s, WebGL: %s, Canvas: %s\n", 
+	VMLOG_DEBUG("VMQemuVGA::supportsFeature: Basic 3D: %s, WebGL: %s, Canvas: %s\n", 
 		  supports_basic_3d ? "YES" : "NO", 
 		  supports_webgl ? "YES" : "NO", 
 		  supports_canvas ? "YES" : "NO");
@@ -3252,10 +3257,10 @@ bool CLASS::supportsFeature(uint32_t feature_flags) const
 // WebGL-specific acceleration initialization
 void CLASS::initializeWebGLAcceleration()
 {
-	IOLog("VMQemuVGA::initializeWebGLAcceleration: Initializing WebGL hardware acceleration\n");
+	VMLOG_INFO("VMQemuVGA::initializeWebGLAcceleration: Initializing WebGL hardware acceleration\n");
 	
 	if (!m_3d_acceleration_enabled) {
-		IOLog("VMQemuVGA::initializeWebGLAcceleration: 3D acceleration not available\n");
+		VMLOG_INFO("VMQemuVGA::initializeWebGLAcceleration: 3D acceleration not available\n");
 		return;
 	}
 	
@@ -3268,15 +3273,15 @@ void CLASS::initializeWebGLAcceleration()
 	// Memory allocation for WebGL resources
 	size_t webgl_memory_size = 64 * 1024 * 1024; // 64MB for WebGL operations
 	
-	IOLog("VMQemuVGA::initializeWebGLAcceleration: WebGL acceleration initialized with %llu MB memory\n",
+	VMLOG_INFO("VMQemuVGA::initializeWebGLAcceleration: WebGL acceleration initialized with %llu MB memory\n",
 		  (uint64_t)(webgl_memory_size / (1024 * 1024)));
 	
-	IOLog("VMQemuVGA::initializeWebGLAcceleration: WebGL hardware acceleration ready\n");
+	VMLOG_INFO("VMQemuVGA::initializeWebGLAcceleration: WebGL hardware acceleration ready\n");
 }
 
 void CLASS::enable3DAcceleration()
 {
-	IOLog("VMQemuVGA::enable3DAcceleration: Enabling 3D acceleration for QXL/VGA devices\n");
+	VMLOG_INFO("VMQemuVGA::enable3DAcceleration: Enabling 3D acceleration for QXL/VGA devices\n");
 	
 	// Enable basic 3D support
 	m_3d_acceleration_enabled = true;
@@ -3294,5 +3299,5 @@ void CLASS::enable3DAcceleration()
 	// Enable Canvas acceleration
 	enableCanvasAcceleration(true);
 	
-	IOLog("VMQemuVGA::enable3DAcceleration: 3D acceleration enabled successfully\n");
+	VMLOG_INFO("VMQemuVGA::enable3DAcceleration: 3D acceleration enabled successfully\n");
 }
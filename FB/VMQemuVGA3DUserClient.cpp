@@ -1,4 +1,5 @@
 #include "VMQemuVGAAccelerator.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 
 #define CLASS VMQemuVGA3DUserClient
@@ -92,17 +93,17 @@ bool CLASS::start(IOService* provider)
     
     m_accelerator = OSDynamicCast(VMQemuVGAAccelerator, provider);
     if (!m_accelerator) {
-        IOLog("VMQemuVGA3DUserClient: Provider is not VMQemuVGAAccelerator\n");
+        VMLOG_INFO("VMQemuVGA3DUserClient: Provider is not VMQemuVGAAccelerator\n");
         return false;
     }
     
-    IOLog("VMQemuVGA3DUserClient: Started for task %p\n", m_task);
+    VMLOG_INFO("VMQemuVGA3DUserClient: Started for task %p\n", m_task);
     return true;
 }
 
 IOReturn CLASS::clientClose()
 {
-    IOLog("VMQemuVGA3DUserClient: clientClose\n");
+    VMLOG_INFO("VMQemuVGA3DUserClient: clientClose\n");
     
     if (m_has_context) {
         m_accelerator->destroy3DContext(m_context_id);
@@ -119,7 +120,7 @@ IOReturn CLASS::clientClose()
 
 IOReturn CLASS::clientDied()
 {
-    IOLog("VMQemuVGA3DUserClient: clientDied\n");
+    VMLOG_INFO("VMQemuVGA3DUserClient: clientDied\n");
     return clientClose();
 }
 
@@ -155,7 +156,7 @@ IOReturn CLASS::sCreate3DContext(OSObject* target, void* reference,
         args->scalarOutput[0] = me->m_context_id;
     }
     
-    IOLog("VMQemuVGA3DUserClient: Created context %d, result: 0x%x\n", 
+    VMLOG_DEBUG("VMQemuVGA3DUserClient: Created context %d, result: 0x%x\n", 
           me->m_context_id, ret);
     
     return ret;
@@ -177,7 +178,7 @@ IOReturn CLASS::sDestroy3DContext(OSObject* target, void* reference,
         me->m_context_id = 0;
     }
     
-    IOLog("VMQemuVGA3DUserClient: Destroyed context %d, result: 0x%x\n", 
+    VMLOG_DEBUG("VMQemuVGA3DUserClient: Destroyed context %d, result: 0x%x\n", 
           context_id, ret);
     
     return ret;
@@ -199,7 +200,7 @@ IOReturn CLASS::sCreate3DSurface(OSObject* target, void* reference,
         args->scalarOutput[0] = surface_info->surface_id;
     }
     
-    IOLog("VMQemuVGA3DUserClient: Created surface %d (%dx%d), result: 0x%x\n",
+    VMLOG_DEBUG("VMQemuVGA3DUserClient: Created surface %d (%dx%d), result: 0x%x\n",
           surface_info->surface_id, surface_info->width, surface_info->height, ret);
     
     return ret;
@@ -217,7 +218,7 @@ IOReturn CLASS::sDestroy3DSurface(OSObject* target, void* reference,
     }
     
     // Implementation would call accelerator's destroy surface method
-    IOLog("VMQemuVGA3DUserClient: Destroy surface %d\n", surface_id);
+    VMLOG_DEBUG("VMQemuVGA3DUserClient: Destroy surface %d\n", surface_id);
     
     return kIOReturnSuccess;
 }
@@ -239,7 +240,7 @@ IOReturn CLASS::sSubmit3DCommands(OSObject* target, void* reference,
     
     IOReturn ret = me->m_accelerator->submit3DCommands(context_id, commands);
     
-    IOLog("VMQemuVGA3DUserClient: Submit commands to context %d, result: 0x%x\n",
+    VMLOG_DEBUG("VMQemuVGA3DUserClient: Submit commands to context %d, result: 0x%x\n",
           context_id, ret);
     
     return ret;
@@ -258,7 +259,7 @@ IOReturn CLASS::sPresent3DSurface(OSObject* target, void* reference,
     
     IOReturn ret = me->m_accelerator->present3DSurface(context_id, surface_id);
     
-    IOLog("VMQemuVGA3DUserClient: Present surface %d from context %d, result: 0x%x\n",
+    VMLOG_DEBUG("VMQemuVGA3DUserClient: Present surface %d from context %d, result: 0x%x\n",
           surface_id, context_id, ret);
     
     return ret;
@@ -289,7 +290,7 @@ IOReturn CLASS::sGetCapabilities(OSObject* target, void* reference,
     memcpy(args->structureOutput, &capabilities, sizeof(capabilities));
     args->structureOutputSize = sizeof(capabilities);
     
-    IOLog("VMQemuVGA3DUserClient: Get capabilities\n");
+    VMLOG_DEBUG("VMQemuVGA3DUserClient: Get capabilities\n");
     
     return kIOReturnSuccess;
 }
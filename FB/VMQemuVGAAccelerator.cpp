@@ -8,7 +8,10 @@
 #include "VMMetalPlugin.h"
 #include "VMCGLContext.h"
 #include "VMAccelSurfaceClient.h"
+#include "VMBlit2D.h"
 #include "virgl_protocol.h"
+#include "virgl_encode.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 #include <IOKit/IOBufferMemoryDescriptor.h>
 #include <mach/mach_time.h>
@@ -59,6 +62,7 @@ bool CLASS::init(OSDictionary* properties)
     m_commands_submitted = 0;
     m_memory_allocated = 0;
     m_metal_compatible = false;
+    m_vram_map = nullptr;
 
     return (m_lock && m_context_pool && m_surface_pool);
 }
@@ -126,7 +130,7 @@ void CLASS::free()
 
 bool CLASS::start(IOService* provider)
 {
-    IOLog("VMQemuVGAAccelerator::start\n");
+    VMLOG_INFO("VMQemuVGAAccelerator::start\n");
     
     if (!super::start(provider))
         return false;
@@ -134,7 +138,7 @@ bool CLASS::start(IOService* provider)
     // Support both VMQemuVGA (QXL) and VMVirtIOFramebuffer (VirtIO GPU)
     m_framebuffer = OSDynamicCast(IOFramebuffer, provider);
     if (!m_framebuffer) {
-        IOLog("VMQemuVGAAccelerator: Provider is not IOFramebuffer\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: Provider is not IOFramebuffer\n");
         return false;
     }
     
@@ -143,32 +147,32 @@ bool CLASS::start(IOService* provider)
     VMVirtIOFramebuffer* virtio_fb = OSDynamicCast(VMVirtIOFramebuffer, provider);
     
     if (qxl_fb) {
-        IOLog("VMQemuVGAAccelerator: Attached to VMQemuVGA (QXL) framebuffer\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: Attached to VMQemuVGA (QXL) framebuffer\n");
         m_gpu_device = qxl_fb->getGPUDevice();
         if (!m_gpu_device) {
-            IOLog("VMQemuVGAAccelerator: WARNING - QXL framebuffer has no GPU device\n");
+            VMLOG_WARN("VMQemuVGAAccelerator: WARNING - QXL framebuffer has no GPU device\n");
         }
     } else if (virtio_fb) {
-        IOLog("VMQemuVGAAccelerator: Attached to VMVirtIOFramebuffer (VirtIO GPU)\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: Attached to VMVirtIOFramebuffer (VirtIO GPU)\n");
         m_gpu_device = virtio_fb->getGPUDevice();
         if (!m_gpu_device) {
-            IOLog("VMQemuVGAAccelerator: WARNING - VirtIO framebuffer has no GPU device\n");
+            VMLOG_WARN("VMQemuVGAAccelerator: WARNING - VirtIO framebuffer has no GPU device\n");
         }
     } else {
-        IOLog("VMQemuVGAAccelerator: ERROR - Unknown framebuffer type\n");
+        VMLOG_ERROR("VMQemuVGAAccelerator: ERROR - Unknown framebuffer type\n");
         m_gpu_device = nullptr;
     }
     
     // Create workloop and command gate
     m_workloop = IOWorkLoop::workLoop();
     if (!m_workloop) {
-        IOLog("VMQemuVGAAccelerator: Failed to create workloop\n");
+        VMLOG_ERROR("VMQemuVGAAccelerator: Failed to create workloop\n");
         return false;
     }
     
     m_command_gate = IOCommandGate::commandGate(this);
     if (!m_command_gate) {
-        IOLog("VMQemuVGAAccelerator: Failed to create command gate\n");
+        VMLOG_ERROR("VMQemuVGAAccelerator: Failed to create command gate\n");
         return false;
     }
     
@@ -179,53 +183,58 @@ bool CLASS::start(IOService* provider)
     if (m_gpu_device) {
         m_shader_manager = VMShaderManager::withAccelerator(this);
         if (!m_shader_manager) {
-            IOLog("VMQemuVGAAccelerator: Failed to create shader manager\n");
+            VMLOG_ERROR("VMQemuVGAAccelerator: Failed to create shader manager\n");
             return false;
         }
         
         m_texture_manager = VMTextureManager::withAccelerator(this);
         if (!m_texture_manager) {
-            IOLog("VMQemuVGAAccelerator: Failed to create texture manager\n");
+            VMLOG_ERROR("VMQemuVGAAccelerator: Failed to create texture manager\n");
             return false;
         }
         
         m_command_pool = VMCommandBufferPool::withAccelerator(this, 0, 16);
         if (!m_command_pool) {
-            IOLog("VMQemuVGAAccelerator: Failed to create command buffer pool\n");
+            VMLOG_ERROR("VMQemuVGAAccelerator: Failed to create command buffer pool\n");
             return false;
         }
         
-        IOLog("VMQemuVGAAccelerator: 3D managers initialized for QXL/Hyper-V DDA mode\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: 3D managers initialized for QXL/Hyper-V DDA mode\n");
     } else {
-        IOLog("VMQemuVGAAccelerator: VirtIO GPU mode - skipping QXL-specific managers\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: VirtIO GPU mode - skipping QXL-specific managers\n");
         m_shader_manager = nullptr;
         m_texture_manager = nullptr;
         m_command_pool = nullptr;
     }
     
+    // Software 2D engine backs blit/fill whenever no host 2D path takes them
+    VMBlit2DInit();
+    VMLOG_INFO("VMQemuVGAAccelerator: 2D engine using %s span kernels\n",
+          VMBlit2DPathName(VMBlit2DActivePath()));
+    
     // d65: Create and start Metal plugin for WindowServer compatibility (macOS 10.11+)
     // Metal framework not available on Snow Leopard 10.6 - skip Metal plugin on legacy systems
     #if MAC_OS_X_VERSION_MIN_REQUIRED >= 101100  // Only enable on El Capitan 10.11 and later
-    IOLog("VMQemuVGAAccelerator: Creating Metal plugin for WindowServer support\n");
+    VMLOG_INFO("VMQemuVGAAccelerator: Creating Metal plugin for WindowServer support\n");
     m_metal_plugin = new VMMetalPlugin();
     if (m_metal_plugin) {
         if (m_metal_plugin->init() && m_metal_plugin->attach(this)) {
             m_metal_plugin->start(this);
-            IOLog("VMQemuVGAAccelerator: Metal plugin started successfully\n");
+            VMLOG_INFO("VMQemuVGAAccelerator: Metal plugin started successfully\n");
             m_metal_compatible = true;
         } else {
-            IOLog("VMQemuVGAAccelerator: WARNING - Metal plugin failed to start\n");
+            VMLOG_ERROR("VMQemuVGAAccelerator: WARNING - Metal plugin failed to start\n");
             m_metal_plugin->release();
             m_metal_plugin = nullptr;
             m_metal_compatible = false;
         }
     } else {
-        IOLog("VMQemuVGAAccelerator: WARNING - Failed to create Metal plugin\n");
+        VMLOG_ERROR("VMQemuVGAAccelerator: WARNING - Failed to create Metal plugin\n");
         m_metal_compatible = false;
     }
     #else
     // Metal not available on this macOS version - disable Metal plugin
-    IOLog("VMQemuVGAAccelerator: Metal framework not available (macOS < 10.11) - using legacy acceleration\n");
+    VMLOG_INFO("VMQemuVGAAccelerator: Metal framework not available (macOS < 10.11) - using legacy acceleration\n");
     m_metal_plugin = nullptr;
     m_metal_compatible = false;
     #endif
@@ -288,20 +297,20 @@ bool CLASS::start(IOService* provider)
     setProperty("IOAccelIndex", (uint32_t)0, 32);      // Primary accelerator index
     setProperty("IOAccelRevision", (uint32_t)2, 32);   // Accelerator API revision
     
-    IOLog("VMQemuVGAAccelerator: Started successfully with OpenGL renderer properties\n");
-    IOLog("VMQemuVGAAccelerator: IOAccelIndex=0, IOAccelRevision=2, RendererID=0x00024600\n");
+    VMLOG_INFO("VMQemuVGAAccelerator: Started successfully with OpenGL renderer properties\n");
+    VMLOG_INFO("VMQemuVGAAccelerator: IOAccelIndex=0, IOAccelRevision=2, RendererID=0x00024600\n");
     
     // CRITICAL: Call registerService() to make this accelerator discoverable by CGL
     // Without this, CGL won't query our properties and can't find the renderer
     registerService();
-    IOLog("VMQemuVGAAccelerator: Registered service for CGL discovery\n");
+    VMLOG_INFO("VMQemuVGAAccelerator: Registered service for CGL discovery\n");
     
     return true;
 }
 
 void CLASS::stop(IOService* provider)
 {
-    IOLog("VMQemuVGAAccelerator::stop\n");
+    VMLOG_INFO("VMQemuVGAAccelerator::stop\n");
     
     // Clean up all contexts and surfaces
     IOLockLock(m_lock);
@@ -326,6 +335,11 @@ void CLASS::stop(IOService* provider)
     }
     m_surface_count = 0;
 
+    if (m_vram_map) {
+        m_vram_map->release();
+        m_vram_map = nullptr;
+    }
+
     IOLockUnlock(m_lock);
     
     if (m_command_gate && m_workloop) {
@@ -369,11 +383,11 @@ IOReturn CLASS::newUserClient(task_t owningTask, void* securityID,
         int surface_gate = 0;
         if (!PE_parse_boot_argn("vm-accel-surface", &surface_gate,
                                 sizeof(surface_gate))) {
-            IOLog("VMQemuVGAAccelerator: type 0 gated off "
+            VMLOG_INFO("VMQemuVGAAccelerator: type 0 gated off "
                   "(no vm-accel-surface boot-arg) - software fallback\n");
             return kIOReturnUnsupported;
         }
-        IOLog("VMQemuVGAAccelerator: type 0 GATED ON (vm-accel-surface=%d) "
+        VMLOG_INFO("VMQemuVGAAccelerator: type 0 GATED ON (vm-accel-surface=%d) "
               "- creating VMAccelSurfaceClient\n", surface_gate);
         // withTask() already ran initWithTask(owningTask, NULL, 0, NULL)
         VMAccelSurfaceClient* surface_client =
@@ -391,13 +405,13 @@ IOReturn CLASS::newUserClient(task_t owningTask, void* securityID,
             return kIOReturnError;
         }
         *handler = surface_client;
-        IOLog("VMQemuVGAAccelerator: VMAccelSurfaceClient created\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: VMAccelSurfaceClient created\n");
         return kIOReturnSuccess;
     }
     
     // Type 1 - CGL context user client
     if (type == 1) {
-        IOLog("VMQemuVGAAccelerator: Creating CGL context user client for task %p\n", owningTask);
+        VMLOG_INFO("VMQemuVGAAccelerator: Creating CGL context user client for task %p\n", owningTask);
         
         VMCGLContext* cgl_client = new VMCGLContext;
         if (!cgl_client) {
@@ -421,13 +435,13 @@ IOReturn CLASS::newUserClient(task_t owningTask, void* securityID,
         }
         
         *handler = cgl_client;
-        IOLog("VMQemuVGAAccelerator: ✅ CGL context user client created successfully\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: ✅ CGL context user client created successfully\n");
         return kIOReturnSuccess;
     }
     
     // Type 4 - VMVirtIOGPUUserClient for VirtIO GPU commands
     if (type == 4) {
-        IOLog("VMQemuVGAAccelerator: Creating VMVirtIOGPUUserClient\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: Creating VMVirtIOGPUUserClient\n");
         
         VMVirtIOGPUUserClient* virtio_client = OSTypeAlloc(VMVirtIOGPUUserClient);
         if (!virtio_client) {
@@ -451,7 +465,7 @@ IOReturn CLASS::newUserClient(task_t owningTask, void* securityID,
         }
         
         *handler = virtio_client;
-        IOLog("VMQemuVGAAccelerator: ✅ VMVirtIOGPUUserClient created successfully\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: ✅ VMVirtIOGPUUserClient created successfully\n");
         return kIOReturnSuccess;
     }
     
@@ -527,7 +541,7 @@ IOReturn CLASS::create3DContext(uint32_t* context_id, task_t task)
 
     IOLockUnlock(m_lock);
 
-    IOLog("VMQemuVGAAccelerator: Created 3D context %d\n", *context_id);
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Created 3D context %d\n", *context_id);
     return kIOReturnSuccess;
 }
 
@@ -594,7 +608,7 @@ IOReturn CLASS::create3DSurface(uint32_t context_id, VM3DSurfaceInfo* surface_in
     
     IOLockUnlock(m_lock);
     
-    IOLog("VMQemuVGAAccelerator: Created 3D surface %d (%dx%d)\n", 
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Created 3D surface %d (%dx%d)\n", 
           surface->surface_id, surface_info->width, surface_info->height);
     
     return kIOReturnSuccess;
@@ -628,12 +642,39 @@ IOReturn CLASS::submit3DCommands(uint32_t context_id, IOMemoryDescriptor* comman
     return ret;
 }
 
+IOReturn CLASS::submit3DCommandBytes(uint32_t context_id, const void* commands, size_t size)
+{
+    if (!commands || size == 0)
+        return kIOReturnBadArgument;
+    
+    IOLockLock(m_lock);
+    
+    AccelContext* context = findContext(context_id);
+    if (!context) {
+        IOLockUnlock(m_lock);
+        return kIOReturnNotFound;
+    }
+    
+    // Caller keeps the stream mapped and wired (VMCGLContext command arena)
+    IOReturn ret = m_gpu_device->executeCommandBytes(context->gpu_context_id, commands, size);
+    
+    if (ret == kIOReturnSuccess) {
+        m_draw_calls++;
+        m_commands_submitted++;
+        m_triangles_rendered += static_cast<uint32_t>(size / 64);
+    }
+    
+    IOLockUnlock(m_lock);
+    
+    return ret;
+}
+
 bool CLASS::poolGrowContext()
 {
     uint32_t new_cap = m_context_capacity ? m_context_capacity * 2 : kInitialContextCapacity;
     AccelContext** new_pool = (AccelContext**)ioMallocZero(new_cap * sizeof(AccelContext*));
     if (!new_pool) {
-        IOLog("VMQemuVGAAccelerator: poolGrowContext FAILED — OOM at capacity=%u\n", m_context_capacity);
+        VMLOG_ERROR("VMQemuVGAAccelerator: poolGrowContext FAILED — OOM at capacity=%u\n", m_context_capacity);
         return false;
     }
     for (uint32_t i = 0; i < m_context_capacity; i++) {
@@ -650,7 +691,7 @@ bool CLASS::poolGrowSurface()
     uint32_t new_cap = m_surface_capacity ? m_surface_capacity * 2 : kInitialSurfaceCapacity;
     AccelSurface** new_pool = (AccelSurface**)ioMallocZero(new_cap * sizeof(AccelSurface*));
     if (!new_pool) {
-        IOLog("VMQemuVGAAccelerator: poolGrowSurface FAILED — OOM at capacity=%u\n", m_surface_capacity);
+        VMLOG_ERROR("VMQemuVGAAccelerator: poolGrowSurface FAILED — OOM at capacity=%u\n", m_surface_capacity);
         return false;
     }
     for (uint32_t i = 0; i < m_surface_capacity; i++) {
@@ -726,7 +767,7 @@ bool CLASS::contextBindSurface(AccelContext* ctx, uint32_t surface_id)
         uint32_t new_cap = ctx->bound_surface_capacity ? ctx->bound_surface_capacity * 2 : 8;
         uint32_t* new_arr = (uint32_t*)IOMalloc(new_cap * sizeof(uint32_t));
         if (!new_arr) {
-            IOLog("VMQemuVGAAccelerator: contextBindSurface FAILED — OOM ctx=%u cap=%u\n",
+            VMLOG_ERROR("VMQemuVGAAccelerator: contextBindSurface FAILED — OOM ctx=%u cap=%u\n",
                   ctx->context_id, ctx->bound_surface_capacity);
             return false;
         }
@@ -874,7 +915,7 @@ void CLASS::resetStatistics()
 
 IOReturn CLASS::setPowerState(unsigned long powerState, IOService* whatDevice)
 {
-    IOLog("VMQemuVGAAccelerator: Power state %lu\n", powerState);
+    VMLOG_INFO("VMQemuVGAAccelerator: Power state %lu\n", powerState);
     return kIOReturnSuccess;
 }
 
@@ -943,11 +984,11 @@ IOReturn CLASS::present3DSurface(uint32_t context_id, uint32_t surface_id)
                                                    surface->info.height);
         
         if (presentResult == kIOReturnSuccess) {
-            IOLog("VMQemuVGAAccelerator: Hardware-accelerated presentation successful\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Hardware-accelerated presentation successful\n");
             IOLockUnlock(m_lock);
             return presentResult;
         } else {
-            IOLog("VMQemuVGAAccelerator: Hardware presentation failed (0x%x), trying fallback\n", 
+            VMLOG_ERROR("VMQemuVGAAccelerator: Hardware presentation failed (0x%x), trying fallback\n", 
                   presentResult);
         }
     }
@@ -1004,11 +1045,11 @@ IOReturn CLASS::present3DSurface(uint32_t context_id, uint32_t surface_id)
                             }
                         }
                         
-                        IOLog("VMQemuVGAAccelerator: Surface copied to framebuffer (%d bytes, offset: %d)\n", 
+                        VMLOG_DEBUG("VMQemuVGAAccelerator: Surface copied to framebuffer (%d bytes, offset: %d)\n", 
                               surface_size, vram_offset);
                         presentResult = kIOReturnSuccess;
                     } else {
-                        IOLog("VMQemuVGAAccelerator: Surface too large for VRAM (%d > %d available)\n", 
+                        VMLOG_DEBUG("VMQemuVGAAccelerator: Surface too large for VRAM (%d > %d available)\n", 
                               surface_size, vram_size - vram_offset);
                         presentResult = kIOReturnNoSpace;
                     }
@@ -1017,11 +1058,11 @@ IOReturn CLASS::present3DSurface(uint32_t context_id, uint32_t surface_id)
                 if (surface_map) surface_map->release();
                 vram_map->release();
             } else {
-                IOLog("VMQemuVGAAccelerator: Failed to map VRAM for presentation\n");
+                VMLOG_ERROR("VMQemuVGAAccelerator: Failed to map VRAM for presentation\n");
                 presentResult = kIOReturnError;
             }
         } else {
-            IOLog("VMQemuVGAAccelerator: No VRAM available for presentation\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: No VRAM available for presentation\n");
             presentResult = kIOReturnError;
         }
     }
@@ -1060,16 +1101,16 @@ IOReturn CLASS::present3DSurface(uint32_t context_id, uint32_t surface_id)
             cmdDesc->release();
             
             if (presentResult == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU command presentation successful\n");
+                VMLOG_DEBUG("VMQemuVGAAccelerator: VirtIO GPU command presentation successful\n");
             } else {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU command presentation failed (0x%x)\n", presentResult);
+                VMLOG_ERROR("VMQemuVGAAccelerator: VirtIO GPU command presentation failed (0x%x)\n", presentResult);
             }
         }
     }
     
     // Method 4: Enhanced software presentation with proper integration
     if (presentResult != kIOReturnSuccess) {
-        IOLog("VMQemuVGAAccelerator: Using enhanced software fallback for presentation\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Using enhanced software fallback for presentation\n");
         
         // Mark surface as presented and update render target status
         surface->is_render_target = true;
@@ -1082,19 +1123,19 @@ IOReturn CLASS::present3DSurface(uint32_t context_id, uint32_t surface_id)
         
         // Log the presentation method and provide guidance
         if (m_gpu_device && m_gpu_device->supports3D()) {
-            IOLog("VMQemuVGAAccelerator: VirtIO GPU software fallback (check display configuration)\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: VirtIO GPU software fallback (check display configuration)\n");
         } else if (m_framebuffer) {
-            IOLog("VMQemuVGAAccelerator: Hyper-V DDA software fallback (check VRAM mapping)\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Hyper-V DDA software fallback (check VRAM mapping)\n");
         } else {
-            IOLog("VMQemuVGAAccelerator: Pure software presentation (limited acceleration)\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Pure software presentation (limited acceleration)\n");
         }
         
         // Enhanced logging for troubleshooting
-        IOLog("VMQemuVGAAccelerator: Surface %dx%d, Format: %d, GPU Resource: %d\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Surface %dx%d, Format: %d, GPU Resource: %d\n",
               surface->info.width, surface->info.height, surface->info.format, surface->gpu_resource_id);
     }
     
-    IOLog("VMQemuVGAAccelerator: Present surface %d from context %d (result: 0x%x)\n", 
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Present surface %d from context %d (result: 0x%x)\n", 
           surface_id, context_id, presentResult);
     
     IOLockUnlock(m_lock);
@@ -1122,7 +1163,7 @@ IOReturn CLASS::compileShader(uint32_t context_id, uint32_t shader_type, uint32_
         shader_id
     );
     
-    IOLog("VMQemuVGAAccelerator: Compiled shader %d for context %d (result: 0x%x)\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Compiled shader %d for context %d (result: 0x%x)\n",
           *shader_id, context_id, ret);
     
     return ret;
@@ -1156,7 +1197,7 @@ IOReturn CLASS::createShaderProgram(uint32_t context_id, uint32_t* shader_ids, u
         ret = m_shader_manager->linkProgram(*program_id);
     }
     
-    IOLog("VMQemuVGAAccelerator: Created shader program %d for context %d (result: 0x%x)\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Created shader program %d for context %d (result: 0x%x)\n",
           *program_id, context_id, ret);
     
     return ret;
@@ -1200,7 +1241,7 @@ IOReturn CLASS::createTexture(uint32_t context_id, const void* descriptor,
         data_desc->release();
     }
     
-    IOLog("VMQemuVGAAccelerator: Created texture %d for context %d (%dx%d, result: 0x%x)\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Created texture %d for context %d (%dx%d, result: 0x%x)\n",
           *texture_id, context_id, tex_desc->width, tex_desc->height, ret);
     
     return ret;
@@ -1212,14 +1253,14 @@ IOReturn CLASS::beginRenderPass(uint32_t context_id, uint32_t framebuffer_id)
     if (!context)
         return kIOReturnNotFound;
     
-    IOLog("VMQemuVGAAccelerator: Begin render pass for context %d, framebuffer %d\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Begin render pass for context %d, framebuffer %d\n",
           context_id, framebuffer_id);
     
     IOReturn result = kIOReturnSuccess;
     
     // Method 1: VirtIO GPU 3D render state setup
     if (m_gpu_device && m_gpu_device->supports3D()) {
-        IOLog("VMQemuVGAAccelerator: Setting up VirtIO GPU 3D render state\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Setting up VirtIO GPU 3D render state\n");
         
         // Create VirtIO GPU command buffer for render state setup
         IOBufferMemoryDescriptor* cmdDesc = IOBufferMemoryDescriptor::withCapacity(512, kIODirectionOut);
@@ -1319,24 +1360,24 @@ IOReturn CLASS::beginRenderPass(uint32_t context_id, uint32_t framebuffer_id)
             cmdDesc->release();
             
             if (result == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU render state setup successful\n");
-                IOLog("VMQemuVGAAccelerator: Framebuffer %dx%d, Depth test enabled, Blending disabled\n",
+                VMLOG_DEBUG("VMQemuVGAAccelerator: VirtIO GPU render state setup successful\n");
+                VMLOG_DEBUG("VMQemuVGAAccelerator: Framebuffer %dx%d, Depth test enabled, Blending disabled\n",
                       gpu_render_state.fb_cmd.width, gpu_render_state.fb_cmd.height);
                 
                 // Mark context as having active render pass
                 context->active = true;
                 return result;
             } else {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU render state setup failed (0x%x), using fallback\n", result);
+                VMLOG_ERROR("VMQemuVGAAccelerator: VirtIO GPU render state setup failed (0x%x), using fallback\n", result);
             }
         } else {
-            IOLog("VMQemuVGAAccelerator: Failed to allocate command buffer for VirtIO GPU render state\n");
+            VMLOG_ERROR("VMQemuVGAAccelerator: Failed to allocate command buffer for VirtIO GPU render state\n");
         }
     }
     
     // Method 2: Hyper-V DDA framebuffer render state setup
     if (m_framebuffer && result != kIOReturnSuccess) {
-        IOLog("VMQemuVGAAccelerator: Setting up Hyper-V DDA framebuffer render state\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Setting up Hyper-V DDA framebuffer render state\n");
         
         // Get VRAM information for framebuffer setup
         IODeviceMemory* vram = m_framebuffer->getVRAMRange();
@@ -1349,7 +1390,7 @@ IOReturn CLASS::beginRenderPass(uint32_t context_id, uint32_t framebuffer_id)
                 uint32_t fb_bpp = 32; // Assume 32-bit color depth
                 uint32_t fb_stride = fb_width * (fb_bpp / 8);
                 
-                IOLog("VMQemuVGAAccelerator: Framebuffer setup: %dx%d, %d bpp, stride %d\n",
+                VMLOG_DEBUG("VMQemuVGAAccelerator: Framebuffer setup: %dx%d, %d bpp, stride %d\n",
                       fb_width, fb_height, fb_bpp, fb_stride);
                 
                 // Setup software render state tracking
@@ -1389,28 +1430,28 @@ IOReturn CLASS::beginRenderPass(uint32_t context_id, uint32_t framebuffer_id)
                     context->command_buffer->writeBytes(0, &fb_render_state, sizeof(fb_render_state));
                 }
                 
-                IOLog("VMQemuVGAAccelerator: Hyper-V DDA render state configured successfully\n");
+                VMLOG_DEBUG("VMQemuVGAAccelerator: Hyper-V DDA render state configured successfully\n");
                 result = kIOReturnSuccess;
             } else {
-                IOLog("VMQemuVGAAccelerator: No QemuVGADevice available for framebuffer setup\n");
+                VMLOG_DEBUG("VMQemuVGAAccelerator: No QemuVGADevice available for framebuffer setup\n");
                 result = kIOReturnError;
             }
         } else {
-            IOLog("VMQemuVGAAccelerator: No VRAM available for framebuffer render state\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: No VRAM available for framebuffer render state\n");
             result = kIOReturnError;
         }
     }
     
     // Method 3: Advanced shader pipeline setup (if available)
     if (result == kIOReturnSuccess && m_shader_manager && context->gpu_context_id) {
-        IOLog("VMQemuVGAAccelerator: Configuring shader pipeline for render pass\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Configuring shader pipeline for render pass\n");
         
         // Setup a basic shader program if available
         uint32_t default_program = 1; // Assume program ID 1 as default
         IOReturn shader_result = m_shader_manager->useProgram(context_id, default_program);
         
         if (shader_result == kIOReturnSuccess) {
-            IOLog("VMQemuVGAAccelerator: Default shader program %d activated\n", default_program);
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Default shader program %d activated\n", default_program);
                 
                 // Setup default uniform values
                 float identity_matrix[16] = {
@@ -1424,28 +1465,28 @@ IOReturn CLASS::beginRenderPass(uint32_t context_id, uint32_t framebuffer_id)
             // Set model-view-projection matrix uniform
             m_shader_manager->setUniform(default_program, "u_mvpMatrix", identity_matrix, 16 * sizeof(float));
             
-            IOLog("VMQemuVGAAccelerator: Shader uniforms configured with identity matrix\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Shader uniforms configured with identity matrix\n");
         } else {
-            IOLog("VMQemuVGAAccelerator: Failed to activate default shader program (0x%x)\n", shader_result);
+            VMLOG_ERROR("VMQemuVGAAccelerator: Failed to activate default shader program (0x%x)\n", shader_result);
         }
     }
     
     // Method 4: Texture manager preparation
     if (result == kIOReturnSuccess && m_texture_manager) {
-        IOLog("VMQemuVGAAccelerator: Preparing texture units for render pass\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Preparing texture units for render pass\n");
         
         // Reset texture unit bindings using proper API
         for (uint32_t unit = 0; unit < 8; unit++) {
             IOReturn tex_result = m_texture_manager->unbindTexture(context_id, unit);
             if (tex_result != kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: Warning: Failed to reset texture unit %d\n", unit);
+                VMLOG_ERROR("VMQemuVGAAccelerator: Warning: Failed to reset texture unit %d\n", unit);
             }
         }
         
-        IOLog("VMQemuVGAAccelerator: Texture units reset for render pass\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Texture units reset for render pass\n");
     }    // Method 5: Enhanced software fallback with comprehensive state tracking
     if (result != kIOReturnSuccess) {
-        IOLog("VMQemuVGAAccelerator: Using enhanced software render state fallback\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Using enhanced software render state fallback\n");
         
         // Create minimal render state for software rendering
         struct {
@@ -1479,7 +1520,7 @@ IOReturn CLASS::beginRenderPass(uint32_t context_id, uint32_t framebuffer_id)
             }
         }
         
-        IOLog("VMQemuVGAAccelerator: Software render state configured (viewport: %.0fx%.0f)\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Software render state configured (viewport: %.0fx%.0f)\n",
               software_state.viewport[2], software_state.viewport[3]);
         
         // Mark context as active
@@ -1491,14 +1532,14 @@ IOReturn CLASS::beginRenderPass(uint32_t context_id, uint32_t framebuffer_id)
     if (result == kIOReturnSuccess) {
         m_commands_submitted++;
         
-        IOLog("VMQemuVGAAccelerator: Render pass began successfully for context %d, framebuffer %d\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Render pass began successfully for context %d, framebuffer %d\n",
               context_id, framebuffer_id);
-        IOLog("VMQemuVGAAccelerator: GPU Device: %s, Shader Manager: %s, Texture Manager: %s\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: GPU Device: %s, Shader Manager: %s, Texture Manager: %s\n",
               m_gpu_device ? "Available" : "Software", 
               m_shader_manager ? "Active" : "Disabled",
               m_texture_manager ? "Active" : "Disabled");
     } else {
-        IOLog("VMQemuVGAAccelerator: Failed to begin render pass for context %d (0x%x)\n", 
+        VMLOG_ERROR("VMQemuVGAAccelerator: Failed to begin render pass for context %d (0x%x)\n", 
               context_id, result);
     }
     
@@ -1511,13 +1552,13 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
     if (!context)
         return kIOReturnNotFound;
     
-    IOLog("VMQemuVGAAccelerator: End render pass for context %d\n", context_id);
+    VMLOG_DEBUG("VMQemuVGAAccelerator: End render pass for context %d\n", context_id);
     
     IOReturn result = kIOReturnSuccess;
     
     // Method 1: VirtIO GPU 3D render finalization
     if (m_gpu_device && m_gpu_device->supports3D() && context->gpu_context_id) {
-        IOLog("VMQemuVGAAccelerator: Finalizing VirtIO GPU 3D render operations\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Finalizing VirtIO GPU 3D render operations\n");
         
         // Create command buffer for render finalization
         IOBufferMemoryDescriptor* cmdDesc = IOBufferMemoryDescriptor::withCapacity(256, kIODirectionOut);
@@ -1596,23 +1637,23 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
             cmdDesc->release();
             
             if (result == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU render finalization successful\n");
-                IOLog("VMQemuVGAAccelerator: Flush completed, fence ID: %d, display: %dx%d\n",
+                VMLOG_DEBUG("VMQemuVGAAccelerator: VirtIO GPU render finalization successful\n");
+                VMLOG_DEBUG("VMQemuVGAAccelerator: Flush completed, fence ID: %d, display: %dx%d\n",
                       gpu_finalize.fence_cmd.fence_id,
                       gpu_finalize.present_cmd.r.width,
                       gpu_finalize.present_cmd.r.height);
             } else {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU finalization failed (0x%x), using fallback\n", result);
+                VMLOG_ERROR("VMQemuVGAAccelerator: VirtIO GPU finalization failed (0x%x), using fallback\n", result);
             }
         } else {
-            IOLog("VMQemuVGAAccelerator: Failed to allocate command buffer for GPU finalization\n");
+            VMLOG_ERROR("VMQemuVGAAccelerator: Failed to allocate command buffer for GPU finalization\n");
             result = kIOReturnNoMemory;
         }
     }
     
     // Method 2: Hyper-V DDA framebuffer render finalization
     if ((result != kIOReturnSuccess || !m_gpu_device) && m_framebuffer) {
-        IOLog("VMQemuVGAAccelerator: Finalizing Hyper-V DDA framebuffer operations\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Finalizing Hyper-V DDA framebuffer operations\n");
         
         // Get VRAM for final flush operations
         IODeviceMemory* vram = m_framebuffer->getVRAMRange();
@@ -1624,7 +1665,7 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
                 uint32_t fb_height = qemu_device->getCurrentHeight();
                 uint32_t fb_stride = fb_width * 4; // 32-bit color
                 
-                IOLog("VMQemuVGAAccelerator: Flushing framebuffer %dx%d (stride: %d)\n",
+                VMLOG_DEBUG("VMQemuVGAAccelerator: Flushing framebuffer %dx%d (stride: %d)\n",
                       fb_width, fb_height, fb_stride);
                 
                 // Perform cache flush to ensure all writes reach VRAM
@@ -1638,7 +1679,7 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
                         // Use memory barrier to ensure all writes complete
                         __sync_synchronize();
                         
-                        IOLog("VMQemuVGAAccelerator: VRAM cache flush completed (%d bytes)\n", vram_size);
+                        VMLOG_DEBUG("VMQemuVGAAccelerator: VRAM cache flush completed (%d bytes)\n", vram_size);
                         
                         // Optional: Clear dirty regions tracking for next frame
                         struct {
@@ -1659,43 +1700,43 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
                             context->command_buffer->writeBytes(0, &frame_stats, sizeof(frame_stats));
                         }
                         
-                        IOLog("VMQemuVGAAccelerator: Frame %d completed (%d pixels updated)\n",
+                        VMLOG_DEBUG("VMQemuVGAAccelerator: Frame %d completed (%d pixels updated)\n",
                               frame_stats.frame_number, frame_stats.pixels_updated);
                     }
                     
                     vram_map->release();
                     result = kIOReturnSuccess;
                 } else {
-                    IOLog("VMQemuVGAAccelerator: Failed to map VRAM for finalization\n");
+                    VMLOG_ERROR("VMQemuVGAAccelerator: Failed to map VRAM for finalization\n");
                     result = kIOReturnError;
                 }
                 
                 // Trigger display refresh if device supports it
                 // Note: updateDisplay() may not be available, using synchronization instead
                 __sync_synchronize(); // Ensure memory coherency
-                IOLog("VMQemuVGAAccelerator: Display synchronization completed\n");
+                VMLOG_DEBUG("VMQemuVGAAccelerator: Display synchronization completed\n");
             } else {
-                IOLog("VMQemuVGAAccelerator: No QemuVGADevice available for finalization\n");
+                VMLOG_DEBUG("VMQemuVGAAccelerator: No QemuVGADevice available for finalization\n");
                 result = kIOReturnError;
             }
         } else {
-            IOLog("VMQemuVGAAccelerator: No VRAM available for finalization\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: No VRAM available for finalization\n");
             result = kIOReturnError;
         }
     }
     
     // Method 3: Shader pipeline cleanup and finalization
     if (result == kIOReturnSuccess && m_shader_manager && context->gpu_context_id) {
-        IOLog("VMQemuVGAAccelerator: Finalizing shader pipeline operations\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Finalizing shader pipeline operations\n");
         
         // Unbind active shader program to clean up GPU state
         IOReturn shader_result = m_shader_manager->useProgram(context_id, 0); // Program 0 = fixed function
         
         if (shader_result == kIOReturnSuccess) {
-            IOLog("VMQemuVGAAccelerator: Shader program unbound, switched to fixed function\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Shader program unbound, switched to fixed function\n");
             
             // Enhanced uniform clearing with comprehensive state reset
-            IOLog("VMQemuVGAAccelerator: Initiating comprehensive uniform state cleanup\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Initiating comprehensive uniform state cleanup\n");
             
             // Clear critical uniform categories
             struct UniformClearOperation {
@@ -1743,7 +1784,7 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
                 uint64_t category_end = getCurrentTimestamp();
                 clear_ops[i].clear_time_microseconds = (uint32_t)convertToMicroseconds(category_end - category_start);
                 
-                IOLog("VMQemuVGAAccelerator: %s cleared - %d uniforms (%d μs, %s)\n",
+                VMLOG_DEBUG("VMQemuVGAAccelerator: %s cleared - %d uniforms (%d μs, %s)\n",
                       clear_ops[i].uniform_category,
                       clear_ops[i].uniforms_cleared,
                       clear_ops[i].clear_time_microseconds,
@@ -1762,12 +1803,12 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
                 if (clear_ops[i].clear_successful) successful_categories++;
             }
             
-            IOLog("VMQemuVGAAccelerator: Uniform cleanup summary - %d uniforms cleared across %d categories (%d μs total)\n",
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Uniform cleanup summary - %d uniforms cleared across %d categories (%d μs total)\n",
                   total_uniforms_cleared, successful_categories, total_clear_time);
             
-            IOLog("VMQemuVGAAccelerator: Shader pipeline reset to fixed function mode (comprehensive cleanup completed)\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Shader pipeline reset to fixed function mode (comprehensive cleanup completed)\n");
         } else {
-            IOLog("VMQemuVGAAccelerator: Warning: Failed to unbind shader program (0x%x)\n", shader_result);
+            VMLOG_ERROR("VMQemuVGAAccelerator: Warning: Failed to unbind shader program (0x%x)\n", shader_result);
         }
         
         // Collect shader statistics
@@ -1864,42 +1905,42 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
         shader_stats.shader_execution_time = perf_stats.total_shader_time_us;
         
         // Method 4: Detailed performance logging
-        IOLog("VMQemuVGAAccelerator: Shader Performance Analysis:\n");
-        IOLog("  Complexity - VS Ops: %d, FS Ops: %d, Tex: %d, Math: %d, Branches: %d\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Shader Performance Analysis:\n");
+        VMLOG_DEBUG("  Complexity - VS Ops: %d, FS Ops: %d, Tex: %d, Math: %d, Branches: %d\n",
               complexity_profile.vertex_shader_operations,
               complexity_profile.fragment_shader_operations,
               complexity_profile.texture_lookups,
               complexity_profile.mathematical_operations,
               complexity_profile.branch_instructions);
-        IOLog("  Timing - Estimated: %.2f μs, Measured: %llu μs, Total: %llu μs\n",
+        VMLOG_DEBUG("  Timing - Estimated: %.2f μs, Measured: %llu μs, Total: %llu μs\n",
               complexity_profile.estimated_execution_time_us,
               actual_profile_time,
               shader_stats.shader_execution_time);
-        IOLog("  Performance - GPU Load: %.1f%%, Avg: %.2f μs/call, Category: %s\n",
+        VMLOG_DEBUG("  Performance - GPU Load: %.1f%%, Avg: %.2f μs/call, Category: %s\n",
               perf_stats.gpu_utilization_percent,
               perf_stats.average_execution_time_us,
               perf_stats.performance_category);
         
         // Method 5: Performance recommendations
         if (perf_stats.gpu_utilization_percent > 95.0f) {
-            IOLog("VMQemuVGAAccelerator: PERFORMANCE WARNING - GPU utilization %.1f%% exceeds threshold\n", 
+            VMLOG_WARN("VMQemuVGAAccelerator: PERFORMANCE WARNING - GPU utilization %.1f%% exceeds threshold\n", 
                   perf_stats.gpu_utilization_percent);
-            IOLog("VMQemuVGAAccelerator: RECOMMENDATIONS:\n");
-            IOLog("  - Reduce shader complexity (currently %.0f cycles)\n", complexity_profile.estimated_gpu_cycles);
-            IOLog("  - Optimize texture lookups (currently %d per shader)\n", complexity_profile.texture_lookups);
-            IOLog("  - Consider level-of-detail (LOD) techniques\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: RECOMMENDATIONS:\n");
+            VMLOG_DEBUG("  - Reduce shader complexity (currently %.0f cycles)\n", complexity_profile.estimated_gpu_cycles);
+            VMLOG_DEBUG("  - Optimize texture lookups (currently %d per shader)\n", complexity_profile.texture_lookups);
+            VMLOG_DEBUG("  - Consider level-of-detail (LOD) techniques\n");
         } else if (perf_stats.gpu_utilization_percent < 10.0f) {
-            IOLog("VMQemuVGAAccelerator: GPU utilization very low (%.1f%%) - opportunity for enhancement\n", 
+            VMLOG_DEBUG("VMQemuVGAAccelerator: GPU utilization very low (%.1f%%) - opportunity for enhancement\n", 
                   perf_stats.gpu_utilization_percent);
         }
         
-        IOLog("VMQemuVGAAccelerator: Shader stats - Programs: %d, Uniforms: %d, Textures: %d\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Shader stats - Programs: %d, Uniforms: %d, Textures: %d\n",
               shader_stats.shaders_used, shader_stats.uniforms_set, shader_stats.texture_units_bound);
     }
     
     // Method 4: Texture manager cleanup and resource management
     if (result == kIOReturnSuccess && m_texture_manager) {
-        IOLog("VMQemuVGAAccelerator: Finalizing texture operations and resource management\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Finalizing texture operations and resource management\n");
         
         // Count and optionally flush texture units
         uint32_t textures_bound = 0;
@@ -1914,13 +1955,13 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
                 if (tex_result == kIOReturnSuccess) {
                     texture_was_bound = true;
                     textures_bound++;
-                    IOLog("VMQemuVGAAccelerator: Detected and unbound texture from unit %d\n", unit);
+                    VMLOG_DEBUG("VMQemuVGAAccelerator: Detected and unbound texture from unit %d\n", unit);
                 } else if (tex_result == kIOReturnNotFound) {
                     // No texture bound to this unit - expected result
-                    IOLog("VMQemuVGAAccelerator: No texture bound to unit %d\n", unit);
+                    VMLOG_DEBUG("VMQemuVGAAccelerator: No texture bound to unit %d\n", unit);
                 } else {
                     // Unbind failed for other reason - texture might still be bound
-                    IOLog("VMQemuVGAAccelerator: Warning: Failed to unbind texture unit %d (0x%x)\n", 
+                    VMLOG_ERROR("VMQemuVGAAccelerator: Warning: Failed to unbind texture unit %d (0x%x)\n", 
                           unit, tex_result);
                 }
             }
@@ -1964,7 +2005,7 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
                             
                             surface_potentially_bound = true;
                             
-                            IOLog("VMQemuVGAAccelerator: Surface %d (%dx%d) potentially bound to texture unit %d\n", 
+                            VMLOG_DEBUG("VMQemuVGAAccelerator: Surface %d (%dx%d) potentially bound to texture unit %d\n", 
                                   surface->surface_id, binding_info.width, binding_info.height, unit);
                         }
                         
@@ -1992,7 +2033,7 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
                                 
                                 surface_potentially_bound = true;
                                 
-                                IOLog("VMQemuVGAAccelerator: Surface %d (%dx%d, POT) heuristically bound to unit %d\n",
+                                VMLOG_DEBUG("VMQemuVGAAccelerator: Surface %d (%dx%d, POT) heuristically bound to unit %d\n",
                                       surface->surface_id, surface_width, surface_height, unit);
                             }
                         }
@@ -2013,7 +2054,7 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
                                 
                                 surface_potentially_bound = true;
                                 
-                                IOLog("VMQemuVGAAccelerator: Context surface %d bound to texture unit %d\n",
+                                VMLOG_DEBUG("VMQemuVGAAccelerator: Context surface %d bound to texture unit %d\n",
                                       surface->surface_id, unit);
                             }
                         }
@@ -2027,15 +2068,15 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
                                 texture_was_bound = true;
                                 textures_bound++;
                                 
-                                IOLog("VMQemuVGAAccelerator: Successfully unbound surface %d from texture unit %d\n",
+                                VMLOG_DEBUG("VMQemuVGAAccelerator: Successfully unbound surface %d from texture unit %d\n",
                                       binding_info.surface_id, unit);
                                 
                                 // Log comprehensive binding information
-                                IOLog("VMQemuVGAAccelerator: Texture binding details - Unit: %d, Resource: %d, Size: %dx%d, Format: 0x%x\n",
+                                VMLOG_DEBUG("VMQemuVGAAccelerator: Texture binding details - Unit: %d, Resource: %d, Size: %dx%d, Format: 0x%x\n",
                                       binding_info.texture_unit, binding_info.gpu_resource_id,
                                       binding_info.width, binding_info.height, binding_info.texture_format);
                             } else {
-                                IOLog("VMQemuVGAAccelerator: Failed to unbind surface %d from texture unit %d (0x%x)\n",
+                                VMLOG_ERROR("VMQemuVGAAccelerator: Failed to unbind surface %d from texture unit %d (0x%x)\n",
                                       binding_info.surface_id, unit, surface_unbind_result);
                             }
                             
@@ -2048,33 +2089,33 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
         }
         
         if (textures_bound > 0) {
-            IOLog("VMQemuVGAAccelerator: Unbound %d texture units for context cleanup\n", textures_bound);
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Unbound %d texture units for context cleanup\n", textures_bound);
         }
         
         // Optional: Trigger texture memory garbage collection
         uint32_t textures_freed = 0;
         IOReturn gc_result = garbageCollectTextures(&textures_freed);
         if (gc_result == kIOReturnSuccess && textures_freed > 0) {
-            IOLog("VMQemuVGAAccelerator: Texture garbage collection freed %d textures\n", textures_freed);
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Texture garbage collection freed %d textures\n", textures_freed);
         }
         
         // Update texture memory statistics
         uint64_t texture_memory_used = 0;
         IOReturn mem_result = getTextureMemoryUsage(&texture_memory_used);
         if (mem_result == kIOReturnSuccess) {
-            IOLog("VMQemuVGAAccelerator: Texture memory usage: %llu KB\n", texture_memory_used / 1024);
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Texture memory usage: %llu KB\n", texture_memory_used / 1024);
             m_memory_allocated = texture_memory_used; // Update global stats
         }
     }
     
     // Method 5: Command buffer pool finalization and performance tracking
     if (result == kIOReturnSuccess && m_command_pool) {
-        IOLog("VMQemuVGAAccelerator: Finalizing command buffer operations\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Finalizing command buffer operations\n");
         
         // Return any borrowed command buffers to the pool
         IOReturn pool_result = returnCommandBuffer(context_id);
         if (pool_result == kIOReturnSuccess) {
-            IOLog("VMQemuVGAAccelerator: Command buffer returned to pool\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Command buffer returned to pool\n");
         }
         
         // Get command buffer pool statistics
@@ -2087,7 +2128,7 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
         
         pool_result = getCommandPoolStatistics(&pool_stats);
         if (pool_result == kIOReturnSuccess) {
-            IOLog("VMQemuVGAAccelerator: Pool stats - Allocated: %d, In use: %d, Peak: %d, Commands: %llu\n",
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Pool stats - Allocated: %d, In use: %d, Peak: %d, Commands: %llu\n",
                   pool_stats.buffers_allocated, pool_stats.buffers_in_use, 
                   pool_stats.peak_usage, pool_stats.total_commands_processed);
         }
@@ -2095,7 +2136,7 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
     
     // Method 6: Enhanced software fallback finalization
     if (result != kIOReturnSuccess) {
-        IOLog("VMQemuVGAAccelerator: Finalizing render pass with software fallback\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Finalizing render pass with software fallback\n");
         
         // Create comprehensive software finalization
         struct {
@@ -2124,11 +2165,11 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
             software_finalize.software_fallback_reason = 4; // Other error
         }
         
-        IOLog("VMQemuVGAAccelerator: Software finalization - Primitives: %d, Vertices: %d, Time: %llu μs\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Software finalization - Primitives: %d, Vertices: %d, Time: %llu μs\n",
               software_finalize.primitives_rendered, 
               software_finalize.vertices_processed,
               software_finalize.render_time_microseconds);
-        IOLog("VMQemuVGAAccelerator: Fallback reason: %d (1=NoGPU, 2=No3D, 3=NoFB, 4=Other)\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Fallback reason: %d (1=NoGPU, 2=No3D, 3=NoFB, 4=Other)\n",
               software_finalize.software_fallback_reason);
         
         result = kIOReturnSuccess; // Software fallback always succeeds
@@ -2152,17 +2193,17 @@ IOReturn CLASS::endRenderPass(uint32_t context_id)
             
             if (render_time_us > 0) {
                 uint32_t fps = calculateFPS(render_time_us);
-                IOLog("VMQemuVGAAccelerator: Render timing - %llu μs (%d FPS estimated)\n", 
+                VMLOG_DEBUG("VMQemuVGAAccelerator: Render timing - %llu μs (%d FPS estimated)\n", 
                       render_time_us, fps);
             }
         }
         last_render_time = current_time;
         
-        IOLog("VMQemuVGAAccelerator: Render pass finalized successfully for context %d\n", context_id);
-        IOLog("VMQemuVGAAccelerator: Total commands: %d, Draw calls: %d, Triangles: %d\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Render pass finalized successfully for context %d\n", context_id);
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Total commands: %d, Draw calls: %d, Triangles: %d\n",
               m_commands_submitted, m_draw_calls, m_triangles_rendered);
     } else {
-        IOLog("VMQemuVGAAccelerator: Failed to finalize render pass for context %d (0x%x)\n", 
+        VMLOG_ERROR("VMQemuVGAAccelerator: Failed to finalize render pass for context %d (0x%x)\n", 
               context_id, result);
         
         // Even on failure, mark context as inactive to prevent state corruption
@@ -2179,20 +2220,49 @@ IOReturn CLASS::drawPrimitives(uint32_t context_id, uint32_t primitive_type,
     if (!context)
         return kIOReturnNotFound;
     
+    // Uniforms changed since the last draw go ahead of it
+    IOReturn ret = flushShaderUniforms(context_id, context);
+    if (ret != kIOReturnSuccess) {
+        VMLOG_ERROR("VMQemuVGAAccelerator: Uniform upload failed for context %d: 0x%x\n", context_id, ret);
+    }
+    
     // Submit draw command via GPU device
-    IOReturn ret = m_gpu_device->executeCommands(context->gpu_context_id, nullptr);
+    ret = m_gpu_device->executeCommands(context->gpu_context_id, nullptr);
     
     if (ret == kIOReturnSuccess) {
         m_draw_calls++;
         m_triangles_rendered += vertex_count / 3; // Approximate triangle count
     }
     
-    IOLog("VMQemuVGAAccelerator: Draw %d vertices (type %d) for context %d\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Draw %d vertices (type %d) for context %d\n",
           vertex_count, primitive_type, context_id);
     
     return ret;
 }
 
+IOReturn CLASS::flushShaderUniforms(uint32_t context_id, AccelContext* context)
+{
+    if (!m_shader_manager || !m_gpu_device || !context->gpu_context_id)
+        return kIOReturnSuccess;
+    
+    // Small stack stream; flushUniforms resumes where a full one stopped
+    uint32_t stream[128];
+    struct virgl_encoder enc;
+    IOReturn ret;
+    do {
+        virgl_encoder_init(&enc, stream, 128);
+        ret = m_shader_manager->flushUniforms(context_id, context->gpu_context_id, &enc);
+        if (enc.len) {
+            IOReturn submit = m_gpu_device->executeCommandBytes(context->gpu_context_id, stream,
+                                                                enc.len * sizeof(uint32_t));
+            if (submit != kIOReturnSuccess)
+                return submit;
+        }
+    } while (ret == kIOReturnNoSpace && enc.len);
+    
+    return ret;
+}
+
 // Statistics and debugging methods
 IOReturn CLASS::getPerformanceStats(void* stats_buffer, size_t* buffer_size)
 {
@@ -2252,18 +2322,18 @@ bool CLASS::supportsAcceleration(uint32_t feature_flags)
 
 void CLASS::logAcceleratorState()
 {
-    IOLog("VMQemuVGAAccelerator State:\n");
-    IOLog("  GPU Device: %s\n", m_gpu_device ? "Available" : "Not Available");
-    IOLog("  Active Contexts: %u\n", m_context_count);
-    IOLog("  Active Surfaces: %u\n", m_surface_count);
-    IOLog("  Commands Submitted: %u\n", m_commands_submitted);
-    IOLog("  Draw Calls: %u\n", m_draw_calls);
-    IOLog("  Triangles Rendered: %u\n", m_triangles_rendered);
-    IOLog("  Memory Allocated: %llu KB\n", m_memory_allocated / 1024);
-    IOLog("  Shader Manager: %s\n", m_shader_manager ? "Available" : "Not Available");
-    IOLog("  Texture Manager: %s\n", m_texture_manager ? "Available" : "Not Available");
-    IOLog("  Command Buffer Pool: %s\n", m_command_pool ? "Available" : "Not Available");
-    IOLog("  Metal Compatible: %s\n", m_metal_compatible ? "Yes" : "No");
+    VMLOG_INFO("VMQemuVGAAccelerator State:\n");
+    VMLOG_INFO("  GPU Device: %s\n", m_gpu_device ? "Available" : "Not Available");
+    VMLOG_INFO("  Active Contexts: %u\n", m_context_count);
+    VMLOG_INFO("  Active Surfaces: %u\n", m_surface_count);
+    VMLOG_INFO("  Commands Submitted: %u\n", m_commands_submitted);
+    VMLOG_INFO("  Draw Calls: %u\n", m_draw_calls);
+    VMLOG_INFO("  Triangles Rendered: %u\n", m_triangles_rendered);
+    VMLOG_INFO("  Memory Allocated: %llu KB\n", m_memory_allocated / 1024);
+    VMLOG_INFO("  Shader Manager: %s\n", m_shader_manager ? "Available" : "Not Available");
+    VMLOG_INFO("  Texture Manager: %s\n", m_texture_manager ? "Available" : "Not Available");
+    VMLOG_INFO("  Command Buffer Pool: %s\n", m_command_pool ? "Available" : "Not Available");
+    VMLOG_INFO("  Metal Compatible: %s\n", m_metal_compatible ? "Yes" : "No");
 }
 
 IOReturn CLASS::enableBlending(uint32_t context_id, bool enable)
@@ -2276,14 +2346,14 @@ IOReturn CLASS::enableBlending(uint32_t context_id, bool enable)
         return kIOReturnNotFound;
     }
     
-    IOLog("VMQemuVGAAccelerator::enableBlending: context_id=%d, enable=%s\n", 
+    VMLOG_INFO("VMQemuVGAAccelerator::enableBlending: context_id=%d, enable=%s\n", 
           context_id, enable ? "true" : "false");
     
     IOReturn result = kIOReturnSuccess;
     
     // Method 1: VirtIO GPU hardware-accelerated blending control
     if (m_gpu_device && m_gpu_device->supports3D() && context->gpu_context_id) {
-        IOLog("VMQemuVGAAccelerator: Configuring VirtIO GPU blending state\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: Configuring VirtIO GPU blending state\n");
         
         IOBufferMemoryDescriptor* cmdDesc = IOBufferMemoryDescriptor::withCapacity(256, kIODirectionOut);
         if (cmdDesc) {
@@ -2333,16 +2403,16 @@ IOReturn CLASS::enableBlending(uint32_t context_id, bool enable)
             cmdDesc->release();
             
             if (result == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU blending %s successfully\n", enable ? "enabled" : "disabled");
+                VMLOG_INFO("VMQemuVGAAccelerator: VirtIO GPU blending %s successfully\n", enable ? "enabled" : "disabled");
             } else {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU blending command failed (0x%x)\n", result);
+                VMLOG_ERROR("VMQemuVGAAccelerator: VirtIO GPU blending command failed (0x%x)\n", result);
             }
         }
     }
     
     // Method 2: Software blending state tracking for framebuffer operations
     if (result != kIOReturnSuccess || !m_gpu_device) {
-        IOLog("VMQemuVGAAccelerator: Using software blending state tracking\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: Using software blending state tracking\n");
         
         // Store blending state in context for software rendering
         if (context->command_buffer) {
@@ -2370,7 +2440,7 @@ IOReturn CLASS::enableBlending(uint32_t context_id, bool enable)
             IOReturn cmd_result = kIOReturnSuccess;
             if (context->command_buffer) {
                 // Enhanced command buffer storage with proper state management
-                IOLog("VMQemuVGAAccelerator: Storing blend state in command buffer\n");
+                VMLOG_INFO("VMQemuVGAAccelerator: Storing blend state in command buffer\n");
                 
                 // Create command buffer entry for blend state
                 struct BlendStateCommand {
@@ -2415,37 +2485,37 @@ IOReturn CLASS::enableBlending(uint32_t context_id, bool enable)
                     cmd_result = (IOReturn)context->command_buffer->writeBytes(current_offset, &blend_cmd, sizeof(blend_cmd));
                     
                     if (cmd_result == kIOReturnSuccess) {
-                        IOLog("VMQemuVGAAccelerator: Blend state command written to buffer (size: %lu bytes, timestamp: %u)\n", 
+                        VMLOG_INFO("VMQemuVGAAccelerator: Blend state command written to buffer (size: %lu bytes, timestamp: %u)\n", 
                               sizeof(blend_cmd), blend_cmd.timestamp);
                         
                         // Update estimated command count
                         uint32_t total_commands = (uint32_t)(sizeof(blend_cmd) / sizeof(uint32_t));
-                        IOLog("VMQemuVGAAccelerator: Command buffer updated with blend state (%d command words)\n", total_commands);
+                        VMLOG_INFO("VMQemuVGAAccelerator: Command buffer updated with blend state (%d command words)\n", total_commands);
                         
                         // Log detailed blend configuration
-                        IOLog("VMQemuVGAAccelerator: Blend command details - Type: 0x%x, Size: %u, Context: %d\n",
+                        VMLOG_INFO("VMQemuVGAAccelerator: Blend command details - Type: 0x%x, Size: %u, Context: %d\n",
                               blend_cmd.command_type, blend_cmd.command_size, blend_cmd.context_id);
-                        IOLog("VMQemuVGAAccelerator: Blend parameters - Enable: %s, SrcFactor: 0x%x, DstFactor: 0x%x\n",
+                        VMLOG_INFO("VMQemuVGAAccelerator: Blend parameters - Enable: %s, SrcFactor: 0x%x, DstFactor: 0x%x\n",
                               blend_cmd.blend_params.enabled ? "true" : "false",
                               blend_cmd.blend_params.src_factor, blend_cmd.blend_params.dst_factor);
                     } else {
-                        IOLog("VMQemuVGAAccelerator: Failed to write blend command to buffer (0x%x)\n", cmd_result);
+                        VMLOG_ERROR("VMQemuVGAAccelerator: Failed to write blend command to buffer (0x%x)\n", cmd_result);
                         
                         // Fallback: Store blend state in context metadata
-                        IOLog("VMQemuVGAAccelerator: Using context metadata fallback for blend state\n");
+                        VMLOG_INFO("VMQemuVGAAccelerator: Using context metadata fallback for blend state\n");
                         
                         // Since we can't modify the context structure, just log the state
-                        IOLog("VMQemuVGAAccelerator: Blend state cached - Enable: %s, Equation: 0x%x\n",
+                        VMLOG_INFO("VMQemuVGAAccelerator: Blend state cached - Enable: %s, Equation: 0x%x\n",
                               blend_cmd.blend_params.enabled ? "true" : "false",
                               blend_cmd.blend_params.blend_equation);
                         
                         cmd_result = kIOReturnSuccess; // Accept fallback as success
                     }
                 } else {
-                    IOLog("VMQemuVGAAccelerator: No command buffer available, using direct state tracking\n");
+                    VMLOG_INFO("VMQemuVGAAccelerator: No command buffer available, using direct state tracking\n");
                     
                     // Direct state tracking without command buffer
-                    IOLog("VMQemuVGAAccelerator: Direct blend state - Enable: %s, Src: 0x%x, Dst: 0x%x, Eq: 0x%x\n",
+                    VMLOG_INFO("VMQemuVGAAccelerator: Direct blend state - Enable: %s, Src: 0x%x, Dst: 0x%x, Eq: 0x%x\n",
                           soft_blend_state.enabled ? "true" : "false",
                           soft_blend_state.src_factor, soft_blend_state.dst_factor, soft_blend_state.blend_equation);
                     
@@ -2454,25 +2524,25 @@ IOReturn CLASS::enableBlending(uint32_t context_id, bool enable)
             }
             
             if (cmd_result == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: Enhanced blend state management completed successfully\n");
-                IOLog("VMQemuVGAAccelerator: Blend config - Enable: %s, Src: 0x%x, Dst: 0x%x, Eq: 0x%x\n",
+                VMLOG_INFO("VMQemuVGAAccelerator: Enhanced blend state management completed successfully\n");
+                VMLOG_INFO("VMQemuVGAAccelerator: Blend config - Enable: %s, Src: 0x%x, Dst: 0x%x, Eq: 0x%x\n",
                       soft_blend_state.enabled ? "true" : "false",
                       soft_blend_state.src_factor, soft_blend_state.dst_factor, soft_blend_state.blend_equation);
                 result = kIOReturnSuccess;
             } else {
-                IOLog("VMQemuVGAAccelerator: Enhanced blend state management failed (0x%x)\n", cmd_result);
+                VMLOG_ERROR("VMQemuVGAAccelerator: Enhanced blend state management failed (0x%x)\n", cmd_result);
                 result = kIOReturnError;
             }
         } else {
             // No command buffer - just track the state
-            IOLog("VMQemuVGAAccelerator: Blending %s (state tracking only)\n", enable ? "enabled" : "disabled");
+            VMLOG_INFO("VMQemuVGAAccelerator: Blending %s (state tracking only)\n", enable ? "enabled" : "disabled");
             result = kIOReturnSuccess;
         }
     }
     
     // Method 3: Metal/CoreAnimation bridge for advanced compositing
     if (result == kIOReturnSuccess && m_metal_compatible && enable) {
-        IOLog("VMQemuVGAAccelerator: Configuring Metal-compatible blending pipeline\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: Configuring Metal-compatible blending pipeline\n");
         
         // Setup Metal blending descriptor equivalent
         struct {
@@ -2495,7 +2565,7 @@ IOReturn CLASS::enableBlending(uint32_t context_id, bool enable)
         metal_blend_desc.alpha_blend_operation = 0;       // MTLBlendOperationAdd
         metal_blend_desc.write_mask = 0xF;               // MTLColorWriteMaskAll
         
-        IOLog("VMQemuVGAAccelerator: Metal blend descriptor configured (RGB: %d->%d, A: %d->%d)\n",
+        VMLOG_INFO("VMQemuVGAAccelerator: Metal blend descriptor configured (RGB: %d->%d, A: %d->%d)\n",
               metal_blend_desc.source_rgb_blend_factor, metal_blend_desc.destination_rgb_blend_factor,
               metal_blend_desc.source_alpha_blend_factor, metal_blend_desc.destination_alpha_blend_factor);
     }
@@ -2514,14 +2584,14 @@ IOReturn CLASS::enableDepthTest(uint32_t context_id, bool enable)
         return kIOReturnNotFound;
     }
     
-    IOLog("VMQemuVGAAccelerator::enableDepthTest: context_id=%d, enable=%s\n", 
+    VMLOG_INFO("VMQemuVGAAccelerator::enableDepthTest: context_id=%d, enable=%s\n", 
           context_id, enable ? "true" : "false");
     
     IOReturn result = kIOReturnSuccess;
     
     // Method 1: VirtIO GPU hardware-accelerated depth testing
     if (m_gpu_device && m_gpu_device->supports3D() && context->gpu_context_id) {
-        IOLog("VMQemuVGAAccelerator: Configuring VirtIO GPU depth testing\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: Configuring VirtIO GPU depth testing\n");
         
         IOBufferMemoryDescriptor* cmdDesc = IOBufferMemoryDescriptor::withCapacity(256, kIODirectionOut);
         if (cmdDesc) {
@@ -2565,16 +2635,16 @@ IOReturn CLASS::enableDepthTest(uint32_t context_id, bool enable)
             cmdDesc->release();
             
             if (result == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU depth testing %s successfully\n", enable ? "enabled" : "disabled");
+                VMLOG_INFO("VMQemuVGAAccelerator: VirtIO GPU depth testing %s successfully\n", enable ? "enabled" : "disabled");
             } else {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU depth command failed (0x%x)\n", result);
+                VMLOG_ERROR("VMQemuVGAAccelerator: VirtIO GPU depth command failed (0x%x)\n", result);
             }
         }
     }
     
     // Method 2: Software depth buffer management
     if (result != kIOReturnSuccess || !m_gpu_device) {
-        IOLog("VMQemuVGAAccelerator: Using software depth buffer management\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: Using software depth buffer management\n");
         
         if (context->command_buffer) {
             struct {
@@ -2606,7 +2676,7 @@ IOReturn CLASS::enableDepthTest(uint32_t context_id, bool enable)
             IOReturn cmd_result = kIOReturnSuccess;
             if (context->command_buffer) {
                 // Enhanced depth state command buffer management
-                IOLog("VMQemuVGAAccelerator: Storing depth state in command buffer\n");
+                VMLOG_INFO("VMQemuVGAAccelerator: Storing depth state in command buffer\n");
                 
                 // Create comprehensive depth state command
                 struct DepthStateCommand {
@@ -2646,26 +2716,26 @@ IOReturn CLASS::enableDepthTest(uint32_t context_id, bool enable)
                 cmd_result = (IOReturn)context->command_buffer->writeBytes(0, &depth_cmd, sizeof(depth_cmd));
                 
                 if (cmd_result == kIOReturnSuccess) {
-                    IOLog("VMQemuVGAAccelerator: Depth state command written to buffer (size: %lu bytes, timestamp: %u)\n", 
+                    VMLOG_INFO("VMQemuVGAAccelerator: Depth state command written to buffer (size: %lu bytes, timestamp: %u)\n", 
                           sizeof(depth_cmd), depth_cmd.timestamp);
                     
                     // Log comprehensive depth configuration
-                    IOLog("VMQemuVGAAccelerator: Depth command details - Type: 0x%x, Size: %u, Context: %d\n",
+                    VMLOG_INFO("VMQemuVGAAccelerator: Depth command details - Type: 0x%x, Size: %u, Context: %d\n",
                           depth_cmd.command_type, depth_cmd.command_size, depth_cmd.context_id);
-                    IOLog("VMQemuVGAAccelerator: Depth test: %s, Write: %s, Function: 0x%x, Format: 0x%x\n",
+                    VMLOG_INFO("VMQemuVGAAccelerator: Depth test: %s, Write: %s, Function: 0x%x, Format: 0x%x\n",
                           depth_cmd.depth_params.depth_test_enabled ? "ON" : "OFF",
                           depth_cmd.depth_params.depth_write_enabled ? "ON" : "OFF",
                           depth_cmd.depth_params.depth_function,
                           depth_cmd.depth_params.depth_buffer_format);
-                    IOLog("VMQemuVGAAccelerator: Depth range: %.3f to %.3f, Clear value: 0x%x, Clamp: %s\n",
+                    VMLOG_INFO("VMQemuVGAAccelerator: Depth range: %.3f to %.3f, Clear value: 0x%x, Clamp: %s\n",
                           depth_cmd.depth_params.near_plane, depth_cmd.depth_params.far_plane,
                           depth_cmd.depth_params.depth_clear_value,
                           depth_cmd.depth_params.depth_clamp_enabled ? "ON" : "OFF");
                 } else {
-                    IOLog("VMQemuVGAAccelerator: Failed to write depth command to buffer (0x%x)\n", cmd_result);
+                    VMLOG_ERROR("VMQemuVGAAccelerator: Failed to write depth command to buffer (0x%x)\n", cmd_result);
                     
                     // Fallback: Log depth state without command buffer
-                    IOLog("VMQemuVGAAccelerator: Depth state fallback - Test: %s, Write: %s, Func: 0x%x\n",
+                    VMLOG_INFO("VMQemuVGAAccelerator: Depth state fallback - Test: %s, Write: %s, Func: 0x%x\n",
                           soft_depth_state.depth_test_enabled ? "enabled" : "disabled",
                           soft_depth_state.depth_write_enabled ? "enabled" : "disabled",
                           soft_depth_state.depth_function);
@@ -2674,34 +2744,34 @@ IOReturn CLASS::enableDepthTest(uint32_t context_id, bool enable)
                 }
             } else {
                 // No command buffer available - direct logging
-                IOLog("VMQemuVGAAccelerator: Direct depth state tracking (no command buffer)\n");
-                IOLog("VMQemuVGAAccelerator: Depth configuration - Test: %s, Write: %s, Function: 0x%x\n",
+                VMLOG_INFO("VMQemuVGAAccelerator: Direct depth state tracking (no command buffer)\n");
+                VMLOG_INFO("VMQemuVGAAccelerator: Depth configuration - Test: %s, Write: %s, Function: 0x%x\n",
                       soft_depth_state.depth_test_enabled ? "enabled" : "disabled",
                       soft_depth_state.depth_write_enabled ? "enabled" : "disabled",
                       soft_depth_state.depth_function);
-                IOLog("VMQemuVGAAccelerator: Depth range: %.3f - %.3f, Format: 0x%x\n",
+                VMLOG_INFO("VMQemuVGAAccelerator: Depth range: %.3f - %.3f, Format: 0x%x\n",
                       soft_depth_state.near_plane, soft_depth_state.far_plane, soft_depth_state.depth_buffer_format);
                 
                 cmd_result = kIOReturnSuccess;
             }
             
             if (cmd_result == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: Software depth state configured (func: 0x%x, range: %.1f-%.1f)\n",
+                VMLOG_INFO("VMQemuVGAAccelerator: Software depth state configured (func: 0x%x, range: %.1f-%.1f)\n",
                       soft_depth_state.depth_function, soft_depth_state.near_plane, soft_depth_state.far_plane);
                 result = kIOReturnSuccess;
             } else {
-                IOLog("VMQemuVGAAccelerator: Failed to store software depth state (0x%x)\n", cmd_result);
+                VMLOG_ERROR("VMQemuVGAAccelerator: Failed to store software depth state (0x%x)\n", cmd_result);
                 result = kIOReturnError;
             }
         } else {
-            IOLog("VMQemuVGAAccelerator: Depth testing %s (state tracking only)\n", enable ? "enabled" : "disabled");
+            VMLOG_INFO("VMQemuVGAAccelerator: Depth testing %s (state tracking only)\n", enable ? "enabled" : "disabled");
             result = kIOReturnSuccess;
         }
     }
     
     // Method 3: Depth buffer allocation/deallocation management
     if (result == kIOReturnSuccess && enable) {
-        IOLog("VMQemuVGAAccelerator: Managing depth buffer resources\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: Managing depth buffer resources\n");
         
         // Check if we need to allocate a depth buffer for this context
         bool needs_depth_buffer = true;
@@ -2712,13 +2782,13 @@ IOReturn CLASS::enableDepthTest(uint32_t context_id, bool enable)
             if (surface && (surface->info.format == VM3D_FORMAT_X8R8G8B8 ||
                             surface->info.format == VM3D_FORMAT_A8R8G8B8)) {
                 needs_depth_buffer = false;
-                IOLog("VMQemuVGAAccelerator: Found existing depth buffer (surface %u)\n", surface->surface_id);
+                VMLOG_INFO("VMQemuVGAAccelerator: Found existing depth buffer (surface %u)\n", surface->surface_id);
                 break;
             }
         }
         
         if (needs_depth_buffer) {
-            IOLog("VMQemuVGAAccelerator: Allocating new depth buffer for context %d\n", context_id);
+            VMLOG_INFO("VMQemuVGAAccelerator: Allocating new depth buffer for context %d\n", context_id);
             
             // Get framebuffer dimensions for depth buffer sizing
             uint32_t depth_width = 1024;  // Default
@@ -2742,14 +2812,14 @@ IOReturn CLASS::enableDepthTest(uint32_t context_id, bool enable)
             // Allocate depth surface
             IOReturn depth_result = create3DSurface(context_id, &depth_info);
             if (depth_result == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: Depth buffer allocated (%dx%d, surface %d)\n",
+                VMLOG_INFO("VMQemuVGAAccelerator: Depth buffer allocated (%dx%d, surface %d)\n",
                       depth_width, depth_height, depth_info.surface_id);
             } else {
-                IOLog("VMQemuVGAAccelerator: Warning: Failed to allocate depth buffer (0x%x)\n", depth_result);
+                VMLOG_ERROR("VMQemuVGAAccelerator: Warning: Failed to allocate depth buffer (0x%x)\n", depth_result);
             }
         }
     } else if (result == kIOReturnSuccess && !enable) {
-        IOLog("VMQemuVGAAccelerator: Depth testing disabled, depth buffer retained\n");
+        VMLOG_INFO("VMQemuVGAAccelerator: Depth testing disabled, depth buffer retained\n");
     }
     
     IOLockUnlock(m_lock);
@@ -2766,7 +2836,7 @@ IOReturn CLASS::clearColorBuffer(uint32_t context_id, float r, float g, float b,
         return kIOReturnNotFound;
     }
     
-    IOLog("VMQemuVGAAccelerator::clearColorBuffer: context_id=%d, rgba=(%.2f,%.2f,%.2f,%.2f)\n", 
+    VMLOG_DEBUG("VMQemuVGAAccelerator::clearColorBuffer: context_id=%d, rgba=(%.2f,%.2f,%.2f,%.2f)\n", 
           context_id, r, g, b, a);
     
     IOReturn result = kIOReturnSuccess;
@@ -2775,7 +2845,7 @@ IOReturn CLASS::clearColorBuffer(uint32_t context_id, float r, float g, float b,
     // Check if we're running on VirtIO GPU with 3D support
     VMVirtIOGPU* virtio_gpu = OSDynamicCast(VMVirtIOGPU, m_gpu_device);
     if (virtio_gpu && virtio_gpu->supports3D() && context->gpu_context_id) {
-        IOLog("VMQemuVGAAccelerator: 🚀 Using REAL VirtIO GPU 3D acceleration (virgl protocol)\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: 🚀 Using REAL VirtIO GPU 3D acceleration (virgl protocol)\n");
         
         // Get the VirtIO GPU accelerator for command translation
         VMVirtIOGPUAccelerator* virtio_accel = nullptr;
@@ -2802,15 +2872,15 @@ IOReturn CLASS::clearColorBuffer(uint32_t context_id, float r, float g, float b,
             );
             
             if (result == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: ✅ REAL 3D ACCELERATION - Virgl CLEAR sent to host GPU!\n");
+                VMLOG_DEBUG("VMQemuVGAAccelerator: ✅ REAL 3D ACCELERATION - Virgl CLEAR sent to host GPU!\n");
             } else {
-                IOLog("VMQemuVGAAccelerator: ❌ Virgl command failed (0x%x), falling back to software\n", result);
+                VMLOG_ERROR("VMQemuVGAAccelerator: ❌ Virgl command failed (0x%x), falling back to software\n", result);
             }
         } else {
-            IOLog("VMQemuVGAAccelerator: No VirtIO GPU accelerator found, falling back\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: No VirtIO GPU accelerator found, falling back\n");
         }
     } else if (m_gpu_device && m_gpu_device->supports3D() && context->gpu_context_id) {
-        IOLog("VMQemuVGAAccelerator: Using generic GPU clear (non-VirtIO)\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Using generic GPU clear (non-VirtIO)\n");
         
         // Generic GPU clear for non-VirtIO devices (QXL, etc.)
         IOBufferMemoryDescriptor* cmdDesc = IOBufferMemoryDescriptor::withCapacity(512, kIODirectionOut);
@@ -2837,14 +2907,14 @@ IOReturn CLASS::clearColorBuffer(uint32_t context_id, float r, float g, float b,
             cmdDesc->release();
             
             if (result == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: Generic GPU color clear successful\n");
+                VMLOG_DEBUG("VMQemuVGAAccelerator: Generic GPU color clear successful\n");
             }
         }
     }
     
     // Method 2: Direct framebuffer clearing
     if ((result != kIOReturnSuccess || !m_gpu_device) && m_framebuffer) {
-        IOLog("VMQemuVGAAccelerator: Performing direct framebuffer color clear\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Performing direct framebuffer color clear\n");
         
         IODeviceMemory* vram = m_framebuffer->getVRAMRange();
         if (vram) {
@@ -2899,7 +2969,7 @@ IOReturn CLASS::clearDepthBuffer(uint32_t context_id, float depth)
         return kIOReturnNotFound;
     }
     
-    IOLog("VMQemuVGAAccelerator::clearDepthBuffer: context_id=%d, depth=%.2f\n", 
+    VMLOG_DEBUG("VMQemuVGAAccelerator::clearDepthBuffer: context_id=%d, depth=%.2f\n", 
           context_id, depth);
     
     // Clamp depth value
@@ -2910,7 +2980,7 @@ IOReturn CLASS::clearDepthBuffer(uint32_t context_id, float depth)
     
     // Method 1: VirtIO GPU depth clear
     if (m_gpu_device && m_gpu_device->supports3D() && context->gpu_context_id) {
-        IOLog("VMQemuVGAAccelerator: Performing VirtIO GPU depth buffer clear\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Performing VirtIO GPU depth buffer clear\n");
         
         IOBufferMemoryDescriptor* cmdDesc = IOBufferMemoryDescriptor::withCapacity(256, kIODirectionOut);
         if (cmdDesc) {
@@ -2933,14 +3003,14 @@ IOReturn CLASS::clearDepthBuffer(uint32_t context_id, float depth)
             cmdDesc->release();
             
             if (result == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU depth clear successful (depth=%.2f)\n", depth);
+                VMLOG_DEBUG("VMQemuVGAAccelerator: VirtIO GPU depth clear successful (depth=%.2f)\n", depth);
             }
         }
     }
     
     // Method 2: Enhanced software depth buffer management and clearing
     if (result != kIOReturnSuccess || !m_gpu_device) {
-        IOLog("VMQemuVGAAccelerator: Initiating enhanced software depth buffer clear (depth=%.2f)\n", depth);
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Initiating enhanced software depth buffer clear (depth=%.2f)\n", depth);
         
         // Comprehensive software depth clearing with buffer management
         struct SoftwareDepthClear {
@@ -2968,7 +3038,7 @@ IOReturn CLASS::clearDepthBuffer(uint32_t context_id, float depth)
             if (device) {
                 soft_clear.depth_buffer_width = device->getCurrentWidth();
                 soft_clear.depth_buffer_height = device->getCurrentHeight();
-                IOLog("VMQemuVGAAccelerator: Using framebuffer dimensions for depth buffer (%dx%d)\n",
+                VMLOG_DEBUG("VMQemuVGAAccelerator: Using framebuffer dimensions for depth buffer (%dx%d)\n",
                       soft_clear.depth_buffer_width, soft_clear.depth_buffer_height);
             }
         }
@@ -2980,7 +3050,7 @@ IOReturn CLASS::clearDepthBuffer(uint32_t context_id, float depth)
         // Estimate clearing time based on buffer size (assume 1 GB/s memory bandwidth)
         soft_clear.estimated_clear_time_us = buffer_size_bytes / 1000; // Microseconds
         
-        IOLog("VMQemuVGAAccelerator: Depth buffer specs - %dx%d (%llu pixels, %llu MB, ~%llu μs estimated)\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Depth buffer specs - %dx%d (%llu pixels, %llu MB, ~%llu μs estimated)\n",
               soft_clear.depth_buffer_width, soft_clear.depth_buffer_height,
               soft_clear.total_pixels, buffer_size_bytes / (1024*1024), soft_clear.estimated_clear_time_us);
         
@@ -2995,19 +3065,19 @@ IOReturn CLASS::clearDepthBuffer(uint32_t context_id, float depth)
                 (surface->info.width >= soft_clear.depth_buffer_width * 0.8f) &&
                 (surface->info.height >= soft_clear.depth_buffer_height * 0.8f)) {
                 depth_surfaces_found++;
-                IOLog("VMQemuVGAAccelerator: Found potential depth surface %u (%ux%u, format: %d)\n",
+                VMLOG_DEBUG("VMQemuVGAAccelerator: Found potential depth surface %u (%ux%u, format: %d)\n",
                       surface->surface_id, surface->info.width, surface->info.height, surface->info.format);
             }
         }
         
         if (depth_surfaces_found > 0) {
-            IOLog("VMQemuVGAAccelerator: Using existing surfaces as depth buffers (%d candidates)\n", depth_surfaces_found);
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Using existing surfaces as depth buffers (%d candidates)\n", depth_surfaces_found);
             soft_clear.buffer_allocated = true;
         } else {
-            IOLog("VMQemuVGAAccelerator: No suitable depth surfaces found, simulating depth clear\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: No suitable depth surfaces found, simulating depth clear\n");
             
             // Simulate depth buffer allocation and clearing
-            IOLog("VMQemuVGAAccelerator: Simulating depth buffer creation (%llu bytes)\n", buffer_size_bytes);
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Simulating depth buffer creation (%llu bytes)\n", buffer_size_bytes);
             
             // Simulate clearing by calculating clear patterns
             uint32_t depth_clear_pattern;
@@ -3019,21 +3089,21 @@ IOReturn CLASS::clearDepthBuffer(uint32_t context_id, float depth)
                 depth_clear_pattern = (uint32_t)(depth * 0xFFFFFFFF); // Scaled depth
             }
             
-            IOLog("VMQemuVGAAccelerator: Depth clear pattern: 0x%08X (depth %.3f)\n", depth_clear_pattern, depth);
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Depth clear pattern: 0x%08X (depth %.3f)\n", depth_clear_pattern, depth);
             soft_clear.buffer_allocated = true;
         }
         
         uint64_t clear_end_time = getCurrentTimestamp();
         uint64_t actual_clear_time = convertToMicroseconds(clear_end_time - clear_start_time);
         
-        IOLog("VMQemuVGAAccelerator: Software depth clear completed - Buffer: %s, Time: %llu μs (estimated: %llu μs)\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Software depth clear completed - Buffer: %s, Time: %llu μs (estimated: %llu μs)\n",
               soft_clear.buffer_allocated ? "Ready" : "Simulated",
               actual_clear_time, soft_clear.estimated_clear_time_us);
         
         // Performance comparison
         if (actual_clear_time > 0) {
             float efficiency_ratio = (float)soft_clear.estimated_clear_time_us / (float)actual_clear_time;
-            IOLog("VMQemuVGAAccelerator: Clear efficiency ratio: %.2fx (1.0 = perfect estimate)\n", efficiency_ratio);
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Clear efficiency ratio: %.2fx (1.0 = perfect estimate)\n", efficiency_ratio);
         }
         
         result = kIOReturnSuccess;
@@ -3056,7 +3126,7 @@ IOReturn CLASS::unbindTexture(uint32_t context_id, uint32_t unit)
     if (!m_texture_manager)
         return kIOReturnUnsupported;
         
-    IOLog("VMQemuVGAAccelerator: Unbinding texture unit %d for context %d\n", unit, context_id);
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Unbinding texture unit %d for context %d\n", unit, context_id);
     return m_texture_manager->unbindTexture(context_id, unit);
 }
 
@@ -3065,7 +3135,7 @@ IOReturn CLASS::garbageCollectTextures(uint32_t* textures_freed)
     if (!m_texture_manager)
         return kIOReturnUnsupported;
         
-    IOLog("VMQemuVGAAccelerator: Starting comprehensive texture garbage collection...\n");
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Starting comprehensive texture garbage collection...\n");
     
     uint32_t freed_count = 0;
     uint64_t freed_memory = 0;
@@ -3295,30 +3365,30 @@ IOReturn CLASS::garbageCollectTextures(uint32_t* textures_freed)
                         
                         // Method 6: Comprehensive logging of access analysis
                         if (phase1_stats.total_textures_scanned < 10) { // Detailed logging for first 10 textures
-                            IOLog("VMQemuVGAAccelerator: [TEXTURE %d] Access Analysis:\n", surface->surface_id);
-                            IOLog("  Dimensions: %dx%d, Format: %d, Size: %d KB\n",
+                            VMLOG_DEBUG("VMQemuVGAAccelerator: [TEXTURE %d] Access Analysis:\n", surface->surface_id);
+                            VMLOG_DEBUG("  Dimensions: %dx%d, Format: %d, Size: %d KB\n",
                                   surface->info.width, surface->info.height, surface->info.format,
                                   calculateSurfaceSize(&surface->info) / 1024);
-                            IOLog("  Access Times - Read: %llu μs ago, Write: %llu μs ago, Bind: %llu μs ago\n",
+                            VMLOG_DEBUG("  Access Times - Read: %llu μs ago, Write: %llu μs ago, Bind: %llu μs ago\n",
                                   convertToMicroseconds(current_time - access_record.last_read_time),
                                   convertToMicroseconds(current_time - access_record.last_write_time),
                                   convertToMicroseconds(current_time - access_record.last_bind_time));
-                            IOLog("  Access Counts - Total: %d, Read: %d, Write: %d, Bind: %d\n",
+                            VMLOG_DEBUG("  Access Counts - Total: %d, Read: %d, Write: %d, Bind: %d\n",
                                   access_record.access_count, access_record.read_count,
                                   access_record.write_count, access_record.bind_count);
-                            IOLog("  Pattern - Frequency: %.1f Hz, R/W Ratio: %.2f, Recency: %d/100\n",
+                            VMLOG_DEBUG("  Pattern - Frequency: %.1f Hz, R/W Ratio: %.2f, Recency: %d/100\n",
                                   pattern_analysis.access_frequency, pattern_analysis.read_write_ratio,
                                   pattern_analysis.access_recency_score);
-                            IOLog("  Flags - Frequent: %s, Recent: %s, Bound: %s, Category: %s\n",
+                            VMLOG_DEBUG("  Flags - Frequent: %s, Recent: %s, Bound: %s, Category: %s\n",
                                   pattern_analysis.is_frequently_accessed ? "YES" : "NO",
                                   pattern_analysis.is_recently_accessed ? "YES" : "NO",
                                   pattern_analysis.is_actively_bound ? "YES" : "NO",
                                   pattern_analysis.access_category);
-                            IOLog("  Context - Referenced: %s, Count: %d, GPU Active: %s\n",
+                            VMLOG_DEBUG("  Context - Referenced: %s, Count: %d, GPU Active: %s\n",
                                   context_references_surface ? "YES" : "NO",
                                   context_access_count,
                                   gpu_resource_active ? "YES" : "NO");
-                            IOLog("  Decision - Referenced: %s\n", is_referenced ? "KEEP" : "CANDIDATE_FOR_GC");
+                            VMLOG_DEBUG("  Decision - Referenced: %s\n", is_referenced ? "KEEP" : "CANDIDATE_FOR_GC");
                         }
                         
                         // Final decision based on all factors
@@ -3368,11 +3438,11 @@ IOReturn CLASS::garbageCollectTextures(uint32_t* textures_freed)
     uint64_t current_texture_memory = 0;
     getTextureMemoryUsage(&current_texture_memory);
     
-    IOLog("VMQemuVGAAccelerator: Current texture memory usage: %llu KB (threshold: %d KB)\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Current texture memory usage: %llu KB (threshold: %d KB)\n",
           current_texture_memory / 1024, phase2_stats.memory_threshold_kb);
     
     if (current_texture_memory > phase2_stats.memory_threshold_kb * 1024) {
-        IOLog("VMQemuVGAAccelerator: Memory threshold exceeded, aggressive cleanup enabled\n");
+        VMLOG_WARN("VMQemuVGAAccelerator: Memory threshold exceeded, aggressive cleanup enabled\n");
         
         // Strategy 1: Free largest textures first
         for (uint32_t si = 0; si < m_surface_capacity; si++) {
@@ -3383,7 +3453,7 @@ IOReturn CLASS::garbageCollectTextures(uint32_t* textures_freed)
             uint32_t surface_size = calculateSurfaceSize(&surface->info);
 
             if (surface_size > 1024 * 1024) {
-                IOLog("VMQemuVGAAccelerator: Freeing large texture %u (%u KB)\n",
+                VMLOG_DEBUG("VMQemuVGAAccelerator: Freeing large texture %u (%u KB)\n",
                       surface->surface_id, surface_size / 1024);
 
                 if (surface->backing_memory) {
@@ -3418,7 +3488,7 @@ IOReturn CLASS::garbageCollectTextures(uint32_t* textures_freed)
                 gc_generation++;
 
                 if ((surface->surface_id % 3) == (gc_generation % 3)) {
-                    IOLog("VMQemuVGAAccelerator: Freeing medium texture %u (%u KB) due to age heuristic\n",
+                    VMLOG_DEBUG("VMQemuVGAAccelerator: Freeing medium texture %u (%u KB) due to age heuristic\n",
                           surface->surface_id, surface_size / 1024);
 
                     if (surface->backing_memory) {
@@ -3459,7 +3529,7 @@ IOReturn CLASS::garbageCollectTextures(uint32_t* textures_freed)
         if (!has_active_context) {
             uint32_t surface_size = calculateSurfaceSize(&surface->info);
 
-            IOLog("VMQemuVGAAccelerator: Freeing orphaned texture %u (%u KB) - no active context\n",
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Freeing orphaned texture %u (%u KB) - no active context\n",
                   surface->surface_id, surface_size / 1024);
 
             if (surface->backing_memory) {
@@ -3483,7 +3553,7 @@ IOReturn CLASS::garbageCollectTextures(uint32_t* textures_freed)
     uint64_t phase2_end = getCurrentTimestamp();
     phase2_stats.free_time_microseconds = convertToMicroseconds(phase2_end - phase2_start);
     
-    IOLog("VMQemuVGAAccelerator: Breakdown - Memory pressure: %d, Age-based: %d, Size-based: %d\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Breakdown - Memory pressure: %d, Age-based: %d, Size-based: %d\n",
           phase2_stats.textures_freed_by_memory, phase2_stats.textures_freed_by_age, phase2_stats.textures_freed_by_size);
     
     
@@ -3514,12 +3584,12 @@ IOReturn CLASS::garbageCollectTextures(uint32_t* textures_freed)
         uint32_t new_count = write;
         if (new_count != original_count) {
             phase3_stats.contexts_cleaned++;
-            IOLog("VMQemuVGAAccelerator: Context %u cleaned: %u -> %u surfaces\n",
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Context %u cleaned: %u -> %u surfaces\n",
                   context->context_id, original_count, new_count);
         }
 
         if (new_count == 0 && !context->active) {
-            IOLog("VMQemuVGAAccelerator: Removing empty inactive context %u\n", context->context_id);
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Removing empty inactive context %u\n", context->context_id);
             phase3_stats.empty_contexts_removed++;
             // Note: In a real implementation, you'd properly clean up the context here
         }
@@ -3546,33 +3616,33 @@ IOReturn CLASS::garbageCollectTextures(uint32_t* textures_freed)
     uint64_t total_gc_time = convertToMicroseconds(getCurrentTimestamp() - collection_start_time);
     
     
-    IOLog("VMQemuVGAAccelerator: Texture garbage collection COMPLETE\n");
-    IOLog("VMQemuVGAAccelerator: =====================================================\n");
-    IOLog("VMQemuVGAAccelerator: Total textures freed: %d\n", freed_count);
-    IOLog("VMQemuVGAAccelerator: Total memory freed: %llu KB (%llu bytes)\n", freed_memory / 1024, freed_memory);
-    IOLog("VMQemuVGAAccelerator: Memory before GC: %llu KB\n", (phase3_stats.new_memory_usage + freed_memory) / 1024);
-    IOLog("VMQemuVGAAccelerator: Memory after GC: %llu KB\n", phase3_stats.new_memory_usage / 1024);
-    IOLog("VMQemuVGAAccelerator: Memory saved: %.1f%%\n", 
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Texture garbage collection COMPLETE\n");
+    VMLOG_DEBUG("VMQemuVGAAccelerator: =====================================================\n");
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Total textures freed: %d\n", freed_count);
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Total memory freed: %llu KB (%llu bytes)\n", freed_memory / 1024, freed_memory);
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Memory before GC: %llu KB\n", (phase3_stats.new_memory_usage + freed_memory) / 1024);
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Memory after GC: %llu KB\n", phase3_stats.new_memory_usage / 1024);
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Memory saved: %.1f%%\n", 
           freed_memory > 0 ? (100.0 * freed_memory) / (phase3_stats.new_memory_usage + freed_memory) : 0.0);
-    IOLog("VMQemuVGAAccelerator: Total GC time: %llu μs\n", total_gc_time);
-    IOLog("VMQemuVGAAccelerator: GC efficiency: %.2f MB/s\n", 
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Total GC time: %llu μs\n", total_gc_time);
+    VMLOG_DEBUG("VMQemuVGAAccelerator: GC efficiency: %.2f MB/s\n", 
           total_gc_time > 0 ? (freed_memory / 1048576.0) / (total_gc_time / 1000000.0) : 0.0);
-    IOLog("VMQemuVGAAccelerator: =====================================================\n");
+    VMLOG_DEBUG("VMQemuVGAAccelerator: =====================================================\n");
     
     // Performance recommendations based on GC results
     if (freed_memory > 32 * 1024 * 1024) { // More than 32MB freed
-        IOLog("VMQemuVGAAccelerator: RECOMMENDATION - High memory usage detected. Consider:\n");
-        IOLog("VMQemuVGAAccelerator: - More frequent texture garbage collection\n");
-        IOLog("VMQemuVGAAccelerator: - Texture compression for large surfaces\n");
-        IOLog("VMQemuVGAAccelerator: - Application-level texture pooling\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: RECOMMENDATION - High memory usage detected. Consider:\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: - More frequent texture garbage collection\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: - Texture compression for large surfaces\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: - Application-level texture pooling\n");
     } else if (freed_count == 0) {
-        IOLog("VMQemuVGAAccelerator: RECOMMENDATION - No textures freed. System is well-optimized or:\n");
-        IOLog("VMQemuVGAAccelerator: - GC frequency may be too high\n");
-        IOLog("VMQemuVGAAccelerator: - All textures are actively being used\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: RECOMMENDATION - No textures freed. System is well-optimized or:\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: - GC frequency may be too high\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: - All textures are actively being used\n");
     } else if (total_gc_time > 10000) { // More than 10ms
-        IOLog("VMQemuVGAAccelerator: RECOMMENDATION - GC took %llu μs. Consider:\n", total_gc_time);
-        IOLog("VMQemuVGAAccelerator: - Background garbage collection\n");
-        IOLog("VMQemuVGAAccelerator: - Incremental collection strategies\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: RECOMMENDATION - GC took %llu μs. Consider:\n", total_gc_time);
+        VMLOG_DEBUG("VMQemuVGAAccelerator: - Background garbage collection\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: - Incremental collection strategies\n");
     }
     
     if (textures_freed) {
@@ -3589,7 +3659,7 @@ IOReturn CLASS::getTextureMemoryUsage(uint64_t* memory_used)
         
     // Return estimated texture memory usage
     *memory_used = m_memory_allocated; // Use our global memory tracking
-    IOLog("VMQemuVGAAccelerator: Texture memory usage: %llu KB\n", (*memory_used) / 1024);
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Texture memory usage: %llu KB\n", (*memory_used) / 1024);
     return kIOReturnSuccess;
 }
 
@@ -3600,7 +3670,7 @@ IOReturn CLASS::returnCommandBuffer(uint32_t context_id)
         return kIOReturnUnsupported;
         
     // Enhanced command buffer return with comprehensive pool management
-    IOLog("VMQemuVGAAccelerator: Initiating command buffer return for context %d\n", context_id);
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Initiating command buffer return for context %d\n", context_id);
     
     IOReturn result = kIOReturnSuccess;
     
@@ -3632,16 +3702,16 @@ IOReturn CLASS::returnCommandBuffer(uint32_t context_id)
         buffer_info.is_active = context->active;
         buffer_info.needs_flush = true; // Always flush before returning
         
-        IOLog("VMQemuVGAAccelerator: Found command buffer %d (size: %zu bytes, active: %s)\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Found command buffer %d (size: %zu bytes, active: %s)\n",
               buffer_info.buffer_id, buffer_info.buffer_size, buffer_info.is_active ? "YES" : "NO");
     } else {
-        IOLog("VMQemuVGAAccelerator: No command buffer found for context %d\n", context_id);
+        VMLOG_DEBUG("VMQemuVGAAccelerator: No command buffer found for context %d\n", context_id);
         return kIOReturnNotFound;
     }
     
     // Method 2: Flush pending commands before return
     if (buffer_info.needs_flush && buffer_info.buffer_memory) {
-        IOLog("VMQemuVGAAccelerator: Flushing command buffer before return\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Flushing command buffer before return\n");
         
         uint64_t flush_start = getCurrentTimestamp();
         
@@ -3672,9 +3742,9 @@ IOReturn CLASS::returnCommandBuffer(uint32_t context_id)
         if (flush_op.gpu_commands > 0 && m_gpu_device && context && context->gpu_context_id) {
             IOReturn gpu_flush_result = m_gpu_device->executeCommands(context->gpu_context_id, buffer_info.buffer_memory);
             if (gpu_flush_result == kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: GPU command flush successful (%d commands)\n", flush_op.gpu_commands);
+                VMLOG_DEBUG("VMQemuVGAAccelerator: GPU command flush successful (%d commands)\n", flush_op.gpu_commands);
             } else {
-                IOLog("VMQemuVGAAccelerator: GPU command flush failed (0x%x), using software fallback\n", gpu_flush_result);
+                VMLOG_ERROR("VMQemuVGAAccelerator: GPU command flush failed (0x%x), using software fallback\n", gpu_flush_result);
                 flush_op.software_commands += flush_op.gpu_commands; // Convert to software
                 flush_op.gpu_commands = 0;
             }
@@ -3682,7 +3752,7 @@ IOReturn CLASS::returnCommandBuffer(uint32_t context_id)
         
         // Process software commands
         if (flush_op.software_commands > 0) {
-            IOLog("VMQemuVGAAccelerator: Processing %d software commands\n", flush_op.software_commands);
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Processing %d software commands\n", flush_op.software_commands);
             // Simulate software command processing time
             IODelay(flush_op.software_commands * 10); // 10μs per command
         }
@@ -3690,7 +3760,7 @@ IOReturn CLASS::returnCommandBuffer(uint32_t context_id)
         uint64_t flush_end = getCurrentTimestamp();
         flush_op.flush_time_us = convertToMicroseconds(flush_end - flush_start);
         
-        IOLog("VMQemuVGAAccelerator: Command buffer flush complete - %d total commands (%d GPU, %d SW) in %llu μs\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Command buffer flush complete - %d total commands (%d GPU, %d SW) in %llu μs\n",
               flush_op.commands_flushed, flush_op.gpu_commands, flush_op.software_commands, flush_op.flush_time_us);
         
         buffer_info.commands_count = flush_op.commands_flushed;
@@ -3698,7 +3768,7 @@ IOReturn CLASS::returnCommandBuffer(uint32_t context_id)
     
     // Method 3: Clear and reset the command buffer
     if (buffer_info.buffer_memory) {
-        IOLog("VMQemuVGAAccelerator: Clearing command buffer memory\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Clearing command buffer memory\n");
         
         // Clear buffer contents (zero out)
         uint8_t zero_buffer[64] = {0}; // Small zero buffer
@@ -3708,13 +3778,13 @@ IOReturn CLASS::returnCommandBuffer(uint32_t context_id)
             buffer_info.buffer_memory->writeBytes(offset, zero_buffer, write_size);
         }
         
-        IOLog("VMQemuVGAAccelerator: Command buffer cleared (%zu bytes zeroed)\n", buffer_info.buffer_size);
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Command buffer cleared (%zu bytes zeroed)\n", buffer_info.buffer_size);
         
         // Reset buffer state in context
         if (context) {
             // Don't release the memory descriptor, just mark it as returned
             // context->command_buffer remains valid for reuse
-            IOLog("VMQemuVGAAccelerator: Command buffer marked as available for reuse\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Command buffer marked as available for reuse\n");
         }
     }
     
@@ -3741,24 +3811,24 @@ IOReturn CLASS::returnCommandBuffer(uint32_t context_id)
     }
     
     // Method 5: Performance analysis and recommendations
-    IOLog("VMQemuVGAAccelerator: Command Buffer Return Analysis:\n");
-    IOLog("  Buffer ID: %d, Size: %zu bytes, Used: %zu bytes (%.1f%%)\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Command Buffer Return Analysis:\n");
+    VMLOG_DEBUG("  Buffer ID: %d, Size: %zu bytes, Used: %zu bytes (%.1f%%)\n",
           buffer_info.buffer_id, buffer_info.buffer_size, buffer_info.bytes_used, pool_update.average_buffer_utilization);
-    IOLog("  Commands: %d total, Active time: %llu μs\n",
+    VMLOG_DEBUG("  Commands: %d total, Active time: %llu μs\n",
           buffer_info.commands_count, pool_update.total_buffer_time_us);
-    IOLog("  Pool Status: %d buffers available after return\n", pool_update.buffers_available);
+    VMLOG_DEBUG("  Pool Status: %d buffers available after return\n", pool_update.buffers_available);
     
     // Performance recommendations
     if (pool_update.average_buffer_utilization > 90.0f) {
-        IOLog("VMQemuVGAAccelerator: RECOMMENDATION - High buffer utilization (%.1f%%), consider larger buffers\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: RECOMMENDATION - High buffer utilization (%.1f%%), consider larger buffers\n",
               pool_update.average_buffer_utilization);
     } else if (pool_update.average_buffer_utilization < 10.0f) {
-        IOLog("VMQemuVGAAccelerator: INFO - Low buffer utilization (%.1f%%), buffer size may be optimized\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: INFO - Low buffer utilization (%.1f%%), buffer size may be optimized\n",
               pool_update.average_buffer_utilization);
     }
     
     if (pool_update.total_buffer_time_us > 1000000) { // > 1 second
-        IOLog("VMQemuVGAAccelerator: RECOMMENDATION - Long buffer hold time (%llu μs), consider buffer pooling optimization\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator: RECOMMENDATION - Long buffer hold time (%llu μs), consider buffer pooling optimization\n",
               pool_update.total_buffer_time_us);
     }
     
@@ -3767,10 +3837,10 @@ IOReturn CLASS::returnCommandBuffer(uint32_t context_id)
         // Update global command processing statistics
         m_commands_submitted += buffer_info.commands_count;
         
-        IOLog("VMQemuVGAAccelerator: Command buffer return completed successfully for context %d\n", context_id);
-        IOLog("VMQemuVGAAccelerator: Total commands processed this session: %d\n", m_commands_submitted);
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Command buffer return completed successfully for context %d\n", context_id);
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Total commands processed this session: %d\n", m_commands_submitted);
     } else {
-        IOLog("VMQemuVGAAccelerator: Command buffer return failed for context %d (0x%x)\n", context_id, result);
+        VMLOG_ERROR("VMQemuVGAAccelerator: Command buffer return failed for context %d (0x%x)\n", context_id, result);
     }
     
     return result;
@@ -3794,7 +3864,7 @@ IOReturn CLASS::getCommandPoolStatistics(void* stats)
     pool_stats->peak_usage = 4;
     pool_stats->total_commands_processed = m_commands_submitted;
     
-    IOLog("VMQemuVGAAccelerator: Pool stats - Allocated: %d, In use: %d, Peak: %d, Commands: %llu\n",
+    VMLOG_INFO("VMQemuVGAAccelerator: Pool stats - Allocated: %d, In use: %d, Peak: %d, Commands: %llu\n",
           pool_stats->buffers_allocated, pool_stats->buffers_in_use, 
           pool_stats->peak_usage, pool_stats->total_commands_processed);
     
@@ -3807,7 +3877,7 @@ IOReturn CLASS::setShaderUniform(uint32_t program_id, const char* name, const vo
     if (!m_shader_manager || !name || !data)
         return kIOReturnBadArgument;
         
-    IOLog("VMQemuVGAAccelerator: Setting uniform '%s' for program %d (%zu bytes)\n", 
+    VMLOG_DEBUG("VMQemuVGAAccelerator: Setting uniform '%s' for program %d (%zu bytes)\n", 
           name, program_id, size);
     return m_shader_manager->setUniform(program_id, name, data, size);
 }
@@ -3826,7 +3896,7 @@ uint64_t CLASS::convertToMicroseconds(uint64_t timestamp_delta)
     static bool s_initialized = false;
     
     if (!s_initialized) {
-        IOLog("VMQemuVGAAccelerator: Initializing kernel-safe timebase conversion...\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Initializing kernel-safe timebase conversion...\n");
         
         // Use computational workload to detect timebase characteristics
         uint64_t start_time = mach_absolute_time();
@@ -3843,7 +3913,7 @@ uint64_t CLASS::convertToMicroseconds(uint64_t timestamp_delta)
         uint64_t end_time = mach_absolute_time();
         uint64_t work_ticks = end_time - start_time;
         
-        IOLog("VMQemuVGAAccelerator: Computational work took %llu ticks\n", work_ticks);
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Computational work took %llu ticks\n", work_ticks);
         
         // Analyze tick granularity to determine timebase
         uint64_t min_tick_delta = UINT64_MAX;
@@ -3856,24 +3926,24 @@ uint64_t CLASS::convertToMicroseconds(uint64_t timestamp_delta)
             }
         }
         
-        IOLog("VMQemuVGAAccelerator: Minimum tick delta: %llu\n", min_tick_delta);
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Minimum tick delta: %llu\n", min_tick_delta);
         
         // Determine timebase based on tick characteristics
         if (min_tick_delta <= 10) {
             // High resolution - likely nanoseconds
             s_numer = 1;
             s_denom = 1000; // nanoseconds to microseconds
-            IOLog("VMQemuVGAAccelerator: Detected nanosecond timebase\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Detected nanosecond timebase\n");
         } else if (min_tick_delta <= 100) {
             // Medium resolution
             s_numer = (uint32_t)min_tick_delta;
             s_denom = 1000;
-            IOLog("VMQemuVGAAccelerator: Detected %llu ns per tick\n", min_tick_delta);
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Detected %llu ns per tick\n", min_tick_delta);
         } else {
             // Lower resolution - conservative fallback
             s_numer = 1;
             s_denom = 1;
-            IOLog("VMQemuVGAAccelerator: Using conservative 1:1 conversion\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Using conservative 1:1 conversion\n");
         }
         
         // Sanity check
@@ -3881,7 +3951,7 @@ uint64_t CLASS::convertToMicroseconds(uint64_t timestamp_delta)
         
         s_initialized = true;
         
-        IOLog("VMQemuVGAAccelerator: Timebase initialized - numer=%u, denom=%u\n", s_numer, s_denom);
+        VMLOG_DEBUG("VMQemuVGAAccelerator: Timebase initialized - numer=%u, denom=%u\n", s_numer, s_denom);
     }
     
     // Perform conversion with overflow protection
@@ -3914,7 +3984,7 @@ IOReturn CLASS::flushVRAMCache(void* vram_ptr, size_t size)
     // Force memory barrier and cache flush
     __sync_synchronize();
     
-    IOLog("VMQemuVGAAccelerator: VRAM cache flush completed (%zu bytes)\n", size);
+    VMLOG_DEBUG("VMQemuVGAAccelerator: VRAM cache flush completed (%zu bytes)\n", size);
     return kIOReturnSuccess;
 }
 
@@ -3933,7 +4003,7 @@ IOReturn CLASS::updateFrameStatistics(uint32_t frame_number, uint32_t pixels_upd
     frame_stats.pixels_updated = pixels_updated;
     frame_stats.flush_timestamp = getCurrentTimestamp();
     
-    IOLog("VMQemuVGAAccelerator: Frame %d statistics - %d pixels updated\n",
+    VMLOG_INFO("VMQemuVGAAccelerator: Frame %d statistics - %d pixels updated\n",
           frame_number, pixels_updated);
     
     return kIOReturnSuccess;
@@ -3946,7 +4016,7 @@ IOReturn VMQemuVGAAccelerator::bindTexture(uint32_t context_id, uint32_t binding
     AccelContext* context = findContext(context_id);
     if (!context) {
         IOLockUnlock(m_lock);
-        IOLog("VMQemuVGAAccelerator::bindTexture: invalid context %u\n", context_id);
+        VMLOG_WARN("VMQemuVGAAccelerator::bindTexture: invalid context %u\n", context_id);
         return kIOReturnBadArgument;
     }
     
@@ -3954,10 +4024,10 @@ IOReturn VMQemuVGAAccelerator::bindTexture(uint32_t context_id, uint32_t binding
     IOReturn result = m_texture_manager->bindTexture(context_id, binding_point, texture_id);
     
     if (result == kIOReturnSuccess) {
-        IOLog("VMQemuVGAAccelerator::bindTexture: bound texture %u to unit %u in context %u\n", 
+        VMLOG_DEBUG("VMQemuVGAAccelerator::bindTexture: bound texture %u to unit %u in context %u\n", 
               texture_id, binding_point, context_id);
     } else {
-        IOLog("VMQemuVGAAccelerator::bindTexture: failed to bind texture %u (error %d)\n", 
+        VMLOG_ERROR("VMQemuVGAAccelerator::bindTexture: failed to bind texture %u (error %d)\n", 
               texture_id, result);
     }
     
@@ -3972,13 +4042,13 @@ IOReturn VMQemuVGAAccelerator::updateTexture(uint32_t context_id, uint32_t textu
     AccelContext* context = findContext(context_id);
     if (!context) {
         IOLockUnlock(m_lock);
-        IOLog("VMQemuVGAAccelerator::updateTexture: invalid context %u\n", context_id);
+        VMLOG_WARN("VMQemuVGAAccelerator::updateTexture: invalid context %u\n", context_id);
         return kIOReturnBadArgument;
     }
     
     if (!data) {
         IOLockUnlock(m_lock);
-        IOLog("VMQemuVGAAccelerator::updateTexture: null data pointer\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator::updateTexture: null data pointer\n");
         return kIOReturnBadArgument;
     }
     
@@ -3988,7 +4058,7 @@ IOReturn VMQemuVGAAccelerator::updateTexture(uint32_t context_id, uint32_t textu
                                                                      kIODirectionOut);
     if (!data_desc) {
         IOLockUnlock(m_lock);
-        IOLog("VMQemuVGAAccelerator::updateTexture: failed to create memory descriptor\n");
+        VMLOG_ERROR("VMQemuVGAAccelerator::updateTexture: failed to create memory descriptor\n");
         return kIOReturnNoMemory;
     }
     
@@ -3999,10 +4069,10 @@ IOReturn VMQemuVGAAccelerator::updateTexture(uint32_t context_id, uint32_t textu
     IOReturn result = m_texture_manager->updateTexture(texture_id, mip_level, tex_region, data_desc);
     
     if (result == kIOReturnSuccess) {
-        IOLog("VMQemuVGAAccelerator::updateTexture: updated texture %u mip %u in context %u\n", 
+        VMLOG_DEBUG("VMQemuVGAAccelerator::updateTexture: updated texture %u mip %u in context %u\n", 
               texture_id, mip_level, context_id);
     } else {
-        IOLog("VMQemuVGAAccelerator::updateTexture: failed to update texture %u (error %d)\n", 
+        VMLOG_ERROR("VMQemuVGAAccelerator::updateTexture: failed to update texture %u (error %d)\n", 
               texture_id, result);
     }
     
@@ -4018,7 +4088,7 @@ IOReturn VMQemuVGAAccelerator::destroy3DSurface(uint32_t context_id, uint32_t su
     AccelContext* context = findContext(context_id);
     if (!context) {
         IOLockUnlock(m_lock);
-        IOLog("VMQemuVGAAccelerator::destroy3DSurface: invalid context %u\n", context_id);
+        VMLOG_WARN("VMQemuVGAAccelerator::destroy3DSurface: invalid context %u\n", context_id);
         return kIOReturnBadArgument;
     }
     
@@ -4026,7 +4096,7 @@ IOReturn VMQemuVGAAccelerator::destroy3DSurface(uint32_t context_id, uint32_t su
     AccelSurface* surface = findSurface(surface_id);
     if (!surface) {
         IOLockUnlock(m_lock);
-        IOLog("VMQemuVGAAccelerator::destroy3DSurface: surface %u not found\n", surface_id);
+        VMLOG_DEBUG("VMQemuVGAAccelerator::destroy3DSurface: surface %u not found\n", surface_id);
         return kIOReturnBadArgument;
     }
     
@@ -4041,14 +4111,14 @@ IOReturn VMQemuVGAAccelerator::destroy3DSurface(uint32_t context_id, uint32_t su
 
     // Remove from GPU if it has a resource ID
     if (surface->gpu_resource_id && m_gpu_device) {
-        IOLog("VMQemuVGAAccelerator::destroy3DSurface: destroying GPU resource %u\n",
+        VMLOG_DEBUG("VMQemuVGAAccelerator::destroy3DSurface: destroying GPU resource %u\n",
               surface->gpu_resource_id);
     }
 
     poolRemoveSurface(surface);
     IOFree(surface, sizeof(AccelSurface));
 
-    IOLog("VMQemuVGAAccelerator::destroy3DSurface: destroyed surface %u from context %u\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator::destroy3DSurface: destroyed surface %u from context %u\n",
           surface_id, context_id);
 
     IOLockUnlock(m_lock);
@@ -4062,20 +4132,20 @@ IOReturn VMQemuVGAAccelerator::createFramebuffer(uint32_t context_id, uint32_t w
     AccelContext* context = findContext(context_id);
     if (!context) {
         IOLockUnlock(m_lock);
-        IOLog("VMQemuVGAAccelerator::createFramebuffer: invalid context %u\n", context_id);
+        VMLOG_WARN("VMQemuVGAAccelerator::createFramebuffer: invalid context %u\n", context_id);
         return kIOReturnBadArgument;
     }
     
     if (!framebuffer_id) {
         IOLockUnlock(m_lock);
-        IOLog("VMQemuVGAAccelerator::createFramebuffer: null framebuffer_id pointer\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator::createFramebuffer: null framebuffer_id pointer\n");
         return kIOReturnBadArgument;
     }
     
     // Validate dimensions
     if (width == 0 || height == 0 || width > 8192 || height > 8192) {
         IOLockUnlock(m_lock);
-        IOLog("VMQemuVGAAccelerator::createFramebuffer: invalid dimensions %ux%u\n", width, height);
+        VMLOG_WARN("VMQemuVGAAccelerator::createFramebuffer: invalid dimensions %ux%u\n", width, height);
         return kIOReturnBadArgument;
     }
     
@@ -4095,7 +4165,7 @@ IOReturn VMQemuVGAAccelerator::createFramebuffer(uint32_t context_id, uint32_t w
         IOReturn color_result = createSurfaceInternal(context_id, &color_info);
         if (color_result != kIOReturnSuccess) {
             IOLockUnlock(m_lock);
-            IOLog("VMQemuVGAAccelerator::createFramebuffer: failed to create color surface\n");
+            VMLOG_ERROR("VMQemuVGAAccelerator::createFramebuffer: failed to create color surface\n");
             return color_result;
         }
         color_surface_id = color_info.surface_id;
@@ -4121,7 +4191,7 @@ IOReturn VMQemuVGAAccelerator::createFramebuffer(uint32_t context_id, uint32_t w
                 destroySurfaceInternal(context_id, color_surface_id);
             }
             IOLockUnlock(m_lock);
-            IOLog("VMQemuVGAAccelerator::createFramebuffer: failed to create depth surface\n");
+            VMLOG_ERROR("VMQemuVGAAccelerator::createFramebuffer: failed to create depth surface\n");
             return depth_result;
         }
         depth_surface_id = depth_info.surface_id;
@@ -4130,7 +4200,7 @@ IOReturn VMQemuVGAAccelerator::createFramebuffer(uint32_t context_id, uint32_t w
     // Generate framebuffer ID (combine color and depth surface IDs)
     *framebuffer_id = (color_surface_id << 16) | depth_surface_id;
     
-    IOLog("VMQemuVGAAccelerator::createFramebuffer: created %ux%u framebuffer %u (color:%u, depth:%u)\n", 
+    VMLOG_DEBUG("VMQemuVGAAccelerator::createFramebuffer: created %ux%u framebuffer %u (color:%u, depth:%u)\n", 
           width, height, *framebuffer_id, color_surface_id, depth_surface_id);
     
     IOLockUnlock(m_lock);
@@ -4168,7 +4238,7 @@ IOReturn VMQemuVGAAccelerator::createSurfaceInternal(uint32_t context_id, VM3DSu
     surface->backing_memory = IOBufferMemoryDescriptor::withCapacity(surface_size, kIODirectionInOut);
     if (!surface->backing_memory) {
         IOFree(surface, sizeof(AccelSurface));
-        IOLog("VMQemuVGAAccelerator::createSurfaceInternal: Failed to allocate backing memory\n");
+        VMLOG_ERROR("VMQemuVGAAccelerator::createSurfaceInternal: Failed to allocate backing memory\n");
         return kIOReturnNoMemory;
     }
 
@@ -4179,7 +4249,7 @@ IOReturn VMQemuVGAAccelerator::createSurfaceInternal(uint32_t context_id, VM3DSu
     }
     contextBindSurface(context, surface->surface_id);
 
-    IOLog("VMQemuVGAAccelerator::createSurfaceInternal: Created surface %u (%ux%ux%u)\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator::createSurfaceInternal: Created surface %u (%ux%ux%u)\n",
           surface->surface_id, info->width, info->height, info->depth);
 
     return kIOReturnSuccess;
@@ -4189,7 +4259,7 @@ IOReturn VMQemuVGAAccelerator::destroySurfaceInternal(uint32_t context_id, uint3
 {
     AccelSurface* surface = findSurface(surface_id);
     if (!surface) {
-        IOLog("VMQemuVGAAccelerator::destroySurfaceInternal: Surface %u not found\n", surface_id);
+        VMLOG_DEBUG("VMQemuVGAAccelerator::destroySurfaceInternal: Surface %u not found\n", surface_id);
         return kIOReturnBadArgument;
     }
 
@@ -4206,24 +4276,104 @@ IOReturn VMQemuVGAAccelerator::destroySurfaceInternal(uint32_t context_id, uint3
     poolRemoveSurface(surface);
     IOFree(surface, sizeof(AccelSurface));
 
-    IOLog("VMQemuVGAAccelerator::destroySurfaceInternal: Destroyed surface %u\n", surface_id);
+    VMLOG_DEBUG("VMQemuVGAAccelerator::destroySurfaceInternal: Destroyed surface %u\n", surface_id);
     return kIOReturnSuccess;
 }
 
+// Describe the live framebuffer scanout as a 2D engine surface. IOPixelInformation
+// carries geometry only, so the pixels come from the framebuffer's VRAM range,
+// mapped once and reused until the next mode change. Called with m_lock held.
+IOReturn CLASS::mapFramebufferSurface(IOPixelInformation* pixelInfo, VMBlit2DSurface* surface)
+{
+    if (!m_framebuffer)
+        return kIOReturnNotReady;
+    if (pixelInfo->bitsPerPixel != 16 && pixelInfo->bitsPerPixel != 32)
+        return kIOReturnUnsupported;
+    
+    if (!m_vram_map) {
+        IODeviceMemory* vram = m_framebuffer->getVRAMRange();
+        if (!vram)
+            return kIOReturnNoResources;
+        m_vram_map = vram->map();
+        vram->release();
+        if (!m_vram_map)
+            return kIOReturnNoMemory;
+    }
+    
+    IOMemoryMap* map = m_vram_map;
+    surface->base = (uint8_t*)map->getVirtualAddress();
+    surface->rowBytes = pixelInfo->bytesPerRow;
+    surface->width = pixelInfo->activeWidth;
+    surface->bytesPerPixel = pixelInfo->bitsPerPixel / 8;
+    
+    // Never let a stale mode describe more rows than VRAM holds
+    uint64_t rows = pixelInfo->bytesPerRow ? map->getLength() / pixelInfo->bytesPerRow : 0;
+    surface->height = (uint32_t)(rows < pixelInfo->activeHeight ? rows : pixelInfo->activeHeight);
+    return kIOReturnSuccess;
+}
+
+void CLASS::framebufferModeChanged()
+{
+    IOLockLock(m_lock);
+    if (m_vram_map) {
+        m_vram_map->release();
+        m_vram_map = nullptr;
+    }
+    IOLockUnlock(m_lock);
+}
+
+// IOAccelSurfaceInformation::pixelFormat is not consistently a depth across
+// clients, so fall back to the stride when it does not say 15/16 bpp
+static uint32_t accelSurfaceBytesPerPixel(const IOAccelSurfaceInformation* info)
+{
+    if (info->pixelFormat == 15 || info->pixelFormat == 16)
+        return 2;
+    if (info->width && info->rowBytes >= info->width * 2 && info->rowBytes < info->width * 4)
+        return 2;
+    return 4;
+}
+
+static void describeAccelSurface(const IOAccelSurfaceInformation* info, VMBlit2DSurface* surface)
+{
+    surface->base = (uint8_t*)info->address[0];
+    surface->rowBytes = info->rowBytes;
+    surface->width = info->width;
+    surface->height = info->height;
+    surface->bytesPerPixel = accelSurfaceBytesPerPixel(info);
+}
+
 IOReturn VMQemuVGAAccelerator::performBlit(IOPixelInformation* sourcePixelInfo, 
                                            IOPixelInformation* destPixelInfo, 
                                            int sourceX, int sourceY, 
-                                           int destX, int destY)
+                                           int destX, int destY,
+                                           int width, int height)
 {
-    if (!sourcePixelInfo || !destPixelInfo) {
+    if (!sourcePixelInfo || !destPixelInfo || width < 0 || height < 0) {
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMQemuVGAAccelerator::performBlit: %dx%d -> %dx%d\n", 
-          sourceX, sourceY, destX, destY);
+    // Both descriptors refer to the scanout; the engine clips the block to it
+    VMBlit2DSurface src, dst;
+    IOLockLock(m_lock);
+    IOReturn ret = mapFramebufferSurface(sourcePixelInfo, &src);
+    if (ret != kIOReturnSuccess) {
+        IOLockUnlock(m_lock);
+        VMLOG_DEBUG("VMQemuVGAAccelerator::performBlit: No framebuffer surface (0x%x)\n", ret);
+        return ret;
+    }
+    
+    dst = src;
+    dst.rowBytes = destPixelInfo->bytesPerRow;
+    dst.width = destPixelInfo->activeWidth < src.width ? destPixelInfo->activeWidth : src.width;
+    if (destPixelInfo->bitsPerPixel != sourcePixelInfo->bitsPerPixel || dst.rowBytes != src.rowBytes) {
+        IOLockUnlock(m_lock);
+        return kIOReturnUnsupported;
+    }
     
-    // In a real implementation, this would perform hardware-accelerated blitting
-    // For now, just return success to satisfy the linker
+    VMBlit2DCopyRect(&dst, destX, destY, &src, sourceX, sourceY, width, height);
+    IOLockUnlock(m_lock);
+    
+    m_draw_calls++;
     return kIOReturnSuccess;
 }
 
@@ -4235,17 +4385,25 @@ IOReturn VMQemuVGAAccelerator::performFill(IOPixelInformation* pixelInfo,
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMQemuVGAAccelerator::performFill: Fill %dx%d+%d+%d with color 0x%x\n", 
-          width, height, x, y, color);
+    VMBlit2DSurface dst;
+    IOLockLock(m_lock);
+    IOReturn ret = mapFramebufferSurface(pixelInfo, &dst);
+    if (ret != kIOReturnSuccess) {
+        IOLockUnlock(m_lock);
+        VMLOG_DEBUG("VMQemuVGAAccelerator::performFill: No framebuffer surface (0x%x)\n", ret);
+        return ret;
+    }
     
-    // In a real implementation, this would perform hardware-accelerated filling
-    // For now, just return success to satisfy the linker
+    VMBlit2DFillRect(&dst, x, y, width, height, color);
+    IOLockUnlock(m_lock);
+    
+    m_draw_calls++;
     return kIOReturnSuccess;
 }
 
 IOReturn VMQemuVGAAccelerator::synchronize()
 {
-    IOLog("VMQemuVGAAccelerator::synchronize: GPU synchronization\n");
+    VMLOG_DEBUG("VMQemuVGAAccelerator::synchronize: GPU synchronization\n");
     
     // In a real implementation, this would wait for all GPU operations to complete
     // For now, just return success to satisfy the linker
@@ -4264,18 +4422,18 @@ IOReturn CLASS::blitSurfaceAccelerated(IOAccelSurfaceInformation* src,
                                       IOOptionBits options)
 {
     if (!src || !dest || !srcRect || !destRect) {
-        IOLog("VMQemuVGAAccelerator::blitSurfaceAccelerated: Invalid parameters\n");
+        VMLOG_WARN("VMQemuVGAAccelerator::blitSurfaceAccelerated: Invalid parameters\n");
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMQemuVGAAccelerator::blitSurfaceAccelerated: Blit %dx%d from (%d,%d) to (%d,%d)\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator::blitSurfaceAccelerated: Blit %dx%d from (%d,%d) to (%d,%d)\n",
           srcRect->w, srcRect->h, srcRect->x, srcRect->y, destRect->x, destRect->y);
     
     // Check device type: VirtIO GPU (real hardware) vs QXL/Mock (software)
     if (m_gpu_device) {
         if (!m_gpu_device->isMockDevice()) {
             // CASE 1: Real VirtIO GPU - Use hardware acceleration
-            IOLog("VMQemuVGAAccelerator: Using VirtIO GPU hardware blit\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Using VirtIO GPU hardware blit\n");
             
             // VirtIO GPU can accelerate blits using TRANSFER_TO_HOST_2D
             // This offloads the copy to the host GPU, much faster than CPU memcpy
@@ -4288,38 +4446,38 @@ IOReturn CLASS::blitSurfaceAccelerated(IOAccelSurfaceInformation* src,
             
             if (result == kIOReturnSuccess) {
                 m_draw_calls++;
-                IOLog("VMQemuVGAAccelerator: VirtIO hardware blit successful\n");
+                VMLOG_DEBUG("VMQemuVGAAccelerator: VirtIO hardware blit successful\n");
                 return kIOReturnSuccess;
             }
             
-            IOLog("VMQemuVGAAccelerator: VirtIO hardware blit failed (0x%x), falling back to CPU\n", result);
+            VMLOG_ERROR("VMQemuVGAAccelerator: VirtIO hardware blit failed (0x%x), falling back to CPU\n", result);
             // Fall through to CPU blit
         } else {
             // CASE 2: Mock VirtIO device (QXL hardware detected)
-            IOLog("VMQemuVGAAccelerator: Mock VirtIO device, using CPU blit for QXL\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Mock VirtIO device, using CPU blit for QXL\n");
             // Fall through to CPU blit
         }
     } else {
         // CASE 3: No GPU device (pure QXL mode)
-        IOLog("VMQemuVGAAccelerator: No GPU device, using CPU blit for QXL\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: No GPU device, using CPU blit for QXL\n");
         // Fall through to CPU blit
     }
     
-    // CPU-based blit (used for QXL or as VirtIO fallback)
-    // Calculate source and dest pointers
-    uint8_t* srcPtr = (uint8_t*)src->address[0] + (srcRect->y * src->rowBytes) + (srcRect->x * 4);
-    uint8_t* destPtr = (uint8_t*)dest->address[0] + (destRect->y * dest->rowBytes) + (destRect->x * 4);
-    
-    // Copy line by line
-    uint32_t bytesPerLine = srcRect->w * 4; // Assuming 32bpp BGRA/RGBA
-    for (int y = 0; y < srcRect->h; y++) {
-        memcpy(destPtr, srcPtr, bytesPerLine);
-        srcPtr += src->rowBytes;
-        destPtr += dest->rowBytes;
+    // CPU-based blit (used for QXL or as VirtIO fallback). src and dest may be
+    // the same surface, e.g. scrolling, so the engine handles overlap.
+    VMBlit2DSurface srcSurface, destSurface;
+    describeAccelSurface(src, &srcSurface);
+    describeAccelSurface(dest, &destSurface);
+    if (!VMBlit2DCopyRect(&destSurface, destRect->x, destRect->y,
+                          &srcSurface, srcRect->x, srcRect->y,
+                          srcRect->w, srcRect->h)) {
+        VMLOG_WARN("VMQemuVGAAccelerator: CPU blit rejected (%u/%u bytes per pixel)\n",
+              srcSurface.bytesPerPixel, destSurface.bytesPerPixel);
+        return kIOReturnUnsupported;
     }
     
     m_draw_calls++;
-    IOLog("VMQemuVGAAccelerator: CPU blit completed\n");
+    VMLOG_DEBUG("VMQemuVGAAccelerator: CPU blit completed\n");
     return kIOReturnSuccess;
 }
 
@@ -4329,18 +4487,18 @@ IOReturn CLASS::fillSurfaceAccelerated(IOAccelSurfaceInformation* surface,
                                       IOOptionBits options)
 {
     if (!surface || !rect) {
-        IOLog("VMQemuVGAAccelerator::fillSurfaceAccelerated: Invalid parameters\n");
+        VMLOG_WARN("VMQemuVGAAccelerator::fillSurfaceAccelerated: Invalid parameters\n");
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMQemuVGAAccelerator::fillSurfaceAccelerated: Fill %dx%d at (%d,%d) with color 0x%08x\n",
+    VMLOG_DEBUG("VMQemuVGAAccelerator::fillSurfaceAccelerated: Fill %dx%d at (%d,%d) with color 0x%08x\n",
           rect->w, rect->h, rect->x, rect->y, color);
     
     // Check device type: VirtIO GPU (real hardware) vs QXL/Mock (software)
     if (m_gpu_device) {
         if (!m_gpu_device->isMockDevice()) {
             // CASE 1: Real VirtIO GPU - Use hardware acceleration
-            IOLog("VMQemuVGAAccelerator: Using VirtIO GPU hardware fill\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Using VirtIO GPU hardware fill\n");
             
             // VirtIO GPU can accelerate fills using GPU memset operations
             // The host GPU fills the region, much faster than CPU loops
@@ -4352,73 +4510,68 @@ IOReturn CLASS::fillSurfaceAccelerated(IOAccelSurfaceInformation* surface,
             
             if (result == kIOReturnSuccess) {
                 m_draw_calls++;
-                IOLog("VMQemuVGAAccelerator: VirtIO hardware fill successful\n");
+                VMLOG_DEBUG("VMQemuVGAAccelerator: VirtIO hardware fill successful\n");
                 return kIOReturnSuccess;
             }
             
-            IOLog("VMQemuVGAAccelerator: VirtIO hardware fill failed (0x%x), falling back to CPU\n", result);
+            VMLOG_ERROR("VMQemuVGAAccelerator: VirtIO hardware fill failed (0x%x), falling back to CPU\n", result);
             // Fall through to CPU fill
         } else {
             // CASE 2: Mock VirtIO device (QXL hardware detected)
-            IOLog("VMQemuVGAAccelerator: Mock VirtIO device, using CPU fill for QXL\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Mock VirtIO device, using CPU fill for QXL\n");
             // Fall through to CPU fill
         }
     } else {
         // CASE 3: No GPU device (pure QXL mode)
-        IOLog("VMQemuVGAAccelerator: No GPU device, using CPU fill for QXL\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: No GPU device, using CPU fill for QXL\n");
         // Fall through to CPU fill
     }
     
     // CPU-based fill (used for QXL or as VirtIO fallback)
-    // Calculate dest pointer
-    uint8_t* destPtr = (uint8_t*)surface->address[0] + (rect->y * surface->rowBytes) + (rect->x * 4);
-    
-    // Fill line by line using fast 32-bit writes
-    for (int y = 0; y < rect->h; y++) {
-        uint32_t* pixels = (uint32_t*)destPtr;
-        for (int x = 0; x < rect->w; x++) {
-            pixels[x] = color;
-        }
-        destPtr += surface->rowBytes;
+    VMBlit2DSurface destSurface;
+    describeAccelSurface(surface, &destSurface);
+    if (!VMBlit2DFillRect(&destSurface, rect->x, rect->y, rect->w, rect->h, color)) {
+        VMLOG_WARN("VMQemuVGAAccelerator: CPU fill rejected (null surface)\n");
+        return kIOReturnBadArgument;
     }
     
     m_draw_calls++;
-    IOLog("VMQemuVGAAccelerator: CPU fill completed\n");
+    VMLOG_DEBUG("VMQemuVGAAccelerator: CPU fill completed\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::synchronizeAccelerator(IOOptionBits options)
 {
-    IOLog("VMQemuVGAAccelerator::synchronizeAccelerator: Synchronizing accelerator operations\n");
+    VMLOG_DEBUG("VMQemuVGAAccelerator::synchronizeAccelerator: Synchronizing accelerator operations\n");
     
     // Check device type: VirtIO GPU (async) vs QXL/Mock (sync)
     if (m_gpu_device) {
         if (!m_gpu_device->isMockDevice()) {
             // CASE 1: Real VirtIO GPU - Flush asynchronous command queue
-            IOLog("VMQemuVGAAccelerator: Flushing VirtIO GPU command queue\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Flushing VirtIO GPU command queue\n");
             
             // Flush any pending VirtIO GPU commands to hardware
             IOReturn result = m_gpu_device->flushCommands();
             if (result != kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU flush failed (0x%x)\n", result);
+                VMLOG_ERROR("VMQemuVGAAccelerator: VirtIO GPU flush failed (0x%x)\n", result);
                 return result;
             }
             
             // Wait for GPU to complete all operations
             result = m_gpu_device->waitForIdle();
             if (result != kIOReturnSuccess) {
-                IOLog("VMQemuVGAAccelerator: VirtIO GPU wait failed (0x%x)\n", result);
+                VMLOG_ERROR("VMQemuVGAAccelerator: VirtIO GPU wait failed (0x%x)\n", result);
                 return result;
             }
             
-            IOLog("VMQemuVGAAccelerator: VirtIO GPU synchronized successfully\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: VirtIO GPU synchronized successfully\n");
         } else {
             // CASE 2: Mock VirtIO device (QXL) - CPU operations are synchronous
-            IOLog("VMQemuVGAAccelerator: Mock device, CPU operations already synchronous\n");
+            VMLOG_DEBUG("VMQemuVGAAccelerator: Mock device, CPU operations already synchronous\n");
         }
     } else {
         // CASE 3: No GPU device (pure QXL) - CPU operations are synchronous
-        IOLog("VMQemuVGAAccelerator: QXL mode, CPU operations already synchronous\n");
+        VMLOG_DEBUG("VMQemuVGAAccelerator: QXL mode, CPU operations already synchronous\n");
     }
     
     return kIOReturnSuccess;
@@ -18,6 +18,7 @@ class VMPhase3Manager;
 class VMMetalBridge;
 class VMMetalPlugin;
 class IOPixelInformation;
+struct VMBlit2DSurface;
 
 // 3D command types for user space communication
 enum VM3DCommandType {
@@ -151,6 +152,11 @@ protected:
     uint64_t m_memory_allocated;
     bool m_metal_compatible;
     
+    // VRAM mapped for the software 2D engine. Created by the first
+    // performBlit/performFill and kept until the framebuffer changes mode.
+    // Guarded by m_lock.
+    IOMemoryMap* m_vram_map;
+    
     // Internal methods
     AccelContext* findContext(uint32_t context_id);
     AccelSurface* findSurface(uint32_t surface_id);
@@ -162,6 +168,7 @@ protected:
     // Command processing
     IOReturn processCommand(VM3DCommand* cmd, IOMemoryDescriptor* data);
     IOReturn executeDrawCall(uint32_t context_id, IOMemoryDescriptor* commands);
+    IOReturn flushShaderUniforms(uint32_t context_id, AccelContext* context);
     IOReturn setRenderTarget(uint32_t context_id, uint32_t surface_id);
     IOReturn clearSurface(uint32_t context_id, uint32_t surface_id, uint32_t color);
     
@@ -172,6 +179,9 @@ protected:
     // State management
     IOReturn validateContext(uint32_t context_id, task_t task);
     IOReturn validateSurface(uint32_t surface_id, uint32_t context_id);
+    
+    // Software 2D engine
+    IOReturn mapFramebufferSurface(IOPixelInformation* pixelInfo, VMBlit2DSurface* surface);
 
 public:
     virtual bool init(OSDictionary* properties = nullptr) override;
@@ -189,6 +199,7 @@ public:
     IOReturn create3DSurface(uint32_t context_id, VM3DSurfaceInfo* surface_info);
     IOReturn destroy3DSurface(uint32_t context_id, uint32_t surface_id);
     IOReturn submit3DCommands(uint32_t context_id, IOMemoryDescriptor* commands);
+    IOReturn submit3DCommandBytes(uint32_t context_id, const void* commands, size_t size);
     IOReturn present3DSurface(uint32_t context_id, uint32_t surface_id);
     
     // Performance monitoring
@@ -280,9 +291,10 @@ public:
     
     // Hardware acceleration methods
     IOReturn performBlit(IOPixelInformation* sourcePixelInfo, IOPixelInformation* destPixelInfo, 
-                        int sourceX, int sourceY, int destX, int destY);
+                        int sourceX, int sourceY, int destX, int destY, int width, int height);
     IOReturn performFill(IOPixelInformation* pixelInfo, int x, int y, int width, int height, 
                         uint32_t color);
+    void framebufferModeChanged();  // Drops m_vram_map; the backing may have moved
     IOReturn synchronize();
     
     // Performance profiling
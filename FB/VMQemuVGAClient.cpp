@@ -34,6 +34,7 @@
 
 #include "VMQemuVGAClient.h"
 #include "VMQemuVGA.h"
+#include "VMLog.h"
 
 #define super IOUserClient
 
@@ -47,11 +48,11 @@ static IOExternalMethod const iofbFuncsCache[1] =
 
 IOExternalMethod* VMQemuVGAClient::getTargetAndMethodForIndex(IOService** targetP, UInt32 index)
 {
-	IOLog( "%s: index=%u.\n", __FUNCTION__, static_cast<unsigned>(index));
+	VMLOG_DEBUG( "%s: index=%u.\n", __FUNCTION__, static_cast<unsigned>(index));
 	if (!targetP)
 		return 0;
 	if (index != 0 && index != 3) {
-		IOLog( "%s: Invalid index %u.\n",
+		VMLOG_WARN( "%s: Invalid index %u.\n",
 				  __FUNCTION__, static_cast<unsigned>(index));
 		return 0;
 	}
@@ -61,9 +62,9 @@ IOExternalMethod* VMQemuVGAClient::getTargetAndMethodForIndex(IOService** target
 
 IOReturn VMQemuVGAClient::clientClose()
 {
-	IOLog( "%s()\n", __FUNCTION__);
+	VMLOG_INFO( "%s()\n", __FUNCTION__);
 	if (!terminate())
-		IOLog( "%s: terminate failed.\n", __FUNCTION__);
+		VMLOG_ERROR( "%s: terminate failed.\n", __FUNCTION__);
 	return kIOReturnSuccess;
 }
 
@@ -70,6 +70,8 @@ enum VMTextureFormat {
     VMTextureFormatRG8Snorm = 32,
     VMTextureFormatRG8Uint = 33,
     VMTextureFormatRG8Sint = 34,
+    VMTextureFormatB5G6R5Unorm = 40,
+    VMTextureFormatBGR5A1Unorm = 43,
     
     // 32-bit formats
     VMTextureFormatR32Uint = 53,
@@ -87,6 +89,7 @@ enum VMTextureFormat {
     VMTextureFormatRGBA8Sint = 74,
     VMTextureFormatBGRA8Unorm = 80,
     VMTextureFormatBGRA8Unorm_sRGB = 81,
+    VMTextureFormatRGB10A2Unorm = 90,
     
     // 64-bit formats
     VMTextureFormatRG32Uint = 103,
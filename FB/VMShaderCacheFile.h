@@ -0,0 +1,74 @@
+/*
+ * VMShaderCacheFile.h - Persistent shader cache image
+ *
+ * The layout VMShaderManager exports and imports through the
+ * VMVirtIOGPUUserClient shader-cache selectors (0x600A-0x600C), and the
+ * file tools/shadercache keeps on disk between boots. Plain C, fixed-width
+ * fields, host byte order: the image never leaves the machine it was
+ * made on.
+ *
+ * An image is a header followed by payload_size bytes of records: first
+ * shader_count shader records, then program_count program records. Every
+ * record starts with its own size and is 4-byte aligned.
+ *
+ * identity names the kext build and host renderer the image was made for
+ * (SHA-256 of the format version, the kext version and every capset the
+ * host reports); an image with a different identity is stale and the kext
+ * refuses it. checksum is SHA-256 over the payload.
+ */
+
+#ifndef _VM_SHADER_CACHE_FILE_H
+#define _VM_SHADER_CACHE_FILE_H
+
+#ifdef KERNEL
+#include <IOKit/IOTypes.h>
+#else
+#include <stdint.h>
+#endif
+
+#define VM_SHADER_CACHE_FILE_MAGIC      0x43534d56u     /* "VMSC" */
+#define VM_SHADER_CACHE_FILE_VERSION    1
+#define VM_SHADER_CACHE_FILE_MAX        (16u << 20)     /* bytes, header included */
+#define VM_SHADER_CACHE_DIGEST_SIZE     32
+
+struct vm_shader_cache_file_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;           /* sizeof(struct vm_shader_cache_file_header) */
+    uint32_t payload_size;
+    uint8_t  identity[VM_SHADER_CACHE_DIGEST_SIZE];
+    uint8_t  checksum[VM_SHADER_CACHE_DIGEST_SIZE];
+    uint32_t shader_count;
+    uint32_t program_count;
+    uint64_t generation;            /* kext cache generation at export */
+};
+
+/*
+ * Followed by: VMCompiledShaderInfo, bytecode padded to 4 bytes, then
+ * uniform_count VMShaderUniform, attribute_count VMShaderAttribute and
+ * resource_count VMShaderResource.
+ */
+struct vm_shader_cache_shader_record {
+    uint32_t record_size;
+    uint32_t type;
+    uint32_t language;
+    uint32_t bytecode_size;
+    uint32_t uniform_count;
+    uint32_t attribute_count;
+    uint32_t resource_count;
+    uint32_t reserved;
+    uint8_t  key[VM_SHADER_CACHE_DIGEST_SIZE];
+};
+
+/* Followed by uniform_count VMShaderUniform and attribute_count VMShaderAttribute. */
+struct vm_shader_cache_program_record {
+    uint32_t record_size;
+    uint32_t uniform_count;
+    uint32_t attribute_count;
+    uint32_t resource_count;
+    uint32_t hardware_optimized;
+    uint32_t reserved[3];
+    uint8_t  key[VM_SHADER_CACHE_DIGEST_SIZE];
+};
+
+#endif /* _VM_SHADER_CACHE_FILE_H */
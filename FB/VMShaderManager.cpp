@@ -1,7 +1,10 @@
 #include "VMShaderManager.h"
 #include "VMQemuVGAAccelerator.h"
+#include "virgl_encode.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 #include <mach/mach_time.h>
+#include <sys/sysctl.h>
 // Note: Using only kernel-safe headers - no stdio.h or stdlib.h in kernel space
 
 // Kernel-safe string parsing helper functions
@@ -18,471 +21,6 @@ static const char* kernel_strstr(const char* haystack, const char* needle) {
     return nullptr;
 }
 
-static const char* kernel_strchr(const char* str, int c) {
-    if (!str) return nullptr;
-    while (*str) {
-        if (*str == c) return str;
-        str++;
-    }
-    return (c == '\0') ? str : nullptr;
-}
-
-static int kernel_simple_sscanf(const char* str, const char* format, char* arg1, char* arg2) {
-    // Advanced kernel-safe sscanf implementation with comprehensive format support
-    // Supports multiple format patterns: "%s %s", "%d %s", "%s %d", "%d %d", "%c %s", etc.
-    if (!str || !format || !arg1 || !arg2) return 0;
-    
-    // Initialize output buffers to ensure clean state
-    arg1[0] = '\0';
-    arg2[0] = '\0';
-    
-    // Advanced Format Pattern Analysis and Parsing State Machine
-    struct SScanfParsingState {
-        const char* current_input_ptr;          // Current position in input string
-        const char* current_format_ptr;         // Current position in format string
-        uint32_t arguments_parsed;              // Number of successful argument extractions
-        uint32_t format_specifiers_found;       // Total format specifiers in format string
-        bool parsing_complete;                  // Parsing completion status
-        bool error_encountered;                 // Error flag for parsing issues
-        char current_format_type;               // Current format specifier being processed
-        uint32_t field_width_limit;             // Field width limitation for current parse
-        bool skip_whitespace_mode;              // Whitespace handling mode
-        uint32_t parse_depth;                   // Recursion depth for complex patterns
-    } parse_state = {
-        .current_input_ptr = str,
-        .current_format_ptr = format,
-        .arguments_parsed = 0,
-        .format_specifiers_found = 0,
-        .parsing_complete = false,
-        .error_encountered = false,
-        .current_format_type = '\0',
-        .field_width_limit = 63,
-        .skip_whitespace_mode = true,
-        .parse_depth = 0
-    };
-    
-    // Phase 1: Format String Analysis and Validation
-    // Comprehensive format string preprocessing to identify all format specifiers
-    const char* format_analysis_ptr = format;
-    uint32_t format_validation_score = 0;
-    
-    struct FormatSpecifierAnalysis {
-        uint32_t string_specifiers;             // %s count
-        uint32_t decimal_specifiers;            // %d count  
-        uint32_t character_specifiers;          // %c count
-        uint32_t hexadecimal_specifiers;        // %x count
-        uint32_t octal_specifiers;              // %o count
-        uint32_t float_specifiers;              // %f count
-        uint32_t literal_characters;            // Non-format characters
-        uint32_t whitespace_sequences;          // Whitespace sequences
-        bool has_field_width_specifiers;        // Field width modifiers
-        bool has_precision_specifiers;          // Precision modifiers
-        bool is_supported_pattern;              // Pattern support validation
-        char detected_pattern[64];              // Detected format pattern string
-    } format_analysis = {0};
-    
-    // Analyze format string structure
-    while (*format_analysis_ptr) {
-        if (*format_analysis_ptr == '%' && *(format_analysis_ptr + 1)) {
-            parse_state.format_specifiers_found++;
-            format_analysis_ptr++;
-            
-            // Check for field width specifiers
-            if (*format_analysis_ptr >= '1' && *format_analysis_ptr <= '9') {
-                format_analysis.has_field_width_specifiers = true;
-                while (*format_analysis_ptr >= '0' && *format_analysis_ptr <= '9') {
-                    format_analysis_ptr++;
-                }
-            }
-            
-            // Check for precision specifiers
-            if (*format_analysis_ptr == '.') {
-                format_analysis.has_precision_specifiers = true;
-                format_analysis_ptr++;
-                while (*format_analysis_ptr >= '0' && *format_analysis_ptr <= '9') {
-                    format_analysis_ptr++;
-                }
-            }
-            
-            // Identify format specifier type
-            switch (*format_analysis_ptr) {
-                case 's':
-                    format_analysis.string_specifiers++;
-                    format_validation_score += 10;
-                    break;
-                case 'd':
-                case 'i':
-                    format_analysis.decimal_specifiers++;
-                    format_validation_score += 10;
-                    break;
-                case 'c':
-                    format_analysis.character_specifiers++;
-                    format_validation_score += 10;
-                    break;
-                case 'x':
-                case 'X':
-                    format_analysis.hexadecimal_specifiers++;
-                    format_validation_score += 8;
-                    break;
-                case 'o':
-                    format_analysis.octal_specifiers++;
-                    format_validation_score += 8;
-                    break;
-                case 'f':
-                case 'e':
-                case 'g':
-                    format_analysis.float_specifiers++;
-                    format_validation_score += 6;
-                    break;
-                default:
-                    parse_state.error_encountered = true;
-                    format_validation_score -= 5;
-                    break;
-            }
-        } else if (*format_analysis_ptr == ' ' || *format_analysis_ptr == '\t') {
-            format_analysis.whitespace_sequences++;
-        } else {
-            format_analysis.literal_characters++;
-        }
-        format_analysis_ptr++;
-    }
-    
-    // Validate format pattern support
-    format_analysis.is_supported_pattern = 
-        (parse_state.format_specifiers_found <= 2) &&
-        (format_analysis.float_specifiers == 0 || format_analysis.float_specifiers <= 1) &&
-        (format_validation_score > 5) &&
-        !parse_state.error_encountered;
-    
-    // Generate pattern description
-    snprintf(format_analysis.detected_pattern, sizeof(format_analysis.detected_pattern),
-             "Pattern: %ds/%dd/%dc/%dx/%do/%df, literals=%d, whitespace=%d",
-             format_analysis.string_specifiers,
-             format_analysis.decimal_specifiers,
-             format_analysis.character_specifiers,
-             format_analysis.hexadecimal_specifiers,
-             format_analysis.octal_specifiers,
-             format_analysis.float_specifiers,
-             format_analysis.literal_characters,
-             format_analysis.whitespace_sequences);
-    
-    if (!format_analysis.is_supported_pattern) {
-        return 0; // Unsupported format pattern
-    }
-    
-    // Phase 2: Advanced Input String Preprocessing and Tokenization
-    // Comprehensive input string analysis and whitespace normalization
-    
-    struct InputPreprocessing {
-        uint32_t total_input_length;            // Total input string length
-        uint32_t leading_whitespace_count;      // Leading whitespace characters
-        uint32_t trailing_whitespace_count;     // Trailing whitespace characters
-        uint32_t internal_whitespace_sequences; // Internal whitespace sequences
-        uint32_t token_boundaries_identified;   // Token boundary positions
-        uint32_t alphanumeric_tokens;           // Count of alphanumeric tokens
-        uint32_t numeric_tokens;                // Count of numeric-only tokens
-        uint32_t special_character_tokens;      // Count of special character tokens
-        bool has_quoted_strings;                // Quoted string detection
-        bool has_escaped_characters;            // Escape sequence detection
-        char preprocessing_status[128];         // Preprocessing status description
-    } input_preprocessing = {0};
-    
-    // Calculate input string metrics
-    const char* input_analysis_ptr = str;
-    input_preprocessing.total_input_length = (uint32_t)strlen(str);
-    
-    // Count leading whitespace
-    while (*input_analysis_ptr && (*input_analysis_ptr == ' ' || *input_analysis_ptr == '\t')) {
-        input_preprocessing.leading_whitespace_count++;
-        input_analysis_ptr++;
-    }
-    
-    // Analyze token structure
-    bool in_token = false;
-    while (*input_analysis_ptr) {
-        if (*input_analysis_ptr == ' ' || *input_analysis_ptr == '\t') {
-            if (in_token) {
-                input_preprocessing.token_boundaries_identified++;
-                in_token = false;
-            }
-            input_preprocessing.internal_whitespace_sequences++;
-        } else {
-            if (!in_token) {
-                in_token = true;
-                // Classify token type
-                if (*input_analysis_ptr >= '0' && *input_analysis_ptr <= '9') {
-                    input_preprocessing.numeric_tokens++;
-                } else if ((*input_analysis_ptr >= 'a' && *input_analysis_ptr <= 'z') ||
-                          (*input_analysis_ptr >= 'A' && *input_analysis_ptr <= 'Z')) {
-                    input_preprocessing.alphanumeric_tokens++;
-                } else {
-                    input_preprocessing.special_character_tokens++;
-                }
-            }
-        }
-        input_analysis_ptr++;
-    }
-    if (in_token) input_preprocessing.token_boundaries_identified++;
-    
-    // Generate preprocessing status
-    snprintf(input_preprocessing.preprocessing_status, sizeof(input_preprocessing.preprocessing_status),
-             "Input: len=%d, tokens=%d (alpha=%d, numeric=%d, special=%d), whitespace=%d",
-             input_preprocessing.total_input_length,
-             input_preprocessing.token_boundaries_identified,
-             input_preprocessing.alphanumeric_tokens,
-             input_preprocessing.numeric_tokens,
-             input_preprocessing.special_character_tokens,
-             input_preprocessing.internal_whitespace_sequences);
-    
-    // Phase 3: Advanced Parsing State Machine with Format-Specific Processing
-    // Sophisticated parsing engine with support for multiple format patterns
-    
-    parse_state.current_input_ptr = str;
-    parse_state.current_format_ptr = format;
-    
-    // Advanced parsing loop with format specifier matching
-    while (*parse_state.current_format_ptr && !parse_state.error_encountered && parse_state.arguments_parsed < 2) {
-        
-        // Skip literal characters in format string
-        while (*parse_state.current_format_ptr && *parse_state.current_format_ptr != '%') {
-            if (*parse_state.current_format_ptr == ' ' || *parse_state.current_format_ptr == '\t') {
-                // Skip whitespace in both format and input
-                while (*parse_state.current_input_ptr && 
-                      (*parse_state.current_input_ptr == ' ' || *parse_state.current_input_ptr == '\t')) {
-                    parse_state.current_input_ptr++;
-                }
-            } else {
-                // Match literal character
-                if (*parse_state.current_input_ptr != *parse_state.current_format_ptr) {
-                    parse_state.error_encountered = true;
-                    break;
-                }
-                parse_state.current_input_ptr++;
-            }
-            parse_state.current_format_ptr++;
-        }
-        
-        // Process format specifier
-        if (*parse_state.current_format_ptr == '%' && *(parse_state.current_format_ptr + 1)) {
-            parse_state.current_format_ptr++; // Skip '%'
-            
-            // Extract field width if present
-            uint32_t field_width = parse_state.field_width_limit;
-            if (*parse_state.current_format_ptr >= '1' && *parse_state.current_format_ptr <= '9') {
-                field_width = 0;
-                while (*parse_state.current_format_ptr >= '0' && *parse_state.current_format_ptr <= '9') {
-                    field_width = field_width * 10 + (*parse_state.current_format_ptr - '0');
-                    parse_state.current_format_ptr++;
-                }
-                if (field_width > 63) field_width = 63; // Safety limit
-            }
-            
-            // Skip precision specifier if present
-            if (*parse_state.current_format_ptr == '.') {
-                parse_state.current_format_ptr++;
-                while (*parse_state.current_format_ptr >= '0' && *parse_state.current_format_ptr <= '9') {
-                    parse_state.current_format_ptr++;
-                }
-            }
-            
-            parse_state.current_format_type = *parse_state.current_format_ptr;
-            
-            // Advanced Format-Specific Parsing Engine
-            switch (parse_state.current_format_type) {
-                case 's': {
-                    // String parsing with advanced tokenization
-                    while (*parse_state.current_input_ptr && 
-                          (*parse_state.current_input_ptr == ' ' || *parse_state.current_input_ptr == '\t')) {
-                        parse_state.current_input_ptr++;
-                    }
-                    
-                    if (!*parse_state.current_input_ptr) {
-                        parse_state.error_encountered = true;
-                        break;
-                    }
-                    
-                    // Copy string token
-                    char* target_buffer = (parse_state.arguments_parsed == 0) ? arg1 : arg2;
-                    uint32_t char_count = 0;
-                    
-                    while (*parse_state.current_input_ptr && 
-                          *parse_state.current_input_ptr != ' ' && 
-                          *parse_state.current_input_ptr != '\t' && 
-                          *parse_state.current_input_ptr != ';' &&
-                          *parse_state.current_input_ptr != ',' &&
-                          char_count < field_width) {
-                        target_buffer[char_count++] = *parse_state.current_input_ptr++;
-                    }
-                    target_buffer[char_count] = '\0';
-                    
-                    if (char_count > 0) {
-                        parse_state.arguments_parsed++;
-                    } else {
-                        parse_state.error_encountered = true;
-                    }
-                    break;
-                }
-                
-                case 'd':
-                case 'i': {
-                    // Integer parsing with validation
-                    while (*parse_state.current_input_ptr && 
-                          (*parse_state.current_input_ptr == ' ' || *parse_state.current_input_ptr == '\t')) {
-                        parse_state.current_input_ptr++;
-                    }
-                    
-                    if (!*parse_state.current_input_ptr) {
-                        parse_state.error_encountered = true;
-                        break;
-                    }
-                    
-                    // Parse integer and convert to string
-                    char* target_buffer = (parse_state.arguments_parsed == 0) ? arg1 : arg2;
-                    uint32_t char_count = 0;
-                    
-                    // Handle sign
-                    if (*parse_state.current_input_ptr == '+' || *parse_state.current_input_ptr == '-') {
-                        target_buffer[char_count++] = *parse_state.current_input_ptr++;
-                    }
-                    
-                    // Parse digits
-                    bool found_digits = false;
-                    while (*parse_state.current_input_ptr >= '0' && *parse_state.current_input_ptr <= '9' && 
-                           char_count < field_width) {
-                        target_buffer[char_count++] = *parse_state.current_input_ptr++;
-                        found_digits = true;
-                    }
-                    target_buffer[char_count] = '\0';
-                    
-                    if (found_digits) {
-                        parse_state.arguments_parsed++;
-                    } else {
-                        parse_state.error_encountered = true;
-                    }
-                    break;
-                }
-                
-                case 'c': {
-                    // Character parsing
-                    while (*parse_state.current_input_ptr && 
-                          (*parse_state.current_input_ptr == ' ' || *parse_state.current_input_ptr == '\t')) {
-                        parse_state.current_input_ptr++;
-                    }
-                    
-                    if (!*parse_state.current_input_ptr) {
-                        parse_state.error_encountered = true;
-                        break;
-                    }
-                    
-                    // Copy single character
-                    char* target_buffer = (parse_state.arguments_parsed == 0) ? arg1 : arg2;
-                    target_buffer[0] = *parse_state.current_input_ptr++;
-                    target_buffer[1] = '\0';
-                    
-                    parse_state.arguments_parsed++;
-                    break;
-                }
-                
-                case 'x':
-                case 'X': {
-                    // Hexadecimal parsing
-                    while (*parse_state.current_input_ptr && 
-                          (*parse_state.current_input_ptr == ' ' || *parse_state.current_input_ptr == '\t')) {
-                        parse_state.current_input_ptr++;
-                    }
-                    
-                    char* target_buffer = (parse_state.arguments_parsed == 0) ? arg1 : arg2;
-                    uint32_t char_count = 0;
-                    
-                    // Handle 0x prefix
-                    if (*parse_state.current_input_ptr == '0' && 
-                        (*(parse_state.current_input_ptr + 1) == 'x' || *(parse_state.current_input_ptr + 1) == 'X')) {
-                        target_buffer[char_count++] = *parse_state.current_input_ptr++;
-                        target_buffer[char_count++] = *parse_state.current_input_ptr++;
-                    }
-                    
-                    // Parse hex digits
-                    bool found_hex_digits = false;
-                    while (((*parse_state.current_input_ptr >= '0' && *parse_state.current_input_ptr <= '9') ||
-                            (*parse_state.current_input_ptr >= 'a' && *parse_state.current_input_ptr <= 'f') ||
-                            (*parse_state.current_input_ptr >= 'A' && *parse_state.current_input_ptr <= 'F')) &&
-                           char_count < field_width) {
-                        target_buffer[char_count++] = *parse_state.current_input_ptr++;
-                        found_hex_digits = true;
-                    }
-                    target_buffer[char_count] = '\0';
-                    
-                    if (found_hex_digits) {
-                        parse_state.arguments_parsed++;
-                    } else {
-                        parse_state.error_encountered = true;
-                    }
-                    break;
-                }
-                
-                default:
-                    parse_state.error_encountered = true;
-                    break;
-            }
-            
-            parse_state.current_format_ptr++; // Move past format specifier
-        }
-    }
-    
-    // Skip whitespace before potential third argument or end validation
-    while (*parse_state.current_input_ptr && 
-          (*parse_state.current_input_ptr == ' ' || *parse_state.current_input_ptr == '\t')) {
-        parse_state.current_input_ptr++;
-    }
-    
-    // Phase 4: Final Validation and Result Compilation
-    // Comprehensive parsing result analysis and quality assessment
-    
-    struct ParsingResults {
-        uint32_t successful_extractions;        // Successfully parsed arguments
-        uint32_t format_compliance_score;       // Format compliance rating (0-100)
-        bool parsing_errors_detected;           // Error detection flag
-        bool format_completely_consumed;        // Format string fully processed
-        bool input_completely_consumed;         // Input string fully processed
-        char result_summary[128];               // Result summary description
-    } results = {
-        .successful_extractions = parse_state.arguments_parsed,
-        .parsing_errors_detected = parse_state.error_encountered,
-        .format_completely_consumed = (*parse_state.current_format_ptr == '\0'),
-        .input_completely_consumed = (*parse_state.current_input_ptr == '\0' || 
-                                     *parse_state.current_input_ptr == ';' ||
-                                     *parse_state.current_input_ptr == ','),
-        .format_compliance_score = 0
-    };
-    
-    // Calculate format compliance score
-    if (!results.parsing_errors_detected) {
-        results.format_compliance_score = 50; // Base score
-        results.format_compliance_score += (results.successful_extractions * 20); // 20 points per successful extraction
-        if (results.format_completely_consumed) results.format_compliance_score += 10;
-        if (results.input_completely_consumed || 
-            (*parse_state.current_input_ptr == ';' || *parse_state.current_input_ptr == ',')) {
-            results.format_compliance_score += 10;
-        }
-        if (results.format_compliance_score > 100) results.format_compliance_score = 100;
-    }
-    
-    // Generate result summary
-    snprintf(results.result_summary, sizeof(results.result_summary),
-             "Parsed: %d args, compliance: %d%%, errors: %s, format consumed: %s",
-             results.successful_extractions,
-             results.format_compliance_score,
-             results.parsing_errors_detected ? "YES" : "NO",
-             results.format_completely_consumed ? "YES" : "NO");
-    
-    // Return appropriate result code
-    if (results.parsing_errors_detected || results.successful_extractions == 0) {
-        return 0; // Parsing failed
-    } else {
-        return (int)results.successful_extractions; // Return number of successfully parsed arguments
-    }
-}
-
 static int kernel_simple_atoi(const char* str) {
     if (!str) return 0;
     int result = 0;
@@ -518,6 +56,28 @@ static const char* strnstr_local(const char* haystack, const char* needle, size_
     return nullptr;
 }
 
+// Appends a zeroed record to a plain IOMalloc'd array, doubling it when
+// full. Reflection records are plain structs, not OSObjects, so they cannot
+// go in an OSArray.
+template <typename T>
+static T* appendRecord(T** records, uint32_t* count, uint32_t* capacity)
+{
+    if (*count == *capacity) {
+        uint32_t grown = *capacity ? *capacity * 2 : 8;
+        T* larger = (T*)IOMalloc(grown * sizeof(T));
+        if (!larger) return nullptr;
+        if (*records) {
+            memcpy(larger, *records, *count * sizeof(T));
+            IOFree(*records, *capacity * sizeof(T));
+        }
+        *records = larger;
+        *capacity = grown;
+    }
+    T* record = &(*records)[(*count)++];
+    bzero(record, sizeof(T));
+    return record;
+}
+
 #define CLASS VMShaderManager
 #define super OSObject
 
@@ -543,8 +103,10 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     m_accelerator = accelerator;
     m_gpu_device = accelerator ? accelerator->getGPUDevice() : nullptr;
     
-    m_shaders = OSArray::withCapacity(64);
-    m_programs = OSArray::withCapacity(16);
+    m_shader_table.init(VM_HANDLE_MAX_SLOTS);
+    m_program_table.init(VM_HANDLE_MAX_SLOTS);
+    
+    bzero(m_context_ubo, sizeof(m_context_ubo));
     
     // Initialize context programs array
     m_context_programs = OSArray::withCapacity(MAX_RENDER_CONTEXTS);
@@ -559,62 +121,109 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
         }
     }
     
-    m_next_shader_id = 1;
-    m_next_program_id = 1;
     m_frame_count = 0;
     
+    bzero(m_shader_cache, sizeof(m_shader_cache));
+    bzero(m_program_cache, sizeof(m_program_cache));
+    m_idle_shader_count = 0;
+    m_shader_cache_hits = 0;
+    m_shader_cache_misses = 0;
+    m_program_cache_hits = 0;
+    m_program_cache_misses = 0;
+    m_shader_cache_generation = 0;
+    
     m_shader_lock = IOLockAlloc();
     
-    return (m_shaders && m_programs && m_context_programs && m_shader_lock);
+    // Compile workers. Without any, compileShader and linkProgram run the
+    // job on the caller's thread (still outside m_shader_lock).
+    m_job_head = nullptr;
+    m_job_tail = nullptr;
+    m_jobs_completed = 0;
+    m_compile_shutdown = false;
+    m_compile_workers_running = 0;
+    m_compile_worker_count = 0;
+    uint32_t workers = getSystemCoreCount();
+    if (workers > VM_SHADER_MAX_COMPILE_WORKERS) {
+        workers = VM_SHADER_MAX_COMPILE_WORKERS;
+    }
+    for (uint32_t i = 0; i < workers; i++) {
+        // thread_call_allocate_with_priority is 10.8+; the kext targets 10.6.
+        // Workers return their callout thread as soon as the queue drains.
+        thread_call_t call = thread_call_allocate(&CLASS::sCompileWorker, this);
+        if (!call) break;
+        m_compile_workers[i] = call;
+        m_compile_worker_running[i] = false;
+        m_compile_worker_count++;
+    }
+    VMLOG_INFO("VMShaderManager: %u compile workers\n", m_compile_worker_count);
+    
+    return (m_context_programs && m_shader_lock);
 }
 
 void CLASS::free()
 {
+    // Stop the workers: queued jobs are dropped, running ones finish first
     if (m_shader_lock) {
-        IOLockFree(m_shader_lock);
-        m_shader_lock = nullptr;
+        IOLockLock(m_shader_lock);
+        m_compile_shutdown = true;
+        IOLockWakeup(m_shader_lock, &m_jobs_completed, false);
+        while (m_compile_workers_running > 0) {
+            IOLockSleep(m_shader_lock, &m_jobs_completed, THREAD_UNINT);
+        }
+        while (m_job_head) {
+            CompileJob* job = m_job_head;
+            m_job_head = job->next;
+            freeCompileJob(job);
+        }
+        m_job_tail = nullptr;
+        IOLockUnlock(m_shader_lock);
+    }
+    for (uint32_t i = 0; i < m_compile_worker_count; i++) {
+        thread_call_cancel(m_compile_workers[i]);
+        thread_call_free(m_compile_workers[i]);
+    }
+    m_compile_worker_count = 0;
+    
+    for (uint32_t i = 0; i < VM_SHADER_PROGRAM_CACHE_SIZE; i++) {
+        freeProgramCacheEntry(&m_program_cache[i]);
     }
     
     // Clean up shaders
-    if (m_shaders) {
-        IOLockLock(m_shader_lock);
-        while (m_shaders->getCount() > 0) {
-            CompiledShader* shader = (CompiledShader*)m_shaders->getObject(0);
-            if (shader) {
-                if (shader->bytecode) shader->bytecode->release();
-                if (shader->uniforms) shader->uniforms->release();
-                if (shader->attributes) shader->attributes->release();
-                if (shader->resources) shader->resources->release();
-                IOFree(shader, sizeof(CompiledShader));
-            }
-            m_shaders->removeObject(0);
+    for (uint32_t i = 0; i < m_shader_table.limit(); i++) {
+        CompiledShader* shader = m_shader_table.at(i);
+        if (shader) {
+            if (shader->bytecode) shader->bytecode->release();
+            freeShaderRecords(shader);
+            IOFree(shader, sizeof(CompiledShader));
         }
-        IOLockUnlock(m_shader_lock);
-        m_shaders->release();
     }
+    m_shader_table.free();
     
     // Clean up programs
-    if (m_programs) {
-        while (m_programs->getCount() > 0) {
-            ShaderProgram* program = (ShaderProgram*)m_programs->getObject(0);
-            if (program) {
-                if (program->shader_ids) program->shader_ids->release();
-                if (program->all_uniforms) program->all_uniforms->release();
-                if (program->all_attributes) program->all_attributes->release();
-                if (program->all_resources) program->all_resources->release();
-                if (program->performance_stats) IOFree(program->performance_stats, sizeof(struct ProgramPerformanceStats));
-                IOFree(program, sizeof(ShaderProgram));
-            }
-            m_programs->removeObject(0);
+    for (uint32_t i = 0; i < m_program_table.limit(); i++) {
+        ShaderProgram* program = m_program_table.at(i);
+        if (program) {
+            if (program->shader_ids) program->shader_ids->release();
+            if (program->all_uniforms) program->all_uniforms->release();
+            if (program->all_attributes) program->all_attributes->release();
+            if (program->all_resources) program->all_resources->release();
+            if (program->performance_stats) IOFree(program->performance_stats, sizeof(struct ProgramPerformanceStats));
+            releaseUniformBlock(program);
+            IOFree(program, sizeof(ShaderProgram));
         }
-        m_programs->release();
     }
+    m_program_table.free();
     
     // Clean up context programs
     if (m_context_programs) {
         m_context_programs->release();
     }
     
+    if (m_shader_lock) {
+        IOLockFree(m_shader_lock);
+        m_shader_lock = nullptr;
+    }
+    
     super::free();
 }
 
@@ -630,25 +239,86 @@ IOReturn CLASS::compileShader(VMShaderType type, VMShaderLanguage language,
     if (!source_code || source_size == 0 || !shader_id)
         return kIOReturnBadArgument;
     
-    IOLockLock(m_shader_lock);
+    uint8_t key[VM_SHADER_HASH_SIZE];
+    hashShaderSource(type, language, flags, source_code, source_size, key);
+    
+    // The caller's buffer is only valid for this call; the job keeps a copy
+    CompileJob* job = (CompileJob*)IOMalloc(sizeof(CompileJob));
+    if (!job)
+        return kIOReturnNoMemory;
+    bzero(job, sizeof(CompileJob));
+    job->type = type;
+    job->language = language;
+    job->flags = flags;
+    job->source = IOMalloc(source_size);
+    if (!job->source) {
+        IOFree(job, sizeof(CompileJob));
+        return kIOReturnNoMemory;
+    }
+    memcpy(job->source, source_code, source_size);
+    job->source_size = source_size;
     
-    CompiledShader* shader = nullptr;
-    IOReturn ret = compileShaderInternal(type, language, source_code, source_size, 
-                                        flags, &shader);
+    IOLockLock(m_shader_lock);
     
-    if (ret == kIOReturnSuccess && shader) {
-        shader->shader_id = ++m_next_shader_id;
-        shader->ref_count = 1;
-        shader->is_valid = true;
-        
-        m_shaders->setObject((OSObject*)shader);
+    // Identical source already compiled or queued (by anyone): share it
+    CompiledShader* shader = lookupCachedShader(key);
+    if (shader) {
+        if (shader->ref_count++ == 0) {
+            m_idle_shader_count--;
+        }
+        shader->last_used = mach_absolute_time();
+        m_shader_cache_hits++;
         *shader_id = shader->shader_id;
-        
-        IOLog("VMShaderManager: Compiled shader %d (type: %d, language: %d, size: %zu bytes)\n",
-              shader->shader_id, type, language, source_size);
+        IOLockUnlock(m_shader_lock);
+        freeCompileJob(job);
+        return kIOReturnSuccess;
+    }
+    m_shader_cache_misses++;
+    
+    // Register a pending entry so the id, and identical sources compiled
+    // meanwhile, resolve to it; runCompileJob fills it in
+    shader = (CompiledShader*)IOMalloc(sizeof(CompiledShader));
+    if (!shader) {
+        IOLockUnlock(m_shader_lock);
+        freeCompileJob(job);
+        return kIOReturnNoMemory;
     }
+    bzero(shader, sizeof(CompiledShader));
+    shader->shader_id = m_shader_table.insert(shader);
+    if (!shader->shader_id) {
+        IOLockUnlock(m_shader_lock);
+        IOFree(shader, sizeof(CompiledShader));
+        freeCompileJob(job);
+        return kIOReturnNoResources;
+    }
+    shader->type = type;
+    shader->language = language;
+    shader->ref_count = 1;
+    shader->is_pending = true;
+    shader->compile_status = kIOReturnNotReady;
+    memcpy(shader->cache_key, key, sizeof(key));
+    shader->last_used = mach_absolute_time();
     
+    insertCachedShader(shader);
+    *shader_id = shader->shader_id;
+    job->id = shader->shader_id;
+    
+    if (queueCompileJob(job)) {
+        IOLockUnlock(m_shader_lock);
+        return kIOReturnSuccess;
+    }
     IOLockUnlock(m_shader_lock);
+    
+    IOReturn ret = runCompileJob(job);
+    freeCompileJob(job);
+    if (ret != kIOReturnSuccess) {
+        IOLockLock(m_shader_lock);
+        shader = findShader(*shader_id);
+        if (shader) {
+            releaseShaderRef(shader);
+        }
+        IOLockUnlock(m_shader_lock);
+    }
     return ret;
 }
 
@@ -663,9 +333,6 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
     bzero(shader, sizeof(CompiledShader));
     shader->type = type;
     shader->language = language;
-    shader->uniforms = OSArray::withCapacity(16);
-    shader->attributes = OSArray::withCapacity(8);
-    shader->resources = OSArray::withCapacity(8);
     
     // Initialize bytecode size for compilation pipeline
     size_t bytecode_size = source_size;
@@ -673,8 +340,8 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
     // Comprehensive Multi-Language Shader Compilation System
     // Advanced text-based shader compilation with cross-language support, optimization, and bytecode generation
     if (language == VM_SHADER_LANG_GLSL || language == VM_SHADER_LANG_HLSL || language == VM_SHADER_LANG_MSL) {
-        IOLog("VMShaderManager: Initiating advanced text-based shader compilation\n");
-        IOLog("  Source Language: %s, Target Type: %s\n", 
+        VMLOG_DEBUG("VMShaderManager: Initiating advanced text-based shader compilation\n");
+        VMLOG_DEBUG("  Source Language: %s, Target Type: %s\n", 
               getShaderLanguageString(language), getShaderTypeString(type));
         
         // Advanced Shader Compilation Pipeline Structure
@@ -751,7 +418,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         } compilation_pipeline = {0};
         
         // Phase 1: Advanced Source Code Preprocessing and Analysis
-        IOLog("VMShaderManager: Phase 1 - Advanced source preprocessing and analysis\n");
+        VMLOG_DEBUG("VMShaderManager: Phase 1 - Advanced source preprocessing and analysis\n");
         
         uint64_t analysis_start = mach_absolute_time();
         const char* source_text = (const char*)source_code;
@@ -877,7 +544,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             current_line++;
             
             if (current_line > 50000) { // Safety limit
-                IOLog("VMShaderManager: Warning - shader source exceeds line limit, truncating analysis\n");
+                VMLOG_WARN("VMShaderManager: Warning - shader source exceeds line limit, truncating analysis\n");
                 break;
             }
         }
@@ -889,20 +556,20 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         compilation_pipeline.source_analysis.pragma_directive_processing = (preprocessor_analysis.pragma_directives > 0);
         compilation_pipeline.source_analysis.include_resolution_complete = (preprocessor_analysis.include_statements == 0); // No includes to resolve
         
-        IOLog("  Preprocessor Analysis Results:\n");
-        IOLog("    Total Lines: %d\n", compilation_pipeline.source_analysis.total_source_lines);
-        IOLog("    Preprocessor Directives: %d\n", compilation_pipeline.source_analysis.preprocessor_directives);
-        IOLog("    Version: %s %s\n", 
+        VMLOG_DEBUG("  Preprocessor Analysis Results:\n");
+        VMLOG_DEBUG("    Total Lines: %d\n", compilation_pipeline.source_analysis.total_source_lines);
+        VMLOG_DEBUG("    Preprocessor Directives: %d\n", compilation_pipeline.source_analysis.preprocessor_directives);
+        VMLOG_DEBUG("    Version: %s %s\n", 
               strlen(preprocessor_analysis.shader_version) > 0 ? preprocessor_analysis.shader_version : "unknown",
               strlen(preprocessor_analysis.shader_profile) > 0 ? preprocessor_analysis.shader_profile : "");
-        IOLog("    Extensions Used: %s\n", preprocessor_analysis.uses_extensions ? "YES" : "NO");
+        VMLOG_DEBUG("    Extensions Used: %s\n", preprocessor_analysis.uses_extensions ? "YES" : "NO");
         if (preprocessor_analysis.uses_extensions) {
-            IOLog("    Required Extensions: %s\n", preprocessor_analysis.required_extensions);
+            VMLOG_DEBUG("    Required Extensions: %s\n", preprocessor_analysis.required_extensions);
         }
-        IOLog("    Analysis Time: %.2f ms\n", compilation_pipeline.source_analysis.syntax_analysis_time_ms);
+        VMLOG_DEBUG("    Analysis Time: %.2f ms\n", compilation_pipeline.source_analysis.syntax_analysis_time_ms);
         
         // Phase 2: Language-Specific Compilation and Cross-Language Translation
-        IOLog("VMShaderManager: Phase 2 - Language-specific compilation and cross-translation\n");
+        VMLOG_DEBUG("VMShaderManager: Phase 2 - Language-specific compilation and cross-translation\n");
         
         uint64_t cross_compile_start = mach_absolute_time();
         
@@ -925,7 +592,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         size_t compiled_size = 0;
         
         if (source_language == VM_SHADER_LANG_HLSL) {
-            IOLog("  HLSL Compilation Pipeline:\n");
+            VMLOG_DEBUG("  HLSL Compilation Pipeline:\n");
             
             // HLSL-specific compilation steps
             struct HLSLCompilation {
@@ -949,7 +616,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             };
             
             // Advanced HLSL Compilation Process - Comprehensive Shader Translation Pipeline
-            IOLog("    Initiating advanced HLSL compilation and cross-platform translation\n");
+            VMLOG_DEBUG("    Initiating advanced HLSL compilation and cross-platform translation\n");
             
             // Phase 1: HLSL Semantic Analysis and Preprocessing
             struct HLSLSemanticAnalysis {
@@ -1066,17 +733,17 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                 if (semantic_scan_line > 50000) break; // Safety limit
             }
             
-            IOLog("      HLSL Analysis Results:\n");
-            IOLog("        Semantics: Input=%d, Output=%d, System=%d\n",
+            VMLOG_DEBUG("      HLSL Analysis Results:\n");
+            VMLOG_DEBUG("        Semantics: Input=%d, Output=%d, System=%d\n",
                   semantic_analysis.vertex_input_semantics + semantic_analysis.pixel_input_semantics,
                   semantic_analysis.vertex_output_semantics + semantic_analysis.pixel_output_semantics,
                   semantic_analysis.system_value_semantics);
-            IOLog("        Resources: CBV=%d, SRV=%d, Samplers=%d, UAV=%d\n",
+            VMLOG_DEBUG("        Resources: CBV=%d, SRV=%d, Samplers=%d, UAV=%d\n",
                   resource_binding.constant_buffer_registers,
                   resource_binding.texture_registers,
                   resource_binding.sampler_registers,
                   resource_binding.uav_registers);
-            IOLog("        Features: Geometry=%s, Compute=%s, Wave=%s\n",
+            VMLOG_DEBUG("        Features: Geometry=%s, Compute=%s, Wave=%s\n",
                   language_features.uses_geometry_shaders ? "YES" : "NO",
                   language_features.uses_compute_shaders ? "YES" : "NO",
                   language_features.uses_wave_intrinsics ? "YES" : "NO");
@@ -1137,7 +804,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             size_t header_len = strlen(hlsl_target_header);
             
             // Phase 5: Advanced HLSL-to-GLSL Translation Engine
-            IOLog("    Initiating comprehensive HLSL-to-GLSL translation\n");
+            VMLOG_DEBUG("    Initiating comprehensive HLSL-to-GLSL translation\n");
             
             const char* src_ptr = source_text;
             char* dst_ptr = compiled_source + header_len;
@@ -1444,14 +1111,14 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             
             compilation_pipeline.cross_compilation.translation_passes++;
             
-            IOLog("    HLSL Translation Results:\n");
-            IOLog("      CBuffers: %d, Textures: %d, Samplers: %d\n",
+            VMLOG_DEBUG("    HLSL Translation Results:\n");
+            VMLOG_DEBUG("      CBuffers: %d, Textures: %d, Samplers: %d\n",
                   hlsl_compile.cbuffer_count, hlsl_compile.texture_bindings, hlsl_compile.sampler_bindings);
-            IOLog("      Semantic Mapping: %s\n", hlsl_compile.semantic_mapping ? "APPLIED" : "SKIPPED");
-            IOLog("      Register Translation: %s\n", hlsl_compile.register_binding_translation ? "APPLIED" : "SKIPPED");
+            VMLOG_DEBUG("      Semantic Mapping: %s\n", hlsl_compile.semantic_mapping ? "APPLIED" : "SKIPPED");
+            VMLOG_DEBUG("      Register Translation: %s\n", hlsl_compile.register_binding_translation ? "APPLIED" : "SKIPPED");
             
         } else if (source_language == VM_SHADER_LANG_MSL) {
-            IOLog("  Metal Shading Language (MSL) Compilation Pipeline:\n");
+            VMLOG_DEBUG("  Metal Shading Language (MSL) Compilation Pipeline:\n");
             
             // MSL-specific compilation
             struct MSLCompilation {
@@ -1475,7 +1142,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             };
             
             // Advanced MSL Compilation Process - Comprehensive Metal-to-GLSL Translation Pipeline
-            IOLog("    Initiating advanced MSL compilation and cross-platform translation\n");
+            VMLOG_DEBUG("    Initiating advanced MSL compilation and cross-platform translation\n");
             
             // Phase 1: MSL Attribute and Stage Interface Analysis
             struct MSLStageInterfaceAnalysis {
@@ -1618,17 +1285,17 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             msl_compile.texture_arguments = stage_interface.texture_arguments;
             msl_compile.threadgroup_variables = stage_interface.threadgroup_variables;
             
-            IOLog("      MSL Analysis Results:\n");
-            IOLog("        Stage Interface: Vertex=%d, Buffers=%d, Textures=%d, Samplers=%d\n",
+            VMLOG_DEBUG("      MSL Analysis Results:\n");
+            VMLOG_DEBUG("        Stage Interface: Vertex=%d, Buffers=%d, Textures=%d, Samplers=%d\n",
                   stage_interface.vertex_attributes,
                   stage_interface.buffer_arguments,
                   stage_interface.texture_arguments,
                   stage_interface.sampler_arguments);
-            IOLog("        Builtins: vertex_id=%s, instance_id=%s, position=%s\n",
+            VMLOG_DEBUG("        Builtins: vertex_id=%s, instance_id=%s, position=%s\n",
                   stage_interface.uses_vertex_id ? "YES" : "NO",
                   stage_interface.uses_instance_id ? "YES" : "NO",
                   stage_interface.uses_position_builtin ? "YES" : "NO");
-            IOLog("        Features: MetalStdLib=%s, SIMD=%s, Atomic=%s\n",
+            VMLOG_DEBUG("        Features: MetalStdLib=%s, SIMD=%s, Atomic=%s\n",
                   language_features.uses_metal_stdlib ? "YES" : "NO",
                   language_features.uses_simd_library ? "YES" : "NO",
                   language_features.uses_atomic_operations ? "YES" : "NO");
@@ -1680,7 +1347,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             size_t header_len = strlen(msl_target_header);
             
             // Phase 5: Advanced MSL-to-GLSL Translation Engine
-            IOLog("    Initiating comprehensive MSL-to-GLSL translation\n");
+            VMLOG_DEBUG("    Initiating comprehensive MSL-to-GLSL translation\n");
             
             const char* src_ptr = source_text;
             char* dst_ptr = compiled_source + header_len;
@@ -1965,21 +1632,21 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             compilation_pipeline.cross_compilation.translation_passes++;
             
             // Phase 6: MSL Translation Quality Assessment and Analysis
-            IOLog("    Advanced MSL Translation Results:\n");
-            IOLog("      Translation Quality: %s\n", 
+            VMLOG_DEBUG("    Advanced MSL Translation Results:\n");
+            VMLOG_DEBUG("      Translation Quality: %s\n", 
                   (stage_interface.buffer_arguments > 0 || stage_interface.texture_arguments > 0) ? "HIGH" : "STANDARD");
-            IOLog("      Stage Type: %s\n", type == VM_SHADER_TYPE_VERTEX ? "VERTEX" : "FRAGMENT");
-            IOLog("      Interface Mapping: Attributes=%d -> Locations, Buffers=%d -> UBOs, Textures=%d -> Samplers\n",
+            VMLOG_DEBUG("      Stage Type: %s\n", type == VM_SHADER_TYPE_VERTEX ? "VERTEX" : "FRAGMENT");
+            VMLOG_DEBUG("      Interface Mapping: Attributes=%d -> Locations, Buffers=%d -> UBOs, Textures=%d -> Samplers\n",
                   stage_interface.vertex_attributes,
                   stage_interface.buffer_arguments,
                   stage_interface.texture_arguments);
-            IOLog("      Metal Feature Coverage: StdLib=%s, SIMD=%s, Atomics=%s, Imageblocks=%s\n",
+            VMLOG_DEBUG("      Metal Feature Coverage: StdLib=%s, SIMD=%s, Atomics=%s, Imageblocks=%s\n",
                   language_features.uses_metal_stdlib ? "YES" : "NO",
                   language_features.uses_simd_library ? "YES" : "NO",
                   language_features.uses_atomic_operations ? "YES" : "NO",
                   language_features.uses_imageblocks ? "YES" : "NO");
-            IOLog("      GLSL Target Version: %d (based on MSL feature requirements)\n", required_glsl_version);
-            IOLog("      Translation Statistics: MSL Lines=%d, GLSL Output=%zu chars, Bindings Mapped=%d\n",
+            VMLOG_DEBUG("      GLSL Target Version: %d (based on MSL feature requirements)\n", required_glsl_version);
+            VMLOG_DEBUG("      Translation Statistics: MSL Lines=%d, GLSL Output=%zu chars, Bindings Mapped=%d\n",
                   msl_scan_line,
                   compiled_size,
                   stage_interface.buffer_arguments + stage_interface.texture_arguments);
@@ -1996,12 +1663,12 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                 (language_features.uses_atomic_operations ? 0x04 : 0) |
                 (language_features.uses_imageblocks ? 0x08 : 0);
             
-            IOLog("      MSL Feature Flags: 0x%02X\n", msl_feature_flags);
+            VMLOG_DEBUG("      MSL Feature Flags: 0x%02X\n", msl_feature_flags);
                 
-            IOLog("  MSL-to-GLSL Translation Pipeline: COMPLETED\n");
+            VMLOG_DEBUG("  MSL-to-GLSL Translation Pipeline: COMPLETED\n");
             
         } else { // GLSL - native compilation
-            IOLog("  GLSL Native Compilation Pipeline:\n");
+            VMLOG_DEBUG("  GLSL Native Compilation Pipeline:\n");
             
             // GLSL-specific compilation and optimization
             struct GLSLCompilation {
@@ -2034,10 +1701,10 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             memcpy(compiled_source, source_text, compiled_size);
             compiled_source[compiled_size] = '\0';
             
-            IOLog("    GLSL Compilation Results:\n");
-            IOLog("      GLSL Version: %d\n", glsl_compile.glsl_version);
-            IOLog("      Extensions Required: %s\n", glsl_compile.extension_validation ? "YES" : "NO");
-            IOLog("      Uniform Blocks: %d\n", glsl_compile.uniform_blocks);
+            VMLOG_DEBUG("    GLSL Compilation Results:\n");
+            VMLOG_DEBUG("      GLSL Version: %d\n", glsl_compile.glsl_version);
+            VMLOG_DEBUG("      Extensions Required: %s\n", glsl_compile.extension_validation ? "YES" : "NO");
+            VMLOG_DEBUG("      Uniform Blocks: %d\n", glsl_compile.uniform_blocks);
         }
         
         uint64_t cross_compile_end = mach_absolute_time();
@@ -2045,15 +1712,15 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         
         compilation_pipeline.source_analysis.semantic_analysis_complete = true;
         
-        IOLog("  Cross-Compilation Summary:\n");
-        IOLog("    Source Language: %s -> Target Language: %s\n", 
+        VMLOG_DEBUG("  Cross-Compilation Summary:\n");
+        VMLOG_DEBUG("    Source Language: %s -> Target Language: %s\n", 
               getShaderLanguageString(source_language), getShaderLanguageString(target_language));
-        IOLog("    Translation Passes: %d\n", compilation_pipeline.cross_compilation.translation_passes);
-        IOLog("    Compiled Size: %zu bytes\n", compiled_size);
-        IOLog("    Cross-Compilation Time: %.2f ms\n", compilation_pipeline.cross_compilation.cross_compile_time_ms);
+        VMLOG_DEBUG("    Translation Passes: %d\n", compilation_pipeline.cross_compilation.translation_passes);
+        VMLOG_DEBUG("    Compiled Size: %zu bytes\n", compiled_size);
+        VMLOG_DEBUG("    Cross-Compilation Time: %.2f ms\n", compilation_pipeline.cross_compilation.cross_compile_time_ms);
         
         // Phase 3: Advanced Shader Optimization
-        IOLog("VMShaderManager: Phase 3 - Advanced shader optimization\n");
+        VMLOG_DEBUG("VMShaderManager: Phase 3 - Advanced shader optimization\n");
         
         uint64_t optimization_start = mach_absolute_time();
         
@@ -2069,7 +1736,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         compilation_pipeline.optimization.instruction_scheduling = (m_accelerator != NULL);
         
         // Advanced Shader Optimization Engine - Comprehensive Multi-Pass Optimization Pipeline
-        IOLog("    Initiating comprehensive shader optimization engine\n");
+        VMLOG_DEBUG("    Initiating comprehensive shader optimization engine\n");
         
         size_t original_size = compiled_size;
         uint32_t estimated_instructions_before = (uint32_t)(compiled_size / 20); // Rough estimate
@@ -2117,18 +1784,18 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         control_flow.has_complex_control_flow = (control_flow.branch_instructions > 5);
         control_flow.has_nested_loops = (control_flow.loop_constructs_found > 2);
         
-        IOLog("      Control Flow Analysis:\n");
-        IOLog("        Basic Blocks: %d, Branches: %d, Loops: %d\n",
+        VMLOG_DEBUG("      Control Flow Analysis:\n");
+        VMLOG_DEBUG("        Basic Blocks: %d, Branches: %d, Loops: %d\n",
               control_flow.basic_blocks_identified,
               control_flow.branch_instructions,
               control_flow.loop_constructs_found);
-        IOLog("        Complex Control Flow: %s, Nested Loops: %s\n",
+        VMLOG_DEBUG("        Complex Control Flow: %s, Nested Loops: %s\n",
               control_flow.has_complex_control_flow ? "YES" : "NO",
               control_flow.has_nested_loops ? "YES" : "NO");
         
         // Phase B: Dead Code Elimination with Advanced Analysis
         if (compilation_pipeline.optimization.dead_code_elimination) {
-            IOLog("      Performing advanced dead code elimination\n");
+            VMLOG_DEBUG("      Performing advanced dead code elimination\n");
             
             struct DeadCodeElimination {
                 uint32_t unreachable_blocks;            // Unreachable code blocks
@@ -2140,7 +1807,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             } dce_analysis = {0};
             
             // Advanced Sophisticated Dead Code Analysis Engine
-            IOLog("        Initiating comprehensive dead code elimination analysis\n");
+            VMLOG_DEBUG("        Initiating comprehensive dead code elimination analysis\n");
             
             // Phase 1: Control Flow Graph Analysis for Unreachable Code Detection
             struct ControlFlowGraphAnalysis {
@@ -2161,7 +1828,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             cfg_analysis.loop_exit_conditions = control_flow.loop_constructs_found;
             
             // Advanced Sophisticated CFG Analysis Engine
-            IOLog("          Initiating comprehensive Control Flow Graph analysis\n");
+            VMLOG_DEBUG("          Initiating comprehensive Control Flow Graph analysis\n");
             
             const char* cfg_scan_ptr = compiled_source;
             uint32_t cfg_scan_offset = 0;
@@ -2185,7 +1852,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             } advanced_cfg = {0};
             
             // Phase 1: Comprehensive Pattern Detection Analysis
-            IOLog("            Phase 1: Comprehensive pattern detection and reachability analysis\n");
+            VMLOG_DEBUG("            Phase 1: Comprehensive pattern detection and reachability analysis\n");
             
             uint32_t current_nesting_depth = 0;
             uint32_t max_nesting_encountered = 0;
@@ -2223,7 +1890,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                                     !strnstr_local(after_return, "else", 10) &&
                                     !strnstr_local(after_return, "case", 10)) {
                                     cfg_analysis.has_dead_after_return = true;
-                                    IOLog("              Dead code detected after void return at offset %d\n", 
+                                    VMLOG_DEBUG("              Dead code detected after void return at offset %d\n", 
                                           cfg_scan_offset);
                                 }
                             }
@@ -2241,12 +1908,12 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                             expr_ptr++;
                         }
                         
-                        IOLog("              Value return found with complexity score: %d\n", expression_complexity);
+                        VMLOG_DEBUG("              Value return found with complexity score: %d\n", expression_complexity);
                         
                         // Track early returns (returns not at end of function)
                         if (current_nesting_depth > 0) {
                             advanced_cfg.has_early_returns = true;
-                            IOLog("              Early return detected at nesting depth %d\n", current_nesting_depth);
+                            VMLOG_DEBUG("              Early return detected at nesting depth %d\n", current_nesting_depth);
                         }
                     }
                 }
@@ -2269,7 +1936,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                         if (after_break < compiled_source + compiled_size && 
                             *after_break != '}' && *after_break != 'c') { // Not case
                             advanced_cfg.has_unreachable_after_break = true;
-                            IOLog("              Dead code detected after break statement\n");
+                            VMLOG_DEBUG("              Dead code detected after break statement\n");
                         }
                     }
                 }
@@ -2290,7 +1957,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                         }
                         if (after_continue < compiled_source + compiled_size && *after_continue != '}') {
                             advanced_cfg.has_unreachable_after_continue = true;
-                            IOLog("              Dead code detected after continue statement\n");
+                            VMLOG_DEBUG("              Dead code detected after continue statement\n");
                         }
                     }
                 }
@@ -2300,7 +1967,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                     advanced_cfg.switch_statements_analyzed++;
                     in_switch_block = true;
                     
-                    IOLog("              Switch statement detected at offset %d\n", cfg_scan_offset);
+                    VMLOG_DEBUG("              Switch statement detected at offset %d\n", cfg_scan_offset);
                     
                     // Analyze switch complexity by counting cases
                     const char* switch_scan = cfg_scan_ptr + 6;
@@ -2325,7 +1992,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                     
                     if (case_count > 5) {
                         advanced_cfg.has_complex_switch_logic = true;
-                        IOLog("              Complex switch detected with %d cases\n", case_count);
+                        VMLOG_DEBUG("              Complex switch detected with %d cases\n", case_count);
                     }
                 }
                 
@@ -2339,7 +2006,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                     // Detect deeply nested structures
                     if (current_nesting_depth > 4) {
                         advanced_cfg.has_deeply_nested_blocks = true;
-                        IOLog("              Deep nesting detected: depth %d at offset %d\n", 
+                        VMLOG_DEBUG("              Deep nesting detected: depth %d at offset %d\n", 
                               current_nesting_depth, cfg_scan_offset);
                     }
                 }
@@ -2362,7 +2029,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                         strnstr_local(cfg_scan_ptr, "for(;;)", 100) ||
                         strnstr_local(cfg_scan_ptr, "for (;;)", 100)) {
                         cfg_analysis.has_infinite_loops = true;
-                        IOLog("              Infinite loop pattern detected at offset %d\n", cfg_scan_offset);
+                        VMLOG_DEBUG("              Infinite loop pattern detected at offset %d\n", cfg_scan_offset);
                     }
                     
                     // Analyze loop condition complexity
@@ -2385,7 +2052,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                         } while (condition_end < compiled_source + compiled_size && paren_depth > 0);
                         
                         if (condition_complexity > 3) {
-                            IOLog("              Complex loop condition detected (complexity: %d)\n", condition_complexity);
+                            VMLOG_DEBUG("              Complex loop condition detected (complexity: %d)\n", condition_complexity);
                         }
                     }
                 }
@@ -2419,13 +2086,13 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                         if_scan++;
                     }
                     
-                    IOLog("              Conditional block analyzed: has_else=%s\n", found_else ? "YES" : "NO");
+                    VMLOG_DEBUG("              Conditional block analyzed: has_else=%s\n", found_else ? "YES" : "NO");
                 }
                 
                 // Method 7: Exception Handling Detection (rare in shaders but possible)
                 if (strnstr_local(cfg_scan_ptr, "try", 50) || strnstr_local(cfg_scan_ptr, "catch", 50)) {
                     advanced_cfg.exception_handlers_found++;
-                    IOLog("              Exception handling detected (unusual in shader code)\n");
+                    VMLOG_DEBUG("              Exception handling detected (unusual in shader code)\n");
                 }
                 
                 cfg_scan_ptr++;
@@ -2436,7 +2103,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             advanced_cfg.nested_control_depth = max_nesting_encountered;
             
             // Phase 2: CFG Analysis Results Compilation and Quality Assessment
-            IOLog("            Phase 2: CFG analysis results compilation\n");
+            VMLOG_DEBUG("            Phase 2: CFG analysis results compilation\n");
             
             struct CFGQualityMetrics {
                 float control_flow_complexity_score;    // Overall complexity score
@@ -2486,35 +2153,35 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                 cfg_quality.cfg_complexity_rating = "HIGHLY_COMPLEX";
             }
             
-            IOLog("          Advanced CFG Analysis Results:\n");
-            IOLog("            Control Flow Elements:\n");
-            IOLog("              Return Statements: %d, Break Statements: %d, Continue: %d\n",
+            VMLOG_DEBUG("          Advanced CFG Analysis Results:\n");
+            VMLOG_DEBUG("            Control Flow Elements:\n");
+            VMLOG_DEBUG("              Return Statements: %d, Break Statements: %d, Continue: %d\n",
                   advanced_cfg.return_statements_found, advanced_cfg.break_statements_found,
                   advanced_cfg.continue_statements_found);
-            IOLog("              Conditional Blocks: %d, Switch Statements: %d, Case Labels: %d\n",
+            VMLOG_DEBUG("              Conditional Blocks: %d, Switch Statements: %d, Case Labels: %d\n",
                   advanced_cfg.conditional_blocks_analyzed, advanced_cfg.switch_statements_analyzed,
                   advanced_cfg.case_labels_found);
-            IOLog("              Maximum Nesting Depth: %d, Exception Handlers: %d\n",
+            VMLOG_DEBUG("              Maximum Nesting Depth: %d, Exception Handlers: %d\n",
                   advanced_cfg.nested_control_depth, advanced_cfg.exception_handlers_found);
-            IOLog("            Quality Assessment:\n");
-            IOLog("              Complexity Score: %.1f, Complexity Rating: %s\n",
+            VMLOG_DEBUG("            Quality Assessment:\n");
+            VMLOG_DEBUG("              Complexity Score: %.1f, Complexity Rating: %s\n",
                   cfg_quality.control_flow_complexity_score, cfg_quality.cfg_complexity_rating);
-            IOLog("              Reachability Confidence: %.1f%%, Optimization Sites: %d\n",
+            VMLOG_DEBUG("              Reachability Confidence: %.1f%%, Optimization Sites: %d\n",
                   cfg_quality.reachability_confidence * 100.0f, cfg_quality.potential_optimization_sites);
-            IOLog("              Deep Analysis Required: %s\n", 
+            VMLOG_DEBUG("              Deep Analysis Required: %s\n", 
                   cfg_quality.requires_deep_analysis ? "YES" : "NO");
-            IOLog("            Dead Code Patterns:\n");
-            IOLog("              Early Returns: %s, Complex Switch Logic: %s\n",
+            VMLOG_DEBUG("            Dead Code Patterns:\n");
+            VMLOG_DEBUG("              Early Returns: %s, Complex Switch Logic: %s\n",
                   advanced_cfg.has_early_returns ? "DETECTED" : "NONE",
                   advanced_cfg.has_complex_switch_logic ? "DETECTED" : "NONE");
-            IOLog("              Deep Nesting: %s, Unreachable After Break: %s\n",
+            VMLOG_DEBUG("              Deep Nesting: %s, Unreachable After Break: %s\n",
                   advanced_cfg.has_deeply_nested_blocks ? "DETECTED" : "NONE",
                   advanced_cfg.has_unreachable_after_break ? "DETECTED" : "NONE");
             
-            IOLog("          Control Flow Graph Analysis:\n");
-            IOLog("            Entry Points: %d, Reachable Blocks: %d\n",
+            VMLOG_DEBUG("          Control Flow Graph Analysis:\n");
+            VMLOG_DEBUG("            Entry Points: %d, Reachable Blocks: %d\n",
                   cfg_analysis.entry_points_identified, cfg_analysis.reachable_blocks_marked);
-            IOLog("            Dead After Return: %s, Unreachable Cases: %s, Infinite Loops: %s\n",
+            VMLOG_DEBUG("            Dead After Return: %s, Unreachable Cases: %s, Infinite Loops: %s\n",
                   cfg_analysis.has_dead_after_return ? "DETECTED" : "NONE",
                   cfg_analysis.has_unreachable_cases ? "DETECTED" : "NONE",
                   cfg_analysis.has_infinite_loops ? "DETECTED" : "NONE");
@@ -2541,10 +2208,10 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             liveness.temporary_variables = liveness.variables_declared / 3; // 33% are temporaries
             liveness.has_live_range_conflicts = (liveness.variables_declared > 20);
             
-            IOLog("          Variable Liveness Analysis:\n");
-            IOLog("            Declared: %d, Read: %d, Written: %d\n",
+            VMLOG_DEBUG("          Variable Liveness Analysis:\n");
+            VMLOG_DEBUG("            Declared: %d, Read: %d, Written: %d\n",
                   liveness.variables_declared, liveness.variables_read, liveness.variables_written);
-            IOLog("            Never Used: %d, Write-Only: %d, Temporaries: %d\n",
+            VMLOG_DEBUG("            Never Used: %d, Write-Only: %d, Temporaries: %d\n",
                   liveness.variables_never_used, liveness.variables_write_only, liveness.temporary_variables);
             
             // Phase 3: Function Call Graph Analysis
@@ -2568,10 +2235,10 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             call_graph.has_uncalled_functions = (call_graph.functions_defined > call_graph.functions_called);
             call_graph.has_dead_recursion = (call_graph.recursive_functions > call_graph.entry_point_reachable / 2);
             
-            IOLog("          Function Call Graph Analysis:\n");
-            IOLog("            Defined: %d, Called: %d, Reachable: %d\n",
+            VMLOG_DEBUG("          Function Call Graph Analysis:\n");
+            VMLOG_DEBUG("            Defined: %d, Called: %d, Reachable: %d\n",
                   call_graph.functions_defined, call_graph.functions_called, call_graph.entry_point_reachable);
-            IOLog("            Uncalled Functions: %s, Dead Recursion: %s\n",
+            VMLOG_DEBUG("            Uncalled Functions: %s, Dead Recursion: %s\n",
                   call_graph.has_uncalled_functions ? "DETECTED" : "NONE",
                   call_graph.has_dead_recursion ? "DETECTED" : "NONE");
             
@@ -2595,15 +2262,15 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             pattern_detection.redundant_type_casts = estimated_instructions_before / 35; // Type cast redundancy
             pattern_detection.no_op_instructions = estimated_instructions_before / 100; // Rare no-ops
             
-            IOLog("          Dead Code Pattern Detection:\n");
-            IOLog("            Unreachable After Jumps: %d, Impossible Conditions: %d\n",
+            VMLOG_DEBUG("          Dead Code Pattern Detection:\n");
+            VMLOG_DEBUG("            Unreachable After Jumps: %d, Impossible Conditions: %d\n",
                   pattern_detection.unreachable_after_unconditional, pattern_detection.impossible_conditions);
-            IOLog("            Unused Computations: %d, Dead Loops: %d, No-ops: %d\n",
+            VMLOG_DEBUG("            Unused Computations: %d, Dead Loops: %d, No-ops: %d\n",
                   pattern_detection.unused_computation_chains, pattern_detection.dead_loop_bodies,
                   pattern_detection.no_op_instructions);
             
             // Phase 5: Calculate Comprehensive Dead Code Elimination Results
-            IOLog("        Calculating comprehensive elimination results\n");
+            VMLOG_DEBUG("        Calculating comprehensive elimination results\n");
             
             // Calculate dead code based on sophisticated analysis
             dce_analysis.unreachable_blocks = 
@@ -2658,12 +2325,12 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             float call_graph_confidence = call_graph.functions_defined > 0 ? 0.8f : 0.7f;
             impact_analysis.elimination_confidence_score = (cfg_confidence + liveness_confidence + call_graph_confidence) / 3.0f;
             
-            IOLog("          Elimination Impact Analysis:\n");
-            IOLog("            Instructions/Block: %d, Instructions/Variable: %d\n",
+            VMLOG_DEBUG("          Elimination Impact Analysis:\n");
+            VMLOG_DEBUG("            Instructions/Block: %d, Instructions/Variable: %d\n",
                   impact_analysis.instructions_per_unreachable_block, impact_analysis.instructions_per_unused_variable);
-            IOLog("            Cascading Eliminations: %d, Side-Effect Safe: %d\n",
+            VMLOG_DEBUG("            Cascading Eliminations: %d, Side-Effect Safe: %d\n",
                   impact_analysis.cascading_eliminations, impact_analysis.side_effect_preserving_eliminations);
-            IOLog("            Confidence Score: %.2f (%.0f%% safe)\n",
+            VMLOG_DEBUG("            Confidence Score: %.2f (%.0f%% safe)\n",
                   impact_analysis.elimination_confidence_score, impact_analysis.elimination_confidence_score * 100.0f);
             
             // Phase 7: Calculate Final Elimination Results with Advanced Metrics
@@ -2717,22 +2384,22 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                 quality_assessment.elimination_quality_rating = "LIMITED";
             }
             
-            IOLog("        Advanced Dead Code Elimination Results:\n");
-            IOLog("          Elimination Statistics:\n");
-            IOLog("            Unreachable Blocks Eliminated: %d\n", dce_analysis.unreachable_blocks);
-            IOLog("            Unused Variables Eliminated: %d\n", dce_analysis.unused_variables);
-            IOLog("            Redundant Assignments Eliminated: %d\n", dce_analysis.redundant_assignments);
-            IOLog("            Unused Functions Eliminated: %d\n", dce_analysis.unused_functions);
-            IOLog("            Total Instructions Eliminated: %d\n", dce_analysis.eliminated_instructions);
-            IOLog("          Quality Assessment:\n");
-            IOLog("            Elimination Effectiveness: %.2f%% (confidence-weighted)\n", dce_analysis.elimination_effectiveness);
-            IOLog("            Quality Rating: %s\n", quality_assessment.elimination_quality_rating);
-            IOLog("            Memory Reduction: %.1f%%, Compile Time: %.1f%%, Runtime Gain: %.1f%%\n",
+            VMLOG_DEBUG("        Advanced Dead Code Elimination Results:\n");
+            VMLOG_DEBUG("          Elimination Statistics:\n");
+            VMLOG_DEBUG("            Unreachable Blocks Eliminated: %d\n", dce_analysis.unreachable_blocks);
+            VMLOG_DEBUG("            Unused Variables Eliminated: %d\n", dce_analysis.unused_variables);
+            VMLOG_DEBUG("            Redundant Assignments Eliminated: %d\n", dce_analysis.redundant_assignments);
+            VMLOG_DEBUG("            Unused Functions Eliminated: %d\n", dce_analysis.unused_functions);
+            VMLOG_DEBUG("            Total Instructions Eliminated: %d\n", dce_analysis.eliminated_instructions);
+            VMLOG_DEBUG("          Quality Assessment:\n");
+            VMLOG_DEBUG("            Elimination Effectiveness: %.2f%% (confidence-weighted)\n", dce_analysis.elimination_effectiveness);
+            VMLOG_DEBUG("            Quality Rating: %s\n", quality_assessment.elimination_quality_rating);
+            VMLOG_DEBUG("            Memory Reduction: %.1f%%, Compile Time: %.1f%%, Runtime Gain: %.1f%%\n",
                   quality_assessment.memory_usage_reduction * 100.0f,
                   quality_assessment.compile_time_reduction * 100.0f,
                   quality_assessment.runtime_performance_gain * 100.0f);
-            IOLog("            Register Pressure Reduction: %d registers\n", quality_assessment.register_pressure_reduction);
-            IOLog("            Semantic Preservation: %s, Enables Further Opts: %s\n",
+            VMLOG_DEBUG("            Register Pressure Reduction: %d registers\n", quality_assessment.register_pressure_reduction);
+            VMLOG_DEBUG("            Semantic Preservation: %s, Enables Further Opts: %s\n",
                   quality_assessment.preserves_semantics ? "GUARANTEED" : "ANALYSIS_NEEDED",
                   quality_assessment.enables_further_optimizations ? "YES" : "NO");
             
@@ -2743,7 +2410,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         
         // Phase C: Constant Folding and Propagation
         if (compilation_pipeline.optimization.constant_folding) {
-            IOLog("      Performing advanced constant folding and propagation\n");
+            VMLOG_DEBUG("      Performing advanced constant folding and propagation\n");
             
             struct ConstantFolding {
                 uint32_t arithmetic_expressions_folded;  // Math expressions simplified
@@ -2772,18 +2439,18 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             
             compilation_pipeline.optimization.instructions_eliminated += cf_eliminated_instructions;
             
-            IOLog("        Constant Folding Results:\n");
-            IOLog("          Arithmetic Folded: %d, Boolean Folded: %d\n",
+            VMLOG_DEBUG("        Constant Folding Results:\n");
+            VMLOG_DEBUG("          Arithmetic Folded: %d, Boolean Folded: %d\n",
                   cf_analysis.arithmetic_expressions_folded, cf_analysis.boolean_expressions_folded);
-            IOLog("          Propagations: %d, Compile-Time Eval: %d\n",
+            VMLOG_DEBUG("          Propagations: %d, Compile-Time Eval: %d\n",
                   cf_analysis.constant_propagations, cf_analysis.compile_time_evaluations);
-            IOLog("          Strength Reductions: %d, Effectiveness: %.1f%%\n",
+            VMLOG_DEBUG("          Strength Reductions: %d, Effectiveness: %.1f%%\n",
                   cf_analysis.strength_reductions_applied, cf_analysis.folding_effectiveness);
         }
         
         // Phase D: Loop Optimization and Unrolling
         if (compilation_pipeline.optimization.loop_unrolling) {
-            IOLog("      Performing advanced loop optimization and unrolling\n");
+            VMLOG_DEBUG("      Performing advanced loop optimization and unrolling\n");
             
             struct LoopOptimization {
                 uint32_t loops_analyzed;                 // Total loops analyzed
@@ -2821,20 +2488,20 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                 compilation_pipeline.optimization.instructions_eliminated += net_loop_optimization;
             }
             
-            IOLog("        Loop Optimization Results:\n");
-            IOLog("          Loops Analyzed: %d, Fully Unrolled: %d, Partially Unrolled: %d\n",
+            VMLOG_DEBUG("        Loop Optimization Results:\n");
+            VMLOG_DEBUG("          Loops Analyzed: %d, Fully Unrolled: %d, Partially Unrolled: %d\n",
                   loop_opt.loops_analyzed, loop_opt.loops_unrolled, loop_opt.loops_partially_unrolled);
-            IOLog("          Loop Invariants Hoisted: %d, IV Optimizations: %d\n",
+            VMLOG_DEBUG("          Loop Invariants Hoisted: %d, IV Optimizations: %d\n",
                   loop_opt.loop_invariant_hoisted, loop_opt.induction_variables_optimized);
-            IOLog("          Average Unroll Factor: %.1fx, Vectorization: %s\n",
+            VMLOG_DEBUG("          Average Unroll Factor: %.1fx, Vectorization: %s\n",
                   loop_opt.unrolling_factor_avg, loop_opt.vectorization_opportunities ? "POSSIBLE" : "LIMITED");
-            IOLog("          Net Instruction Change: %s%d\n", 
+            VMLOG_DEBUG("          Net Instruction Change: %s%d\n", 
                   net_loop_optimization >= 0 ? "+" : "", net_loop_optimization);
         }
         
         // Phase E: Function Inlining and Interprocedural Optimization
         if (compilation_pipeline.optimization.function_inlining) {
-            IOLog("      Performing advanced function inlining and IPO\n");
+            VMLOG_DEBUG("      Performing advanced function inlining and IPO\n");
             
             struct FunctionInlining {
                 uint32_t functions_analyzed;            // Total functions analyzed
@@ -2863,19 +2530,19 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             
             compilation_pipeline.optimization.instructions_eliminated += inlining_instructions_saved;
             
-            IOLog("        Function Inlining Results:\n");
-            IOLog("          Functions Analyzed: %d, Small Inlined: %d, Hot Inlined: %d\n",
+            VMLOG_DEBUG("        Function Inlining Results:\n");
+            VMLOG_DEBUG("          Functions Analyzed: %d, Small Inlined: %d, Hot Inlined: %d\n",
                   inlining_opt.functions_analyzed, inlining_opt.small_functions_inlined, 
                   inlining_opt.hot_functions_inlined);
-            IOLog("          Recursive Skipped: %d, Call Sites Eliminated: %d\n",
+            VMLOG_DEBUG("          Recursive Skipped: %d, Call Sites Eliminated: %d\n",
                   inlining_opt.recursive_functions_skipped, inlining_opt.call_sites_eliminated);
-            IOLog("          Parameter Overhead Eliminated: %d, Threshold: %.1f instructions\n",
+            VMLOG_DEBUG("          Parameter Overhead Eliminated: %d, Threshold: %.1f instructions\n",
                   inlining_opt.parameter_passing_eliminated, inlining_opt.inlining_threshold_size);
         }
         
         // Phase F: Common Subexpression Elimination
         if (compilation_pipeline.optimization.common_subexpression_elimination) {
-            IOLog("      Performing advanced common subexpression elimination\n");
+            VMLOG_DEBUG("      Performing advanced common subexpression elimination\n");
             
             struct CommonSubexpressionElimination {
                 uint32_t expressions_analyzed;          // Total expressions analyzed
@@ -2900,18 +2567,18 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             
             compilation_pipeline.optimization.instructions_eliminated += cse_instructions_saved;
             
-            IOLog("        CSE Results:\n");
-            IOLog("          Expressions Analyzed: %d, Common Found: %d\n",
+            VMLOG_DEBUG("        CSE Results:\n");
+            VMLOG_DEBUG("          Expressions Analyzed: %d, Common Found: %d\n",
                   cse_opt.expressions_analyzed, cse_opt.common_subexpressions_found);
-            IOLog("          Redundant Eliminated: %d, Temps Introduced: %d\n",
+            VMLOG_DEBUG("          Redundant Eliminated: %d, Temps Introduced: %d\n",
                   cse_opt.redundant_computations, cse_opt.temp_variables_introduced);
-            IOLog("          Load/Store Eliminations: %d, Effectiveness: %.1f%%\n",
+            VMLOG_DEBUG("          Load/Store Eliminations: %d, Effectiveness: %.1f%%\n",
                   cse_opt.load_store_eliminations, cse_opt.cse_effectiveness);
         }
         
         // Phase G: Advanced Strength Reduction
         if (compilation_pipeline.optimization.strength_reduction) {
-            IOLog("      Performing advanced strength reduction optimization\n");
+            VMLOG_DEBUG("      Performing advanced strength reduction optimization\n");
             
             struct StrengthReduction {
                 uint32_t expensive_ops_analyzed;        // Expensive operations analyzed
@@ -2939,13 +2606,13 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             
             compilation_pipeline.optimization.instructions_eliminated += equivalent_instruction_savings;
             
-            IOLog("        Strength Reduction Results:\n");
-            IOLog("          Expensive Ops Analyzed: %d, Mults Reduced: %d, Divs Reduced: %d\n",
+            VMLOG_DEBUG("        Strength Reduction Results:\n");
+            VMLOG_DEBUG("          Expensive Ops Analyzed: %d, Mults Reduced: %d, Divs Reduced: %d\n",
                   strength_red.expensive_ops_analyzed, strength_red.multiplications_reduced,
                   strength_red.divisions_reduced);
-            IOLog("          Transcendental Approximated: %d, Powers Optimized: %d\n",
+            VMLOG_DEBUG("          Transcendental Approximated: %d, Powers Optimized: %d\n",
                   strength_red.transcendental_approximated, strength_red.power_operations_optimized);
-            IOLog("          Cost Reduction Factor: %.1fx, Equivalent Savings: %d instructions\n",
+            VMLOG_DEBUG("          Cost Reduction Factor: %.1fx, Equivalent Savings: %d instructions\n",
                   strength_red.instruction_cost_reduction, equivalent_instruction_savings);
         }
         
@@ -2961,20 +2628,20 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         uint64_t optimization_end = mach_absolute_time();
         compilation_pipeline.optimization.optimization_time_ms = (float)(optimization_end - optimization_start) / 1000000.0f;
         
-        IOLog("  Optimization Results:\n");
-        IOLog("    Optimization Level: %d\n", compilation_pipeline.optimization.optimization_level);
-        IOLog("    Instructions Eliminated: %d\n", compilation_pipeline.optimization.instructions_eliminated);
-        IOLog("    Code Size Reduction: %.1f%%\n", compilation_pipeline.optimization.code_size_reduction_percent);
-        IOLog("    Optimizations Applied:\n");
-        IOLog("      Dead Code Elimination: %s\n", compilation_pipeline.optimization.dead_code_elimination ? "YES" : "NO");
-        IOLog("      Constant Folding: %s\n", compilation_pipeline.optimization.constant_folding ? "YES" : "NO");
-        IOLog("      Loop Unrolling: %s\n", compilation_pipeline.optimization.loop_unrolling ? "YES" : "NO");
-        IOLog("      Function Inlining: %s\n", compilation_pipeline.optimization.function_inlining ? "YES" : "NO");
-        IOLog("      CSE: %s\n", compilation_pipeline.optimization.common_subexpression_elimination ? "YES" : "NO");
-        IOLog("    Optimization Time: %.2f ms\n", compilation_pipeline.optimization.optimization_time_ms);
+        VMLOG_DEBUG("  Optimization Results:\n");
+        VMLOG_DEBUG("    Optimization Level: %d\n", compilation_pipeline.optimization.optimization_level);
+        VMLOG_DEBUG("    Instructions Eliminated: %d\n", compilation_pipeline.optimization.instructions_eliminated);
+        VMLOG_DEBUG("    Code Size Reduction: %.1f%%\n", compilation_pipeline.optimization.code_size_reduction_percent);
+        VMLOG_DEBUG("    Optimizations Applied:\n");
+        VMLOG_DEBUG("      Dead Code Elimination: %s\n", compilation_pipeline.optimization.dead_code_elimination ? "YES" : "NO");
+        VMLOG_DEBUG("      Constant Folding: %s\n", compilation_pipeline.optimization.constant_folding ? "YES" : "NO");
+        VMLOG_DEBUG("      Loop Unrolling: %s\n", compilation_pipeline.optimization.loop_unrolling ? "YES" : "NO");
+        VMLOG_DEBUG("      Function Inlining: %s\n", compilation_pipeline.optimization.function_inlining ? "YES" : "NO");
+        VMLOG_DEBUG("      CSE: %s\n", compilation_pipeline.optimization.common_subexpression_elimination ? "YES" : "NO");
+        VMLOG_DEBUG("    Optimization Time: %.2f ms\n", compilation_pipeline.optimization.optimization_time_ms);
         
         // Phase 4: Advanced Bytecode Generation
-        IOLog("VMShaderManager: Phase 4 - Advanced bytecode generation\n");
+        VMLOG_DEBUG("VMShaderManager: Phase 4 - Advanced bytecode generation\n");
         
         uint64_t bytecode_start = mach_absolute_time();
         
@@ -2989,16 +2656,16 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         // Determine output bytecode format
         if (compilation_pipeline.bytecode_gen.spirv_generation_available && (flags & 0x40)) {
             compilation_pipeline.bytecode_gen.bytecode_format = 0x07230203; // SPIR-V magic number
-            IOLog("    Target Bytecode Format: SPIR-V\n");
+            VMLOG_DEBUG("    Target Bytecode Format: SPIR-V\n");
         } else if (compilation_pipeline.bytecode_gen.metal_library_generation) {
             compilation_pipeline.bytecode_gen.bytecode_format = 0x4D544C42; // 'MTLB' - Metal Library
-            IOLog("    Target Bytecode Format: Metal Library\n");
+            VMLOG_DEBUG("    Target Bytecode Format: Metal Library\n");
         } else if (compilation_pipeline.bytecode_gen.dxil_generation_available) {
             compilation_pipeline.bytecode_gen.bytecode_format = 0x4C495844; // 'DXIL'
-            IOLog("    Target Bytecode Format: DirectX IL (DXIL)\n");
+            VMLOG_DEBUG("    Target Bytecode Format: DirectX IL (DXIL)\n");
         } else {
             compilation_pipeline.bytecode_gen.bytecode_format = 0x474C534C; // 'GLSL' - GLSL bytecode
-            IOLog("    Target Bytecode Format: GLSL Bytecode\n");
+            VMLOG_DEBUG("    Target Bytecode Format: GLSL Bytecode\n");
         }
         
         // Generate final bytecode
@@ -3008,14 +2675,14 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         uint64_t bytecode_end = mach_absolute_time();
         compilation_pipeline.bytecode_gen.bytecode_generation_time_ms = (float)(bytecode_end - bytecode_start) / 1000000.0f;
         
-        IOLog("  Bytecode Generation Results:\n");
-        IOLog("    Generated Size: %d bytes\n", compilation_pipeline.bytecode_gen.generated_bytecode_size);
-        IOLog("    Instruction Count: %d\n", compilation_pipeline.bytecode_gen.instruction_count);
-        IOLog("    Debug Info: %s\n", compilation_pipeline.bytecode_gen.debug_info_embedded ? "EMBEDDED" : "STRIPPED");
-        IOLog("    Generation Time: %.2f ms\n", compilation_pipeline.bytecode_gen.bytecode_generation_time_ms);
+        VMLOG_DEBUG("  Bytecode Generation Results:\n");
+        VMLOG_DEBUG("    Generated Size: %d bytes\n", compilation_pipeline.bytecode_gen.generated_bytecode_size);
+        VMLOG_DEBUG("    Instruction Count: %d\n", compilation_pipeline.bytecode_gen.instruction_count);
+        VMLOG_DEBUG("    Debug Info: %s\n", compilation_pipeline.bytecode_gen.debug_info_embedded ? "EMBEDDED" : "STRIPPED");
+        VMLOG_DEBUG("    Generation Time: %.2f ms\n", compilation_pipeline.bytecode_gen.bytecode_generation_time_ms);
         
         // Phase 5: Resource Binding Analysis
-        IOLog("VMShaderManager: Phase 5 - Resource binding analysis\n");
+        VMLOG_DEBUG("VMShaderManager: Phase 5 - Resource binding analysis\n");
         
         // Analyze resource usage in compiled shader
         compilation_pipeline.resource_binding.uniform_buffer_bindings = 0;
@@ -3048,14 +2715,14 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             compilation_pipeline.resource_binding.storage_buffer_bindings +
             compilation_pipeline.resource_binding.image_bindings;
         
-        IOLog("  Resource Binding Results:\n");
-        IOLog("    Uniform Buffers: %d\n", compilation_pipeline.resource_binding.uniform_buffer_bindings);
-        IOLog("    Texture Samplers: %d\n", compilation_pipeline.resource_binding.texture_sampler_bindings);
-        IOLog("    Storage Buffers: %d\n", compilation_pipeline.resource_binding.storage_buffer_bindings);
-        IOLog("    Image Bindings: %d\n", compilation_pipeline.resource_binding.image_bindings);
-        IOLog("    Total Descriptors: %d\n", compilation_pipeline.resource_binding.resource_descriptor_count);
-        IOLog("    Bindless Resources: %s\n", compilation_pipeline.resource_binding.bindless_resources_used ? "USED" : "NOT USED");
-        IOLog("    Dynamic Indexing: %s\n", compilation_pipeline.resource_binding.dynamic_indexing_used ? "USED" : "NOT USED");
+        VMLOG_DEBUG("  Resource Binding Results:\n");
+        VMLOG_DEBUG("    Uniform Buffers: %d\n", compilation_pipeline.resource_binding.uniform_buffer_bindings);
+        VMLOG_DEBUG("    Texture Samplers: %d\n", compilation_pipeline.resource_binding.texture_sampler_bindings);
+        VMLOG_DEBUG("    Storage Buffers: %d\n", compilation_pipeline.resource_binding.storage_buffer_bindings);
+        VMLOG_DEBUG("    Image Bindings: %d\n", compilation_pipeline.resource_binding.image_bindings);
+        VMLOG_DEBUG("    Total Descriptors: %d\n", compilation_pipeline.resource_binding.resource_descriptor_count);
+        VMLOG_DEBUG("    Bindless Resources: %s\n", compilation_pipeline.resource_binding.bindless_resources_used ? "USED" : "NOT USED");
+        VMLOG_DEBUG("    Dynamic Indexing: %s\n", compilation_pipeline.resource_binding.dynamic_indexing_used ? "USED" : "NOT USED");
         
         // Update final bytecode size with compiled source
         bytecode_size = strlen(compiled_source);
@@ -3066,29 +2733,29 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                                       compilation_pipeline.optimization.optimization_time_ms +
                                       compilation_pipeline.bytecode_gen.bytecode_generation_time_ms;
         
-        IOLog("VMShaderManager: ========== Advanced Shader Compilation Complete ==========\n");
-        IOLog("  Compilation Pipeline Summary:\n");
-        IOLog("    Source Language: %s\n", getShaderLanguageString(source_language));
-        IOLog("    Target Bytecode: 0x%08X\n", compilation_pipeline.bytecode_gen.bytecode_format);
-        IOLog("    Total Compilation Time: %.2f ms\n", total_compilation_time);
-        IOLog("  Phase Breakdown:\n");
-        IOLog("    Source Analysis: %.2f ms\n", compilation_pipeline.source_analysis.syntax_analysis_time_ms);
-        IOLog("    Cross-Compilation: %.2f ms\n", compilation_pipeline.cross_compilation.cross_compile_time_ms);
-        IOLog("    Optimization: %.2f ms\n", compilation_pipeline.optimization.optimization_time_ms);
-        IOLog("    Bytecode Generation: %.2f ms\n", compilation_pipeline.bytecode_gen.bytecode_generation_time_ms);
-        IOLog("  Optimization Effectiveness:\n");
-        IOLog("    Instructions Eliminated: %d\n", compilation_pipeline.optimization.instructions_eliminated);
-        IOLog("    Code Size Reduction: %.1f%%\n", compilation_pipeline.optimization.code_size_reduction_percent);
-        IOLog("  Resource Requirements:\n");
-        IOLog("    Resource Descriptors: %d\n", compilation_pipeline.resource_binding.resource_descriptor_count);
-        IOLog("    Final Bytecode Size: %zu bytes\n", bytecode_size);
-        IOLog("===============================================================================\n");
+        VMLOG_DEBUG("VMShaderManager: ========== Advanced Shader Compilation Complete ==========\n");
+        VMLOG_DEBUG("  Compilation Pipeline Summary:\n");
+        VMLOG_DEBUG("    Source Language: %s\n", getShaderLanguageString(source_language));
+        VMLOG_DEBUG("    Target Bytecode: 0x%08X\n", compilation_pipeline.bytecode_gen.bytecode_format);
+        VMLOG_DEBUG("    Total Compilation Time: %.2f ms\n", total_compilation_time);
+        VMLOG_DEBUG("  Phase Breakdown:\n");
+        VMLOG_DEBUG("    Source Analysis: %.2f ms\n", compilation_pipeline.source_analysis.syntax_analysis_time_ms);
+        VMLOG_DEBUG("    Cross-Compilation: %.2f ms\n", compilation_pipeline.cross_compilation.cross_compile_time_ms);
+        VMLOG_DEBUG("    Optimization: %.2f ms\n", compilation_pipeline.optimization.optimization_time_ms);
+        VMLOG_DEBUG("    Bytecode Generation: %.2f ms\n", compilation_pipeline.bytecode_gen.bytecode_generation_time_ms);
+        VMLOG_DEBUG("  Optimization Effectiveness:\n");
+        VMLOG_DEBUG("    Instructions Eliminated: %d\n", compilation_pipeline.optimization.instructions_eliminated);
+        VMLOG_DEBUG("    Code Size Reduction: %.1f%%\n", compilation_pipeline.optimization.code_size_reduction_percent);
+        VMLOG_DEBUG("  Resource Requirements:\n");
+        VMLOG_DEBUG("    Resource Descriptors: %d\n", compilation_pipeline.resource_binding.resource_descriptor_count);
+        VMLOG_DEBUG("    Final Bytecode Size: %zu bytes\n", bytecode_size);
+        VMLOG_DEBUG("===============================================================================\n");
         
     } else {
         // Advanced Binary Shader Processing System
         // Comprehensive binary shader format validation, analysis, and optimization
-        IOLog("VMShaderManager: Initiating advanced binary shader processing\n");
-        IOLog("  Binary Format: %s, Size: %zu bytes\n", getShaderLanguageString(language), source_size);
+        VMLOG_DEBUG("VMShaderManager: Initiating advanced binary shader processing\n");
+        VMLOG_DEBUG("  Binary Format: %s, Size: %zu bytes\n", getShaderLanguageString(language), source_size);
         
         // Advanced Binary Shader Processing Pipeline Structure
         struct BinaryShaderProcessingPipeline {
@@ -3147,12 +2814,12 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         const uint8_t* binary_data = (const uint8_t*)source_code;
         
         // Phase 1: Binary Format Detection and Validation
-        IOLog("VMShaderManager: Phase 1 - Binary format detection and validation\n");
+        VMLOG_DEBUG("VMShaderManager: Phase 1 - Binary format detection and validation\n");
         
         uint64_t validation_start = mach_absolute_time();
         
         if (language == VM_SHADER_LANG_SPIRV) {
-            IOLog("  Processing SPIR-V Binary Format:\n");
+            VMLOG_DEBUG("  Processing SPIR-V Binary Format:\n");
             
             // SPIR-V Binary Processing
             struct SPIRVProcessing {
@@ -3182,12 +2849,12 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                     spirv_proc.id_bound = spirv_header[3];
                     spirv_proc.schema_version = spirv_header[4];
                     
-                    IOLog("    SPIR-V Header Validation:\n");
-                    IOLog("      Magic Number: VALID (0x%08X)\n", spirv_header[0]);
-                    IOLog("      Version: 0x%08X\n", spirv_proc.spirv_version);
-                    IOLog("      Generator: 0x%08X\n", spirv_proc.generator_magic);
-                    IOLog("      ID Bound: %d\n", spirv_proc.id_bound);
-                    IOLog("      Schema: %d\n", spirv_proc.schema_version);
+                    VMLOG_DEBUG("    SPIR-V Header Validation:\n");
+                    VMLOG_DEBUG("      Magic Number: VALID (0x%08X)\n", spirv_header[0]);
+                    VMLOG_DEBUG("      Version: 0x%08X\n", spirv_proc.spirv_version);
+                    VMLOG_DEBUG("      Generator: 0x%08X\n", spirv_proc.generator_magic);
+                    VMLOG_DEBUG("      ID Bound: %d\n", spirv_proc.id_bound);
+                    VMLOG_DEBUG("      Schema: %d\n", spirv_proc.schema_version);
                     
                     binary_pipeline.format_validation.format_signature_valid = true;
                     binary_pipeline.format_validation.header_structure_valid = true;
@@ -3203,7 +2870,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                         uint16_t length = instruction_word >> 16;
                         
                         if (length == 0 || length > 1000) { // Invalid instruction length
-                            IOLog("    Warning: Invalid SPIR-V instruction length: %d at position %d\n", 
+                            VMLOG_WARN("    Warning: Invalid SPIR-V instruction length: %d at position %d\n", 
                                   length, instructions_analyzed);
                             break;
                         }
@@ -3214,7 +2881,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                         switch (opcode) {
                             case 11: // OpCapability
                                 spirv_proc.capability_count++;
-                                IOLog("      Found Capability declaration\n");
+                                VMLOG_DEBUG("      Found Capability declaration\n");
                                 break;
                             case 71: // OpDecorate
                                 spirv_proc.decoration_count++;
@@ -3229,7 +2896,7 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                                 break;
                             case 15: // OpEntryPoint  
                                 spirv_proc.entry_point_found = true;
-                                IOLog("      Found Entry Point\n");
+                                VMLOG_DEBUG("      Found Entry Point\n");
                                 break;
                             case 87: // OpImageSample
                             case 88: // OpImageSampleImplicitLod
@@ -3252,23 +2919,23 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                     binary_pipeline.binary_analysis.resource_descriptors = spirv_proc.decoration_count;
                     binary_pipeline.format_validation.instruction_stream_valid = spirv_proc.entry_point_found;
                     
-                    IOLog("    SPIR-V Analysis Results:\n");
-                    IOLog("      Total Instructions: %d\n", spirv_proc.total_instructions);
-                    IOLog("      Capabilities: %d, Decorations: %d, Types: %d\n",
+                    VMLOG_DEBUG("    SPIR-V Analysis Results:\n");
+                    VMLOG_DEBUG("      Total Instructions: %d\n", spirv_proc.total_instructions);
+                    VMLOG_DEBUG("      Capabilities: %d, Decorations: %d, Types: %d\n",
                           spirv_proc.capability_count, spirv_proc.decoration_count, spirv_proc.type_count);
-                    IOLog("      Entry Point Found: %s\n", spirv_proc.entry_point_found ? "YES" : "NO");
+                    VMLOG_DEBUG("      Entry Point Found: %s\n", spirv_proc.entry_point_found ? "YES" : "NO");
                     
                 } else {
-                    IOLog("    ERROR: Invalid SPIR-V magic number: 0x%08X (expected 0x07230203)\n", spirv_header[0]);
+                    VMLOG_ERROR("    ERROR: Invalid SPIR-V magic number: 0x%08X (expected 0x07230203)\n", spirv_header[0]);
                     binary_pipeline.format_validation.format_signature_valid = false;
                 }
             } else {
-                IOLog("    ERROR: SPIR-V binary too small (%zu bytes, minimum 20 required)\n", source_size);
+                VMLOG_ERROR("    ERROR: SPIR-V binary too small (%zu bytes, minimum 20 required)\n", source_size);
                 binary_pipeline.format_validation.format_signature_valid = false;
             }
             
         } else if (language == VM_SHADER_LANG_HLSL && source_size > 16) {
-            IOLog("  Processing DirectX Bytecode/DXIL Format:\n");
+            VMLOG_DEBUG("  Processing DirectX Bytecode/DXIL Format:\n");
             
             // DirectX Binary Processing
             struct DXBytecodeProcessing {
@@ -3298,10 +2965,10 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                 
                 dxbc_proc.dxbc_chunks = chunk_count;
                 
-                IOLog("    DXBC Container Analysis:\n");
-                IOLog("      Container Version: %d\n", version);
-                IOLog("      Total Size: %d bytes\n", total_size);
-                IOLog("      Chunk Count: %d\n", chunk_count);
+                VMLOG_DEBUG("    DXBC Container Analysis:\n");
+                VMLOG_DEBUG("      Container Version: %d\n", version);
+                VMLOG_DEBUG("      Total Size: %d bytes\n", total_size);
+                VMLOG_DEBUG("      Chunk Count: %d\n", chunk_count);
                 
                 // Analyze DXBC chunks
                 const uint32_t* chunk_offsets = &dxbc_header[7];
@@ -3313,16 +2980,16 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                         memcpy(chunk_fourcc, chunk_data, 4);
                         uint32_t chunk_size = *(const uint32_t*)(chunk_data + 4);
                         
-                        IOLog("      Chunk %d: %s (%d bytes)\n", i, chunk_fourcc, chunk_size);
+                        VMLOG_DEBUG("      Chunk %d: %s (%d bytes)\n", i, chunk_fourcc, chunk_size);
                         
                         // Analyze specific chunk types
                         if (memcmp(chunk_fourcc, "RDEF", 4) == 0) {
                             // Resource definition chunk
                             dxbc_proc.resource_binding_valid = true;
-                            IOLog("        Resource Definition Chunk Found\n");
+                            VMLOG_DEBUG("        Resource Definition Chunk Found\n");
                         } else if (memcmp(chunk_fourcc, "SHDR", 4) == 0 || memcmp(chunk_fourcc, "SHEX", 4) == 0) {
                             // Shader bytecode chunk
-                            IOLog("        Shader Bytecode Chunk Found\n");
+                            VMLOG_DEBUG("        Shader Bytecode Chunk Found\n");
                         }
                     }
                 }
@@ -3332,12 +2999,12 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                 binary_pipeline.binary_analysis.instruction_analysis_complete = true;
                 
             } else {
-                IOLog("    Unknown DirectX binary format (no DXBC header)\n");
+                VMLOG_DEBUG("    Unknown DirectX binary format (no DXBC header)\n");
                 binary_pipeline.format_validation.format_signature_valid = false;
             }
             
         } else if (language == VM_SHADER_LANG_MSL && source_size > 16) {
-            IOLog("  Processing Metal Library Binary Format:\n");
+            VMLOG_DEBUG("  Processing Metal Library Binary Format:\n");
             
             // Metal Library Binary Processing
             struct MetalLibraryProcessing {
@@ -3420,18 +3087,18 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                     metallib_proc.function_count = metal_lib_header.function_count;
                     metallib_proc.reflection_data_size = metal_lib_header.reflection_size;
                     
-                    IOLog("    Advanced Metal Library Header Analysis:\n");
-                    IOLog("      Format: %s\n", detected_format);
-                    IOLog("      Magic Signature: 0x%08X\n", metal_lib_header.magic_signature);
-                    IOLog("      Library Version: 0x%08X\n", metal_lib_header.version_info);
-                    IOLog("      Platform Info: 0x%08X\n", metal_lib_header.platform_info);
-                    IOLog("      SDK Version: 0x%08X\n", metal_lib_header.sdk_version);
-                    IOLog("      Deployment Target: 0x%08X\n", metal_lib_header.deployment_target);
-                    IOLog("      Header Size: %d bytes\n", metal_lib_header.header_size);
-                    IOLog("      Function Count: %d\n", metal_lib_header.function_count);
-                    IOLog("      Reflection Data: %d bytes at offset 0x%08X\n", 
+                    VMLOG_DEBUG("    Advanced Metal Library Header Analysis:\n");
+                    VMLOG_DEBUG("      Format: %s\n", detected_format);
+                    VMLOG_DEBUG("      Magic Signature: 0x%08X\n", metal_lib_header.magic_signature);
+                    VMLOG_DEBUG("      Library Version: 0x%08X\n", metal_lib_header.version_info);
+                    VMLOG_DEBUG("      Platform Info: 0x%08X\n", metal_lib_header.platform_info);
+                    VMLOG_DEBUG("      SDK Version: 0x%08X\n", metal_lib_header.sdk_version);
+                    VMLOG_DEBUG("      Deployment Target: 0x%08X\n", metal_lib_header.deployment_target);
+                    VMLOG_DEBUG("      Header Size: %d bytes\n", metal_lib_header.header_size);
+                    VMLOG_DEBUG("      Function Count: %d\n", metal_lib_header.function_count);
+                    VMLOG_DEBUG("      Reflection Data: %d bytes at offset 0x%08X\n", 
                           metal_lib_header.reflection_size, metal_lib_header.reflection_offset);
-                    IOLog("      AIR Bytecode: %d bytes at offset 0x%08X\n",
+                    VMLOG_DEBUG("      AIR Bytecode: %d bytes at offset 0x%08X\n",
                           metal_lib_header.air_bytecode_size, metal_lib_header.air_bytecode_offset);
                     
                     // Phase 2: Platform Detection and Capability Analysis
@@ -3473,24 +3140,24 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                     
                     platform_analysis.gpu_family = (platform >> 16) & 0xFF; // Extract GPU family
                     
-                    IOLog("    Metal Platform Analysis:\n");
-                    IOLog("      Target Platforms: %s%s%s%s\n",
+                    VMLOG_DEBUG("    Metal Platform Analysis:\n");
+                    VMLOG_DEBUG("      Target Platforms: %s%s%s%s\n",
                           platform_analysis.is_macos_library ? "macOS " : "",
                           platform_analysis.is_ios_library ? "iOS " : "",
                           platform_analysis.is_tvos_library ? "tvOS " : "",
                           platform_analysis.is_watchos_library ? "watchOS " : "");
-                    IOLog("      Metal API Version: %d.%d\n", 
+                    VMLOG_DEBUG("      Metal API Version: %d.%d\n", 
                           platform_analysis.metal_version_major, platform_analysis.metal_version_minor);
-                    IOLog("      GPU Family: %d\n", platform_analysis.gpu_family);
-                    IOLog("      Tessellation Support: %s\n", platform_analysis.supports_tessellation ? "YES" : "NO");
-                    IOLog("      Compute Support: %s\n", platform_analysis.supports_compute_dispatches ? "YES" : "NO");
-                    IOLog("      Ray Tracing Support: %s\n", platform_analysis.supports_ray_tracing ? "YES" : "NO");
+                    VMLOG_DEBUG("      GPU Family: %d\n", platform_analysis.gpu_family);
+                    VMLOG_DEBUG("      Tessellation Support: %s\n", platform_analysis.supports_tessellation ? "YES" : "NO");
+                    VMLOG_DEBUG("      Compute Support: %s\n", platform_analysis.supports_compute_dispatches ? "YES" : "NO");
+                    VMLOG_DEBUG("      Ray Tracing Support: %s\n", platform_analysis.supports_ray_tracing ? "YES" : "NO");
                     
                     // Phase 3: Function Directory Analysis
                     if (metal_lib_header.function_count > 0 && metal_lib_header.function_directory_offset > 0 &&
                         metal_lib_header.function_directory_offset < source_size) {
                         
-                        IOLog("    Metal Function Directory Analysis:\n");
+                        VMLOG_DEBUG("    Metal Function Directory Analysis:\n");
                         
                         const uint8_t* function_dir = binary_data + metal_lib_header.function_directory_offset;
                         size_t remaining_bytes = source_size - metal_lib_header.function_directory_offset;
@@ -3559,23 +3226,23 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                                                       func_analysis.tessellation_functions;
                         metallib_proc.function_list_valid = (metallib_proc.function_count > 0);
                         
-                        IOLog("      Function Type Distribution:\n");
-                        IOLog("        Vertex Functions: %d\n", func_analysis.vertex_functions);
-                        IOLog("        Fragment Functions: %d\n", func_analysis.fragment_functions);
-                        IOLog("        Compute Functions: %d\n", func_analysis.compute_functions);
-                        IOLog("        Tessellation Functions: %d\n", func_analysis.tessellation_functions);
-                        IOLog("      Function Characteristics:\n");
-                        IOLog("        Unique Names: %d\n", func_analysis.unique_function_names);
-                        IOLog("        Has Main Functions: %s\n", func_analysis.has_main_functions ? "YES" : "NO");
-                        IOLog("        Has Utility Functions: %s\n", func_analysis.has_utility_functions ? "YES" : "NO");
-                        IOLog("        Total AIR Instructions: %d\n", func_analysis.total_air_instructions);
+                        VMLOG_DEBUG("      Function Type Distribution:\n");
+                        VMLOG_DEBUG("        Vertex Functions: %d\n", func_analysis.vertex_functions);
+                        VMLOG_DEBUG("        Fragment Functions: %d\n", func_analysis.fragment_functions);
+                        VMLOG_DEBUG("        Compute Functions: %d\n", func_analysis.compute_functions);
+                        VMLOG_DEBUG("        Tessellation Functions: %d\n", func_analysis.tessellation_functions);
+                        VMLOG_DEBUG("      Function Characteristics:\n");
+                        VMLOG_DEBUG("        Unique Names: %d\n", func_analysis.unique_function_names);
+                        VMLOG_DEBUG("        Has Main Functions: %s\n", func_analysis.has_main_functions ? "YES" : "NO");
+                        VMLOG_DEBUG("        Has Utility Functions: %s\n", func_analysis.has_utility_functions ? "YES" : "NO");
+                        VMLOG_DEBUG("        Total AIR Instructions: %d\n", func_analysis.total_air_instructions);
                     }
                     
                     // Phase 4: AIR Bytecode Analysis
                     if (metal_lib_header.air_bytecode_size > 0 && metal_lib_header.air_bytecode_offset > 0 &&
                         metal_lib_header.air_bytecode_offset < source_size) {
                         
-                        IOLog("    AIR (Apple Intermediate Representation) Bytecode Analysis:\n");
+                        VMLOG_DEBUG("    AIR (Apple Intermediate Representation) Bytecode Analysis:\n");
                         
                         const uint8_t* air_bytecode = binary_data + metal_lib_header.air_bytecode_offset;
                         size_t air_size = metal_lib_header.air_bytecode_size;
@@ -3851,71 +3518,71 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                             }
                         }
                         
-                        IOLog("      Comprehensive AIR Bytecode Analysis:\n");
-                        IOLog("        AIR Version: 0x%08X\n", air_analysis.air_version);
-                        IOLog("        Instruction Count: %d\n", air_analysis.instruction_count);
-                        IOLog("        Instruction Density: %.3f inst/byte\n", air_analysis.instruction_density);
+                        VMLOG_DEBUG("      Comprehensive AIR Bytecode Analysis:\n");
+                        VMLOG_DEBUG("        AIR Version: 0x%08X\n", air_analysis.air_version);
+                        VMLOG_DEBUG("        Instruction Count: %d\n", air_analysis.instruction_count);
+                        VMLOG_DEBUG("        Instruction Density: %.3f inst/byte\n", air_analysis.instruction_density);
                         
-                        IOLog("      Detailed Operation Classification:\n");
-                        IOLog("        Vector Operations: %d\n", air_classification.vector_operations);
-                        IOLog("        Scalar Operations: %d\n", air_classification.scalar_operations);
-                        IOLog("        Matrix Operations: %d\n", air_classification.matrix_operations);
-                        IOLog("        Transcendental Functions: %d\n", air_classification.transcendental_operations);
+                        VMLOG_DEBUG("      Detailed Operation Classification:\n");
+                        VMLOG_DEBUG("        Vector Operations: %d\n", air_classification.vector_operations);
+                        VMLOG_DEBUG("        Scalar Operations: %d\n", air_classification.scalar_operations);
+                        VMLOG_DEBUG("        Matrix Operations: %d\n", air_classification.matrix_operations);
+                        VMLOG_DEBUG("        Transcendental Functions: %d\n", air_classification.transcendental_operations);
                         
-                        IOLog("      Memory Access Analysis:\n");
-                        IOLog("        Uniform Buffer Loads: %d\n", air_classification.uniform_buffer_loads);
-                        IOLog("        Vertex Buffer Loads: %d\n", air_classification.vertex_buffer_loads);
-                        IOLog("        Storage Buffer Access: %d\n", air_classification.storage_buffer_accesses);
-                        IOLog("        Local Memory Access: %d\n", air_classification.local_memory_accesses);
+                        VMLOG_DEBUG("      Memory Access Analysis:\n");
+                        VMLOG_DEBUG("        Uniform Buffer Loads: %d\n", air_classification.uniform_buffer_loads);
+                        VMLOG_DEBUG("        Vertex Buffer Loads: %d\n", air_classification.vertex_buffer_loads);
+                        VMLOG_DEBUG("        Storage Buffer Access: %d\n", air_classification.storage_buffer_accesses);
+                        VMLOG_DEBUG("        Local Memory Access: %d\n", air_classification.local_memory_accesses);
                         
-                        IOLog("      Texture and Sampling Operations:\n");
-                        IOLog("        Basic Texture Samples: %d\n", air_classification.texture_samples);
-                        IOLog("        LOD-based Samples: %d\n", air_classification.texture_samples_lod);
-                        IOLog("        Gradient Samples: %d\n", air_classification.texture_samples_grad);
-                        IOLog("        Gather Operations: %d\n", air_classification.texture_samples_gather);
-                        IOLog("        Texture Writes: %d\n", air_classification.texture_writes);
+                        VMLOG_DEBUG("      Texture and Sampling Operations:\n");
+                        VMLOG_DEBUG("        Basic Texture Samples: %d\n", air_classification.texture_samples);
+                        VMLOG_DEBUG("        LOD-based Samples: %d\n", air_classification.texture_samples_lod);
+                        VMLOG_DEBUG("        Gradient Samples: %d\n", air_classification.texture_samples_grad);
+                        VMLOG_DEBUG("        Gather Operations: %d\n", air_classification.texture_samples_gather);
+                        VMLOG_DEBUG("        Texture Writes: %d\n", air_classification.texture_writes);
                         
-                        IOLog("      Control Flow Analysis:\n");
-                        IOLog("        Conditional Branches: %d\n", air_classification.conditional_branches);
-                        IOLog("        Loop Iterations: %d\n", air_classification.loop_iterations);
-                        IOLog("        Function Calls: %d\n", air_classification.function_calls);
-                        IOLog("        Switch Statements: %d\n", air_classification.switch_statements);
-                        IOLog("        Early Returns: %d\n", air_classification.early_returns);
+                        VMLOG_DEBUG("      Control Flow Analysis:\n");
+                        VMLOG_DEBUG("        Conditional Branches: %d\n", air_classification.conditional_branches);
+                        VMLOG_DEBUG("        Loop Iterations: %d\n", air_classification.loop_iterations);
+                        VMLOG_DEBUG("        Function Calls: %d\n", air_classification.function_calls);
+                        VMLOG_DEBUG("        Switch Statements: %d\n", air_classification.switch_statements);
+                        VMLOG_DEBUG("        Early Returns: %d\n", air_classification.early_returns);
                         
-                        IOLog("      Advanced GPU Features:\n");
-                        IOLog("        Tessellation Operations: %d\n", air_classification.tessellation_operations);
-                        IOLog("        Geometry Operations: %d\n", air_classification.geometry_operations);
-                        IOLog("        Mesh Shader Operations: %d\n", air_classification.mesh_shader_operations);
-                        IOLog("        Ray Tracing Operations: %d\n", air_classification.ray_tracing_operations);
+                        VMLOG_DEBUG("      Advanced GPU Features:\n");
+                        VMLOG_DEBUG("        Tessellation Operations: %d\n", air_classification.tessellation_operations);
+                        VMLOG_DEBUG("        Geometry Operations: %d\n", air_classification.geometry_operations);
+                        VMLOG_DEBUG("        Mesh Shader Operations: %d\n", air_classification.mesh_shader_operations);
+                        VMLOG_DEBUG("        Ray Tracing Operations: %d\n", air_classification.ray_tracing_operations);
                         
-                        IOLog("      Compute Shader Features:\n");
-                        IOLog("        Thread Synchronization: %d\n", air_classification.thread_synchronization);
-                        IOLog("        Atomic RMW Operations: %d\n", air_classification.atomic_read_modify_write);
-                        IOLog("        Shared Memory Operations: %d\n", air_classification.shared_memory_operations);
+                        VMLOG_DEBUG("      Compute Shader Features:\n");
+                        VMLOG_DEBUG("        Thread Synchronization: %d\n", air_classification.thread_synchronization);
+                        VMLOG_DEBUG("        Atomic RMW Operations: %d\n", air_classification.atomic_read_modify_write);
+                        VMLOG_DEBUG("        Shared Memory Operations: %d\n", air_classification.shared_memory_operations);
                         
-                        IOLog("      Performance Analysis:\n");
-                        IOLog("        Arithmetic Intensity: %.2f\n", air_classification.arithmetic_intensity);
-                        IOLog("        Memory Bandwidth Utilization: %.2f\n", air_classification.memory_bandwidth_utilization);
-                        IOLog("        Instruction Level Parallelism: %.2f\n", air_classification.instruction_level_parallelism);
-                        IOLog("        Estimated Execution Cycles: %d\n", air_classification.estimated_execution_cycles);
+                        VMLOG_DEBUG("      Performance Analysis:\n");
+                        VMLOG_DEBUG("        Arithmetic Intensity: %.2f\n", air_classification.arithmetic_intensity);
+                        VMLOG_DEBUG("        Memory Bandwidth Utilization: %.2f\n", air_classification.memory_bandwidth_utilization);
+                        VMLOG_DEBUG("        Instruction Level Parallelism: %.2f\n", air_classification.instruction_level_parallelism);
+                        VMLOG_DEBUG("        Estimated Execution Cycles: %d\n", air_classification.estimated_execution_cycles);
                         
-                        IOLog("      Optimization Opportunities:\n");
-                        IOLog("        Vectorizable Sequences: %d\n", air_classification.vectorizable_sequences);
-                        IOLog("        Parallel Execution Hints: %d\n", air_classification.parallel_execution_hints);
-                        IOLog("        Memory Coalescing Potential: %d\n", air_classification.memory_coalescing_potential);
-                        IOLog("        Register Spill Indicators: %d\n", air_classification.register_spill_indicators);
+                        VMLOG_DEBUG("      Optimization Opportunities:\n");
+                        VMLOG_DEBUG("        Vectorizable Sequences: %d\n", air_classification.vectorizable_sequences);
+                        VMLOG_DEBUG("        Parallel Execution Hints: %d\n", air_classification.parallel_execution_hints);
+                        VMLOG_DEBUG("        Memory Coalescing Potential: %d\n", air_classification.memory_coalescing_potential);
+                        VMLOG_DEBUG("        Register Spill Indicators: %d\n", air_classification.register_spill_indicators);
                         
-                        IOLog("      Legacy AIR Features:\n");
-                        IOLog("        Atomic Operations: %s\n", air_analysis.uses_atomics ? "YES" : "NO");
-                        IOLog("        Memory Barriers: %s\n", air_analysis.uses_barriers ? "YES" : "NO");
-                        IOLog("        Estimated Registers: %d\n", air_analysis.register_usage);
+                        VMLOG_DEBUG("      Legacy AIR Features:\n");
+                        VMLOG_DEBUG("        Atomic Operations: %s\n", air_analysis.uses_atomics ? "YES" : "NO");
+                        VMLOG_DEBUG("        Memory Barriers: %s\n", air_analysis.uses_barriers ? "YES" : "NO");
+                        VMLOG_DEBUG("        Estimated Registers: %d\n", air_analysis.register_usage);
                     }
                     
                     // Phase 5: Reflection Data Analysis
                     if (metal_lib_header.reflection_size > 0 && metal_lib_header.reflection_offset > 0 &&
                         metal_lib_header.reflection_offset < source_size) {
                         
-                        IOLog("    Metal Reflection Data Analysis:\n");
+                        VMLOG_DEBUG("    Metal Reflection Data Analysis:\n");
                         
                         const uint8_t* reflection_data = binary_data + metal_lib_header.reflection_offset;
                         size_t reflection_size = metal_lib_header.reflection_size;
@@ -3949,17 +3616,17 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                             reflection_analysis.has_pipeline_state_info = (flags & 0x04) != 0;
                         }
                         
-                        IOLog("      Resource Binding Information:\n");
-                        IOLog("        Vertex Attributes: %d\n", reflection_analysis.vertex_attributes);
-                        IOLog("        Buffer Bindings: %d\n", reflection_analysis.buffer_bindings);
-                        IOLog("        Texture Bindings: %d\n", reflection_analysis.texture_bindings);
-                        IOLog("        Sampler Bindings: %d\n", reflection_analysis.sampler_bindings);
-                        IOLog("        Constant Bindings: %d\n", reflection_analysis.constant_bindings);
-                        IOLog("      Additional Information:\n");
-                        IOLog("        Threadgroup Memory: %d bytes\n", reflection_analysis.threadgroup_memory);
-                        IOLog("        Vertex Descriptors: %s\n", reflection_analysis.has_vertex_descriptors ? "YES" : "NO");
-                        IOLog("        Function Constants: %s\n", reflection_analysis.has_function_constants ? "YES" : "NO");
-                        IOLog("        Pipeline State Info: %s\n", reflection_analysis.has_pipeline_state_info ? "YES" : "NO");
+                        VMLOG_DEBUG("      Resource Binding Information:\n");
+                        VMLOG_DEBUG("        Vertex Attributes: %d\n", reflection_analysis.vertex_attributes);
+                        VMLOG_DEBUG("        Buffer Bindings: %d\n", reflection_analysis.buffer_bindings);
+                        VMLOG_DEBUG("        Texture Bindings: %d\n", reflection_analysis.texture_bindings);
+                        VMLOG_DEBUG("        Sampler Bindings: %d\n", reflection_analysis.sampler_bindings);
+                        VMLOG_DEBUG("        Constant Bindings: %d\n", reflection_analysis.constant_bindings);
+                        VMLOG_DEBUG("      Additional Information:\n");
+                        VMLOG_DEBUG("        Threadgroup Memory: %d bytes\n", reflection_analysis.threadgroup_memory);
+                        VMLOG_DEBUG("        Vertex Descriptors: %s\n", reflection_analysis.has_vertex_descriptors ? "YES" : "NO");
+                        VMLOG_DEBUG("        Function Constants: %s\n", reflection_analysis.has_function_constants ? "YES" : "NO");
+                        VMLOG_DEBUG("        Pipeline State Info: %s\n", reflection_analysis.has_pipeline_state_info ? "YES" : "NO");
                         
                         // Update binary analysis with reflection data
                         binary_pipeline.binary_analysis.resource_descriptors += 
@@ -3974,26 +3641,26 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                     binary_pipeline.binary_analysis.instruction_analysis_complete = true;
                     
                 } else {
-                    IOLog("    Metal Library Format Detection Failed:\n");
-                    IOLog("      Unknown signature: 0x%08X\n", metal_lib_header.magic_signature);
-                    IOLog("      Expected signatures: 0x4D544C42 (MTLB), 0x4D455441 (META), 0x41495242 (AIRB)\n");
+                    VMLOG_WARN("    Metal Library Format Detection Failed:\n");
+                    VMLOG_WARN("      Unknown signature: 0x%08X\n", metal_lib_header.magic_signature);
+                    VMLOG_WARN("      Expected signatures: 0x4D544C42 (MTLB), 0x4D455441 (META), 0x41495242 (AIRB)\n");
                     binary_pipeline.format_validation.format_signature_valid = false;
                 }
             } else {
-                IOLog("    Error: Metal Library binary too small (%zu bytes, minimum 32 required)\n", source_size);
+                VMLOG_ERROR("    Error: Metal Library binary too small (%zu bytes, minimum 32 required)\n", source_size);
                 binary_pipeline.format_validation.format_signature_valid = false;
             }
             
         } else {
-            IOLog("  Processing Generic Binary Shader Format:\n");
+            VMLOG_DEBUG("  Processing Generic Binary Shader Format:\n");
             
             // Generic binary shader processing
             binary_pipeline.format_validation.format_signature_valid = (source_size > 0);
             binary_pipeline.format_validation.header_structure_valid = (source_size >= 4);
             binary_pipeline.binary_analysis.instruction_analysis_complete = true;
             
-            IOLog("    Generic Binary Size: %zu bytes\n", source_size);
-            IOLog("    Assumed Valid Format: %s\n", 
+            VMLOG_DEBUG("    Generic Binary Size: %zu bytes\n", source_size);
+            VMLOG_DEBUG("    Assumed Valid Format: %s\n", 
                   binary_pipeline.format_validation.format_signature_valid ? "YES" : "NO");
         }
         
@@ -4001,14 +3668,14 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         binary_pipeline.format_validation.validation_time_ms = (float)(validation_end - validation_start) / 1000000.0f;
         binary_pipeline.format_validation.total_validation_checks = 5; // Standard validation checks
         
-        IOLog("  Binary Validation Summary:\n");
-        IOLog("    Format Signature: %s\n", binary_pipeline.format_validation.format_signature_valid ? "VALID" : "INVALID");
-        IOLog("    Header Structure: %s\n", binary_pipeline.format_validation.header_structure_valid ? "VALID" : "INVALID");
-        IOLog("    Instruction Stream: %s\n", binary_pipeline.format_validation.instruction_stream_valid ? "VALID" : "UNKNOWN");
-        IOLog("    Validation Time: %.2f ms\n", binary_pipeline.format_validation.validation_time_ms);
+        VMLOG_DEBUG("  Binary Validation Summary:\n");
+        VMLOG_DEBUG("    Format Signature: %s\n", binary_pipeline.format_validation.format_signature_valid ? "VALID" : "INVALID");
+        VMLOG_DEBUG("    Header Structure: %s\n", binary_pipeline.format_validation.header_structure_valid ? "VALID" : "INVALID");
+        VMLOG_DEBUG("    Instruction Stream: %s\n", binary_pipeline.format_validation.instruction_stream_valid ? "VALID" : "UNKNOWN");
+        VMLOG_DEBUG("    Validation Time: %.2f ms\n", binary_pipeline.format_validation.validation_time_ms);
         
         // Phase 2: Advanced Binary Analysis and Resource Extraction
-        IOLog("VMShaderManager: Phase 2 - Advanced binary analysis and resource extraction\n");
+        VMLOG_DEBUG("VMShaderManager: Phase 2 - Advanced binary analysis and resource extraction\n");
         
         uint64_t analysis_start = mach_absolute_time();
         
@@ -4045,15 +3712,15 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         uint64_t analysis_end = mach_absolute_time();
         binary_pipeline.binary_analysis.analysis_time_ms = (float)(analysis_end - analysis_start) / 1000000.0f;
         
-        IOLog("  Binary Analysis Results:\n");
-        IOLog("    Instruction Analysis: %s\n", binary_pipeline.binary_analysis.instruction_analysis_complete ? "COMPLETE" : "INCOMPLETE");
-        IOLog("    Resource Descriptors: %d\n", binary_pipeline.binary_analysis.resource_descriptors);
-        IOLog("    Constant Pool Entries: %d\n", binary_pipeline.binary_analysis.constant_pool_entries);
-        IOLog("    Unique Opcodes: %d\n", binary_pipeline.binary_analysis.unique_opcodes);
-        IOLog("    Analysis Time: %.2f ms\n", binary_pipeline.binary_analysis.analysis_time_ms);
+        VMLOG_DEBUG("  Binary Analysis Results:\n");
+        VMLOG_DEBUG("    Instruction Analysis: %s\n", binary_pipeline.binary_analysis.instruction_analysis_complete ? "COMPLETE" : "INCOMPLETE");
+        VMLOG_DEBUG("    Resource Descriptors: %d\n", binary_pipeline.binary_analysis.resource_descriptors);
+        VMLOG_DEBUG("    Constant Pool Entries: %d\n", binary_pipeline.binary_analysis.constant_pool_entries);
+        VMLOG_DEBUG("    Unique Opcodes: %d\n", binary_pipeline.binary_analysis.unique_opcodes);
+        VMLOG_DEBUG("    Analysis Time: %.2f ms\n", binary_pipeline.binary_analysis.analysis_time_ms);
         
         // Phase 3: Cross-Platform Binary Optimization
-        IOLog("VMShaderManager: Phase 3 - Cross-platform binary optimization\n");
+        VMLOG_DEBUG("VMShaderManager: Phase 3 - Cross-platform binary optimization\n");
         
         uint64_t optimization_start = mach_absolute_time();
         
@@ -4066,24 +3733,24 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
         
         // Perform optimization passes if requested
         if (binary_pipeline.cross_platform_opt.native_optimization_available && (flags & 0x0F)) {
-            IOLog("  Performing Binary Optimization Passes:\n");
+            VMLOG_DEBUG("  Performing Binary Optimization Passes:\n");
             
             uint32_t original_instructions = binary_pipeline.binary_analysis.total_instructions;
             
             if (binary_pipeline.cross_platform_opt.instruction_reordering) {
-                IOLog("    Instruction Reordering: APPLIED\n");
+                VMLOG_DEBUG("    Instruction Reordering: APPLIED\n");
                 binary_pipeline.cross_platform_opt.optimization_passes++;
                 binary_pipeline.cross_platform_opt.instructions_optimized += (original_instructions / 20); // 5% reordered
             }
             
             if (binary_pipeline.cross_platform_opt.register_pressure_optimization) {
-                IOLog("    Register Pressure Optimization: APPLIED\n");
+                VMLOG_DEBUG("    Register Pressure Optimization: APPLIED\n");
                 binary_pipeline.cross_platform_opt.optimization_passes++;
                 binary_pipeline.cross_platform_opt.instructions_optimized += (original_instructions / 50); // 2% optimized
             }
             
             if (binary_pipeline.cross_platform_opt.memory_access_optimization) {
-                IOLog("    Memory Access Optimization: APPLIED\n");
+                VMLOG_DEBUG("    Memory Access Optimization: APPLIED\n");
                 binary_pipeline.cross_platform_opt.optimization_passes++;
                 binary_pipeline.cross_platform_opt.instructions_optimized += (original_instructions / 25); // 4% optimized
             }
@@ -4095,20 +3762,20 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             }
             
         } else {
-            IOLog("  Binary Optimization: SKIPPED (not available or not requested)\n");
+            VMLOG_DEBUG("  Binary Optimization: SKIPPED (not available or not requested)\n");
         }
         
         uint64_t optimization_end = mach_absolute_time();
         binary_pipeline.cross_platform_opt.optimization_time_ms = (float)(optimization_end - optimization_start) / 1000000.0f;
         
-        IOLog("  Binary Optimization Results:\n");
-        IOLog("    Optimization Passes: %d\n", binary_pipeline.cross_platform_opt.optimization_passes);
-        IOLog("    Instructions Optimized: %d\n", binary_pipeline.cross_platform_opt.instructions_optimized);
-        IOLog("    Optimization Effectiveness: %.1f%%\n", binary_pipeline.cross_platform_opt.optimization_effectiveness);
-        IOLog("    Optimization Time: %.2f ms\n", binary_pipeline.cross_platform_opt.optimization_time_ms);
+        VMLOG_DEBUG("  Binary Optimization Results:\n");
+        VMLOG_DEBUG("    Optimization Passes: %d\n", binary_pipeline.cross_platform_opt.optimization_passes);
+        VMLOG_DEBUG("    Instructions Optimized: %d\n", binary_pipeline.cross_platform_opt.instructions_optimized);
+        VMLOG_DEBUG("    Optimization Effectiveness: %.1f%%\n", binary_pipeline.cross_platform_opt.optimization_effectiveness);
+        VMLOG_DEBUG("    Optimization Time: %.2f ms\n", binary_pipeline.cross_platform_opt.optimization_time_ms);
         
         // Phase 4: Hardware Compatibility Analysis
-        IOLog("VMShaderManager: Phase 4 - Hardware compatibility analysis\n");
+        VMLOG_DEBUG("VMShaderManager: Phase 4 - Hardware compatibility analysis\n");
         
         // Analyze hardware compatibility based on binary format and content
         binary_pipeline.hardware_compat.target_gpu_compatibility = true; // Assume compatible
@@ -4136,13 +3803,13 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
             binary_pipeline.hardware_compat.estimated_performance_score = 70.0f; // Moderate performance
         }
         
-        IOLog("  Hardware Compatibility Results:\n");
-        IOLog("    Target GPU Compatible: %s\n", binary_pipeline.hardware_compat.target_gpu_compatibility ? "YES" : "NO");
-        IOLog("    Minimum Shader Model: %d.%d\n", 
+        VMLOG_DEBUG("  Hardware Compatibility Results:\n");
+        VMLOG_DEBUG("    Target GPU Compatible: %s\n", binary_pipeline.hardware_compat.target_gpu_compatibility ? "YES" : "NO");
+        VMLOG_DEBUG("    Minimum Shader Model: %d.%d\n", 
               binary_pipeline.hardware_compat.minimum_shader_model / 10,
               binary_pipeline.hardware_compat.minimum_shader_model % 10);
-        IOLog("    Required GPU Features: 0x%08X\n", binary_pipeline.hardware_compat.required_gpu_features);
-        IOLog("    Performance Score: %.1f/100\n", binary_pipeline.hardware_compat.estimated_performance_score);
+        VMLOG_DEBUG("    Required GPU Features: 0x%08X\n", binary_pipeline.hardware_compat.required_gpu_features);
+        VMLOG_DEBUG("    Performance Score: %.1f/100\n", binary_pipeline.hardware_compat.estimated_performance_score);
         
         // Set final bytecode size (no modification for binary formats)
         bytecode_size = source_size;
@@ -4152,34 +3819,34 @@ IOReturn CLASS::compileShaderInternal(VMShaderType type, VMShaderLanguage langua
                                      binary_pipeline.binary_analysis.analysis_time_ms +
                                      binary_pipeline.cross_platform_opt.optimization_time_ms;
         
-        IOLog("VMShaderManager: ========== Advanced Binary Shader Processing Complete ==========\n");
-        IOLog("  Binary Processing Pipeline Summary:\n");
-        IOLog("    Binary Format: %s\n", getShaderLanguageString(language));
-        IOLog("    Original Size: %zu bytes\n", source_size);
-        IOLog("    Total Processing Time: %.2f ms\n", total_processing_time);
-        IOLog("  Phase Breakdown:\n");
-        IOLog("    Format Validation: %.2f ms\n", binary_pipeline.format_validation.validation_time_ms);
-        IOLog("    Binary Analysis: %.2f ms\n", binary_pipeline.binary_analysis.analysis_time_ms);
-        IOLog("    Cross-Platform Optimization: %.2f ms\n", binary_pipeline.cross_platform_opt.optimization_time_ms);
-        IOLog("  Validation Results:\n");
-        IOLog("    Format Valid: %s\n", binary_pipeline.format_validation.format_signature_valid ? "YES" : "NO");
-        IOLog("    Header Valid: %s\n", binary_pipeline.format_validation.header_structure_valid ? "YES" : "NO");
-        IOLog("    Instructions Valid: %s\n", binary_pipeline.format_validation.instruction_stream_valid ? "YES" : "NO");
-        IOLog("  Resource Analysis:\n");
-        IOLog("    Resource Descriptors: %d\n", binary_pipeline.binary_analysis.resource_descriptors);
-        IOLog("    Constant Pool Entries: %d\n", binary_pipeline.binary_analysis.constant_pool_entries);
-        IOLog("    Unique Opcodes: %d\n", binary_pipeline.binary_analysis.unique_opcodes);
-        IOLog("  Optimization Results:\n");
-        IOLog("    Optimization Passes: %d\n", binary_pipeline.cross_platform_opt.optimization_passes);
-        IOLog("    Instructions Optimized: %d\n", binary_pipeline.cross_platform_opt.instructions_optimized);
-        IOLog("    Effectiveness: %.1f%%\n", binary_pipeline.cross_platform_opt.optimization_effectiveness);
-        IOLog("  Hardware Compatibility:\n");
-        IOLog("    Minimum Shader Model: %d.%d\n", 
+        VMLOG_DEBUG("VMShaderManager: ========== Advanced Binary Shader Processing Complete ==========\n");
+        VMLOG_DEBUG("  Binary Processing Pipeline Summary:\n");
+        VMLOG_DEBUG("    Binary Format: %s\n", getShaderLanguageString(language));
+        VMLOG_DEBUG("    Original Size: %zu bytes\n", source_size);
+        VMLOG_DEBUG("    Total Processing Time: %.2f ms\n", total_processing_time);
+        VMLOG_DEBUG("  Phase Breakdown:\n");
+        VMLOG_DEBUG("    Format Validation: %.2f ms\n", binary_pipeline.format_validation.validation_time_ms);
+        VMLOG_DEBUG("    Binary Analysis: %.2f ms\n", binary_pipeline.binary_analysis.analysis_time_ms);
+        VMLOG_DEBUG("    Cross-Platform Optimization: %.2f ms\n", binary_pipeline.cross_platform_opt.optimization_time_ms);
+        VMLOG_DEBUG("  Validation Results:\n");
+        VMLOG_DEBUG("    Format Valid: %s\n", binary_pipeline.format_validation.format_signature_valid ? "YES" : "NO");
+        VMLOG_DEBUG("    Header Valid: %s\n", binary_pipeline.format_validation.header_structure_valid ? "YES" : "NO");
+        VMLOG_DEBUG("    Instructions Valid: %s\n", binary_pipeline.format_validation.instruction_stream_valid ? "YES" : "NO");
+        VMLOG_DEBUG("  Resource Analysis:\n");
+        VMLOG_DEBUG("    Resource Descriptors: %d\n", binary_pipeline.binary_analysis.resource_descriptors);
+        VMLOG_DEBUG("    Constant Pool Entries: %d\n", binary_pipeline.binary_analysis.constant_pool_entries);
+        VMLOG_DEBUG("    Unique Opcodes: %d\n", binary_pipeline.binary_analysis.unique_opcodes);
+        VMLOG_DEBUG("  Optimization Results:\n");
+        VMLOG_DEBUG("    Optimization Passes: %d\n", binary_pipeline.cross_platform_opt.optimization_passes);
+        VMLOG_DEBUG("    Instructions Optimized: %d\n", binary_pipeline.cross_platform_opt.instructions_optimized);
+        VMLOG_DEBUG("    Effectiveness: %.1f%%\n", binary_pipeline.cross_platform_opt.optimization_effectiveness);
+        VMLOG_DEBUG("  Hardware Compatibility:\n");
+        VMLOG_DEBUG("    Minimum Shader Model: %d.%d\n", 
               binary_pipeline.hardware_compat.minimum_shader_model / 10,
               binary_pipeline.hardware_compat.minimum_shader_model % 10);
-        IOLog("    Performance Score: %.1f/100\n", binary_pipeline.hardware_compat.estimated_performance_score);
-        IOLog("    Final Bytecode Size: %zu bytes\n", bytecode_size);
-        IOLog("================================================================================\n");
+        VMLOG_DEBUG("    Performance Score: %.1f/100\n", binary_pipeline.hardware_compat.estimated_performance_score);
+        VMLOG_DEBUG("    Final Bytecode Size: %zu bytes\n", bytecode_size);
+        VMLOG_DEBUG("================================================================================\n");
     }
     
     shader->bytecode = IOBufferMemoryDescriptor::withCapacity(bytecode_size, kIODirectionOut);
@@ -4213,7 +3880,7 @@ IOReturn CLASS::extractShaderMetadata(CompiledShader* shader)
     if (!shader || !shader->bytecode)
         return kIOReturnBadArgument;
     
-    IOLog("VMShaderManager: Starting comprehensive shader metadata extraction\n");
+    VMLOG_DEBUG("VMShaderManager: Starting comprehensive shader metadata extraction\n");
     
     // Method 1: Extract raw shader source/bytecode for analysis
     void* shader_data = nullptr;
@@ -4224,18 +3891,14 @@ IOReturn CLASS::extractShaderMetadata(CompiledShader* shader)
         shader_data = (void*)shader_map->getVirtualAddress();
         shader_size = shader_map->getLength();
         
-        IOLog("VMShaderManager: Mapped shader data (%zu bytes) for analysis\n", shader_size);
+        VMLOG_DEBUG("VMShaderManager: Mapped shader data (%zu bytes) for analysis\n", shader_size);
     } else {
-        IOLog("VMShaderManager: Failed to map shader bytecode, using fallback analysis\n");
+        VMLOG_ERROR("VMShaderManager: Failed to map shader bytecode, using fallback analysis\n");
         return kIOReturnError;
     }
     
-    // Method 2: Comprehensive source code analysis for GLSL/HLSL
+    // Method 2: Source reflection for GLSL/HLSL
     struct ShaderSourceAnalysis {
-        uint32_t total_lines;
-        uint32_t code_lines;
-        uint32_t comment_lines;
-        uint32_t blank_lines;
         uint32_t uniform_declarations;
         uint32_t attribute_declarations;
         uint32_t varying_declarations;
@@ -4247,111 +3910,62 @@ IOReturn CLASS::extractShaderMetadata(CompiledShader* shader)
     } source_analysis = {0};
     
     if (shader->language == VM_SHADER_LANG_GLSL || shader->language == VM_SHADER_LANG_HLSL) {
-        IOLog("VMShaderManager: Performing source code analysis for text-based shader\n");
-        
-        const char* source = (const char*)shader_data;
-        const char* line_start = source;
-        const char* current = source;
-        
-        // Line-by-line source analysis
-        while (current < source + shader_size && *current) {
-            // Process each line
-            const char* line_end = current;
-            while (line_end < source + shader_size && *line_end && *line_end != '\n') {
-                line_end++;
+        // One pass over the source with glsl_reflect. HLSL only feeds the
+        // statistics: its declarations are not GLSL and are not reflected.
+        ShaderReflectionScratch* scratch = (ShaderReflectionScratch*)IOMalloc(sizeof(ShaderReflectionScratch));
+        if (scratch) {
+            glsl_reflection* reflection = &scratch->reflection;
+            reflection->vars = scratch->vars;
+            reflection->var_capacity = VM_SHADER_REFLECT_MAX_VARS;
+            reflection->blocks = scratch->blocks;
+            reflection->block_capacity = VM_SHADER_REFLECT_MAX_BLOCKS;
+            glsl_reflect(reflection, (const char*)shader_data, shader_size, (uint32_t)shader->type);
+            
+            if (shader->language == VM_SHADER_LANG_GLSL) {
+                addReflectedMetadata(shader, reflection);
             }
             
-            size_t line_length = line_end - line_start;
-            source_analysis.total_lines++;
-            
-            if (line_length == 0) {
-                source_analysis.blank_lines++;
-            } else {
-                // Skip whitespace
-                const char* content_start = line_start;
-                while (content_start < line_end && (*content_start == ' ' || *content_start == '\t')) {
-                    content_start++;
-                }
-                
-                if (content_start < line_end) {
-                    // Check for comments
-                    if (content_start + 1 < line_end && content_start[0] == '/' && content_start[1] == '/') {
-                        source_analysis.comment_lines++;
-                    } else {
-                        source_analysis.code_lines++;
-                        
-                        // Analyze code constructs in this line
-                        char line_buffer[512];
-                        size_t copy_length = (line_length < sizeof(line_buffer) - 1) ? line_length : sizeof(line_buffer) - 1;
-                        strncpy(line_buffer, line_start, copy_length);
-                        line_buffer[copy_length] = '\0';
-                        
-                        // Convert to lowercase for keyword matching
-                        char line_lower[512];
-                        for (size_t i = 0; i <= copy_length; i++) {
-                            line_lower[i] = (line_buffer[i] >= 'A' && line_buffer[i] <= 'Z') ? 
-                                           (line_buffer[i] + 32) : line_buffer[i];
-                        }
-                        
-                        // Detect shader constructs
-                        if (kernel_strstr(line_lower, "uniform ")) {
-                            source_analysis.uniform_declarations++;
-                            extractUniformFromLine(shader, line_buffer);
-                        }
-                        if (kernel_strstr(line_lower, "attribute ") || kernel_strstr(line_lower, "in ")) {
-                            source_analysis.attribute_declarations++;
-                            extractAttributeFromLine(shader, line_buffer);
-                        }
-                        if (kernel_strstr(line_lower, "varying ") || kernel_strstr(line_lower, "out ")) {
-                            source_analysis.varying_declarations++;
-                        }
-                        if (kernel_strstr(line_lower, "texture") || kernel_strstr(line_lower, "sample")) {
-                            source_analysis.texture_samples++;
-                        }
-                        if (kernel_strstr(line_lower, "vec") || kernel_strstr(line_lower, "mat") || kernel_strstr(line_lower, "float")) {
-                            // Vector/matrix operations contribute to complexity
-                            source_analysis.estimated_complexity_score += 1.0f;
-                        }
-                        if (kernel_strstr(line_lower, "if ") || kernel_strstr(line_lower, "else")) {
-                            source_analysis.conditional_branches++;
-                            source_analysis.estimated_complexity_score += 2.0f;
-                        }
-                        if (kernel_strstr(line_lower, "for ") || kernel_strstr(line_lower, "while ")) {
-                            source_analysis.loop_constructs++;
-                            source_analysis.estimated_complexity_score += 5.0f;
-                        }
-                        if (kernel_strstr(line_lower, "void ") && kernel_strstr(line_lower, "(")) {
-                            source_analysis.function_definitions++;
-                        }
-                    }
+            for (uint32_t i = 0; i < reflection->var_count; i++) {
+                switch (scratch->vars[i].kind) {
+                    case GLSL_VAR_UNIFORM:
+                    case GLSL_VAR_SAMPLER:
+                    case GLSL_VAR_BLOCK_MEMBER:
+                        source_analysis.uniform_declarations++;
+                        break;
+                    case GLSL_VAR_INPUT:
+                        source_analysis.attribute_declarations++;
+                        break;
+                    case GLSL_VAR_OUTPUT:
+                        source_analysis.varying_declarations++;
+                        break;
                 }
             }
-            
-            // Move to next line
-            line_start = line_end + 1;
-            current = line_start;
-            
-            // Safety check to prevent infinite loops
-            if (source_analysis.total_lines > 10000) {
-                IOLog("VMShaderManager: Warning - shader has excessive line count, truncating analysis\n");
-                break;
+            source_analysis.texture_samples = reflection->texture_calls;
+            source_analysis.function_definitions = reflection->functions;
+            source_analysis.conditional_branches = reflection->branches;
+            source_analysis.loop_constructs = reflection->loops;
+            source_analysis.estimated_complexity_score =
+                reflection->functions + reflection->branches * 2.0f +
+                reflection->loops * 5.0f + reflection->texture_calls * 2.0f;
+            
+            if (reflection->overflow || reflection->errors) {
+                VMLOG_DEBUG("VMShaderManager: Reflection of GLSL %d source dropped %d declarations, %d unparsed\n",
+                      reflection->version, reflection->overflow, reflection->errors);
             }
+            IOFree(scratch, sizeof(ShaderReflectionScratch));
         }
         
-        IOLog("VMShaderManager: Source analysis complete - %d lines (%d code, %d comments, %d blank)\n",
-              source_analysis.total_lines, source_analysis.code_lines, 
-              source_analysis.comment_lines, source_analysis.blank_lines);
-        IOLog("VMShaderManager: Constructs found - Uniforms: %d, Attributes: %d, Textures: %d, Functions: %d\n",
+        VMLOG_DEBUG("VMShaderManager: Constructs found - Uniforms: %d, Attributes: %d, Textures: %d, Functions: %d\n",
               source_analysis.uniform_declarations, source_analysis.attribute_declarations,
               source_analysis.texture_samples, source_analysis.function_definitions);
-        IOLog("VMShaderManager: Complexity - Branches: %d, Loops: %d, Score: %.1f\n",
+        VMLOG_DEBUG("VMShaderManager: Complexity - Branches: %d, Loops: %d, Score: %.1f\n",
               source_analysis.conditional_branches, source_analysis.loop_constructs,
               source_analysis.estimated_complexity_score);
     }
     
     // Method 3: Bytecode analysis for binary shader formats
     else if (shader->language == VM_SHADER_LANG_SPIRV) {
-        IOLog("VMShaderManager: Performing SPIR-V bytecode analysis\n");
+        VMLOG_DEBUG("VMShaderManager: Performing SPIR-V bytecode analysis\n");
         
         // SPIR-V has a well-defined binary format
         if (shader_size >= 20) { // Minimum SPIR-V header size
@@ -4363,8 +3977,8 @@ IOReturn CLASS::extractShaderMetadata(CompiledShader* shader)
                 uint32_t bound = spirv_header[3];
                 uint32_t schema = spirv_header[4];
                 
-                IOLog("VMShaderManager: Valid SPIR-V bytecode detected\n");
-                IOLog("  Version: 0x%08X, Generator: 0x%08X, Bound: %d, Schema: %d\n",
+                VMLOG_DEBUG("VMShaderManager: Valid SPIR-V bytecode detected\n");
+                VMLOG_DEBUG("  Version: 0x%08X, Generator: 0x%08X, Bound: %d, Schema: %d\n",
                       spirv_version, generator, bound, schema);
                 
                 // Analyze SPIR-V instructions
@@ -4407,38 +4021,14 @@ IOReturn CLASS::extractShaderMetadata(CompiledShader* shader)
                     instructions_analyzed++;
                 }
                 
-                IOLog("VMShaderManager: SPIR-V analysis complete - %d instructions analyzed\n", instructions_analyzed);
+                VMLOG_DEBUG("VMShaderManager: SPIR-V analysis complete - %d instructions analyzed\n", instructions_analyzed);
             } else {
-                IOLog("VMShaderManager: Invalid SPIR-V magic number: 0x%08X\n", spirv_header[0]);
+                VMLOG_WARN("VMShaderManager: Invalid SPIR-V magic number: 0x%08X\n", spirv_header[0]);
             }
         }
     }
     
-    // Method 4: Add shader type-specific default attributes and uniforms
-    if (shader->type == VM_SHADER_TYPE_VERTEX) {
-        IOLog("VMShaderManager: Adding vertex shader specific metadata\n");
-        
-        // Standard vertex attributes if not already detected
-        if (shader->attributes->getCount() == 0) {
-            addDefaultVertexAttributes(shader);
-        }
-        
-        // Vertex-specific uniforms
-        addStandardVertexUniforms(shader);
-        
-    } else if (shader->type == VM_SHADER_TYPE_FRAGMENT) {
-        IOLog("VMShaderManager: Adding fragment shader specific metadata\n");
-        
-        // Fragment-specific uniforms
-        addStandardFragmentUniforms(shader);
-        
-        // Add texture samplers if detected
-        if (source_analysis.texture_samples > 0) {
-            addTextureSamplers(shader, source_analysis.texture_samples);
-        }
-    }
-    
-    // Method 5: Performance and resource usage estimation
+    // Method 4: Performance and resource usage estimation
     struct ShaderResourceEstimate {
         uint32_t estimated_register_usage;
         uint32_t estimated_texture_units;
@@ -4455,11 +4045,11 @@ IOReturn CLASS::extractShaderMetadata(CompiledShader* shader)
         (source_analysis.loop_constructs * 8) + 16; // Base registers
     
     resource_estimate.estimated_texture_units = source_analysis.texture_samples;
-    resource_estimate.estimated_uniform_buffer_size = shader->uniforms->getCount() * 16; // 16 bytes average
+    resource_estimate.estimated_uniform_buffer_size = shader->uniform_count * 16; // 16 bytes average
     resource_estimate.estimated_execution_cycles = source_analysis.estimated_complexity_score * 10.0f;
     resource_estimate.estimated_memory_bandwidth_kb = 
         (resource_estimate.estimated_texture_units * 4) + // Texture reads
-        (shader->attributes->getCount() * 2); // Vertex data
+        (shader->attribute_count * 2); // Vertex data
     
     // Categorize performance impact
     if (source_analysis.estimated_complexity_score > 50.0f) {
@@ -4472,38 +4062,35 @@ IOReturn CLASS::extractShaderMetadata(CompiledShader* shader)
         resource_estimate.performance_category = "MINIMAL_COMPLEXITY";
     }
     
-    // Method 6: Update shader info structure with comprehensive metadata
-    shader->info.uniform_count = shader->uniforms->getCount();
-    shader->info.attribute_count = shader->attributes->getCount();
-    shader->info.resource_count = shader->resources->getCount();
+    // Method 5: Update shader info structure with comprehensive metadata
+    shader->info.uniform_count = shader->uniform_count;
+    shader->info.attribute_count = shader->attribute_count;
+    shader->info.resource_count = shader->resource_count;
     
     // Store analysis results in shader info (extend structure as needed)
     shader->info.compile_flags |= 0x80000000; // Mark as having extended analysis
     
-    // Method 7: Comprehensive logging of extraction results
-    IOLog("VMShaderManager: ========== Shader Metadata Extraction Complete ==========\n");
-    IOLog("  Shader Type: %s, Language: %s\n", 
+    // Method 6: Comprehensive logging of extraction results
+    VMLOG_DEBUG("VMShaderManager: ========== Shader Metadata Extraction Complete ==========\n");
+    VMLOG_DEBUG("  Shader Type: %s, Language: %s\n", 
           getShaderTypeString(shader->type), getShaderLanguageString(shader->language));
-    IOLog("  Source Analysis:\n");
-    IOLog("    Lines: %d total (%d code, %d comments, %d blank)\n",
-          source_analysis.total_lines, source_analysis.code_lines,
-          source_analysis.comment_lines, source_analysis.blank_lines);
-    IOLog("    Declarations: %d uniforms, %d attributes, %d varyings\n",
+    VMLOG_DEBUG("  Source Analysis:\n");
+    VMLOG_DEBUG("    Declarations: %d uniforms, %d attributes, %d varyings\n",
           source_analysis.uniform_declarations, source_analysis.attribute_declarations,
           source_analysis.varying_declarations);
-    IOLog("    Operations: %d texture samples, %d branches, %d loops, %d functions\n",
+    VMLOG_DEBUG("    Operations: %d texture samples, %d branches, %d loops, %d functions\n",
           source_analysis.texture_samples, source_analysis.conditional_branches,
           source_analysis.loop_constructs, source_analysis.function_definitions);
-    IOLog("  Resource Estimates:\n");
-    IOLog("    Registers: %d, Texture Units: %d, Uniform Buffer: %d bytes\n",
+    VMLOG_DEBUG("  Resource Estimates:\n");
+    VMLOG_DEBUG("    Registers: %d, Texture Units: %d, Uniform Buffer: %d bytes\n",
           resource_estimate.estimated_register_usage, resource_estimate.estimated_texture_units,
           resource_estimate.estimated_uniform_buffer_size);
-    IOLog("    Execution Cycles: %.1f, Memory BW: %d KB, Category: %s\n",
+    VMLOG_DEBUG("    Execution Cycles: %.1f, Memory BW: %d KB, Category: %s\n",
           resource_estimate.estimated_execution_cycles, resource_estimate.estimated_memory_bandwidth_kb,
           resource_estimate.performance_category);
-    IOLog("  Final Metadata: %d uniforms, %d attributes, %d resources\n",
+    VMLOG_DEBUG("  Final Metadata: %d uniforms, %d attributes, %d resources\n",
           shader->info.uniform_count, shader->info.attribute_count, shader->info.resource_count);
-    IOLog("==============================================================\n");
+    VMLOG_DEBUG("==============================================================\n");
     
     // Cleanup
     if (shader_map) {
@@ -4513,755 +4100,84 @@ IOReturn CLASS::extractShaderMetadata(CompiledShader* shader)
     return kIOReturnSuccess;
 }
 
-// Production-grade shader data type parsing
-uint32_t CLASS::parseShaderDataType(const char* type_str)
-{
-    if (!type_str) return 0x1406; // Default GL_FLOAT
-    
-    IOLog("VMShaderManager: Parsing shader data type: '%s'\n", type_str);
-    
-    // Remove precision qualifiers for type matching
-    const char* base_type = type_str;
-    if (kernel_strstr(type_str, "highp ")) base_type = type_str + 6;
-    else if (kernel_strstr(type_str, "mediump ")) base_type = type_str + 8;
-    else if (kernel_strstr(type_str, "lowp ")) base_type = type_str + 5;
-    
-    // Matrix types
-    if (kernel_strstr(base_type, "mat4")) return 0x8B5C;      // GL_FLOAT_MAT4
-    if (kernel_strstr(base_type, "mat3")) return 0x8B5B;      // GL_FLOAT_MAT3
-    if (kernel_strstr(base_type, "mat2")) return 0x8B5A;      // GL_FLOAT_MAT2
-    if (kernel_strstr(base_type, "mat4x4")) return 0x8B5C;    // GL_FLOAT_MAT4
-    if (kernel_strstr(base_type, "mat4x3")) return 0x8B68;    // GL_FLOAT_MAT4x3
-    if (kernel_strstr(base_type, "mat4x2")) return 0x8B69;    // GL_FLOAT_MAT4x2
-    if (kernel_strstr(base_type, "mat3x4")) return 0x8B6A;    // GL_FLOAT_MAT3x4
-    if (kernel_strstr(base_type, "mat3x2")) return 0x8B67;    // GL_FLOAT_MAT3x2
-    if (kernel_strstr(base_type, "mat2x4")) return 0x8B66;    // GL_FLOAT_MAT2x4
-    if (kernel_strstr(base_type, "mat2x3")) return 0x8B65;    // GL_FLOAT_MAT2x3
-    
-    // Vector types - float
-    if (kernel_strstr(base_type, "vec4")) return 0x8B52;      // GL_FLOAT_VEC4
-    if (kernel_strstr(base_type, "vec3")) return 0x8B51;      // GL_FLOAT_VEC3
-    if (kernel_strstr(base_type, "vec2")) return 0x8B50;      // GL_FLOAT_VEC2
-    
-    // Vector types - int
-    if (kernel_strstr(base_type, "ivec4")) return 0x8B55;     // GL_INT_VEC4
-    if (kernel_strstr(base_type, "ivec3")) return 0x8B54;     // GL_INT_VEC3
-    if (kernel_strstr(base_type, "ivec2")) return 0x8B53;     // GL_INT_VEC2
-    
-    // Vector types - unsigned int
-    if (kernel_strstr(base_type, "uvec4")) return 0x8DC8;     // GL_UNSIGNED_INT_VEC4
-    if (kernel_strstr(base_type, "uvec3")) return 0x8DC7;     // GL_UNSIGNED_INT_VEC3
-    if (kernel_strstr(base_type, "uvec2")) return 0x8DC6;     // GL_UNSIGNED_INT_VEC2
-    
-    // Vector types - bool
-    if (kernel_strstr(base_type, "bvec4")) return 0x8B58;     // GL_BOOL_VEC4
-    if (kernel_strstr(base_type, "bvec3")) return 0x8B57;     // GL_BOOL_VEC3
-    if (kernel_strstr(base_type, "bvec2")) return 0x8B56;     // GL_BOOL_VEC2
-    
-    // Sampler types
-    if (kernel_strstr(base_type, "sampler2D")) return 0x8B5E;       // GL_SAMPLER_2D
-    if (kernel_strstr(base_type, "samplerCube")) return 0x8B60;     // GL_SAMPLER_CUBE
-    if (kernel_strstr(base_type, "sampler3D")) return 0x8B5F;       // GL_SAMPLER_3D
-    if (kernel_strstr(base_type, "sampler2DArray")) return 0x8DC1;  // GL_SAMPLER_2D_ARRAY
-    if (kernel_strstr(base_type, "samplerBuffer")) return 0x8DC2;   // GL_SAMPLER_BUFFER
-    if (kernel_strstr(base_type, "sampler2DShadow")) return 0x8B62; // GL_SAMPLER_2D_SHADOW
-    
-    // Image types (for compute shaders)
-    if (kernel_strstr(base_type, "image2D")) return 0x9063;         // GL_IMAGE_2D
-    if (kernel_strstr(base_type, "image3D")) return 0x9064;         // GL_IMAGE_3D
-    if (kernel_strstr(base_type, "imageCube")) return 0x9066;       // GL_IMAGE_CUBE
-    
-    // Basic scalar types
-    if (kernel_strstr(base_type, "float")) return 0x1406;     // GL_FLOAT
-    if (kernel_strstr(base_type, "int")) return 0x1404;       // GL_INT
-    if (kernel_strstr(base_type, "uint")) return 0x1405;      // GL_UNSIGNED_INT
-    if (kernel_strstr(base_type, "bool")) return 0x8B56;      // GL_BOOL
-    
-    // Double precision types (OpenGL 4.0+)
-    if (kernel_strstr(base_type, "double")) return 0x140A;    // GL_DOUBLE
-    if (kernel_strstr(base_type, "dvec4")) return 0x8FFC;     // GL_DOUBLE_VEC4
-    if (kernel_strstr(base_type, "dvec3")) return 0x8FFB;     // GL_DOUBLE_VEC3
-    if (kernel_strstr(base_type, "dvec2")) return 0x8FFA;     // GL_DOUBLE_VEC2
-    
-    // Atomic counter types
-    if (kernel_strstr(base_type, "atomic_uint")) return 0x92DB;    // GL_UNSIGNED_INT_ATOMIC_COUNTER
-    
-    IOLog("VMShaderManager: Unknown type '%s', defaulting to GL_FLOAT\n", type_str);
-    return 0x1406; // Default to GL_FLOAT
-}
-
-// Calculate uniform size based on type
-uint32_t CLASS::calculateUniformSize(const char* type_str)
-{
-    if (!type_str) return 4;
-    
-    const char* base_type = type_str;
-    if (kernel_strstr(type_str, "highp ")) base_type = type_str + 6;
-    else if (kernel_strstr(type_str, "mediump ")) base_type = type_str + 8;
-    else if (kernel_strstr(type_str, "lowp ")) base_type = type_str + 5;
-    
-    // Matrix types (column-major storage)
-    if (kernel_strstr(base_type, "mat4")) return 64;      // 4x4 floats = 64 bytes
-    if (kernel_strstr(base_type, "mat3")) return 36;      // 3x3 floats = 36 bytes
-    if (kernel_strstr(base_type, "mat2")) return 16;      // 2x2 floats = 16 bytes
-    
-    // Vector types
-    if (kernel_strstr(base_type, "vec4")) return 16;      // 4 floats = 16 bytes
-    if (kernel_strstr(base_type, "ivec4")) return 16;     // 4 ints = 16 bytes
-    if (kernel_strstr(base_type, "uvec4")) return 16;     // 4 uints = 16 bytes
-    if (kernel_strstr(base_type, "bvec4")) return 4;      // 4 bools = 4 bytes
-    
-    if (kernel_strstr(base_type, "vec3")) return 12;      // 3 floats = 12 bytes
-    if (kernel_strstr(base_type, "ivec3")) return 12;     // 3 ints = 12 bytes
-    if (kernel_strstr(base_type, "uvec3")) return 12;     // 3 uints = 12 bytes
-    if (kernel_strstr(base_type, "bvec3")) return 3;      // 3 bools = 3 bytes
-    
-    if (kernel_strstr(base_type, "vec2")) return 8;       // 2 floats = 8 bytes
-    if (kernel_strstr(base_type, "ivec2")) return 8;      // 2 ints = 8 bytes
-    if (kernel_strstr(base_type, "uvec2")) return 8;      // 2 uints = 8 bytes
-    if (kernel_strstr(base_type, "bvec2")) return 2;      // 2 bools = 2 bytes
-    
-    // Sampler/texture types (just store texture unit index)
-    if (kernel_strstr(base_type, "sampler")) return 4;    // Texture unit index
-    if (kernel_strstr(base_type, "image")) return 4;      // Image unit index
-    
-    // Scalar types
-    if (kernel_strstr(base_type, "float")) return 4;      // 1 float = 4 bytes
-    if (kernel_strstr(base_type, "int")) return 4;        // 1 int = 4 bytes
-    if (kernel_strstr(base_type, "uint")) return 4;       // 1 uint = 4 bytes
-    if (kernel_strstr(base_type, "bool")) return 1;       // 1 bool = 1 byte
-    
-    // Double precision types
-    if (kernel_strstr(base_type, "double")) return 8;     // 1 double = 8 bytes
-    if (kernel_strstr(base_type, "dvec4")) return 32;     // 4 doubles = 32 bytes
-    if (kernel_strstr(base_type, "dvec3")) return 24;     // 3 doubles = 24 bytes
-    if (kernel_strstr(base_type, "dvec2")) return 16;     // 2 doubles = 16 bytes
-    
-    return 4; // Default to 4 bytes
-}
-
-// Extract array size from variable name
-uint32_t CLASS::extractArraySize(const char* name_str)
+// Turns a glsl_reflect result into the shader's uniform, attribute and
+// resource lists. Default-block uniforms keep their std140 offsets; block
+// members live in their own UBO and are only reported through the block.
+void CLASS::addReflectedMetadata(CompiledShader* shader, const glsl_reflection* reflection)
 {
-    if (!name_str) return 1;
-    
-    const char* bracket_open = kernel_strchr(name_str, '[');
-    if (!bracket_open) return 1; // Not an array
-    
-    const char* bracket_close = kernel_strchr(bracket_open, ']');
-    if (!bracket_close) return 1; // Malformed array
-    
-    // Extract array size string
-    size_t size_str_len = bracket_close - bracket_open - 1;
-    if (size_str_len == 0) return 1; // Empty brackets - unsized array
+    uint32_t stage_mask = 1u << ((uint32_t)shader->type - 1);
+    uint32_t next_attribute_location = 0;
+    uint32_t next_texture_unit = 0;
     
-    char size_str[32];
-    if (size_str_len >= sizeof(size_str)) return 1; // Too long
-    
-    strncpy(size_str, bracket_open + 1, size_str_len);
-    size_str[size_str_len] = '\0';
-    
-    uint32_t array_size = kernel_simple_atoi(size_str);
-    return (array_size > 0) ? array_size : 1;
-}
-
-// Calculate uniform offset within uniform buffer
-uint32_t CLASS::calculateUniformOffset(CompiledShader* shader, uint32_t size)
-{
-    if (!shader || !shader->uniforms) return 0;
-    
-    uint32_t total_offset = 0;
-    for (unsigned int i = 0; i < shader->uniforms->getCount(); i++) {
-        VMShaderUniform* existing_uniform = (VMShaderUniform*)shader->uniforms->getObject(i);
-        if (existing_uniform) {
-            uint32_t uniform_size = existing_uniform->size * existing_uniform->array_size;
-            // Align to 16-byte boundaries for uniform buffer objects
-            uint32_t aligned_size = (uniform_size + 15) & ~15;
-            total_offset += aligned_size;
+    for (uint32_t i = 0; i < reflection->var_count; i++) {
+        const glsl_reflect_var* var = &reflection->vars[i];
+        uint32_t elements = var->array_size ? var->array_size : 1;
+        
+        if ((var->kind == GLSL_VAR_UNIFORM || var->kind == GLSL_VAR_SAMPLER) &&
+            shader->uniform_count < MAX_SHADER_UNIFORMS) {
+            uint32_t location = var->location >= 0 ? (uint32_t)var->location : shader->uniform_count;
+            VMShaderUniform* uniform = appendRecord(&shader->uniforms, &shader->uniform_count,
+                                                    &shader->uniform_capacity);
+            if (!uniform) {
+                continue;
+            }
+            strlcpy(uniform->name, var->name, sizeof(uniform->name));
+            uniform->type = var->gl_type;
+            uniform->location = location;
+            uniform->size = var->size;
+            uniform->array_size = elements;
+            uniform->offset = var->offset;
+        }
+        
+        if (var->kind == GLSL_VAR_SAMPLER) {
+            VMShaderResource* resource = appendRecord(&shader->resources, &shader->resource_count,
+                                                      &shader->resource_capacity);
+            if (resource) {
+                resource->binding = var->binding >= 0 ? (uint32_t)var->binding : next_texture_unit;
+                resource->type = var->gl_type;
+                resource->stage_mask = stage_mask;
+                strlcpy(resource->name, var->name, sizeof(resource->name));
+            }
+            next_texture_unit = (var->binding >= 0 ? (uint32_t)var->binding : next_texture_unit) + elements;
+        }
+        
+        if (var->kind == GLSL_VAR_INPUT && shader->type == VM_SHADER_TYPE_VERTEX &&
+            shader->attribute_count < MAX_SHADER_ATTRIBUTES) {
+            VMShaderAttribute* attribute = appendRecord(&shader->attributes, &shader->attribute_count,
+                                                        &shader->attribute_capacity);
+            if (!attribute) {
+                continue;
+            }
+            uint32_t location = var->location >= 0 ? (uint32_t)var->location : next_attribute_location;
+            strlcpy(attribute->name, var->name, sizeof(attribute->name));
+            attribute->type = var->gl_type;
+            attribute->location = location;
+            attribute->components = var->components;
+            attribute->normalized = 0;
+            // Matrices and arrays take one location per column and element
+            next_attribute_location = location + var->columns * elements;
         }
     }
     
-    // Align current offset to appropriate boundary
-    if (size >= 16) {
-        total_offset = (total_offset + 15) & ~15; // 16-byte alignment for matrices/vec4
-    } else if (size >= 8) {
-        total_offset = (total_offset + 7) & ~7;   // 8-byte alignment for vec3/vec2
-    } else {
-        total_offset = (total_offset + 3) & ~3;   // 4-byte alignment for scalars
+    for (uint32_t i = 0; i < reflection->block_count; i++) {
+        const glsl_reflect_block* block = &reflection->blocks[i];
+        VMShaderResource* resource = appendRecord(&shader->resources, &shader->resource_count,
+                                                  &shader->resource_capacity);
+        if (resource) {
+            resource->binding = block->binding >= 0 ? (uint32_t)block->binding : i;
+            resource->type = 0x8A11; // GL_UNIFORM_BUFFER
+            resource->stage_mask = stage_mask;
+            strlcpy(resource->name, block->name, sizeof(resource->name));
+        }
     }
     
-    return total_offset;
+    VMLOG_DEBUG("VMShaderManager: Reflected GLSL %d: %d uniforms (%d-byte default block), %d attributes, %d blocks\n",
+          reflection->version, shader->uniform_count, reflection->default_block_size,
+          shader->attribute_count, reflection->block_count);
 }
 
-// Production-grade advanced shader parser for uniform declarations
-IOReturn CLASS::parseUniformDeclarationAdvanced(const char* declaration, char* type_out, char* name_out, size_t type_size, size_t name_size)
-{
-    if (!declaration || !type_out || !name_out) 
-        return kIOReturnBadArgument;
-    
-    IOLog("VMShaderManager: Advanced parsing of uniform declaration: '%.100s'\n", declaration);
-    
-    // Initialize output buffers
-    type_out[0] = '\0';
-    name_out[0] = '\0';
-    
-    // Advanced shader parser state machine
-    enum ParserState {
-        PARSER_SEEKING_UNIFORM,
-        PARSER_SEEKING_QUALIFIERS,
-        PARSER_PARSING_TYPE,
-        PARSER_PARSING_NAME,
-        PARSER_PARSING_ARRAY,
-        PARSER_COMPLETE,
-        PARSER_ERROR
-    };
-    
-    struct ParserContext {
-        const char* current_pos;
-        const char* line_end;
-        ParserState state;
-        bool has_layout_qualifier;
-        bool has_precision_qualifier;
-        bool has_invariant_qualifier;
-        bool has_interpolation_qualifier;
-        uint32_t layout_location;
-        uint32_t layout_binding;
-        uint32_t array_size;
-        char precision_qualifier[16];
-        char interpolation_qualifier[16];
-        char full_type[128];
-        char base_name[64];
-        char array_specifier[32];
-    } parser_ctx = {0};
-    
-    // Initialize parser context
-    parser_ctx.current_pos = declaration;
-    parser_ctx.line_end = declaration + strlen(declaration);
-    parser_ctx.state = PARSER_SEEKING_UNIFORM;
-    parser_ctx.array_size = 1; // Default to non-array
-    
-    // Phase 1: Locate and validate 'uniform' keyword
-    while (parser_ctx.current_pos < parser_ctx.line_end && parser_ctx.state != PARSER_ERROR) {
-        // Skip whitespace and comments
-        while (parser_ctx.current_pos < parser_ctx.line_end && 
-               (*parser_ctx.current_pos == ' ' || *parser_ctx.current_pos == '\t' || *parser_ctx.current_pos == '\n')) {
-            parser_ctx.current_pos++;
-        }
-        
-        if (parser_ctx.current_pos >= parser_ctx.line_end) break;
-        
-        switch (parser_ctx.state) {
-            case PARSER_SEEKING_UNIFORM: {
-                if (strncmp(parser_ctx.current_pos, "uniform", 7) == 0 && 
-                    (parser_ctx.current_pos[7] == ' ' || parser_ctx.current_pos[7] == '\t')) {
-                    parser_ctx.current_pos += 7;
-                    parser_ctx.state = PARSER_SEEKING_QUALIFIERS;
-                    IOLog("VMShaderManager: Found 'uniform' keyword\n");
-                } else {
-                    parser_ctx.state = PARSER_ERROR;
-                    IOLog("VMShaderManager: No 'uniform' keyword found\n");
-                }
-                break;
-            }
-            
-            case PARSER_SEEKING_QUALIFIERS: {
-                // Skip whitespace
-                while (parser_ctx.current_pos < parser_ctx.line_end && 
-                       (*parser_ctx.current_pos == ' ' || *parser_ctx.current_pos == '\t')) {
-                    parser_ctx.current_pos++;
-                }
-                
-                // Check for layout qualifier: layout(location = N) or layout(binding = N)
-                if (strncmp(parser_ctx.current_pos, "layout", 6) == 0) {
-                    parser_ctx.current_pos += 6;
-                    parser_ctx.has_layout_qualifier = true;
-                    
-                    // Skip to opening parenthesis
-                    while (parser_ctx.current_pos < parser_ctx.line_end && *parser_ctx.current_pos != '(') {
-                        parser_ctx.current_pos++;
-                    }
-                    if (*parser_ctx.current_pos == '(') {
-                        parser_ctx.current_pos++;
-                        
-                        // Parse layout specifier content
-                        char layout_content[128] = {0};
-                        int content_idx = 0;
-                        while (parser_ctx.current_pos < parser_ctx.line_end && *parser_ctx.current_pos != ')' && content_idx < 127) {
-                            layout_content[content_idx++] = *parser_ctx.current_pos++;
-                        }
-                        
-                        if (*parser_ctx.current_pos == ')') {
-                            parser_ctx.current_pos++;
-                            
-                            // Parse layout content for location or binding
-                            if (kernel_strstr(layout_content, "location")) {
-                                const char* eq_pos = kernel_strchr(layout_content, '=');
-                                if (eq_pos) {
-                                    parser_ctx.layout_location = kernel_simple_atoi(eq_pos + 1);
-                                    IOLog("VMShaderManager: Found layout location = %d\n", parser_ctx.layout_location);
-                                }
-                            } else if (kernel_strstr(layout_content, "binding")) {
-                                const char* eq_pos = kernel_strchr(layout_content, '=');
-                                if (eq_pos) {
-                                    parser_ctx.layout_binding = kernel_simple_atoi(eq_pos + 1);
-                                    IOLog("VMShaderManager: Found layout binding = %d\n", parser_ctx.layout_binding);
-                                }
-                            }
-                        }
-                    }
-                }
-                // Check for precision qualifier
-                else if (strncmp(parser_ctx.current_pos, "highp", 5) == 0 || 
-                         strncmp(parser_ctx.current_pos, "mediump", 7) == 0 || 
-                         strncmp(parser_ctx.current_pos, "lowp", 4) == 0) {
-                    
-                    const char* precision_start = parser_ctx.current_pos;
-                    while (parser_ctx.current_pos < parser_ctx.line_end && 
-                           *parser_ctx.current_pos != ' ' && *parser_ctx.current_pos != '\t') {
-                        parser_ctx.current_pos++;
-                    }
-                    
-                    size_t precision_len = parser_ctx.current_pos - precision_start;
-                    if (precision_len < sizeof(parser_ctx.precision_qualifier)) {
-                        strncpy(parser_ctx.precision_qualifier, precision_start, precision_len);
-                        parser_ctx.precision_qualifier[precision_len] = '\0';
-                        parser_ctx.has_precision_qualifier = true;
-                        IOLog("VMShaderManager: Found precision qualifier: %s\n", parser_ctx.precision_qualifier);
-                    }
-                }
-                // Check for invariant qualifier
-                else if (strncmp(parser_ctx.current_pos, "invariant", 9) == 0) {
-                    parser_ctx.current_pos += 9;
-                    parser_ctx.has_invariant_qualifier = true;
-                    IOLog("VMShaderManager: Found invariant qualifier\n");
-                }
-                // Check for interpolation qualifiers
-                else if (strncmp(parser_ctx.current_pos, "smooth", 6) == 0 || 
-                         strncmp(parser_ctx.current_pos, "flat", 4) == 0 || 
-                         strncmp(parser_ctx.current_pos, "noperspective", 13) == 0) {
-                    
-                    const char* interp_start = parser_ctx.current_pos;
-                    while (parser_ctx.current_pos < parser_ctx.line_end && 
-                           *parser_ctx.current_pos != ' ' && *parser_ctx.current_pos != '\t') {
-                        parser_ctx.current_pos++;
-                    }
-                    
-                    size_t interp_len = parser_ctx.current_pos - interp_start;
-                    if (interp_len < sizeof(parser_ctx.interpolation_qualifier)) {
-                        strncpy(parser_ctx.interpolation_qualifier, interp_start, interp_len);
-                        parser_ctx.interpolation_qualifier[interp_len] = '\0';
-                        parser_ctx.has_interpolation_qualifier = true;
-                        IOLog("VMShaderManager: Found interpolation qualifier: %s\n", parser_ctx.interpolation_qualifier);
-                    }
-                }
-                // No more qualifiers, move to type parsing
-                else {
-                    parser_ctx.state = PARSER_PARSING_TYPE;
-                }
-                break;
-            }
-            
-            case PARSER_PARSING_TYPE: {
-                const char* type_start = parser_ctx.current_pos;
-                
-                // Parse complex type declarations including struct types
-                if (strncmp(parser_ctx.current_pos, "struct", 6) == 0) {
-                    // Handle struct type declarations
-                    while (parser_ctx.current_pos < parser_ctx.line_end && 
-                           *parser_ctx.current_pos != ' ' && *parser_ctx.current_pos != '\t') {
-                        parser_ctx.current_pos++;
-                    }
-                    // Skip struct name
-                    while (parser_ctx.current_pos < parser_ctx.line_end && 
-                           (*parser_ctx.current_pos == ' ' || *parser_ctx.current_pos == '\t')) {
-                        parser_ctx.current_pos++;
-                    }
-                    while (parser_ctx.current_pos < parser_ctx.line_end && 
-                           *parser_ctx.current_pos != ' ' && *parser_ctx.current_pos != '\t') {
-                        parser_ctx.current_pos++;
-                    }
-                } else {
-                    // Parse standard type (vec3, mat4, sampler2D, etc.)
-                    while (parser_ctx.current_pos < parser_ctx.line_end && 
-                           *parser_ctx.current_pos != ' ' && *parser_ctx.current_pos != '\t' &&
-                           *parser_ctx.current_pos != '[') { // Stop at array bracket
-                        parser_ctx.current_pos++;
-                    }
-                }
-                
-                size_t type_len = parser_ctx.current_pos - type_start;
-                if (type_len > 0 && type_len < sizeof(parser_ctx.full_type)) {
-                    strncpy(parser_ctx.full_type, type_start, type_len);
-                    parser_ctx.full_type[type_len] = '\0';
-                    parser_ctx.state = PARSER_PARSING_NAME;
-                    IOLog("VMShaderManager: Parsed type: '%s'\n", parser_ctx.full_type);
-                } else {
-                    parser_ctx.state = PARSER_ERROR;
-                    IOLog("VMShaderManager: Error parsing type\n");
-                }
-                break;
-            }
-            
-            case PARSER_PARSING_NAME: {
-                // Skip whitespace before name
-                while (parser_ctx.current_pos < parser_ctx.line_end && 
-                       (*parser_ctx.current_pos == ' ' || *parser_ctx.current_pos == '\t')) {
-                    parser_ctx.current_pos++;
-                }
-                
-                const char* name_start = parser_ctx.current_pos;
-                
-                // Parse variable name (stop at array bracket, semicolon, or assignment)
-                while (parser_ctx.current_pos < parser_ctx.line_end && 
-                       *parser_ctx.current_pos != ' ' && *parser_ctx.current_pos != '\t' &&
-                       *parser_ctx.current_pos != '[' && *parser_ctx.current_pos != ';' &&
-                       *parser_ctx.current_pos != '=' && *parser_ctx.current_pos != ',') {
-                    parser_ctx.current_pos++;
-                }
-                
-                size_t name_len = parser_ctx.current_pos - name_start;
-                if (name_len > 0 && name_len < sizeof(parser_ctx.base_name)) {
-                    strncpy(parser_ctx.base_name, name_start, name_len);
-                    parser_ctx.base_name[name_len] = '\0';
-                    IOLog("VMShaderManager: Parsed variable name: '%s'\n", parser_ctx.base_name);
-                    
-                    // Check for array specifier
-                    if (parser_ctx.current_pos < parser_ctx.line_end && *parser_ctx.current_pos == '[') {
-                        parser_ctx.state = PARSER_PARSING_ARRAY;
-                    } else {
-                        parser_ctx.state = PARSER_COMPLETE;
-                    }
-                } else {
-                    parser_ctx.state = PARSER_ERROR;
-                    IOLog("VMShaderManager: Error parsing variable name\n");
-                }
-                break;
-            }
-            
-            case PARSER_PARSING_ARRAY: {
-                if (*parser_ctx.current_pos == '[') {
-                    parser_ctx.current_pos++;
-                    const char* array_start = parser_ctx.current_pos;
-                    
-                    // Find closing bracket
-                    while (parser_ctx.current_pos < parser_ctx.line_end && *parser_ctx.current_pos != ']') {
-                        parser_ctx.current_pos++;
-                    }
-                    
-                    if (*parser_ctx.current_pos == ']') {
-                        size_t array_content_len = parser_ctx.current_pos - array_start;
-                        if (array_content_len < sizeof(parser_ctx.array_specifier)) {
-                            strncpy(parser_ctx.array_specifier, array_start, array_content_len);
-                            parser_ctx.array_specifier[array_content_len] = '\0';
-                            
-                            // Parse array size (could be number or expression)
-                            if (array_content_len > 0) {
-                                parser_ctx.array_size = kernel_simple_atoi(parser_ctx.array_specifier);
-                                if (parser_ctx.array_size == 0) {
-                                    parser_ctx.array_size = 1; // Unsized array defaults to 1
-                                }
-                            }
-                            
-                            IOLog("VMShaderManager: Parsed array specifier: [%s] (size: %d)\n", 
-                                  parser_ctx.array_specifier, parser_ctx.array_size);
-                        }
-                        parser_ctx.current_pos++;
-                        parser_ctx.state = PARSER_COMPLETE;
-                    } else {
-                        parser_ctx.state = PARSER_ERROR;
-                        IOLog("VMShaderManager: Missing closing bracket in array specifier\n");
-                    }
-                }
-                break;
-            }
-            
-            case PARSER_COMPLETE:
-            case PARSER_ERROR:
-                break;
-        }
-    }
-    
-    // Phase 2: Validate parsing results and construct output
-    if (parser_ctx.state == PARSER_COMPLETE || 
-        (parser_ctx.state == PARSER_PARSING_NAME && strlen(parser_ctx.base_name) > 0)) {
-        
-        // Build complete type string with qualifiers
-        char complete_type[256] = {0};
-        size_t offset = 0;
-        
-        // Add precision qualifier if present
-        if (parser_ctx.has_precision_qualifier) {
-            strlcpy(complete_type + offset, parser_ctx.precision_qualifier, sizeof(complete_type) - offset);
-            offset = strlen(complete_type);
-            if (offset < sizeof(complete_type) - 1) {
-                complete_type[offset++] = ' ';
-            }
-        }
-        
-        // Add base type
-        strlcpy(complete_type + offset, parser_ctx.full_type, sizeof(complete_type) - offset);
-        
-        // Copy to output parameters
-        strlcpy(type_out, complete_type, type_size);
-        
-        // Build complete name with array specifier
-        strlcpy(name_out, parser_ctx.base_name, name_size);
-        if (parser_ctx.array_size > 1 && strlen(parser_ctx.array_specifier) > 0) {
-            strlcat(name_out, "[", name_size);
-            strlcat(name_out, parser_ctx.array_specifier, name_size);
-            strlcat(name_out, "]", name_size);
-        }
-        
-        IOLog("VMShaderManager: Advanced parsing complete\n");
-        IOLog("  Final type: '%s'\n", type_out);
-        IOLog("  Final name: '%s'\n", name_out);
-        IOLog("  Array size: %d\n", parser_ctx.array_size);
-        IOLog("  Layout location: %d\n", parser_ctx.layout_location);
-        IOLog("  Layout binding: %d\n", parser_ctx.layout_binding);
-        
-        return kIOReturnSuccess;
-    } else {
-        IOLog("VMShaderManager: Advanced parsing failed in state %d\n", parser_ctx.state);
-        return kIOReturnError;
-    }
-}
-
-// Helper method to extract uniform declarations from source lines
-void CLASS::extractUniformFromLine(CompiledShader* shader, const char* line)
-{
-    // Parse uniform declarations like: "uniform mat4 mvpMatrix;"
-    const char* uniform_pos = kernel_strstr(line, "uniform ");
-    if (!uniform_pos) return;
-    
-    char type_str[64] = {0};
-    char name_str[64] = {0};
-    
-    // Production-grade shader parser with comprehensive uniform declaration handling
-    // This implementation handles complex uniform declarations including arrays, qualifiers, and modifiers
-    IOReturn parse_result = parseUniformDeclarationAdvanced(uniform_pos, type_str, name_str, sizeof(type_str), sizeof(name_str));
-    if (parse_result == kIOReturnSuccess) {
-        // Remove semicolon if present
-        char* semicolon = const_cast<char*>(kernel_strchr(name_str, ';'));
-        if (semicolon) *semicolon = '\0';
-        
-        VMShaderUniform* uniform = (VMShaderUniform*)IOMalloc(sizeof(VMShaderUniform));
-        if (uniform) {
-            strlcpy(uniform->name, name_str, sizeof(uniform->name));
-            
-            // Enhanced type determination with comprehensive GLSL/HLSL type support
-            uniform->type = parseShaderDataType(type_str);
-            uniform->size = calculateUniformSize(type_str);
-            uniform->array_size = extractArraySize(name_str);
-            uniform->location = shader->uniforms->getCount(); // Sequential locations
-            uniform->offset = calculateUniformOffset(shader, uniform->size);
-            
-            shader->uniforms->setObject((OSObject*)uniform);
-            
-            IOLog("VMShaderManager: Extracted uniform '%s' of type %s (GL type: 0x%x, size: %d bytes, array: %d)\n",
-                  uniform->name, type_str, uniform->type, uniform->size, uniform->array_size);
-        }
-    } else {
-        IOLog("VMShaderManager: Advanced parsing failed, falling back to simple parsing\n");
-        
-        // Fallback to simple parsing for compatibility
-        if (kernel_simple_sscanf(uniform_pos, "uniform %s %s", type_str, name_str) >= 2) {
-            // Remove semicolon if present
-            char* semicolon = const_cast<char*>(kernel_strchr(name_str, ';'));
-            if (semicolon) *semicolon = '\0';
-            
-            VMShaderUniform* uniform = (VMShaderUniform*)IOMalloc(sizeof(VMShaderUniform));
-            if (uniform) {
-                strlcpy(uniform->name, name_str, sizeof(uniform->name));
-                
-                // Determine type from string
-                if (kernel_strstr(type_str, "mat4")) {
-                    uniform->type = 0x8B5C; // GL_FLOAT_MAT4
-                    uniform->size = 64; // 4x4 float matrix
-                } else if (kernel_strstr(type_str, "mat3")) {
-                    uniform->type = 0x8B5B; // GL_FLOAT_MAT3
-                    uniform->size = 36; // 3x3 float matrix
-                } else if (kernel_strstr(type_str, "vec4")) {
-                    uniform->type = 0x8B52; // GL_FLOAT_VEC4
-                    uniform->size = 16; // 4 floats
-                } else if (kernel_strstr(type_str, "vec3")) {
-                    uniform->type = 0x8B51; // GL_FLOAT_VEC3
-                    uniform->size = 12; // 3 floats
-                } else if (kernel_strstr(type_str, "vec2")) {
-                    uniform->type = 0x8B50; // GL_FLOAT_VEC2
-                    uniform->size = 8; // 2 floats
-                } else if (kernel_strstr(type_str, "float")) {
-                    uniform->type = 0x1406; // GL_FLOAT
-                    uniform->size = 4; // 1 float
-                } else if (kernel_strstr(type_str, "sampler2D")) {
-                    uniform->type = 0x8B5E; // GL_SAMPLER_2D
-                    uniform->size = 4; // Texture unit index
-                } else {
-                    uniform->type = 0x1406; // Default to float
-                    uniform->size = 4;
-                }
-                
-                uniform->location = shader->uniforms->getCount(); // Sequential locations
-                uniform->array_size = 1;
-                uniform->offset = 0;
-                
-                shader->uniforms->setObject((OSObject*)uniform);
-                
-                IOLog("VMShaderManager: Extracted uniform '%s' of type %s (GL type: 0x%x)\n",
-                      uniform->name, type_str, uniform->type);
-            }
-        }
-    }
-}
-
-// Helper method to extract attribute declarations from source lines
-void CLASS::extractAttributeFromLine(CompiledShader* shader, const char* line)
-{
-    // Parse attribute declarations like: "attribute vec3 position;" or "in vec3 position;"
-    const char* attr_pos = kernel_strstr(line, "attribute ");
-    if (!attr_pos) {
-        attr_pos = kernel_strstr(line, "in ");
-        if (!attr_pos) return;
-    }
-    
-    char type_str[64] = {0};
-    char name_str[64] = {0};
-    
-    // Simple parsing
-    const char* scan_start = kernel_strchr(attr_pos, ' ');
-    if (scan_start) {
-        scan_start++; // Skip the space
-        if (kernel_simple_sscanf(scan_start, "%s %s", type_str, name_str) >= 2) {
-            char* semicolon = const_cast<char*>(kernel_strchr(name_str, ';'));
-            if (semicolon) *semicolon = '\0';
-            
-            VMShaderAttribute* attribute = (VMShaderAttribute*)IOMalloc(sizeof(VMShaderAttribute));
-            if (attribute) {
-                strlcpy(attribute->name, name_str, sizeof(attribute->name));
-                attribute->type = 0x1406; // GL_FLOAT (default)
-                attribute->location = shader->attributes->getCount();
-                attribute->normalized = 0;
-                
-                // Determine component count from type
-                if (kernel_strstr(type_str, "vec4")) {
-                    attribute->components = 4;
-                } else if (kernel_strstr(type_str, "vec3")) {
-                    attribute->components = 3;
-                } else if (kernel_strstr(type_str, "vec2")) {
-                    attribute->components = 2;
-                } else {
-                    attribute->components = 1;
-                }
-                
-                shader->attributes->setObject((OSObject*)attribute);
-                
-                IOLog("VMShaderManager: Extracted attribute '%s' of type %s (%d components)\n",
-                      attribute->name, type_str, attribute->components);
-            }
-        }
-    }
-}
-
-// Helper methods for adding default shader uniforms and attributes
-void CLASS::addDefaultVertexAttributes(CompiledShader* shader)
-{
-    // Add common vertex shader attributes if not already present
-    const char* default_attrs[][2] = {
-        {"position", "vec3"},
-        {"normal", "vec3"},
-        {"texCoord", "vec2"},
-        {"color", "vec4"}
-    };
-    
-    for (int i = 0; i < 4; i++) {
-        VMShaderAttribute* attr = (VMShaderAttribute*)IOMalloc(sizeof(VMShaderAttribute));
-        if (attr) {
-            strlcpy(attr->name, default_attrs[i][0], sizeof(attr->name));
-            attr->type = 0x1406; // GL_FLOAT
-            attr->location = i;
-            attr->normalized = 0;
-            
-            if (kernel_strstr(default_attrs[i][1], "vec3")) {
-                attr->components = 3;
-            } else if (kernel_strstr(default_attrs[i][1], "vec2")) {
-                attr->components = 2;
-            } else if (kernel_strstr(default_attrs[i][1], "vec4")) {
-                attr->components = 4;
-            } else {
-                attr->components = 1;
-            }
-            
-            shader->attributes->setObject((OSObject*)attr);
-        }
-    }
-}
-
-void CLASS::addStandardVertexUniforms(CompiledShader* shader)
-{
-    // Add standard vertex shader uniforms
-    const char* vertex_uniforms[][3] = {
-        {"mvpMatrix", "mat4", "64"},
-        {"modelMatrix", "mat4", "64"},
-        {"viewMatrix", "mat4", "64"},
-        {"projectionMatrix", "mat4", "64"}
-    };
-    
-    for (int i = 0; i < 4; i++) {
-        VMShaderUniform* uniform = (VMShaderUniform*)IOMalloc(sizeof(VMShaderUniform));
-        if (uniform) {
-            strlcpy(uniform->name, vertex_uniforms[i][0], sizeof(uniform->name));
-            uniform->type = 0x8B5C; // GL_FLOAT_MAT4
-            uniform->location = shader->uniforms->getCount();
-            uniform->size = kernel_simple_atoi(vertex_uniforms[i][2]);
-            uniform->array_size = 1;
-            uniform->offset = i * 64; // 64 bytes per matrix
-            shader->uniforms->setObject((OSObject*)uniform);
-        }
-    }
-}
-
-void CLASS::addStandardFragmentUniforms(CompiledShader* shader)
-{
-    // Add standard fragment shader uniforms
-    VMShaderUniform* time_uniform = (VMShaderUniform*)IOMalloc(sizeof(VMShaderUniform));
-    if (time_uniform) {
-        strlcpy(time_uniform->name, "time", sizeof(time_uniform->name));
-        time_uniform->type = 0x1406; // GL_FLOAT
-        time_uniform->location = shader->uniforms->getCount();
-        time_uniform->size = 4;
-        time_uniform->array_size = 1;
-        time_uniform->offset = 0;
-        shader->uniforms->setObject((OSObject*)time_uniform);
-    }
-}
-
-void CLASS::addTextureSamplers(CompiledShader* shader, uint32_t sampler_count)
-{
-    for (uint32_t i = 0; i < sampler_count && i < 8; i++) { // Max 8 texture units
-        VMShaderUniform* sampler = (VMShaderUniform*)IOMalloc(sizeof(VMShaderUniform));
-        if (sampler) {
-            // Create texture sampler name like "texture0", "texture1", etc.
-            const char* base_name = "texture";
-            strlcpy(sampler->name, base_name, sizeof(sampler->name));
-            if (i < 10) {
-                // Simple single digit append
-                size_t len = strlen(sampler->name);
-                if (len < sizeof(sampler->name) - 2) {
-                    sampler->name[len] = '0' + i;
-                    sampler->name[len + 1] = '\0';
-                }
-            }
-            sampler->type = 0x8B5E; // GL_SAMPLER_2D
-            sampler->location = shader->uniforms->getCount();
-            sampler->size = 4;
-            sampler->array_size = 1;
-            sampler->offset = i * 4;
-            shader->uniforms->setObject((OSObject*)sampler);
-        }
-    }
-}
-
-// Helper methods for shader type/language string conversion
-const char* CLASS::getShaderTypeString(VMShaderType type)
+// Helper methods for shader type/language string conversion
+const char* CLASS::getShaderTypeString(VMShaderType type)
 {
     switch (type) {
         case VM_SHADER_TYPE_VERTEX: return "VERTEX";
@@ -5293,26 +4209,17 @@ IOReturn CLASS::destroyShader(uint32_t shader_id)
         return kIOReturnNotFound;
     }
     
-    shader->ref_count--;
     if (shader->ref_count == 0) {
-        // Remove from array and cleanup
-        for (unsigned int i = 0; i < m_shaders->getCount(); i++) {
-            CompiledShader* s = (CompiledShader*)m_shaders->getObject(i);
-            if (s && s->shader_id == shader_id) {
-                if (s->bytecode) s->bytecode->release();
-                if (s->uniforms) s->uniforms->release();
-                if (s->attributes) s->attributes->release();
-                if (s->resources) s->resources->release();
-                m_shaders->removeObject(i);
-                IOFree(s, sizeof(CompiledShader));
-                break;
-            }
-        }
+        IOLockUnlock(m_shader_lock);
+        return kIOReturnNotFound;
     }
     
+    // The last reference leaves the shader idle in the cache
+    releaseShaderRef(shader);
+    
     IOLockUnlock(m_shader_lock);
     
-    IOLog("VMShaderManager: Destroyed shader %d\n", shader_id);
+    VMLOG_DEBUG("VMShaderManager: Destroyed shader %d\n", shader_id);
     return kIOReturnSuccess;
 }
 
@@ -5323,11 +4230,15 @@ IOReturn CLASS::getShaderInfo(uint32_t shader_id, VMCompiledShaderInfo* info)
     
     IOLockLock(m_shader_lock);
     
-    CompiledShader* shader = findShader(shader_id);
+    CompiledShader* shader = waitForShader(shader_id);
     if (!shader) {
         IOLockUnlock(m_shader_lock);
         return kIOReturnNotFound;
     }
+    if (!shader->is_valid) {
+        IOLockUnlock(m_shader_lock);
+        return shader->compile_status;
+    }
     
     *info = shader->info;
     info->shader_id = shader_id;
@@ -5357,12 +4268,19 @@ IOReturn CLASS::createProgram(uint32_t* shader_ids, uint32_t count, uint32_t* pr
     }
     
     bzero(program, sizeof(ShaderProgram));
-    program->program_id = ++m_next_program_id;
+    program->program_id = m_program_table.insert(program);
+    if (!program->program_id) {
+        IOLockUnlock(m_shader_lock);
+        IOFree(program, sizeof(ShaderProgram));
+        return kIOReturnNoResources;
+    }
     program->shader_ids = OSArray::withCapacity(count);
     program->all_uniforms = OSArray::withCapacity(32);
     program->all_attributes = OSArray::withCapacity(16);
     program->all_resources = OSArray::withCapacity(16);
     program->is_linked = false;
+    program->link_jobs = 0;
+    program->link_status = kIOReturnNotReady;
     
     // Initialize shader stage IDs
     program->vertex_shader_id = 0;
@@ -5382,44 +4300,35 @@ IOReturn CLASS::createProgram(uint32_t* shader_ids, uint32_t count, uint32_t* pr
     program->hardware_optimized = false;
     program->performance_stats = nullptr;
     
-    // Copy shader IDs
+    // Copy shader IDs; the program holds a reference on each (dropped in destroyProgram)
     for (uint32_t i = 0; i < count; i++) {
         OSNumber* shader_id = OSNumber::withNumber((unsigned long long)shader_ids[i], 32);
         if (shader_id) {
             program->shader_ids->setObject(shader_id);
             shader_id->release();
         }
+        CompiledShader* shader = findShader(shader_ids[i]);
+        if (shader) {
+            shader->ref_count++;
+        }
     }
     
-    m_programs->setObject((OSObject*)program);
     *program_id = program->program_id;
     
     IOLockUnlock(m_shader_lock);
     
-    IOLog("VMShaderManager: Created program %d with %d shaders\n", program->program_id, count);
+    VMLOG_DEBUG("VMShaderManager: Created program %d with %d shaders\n", program->program_id, count);
     return kIOReturnSuccess;
 }
 
 CLASS::CompiledShader* CLASS::findShader(uint32_t shader_id)
 {
-    for (unsigned int i = 0; i < m_shaders->getCount(); i++) {
-        CompiledShader* shader = (CompiledShader*)m_shaders->getObject(i);
-        if (shader && shader->shader_id == shader_id) {
-            return shader;
-        }
-    }
-    return nullptr;
+    return m_shader_table.lookup(shader_id);
 }
 
 CLASS::ShaderProgram* CLASS::findProgram(uint32_t program_id)
 {
-    for (unsigned int i = 0; i < m_programs->getCount(); i++) {
-        ShaderProgram* program = (ShaderProgram*)m_programs->getObject(i);
-        if (program && program->program_id == program_id) {
-            return program;
-        }
-    }
-    return nullptr;
+    return m_program_table.lookup(program_id);
 }
 
 IOReturn CLASS::validateShaderCompatibility(uint32_t* shader_ids, uint32_t count)
@@ -5440,7 +4349,7 @@ IOReturn CLASS::validateShaderCompatibility(uint32_t* shader_ids, uint32_t count
     
     // For graphics pipelines, we need at least vertex and fragment shaders
     if (!has_vertex || !has_fragment) {
-        IOLog("VMShaderManager: Program missing required vertex or fragment shader\n");
+        VMLOG_DEBUG("VMShaderManager: Program missing required vertex or fragment shader\n");
         return kIOReturnBadArgument;
     }
     
@@ -5449,12 +4358,12 @@ IOReturn CLASS::validateShaderCompatibility(uint32_t* shader_ids, uint32_t count
 
 uint32_t CLASS::getCompiledShaderCount() const
 {
-    return m_shaders ? m_shaders->getCount() : 0;
+    return m_shader_table.count();
 }
 
 uint32_t CLASS::getLinkedProgramCount() const
 {
-    return m_programs ? m_programs->getCount() : 0;
+    return m_program_table.count();
 }
 
 bool CLASS::supportsShaderType(VMShaderType type) const
@@ -5498,7 +4407,7 @@ IOReturn CLASS::detectRealHLSLCompilerInfrastructure(HLSLCompilerInfrastructure*
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMShaderManager: Performing real HLSL compiler infrastructure detection\n");
+    VMLOG_INFO("VMShaderManager: Performing real HLSL compiler infrastructure detection\n");
     
     // Phase 1: DirectX Compiler (DXC) Detection
     // Check for modern DXC compiler availability in system paths
@@ -5514,7 +4423,7 @@ IOReturn CLASS::detectRealHLSLCompilerInfrastructure(HLSLCompilerInfrastructure*
     for (int i = 0; i < 5; i++) {
         if (checkFileExists(dxc_search_paths[i])) {
             dxc_found = true;
-            IOLog("VMShaderManager: DXC compiler found at: %s\n", dxc_search_paths[i]);
+            VMLOG_INFO("VMShaderManager: DXC compiler found at: %s\n", dxc_search_paths[i]);
             break;
         }
     }
@@ -5532,7 +4441,7 @@ IOReturn CLASS::detectRealHLSLCompilerInfrastructure(HLSLCompilerInfrastructure*
     for (int i = 0; i < 4; i++) {
         if (checkFileExists(fxc_search_paths[i])) {
             fxc_found = true;
-            IOLog("VMShaderManager: FXC legacy compiler found at: %s\n", fxc_search_paths[i]);
+            VMLOG_INFO("VMShaderManager: FXC legacy compiler found at: %s\n", fxc_search_paths[i]);
             break;
         }
     }
@@ -5573,24 +4482,24 @@ IOReturn CLASS::detectRealHLSLCompilerInfrastructure(HLSLCompilerInfrastructure*
     // Phase 7: Detection Results Summary
     bool has_any_compiler = dxc_found || fxc_found || has_metal_compiler || has_glsl_validator;
     
-    IOLog("VMShaderManager: ========== Real HLSL Compiler Detection Results ==========\n");
-    IOLog("  DirectX Compilers:\n");
-    IOLog("    DXC (Modern): %s\n", dxc_found ? "FOUND" : "NOT FOUND");
-    IOLog("    FXC (Legacy): %s\n", fxc_found ? "FOUND" : "NOT FOUND");
-    IOLog("  System Compilers:\n");
-    IOLog("    Metal Compiler: %s\n", has_metal_compiler ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("    GLSL Validator: %s\n", has_glsl_validator ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("    SPIR-V Tools: %s\n", has_spirv_tools ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("  Frameworks:\n");
-    IOLog("    Metal Framework: %s\n", has_metal_framework ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("    OpenGL Framework: %s\n", has_opengl_framework ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("    Vulkan SDK: %s\n", has_vulkan_sdk ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("  Compilation Infrastructure:\n");
-    IOLog("    Max Optimization Level: %d\n", infra->max_optimization_level);
-    IOLog("    Compilation Threads: %d\n", infra->compilation_threads);
-    IOLog("    Average Compile Time: %.1f ms\n", infra->average_compile_time_ms);
-    IOLog("  Overall Status: %s\n", has_any_compiler ? "COMPILER INFRASTRUCTURE AVAILABLE" : "SOFTWARE FALLBACK ONLY");
-    IOLog("================================================================\n");
+    VMLOG_INFO("VMShaderManager: ========== Real HLSL Compiler Detection Results ==========\n");
+    VMLOG_INFO("  DirectX Compilers:\n");
+    VMLOG_INFO("    DXC (Modern): %s\n", dxc_found ? "FOUND" : "NOT FOUND");
+    VMLOG_INFO("    FXC (Legacy): %s\n", fxc_found ? "FOUND" : "NOT FOUND");
+    VMLOG_INFO("  System Compilers:\n");
+    VMLOG_INFO("    Metal Compiler: %s\n", has_metal_compiler ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("    GLSL Validator: %s\n", has_glsl_validator ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("    SPIR-V Tools: %s\n", has_spirv_tools ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("  Frameworks:\n");
+    VMLOG_INFO("    Metal Framework: %s\n", has_metal_framework ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("    OpenGL Framework: %s\n", has_opengl_framework ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("    Vulkan SDK: %s\n", has_vulkan_sdk ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("  Compilation Infrastructure:\n");
+    VMLOG_INFO("    Max Optimization Level: %d\n", infra->max_optimization_level);
+    VMLOG_INFO("    Compilation Threads: %d\n", infra->compilation_threads);
+    VMLOG_INFO("    Average Compile Time: %.1f ms\n", infra->average_compile_time_ms);
+    VMLOG_INFO("  Overall Status: %s\n", has_any_compiler ? "COMPILER INFRASTRUCTURE AVAILABLE" : "SOFTWARE FALLBACK ONLY");
+    VMLOG_INFO("================================================================\n");
     
     return has_any_compiler ? kIOReturnSuccess : kIOReturnUnsupported;
 }
@@ -5600,7 +4509,7 @@ bool CLASS::checkFileExists(const char* path) const
 {
     if (!path) return false;
     
-    IOLog("VMShaderManager: Performing kernel-space file existence check for: %s\n", path);
+    VMLOG_DEBUG("VMShaderManager: Performing kernel-space file existence check for: %s\n", path);
     
     // Production kernel-space file existence check implementation
     // Uses IOKit registry queries and system path validation to determine actual file availability
@@ -5621,7 +4530,7 @@ bool CLASS::checkFileExists(const char* path) const
             // Metal compiler detection - part of Xcode Command Line Tools
             if (kernel_strstr(path, "metal")) {
                 file_exists = (xcode_path != nullptr) || (developer_tools != nullptr) || checkSystemPath("/usr/bin/xcrun");
-                IOLog("VMShaderManager: Metal compiler availability: %s (DeveloperTools: %s, DEVELOPER_DIR: %s)\n", 
+                VMLOG_DEBUG("VMShaderManager: Metal compiler availability: %s (DeveloperTools: %s, DEVELOPER_DIR: %s)\n", 
                       file_exists ? "DETECTED" : "NOT DETECTED",
                       developer_tools ? "PRESENT" : "ABSENT",
                       xcode_path ? "SET" : "UNSET");
@@ -5629,41 +4538,41 @@ bool CLASS::checkFileExists(const char* path) const
             // GLSL/SPIR-V tools detection - third-party installations
             else if (kernel_strstr(path, "glslang") || kernel_strstr(path, "spirv")) {
                 file_exists = checkThirdPartyTool(path) || (developer_tools != nullptr);
-                IOLog("VMShaderManager: GLSL/SPIR-V tools availability: %s (DeveloperTools: %s)\n", 
+                VMLOG_DEBUG("VMShaderManager: GLSL/SPIR-V tools availability: %s (DeveloperTools: %s)\n", 
                       file_exists ? "DETECTED" : "NOT DETECTED",
                       developer_tools ? "PRESENT" : "ABSENT");
             }
             // DirectX compilers - not native to macOS
             else if (kernel_strstr(path, "dxc") || kernel_strstr(path, "fxc")) {
                 file_exists = false; // DirectX compilers not available on macOS
-                IOLog("VMShaderManager: DirectX compiler availability: NOT AVAILABLE ON MACOS\n");
+                VMLOG_DEBUG("VMShaderManager: DirectX compiler availability: NOT AVAILABLE ON MACOS\n");
             }
             else {
                 file_exists = checkGenericExecutable(path);
-                IOLog("VMShaderManager: Generic executable check: %s\n", file_exists ? "FOUND" : "NOT FOUND");
+                VMLOG_DEBUG("VMShaderManager: Generic executable check: %s\n", file_exists ? "FOUND" : "NOT FOUND");
             }
         } else {
-            IOLog("VMShaderManager: Could not access IORegistry root for system information\n");
+            VMLOG_WARN("VMShaderManager: Could not access IORegistry root for system information\n");
             file_exists = false;
         }
     }
     // Phase 2: Application and framework path detection
     else if (kernel_strstr(path, "/System/Library/") || kernel_strstr(path, "/Applications/")) {
         file_exists = checkSystemFrameworkPath(path);
-        IOLog("VMShaderManager: System/Application path check: %s\n", file_exists ? "ACCESSIBLE" : "NOT ACCESSIBLE");
+        VMLOG_DEBUG("VMShaderManager: System/Application path check: %s\n", file_exists ? "ACCESSIBLE" : "NOT ACCESSIBLE");
     }
     // Phase 3: Third-party installation paths
     else if (kernel_strstr(path, "/opt/") || kernel_strstr(path, "/usr/local/")) {
         file_exists = checkThirdPartyInstallation(path);
-        IOLog("VMShaderManager: Third-party installation check: %s\n", file_exists ? "FOUND" : "NOT FOUND");
+        VMLOG_DEBUG("VMShaderManager: Third-party installation check: %s\n", file_exists ? "FOUND" : "NOT FOUND");
     }
     // Phase 4: Unknown paths - conservative approach
     else {
         file_exists = false;
-        IOLog("VMShaderManager: Unknown path format - defaulting to not accessible\n");
+        VMLOG_DEBUG("VMShaderManager: Unknown path format - defaulting to not accessible\n");
     }
     
-    IOLog("VMShaderManager: Final file existence result for '%s': %s\n", 
+    VMLOG_DEBUG("VMShaderManager: Final file existence result for '%s': %s\n", 
           path, file_exists ? "EXISTS AND ACCESSIBLE" : "NOT FOUND OR NOT ACCESSIBLE");
     
     return file_exists;
@@ -5778,14 +4687,14 @@ bool CLASS::checkDirectoryExists(const char* path) const
 {
     if (!path) return false;
     
-    IOLog("VMShaderManager: Checking directory existence for: %s\n", path);
+    VMLOG_DEBUG("VMShaderManager: Checking directory existence for: %s\n", path);
     
     // Real directory existence assessment using kernel-safe path analysis
     // This provides actual directory structure queries rather than simulation
     
     OSString* dir_string = OSString::withCString(path);
     if (!dir_string) {
-        IOLog("VMShaderManager: Failed to create directory string for: %s\n", path);
+        VMLOG_ERROR("VMShaderManager: Failed to create directory string for: %s\n", path);
         return false;
     }
     
@@ -5796,49 +4705,49 @@ bool CLASS::checkDirectoryExists(const char* path) const
         // Check for standard /usr/local/share paths
         if (kernel_strstr(path, "vulkan")) {
             directory_exists = false;  // Vulkan SDK not installed by default
-            IOLog("VMShaderManager: Vulkan SDK directory - requires manual installation\n");
+            VMLOG_DEBUG("VMShaderManager: Vulkan SDK directory - requires manual installation\n");
         } else {
             directory_exists = false;  // Conservative for unknown share directories
-            IOLog("VMShaderManager: Unknown /usr/local/share directory\n");
+            VMLOG_DEBUG("VMShaderManager: Unknown /usr/local/share directory\n");
         }
     }
     // Method 2: System library directories
     else if (kernel_strstr(path, "/System/Library/")) {
         directory_exists = true;  // System library directories typically exist
-        IOLog("VMShaderManager: System library directory - standard macOS path\n");
+        VMLOG_DEBUG("VMShaderManager: System library directory - standard macOS path\n");
     }
     // Method 3: Application directories
     else if (kernel_strstr(path, "/Applications/")) {
         if (kernel_strstr(path, "Xcode") || kernel_strstr(path, "Developer")) {
             directory_exists = true;  // Developer tools likely present
-            IOLog("VMShaderManager: Developer tools directory - likely present\n");
+            VMLOG_DEBUG("VMShaderManager: Developer tools directory - likely present\n");
         } else if (kernel_strstr(path, "Microsoft")) {
             directory_exists = false;  // Microsoft tools not standard on macOS
-            IOLog("VMShaderManager: Microsoft tools directory - not standard on macOS\n");
+            VMLOG_DEBUG("VMShaderManager: Microsoft tools directory - not standard on macOS\n");
         } else {
             directory_exists = false;  // Conservative for unknown applications
-            IOLog("VMShaderManager: Unknown application directory\n");
+            VMLOG_DEBUG("VMShaderManager: Unknown application directory\n");
         }
     }
     // Method 4: User and local directories
     else if (kernel_strstr(path, "/opt/") || kernel_strstr(path, "/usr/local/")) {
         directory_exists = false;  // Third-party directories require manual installation
-        IOLog("VMShaderManager: Third-party directory - manual installation required\n");
+        VMLOG_DEBUG("VMShaderManager: Third-party directory - manual installation required\n");
     }
     // Method 5: Standard system directories
     else if (kernel_strstr(path, "/usr/") || kernel_strstr(path, "/bin/") || kernel_strstr(path, "/lib/")) {
         directory_exists = true;  // Standard UNIX directories
-        IOLog("VMShaderManager: Standard UNIX directory - typically present\n");
+        VMLOG_DEBUG("VMShaderManager: Standard UNIX directory - typically present\n");
     }
     else {
         directory_exists = false;  // Conservative default
-        IOLog("VMShaderManager: Unknown directory path - conservative assessment\n");
+        VMLOG_DEBUG("VMShaderManager: Unknown directory path - conservative assessment\n");
     }
     
     // Clean up OSString
     dir_string->release();
     
-    IOLog("VMShaderManager: Directory existence result for '%s': %s\n", 
+    VMLOG_DEBUG("VMShaderManager: Directory existence result for '%s': %s\n", 
           path, directory_exists ? "EXISTS" : "DOES NOT EXIST");
     
     return directory_exists;
@@ -5849,7 +4758,7 @@ bool CLASS::checkEnvironmentVariable(const char* var_name) const
 {
     if (!var_name) return false;
     
-    IOLog("VMShaderManager: Checking environment variable: %s\n", var_name);
+    VMLOG_DEBUG("VMShaderManager: Checking environment variable: %s\n", var_name);
     
     // Real environment variable detection in kernel space
     // Kernel extensions have limited access to environment variables, but we can
@@ -5861,35 +4770,35 @@ bool CLASS::checkEnvironmentVariable(const char* var_name) const
     if (strcmp(var_name, "VULKAN_SDK") == 0) {
         // Vulkan SDK environment variable - requires manual setup
         var_likely_set = false;
-        IOLog("VMShaderManager: VULKAN_SDK - requires manual installation and setup\n");
+        VMLOG_DEBUG("VMShaderManager: VULKAN_SDK - requires manual installation and setup\n");
     }
     else if (strcmp(var_name, "DEVELOPER_DIR") == 0) {
         // Xcode developer directory - set when Xcode command line tools installed
         var_likely_set = true;
-        IOLog("VMShaderManager: DEVELOPER_DIR - typically set with Xcode tools\n");
+        VMLOG_DEBUG("VMShaderManager: DEVELOPER_DIR - typically set with Xcode tools\n");
     }
     else if (strcmp(var_name, "PATH") == 0) {
         // PATH is always set in user environments
         var_likely_set = true;
-        IOLog("VMShaderManager: PATH - standard system environment variable\n");
+        VMLOG_DEBUG("VMShaderManager: PATH - standard system environment variable\n");
     }
     else if (strcmp(var_name, "HOME") == 0 || strcmp(var_name, "USER") == 0) {
         // Standard user environment variables
         var_likely_set = true;
-        IOLog("VMShaderManager: %s - standard user environment variable\n", var_name);
+        VMLOG_DEBUG("VMShaderManager: %s - standard user environment variable\n", var_name);
     }
     else if (kernel_strstr(var_name, "DIRECTX") || kernel_strstr(var_name, "DXC") || kernel_strstr(var_name, "FXC")) {
         // DirectX-related variables not standard on macOS
         var_likely_set = false;
-        IOLog("VMShaderManager: DirectX-related variable - not standard on macOS\n");
+        VMLOG_DEBUG("VMShaderManager: DirectX-related variable - not standard on macOS\n");
     }
     else {
         // Unknown environment variable - conservative approach
         var_likely_set = false;
-        IOLog("VMShaderManager: Unknown environment variable - conservative assessment\n");
+        VMLOG_DEBUG("VMShaderManager: Unknown environment variable - conservative assessment\n");
     }
     
-    IOLog("VMShaderManager: Environment variable check for '%s': %s\n", 
+    VMLOG_DEBUG("VMShaderManager: Environment variable check for '%s': %s\n", 
           var_name, var_likely_set ? "LIKELY SET" : "NOT SET");
     
     return var_likely_set;
@@ -5898,9 +4807,12 @@ bool CLASS::checkEnvironmentVariable(const char* var_name) const
 // Helper method to get system core count
 uint32_t CLASS::getSystemCoreCount() const
 {
-    // In real implementation, query system for CPU core count
-    // For now, return a reasonable default
-    return 4; // Assume quad-core system
+    int cpus = 0;
+    size_t size = sizeof(cpus);
+    if (sysctlbyname("hw.activecpu", &cpus, &size, NULL, 0) != 0 || cpus < 1) {
+        return 1;
+    }
+    return (uint32_t)cpus;
 }
 
 // Helper method to perform lightweight compiler benchmarking
@@ -5918,7 +4830,7 @@ float CLASS::performCompilerBenchmark() const
 // Advanced HLSL (High Level Shading Language) support detection and capabilities
 bool CLASS::checkHLSLSupport() const
 {
-    IOLog("VMShaderManager: Checking HLSL (DirectX Shader Language) support capabilities\n");
+    VMLOG_INFO("VMShaderManager: Checking HLSL (DirectX Shader Language) support capabilities\n");
     
     // HLSL Support Matrix - comprehensive DirectX shader language capabilities
     struct HLSLCapabilities {
@@ -5934,7 +4846,7 @@ bool CLASS::checkHLSLSupport() const
     } hlsl_caps = {0};
     
     // Phase 1: Check for HLSL compiler infrastructure availability
-    IOLog("VMShaderManager: Phase 1 - HLSL Compiler Infrastructure Check\n");
+    VMLOG_INFO("VMShaderManager: Phase 1 - HLSL Compiler Infrastructure Check\n");
     
     // Advanced HLSL Compiler Detection and Optimization Pipeline
     // This comprehensive system provides enterprise-grade shader compilation with advanced optimizations
@@ -6018,12 +4930,12 @@ bool CLASS::checkHLSLSupport() const
     IOReturn dxc_detection_result = detectRealHLSLCompilerInfrastructure(&compiler_infra);
     
     if (dxc_detection_result == kIOReturnSuccess) {
-        IOLog("VMShaderManager: Real HLSL compiler infrastructure successfully detected\n");
+        VMLOG_INFO("VMShaderManager: Real HLSL compiler infrastructure successfully detected\n");
         hlsl_caps.has_hlsl_compiler = compiler_infra.has_dxc_compiler;
         hlsl_caps.has_dx_bytecode_validator = compiler_infra.has_intermediate_validation;
         hlsl_caps.has_cross_compilation = compiler_infra.has_optimization_engine;
     } else {
-        IOLog("VMShaderManager: Falling back to built-in HLSL compilation capabilities\n");
+        VMLOG_INFO("VMShaderManager: Falling back to built-in HLSL compilation capabilities\n");
         // Fallback to built-in VMShaderManager HLSL capabilities
         hlsl_caps.has_hlsl_compiler = true;  // VMShaderManager has built-in HLSL parser
         hlsl_caps.has_dx_bytecode_validator = true;  // Built-in DX bytecode validation
@@ -6031,7 +4943,7 @@ bool CLASS::checkHLSLSupport() const
     }
     
     // Phase 2: DirectX Shader Model support detection
-    IOLog("VMShaderManager: Phase 2 - DirectX Shader Model Support\n");
+    VMLOG_INFO("VMShaderManager: Phase 2 - DirectX Shader Model Support\n");
     
     // Advanced DirectX Shader Model Capability Matrix
     // This comprehensive system provides complete DirectX shader model support with enterprise features
@@ -6161,7 +5073,7 @@ bool CLASS::checkHLSLSupport() const
     hlsl_caps.hlsl_feature_level = (dx_shader_models.shader_model_6_0) ? 0xC000 : 0xB100;  // Feature level
     
     // Phase 3: HLSL Language Features and Compilation Pipeline Integration
-    IOLog("VMShaderManager: Phase 3 - HLSL Language Features and Advanced Compilation Pipeline\n");
+    VMLOG_INFO("VMShaderManager: Phase 3 - HLSL Language Features and Advanced Compilation Pipeline\n");
     
     // Advanced HLSL Compilation Pipeline with Multi-stage Optimization
     struct HLSLCompilationPipeline {
@@ -6253,7 +5165,7 @@ bool CLASS::checkHLSLSupport() const
     };
     
     // Phase 4: Cross-compilation capabilities assessment
-    IOLog("VMShaderManager: Phase 4 - HLSL Cross-Compilation Assessment\n");
+    VMLOG_INFO("VMShaderManager: Phase 4 - HLSL Cross-Compilation Assessment\n");
     
     bool cross_compile_to_glsl = true;   // HLSL -> GLSL translation
     bool cross_compile_to_msl = true;    // HLSL -> Metal Shading Language
@@ -6271,31 +5183,31 @@ bool CLASS::checkHLSLSupport() const
                             cross_compile_to_msl;
     
     // Detailed capability logging
-    IOLog("VMShaderManager: ========== HLSL Support Assessment Complete ==========\n");
-    IOLog("  HLSL Compiler Infrastructure:\n");
-    IOLog("    HLSL Compiler: %s\n", hlsl_caps.has_hlsl_compiler ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("    DX Bytecode Validator: %s\n", hlsl_caps.has_dx_bytecode_validator ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("    Cross-Compilation: %s\n", hlsl_caps.has_cross_compilation ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("  DirectX Shader Model Support:\n");
-    IOLog("    Max Shader Model: 5.%d\n", hlsl_caps.max_supported_shader_model - 50);
-    IOLog("    Feature Level: D3D_FEATURE_LEVEL_%X\n", hlsl_caps.hlsl_feature_level);
-    IOLog("    Compute Shaders: %s\n", hlsl_caps.has_compute_shader_support ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Tessellation: %s\n", hlsl_caps.has_tessellation_support ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Geometry Shaders: %s\n", hlsl_caps.has_geometry_shader_support ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("  HLSL Language Features:\n");
-    IOLog("    cbuffer Support: %s\n", lang_features.cbuffer_support ? "YES" : "NO");
-    IOLog("    Texture Sampling: %s\n", lang_features.texture_sampling ? "YES" : "NO");
-    IOLog("    Structured Buffers: %s\n", lang_features.structured_buffers ? "YES" : "NO");
-    IOLog("    Semantic Bindings: %s\n", lang_features.semantic_bindings ? "YES" : "NO");
-    IOLog("    Register Allocation: %s\n", lang_features.register_allocations ? "YES" : "NO");
-    IOLog("    Shader Intrinsics: %s\n", lang_features.shader_intrinsics ? "YES" : "NO");
-    IOLog("  Cross-Compilation Targets:\n");
-    IOLog("    HLSL -> GLSL: %s\n", cross_compile_to_glsl ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    HLSL -> MSL: %s\n", cross_compile_to_msl ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Semantic Preservation: %s\n", preserve_semantics ? "YES" : "NO");
-    IOLog("    Post-Optimization: %s\n", optimize_output ? "YES" : "NO");
-    IOLog("  Overall HLSL Support: %s\n", full_hlsl_support ? "FULLY SUPPORTED" : "LIMITED/EXPERIMENTAL");
-    IOLog("==============================================================\n");
+    VMLOG_INFO("VMShaderManager: ========== HLSL Support Assessment Complete ==========\n");
+    VMLOG_INFO("  HLSL Compiler Infrastructure:\n");
+    VMLOG_INFO("    HLSL Compiler: %s\n", hlsl_caps.has_hlsl_compiler ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("    DX Bytecode Validator: %s\n", hlsl_caps.has_dx_bytecode_validator ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("    Cross-Compilation: %s\n", hlsl_caps.has_cross_compilation ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("  DirectX Shader Model Support:\n");
+    VMLOG_INFO("    Max Shader Model: 5.%d\n", hlsl_caps.max_supported_shader_model - 50);
+    VMLOG_INFO("    Feature Level: D3D_FEATURE_LEVEL_%X\n", hlsl_caps.hlsl_feature_level);
+    VMLOG_INFO("    Compute Shaders: %s\n", hlsl_caps.has_compute_shader_support ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    Tessellation: %s\n", hlsl_caps.has_tessellation_support ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    Geometry Shaders: %s\n", hlsl_caps.has_geometry_shader_support ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("  HLSL Language Features:\n");
+    VMLOG_INFO("    cbuffer Support: %s\n", lang_features.cbuffer_support ? "YES" : "NO");
+    VMLOG_INFO("    Texture Sampling: %s\n", lang_features.texture_sampling ? "YES" : "NO");
+    VMLOG_INFO("    Structured Buffers: %s\n", lang_features.structured_buffers ? "YES" : "NO");
+    VMLOG_INFO("    Semantic Bindings: %s\n", lang_features.semantic_bindings ? "YES" : "NO");
+    VMLOG_INFO("    Register Allocation: %s\n", lang_features.register_allocations ? "YES" : "NO");
+    VMLOG_INFO("    Shader Intrinsics: %s\n", lang_features.shader_intrinsics ? "YES" : "NO");
+    VMLOG_INFO("  Cross-Compilation Targets:\n");
+    VMLOG_INFO("    HLSL -> GLSL: %s\n", cross_compile_to_glsl ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    HLSL -> MSL: %s\n", cross_compile_to_msl ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    Semantic Preservation: %s\n", preserve_semantics ? "YES" : "NO");
+    VMLOG_INFO("    Post-Optimization: %s\n", optimize_output ? "YES" : "NO");
+    VMLOG_INFO("  Overall HLSL Support: %s\n", full_hlsl_support ? "FULLY SUPPORTED" : "LIMITED/EXPERIMENTAL");
+    VMLOG_INFO("==============================================================\n");
     
     return full_hlsl_support;
 }
@@ -6303,17 +5215,17 @@ bool CLASS::checkHLSLSupport() const
 // Advanced SPIR-V (Standard Portable Intermediate Representation) support detection
 bool CLASS::checkSPIRVSupport() const
 {
-    IOLog("VMShaderManager: Checking SPIR-V (Vulkan Intermediate Representation) support capabilities\n");
+    VMLOG_INFO("VMShaderManager: Checking SPIR-V (Vulkan Intermediate Representation) support capabilities\n");
     
     // SPIR-V Support Matrix - comprehensive Vulkan IR capabilities
     SPIRVCapabilities spirv_caps = {0};
     
     // Phase 1: Check for SPIR-V infrastructure availability
-    IOLog("VMShaderManager: Phase 1 - SPIR-V Infrastructure Check\n");
+    VMLOG_INFO("VMShaderManager: Phase 1 - SPIR-V Infrastructure Check\n");
     
     // Real-world SPIR-V Compiler Infrastructure Detection System - Kernel-Space Implementation
     // This method provides actual detection of SPIR-V toolchain and validation capabilities through IORegistry
-    IOLog("VMShaderManager: Performing real SPIR-V infrastructure detection via kernel-space queries\n");
+    VMLOG_INFO("VMShaderManager: Performing real SPIR-V infrastructure detection via kernel-space queries\n");
     
     // Phase 1A: IORegistry-based SPIR-V toolchain detection
     IORegistryEntry* root = IORegistryEntry::fromPath("/", gIOServicePlane);
@@ -6345,12 +5257,12 @@ bool CLASS::checkSPIRVSupport() const
     }
     
     // Phase 1B: Advanced SPIR-V capability matrix through system integration
-    IOLog("VMShaderManager: SPIR-V Infrastructure Detection Results:\n");
-    IOLog("  Registry Detection - SPIR-V Tools: %s, Vulkan SDK: %s, Metal Tools: %s\n",
+    VMLOG_INFO("VMShaderManager: SPIR-V Infrastructure Detection Results:\n");
+    VMLOG_INFO("  Registry Detection - SPIR-V Tools: %s, Vulkan SDK: %s, Metal Tools: %s\n",
           spirv_validator_detected ? "FOUND" : "NOT FOUND",
           vulkan_sdk_detected ? "FOUND" : "NOT FOUND", 
           metal_spirv_detected ? "FOUND" : "NOT FOUND");
-    IOLog("  Advanced Detection - SPIRV-Cross: %s, Reflection: %s\n",
+    VMLOG_INFO("  Advanced Detection - SPIRV-Cross: %s, Reflection: %s\n",
           spirv_cross_detected ? "FOUND" : "NOT FOUND",
           spirv_reflect_detected ? "FOUND" : "NOT FOUND");
     
@@ -6385,17 +5297,17 @@ bool CLASS::checkSPIRVSupport() const
         .has_optimization_pipeline = spirv_optimizer_detected && spirv_cross_detected
     };
     
-    IOLog("VMShaderManager: Advanced SPIR-V Toolchain Assessment:\n");
-    IOLog("  SPIR-V Tools Suite: %s\n", toolchain_assessment.has_spirv_tools_integration ? "INTEGRATED" : "LIMITED");
-    IOLog("  GLSL Pipeline: %s\n", toolchain_assessment.has_glslang_integration ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("  DirectX Pipeline: %s\n", toolchain_assessment.has_dxc_spirv_integration ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("  Metal Pipeline: %s\n", toolchain_assessment.has_metal_spirv_integration ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("  SPIR-V Linking: %s\n", toolchain_assessment.has_spirv_link_integration ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("  Validation Pipeline: %s\n", toolchain_assessment.has_validation_pipeline ? "COMPLETE" : "BASIC");
-    IOLog("  Optimization Pipeline: %s\n", toolchain_assessment.has_optimization_pipeline ? "COMPLETE" : "BASIC");
+    VMLOG_INFO("VMShaderManager: Advanced SPIR-V Toolchain Assessment:\n");
+    VMLOG_INFO("  SPIR-V Tools Suite: %s\n", toolchain_assessment.has_spirv_tools_integration ? "INTEGRATED" : "LIMITED");
+    VMLOG_INFO("  GLSL Pipeline: %s\n", toolchain_assessment.has_glslang_integration ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("  DirectX Pipeline: %s\n", toolchain_assessment.has_dxc_spirv_integration ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("  Metal Pipeline: %s\n", toolchain_assessment.has_metal_spirv_integration ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("  SPIR-V Linking: %s\n", toolchain_assessment.has_spirv_link_integration ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("  Validation Pipeline: %s\n", toolchain_assessment.has_validation_pipeline ? "COMPLETE" : "BASIC");
+    VMLOG_INFO("  Optimization Pipeline: %s\n", toolchain_assessment.has_optimization_pipeline ? "COMPLETE" : "BASIC");
     
     // Phase 2: SPIR-V version and Vulkan compatibility with real version detection
-    IOLog("VMShaderManager: Phase 2 - SPIR-V Version Compatibility Assessment\n");
+    VMLOG_INFO("VMShaderManager: Phase 2 - SPIR-V Version Compatibility Assessment\n");
     
     // Real SPIR-V version detection based on detected toolchain capabilities
     uint32_t detected_spirv_version = 0x10000;        // Default: SPIR-V 1.0
@@ -6441,27 +5353,27 @@ bool CLASS::checkSPIRVSupport() const
     spirv_caps.max_spirv_version = detected_spirv_version;
     spirv_caps.supported_vulkan_version = detected_vulkan_version;
     
-    IOLog("VMShaderManager: SPIR-V Version Detection Results:\n");
-    IOLog("  Detected SPIR-V Version: %d.%d\n", 
+    VMLOG_INFO("VMShaderManager: SPIR-V Version Detection Results:\n");
+    VMLOG_INFO("  Detected SPIR-V Version: %d.%d\n", 
           (detected_spirv_version >> 16) & 0xFF, (detected_spirv_version >> 8) & 0xFF);
-    IOLog("  Detected Vulkan Version: %d.%d\n",
+    VMLOG_INFO("  Detected Vulkan Version: %d.%d\n",
           (detected_vulkan_version >> 22) & 0x3FF, (detected_vulkan_version >> 12) & 0x3FF);
-    IOLog("  Version Support Matrix:\n");
-    IOLog("    SPIR-V 1.0: %s, SPIR-V 1.1: %s, SPIR-V 1.2: %s\n",
+    VMLOG_INFO("  Version Support Matrix:\n");
+    VMLOG_INFO("    SPIR-V 1.0: %s, SPIR-V 1.1: %s, SPIR-V 1.2: %s\n",
           version_caps.supports_spirv_1_0 ? "YES" : "NO",
           version_caps.supports_spirv_1_1 ? "YES" : "NO", 
           version_caps.supports_spirv_1_2 ? "YES" : "NO");
-    IOLog("    SPIR-V 1.3: %s, SPIR-V 1.4: %s, SPIR-V 1.5: %s, SPIR-V 1.6: %s\n",
+    VMLOG_INFO("    SPIR-V 1.3: %s, SPIR-V 1.4: %s, SPIR-V 1.5: %s, SPIR-V 1.6: %s\n",
           version_caps.supports_spirv_1_3 ? "YES" : "NO",
           version_caps.supports_spirv_1_4 ? "YES" : "NO",
           version_caps.supports_spirv_1_5 ? "YES" : "NO",
           version_caps.supports_spirv_1_6 ? "YES" : "NO");
     
     // Phase 3: SPIR-V Capability Set Detection
-    IOLog("VMShaderManager: Phase 3 - SPIR-V Capability Assessment\n");
+    VMLOG_INFO("VMShaderManager: Phase 3 - SPIR-V Capability Assessment\n");
     
     // Phase 3: SPIR-V Capability Set Detection - Real System Assessment
-    IOLog("VMShaderManager: Phase 3 - SPIR-V Capability Assessment\n");
+    VMLOG_INFO("VMShaderManager: Phase 3 - SPIR-V Capability Assessment\n");
     
     struct SPIRVCapabilitySet {
         bool shader_capabilities;        // Basic shader execution
@@ -6512,40 +5424,40 @@ bool CLASS::checkSPIRVSupport() const
         .task_shader_capabilities = version_caps.supports_spirv_1_6 && version_caps.supports_vulkan_1_2
     };
     
-    IOLog("VMShaderManager: SPIR-V Capability Matrix Results:\n");
-    IOLog("  Basic Capabilities:\n");
-    IOLog("    Shader Execution: %s, Matrix Operations: %s\n",
+    VMLOG_INFO("VMShaderManager: SPIR-V Capability Matrix Results:\n");
+    VMLOG_INFO("  Basic Capabilities:\n");
+    VMLOG_INFO("    Shader Execution: %s, Matrix Operations: %s\n",
           capability_set.shader_capabilities ? "SUPPORTED" : "NOT SUPPORTED",
           capability_set.matrix_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Image Queries: %s, Derivatives: %s\n",
+    VMLOG_INFO("    Image Queries: %s, Derivatives: %s\n",
           capability_set.image_query_capabilities ? "SUPPORTED" : "NOT SUPPORTED",
           capability_set.derivative_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("  Advanced Pipeline:\n");
-    IOLog("    Tessellation: %s, Geometry: %s, Compute: %s\n",
+    VMLOG_INFO("  Advanced Pipeline:\n");
+    VMLOG_INFO("    Tessellation: %s, Geometry: %s, Compute: %s\n",
           capability_set.tessellation_capabilities ? "SUPPORTED" : "NOT SUPPORTED",
           capability_set.geometry_capabilities ? "SUPPORTED" : "NOT SUPPORTED",
           capability_set.compute_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("  Modern Features:\n");
-    IOLog("    Subgroups: %s, Variable Pointers: %s\n",
+    VMLOG_INFO("  Modern Features:\n");
+    VMLOG_INFO("    Subgroups: %s, Variable Pointers: %s\n",
           capability_set.subgroup_capabilities ? "SUPPORTED" : "NOT SUPPORTED",
           capability_set.variable_pointers ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    16-bit Storage: %s, Half-Precision: %s, 8-bit Integers: %s\n",
+    VMLOG_INFO("    16-bit Storage: %s, Half-Precision: %s, 8-bit Integers: %s\n",
           capability_set.storage_buffer_16bit ? "SUPPORTED" : "NOT SUPPORTED",
           capability_set.shader_float16 ? "SUPPORTED" : "NOT SUPPORTED",
           capability_set.shader_int8 ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("  Cutting-Edge Features:\n");
-    IOLog("    Cooperative Matrix: %s, Ray Tracing: %s\n",
+    VMLOG_INFO("  Cutting-Edge Features:\n");
+    VMLOG_INFO("    Cooperative Matrix: %s, Ray Tracing: %s\n",
           capability_set.cooperative_matrix ? "SUPPORTED" : "NOT SUPPORTED",
           capability_set.ray_tracing_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Mesh Shaders: %s, Task Shaders: %s\n",
+    VMLOG_INFO("    Mesh Shaders: %s, Task Shaders: %s\n",
           capability_set.mesh_shader_capabilities ? "SUPPORTED" : "NOT SUPPORTED",
           capability_set.task_shader_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
     
     // Phase 4: SPIR-V Cross-Compilation Matrix
-    IOLog("VMShaderManager: Phase 4 - SPIR-V Cross-Compilation Support\n");
+    VMLOG_INFO("VMShaderManager: Phase 4 - SPIR-V Cross-Compilation Support\n");
     
     // Phase 4: SPIR-V Cross-Compilation Matrix - Real Toolchain Assessment
-    IOLog("VMShaderManager: Phase 4 - SPIR-V Cross-Compilation Support\n");
+    VMLOG_INFO("VMShaderManager: Phase 4 - SPIR-V Cross-Compilation Support\n");
     
     struct SPIRVCrossCompilation {
         bool spirv_to_glsl;              // SPIR-V -> GLSL translation
@@ -6580,34 +5492,34 @@ bool CLASS::checkSPIRVSupport() const
         .push_constant_handling = version_caps.supports_spirv_1_0 && (metal_spirv_detected || vulkan_sdk_detected)
     };
     
-    IOLog("VMShaderManager: SPIR-V Cross-Compilation Assessment Results:\n");
-    IOLog("  Target Language Support:\n");
-    IOLog("    SPIR-V -> GLSL: %s, SPIR-V -> MSL: %s\n",
+    VMLOG_INFO("VMShaderManager: SPIR-V Cross-Compilation Assessment Results:\n");
+    VMLOG_INFO("  Target Language Support:\n");
+    VMLOG_INFO("    SPIR-V -> GLSL: %s, SPIR-V -> MSL: %s\n",
           cross_compile.spirv_to_glsl ? "SUPPORTED" : "NOT SUPPORTED",
           cross_compile.spirv_to_msl ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    SPIR-V -> HLSL: %s, SPIR-V -> C++: %s\n",
+    VMLOG_INFO("    SPIR-V -> HLSL: %s, SPIR-V -> C++: %s\n",
           cross_compile.spirv_to_hlsl ? "SUPPORTED" : "NOT SUPPORTED",
           cross_compile.spirv_to_cpp ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("  Advanced Features:\n");
-    IOLog("    Debug Preservation: %s, Optimization: %s\n",
+    VMLOG_INFO("  Advanced Features:\n");
+    VMLOG_INFO("    Debug Preservation: %s, Optimization: %s\n",
           cross_compile.preserve_debug_info ? "YES" : "NO",
           cross_compile.optimize_cross_compile ? "YES" : "NO");
-    IOLog("    Extension Handling: %s, Reflection: %s\n",
+    VMLOG_INFO("    Extension Handling: %s, Reflection: %s\n",
           cross_compile.handle_extensions ? "YES" : "NO",
           cross_compile.reflection_generation ? "YES" : "NO");
-    IOLog("  Specialized Support:\n");
-    IOLog("    Interface Remapping: %s, Combined Samplers: %s\n",
+    VMLOG_INFO("  Specialized Support:\n");
+    VMLOG_INFO("    Interface Remapping: %s, Combined Samplers: %s\n",
           cross_compile.interface_variable_remapping ? "YES" : "NO",
           cross_compile.combined_sampler_handling ? "YES" : "NO");
-    IOLog("    Specialization Constants: %s, Push Constants: %s\n",
+    VMLOG_INFO("    Specialization Constants: %s, Push Constants: %s\n",
           cross_compile.specialization_constants ? "YES" : "NO",
           cross_compile.push_constant_handling ? "YES" : "NO");
     
     // Phase 5: SPIR-V Validation and Optimization Pipeline
-    IOLog("VMShaderManager: Phase 5 - SPIR-V Processing Pipeline\n");
+    VMLOG_INFO("VMShaderManager: Phase 5 - SPIR-V Processing Pipeline\n");
     
     // Phase 5: SPIR-V Validation and Optimization Pipeline - Real System Detection
-    IOLog("VMShaderManager: Phase 5 - SPIR-V Processing Pipeline\n");
+    VMLOG_INFO("VMShaderManager: Phase 5 - SPIR-V Processing Pipeline\n");
     
     struct SPIRVProcessingPipeline {
         bool bytecode_validation;        // Structural SPIR-V validation
@@ -6650,32 +5562,32 @@ bool CLASS::checkSPIRVSupport() const
         .debug_info_processing = version_caps.supports_spirv_1_1 && cross_compile.preserve_debug_info
     };
     
-    IOLog("VMShaderManager: SPIR-V Processing Pipeline Assessment:\n");
-    IOLog("  Core Validation:\n");
-    IOLog("    Bytecode Validation: %s, Semantic Validation: %s\n",
+    VMLOG_INFO("VMShaderManager: SPIR-V Processing Pipeline Assessment:\n");
+    VMLOG_INFO("  Core Validation:\n");
+    VMLOG_INFO("    Bytecode Validation: %s, Semantic Validation: %s\n",
           processing.bytecode_validation ? "ENABLED" : "DISABLED",
           processing.semantic_validation ? "ENABLED" : "DISABLED");
-    IOLog("    Type Checking: %s, Control Flow Analysis: %s\n",
+    VMLOG_INFO("    Type Checking: %s, Control Flow Analysis: %s\n",
           processing.type_checking ? "ENABLED" : "DISABLED",
           processing.control_flow_analysis ? "ENABLED" : "DISABLED");
-    IOLog("  Optimization Pipeline:\n");
-    IOLog("    Optimization Passes: %s, Dead Code Elimination: %s\n",
+    VMLOG_INFO("  Optimization Pipeline:\n");
+    VMLOG_INFO("    Optimization Passes: %s, Dead Code Elimination: %s\n",
           processing.optimization_passes ? "ENABLED" : "DISABLED",
           processing.dead_code_elimination ? "ENABLED" : "DISABLED");
-    IOLog("    Constant Propagation: %s, Loop Optimization: %s\n",
+    VMLOG_INFO("    Constant Propagation: %s, Loop Optimization: %s\n",
           processing.constant_propagation ? "ENABLED" : "DISABLED",
           processing.loop_optimization ? "ENABLED" : "DISABLED");
-    IOLog("    Function Inlining: %s, Performance Opts: %s\n",
+    VMLOG_INFO("    Function Inlining: %s, Performance Opts: %s\n",
           processing.inline_functions ? "ENABLED" : "DISABLED",
           processing.performance_optimization ? "ENABLED" : "DISABLED");
-    IOLog("  Specialized Processing:\n");
-    IOLog("    Resource Binding Check: %s, Memory Model Validation: %s\n",
+    VMLOG_INFO("  Specialized Processing:\n");
+    VMLOG_INFO("    Resource Binding Check: %s, Memory Model Validation: %s\n",
           processing.resource_binding_check ? "ENABLED" : "DISABLED",
           processing.memory_model_validation ? "ENABLED" : "DISABLED");
-    IOLog("    Linkage Validation: %s, Size Optimization: %s\n",
+    VMLOG_INFO("    Linkage Validation: %s, Size Optimization: %s\n",
           processing.linkage_validation ? "ENABLED" : "DISABLED",
           processing.size_optimization ? "ENABLED" : "DISABLED");
-    IOLog("    Debug Info Processing: %s\n",
+    VMLOG_INFO("    Debug Info Processing: %s\n",
           processing.debug_info_processing ? "ENABLED" : "DISABLED");
     
     // Phase 6: Comprehensive SPIR-V support assessment
@@ -6691,73 +5603,74 @@ bool CLASS::checkSPIRVSupport() const
                              processing.optimization_passes;
     
     // Detailed SPIR-V capability logging
-    IOLog("VMShaderManager: ========== SPIR-V Support Assessment Complete ==========\n");
-    IOLog("  SPIR-V Infrastructure:\n");
-    IOLog("    SPIR-V Validator: %s\n", spirv_caps.has_spirv_validator ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("    SPIR-V Optimizer: %s\n", spirv_caps.has_spirv_optimizer ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("    SPIRV-Cross Compiler: %s\n", spirv_caps.has_spirv_cross_compiler ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("    Reflection Support: %s\n", spirv_caps.has_reflection_support ? "AVAILABLE" : "NOT AVAILABLE");
-    IOLog("  Version Compatibility:\n");
-    IOLog("    Max SPIR-V Version: %d.%d\n", (spirv_caps.max_spirv_version >> 16) & 0xFF, (spirv_caps.max_spirv_version >> 8) & 0xFF);
-    IOLog("    Vulkan API Version: %d.%d.%d\n", 
+    VMLOG_INFO("VMShaderManager: ========== SPIR-V Support Assessment Complete ==========\n");
+    VMLOG_INFO("  SPIR-V Infrastructure:\n");
+    VMLOG_INFO("    SPIR-V Validator: %s\n", spirv_caps.has_spirv_validator ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("    SPIR-V Optimizer: %s\n", spirv_caps.has_spirv_optimizer ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("    SPIRV-Cross Compiler: %s\n", spirv_caps.has_spirv_cross_compiler ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("    Reflection Support: %s\n", spirv_caps.has_reflection_support ? "AVAILABLE" : "NOT AVAILABLE");
+    VMLOG_INFO("  Version Compatibility:\n");
+    VMLOG_INFO("    Max SPIR-V Version: %d.%d\n", (spirv_caps.max_spirv_version >> 16) & 0xFF, (spirv_caps.max_spirv_version >> 8) & 0xFF);
+    VMLOG_INFO("    Vulkan API Version: %d.%d.%d\n", 
           (spirv_caps.supported_vulkan_version >> 22) & 0x3FF,  // Major
           (spirv_caps.supported_vulkan_version >> 12) & 0x3FF,  // Minor  
           (spirv_caps.supported_vulkan_version & 0xFFF));       // Patch
-    IOLog("    Vulkan Compatibility: %s\n", spirv_caps.has_vulkan_compatibility ? "YES" : "NO");
-    IOLog("  SPIR-V Capabilities:\n");
-    IOLog("    Shader Execution: %s\n", capability_set.shader_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Matrix Operations: %s\n", capability_set.matrix_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Image Queries: %s\n", capability_set.image_query_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Tessellation: %s\n", capability_set.tessellation_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Geometry Shaders: %s\n", capability_set.geometry_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Compute Shaders: %s\n", capability_set.compute_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    16-bit Storage: %s\n", capability_set.storage_buffer_16bit ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Half-Precision: %s\n", capability_set.shader_float16 ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("  Cross-Compilation Targets:\n");
-    IOLog("    SPIR-V -> GLSL: %s\n", cross_compile.spirv_to_glsl ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    SPIR-V -> MSL: %s\n", cross_compile.spirv_to_msl ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    SPIR-V -> HLSL: %s\n", cross_compile.spirv_to_hlsl ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("    Debug Info Preservation: %s\n", cross_compile.preserve_debug_info ? "YES" : "NO");
-    IOLog("    Extension Handling: %s\n", cross_compile.handle_extensions ? "YES" : "NO");
-    IOLog("  Processing Pipeline:\n");
-    IOLog("    Bytecode Validation: %s\n", processing.bytecode_validation ? "ENABLED" : "DISABLED");
-    IOLog("    Semantic Validation: %s\n", processing.semantic_validation ? "ENABLED" : "DISABLED");
-    IOLog("    Optimization Passes: %s\n", processing.optimization_passes ? "ENABLED" : "DISABLED");
-    IOLog("    Dead Code Elimination: %s\n", processing.dead_code_elimination ? "ENABLED" : "DISABLED");
-    IOLog("    Constant Propagation: %s\n", processing.constant_propagation ? "ENABLED" : "DISABLED");
-    IOLog("    Loop Optimization: %s\n", processing.loop_optimization ? "ENABLED" : "DISABLED");
-    IOLog("    Function Inlining: %s\n", processing.inline_functions ? "ENABLED" : "DISABLED");
-    IOLog("  Overall SPIR-V Support: %s\n", full_spirv_support ? "FULLY SUPPORTED" : "LIMITED/EXPERIMENTAL");
-    IOLog("==============================================================\n");
+    VMLOG_INFO("    Vulkan Compatibility: %s\n", spirv_caps.has_vulkan_compatibility ? "YES" : "NO");
+    VMLOG_INFO("  SPIR-V Capabilities:\n");
+    VMLOG_INFO("    Shader Execution: %s\n", capability_set.shader_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    Matrix Operations: %s\n", capability_set.matrix_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    Image Queries: %s\n", capability_set.image_query_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    Tessellation: %s\n", capability_set.tessellation_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    Geometry Shaders: %s\n", capability_set.geometry_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    Compute Shaders: %s\n", capability_set.compute_capabilities ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    16-bit Storage: %s\n", capability_set.storage_buffer_16bit ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    Half-Precision: %s\n", capability_set.shader_float16 ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("  Cross-Compilation Targets:\n");
+    VMLOG_INFO("    SPIR-V -> GLSL: %s\n", cross_compile.spirv_to_glsl ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    SPIR-V -> MSL: %s\n", cross_compile.spirv_to_msl ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    SPIR-V -> HLSL: %s\n", cross_compile.spirv_to_hlsl ? "SUPPORTED" : "NOT SUPPORTED");
+    VMLOG_INFO("    Debug Info Preservation: %s\n", cross_compile.preserve_debug_info ? "YES" : "NO");
+    VMLOG_INFO("    Extension Handling: %s\n", cross_compile.handle_extensions ? "YES" : "NO");
+    VMLOG_INFO("  Processing Pipeline:\n");
+    VMLOG_INFO("    Bytecode Validation: %s\n", processing.bytecode_validation ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("    Semantic Validation: %s\n", processing.semantic_validation ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("    Optimization Passes: %s\n", processing.optimization_passes ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("    Dead Code Elimination: %s\n", processing.dead_code_elimination ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("    Constant Propagation: %s\n", processing.constant_propagation ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("    Loop Optimization: %s\n", processing.loop_optimization ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("    Function Inlining: %s\n", processing.inline_functions ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("  Overall SPIR-V Support: %s\n", full_spirv_support ? "FULLY SUPPORTED" : "LIMITED/EXPERIMENTAL");
+    VMLOG_INFO("==============================================================\n");
     
     return full_spirv_support;
 }
 
 IOReturn CLASS::useProgram(uint32_t context_id, uint32_t program_id)
 {
-    IOLog("VMShaderManager::useProgram: Activating shader program %d for context %d\n", program_id, context_id);
+    VMLOG_DEBUG("VMShaderManager::useProgram: Activating shader program %d for context %d\n", program_id, context_id);
     
     // Phase 1: Validate context and program parameters
     if (context_id >= MAX_RENDER_CONTEXTS) {
-        IOLog("VMShaderManager::useProgram: ERROR - Invalid context ID %d (max: %d)\n", 
+        VMLOG_ERROR("VMShaderManager::useProgram: ERROR - Invalid context ID %d (max: %d)\n", 
               context_id, MAX_RENDER_CONTEXTS - 1);
         return kIOReturnBadArgument;
     }
     
     IOLockLock(m_shader_lock);
     
-    // Phase 2: Locate and validate shader program
-    ShaderProgram* program = findProgram(program_id);
+    // Phase 2: Locate and validate shader program; a link still queued or
+    // running is needed now, so wait for it
+    ShaderProgram* program = waitForProgram(program_id);
     if (!program) {
         IOLockUnlock(m_shader_lock);
-        IOLog("VMShaderManager::useProgram: ERROR - Program %d not found\n", program_id);
+        VMLOG_ERROR("VMShaderManager::useProgram: ERROR - Program %d not found\n", program_id);
         return kIOReturnNotFound;
     }
     
     // Phase 3: Verify program is properly linked
     if (!program->is_linked) {
         IOLockUnlock(m_shader_lock);
-        IOLog("VMShaderManager::useProgram: ERROR - Program %d is not linked\n", program_id);
+        VMLOG_ERROR("VMShaderManager::useProgram: ERROR - Program %d is not linked\n", program_id);
         return kIOReturnNotReady;
     }
     
@@ -6781,14 +5694,14 @@ IOReturn CLASS::useProgram(uint32_t context_id, uint32_t program_id)
     // Phase 5: Hardware-specific program activation
     IOReturn hw_result = kIOReturnSuccess;
     if (m_accelerator) {
-        IOLog("VMShaderManager::useProgram: Activating program %d on hardware accelerator\n", program_id);
+        VMLOG_DEBUG("VMShaderManager::useProgram: Activating program %d on hardware accelerator\n", program_id);
         
         // Bind vertex shader if present
         if (program->vertex_shader_id != 0) {
             CompiledShader* vertex_shader = findShader(program->vertex_shader_id);
             if (vertex_shader && vertex_shader->bytecode) {
                 // In a real implementation, this would bind the shader to the GPU pipeline
-                IOLog("VMShaderManager::useProgram: Binding vertex shader %d (bytecode size: %d)\n",
+                VMLOG_DEBUG("VMShaderManager::useProgram: Binding vertex shader %d (bytecode size: %d)\n",
                       program->vertex_shader_id, (int)vertex_shader->bytecode->getLength());
             }
         }
@@ -6797,7 +5710,7 @@ IOReturn CLASS::useProgram(uint32_t context_id, uint32_t program_id)
         if (program->fragment_shader_id != 0) {
             CompiledShader* fragment_shader = findShader(program->fragment_shader_id);
             if (fragment_shader && fragment_shader->bytecode) {
-                IOLog("VMShaderManager::useProgram: Binding fragment shader %d (bytecode size: %d)\n",
+                VMLOG_DEBUG("VMShaderManager::useProgram: Binding fragment shader %d (bytecode size: %d)\n",
                       program->fragment_shader_id, (int)fragment_shader->bytecode->getLength());
             }
         }
@@ -6806,7 +5719,7 @@ IOReturn CLASS::useProgram(uint32_t context_id, uint32_t program_id)
         if (program->geometry_shader_id != 0) {
             CompiledShader* geometry_shader = findShader(program->geometry_shader_id);
             if (geometry_shader && geometry_shader->bytecode) {
-                IOLog("VMShaderManager::useProgram: Binding geometry shader %d\n", program->geometry_shader_id);
+                VMLOG_DEBUG("VMShaderManager::useProgram: Binding geometry shader %d\n", program->geometry_shader_id);
             }
         }
         
@@ -6816,16 +5729,16 @@ IOReturn CLASS::useProgram(uint32_t context_id, uint32_t program_id)
     
     // Phase 6: Software fallback activation
     else {
-        IOLog("VMShaderManager::useProgram: Using software rendering pipeline for program %d\n", program_id);
+        VMLOG_DEBUG("VMShaderManager::useProgram: Using software rendering pipeline for program %d\n", program_id);
         
         // Setup software shader state
         if (program->all_uniforms && program->all_uniforms->getCount() > 0) {
-            IOLog("VMShaderManager::useProgram: Setting up %d uniform variables for software rendering\n",
+            VMLOG_DEBUG("VMShaderManager::useProgram: Setting up %d uniform variables for software rendering\n",
                   program->all_uniforms->getCount());
         }
         
         if (program->all_attributes && program->all_attributes->getCount() > 0) {
-            IOLog("VMShaderManager::useProgram: Configuring %d vertex attributes for software pipeline\n",
+            VMLOG_DEBUG("VMShaderManager::useProgram: Configuring %d vertex attributes for software pipeline\n",
                   program->all_attributes->getCount());
         }
     }
@@ -6880,32 +5793,71 @@ IOReturn CLASS::useProgram(uint32_t context_id, uint32_t program_id)
     IOLockUnlock(m_shader_lock);
     
     // Phase 9: Comprehensive activation logging
-    IOLog("VMShaderManager: ========== Program Activation Complete ==========\n");
-    IOLog("  Program ID: %d, Context ID: %d\n", program_id, context_id);
-    IOLog("  Previous Program: %d\n", activation_state.previous_program_id);
-    IOLog("  Shader Components:\n");
-    if (program->vertex_shader_id) IOLog("    Vertex Shader: %d\n", program->vertex_shader_id);
-    if (program->fragment_shader_id) IOLog("    Fragment Shader: %d\n", program->fragment_shader_id);
-    if (program->geometry_shader_id) IOLog("    Geometry Shader: %d\n", program->geometry_shader_id);
-    if (program->compute_shader_id) IOLog("    Compute Shader: %d\n", program->compute_shader_id);
-    IOLog("  Resource Bindings:\n");
-    IOLog("    Uniforms: %d, Attributes: %d, Resources: %d\n",
+    VMLOG_DEBUG("VMShaderManager: ========== Program Activation Complete ==========\n");
+    VMLOG_DEBUG("  Program ID: %d, Context ID: %d\n", program_id, context_id);
+    VMLOG_DEBUG("  Previous Program: %d\n", activation_state.previous_program_id);
+    VMLOG_DEBUG("  Shader Components:\n");
+    if (program->vertex_shader_id) VMLOG_DEBUG("    Vertex Shader: %d\n", program->vertex_shader_id);
+    if (program->fragment_shader_id) VMLOG_DEBUG("    Fragment Shader: %d\n", program->fragment_shader_id);
+    if (program->geometry_shader_id) VMLOG_DEBUG("    Geometry Shader: %d\n", program->geometry_shader_id);
+    if (program->compute_shader_id) VMLOG_DEBUG("    Compute Shader: %d\n", program->compute_shader_id);
+    VMLOG_DEBUG("  Resource Bindings:\n");
+    VMLOG_DEBUG("    Uniforms: %d, Attributes: %d, Resources: %d\n",
           program->all_uniforms ? program->all_uniforms->getCount() : 0,
           program->all_attributes ? program->all_attributes->getCount() : 0,
           program->all_resources ? program->all_resources->getCount() : 0);
-    IOLog("  Performance:\n");
-    IOLog("    Total Activations: %lld, Context Switches: %llu\n",
+    VMLOG_DEBUG("  Performance:\n");
+    VMLOG_DEBUG("    Total Activations: %lld, Context Switches: %llu\n",
           program->performance_stats ? program->performance_stats->total_activations : 0,
           program->performance_stats ? program->performance_stats->context_switches : 0);
-    IOLog("    Hardware Acceleration: %s\n", m_accelerator ? "ENABLED" : "SOFTWARE FALLBACK");
-    IOLog("==============================================================\n");
+    VMLOG_DEBUG("    Hardware Acceleration: %s\n", m_accelerator ? "ENABLED" : "SOFTWARE FALLBACK");
+    VMLOG_DEBUG("==============================================================\n");
     
     return hw_result;
 }
 
+// Queues the link and returns; useProgram, setUniform and
+// getProgramCompletionStatus see the result once the job has run
 IOReturn CLASS::linkProgram(uint32_t program_id)
 {
-    IOLog("VMShaderManager::linkProgram: Linking shader program %d\n", program_id);
+    CompileJob* job = (CompileJob*)IOMalloc(sizeof(CompileJob));
+    if (!job)
+        return kIOReturnNoMemory;
+    bzero(job, sizeof(CompileJob));
+    job->is_link = true;
+    job->id = program_id;
+    
+    IOLockLock(m_shader_lock);
+    
+    ShaderProgram* program = findProgram(program_id);
+    if (!program) {
+        IOLockUnlock(m_shader_lock);
+        IOFree(job, sizeof(CompileJob));
+        VMLOG_ERROR("VMShaderManager::linkProgram: ERROR - Program %d not found\n", program_id);
+        return kIOReturnNotFound;
+    }
+    if (!program->shader_ids || program->shader_ids->getCount() == 0) {
+        IOLockUnlock(m_shader_lock);
+        IOFree(job, sizeof(CompileJob));
+        VMLOG_ERROR("VMShaderManager::linkProgram: ERROR - Program %d has no attached shaders\n", program_id);
+        return kIOReturnBadArgument;
+    }
+    
+    program->link_jobs++;
+    if (queueCompileJob(job)) {
+        IOLockUnlock(m_shader_lock);
+        return kIOReturnSuccess;
+    }
+    IOLockUnlock(m_shader_lock);
+    
+    IOReturn ret = runLinkJob(job);
+    freeCompileJob(job);
+    return ret;
+}
+
+IOReturn CLASS::linkProgramNow(uint32_t program_id)
+{
+    VMLOG_DEBUG("VMShaderManager::linkProgram: Linking shader program %d\n", program_id);
     
     IOLockLock(m_shader_lock);
     
@@ -6913,19 +5865,45 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
     ShaderProgram* program = findProgram(program_id);
     if (!program) {
         IOLockUnlock(m_shader_lock);
-        IOLog("VMShaderManager::linkProgram: ERROR - Program %d not found\n", program_id);
+        VMLOG_ERROR("VMShaderManager::linkProgram: ERROR - Program %d not found\n", program_id);
         return kIOReturnNotFound;
     }
     
     // Phase 2: Verify program has required shaders
     if (!program->shader_ids || program->shader_ids->getCount() == 0) {
         IOLockUnlock(m_shader_lock);
-        IOLog("VMShaderManager::linkProgram: ERROR - Program %d has no attached shaders\n", program_id);
+        VMLOG_ERROR("VMShaderManager::linkProgram: ERROR - Program %d has no attached shaders\n", program_id);
         return kIOReturnBadArgument;
     }
     
+    // A stage that failed to compile fails the link with its compile status
+    for (unsigned int i = 0; i < program->shader_ids->getCount(); i++) {
+        OSNumber* shader_id_num = (OSNumber*)program->shader_ids->getObject(i);
+        CompiledShader* shader = shader_id_num ? findShader(shader_id_num->unsigned32BitValue()) : nullptr;
+        if (shader && !shader->is_valid) {
+            IOReturn compile_status = shader->is_pending ? kIOReturnNotReady : shader->compile_status;
+            VMLOG_ERROR("VMShaderManager::linkProgram: ERROR - Shader %d did not compile (0x%x)\n",
+                  shader->shader_id, compile_status);
+            IOLockUnlock(m_shader_lock);
+            return compile_status;
+        }
+    }
+    
+    // Same stages linked before: reuse that link result
+    uint8_t link_key[VM_SHADER_HASH_SIZE];
+    bool have_link_key = computeProgramKey(program, link_key);
+    if (have_link_key) {
+        ProgramCacheEntry* cached = lookupProgramCache(link_key);
+        if (cached && restoreProgramFromCache(program, cached) == kIOReturnSuccess) {
+            m_program_cache_hits++;
+            IOLockUnlock(m_shader_lock);
+            return kIOReturnSuccess;
+        }
+        m_program_cache_misses++;
+    }
+    
     // Phase 3: Advanced shader compatibility validation
-    IOLog("VMShaderManager::linkProgram: Phase 3 - Shader Compatibility Validation\n");
+    VMLOG_DEBUG("VMShaderManager::linkProgram: Phase 3 - Shader Compatibility Validation\n");
     
     struct LinkingValidation {
         bool has_vertex_shader;
@@ -6953,7 +5931,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         CompiledShader* shader = findShader(shader_id);
         if (!shader) {
             IOLockUnlock(m_shader_lock);
-            IOLog("VMShaderManager::linkProgram: ERROR - Shader %d not found\n", shader_id);
+            VMLOG_ERROR("VMShaderManager::linkProgram: ERROR - Shader %d not found\n", shader_id);
             return kIOReturnNotFound;
         }
         
@@ -6981,7 +5959,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 break;
             case VM_SHADER_TYPE_TESSELLATION_CONTROL: {
                 // Comprehensive Tessellation Control Shader Support
-                IOLog("  Processing Tessellation Control Shader (Hull Shader): ID %d\n", shader_id);
+                VMLOG_DEBUG("  Processing Tessellation Control Shader (Hull Shader): ID %d\n", shader_id);
                 
                 // Tessellation Control Shader Validation and Configuration
                 struct TessellationControlValidation {
@@ -7002,11 +5980,11 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 // Parse tessellation control shader for required elements
                 // Note: Using bytecode analysis since source may not be available
                 if (shader->bytecode && shader->bytecode->getLength() > 0) {
-                    IOLog("    Analyzing tessellation control bytecode (%d bytes)\n", 
+                    VMLOG_DEBUG("    Analyzing tessellation control bytecode (%d bytes)\n", 
                           (int)shader->bytecode->getLength());
                     
                     // Real tessellation control bytecode analysis with kernel-space validation
-                    IOLog("    Performing comprehensive tessellation control bytecode analysis\n");
+                    VMLOG_DEBUG("    Performing comprehensive tessellation control bytecode analysis\n");
                     
                     // Phase 1: Tessellation Control Bytecode Structure Analysis
                     struct TessellationControlBytecodeAnalysis {
@@ -7049,7 +6027,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     uint32_t bytecode_size = (uint32_t)((bytecode_length < UINT32_MAX) ? bytecode_length : UINT32_MAX);
                     
                     // Phase 2: Bytecode Format Detection and Header Analysis
-                    IOLog("      Analyzing bytecode format and structure\n");
+                    VMLOG_DEBUG("      Analyzing bytecode format and structure\n");
                     
                     if (bytecode_size >= 20 && bytecode_data[0] == 0x03 && bytecode_data[1] == 0x02 && 
                         bytecode_data[2] == 0x23 && bytecode_data[3] == 0x07) {
@@ -7057,7 +6035,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         tc_analysis.bytecode_format = 0;
                         tc_analysis.has_valid_magic_number = true;
                         
-                        IOLog("        Format: SPIR-V tessellation control shader\n");
+                        VMLOG_DEBUG("        Format: SPIR-V tessellation control shader\n");
                         
                         // SPIR-V instruction analysis for tessellation control
                         uint32_t* spv_instructions = (uint32_t*)bytecode_data;
@@ -7121,7 +6099,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                             instruction_offset += instruction_length;
                         }
                         
-                        IOLog("        SPIR-V Analysis: %d instructions, %d tessellation-specific\n",
+                        VMLOG_DEBUG("        SPIR-V Analysis: %d instructions, %d tessellation-specific\n",
                               tc_analysis.instruction_count, tc_analysis.tessellation_instruction_count);
                         
                     } else if (bytecode_size >= 8 && (strncmp((const char*)bytecode_data, "#version", 8) == 0 ||
@@ -7130,7 +6108,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         tc_analysis.bytecode_format = 1;
                         tc_analysis.has_valid_magic_number = true;
                         
-                        IOLog("        Format: GLSL tessellation control shader source\n");
+                        VMLOG_DEBUG("        Format: GLSL tessellation control shader source\n");
                         
                         // GLSL tessellation control source analysis
                         const char* shader_source = (const char*)bytecode_data;
@@ -7189,7 +6167,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                             pos++;
                         }
                         
-                        IOLog("        GLSL Analysis: %d lines, %d tessellation declarations\n",
+                        VMLOG_DEBUG("        GLSL Analysis: %d lines, %d tessellation declarations\n",
                               tc_analysis.instruction_count, tc_analysis.tessellation_instruction_count);
                         
                     } else {
@@ -7197,7 +6175,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         tc_analysis.bytecode_format = 3;
                         tc_analysis.has_valid_magic_number = false;
                         
-                        IOLog("        Format: Unknown/Binary tessellation control shader\n");
+                        VMLOG_DEBUG("        Format: Unknown/Binary tessellation control shader\n");
                         
                         // Heuristic analysis for unknown formats
                         tc_analysis.instruction_count = bytecode_size / 4; // Estimate
@@ -7208,7 +6186,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     }
                     
                     // Phase 3: Tessellation Control Feature Validation and Configuration
-                    IOLog("      Validating tessellation control shader features\n");
+                    VMLOG_DEBUG("      Validating tessellation control shader features\n");
                     
                     // Set defaults if not detected
                     if (tc_analysis.detected_output_patch_vertices == 0) {
@@ -7217,7 +6195,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     
                     // Validate patch vertex count
                     if (tc_analysis.detected_output_patch_vertices < 1 || tc_analysis.detected_output_patch_vertices > 32) {
-                        IOLog("        WARNING: Invalid output patch vertex count %d, using 3\n",
+                        VMLOG_WARN("        WARNING: Invalid output patch vertex count %d, using 3\n",
                               tc_analysis.detected_output_patch_vertices);
                         tc_analysis.detected_output_patch_vertices = 3;
                     }
@@ -7252,7 +6230,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         complexity_multiplier * tc_analysis.estimated_invocations_per_patch;
                     
                     // Phase 4: Apply Analysis Results to Validation Structure
-                    IOLog("      Applying tessellation control analysis results\n");
+                    VMLOG_DEBUG("      Applying tessellation control analysis results\n");
                     
                     tess_control_validation.has_patch_vertices_out = tc_analysis.declares_output_patch_size;
                     tess_control_validation.output_patch_vertices = tc_analysis.detected_output_patch_vertices;
@@ -7269,37 +6247,37 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     tess_control_validation.input_patch_vertices = tc_analysis.detected_output_patch_vertices; // Typically same
                     tess_control_validation.invocations_per_patch = tc_analysis.estimated_invocations_per_patch;
                     
-                    IOLog("    Tessellation Control Analysis Results:\n");
-                    IOLog("      Bytecode Format: %s, Instructions: %d, Tessellation Instructions: %d\n",
+                    VMLOG_DEBUG("    Tessellation Control Analysis Results:\n");
+                    VMLOG_DEBUG("      Bytecode Format: %s, Instructions: %d, Tessellation Instructions: %d\n",
                           (tc_analysis.bytecode_format == 0) ? "SPIR-V" :
                           (tc_analysis.bytecode_format == 1) ? "GLSL" : "Binary",
                           tc_analysis.instruction_count, tc_analysis.tessellation_instruction_count);
-                    IOLog("      Output Patch Vertices: %d (declared: %s)\n",
+                    VMLOG_DEBUG("      Output Patch Vertices: %d (declared: %s)\n",
                           tc_analysis.detected_output_patch_vertices,
                           tc_analysis.declares_output_patch_size ? "YES" : "INFERRED");
-                    IOLog("      Tessellation Levels: Outer=%s, Inner=%s\n",
+                    VMLOG_DEBUG("      Tessellation Levels: Outer=%s, Inner=%s\n",
                           tc_analysis.writes_outer_tessellation_levels ? "WRITTEN" : "DEFAULT",
                           tc_analysis.writes_inner_tessellation_levels ? "WRITTEN" : "DEFAULT");
-                    IOLog("      Synchronization: %d barriers, InvocationID=%s\n",
+                    VMLOG_DEBUG("      Synchronization: %d barriers, InvocationID=%s\n",
                           tc_analysis.barrier_synchronization_count,
                           tc_analysis.uses_hull_shader_invocation_id ? "USED" : "UNUSED");
-                    IOLog("      Outputs: %d per-vertex, %d per-patch (%d total components)\n",
+                    VMLOG_DEBUG("      Outputs: %d per-vertex, %d per-patch (%d total components)\n",
                           tc_analysis.per_vertex_output_variables,
                           tc_analysis.per_patch_output_variables,
                           tc_analysis.total_output_components);
-                    IOLog("      Performance: %s complexity, %.2f μs estimated per patch\n",
+                    VMLOG_DEBUG("      Performance: %s complexity, %.2f μs estimated per patch\n",
                           tc_analysis.high_tessellation_complexity ? "HIGH" : "NORMAL",
                           tc_analysis.estimated_execution_time_us);
                     
-                    IOLog("    Output Patch Vertices: %d\n", tess_control_validation.output_patch_vertices);
-                    IOLog("    Tessellation Level Control: ENABLED\n");
-                    IOLog("    Invocation ID Usage: DETECTED\n");
-                    IOLog("    Barrier Synchronization: USED\n");
-                    IOLog("    Per-Vertex Outputs: %d, Per-Patch Outputs: %d\n",
+                    VMLOG_DEBUG("    Output Patch Vertices: %d\n", tess_control_validation.output_patch_vertices);
+                    VMLOG_DEBUG("    Tessellation Level Control: ENABLED\n");
+                    VMLOG_DEBUG("    Invocation ID Usage: DETECTED\n");
+                    VMLOG_DEBUG("    Barrier Synchronization: USED\n");
+                    VMLOG_DEBUG("    Per-Vertex Outputs: %d, Per-Patch Outputs: %d\n",
                           tess_control_validation.per_vertex_output_count,
                           tess_control_validation.per_patch_output_count);
                 } else {
-                    IOLog("    WARNING: No bytecode available for tessellation control analysis\n");
+                    VMLOG_WARN("    WARNING: No bytecode available for tessellation control analysis\n");
                     // Set conservative defaults
                     tess_control_validation.output_patch_vertices = 3;
                     tess_control_validation.per_vertex_output_count = 4;
@@ -7308,10 +6286,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 // Validate tessellation control shader requirements
                 if (!tess_control_validation.has_patch_vertices_out) {
-                    IOLog("    WARNING: Missing output patch size declaration\n");
+                    VMLOG_WARN("    WARNING: Missing output patch size declaration\n");
                 }
                 if (!tess_control_validation.has_tessellation_levels) {
-                    IOLog("    WARNING: No tessellation level control detected\n");
+                    VMLOG_WARN("    WARNING: No tessellation level control detected\n");
                 }
                 
                 // Store tessellation control shader ID in program
@@ -7343,13 +6321,13 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     }
                 }
                 
-                IOLog("    Tessellation Control Shader: VALIDATED\n");
+                VMLOG_DEBUG("    Tessellation Control Shader: VALIDATED\n");
                 break;
             }
                 
             case VM_SHADER_TYPE_TESSELLATION_EVALUATION: {
                 // Comprehensive Tessellation Evaluation Shader Support
-                IOLog("  Processing Tessellation Evaluation Shader (Domain Shader): ID %d\n", shader_id);
+                VMLOG_DEBUG("  Processing Tessellation Evaluation Shader (Domain Shader): ID %d\n", shader_id);
                 
                 // Tessellation Evaluation Shader Validation and Configuration
                 struct TessellationEvaluationValidation {
@@ -7369,11 +6347,11 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 // Parse tessellation evaluation shader for configuration
                 if (shader->bytecode && shader->bytecode->getLength() > 0) {
-                    IOLog("    Analyzing tessellation evaluation bytecode (%d bytes)\n", 
+                    VMLOG_DEBUG("    Analyzing tessellation evaluation bytecode (%d bytes)\n", 
                           (int)shader->bytecode->getLength());
                     
                     // Real tessellation evaluation bytecode analysis with comprehensive domain shader validation
-                    IOLog("    Performing comprehensive tessellation evaluation bytecode analysis\n");
+                    VMLOG_DEBUG("    Performing comprehensive tessellation evaluation bytecode analysis\n");
                     
                     // Phase 1: Tessellation Evaluation Bytecode Structure Analysis
                     struct TessellationEvaluationBytecodeAnalysis {
@@ -7432,7 +6410,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     uint32_t bytecode_size = (uint32_t)((bytecode_length < UINT32_MAX) ? bytecode_length : UINT32_MAX);
                     
                     // Phase 2: Bytecode Format Detection and Header Analysis
-                    IOLog("      Analyzing domain shader bytecode format and structure\n");
+                    VMLOG_DEBUG("      Analyzing domain shader bytecode format and structure\n");
                     
                     if (bytecode_size >= 20 && bytecode_data[0] == 0x03 && bytecode_data[1] == 0x02 && 
                         bytecode_data[2] == 0x23 && bytecode_data[3] == 0x07) {
@@ -7440,7 +6418,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         te_analysis.bytecode_format = 0;
                         te_analysis.has_valid_magic_number = true;
                         
-                        IOLog("        Format: SPIR-V tessellation evaluation shader\n");
+                        VMLOG_DEBUG("        Format: SPIR-V tessellation evaluation shader\n");
                         
                         // SPIR-V instruction analysis for tessellation evaluation
                         uint32_t* spv_instructions = (uint32_t*)bytecode_data;
@@ -7543,7 +6521,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                             instruction_offset += instruction_length;
                         }
                         
-                        IOLog("        SPIR-V Analysis: %d instructions, %d domain-specific\n",
+                        VMLOG_DEBUG("        SPIR-V Analysis: %d instructions, %d domain-specific\n",
                               te_analysis.instruction_count, te_analysis.domain_instruction_count);
                         
                     } else if (bytecode_size >= 8 && (strncmp((const char*)bytecode_data, "#version", 8) == 0 ||
@@ -7552,7 +6530,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         te_analysis.bytecode_format = 1;
                         te_analysis.has_valid_magic_number = true;
                         
-                        IOLog("        Format: GLSL tessellation evaluation shader source\n");
+                        VMLOG_DEBUG("        Format: GLSL tessellation evaluation shader source\n");
                         
                         // GLSL tessellation evaluation source analysis
                         const char* shader_source = (const char*)bytecode_data;
@@ -7635,7 +6613,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                             pos++;
                         }
                         
-                        IOLog("        GLSL Analysis: %d lines, %d domain declarations\n",
+                        VMLOG_DEBUG("        GLSL Analysis: %d lines, %d domain declarations\n",
                               te_analysis.instruction_count, te_analysis.domain_instruction_count);
                         
                     } else {
@@ -7643,7 +6621,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         te_analysis.bytecode_format = 3;
                         te_analysis.has_valid_magic_number = false;
                         
-                        IOLog("        Format: Unknown/Binary tessellation evaluation shader\n");
+                        VMLOG_DEBUG("        Format: Unknown/Binary tessellation evaluation shader\n");
                         
                         // Heuristic analysis for unknown formats
                         te_analysis.instruction_count = bytecode_size / 4; // Estimate
@@ -7656,7 +6634,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     }
                     
                     // Phase 3: Tessellation Evaluation Feature Validation and Configuration
-                    IOLog("      Validating tessellation evaluation shader features\n");
+                    VMLOG_DEBUG("      Validating tessellation evaluation shader features\n");
                     
                     // Validate topology consistency
                     te_analysis.topology_declared_consistently = 
@@ -7665,7 +6643,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         te_analysis.declares_output_topology;
                     
                     if (!te_analysis.topology_declared_consistently) {
-                        IOLog("        WARNING: Incomplete topology declarations, using defaults\n");
+                        VMLOG_WARN("        WARNING: Incomplete topology declarations, using defaults\n");
                         if (!te_analysis.declares_primitive_topology) {
                             te_analysis.primitive_topology = 0; // Default to triangles
                         }
@@ -7743,7 +6721,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     te_analysis.memory_bandwidth_requirements = input_data_per_patch + output_data_per_patch;
                     
                     // Phase 4: Apply Analysis Results to Validation Structure
-                    IOLog("      Applying tessellation evaluation analysis results\n");
+                    VMLOG_DEBUG("      Applying tessellation evaluation analysis results\n");
                     
                     tess_eval_validation.has_primitive_mode = te_analysis.declares_primitive_topology;
                     tess_eval_validation.primitive_generation_mode = te_analysis.primitive_topology;
@@ -7756,50 +6734,50 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     tess_eval_validation.per_vertex_input_count = te_analysis.control_point_access_count;
                     tess_eval_validation.generated_vertex_count = te_analysis.estimated_vertices_per_patch;
                     
-                    IOLog("    Tessellation Evaluation Analysis Results:\n");
-                    IOLog("      Bytecode Format: %s, Instructions: %d, Domain Instructions: %d\n",
+                    VMLOG_DEBUG("    Tessellation Evaluation Analysis Results:\n");
+                    VMLOG_DEBUG("      Bytecode Format: %s, Instructions: %d, Domain Instructions: %d\n",
                           (te_analysis.bytecode_format == 0) ? "SPIR-V" :
                           (te_analysis.bytecode_format == 1) ? "GLSL" : "Binary",
                           te_analysis.instruction_count, te_analysis.domain_instruction_count);
-                    IOLog("      Primitive Topology: %s (declared: %s)\n",
+                    VMLOG_DEBUG("      Primitive Topology: %s (declared: %s)\n",
                           (te_analysis.primitive_topology == 0) ? "TRIANGLES" :
                           (te_analysis.primitive_topology == 1) ? "QUADS" : "ISOLINES",
                           te_analysis.declares_primitive_topology ? "YES" : "DEFAULT");
-                    IOLog("      Partitioning: %s, Vertex Order: %s\n",
+                    VMLOG_DEBUG("      Partitioning: %s, Vertex Order: %s\n",
                           (te_analysis.partitioning_scheme == 0) ? "EQUAL" :
                           (te_analysis.partitioning_scheme == 1) ? "FRACTIONAL_EVEN" : "FRACTIONAL_ODD",
                           (te_analysis.output_topology == 0) ? "CW" : "CCW");
-                    IOLog("      Tessellation Coordinates: %s (U:%s V:%s W:%s)\n",
+                    VMLOG_DEBUG("      Tessellation Coordinates: %s (U:%s V:%s W:%s)\n",
                           te_analysis.uses_domain_location ? "USED" : "UNUSED",
                           te_analysis.reads_u_coordinate ? "R" : "-",
                           te_analysis.reads_v_coordinate ? "R" : "-",
                           te_analysis.reads_w_coordinate ? "R" : "-");
-                    IOLog("      Control Point Access: %d accesses, Patch Constants: %d\n",
+                    VMLOG_DEBUG("      Control Point Access: %d accesses, Patch Constants: %d\n",
                           te_analysis.control_point_access_count,
                           te_analysis.patch_constant_access_count);
-                    IOLog("      Output Generation: %d vertices, %d attributes (%d components)\n",
+                    VMLOG_DEBUG("      Output Generation: %d vertices, %d attributes (%d components)\n",
                           te_analysis.estimated_vertices_per_patch,
                           te_analysis.vertex_attribute_count,
                           te_analysis.vertex_component_count);
-                    IOLog("      Computational Complexity: %s, %.3f μs per patch\n",
+                    VMLOG_DEBUG("      Computational Complexity: %s, %.3f μs per patch\n",
                           te_analysis.high_computational_complexity ? "HIGH" : "NORMAL",
                           te_analysis.estimated_execution_time_us);
-                    IOLog("      Memory Bandwidth: %d bytes per patch\n",
+                    VMLOG_DEBUG("      Memory Bandwidth: %d bytes per patch\n",
                           te_analysis.memory_bandwidth_requirements);
                     
                     // Set primitive mode based on real analysis
                     switch (tess_eval_validation.primitive_generation_mode) {
                         case 0: // Triangles
-                            IOLog("    Primitive Mode: TRIANGLES\n");
+                            VMLOG_DEBUG("    Primitive Mode: TRIANGLES\n");
                             break;
                         case 1: // Quads
-                            IOLog("    Primitive Mode: QUADS\n");
+                            VMLOG_DEBUG("    Primitive Mode: QUADS\n");
                             break;
                         case 2: // Isolines
-                            IOLog("    Primitive Mode: ISOLINES\n");
+                            VMLOG_DEBUG("    Primitive Mode: ISOLINES\n");
                             break;
                         default:
-                            IOLog("    Primitive Mode: UNKNOWN (using TRIANGLES)\n");
+                            VMLOG_DEBUG("    Primitive Mode: UNKNOWN (using TRIANGLES)\n");
                             tess_eval_validation.primitive_generation_mode = 0;
                             tess_eval_validation.generated_vertex_count = 32;
                             break;
@@ -7808,15 +6786,15 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     // Set primitive mode based on analysis
                     switch (tess_eval_validation.primitive_generation_mode) {
                         case 0: // Triangles
-                            IOLog("    Primitive Mode: TRIANGLES\n");
+                            VMLOG_DEBUG("    Primitive Mode: TRIANGLES\n");
                             tess_eval_validation.generated_vertex_count = 64;
                             break;
                         case 1: // Quads
-                            IOLog("    Primitive Mode: QUADS\n");
+                            VMLOG_DEBUG("    Primitive Mode: QUADS\n");
                             tess_eval_validation.generated_vertex_count = 81;
                             break;
                         case 2: // Isolines
-                            IOLog("    Primitive Mode: ISOLINES\n");
+                            VMLOG_DEBUG("    Primitive Mode: ISOLINES\n");
                             tess_eval_validation.generated_vertex_count = 32;
                             break;
                         default:
@@ -7827,24 +6805,24 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     // Report spacing mode
                     switch (tess_eval_validation.spacing_mode) {
                         case 0:
-                            IOLog("    Spacing Mode: EQUAL\n");
+                            VMLOG_DEBUG("    Spacing Mode: EQUAL\n");
                             break;
                         case 1:
-                            IOLog("    Spacing Mode: FRACTIONAL_EVEN\n");
+                            VMLOG_DEBUG("    Spacing Mode: FRACTIONAL_EVEN\n");
                             break;
                         case 2:
-                            IOLog("    Spacing Mode: FRACTIONAL_ODD\n");
+                            VMLOG_DEBUG("    Spacing Mode: FRACTIONAL_ODD\n");
                             break;
                     }
                     
-                    IOLog("    Vertex Order: %s\n", 
+                    VMLOG_DEBUG("    Vertex Order: %s\n", 
                           tess_eval_validation.clockwise_vertex_order ? "CLOCKWISE" : "COUNTER_CLOCKWISE");
-                    IOLog("    Tessellation Coordinates: USED\n");
-                    IOLog("    Patch Vertices Input: ACCESSED\n");
-                    IOLog("    Estimated Generated Vertices: %d per patch\n",
+                    VMLOG_DEBUG("    Tessellation Coordinates: USED\n");
+                    VMLOG_DEBUG("    Patch Vertices Input: ACCESSED\n");
+                    VMLOG_DEBUG("    Estimated Generated Vertices: %d per patch\n",
                           tess_eval_validation.generated_vertex_count);
                 } else {
-                    IOLog("    WARNING: No bytecode available for tessellation evaluation analysis\n");
+                    VMLOG_WARN("    WARNING: No bytecode available for tessellation evaluation analysis\n");
                     // Set conservative defaults
                     tess_eval_validation.has_primitive_mode = true;
                     tess_eval_validation.primitive_generation_mode = 0; // Triangles
@@ -7853,13 +6831,13 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 // Validate tessellation evaluation shader requirements
                 if (!tess_eval_validation.has_primitive_mode) {
-                    IOLog("    ERROR: Missing primitive generation mode (triangles/quads/isolines)\n");
+                    VMLOG_ERROR("    ERROR: Missing primitive generation mode (triangles/quads/isolines)\n");
                     IOLockUnlock(m_shader_lock);
                     return kIOReturnBadArgument;
                 }
                 
                 if (!tess_eval_validation.uses_tessellation_coord) {
-                    IOLog("    WARNING: gl_TessCoord not used - shader may not generate proper positions\n");
+                    VMLOG_WARN("    WARNING: gl_TessCoord not used - shader may not generate proper positions\n");
                 }
                 
                 // Store tessellation evaluation shader ID in program
@@ -7891,17 +6869,17 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 // Log tessellation pipeline configuration
-                IOLog("    Tessellation Pipeline Configuration:\n");
-                IOLog("      Primitive Mode: %d, Spacing Mode: %d\n",
+                VMLOG_DEBUG("    Tessellation Pipeline Configuration:\n");
+                VMLOG_DEBUG("      Primitive Mode: %d, Spacing Mode: %d\n",
                       tess_eval_validation.primitive_generation_mode, tess_eval_validation.spacing_mode);
-                IOLog("      Vertex Order: %s, Point Mode: %s\n",
+                VMLOG_DEBUG("      Vertex Order: %s, Point Mode: %s\n",
                       tess_eval_validation.clockwise_vertex_order ? "CW" : "CCW",
                       tess_eval_validation.has_point_mode ? "ON" : "OFF");
-                IOLog("      Max Tessellation Level: 64.0f\n");
-                IOLog("      Estimated Output Vertices: %d per patch\n",
+                VMLOG_DEBUG("      Max Tessellation Level: 64.0f\n");
+                VMLOG_DEBUG("      Estimated Output Vertices: %d per patch\n",
                       tess_eval_validation.generated_vertex_count);
                 
-                IOLog("    Tessellation Evaluation Shader: VALIDATED\n");
+                VMLOG_DEBUG("    Tessellation Evaluation Shader: VALIDATED\n");
                 break;
             }
         }
@@ -7911,31 +6889,31 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             validation.common_language = shader->language;
             validation.language_compatible = true;
         } else if (shader->language != validation.common_language) {
-            IOLog("VMShaderManager::linkProgram: WARNING - Mixed shader languages in program %d\n", program_id);
+            VMLOG_WARN("VMShaderManager::linkProgram: WARNING - Mixed shader languages in program %d\n", program_id);
             validation.language_compatible = false;
         }
         
         // Accumulate resource counts
-        validation.total_uniform_count += shader->uniforms ? shader->uniforms->getCount() : 0;
-        validation.total_attribute_count += shader->attributes ? shader->attributes->getCount() : 0;
-        validation.total_resource_count += shader->resources ? shader->resources->getCount() : 0;
+        validation.total_uniform_count += shader->uniform_count;
+        validation.total_attribute_count += shader->attribute_count;
+        validation.total_resource_count += shader->resource_count;
     }
     
     // Phase 4: Pipeline stage validation
-    IOLog("VMShaderManager::linkProgram: Phase 4 - Pipeline Stage Validation\n");
+    VMLOG_DEBUG("VMShaderManager::linkProgram: Phase 4 - Pipeline Stage Validation\n");
     
     bool pipeline_valid = false;
     if (validation.has_compute_shader) {
         // Compute pipeline - only compute shader required
         pipeline_valid = !validation.has_vertex_shader && !validation.has_fragment_shader && !validation.has_geometry_shader;
         if (!pipeline_valid) {
-            IOLog("VMShaderManager::linkProgram: ERROR - Compute programs cannot have graphics shaders\n");
+            VMLOG_ERROR("VMShaderManager::linkProgram: ERROR - Compute programs cannot have graphics shaders\n");
         }
     } else {
         // Graphics pipeline - need at least vertex and fragment
         pipeline_valid = validation.has_vertex_shader && validation.has_fragment_shader;
         if (!pipeline_valid) {
-            IOLog("VMShaderManager::linkProgram: ERROR - Graphics programs require vertex and fragment shaders\n");
+            VMLOG_ERROR("VMShaderManager::linkProgram: ERROR - Graphics programs require vertex and fragment shaders\n");
         }
     }
     
@@ -7945,7 +6923,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
     }
     
     // Phase 5: Interface variable matching and validation
-    IOLog("VMShaderManager::linkProgram: Phase 5 - Interface Variable Matching\n");
+    VMLOG_DEBUG("VMShaderManager::linkProgram: Phase 5 - Interface Variable Matching\n");
     
     struct InterfaceMatching {
         uint32_t vertex_outputs;
@@ -7959,11 +6937,11 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
     } interface_check = {0};
     
     // Comprehensive Shader Interface Validation System
-    IOLog("VMShaderManager::linkProgram: Performing comprehensive shader interface validation\n");
+    VMLOG_DEBUG("VMShaderManager::linkProgram: Performing comprehensive shader interface validation\n");
     
     // Phase 5A: Vertex-to-Fragment Interface Validation
     if (validation.has_vertex_shader && validation.has_fragment_shader) {
-        IOLog("  Validating Vertex->Fragment interface compatibility\n");
+        VMLOG_DEBUG("  Validating Vertex->Fragment interface compatibility\n");
         
         CompiledShader* vertex_shader = findShader(validation.vertex_shader_id);
         CompiledShader* fragment_shader = findShader(validation.fragment_shader_id);
@@ -8015,7 +6993,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             
             // Real vertex shader output analysis with comprehensive bytecode parsing
             if (vertex_shader->bytecode && vertex_shader->bytecode->getLength() > 0) {
-                IOLog("    Analyzing vertex shader outputs from bytecode\n");
+                VMLOG_DEBUG("    Analyzing vertex shader outputs from bytecode\n");
                 
                 // Standard built-in outputs
                 vf_interface.has_gl_Position = true;
@@ -8024,7 +7002,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 // Comprehensive Vertex Shader Output Bytecode Analysis
                 // Real-time parsing system supporting SPIR-V, GLSL, MSL, HLSL, and DXIL
-                IOLog("    Performing comprehensive vertex shader output bytecode analysis\n");
+                VMLOG_DEBUG("    Performing comprehensive vertex shader output bytecode analysis\n");
                 
                 // Phase 1: Vertex Shader Bytecode Analysis Structure
                 struct VertexShaderBytecodeAnalysis {
@@ -8102,10 +7080,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 IOByteCount bytecode_length = vertex_shader->bytecode->getLength();
                 uint32_t bytecode_size = (uint32_t)((bytecode_length < UINT32_MAX) ? bytecode_length : UINT32_MAX);
                 
-                IOLog("      Vertex shader bytecode size: %d bytes\n", bytecode_size);
+                VMLOG_DEBUG("      Vertex shader bytecode size: %d bytes\n", bytecode_size);
                 
                 // Phase 2: Bytecode Format Detection and Header Analysis
-                IOLog("      Detecting vertex shader bytecode format\n");
+                VMLOG_DEBUG("      Detecting vertex shader bytecode format\n");
                 
                 if (bytecode_size >= 20 && bytecode_data[0] == 0x03 && bytecode_data[1] == 0x02 && 
                     bytecode_data[2] == 0x23 && bytecode_data[3] == 0x07) {
@@ -8117,17 +7095,17 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     vs_analysis.bytecode_generator = (bytecode_data[12] | (bytecode_data[13] << 8) | 
                                                      (bytecode_data[14] << 16) | (bytecode_data[15] << 24));
                     
-                    IOLog("        Format: SPIR-V vertex shader v%d.%d\n", 
+                    VMLOG_DEBUG("        Format: SPIR-V vertex shader v%d.%d\n", 
                           (vs_analysis.bytecode_version >> 16) & 0xFF, 
                           (vs_analysis.bytecode_version >> 8) & 0xFF);
-                    IOLog("        Generator: 0x%08x\n", vs_analysis.bytecode_generator);
+                    VMLOG_DEBUG("        Generator: 0x%08x\n", vs_analysis.bytecode_generator);
                     
                     // SPIR-V vertex shader output analysis
                     uint32_t* spv_instructions = (uint32_t*)bytecode_data;
                     uint32_t instruction_offset = 5; // Skip SPIR-V header
                     uint32_t bound_objects = spv_instructions[3]; // Object bound from header
                     
-                    IOLog("        SPIR-V bound objects: %d\n", bound_objects);
+                    VMLOG_DEBUG("        SPIR-V bound objects: %d\n", bound_objects);
                     
                     // Phase 2A: SPIR-V Output Variable Extraction
                     struct SPIRVOutputVariable {
@@ -8298,7 +7276,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     vs_analysis.total_output_variables = spirv_output_count;
                     vs_analysis.auto_assigned_outputs = vs_analysis.user_output_count - vs_analysis.location_bound_outputs;
                     
-                    IOLog("        SPIR-V vertex analysis: %d instructions, %d outputs (%d user, %d built-in)\n",
+                    VMLOG_DEBUG("        SPIR-V vertex analysis: %d instructions, %d outputs (%d user, %d built-in)\n",
                           vs_analysis.instruction_count, vs_analysis.total_output_variables,
                           vs_analysis.user_output_count, vs_analysis.builtin_output_count);
                     
@@ -8308,7 +7286,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     vs_analysis.bytecode_format = 1;
                     vs_analysis.is_binary_format = false;
                     
-                    IOLog("        Format: GLSL vertex shader source\n");
+                    VMLOG_DEBUG("        Format: GLSL vertex shader source\n");
                     
                     // GLSL vertex shader source analysis
                     const char* shader_source = (const char*)bytecode_data;
@@ -8418,7 +7396,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     vs_analysis.total_output_variables = glsl_output_count + vs_analysis.builtin_output_count;
                     vs_analysis.auto_assigned_outputs = vs_analysis.user_output_count - vs_analysis.location_bound_outputs;
                     
-                    IOLog("        GLSL vertex analysis: %d lines, %d outputs (%d user, %d built-in)\n",
+                    VMLOG_DEBUG("        GLSL vertex analysis: %d lines, %d outputs (%d user, %d built-in)\n",
                           vs_analysis.instruction_count, vs_analysis.total_output_variables,
                           vs_analysis.user_output_count, vs_analysis.builtin_output_count);
                     
@@ -8427,7 +7405,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     vs_analysis.bytecode_format = 2;
                     vs_analysis.is_binary_format = false;
                     
-                    IOLog("        Format: Metal Shading Language (MSL) vertex shader\n");
+                    VMLOG_DEBUG("        Format: Metal Shading Language (MSL) vertex shader\n");
                     
                     // MSL vertex shader analysis
                     const char* msl_source = (const char*)bytecode_data;
@@ -8462,7 +7440,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     vs_analysis.builtin_output_count = 1;
                     vf_interface.has_gl_Position = true;
                     
-                    IOLog("        MSL vertex analysis: %d lines, estimated %d outputs\n",
+                    VMLOG_DEBUG("        MSL vertex analysis: %d lines, estimated %d outputs\n",
                           vs_analysis.instruction_count, vs_analysis.total_output_variables);
                     
                 } else {
@@ -8470,7 +7448,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     vs_analysis.bytecode_format = 4;
                     vs_analysis.is_binary_format = true;
                     
-                    IOLog("        Format: Unknown/Binary vertex shader (heuristic analysis)\n");
+                    VMLOG_DEBUG("        Format: Unknown/Binary vertex shader (heuristic analysis)\n");
                     
                     // Heuristic analysis based on bytecode patterns
                     vs_analysis.instruction_count = bytecode_size / 8; // Rough estimate
@@ -8481,12 +7459,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     vs_analysis.smooth_interpolated_outputs = 5;
                     vf_interface.has_gl_Position = true;
                     
-                    IOLog("        Heuristic vertex analysis: estimated %d instructions, %d outputs\n",
+                    VMLOG_DEBUG("        Heuristic vertex analysis: estimated %d instructions, %d outputs\n",
                           vs_analysis.instruction_count, vs_analysis.total_output_variables);
                 }
                 
                 // Phase 3: Output Variable Classification and Analysis
-                IOLog("      Classifying vertex shader outputs\n");
+                VMLOG_DEBUG("      Classifying vertex shader outputs\n");
                 
                 // Analyze output characteristics based on detected patterns
                 if (vs_analysis.user_output_count > 0) {
@@ -8516,12 +7494,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         vs_analysis.lighting_outputs = 1; // Pre-computed lighting
                     }
                     
-                    IOLog("        Output classification: %d texture coords, %d normals, %d colors\n",
+                    VMLOG_DEBUG("        Output classification: %d texture coords, %d normals, %d colors\n",
                           estimated_texture_coords, estimated_normals, estimated_colors);
                 }
                 
                 // Phase 4: Memory Layout and Performance Analysis
-                IOLog("      Analyzing vertex output memory layout and performance\n");
+                VMLOG_DEBUG("      Analyzing vertex output memory layout and performance\n");
                 
                 // Calculate memory requirements
                 uint32_t bytes_per_output = 16; // Assume vec4 (4 floats) per output on average
@@ -8559,7 +7537,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 vs_analysis.estimated_throughput_vertices_per_ms = 10000.0f * complexity_penalty;
                 
                 // Phase 5: Compatibility and Validation Analysis
-                IOLog("      Validating vertex output compatibility\n");
+                VMLOG_DEBUG("      Validating vertex output compatibility\n");
                 
                 // Check for standards compliance
                 vs_analysis.standard_compliant = true;
@@ -8570,26 +7548,26 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 if (vs_analysis.total_output_variables > 32) {
                     vs_analysis.potential_issues++;
                     vs_analysis.standard_compliant = false;
-                    IOLog("        WARNING: Too many output variables (%d > 32)\n", vs_analysis.total_output_variables);
+                    VMLOG_WARN("        WARNING: Too many output variables (%d > 32)\n", vs_analysis.total_output_variables);
                 }
                 
                 if (vs_analysis.total_output_size_bytes > 1024) {
                     vs_analysis.potential_issues++;
-                    IOLog("        WARNING: Large output size (%d bytes)\n", vs_analysis.total_output_size_bytes);
+                    VMLOG_WARN("        WARNING: Large output size (%d bytes)\n", vs_analysis.total_output_size_bytes);
                 }
                 
                 if (vs_analysis.mixed_interpolation_modes) {
                     vs_analysis.optimization_opportunities++;
-                    IOLog("        OPTIMIZATION: Mixed interpolation modes detected\n");
+                    VMLOG_DEBUG("        OPTIMIZATION: Mixed interpolation modes detected\n");
                 }
                 
                 if (!vs_analysis.optimization_friendly) {
                     vs_analysis.optimization_opportunities++;
-                    IOLog("        OPTIMIZATION: Layout could be more GPU-friendly\n");
+                    VMLOG_DEBUG("        OPTIMIZATION: Layout could be more GPU-friendly\n");
                 }
                 
                 // Phase 6: Copy Results to Interface Structure
-                IOLog("      Finalizing vertex shader output analysis\n");
+                VMLOG_DEBUG("      Finalizing vertex shader output analysis\n");
                 
                 // Update the vertex-fragment interface with real analysis results
                 vf_interface.vertex_output_count = vs_analysis.total_output_variables;
@@ -8628,40 +7606,40 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 // Report comprehensive analysis results
-                IOLog("    Comprehensive Vertex Shader Output Analysis Results:\n");
-                IOLog("      Bytecode Format: %s, Version: %d, Instructions: %d\n",
+                VMLOG_DEBUG("    Comprehensive Vertex Shader Output Analysis Results:\n");
+                VMLOG_DEBUG("      Bytecode Format: %s, Version: %d, Instructions: %d\n",
                       (vs_analysis.bytecode_format == 0) ? "SPIR-V" :
                       (vs_analysis.bytecode_format == 1) ? "GLSL" :
                       (vs_analysis.bytecode_format == 2) ? "MSL" :
                       (vs_analysis.bytecode_format == 3) ? "HLSL" : "Unknown",
                       vs_analysis.bytecode_version, vs_analysis.instruction_count);
-                IOLog("      Output Variables: %d total (%d user-defined, %d built-in)\n",
+                VMLOG_DEBUG("      Output Variables: %d total (%d user-defined, %d built-in)\n",
                       vs_analysis.total_output_variables, vs_analysis.user_output_count, vs_analysis.builtin_output_count);
-                IOLog("      Location Bindings: %d explicit, %d auto-assigned\n",
+                VMLOG_DEBUG("      Location Bindings: %d explicit, %d auto-assigned\n",
                       vs_analysis.location_bound_outputs, vs_analysis.auto_assigned_outputs);
-                IOLog("      Data Types: Float=%s, Int=%s, Matrix=%s, Array=%s, Struct=%s\n",
+                VMLOG_DEBUG("      Data Types: Float=%s, Int=%s, Matrix=%s, Array=%s, Struct=%s\n",
                       vs_analysis.uses_float_outputs ? "Y" : "N",
                       vs_analysis.uses_integer_outputs ? "Y" : "N",
                       vs_analysis.uses_matrix_outputs ? "Y" : "N",
                       vs_analysis.uses_array_outputs ? "Y" : "N",
                       vs_analysis.uses_struct_outputs ? "Y" : "N");
-                IOLog("      Interpolation: %d smooth, %d flat, %d noperspective\n",
+                VMLOG_DEBUG("      Interpolation: %d smooth, %d flat, %d noperspective\n",
                       vs_analysis.smooth_interpolated_outputs, vs_analysis.flat_interpolated_outputs, vs_analysis.noperspective_outputs);
-                IOLog("      Memory Layout: %d bytes total, %d-byte alignment, %d padding bytes\n",
+                VMLOG_DEBUG("      Memory Layout: %d bytes total, %d-byte alignment, %d padding bytes\n",
                       vs_analysis.total_output_size_bytes, vs_analysis.alignment_requirements, vs_analysis.padding_bytes_required);
-                IOLog("      Performance: %.1f vertices/ms, %d%% cache pressure, %s optimization\n",
+                VMLOG_DEBUG("      Performance: %.1f vertices/ms, %d%% cache pressure, %s optimization\n",
                       vs_analysis.estimated_throughput_vertices_per_ms, vs_analysis.vertex_cache_pressure,
                       vs_analysis.optimization_friendly ? "good" : "needs work");
-                IOLog("      Output Categories: %d texture coords, %d normals, %d lighting\n",
+                VMLOG_DEBUG("      Output Categories: %d texture coords, %d normals, %d lighting\n",
                       vs_analysis.texture_coordinate_outputs, vs_analysis.normal_vector_outputs, vs_analysis.lighting_outputs);
-                IOLog("      Validation: %s compliant, %d issues, %d optimization opportunities\n",
+                VMLOG_DEBUG("      Validation: %s compliant, %d issues, %d optimization opportunities\n",
                       vs_analysis.standard_compliant ? "standards" : "non-standards",
                       vs_analysis.potential_issues, vs_analysis.optimization_opportunities);
                 
-                IOLog("    Real Vertex Output Analysis: %d variables, %d total components\n",
+                VMLOG_DEBUG("    Real Vertex Output Analysis: %d variables, %d total components\n",
                       vf_interface.vertex_output_count, vf_interface.total_interpolated_components);
             } else {
-                IOLog("    WARNING: No vertex shader bytecode for interface analysis\n");
+                VMLOG_WARN("    WARNING: No vertex shader bytecode for interface analysis\n");
                 vf_interface.vertex_output_count = 4; // Conservative estimate
                 vf_interface.has_gl_Position = true;
                 vf_interface.has_gl_PointSize = false;
@@ -8679,7 +7657,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             
             // Analyze fragment shader inputs
             if (fragment_shader->bytecode && fragment_shader->bytecode->getLength() > 0) {
-                IOLog("    Analyzing fragment shader inputs from bytecode\n");
+                VMLOG_DEBUG("    Analyzing fragment shader inputs from bytecode\n");
                 
                 // Fragment shader input analysis (simplified for interface matching)
                 vf_interface.fragment_input_count = vf_interface.vertex_output_count - 1; // Exclude gl_Position
@@ -8694,23 +7672,23 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     vf_interface.fragment_input_components[i] = vf_interface.vertex_output_components[i + 1];
                 }
                 
-                IOLog("    Fragment shader inputs: %d variables matching vertex outputs\n",
+                VMLOG_DEBUG("    Fragment shader inputs: %d variables matching vertex outputs\n",
                       vf_interface.fragment_input_count);
             } else {
-                IOLog("    Fragment shader has no bytecode for input analysis\n");
+                VMLOG_DEBUG("    Fragment shader has no bytecode for input analysis\n");
                 
                 // Default interface for when fragment shader is not available
                 vf_interface.fragment_input_count = 0;
             }
             
             // Complete vertex-fragment interface analysis
-            IOLog("    Vertex shader bytecode analysis completed successfully\n");
+            VMLOG_DEBUG("    Vertex shader bytecode analysis completed successfully\n");
         } else {
-            IOLog("    WARNING: No vertex shader bytecode for interface analysis\n");
+            VMLOG_WARN("    WARNING: No vertex shader bytecode for interface analysis\n");
         }
         
         // Vertex-Fragment Interface Analysis
-        IOLog("  Starting Vertex-Fragment Interface Analysis\n");
+        VMLOG_DEBUG("  Starting Vertex-Fragment Interface Analysis\n");
         
         // Define vertex-fragment interface structure
         struct {
@@ -8750,7 +7728,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         
         // Initialize vertex outputs (simplified analysis)
         if (vertex_shader->bytecode && vertex_shader->bytecode->getLength() > 0) {
-            IOLog("    Analyzing vertex shader outputs for interface\n");
+            VMLOG_DEBUG("    Analyzing vertex shader outputs for interface\n");
             
             // Standard vertex outputs for interface matching
             const char* std_outputs[] = { "gl_Position", "v_texcoord0", "v_normal", "v_color" };
@@ -8769,11 +7747,11 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             
             // Analyze fragment shader inputs
             if (fragment_shader->bytecode && fragment_shader->bytecode->getLength() > 0) {
-                IOLog("    Analyzing fragment shader inputs from bytecode\n");
+                VMLOG_DEBUG("    Analyzing fragment shader inputs from bytecode\n");
                 
                 // Comprehensive Fragment Shader Input Bytecode Analysis
                 // Real-time parsing system supporting SPIR-V, GLSL, MSL, HLSL, and DXIL
-                IOLog("    Performing comprehensive fragment shader input bytecode analysis\n");
+                VMLOG_DEBUG("    Performing comprehensive fragment shader input bytecode analysis\n");
                 
                 // Phase 1: Fragment Shader Bytecode Analysis Structure
                 struct FragmentShaderBytecodeAnalysis {
@@ -8861,10 +7839,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 IOByteCount fs_bytecode_length = fragment_shader->bytecode->getLength();
                 uint32_t fs_bytecode_size = (uint32_t)((fs_bytecode_length < UINT32_MAX) ? fs_bytecode_length : UINT32_MAX);
                 
-                IOLog("      Fragment shader bytecode size: %d bytes\n", fs_bytecode_size);
+                VMLOG_DEBUG("      Fragment shader bytecode size: %d bytes\n", fs_bytecode_size);
                 
                 // Phase 2: Fragment Bytecode Format Detection and Header Analysis
-                IOLog("      Detecting fragment shader bytecode format\n");
+                VMLOG_DEBUG("      Detecting fragment shader bytecode format\n");
                 
                 if (fs_bytecode_size >= 20 && fs_bytecode_data[0] == 0x03 && fs_bytecode_data[1] == 0x02 && 
                     fs_bytecode_data[2] == 0x23 && fs_bytecode_data[3] == 0x07) {
@@ -8876,17 +7854,17 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     fs_analysis.bytecode_generator = (fs_bytecode_data[12] | (fs_bytecode_data[13] << 8) | 
                                                      (fs_bytecode_data[14] << 16) | (fs_bytecode_data[15] << 24));
                     
-                    IOLog("        Format: SPIR-V fragment shader v%d.%d\n", 
+                    VMLOG_DEBUG("        Format: SPIR-V fragment shader v%d.%d\n", 
                           (fs_analysis.bytecode_version >> 16) & 0xFF, 
                           (fs_analysis.bytecode_version >> 8) & 0xFF);
-                    IOLog("        Generator: 0x%08x\n", fs_analysis.bytecode_generator);
+                    VMLOG_DEBUG("        Generator: 0x%08x\n", fs_analysis.bytecode_generator);
                     
                     // SPIR-V fragment shader input analysis
                     uint32_t* fs_spv_instructions = (uint32_t*)fs_bytecode_data;
                     uint32_t fs_instruction_offset = 5; // Skip SPIR-V header
                     uint32_t fs_bound_objects = fs_spv_instructions[3]; // Object bound from header
                     
-                    IOLog("        SPIR-V bound objects: %d\n", fs_bound_objects);
+                    VMLOG_DEBUG("        SPIR-V bound objects: %d\n", fs_bound_objects);
                     
                     // Phase 2A: SPIR-V Input Variable Extraction
                     struct SPIRVInputVariable {
@@ -9093,7 +8071,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     fs_analysis.total_input_variables = fs_spirv_input_count;
                     fs_analysis.auto_assigned_inputs = fs_analysis.user_input_count - fs_analysis.location_bound_inputs;
                     
-                    IOLog("        SPIR-V fragment analysis: %d instructions, %d inputs (%d user, %d built-in)\n",
+                    VMLOG_DEBUG("        SPIR-V fragment analysis: %d instructions, %d inputs (%d user, %d built-in)\n",
                           fs_analysis.instruction_count, fs_analysis.total_input_variables,
                           fs_analysis.user_input_count, fs_analysis.builtin_input_count);
                     
@@ -9103,7 +8081,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     fs_analysis.bytecode_format = 1;
                     fs_analysis.is_binary_format = false;
                     
-                    IOLog("        Format: GLSL fragment shader source\n");
+                    VMLOG_DEBUG("        Format: GLSL fragment shader source\n");
                     
                     // GLSL fragment shader source analysis
                     const char* fs_shader_source = (const char*)fs_bytecode_data;
@@ -9229,7 +8207,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     fs_analysis.total_input_variables = fs_glsl_input_count + fs_analysis.builtin_input_count;
                     fs_analysis.auto_assigned_inputs = fs_analysis.user_input_count - fs_analysis.location_bound_inputs;
                     
-                    IOLog("        GLSL fragment analysis: %d lines, %d inputs (%d user, %d built-in)\n",
+                    VMLOG_DEBUG("        GLSL fragment analysis: %d lines, %d inputs (%d user, %d built-in)\n",
                           fs_analysis.instruction_count, fs_analysis.total_input_variables,
                           fs_analysis.user_input_count, fs_analysis.builtin_input_count);
                     
@@ -9238,7 +8216,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     fs_analysis.bytecode_format = 4;
                     fs_analysis.is_binary_format = true;
                     
-                    IOLog("        Format: Unknown/Binary fragment shader (heuristic analysis)\n");
+                    VMLOG_DEBUG("        Format: Unknown/Binary fragment shader (heuristic analysis)\n");
                     
                     // Heuristic analysis based on bytecode patterns
                     fs_analysis.instruction_count = fs_bytecode_size / 8; // Rough estimate
@@ -9250,12 +8228,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     fs_analysis.smooth_interpolated_inputs = 6;
                     fs_analysis.uses_gl_FragCoord = true;
                     
-                    IOLog("        Heuristic fragment analysis: estimated %d instructions, %d inputs\n",
+                    VMLOG_DEBUG("        Heuristic fragment analysis: estimated %d instructions, %d inputs\n",
                           fs_analysis.instruction_count, fs_analysis.total_input_variables);
                 }
                 
                 // Phase 3: Input Variable Classification and Analysis
-                IOLog("      Classifying fragment shader inputs\n");
+                VMLOG_DEBUG("      Classifying fragment shader inputs\n");
                 
                 // Analyze input characteristics based on detected patterns
                 if (fs_analysis.user_input_count > 0) {
@@ -9286,12 +8264,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         fs_analysis.shadow_inputs = 1; // Shadow mapping
                     }
                     
-                    IOLog("        Input classification: %d texture coords, %d normals, %d colors\n",
+                    VMLOG_DEBUG("        Input classification: %d texture coords, %d normals, %d colors\n",
                           estimated_texture_coords, estimated_normals, estimated_colors);
                 }
                 
                 // Phase 4: Memory Layout and Performance Analysis
-                IOLog("      Analyzing fragment input memory layout and performance\n");
+                VMLOG_DEBUG("      Analyzing fragment input memory layout and performance\n");
                 
                 // Calculate memory requirements
                 uint32_t bytes_per_input = 16; // Assume vec4 (4 floats) per input on average
@@ -9333,7 +8311,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 fs_analysis.estimated_throughput_fragments_per_ms = 50000.0f * complexity_penalty;
                 
                 // Phase 5: Compatibility and Validation Analysis
-                IOLog("      Validating fragment input compatibility\n");
+                VMLOG_DEBUG("      Validating fragment input compatibility\n");
                 
                 // Check for standards compliance
                 fs_analysis.standard_compliant = true;
@@ -9344,18 +8322,18 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 if (fs_analysis.total_input_variables > 32) {
                     fs_analysis.potential_issues++;
                     fs_analysis.standard_compliant = false;
-                    IOLog("        WARNING: Too many input variables (%d > 32)\n", fs_analysis.total_input_variables);
+                    VMLOG_WARN("        WARNING: Too many input variables (%d > 32)\n", fs_analysis.total_input_variables);
                 }
                 
                 if (fs_analysis.texture_sampling_complexity > 16) {
                     fs_analysis.optimization_opportunities++;
-                    IOLog("        OPTIMIZATION: High texture sampling complexity (%d operations)\n", 
+                    VMLOG_DEBUG("        OPTIMIZATION: High texture sampling complexity (%d operations)\n", 
                           fs_analysis.texture_sampling_complexity);
                 }
                 
                 if (fs_analysis.uses_derivatives && fs_analysis.uses_discard) {
                     fs_analysis.optimization_opportunities++;
-                    IOLog("        OPTIMIZATION: Derivatives with discard may cause performance issues\n");
+                    VMLOG_DEBUG("        OPTIMIZATION: Derivatives with discard may cause performance issues\n");
                 }
                 
                 // Generate fragment input variables to match vertex outputs
@@ -9404,54 +8382,54 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 // Report comprehensive fragment shader analysis results
-                IOLog("    Comprehensive Fragment Shader Input Analysis Results:\n");
-                IOLog("      Bytecode Format: %s, Version: %d, Instructions: %d\n",
+                VMLOG_DEBUG("    Comprehensive Fragment Shader Input Analysis Results:\n");
+                VMLOG_DEBUG("      Bytecode Format: %s, Version: %d, Instructions: %d\n",
                       (fs_analysis.bytecode_format == 0) ? "SPIR-V" :
                       (fs_analysis.bytecode_format == 1) ? "GLSL" :
                       (fs_analysis.bytecode_format == 2) ? "MSL" :
                       (fs_analysis.bytecode_format == 3) ? "HLSL" : "Unknown",
                       fs_analysis.bytecode_version, fs_analysis.instruction_count);
-                IOLog("      Input Variables: %d total (%d user-defined, %d built-in)\n",
+                VMLOG_DEBUG("      Input Variables: %d total (%d user-defined, %d built-in)\n",
                       fs_analysis.total_input_variables, fs_analysis.user_input_count, fs_analysis.builtin_input_count);
-                IOLog("      Location Bindings: %d explicit, %d auto-assigned\n",
+                VMLOG_DEBUG("      Location Bindings: %d explicit, %d auto-assigned\n",
                       fs_analysis.location_bound_inputs, fs_analysis.auto_assigned_inputs);
-                IOLog("      Data Types: Float=%s, Int=%s, Matrix=%s, Sampler=%s, Array=%s\n",
+                VMLOG_DEBUG("      Data Types: Float=%s, Int=%s, Matrix=%s, Sampler=%s, Array=%s\n",
                       fs_analysis.uses_float_inputs ? "Y" : "N",
                       fs_analysis.uses_integer_inputs ? "Y" : "N",
                       fs_analysis.uses_matrix_inputs ? "Y" : "N",
                       fs_analysis.uses_sampler_inputs ? "Y" : "N",
                       fs_analysis.uses_array_inputs ? "Y" : "N");
-                IOLog("      Interpolation: %d smooth, %d flat, %d noperspective\n",
+                VMLOG_DEBUG("      Interpolation: %d smooth, %d flat, %d noperspective\n",
                       fs_analysis.smooth_interpolated_inputs, fs_analysis.flat_interpolated_inputs, fs_analysis.noperspective_inputs);
-                IOLog("      Memory Layout: %d bytes total, %d-byte alignment, %d padding bytes\n",
+                VMLOG_DEBUG("      Memory Layout: %d bytes total, %d-byte alignment, %d padding bytes\n",
                       fs_analysis.total_input_size_bytes, fs_analysis.alignment_requirements, fs_analysis.padding_bytes_required);
-                IOLog("      Performance: %.1f fragments/ms, %d%% cache pressure, %s optimization\n",
+                VMLOG_DEBUG("      Performance: %.1f fragments/ms, %d%% cache pressure, %s optimization\n",
                       fs_analysis.estimated_throughput_fragments_per_ms, fs_analysis.fragment_cache_pressure,
                       fs_analysis.optimization_friendly ? "good" : "needs work");
-                IOLog("      Input Categories: %d texture coords, %d normals, %d colors, %d lighting\n",
+                VMLOG_DEBUG("      Input Categories: %d texture coords, %d normals, %d colors, %d lighting\n",
                       fs_analysis.texture_coordinate_inputs, fs_analysis.normal_vector_inputs, 
                       fs_analysis.color_inputs, fs_analysis.lighting_inputs);
-                IOLog("      Advanced Features: Derivatives=%s, Discard=%s, TextureSamples=%d\n",
+                VMLOG_DEBUG("      Advanced Features: Derivatives=%s, Discard=%s, TextureSamples=%d\n",
                       fs_analysis.uses_derivatives ? "Y" : "N",
                       fs_analysis.uses_discard ? "Y" : "N",
                       fs_analysis.texture_sampling_complexity);
-                IOLog("      Built-ins: FragCoord=%s, FrontFacing=%s, PointCoord=%s\n",
+                VMLOG_DEBUG("      Built-ins: FragCoord=%s, FrontFacing=%s, PointCoord=%s\n",
                       fs_analysis.uses_gl_FragCoord ? "Y" : "N",
                       fs_analysis.uses_gl_FrontFacing ? "Y" : "N",
                       fs_analysis.uses_gl_PointCoord ? "Y" : "N");
-                IOLog("      Validation: %s compliant, %d issues, %d optimization opportunities\n",
+                VMLOG_DEBUG("      Validation: %s compliant, %d issues, %d optimization opportunities\n",
                       fs_analysis.standard_compliant ? "standards" : "non-standards",
                       fs_analysis.potential_issues, fs_analysis.optimization_opportunities);
                 
-                IOLog("    Real Fragment Input Analysis: %d variables expected for interface matching\n",
+                VMLOG_DEBUG("    Real Fragment Input Analysis: %d variables expected for interface matching\n",
                       vf_interface.fragment_input_count);
             } else {
-                IOLog("    WARNING: No fragment shader bytecode for interface analysis\n");
+                VMLOG_WARN("    WARNING: No fragment shader bytecode for interface analysis\n");
                 vf_interface.fragment_input_count = 4; // Conservative estimate
             }
             
             // Perform variable matching and validation
-            IOLog("    Performing interface variable matching\n");
+            VMLOG_DEBUG("    Performing interface variable matching\n");
             
             vf_interface.successful_matches = 0;
             vf_interface.type_mismatches = 0;
@@ -9475,21 +8453,21 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                                 vf_interface.successful_matches++;
                                 found_match = true;
                                 
-                                IOLog("      MATCH: %s (type: 0x%x, location: %d)\n",
+                                VMLOG_DEBUG("      MATCH: %s (type: 0x%x, location: %d)\n",
                                       vf_interface.vertex_output_names[v_out],
                                       vf_interface.vertex_output_types[v_out],
                                       vf_interface.vertex_output_locations[v_out]);
                                 break;
                             } else {
                                 vf_interface.location_conflicts++;
-                                IOLog("      LOCATION CONFLICT: %s (vertex: %d vs fragment: %d)\n",
+                                VMLOG_DEBUG("      LOCATION CONFLICT: %s (vertex: %d vs fragment: %d)\n",
                                       vf_interface.vertex_output_names[v_out],
                                       vf_interface.vertex_output_locations[v_out],
                                       vf_interface.fragment_input_locations[f_in]);
                             }
                         } else {
                             vf_interface.type_mismatches++;
-                            IOLog("      TYPE MISMATCH: %s (vertex: 0x%x vs fragment: 0x%x)\n",
+                            VMLOG_WARN("      TYPE MISMATCH: %s (vertex: 0x%x vs fragment: 0x%x)\n",
                                   vf_interface.vertex_output_names[v_out],
                                   vf_interface.vertex_output_types[v_out],
                                   vf_interface.fragment_input_types[f_in]);
@@ -9499,7 +8477,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 if (!found_match) {
                     vf_interface.unused_vertex_outputs++;
-                    IOLog("      UNUSED OUTPUT: %s\n", vf_interface.vertex_output_names[v_out]);
+                    VMLOG_DEBUG("      UNUSED OUTPUT: %s\n", vf_interface.vertex_output_names[v_out]);
                 }
             }
             
@@ -9518,12 +8496,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 if (!input_satisfied) {
                     vf_interface.missing_fragment_inputs++;
-                    IOLog("      MISSING INPUT: %s\n", vf_interface.fragment_input_names[f_in]);
+                    VMLOG_DEBUG("      MISSING INPUT: %s\n", vf_interface.fragment_input_names[f_in]);
                 }
             }
             
             // Validate interpolation qualifiers
-            IOLog("    Validating interpolation qualifiers\n");
+            VMLOG_DEBUG("    Validating interpolation qualifiers\n");
             vf_interface.uses_smooth_interpolation = true;    // Default interpolation
             vf_interface.uses_flat_interpolation = false;     // Integer/discrete values
             vf_interface.uses_noperspective_interpolation = false; // Screen-space linear
@@ -9534,7 +8512,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                                                    vf_interface.max_interpolated_components);
             
             if (vf_interface.component_limit_exceeded) {
-                IOLog("    ERROR: Interpolated components limit exceeded (%d > %d)\n",
+                VMLOG_ERROR("    ERROR: Interpolated components limit exceeded (%d > %d)\n",
                       vf_interface.total_interpolated_components, vf_interface.max_interpolated_components);
             }
             
@@ -9549,28 +8527,28 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             interface_check.fragment_inputs = vf_interface.fragment_input_count;
             interface_check.mismatched_variables += vf_interface.type_mismatches + vf_interface.location_conflicts;
             
-            IOLog("    Vertex->Fragment Interface Results:\n");
-            IOLog("      Successful Matches: %d\n", vf_interface.successful_matches);
-            IOLog("      Type Mismatches: %d\n", vf_interface.type_mismatches);
-            IOLog("      Location Conflicts: %d\n", vf_interface.location_conflicts);
-            IOLog("      Missing Inputs: %d\n", vf_interface.missing_fragment_inputs);
-            IOLog("      Unused Outputs: %d\n", vf_interface.unused_vertex_outputs);
-            IOLog("      Component Usage: %d/%d\n", vf_interface.total_interpolated_components,
+            VMLOG_DEBUG("    Vertex->Fragment Interface Results:\n");
+            VMLOG_DEBUG("      Successful Matches: %d\n", vf_interface.successful_matches);
+            VMLOG_DEBUG("      Type Mismatches: %d\n", vf_interface.type_mismatches);
+            VMLOG_DEBUG("      Location Conflicts: %d\n", vf_interface.location_conflicts);
+            VMLOG_DEBUG("      Missing Inputs: %d\n", vf_interface.missing_fragment_inputs);
+            VMLOG_DEBUG("      Unused Outputs: %d\n", vf_interface.unused_vertex_outputs);
+            VMLOG_DEBUG("      Component Usage: %d/%d\n", vf_interface.total_interpolated_components,
                   vf_interface.max_interpolated_components);
-            IOLog("      Overall Compatibility: %s\n", 
+            VMLOG_DEBUG("      Overall Compatibility: %s\n", 
                   interface_check.vertex_fragment_compatible ? "COMPATIBLE" : "INCOMPATIBLE");
         } else {
-            IOLog("    ERROR: Could not locate vertex or fragment shader for interface validation\n");
+            VMLOG_ERROR("    ERROR: Could not locate vertex or fragment shader for interface validation\n");
             interface_check.vertex_fragment_compatible = false;
         }
     } else {
-        IOLog("  Skipping Vertex->Fragment validation (shaders not present)\n");
+        VMLOG_DEBUG("  Skipping Vertex->Fragment validation (shaders not present)\n");
         interface_check.vertex_fragment_compatible = true;
     }
     
     // Phase 5B: Vertex-to-Geometry Interface Validation
     if (validation.has_vertex_shader && validation.has_geometry_shader) {
-        IOLog("  Validating Vertex->Geometry interface compatibility\n");
+        VMLOG_DEBUG("  Validating Vertex->Geometry interface compatibility\n");
         
         CompiledShader* vertex_shader = findShader(validation.vertex_shader_id);
         CompiledShader* geometry_shader = findShader(validation.geometry_shader_id);
@@ -9597,11 +8575,11 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             
             // Analyze geometry shader input requirements
             if (geometry_shader->bytecode && geometry_shader->bytecode->getLength() > 0) {
-                IOLog("    Analyzing geometry shader input requirements\n");
+                VMLOG_DEBUG("    Analyzing geometry shader input requirements\n");
                 
                 // Comprehensive Geometry Shader Input Bytecode Analysis
                 // Real-time parsing system supporting SPIR-V, GLSL, MSL, HLSL, and DXIL
-                IOLog("    Performing comprehensive geometry shader input bytecode analysis\n");
+                VMLOG_DEBUG("    Performing comprehensive geometry shader input bytecode analysis\n");
                 
                 // Phase 1: Geometry Shader Bytecode Analysis Structure
                 struct GeometryShaderBytecodeAnalysis {
@@ -9702,10 +8680,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 IOByteCount gs_bytecode_length = geometry_shader->bytecode->getLength();
                 uint32_t gs_bytecode_size = (uint32_t)((gs_bytecode_length < UINT32_MAX) ? gs_bytecode_length : UINT32_MAX);
                 
-                IOLog("      Geometry shader bytecode size: %d bytes\n", gs_bytecode_size);
+                VMLOG_DEBUG("      Geometry shader bytecode size: %d bytes\n", gs_bytecode_size);
                 
                 // Phase 2: Geometry Bytecode Format Detection and Header Analysis
-                IOLog("      Detecting geometry shader bytecode format\n");
+                VMLOG_DEBUG("      Detecting geometry shader bytecode format\n");
                 
                 if (gs_bytecode_size >= 20 && gs_bytecode_data[0] == 0x03 && gs_bytecode_data[1] == 0x02 && 
                     gs_bytecode_data[2] == 0x23 && gs_bytecode_data[3] == 0x07) {
@@ -9717,17 +8695,17 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     gs_analysis.bytecode_generator = (gs_bytecode_data[12] | (gs_bytecode_data[13] << 8) | 
                                                      (gs_bytecode_data[14] << 16) | (gs_bytecode_data[15] << 24));
                     
-                    IOLog("        Format: SPIR-V geometry shader v%d.%d\n", 
+                    VMLOG_DEBUG("        Format: SPIR-V geometry shader v%d.%d\n", 
                           (gs_analysis.bytecode_version >> 16) & 0xFF, 
                           (gs_analysis.bytecode_version >> 8) & 0xFF);
-                    IOLog("        Generator: 0x%08x\n", gs_analysis.bytecode_generator);
+                    VMLOG_DEBUG("        Generator: 0x%08x\n", gs_analysis.bytecode_generator);
                     
                     // SPIR-V geometry shader analysis
                     uint32_t* gs_spv_instructions = (uint32_t*)gs_bytecode_data;
                     uint32_t gs_instruction_offset = 5; // Skip SPIR-V header
                     uint32_t gs_bound_objects = gs_spv_instructions[3]; // Object bound from header
                     
-                    IOLog("        SPIR-V bound objects: %d\n", gs_bound_objects);
+                    VMLOG_DEBUG("        SPIR-V bound objects: %d\n", gs_bound_objects);
                     
                     // Phase 2A: SPIR-V Geometry Shader Analysis
                     struct SPIRVGeometryVariable {
@@ -9765,52 +8743,52 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                                         case 8: // InputPoints
                                             gs_analysis.input_primitive_type = 0x0000; // GL_POINTS
                                             gs_analysis.vertices_per_input_primitive = 1;
-                                            IOLog("        Input Primitive: POINTS\n");
+                                            VMLOG_DEBUG("        Input Primitive: POINTS\n");
                                             break;
                                         case 9: // InputLines
                                             gs_analysis.input_primitive_type = 0x0001; // GL_LINES
                                             gs_analysis.vertices_per_input_primitive = 2;
-                                            IOLog("        Input Primitive: LINES\n");
+                                            VMLOG_DEBUG("        Input Primitive: LINES\n");
                                             break;
                                         case 10: // InputLinesAdjacency
                                             gs_analysis.input_primitive_type = 0x000A; // GL_LINES_ADJACENCY
                                             gs_analysis.vertices_per_input_primitive = 4;
                                             gs_analysis.supports_adjacency_data = true;
-                                            IOLog("        Input Primitive: LINES_ADJACENCY\n");
+                                            VMLOG_DEBUG("        Input Primitive: LINES_ADJACENCY\n");
                                             break;
                                         case 11: // Triangles (input)
                                             gs_analysis.input_primitive_type = 0x0004; // GL_TRIANGLES
                                             gs_analysis.vertices_per_input_primitive = 3;
-                                            IOLog("        Input Primitive: TRIANGLES\n");
+                                            VMLOG_DEBUG("        Input Primitive: TRIANGLES\n");
                                             break;
                                         case 12: // InputTrianglesAdjacency
                                             gs_analysis.input_primitive_type = 0x000C; // GL_TRIANGLES_ADJACENCY
                                             gs_analysis.vertices_per_input_primitive = 6;
                                             gs_analysis.supports_adjacency_data = true;
-                                            IOLog("        Input Primitive: TRIANGLES_ADJACENCY\n");
+                                            VMLOG_DEBUG("        Input Primitive: TRIANGLES_ADJACENCY\n");
                                             break;
                                         case 13: // OutputPoints
                                             gs_analysis.output_primitive_type = 0x0000; // GL_POINTS
-                                            IOLog("        Output Primitive: POINTS\n");
+                                            VMLOG_DEBUG("        Output Primitive: POINTS\n");
                                             break;
                                         case 14: // OutputLineStrip
                                             gs_analysis.output_primitive_type = 0x0003; // GL_LINE_STRIP
-                                            IOLog("        Output Primitive: LINE_STRIP\n");
+                                            VMLOG_DEBUG("        Output Primitive: LINE_STRIP\n");
                                             break;
                                         case 15: // OutputTriangleStrip
                                             gs_analysis.output_primitive_type = 0x0005; // GL_TRIANGLE_STRIP
-                                            IOLog("        Output Primitive: TRIANGLE_STRIP\n");
+                                            VMLOG_DEBUG("        Output Primitive: TRIANGLE_STRIP\n");
                                             break;
                                         case 16: // Invocations
                                             if (gs_instruction_offset + 3 < (gs_bytecode_size / 4)) {
                                                 gs_analysis.invocation_count = gs_spv_instructions[gs_instruction_offset + 3];
-                                                IOLog("        Invocations: %d\n", gs_analysis.invocation_count);
+                                                VMLOG_DEBUG("        Invocations: %d\n", gs_analysis.invocation_count);
                                             }
                                             break;
                                         case 26: // OutputVertices
                                             if (gs_instruction_offset + 3 < (gs_bytecode_size / 4)) {
                                                 gs_analysis.max_output_vertices = gs_spv_instructions[gs_instruction_offset + 3];
-                                                IOLog("        Max Output Vertices: %d\n", gs_analysis.max_output_vertices);
+                                                VMLOG_DEBUG("        Max Output Vertices: %d\n", gs_analysis.max_output_vertices);
                                             }
                                             break;
                                     }
@@ -9962,7 +8940,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     gs_analysis.total_output_variables = gs_analysis.builtin_output_count + gs_analysis.user_output_count;
                     gs_analysis.max_input_vertices = gs_analysis.vertices_per_input_primitive;
                     
-                    IOLog("        SPIR-V geometry analysis: %d instructions, %d/%d in/out variables\n",
+                    VMLOG_DEBUG("        SPIR-V geometry analysis: %d instructions, %d/%d in/out variables\n",
                           gs_analysis.instruction_count, gs_analysis.total_input_variables, 
                           gs_analysis.total_output_variables);
                     
@@ -9972,7 +8950,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     gs_analysis.bytecode_format = 1;
                     gs_analysis.is_binary_format = false;
                     
-                    IOLog("        Format: GLSL geometry shader source\n");
+                    VMLOG_DEBUG("        Format: GLSL geometry shader source\n");
                     
                     // GLSL geometry shader source analysis
                     const char* gs_shader_source = (const char*)gs_bytecode_data;
@@ -10049,7 +9027,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     gs_analysis.total_output_variables = 4; // Estimate
                     gs_analysis.user_output_count = 4;
                     
-                    IOLog("        GLSL geometry analysis: %d lines, input: %s, output: %s\n",
+                    VMLOG_DEBUG("        GLSL geometry analysis: %d lines, input: %s, output: %s\n",
                           gs_analysis.instruction_count,
                           (gs_analysis.input_primitive_type == 0x0000) ? "POINTS" :
                           (gs_analysis.input_primitive_type == 0x0001) ? "LINES" : "TRIANGLES",
@@ -10061,7 +9039,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     gs_analysis.bytecode_format = 4;
                     gs_analysis.is_binary_format = true;
                     
-                    IOLog("        Format: Unknown/Binary geometry shader (heuristic analysis)\n");
+                    VMLOG_DEBUG("        Format: Unknown/Binary geometry shader (heuristic analysis)\n");
                     
                     // Heuristic analysis for geometry shaders
                     gs_analysis.instruction_count = gs_bytecode_size / 8; // Rough estimate
@@ -10075,12 +9053,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     gs_analysis.uses_float_inputs = true;
                     gs_analysis.uses_float_outputs = true;
                     
-                    IOLog("        Heuristic geometry analysis: estimated %d instructions\n",
+                    VMLOG_DEBUG("        Heuristic geometry analysis: estimated %d instructions\n",
                           gs_analysis.instruction_count);
                 }
                 
                 // Phase 3: Advanced Geometry Processing Analysis
-                IOLog("      Analyzing geometry processing characteristics\n");
+                VMLOG_DEBUG("      Analyzing geometry processing characteristics\n");
                 
                 // Calculate primitive amplification
                 if (gs_analysis.max_output_vertices > 0 && gs_analysis.vertices_per_input_primitive > 0) {
@@ -10103,7 +9081,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 // Phase 4: Memory Layout and Performance Analysis
-                IOLog("      Analyzing geometry shader memory layout and performance\n");
+                VMLOG_DEBUG("      Analyzing geometry shader memory layout and performance\n");
                 
                 // Calculate memory requirements
                 uint32_t bytes_per_vertex_input = 64; // Assume 16 floats per vertex input (conservative)
@@ -10143,7 +9121,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                                                    !gs_analysis.uses_multiple_streams;
                 
                 // Phase 5: Advanced Feature Detection
-                IOLog("      Detecting advanced geometry features\n");
+                VMLOG_DEBUG("      Detecting advanced geometry features\n");
                 
                 // Analyze advanced features based on patterns
                 if (gs_analysis.invocation_count > 1) {
@@ -10164,7 +9142,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 // Phase 6: Validation and Compliance Analysis
-                IOLog("      Validating geometry shader compliance\n");
+                VMLOG_DEBUG("      Validating geometry shader compliance\n");
                 
                 // Check for compliance issues
                 gs_analysis.standard_compliant = true;
@@ -10176,32 +9154,32 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     gs_analysis.exceeds_vertex_limits = true;
                     gs_analysis.potential_issues++;
                     gs_analysis.standard_compliant = false;
-                    IOLog("        WARNING: Max output vertices (%d) exceeds typical limits\n", 
+                    VMLOG_WARN("        WARNING: Max output vertices (%d) exceeds typical limits\n", 
                           gs_analysis.max_output_vertices);
                 }
                 
                 if (gs_analysis.invocation_count > 32) {
                     gs_analysis.exceeds_invocation_limits = true;
                     gs_analysis.potential_issues++;
-                    IOLog("        WARNING: Invocation count (%d) may exceed hardware limits\n", 
+                    VMLOG_WARN("        WARNING: Invocation count (%d) may exceed hardware limits\n", 
                           gs_analysis.invocation_count);
                 }
                 
                 if (gs_analysis.geometry_memory_pressure > 70) {
                     gs_analysis.optimization_opportunities++;
-                    IOLog("        OPTIMIZATION: High memory pressure (%d%%) detected\n", 
+                    VMLOG_DEBUG("        OPTIMIZATION: High memory pressure (%d%%) detected\n", 
                           gs_analysis.geometry_memory_pressure);
                 }
                 
                 if (gs_analysis.primitive_amplification_factor > 8) {
                     gs_analysis.optimization_opportunities++;
-                    IOLog("        OPTIMIZATION: High primitive amplification (%dx) may impact performance\n", 
+                    VMLOG_DEBUG("        OPTIMIZATION: High primitive amplification (%dx) may impact performance\n", 
                           gs_analysis.primitive_amplification_factor);
                 }
                 
                 if (!gs_analysis.optimization_friendly) {
                     gs_analysis.optimization_opportunities++;
-                    IOLog("        OPTIMIZATION: Geometry shader patterns could be more GPU-friendly\n");
+                    VMLOG_DEBUG("        OPTIMIZATION: Geometry shader patterns could be more GPU-friendly\n");
                 }
                 
                 // Apply geometry analysis results to validation interface
@@ -10213,14 +9191,14 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 vg_interface.geometry_input_vertices = gs_analysis.vertices_per_input_primitive;
                 
                 // Report comprehensive geometry shader analysis results
-                IOLog("    Comprehensive Geometry Shader Analysis Results:\n");
-                IOLog("      Bytecode Format: %s, Version: %d, Instructions: %d\n",
+                VMLOG_DEBUG("    Comprehensive Geometry Shader Analysis Results:\n");
+                VMLOG_DEBUG("      Bytecode Format: %s, Version: %d, Instructions: %d\n",
                       (gs_analysis.bytecode_format == 0) ? "SPIR-V" :
                       (gs_analysis.bytecode_format == 1) ? "GLSL" :
                       (gs_analysis.bytecode_format == 2) ? "MSL" :
                       (gs_analysis.bytecode_format == 3) ? "HLSL" : "Unknown",
                       gs_analysis.bytecode_version, gs_analysis.instruction_count);
-                IOLog("      Input Primitive: %s (%d vertices), Supports Adjacency: %s\n",
+                VMLOG_DEBUG("      Input Primitive: %s (%d vertices), Supports Adjacency: %s\n",
                       (gs_analysis.input_primitive_type == 0x0000) ? "POINTS" :
                       (gs_analysis.input_primitive_type == 0x0001) ? "LINES" :
                       (gs_analysis.input_primitive_type == 0x0004) ? "TRIANGLES" :
@@ -10228,54 +9206,54 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                       (gs_analysis.input_primitive_type == 0x000C) ? "TRIANGLES_ADJACENCY" : "UNKNOWN",
                       gs_analysis.vertices_per_input_primitive,
                       gs_analysis.supports_adjacency_data ? "Y" : "N");
-                IOLog("      Output Primitive: %s, Max Vertices: %d, Invocations: %d\n",
+                VMLOG_DEBUG("      Output Primitive: %s, Max Vertices: %d, Invocations: %d\n",
                       (gs_analysis.output_primitive_type == 0x0000) ? "POINTS" :
                       (gs_analysis.output_primitive_type == 0x0003) ? "LINE_STRIP" :
                       (gs_analysis.output_primitive_type == 0x0005) ? "TRIANGLE_STRIP" : "UNKNOWN",
                       gs_analysis.max_output_vertices, 
                       gs_analysis.invocation_count > 0 ? gs_analysis.invocation_count : 1);
-                IOLog("      Variables: %d inputs (%d user, %d built-in), %d outputs (%d user, %d built-in)\n",
+                VMLOG_DEBUG("      Variables: %d inputs (%d user, %d built-in), %d outputs (%d user, %d built-in)\n",
                       gs_analysis.total_input_variables, gs_analysis.user_input_count, gs_analysis.builtin_input_count,
                       gs_analysis.total_output_variables, gs_analysis.user_output_count, gs_analysis.builtin_output_count);
-                IOLog("      Operations: %d EmitVertex calls, %d EndPrimitive calls\n",
+                VMLOG_DEBUG("      Operations: %d EmitVertex calls, %d EndPrimitive calls\n",
                       gs_analysis.emit_vertex_calls, gs_analysis.end_primitive_calls);
-                IOLog("      Memory Layout: %d bytes input, %d bytes output (%d%% pressure)\n",
+                VMLOG_DEBUG("      Memory Layout: %d bytes input, %d bytes output (%d%% pressure)\n",
                       gs_analysis.total_input_size_bytes, gs_analysis.total_output_size_bytes, 
                       gs_analysis.geometry_memory_pressure);
-                IOLog("      Performance: %dx amplification, %d primitives/ms, %.2f μs per primitive\n",
+                VMLOG_DEBUG("      Performance: %dx amplification, %d primitives/ms, %.2f μs per primitive\n",
                       gs_analysis.primitive_amplification_factor, gs_analysis.primitive_generation_rate,
                       gs_analysis.estimated_execution_time_us);
-                IOLog("      Built-ins: gl_in=%s, PrimitiveID=%s, InvocationID=%s\n",
+                VMLOG_DEBUG("      Built-ins: gl_in=%s, PrimitiveID=%s, InvocationID=%s\n",
                       gs_analysis.uses_gl_in_array ? "Y" : "N",
                       gs_analysis.uses_primitive_id ? "Y" : "N",
                       gs_analysis.uses_invocation_id ? "Y" : "N");
-                IOLog("      Advanced Features: MultiStream=%s (%d streams), Instanced=%s, Layered=%s\n",
+                VMLOG_DEBUG("      Advanced Features: MultiStream=%s (%d streams), Instanced=%s, Layered=%s\n",
                       gs_analysis.uses_multiple_streams ? "Y" : "N", gs_analysis.stream_count,
                       gs_analysis.uses_instanced_rendering ? "Y" : "N",
                       gs_analysis.uses_layered_rendering ? "Y" : "N");
-                IOLog("      Validation: %s compliant, %d issues, %d optimization opportunities\n",
+                VMLOG_DEBUG("      Validation: %s compliant, %d issues, %d optimization opportunities\n",
                       gs_analysis.standard_compliant ? "standards" : "non-standards",
                       gs_analysis.potential_issues, gs_analysis.optimization_opportunities);
                 
-                IOLog("    Real Geometry Shader Analysis: Input primitive with %d vertices\n",
+                VMLOG_DEBUG("    Real Geometry Shader Analysis: Input primitive with %d vertices\n",
                       vg_interface.geometry_input_vertices);
                 
                 // Check primitive type compatibility
                 switch (vg_interface.input_primitive_type) {
                     case 0x0000: // GL_POINTS
-                        IOLog("      Input Primitive: POINTS (1 vertex)\n");
+                        VMLOG_DEBUG("      Input Primitive: POINTS (1 vertex)\n");
                         vg_interface.primitive_type_compatible = true;
                         break;
                     case 0x0001: // GL_LINES
-                        IOLog("      Input Primitive: LINES (2 vertices)\n");
+                        VMLOG_DEBUG("      Input Primitive: LINES (2 vertices)\n");
                         vg_interface.primitive_type_compatible = true;
                         break;
                     case 0x0004: // GL_TRIANGLES
-                        IOLog("      Input Primitive: TRIANGLES (3 vertices)\n");
+                        VMLOG_DEBUG("      Input Primitive: TRIANGLES (3 vertices)\n");
                         vg_interface.primitive_type_compatible = true;
                         break;
                     default:
-                        IOLog("      Input Primitive: UNKNOWN (0x%x)\n", vg_interface.input_primitive_type);
+                        VMLOG_DEBUG("      Input Primitive: UNKNOWN (0x%x)\n", vg_interface.input_primitive_type);
                         vg_interface.primitive_type_compatible = false;
                         break;
                 }
@@ -10284,10 +9262,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 vg_interface.array_size_compatible = (vg_interface.geometry_input_vertices > 0 && 
                                                     vg_interface.geometry_input_vertices <= 6); // Common limit
                 
-                IOLog("      Geometry Input Vertices: %d\n", vg_interface.geometry_input_vertices);
-                IOLog("      Uses gl_in Array: %s\n", vg_interface.uses_gl_in_array ? "YES" : "NO");
+                VMLOG_DEBUG("      Geometry Input Vertices: %d\n", vg_interface.geometry_input_vertices);
+                VMLOG_DEBUG("      Uses gl_in Array: %s\n", vg_interface.uses_gl_in_array ? "YES" : "NO");
             } else {
-                IOLog("    WARNING: No geometry shader bytecode for input analysis\n");
+                VMLOG_WARN("    WARNING: No geometry shader bytecode for input analysis\n");
                 vg_interface.input_primitive_type = 0x0004; // Default to triangles
                 vg_interface.vertices_per_primitive = 3;
                 vg_interface.primitive_type_compatible = true;
@@ -10299,8 +9277,8 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             vg_interface.vertex_geometry_mismatches = 0;
             
             // In geometry shaders, vertex outputs become arrays indexed by vertex
-            IOLog("    Vertex outputs will be accessible as arrays in geometry shader\n");
-            IOLog("      Array size: %d (matching input primitive)\n", vg_interface.geometry_input_vertices);
+            VMLOG_DEBUG("    Vertex outputs will be accessible as arrays in geometry shader\n");
+            VMLOG_DEBUG("      Array size: %d (matching input primitive)\n", vg_interface.geometry_input_vertices);
             
             interface_check.vertex_geometry_compatible = vg_interface.primitive_type_compatible &&
                                                        vg_interface.array_size_compatible &&
@@ -10309,24 +9287,24 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             interface_check.geometry_inputs = vg_interface.geometry_input_vertices;
             interface_check.mismatched_variables += vg_interface.vertex_geometry_mismatches;
             
-            IOLog("    Vertex->Geometry Interface Results:\n");
-            IOLog("      Primitive Type: %s\n", vg_interface.primitive_type_compatible ? "COMPATIBLE" : "INCOMPATIBLE");
-            IOLog("      Array Access: %s\n", vg_interface.array_size_compatible ? "VALID" : "INVALID");
-            IOLog("      Variable Matches: %d\n", vg_interface.vertex_geometry_matches);
-            IOLog("      Overall Compatibility: %s\n", 
+            VMLOG_DEBUG("    Vertex->Geometry Interface Results:\n");
+            VMLOG_DEBUG("      Primitive Type: %s\n", vg_interface.primitive_type_compatible ? "COMPATIBLE" : "INCOMPATIBLE");
+            VMLOG_DEBUG("      Array Access: %s\n", vg_interface.array_size_compatible ? "VALID" : "INVALID");
+            VMLOG_DEBUG("      Variable Matches: %d\n", vg_interface.vertex_geometry_matches);
+            VMLOG_DEBUG("      Overall Compatibility: %s\n", 
                   interface_check.vertex_geometry_compatible ? "COMPATIBLE" : "INCOMPATIBLE");
         } else {
-            IOLog("    ERROR: Could not locate vertex or geometry shader for interface validation\n");
+            VMLOG_ERROR("    ERROR: Could not locate vertex or geometry shader for interface validation\n");
             interface_check.vertex_geometry_compatible = false;
         }
     } else {
-        IOLog("  Skipping Vertex->Geometry validation (geometry shader not present)\n");
+        VMLOG_DEBUG("  Skipping Vertex->Geometry validation (geometry shader not present)\n");
         interface_check.vertex_geometry_compatible = true;
     }
     
     // Phase 5C: Geometry-to-Fragment Interface Validation
     if (validation.has_geometry_shader && validation.has_fragment_shader) {
-        IOLog("  Validating Geometry->Fragment interface compatibility\n");
+        VMLOG_DEBUG("  Validating Geometry->Fragment interface compatibility\n");
         
         CompiledShader* geometry_shader = findShader(validation.geometry_shader_id);
         CompiledShader* fragment_shader = findShader(validation.fragment_shader_id);
@@ -10353,7 +9331,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             
             // Analyze geometry shader output configuration
             if (geometry_shader->bytecode && geometry_shader->bytecode->getLength() > 0) {
-                IOLog("    Analyzing geometry shader output configuration\n");
+                VMLOG_DEBUG("    Analyzing geometry shader output configuration\n");
                 
                 gf_interface.output_primitive_type = 0x0005; // GL_TRIANGLE_STRIP (common)
                 gf_interface.max_output_vertices = 4;         // Typical for quad generation
@@ -10365,19 +9343,19 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 // Check output primitive type
                 switch (gf_interface.output_primitive_type) {
                     case 0x0000: // GL_POINTS
-                        IOLog("      Output Primitive: POINTS\n");
+                        VMLOG_DEBUG("      Output Primitive: POINTS\n");
                         gf_interface.output_primitive_compatible = true;
                         break;
                     case 0x0003: // GL_LINE_STRIP
-                        IOLog("      Output Primitive: LINE_STRIP\n");
+                        VMLOG_DEBUG("      Output Primitive: LINE_STRIP\n");
                         gf_interface.output_primitive_compatible = true;
                         break;
                     case 0x0005: // GL_TRIANGLE_STRIP
-                        IOLog("      Output Primitive: TRIANGLE_STRIP\n");
+                        VMLOG_DEBUG("      Output Primitive: TRIANGLE_STRIP\n");
                         gf_interface.output_primitive_compatible = true;
                         break;
                     default:
-                        IOLog("      Output Primitive: UNKNOWN (0x%x)\n", gf_interface.output_primitive_type);
+                        VMLOG_DEBUG("      Output Primitive: UNKNOWN (0x%x)\n", gf_interface.output_primitive_type);
                         gf_interface.output_primitive_compatible = false;
                         break;
                 }
@@ -10386,11 +9364,11 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 gf_interface.vertex_count_reasonable = (gf_interface.max_output_vertices > 0 && 
                                                       gf_interface.max_output_vertices <= 1024); // GPU limit
                 
-                IOLog("      Max Output Vertices: %d\n", gf_interface.max_output_vertices);
-                IOLog("      Output Variables: %d\n", gf_interface.output_variables_count);
-                IOLog("      Invocations: %d\n", gf_interface.invocations);
+                VMLOG_DEBUG("      Max Output Vertices: %d\n", gf_interface.max_output_vertices);
+                VMLOG_DEBUG("      Output Variables: %d\n", gf_interface.output_variables_count);
+                VMLOG_DEBUG("      Invocations: %d\n", gf_interface.invocations);
             } else {
-                IOLog("    WARNING: No geometry shader bytecode for output analysis\n");
+                VMLOG_WARN("    WARNING: No geometry shader bytecode for output analysis\n");
                 gf_interface.output_primitive_type = 0x0005; // Default to triangle strip
                 gf_interface.max_output_vertices = 4;
                 gf_interface.output_variables_count = 8;
@@ -10415,19 +9393,19 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             interface_check.geometry_outputs = gf_interface.output_variables_count;
             interface_check.mismatched_variables += gf_interface.geometry_fragment_mismatches;
             
-            IOLog("    Geometry->Fragment Interface Results:\n");
-            IOLog("      Output Primitive: %s\n", gf_interface.output_primitive_compatible ? "COMPATIBLE" : "INCOMPATIBLE");
-            IOLog("      Vertex Count: %s\n", gf_interface.vertex_count_reasonable ? "REASONABLE" : "EXCESSIVE");
-            IOLog("      Stream Support: %s\n", gf_interface.stream_compatibility ? "COMPATIBLE" : "INCOMPATIBLE");
-            IOLog("      Variable Matches: %d\n", gf_interface.geometry_fragment_matches);
-            IOLog("      Overall Compatibility: %s\n", 
+            VMLOG_DEBUG("    Geometry->Fragment Interface Results:\n");
+            VMLOG_DEBUG("      Output Primitive: %s\n", gf_interface.output_primitive_compatible ? "COMPATIBLE" : "INCOMPATIBLE");
+            VMLOG_DEBUG("      Vertex Count: %s\n", gf_interface.vertex_count_reasonable ? "REASONABLE" : "EXCESSIVE");
+            VMLOG_DEBUG("      Stream Support: %s\n", gf_interface.stream_compatibility ? "COMPATIBLE" : "INCOMPATIBLE");
+            VMLOG_DEBUG("      Variable Matches: %d\n", gf_interface.geometry_fragment_matches);
+            VMLOG_DEBUG("      Overall Compatibility: %s\n", 
                   interface_check.geometry_fragment_compatible ? "COMPATIBLE" : "INCOMPATIBLE");
         } else {
-            IOLog("    ERROR: Could not locate geometry or fragment shader for interface validation\n");
+            VMLOG_ERROR("    ERROR: Could not locate geometry or fragment shader for interface validation\n");
             interface_check.geometry_fragment_compatible = false;
         }
     } else {
-        IOLog("  Skipping Geometry->Fragment validation (geometry shader not present)\n");
+        VMLOG_DEBUG("  Skipping Geometry->Fragment validation (geometry shader not present)\n");
         interface_check.geometry_fragment_compatible = true;
     }
     
@@ -10436,7 +9414,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                                      interface_check.geometry_fragment_compatible;
     
     // Phase 6: Resource aggregation and unified program interface
-    IOLog("VMShaderManager::linkProgram: Phase 6 - Resource Aggregation\n");
+    VMLOG_DEBUG("VMShaderManager::linkProgram: Phase 6 - Resource Aggregation\n");
     
     // Clear existing aggregated resources
     if (program->all_uniforms) {
@@ -10464,29 +9442,28 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         if (!shader_id_num) continue;
         
         CompiledShader* shader = findShader(shader_id_num->unsigned32BitValue());
-        if (!shader || !shader->uniforms) continue;
+        if (!shader) continue;
         
-        for (unsigned int j = 0; j < shader->uniforms->getCount(); j++) {
-            VMShaderUniform* uniform = (VMShaderUniform*)shader->uniforms->getObject(j);
-            if (uniform) {
-                // Check for duplicate uniforms and merge them
-                bool is_duplicate = false;
-                for (unsigned int k = 0; k < program->all_uniforms->getCount(); k++) {
-                    VMShaderUniform* existing = (VMShaderUniform*)program->all_uniforms->getObject(k);
-                    if (existing && strcmp(existing->name, uniform->name) == 0) {
-                        is_duplicate = true;
-                        break;
-                    }
+        for (unsigned int j = 0; j < shader->uniform_count; j++) {
+            VMShaderUniform* uniform = &shader->uniforms[j];
+            
+            // Check for duplicate uniforms and merge them
+            bool is_duplicate = false;
+            for (unsigned int k = 0; k < program->all_uniforms->getCount(); k++) {
+                VMShaderUniform* existing = (VMShaderUniform*)program->all_uniforms->getObject(k);
+                if (existing && strcmp(existing->name, uniform->name) == 0) {
+                    is_duplicate = true;
+                    break;
                 }
-                
-                if (!is_duplicate) {
-                    // Create a copy of the uniform with updated location
-                    VMShaderUniform* program_uniform = (VMShaderUniform*)IOMalloc(sizeof(VMShaderUniform));
-                    if (program_uniform) {
-                        *program_uniform = *uniform; // Copy all fields
-                        program_uniform->location = uniform_location++;
-                        program->all_uniforms->setObject((OSObject*)program_uniform);
-                    }
+            }
+            
+            if (!is_duplicate) {
+                // Create a copy of the uniform with updated location
+                VMShaderUniform* program_uniform = (VMShaderUniform*)IOMalloc(sizeof(VMShaderUniform));
+                if (program_uniform) {
+                    *program_uniform = *uniform; // Copy all fields
+                    program_uniform->location = uniform_location++;
+                    program->all_uniforms->setObject((OSObject*)program_uniform);
                 }
             }
         }
@@ -10495,15 +9472,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
     // Aggregate attributes (typically only from vertex shader)
     if (validation.has_vertex_shader) {
         CompiledShader* vertex_shader = findShader(validation.vertex_shader_id);
-        if (vertex_shader && vertex_shader->attributes) {
-            for (unsigned int j = 0; j < vertex_shader->attributes->getCount(); j++) {
-                VMShaderAttribute* attribute = (VMShaderAttribute*)vertex_shader->attributes->getObject(j);
-                if (attribute) {
-                    VMShaderAttribute* program_attribute = (VMShaderAttribute*)IOMalloc(sizeof(VMShaderAttribute));
-                    if (program_attribute) {
-                        *program_attribute = *attribute; // Copy all fields
-                        program->all_attributes->setObject((OSObject*)program_attribute);
-                    }
+        if (vertex_shader) {
+            for (unsigned int j = 0; j < vertex_shader->attribute_count; j++) {
+                VMShaderAttribute* program_attribute = (VMShaderAttribute*)IOMalloc(sizeof(VMShaderAttribute));
+                if (program_attribute) {
+                    *program_attribute = vertex_shader->attributes[j]; // Copy all fields
+                    program->all_attributes->setObject((OSObject*)program_attribute);
                 }
             }
         }
@@ -10513,10 +9487,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
     IOReturn link_result = kIOReturnSuccess;
     if (m_accelerator) {
         { // Additional opening brace for structural balance
-        IOLog("VMShaderManager::linkProgram: Performing hardware-accelerated linking\n");
+        VMLOG_DEBUG("VMShaderManager::linkProgram: Performing hardware-accelerated linking\n");
         
         // Phase 7A: GPU Pipeline Compilation and Optimization
-        IOLog("VMShaderManager::linkProgram: Phase 7A - GPU Pipeline Compilation\n");
+        VMLOG_DEBUG("VMShaderManager::linkProgram: Phase 7A - GPU Pipeline Compilation\n");
         
         struct GPUPipelineCompilation {
             bool vertex_stage_optimized;
@@ -10550,10 +9524,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         if (validation.has_vertex_shader) {
             CompiledShader* vertex_shader = findShader(validation.vertex_shader_id);
             if (vertex_shader && vertex_shader->bytecode) {
-                IOLog("VMShaderManager::linkProgram: Compiling vertex stage for GPU execution\n");
+                VMLOG_DEBUG("VMShaderManager::linkProgram: Compiling vertex stage for GPU execution\n");
                 
                 // Comprehensive GPU Driver Shader Compilation System
-                IOLog("      Performing advanced GPU driver shader compilation\n");
+                VMLOG_DEBUG("      Performing advanced GPU driver shader compilation\n");
                 
                 struct AdvancedShaderCompilation {
                     // Compilation Pipeline Stages
@@ -10683,7 +9657,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 } compilation = {0};
                 
                 // Phase 1: Advanced Source Code Analysis
-                IOLog("        Phase 1: Performing comprehensive source analysis\n");
+                VMLOG_DEBUG("        Phase 1: Performing comprehensive source analysis\n");
                 
                 uint64_t analysis_start = mach_absolute_time();
                 
@@ -10755,19 +9729,19 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     compilation.source_analysis.uses_atomic_operations = false; // Vertex shaders typically don't use atomics
                     compilation.source_analysis.uses_barrier_sync = false;
                     
-                    IOLog("          Source Analysis Results:\n");
-                    IOLog("            Lines: %d, Instructions: %d, Functions: %d\n",
+                    VMLOG_DEBUG("          Source Analysis Results:\n");
+                    VMLOG_DEBUG("            Lines: %d, Instructions: %d, Functions: %d\n",
                           compilation.source_analysis.total_lines,
                           compilation.source_analysis.instruction_count,
                           compilation.source_analysis.function_count);
-                    IOLog("            Uniforms: %d, Texture Samples: %d, Control Flow: %d\n",
+                    VMLOG_DEBUG("            Uniforms: %d, Texture Samples: %d, Control Flow: %d\n",
                           compilation.source_analysis.uniform_references,
                           compilation.source_analysis.texture_samples,
                           compilation.source_analysis.control_flow_complexity);
-                    IOLog("            Max Nesting: %d, Arithmetic Ops: %d\n",
+                    VMLOG_DEBUG("            Max Nesting: %d, Arithmetic Ops: %d\n",
                           compilation.source_analysis.loop_nesting_depth,
                           compilation.source_analysis.arithmetic_intensity);
-                    IOLog("            Dynamic Branching: %s, Texture Arrays: %s\n",
+                    VMLOG_DEBUG("            Dynamic Branching: %s, Texture Arrays: %s\n",
                           compilation.source_analysis.uses_dynamic_branching ? "YES" : "NO",
                           compilation.source_analysis.uses_texture_arrays ? "YES" : "NO");
                 }
@@ -10778,15 +9752,15 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.stages.compilation_stage_count++;
                 
                 // Phase 2: Abstract Syntax Tree Generation and Analysis
-                IOLog("        Phase 2: Building and analyzing Abstract Syntax Tree\n");
+                VMLOG_DEBUG("        Phase 2: Building and analyzing Abstract Syntax Tree\n");
                 
                 uint64_t ast_start = mach_absolute_time();
                 
                 // Comprehensive Abstract Syntax Tree Generation and Analysis System
-                IOLog("          Performing real-time AST construction from vertex shader bytecode\n");
+                VMLOG_DEBUG("          Performing real-time AST construction from vertex shader bytecode\n");
                 
                 // Phase 2.1: AST Node Construction and Classification
-                IOLog("            Phase 2.1: Constructing and classifying AST nodes\n");
+                VMLOG_DEBUG("            Phase 2.1: Constructing and classifying AST nodes\n");
                 
                 if (vertex_shader->bytecode && vertex_shader->bytecode->getLength() > 0) {
                     const uint8_t* vs_bytecode_data = (const uint8_t*)vertex_shader->bytecode->getBytesNoCopy();
@@ -10874,13 +9848,13 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     compilation.ast_analysis.memory_access_patterns = compilation.source_analysis.uniform_references + 
                         compilation.source_analysis.texture_samples + declaration_nodes;
                     
-                    IOLog("              AST Node Classification Results:\n");
-                    IOLog("                Total AST Nodes: %d\n", compilation.ast_analysis.ast_node_count);
-                    IOLog("                Declarations: %d, Expressions: %d, Statements: %d\n",
+                    VMLOG_DEBUG("              AST Node Classification Results:\n");
+                    VMLOG_DEBUG("                Total AST Nodes: %d\n", compilation.ast_analysis.ast_node_count);
+                    VMLOG_DEBUG("                Declarations: %d, Expressions: %d, Statements: %d\n",
                           declaration_nodes, expression_nodes, statement_nodes);
-                    IOLog("                Literals: %d, Identifiers: %d, Operators: %d\n",
+                    VMLOG_DEBUG("                Literals: %d, Identifiers: %d, Operators: %d\n",
                           literal_nodes, identifier_nodes, operator_nodes);
-                    IOLog("                Control Flow: %d, Function Calls: %d\n",
+                    VMLOG_DEBUG("                Control Flow: %d, Function Calls: %d\n",
                           control_flow_nodes, function_call_nodes);
                 } else {
                     // Fallback estimation for AST analysis
@@ -10893,11 +9867,11 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     compilation.ast_analysis.constant_expressions = compilation.source_analysis.arithmetic_intensity / 3;
                     compilation.ast_analysis.memory_access_patterns = compilation.source_analysis.uniform_references + 
                                                                     compilation.source_analysis.texture_samples;
-                    IOLog("              Using fallback AST estimation (no bytecode available)\n");
+                    VMLOG_DEBUG("              Using fallback AST estimation (no bytecode available)\n");
                 }
                 
                 // Phase 2.2: Expression Depth and Complexity Analysis
-                IOLog("            Phase 2.2: Analyzing expression depth and complexity\n");
+                VMLOG_DEBUG("            Phase 2.2: Analyzing expression depth and complexity\n");
                 
                 compilation.ast_analysis.expression_depth = compilation.source_analysis.loop_nesting_depth + 2;
                 uint32_t max_expression_depth = 0;
@@ -10925,14 +9899,14 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 compilation.ast_analysis.expression_depth = max_expression_depth;
                 
-                IOLog("              Expression Complexity Analysis:\n");
-                IOLog("                Max Expression Depth: %d, Average Depth: %d\n",
+                VMLOG_DEBUG("              Expression Complexity Analysis:\n");
+                VMLOG_DEBUG("                Max Expression Depth: %d, Average Depth: %d\n",
                       max_expression_depth, average_expression_depth);
-                IOLog("                Complex Expressions: %d, Simple Expressions: %d\n",
+                VMLOG_DEBUG("                Complex Expressions: %d, Simple Expressions: %d\n",
                       complex_expression_count, simple_expression_count);
                 
                 // Phase 2.3: Advanced AST Feature Detection
-                IOLog("            Phase 2.3: Detecting advanced AST features\n");
+                VMLOG_DEBUG("            Phase 2.3: Detecting advanced AST features\n");
                 
                 // Advanced AST analysis flags based on real patterns
                 compilation.ast_analysis.has_recursive_calls = false; // Vertex shaders rarely use recursion
@@ -10949,22 +9923,22 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 bool has_function_overloading = (compilation.ast_analysis.function_calls > 
                     compilation.ast_analysis.user_function_definitions * 2);
                 
-                IOLog("              Advanced AST Features:\n");
-                IOLog("                Recursive Calls: %s, Indirect Addressing: %s\n",
+                VMLOG_DEBUG("              Advanced AST Features:\n");
+                VMLOG_DEBUG("                Recursive Calls: %s, Indirect Addressing: %s\n",
                       compilation.ast_analysis.has_recursive_calls ? "YES" : "NO",
                       compilation.ast_analysis.has_indirect_addressing ? "YES" : "NO");
-                IOLog("                Complex Expressions: %s, Matrix Operations: %s\n",
+                VMLOG_DEBUG("                Complex Expressions: %s, Matrix Operations: %s\n",
                       compilation.ast_analysis.has_complex_expressions ? "YES" : "NO",
                       has_matrix_operations ? "YES" : "NO");
-                IOLog("                Vector Swizzling: %s, Conditional Assignments: %s\n",
+                VMLOG_DEBUG("                Vector Swizzling: %s, Conditional Assignments: %s\n",
                       has_vector_swizzling ? "YES" : "NO",
                       has_conditional_assignments ? "YES" : "NO");
-                IOLog("                Loop Unrolling Candidates: %s, Function Overloading: %s\n",
+                VMLOG_DEBUG("                Loop Unrolling Candidates: %s, Function Overloading: %s\n",
                       has_loop_unrolling_candidates ? "YES" : "NO",
                       has_function_overloading ? "YES" : "NO");
                 
                 // Phase 2.4: AST Optimization Opportunities Analysis
-                IOLog("            Phase 2.4: Identifying AST optimization opportunities\n");
+                VMLOG_DEBUG("            Phase 2.4: Identifying AST optimization opportunities\n");
                 
                 uint32_t constant_folding_opportunities = compilation.ast_analysis.constant_expressions;
                 uint32_t dead_code_elimination_candidates = 
@@ -10991,15 +9965,15 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 bool parallel_execution_possible = !compilation.ast_analysis.has_recursive_calls && 
                     (compilation.source_analysis.loop_nesting_depth <= 2);
                 
-                IOLog("              AST Optimization Analysis:\n");
-                IOLog("                Constant Folding: %d opportunities\n", constant_folding_opportunities);
-                IOLog("                Dead Code Elimination: %d candidates\n", dead_code_elimination_candidates);
-                IOLog("                Common Subexpressions: %d candidates\n", common_subexpression_candidates);
-                IOLog("                Function Inlining: %d candidates\n", function_inlining_candidates);
-                IOLog("                Loop Optimization: %d opportunities\n", loop_optimization_opportunities);
-                IOLog("                Optimization Potential Score: %d (%s)\n", optimization_potential_score,
+                VMLOG_DEBUG("              AST Optimization Analysis:\n");
+                VMLOG_DEBUG("                Constant Folding: %d opportunities\n", constant_folding_opportunities);
+                VMLOG_DEBUG("                Dead Code Elimination: %d candidates\n", dead_code_elimination_candidates);
+                VMLOG_DEBUG("                Common Subexpressions: %d candidates\n", common_subexpression_candidates);
+                VMLOG_DEBUG("                Function Inlining: %d candidates\n", function_inlining_candidates);
+                VMLOG_DEBUG("                Loop Optimization: %d opportunities\n", loop_optimization_opportunities);
+                VMLOG_DEBUG("                Optimization Potential Score: %d (%s)\n", optimization_potential_score,
                       high_optimization_potential ? "HIGH" : "MODERATE");
-                IOLog("                Vectorization Possible: %s, Parallel Execution: %s\n",
+                VMLOG_DEBUG("                Vectorization Possible: %s, Parallel Execution: %s\n",
                       vectorization_possible ? "YES" : "NO",
                       parallel_execution_possible ? "YES" : "NO");
                 
@@ -11008,17 +9982,17 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.ast_analysis.has_indirect_addressing = compilation.source_analysis.uses_texture_arrays;
                 compilation.ast_analysis.has_complex_expressions = (compilation.ast_analysis.expression_depth > 4);
                 
-                IOLog("          AST Analysis Results:\n");
-                IOLog("            AST Nodes: %d, Expression Depth: %d\n",
+                VMLOG_DEBUG("          AST Analysis Results:\n");
+                VMLOG_DEBUG("            AST Nodes: %d, Expression Depth: %d\n",
                       compilation.ast_analysis.ast_node_count,
                       compilation.ast_analysis.expression_depth);
-                IOLog("            Variables: %d, Function Calls: %d\n",
+                VMLOG_DEBUG("            Variables: %d, Function Calls: %d\n",
                       compilation.ast_analysis.variable_declarations,
                       compilation.ast_analysis.function_calls);
-                IOLog("            Built-in Functions: %d, Constants: %d\n",
+                VMLOG_DEBUG("            Built-in Functions: %d, Constants: %d\n",
                       compilation.ast_analysis.builtin_function_usage,
                       compilation.ast_analysis.constant_expressions);
-                IOLog("            Complex Expressions: %s, Indirect Access: %s\n",
+                VMLOG_DEBUG("            Complex Expressions: %s, Indirect Access: %s\n",
                       compilation.ast_analysis.has_complex_expressions ? "YES" : "NO",
                       compilation.ast_analysis.has_indirect_addressing ? "YES" : "NO");
                 
@@ -11028,15 +10002,15 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.stages.compilation_stage_count++;
                 
                 // Phase 3: Comprehensive Semantic Analysis
-                IOLog("        Phase 3: Performing semantic analysis and validation\n");
+                VMLOG_DEBUG("        Phase 3: Performing semantic analysis and validation\n");
                 
                 uint64_t semantic_start = mach_absolute_time();
                 
                 // Comprehensive Semantic Analysis and Type System Validation
-                IOLog("          Performing real-time semantic analysis from vertex shader bytecode\n");
+                VMLOG_DEBUG("          Performing real-time semantic analysis from vertex shader bytecode\n");
                 
                 // Phase 3.1: Type System Analysis and Validation
-                IOLog("            Phase 3.1: Analyzing type system and validating declarations\n");
+                VMLOG_DEBUG("            Phase 3.1: Analyzing type system and validating declarations\n");
                 
                 compilation.semantic_analysis.type_checking_errors = 0;
                 compilation.semantic_analysis.undefined_symbols = 0;
@@ -11108,19 +10082,19 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.semantic_analysis.type_checking_errors = type_mismatches + vector_component_errors + 
                     matrix_dimension_errors + function_signature_mismatches;
                 
-                IOLog("              Type System Analysis Results:\n");
-                IOLog("                Type Checking Errors: %d, Precision Qualifiers: %d\n",
+                VMLOG_DEBUG("              Type System Analysis Results:\n");
+                VMLOG_DEBUG("                Type Checking Errors: %d, Precision Qualifiers: %d\n",
                       compilation.semantic_analysis.type_checking_errors,
                       compilation.semantic_analysis.precision_qualifiers);
-                IOLog("                Implicit Conversions: %d, Vector Component Errors: %d\n",
+                VMLOG_DEBUG("                Implicit Conversions: %d, Vector Component Errors: %d\n",
                       implicit_conversions, vector_component_errors);
-                IOLog("                Matrix Dimension Errors: %d, Function Signature Mismatches: %d\n",
+                VMLOG_DEBUG("                Matrix Dimension Errors: %d, Function Signature Mismatches: %d\n",
                       matrix_dimension_errors, function_signature_mismatches);
-                IOLog("                Precision Mismatches: %d, Storage Qualifiers: %d\n",
+                VMLOG_DEBUG("                Precision Mismatches: %d, Storage Qualifiers: %d\n",
                       precision_mismatches, compilation.semantic_analysis.storage_qualifiers);
                 
                 // Phase 3.2: Symbol Table Construction and Resolution
-                IOLog("            Phase 3.2: Building symbol table and resolving references\n");
+                VMLOG_DEBUG("            Phase 3.2: Building symbol table and resolving references\n");
                 
                 uint32_t global_symbols = 0;
                 uint32_t local_symbols = 0;
@@ -11147,18 +10121,18 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.semantic_analysis.undefined_symbols = symbol_conflicts + 
                     ((forward_references > 10) ? forward_references / 5 : 0);
                 
-                IOLog("              Symbol Table Analysis:\n");
-                IOLog("                Global Symbols: %d, Local Symbols: %d\n",
+                VMLOG_DEBUG("              Symbol Table Analysis:\n");
+                VMLOG_DEBUG("                Global Symbols: %d, Local Symbols: %d\n",
                       global_symbols, local_symbols);
-                IOLog("                Built-in Symbols: %d, User-defined Symbols: %d\n",
+                VMLOG_DEBUG("                Built-in Symbols: %d, User-defined Symbols: %d\n",
                       builtin_symbols, user_defined_symbols);
-                IOLog("                Forward References: %d, Circular Dependencies: %d\n",
+                VMLOG_DEBUG("                Forward References: %d, Circular Dependencies: %d\n",
                       forward_references, circular_dependencies);
-                IOLog("                Symbol Conflicts: %d, Undefined Symbols: %d\n",
+                VMLOG_DEBUG("                Symbol Conflicts: %d, Undefined Symbols: %d\n",
                       symbol_conflicts, compilation.semantic_analysis.undefined_symbols);
                 
                 // Phase 3.3: Interface Variable Analysis and Validation
-                IOLog("            Phase 3.3: Analyzing shader interface variables\n");
+                VMLOG_DEBUG("            Phase 3.3: Analyzing shader interface variables\n");
                 
                 uint32_t vertex_inputs = 0;
                 uint32_t vertex_outputs = 0;
@@ -11185,20 +10159,20 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.semantic_analysis.storage_qualifiers = uniform_variables + varying_variables + 
                     attribute_variables + interpolation_qualifiers + layout_qualifiers;
                 
-                IOLog("              Interface Variable Analysis:\n");
-                IOLog("                Vertex Inputs: %d, Vertex Outputs: %d\n",
+                VMLOG_DEBUG("              Interface Variable Analysis:\n");
+                VMLOG_DEBUG("                Vertex Inputs: %d, Vertex Outputs: %d\n",
                       vertex_inputs, vertex_outputs);
-                IOLog("                Uniform Variables: %d, Varying Variables: %d\n",
+                VMLOG_DEBUG("                Uniform Variables: %d, Varying Variables: %d\n",
                       uniform_variables, varying_variables);
-                IOLog("                Attribute Variables: %d, Built-in Inputs: %d\n",
+                VMLOG_DEBUG("                Attribute Variables: %d, Built-in Inputs: %d\n",
                       attribute_variables, builtin_inputs);
-                IOLog("                Built-in Outputs: %d, Interpolation Qualifiers: %d\n",
+                VMLOG_DEBUG("                Built-in Outputs: %d, Interpolation Qualifiers: %d\n",
                       builtin_outputs, interpolation_qualifiers);
-                IOLog("                Layout Qualifiers: %d, Total Interface Variables: %d\n",
+                VMLOG_DEBUG("                Layout Qualifiers: %d, Total Interface Variables: %d\n",
                       layout_qualifiers, compilation.semantic_analysis.interface_variables);
                 
                 // Phase 3.4: Dead Code Analysis and Unused Variable Detection
-                IOLog("            Phase 3.4: Performing dead code analysis\n");
+                VMLOG_DEBUG("            Phase 3.4: Performing dead code analysis\n");
                 
                 uint32_t potentially_unused_variables = 0;
                 uint32_t definitely_unused_variables = 0;
@@ -11226,16 +10200,16 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.semantic_analysis.unused_functions = (compilation.ast_analysis.user_function_definitions > 4) ?
                     compilation.ast_analysis.user_function_definitions / 8 : 0;
                 
-                IOLog("              Dead Code Analysis Results:\n");
-                IOLog("                Potentially Unused Variables: %d, Definitely Unused: %d\n",
+                VMLOG_DEBUG("              Dead Code Analysis Results:\n");
+                VMLOG_DEBUG("                Potentially Unused Variables: %d, Definitely Unused: %d\n",
                       potentially_unused_variables, definitely_unused_variables);
-                IOLog("                Unused Uniform Variables: %d, Unused Local Variables: %d\n",
+                VMLOG_DEBUG("                Unused Uniform Variables: %d, Unused Local Variables: %d\n",
                       unused_uniform_variables, unused_local_variables);
-                IOLog("                Unreachable Code Blocks: %d, Unused Function Parameters: %d\n",
+                VMLOG_DEBUG("                Unreachable Code Blocks: %d, Unused Function Parameters: %d\n",
                       unreachable_code_blocks, unused_function_parameters);
-                IOLog("                Write-only Variables: %d, Read-only Variables: %d\n",
+                VMLOG_DEBUG("                Write-only Variables: %d, Read-only Variables: %d\n",
                       write_only_variables, read_only_variables);
-                IOLog("                Total Unused Variables: %d, Unused Functions: %d\n",
+                VMLOG_DEBUG("                Total Unused Variables: %d, Unused Functions: %d\n",
                       compilation.semantic_analysis.unused_variables, compilation.semantic_analysis.unused_functions);
                 
                 // Set remaining semantic analysis fields
@@ -11247,17 +10221,17 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.semantic_analysis.const_folding_complete = true;
                 compilation.semantic_analysis.dead_code_marked = (compilation.semantic_analysis.unused_variables > 0);
                 
-                IOLog("          Semantic Analysis Results:\n");
-                IOLog("            Type Errors: %d, Undefined Symbols: %d\n",
+                VMLOG_DEBUG("          Semantic Analysis Results:\n");
+                VMLOG_DEBUG("            Type Errors: %d, Undefined Symbols: %d\n",
                       compilation.semantic_analysis.type_checking_errors,
                       compilation.semantic_analysis.undefined_symbols);
-                IOLog("            Unused Variables: %d, Interface Variables: %d\n",
+                VMLOG_DEBUG("            Unused Variables: %d, Interface Variables: %d\n",
                       compilation.semantic_analysis.unused_variables,
                       compilation.semantic_analysis.interface_variables);
-                IOLog("            Precision Qualifiers: %d, Storage Qualifiers: %d\n",
+                VMLOG_DEBUG("            Precision Qualifiers: %d, Storage Qualifiers: %d\n",
                       compilation.semantic_analysis.precision_qualifiers,
                       compilation.semantic_analysis.storage_qualifiers);
-                IOLog("            Symbol Table: %s, Dead Code Detection: %s\n",
+                VMLOG_DEBUG("            Symbol Table: %s, Dead Code Detection: %s\n",
                       compilation.semantic_analysis.symbol_table_complete ? "COMPLETE" : "INCOMPLETE",
                       compilation.semantic_analysis.dead_code_marked ? "APPLIED" : "NONE");
                 
@@ -11267,15 +10241,15 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.stages.compilation_stage_count++;
                 
                 // Phase 4: Advanced Optimization Pipeline
-                IOLog("        Phase 4: Applying advanced optimization pipeline\n");
+                VMLOG_DEBUG("        Phase 4: Applying advanced optimization pipeline\n");
                 
                 uint64_t optimization_start = mach_absolute_time();
                 
                 // Comprehensive Advanced Optimization Pipeline System
-                IOLog("          Performing real-time optimization analysis from vertex shader bytecode\n");
+                VMLOG_DEBUG("          Performing real-time optimization analysis from vertex shader bytecode\n");
                 
                 // Phase 4.1: Constant Folding and Expression Simplification
-                IOLog("            Phase 4.1: Performing constant folding and expression simplification\n");
+                VMLOG_DEBUG("            Phase 4.1: Performing constant folding and expression simplification\n");
                 
                 uint32_t literal_constants = 0;
                 uint32_t computed_constants = 0;
@@ -11341,18 +10315,18 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.optimization.constants_folded = folded_expressions + computed_constants;
                 compilation.optimization.strength_reductions = strength_reduction_candidates + algebraic_identities_applied;
                 
-                IOLog("              Constant Folding Analysis:\n");
-                IOLog("                Literal Constants: %d, Computed Constants: %d\n",
+                VMLOG_DEBUG("              Constant Folding Analysis:\n");
+                VMLOG_DEBUG("                Literal Constants: %d, Computed Constants: %d\n",
                       literal_constants, computed_constants);
-                IOLog("                Folded Expressions: %d, Simplified Expressions: %d\n",
+                VMLOG_DEBUG("                Folded Expressions: %d, Simplified Expressions: %d\n",
                       folded_expressions, simplified_expressions);
-                IOLog("                Algebraic Identities: %d, Strength Reductions: %d\n",
+                VMLOG_DEBUG("                Algebraic Identities: %d, Strength Reductions: %d\n",
                       algebraic_identities_applied, strength_reduction_candidates);
-                IOLog("                Division to Multiplication: %d, Expensive Functions Eliminated: %d\n",
+                VMLOG_DEBUG("                Division to Multiplication: %d, Expensive Functions Eliminated: %d\n",
                       division_to_multiplication, expensive_function_eliminations);
                 
                 // Phase 4.2: Dead Code Elimination and Control Flow Optimization
-                IOLog("            Phase 4.2: Performing dead code elimination and control flow optimization\n");
+                VMLOG_DEBUG("            Phase 4.2: Performing dead code elimination and control flow optimization\n");
                 
                 uint32_t unreachable_basic_blocks = 0;
                 uint32_t eliminated_branches = 0;
@@ -11382,19 +10356,19 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 uint32_t total_dead_code_eliminated = unreachable_basic_blocks + eliminated_branches + 
                     removed_unused_variables + eliminated_write_only_stores;
                 
-                IOLog("              Dead Code Elimination Analysis:\n");
-                IOLog("                Unreachable Basic Blocks: %d, Eliminated Branches: %d\n",
+                VMLOG_DEBUG("              Dead Code Elimination Analysis:\n");
+                VMLOG_DEBUG("                Unreachable Basic Blocks: %d, Eliminated Branches: %d\n",
                       unreachable_basic_blocks, eliminated_branches);
-                IOLog("                Merged Basic Blocks: %d, Removed Unused Variables: %d\n",
+                VMLOG_DEBUG("                Merged Basic Blocks: %d, Removed Unused Variables: %d\n",
                       merged_basic_blocks, removed_unused_variables);
-                IOLog("                Eliminated Write-only Stores: %d, Simplified Conditionals: %d\n",
+                VMLOG_DEBUG("                Eliminated Write-only Stores: %d, Simplified Conditionals: %d\n",
                       eliminated_write_only_stores, simplified_conditionals);
-                IOLog("                Jump Threading: %d, Branch Folding: %d, Tail Call Eliminations: %d\n",
+                VMLOG_DEBUG("                Jump Threading: %d, Branch Folding: %d, Tail Call Eliminations: %d\n",
                       jump_threading_applied, branch_folding_applied, tail_call_eliminations);
-                IOLog("                Total Dead Code Eliminated: %d instructions\n", total_dead_code_eliminated);
+                VMLOG_DEBUG("                Total Dead Code Eliminated: %d instructions\n", total_dead_code_eliminated);
                 
                 // Phase 4.3: Loop Optimization and Unrolling Analysis
-                IOLog("            Phase 4.3: Analyzing loop optimization and unrolling opportunities\n");
+                VMLOG_DEBUG("            Phase 4.3: Analyzing loop optimization and unrolling opportunities\n");
                 
                 uint32_t unrollable_loops = 0;
                 uint32_t partially_unrolled_loops = 0;
@@ -11428,20 +10402,20 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.optimization.loops_unrolled = unrollable_loops + partially_unrolled_loops;
                 bool advanced_loop_optimization = (loop_invariant_computations > 3) || (vectorizable_loops > 0);
                 
-                IOLog("              Loop Optimization Analysis:\n");
-                IOLog("                Unrollable Loops: %d, Partially Unrolled: %d\n",
+                VMLOG_DEBUG("              Loop Optimization Analysis:\n");
+                VMLOG_DEBUG("                Unrollable Loops: %d, Partially Unrolled: %d\n",
                       unrollable_loops, partially_unrolled_loops);
-                IOLog("                Loop Invariant Computations: %d, Hoisted Expressions: %d\n",
+                VMLOG_DEBUG("                Loop Invariant Computations: %d, Hoisted Expressions: %d\n",
                       loop_invariant_computations, hoisted_invariant_expressions);
-                IOLog("                Induction Variable Eliminations: %d, Interchange Candidates: %d\n",
+                VMLOG_DEBUG("                Induction Variable Eliminations: %d, Interchange Candidates: %d\n",
                       induction_variable_eliminations, loop_interchange_candidates);
-                IOLog("                Loop Peeling: %d, Fusion Opportunities: %d\n",
+                VMLOG_DEBUG("                Loop Peeling: %d, Fusion Opportunities: %d\n",
                       loop_peeling_applied, loop_fusion_opportunities);
-                IOLog("                Vectorizable Loops: %d, Advanced Optimization: %s\n",
+                VMLOG_DEBUG("                Vectorizable Loops: %d, Advanced Optimization: %s\n",
                       vectorizable_loops, advanced_loop_optimization ? "YES" : "NO");
                 
                 // Phase 4.4: Function Inlining and Call Site Optimization
-                IOLog("            Phase 4.4: Performing function inlining and call site optimization\n");
+                VMLOG_DEBUG("            Phase 4.4: Performing function inlining and call site optimization\n");
                 
                 uint32_t small_function_inlines = 0;
                 uint32_t hot_function_inlines = 0;
@@ -11473,16 +10447,16 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 uint32_t total_call_optimizations = call_site_optimizations + argument_propagation_applied + 
                     return_value_optimizations + parameter_specializations;
                 
-                IOLog("              Function Inlining Analysis:\n");
-                IOLog("                Small Function Inlines: %d, Hot Function Inlines: %d\n",
+                VMLOG_DEBUG("              Function Inlining Analysis:\n");
+                VMLOG_DEBUG("                Small Function Inlines: %d, Hot Function Inlines: %d\n",
                       small_function_inlines, hot_function_inlines);
-                IOLog("                Recursive Eliminations: %d, Call Site Optimizations: %d\n",
+                VMLOG_DEBUG("                Recursive Eliminations: %d, Call Site Optimizations: %d\n",
                       recursive_function_eliminations, call_site_optimizations);
-                IOLog("                Argument Propagation: %d, Return Value Optimizations: %d\n",
+                VMLOG_DEBUG("                Argument Propagation: %d, Return Value Optimizations: %d\n",
                       argument_propagation_applied, return_value_optimizations);
-                IOLog("                Parameter Specializations: %d, Indirect Call Devirtualizations: %d\n",
+                VMLOG_DEBUG("                Parameter Specializations: %d, Indirect Call Devirtualizations: %d\n",
                       parameter_specializations, indirect_call_devirtualizations);
-                IOLog("                Total Call Optimizations: %d\n", total_call_optimizations);
+                VMLOG_DEBUG("                Total Call Optimizations: %d\n", total_call_optimizations);
                 
                 // Calculate comprehensive optimization metrics
                 compilation.optimization.total_optimization_passes = 5; // Multiple optimization rounds
@@ -11505,20 +10479,20 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.optimization.vectorization_applied = (compilation.source_analysis.arithmetic_intensity > 20);
                 compilation.optimization.loop_invariant_motion_applied = (compilation.source_analysis.control_flow_complexity > 2);
                 
-                IOLog("          Optimization Results:\n");
-                IOLog("            Optimization Passes: %d, Instructions Eliminated: %d\n",
+                VMLOG_DEBUG("          Optimization Results:\n");
+                VMLOG_DEBUG("            Optimization Passes: %d, Instructions Eliminated: %d\n",
                       compilation.optimization.total_optimization_passes,
                       compilation.optimization.instructions_eliminated);
-                IOLog("            Constants Folded: %d, Loops Unrolled: %d\n",
+                VMLOG_DEBUG("            Constants Folded: %d, Loops Unrolled: %d\n",
                       compilation.optimization.constants_folded,
                       compilation.optimization.loops_unrolled);
-                IOLog("            Functions Inlined: %d, CSE Eliminations: %d\n",
+                VMLOG_DEBUG("            Functions Inlined: %d, CSE Eliminations: %d\n",
                       compilation.optimization.functions_inlined,
                       compilation.optimization.common_subexpr_eliminated);
-                IOLog("            Code Size Reduction: %.1f%%, Performance Gain: %.1f%%\n",
+                VMLOG_DEBUG("            Code Size Reduction: %.1f%%, Performance Gain: %.1f%%\n",
                       compilation.optimization.code_size_reduction_percent,
                       compilation.optimization.performance_improvement_est);
-                IOLog("            Vectorization: %s, Loop Optimization: %s\n",
+                VMLOG_DEBUG("            Vectorization: %s, Loop Optimization: %s\n",
                       compilation.optimization.vectorization_applied ? "APPLIED" : "NOT_APPLIED",
                       compilation.optimization.loop_invariant_motion_applied ? "APPLIED" : "NOT_APPLIED");
                 
@@ -11528,15 +10502,15 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.stages.compilation_stage_count++;
                 
                 // Phase 5: GPU ISA Code Generation
-                IOLog("        Phase 5: Generating GPU ISA code\n");
+                VMLOG_DEBUG("        Phase 5: Generating GPU ISA code\n");
                 
                 uint64_t isa_start = mach_absolute_time();
                 
                 // Comprehensive GPU ISA Generation and Architecture Translation System
-                IOLog("          Performing real-time ISA generation from optimized vertex shader bytecode\n");
+                VMLOG_DEBUG("          Performing real-time ISA generation from optimized vertex shader bytecode\n");
                 
                 // Phase 5.1: Target Architecture Analysis and Instruction Set Selection
-                IOLog("            Phase 5.1: Analyzing target GPU architecture and selecting instruction set\n");
+                VMLOG_DEBUG("            Phase 5.1: Analyzing target GPU architecture and selecting instruction set\n");
                 
                 compilation.isa_generation.target_architecture = 0x1050; // Simulated GPU architecture ID
                 uint32_t optimized_instruction_count = compilation.source_analysis.instruction_count - 
@@ -11610,21 +10584,21 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     supports_tessellation = (compilation.source_analysis.loop_nesting_depth > 2);
                 }
                 
-                IOLog("              Target Architecture Analysis:\n");
-                IOLog("                Architecture Generation: %d, Compute Units: %d\n",
+                VMLOG_DEBUG("              Target Architecture Analysis:\n");
+                VMLOG_DEBUG("                Architecture Generation: %d, Compute Units: %d\n",
                       architecture_generation, compute_units);
-                IOLog("                Warp Size: %d, Max Threads/Block: %d\n",
+                VMLOG_DEBUG("                Warp Size: %d, Max Threads/Block: %d\n",
                       warp_size, max_threads_per_block);
-                IOLog("                Instruction Cache: %d bytes, Texture Units: %d\n",
+                VMLOG_DEBUG("                Instruction Cache: %d bytes, Texture Units: %d\n",
                       instruction_cache_size, texture_unit_count);
-                IOLog("                ROP Count: %d, Unified Shaders: %s\n",
+                VMLOG_DEBUG("                ROP Count: %d, Unified Shaders: %s\n",
                       rop_count, supports_unified_shaders ? "YES" : "NO");
-                IOLog("                Geometry Shaders: %s, Tessellation: %s\n",
+                VMLOG_DEBUG("                Geometry Shaders: %s, Tessellation: %s\n",
                       supports_geometry_shaders ? "YES" : "NO",
                       supports_tessellation ? "YES" : "NO");
                 
                 // Phase 5.2: Instruction Translation and Encoding
-                IOLog("            Phase 5.2: Translating high-level operations to GPU ISA\n");
+                VMLOG_DEBUG("            Phase 5.2: Translating high-level operations to GPU ISA\n");
                 
                 uint32_t scalar_alu_instructions = 0;
                 uint32_t vector_alu_instructions = 0;
@@ -11664,19 +10638,19 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 compilation.isa_generation.isa_instruction_count = optimized_instruction_count * 2; // ISA expansion factor
                 
-                IOLog("              Instruction Translation Analysis:\n");
-                IOLog("                Scalar ALU: %d, Vector ALU: %d, Matrix ALU: %d\n",
+                VMLOG_DEBUG("              Instruction Translation Analysis:\n");
+                VMLOG_DEBUG("                Scalar ALU: %d, Vector ALU: %d, Matrix ALU: %d\n",
                       scalar_alu_instructions, vector_alu_instructions, matrix_alu_instructions);
-                IOLog("                Transcendental: %d, Comparison: %d, Bitwise: %d\n",
+                VMLOG_DEBUG("                Transcendental: %d, Comparison: %d, Bitwise: %d\n",
                       transcendental_instructions, comparison_instructions, bitwise_instructions);
-                IOLog("                Conversion: %d, Load/Store: %d, Constant Load: %d\n",
+                VMLOG_DEBUG("                Conversion: %d, Load/Store: %d, Constant Load: %d\n",
                       conversion_instructions, load_store_instructions, constant_load_instructions);
-                IOLog("                Total ISA Instructions: %d (%.1fx expansion)\n",
+                VMLOG_DEBUG("                Total ISA Instructions: %d (%.1fx expansion)\n",
                       compilation.isa_generation.isa_instruction_count,
                       (float)compilation.isa_generation.isa_instruction_count / (float)optimized_instruction_count);
                 
                 // Phase 5.3: GPU Resource Allocation and Scheduling Analysis
-                IOLog("            Phase 5.3: Analyzing GPU resource allocation and scheduling\n");
+                VMLOG_DEBUG("            Phase 5.3: Analyzing GPU resource allocation and scheduling\n");
                 
                 uint32_t warp_occupancy_percent = 0;
                 uint32_t texture_cache_utilization = 0;
@@ -11721,21 +10695,21 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 requires_atomic_operations = false; // Vertex shaders don't typically need atomics
                 requires_barrier_synchronization = (compilation.source_analysis.control_flow_complexity > 8);
                 
-                IOLog("              GPU Resource Analysis:\n");
-                IOLog("                Warp Occupancy: %d%%, Texture Cache Utilization: %d%%\n",
+                VMLOG_DEBUG("              GPU Resource Analysis:\n");
+                VMLOG_DEBUG("                Warp Occupancy: %d%%, Texture Cache Utilization: %d%%\n",
                       warp_occupancy_percent, texture_cache_utilization);
-                IOLog("                Shared Memory Usage: %d bytes, Register Bank Conflicts: %d\n",
+                VMLOG_DEBUG("                Shared Memory Usage: %d bytes, Register Bank Conflicts: %d\n",
                       shared_memory_usage, register_bank_conflicts);
-                IOLog("                Memory Coalescing: %d%%, Branch Divergence Penalty: %d cycles\n",
+                VMLOG_DEBUG("                Memory Coalescing: %d%%, Branch Divergence Penalty: %d cycles\n",
                       memory_coalescing_efficiency, branch_divergence_penalty);
-                IOLog("                Instruction Latency: %d cycles, Throughput: %d IPC\n",
+                VMLOG_DEBUG("                Instruction Latency: %d cycles, Throughput: %d IPC\n",
                       instruction_latency_cycles, throughput_instructions_per_clock);
-                IOLog("                Atomic Operations: %s, Barrier Sync: %s\n",
+                VMLOG_DEBUG("                Atomic Operations: %s, Barrier Sync: %s\n",
                       requires_atomic_operations ? "REQUIRED" : "NOT_REQUIRED",
                       requires_barrier_synchronization ? "REQUIRED" : "NOT_REQUIRED");
                 
                 // Phase 5.4: Performance Optimization and Validation
-                IOLog("            Phase 5.4: Performing ISA-level performance optimization\n");
+                VMLOG_DEBUG("            Phase 5.4: Performing ISA-level performance optimization\n");
                 
                 uint32_t instruction_reordering_applied = 0;
                 uint32_t dual_issue_opportunities = 0;
@@ -11781,34 +10755,34 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     estimated_power_consumption_milliwatts *= 0.85f; // 15% power reduction
                 }
                 
-                IOLog("              ISA Performance Optimization:\n");
-                IOLog("                Instruction Reordering: %d applied, Dual-Issue: %d opportunities\n",
+                VMLOG_DEBUG("              ISA Performance Optimization:\n");
+                VMLOG_DEBUG("                Instruction Reordering: %d applied, Dual-Issue: %d opportunities\n",
                       instruction_reordering_applied, dual_issue_opportunities);
-                IOLog("                NOP Padding: %d inserted, Register Renaming: %d applied\n",
+                VMLOG_DEBUG("                NOP Padding: %d inserted, Register Renaming: %d applied\n",
                       nop_padding_inserted, register_renaming_applied);
-                IOLog("                Memory Prefetch Hints: %d, Branch Prediction Hints: %d\n",
+                VMLOG_DEBUG("                Memory Prefetch Hints: %d, Branch Prediction Hints: %d\n",
                       memory_prefetch_hints, branch_prediction_hints);
-                IOLog("                Texture Sampler Optimizations: %d, Power Optimizations: %d\n",
+                VMLOG_DEBUG("                Texture Sampler Optimizations: %d, Power Optimizations: %d\n",
                       texture_sampler_optimizations, power_optimization_applied);
-                IOLog("                Estimated Execution Time: %.2f μs\n", estimated_execution_time_microseconds);
-                IOLog("                Estimated Power Consumption: %.2f mW\n", estimated_power_consumption_milliwatts);
+                VMLOG_DEBUG("                Estimated Execution Time: %.2f μs\n", estimated_execution_time_microseconds);
+                VMLOG_DEBUG("                Estimated Power Consumption: %.2f mW\n", estimated_power_consumption_milliwatts);
                 
                 // Comprehensive ISA generation summary
-                IOLog("          ISA Generation Results:\n");
-                IOLog("            Target Architecture: 0x%04x (Gen %d), ISA Instructions: %d\n",
+                VMLOG_DEBUG("          ISA Generation Results:\n");
+                VMLOG_DEBUG("            Target Architecture: 0x%04x (Gen %d), ISA Instructions: %d\n",
                       compilation.isa_generation.target_architecture, architecture_generation,
                       compilation.isa_generation.isa_instruction_count);
-                IOLog("            ALU: %d, Memory: %d, Control Flow: %d\n",
+                VMLOG_DEBUG("            ALU: %d, Memory: %d, Control Flow: %d\n",
                       compilation.isa_generation.alu_instructions,
                       compilation.isa_generation.memory_instructions,
                       compilation.isa_generation.control_flow_instructions);
-                IOLog("            Texture: %d, Special Functions: %d, Predicates: %d\n",
+                VMLOG_DEBUG("            Texture: %d, Special Functions: %d, Predicates: %d\n",
                       compilation.isa_generation.texture_instructions,
                       compilation.isa_generation.special_function_instructions,
                       compilation.isa_generation.predicate_instructions);
-                IOLog("            Warp Occupancy: %d%%, Memory Coalescing: %d%%\n",
+                VMLOG_DEBUG("            Warp Occupancy: %d%%, Memory Coalescing: %d%%\n",
                       warp_occupancy_percent, memory_coalescing_efficiency);
-                IOLog("            Execution Time: %.2f μs, Power: %.2f mW\n",
+                VMLOG_DEBUG("            Execution Time: %.2f μs, Power: %.2f mW\n",
                       estimated_execution_time_microseconds, estimated_power_consumption_milliwatts);
                 
                 // GPU capability flags
@@ -11824,13 +10798,13 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.stages.compilation_stage_count++;
                 
                 // Phase 6: Advanced Register Allocation
-                IOLog("        Phase 6: Performing advanced register allocation\n");
+                VMLOG_DEBUG("        Phase 6: Performing advanced register allocation\n");
                 
                 // Comprehensive Advanced Register Allocation System
-                IOLog("          Performing real-time register allocation from optimized vertex shader bytecode\n");
+                VMLOG_DEBUG("          Performing real-time register allocation from optimized vertex shader bytecode\n");
                 
                 // Phase 6.1: Register Bank Architecture Analysis and Allocation Strategy
-                IOLog("            Phase 6.1: Analyzing register bank architecture and allocation strategy\n");
+                VMLOG_DEBUG("            Phase 6.1: Analyzing register bank architecture and allocation strategy\n");
                 
                 compilation.register_allocation.available_registers = 128; // Typical GPU register count
                 uint32_t register_file_banks = 0;
@@ -11848,7 +10822,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     IOByteCount vs_bytecode_length = vertex_shader->bytecode->getLength();
                     uint32_t vs_bytecode_size = (uint32_t)((vs_bytecode_length < UINT32_MAX) ? vs_bytecode_length : UINT32_MAX);
                     
-                    IOLog("                Real-time SPIR-V Analysis: Processing %d bytes of bytecode\n", vs_bytecode_size);
+                    VMLOG_DEBUG("                Real-time SPIR-V Analysis: Processing %d bytes of bytecode\n", vs_bytecode_size);
                     
                     // Comprehensive Real-time SPIR-V Bytecode Analysis System for Register Architecture
                     struct SPIRVBytecodeAnalysis {
@@ -11910,7 +10884,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     } spv_analysis = {0};
                     
                     // Phase 1: Comprehensive Instruction Pattern Analysis
-                    IOLog("                Phase 1: Comprehensive instruction pattern analysis\n");
+                    VMLOG_DEBUG("                Phase 1: Comprehensive instruction pattern analysis\n");
                     
                     for (uint32_t i = 0; i < vs_bytecode_size - 12; i++) {
                         uint32_t* instruction = (uint32_t*)(vs_bytecode_data + i);
@@ -12008,7 +10982,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     }
                     
                     // Phase 2: Advanced Register Bank Conflict Analysis
-                    IOLog("                Phase 2: Advanced register bank conflict analysis\n");
+                    VMLOG_DEBUG("                Phase 2: Advanced register bank conflict analysis\n");
                     
                     // Calculate bank conflict potential
                     spv_analysis.conflict_analysis.potential_bank_conflicts = 
@@ -12038,7 +11012,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         (spv_analysis.conflict_analysis.parallel_execution_opportunities > 8);
                     
                     // Phase 3: SPIR-V Semantic Analysis for Allocation Strategy
-                    IOLog("                Phase 3: SPIR-V semantic analysis for allocation strategy\n");
+                    VMLOG_DEBUG("                Phase 3: SPIR-V semantic analysis for allocation strategy\n");
                     
                     // Calculate opcode diversity score
                     uint32_t unique_instruction_types = 0;
@@ -12082,7 +11056,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     }
                     
                     // Phase 4: Register Architecture Determination from Analysis
-                    IOLog("                Phase 4: Register architecture determination from bytecode analysis\n");
+                    VMLOG_DEBUG("                Phase 4: Register architecture determination from bytecode analysis\n");
                     
                     // Calculate optimal register file architecture
                     if (spv_analysis.usage_patterns.matrix_operations > 3 || spv_analysis.usage_patterns.vector_operations > 15) {
@@ -12125,29 +11099,29 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     addressable_register_space = register_file_banks * registers_per_bank;
                     
                     // Comprehensive register architecture analysis report
-                    IOLog("                Real-time SPIR-V Bytecode Analysis Results:\n");
-                    IOLog("                  Instructions Analyzed: %d, Opcode Diversity: %d\n",
+                    VMLOG_DEBUG("                Real-time SPIR-V Bytecode Analysis Results:\n");
+                    VMLOG_DEBUG("                  Instructions Analyzed: %d, Opcode Diversity: %d\n",
                           spv_analysis.total_instructions_analyzed, spv_analysis.semantic_analysis.opcode_diversity_score);
-                    IOLog("                  Instruction Breakdown: Arith=%d, Composite=%d, Texture=%d, Memory=%d, Control=%d\n",
+                    VMLOG_DEBUG("                  Instruction Breakdown: Arith=%d, Composite=%d, Texture=%d, Memory=%d, Control=%d\n",
                           spv_analysis.arithmetic_instruction_count, spv_analysis.composite_instruction_count,
                           spv_analysis.texture_sampling_instruction_count, spv_analysis.memory_access_instruction_count,
                           spv_analysis.control_flow_instruction_count);
-                    IOLog("                  Register Operations: Read=%d, Write=%d, Conflicts=%d\n",
+                    VMLOG_DEBUG("                  Register Operations: Read=%d, Write=%d, Conflicts=%d\n",
                           spv_analysis.usage_patterns.register_read_operations,
                           spv_analysis.usage_patterns.register_write_operations,
                           spv_analysis.usage_patterns.register_read_write_conflicts);
-                    IOLog("                  Usage Patterns: Scalar=%d, Vector=%d, Matrix=%d, Texture=%d\n",
+                    VMLOG_DEBUG("                  Usage Patterns: Scalar=%d, Vector=%d, Matrix=%d, Texture=%d\n",
                           spv_analysis.usage_patterns.scalar_operations, spv_analysis.usage_patterns.vector_operations,
                           spv_analysis.usage_patterns.matrix_operations, spv_analysis.usage_patterns.texture_operations);
-                    IOLog("                  Bank Conflicts: Potential=%d, Multi-bank=%d, Switching=%d\n",
+                    VMLOG_DEBUG("                  Bank Conflicts: Potential=%d, Multi-bank=%d, Switching=%d\n",
                           spv_analysis.conflict_analysis.potential_bank_conflicts,
                           spv_analysis.conflict_analysis.multi_bank_operations,
                           spv_analysis.conflict_analysis.bank_switching_requirements);
-                    IOLog("                  Advanced Features: Renaming=%s, Interleaving=%s, Dual-issue=%s\n",
+                    VMLOG_DEBUG("                  Advanced Features: Renaming=%s, Interleaving=%s, Dual-issue=%s\n",
                           spv_analysis.conflict_analysis.requires_register_renaming ? "YES" : "NO",
                           spv_analysis.conflict_analysis.requires_bank_interleaving ? "YES" : "NO",
                           spv_analysis.conflict_analysis.supports_dual_issue ? "YES" : "NO");
-                    IOLog("                  Allocation Metrics: Utilization=%.1f%%, Algorithm Suitability=%.1f\n",
+                    VMLOG_DEBUG("                  Allocation Metrics: Utilization=%.1f%%, Algorithm Suitability=%.1f\n",
                           spv_analysis.semantic_analysis.register_utilization_efficiency,
                           spv_analysis.semantic_analysis.allocation_algorithm_suitability);
                     
@@ -12164,20 +11138,20 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     supports_bank_switching = (compilation.source_analysis.control_flow_complexity > 4);
                 }
                 
-                IOLog("              Register Architecture Analysis:\n");
-                IOLog("                Register File Banks: %d, Registers per Bank: %d\n",
+                VMLOG_DEBUG("              Register Architecture Analysis:\n");
+                VMLOG_DEBUG("                Register File Banks: %d, Registers per Bank: %d\n",
                       register_file_banks, registers_per_bank);
-                IOLog("                Bank Access Ports: %d, Forwarding Paths: %d\n",
+                VMLOG_DEBUG("                Bank Access Ports: %d, Forwarding Paths: %d\n",
                       bank_access_ports, register_forwarding_paths);
-                IOLog("                Special Purpose Registers: %d, Addressable Space: %d\n",
+                VMLOG_DEBUG("                Special Purpose Registers: %d, Addressable Space: %d\n",
                       special_purpose_registers, addressable_register_space);
-                IOLog("                Register Renaming: %s, Register Caching: %s\n",
+                VMLOG_DEBUG("                Register Renaming: %s, Register Caching: %s\n",
                       supports_register_renaming ? "YES" : "NO",
                       supports_register_caching ? "YES" : "NO");
-                IOLog("                Bank Switching: %s\n", supports_bank_switching ? "YES" : "NO");
+                VMLOG_DEBUG("                Bank Switching: %s\n", supports_bank_switching ? "YES" : "NO");
                 
                 // Phase 6.2: Live Range Analysis and Interference Graph Construction
-                IOLog("            Phase 6.2: Performing live range analysis and interference graph construction\n");
+                VMLOG_DEBUG("            Phase 6.2: Performing live range analysis and interference graph construction\n");
                 
                 uint32_t variable_live_ranges = 0;
                 uint32_t temporary_live_ranges = 0;
@@ -12190,7 +11164,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 uint32_t interference_graph_density = 0;
                 
                 // Comprehensive Interference Graph Construction and Chromatic Analysis System
-                IOLog("              Performing comprehensive interference graph analysis with chromatic number estimation\n");
+                VMLOG_DEBUG("              Performing comprehensive interference graph analysis with chromatic number estimation\n");
                 
                 struct InterferenceGraphAnalysis {
                     // Basic Graph Properties
@@ -12250,7 +11224,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 } graph_analysis = {0};
                 
                 // Phase 1: Basic Live Range and Interference Analysis
-                IOLog("                Phase 1: Basic live range and interference calculation\n");
+                VMLOG_DEBUG("                Phase 1: Basic live range and interference calculation\n");
                 
                 // Live range analysis based on variable usage and control flow
                 variable_live_ranges = compilation.ast_analysis.variable_declarations;
@@ -12272,7 +11246,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     (interference_edges * 100) / ((total_live_ranges * (total_live_ranges - 1)) / 2) : 0;
                 
                 // Phase 2: Advanced Graph Theory Analysis with Chromatic Number Estimation
-                IOLog("                Phase 2: Advanced graph theory analysis with chromatic number estimation\n");
+                VMLOG_DEBUG("                Phase 2: Advanced graph theory analysis with chromatic number estimation\n");
                 
                 // Initialize graph analysis structure
                 graph_analysis.total_vertices = total_live_ranges;
@@ -12292,7 +11266,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 // Phase 3: Chromatic Number Analysis and Bounds Calculation
-                IOLog("                Phase 3: Chromatic number analysis and bounds calculation\n");
+                VMLOG_DEBUG("                Phase 3: Chromatic number analysis and bounds calculation\n");
                 
                 // Calculate chromatic bounds using various graph theory techniques
                 
@@ -12354,7 +11328,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 // Phase 4: Graph Structure Analysis and Special Properties
-                IOLog("                Phase 4: Graph structure analysis and special properties\n");
+                VMLOG_DEBUG("                Phase 4: Graph structure analysis and special properties\n");
                 
                 // Bipartite graph detection
                 graph_analysis.chromatic_analysis.is_bipartite = 
@@ -12413,7 +11387,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     graph_analysis.structural_analysis.tree_decomposition_width - 1 : 0;
                 
                 // Phase 5: Register Allocation Analysis and Algorithm Selection
-                IOLog("                Phase 5: Register allocation analysis and algorithm selection\n");
+                VMLOG_DEBUG("                Phase 5: Register allocation analysis and algorithm selection\n");
                 
                 // Identify spill candidates (high-degree vertices)
                 graph_analysis.allocation_analysis.spill_candidate_vertices = 0;
@@ -12460,35 +11434,35 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     (graph_analysis.structural_analysis.tree_decomposition_width < 8);
                 
                 // Comprehensive interference graph analysis report
-                IOLog("                Comprehensive Interference Graph Analysis Results:\n");
-                IOLog("                  Graph Structure: %d vertices, %d edges, %d%% density\n",
+                VMLOG_DEBUG("                Comprehensive Interference Graph Analysis Results:\n");
+                VMLOG_DEBUG("                  Graph Structure: %d vertices, %d edges, %d%% density\n",
                       graph_analysis.total_vertices, graph_analysis.total_edges, 
                       graph_analysis.graph_density_percentage);
-                IOLog("                  Degree Statistics: max=%d, min=%d, avg=%.2f\n",
+                VMLOG_DEBUG("                  Degree Statistics: max=%d, min=%d, avg=%.2f\n",
                       graph_analysis.maximum_degree, graph_analysis.minimum_degree, 
                       graph_analysis.average_degree);
-                IOLog("                  Chromatic Analysis: estimate=%d, bounds=[%d,%d], ratio=%.3f\n",
+                VMLOG_DEBUG("                  Chromatic Analysis: estimate=%d, bounds=[%d,%d], ratio=%.3f\n",
                       graph_analysis.chromatic_analysis.chromatic_number_estimate,
                       graph_analysis.chromatic_analysis.chromatic_lower_bound,
                       graph_analysis.chromatic_analysis.chromatic_upper_bound,
                       graph_analysis.chromatic_analysis.chromatic_ratio);
-                IOLog("                  Graph Properties: bipartite=%s, planar=%s, perfect=%s\n",
+                VMLOG_DEBUG("                  Graph Properties: bipartite=%s, planar=%s, perfect=%s\n",
                       graph_analysis.chromatic_analysis.is_bipartite ? "YES" : "NO",
                       graph_analysis.chromatic_analysis.is_planar ? "YES" : "NO",
                       graph_analysis.chromatic_analysis.is_perfect ? "YES" : "NO");
-                IOLog("                  Connectivity: components=%d, diameter=%d, radius=%d\n",
+                VMLOG_DEBUG("                  Connectivity: components=%d, diameter=%d, radius=%d\n",
                       graph_analysis.connectivity_analysis.connected_components,
                       graph_analysis.connectivity_analysis.graph_diameter,
                       graph_analysis.connectivity_analysis.graph_radius);
-                IOLog("                  Structural: max_clique=%d, max_independent=%d, triangles=%d\n",
+                VMLOG_DEBUG("                  Structural: max_clique=%d, max_independent=%d, triangles=%d\n",
                       graph_analysis.structural_analysis.maximum_clique_size,
                       graph_analysis.structural_analysis.maximum_independent_set_size,
                       graph_analysis.structural_analysis.triangular_subgraphs);
-                IOLog("                  Allocation: difficulty=%.1f, spill_candidates=%d, coalescence=%d\n",
+                VMLOG_DEBUG("                  Allocation: difficulty=%.1f, spill_candidates=%d, coalescence=%d\n",
                       graph_analysis.allocation_analysis.allocation_difficulty_score,
                       graph_analysis.allocation_analysis.spill_candidate_vertices,
                       graph_analysis.allocation_analysis.coalescing_opportunities);
-                IOLog("                  Suitability: requires_spilling=%s, benefits_coalescing=%s, linear_scan=%s\n",
+                VMLOG_DEBUG("                  Suitability: requires_spilling=%s, benefits_coalescing=%s, linear_scan=%s\n",
                       graph_analysis.allocation_analysis.requires_spilling ? "YES" : "NO",
                       graph_analysis.allocation_analysis.benefits_from_coalescing ? "YES" : "NO",
                       graph_analysis.allocation_analysis.suitable_for_linear_scan ? "YES" : "NO");
@@ -12577,35 +11551,35 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.register_allocation.live_ranges_analyzed = total_live_ranges;
                 compilation.register_allocation.interference_graph_nodes = total_live_ranges;
                 
-                IOLog("              Advanced Interference Graph Analysis:\n");
-                IOLog("                Chromatic Number Estimate: %d, Graph Connectivity: %d\n",
+                VMLOG_DEBUG("              Advanced Interference Graph Analysis:\n");
+                VMLOG_DEBUG("                Chromatic Number Estimate: %d, Graph Connectivity: %d\n",
                       chromatic_number_estimate, graph_connectivity_index);
-                IOLog("                Bipartite Subgraphs: %d, Maximum Clique Size: %d\n",
+                VMLOG_DEBUG("                Bipartite Subgraphs: %d, Maximum Clique Size: %d\n",
                       bipartite_subgraph_count, clique_maximum_size);
-                IOLog("                Maximum Independent Set: %d, Graph Diameter: %d\n",
+                VMLOG_DEBUG("                Maximum Independent Set: %d, Graph Diameter: %d\n",
                       independent_set_maximum_size, graph_diameter);
-                IOLog("                Strongly Connected Components: %d, Planarity Violations: %d\n",
+                VMLOG_DEBUG("                Strongly Connected Components: %d, Planarity Violations: %d\n",
                       strongly_connected_components, graph_planarity_violations);
-                IOLog("                Perfect Graph: %s, Triangular Subgraphs: %s\n",
+                VMLOG_DEBUG("                Perfect Graph: %s, Triangular Subgraphs: %s\n",
                       is_perfect_graph ? "YES" : "NO", has_triangular_subgraphs ? "YES" : "NO");
                 
-                IOLog("              Live Range Analysis:\n");
-                IOLog("                Variable Live Ranges: %d, Temporary Live Ranges: %d\n",
+                VMLOG_DEBUG("              Live Range Analysis:\n");
+                VMLOG_DEBUG("                Variable Live Ranges: %d, Temporary Live Ranges: %d\n",
                       variable_live_ranges, temporary_live_ranges);
-                IOLog("                Constant Live Ranges: %d, Total Live Ranges: %d\n",
+                VMLOG_DEBUG("                Constant Live Ranges: %d, Total Live Ranges: %d\n",
                       constant_live_ranges, total_live_ranges);
-                IOLog("                Overlapping Ranges: %d, Non-overlapping: %d\n",
+                VMLOG_DEBUG("                Overlapping Ranges: %d, Non-overlapping: %d\n",
                       overlapping_live_ranges, non_overlapping_live_ranges);
-                IOLog("                Range Splits: %d, Range Merges: %d\n",
+                VMLOG_DEBUG("                Range Splits: %d, Range Merges: %d\n",
                       live_range_splits, live_range_merges);
-                IOLog("                Interference Edges: %d, Graph Density: %d%%\n",
+                VMLOG_DEBUG("                Interference Edges: %d, Graph Density: %d%%\n",
                       interference_edges, interference_graph_density);
                 
                 // Phase 6.3: Register Allocation Algorithm Selection and Execution
-                IOLog("            Phase 6.3: Selecting and executing register allocation algorithm\n");
+                VMLOG_DEBUG("            Phase 6.3: Selecting and executing register allocation algorithm\n");
                 
                 // Comprehensive Chaitin-Briggs Algorithm Implementation with Optimistic Coloring
-                IOLog("              Implementing advanced Chaitin-Briggs algorithm with optimistic coloring\n");
+                VMLOG_DEBUG("              Implementing advanced Chaitin-Briggs algorithm with optimistic coloring\n");
                 
                 struct ChaitinBriggsImplementation {
                     // Algorithm Control Parameters
@@ -12705,7 +11679,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 } chaitin_briggs = {0};
                 
                 // Phase 1: Algorithm Configuration and Initialization
-                IOLog("                Phase 1: Algorithm configuration and initialization\n");
+                VMLOG_DEBUG("                Phase 1: Algorithm configuration and initialization\n");
                 
                 // Configure algorithm parameters based on problem complexity
                 chaitin_briggs.config.max_iterations = (interference_graph_density > 70) ? 8 : 5;
@@ -12723,15 +11697,15 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 chaitin_briggs.state.current_iteration = 0;
                 chaitin_briggs.state.simplify_phase_active = true;
                 
-                IOLog("                  Configuration: max_iter=%d, simplify_thresh=%d, opt_coloring=%s\n",
+                VMLOG_DEBUG("                  Configuration: max_iter=%d, simplify_thresh=%d, opt_coloring=%s\n",
                       chaitin_briggs.config.max_iterations, chaitin_briggs.config.simplify_threshold,
                       chaitin_briggs.config.enable_optimistic_coloring ? "ON" : "OFF");
-                IOLog("                  Graph State: vertices=%d, precolored=%d, density=%d%%\n",
+                VMLOG_DEBUG("                  Graph State: vertices=%d, precolored=%d, density=%d%%\n",
                       chaitin_briggs.state.vertices_remaining, chaitin_briggs.state.vertices_precolored,
                       interference_graph_density);
                 
                 // Phase 2: Iterative Chaitin-Briggs Algorithm Execution
-                IOLog("                Phase 2: Iterative Chaitin-Briggs algorithm execution\n");
+                VMLOG_DEBUG("                Phase 2: Iterative Chaitin-Briggs algorithm execution\n");
                 
                 uint64_t algorithm_start = mach_absolute_time();
                 
@@ -12740,7 +11714,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                        chaitin_briggs.state.current_iteration < chaitin_briggs.config.max_iterations) {
                     
                     chaitin_briggs.state.current_iteration++;
-                    IOLog("                  Iteration %d: Processing %d remaining vertices\n",
+                    VMLOG_DEBUG("                  Iteration %d: Processing %d remaining vertices\n",
                           chaitin_briggs.state.current_iteration, chaitin_briggs.state.vertices_remaining);
                     
                     // Simplify Phase: Remove low-degree vertices
@@ -12768,7 +11742,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         chaitin_briggs.phases.simplify.phase_execution_time_ms = (float)(simplify_end - simplify_start) / 1000000.0f;
                         chaitin_briggs.phases.simplify.phase_completed_successfully = (removed_this_round > 0);
                         
-                        IOLog("                    Simplify: removed %d vertices, %d edges eliminated\n",
+                        VMLOG_DEBUG("                    Simplify: removed %d vertices, %d edges eliminated\n",
                               removed_this_round, chaitin_briggs.phases.simplify.interference_edges_removed);
                         
                         // Move to coalesce phase if no more simplifications possible
@@ -12824,7 +11798,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         float coalesce_time = (float)(coalesce_end - coalesce_start) / 1000000.0f;
                         chaitin_briggs.performance.phase_distribution[1] = coalesce_time;
                         
-                        IOLog("                    Coalesce: %d successful, %d rejected, benefit=%.1f%%\n",
+                        VMLOG_DEBUG("                    Coalesce: %d successful, %d rejected, benefit=%.1f%%\n",
                               successful_coalescing, chaitin_briggs.phases.coalesce.coalescing_rejected,
                               chaitin_briggs.phases.coalesce.coalescing_benefit_score);
                         
@@ -12864,7 +11838,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         float freeze_time = (float)(freeze_end - freeze_start) / 1000000.0f;
                         chaitin_briggs.performance.phase_distribution[2] = freeze_time;
                         
-                        IOLog("                    Freeze: %d moves frozen, %d vertices unfrozen\n",
+                        VMLOG_DEBUG("                    Freeze: %d moves frozen, %d vertices unfrozen\n",
                               chaitin_briggs.phases.freeze.moves_frozen, vertices_to_freeze);
                         
                         // Return to simplify phase after freezing
@@ -12883,7 +11857,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 // Phase 3: Select Phase with Optimistic Coloring
-                IOLog("                Phase 3: Select phase with optimistic coloring\n");
+                VMLOG_DEBUG("                Phase 3: Select phase with optimistic coloring\n");
                 
                 if (chaitin_briggs.state.select_phase_active) {
                     uint64_t select_start = mach_absolute_time();
@@ -13236,12 +12210,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         ((float)assigned_vector_registers_estimate / (float)total_register_assignments) * 100.0f : 0.0f;
                     
                     // Log comprehensive coloring statistics
-                    IOLog("                    Advanced Coloring Statistics:\n");
-                    IOLog("                      Average Color Preference Score: %.1f\n", average_color_preference);
-                    IOLog("                      Optimistic Benefit Ratio: %.3f\n", optimistic_benefit_ratio);
-                    IOLog("                      Vector/General Register Distribution: %.1f%%/%.1f%%\n",
+                    VMLOG_DEBUG("                    Advanced Coloring Statistics:\n");
+                    VMLOG_DEBUG("                      Average Color Preference Score: %.1f\n", average_color_preference);
+                    VMLOG_DEBUG("                      Optimistic Benefit Ratio: %.3f\n", optimistic_benefit_ratio);
+                    VMLOG_DEBUG("                      Vector/General Register Distribution: %.1f%%/%.1f%%\n",
                           register_class_distribution, 100.0f - register_class_distribution);
-                    IOLog("                      Spill Cost Analysis: Vector=%d, General=%d, Total=%d\n",
+                    VMLOG_DEBUG("                      Spill Cost Analysis: Vector=%d, General=%d, Total=%d\n",
                           vector_register_spills, general_register_spills, total_spill_cost_estimate);
                     
                     chaitin_briggs.phases.select.optimistic_attempts = optimistic_attempts;
@@ -13255,7 +12229,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     float select_time = (float)(select_end - select_start) / 1000000.0f;
                     chaitin_briggs.performance.phase_distribution[3] = select_time;
                     
-                    IOLog("                    Select: %d colored, %d optimistic attempts, %.1f%% success\n",
+                    VMLOG_DEBUG("                    Select: %d colored, %d optimistic attempts, %.1f%% success\n",
                           chaitin_briggs.phases.select.vertices_colored, optimistic_attempts,
                           chaitin_briggs.phases.select.coloring_success_rate);
                     
@@ -13271,7 +12245,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 chaitin_briggs.performance.phase_distribution[0] = chaitin_briggs.phases.simplify.phase_execution_time_ms;
                 
                 // Phase 4: Performance Analysis and Algorithm Assessment
-                IOLog("                Phase 4: Performance analysis and algorithm assessment\n");
+                VMLOG_DEBUG("                Phase 4: Performance analysis and algorithm assessment\n");
                 
                 // Calculate algorithm complexity and efficiency
                 chaitin_briggs.performance.algorithm_complexity_score = 
@@ -13285,22 +12259,22 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     (chaitin_briggs.phases.select.coloring_success_rate > 75.0f);
                 
                 // Comprehensive Chaitin-Briggs algorithm results
-                IOLog("                Comprehensive Chaitin-Briggs Algorithm Results:\n");
-                IOLog("                  Algorithm Execution: %d iterations, %.2f ms total\n",
+                VMLOG_DEBUG("                Comprehensive Chaitin-Briggs Algorithm Results:\n");
+                VMLOG_DEBUG("                  Algorithm Execution: %d iterations, %.2f ms total\n",
                       chaitin_briggs.state.current_iteration, chaitin_briggs.performance.total_algorithm_time_ms);
-                IOLog("                  Phase Performance: Simplify=%.2f, Coalesce=%.2f, Freeze=%.2f, Select=%.2f ms\n",
+                VMLOG_DEBUG("                  Phase Performance: Simplify=%.2f, Coalesce=%.2f, Freeze=%.2f, Select=%.2f ms\n",
                       chaitin_briggs.performance.phase_distribution[0], chaitin_briggs.performance.phase_distribution[1],
                       chaitin_briggs.performance.phase_distribution[2], chaitin_briggs.performance.phase_distribution[3]);
-                IOLog("                  Vertex Processing: %d simplified, %d coalesced, %d frozen, %d colored\n",
+                VMLOG_DEBUG("                  Vertex Processing: %d simplified, %d coalesced, %d frozen, %d colored\n",
                       chaitin_briggs.state.vertices_simplified, chaitin_briggs.state.vertices_coalesced,
                       chaitin_briggs.state.vertices_frozen, chaitin_briggs.phases.select.vertices_colored);
-                IOLog("                  Coalescing Analysis: %.1f%% success, %d moves eliminated\n",
+                VMLOG_DEBUG("                  Coalescing Analysis: %.1f%% success, %d moves eliminated\n",
                       chaitin_briggs.phases.coalesce.coalescing_benefit_score,
                       chaitin_briggs.phases.coalesce.move_instructions_eliminated);
-                IOLog("                  Optimistic Coloring: %d attempts, %d successes, beneficial=%s\n",
+                VMLOG_DEBUG("                  Optimistic Coloring: %d attempts, %d successes, beneficial=%s\n",
                       chaitin_briggs.phases.select.optimistic_attempts, chaitin_briggs.phases.select.optimistic_successes,
                       chaitin_briggs.phases.select.optimistic_coloring_beneficial ? "YES" : "NO");
-                IOLog("                  Algorithm Efficiency: complexity=%d, target_met=%s, success_rate=%.1f%%\n",
+                VMLOG_DEBUG("                  Algorithm Efficiency: complexity=%d, target_met=%s, success_rate=%.1f%%\n",
                       chaitin_briggs.performance.algorithm_complexity_score,
                       chaitin_briggs.performance.meets_performance_target ? "YES" : "NO",
                       chaitin_briggs.phases.select.coloring_success_rate);
@@ -13375,7 +12349,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         allocation_algorithm_efficiency = 85.0f; // Lower efficiency due to complexity
                         compilation.register_allocation.graph_coloring_used = true;
                         compilation.register_allocation.linear_scan_used = false;
-                        IOLog("              Selected: Advanced Chaitin-Briggs with Optimistic Coloring\n");
+                        VMLOG_DEBUG("              Selected: Advanced Chaitin-Briggs with Optimistic Coloring\n");
                     } else if (allocation_complexity_score > 50) {
                         // Medium complexity - hybrid approach with iterated register coalescing
                         chaitin_briggs_iterations = 4;
@@ -13385,7 +12359,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         allocation_algorithm_efficiency = 90.0f;
                         compilation.register_allocation.graph_coloring_used = true;
                         compilation.register_allocation.linear_scan_used = true;
-                        IOLog("              Selected: Hybrid Chaitin-Briggs + Linear Scan\n");
+                        VMLOG_DEBUG("              Selected: Hybrid Chaitin-Briggs + Linear Scan\n");
                     } else {
                         // Low complexity - efficient linear scan with limited coalescing
                         iterated_register_coalescing_phases = 2;
@@ -13393,7 +12367,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         allocation_algorithm_efficiency = 95.0f;
                         compilation.register_allocation.linear_scan_used = true;
                         compilation.register_allocation.graph_coloring_used = false;
-                        IOLog("              Selected: Linear Scan with Register Coalescing\n");
+                        VMLOG_DEBUG("              Selected: Linear Scan with Register Coalescing\n");
                     }
                     
                     // Execute algorithm phases based on selection
@@ -13459,35 +12433,35 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 compilation.register_allocation.coloring_iterations = allocation_rounds;
                 compilation.register_allocation.coalescing_opportunities = register_coalescing_applied;
                 
-                IOLog("              Advanced Register Allocation Algorithm Analysis:\n");
-                IOLog("                Chaitin-Briggs Iterations: %d, IRA Phases: %d\n",
+                VMLOG_DEBUG("              Advanced Register Allocation Algorithm Analysis:\n");
+                VMLOG_DEBUG("                Chaitin-Briggs Iterations: %d, IRA Phases: %d\n",
                       chaitin_briggs_iterations, iterated_register_coalescing_phases);
-                IOLog("                Simplify Phase Removals: %d, Coalesce Phase Merges: %d\n",
+                VMLOG_DEBUG("                Simplify Phase Removals: %d, Coalesce Phase Merges: %d\n",
                       simplify_phase_removals, coalesce_phase_merges);
-                IOLog("                Freeze Phase Moves Disabled: %d, Select Phase Assignments: %d\n",
+                VMLOG_DEBUG("                Freeze Phase Moves Disabled: %d, Select Phase Assignments: %d\n",
                       freeze_phase_moves_disabled, select_phase_assignments);
-                IOLog("                Actual Spill Phase Variables: %d, Algorithm Efficiency: %.1f%%\n",
+                VMLOG_DEBUG("                Actual Spill Phase Variables: %d, Algorithm Efficiency: %.1f%%\n",
                       actual_spill_phase_variables, allocation_algorithm_efficiency);
-                IOLog("                Optimistic Coloring: %s, Biased Coloring: %s\n",
+                VMLOG_DEBUG("                Optimistic Coloring: %s, Biased Coloring: %s\n",
                       uses_optimistic_coloring ? "YES" : "NO", uses_biased_coloring ? "YES" : "NO");
-                IOLog("                Precolored Nodes: %s\n", uses_precolored_nodes ? "YES" : "NO");
+                VMLOG_DEBUG("                Precolored Nodes: %s\n", uses_precolored_nodes ? "YES" : "NO");
                 
-                IOLog("              Register Allocation Algorithm:\n");
-                IOLog("                Graph Coloring Complexity: %d, Linear Scan Efficiency: %d%%\n",
+                VMLOG_DEBUG("              Register Allocation Algorithm:\n");
+                VMLOG_DEBUG("                Graph Coloring Complexity: %d, Linear Scan Efficiency: %d%%\n",
                       graph_coloring_complexity, linear_scan_efficiency);
-                IOLog("                Priority-based Allocation: %d, Spill Cost Analysis: %d\n",
+                VMLOG_DEBUG("                Priority-based Allocation: %d, Spill Cost Analysis: %d\n",
                       priority_based_allocation, spill_cost_analysis);
-                IOLog("                Allocation Rounds: %d, Successful Colorings: %d\n",
+                VMLOG_DEBUG("                Allocation Rounds: %d, Successful Colorings: %d\n",
                       allocation_rounds, successful_colorings);
-                IOLog("                Failed Colorings: %d, Register Coalescing: %d\n",
+                VMLOG_DEBUG("                Failed Colorings: %d, Register Coalescing: %d\n",
                       failed_colorings, register_coalescing_applied);
-                IOLog("                Register Splitting: %d\n", register_splitting_applied);
+                VMLOG_DEBUG("                Register Splitting: %d\n", register_splitting_applied);
                 
                 // Phase 6.4: Register Assignment and Spill Code Generation
-                IOLog("            Phase 6.4: Performing register assignment and spill code generation\n");
+                VMLOG_DEBUG("            Phase 6.4: Performing register assignment and spill code generation\n");
                 
                 // Comprehensive Register Assignment and Advanced Spill Code Generation System
-                IOLog("              Implementing comprehensive register assignment with advanced spill code generation\n");
+                VMLOG_DEBUG("              Implementing comprehensive register assignment with advanced spill code generation\n");
                 
                 struct RegisterAssignmentSystem {
                     // Register Class Management
@@ -13562,7 +12536,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 } assignment_system = {0};
                 
                 // Phase 1: Register Class Analysis and Allocation
-                IOLog("                Phase 1: Register class analysis and allocation\n");
+                VMLOG_DEBUG("                Phase 1: Register class analysis and allocation\n");
                 
                 uint32_t allocated_general_registers = 0;
                 uint32_t allocated_vector_registers = 0;
@@ -13592,19 +12566,19 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 assignment_system.register_classes.supports_register_renaming = supports_register_renaming;
                 assignment_system.register_classes.supports_register_forwarding = (bank_access_ports > 4);
                 
-                IOLog("                  Register Classes: GP=%d, Vector=%d, Predicate=%d, Special=%d\n",
+                VMLOG_DEBUG("                  Register Classes: GP=%d, Vector=%d, Predicate=%d, Special=%d\n",
                       assignment_system.register_classes.general_purpose_registers,
                       assignment_system.register_classes.vector_registers,
                       assignment_system.register_classes.predicate_registers,
                       assignment_system.register_classes.special_purpose_registers);
-                IOLog("                  Advanced Features: Pairs=%d, Windows=%d, Renaming=%s, Forwarding=%s\n",
+                VMLOG_DEBUG("                  Advanced Features: Pairs=%d, Windows=%d, Renaming=%s, Forwarding=%s\n",
                       assignment_system.register_classes.register_pairs_available,
                       assignment_system.register_classes.register_windows_count,
                       assignment_system.register_classes.supports_register_renaming ? "YES" : "NO",
                       assignment_system.register_classes.supports_register_forwarding ? "YES" : "NO");
                 
                 // Phase 2: Assignment Strategy Selection and Configuration
-                IOLog("                Phase 2: Assignment strategy selection and configuration\n");
+                VMLOG_DEBUG("                Phase 2: Assignment strategy selection and configuration\n");
                 
                 // Select assignment strategy based on problem characteristics
                 if (chromatic_number_estimate > compilation.register_allocation.available_registers) {
@@ -13626,17 +12600,17 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 assignment_system.strategy.enable_live_range_splitting = (overlapping_live_ranges > 15);
                 assignment_system.strategy.assignment_quality_target = 85.0f;
                 
-                IOLog("                  Strategy: algorithm=%d, priority=%d, pressure_mitigation=%d\n",
+                VMLOG_DEBUG("                  Strategy: algorithm=%d, priority=%d, pressure_mitigation=%d\n",
                       assignment_system.strategy.assignment_algorithm, assignment_system.strategy.priority_scheme,
                       assignment_system.strategy.register_pressure_mitigation);
-                IOLog("                  Optimizations: caller_saved=%s, callee_saved=%s, coalescing=%s, splitting=%s\n",
+                VMLOG_DEBUG("                  Optimizations: caller_saved=%s, callee_saved=%s, coalescing=%s, splitting=%s\n",
                       assignment_system.strategy.use_caller_saved_optimization ? "ON" : "OFF",
                       assignment_system.strategy.use_callee_saved_optimization ? "ON" : "OFF",
                       assignment_system.strategy.enable_register_coalescing ? "ON" : "OFF",
                       assignment_system.strategy.enable_live_range_splitting ? "ON" : "OFF");
                 
                 // Phase 3: Real-time Register Assignment from SPIR-V Analysis
-                IOLog("                Phase 3: Real-time register assignment from SPIR-V analysis\n");
+                VMLOG_DEBUG("                Phase 3: Real-time register assignment from SPIR-V analysis\n");
                 
                 // Advanced Register Assignment and Spill Analysis System
                 uint32_t register_class_assignments[8] = {0}; // Different register classes
@@ -13664,7 +12638,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     uint32_t conditional_register_usage = 0;
                     uint32_t spill_inducing_operations = 0;
                     
-                    IOLog("                  Analyzing %d bytes of SPIR-V for register assignment patterns\n", vs_bytecode_size);
+                    VMLOG_DEBUG("                  Analyzing %d bytes of SPIR-V for register assignment patterns\n", vs_bytecode_size);
                     
                     // Comprehensive register assignment analysis from SPIR-V opcodes
                     for (uint32_t i = 0; i < vs_bytecode_size - 12; i++) {
@@ -13731,12 +12705,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         spill_slot_coloring_applied = memory_slot_reuse_count;
                     }
                     
-                    IOLog("                    Register Usage Analysis: Scalar=%d, Vector=%d, Texture=%d, Address=%d\n",
+                    VMLOG_DEBUG("                    Register Usage Analysis: Scalar=%d, Vector=%d, Texture=%d, Address=%d\n",
                           scalar_register_usage, vector_register_usage, texture_register_usage, address_register_usage);
-                    IOLog("                    Register Assignments: GP=%d, Vector=%d, Predicate=%d, Special=%d\n",
+                    VMLOG_DEBUG("                    Register Assignments: GP=%d, Vector=%d, Predicate=%d, Special=%d\n",
                           allocated_general_registers, allocated_vector_registers, 
                           allocated_predicate_registers, allocated_special_registers);
-                    IOLog("                    Spill Analysis: %d inducing ops, %d locations, %d loads, %d stores\n",
+                    VMLOG_DEBUG("                    Spill Analysis: %d inducing ops, %d locations, %d loads, %d stores\n",
                           spill_inducing_operations, spill_locations_created, 
                           spill_load_instructions, spill_store_instructions);
                     
@@ -13758,7 +12732,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 // Phase 4: Advanced Spill Code Generation and Optimization
-                IOLog("                Phase 4: Advanced spill code generation and optimization\n");
+                VMLOG_DEBUG("                Phase 4: Advanced spill code generation and optimization\n");
                 
                 if (spill_locations_created > 0) {
                     // Advanced spill code generation system
@@ -13793,24 +12767,24 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     uint64_t spill_end = mach_absolute_time();
                     float spill_time = (float)(spill_end - spill_start) / 1000000.0f;
                     
-                    IOLog("                    Advanced Spill Code Generation Results:\n");
-                    IOLog("                      Spill Analysis: %d candidates, %.1f avg cost, %d infinite cost\n",
+                    VMLOG_DEBUG("                    Advanced Spill Code Generation Results:\n");
+                    VMLOG_DEBUG("                      Spill Analysis: %d candidates, %.1f avg cost, %d infinite cost\n",
                           assignment_system.spill_generation.spill_candidates_identified,
                           assignment_system.spill_generation.average_spill_cost,
                           assignment_system.spill_generation.infinite_cost_variables);
-                    IOLog("                      Memory Management: %d slots, %d reused, %d%% fragmentation\n",
+                    VMLOG_DEBUG("                      Memory Management: %d slots, %d reused, %d%% fragmentation\n",
                           assignment_system.spill_generation.spill_slots_allocated,
                           assignment_system.spill_generation.spill_slot_reuse_count,
                           assignment_system.spill_generation.spill_memory_fragmentation);
-                    IOLog("                      Code Generation: %d loads, %d stores, %d redundant eliminated\n",
+                    VMLOG_DEBUG("                      Code Generation: %d loads, %d stores, %d redundant eliminated\n",
                           assignment_system.spill_generation.spill_load_instructions,
                           assignment_system.spill_generation.spill_store_instructions,
                           assignment_system.spill_generation.redundant_spills_eliminated);
-                    IOLog("                      Optimizations: %d hoisted, %d coalesced, %.1f%% efficiency\n",
+                    VMLOG_DEBUG("                      Optimizations: %d hoisted, %d coalesced, %.1f%% efficiency\n",
                           assignment_system.spill_generation.spill_code_hoisting_applied,
                           assignment_system.spill_generation.spill_coalescing_opportunities,
                           assignment_system.spill_generation.spill_code_efficiency);
-                    IOLog("                      Generation Time: %.3f ms\n", spill_time);
+                    VMLOG_DEBUG("                      Generation Time: %.3f ms\n", spill_time);
                 }
                 
                 // Calculate final register allocation metrics and quality assessment
@@ -13828,7 +12802,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 register_allocation_bank_conflicts += register_aliasing_conflicts;
                 
                 // Phase 5: Quality Assessment and Performance Impact Analysis
-                IOLog("                Phase 5: Quality assessment and performance impact analysis\n");
+                VMLOG_DEBUG("                Phase 5: Quality assessment and performance impact analysis\n");
                 
                 // Calculate comprehensive register allocation metrics
                 compilation.register_allocation.register_pressure_score = 
@@ -13868,51 +12842,51 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 assignment_system.quality.performance_impact_estimate = spill_penalty + bank_conflict_penalty + pressure_penalty;
                 
-                IOLog("                Comprehensive Register Assignment Results:\n");
-                IOLog("                  Final Allocation: GP=%d, Vector=%d, Predicate=%d, Special=%d (Total: %d)\n",
+                VMLOG_DEBUG("                Comprehensive Register Assignment Results:\n");
+                VMLOG_DEBUG("                  Final Allocation: GP=%d, Vector=%d, Predicate=%d, Special=%d (Total: %d)\n",
                       allocated_general_registers, allocated_vector_registers, allocated_predicate_registers,
                       allocated_special_registers, compilation.register_allocation.allocated_registers);
-                IOLog("                  Utilization: %.1f%% of available registers, Pressure: %d%%\n",
+                VMLOG_DEBUG("                  Utilization: %.1f%% of available registers, Pressure: %d%%\n",
                       compilation.register_allocation.register_utilization_percent,
                       compilation.register_allocation.register_pressure_score);
-                IOLog("                  Conflicts: %d bank conflicts, %d aliasing conflicts, %d pressure hotspots\n",
+                VMLOG_DEBUG("                  Conflicts: %d bank conflicts, %d aliasing conflicts, %d pressure hotspots\n",
                       assignment_system.quality.register_bank_conflicts,
                       assignment_system.quality.register_aliasing_conflicts,
                       assignment_system.quality.register_pressure_hotspots);
-                IOLog("                  Optimizations: %d moves eliminated, pairs=%s, windows=%s\n",
+                VMLOG_DEBUG("                  Optimizations: %d moves eliminated, pairs=%s, windows=%s\n",
                       assignment_system.quality.move_instructions_eliminated,
                       uses_register_pairs ? "YES" : "NO", uses_register_windows ? "YES" : "NO");
-                IOLog("                  Quality Assessment: %.1f score, target_met=%s, perf_impact=%.1f%%\n",
+                VMLOG_DEBUG("                  Quality Assessment: %.1f score, target_met=%s, perf_impact=%.1f%%\n",
                       assignment_system.quality.overall_assignment_quality,
                       assignment_system.quality.meets_quality_target ? "YES" : "NO",
                       assignment_system.quality.performance_impact_estimate);
-                IOLog("                  Register Features: renaming=%s, forwarding=%s, caller_opt=%s, callee_opt=%s\n",
+                VMLOG_DEBUG("                  Register Features: renaming=%s, forwarding=%s, caller_opt=%s, callee_opt=%s\n",
                       assignment_system.register_classes.supports_register_renaming ? "YES" : "NO",
                       assignment_system.register_classes.supports_register_forwarding ? "YES" : "NO",
                       uses_caller_saved_optimization ? "YES" : "NO",
                       uses_callee_saved_optimization ? "YES" : "NO");
                 
                 if (spill_locations_created == 0) {
-                    IOLog("                  No spill code generation required - optimal register allocation achieved\n");
+                    VMLOG_DEBUG("                  No spill code generation required - optimal register allocation achieved\n");
                 } else {
-                    IOLog("                  Spill code generation completed with %d locations and %.1f%% efficiency\n",
+                    VMLOG_DEBUG("                  Spill code generation completed with %d locations and %.1f%% efficiency\n",
                           spill_locations_created, assignment_system.spill_generation.spill_code_efficiency);
                 }
                 
                 // Phase 6.4 Summary and Final Performance Assessment
-                IOLog("            Phase 6.4 Register Assignment Summary:\n");
-                IOLog("              Total Register Classes: %d configured with advanced features\n",
+                VMLOG_DEBUG("            Phase 6.4 Register Assignment Summary:\n");
+                VMLOG_DEBUG("              Total Register Classes: %d configured with advanced features\n",
                       (assignment_system.register_classes.general_purpose_registers > 0 ? 1 : 0) +
                       (assignment_system.register_classes.vector_registers > 0 ? 1 : 0) +
                       (assignment_system.register_classes.predicate_registers > 0 ? 1 : 0) +
                       (assignment_system.register_classes.special_purpose_registers > 0 ? 1 : 0));
-                IOLog("              Assignment Strategy: Algorithm %d, Quality %.1f%%, Target Met: %s\n",
+                VMLOG_DEBUG("              Assignment Strategy: Algorithm %d, Quality %.1f%%, Target Met: %s\n",
                       assignment_system.strategy.assignment_algorithm,
                       assignment_system.quality.overall_assignment_quality,
                       assignment_system.quality.meets_quality_target ? "YES" : "NO");
-                IOLog("              Performance Impact: %.1f%% overhead from conflicts and spills\n",
+                VMLOG_DEBUG("              Performance Impact: %.1f%% overhead from conflicts and spills\n",
                       assignment_system.quality.performance_impact_estimate);
-                IOLog("              Advanced Features: Renaming=%s, Forwarding=%s, Pairs=%s, Windows=%s\n",
+                VMLOG_DEBUG("              Advanced Features: Renaming=%s, Forwarding=%s, Pairs=%s, Windows=%s\n",
                       assignment_system.register_classes.supports_register_renaming ? "YES" : "NO",
                       assignment_system.register_classes.supports_register_forwarding ? "YES" : "NO",
                       uses_register_pairs ? "YES" : "NO",
@@ -13921,17 +12895,17 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 // Phase 6 Register Allocation Summary
                 float total_register_allocation_time = 15.5f; // Estimated comprehensive time
                 
-                IOLog("          Phase 6 Register Allocation Complete - Total Time: %.3f ms\n", total_register_allocation_time);
-                IOLog("            Architecture Analysis: %s, %d banks detected\n",
+                VMLOG_DEBUG("          Phase 6 Register Allocation Complete - Total Time: %.3f ms\n", total_register_allocation_time);
+                VMLOG_DEBUG("            Architecture Analysis: %s, %d banks detected\n",
                       supports_register_renaming ? "ADVANCED" : "STANDARD", register_file_banks);
-                IOLog("            Interference Graph: %u%% density, chromatic estimate: %d\n",
+                VMLOG_DEBUG("            Interference Graph: %u%% density, chromatic estimate: %d\n",
                       interference_graph_density, chromatic_number_estimate);
-                IOLog("            Algorithm Selection: Chaitin-Briggs with optimistic coloring\n");
-                IOLog("            Final Assignment: %d total registers (%.1f%% utilization), %d spilled\n",
+                VMLOG_DEBUG("            Algorithm Selection: Chaitin-Briggs with optimistic coloring\n");
+                VMLOG_DEBUG("            Final Assignment: %d total registers (%.1f%% utilization), %d spilled\n",
                       compilation.register_allocation.allocated_registers,
                       compilation.register_allocation.register_utilization_percent,
                       compilation.register_allocation.spilled_variables);
-                IOLog("            Overall Quality: %.1f%% (target: %.1f%%), Performance Impact: %.1f%%\n",
+                VMLOG_DEBUG("            Overall Quality: %.1f%% (target: %.1f%%), Performance Impact: %.1f%%\n",
                       assignment_system.quality.overall_assignment_quality,
                       assignment_system.strategy.assignment_quality_target,
                       assignment_system.quality.performance_impact_estimate);
@@ -13939,20 +12913,20 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             }  // End of Phase 6 Register Allocation
             
             // Phase 6 Complete - Register allocation finished successfully
-            IOLog("          Phase 6 Register Allocation: COMPLETED SUCCESSFULLY\n");
-            IOLog("            Comprehensive register allocation system implemented with 4 sub-phases\n");
-            IOLog("            Architecture analysis, interference graphs, Chaitin-Briggs algorithm, and assignment complete\n");
+            VMLOG_DEBUG("          Phase 6 Register Allocation: COMPLETED SUCCESSFULLY\n");
+            VMLOG_DEBUG("            Comprehensive register allocation system implemented with 4 sub-phases\n");
+            VMLOG_DEBUG("            Architecture analysis, interference graphs, Chaitin-Briggs algorithm, and assignment complete\n");
             
             float register_phase_time = 15.0f; // Estimated phase time
-            IOLog("            Register allocation phase timing: %.3f ms\n", register_phase_time);
+            VMLOG_DEBUG("            Register allocation phase timing: %.3f ms\n", register_phase_time);
                 
                 // Phase 7: Comprehensive Binary Generation and Final Optimization System
-                IOLog("        Phase 7: Professional Binary Generation with Real-time Analysis\n");
+                VMLOG_DEBUG("        Phase 7: Professional Binary Generation with Real-time Analysis\n");
                 
                 uint64_t binary_start = mach_absolute_time();
                 
                 // Phase 7.1: Instruction Encoding and Binary Format Generation
-                IOLog("          Phase 7.1: Instruction encoding and format generation\n");
+                VMLOG_DEBUG("          Phase 7.1: Instruction encoding and format generation\n");
                 uint64_t phase7_1_start = mach_absolute_time();
                 
                 struct InstructionEncodingAnalysis {
@@ -14014,7 +12988,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     // Verify SPIR-V format
                     if (bytecode[0] == 0x03 && bytecode[1] == 0x02 && 
                         bytecode[2] == 0x23 && bytecode[3] == 0x07) {
-                        IOLog("            Analyzing SPIR-V bytecode for instruction encoding\n");
+                        VMLOG_DEBUG("            Analyzing SPIR-V bytecode for instruction encoding\n");
                         
                         uint32_t* spv_data = (uint32_t*)bytecode;
                         uint32_t instruction_offset = 5; // Skip SPIR-V header
@@ -14101,21 +13075,21 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         encoding_analysis.binary_format.position_independent_code = true;
                         encoding_analysis.binary_format.cache_line_optimization_level = 95;
                         
-                        IOLog("            SPIR-V Instruction Analysis Complete:\n");
-                        IOLog("              Total Instructions: %d, Complex: %d, Simple: %d\n",
+                        VMLOG_DEBUG("            SPIR-V Instruction Analysis Complete:\n");
+                        VMLOG_DEBUG("              Total Instructions: %d, Complex: %d, Simple: %d\n",
                               encoding_analysis.encoding_stats.total_instructions_encoded,
                               encoding_analysis.encoding_stats.complex_instructions_count,
                               encoding_analysis.encoding_stats.simple_instructions_count);
-                        IOLog("              Vectorized: %d, Memory Access: %d, Control Flow: %d\n",
+                        VMLOG_DEBUG("              Vectorized: %d, Memory Access: %d, Control Flow: %d\n",
                               encoding_analysis.encoding_stats.vectorized_instructions_count,
                               encoding_analysis.encoding_stats.memory_access_instructions,
                               encoding_analysis.encoding_stats.control_flow_instructions);
-                        IOLog("              Avg Complexity: %.1f, Encoding Efficiency: %d%%\n",
+                        VMLOG_DEBUG("              Avg Complexity: %.1f, Encoding Efficiency: %d%%\n",
                               encoding_analysis.encoding_stats.average_instruction_complexity,
                               encoding_analysis.encoding_stats.encoding_efficiency_percent);
                     } else {
                         // Fallback analysis for non-SPIR-V bytecode
-                        IOLog("            Non-SPIR-V bytecode detected, using estimation\n");
+                        VMLOG_DEBUG("            Non-SPIR-V bytecode detected, using estimation\n");
                         encoding_analysis.encoding_stats.total_instructions_encoded = shader_size / 4;
                         encoding_analysis.encoding_stats.simple_instructions_count = 
                             encoding_analysis.encoding_stats.total_instructions_encoded * 0.7f;
@@ -14132,7 +13106,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     }
                 } else {
                     // No shader data available, use fallback analysis
-                    IOLog("            Using fallback analysis for instruction encoding\n");
+                    VMLOG_DEBUG("            Using fallback analysis for instruction encoding\n");
                     encoding_analysis.encoding_stats.total_instructions_encoded = 1000; // Fallback estimate
                     encoding_analysis.encoding_stats.simple_instructions_count = 
                         encoding_analysis.encoding_stats.total_instructions_encoded * 0.75f;
@@ -14151,7 +13125,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 float phase7_1_time = (float)(phase7_1_end - phase7_1_start) / 1000000.0f;
                 
                 // Phase 7.2: Symbol Resolution and Relocation Table Generation
-                IOLog("          Phase 7.2: Symbol resolution and relocation generation\n");
+                VMLOG_DEBUG("          Phase 7.2: Symbol resolution and relocation generation\n");
                 uint64_t phase7_2_start = mach_absolute_time();
                 
                 struct SymbolResolutionSystem {
@@ -14195,7 +13169,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 } symbol_system = {0};
                 
                 // Generate symbols from compilation analysis
-                IOLog("            Generating symbol table from fallback analysis\n");
+                VMLOG_DEBUG("            Generating symbol table from fallback analysis\n");
                 
                 // Add function symbols - using fallback values
                 for (uint32_t i = 0; i < 8 && // Fallback function count
@@ -14232,7 +13206,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 // Generate relocation entries
-                IOLog("            Generating relocation entries\n");
+                VMLOG_DEBUG("            Generating relocation entries\n");
                 
                 for (uint32_t i = 0; i < symbol_system.symbol_count && 
                      symbol_system.relocation_count < 64; i++) {
@@ -14283,16 +13257,16 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 uint64_t phase7_2_end = mach_absolute_time();
                 float phase7_2_time = (float)(phase7_2_end - phase7_2_start) / 1000000.0f;
                 
-                IOLog("            Symbol Resolution Complete:\n");
-                IOLog("              Symbols: %d total, %d resolved, %d external\n",
+                VMLOG_DEBUG("            Symbol Resolution Complete:\n");
+                VMLOG_DEBUG("              Symbols: %d total, %d resolved, %d external\n",
                       symbol_system.symbol_count, symbol_system.resolution_stats.symbols_resolved,
                       symbol_system.resolution_stats.external_references);
-                IOLog("              Relocations: %d entries, Success Rate: %.1f%%\n",
+                VMLOG_DEBUG("              Relocations: %d entries, Success Rate: %.1f%%\n",
                       symbol_system.relocation_count,
                       symbol_system.resolution_stats.symbol_resolution_success_rate);
                 
                 // Phase 7.3: Debug Information and Metadata Generation
-                IOLog("          Phase 7.3: Debug information and metadata generation\n");
+                VMLOG_DEBUG("          Phase 7.3: Debug information and metadata generation\n");
                 uint64_t phase7_3_start = mach_absolute_time();
                 
                 struct DebugMetadataSystem {
@@ -14342,7 +13316,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 } debug_metadata = {0};
                 
                 // Generate debug information
-                IOLog("            Generating comprehensive debug information\n");
+                VMLOG_DEBUG("            Generating comprehensive debug information\n");
                 
                 debug_metadata.debug_info.line_number_entries = 50; // Fallback estimate
                 debug_metadata.debug_info.variable_debug_entries = 12; // Fallback estimate
@@ -14358,7 +13332,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 debug_metadata.debug_info.debug_compression_ratio = 75; // 75% compression
                 
                 // Generate shader metadata
-                IOLog("            Generating shader metadata\n");
+                VMLOG_DEBUG("            Generating shader metadata\n");
                 
                 strlcpy(debug_metadata.metadata.shader_version, "GLSL 4.60", 32);
                 strlcpy(debug_metadata.metadata.compiler_version, "VMQemuVGA-v4.0.0", 32);
@@ -14376,7 +13350,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 debug_metadata.metadata.estimated_performance_impact = 0.85f; // Fallback performance impact
                 
                 // Generate profiling metadata
-                IOLog("            Generating profiling and analytics metadata\n");
+                VMLOG_DEBUG("            Generating profiling and analytics metadata\n");
                 
                 debug_metadata.profiling.compilation_stage_count = 7;
                 for (uint32_t i = 0; i < 7; i++) {
@@ -14400,17 +13374,17 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 uint64_t phase7_3_end = mach_absolute_time();
                 float phase7_3_time = (float)(phase7_3_end - phase7_3_start) / 1000000.0f;
                 
-                IOLog("            Debug and Metadata Generation Complete:\n");
-                IOLog("              Debug Entries: %d lines, %d variables, %d functions\n",
+                VMLOG_DEBUG("            Debug and Metadata Generation Complete:\n");
+                VMLOG_DEBUG("              Debug Entries: %d lines, %d variables, %d functions\n",
                       debug_metadata.debug_info.line_number_entries,
                       debug_metadata.debug_info.variable_debug_entries,
                       debug_metadata.debug_info.function_debug_entries);
-                IOLog("              Metadata: %s, Features: 0x%X\n",
+                VMLOG_DEBUG("              Metadata: %s, Features: 0x%X\n",
                       debug_metadata.metadata.shader_version,
                       debug_metadata.metadata.feature_flags);
                 
                 // Phase 7.4: Binary Optimization and Output Generation
-                IOLog("          Phase 7.4: Binary optimization and final output\n");
+                VMLOG_DEBUG("          Phase 7.4: Binary optimization and final output\n");
                 uint64_t phase7_4_start = mach_absolute_time();
                 
                 struct BinaryOptimizationSystem {
@@ -14457,7 +13431,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 } binary_optimization = {0};
                 
                 // Apply binary optimizations
-                IOLog("            Applying comprehensive binary optimizations\n");
+                VMLOG_DEBUG("            Applying comprehensive binary optimizations\n");
                 
                 // Calculate optimization benefits
                 binary_optimization.optimization.code_compression_ratio = 85; // 15% compression
@@ -14475,7 +13449,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     binary_optimization.optimization.alignment_optimization_savings;
                 
                 // Generate final binary structure
-                IOLog("            Generating final binary structure\n");
+                VMLOG_DEBUG("            Generating final binary structure\n");
                 
                 binary_optimization.final_binary.code_section_final_size = 
                     (encoding_analysis.binary_format.code_section_size * 
@@ -14523,7 +13497,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     binary_optimization.final_binary.total_size_bytes ^ 0xDEADBEEF;
                 
                 // Calculate performance characteristics
-                IOLog("            Calculating binary performance characteristics\n");
+                VMLOG_DEBUG("            Calculating binary performance characteristics\n");
                 
                 binary_optimization.performance.estimated_load_time_ms = 
                     (float)binary_optimization.final_binary.total_size_bytes / 1024.0f * 0.1f; // 0.1ms per KB
@@ -14544,12 +13518,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 uint64_t phase7_4_end = mach_absolute_time();
                 float phase7_4_time = (float)(phase7_4_end - phase7_4_start) / 1000000.0f;
                 
-                IOLog("            Binary Optimization Complete:\n");
-                IOLog("              Final Size: %d bytes (%d KB), Compression: %d%%\n",
+                VMLOG_DEBUG("            Binary Optimization Complete:\n");
+                VMLOG_DEBUG("              Final Size: %d bytes (%d KB), Compression: %d%%\n",
                       binary_optimization.final_binary.total_size_bytes,
                       binary_optimization.performance.memory_footprint_kb,
                       100 - binary_optimization.optimization.code_compression_ratio);
-                IOLog("              Load Time: %.2f ms, Cache Score: %d, CRC32: 0x%X\n",
+                VMLOG_DEBUG("              Load Time: %.2f ms, Cache Score: %d, CRC32: 0x%X\n",
                       binary_optimization.performance.estimated_load_time_ms,
                       binary_optimization.performance.cache_efficiency_score,
                       binary_optimization.final_binary.checksum_crc32);
@@ -14570,17 +13544,17 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 uint64_t binary_end = mach_absolute_time();
                 float total_phase7_time = (float)(binary_end - binary_start) / 1000000.0f;
                 
-                IOLog("          Comprehensive Binary Generation Results:\n");
-                IOLog("            Phase 7.1 (Instruction Encoding): %.2f ms\n", phase7_1_time);
-                IOLog("            Phase 7.2 (Symbol Resolution): %.2f ms\n", phase7_2_time);
-                IOLog("            Phase 7.3 (Debug/Metadata): %.2f ms\n", phase7_3_time);
-                IOLog("            Phase 7.4 (Binary Optimization): %.2f ms\n", phase7_4_time);
-                IOLog("            Total Binary Generation Time: %.2f ms\n", total_phase7_time);
-                IOLog("            Final Binary: %d bytes, %d symbols, %d relocations\n",
+                VMLOG_DEBUG("          Comprehensive Binary Generation Results:\n");
+                VMLOG_DEBUG("            Phase 7.1 (Instruction Encoding): %.2f ms\n", phase7_1_time);
+                VMLOG_DEBUG("            Phase 7.2 (Symbol Resolution): %.2f ms\n", phase7_2_time);
+                VMLOG_DEBUG("            Phase 7.3 (Debug/Metadata): %.2f ms\n", phase7_3_time);
+                VMLOG_DEBUG("            Phase 7.4 (Binary Optimization): %.2f ms\n", phase7_4_time);
+                VMLOG_DEBUG("            Total Binary Generation Time: %.2f ms\n", total_phase7_time);
+                VMLOG_DEBUG("            Final Binary: %d bytes, %d symbols, %d relocations\n",
                       binary_optimization.final_binary.total_size_bytes,
                       symbol_system.symbol_count,
                       symbol_system.relocation_count);
-                IOLog("            Optimization: %.1f%% compression, %s PIC support\n",
+                VMLOG_DEBUG("            Optimization: %.1f%% compression, %s PIC support\n",
                       (100.0f - binary_optimization.optimization.code_compression_ratio),
                       binary_optimization.final_binary.is_position_independent ? "with" : "without");
                 
@@ -14592,22 +13566,22 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 float total_compilation_time = total_phase7_time + 45.0f; // Estimated previous phases
                 
                 // Comprehensive compilation report
-                IOLog("        GPU Driver Compilation Summary:\n");
-                IOLog("          Total Stages: %d completed successfully\n", 7);
-                IOLog("          Total Compilation Time: %.2f ms\n", total_compilation_time);
-                IOLog("          Stage Breakdown:\n");
-                IOLog("            Source Analysis: %.2f ms\n", 3.5f);
-                IOLog("            AST Generation: %.2f ms\n", 4.2f);
-                IOLog("            Semantic Analysis: %.2f ms\n", 6.8f);
-                IOLog("            Optimization: %.2f ms\n", 8.5f);
-                IOLog("            ISA Generation: %.2f ms\n", 7.3f);
-                IOLog("            Register Allocation: %.2f ms\n", 15.5f);
-                IOLog("            Binary Generation: %.2f ms\n", total_phase7_time);
-                IOLog("          Optimization Effectiveness:\n");
-                IOLog("            Code Size Reduction: %.1u%%\n", 
+                VMLOG_DEBUG("        GPU Driver Compilation Summary:\n");
+                VMLOG_DEBUG("          Total Stages: %d completed successfully\n", 7);
+                VMLOG_DEBUG("          Total Compilation Time: %.2f ms\n", total_compilation_time);
+                VMLOG_DEBUG("          Stage Breakdown:\n");
+                VMLOG_DEBUG("            Source Analysis: %.2f ms\n", 3.5f);
+                VMLOG_DEBUG("            AST Generation: %.2f ms\n", 4.2f);
+                VMLOG_DEBUG("            Semantic Analysis: %.2f ms\n", 6.8f);
+                VMLOG_DEBUG("            Optimization: %.2f ms\n", 8.5f);
+                VMLOG_DEBUG("            ISA Generation: %.2f ms\n", 7.3f);
+                VMLOG_DEBUG("            Register Allocation: %.2f ms\n", 15.5f);
+                VMLOG_DEBUG("            Binary Generation: %.2f ms\n", total_phase7_time);
+                VMLOG_DEBUG("          Optimization Effectiveness:\n");
+                VMLOG_DEBUG("            Code Size Reduction: %.1u%%\n", 
                       binary_optimization.optimization.binary_size_reduction_percent);
-                IOLog("            Performance Improvement: %.1f%%\n", 12.5f); // Estimated performance improvement
-                IOLog("            Register Utilization: %.1f%%\n", 88.5f); // Estimated register utilization
+                VMLOG_DEBUG("            Performance Improvement: %.1f%%\n", 12.5f); // Estimated performance improvement
+                VMLOG_DEBUG("            Register Utilization: %.1f%%\n", 88.5f); // Estimated register utilization
                 
                 // Update GPU-specific vertex shader optimization
                 struct VertexStageOptimization {
@@ -14630,10 +13604,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 // Vertex stage optimization completed
                 
-                IOLog("  Vertex Stage Optimization Results:\n");
-                IOLog("    Cache Efficiency: %d%%, Register Count: %d\n",
+                VMLOG_DEBUG("  Vertex Stage Optimization Results:\n");
+                VMLOG_DEBUG("    Cache Efficiency: %d%%, Register Count: %d\n",
                       vertex_opt.vertex_cache_optimization, vertex_opt.vertex_shader_register_count);
-                IOLog("    Estimated Throughput: %.1f MVerts/sec\n", vertex_opt.estimated_vertex_throughput_mverts_sec);
+                VMLOG_DEBUG("    Estimated Throughput: %.1f MVerts/sec\n", vertex_opt.estimated_vertex_throughput_mverts_sec);
             }
         }
         
@@ -14641,7 +13615,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         if (validation.has_fragment_shader) {
             CompiledShader* fragment_shader = findShader(validation.fragment_shader_id);
             if (fragment_shader && fragment_shader->bytecode) {
-                IOLog("VMShaderManager::linkProgram: Compiling fragment stage for GPU execution\n");
+                VMLOG_DEBUG("VMShaderManager::linkProgram: Compiling fragment stage for GPU execution\n");
                 
                 // GPU-specific fragment shader optimization
                 struct FragmentStageOptimization {
@@ -14666,10 +13640,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 // Fragment stage optimization completed
                 
-                IOLog("  Fragment Stage Optimization Results:\n");
-                IOLog("    Pixel Throughput: %d%%, Texture Cache: %d%%\n",
+                VMLOG_DEBUG("  Fragment Stage Optimization Results:\n");
+                VMLOG_DEBUG("    Pixel Throughput: %d%%, Texture Cache: %d%%\n",
                       fragment_opt.pixel_throughput_optimization, fragment_opt.texture_cache_efficiency);
-                IOLog("    Early-Z: %s, Estimated Fillrate: %.1f GPixels/sec\n",
+                VMLOG_DEBUG("    Early-Z: %s, Estimated Fillrate: %.1f GPixels/sec\n",
                       fragment_opt.early_depth_test_enabled ? "ENABLED" : "DISABLED",
                       fragment_opt.estimated_pixel_fillrate_gpixels_sec);
             }
@@ -14679,7 +13653,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         if (validation.has_geometry_shader) {
             CompiledShader* geometry_shader = findShader(validation.geometry_shader_id);
             if (geometry_shader && geometry_shader->bytecode) {
-                IOLog("VMShaderManager::linkProgram: Compiling geometry stage for GPU execution\n");
+                VMLOG_DEBUG("VMShaderManager::linkProgram: Compiling geometry stage for GPU execution\n");
                 
                 struct GeometryStageOptimization {
                     uint32_t geometry_throughput_optimization;
@@ -14699,10 +13673,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 
                 // Geometry stage optimization completed
                 
-                IOLog("  Geometry Stage Optimization Results:\n");
-                IOLog("    Max Output Vertices: %d, Invocations: %d\n",
+                VMLOG_DEBUG("  Geometry Stage Optimization Results:\n");
+                VMLOG_DEBUG("    Max Output Vertices: %d, Invocations: %d\n",
                       geometry_opt.max_output_vertices, geometry_opt.invocation_count);
-                IOLog("    Estimated Throughput: %.1f MPrimitives/sec\n",
+                VMLOG_DEBUG("    Estimated Throughput: %.1f MPrimitives/sec\n",
                       geometry_opt.estimated_geometry_throughput_mprimitives_sec);
             }
         }
@@ -14712,11 +13686,11 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         // Use estimated compilation time in kernel context
         float total_compilation_time_ms = 65.0f; // Estimated compilation time
         
-        IOLog("VMShaderManager::linkProgram: Estimated compilation time: %.2f ms (marked at %llu)\n", 
+        VMLOG_DEBUG("VMShaderManager::linkProgram: Estimated compilation time: %.2f ms (marked at %llu)\n", 
               total_compilation_time_ms, compilation_end);
         
         // Phase 7B: Symbol Resolution Between Shader Stages
-        IOLog("VMShaderManager::linkProgram: Phase 7B - Inter-Stage Symbol Resolution\n");
+        VMLOG_DEBUG("VMShaderManager::linkProgram: Phase 7B - Inter-Stage Symbol Resolution\n");
         
         struct SymbolResolution {
             uint32_t vertex_outputs_resolved;
@@ -14738,10 +13712,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             CompiledShader* fragment_shader = findShader(validation.fragment_shader_id);
             
             if (vertex_shader && fragment_shader) {
-                IOLog("VMShaderManager::linkProgram: Resolving vertex->fragment interface\n");
+                VMLOG_DEBUG("VMShaderManager::linkProgram: Resolving vertex->fragment interface\n");
                 
                 // Advanced Shader Symbol Resolution and Interface Matching System
-                IOLog("    Performing comprehensive bytecode analysis for symbol resolution\n");
+                VMLOG_DEBUG("    Performing comprehensive bytecode analysis for symbol resolution\n");
                 
                 struct AdvancedSymbolResolution {
                     // Vertex shader output analysis
@@ -14817,7 +13791,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 } advanced_resolution = {0};
                 
                 // Phase 1: Extract vertex shader output symbols
-                IOLog("    Phase 1: Extracting vertex shader output symbols\n");
+                VMLOG_DEBUG("    Phase 1: Extracting vertex shader output symbols\n");
                 
                 if (vertex_shader->bytecode && vertex_shader->bytecode->getLength() > 0) {
                     const uint8_t* v_bytecode = (const uint8_t*)vertex_shader->bytecode->getBytesNoCopy();
@@ -14827,7 +13801,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     if (v_size >= 20 && v_bytecode[0] == 0x03 && v_bytecode[1] == 0x02 && 
                         v_bytecode[2] == 0x23 && v_bytecode[3] == 0x07) {
                         // SPIR-V bytecode analysis
-                        IOLog("      Analyzing SPIR-V vertex shader for output symbols\n");
+                        VMLOG_DEBUG("      Analyzing SPIR-V vertex shader for output symbols\n");
                         
                         uint32_t* spv_data = (uint32_t*)v_bytecode;
                         uint32_t instruction_offset = 5; // Skip header
@@ -14927,10 +13901,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                             advanced_resolution.vertex_outputs[i].semantic_hash = hash;
                         }
                         
-                        IOLog("        SPIR-V Analysis: %d output variables extracted\n", spirv_output_count);
+                        VMLOG_DEBUG("        SPIR-V Analysis: %d output variables extracted\n", spirv_output_count);
                     } else {
                         // Text-based shader analysis (GLSL/MSL/HLSL)
-                        IOLog("      Analyzing text-based vertex shader for output symbols\n");
+                        VMLOG_DEBUG("      Analyzing text-based vertex shader for output symbols\n");
                         
                         const char* v_source = (const char*)v_bytecode;
                         uint32_t v_source_size = (uint32_t)((v_size < UINT32_MAX) ? v_size : UINT32_MAX);
@@ -15043,10 +14017,10 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         }
                         
                         advanced_resolution.vertex_output_count = output_index;
-                        IOLog("        Text Analysis: %d output variables extracted\n", output_index);
+                        VMLOG_DEBUG("        Text Analysis: %d output variables extracted\n", output_index);
                     }
                 } else {
-                    IOLog("      No vertex shader bytecode available for symbol extraction\n");
+                    VMLOG_DEBUG("      No vertex shader bytecode available for symbol extraction\n");
                     // Use default set of common outputs
                     const char* default_outputs[] = {"v_position", "v_normal", "v_texcoord", "v_color"};
                     const uint32_t default_types[] = {0x8B52, 0x8B51, 0x8B50, 0x8B52};
@@ -15065,7 +14039,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 // Phase 2: Extract fragment shader input symbols
-                IOLog("    Phase 2: Extracting fragment shader input symbols\n");
+                VMLOG_DEBUG("    Phase 2: Extracting fragment shader input symbols\n");
                 
                 if (fragment_shader->bytecode && fragment_shader->bytecode->getLength() > 0) {
                     // Similar analysis for fragment shader inputs
@@ -15093,12 +14067,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         advanced_resolution.fragment_inputs[i].array_size = 
                             advanced_resolution.vertex_outputs[i].array_size;
                     }
-                    IOLog("        Fragment inputs: %d variables expected\n", 
+                    VMLOG_DEBUG("        Fragment inputs: %d variables expected\n", 
                           advanced_resolution.fragment_input_count);
                 }
                 
                 // Phase 3: Symbol matching and validation
-                IOLog("    Phase 3: Performing symbol matching and validation\n");
+                VMLOG_DEBUG("    Phase 3: Performing symbol matching and validation\n");
                 
                 for (uint32_t v_out = 0; v_out < advanced_resolution.vertex_output_count; v_out++) {
                     bool found_match = false;
@@ -15122,7 +14096,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                                     advanced_resolution.vertex_outputs[v_out].is_used_in_fragment = true;
                                     found_match = true;
                                     
-                                    IOLog("        MATCH: %s (type=0x%x, location=%d)\n",
+                                    VMLOG_DEBUG("        MATCH: %s (type=0x%x, location=%d)\n",
                                           advanced_resolution.vertex_outputs[v_out].name,
                                           advanced_resolution.vertex_outputs[v_out].type_id,
                                           advanced_resolution.vertex_outputs[v_out].location);
@@ -15176,29 +14150,29 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                                                       advanced_resolution.matching.missing_fragment_inputs;
                 
                 // Comprehensive symbol resolution report
-                IOLog("    Advanced Symbol Resolution Results:\n");
-                IOLog("      Vertex Outputs: %d extracted, %d used\n",
+                VMLOG_DEBUG("    Advanced Symbol Resolution Results:\n");
+                VMLOG_DEBUG("      Vertex Outputs: %d extracted, %d used\n",
                       advanced_resolution.vertex_output_count,
                       advanced_resolution.matching.successful_matches);
-                IOLog("      Fragment Inputs: %d expected, %d satisfied\n",
+                VMLOG_DEBUG("      Fragment Inputs: %d expected, %d satisfied\n",
                       advanced_resolution.fragment_input_count,
                       advanced_resolution.matching.successful_matches);
-                IOLog("      Matching Statistics:\n");
-                IOLog("        Successful Matches: %d\n", advanced_resolution.matching.successful_matches);
-                IOLog("        Type Mismatches: %d\n", advanced_resolution.matching.type_mismatches);
-                IOLog("        Location Conflicts: %d\n", advanced_resolution.matching.location_conflicts);
-                IOLog("        Missing Inputs: %d\n", advanced_resolution.matching.missing_fragment_inputs);
-                IOLog("        Unused Outputs: %d\n", advanced_resolution.matching.unused_vertex_outputs);
-                IOLog("        Matching Confidence: %.2f\n", advanced_resolution.matching.matching_confidence);
-                IOLog("      Overall Interface Compatibility: %s\n",
+                VMLOG_DEBUG("      Matching Statistics:\n");
+                VMLOG_DEBUG("        Successful Matches: %d\n", advanced_resolution.matching.successful_matches);
+                VMLOG_DEBUG("        Type Mismatches: %d\n", advanced_resolution.matching.type_mismatches);
+                VMLOG_DEBUG("        Location Conflicts: %d\n", advanced_resolution.matching.location_conflicts);
+                VMLOG_DEBUG("        Missing Inputs: %d\n", advanced_resolution.matching.missing_fragment_inputs);
+                VMLOG_DEBUG("        Unused Outputs: %d\n", advanced_resolution.matching.unused_vertex_outputs);
+                VMLOG_DEBUG("        Matching Confidence: %.2f\n", advanced_resolution.matching.matching_confidence);
+                VMLOG_DEBUG("      Overall Interface Compatibility: %s\n",
                       advanced_resolution.matching.overall_compatibility ? "COMPATIBLE" : "INCOMPATIBLE");
                 
                 // Validate interface compatibility for linking decision
                 if (advanced_resolution.matching.overall_compatibility) {
-                    IOLog("  Interface validation: PASSED (%d variables matched)\n",
+                    VMLOG_DEBUG("  Interface validation: PASSED (%d variables matched)\n",
                           symbol_resolution.vertex_outputs_resolved);
                 } else {
-                    IOLog("  Interface validation: FAILED (%d unresolved symbols)\n",
+                    VMLOG_ERROR("  Interface validation: FAILED (%d unresolved symbols)\n",
                           symbol_resolution.unresolved_symbols);
                     link_result = kIOReturnInvalid;
                 }
@@ -15207,7 +14181,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         
         // Resolve geometry shader interfaces if present
         if (validation.has_geometry_shader) {
-            IOLog("VMShaderManager::linkProgram: Resolving geometry shader interfaces\n");
+            VMLOG_DEBUG("VMShaderManager::linkProgram: Resolving geometry shader interfaces\n");
             symbol_resolution.geometry_inputs_resolved = symbol_resolution.vertex_outputs_resolved;
             symbol_resolution.geometry_outputs_resolved = 6; // Geometry can output more primitives
         }
@@ -15217,7 +14191,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         symbol_resolution.symbol_resolution_time_ms = (float)(resolution_end - resolution_start) / 1000000.0f;
         
         // Phase 7C: GPU Resource Allocation and Management
-        IOLog("VMShaderManager::linkProgram: Phase 7C - GPU Resource Allocation\n");
+        VMLOG_DEBUG("VMShaderManager::linkProgram: Phase 7C - GPU Resource Allocation\n");
         
         struct GPUResourceAllocation {
             // Uniform Buffer Objects
@@ -15257,7 +14231,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         gpu_resources.uniform_buffer_alignment = 256; // Common GPU alignment requirement
         
         if (program->all_uniforms && program->all_uniforms->getCount() > 0) {
-            IOLog("VMShaderManager::linkProgram: Allocating uniform buffers\n");
+            VMLOG_DEBUG("VMShaderManager::linkProgram: Allocating uniform buffers\n");
             
             uint32_t current_buffer_size = 0;
             uint32_t current_binding_point = 0;
@@ -15265,23 +14239,29 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             for (unsigned int i = 0; i < program->all_uniforms->getCount(); i++) {
                 VMShaderUniform* uniform = (VMShaderUniform*)program->all_uniforms->getObject(i);
                 if (uniform) {
-                    uint32_t uniform_size = uniform->size * uniform->array_size;
+                    uint32_t elements = uniform->array_size ? uniform->array_size : 1;
+                    uint32_t uniform_size = uniform->size * elements;
                     
-                    // Align uniform to appropriate boundary
-                    uint32_t aligned_size = (uniform_size + 15) & ~15; // 16-byte alignment
+                    // std140 placement; the reflected size is already the array stride
+                    uint32_t alignment, stride;
+                    if (!glsl_reflect_type_layout(uniform->type, elements, &alignment, &stride)) {
+                        alignment = 16;
+                    }
+                    uint32_t offset = (current_buffer_size + alignment - 1) & ~(alignment - 1);
                     
                     // Check if we need a new buffer (common limit: 64KB per buffer)
-                    if (current_buffer_size + aligned_size > 65536) {
+                    if (offset + uniform_size > 65536) {
                         if (gpu_resources.uniform_buffer_count < 16) {
                             gpu_resources.uniform_buffer_binding_points[gpu_resources.uniform_buffer_count] = current_binding_point++;
                             gpu_resources.uniform_buffer_count++;
                             gpu_resources.uniform_buffer_total_size += current_buffer_size;
                             current_buffer_size = 0;
+                            offset = 0;
                         }
                     }
                     
-                    current_buffer_size += aligned_size;
-                    uniform->offset = current_buffer_size - aligned_size;
+                    uniform->offset = offset;
+                    current_buffer_size = offset + uniform_size;
                 }
             }
             
@@ -15292,7 +14272,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 gpu_resources.uniform_buffer_total_size += current_buffer_size;
             }
             
-            IOLog("  Uniform Buffers: %d allocated, Total Size: %d bytes\n",
+            VMLOG_DEBUG("  Uniform Buffers: %d allocated, Total Size: %d bytes\n",
                   gpu_resources.uniform_buffer_count, gpu_resources.uniform_buffer_total_size);
         }
         
@@ -15315,7 +14295,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
             }
             
-            IOLog("  Texture Resources: %d units, %d samplers allocated\n",
+            VMLOG_DEBUG("  Texture Resources: %d units, %d samplers allocated\n",
                   gpu_resources.texture_units_allocated, gpu_resources.sampler_objects_allocated);
         }
         
@@ -15325,7 +14305,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         gpu_resources.vertex_stride_bytes = 0;
         
         if (program->all_attributes) {
-            IOLog("VMShaderManager::linkProgram: Allocating vertex attribute bindings\n");
+            VMLOG_DEBUG("VMShaderManager::linkProgram: Allocating vertex attribute bindings\n");
             
             for (unsigned int i = 0; i < program->all_attributes->getCount(); i++) {
                 VMShaderAttribute* attribute = (VMShaderAttribute*)program->all_attributes->getObject(i);
@@ -15337,13 +14317,13 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             }
             
             gpu_resources.vertex_buffer_bindings = 1; // Single interleaved buffer for now
-            IOLog("  Vertex Attributes: %d attributes, stride: %d bytes\n",
+            VMLOG_DEBUG("  Vertex Attributes: %d attributes, stride: %d bytes\n",
                   gpu_resources.vertex_attribute_count, gpu_resources.vertex_stride_bytes);
         }
         
         // Handle compute shader resource allocation
         if (validation.has_compute_shader) {
-            IOLog("VMShaderManager::linkProgram: Allocating compute shader resources\n");
+            VMLOG_DEBUG("VMShaderManager::linkProgram: Allocating compute shader resources\n");
             
             gpu_resources.compute_work_group_size[0] = 64;  // Default work group size
             gpu_resources.compute_work_group_size[1] = 1;
@@ -15351,7 +14331,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             gpu_resources.shared_memory_size_bytes = 16384; // 16KB shared memory
             gpu_resources.compute_buffer_bindings = 8;      // Storage buffers
             
-            IOLog("  Compute Resources: Work Group [%dx%dx%d], Shared Memory: %d bytes\n",
+            VMLOG_DEBUG("  Compute Resources: Work Group [%dx%dx%d], Shared Memory: %d bytes\n",
                   gpu_resources.compute_work_group_size[0], gpu_resources.compute_work_group_size[1],
                   gpu_resources.compute_work_group_size[2], gpu_resources.shared_memory_size_bytes);
         }
@@ -15364,11 +14344,11 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         gpu_resources.gpu_memory_peak_usage = gpu_resources.gpu_memory_allocated_bytes;
         gpu_resources.memory_allocation_successful = (gpu_resources.gpu_memory_allocated_bytes < 512 * 1024 * 1024); // 512MB limit
         
-        IOLog("  GPU Memory: %lld bytes allocated, Peak: %lld bytes\n",
+        VMLOG_DEBUG("  GPU Memory: %lld bytes allocated, Peak: %lld bytes\n",
               gpu_resources.gpu_memory_allocated_bytes, gpu_resources.gpu_memory_peak_usage);
         
         // Phase 7D: Hardware Resource Limits Validation
-        IOLog("VMShaderManager::linkProgram: Phase 7D - Resource Limits Validation\n");
+        VMLOG_DEBUG("VMShaderManager::linkProgram: Phase 7D - Resource Limits Validation\n");
         
         struct ResourceLimitsValidation {
             // Uniform limits
@@ -15423,21 +14403,21 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                                                 limits_validation.texture_limits_valid;
         
         if (!limits_validation.overall_limits_valid) {
-            IOLog("VMShaderManager::linkProgram: ERROR - Resource limits exceeded\n");
-            IOLog("  Uniforms: %d/%d %s\n", total_uniforms, limits_validation.max_vertex_uniforms,
+            VMLOG_ERROR("VMShaderManager::linkProgram: ERROR - Resource limits exceeded\n");
+            VMLOG_DEBUG("  Uniforms: %d/%d %s\n", total_uniforms, limits_validation.max_vertex_uniforms,
                   limits_validation.uniform_limits_valid ? "OK" : "EXCEEDED");
-            IOLog("  Attributes: %d/%d %s\n", gpu_resources.vertex_attribute_count, limits_validation.max_vertex_attributes,
+            VMLOG_DEBUG("  Attributes: %d/%d %s\n", gpu_resources.vertex_attribute_count, limits_validation.max_vertex_attributes,
                   limits_validation.attribute_limits_valid ? "OK" : "EXCEEDED");
-            IOLog("  Textures: %d/%d %s\n", gpu_resources.texture_units_allocated, limits_validation.max_texture_units,
+            VMLOG_DEBUG("  Textures: %d/%d %s\n", gpu_resources.texture_units_allocated, limits_validation.max_texture_units,
                   limits_validation.texture_limits_valid ? "OK" : "EXCEEDED");
             link_result = kIOReturnNoResources;
         } else {
-            IOLog("  Resource validation: ALL LIMITS OK\n");
+            VMLOG_DEBUG("  Resource validation: ALL LIMITS OK\n");
         }
         
         // Phase 7E: Final GPU Pipeline State Configuration
         if (link_result == kIOReturnSuccess) {
-            IOLog("VMShaderManager::linkProgram: Phase 7E - Pipeline State Configuration\n");
+            VMLOG_DEBUG("VMShaderManager::linkProgram: Phase 7E - Pipeline State Configuration\n");
             
             struct GPUPipelineState {
                 uint32_t pipeline_state_object_id;
@@ -15466,7 +14446,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             uint64_t pso_start = mach_absolute_time();
             
             // Comprehensive GPU Pipeline State Object Creation and Resource Management
-            IOLog("  Creating comprehensive GPU pipeline state object\n");
+            VMLOG_DEBUG("  Creating comprehensive GPU pipeline state object\n");
             
             struct AdvancedPipelineStateConfiguration {
                 // Core Pipeline State Components
@@ -15677,13 +14657,13 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             } pso_config = {0};
             
             // Phase 1: Configure Shader Stages
-            IOLog("    Phase 1: Configuring shader stages for pipeline\n");
+            VMLOG_DEBUG("    Phase 1: Configuring shader stages for pipeline\n");
             
             if (validation.has_vertex_shader) {
                 CompiledShader* vertex_shader = findShader(validation.vertex_shader_id);
                 if (vertex_shader && vertex_shader->bytecode) {
                     // Comprehensive GPU Driver Shader Compilation and Handle Management System
-                    IOLog("        Performing comprehensive GPU driver shader compilation\n");
+                    VMLOG_DEBUG("        Performing comprehensive GPU driver shader compilation\n");
                     
                     uint64_t shader_compilation_start = mach_absolute_time();
                     
@@ -15766,7 +14746,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     } gpu_compilation = {0};
                     
                     // Phase 1: Comprehensive Shader Validation
-                    IOLog("          Phase 1: Comprehensive shader validation\n");
+                    VMLOG_DEBUG("          Phase 1: Comprehensive shader validation\n");
                     
                     // Bytecode integrity validation
                     uint32_t bytecode_size = (uint32_t)vertex_shader->bytecode->getLength();
@@ -15789,16 +14769,16 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     gpu_compilation.validation.compatibility_score = 95; // High compatibility
                     gpu_compilation.validation.requires_driver_workarounds = false;
                     
-                    IOLog("            Bytecode Validation: %s (size: %d bytes, checksum: 0x%08x)\n",
+                    VMLOG_DEBUG("            Bytecode Validation: %s (size: %d bytes, checksum: 0x%08x)\n",
                           gpu_compilation.validation.bytecode_integrity_valid ? "PASSED" : "FAILED",
                           bytecode_size, bytecode_checksum);
-                    IOLog("            Compatibility Analysis: ISA=%s, Resources=%s, Score=%d%%\n",
+                    VMLOG_DEBUG("            Compatibility Analysis: ISA=%s, Resources=%s, Score=%d%%\n",
                           gpu_compilation.validation.instruction_set_compatible ? "OK" : "INCOMPATIBLE",
                           gpu_compilation.validation.resource_requirements_valid ? "OK" : "EXCEEDED",
                           gpu_compilation.validation.compatibility_score);
                     
                     // Phase 2: GPU Architecture Optimization Analysis
-                    IOLog("          Phase 2: GPU architecture optimization analysis\n");
+                    VMLOG_DEBUG("          Phase 2: GPU architecture optimization analysis\n");
                     
                     // Calculate optimization opportunities based on shader characteristics
                     uint32_t estimated_instruction_count = bytecode_size / 8; // Rough estimate: 8 bytes per instruction
@@ -15808,22 +14788,22 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     float optimization_reduction = 0.0f;
                     if (gpu_compilation.architecture.supports_native_fp16 && (bytecode_size % 16) == 0) {
                         optimization_reduction += 0.12f; // 12% reduction with FP16
-                        IOLog("            FP16 Optimization: ENABLED (12%% instruction reduction)\n");
+                        VMLOG_DEBUG("            FP16 Optimization: ENABLED (12%% instruction reduction)\n");
                     }
                     
                     if (gpu_compilation.architecture.supports_subgroup_operations && estimated_instruction_count > 50) {
                         optimization_reduction += 0.08f; // 8% reduction with subgroup ops
-                        IOLog("            Subgroup Operations: ENABLED (8%% instruction reduction)\n");
+                        VMLOG_DEBUG("            Subgroup Operations: ENABLED (8%% instruction reduction)\n");
                     }
                     
                     // Register pressure analysis
                     gpu_compilation.metrics.register_pressure_estimate = 
                         (estimated_instruction_count * 2) / gpu_compilation.architecture.warp_size;
                     if (gpu_compilation.metrics.register_pressure_estimate > 64) {
-                        IOLog("            Register Pressure: HIGH (%d regs/thread, spilling likely)\n",
+                        VMLOG_DEBUG("            Register Pressure: HIGH (%d regs/thread, spilling likely)\n",
                               gpu_compilation.metrics.register_pressure_estimate);
                     } else {
-                        IOLog("            Register Pressure: OPTIMAL (%d regs/thread)\n",
+                        VMLOG_DEBUG("            Register Pressure: OPTIMAL (%d regs/thread)\n",
                               gpu_compilation.metrics.register_pressure_estimate);
                     }
                     
@@ -15837,16 +14817,16 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         (gpu_compilation.metrics.optimized_instruction_count > gpu_compilation.metrics.memory_bandwidth_estimate) ?
                         gpu_compilation.metrics.optimized_instruction_count / gpu_compilation.metrics.memory_bandwidth_estimate : 1;
                     
-                    IOLog("            Optimization Results: %d->%d instructions (%.1f%% reduction)\n",
+                    VMLOG_DEBUG("            Optimization Results: %d->%d instructions (%.1f%% reduction)\n",
                           gpu_compilation.metrics.original_instruction_count,
                           gpu_compilation.metrics.optimized_instruction_count,
                           optimization_reduction * 100.0f);
-                    IOLog("            Performance Metrics: Memory BW=%d, Arithmetic Intensity=%d\n",
+                    VMLOG_DEBUG("            Performance Metrics: Memory BW=%d, Arithmetic Intensity=%d\n",
                           gpu_compilation.metrics.memory_bandwidth_estimate,
                           gpu_compilation.metrics.arithmetic_intensity);
                     
                     // Phase 3: Advanced Handle Allocation with Caching
-                    IOLog("          Phase 3: Advanced handle allocation with caching\n");
+                    VMLOG_DEBUG("          Phase 3: Advanced handle allocation with caching\n");
                     
                     // Generate sophisticated handle with validation
                     gpu_compilation.handle_allocation.base_handle_id = validation.vertex_shader_id + 2000;
@@ -15860,11 +14840,11 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     
                     if (gpu_compilation.handle_allocation.handle_cached) {
                         gpu_compilation.handle_allocation.cache_hit_count = (cache_key % 8) + 1;
-                        IOLog("            Handle Cache: HIT (key=0x%03x, hits=%d)\n",
+                        VMLOG_DEBUG("            Handle Cache: HIT (key=0x%03x, hits=%d)\n",
                               cache_key, gpu_compilation.handle_allocation.cache_hit_count);
                     } else {
                         gpu_compilation.handle_allocation.cache_hit_count = 0;
-                        IOLog("            Handle Cache: MISS (creating new entry, key=0x%03x)\n", cache_key);
+                        VMLOG_DEBUG("            Handle Cache: MISS (creating new entry, key=0x%03x)\n", cache_key);
                     }
                     
                     // Handle capabilities
@@ -15879,18 +14859,18 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     
                     pso_config.shader_stages.vertex_shader_handle = final_handle;
                     
-                    IOLog("            Handle Allocation: 0x%08x (base=%d, gen=%d, key=0x%03x)\n",
+                    VMLOG_DEBUG("            Handle Allocation: 0x%08x (base=%d, gen=%d, key=0x%03x)\n",
                           final_handle,
                           gpu_compilation.handle_allocation.base_handle_id,
                           gpu_compilation.handle_allocation.handle_generation,
                           gpu_compilation.handle_allocation.handle_validation_key);
-                    IOLog("            Handle Features: hot_reload=%s, debugging=%s, refs=%d\n",
+                    VMLOG_DEBUG("            Handle Features: hot_reload=%s, debugging=%s, refs=%d\n",
                           gpu_compilation.handle_allocation.supports_hot_reload ? "YES" : "NO",
                           gpu_compilation.handle_allocation.supports_debugging ? "YES" : "NO",
                           gpu_compilation.handle_allocation.reference_count);
                     
                     // Phase 4: Shader Specialization Analysis
-                    IOLog("          Phase 4: Shader specialization analysis\n");
+                    VMLOG_DEBUG("          Phase 4: Shader specialization analysis\n");
                     
                     // Analyze specialization opportunities
                     gpu_compilation.specialization.specialization_constant_count = 
@@ -15907,19 +14887,19 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                             gpu_compilation.specialization.specialized_variants * 0.5f; // 0.5ms per variant
                         gpu_compilation.specialization.supports_runtime_specialization = true;
                         
-                        IOLog("            Specialization: BENEFICIAL (%d constants, %d variants)\n",
+                        VMLOG_DEBUG("            Specialization: BENEFICIAL (%d constants, %d variants)\n",
                               gpu_compilation.specialization.specialization_constant_count,
                               gpu_compilation.specialization.specialized_variants);
-                        IOLog("            Cache Entries: %d, Compile Time: %.1f ms, Runtime: %s\n",
+                        VMLOG_DEBUG("            Cache Entries: %d, Compile Time: %.1f ms, Runtime: %s\n",
                               gpu_compilation.specialization.specialization_cache_entries,
                               gpu_compilation.specialization.specialization_compile_time,
                               gpu_compilation.specialization.supports_runtime_specialization ? "YES" : "NO");
                     } else {
-                        IOLog("            Specialization: NOT BENEFICIAL (too few constants)\n");
+                        VMLOG_DEBUG("            Specialization: NOT BENEFICIAL (too few constants)\n");
                     }
                     
                     // Phase 5: Performance Analysis and Estimation
-                    IOLog("          Phase 5: Performance analysis and estimation\n");
+                    VMLOG_DEBUG("          Phase 5: Performance analysis and estimation\n");
                     
                     // Control flow complexity analysis
                     gpu_compilation.metrics.branch_complexity_score = (bytecode_size > 1024) ?
@@ -15944,32 +14924,32 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                     gpu_compilation.metrics.compilation_time_ms = 
                         (float)(shader_compilation_end - shader_compilation_start) / 1000000.0f;
                     
-                    IOLog("            Performance Estimation:\n");
-                    IOLog("              Branch Complexity: %d, Texture Ops: %d, Atomics: %d\n",
+                    VMLOG_DEBUG("            Performance Estimation:\n");
+                    VMLOG_DEBUG("              Branch Complexity: %d, Texture Ops: %d, Atomics: %d\n",
                           gpu_compilation.metrics.branch_complexity_score,
                           gpu_compilation.metrics.texture_sampling_operations,
                           gpu_compilation.metrics.atomic_operations_count);
-                    IOLog("              Estimated Cycles: %.1f, Memory Stalls: %.2fx, Branch Penalty: %.2fx\n",
+                    VMLOG_DEBUG("              Estimated Cycles: %.1f, Memory Stalls: %.2fx, Branch Penalty: %.2fx\n",
                           gpu_compilation.metrics.estimated_execution_cycles,
                           memory_stall_factor, branch_penalty_factor);
-                    IOLog("              Driver Compilation Time: %.3f ms\n",
+                    VMLOG_DEBUG("              Driver Compilation Time: %.3f ms\n",
                           gpu_compilation.metrics.compilation_time_ms);
                     
                     // Comprehensive shader compilation summary
-                    IOLog("        GPU Driver Shader Compilation Results:\n");
-                    IOLog("          Vertex Shader Handle: 0x%08x\n", pso_config.shader_stages.vertex_shader_handle);
-                    IOLog("          Bytecode: %d bytes -> %d instructions (%.1f%% optimized)\n",
+                    VMLOG_DEBUG("        GPU Driver Shader Compilation Results:\n");
+                    VMLOG_DEBUG("          Vertex Shader Handle: 0x%08x\n", pso_config.shader_stages.vertex_shader_handle);
+                    VMLOG_DEBUG("          Bytecode: %d bytes -> %d instructions (%.1f%% optimized)\n",
                           bytecode_size, gpu_compilation.metrics.optimized_instruction_count,
                           optimization_reduction * 100.0f);
-                    IOLog("          Validation: %d errors, %d warnings, %d%% compatibility\n",
+                    VMLOG_DEBUG("          Validation: %d errors, %d warnings, %d%% compatibility\n",
                           gpu_compilation.validation.validation_error_count,
                           gpu_compilation.validation.validation_warning_count,
                           gpu_compilation.validation.compatibility_score);
-                    IOLog("          Cache: %s, Specialization: %s, Debug: %s\n",
+                    VMLOG_DEBUG("          Cache: %s, Specialization: %s, Debug: %s\n",
                           gpu_compilation.handle_allocation.handle_cached ? "HIT" : "MISS",
                           gpu_compilation.specialization.benefits_from_specialization ? "ENABLED" : "DISABLED",
                           gpu_compilation.handle_allocation.supports_debugging ? "ENABLED" : "DISABLED");
-                    IOLog("          Performance: %.1f cycles estimated, %d register pressure\n",
+                    VMLOG_DEBUG("          Performance: %.1f cycles estimated, %d register pressure\n",
                           gpu_compilation.metrics.estimated_execution_cycles,
                           gpu_compilation.metrics.register_pressure_estimate);
                 }
@@ -15979,7 +14959,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 CompiledShader* fragment_shader = findShader(validation.fragment_shader_id);
                 if (fragment_shader && fragment_shader->bytecode) {
                     pso_config.shader_stages.fragment_shader_handle = validation.fragment_shader_id + 2000;
-                    IOLog("      Fragment Shader: Handle %d, Bytecode %u bytes\n",
+                    VMLOG_DEBUG("      Fragment Shader: Handle %d, Bytecode %u bytes\n",
                           pso_config.shader_stages.fragment_shader_handle,
                           (uint32_t)fragment_shader->bytecode->getLength());
                 }
@@ -15989,7 +14969,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 CompiledShader* geometry_shader = findShader(validation.geometry_shader_id);
                 if (geometry_shader && geometry_shader->bytecode) {
                     pso_config.shader_stages.geometry_shader_handle = validation.geometry_shader_id + 2000;
-                    IOLog("      Geometry Shader: Handle %d, Bytecode %u bytes\n",
+                    VMLOG_DEBUG("      Geometry Shader: Handle %d, Bytecode %u bytes\n",
                           pso_config.shader_stages.geometry_shader_handle,
                           (uint32_t)geometry_shader->bytecode->getLength());
                 }
@@ -16004,7 +14984,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             pso_config.shader_stages.shader_stages_valid = true;
             
             // Phase 2: Configure Vertex Input State
-            IOLog("    Phase 2: Configuring vertex input state\n");
+            VMLOG_DEBUG("    Phase 2: Configuring vertex input state\n");
             
             if (program->all_attributes && program->all_attributes->getCount() > 0) {
                 pso_config.vertex_input.vertex_binding_count = 1; // Single interleaved buffer
@@ -16032,7 +15012,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                         
                         current_offset += attribute->components * 4; // 4 bytes per float component
                         
-                        IOLog("        Attribute %d: location=%d, format=0x%x, offset=%d, components=%d\n",
+                        VMLOG_DEBUG("        Attribute %d: location=%d, format=0x%x, offset=%d, components=%d\n",
                               i, attribute->location, attribute->type, 
                               pso_config.vertex_input.vertex_attributes[i].offset_bytes, 
                               attribute->components);
@@ -16040,21 +15020,21 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 }
                 
                 pso_config.vertex_input.vertex_input_valid = true;
-                IOLog("      Vertex Input: %d bindings, %d attributes, stride=%d bytes\n",
+                VMLOG_DEBUG("      Vertex Input: %d bindings, %d attributes, stride=%d bytes\n",
                       pso_config.vertex_input.vertex_binding_count,
                       pso_config.vertex_input.vertex_attribute_count,
                       pso_config.vertex_input.vertex_bindings[0].stride_bytes);
             }
             
             // Phase 3: Configure Advanced Rasterization State
-            IOLog("    Phase 3: Configuring advanced rasterization state\n");
+            VMLOG_DEBUG("    Phase 3: Configuring advanced rasterization state\n");
             
             // Check for conservative rasterization capability
             if (m_accelerator && true) { // Conservative raster support check
                 pso_config.rasterization.conservative_raster_enabled = true;
                 pso_config.rasterization.conservative_raster_mode = 1; // Overestimate
                 pso_config.rasterization.extra_primitive_overestimate = 0.5f;
-                IOLog("      Conservative Rasterization: ENABLED (overestimate mode)\n");
+                VMLOG_DEBUG("      Conservative Rasterization: ENABLED (overestimate mode)\n");
             }
             
             // Configure depth bias for shadow mapping if needed
@@ -16065,12 +15045,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 pso_config.rasterization.depth_bias_clamp = 0.01f;
             }
             
-            IOLog("      Rasterization: polygon_mode=0x%x, cull_mode=0x%x, line_width=%.1f\n",
+            VMLOG_DEBUG("      Rasterization: polygon_mode=0x%x, cull_mode=0x%x, line_width=%.1f\n",
                   pso_config.rasterization.polygon_mode, pso_config.rasterization.cull_mode,
                   pso_config.rasterization.line_width);
             
             // Phase 4: Configure Variable Rate Shading (VRS) if supported
-            IOLog("    Phase 4: Configuring variable rate shading\n");
+            VMLOG_DEBUG("    Phase 4: Configuring variable rate shading\n");
             
             if (m_accelerator && false) { // Variable rate shading support check
                 pso_config.multisampling.variable_rate_shading_enabled = true;
@@ -16079,23 +15059,23 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 pso_config.multisampling.vrs_combiners[1] = 0x00; // Replace combiner
                 pso_config.multisampling.vrs_per_draw_enabled = true;
                 
-                IOLog("      Variable Rate Shading: ENABLED (base rate 1x1, per-draw control)\n");
+                VMLOG_DEBUG("      Variable Rate Shading: ENABLED (base rate 1x1, per-draw control)\n");
             } else {
-                IOLog("      Variable Rate Shading: NOT SUPPORTED\n");
+                VMLOG_DEBUG("      Variable Rate Shading: NOT SUPPORTED\n");
             }
             
-            IOLog("      Multisampling: %dx MSAA, sample_shading=%.2f, alpha_to_coverage=%s\n",
+            VMLOG_DEBUG("      Multisampling: %dx MSAA, sample_shading=%.2f, alpha_to_coverage=%s\n",
                   pso_config.multisampling.rasterization_samples,
                   pso_config.multisampling.min_sample_shading,
                   pso_config.multisampling.alpha_to_coverage_enabled ? "ON" : "OFF");
             
             // Phase 5: Configure Advanced Depth-Stencil Operations
-            IOLog("    Phase 5: Configuring advanced depth-stencil state\n");
+            VMLOG_DEBUG("    Phase 5: Configuring advanced depth-stencil state\n");
             
             // Enable early fragment tests for better performance
             if (validation.has_fragment_shader && true) { // Early fragment tests check
                 pso_config.depth_stencil.early_fragment_tests = true;
-                IOLog("      Early Fragment Tests: ENABLED (hardware optimized)\n");
+                VMLOG_DEBUG("      Early Fragment Tests: ENABLED (hardware optimized)\n");
             }
             
             // Configure depth bounds testing if supported
@@ -16105,13 +15085,13 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 pso_config.depth_stencil.max_depth_bounds = 0.9f;
             }
             
-            IOLog("      Depth-Stencil: depth_test=%s, depth_write=%s, compare_op=0x%x\n",
+            VMLOG_DEBUG("      Depth-Stencil: depth_test=%s, depth_write=%s, compare_op=0x%x\n",
                   pso_config.depth_stencil.depth_test_enabled ? "ON" : "OFF",
                   pso_config.depth_stencil.depth_write_enabled ? "ON" : "OFF",
                   pso_config.depth_stencil.depth_compare_op);
             
             // Phase 6: Configure Advanced Blending with Dual-Source Support
-            IOLog("    Phase 6: Configuring advanced color blending\n");
+            VMLOG_DEBUG("    Phase 6: Configuring advanced color blending\n");
             
             // Check for advanced blending modes
             if (m_accelerator) {
@@ -16121,14 +15101,14 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 if (validation.has_fragment_shader) {
                     pso_config.color_blend.attachments[0].src_color_blend_factor = 0x0302; // GL_SRC_ALPHA
                     pso_config.color_blend.attachments[0].dst_color_blend_factor = 0x8589; // GL_SRC1_ALPHA (dual-source)
-                    IOLog("      Advanced Blending: Dual-source alpha blending configured\n");
+                    VMLOG_DEBUG("      Advanced Blending: Dual-source alpha blending configured\n");
                 }
             }
             
             // Configure multiple render targets if needed
             pso_config.color_blend.attachment_count = 1; // Single color attachment for now
             for (uint32_t i = 0; i < pso_config.color_blend.attachment_count; i++) {
-                IOLog("      Color Attachment %d: blend=%s, src=0x%x, dst=0x%x, op=0x%x\n",
+                VMLOG_DEBUG("      Color Attachment %d: blend=%s, src=0x%x, dst=0x%x, op=0x%x\n",
                       i, pso_config.color_blend.attachments[i].blend_enabled ? "ON" : "OFF",
                       pso_config.color_blend.attachments[i].src_color_blend_factor,
                       pso_config.color_blend.attachments[i].dst_color_blend_factor,
@@ -16136,7 +15116,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             }
             
             // Phase 7: Configure Dynamic State for Runtime Flexibility
-            IOLog("    Phase 7: Configuring dynamic state\n");
+            VMLOG_DEBUG("    Phase 7: Configuring dynamic state\n");
             
             uint32_t dynamic_count = 0;
             
@@ -16159,14 +15139,14 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             
             pso_config.dynamic_state.dynamic_state_count = dynamic_count;
             
-            IOLog("      Dynamic States: %d configured (viewport=%s, scissor=%s, depth_bias=%s)\n",
+            VMLOG_DEBUG("      Dynamic States: %d configured (viewport=%s, scissor=%s, depth_bias=%s)\n",
                   dynamic_count,
                   pso_config.dynamic_state.viewport_dynamic ? "Y" : "N",
                   pso_config.dynamic_state.scissor_dynamic ? "Y" : "N",
                   pso_config.dynamic_state.depth_bias_dynamic ? "Y" : "N");
             
             // Phase 8: Pipeline Cache Management and Optimization
-            IOLog("    Phase 8: Managing pipeline cache\n");
+            VMLOG_DEBUG("    Phase 8: Managing pipeline cache\n");
             
             // Check if this pipeline configuration exists in cache
             pso_config.pipeline_cache.cache_handle = (pipeline_hash % 1024) + 3000; // Simulated cache handle
@@ -16176,14 +15156,14 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
                 pso_config.pipeline_cache.cache_size_bytes = 2048 * 1024; // 2MB cache
                 pso_config.pipeline_cache.cached_pipeline_count = 127;
                 pso_config.pipeline_cache.cache_hit_ratio = 0.67f;
-                IOLog("      Pipeline Cache: HIT (handle=%d, size=2MB, hit_ratio=%.2f)\n",
+                VMLOG_DEBUG("      Pipeline Cache: HIT (handle=%d, size=2MB, hit_ratio=%.2f)\n",
                       pso_config.pipeline_cache.cache_handle,
                       pso_config.pipeline_cache.cache_hit_ratio);
             } else {
                 pso_config.pipeline_cache.cache_size_bytes = 1024 * 1024; // 1MB cache
                 pso_config.pipeline_cache.cached_pipeline_count = 64;
                 pso_config.pipeline_cache.cache_hit_ratio = 0.45f;
-                IOLog("      Pipeline Cache: MISS (creating new entry, handle=%d)\n",
+                VMLOG_DEBUG("      Pipeline Cache: MISS (creating new entry, handle=%d)\n",
                       pso_config.pipeline_cache.cache_handle);
             }
             
@@ -16198,12 +15178,12 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             bool supports_vrs = pso_config.multisampling.variable_rate_shading_enabled;
             bool supports_conservative_raster = pso_config.rasterization.conservative_raster_enabled;
             
-            IOLog("      GPU Pipeline State Object Creation: SUCCESS\n");
-            IOLog("        PSO ID: %d, Pipeline Hash: 0x%08x\n",
+            VMLOG_DEBUG("      GPU Pipeline State Object Creation: SUCCESS\n");
+            VMLOG_DEBUG("        PSO ID: %d, Pipeline Hash: 0x%08x\n",
                   program->gpu_program_id, final_pipeline_hash);
-            IOLog("        Cache Handle: %d, Dynamic States: %d\n",
+            VMLOG_DEBUG("        Cache Handle: %d, Dynamic States: %d\n",
                   cache_handle, pso_config.dynamic_state.dynamic_state_count);
-            IOLog("        Advanced Features: VRS=%s, Conservative=%s, Early-Z=%s\n",
+            VMLOG_DEBUG("        Advanced Features: VRS=%s, Conservative=%s, Early-Z=%s\n",
                   supports_vrs ? "ON" : "OFF",
                   supports_conservative_raster ? "ON" : "OFF",
                   pso_config.depth_stencil.early_fragment_tests ? "ON" : "OFF");
@@ -16212,9 +15192,9 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             // Simplified timing calculation for kernel context
             pipeline_state.pipeline_creation_time_ms = (float)(pso_end - pso_start) / 1000000.0f;
             
-            IOLog("  Pipeline State Object: ID %d created in %.2f ms\n",
+            VMLOG_DEBUG("  Pipeline State Object: ID %d created in %.2f ms\n",
                   pipeline_state.pipeline_state_object_id, pipeline_state.pipeline_creation_time_ms);
-            IOLog("  Render State: Depth=%s, Stencil=%s, Blend=%s, MSAA=%dx\n",
+            VMLOG_DEBUG("  Render State: Depth=%s, Stencil=%s, Blend=%s, MSAA=%dx\n",
                   pipeline_state.depth_test_enabled ? "ON" : "OFF",
                   pipeline_state.stencil_test_enabled ? "ON" : "OFF",
                   pipeline_state.blending_enabled ? "ON" : "OFF",
@@ -16224,35 +15204,35 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
         program->hardware_optimized = (link_result == kIOReturnSuccess);
         
         // Comprehensive hardware linking report
-        IOLog("VMShaderManager: ========== Hardware Linking Report ==========\n");
-        IOLog("  Compilation Results:\n");
-        IOLog("    Stages Optimized: V:%s F:%s G:%s\n",
+        VMLOG_DEBUG("VMShaderManager: ========== Hardware Linking Report ==========\n");
+        VMLOG_DEBUG("  Compilation Results:\n");
+        VMLOG_DEBUG("    Stages Optimized: V:%s F:%s G:%s\n",
               validation.has_vertex_shader ? "Y" : "N",
               validation.has_fragment_shader ? "Y" : "N",
               validation.has_geometry_shader ? "Y" : "N");
-        IOLog("    Instructions: %d, Compilation Time: %.2f ms\n",
+        VMLOG_DEBUG("    Instructions: %d, Compilation Time: %.2f ms\n",
               756, // Estimated total instruction count
               65.0f); // Use fixed value instead of total_compilation_time_ms
-        IOLog("  Symbol Resolution:\n");
-        IOLog("    Interface Valid: %s, Unresolved: %d\n",
+        VMLOG_DEBUG("  Symbol Resolution:\n");
+        VMLOG_DEBUG("    Interface Valid: %s, Unresolved: %d\n",
               symbol_resolution.interface_validation_passed ? "YES" : "NO",
               symbol_resolution.unresolved_symbols);
-        IOLog("    Resolution Time: %.2f ms\n", symbol_resolution.symbol_resolution_time_ms);
-        IOLog("  Resource Allocation:\n");
-        IOLog("    Uniform Buffers: %d (%d bytes)\n",
+        VMLOG_DEBUG("    Resolution Time: %.2f ms\n", symbol_resolution.symbol_resolution_time_ms);
+        VMLOG_DEBUG("  Resource Allocation:\n");
+        VMLOG_DEBUG("    Uniform Buffers: %d (%d bytes)\n",
               gpu_resources.uniform_buffer_count, gpu_resources.uniform_buffer_total_size);
-        IOLog("    Texture Units: %d, Attributes: %d\n",
+        VMLOG_DEBUG("    Texture Units: %d, Attributes: %d\n",
               gpu_resources.texture_units_allocated, gpu_resources.vertex_attribute_count);
-        IOLog("    GPU Memory: %lld bytes\n", gpu_resources.gpu_memory_allocated_bytes);
-        IOLog("  Limits Validation: %s\n", limits_validation.overall_limits_valid ? "PASSED" : "FAILED");
-        IOLog("==============================================================\n");
+        VMLOG_DEBUG("    GPU Memory: %lld bytes\n", gpu_resources.gpu_memory_allocated_bytes);
+        VMLOG_DEBUG("  Limits Validation: %s\n", limits_validation.overall_limits_valid ? "PASSED" : "FAILED");
+        VMLOG_DEBUG("==============================================================\n");
         
         // End of hardware acceleration block
     }
     
     // Software fallback path  
     if (!m_accelerator) {
-        IOLog("VMShaderManager::linkProgram: Performing software pipeline linking\n");
+        VMLOG_DEBUG("VMShaderManager::linkProgram: Performing software pipeline linking\n");
         if (program) {
             program->hardware_optimized = false;
         }
@@ -16275,10 +15255,19 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
             }
         }
         
-        IOLog("VMShaderManager::linkProgram: Program %d linked successfully\n", program_id);
+        // Lay out the uniform block and name index for setUniform/flushUniforms
+        if (buildUniformBlock(program) != kIOReturnSuccess) {
+            VMLOG_WARN("VMShaderManager::linkProgram: WARNING - No uniform block for program %d\n", program_id);
+        }
+        
+        if (have_link_key) {
+            storeProgramCache(link_key, program);
+        }
+        
+        VMLOG_DEBUG("VMShaderManager::linkProgram: Program %d linked successfully\n", program_id);
     } else {
         program->is_linked = false;
-        IOLog("VMShaderManager::linkProgram: ERROR - Failed to link program %d\n", program_id);
+        VMLOG_ERROR("VMShaderManager::linkProgram: ERROR - Failed to link program %d\n", program_id);
         link_result = kIOReturnError;
     }
     
@@ -16288,7 +15277,7 @@ IOReturn CLASS::linkProgram(uint32_t program_id)
 
 IOReturn CLASS::destroyProgram(uint32_t program_id)
 {
-    IOLog("VMShaderManager::destroyProgram: Destroying shader program %d\n", program_id);
+    VMLOG_DEBUG("VMShaderManager::destroyProgram: Destroying shader program %d\n", program_id);
     
     IOLockLock(m_shader_lock);
     
@@ -16296,12 +15285,12 @@ IOReturn CLASS::destroyProgram(uint32_t program_id)
     ShaderProgram* program = findProgram(program_id);
     if (!program) {
         IOLockUnlock(m_shader_lock);
-        IOLog("VMShaderManager::destroyProgram: ERROR - Program %d not found\n", program_id);
+        VMLOG_ERROR("VMShaderManager::destroyProgram: ERROR - Program %d not found\n", program_id);
         return kIOReturnNotFound;
     }
     
     // Phase 2: Check if program is currently in use
-    IOLog("VMShaderManager::destroyProgram: Phase 2 - Active Usage Check\n");
+    VMLOG_DEBUG("VMShaderManager::destroyProgram: Phase 2 - Active Usage Check\n");
     
     struct ProgramUsageCheck {
         uint32_t active_contexts;
@@ -16330,12 +15319,12 @@ IOReturn CLASS::destroyProgram(uint32_t program_id)
     
     // Phase 3: Forceful unbinding from active contexts (if needed)
     if (usage_check.is_currently_bound) {
-        IOLog("VMShaderManager::destroyProgram: WARNING - Program %d is bound to %d contexts, unbinding\n",
+        VMLOG_WARN("VMShaderManager::destroyProgram: WARNING - Program %d is bound to %d contexts, unbinding\n",
               program_id, usage_check.active_contexts);
         
         for (uint32_t i = 0; i < usage_check.active_contexts; i++) {
             uint32_t context_id = usage_check.context_list[i];
-            IOLog("VMShaderManager::destroyProgram: Unbinding program %d from context %d\n",
+            VMLOG_DEBUG("VMShaderManager::destroyProgram: Unbinding program %d from context %d\n",
                   program_id, context_id);
             
             // Replace with null program (0)
@@ -16352,7 +15341,7 @@ IOReturn CLASS::destroyProgram(uint32_t program_id)
     // Phase 4: Hardware resource deallocation
     IOReturn dealloc_result = kIOReturnSuccess;
     if (m_accelerator && program->hardware_optimized) {
-        IOLog("VMShaderManager::destroyProgram: Phase 4 - Hardware Resource Deallocation\n");
+        VMLOG_DEBUG("VMShaderManager::destroyProgram: Phase 4 - Hardware Resource Deallocation\n");
         
         // In a real implementation, this would:
         // - Deallocate GPU memory for shader bytecode
@@ -16361,11 +15350,11 @@ IOReturn CLASS::destroyProgram(uint32_t program_id)
         // - Clear any cached GPU state
         // - Notify GPU driver of program destruction
         
-        IOLog("VMShaderManager::destroyProgram: Released hardware resources for program %d\n", program_id);
+        VMLOG_DEBUG("VMShaderManager::destroyProgram: Released hardware resources for program %d\n", program_id);
     }
     
     // Phase 5: Reference counting and shader cleanup
-    IOLog("VMShaderManager::destroyProgram: Phase 5 - Shader Reference Management\n");
+    VMLOG_DEBUG("VMShaderManager::destroyProgram: Phase 5 - Shader Reference Management\n");
     
     if (program->shader_ids) {
         for (unsigned int i = 0; i < program->shader_ids->getCount(); i++) {
@@ -16373,28 +15362,18 @@ IOReturn CLASS::destroyProgram(uint32_t program_id)
             if (shader_id_num) {
                 uint32_t shader_id = shader_id_num->unsigned32BitValue();
                 CompiledShader* shader = findShader(shader_id);
-                if (shader) {
-                    // Decrement reference count
-                    if (shader->ref_count > 0) {
-                        shader->ref_count--;
-                        IOLog("VMShaderManager::destroyProgram: Decremented ref count for shader %d (now %d)\n",
-                              shader_id, shader->ref_count);
-                    }
-                    
-                    // Optionally destroy unreferenced shaders
-                    if (shader->ref_count == 0) {
-                        IOLog("VMShaderManager::destroyProgram: Shader %d no longer referenced, eligible for cleanup\n",
-                              shader_id);
-                        // Note: We don't automatically destroy shaders here to avoid side effects
-                        // The user should explicitly call destroyShader() when appropriate
-                    }
+                if (shader && shader->ref_count > 0) {
+                    // Drop the program's reference; unreferenced shaders stay cached until evicted
+                    VMLOG_DEBUG("VMShaderManager::destroyProgram: Releasing shader %d (refs now %d)\n",
+                          shader_id, shader->ref_count - 1);
+                    releaseShaderRef(shader);
                 }
             }
         }
     }
     
     // Phase 6: Memory cleanup and resource release
-    IOLog("VMShaderManager::destroyProgram: Phase 6 - Memory Cleanup\n");
+    VMLOG_DEBUG("VMShaderManager::destroyProgram: Phase 6 - Memory Cleanup\n");
     
     struct ResourceCleanup {
         size_t uniforms_released;
@@ -16404,6 +15383,9 @@ IOReturn CLASS::destroyProgram(uint32_t program_id)
         size_t total_memory_freed;
     } cleanup = {0};
     
+    // Release the uniform block before the uniforms it indexes
+    releaseUniformBlock(program);
+    
     // Release aggregated uniforms
     if (program->all_uniforms) {
         cleanup.uniforms_released = program->all_uniforms->getCount();
@@ -16454,79 +15436,1357 @@ IOReturn CLASS::destroyProgram(uint32_t program_id)
     }
     
     // Phase 7: Remove from program registry
-    for (unsigned int i = 0; i < m_programs->getCount(); i++) {
-        ShaderProgram* p = (ShaderProgram*)m_programs->getObject(i);
-        if (p && p->program_id == program_id) {
-            m_programs->removeObject(i);
-            IOFree(p, sizeof(ShaderProgram));
-            cleanup.total_memory_freed += sizeof(ShaderProgram);
-            break;
-        }
+    if (m_program_table.remove(program_id)) {
+        IOFree(program, sizeof(ShaderProgram));
+        cleanup.total_memory_freed += sizeof(ShaderProgram);
     }
     
     IOLockUnlock(m_shader_lock);
     
     // Phase 8: Comprehensive destruction report
-    IOLog("VMShaderManager: ========== Program Destruction Complete ==========\n");
-    IOLog("  Program ID: %d\n", program_id);
-    IOLog("  Usage Statistics:\n");
-    IOLog("    Total Usage Count: %d\n", usage_check.total_usage_count);
-    IOLog("    Last Used: %lld ticks ago\n", mach_absolute_time() - usage_check.last_usage_time);
-    IOLog("    Was Active: %s (in %d contexts)\n", 
+    VMLOG_DEBUG("VMShaderManager: ========== Program Destruction Complete ==========\n");
+    VMLOG_DEBUG("  Program ID: %d\n", program_id);
+    VMLOG_DEBUG("  Usage Statistics:\n");
+    VMLOG_DEBUG("    Total Usage Count: %d\n", usage_check.total_usage_count);
+    VMLOG_DEBUG("    Last Used: %lld ticks ago\n", mach_absolute_time() - usage_check.last_usage_time);
+    VMLOG_DEBUG("    Was Active: %s (in %d contexts)\n", 
           usage_check.is_currently_bound ? "YES" : "NO", usage_check.active_contexts);
-    IOLog("  Resource Cleanup:\n");
-    IOLog("    Uniforms Released: %zu\n", cleanup.uniforms_released);
-    IOLog("    Attributes Released: %zu\n", cleanup.attributes_released);
-    IOLog("    Resources Released: %zu\n", cleanup.resources_released);
-    IOLog("    Performance Stats: %s (%zu bytes)\n", 
+    VMLOG_DEBUG("  Resource Cleanup:\n");
+    VMLOG_DEBUG("    Uniforms Released: %zu\n", cleanup.uniforms_released);
+    VMLOG_DEBUG("    Attributes Released: %zu\n", cleanup.attributes_released);
+    VMLOG_DEBUG("    Resources Released: %zu\n", cleanup.resources_released);
+    VMLOG_DEBUG("    Performance Stats: %s (%zu bytes)\n", 
           cleanup.performance_stats_size > 0 ? "RELEASED" : "N/A", cleanup.performance_stats_size);
-    IOLog("    Total Memory Freed: %zu bytes\n", cleanup.total_memory_freed);
-    IOLog("  Hardware Resources:\n");
-    IOLog("    Hardware Optimized: %s\n", program->hardware_optimized ? "YES" : "NO");
-    IOLog("    Deallocation Result: %s\n", 
+    VMLOG_DEBUG("    Total Memory Freed: %zu bytes\n", cleanup.total_memory_freed);
+    VMLOG_DEBUG("  Hardware Resources:\n");
+    VMLOG_DEBUG("    Hardware Optimized: %s\n", program->hardware_optimized ? "YES" : "NO");
+    VMLOG_DEBUG("    Deallocation Result: %s\n", 
           dealloc_result == kIOReturnSuccess ? "SUCCESS" : "ERROR");
-    IOLog("  Destruction Result: SUCCESS\n");
-    IOLog("==============================================================\n");
+    VMLOG_DEBUG("  Destruction Result: SUCCESS\n");
+    VMLOG_DEBUG("==============================================================\n");
     
     return kIOReturnSuccess;
 }
 
-// Missing method implementation for symbol resolution
-IOReturn VMShaderManager::setUniform(uint32_t program_id, const char* name, const void* data, size_t size)
+// ============================================================================
+// MARK: - Background Compilation
+// ============================================================================
+
+void CLASS::sCompileWorker(thread_call_param_t param0, thread_call_param_t param1)
 {
-    if (!name || !data || size == 0)
-        return kIOReturnBadArgument;
-        
-    IOLog("VMShaderManager: Setting uniform '%s' for program %d (%zu bytes)\n", name, program_id, size);
-    
-    ShaderProgram* program = findProgram(program_id);
-    if (!program || !program->is_linked) {
-        IOLog("VMShaderManager: Program %d not found or not linked\n", program_id);
-        return kIOReturnNotFound;
-    }
-    
-    // Find uniform in program
-    if (program->all_uniforms) {
-        for (uint32_t i = 0; i < program->all_uniforms->getCount(); i++) {
-            OSData* uniform_data = (OSData*)program->all_uniforms->getObject(i);
-            if (uniform_data) {
-                VMShaderUniform* uniform = (VMShaderUniform*)uniform_data->getBytesNoCopy();
-                if (uniform && strcmp(uniform->name, name) == 0) {
-                    IOLog("VMShaderManager: Found uniform '%s' at location %d\n", name, uniform->location);
-                    
-                    // Submit uniform to VirtIO GPU
-                    if (m_gpu_device) {
-                        IOLog("VMShaderManager: Submitting uniform '%s' to GPU\n", name);
-                        // Implementation would submit uniform data to GPU
-                    }
-                    
-                    IOLog("VMShaderManager: Uniform '%s' set successfully\n", name);
-                    return kIOReturnSuccess;
-                }
-            }
-        }
+    CLASS* self = static_cast<CLASS*>(param0);
+    if (self) {
+        self->runCompileWorker((uint32_t)(uintptr_t)param1);
     }
+}
+
+// Drains the queue, then returns the worker to the idle pool
+void CLASS::runCompileWorker(uint32_t index)
+{
+    IOLockLock(m_shader_lock);
+    while (m_job_head && !m_compile_shutdown) {
+        CompileJob* job = m_job_head;
+        m_job_head = job->next;
+        if (!m_job_head) {
+            m_job_tail = nullptr;
+        }
+        IOLockUnlock(m_shader_lock);
+        
+        if (job->is_link) {
+            runLinkJob(job);
+        } else {
+            runCompileJob(job);
+        }
+        freeCompileJob(job);
+        
+        IOLockLock(m_shader_lock);
+    }
+    m_compile_worker_running[index] = false;
+    m_compile_workers_running--;
+    IOLockWakeup(m_shader_lock, &m_jobs_completed, false);
+    IOLockUnlock(m_shader_lock);
+}
+
+// Appends the job and starts an idle worker for it. Returns false when
+// there are no workers; the caller then runs the job itself.
+bool CLASS::queueCompileJob(CompileJob* job)
+{
+    if (m_compile_worker_count == 0 || m_compile_shutdown) {
+        return false;
+    }
+    
+    job->next = nullptr;
+    if (m_job_tail) {
+        m_job_tail->next = job;
+    } else {
+        m_job_head = job;
+    }
+    m_job_tail = job;
+    
+    // A running worker rechecks the queue under the lock before it goes
+    // idle, so only start one when some are idle
+    for (uint32_t i = 0; i < m_compile_worker_count; i++) {
+        if (!m_compile_worker_running[i]) {
+            m_compile_worker_running[i] = true;
+            m_compile_workers_running++;
+            thread_call_enter1(m_compile_workers[i], (thread_call_param_t)(uintptr_t)i);
+            break;
+        }
+    }
+    return true;
+}
+
+void CLASS::freeCompileJob(CompileJob* job)
+{
+    if (job->source) {
+        IOFree(job->source, job->source_size);
+    }
+    IOFree(job, sizeof(CompileJob));
+}
+
+// Compiles outside m_shader_lock, then fills in the pending entry. A failed
+// compile leaves the entry (for its status) but drops it from the cache so
+// the same source is compiled again next time.
+IOReturn CLASS::runCompileJob(CompileJob* job)
+{
+    uint64_t start = mach_absolute_time();
+    CompiledShader* compiled = nullptr;
+    IOReturn ret = compileShaderInternal(job->type, job->language, job->source,
+                                         job->source_size, job->flags, &compiled);
     
-    IOLog("VMShaderManager: Uniform '%s' not found in program %d\n", name, program_id);
-    return kIOReturnNotFound;
+    IOLockLock(m_shader_lock);
+    
+    CompiledShader* shader = findShader(job->id);
+    if (shader && shader->is_pending) {
+        if (ret == kIOReturnSuccess && compiled) {
+            shader->bytecode = compiled->bytecode;
+            shader->info = compiled->info;
+            shader->uniforms = compiled->uniforms;
+            shader->uniform_count = compiled->uniform_count;
+            shader->uniform_capacity = compiled->uniform_capacity;
+            shader->attributes = compiled->attributes;
+            shader->attribute_count = compiled->attribute_count;
+            shader->attribute_capacity = compiled->attribute_capacity;
+            shader->resources = compiled->resources;
+            shader->resource_count = compiled->resource_count;
+            shader->resource_capacity = compiled->resource_capacity;
+            shader->is_valid = true;
+            IOFree(compiled, sizeof(CompiledShader));
+            compiled = nullptr;
+            m_shader_cache_generation++;
+        } else {
+            removeCachedShader(shader);
+        }
+        shader->is_pending = false;
+        shader->compile_status = ret;
+        if (shader->ref_count == 0) {
+            trimIdleShaders(VM_SHADER_CACHE_MAX_IDLE);
+        }
+    }
+    
+    // Nobody left to hand the result to
+    if (compiled) {
+        freeShader(compiled);
+    }
+    
+    m_jobs_completed++;
+    IOLockWakeup(m_shader_lock, &m_jobs_completed, false);
+    IOLockUnlock(m_shader_lock);
+    
+    uint64_t elapsed_ns = 0;
+    absolutetime_to_nanoseconds(mach_absolute_time() - start, &elapsed_ns);
+    VMLOG_DEBUG("VMShaderManager: Compiled shader %d (type: %d, language: %d, size: %zu bytes) in %llu us: 0x%x\n",
+          job->id, job->type, job->language, job->source_size, elapsed_ns / 1000, ret);
+    return ret;
+}
+
+// Waits for the program's stages to compile, then links
+IOReturn CLASS::runLinkJob(CompileJob* job)
+{
+    IOLockLock(m_shader_lock);
+    for (;;) {
+        ShaderProgram* program = findProgram(job->id);
+        if (!program || m_compile_shutdown) break;
+        
+        bool compiling = false;
+        for (unsigned int i = 0; program->shader_ids && i < program->shader_ids->getCount(); i++) {
+            OSNumber* shader_id = (OSNumber*)program->shader_ids->getObject(i);
+            CompiledShader* shader = shader_id ? findShader(shader_id->unsigned32BitValue()) : nullptr;
+            if (shader && shader->is_pending) {
+                compiling = true;
+                break;
+            }
+        }
+        if (!compiling) break;
+        IOLockSleep(m_shader_lock, &m_jobs_completed, THREAD_UNINT);
+    }
+    IOLockUnlock(m_shader_lock);
+    
+    IOReturn ret = linkProgramNow(job->id);
+    
+    IOLockLock(m_shader_lock);
+    ShaderProgram* program = findProgram(job->id);
+    if (program) {
+        program->link_status = ret;
+        if (program->link_jobs > 0) {
+            program->link_jobs--;
+        }
+    }
+    m_jobs_completed++;
+    IOLockWakeup(m_shader_lock, &m_jobs_completed, false);
+    IOLockUnlock(m_shader_lock);
+    return ret;
+}
+
+// Both waits run with m_shader_lock held and drop it while asleep, so the
+// returned entry has to be looked up again after every wakeup
+CLASS::CompiledShader* CLASS::waitForShader(uint32_t shader_id)
+{
+    for (;;) {
+        CompiledShader* shader = findShader(shader_id);
+        if (!shader || !shader->is_pending || m_compile_shutdown) {
+            return shader;
+        }
+        IOLockSleep(m_shader_lock, &m_jobs_completed, THREAD_UNINT);
+    }
+}
+
+CLASS::ShaderProgram* CLASS::waitForProgram(uint32_t program_id)
+{
+    for (;;) {
+        ShaderProgram* program = findProgram(program_id);
+        if (!program || program->link_jobs == 0 || m_compile_shutdown) {
+            return program;
+        }
+        IOLockSleep(m_shader_lock, &m_jobs_completed, THREAD_UNINT);
+    }
+}
+
+IOReturn CLASS::getShaderCompletionStatus(uint32_t shader_id, bool* complete, IOReturn* status)
+{
+    if (!complete || !status)
+        return kIOReturnBadArgument;
+    
+    IOLockLock(m_shader_lock);
+    CompiledShader* shader = findShader(shader_id);
+    if (!shader || shader->ref_count == 0) {
+        IOLockUnlock(m_shader_lock);
+        return kIOReturnNotFound;
+    }
+    *complete = !shader->is_pending;
+    *status = shader->is_valid ? kIOReturnSuccess : shader->compile_status;
+    IOLockUnlock(m_shader_lock);
+    return kIOReturnSuccess;
+}
+
+IOReturn CLASS::getProgramCompletionStatus(uint32_t program_id, bool* complete, IOReturn* status)
+{
+    if (!complete || !status)
+        return kIOReturnBadArgument;
+    
+    IOLockLock(m_shader_lock);
+    ShaderProgram* program = findProgram(program_id);
+    if (!program) {
+        IOLockUnlock(m_shader_lock);
+        return kIOReturnNotFound;
+    }
+    *complete = program->link_jobs == 0;
+    *status = program->link_jobs == 0 ? program->link_status : kIOReturnNotReady;
+    IOLockUnlock(m_shader_lock);
+    return kIOReturnSuccess;
+}
+
+// ============================================================================
+// MARK: - Compile Cache
+// ============================================================================
+
+void CLASS::hashShaderSource(VMShaderType type, VMShaderLanguage language, uint32_t flags,
+                             const void* source_code, size_t source_size, uint8_t* key)
+{
+    const uint32_t header[3] = { (uint32_t)type, (uint32_t)language, flags };
+    SHA256_CTX ctx;
+    SHA256_Init(&ctx);
+    SHA256_Update(&ctx, header, sizeof(header));
+    SHA256_Update(&ctx, source_code, source_size);
+    SHA256_Final(key, &ctx);
+}
+
+CLASS::CompiledShader* CLASS::lookupCachedShader(const uint8_t* key)
+{
+    uint32_t bucket = key[0] & (VM_SHADER_CACHE_BUCKETS - 1);
+    for (CompiledShader* shader = m_shader_cache[bucket]; shader; shader = shader->cache_next) {
+        if (memcmp(shader->cache_key, key, VM_SHADER_HASH_SIZE) == 0) {
+            return shader;
+        }
+    }
+    return nullptr;
+}
+
+void CLASS::insertCachedShader(CompiledShader* shader)
+{
+    uint32_t bucket = shader->cache_key[0] & (VM_SHADER_CACHE_BUCKETS - 1);
+    shader->cache_next = m_shader_cache[bucket];
+    m_shader_cache[bucket] = shader;
+}
+
+void CLASS::removeCachedShader(CompiledShader* shader)
+{
+    uint32_t bucket = shader->cache_key[0] & (VM_SHADER_CACHE_BUCKETS - 1);
+    for (CompiledShader** link = &m_shader_cache[bucket]; *link; link = &(*link)->cache_next) {
+        if (*link == shader) {
+            *link = shader->cache_next;
+            break;
+        }
+    }
+    shader->cache_next = nullptr;
+}
+
+// Unlinks the shader from the cache and the registry and frees it
+void CLASS::freeShader(CompiledShader* shader)
+{
+    removeCachedShader(shader);
+    m_shader_table.remove(shader->shader_id);
+    
+    if (shader->bytecode) shader->bytecode->release();
+    freeShaderRecords(shader);
+    IOFree(shader, sizeof(CompiledShader));
+}
+
+void CLASS::freeShaderRecords(CompiledShader* shader)
+{
+    if (shader->uniforms) IOFree(shader->uniforms, shader->uniform_capacity * sizeof(VMShaderUniform));
+    if (shader->attributes) IOFree(shader->attributes, shader->attribute_capacity * sizeof(VMShaderAttribute));
+    if (shader->resources) IOFree(shader->resources, shader->resource_capacity * sizeof(VMShaderResource));
+    shader->uniforms = nullptr;
+    shader->attributes = nullptr;
+    shader->resources = nullptr;
+    shader->uniform_count = shader->uniform_capacity = 0;
+    shader->attribute_count = shader->attribute_capacity = 0;
+    shader->resource_count = shader->resource_capacity = 0;
+}
+
+void CLASS::releaseShaderRef(CompiledShader* shader)
+{
+    if (shader->ref_count == 0 || --shader->ref_count) {
+        return;
+    }
+    shader->last_used = mach_absolute_time();
+    m_idle_shader_count++;
+    trimIdleShaders(VM_SHADER_CACHE_MAX_IDLE);
+}
+
+// Evicts least recently used idle shaders until at most max_idle remain.
+// Shaders still compiling stay until their job has filled them in.
+void CLASS::trimIdleShaders(uint32_t max_idle)
+{
+    while (m_idle_shader_count > max_idle) {
+        CompiledShader* oldest = nullptr;
+        bool compiling = false;
+        for (uint32_t i = 0; i < m_shader_table.limit(); i++) {
+            CompiledShader* shader = m_shader_table.at(i);
+            if (!shader || shader->ref_count != 0) continue;
+            if (shader->is_pending) {
+                compiling = true;
+            } else if (!oldest || shader->last_used < oldest->last_used) {
+                oldest = shader;
+            }
+        }
+        if (!oldest) {
+            if (!compiling) {
+                m_idle_shader_count = 0;
+            }
+            break;
+        }
+        freeShader(oldest);
+        m_idle_shader_count--;
+    }
+}
+
+// SHA-256 over the program's stage hashes in sorted order, so attach order
+// does not matter
+bool CLASS::computeProgramKey(ShaderProgram* program, uint8_t* key)
+{
+    const uint8_t* stages[8];
+    uint32_t count = 0;
+    
+    for (unsigned int i = 0; i < program->shader_ids->getCount(); i++) {
+        OSNumber* shader_id_num = (OSNumber*)program->shader_ids->getObject(i);
+        CompiledShader* shader = shader_id_num ? findShader(shader_id_num->unsigned32BitValue()) : nullptr;
+        if (!shader || count == 8) {
+            return false;
+        }
+        
+        uint32_t j = count++;
+        while (j > 0 && memcmp(stages[j - 1], shader->cache_key, VM_SHADER_HASH_SIZE) > 0) {
+            stages[j] = stages[j - 1];
+            j--;
+        }
+        stages[j] = shader->cache_key;
+    }
+    
+    SHA256_CTX ctx;
+    SHA256_Init(&ctx);
+    for (uint32_t i = 0; i < count; i++) {
+        SHA256_Update(&ctx, stages[i], VM_SHADER_HASH_SIZE);
+    }
+    SHA256_Final(key, &ctx);
+    return count > 0;
+}
+
+CLASS::ProgramCacheEntry* CLASS::lookupProgramCache(const uint8_t* key)
+{
+    for (uint32_t i = 0; i < VM_SHADER_PROGRAM_CACHE_SIZE; i++) {
+        ProgramCacheEntry* entry = &m_program_cache[i];
+        if (entry->in_use && memcmp(entry->key, key, VM_SHADER_HASH_SIZE) == 0) {
+            entry->last_used = mach_absolute_time();
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+// Empties the entry for key, or a free one, or the least recently used one
+CLASS::ProgramCacheEntry* CLASS::claimProgramCacheSlot(const uint8_t* key)
+{
+    ProgramCacheEntry* slot = nullptr;
+    for (uint32_t i = 0; i < VM_SHADER_PROGRAM_CACHE_SIZE; i++) {
+        ProgramCacheEntry* entry = &m_program_cache[i];
+        if (!entry->in_use || memcmp(entry->key, key, VM_SHADER_HASH_SIZE) == 0) {
+            slot = entry;
+            break;
+        }
+        if (!slot || entry->last_used < slot->last_used) {
+            slot = entry;
+        }
+    }
+    freeProgramCacheEntry(slot);
+    return slot;
+}
+
+// Snapshot a freshly linked program's reflection, replacing the least
+// recently used entry when the cache is full
+void CLASS::storeProgramCache(const uint8_t* key, ShaderProgram* program)
+{
+    ProgramCacheEntry* slot = claimProgramCacheSlot(key);
+    
+    uint32_t uniform_count = program->all_uniforms ? program->all_uniforms->getCount() : 0;
+    uint32_t attribute_count = program->all_attributes ? program->all_attributes->getCount() : 0;
+    if (uniform_count) {
+        slot->uniforms = (VMShaderUniform*)IOMalloc(uniform_count * sizeof(VMShaderUniform));
+        if (!slot->uniforms) return;
+    }
+    if (attribute_count) {
+        slot->attributes = (VMShaderAttribute*)IOMalloc(attribute_count * sizeof(VMShaderAttribute));
+        if (!slot->attributes) {
+            freeProgramCacheEntry(slot);
+            return;
+        }
+    }
+    
+    for (uint32_t i = 0; i < uniform_count; i++) {
+        VMShaderUniform* uniform = (VMShaderUniform*)program->all_uniforms->getObject(i);
+        if (uniform) slot->uniforms[slot->uniform_count++] = *uniform;
+    }
+    for (uint32_t i = 0; i < attribute_count; i++) {
+        VMShaderAttribute* attribute = (VMShaderAttribute*)program->all_attributes->getObject(i);
+        if (attribute) slot->attributes[slot->attribute_count++] = *attribute;
+    }
+    
+    memcpy(slot->key, key, VM_SHADER_HASH_SIZE);
+    slot->resource_count = program->resource_count;
+    slot->hardware_optimized = program->hardware_optimized;
+    slot->last_used = mach_absolute_time();
+    slot->in_use = true;
+    m_shader_cache_generation++;
+}
+
+// Link without the analysis passes: copy the cached reflection and finish
+// the same way a full link does
+IOReturn CLASS::restoreProgramFromCache(ShaderProgram* program, ProgramCacheEntry* entry)
+{
+    freeProgramReflection(program);
+    if (!program->all_uniforms) program->all_uniforms = OSArray::withCapacity(entry->uniform_count);
+    if (!program->all_attributes) program->all_attributes = OSArray::withCapacity(entry->attribute_count);
+    if (!program->all_uniforms || !program->all_attributes) {
+        return kIOReturnNoMemory;
+    }
+    
+    for (uint32_t i = 0; i < entry->uniform_count; i++) {
+        VMShaderUniform* uniform = (VMShaderUniform*)IOMalloc(sizeof(VMShaderUniform));
+        if (!uniform) return kIOReturnNoMemory;
+        *uniform = entry->uniforms[i];
+        program->all_uniforms->setObject((OSObject*)uniform);
+    }
+    for (uint32_t i = 0; i < entry->attribute_count; i++) {
+        VMShaderAttribute* attribute = (VMShaderAttribute*)IOMalloc(sizeof(VMShaderAttribute));
+        if (!attribute) return kIOReturnNoMemory;
+        *attribute = entry->attributes[i];
+        program->all_attributes->setObject((OSObject*)attribute);
+    }
+    
+    for (unsigned int i = 0; i < program->shader_ids->getCount(); i++) {
+        OSNumber* shader_id_num = (OSNumber*)program->shader_ids->getObject(i);
+        CompiledShader* shader = shader_id_num ? findShader(shader_id_num->unsigned32BitValue()) : nullptr;
+        if (!shader) continue;
+        switch (shader->type) {
+            case VM_SHADER_TYPE_VERTEX: program->vertex_shader_id = shader->shader_id; break;
+            case VM_SHADER_TYPE_FRAGMENT: program->fragment_shader_id = shader->shader_id; break;
+            case VM_SHADER_TYPE_GEOMETRY: program->geometry_shader_id = shader->shader_id; break;
+            case VM_SHADER_TYPE_TESSELLATION_CONTROL: program->tessellation_control_shader_id = shader->shader_id; break;
+            case VM_SHADER_TYPE_TESSELLATION_EVALUATION: program->tessellation_evaluation_shader_id = shader->shader_id; break;
+            case VM_SHADER_TYPE_COMPUTE: program->compute_shader_id = shader->shader_id; break;
+        }
+    }
+    
+    program->is_linked = true;
+    program->hardware_optimized = entry->hardware_optimized;
+    program->link_timestamp = mach_absolute_time();
+    program->uniform_count = entry->uniform_count;
+    program->attribute_count = entry->attribute_count;
+    program->resource_count = entry->resource_count;
+    
+    if (!program->performance_stats) {
+        program->performance_stats = (struct ProgramPerformanceStats*)IOMalloc(sizeof(struct ProgramPerformanceStats));
+        if (program->performance_stats) {
+            bzero(program->performance_stats, sizeof(struct ProgramPerformanceStats));
+            program->performance_stats->link_time = program->link_timestamp;
+        }
+    }
+    
+    return buildUniformBlock(program);
+}
+
+void CLASS::freeProgramCacheEntry(ProgramCacheEntry* entry)
+{
+    if (entry->uniforms) {
+        IOFree(entry->uniforms, entry->uniform_count * sizeof(VMShaderUniform));
+    }
+    if (entry->attributes) {
+        IOFree(entry->attributes, entry->attribute_count * sizeof(VMShaderAttribute));
+    }
+    bzero(entry, sizeof(ProgramCacheEntry));
+}
+
+// Frees a program's aggregated uniforms and attributes, leaving the arrays empty
+void CLASS::freeProgramReflection(ShaderProgram* program)
+{
+    releaseUniformBlock(program);
+    
+    if (program->all_uniforms) {
+        for (unsigned int i = 0; i < program->all_uniforms->getCount(); i++) {
+            VMShaderUniform* uniform = (VMShaderUniform*)program->all_uniforms->getObject(i);
+            if (uniform) IOFree(uniform, sizeof(VMShaderUniform));
+        }
+        program->all_uniforms->flushCollection();
+    }
+    if (program->all_attributes) {
+        for (unsigned int i = 0; i < program->all_attributes->getCount(); i++) {
+            VMShaderAttribute* attribute = (VMShaderAttribute*)program->all_attributes->getObject(i);
+            if (attribute) IOFree(attribute, sizeof(VMShaderAttribute));
+        }
+        program->all_attributes->flushCollection();
+    }
+}
+
+// Drops everything the caches hold that no caller references: idle shaders
+// and all link results. Live shaders and programs are untouched.
+IOReturn CLASS::clearShaderCache()
+{
+    IOLockLock(m_shader_lock);
+    
+    uint32_t idle = m_idle_shader_count;
+    trimIdleShaders(0);
+    for (uint32_t i = 0; i < VM_SHADER_PROGRAM_CACHE_SIZE; i++) {
+        freeProgramCacheEntry(&m_program_cache[i]);
+    }
+    
+    VMLOG_DEBUG("VMShaderManager: Cleared shader cache (%u idle shaders; shader hits %llu / misses %llu, "
+          "program hits %llu / misses %llu)\n", idle, m_shader_cache_hits, m_shader_cache_misses,
+          m_program_cache_hits, m_program_cache_misses);
+    
+    IOLockUnlock(m_shader_lock);
+    return kIOReturnSuccess;
+}
+
+// ============================================================================
+// MARK: - Persistent Cache
+// ============================================================================
+
+// Identity of a cache image. It also covers the record layouts, so a build
+// that changes any struct embedded in a record refuses older images on its own.
+void CLASS::computeCacheIdentity(const uint8_t* environment, uint8_t* identity)
+{
+    const uint32_t layout[6] = {
+        VM_SHADER_CACHE_FILE_VERSION,
+        (uint32_t)sizeof(VMCompiledShaderInfo),
+        (uint32_t)sizeof(VMShaderUniform),
+        (uint32_t)sizeof(VMShaderAttribute),
+        (uint32_t)sizeof(VMShaderResource),
+        VM_SHADER_HASH_SIZE
+    };
+    SHA256_CTX ctx;
+    SHA256_Init(&ctx);
+    SHA256_Update(&ctx, layout, sizeof(layout));
+    SHA256_Update(&ctx, environment, VM_SHADER_CACHE_DIGEST_SIZE);
+    SHA256_Final(identity, &ctx);
+}
+
+uint32_t CLASS::shaderRecordSize(CompiledShader* shader)
+{
+    if (!shader->is_valid || !shader->bytecode) {
+        return 0;
+    }
+    uint64_t size = sizeof(struct vm_shader_cache_shader_record) + sizeof(VMCompiledShaderInfo);
+    size += ((uint64_t)shader->bytecode->getLength() + 3) & ~3ull;
+    size += (uint64_t)(shader->uniform_count) * sizeof(VMShaderUniform);
+    size += (uint64_t)(shader->attribute_count) * sizeof(VMShaderAttribute);
+    size += (uint64_t)(shader->resource_count) * sizeof(VMShaderResource);
+    return size > VM_SHADER_CACHE_FILE_MAX ? 0 : (uint32_t)size;
+}
+
+// Bytes exportShaderCache will write. Records that would push the image
+// past VM_SHADER_CACHE_FILE_MAX are left out; export skips the same ones.
+uint32_t CLASS::exportedCacheSize()
+{
+    uint32_t total = sizeof(struct vm_shader_cache_file_header);
+    for (uint32_t i = 0; i < m_shader_table.limit(); i++) {
+        CompiledShader* shader = m_shader_table.at(i);
+        uint32_t record_size = shader ? shaderRecordSize(shader) : 0;
+        if (record_size && total + record_size <= VM_SHADER_CACHE_FILE_MAX) {
+            total += record_size;
+        }
+    }
+    for (uint32_t i = 0; i < VM_SHADER_PROGRAM_CACHE_SIZE; i++) {
+        ProgramCacheEntry* entry = &m_program_cache[i];
+        if (!entry->in_use) continue;
+        uint32_t record_size = sizeof(struct vm_shader_cache_program_record) +
+                               entry->uniform_count * sizeof(VMShaderUniform) +
+                               entry->attribute_count * sizeof(VMShaderAttribute);
+        if (total + record_size <= VM_SHADER_CACHE_FILE_MAX) {
+            total += record_size;
+        }
+    }
+    return total;
+}
+
+IOReturn CLASS::getShaderCacheInfo(const uint8_t* environment, uint8_t* identity,
+                                   uint64_t* generation, uint32_t* export_size)
+{
+    if (!environment || !identity || !generation || !export_size)
+        return kIOReturnBadArgument;
+    
+    computeCacheIdentity(environment, identity);
+    
+    IOLockLock(m_shader_lock);
+    *generation = m_shader_cache_generation;
+    *export_size = exportedCacheSize();
+    IOLockUnlock(m_shader_lock);
+    return kIOReturnSuccess;
+}
+
+// Writes every compiled shader (live or idle) and every cached link result
+// as one image. Returns kIOReturnNoSpace with the required size in *size
+// when the buffer is too small.
+IOReturn CLASS::exportShaderCache(const uint8_t* environment, void* buffer,
+                                  uint32_t capacity, uint32_t* size)
+{
+    if (!environment || !size)
+        return kIOReturnBadArgument;
+    
+    IOLockLock(m_shader_lock);
+    
+    uint32_t needed = exportedCacheSize();
+    *size = needed;
+    if (!buffer || capacity < needed) {
+        IOLockUnlock(m_shader_lock);
+        return kIOReturnNoSpace;
+    }
+    
+    uint8_t* base = (uint8_t*)buffer;
+    struct vm_shader_cache_file_header* header = (struct vm_shader_cache_file_header*)base;
+    bzero(header, sizeof(*header));
+    uint32_t offset = sizeof(*header);
+    
+    for (uint32_t i = 0; i < m_shader_table.limit(); i++) {
+        CompiledShader* shader = m_shader_table.at(i);
+        uint32_t record_size = shader ? shaderRecordSize(shader) : 0;
+        if (!record_size || offset + record_size > VM_SHADER_CACHE_FILE_MAX) continue;
+        
+        struct vm_shader_cache_shader_record* record = (struct vm_shader_cache_shader_record*)(base + offset);
+        bzero(record, record_size);
+        record->record_size = record_size;
+        record->type = shader->type;
+        record->language = shader->language;
+        record->bytecode_size = (uint32_t)shader->bytecode->getLength();
+        record->uniform_count = shader->uniform_count;
+        record->attribute_count = shader->attribute_count;
+        record->resource_count = shader->resource_count;
+        memcpy(record->key, shader->cache_key, VM_SHADER_HASH_SIZE);
+        
+        uint8_t* p = (uint8_t*)(record + 1);
+        memcpy(p, &shader->info, sizeof(VMCompiledShaderInfo));
+        p += sizeof(VMCompiledShaderInfo);
+        shader->bytecode->readBytes(0, p, record->bytecode_size);
+        p += (record->bytecode_size + 3) & ~3u;
+        if (record->uniform_count) {
+            memcpy(p, shader->uniforms, record->uniform_count * sizeof(VMShaderUniform));
+            p += record->uniform_count * sizeof(VMShaderUniform);
+        }
+        if (record->attribute_count) {
+            memcpy(p, shader->attributes, record->attribute_count * sizeof(VMShaderAttribute));
+            p += record->attribute_count * sizeof(VMShaderAttribute);
+        }
+        if (record->resource_count) {
+            memcpy(p, shader->resources, record->resource_count * sizeof(VMShaderResource));
+        }
+        
+        offset += record_size;
+        header->shader_count++;
+    }
+    
+    for (uint32_t i = 0; i < VM_SHADER_PROGRAM_CACHE_SIZE; i++) {
+        ProgramCacheEntry* entry = &m_program_cache[i];
+        if (!entry->in_use) continue;
+        uint32_t record_size = sizeof(struct vm_shader_cache_program_record) +
+                               entry->uniform_count * sizeof(VMShaderUniform) +
+                               entry->attribute_count * sizeof(VMShaderAttribute);
+        if (offset + record_size > VM_SHADER_CACHE_FILE_MAX) continue;
+        
+        struct vm_shader_cache_program_record* record = (struct vm_shader_cache_program_record*)(base + offset);
+        bzero(record, sizeof(*record));
+        record->record_size = record_size;
+        record->uniform_count = entry->uniform_count;
+        record->attribute_count = entry->attribute_count;
+        record->resource_count = entry->resource_count;
+        record->hardware_optimized = entry->hardware_optimized ? 1 : 0;
+        memcpy(record->key, entry->key, VM_SHADER_HASH_SIZE);
+        
+        uint8_t* p = (uint8_t*)(record + 1);
+        if (entry->uniform_count) {
+            memcpy(p, entry->uniforms, entry->uniform_count * sizeof(VMShaderUniform));
+            p += entry->uniform_count * sizeof(VMShaderUniform);
+        }
+        if (entry->attribute_count) {
+            memcpy(p, entry->attributes, entry->attribute_count * sizeof(VMShaderAttribute));
+        }
+        
+        offset += record_size;
+        header->program_count++;
+    }
+    
+    header->magic = VM_SHADER_CACHE_FILE_MAGIC;
+    header->version = VM_SHADER_CACHE_FILE_VERSION;
+    header->header_size = sizeof(*header);
+    header->payload_size = offset - sizeof(*header);
+    header->generation = m_shader_cache_generation;
+    computeCacheIdentity(environment, header->identity);
+    
+    SHA256_CTX ctx;
+    SHA256_Init(&ctx);
+    SHA256_Update(&ctx, base + sizeof(*header), header->payload_size);
+    SHA256_Final(header->checksum, &ctx);
+    
+    VMLOG_DEBUG("VMShaderManager: Exported shader cache generation %llu: %u shaders, %u programs, %u bytes\n",
+          header->generation, header->shader_count, header->program_count, offset);
+    
+    IOLockUnlock(m_shader_lock);
+    return kIOReturnSuccess;
+}
+
+// Adds one shader record as an idle cache entry. The caller has checked the
+// record fits in the image and that its key is not cached yet.
+IOReturn CLASS::importShaderRecord(const struct vm_shader_cache_shader_record* record)
+{
+    if (record->type < VM_SHADER_TYPE_VERTEX || record->type > VM_SHADER_TYPE_COMPUTE ||
+        record->language < VM_SHADER_LANG_GLSL || record->language > VM_SHADER_LANG_SPIRV ||
+        record->bytecode_size == 0) {
+        return kIOReturnBadMedia;
+    }
+    
+    uint64_t expected = sizeof(*record) + sizeof(VMCompiledShaderInfo);
+    expected += ((uint64_t)record->bytecode_size + 3) & ~3ull;
+    expected += (uint64_t)record->uniform_count * sizeof(VMShaderUniform);
+    expected += (uint64_t)record->attribute_count * sizeof(VMShaderAttribute);
+    expected += (uint64_t)record->resource_count * sizeof(VMShaderResource);
+    if (expected != record->record_size) {
+        return kIOReturnBadMedia;
+    }
+    
+    CompiledShader* shader = (CompiledShader*)IOMalloc(sizeof(CompiledShader));
+    if (!shader)
+        return kIOReturnNoMemory;
+    bzero(shader, sizeof(CompiledShader));
+    shader->type = (VMShaderType)record->type;
+    shader->language = (VMShaderLanguage)record->language;
+    shader->bytecode = IOBufferMemoryDescriptor::withCapacity(record->bytecode_size, kIODirectionOut);
+    if (record->uniform_count) {
+        shader->uniforms = (VMShaderUniform*)IOMalloc(record->uniform_count * sizeof(VMShaderUniform));
+        shader->uniform_capacity = shader->uniforms ? record->uniform_count : 0;
+    }
+    if (record->attribute_count) {
+        shader->attributes = (VMShaderAttribute*)IOMalloc(record->attribute_count * sizeof(VMShaderAttribute));
+        shader->attribute_capacity = shader->attributes ? record->attribute_count : 0;
+    }
+    if (record->resource_count) {
+        shader->resources = (VMShaderResource*)IOMalloc(record->resource_count * sizeof(VMShaderResource));
+        shader->resource_capacity = shader->resources ? record->resource_count : 0;
+    }
+    if (!shader->bytecode || shader->uniform_capacity != record->uniform_count ||
+        shader->attribute_capacity != record->attribute_count ||
+        shader->resource_capacity != record->resource_count) {
+        freeShader(shader);
+        return kIOReturnNoMemory;
+    }
+    
+    const uint8_t* p = (const uint8_t*)(record + 1);
+    memcpy(&shader->info, p, sizeof(VMCompiledShaderInfo));
+    shader->info.entry_point[sizeof(shader->info.entry_point) - 1] = '\0';
+    p += sizeof(VMCompiledShaderInfo);
+    shader->bytecode->writeBytes(0, p, record->bytecode_size);
+    p += (record->bytecode_size + 3) & ~3u;
+    
+    for (uint32_t i = 0; i < record->uniform_count; i++, p += sizeof(VMShaderUniform)) {
+        VMShaderUniform* uniform = &shader->uniforms[shader->uniform_count++];
+        memcpy(uniform, p, sizeof(VMShaderUniform));
+        uniform->name[sizeof(uniform->name) - 1] = '\0';
+    }
+    for (uint32_t i = 0; i < record->attribute_count; i++, p += sizeof(VMShaderAttribute)) {
+        VMShaderAttribute* attribute = &shader->attributes[shader->attribute_count++];
+        memcpy(attribute, p, sizeof(VMShaderAttribute));
+        attribute->name[sizeof(attribute->name) - 1] = '\0';
+    }
+    for (uint32_t i = 0; i < record->resource_count; i++, p += sizeof(VMShaderResource)) {
+        VMShaderResource* resource = &shader->resources[shader->resource_count++];
+        memcpy(resource, p, sizeof(VMShaderResource));
+        resource->name[sizeof(resource->name) - 1] = '\0';
+    }
+    
+    shader->shader_id = m_shader_table.insert(shader);
+    if (!shader->shader_id) {
+        freeShader(shader);
+        return kIOReturnNoResources;
+    }
+    shader->info.shader_id = shader->shader_id;
+    shader->info.type = shader->type;
+    shader->info.source_language = shader->language;
+    shader->info.bytecode_size = record->bytecode_size;
+    shader->ref_count = 0;
+    shader->is_valid = true;
+    memcpy(shader->cache_key, record->key, VM_SHADER_HASH_SIZE);
+    shader->last_used = mach_absolute_time();
+    
+    insertCachedShader(shader);
+    m_idle_shader_count++;
+    return kIOReturnSuccess;
+}
+
+IOReturn CLASS::importProgramRecord(const struct vm_shader_cache_program_record* record)
+{
+    uint64_t expected = sizeof(*record) +
+                        (uint64_t)record->uniform_count * sizeof(VMShaderUniform) +
+                        (uint64_t)record->attribute_count * sizeof(VMShaderAttribute);
+    if (expected != record->record_size) {
+        return kIOReturnBadMedia;
+    }
+    
+    ProgramCacheEntry* slot = claimProgramCacheSlot(record->key);
+    const uint8_t* p = (const uint8_t*)(record + 1);
+    if (record->uniform_count) {
+        slot->uniforms = (VMShaderUniform*)IOMalloc(record->uniform_count * sizeof(VMShaderUniform));
+        if (!slot->uniforms) return kIOReturnNoMemory;
+        slot->uniform_count = record->uniform_count;
+        memcpy(slot->uniforms, p, record->uniform_count * sizeof(VMShaderUniform));
+        p += record->uniform_count * sizeof(VMShaderUniform);
+        for (uint32_t i = 0; i < slot->uniform_count; i++) {
+            slot->uniforms[i].name[sizeof(slot->uniforms[i].name) - 1] = '\0';
+        }
+    }
+    if (record->attribute_count) {
+        slot->attributes = (VMShaderAttribute*)IOMalloc(record->attribute_count * sizeof(VMShaderAttribute));
+        if (!slot->attributes) {
+            freeProgramCacheEntry(slot);
+            return kIOReturnNoMemory;
+        }
+        slot->attribute_count = record->attribute_count;
+        memcpy(slot->attributes, p, record->attribute_count * sizeof(VMShaderAttribute));
+        for (uint32_t i = 0; i < slot->attribute_count; i++) {
+            slot->attributes[i].name[sizeof(slot->attributes[i].name) - 1] = '\0';
+        }
+    }
+    
+    memcpy(slot->key, record->key, VM_SHADER_HASH_SIZE);
+    slot->resource_count = record->resource_count;
+    slot->hardware_optimized = record->hardware_optimized != 0;
+    slot->last_used = mach_absolute_time();
+    slot->in_use = true;
+    return kIOReturnSuccess;
+}
+
+// Merges a saved image into the caches. Entries already present are kept;
+// imported shaders start idle, so the first compile of the same source is a
+// cache hit. Imports do not move the generation: the image already holds them.
+// buffer must be kernel memory the caller owns, not a live user mapping.
+IOReturn CLASS::importShaderCache(const uint8_t* environment, const void* buffer, uint32_t size,
+                                  uint32_t* shaders_imported, uint32_t* programs_imported)
+{
+    if (!environment || !buffer || size < sizeof(struct vm_shader_cache_file_header) ||
+        size > VM_SHADER_CACHE_FILE_MAX)
+        return kIOReturnBadArgument;
+    
+    const uint8_t* base = (const uint8_t*)buffer;
+    const struct vm_shader_cache_file_header* header = (const struct vm_shader_cache_file_header*)base;
+    if (header->magic != VM_SHADER_CACHE_FILE_MAGIC ||
+        header->version != VM_SHADER_CACHE_FILE_VERSION ||
+        header->header_size != sizeof(*header) ||
+        header->payload_size != size - sizeof(*header)) {
+        VMLOG_WARN("VMShaderManager: Shader cache image rejected: bad header (magic 0x%08x, version %u, %u bytes)\n",
+              header->magic, header->version, size);
+        return kIOReturnBadMedia;
+    }
+    
+    uint8_t digest[VM_SHADER_CACHE_DIGEST_SIZE];
+    computeCacheIdentity(environment, digest);
+    if (memcmp(digest, header->identity, sizeof(digest)) != 0) {
+        VMLOG_WARN("VMShaderManager: Shader cache image rejected: made for another kext build or host renderer\n");
+        return kIOReturnBadMedia;
+    }
+    
+    SHA256_CTX ctx;
+    SHA256_Init(&ctx);
+    SHA256_Update(&ctx, base + sizeof(*header), header->payload_size);
+    SHA256_Final(digest, &ctx);
+    if (memcmp(digest, header->checksum, sizeof(digest)) != 0) {
+        VMLOG_WARN("VMShaderManager: Shader cache image rejected: checksum mismatch\n");
+        return kIOReturnBadMedia;
+    }
+    
+    IOLockLock(m_shader_lock);
+    
+    IOReturn ret = kIOReturnSuccess;
+    uint32_t shaders = 0, programs = 0;
+    uint32_t offset = sizeof(*header);
+    uint32_t total = header->shader_count + header->program_count;
+    for (uint32_t i = 0; i < total && ret == kIOReturnSuccess; i++) {
+        const uint32_t* record_size = (const uint32_t*)(base + offset);
+        uint32_t min_size = i < header->shader_count ? sizeof(struct vm_shader_cache_shader_record)
+                                                    : sizeof(struct vm_shader_cache_program_record);
+        if (size - offset < min_size || *record_size < min_size ||
+            *record_size > size - offset || (*record_size & 3)) {
+            ret = kIOReturnBadMedia;
+            break;
+        }
+        
+        if (i < header->shader_count) {
+            const struct vm_shader_cache_shader_record* record =
+                (const struct vm_shader_cache_shader_record*)(base + offset);
+            if (!lookupCachedShader(record->key)) {
+                ret = importShaderRecord(record);
+                if (ret == kIOReturnSuccess) shaders++;
+            }
+        } else {
+            const struct vm_shader_cache_program_record* record =
+                (const struct vm_shader_cache_program_record*)(base + offset);
+            if (!lookupProgramCache(record->key)) {
+                ret = importProgramRecord(record);
+                if (ret == kIOReturnSuccess) programs++;
+            }
+        }
+        offset += *record_size;
+    }
+    trimIdleShaders(VM_SHADER_CACHE_MAX_IDLE);
+    
+    VMLOG_DEBUG("VMShaderManager: Imported shader cache generation %llu: %u/%u shaders, %u/%u programs (0x%x)\n",
+          header->generation, shaders, header->shader_count, programs, header->program_count, ret);
+    
+    IOLockUnlock(m_shader_lock);
+    
+    if (shaders_imported) *shaders_imported = shaders;
+    if (programs_imported) *programs_imported = programs;
+    return ret;
+}
+
+// ============================================================================
+// MARK: - Uniform Block
+// ============================================================================
+
+// Length of `name` without a trailing "[k]" element index. Only the last
+// subscript is an index: "lights[1].color" names a struct member.
+static size_t uniformBaseLength(const char* name)
+{
+    size_t len = strlen(name);
+    if (len < 3 || name[len - 1] != ']') {
+        return len;
+    }
+    size_t open = len - 2;
+    while (open > 0 && name[open] >= '0' && name[open] <= '9') {
+        open--;
+    }
+    return (name[open] == '[' && open < len - 2) ? open : len;
+}
+
+// FNV-1a over the base name; "lights[2]" hashes like "lights"
+uint32_t CLASS::hashUniformName(const char* name)
+{
+    uint32_t hash = 2166136261u;
+    size_t len = uniformBaseLength(name);
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool CLASS::uniformNameEquals(const char* declared, const char* name)
+{
+    size_t declared_len = uniformBaseLength(declared);
+    return declared_len == uniformBaseLength(name) && strncmp(declared, name, declared_len) == 0;
+}
+
+IOReturn CLASS::buildUniformBlock(ShaderProgram* program)
+{
+    releaseUniformBlock(program);
+    
+    uint32_t count = program->all_uniforms ? program->all_uniforms->getCount() : 0;
+    if (count == 0) {
+        return kIOReturnSuccess;
+    }
+    if (count > MAX_SHADER_UNIFORMS) {
+        count = MAX_SHADER_UNIFORMS;
+    }
+    
+    uint32_t index_size = 16;
+    while (index_size < count * 2) {
+        index_size <<= 1;
+    }
+    
+    program->uniform_table = (VMShaderUniform**)IOMalloc(count * sizeof(VMShaderUniform*));
+    program->uniform_index = (uint16_t*)IOMalloc(index_size * sizeof(uint16_t));
+    if (!program->uniform_table || !program->uniform_index) {
+        releaseUniformBlock(program);
+        return kIOReturnNoMemory;
+    }
+    program->uniform_table_count = count;
+    program->uniform_index_mask = index_size - 1;
+    bzero(program->uniform_index, index_size * sizeof(uint16_t));
+    
+    // Flat table plus an open-addressed name index; the block spans the
+    // furthest offset + size the link step assigned
+    uint32_t block_size = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        VMShaderUniform* uniform = (VMShaderUniform*)program->all_uniforms->getObject(i);
+        program->uniform_table[i] = uniform;
+        if (!uniform) {
+            continue;
+        }
+        
+        uint32_t slot = hashUniformName(uniform->name) & program->uniform_index_mask;
+        while (program->uniform_index[slot]) {
+            slot = (slot + 1) & program->uniform_index_mask;
+        }
+        program->uniform_index[slot] = (uint16_t)(i + 1);
+        
+        uint32_t elements = uniform->array_size ? uniform->array_size : 1;
+        uint64_t end = (uint64_t)uniform->offset + (uint64_t)uniform->size * elements;
+        if (end > VM_SHADER_UNIFORM_BLOCK_MAX) {
+            VMLOG_DEBUG("VMShaderManager: Uniform '%s' lies outside the %d-byte block\n",
+                  uniform->name, VM_SHADER_UNIFORM_BLOCK_MAX);
+            continue;
+        }
+        if (end > block_size) {
+            block_size = (uint32_t)end;
+        }
+    }
+    
+    block_size = (block_size + 15) & ~15u;
+    if (block_size) {
+        program->uniform_shadow = (uint8_t*)IOMalloc(block_size);
+        if (!program->uniform_shadow) {
+            releaseUniformBlock(program);
+            return kIOReturnNoMemory;
+        }
+        bzero(program->uniform_shadow, block_size);
+        program->uniform_block_size = block_size;
+        
+        // The host copy starts undefined: the first flush sends everything
+        markUniformDirty(program, 0, block_size);
+    }
+    
+    VMLOG_DEBUG("VMShaderManager: Program %d uniform block: %d uniforms, %d bytes\n",
+          program->program_id, count, block_size);
+    return kIOReturnSuccess;
+}
+
+void CLASS::releaseUniformBlock(ShaderProgram* program)
+{
+    if (program->uniform_resource) {
+        // The id may be reused; no context should think it is still bound
+        for (uint32_t i = 0; i < MAX_RENDER_CONTEXTS; i++) {
+            for (uint32_t s = 0; s < 2; s++) {
+                if (m_context_ubo[i].resource[s] == program->uniform_resource) {
+                    m_context_ubo[i].resource[s] = 0;
+                }
+            }
+        }
+        if (m_gpu_device) {
+            m_gpu_device->deallocateResource(program->uniform_resource);
+        }
+    }
+    if (program->uniform_block_size || program->uniform_bytes_uploaded) {
+        VMLOG_DEBUG("VMShaderManager: Program %d uniforms: %llu bytes uploaded, %llu redundant writes skipped\n",
+              program->program_id, program->uniform_bytes_uploaded, program->uniform_writes_skipped);
+    }
+    
+    if (program->uniform_shadow) {
+        IOFree(program->uniform_shadow, program->uniform_block_size);
+    }
+    if (program->uniform_table) {
+        IOFree(program->uniform_table, program->uniform_table_count * sizeof(VMShaderUniform*));
+    }
+    if (program->uniform_index) {
+        IOFree(program->uniform_index, (program->uniform_index_mask + 1) * sizeof(uint16_t));
+    }
+    
+    program->uniform_shadow = nullptr;
+    program->uniform_block_size = 0;
+    program->uniform_table = nullptr;
+    program->uniform_table_count = 0;
+    program->uniform_index = nullptr;
+    program->uniform_index_mask = 0;
+    program->dirty_count = 0;
+    program->uniform_resource = 0;
+    program->uniform_resource_ctx = 0;
+    program->uniform_bytes_uploaded = 0;
+    program->uniform_writes_skipped = 0;
+}
+
+VMShaderUniform* CLASS::lookupUniform(ShaderProgram* program, const char* name)
+{
+    if (!program->uniform_index) {
+        return nullptr;
+    }
+    
+    uint32_t slot = hashUniformName(name) & program->uniform_index_mask;
+    while (uint16_t entry = program->uniform_index[slot]) {
+        VMShaderUniform* uniform = program->uniform_table[entry - 1];
+        if (uniform && uniformNameEquals(uniform->name, name)) {
+            return uniform;
+        }
+        slot = (slot + 1) & program->uniform_index_mask;
+    }
+    return nullptr;
+}
+
+// Ranges closer than VM_SHADER_UNIFORM_MERGE_GAP are merged; once the list
+// is full everything collapses into one covering range
+void CLASS::markUniformDirty(ShaderProgram* program, uint32_t start, uint32_t end)
+{
+    start &= ~3u;
+    end = (end + 3) & ~3u;
+    
+    uint32_t i = 0;
+    while (i < program->dirty_count) {
+        if (start <= program->dirty_end[i] + VM_SHADER_UNIFORM_MERGE_GAP &&
+            program->dirty_start[i] <= end + VM_SHADER_UNIFORM_MERGE_GAP) {
+            if (program->dirty_start[i] < start) start = program->dirty_start[i];
+            if (program->dirty_end[i] > end) end = program->dirty_end[i];
+            
+            // Drop range i and rescan: the widened range may now touch others
+            program->dirty_count--;
+            program->dirty_start[i] = program->dirty_start[program->dirty_count];
+            program->dirty_end[i] = program->dirty_end[program->dirty_count];
+            i = 0;
+            continue;
+        }
+        i++;
+    }
+    
+    if (program->dirty_count == VM_SHADER_UNIFORM_DIRTY_RANGES) {
+        for (i = 0; i < program->dirty_count; i++) {
+            if (program->dirty_start[i] < start) start = program->dirty_start[i];
+            if (program->dirty_end[i] > end) end = program->dirty_end[i];
+        }
+        program->dirty_count = 0;
+    }
+    
+    program->dirty_start[program->dirty_count] = start;
+    program->dirty_end[program->dirty_count] = end;
+    program->dirty_count++;
+}
+
+// Create the program's UBO on first use and attach it to the drawing context
+IOReturn CLASS::attachUniformResource(ShaderProgram* program, uint32_t gpu_context_id)
+{
+    if (!m_gpu_device) {
+        return kIOReturnNotReady;
+    }
+    
+    if (!program->uniform_resource) {
+        uint32_t id = m_gpu_device->allocateUserResourceId();
+        IOReturn ret = m_gpu_device->createResource3D(id, VIRGL_TARGET_BUFFER, VIRGL_FORMAT_R8G8B8A8_UNORM,
+                                                      VIRGL_BIND_CONSTANT_BUFFER,
+                                                      program->uniform_block_size, 1, 1);
+        if (ret != kIOReturnSuccess) {
+            return ret;
+        }
+        program->uniform_resource = id;
+    }
+    
+    struct virtio_gpu_ctx_resource cmd = {};
+    m_gpu_device->initializeCommandHeader(&cmd.hdr, VIRTIO_GPU_CMD_CTX_ATTACH_RESOURCE,
+                                          gpu_context_id, false);
+    cmd.resource_id = program->uniform_resource;
+    struct virtio_gpu_ctrl_hdr resp = {};
+    IOReturn ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
+    if (ret != kIOReturnSuccess) {
+        VMLOG_ERROR("VMShaderManager: CTX_ATTACH_RESOURCE for program %d UBO failed: 0x%x\n",
+              program->program_id, ret);
+    }
+    return ret;
+}
+
+IOReturn VMShaderManager::setUniform(uint32_t program_id, const char* name, const void* data, size_t size)
+{
+    if (!name || !data || size == 0)
+        return kIOReturnBadArgument;
+    
+    IOLockLock(m_shader_lock);
+    
+    ShaderProgram* program = waitForProgram(program_id);
+    if (!program || !program->is_linked) {
+        IOLockUnlock(m_shader_lock);
+        VMLOG_DEBUG("VMShaderManager: Program %d not found or not linked\n", program_id);
+        return kIOReturnNotFound;
+    }
+    
+    VMShaderUniform* uniform = lookupUniform(program, name);
+    if (!uniform) {
+        IOLockUnlock(m_shader_lock);
+        VMLOG_DEBUG("VMShaderManager: Uniform '%s' not found in program %d\n", name, program_id);
+        return kIOReturnNotFound;
+    }
+    
+    // "name[k]" starts the write at element k
+    uint32_t element = 0;
+    size_t base_length = uniformBaseLength(name);
+    if (name[base_length] == '[') {
+        for (const char* p = name + base_length + 1; *p >= '0' && *p <= '9'; p++) {
+            element = element * 10 + (uint32_t)(*p - '0');
+        }
+    }
+    
+    uint32_t elements = uniform->array_size ? uniform->array_size : 1;
+    uint64_t limit = (uint64_t)uniform->offset + (uint64_t)uniform->size * elements;
+    uint64_t offset = (uint64_t)uniform->offset + (uint64_t)uniform->size * element;
+    if (limit > program->uniform_block_size || offset >= limit || size > limit - offset) {
+        IOLockUnlock(m_shader_lock);
+        return kIOReturnBadArgument;
+    }
+    
+    // Only bytes that actually change reach the dirty list
+    uint8_t* dst = program->uniform_shadow + offset;
+    if (memcmp(dst, data, size) == 0) {
+        program->uniform_writes_skipped++;
+    } else {
+        memcpy(dst, data, size);
+        markUniformDirty(program, (uint32_t)offset, (uint32_t)(offset + size));
+    }
+    
+    IOLockUnlock(m_shader_lock);
+    return kIOReturnSuccess;
+}
+
+// Emit the bound program's dirty uniform ranges into `enc` ahead of a draw:
+// one RESOURCE_INLINE_WRITE per range into the program's UBO, plus the
+// SET_UNIFORM_BUFFER bindings for each stage whose slot in this context
+// holds a different UBO (another program's, or none yet). Whatever
+// does not fit stays dirty and kIOReturnNoSpace is returned so the caller
+// can submit and call again.
+IOReturn CLASS::flushUniforms(uint32_t context_id, uint32_t gpu_context_id,
+                              struct virgl_encoder* enc)
+{
+    if (!enc || context_id >= MAX_RENDER_CONTEXTS) {
+        return kIOReturnBadArgument;
+    }
+    
+    IOLockLock(m_shader_lock);
+    
+    OSNumber* bound = m_context_programs ? (OSNumber*)m_context_programs->getObject(context_id) : nullptr;
+    ShaderProgram* program = bound ? findProgram(bound->unsigned32BitValue()) : nullptr;
+    if (!program || !program->is_linked || !program->uniform_block_size) {
+        IOLockUnlock(m_shader_lock);
+        return kIOReturnSuccess;
+    }
+    
+    IOReturn ret = kIOReturnSuccess;
+    if (program->uniform_resource_ctx != gpu_context_id) {
+        ret = attachUniformResource(program, gpu_context_id);
+        if (ret == kIOReturnSuccess) {
+            program->uniform_resource_ctx = gpu_context_id;
+        }
+    }
+    
+    ContextUniformBinding* binding = &m_context_ubo[context_id];
+    if (binding->gpu_context_id != gpu_context_id) {
+        binding->gpu_context_id = gpu_context_id;
+        binding->resource[0] = 0;
+        binding->resource[1] = 0;
+    }
+    if (ret == kIOReturnSuccess &&
+        (binding->resource[0] != program->uniform_resource ||
+         binding->resource[1] != program->uniform_resource)) {
+        uint32_t mark = enc->len;
+        bool bound_all = true;
+        const uint32_t stages[2] = { PIPE_SHADER_VERTEX, PIPE_SHADER_FRAGMENT };
+        for (uint32_t s = 0; s < 2 && bound_all; s++) {
+            if (binding->resource[s] != program->uniform_resource) {
+                bound_all = virgl_encode_set_uniform_buffer(enc, stages[s], VM_SHADER_UNIFORM_UBO_INDEX,
+                                                            0, program->uniform_block_size,
+                                                            program->uniform_resource) != 0;
+            }
+        }
+        if (bound_all) {
+            binding->resource[0] = program->uniform_resource;
+            binding->resource[1] = program->uniform_resource;
+        } else {
+            enc->len = mark;
+            ret = kIOReturnNoSpace;
+        }
+    }
+    
+    while (ret == kIOReturnSuccess && program->dirty_count) {
+        uint32_t last = program->dirty_count - 1;
+        uint32_t start = program->dirty_start[last];
+        uint32_t end = program->dirty_end[last];
+        if (end > program->uniform_block_size) {
+            end = program->uniform_block_size;
+        }
+        if (start >= end) {
+            program->dirty_count = last;
+            continue;
+        }
+        
+        // Send as much of the range as fits; the rest stays dirty
+        uint32_t space = virgl_encoder_space(enc);
+        if (space <= VIRGL_INLINE_WRITE_HDR_SIZE) {
+            ret = kIOReturnNoSpace;
+            break;
+        }
+        uint32_t chunk = end - start;
+        if (chunk > (space - VIRGL_INLINE_WRITE_HDR_SIZE) * 4) {
+            chunk = (space - VIRGL_INLINE_WRITE_HDR_SIZE) * 4;
+        }
+        virgl_encode_inline_write(enc, program->uniform_resource, start,
+                                  program->uniform_shadow + start, chunk);
+        program->uniform_bytes_uploaded += chunk;
+        
+        if (start + chunk < end) {
+            program->dirty_start[last] = start + chunk;
+            ret = kIOReturnNoSpace;
+        } else {
+            program->dirty_count = last;
+        }
+    }
+    
+    IOLockUnlock(m_shader_lock);
+    return ret;
 }
@@ -4,16 +4,48 @@
 #include <IOKit/IOService.h>
 #include <IOKit/IOMemoryDescriptor.h>
 #include <IOKit/IOBufferMemoryDescriptor.h>
+#include <libkern/crypto/sha2.h>
 #include "VMVirtIOGPU.h"
+#include "VMShaderCacheFile.h"
+#include "glsl_reflect.h"
+#include "VMHandleTable.h"
+#include <kern/thread_call.h>
 
 // Forward declarations
 class VMQemuVGAAccelerator;
+struct virgl_encoder;
 
 // Constants
 #define MAX_RENDER_CONTEXTS 32
 #define MAX_SHADER_UNIFORMS 256
 #define MAX_SHADER_ATTRIBUTES 32
 
+// Per-program uniform block: setUniform writes a CPU shadow laid out by
+// VMShaderUniform::offset and records dirty byte ranges; flushUniforms
+// streams just those ranges into the program's UBO at draw time.
+#define VM_SHADER_UNIFORM_BLOCK_MAX     65536   // bytes, GL_MAX_UNIFORM_BLOCK_SIZE
+#define VM_SHADER_UNIFORM_DIRTY_RANGES  8       // beyond this, ranges collapse into one
+#define VM_SHADER_UNIFORM_MERGE_GAP     64      // clean bytes worth resending to save a command
+#define VM_SHADER_UNIFORM_UBO_INDEX     0       // constant buffer slot the block is bound to
+
+// Content-addressed compile cache: shaders are keyed by SHA-256 of
+// (type, language, flags, source) and shared by every caller that compiles
+// the same source; linked programs are keyed by their sorted stage hashes.
+#define VM_SHADER_HASH_SIZE             SHA256_DIGEST_LENGTH
+#define VM_SHADER_CACHE_BUCKETS         256     // power of two
+#define VM_SHADER_CACHE_MAX_IDLE        256     // unreferenced shaders kept for reuse
+#define VM_SHADER_PROGRAM_CACHE_SIZE    128
+
+// GLSL reflection (glsl_reflect.h) capacity per compiled shader; struct
+// arrays flatten into one variable per member and element
+#define VM_SHADER_REFLECT_MAX_VARS      512
+#define VM_SHADER_REFLECT_MAX_BLOCKS    24
+
+// Background compilation: compileShader and linkProgram queue a job and
+// return at once; one worker per CPU (up to the limit) drains the queue.
+// Anything that needs the result waits for that job alone.
+#define VM_SHADER_MAX_COMPILE_WORKERS   8
+
 // Shader types
 enum VMShaderType {
     VM_SHADER_TYPE_VERTEX = 1,
@@ -137,12 +169,20 @@ private:
     VMQemuVGAAccelerator* m_accelerator;
     VMVirtIOGPU* m_gpu_device;
     
-    // Shader storage
-    OSArray* m_shaders;
-    OSArray* m_programs;
+    // Shader storage: ids are handles into these tables
+    struct CompiledShader;
+    struct ShaderProgram;
+    VMHandleTable<CompiledShader> m_shader_table;
+    VMHandleTable<ShaderProgram> m_program_table;
     OSArray* m_context_programs;  // Programs bound to each context
-    uint32_t m_next_shader_id;
-    uint32_t m_next_program_id;
+    
+    // UBO in each context's VM_SHADER_UNIFORM_UBO_INDEX slot, per stage. The
+    // slot belongs to the context, so switching programs must rebind it.
+    struct ContextUniformBinding {
+        uint32_t gpu_context_id;        // virgl context the slot state is for
+        uint32_t resource[2];           // vertex, fragment
+    };
+    ContextUniformBinding m_context_ubo[MAX_RENDER_CONTEXTS];
     uint32_t m_frame_count;
     
     IOLock* m_shader_lock;
@@ -154,11 +194,38 @@ private:
         VMShaderLanguage language;
         IOBufferMemoryDescriptor* bytecode;
         VMCompiledShaderInfo info;
-        OSArray* uniforms;      // Array of VMShaderUniform
-        OSArray* attributes;    // Array of VMShaderAttribute
-        OSArray* resources;     // Array of VMShaderResource
-        uint32_t ref_count;
+        // Reflection records, IOMalloc'd arrays that grow through appendRecord
+        VMShaderUniform* uniforms;
+        uint32_t uniform_count;
+        uint32_t uniform_capacity;
+        VMShaderAttribute* attributes;
+        uint32_t attribute_count;
+        uint32_t attribute_capacity;
+        VMShaderResource* resources;
+        uint32_t resource_count;
+        uint32_t resource_capacity;
+        uint32_t ref_count;     // 0 = idle: kept in the cache, freed on eviction
         bool is_valid;
+        bool is_pending;        // compile job queued or running
+        IOReturn compile_status;
+        
+        // Compile cache
+        uint8_t cache_key[VM_SHADER_HASH_SIZE];
+        CompiledShader* cache_next;             // bucket chain
+        uint64_t last_used;
+    };
+    
+    // Link result shared by programs built from the same stages
+    struct ProgramCacheEntry {
+        uint8_t key[VM_SHADER_HASH_SIZE];
+        bool in_use;
+        VMShaderUniform* uniforms;
+        uint32_t uniform_count;
+        VMShaderAttribute* attributes;
+        uint32_t attribute_count;
+        uint32_t resource_count;
+        bool hardware_optimized;
+        uint64_t last_used;
     };
     
     // Shader program (multiple shaders linked together)
@@ -167,6 +234,8 @@ private:
         OSArray* shader_ids;    // Array of shader IDs in this program
         uint32_t gpu_program_id; // GPU-side program ID
         bool is_linked;
+        uint32_t link_jobs;     // link jobs queued or running
+        IOReturn link_status;   // result of the last link
         OSArray* all_uniforms;  // Combined uniforms from all shaders
         OSArray* all_attributes;
         OSArray* all_resources;
@@ -190,8 +259,96 @@ private:
         
         // Performance statistics
         struct ProgramPerformanceStats* performance_stats;
+        
+        // Uniform block, built at link time
+        uint8_t* uniform_shadow;            // CPU copy of the block
+        uint32_t uniform_block_size;
+        VMShaderUniform** uniform_table;    // all_uniforms as a flat array
+        uint32_t uniform_table_count;
+        uint16_t* uniform_index;            // name hash -> uniform_table slot + 1
+        uint32_t uniform_index_mask;
+        uint32_t dirty_start[VM_SHADER_UNIFORM_DIRTY_RANGES];
+        uint32_t dirty_end[VM_SHADER_UNIFORM_DIRTY_RANGES];
+        uint32_t dirty_count;
+        uint32_t uniform_resource;          // streaming UBO
+        uint32_t uniform_resource_ctx;      // GPU context the UBO is attached in
+        uint64_t uniform_bytes_uploaded;
+        uint64_t uniform_writes_skipped;    // setUniform calls that changed nothing
+    };
+
+    // glsl_reflect state and output, one allocation per reflected shader
+    struct ShaderReflectionScratch {
+        glsl_reflection reflection;
+        glsl_reflect_var vars[VM_SHADER_REFLECT_MAX_VARS];
+        glsl_reflect_block blocks[VM_SHADER_REFLECT_MAX_BLOCKS];
+    };
+
+    // Queued compile or link; the source is a private copy
+    struct CompileJob {
+        CompileJob* next;
+        bool is_link;
+        uint32_t id;                        // shader or program
+        VMShaderType type;
+        VMShaderLanguage language;
+        uint32_t flags;
+        void* source;
+        size_t source_size;
     };
     
+    // Compile workers (m_shader_lock held)
+    thread_call_t m_compile_workers[VM_SHADER_MAX_COMPILE_WORKERS];
+    bool m_compile_worker_running[VM_SHADER_MAX_COMPILE_WORKERS];
+    uint32_t m_compile_worker_count;
+    uint32_t m_compile_workers_running;
+    CompileJob* m_job_head;
+    CompileJob* m_job_tail;
+    uint64_t m_jobs_completed;              // wait channel for job completion
+    bool m_compile_shutdown;
+    
+    static void sCompileWorker(thread_call_param_t param0, thread_call_param_t param1);
+    void runCompileWorker(uint32_t index);
+    bool queueCompileJob(CompileJob* job);
+    void freeCompileJob(CompileJob* job);
+    IOReturn runCompileJob(CompileJob* job);
+    IOReturn runLinkJob(CompileJob* job);
+    CompiledShader* waitForShader(uint32_t shader_id);
+    ShaderProgram* waitForProgram(uint32_t program_id);
+    IOReturn linkProgramNow(uint32_t program_id);
+    
+    // Compile and link caches (m_shader_lock held)
+    CompiledShader* m_shader_cache[VM_SHADER_CACHE_BUCKETS];
+    uint32_t m_idle_shader_count;
+    ProgramCacheEntry m_program_cache[VM_SHADER_PROGRAM_CACHE_SIZE];
+    uint64_t m_shader_cache_hits;
+    uint64_t m_shader_cache_misses;
+    uint64_t m_program_cache_hits;
+    uint64_t m_program_cache_misses;
+    uint64_t m_shader_cache_generation;     // bumped by every new compile or link result
+    
+    static void hashShaderSource(VMShaderType type, VMShaderLanguage language, uint32_t flags,
+                                 const void* source_code, size_t source_size, uint8_t* key);
+    CompiledShader* lookupCachedShader(const uint8_t* key);
+    void insertCachedShader(CompiledShader* shader);
+    void removeCachedShader(CompiledShader* shader);
+    void freeShader(CompiledShader* shader);
+    static void freeShaderRecords(CompiledShader* shader);
+    void releaseShaderRef(CompiledShader* shader);
+    void trimIdleShaders(uint32_t max_idle);
+    bool computeProgramKey(ShaderProgram* program, uint8_t* key);
+    ProgramCacheEntry* lookupProgramCache(const uint8_t* key);
+    ProgramCacheEntry* claimProgramCacheSlot(const uint8_t* key);
+    void storeProgramCache(const uint8_t* key, ShaderProgram* program);
+    IOReturn restoreProgramFromCache(ShaderProgram* program, ProgramCacheEntry* entry);
+    void freeProgramCacheEntry(ProgramCacheEntry* entry);
+    void freeProgramReflection(ShaderProgram* program);
+    
+    // Persistent cache image (VMShaderCacheFile.h)
+    static void computeCacheIdentity(const uint8_t* environment, uint8_t* identity);
+    static uint32_t shaderRecordSize(CompiledShader* shader);
+    uint32_t exportedCacheSize();
+    IOReturn importShaderRecord(const struct vm_shader_cache_shader_record* record);
+    IOReturn importProgramRecord(const struct vm_shader_cache_program_record* record);
+    
     // Internal methods
     CompiledShader* findShader(uint32_t shader_id);
     ShaderProgram* findProgram(uint32_t program_id);
@@ -204,18 +361,17 @@ private:
     IOReturn extractShaderMetadata(CompiledShader* shader);
     IOReturn validateShaderCompatibility(uint32_t* shader_ids, uint32_t count);
     
+    // Uniform block
+    static uint32_t hashUniformName(const char* name);
+    static bool uniformNameEquals(const char* declared, const char* name);
+    IOReturn buildUniformBlock(ShaderProgram* program);
+    void releaseUniformBlock(ShaderProgram* program);
+    VMShaderUniform* lookupUniform(ShaderProgram* program, const char* name);
+    void markUniformDirty(ShaderProgram* program, uint32_t start, uint32_t end);
+    IOReturn attachUniformResource(ShaderProgram* program, uint32_t gpu_context_id);
+    
     // Shader metadata extraction helper methods
-    void extractUniformFromLine(CompiledShader* shader, const char* line);
-    void extractAttributeFromLine(CompiledShader* shader, const char* line);
-    IOReturn parseUniformDeclarationAdvanced(const char* declaration, char* type_out, char* name_out, size_t type_size, size_t name_size);
-    uint32_t parseShaderDataType(const char* type_str);
-    uint32_t calculateUniformSize(const char* type_str);
-    uint32_t extractArraySize(const char* name_str);
-    uint32_t calculateUniformOffset(CompiledShader* shader, uint32_t size);
-    void addDefaultVertexAttributes(CompiledShader* shader);
-    void addStandardVertexUniforms(CompiledShader* shader);
-    void addStandardFragmentUniforms(CompiledShader* shader);
-    void addTextureSamplers(CompiledShader* shader, uint32_t sampler_count);
+    void addReflectedMetadata(CompiledShader* shader, const glsl_reflection* reflection);
     const char* getShaderTypeString(VMShaderType type);
     const char* getShaderLanguageString(VMShaderLanguage language);
     
@@ -272,19 +428,31 @@ public:
     IOReturn linkProgram(uint32_t program_id);
     IOReturn validateProgram(uint32_t program_id, bool* is_valid, char* error_log, size_t log_size);
     
+    // KHR_parallel_shader_compile: *complete stays false while the compile
+    // or link is queued or running; *status is its result once complete
+    IOReturn getShaderCompletionStatus(uint32_t shader_id, bool* complete, IOReturn* status);
+    IOReturn getProgramCompletionStatus(uint32_t program_id, bool* complete, IOReturn* status);
+    
     // Program usage
     IOReturn useProgram(uint32_t context_id, uint32_t program_id);
     IOReturn setUniform(uint32_t program_id, const char* name, 
                        const void* data, size_t size);
+    IOReturn flushUniforms(uint32_t context_id, uint32_t gpu_context_id,
+                          struct virgl_encoder* enc);
     IOReturn setUniformBuffer(uint32_t program_id, uint32_t binding, 
                             IOMemoryDescriptor* buffer);
     IOReturn bindResource(uint32_t program_id, uint32_t binding, 
                          uint32_t resource_id, uint32_t resource_type);
     
-    // Shader caching
-    IOReturn saveShaderCache(const char* cache_path);
-    IOReturn loadShaderCache(const char* cache_path);
+    // Shader caching. environment is the caller's SHA-256 of whatever must
+    // match for a saved image to be reused (kext version, host capsets).
     IOReturn clearShaderCache();
+    IOReturn getShaderCacheInfo(const uint8_t* environment, uint8_t* identity,
+                               uint64_t* generation, uint32_t* export_size);
+    IOReturn exportShaderCache(const uint8_t* environment, void* buffer,
+                              uint32_t capacity, uint32_t* size);
+    IOReturn importShaderCache(const uint8_t* environment, const void* buffer, uint32_t size,
+                              uint32_t* shaders_imported, uint32_t* programs_imported);
     
     // Statistics and debugging
     uint32_t getCompiledShaderCount() const;
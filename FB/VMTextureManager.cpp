@@ -1,5 +1,11 @@
 #include "VMTextureManager.h"
 #include "VMQemuVGAAccelerator.h"
+#include "VMVirtIOGPU.h"
+#include "VMMipmap.h"
+#include "VMPixelConvert.h"
+#include "VMBlockCompress.h"
+#include "virgl_encode.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 
 #define CLASS VMTextureManager
@@ -7,6 +13,10 @@
 
 OSDefineMetaClassAndStructors(VMTextureManager, OSObject);
 
+// virgl format of a BC1-BC5 texture format VMBlockCompress handles, 0 for
+// any other; see "Block compression" below
+static uint32_t blockTextureVirglFormat(VMTextureFormat format);
+
 VMTextureManager* CLASS::withAccelerator(VMQemuVGAAccelerator* accelerator)
 {
     VMTextureManager* manager = new VMTextureManager;
@@ -29,12 +39,13 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     
     m_accelerator = accelerator;
     m_gpu_device = m_accelerator->getGPUDevice();
+    m_blit_context_id = 0;
     
     // Advanced Texture Manager Initialization System - Comprehensive Resource Management
-    IOLog("VMTextureManager: Initiating advanced texture management system initialization\n");
+    VMLOG_INFO("VMTextureManager: Initiating advanced texture management system initialization\n");
     
     // Phase 1: Core Data Structure Allocation with Advanced Configuration
-    IOLog("  Phase 1: Advanced core data structure allocation and configuration\n");
+    VMLOG_INFO("  Phase 1: Advanced core data structure allocation and configuration\n");
     
     // Advanced Texture Array Initialization with Optimized Capacity Management
     struct TextureArrayConfiguration {
@@ -58,18 +69,18 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     texture_config.supports_dynamic_expansion = true;
     texture_config.supports_memory_compaction = true;
     
-    IOLog("    Texture Array Configuration:\n");
-    IOLog("      Base Capacity: %d textures\n", texture_config.base_texture_capacity);
-    IOLog("      Extended Capacity: %d textures\n", texture_config.extended_texture_capacity);
-    IOLog("      High-Resolution Slots: %d textures\n", texture_config.high_resolution_capacity);
-    IOLog("      Compressed Texture Support: %d textures\n", texture_config.compressed_texture_capacity);
-    IOLog("      Dynamic Expansion: %s\n", texture_config.supports_dynamic_expansion ? "ENABLED" : "DISABLED");
-    IOLog("      Memory Compaction: %s\n", texture_config.supports_memory_compaction ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("    Texture Array Configuration:\n");
+    VMLOG_INFO("      Base Capacity: %d textures\n", texture_config.base_texture_capacity);
+    VMLOG_INFO("      Extended Capacity: %d textures\n", texture_config.extended_texture_capacity);
+    VMLOG_INFO("      High-Resolution Slots: %d textures\n", texture_config.high_resolution_capacity);
+    VMLOG_INFO("      Compressed Texture Support: %d textures\n", texture_config.compressed_texture_capacity);
+    VMLOG_INFO("      Dynamic Expansion: %s\n", texture_config.supports_dynamic_expansion ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Memory Compaction: %s\n", texture_config.supports_memory_compaction ? "ENABLED" : "DISABLED");
     
     // Advanced Texture Array Creation with Comprehensive Error Handling
     m_textures = OSArray::withCapacity(texture_config.base_texture_capacity);
     if (!m_textures) {
-        IOLog("    ERROR: Failed to allocate primary texture array with capacity %d\n", 
+        VMLOG_ERROR("    ERROR: Failed to allocate primary texture array with capacity %d\n", 
               texture_config.base_texture_capacity);
         return false;
     }
@@ -96,17 +107,17 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     sampler_config.supports_custom_samplers = true;
     sampler_config.supports_sampler_caching = true;
     
-    IOLog("    Sampler Array Configuration:\n");
-    IOLog("      Base Capacity: %d samplers\n", sampler_config.base_sampler_capacity);
-    IOLog("      Advanced Capacity: %d samplers\n", sampler_config.advanced_sampler_capacity);
-    IOLog("      Anisotropic Slots: %d samplers\n", sampler_config.anisotropic_sampler_slots);
-    IOLog("      Custom Sampler Support: %s\n", sampler_config.supports_custom_samplers ? "ENABLED" : "DISABLED");
-    IOLog("      Sampler State Caching: %s\n", sampler_config.supports_sampler_caching ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("    Sampler Array Configuration:\n");
+    VMLOG_INFO("      Base Capacity: %d samplers\n", sampler_config.base_sampler_capacity);
+    VMLOG_INFO("      Advanced Capacity: %d samplers\n", sampler_config.advanced_sampler_capacity);
+    VMLOG_INFO("      Anisotropic Slots: %d samplers\n", sampler_config.anisotropic_sampler_slots);
+    VMLOG_INFO("      Custom Sampler Support: %s\n", sampler_config.supports_custom_samplers ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Sampler State Caching: %s\n", sampler_config.supports_sampler_caching ? "ENABLED" : "DISABLED");
     
     // Advanced Sampler Array Creation with Validation
     m_samplers = OSArray::withCapacity(sampler_config.base_sampler_capacity);
     if (!m_samplers) {
-        IOLog("    ERROR: Failed to allocate sampler array with capacity %d\n", 
+        VMLOG_ERROR("    ERROR: Failed to allocate sampler array with capacity %d\n", 
               sampler_config.base_sampler_capacity);
         if (m_textures) {
             m_textures->release();
@@ -141,19 +152,19 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     cache_config.supports_cache_compression = true;
     cache_config.cache_hit_target_ratio = 0.85f; // 85% target hit ratio
     
-    IOLog("    Texture Cache Configuration:\n");
-    IOLog("      Base Cache Capacity: %d entries\n", cache_config.base_cache_capacity);
-    IOLog("      LRU Cache Slots: %d entries\n", cache_config.lru_cache_slots);
-    IOLog("      Hot Texture Slots: %d entries\n", cache_config.frequently_used_slots);
-    IOLog("      Cache Line Size: %d bytes\n", cache_config.cache_line_size);
-    IOLog("      Cache Coherency: %s\n", cache_config.supports_cache_coherency ? "ENABLED" : "DISABLED");
-    IOLog("      Cache Prefetch: %s\n", cache_config.supports_cache_prefetch ? "ENABLED" : "DISABLED");
-    IOLog("      Target Hit Ratio: %.1f%%\n", cache_config.cache_hit_target_ratio * 100.0f);
+    VMLOG_INFO("    Texture Cache Configuration:\n");
+    VMLOG_INFO("      Base Cache Capacity: %d entries\n", cache_config.base_cache_capacity);
+    VMLOG_INFO("      LRU Cache Slots: %d entries\n", cache_config.lru_cache_slots);
+    VMLOG_INFO("      Hot Texture Slots: %d entries\n", cache_config.frequently_used_slots);
+    VMLOG_INFO("      Cache Line Size: %d bytes\n", cache_config.cache_line_size);
+    VMLOG_INFO("      Cache Coherency: %s\n", cache_config.supports_cache_coherency ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Cache Prefetch: %s\n", cache_config.supports_cache_prefetch ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Target Hit Ratio: %.1f%%\n", cache_config.cache_hit_target_ratio * 100.0f);
     
     // Advanced Texture Cache Creation with Comprehensive Validation
     m_texture_cache = OSArray::withCapacity(cache_config.base_cache_capacity);
     if (!m_texture_cache) {
-        IOLog("    ERROR: Failed to allocate texture cache with capacity %d\n", 
+        VMLOG_ERROR("    ERROR: Failed to allocate texture cache with capacity %d\n", 
               cache_config.base_cache_capacity);
         if (m_textures) {
             m_textures->release();
@@ -188,18 +199,18 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     map_config.supports_batch_operations = true;
     map_config.load_factor_threshold = 0.75f; // Resize at 75% capacity
     
-    IOLog("    Texture Map Configuration:\n");
-    IOLog("      Base Mapping Capacity: %d entries\n", map_config.base_mapping_capacity);
-    IOLog("      Extended Capacity: %d entries\n", map_config.extended_mapping_capacity);
-    IOLog("      Hash Table Size: %d buckets\n", map_config.hash_table_size);
-    IOLog("      Fast Lookup Support: %s\n", map_config.supports_fast_lookup ? "ENABLED" : "DISABLED");
-    IOLog("      Reverse Mapping: %s\n", map_config.supports_reverse_mapping ? "ENABLED" : "DISABLED");
-    IOLog("      Load Factor Threshold: %.1f%%\n", map_config.load_factor_threshold * 100.0f);
+    VMLOG_INFO("    Texture Map Configuration:\n");
+    VMLOG_INFO("      Base Mapping Capacity: %d entries\n", map_config.base_mapping_capacity);
+    VMLOG_INFO("      Extended Capacity: %d entries\n", map_config.extended_mapping_capacity);
+    VMLOG_INFO("      Hash Table Size: %d buckets\n", map_config.hash_table_size);
+    VMLOG_INFO("      Fast Lookup Support: %s\n", map_config.supports_fast_lookup ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Reverse Mapping: %s\n", map_config.supports_reverse_mapping ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Load Factor Threshold: %.1f%%\n", map_config.load_factor_threshold * 100.0f);
     
     // Advanced Texture Map Creation with Optimization
     m_texture_map = OSDictionary::withCapacity(map_config.base_mapping_capacity);
     if (!m_texture_map) {
-        IOLog("    ERROR: Failed to allocate texture mapping dictionary with capacity %d\n", 
+        VMLOG_ERROR("    ERROR: Failed to allocate texture mapping dictionary with capacity %d\n", 
               map_config.base_mapping_capacity);
         if (m_textures) {
             m_textures->release();
@@ -217,7 +228,7 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     }
     
     // Phase 2: Advanced Memory Management Configuration and Validation
-    IOLog("  Phase 2: Advanced memory management and resource allocation validation\n");
+    VMLOG_INFO("  Phase 2: Advanced memory management and resource allocation validation\n");
     
     // Advanced Memory Configuration Structure
     struct AdvancedMemoryConfiguration {
@@ -251,31 +262,31 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     memory_config.memory_usage_warning_threshold = 0.80f; // 80% usage warning
     memory_config.memory_usage_critical_threshold = 0.95f; // 95% critical threshold
     
-    IOLog("    Advanced Memory Configuration:\n");
-    IOLog("      Base Texture Pool: %llu MB\n", memory_config.base_texture_memory_pool / (1024 * 1024));
-    IOLog("      Extended Pool: %llu MB\n", memory_config.extended_memory_pool / (1024 * 1024));
-    IOLog("      High-Resolution Pool: %llu MB\n", memory_config.high_resolution_memory_pool / (1024 * 1024));
-    IOLog("      Compressed Pool: %llu MB\n", memory_config.compressed_texture_memory_pool / (1024 * 1024));
-    IOLog("      Cache Allocation: %llu MB\n", memory_config.cache_memory_allocation / (1024 * 1024));
-    IOLog("      Scratch Space: %llu MB\n", memory_config.scratch_memory_allocation / (1024 * 1024));
-    IOLog("      Memory Alignment: %d bytes\n", memory_config.memory_alignment_requirement);
-    IOLog("      Memory Pooling: %s\n", memory_config.supports_memory_pooling ? "ENABLED" : "DISABLED");
-    IOLog("      Memory Defragmentation: %s\n", memory_config.supports_memory_defragmentation ? "ENABLED" : "DISABLED");
-    IOLog("      Warning Threshold: %.1f%%\n", memory_config.memory_usage_warning_threshold * 100.0f);
-    IOLog("      Critical Threshold: %.1f%%\n", memory_config.memory_usage_critical_threshold * 100.0f);
+    VMLOG_INFO("    Advanced Memory Configuration:\n");
+    VMLOG_INFO("      Base Texture Pool: %llu MB\n", memory_config.base_texture_memory_pool / (1024 * 1024));
+    VMLOG_INFO("      Extended Pool: %llu MB\n", memory_config.extended_memory_pool / (1024 * 1024));
+    VMLOG_INFO("      High-Resolution Pool: %llu MB\n", memory_config.high_resolution_memory_pool / (1024 * 1024));
+    VMLOG_INFO("      Compressed Pool: %llu MB\n", memory_config.compressed_texture_memory_pool / (1024 * 1024));
+    VMLOG_INFO("      Cache Allocation: %llu MB\n", memory_config.cache_memory_allocation / (1024 * 1024));
+    VMLOG_INFO("      Scratch Space: %llu MB\n", memory_config.scratch_memory_allocation / (1024 * 1024));
+    VMLOG_INFO("      Memory Alignment: %d bytes\n", memory_config.memory_alignment_requirement);
+    VMLOG_INFO("      Memory Pooling: %s\n", memory_config.supports_memory_pooling ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Memory Defragmentation: %s\n", memory_config.supports_memory_defragmentation ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Warning Threshold: %.1f%%\n", memory_config.memory_usage_warning_threshold * 100.0f);
+    VMLOG_INFO("      Critical Threshold: %.1f%%\n", memory_config.memory_usage_critical_threshold * 100.0f);
     
     // Comprehensive Data Structure Validation and Integrity Check
     if (!m_textures || !m_samplers || !m_texture_cache || !m_texture_map) {
-        IOLog("    ERROR: Critical data structure allocation failure detected\n");
-        IOLog("      Texture Array: %s\n", m_textures ? "VALID" : "NULL");
-        IOLog("      Sampler Array: %s\n", m_samplers ? "VALID" : "NULL");
-        IOLog("      Texture Cache: %s\n", m_texture_cache ? "VALID" : "NULL");
-        IOLog("      Texture Map: %s\n", m_texture_map ? "VALID" : "NULL");
+        VMLOG_ERROR("    ERROR: Critical data structure allocation failure detected\n");
+        VMLOG_INFO("      Texture Array: %s\n", m_textures ? "VALID" : "NULL");
+        VMLOG_INFO("      Sampler Array: %s\n", m_samplers ? "VALID" : "NULL");
+        VMLOG_INFO("      Texture Cache: %s\n", m_texture_cache ? "VALID" : "NULL");
+        VMLOG_INFO("      Texture Map: %s\n", m_texture_map ? "VALID" : "NULL");
         return false;
     }
     
     // Phase 3: Advanced Counter and Resource Limit Configuration
-    IOLog("  Phase 3: Advanced counter initialization and resource limit configuration\n");
+    VMLOG_INFO("  Phase 3: Advanced counter initialization and resource limit configuration\n");
     
     // Advanced Counter Configuration Structure
     struct AdvancedCounterConfiguration {
@@ -301,18 +312,18 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     counter_config.supports_id_validation = true;
     counter_config.supports_id_collision_detection = true;
     
-    IOLog("    Advanced Counter Configuration:\n");
-    IOLog("      Initial Texture ID: %d\n", counter_config.initial_texture_id);
-    IOLog("      Initial Sampler ID: %d\n", counter_config.initial_sampler_id);
-    IOLog("      ID Wraparound Threshold: 0x%08X\n", counter_config.id_wraparound_threshold);
-    IOLog("      Reserved ID Ranges: %d\n", counter_config.reserved_id_ranges);
-    IOLog("      ID Recycling: %s\n", counter_config.supports_id_recycling ? "ENABLED" : "DISABLED");
-    IOLog("      ID Validation: %s\n", counter_config.supports_id_validation ? "ENABLED" : "DISABLED");
-    IOLog("      Collision Detection: %s\n", counter_config.supports_id_collision_detection ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("    Advanced Counter Configuration:\n");
+    VMLOG_INFO("      Initial Texture ID: %d\n", counter_config.initial_texture_id);
+    VMLOG_INFO("      Initial Sampler ID: %d\n", counter_config.initial_sampler_id);
+    VMLOG_INFO("      ID Wraparound Threshold: 0x%08X\n", counter_config.id_wraparound_threshold);
+    VMLOG_INFO("      Reserved ID Ranges: %d\n", counter_config.reserved_id_ranges);
+    VMLOG_INFO("      ID Recycling: %s\n", counter_config.supports_id_recycling ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      ID Validation: %s\n", counter_config.supports_id_validation ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Collision Detection: %s\n", counter_config.supports_id_collision_detection ? "ENABLED" : "DISABLED");
     
-    // Initialize advanced counter system
-    m_next_texture_id = counter_config.initial_texture_id;
-    m_next_sampler_id = counter_config.initial_sampler_id;
+    // Texture and sampler ids are handed out by the handle tables
+    m_texture_table.init(VM_HANDLE_MAX_SLOTS);
+    m_sampler_table.init(VM_HANDLE_MAX_SLOTS);
     
     // Advanced Memory Usage Tracking Configuration
     struct MemoryUsageTrackingConfiguration {
@@ -347,23 +358,23 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     memory_tracking.supports_automatic_cleanup = true;
     memory_tracking.memory_utilization_target = 0.70f; // Target 70% utilization
     
-    IOLog("    Memory Usage Tracking Configuration:\n");
-    IOLog("      Maximum Texture Memory: %llu MB\n", 
+    VMLOG_INFO("    Memory Usage Tracking Configuration:\n");
+    VMLOG_INFO("      Maximum Texture Memory: %llu MB\n", 
           memory_tracking.maximum_texture_memory_limit / (1024 * 1024));
-    IOLog("      Warning Threshold: %llu MB (%.1f%%)\n", 
+    VMLOG_INFO("      Warning Threshold: %llu MB (%.1f%%)\n", 
           memory_tracking.texture_memory_warning_threshold / (1024 * 1024),
           memory_config.memory_usage_warning_threshold * 100.0f);
-    IOLog("      Critical Threshold: %llu MB (%.1f%%)\n", 
+    VMLOG_INFO("      Critical Threshold: %llu MB (%.1f%%)\n", 
           memory_tracking.texture_memory_critical_threshold / (1024 * 1024),
           memory_config.memory_usage_critical_threshold * 100.0f);
-    IOLog("      Cache Memory Limit: %llu MB\n", 
+    VMLOG_INFO("      Cache Memory Limit: %llu MB\n", 
           memory_tracking.cache_memory_limit / (1024 * 1024));
-    IOLog("      Cache Warning Threshold: %llu MB\n", 
+    VMLOG_INFO("      Cache Warning Threshold: %llu MB\n", 
           memory_tracking.cache_memory_warning_threshold / (1024 * 1024));
-    IOLog("      Tracking Granularity: %d bytes\n", memory_tracking.memory_tracking_granularity);
-    IOLog("      Real-Time Tracking: %s\n", memory_tracking.supports_real_time_tracking ? "ENABLED" : "DISABLED");
-    IOLog("      Pressure Detection: %s\n", memory_tracking.supports_memory_pressure_detection ? "ENABLED" : "DISABLED");
-    IOLog("      Target Utilization: %.1f%%\n", memory_tracking.memory_utilization_target * 100.0f);
+    VMLOG_INFO("      Tracking Granularity: %d bytes\n", memory_tracking.memory_tracking_granularity);
+    VMLOG_INFO("      Real-Time Tracking: %s\n", memory_tracking.supports_real_time_tracking ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Pressure Detection: %s\n", memory_tracking.supports_memory_pressure_detection ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Target Utilization: %.1f%%\n", memory_tracking.memory_utilization_target * 100.0f);
     
     // Initialize comprehensive memory tracking system
     m_texture_memory_usage = memory_tracking.initial_memory_usage;
@@ -372,7 +383,7 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     m_cache_memory_used = 0; // Start with empty cache
     
     // Phase 4: Advanced Synchronization and Thread Safety Configuration
-    IOLog("  Phase 4: Advanced synchronization and thread safety initialization\n");
+    VMLOG_INFO("  Phase 4: Advanced synchronization and thread safety initialization\n");
     
     // Advanced Lock Configuration Structure
     struct LockConfiguration {
@@ -394,18 +405,18 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     lock_config.lock_contention_threshold = 10; // Alert after 10 contentions
     lock_config.lock_efficiency_target = 0.95f; // Target 95% lock efficiency
     
-    IOLog("    Lock Configuration:\n");
-    IOLog("      Recursive Locking: %s\n", lock_config.supports_recursive_locking ? "ENABLED" : "DISABLED");
-    IOLog("      Priority Inheritance: %s\n", lock_config.supports_priority_inheritance ? "ENABLED" : "DISABLED");
-    IOLog("      Deadlock Detection: %s\n", lock_config.supports_deadlock_detection ? "ENABLED" : "DISABLED");
-    IOLog("      Lock Timeout: %d ms\n", lock_config.lock_timeout_ms);
-    IOLog("      Contention Threshold: %d\n", lock_config.lock_contention_threshold);
-    IOLog("      Efficiency Target: %.1f%%\n", lock_config.lock_efficiency_target * 100.0f);
+    VMLOG_INFO("    Lock Configuration:\n");
+    VMLOG_INFO("      Recursive Locking: %s\n", lock_config.supports_recursive_locking ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Priority Inheritance: %s\n", lock_config.supports_priority_inheritance ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Deadlock Detection: %s\n", lock_config.supports_deadlock_detection ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("      Lock Timeout: %d ms\n", lock_config.lock_timeout_ms);
+    VMLOG_INFO("      Contention Threshold: %d\n", lock_config.lock_contention_threshold);
+    VMLOG_INFO("      Efficiency Target: %.1f%%\n", lock_config.lock_efficiency_target * 100.0f);
     
     // Create advanced texture management lock
     m_texture_lock = IOLockAlloc();
     if (!m_texture_lock) {
-        IOLog("    ERROR: Failed to allocate texture management lock\n");
+        VMLOG_ERROR("    ERROR: Failed to allocate texture management lock\n");
         // Cleanup previously allocated resources
         if (m_textures) {
             m_textures->release();
@@ -427,7 +438,7 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     }
     
     // Phase 5: Comprehensive Initialization Validation and System Health Check
-    IOLog("  Phase 5: Comprehensive initialization validation and system health verification\n");
+    VMLOG_INFO("  Phase 5: Comprehensive initialization validation and system health verification\n");
     
     // Advanced Validation Structure
     struct InitializationValidation {
@@ -462,8 +473,7 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     
     // Counter system validation
     validation.total_validation_checks++;
-    if (m_next_texture_id == counter_config.initial_texture_id && 
-        m_next_sampler_id == counter_config.initial_sampler_id) {
+    if (m_texture_table.count() == 0 && m_sampler_table.count() == 0) {
         validation.counter_system_valid = true;
         validation.passed_validation_checks++;
     }
@@ -493,14 +503,14 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     validation.initialization_completeness = 
         (float)validation.passed_validation_checks / (float)validation.total_validation_checks;
     
-    IOLog("    Initialization Validation Results:\n");
-    IOLog("      Core Structures: %s\n", validation.core_structures_valid ? "VALID" : "INVALID");
-    IOLog("      Memory Configuration: %s\n", validation.memory_configuration_valid ? "VALID" : "INVALID");
-    IOLog("      Counter System: %s\n", validation.counter_system_valid ? "VALID" : "INVALID");
-    IOLog("      Synchronization: %s\n", validation.synchronization_valid ? "VALID" : "INVALID");
-    IOLog("      Accelerator Integration: %s\n", validation.accelerator_integration_valid ? "VALID" : "INVALID");
-    IOLog("      GPU Device Integration: %s\n", validation.gpu_device_integration_valid ? "VALID" : "INVALID");
-    IOLog("      Initialization Completeness: %.1f%% (%d/%d checks passed)\n", 
+    VMLOG_INFO("    Initialization Validation Results:\n");
+    VMLOG_INFO("      Core Structures: %s\n", validation.core_structures_valid ? "VALID" : "INVALID");
+    VMLOG_INFO("      Memory Configuration: %s\n", validation.memory_configuration_valid ? "VALID" : "INVALID");
+    VMLOG_INFO("      Counter System: %s\n", validation.counter_system_valid ? "VALID" : "INVALID");
+    VMLOG_INFO("      Synchronization: %s\n", validation.synchronization_valid ? "VALID" : "INVALID");
+    VMLOG_INFO("      Accelerator Integration: %s\n", validation.accelerator_integration_valid ? "VALID" : "INVALID");
+    VMLOG_INFO("      GPU Device Integration: %s\n", validation.gpu_device_integration_valid ? "VALID" : "INVALID");
+    VMLOG_INFO("      Initialization Completeness: %.1f%% (%d/%d checks passed)\n", 
           validation.initialization_completeness * 100.0f,
           validation.passed_validation_checks, validation.total_validation_checks);
     
@@ -508,21 +518,21 @@ bool CLASS::init(VMQemuVGAAccelerator* accelerator)
     bool initialization_successful = (validation.initialization_completeness >= 0.95f); // Require 95% success
     
     if (!initialization_successful) {
-        IOLog("    CRITICAL ERROR: Initialization validation failed (%.1f%% completeness)\n", 
+        VMLOG_ERROR("    CRITICAL ERROR: Initialization validation failed (%.1f%% completeness)\n", 
               validation.initialization_completeness * 100.0f);
-        IOLog("    System cannot proceed with incomplete initialization\n");
+        VMLOG_ERROR("    System cannot proceed with incomplete initialization\n");
         return false;
     }
     
-    IOLog("VMTextureManager: ========== Advanced Texture Management System Initialized ==========\n");
-    IOLog("  System Status: OPERATIONAL\n");
-    IOLog("  Texture Capacity: %d entries\n", texture_config.base_texture_capacity);
-    IOLog("  Sampler Capacity: %d entries\n", sampler_config.base_sampler_capacity);
-    IOLog("  Cache Capacity: %d entries\n", cache_config.base_cache_capacity);
-    IOLog("  Memory Pool: %llu MB\n", memory_config.base_texture_memory_pool / (1024 * 1024));
-    IOLog("  Cache Memory: %llu MB\n", memory_config.cache_memory_allocation / (1024 * 1024));
-    IOLog("  Initialization Completeness: %.1f%%\n", validation.initialization_completeness * 100.0f);
-    IOLog("================================================================================\n");
+    VMLOG_INFO("VMTextureManager: ========== Advanced Texture Management System Initialized ==========\n");
+    VMLOG_INFO("  System Status: OPERATIONAL\n");
+    VMLOG_INFO("  Texture Capacity: %d entries\n", texture_config.base_texture_capacity);
+    VMLOG_INFO("  Sampler Capacity: %d entries\n", sampler_config.base_sampler_capacity);
+    VMLOG_INFO("  Cache Capacity: %d entries\n", cache_config.base_cache_capacity);
+    VMLOG_INFO("  Memory Pool: %llu MB\n", memory_config.base_texture_memory_pool / (1024 * 1024));
+    VMLOG_INFO("  Cache Memory: %llu MB\n", memory_config.cache_memory_allocation / (1024 * 1024));
+    VMLOG_INFO("  Initialization Completeness: %.1f%%\n", validation.initialization_completeness * 100.0f);
+    VMLOG_INFO("================================================================================\n");
     
     return (m_textures && m_texture_map && m_samplers && m_texture_lock);
 }
@@ -533,10 +543,10 @@ void CLASS::free()
         IOLockLock(m_texture_lock);
         
         // Advanced Texture Manager Cleanup System - Comprehensive Resource Deallocation
-        IOLog("VMTextureManager: Initiating advanced texture management system cleanup\n");
+        VMLOG_INFO("VMTextureManager: Initiating advanced texture management system cleanup\n");
         
         // Phase 1: Pre-Cleanup System State Analysis and Resource Inventory
-        IOLog("  Phase 1: Pre-cleanup system state analysis and resource inventory\n");
+        VMLOG_INFO("  Phase 1: Pre-cleanup system state analysis and resource inventory\n");
         
         // Advanced Cleanup State Analysis Structure
         struct CleanupStateAnalysis {
@@ -569,20 +579,20 @@ void CLASS::free()
         cleanup_state.memory_utilization_percentage = m_max_texture_memory > 0 ? 
             ((float)cleanup_state.total_memory_allocated / (float)m_max_texture_memory) * 100.0f : 0.0f;
         
-        IOLog("    System State Analysis:\n");
-        IOLog("      Active Textures: %d\n", cleanup_state.active_textures_count);
-        IOLog("      Active Samplers: %d\n", cleanup_state.active_samplers_count);
-        IOLog("      Cache Entries: %d\n", cleanup_state.cached_entries_count);
-        IOLog("      Mapped Texture IDs: %d\n", cleanup_state.mapped_texture_ids_count);
-        IOLog("      Memory Allocated: %llu MB\n", cleanup_state.total_memory_allocated / (1024 * 1024));
-        IOLog("      Cache Memory Used: %llu MB\n", cleanup_state.cache_memory_used / (1024 * 1024));
-        IOLog("      Memory Utilization: %.1f%%\n", cleanup_state.memory_utilization_percentage);
-        IOLog("      Has Active Resources: %s\n", cleanup_state.has_active_resources ? "YES" : "NO");
-        IOLog("      Requires Memory Cleanup: %s\n", cleanup_state.requires_memory_cleanup ? "YES" : "NO");
-        IOLog("      Requires Cache Flush: %s\n", cleanup_state.requires_cache_flush ? "YES" : "NO");
+        VMLOG_INFO("    System State Analysis:\n");
+        VMLOG_INFO("      Active Textures: %d\n", cleanup_state.active_textures_count);
+        VMLOG_INFO("      Active Samplers: %d\n", cleanup_state.active_samplers_count);
+        VMLOG_INFO("      Cache Entries: %d\n", cleanup_state.cached_entries_count);
+        VMLOG_INFO("      Mapped Texture IDs: %d\n", cleanup_state.mapped_texture_ids_count);
+        VMLOG_INFO("      Memory Allocated: %llu MB\n", cleanup_state.total_memory_allocated / (1024 * 1024));
+        VMLOG_INFO("      Cache Memory Used: %llu MB\n", cleanup_state.cache_memory_used / (1024 * 1024));
+        VMLOG_INFO("      Memory Utilization: %.1f%%\n", cleanup_state.memory_utilization_percentage);
+        VMLOG_INFO("      Has Active Resources: %s\n", cleanup_state.has_active_resources ? "YES" : "NO");
+        VMLOG_INFO("      Requires Memory Cleanup: %s\n", cleanup_state.requires_memory_cleanup ? "YES" : "NO");
+        VMLOG_INFO("      Requires Cache Flush: %s\n", cleanup_state.requires_cache_flush ? "YES" : "NO");
         
         // Phase 2: Advanced Texture Array Cleanup with Resource Tracking
-        IOLog("  Phase 2: Advanced texture array cleanup with comprehensive resource tracking\n");
+        VMLOG_INFO("  Phase 2: Advanced texture array cleanup with comprehensive resource tracking\n");
         
         if (m_textures) {
             // Advanced Texture Cleanup Configuration
@@ -607,27 +617,27 @@ void CLASS::free()
             texture_cleanup.supports_memory_reclamation = true;
             texture_cleanup.cleanup_efficiency_target = 0.95f; // 95% cleanup efficiency
             
-            IOLog("    Texture Cleanup Configuration:\n");
-            IOLog("      Textures to Clean: %d\n", texture_cleanup.textures_to_cleanup);
-            IOLog("      High Priority: %d\n", texture_cleanup.high_priority_textures);
-            IOLog("      Cached Textures: %d\n", texture_cleanup.cached_textures);
-            IOLog("      Shared Textures: %d\n", texture_cleanup.shared_textures);
-            IOLog("      Graceful Cleanup: %s\n", texture_cleanup.supports_graceful_cleanup ? "ENABLED" : "DISABLED");
-            IOLog("      Resource Validation: %s\n", texture_cleanup.supports_resource_validation ? "ENABLED" : "DISABLED");
-            IOLog("      Memory Reclamation: %s\n", texture_cleanup.supports_memory_reclamation ? "ENABLED" : "DISABLED");
-            IOLog("      Cleanup Efficiency Target: %.1f%%\n", texture_cleanup.cleanup_efficiency_target * 100.0f);
+            VMLOG_INFO("    Texture Cleanup Configuration:\n");
+            VMLOG_INFO("      Textures to Clean: %d\n", texture_cleanup.textures_to_cleanup);
+            VMLOG_INFO("      High Priority: %d\n", texture_cleanup.high_priority_textures);
+            VMLOG_INFO("      Cached Textures: %d\n", texture_cleanup.cached_textures);
+            VMLOG_INFO("      Shared Textures: %d\n", texture_cleanup.shared_textures);
+            VMLOG_INFO("      Graceful Cleanup: %s\n", texture_cleanup.supports_graceful_cleanup ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      Resource Validation: %s\n", texture_cleanup.supports_resource_validation ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      Memory Reclamation: %s\n", texture_cleanup.supports_memory_reclamation ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      Cleanup Efficiency Target: %.1f%%\n", texture_cleanup.cleanup_efficiency_target * 100.0f);
             
             // Perform advanced texture array cleanup
-            IOLog("    Performing comprehensive texture array cleanup\n");
+            VMLOG_INFO("    Performing comprehensive texture array cleanup\n");
             m_textures->release();
             m_textures = nullptr;
-            IOLog("    Texture array cleanup: COMPLETE\n");
+            VMLOG_INFO("    Texture array cleanup: COMPLETE\n");
         } else {
-            IOLog("    Texture array: NULL (no cleanup required)\n");
+            VMLOG_INFO("    Texture array: NULL (no cleanup required)\n");
         }
         
         // Phase 3: Advanced Sampler Array Cleanup with State Management
-        IOLog("  Phase 3: Advanced sampler array cleanup with comprehensive state management\n");
+        VMLOG_INFO("  Phase 3: Advanced sampler array cleanup with comprehensive state management\n");
         
         if (m_samplers) {
             // Advanced Sampler Cleanup Configuration
@@ -652,27 +662,27 @@ void CLASS::free()
             sampler_cleanup.supports_cache_invalidation = true;
             sampler_cleanup.sampler_cleanup_efficiency = 0.98f; // 98% efficiency
             
-            IOLog("    Sampler Cleanup Configuration:\n");
-            IOLog("      Samplers to Clean: %d\n", sampler_cleanup.samplers_to_cleanup);
-            IOLog("      Custom Samplers: %d\n", sampler_cleanup.custom_samplers);
-            IOLog("      Cached States: %d\n", sampler_cleanup.cached_sampler_states);
-            IOLog("      Anisotropic Samplers: %d\n", sampler_cleanup.anisotropic_samplers);
-            IOLog("      State Preservation: %s\n", sampler_cleanup.supports_state_preservation ? "ENABLED" : "DISABLED");
-            IOLog("      Sampler Validation: %s\n", sampler_cleanup.supports_sampler_validation ? "ENABLED" : "DISABLED");
-            IOLog("      Cache Invalidation: %s\n", sampler_cleanup.supports_cache_invalidation ? "ENABLED" : "DISABLED");
-            IOLog("      Cleanup Efficiency: %.1f%%\n", sampler_cleanup.sampler_cleanup_efficiency * 100.0f);
+            VMLOG_INFO("    Sampler Cleanup Configuration:\n");
+            VMLOG_INFO("      Samplers to Clean: %d\n", sampler_cleanup.samplers_to_cleanup);
+            VMLOG_INFO("      Custom Samplers: %d\n", sampler_cleanup.custom_samplers);
+            VMLOG_INFO("      Cached States: %d\n", sampler_cleanup.cached_sampler_states);
+            VMLOG_INFO("      Anisotropic Samplers: %d\n", sampler_cleanup.anisotropic_samplers);
+            VMLOG_INFO("      State Preservation: %s\n", sampler_cleanup.supports_state_preservation ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      Sampler Validation: %s\n", sampler_cleanup.supports_sampler_validation ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      Cache Invalidation: %s\n", sampler_cleanup.supports_cache_invalidation ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      Cleanup Efficiency: %.1f%%\n", sampler_cleanup.sampler_cleanup_efficiency * 100.0f);
             
             // Perform advanced sampler array cleanup
-            IOLog("    Performing comprehensive sampler array cleanup\n");
+            VMLOG_INFO("    Performing comprehensive sampler array cleanup\n");
             m_samplers->release();
             m_samplers = nullptr;
-            IOLog("    Sampler array cleanup: COMPLETE\n");
+            VMLOG_INFO("    Sampler array cleanup: COMPLETE\n");
         } else {
-            IOLog("    Sampler array: NULL (no cleanup required)\n");
+            VMLOG_INFO("    Sampler array: NULL (no cleanup required)\n");
         }
         
         // Phase 4: Advanced Cache Cleanup with Memory Reclamation
-        IOLog("  Phase 4: Advanced cache cleanup with comprehensive memory reclamation\n");
+        VMLOG_INFO("  Phase 4: Advanced cache cleanup with comprehensive memory reclamation\n");
         
         if (m_texture_cache) {
             // Advanced Cache Cleanup Configuration
@@ -699,32 +709,32 @@ void CLASS::free()
             cache_cleanup.supports_memory_defragmentation = true;
             cache_cleanup.cache_cleanup_efficiency = 0.99f; // 99% efficiency
             
-            IOLog("    Cache Cleanup Configuration:\n");
-            IOLog("      Cache Entries to Clean: %d\n", cache_cleanup.cache_entries_to_cleanup);
-            IOLog("      LRU Entries to Flush: %d\n", cache_cleanup.lru_entries_to_flush);
-            IOLog("      Hot Entries to Clear: %d\n", cache_cleanup.hot_entries_to_clear);
-            IOLog("      Compressed Entries: %d\n", cache_cleanup.compressed_entries_to_decompress);
-            IOLog("      Memory to Reclaim: %llu MB\n", cache_cleanup.cache_memory_to_reclaim / (1024 * 1024));
-            IOLog("      Incremental Flush: %s\n", cache_cleanup.supports_incremental_flush ? "ENABLED" : "DISABLED");
-            IOLog("      Coherency Validation: %s\n", cache_cleanup.supports_cache_coherency_validation ? "ENABLED" : "DISABLED");
-            IOLog("      Memory Defragmentation: %s\n", cache_cleanup.supports_memory_defragmentation ? "ENABLED" : "DISABLED");
-            IOLog("      Cleanup Efficiency: %.1f%%\n", cache_cleanup.cache_cleanup_efficiency * 100.0f);
+            VMLOG_INFO("    Cache Cleanup Configuration:\n");
+            VMLOG_INFO("      Cache Entries to Clean: %d\n", cache_cleanup.cache_entries_to_cleanup);
+            VMLOG_INFO("      LRU Entries to Flush: %d\n", cache_cleanup.lru_entries_to_flush);
+            VMLOG_INFO("      Hot Entries to Clear: %d\n", cache_cleanup.hot_entries_to_clear);
+            VMLOG_INFO("      Compressed Entries: %d\n", cache_cleanup.compressed_entries_to_decompress);
+            VMLOG_INFO("      Memory to Reclaim: %llu MB\n", cache_cleanup.cache_memory_to_reclaim / (1024 * 1024));
+            VMLOG_INFO("      Incremental Flush: %s\n", cache_cleanup.supports_incremental_flush ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      Coherency Validation: %s\n", cache_cleanup.supports_cache_coherency_validation ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      Memory Defragmentation: %s\n", cache_cleanup.supports_memory_defragmentation ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      Cleanup Efficiency: %.1f%%\n", cache_cleanup.cache_cleanup_efficiency * 100.0f);
             
             // Perform advanced cache cleanup with memory reclamation
-            IOLog("    Performing comprehensive cache cleanup and memory reclamation\n");
+            VMLOG_INFO("    Performing comprehensive cache cleanup and memory reclamation\n");
             m_texture_cache->release();
             m_texture_cache = nullptr;
             
             // Reset cache memory tracking
             m_cache_memory_used = 0;
-            IOLog("    Cache cleanup: COMPLETE (memory reclaimed: %llu MB)\n", 
+            VMLOG_INFO("    Cache cleanup: COMPLETE (memory reclaimed: %llu MB)\n", 
                   cache_cleanup.cache_memory_to_reclaim / (1024 * 1024));
         } else {
-            IOLog("    Texture cache: NULL (no cleanup required)\n");
+            VMLOG_INFO("    Texture cache: NULL (no cleanup required)\n");
         }
         
         // Phase 5: Advanced Texture Map Cleanup with ID Management
-        IOLog("  Phase 5: Advanced texture map cleanup with comprehensive ID management\n");
+        VMLOG_INFO("  Phase 5: Advanced texture map cleanup with comprehensive ID management\n");
         
         if (m_texture_map) {
             // Advanced Map Cleanup Configuration
@@ -749,27 +759,27 @@ void CLASS::free()
             map_cleanup.supports_mapping_verification = true;
             map_cleanup.map_cleanup_efficiency = 1.0f; // 100% efficiency
             
-            IOLog("    Map Cleanup Configuration:\n");
-            IOLog("      Mapped Entries to Clean: %d\n", map_cleanup.mapped_entries_to_cleanup);
-            IOLog("      Hash Buckets to Clear: %d\n", map_cleanup.hash_buckets_to_clear);
-            IOLog("      Collision Chains: %d\n", map_cleanup.collision_chains_to_resolve);
-            IOLog("      Reverse Mappings: %d\n", map_cleanup.reverse_mappings_to_invalidate);
-            IOLog("      Batch Cleanup: %s\n", map_cleanup.supports_batch_cleanup ? "ENABLED" : "DISABLED");
-            IOLog("      ID Validation: %s\n", map_cleanup.supports_id_validation ? "ENABLED" : "DISABLED");
-            IOLog("      Mapping Verification: %s\n", map_cleanup.supports_mapping_verification ? "ENABLED" : "DISABLED");
-            IOLog("      Cleanup Efficiency: %.1f%%\n", map_cleanup.map_cleanup_efficiency * 100.0f);
+            VMLOG_INFO("    Map Cleanup Configuration:\n");
+            VMLOG_INFO("      Mapped Entries to Clean: %d\n", map_cleanup.mapped_entries_to_cleanup);
+            VMLOG_INFO("      Hash Buckets to Clear: %d\n", map_cleanup.hash_buckets_to_clear);
+            VMLOG_INFO("      Collision Chains: %d\n", map_cleanup.collision_chains_to_resolve);
+            VMLOG_INFO("      Reverse Mappings: %d\n", map_cleanup.reverse_mappings_to_invalidate);
+            VMLOG_INFO("      Batch Cleanup: %s\n", map_cleanup.supports_batch_cleanup ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      ID Validation: %s\n", map_cleanup.supports_id_validation ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      Mapping Verification: %s\n", map_cleanup.supports_mapping_verification ? "ENABLED" : "DISABLED");
+            VMLOG_INFO("      Cleanup Efficiency: %.1f%%\n", map_cleanup.map_cleanup_efficiency * 100.0f);
             
             // Perform advanced texture map cleanup
-            IOLog("    Performing comprehensive texture map cleanup\n");
+            VMLOG_INFO("    Performing comprehensive texture map cleanup\n");
             m_texture_map->release();
             m_texture_map = nullptr;
-            IOLog("    Texture map cleanup: COMPLETE\n");
+            VMLOG_INFO("    Texture map cleanup: COMPLETE\n");
         } else {
-            IOLog("    Texture map: NULL (no cleanup required)\n");
+            VMLOG_INFO("    Texture map: NULL (no cleanup required)\n");
         }
         
         // Phase 6: Memory Usage Reset and Final State Cleanup
-        IOLog("  Phase 6: Memory usage reset and final system state cleanup\n");
+        VMLOG_INFO("  Phase 6: Memory usage reset and final system state cleanup\n");
         
         // Advanced Memory Reset Configuration
         struct MemoryResetConfiguration {
@@ -791,27 +801,43 @@ void CLASS::free()
         memory_reset.supports_final_state_check = true;
         memory_reset.memory_reset_efficiency = 1.0f; // 100% efficiency
         
-        IOLog("    Memory Reset Configuration:\n");
-        IOLog("      Memory to Reset: %llu MB\n", memory_reset.memory_to_reset / (1024 * 1024));
-        IOLog("      Cache Memory to Reset: %llu MB\n", memory_reset.cache_memory_to_reset / (1024 * 1024));
-        IOLog("      Counter Values to Reset: %d\n", memory_reset.counter_values_to_reset);
-        IOLog("      Memory Validation: %s\n", memory_reset.supports_memory_validation ? "ENABLED" : "DISABLED");
-        IOLog("      Counter Validation: %s\n", memory_reset.supports_counter_validation ? "ENABLED" : "DISABLED");
-        IOLog("      Final State Check: %s\n", memory_reset.supports_final_state_check ? "ENABLED" : "DISABLED");
-        IOLog("      Reset Efficiency: %.1f%%\n", memory_reset.memory_reset_efficiency * 100.0f);
+        VMLOG_INFO("    Memory Reset Configuration:\n");
+        VMLOG_INFO("      Memory to Reset: %llu MB\n", memory_reset.memory_to_reset / (1024 * 1024));
+        VMLOG_INFO("      Cache Memory to Reset: %llu MB\n", memory_reset.cache_memory_to_reset / (1024 * 1024));
+        VMLOG_INFO("      Counter Values to Reset: %d\n", memory_reset.counter_values_to_reset);
+        VMLOG_INFO("      Memory Validation: %s\n", memory_reset.supports_memory_validation ? "ENABLED" : "DISABLED");
+        VMLOG_INFO("      Counter Validation: %s\n", memory_reset.supports_counter_validation ? "ENABLED" : "DISABLED");
+        VMLOG_INFO("      Final State Check: %s\n", memory_reset.supports_final_state_check ? "ENABLED" : "DISABLED");
+        VMLOG_INFO("      Reset Efficiency: %.1f%%\n", memory_reset.memory_reset_efficiency * 100.0f);
         
         // Reset memory tracking values
-        IOLog("    Resetting memory usage tracking values\n");
+        VMLOG_INFO("    Resetting memory usage tracking values\n");
         m_texture_memory_usage = 0;
         m_cache_memory_used = 0; // Already reset in cache cleanup, but ensure consistency
         
-        // Reset counter values for consistency
-        IOLog("    Resetting counter values for clean state\n");
-        m_next_texture_id = 1; // Reset to initial value
-        m_next_sampler_id = 1; // Reset to initial value
+        // Free every texture and sampler still registered
+        VMLOG_INFO("    Releasing %u textures and %u samplers still registered\n",
+              m_texture_table.count(), m_sampler_table.count());
+        for (uint32_t i = 0; i < m_texture_table.limit(); i++) {
+            ManagedTexture* texture = m_texture_table.at(i);
+            if (texture) {
+                releaseHostTexture(texture);
+                if (texture->data) texture->data->release();
+                delete texture;
+            }
+        }
+        m_texture_table.free();
+        if (m_blit_context_id && m_gpu_device) {
+            m_gpu_device->destroyRenderContext(m_blit_context_id);
+            m_blit_context_id = 0;
+        }
+        for (uint32_t i = 0; i < m_sampler_table.limit(); i++) {
+            delete m_sampler_table.at(i);
+        }
+        m_sampler_table.free();
         
         // Phase 7: Comprehensive Cleanup Validation and Final Status Report
-        IOLog("  Phase 7: Comprehensive cleanup validation and final status verification\n");
+        VMLOG_INFO("  Phase 7: Comprehensive cleanup validation and final status verification\n");
         
         // Advanced Cleanup Validation Structure
         struct CleanupValidation {
@@ -869,7 +895,7 @@ void CLASS::free()
         
         // Counter reset validation
         cleanup_validation.total_cleanup_checks++;
-        if (m_next_texture_id == 1 && m_next_sampler_id == 1) {
+        if (m_texture_table.count() == 0 && m_sampler_table.count() == 0) {
             cleanup_validation.counters_reset = true;
             cleanup_validation.passed_cleanup_checks++;
         }
@@ -884,32 +910,32 @@ void CLASS::free()
         // Determine overall cleanup success
         cleanup_validation.cleanup_successful = (cleanup_validation.cleanup_completeness >= 0.95f); // Require 95% success
         
-        IOLog("    Cleanup Validation Results:\n");
-        IOLog("      Texture Array Cleaned: %s\n", cleanup_validation.texture_array_cleaned ? "YES" : "NO");
-        IOLog("      Sampler Array Cleaned: %s\n", cleanup_validation.sampler_array_cleaned ? "YES" : "NO");
-        IOLog("      Cache Cleaned: %s\n", cleanup_validation.cache_cleaned ? "YES" : "NO");
-        IOLog("      Texture Map Cleaned: %s\n", cleanup_validation.texture_map_cleaned ? "YES" : "NO");
-        IOLog("      Memory Usage Reset: %s\n", cleanup_validation.memory_usage_reset ? "YES" : "NO");
-        IOLog("      Counters Reset: %s\n", cleanup_validation.counters_reset ? "YES" : "NO");
-        IOLog("      Cleanup Completeness: %.1f%% (%d/%d checks passed)\n", 
+        VMLOG_INFO("    Cleanup Validation Results:\n");
+        VMLOG_INFO("      Texture Array Cleaned: %s\n", cleanup_validation.texture_array_cleaned ? "YES" : "NO");
+        VMLOG_INFO("      Sampler Array Cleaned: %s\n", cleanup_validation.sampler_array_cleaned ? "YES" : "NO");
+        VMLOG_INFO("      Cache Cleaned: %s\n", cleanup_validation.cache_cleaned ? "YES" : "NO");
+        VMLOG_INFO("      Texture Map Cleaned: %s\n", cleanup_validation.texture_map_cleaned ? "YES" : "NO");
+        VMLOG_INFO("      Memory Usage Reset: %s\n", cleanup_validation.memory_usage_reset ? "YES" : "NO");
+        VMLOG_INFO("      Counters Reset: %s\n", cleanup_validation.counters_reset ? "YES" : "NO");
+        VMLOG_INFO("      Cleanup Completeness: %.1f%% (%d/%d checks passed)\n", 
               cleanup_validation.cleanup_completeness * 100.0f,
               cleanup_validation.passed_cleanup_checks, cleanup_validation.total_cleanup_checks);
-        IOLog("      Total Memory Reclaimed: %llu MB\n", cleanup_validation.memory_reclaimed / (1024 * 1024));
-        IOLog("      Cleanup Status: %s\n", cleanup_validation.cleanup_successful ? "SUCCESS" : "INCOMPLETE");
+        VMLOG_INFO("      Total Memory Reclaimed: %llu MB\n", cleanup_validation.memory_reclaimed / (1024 * 1024));
+        VMLOG_INFO("      Cleanup Status: %s\n", cleanup_validation.cleanup_successful ? "SUCCESS" : "INCOMPLETE");
         
         // Final cleanup status report
         if (cleanup_validation.cleanup_successful) {
-            IOLog("VMTextureManager: ========== Advanced Texture Management System Cleanup Complete ==========\n");
-            IOLog("  Cleanup Status: SUCCESS\n");
-            IOLog("  Resources Cleaned: %d textures, %d samplers, %d cache entries, %d mappings\n",
+            VMLOG_INFO("VMTextureManager: ========== Advanced Texture Management System Cleanup Complete ==========\n");
+            VMLOG_INFO("  Cleanup Status: SUCCESS\n");
+            VMLOG_INFO("  Resources Cleaned: %d textures, %d samplers, %d cache entries, %d mappings\n",
                   cleanup_state.active_textures_count, cleanup_state.active_samplers_count,
                   cleanup_state.cached_entries_count, cleanup_state.mapped_texture_ids_count);
-            IOLog("  Memory Reclaimed: %llu MB\n", cleanup_validation.memory_reclaimed / (1024 * 1024));
-            IOLog("  Cleanup Efficiency: %.1f%%\n", cleanup_validation.cleanup_completeness * 100.0f);
-            IOLog("  System State: CLEAN\n");
-            IOLog("==================================================================================\n");
+            VMLOG_INFO("  Memory Reclaimed: %llu MB\n", cleanup_validation.memory_reclaimed / (1024 * 1024));
+            VMLOG_INFO("  Cleanup Efficiency: %.1f%%\n", cleanup_validation.cleanup_completeness * 100.0f);
+            VMLOG_INFO("  System State: CLEAN\n");
+            VMLOG_INFO("==================================================================================\n");
         } else {
-            IOLog("VMTextureManager: WARNING - Incomplete cleanup detected (%.1f%% completeness)\n",
+            VMLOG_WARN("VMTextureManager: WARNING - Incomplete cleanup detected (%.1f%% completeness)\n",
                   cleanup_validation.cleanup_completeness * 100.0f);
         }
         
@@ -929,23 +955,23 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
 {
     // Advanced Texture Creation System - Comprehensive Resource Allocation and Validation
     if (!descriptor || !texture_id) {
-        IOLog("VMTextureManager::createTexture: Invalid parameters (descriptor: %p, texture_id: %p)\n", 
+        VMLOG_WARN("VMTextureManager::createTexture: Invalid parameters (descriptor: %p, texture_id: %p)\n", 
               descriptor, texture_id);
         return kIOReturnBadArgument;
     }
     
     // Acquire texture management lock for thread safety
     if (!m_texture_lock) {
-        IOLog("VMTextureManager::createTexture: Texture lock not initialized\n");
+        VMLOG_DEBUG("VMTextureManager::createTexture: Texture lock not initialized\n");
         return kIOReturnNotReady;
     }
     
     IOLockLock(m_texture_lock);
     
-    IOLog("VMTextureManager::createTexture: Initiating advanced texture creation process\n");
+    VMLOG_DEBUG("VMTextureManager::createTexture: Initiating advanced texture creation process\n");
     
     // Phase 1: Comprehensive Texture Descriptor Validation
-    IOLog("  Phase 1: Comprehensive texture descriptor validation and compatibility analysis\n");
+    VMLOG_DEBUG("  Phase 1: Comprehensive texture descriptor validation and compatibility analysis\n");
     
     struct TextureValidationResult {
         bool dimensions_valid;
@@ -1039,30 +1065,30 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     if (validation.supports_hardware_acceleration) valid_checks++;
     validation.validation_score = (float)valid_checks / (float)total_checks;
     
-    IOLog("    Texture Descriptor Validation Results:\n");
-    IOLog("      Dimensions: %dx%dx%d - %s\n", descriptor->width, descriptor->height, descriptor->depth,
+    VMLOG_DEBUG("    Texture Descriptor Validation Results:\n");
+    VMLOG_DEBUG("      Dimensions: %dx%dx%d - %s\n", descriptor->width, descriptor->height, descriptor->depth,
           validation.dimensions_valid ? "VALID" : "INVALID");
-    IOLog("      Pixel Format: %d - %s\n", descriptor->pixel_format,
+    VMLOG_DEBUG("      Pixel Format: %d - %s\n", descriptor->pixel_format,
           validation.format_supported ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("      Estimated Memory: %llu MB - %s\n", validation.estimated_memory_size / (1024 * 1024),
+    VMLOG_DEBUG("      Estimated Memory: %llu MB - %s\n", validation.estimated_memory_size / (1024 * 1024),
           validation.memory_requirements_feasible ? "FEASIBLE" : "EXCEEDED");
-    IOLog("      Mipmap Levels: %d - %s\n", validation.calculated_mip_levels,
+    VMLOG_DEBUG("      Mipmap Levels: %d - %s\n", validation.calculated_mip_levels,
           validation.mipmap_configuration_valid ? "VALID" : "INVALID");
-    IOLog("      Usage Flags: %s\n", validation.usage_flags_supported ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("      Hardware Acceleration: %s\n", validation.supports_hardware_acceleration ? "AVAILABLE" : "UNAVAILABLE");
-    IOLog("      Compression Required: %s\n", validation.requires_compression ? "YES" : "NO");
-    IOLog("      Validation Score: %.1f%% (%d/%d checks passed)\n", 
+    VMLOG_DEBUG("      Usage Flags: %s\n", validation.usage_flags_supported ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("      Hardware Acceleration: %s\n", validation.supports_hardware_acceleration ? "AVAILABLE" : "UNAVAILABLE");
+    VMLOG_DEBUG("      Compression Required: %s\n", validation.requires_compression ? "YES" : "NO");
+    VMLOG_DEBUG("      Validation Score: %.1f%% (%d/%d checks passed)\n", 
           validation.validation_score * 100.0f, valid_checks, total_checks);
     
     // Check if validation passed
     if (validation.validation_score < 0.85f) { // Require 85% validation success
-        IOLog("    ERROR: Texture validation failed (%.1f%% score)\n", validation.validation_score * 100.0f);
+        VMLOG_ERROR("    ERROR: Texture validation failed (%.1f%% score)\n", validation.validation_score * 100.0f);
         IOLockUnlock(m_texture_lock);
         return kIOReturnBadArgument;
     }
     
     // Phase 2: Advanced Memory Allocation and Resource Management
-    IOLog("  Phase 2: Advanced memory allocation and comprehensive resource management\n");
+    VMLOG_DEBUG("  Phase 2: Advanced memory allocation and comprehensive resource management\n");
     
     struct MemoryAllocationPlan {
         uint64_t primary_texture_memory;
@@ -1095,22 +1121,22 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     allocation_plan.memory_efficiency = (float)allocation_plan.primary_texture_memory / 
         (float)allocation_plan.total_allocation_size;
     
-    IOLog("    Memory Allocation Plan:\n");
-    IOLog("      Primary Texture Memory: %llu MB\n", allocation_plan.primary_texture_memory / (1024 * 1024));
-    IOLog("      Mipmap Memory: %llu MB\n", allocation_plan.mipmap_memory / (1024 * 1024));
-    IOLog("      Metadata Memory: %llu KB\n", allocation_plan.metadata_memory / 1024);
-    IOLog("      Alignment Padding: %llu bytes\n", allocation_plan.alignment_padding);
-    IOLog("      Total Allocation: %llu MB\n", allocation_plan.total_allocation_size / (1024 * 1024));
-    IOLog("      Memory Alignment: %d bytes\n", allocation_plan.memory_alignment);
-    IOLog("      Cache Alignment: %d bytes\n", allocation_plan.cache_alignment);
-    IOLog("      Compression Support: %s\n", allocation_plan.supports_memory_compression ? "ENABLED" : "DISABLED");
-    IOLog("      Memory Mapping: %s\n", allocation_plan.supports_memory_mapping ? "ENABLED" : "DISABLED");
-    IOLog("      GPU Memory Required: %s\n", allocation_plan.requires_gpu_memory ? "YES" : "NO");
-    IOLog("      Memory Efficiency: %.1f%%\n", allocation_plan.memory_efficiency * 100.0f);
+    VMLOG_DEBUG("    Memory Allocation Plan:\n");
+    VMLOG_DEBUG("      Primary Texture Memory: %llu MB\n", allocation_plan.primary_texture_memory / (1024 * 1024));
+    VMLOG_DEBUG("      Mipmap Memory: %llu MB\n", allocation_plan.mipmap_memory / (1024 * 1024));
+    VMLOG_DEBUG("      Metadata Memory: %llu KB\n", allocation_plan.metadata_memory / 1024);
+    VMLOG_DEBUG("      Alignment Padding: %llu bytes\n", allocation_plan.alignment_padding);
+    VMLOG_DEBUG("      Total Allocation: %llu MB\n", allocation_plan.total_allocation_size / (1024 * 1024));
+    VMLOG_DEBUG("      Memory Alignment: %d bytes\n", allocation_plan.memory_alignment);
+    VMLOG_DEBUG("      Cache Alignment: %d bytes\n", allocation_plan.cache_alignment);
+    VMLOG_DEBUG("      Compression Support: %s\n", allocation_plan.supports_memory_compression ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("      Memory Mapping: %s\n", allocation_plan.supports_memory_mapping ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("      GPU Memory Required: %s\n", allocation_plan.requires_gpu_memory ? "YES" : "NO");
+    VMLOG_DEBUG("      Memory Efficiency: %.1f%%\n", allocation_plan.memory_efficiency * 100.0f);
     
     // Check if we have enough memory available
     if ((m_texture_memory_usage + allocation_plan.total_allocation_size) > m_max_texture_memory) {
-        IOLog("    ERROR: Insufficient memory (need: %llu MB, available: %llu MB)\n",
+        VMLOG_ERROR("    ERROR: Insufficient memory (need: %llu MB, available: %llu MB)\n",
               allocation_plan.total_allocation_size / (1024 * 1024),
               (m_max_texture_memory - m_texture_memory_usage) / (1024 * 1024));
         IOLockUnlock(m_texture_lock);
@@ -1118,7 +1144,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     }
     
     // Phase 3: Advanced Texture Object Creation and Initialization
-    IOLog("  Phase 3: Advanced texture object creation and comprehensive initialization\n");
+    VMLOG_DEBUG("  Phase 3: Advanced texture object creation and comprehensive initialization\n");
     
     struct TextureObjectConfiguration {
         uint32_t assigned_texture_id;
@@ -1134,7 +1160,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     } texture_object = {0};
     
     // Configure texture object parameters
-    texture_object.assigned_texture_id = m_next_texture_id++;
+    texture_object.assigned_texture_id = 0; // handed out by m_texture_table at registration
     texture_object.object_creation_flags = 0x01; // Standard creation
     texture_object.access_permissions = 0xFF; // Full access
     texture_object.sharing_mode = 0x01; // Exclusive access
@@ -1147,34 +1173,36 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     // Create managed texture object
     ManagedTexture* managed_texture = new ManagedTexture;
     if (!managed_texture) {
-        IOLog("    ERROR: Failed to allocate managed texture object\n");
+        VMLOG_ERROR("    ERROR: Failed to allocate managed texture object\n");
         IOLockUnlock(m_texture_lock);
         return kIOReturnNoMemory;
     }
     
     // Initialize managed texture properties
-    managed_texture->texture_id = texture_object.assigned_texture_id;
+    managed_texture->texture_id = 0;
+    managed_texture->gpu_resource_id = 0;
+    managed_texture->mip_offsets = nullptr;
+    managed_texture->mip_sizes = nullptr;
     managed_texture->descriptor = *descriptor; // Copy descriptor
     managed_texture->data_size = (uint32_t)allocation_plan.total_allocation_size;
     managed_texture->last_accessed = 0; // Would use mach_absolute_time() in real implementation
     managed_texture->ref_count = 1; // Initial reference
-    managed_texture->is_compressed = allocation_plan.supports_memory_compression;
+    managed_texture->is_compressed = isFormatCompressed(descriptor->pixel_format);
     managed_texture->has_mipmaps = (descriptor->mipmap_level_count > 1);
     managed_texture->is_render_target = false; // Not a render target by default
     
-    IOLog("    Texture Object Configuration:\n");
-    IOLog("      Assigned Texture ID: %d\n", texture_object.assigned_texture_id);
-    IOLog("      Creation Flags: 0x%02X\n", texture_object.object_creation_flags);
-    IOLog("      Access Permissions: 0x%02X\n", texture_object.access_permissions);
-    IOLog("      Sharing Mode: 0x%02X\n", texture_object.sharing_mode);
-    IOLog("      Optimization Hints: 0x%02X\n", texture_object.optimization_hints);
-    IOLog("      Concurrent Access: %s\n", texture_object.supports_concurrent_access ? "ENABLED" : "DISABLED");
-    IOLog("      Memory Coherency: %s\n", texture_object.supports_memory_coherency ? "ENABLED" : "DISABLED");
-    IOLog("      Cache Optimization: %s\n", texture_object.supports_cache_optimization ? "ENABLED" : "DISABLED");
-    IOLog("      Creation Efficiency Target: %.1f%%\n", texture_object.creation_efficiency * 100.0f);
+    VMLOG_DEBUG("    Texture Object Configuration:\n");
+    VMLOG_DEBUG("      Creation Flags: 0x%02X\n", texture_object.object_creation_flags);
+    VMLOG_DEBUG("      Access Permissions: 0x%02X\n", texture_object.access_permissions);
+    VMLOG_DEBUG("      Sharing Mode: 0x%02X\n", texture_object.sharing_mode);
+    VMLOG_DEBUG("      Optimization Hints: 0x%02X\n", texture_object.optimization_hints);
+    VMLOG_DEBUG("      Concurrent Access: %s\n", texture_object.supports_concurrent_access ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("      Memory Coherency: %s\n", texture_object.supports_memory_coherency ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("      Cache Optimization: %s\n", texture_object.supports_cache_optimization ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("      Creation Efficiency Target: %.1f%%\n", texture_object.creation_efficiency * 100.0f);
     
     // Phase 4: Initial Data Processing and GPU Resource Allocation
-    IOLog("  Phase 4: Initial data processing and comprehensive GPU resource allocation\n");
+    VMLOG_DEBUG("  Phase 4: Initial data processing and comprehensive GPU resource allocation\n");
     
     if (initial_data) {
         struct InitialDataProcessing {
@@ -1198,15 +1226,15 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         data_processing.supports_dma_transfer = true;
         data_processing.processing_efficiency = 0.90f; // Target 90% efficiency
         
-        IOLog("    Initial Data Processing:\n");
-        IOLog("      Data Size: %llu MB\n", data_processing.data_size / (1024 * 1024));
-        IOLog("      Processed Size: %llu MB\n", data_processing.processed_size / (1024 * 1024));
-        IOLog("      Processing Flags: 0x%02X\n", data_processing.processing_flags);
-        IOLog("      Format Conversion: %s\n", data_processing.requires_format_conversion ? "REQUIRED" : "NOT REQUIRED");
-        IOLog("      Compression: %s\n", data_processing.requires_compression ? "REQUIRED" : "NOT REQUIRED");
-        IOLog("      GPU Upload: %s\n", data_processing.requires_gpu_upload ? "REQUIRED" : "NOT REQUIRED");
-        IOLog("      DMA Transfer: %s\n", data_processing.supports_dma_transfer ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("      Processing Efficiency: %.1f%%\n", data_processing.processing_efficiency * 100.0f);
+        VMLOG_DEBUG("    Initial Data Processing:\n");
+        VMLOG_DEBUG("      Data Size: %llu MB\n", data_processing.data_size / (1024 * 1024));
+        VMLOG_DEBUG("      Processed Size: %llu MB\n", data_processing.processed_size / (1024 * 1024));
+        VMLOG_DEBUG("      Processing Flags: 0x%02X\n", data_processing.processing_flags);
+        VMLOG_DEBUG("      Format Conversion: %s\n", data_processing.requires_format_conversion ? "REQUIRED" : "NOT REQUIRED");
+        VMLOG_DEBUG("      Compression: %s\n", data_processing.requires_compression ? "REQUIRED" : "NOT REQUIRED");
+        VMLOG_DEBUG("      GPU Upload: %s\n", data_processing.requires_gpu_upload ? "REQUIRED" : "NOT REQUIRED");
+        VMLOG_DEBUG("      DMA Transfer: %s\n", data_processing.supports_dma_transfer ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("      Processing Efficiency: %.1f%%\n", data_processing.processing_efficiency * 100.0f);
         
         // Advanced Initial Data Processing System - Comprehensive Data Transformation and GPU Upload
         struct DataTransformationPipeline {
@@ -1234,17 +1262,17 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         transform_pipeline.transformation_progress = 0.0f;
         transform_pipeline.data_integrity_score = 1.0f; // Perfect integrity initially
         
-        IOLog("    Advanced Data Transformation Pipeline:\n");
-        IOLog("      Transformation Stage: %d\n", transform_pipeline.transformation_stage);
-        IOLog("      Processing Method: %s\n", transform_pipeline.processing_method == 2 ? "DMA Transfer" : "Memory Copy");
-        IOLog("      Format Conversion: %s\n", transform_pipeline.format_conversion_required ? "REQUIRED" : "SKIP");
-        IOLog("      Memory Copy: %s\n", transform_pipeline.memory_copy_required ? "REQUIRED" : "SKIP");
-        IOLog("      GPU Upload: %s\n", transform_pipeline.gpu_upload_required ? "REQUIRED" : "SKIP");
-        IOLog("      Compression Applied: %s\n", transform_pipeline.compression_applied ? "YES" : "NO");
-        IOLog("      Data Integrity Score: %.3f\n", transform_pipeline.data_integrity_score);
+        VMLOG_DEBUG("    Advanced Data Transformation Pipeline:\n");
+        VMLOG_DEBUG("      Transformation Stage: %d\n", transform_pipeline.transformation_stage);
+        VMLOG_DEBUG("      Processing Method: %s\n", transform_pipeline.processing_method == 2 ? "DMA Transfer" : "Memory Copy");
+        VMLOG_DEBUG("      Format Conversion: %s\n", transform_pipeline.format_conversion_required ? "REQUIRED" : "SKIP");
+        VMLOG_DEBUG("      Memory Copy: %s\n", transform_pipeline.memory_copy_required ? "REQUIRED" : "SKIP");
+        VMLOG_DEBUG("      GPU Upload: %s\n", transform_pipeline.gpu_upload_required ? "REQUIRED" : "SKIP");
+        VMLOG_DEBUG("      Compression Applied: %s\n", transform_pipeline.compression_applied ? "YES" : "NO");
+        VMLOG_DEBUG("      Data Integrity Score: %.3f\n", transform_pipeline.data_integrity_score);
         
         // Stage 1: Memory Buffer Preparation and Validation
-        IOLog("    Stage 1: Memory buffer preparation and comprehensive validation\n");
+        VMLOG_DEBUG("    Stage 1: Memory buffer preparation and comprehensive validation\n");
         
         struct MemoryBufferPreparation {
             void* source_buffer;
@@ -1272,24 +1300,24 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         buffer_prep.memory_mapping_successful = buffer_prep.buffer_validation_passed;
         buffer_prep.buffer_access_validated = buffer_prep.memory_mapping_successful;
         
-        IOLog("      Memory Buffer Preparation:\n");
-        IOLog("        Source Buffer Size: %llu MB\n", buffer_prep.source_buffer_size / (1024 * 1024));
-        IOLog("        Destination Buffer Size: %llu MB\n", buffer_prep.destination_buffer_size / (1024 * 1024));
-        IOLog("        Buffer Alignment: %d bytes\n", buffer_prep.buffer_alignment);
-        IOLog("        Buffer Validation: %s\n", buffer_prep.buffer_validation_passed ? "PASSED" : "FAILED");
-        IOLog("        Memory Mapping: %s\n", buffer_prep.memory_mapping_successful ? "SUCCESSFUL" : "FAILED");
-        IOLog("        Buffer Access: %s\n", buffer_prep.buffer_access_validated ? "VALIDATED" : "INVALID");
-        IOLog("        Preparation Efficiency: %.1f%%\n", buffer_prep.preparation_efficiency * 100.0f);
+        VMLOG_DEBUG("      Memory Buffer Preparation:\n");
+        VMLOG_DEBUG("        Source Buffer Size: %llu MB\n", buffer_prep.source_buffer_size / (1024 * 1024));
+        VMLOG_DEBUG("        Destination Buffer Size: %llu MB\n", buffer_prep.destination_buffer_size / (1024 * 1024));
+        VMLOG_DEBUG("        Buffer Alignment: %d bytes\n", buffer_prep.buffer_alignment);
+        VMLOG_DEBUG("        Buffer Validation: %s\n", buffer_prep.buffer_validation_passed ? "PASSED" : "FAILED");
+        VMLOG_DEBUG("        Memory Mapping: %s\n", buffer_prep.memory_mapping_successful ? "SUCCESSFUL" : "FAILED");
+        VMLOG_DEBUG("        Buffer Access: %s\n", buffer_prep.buffer_access_validated ? "VALIDATED" : "INVALID");
+        VMLOG_DEBUG("        Preparation Efficiency: %.1f%%\n", buffer_prep.preparation_efficiency * 100.0f);
         
         if (!buffer_prep.buffer_validation_passed) {
-            IOLog("      ERROR: Buffer preparation failed\n");
+            VMLOG_ERROR("      ERROR: Buffer preparation failed\n");
             delete managed_texture;
             IOLockUnlock(m_texture_lock);
             return kIOReturnNoMemory;
         }
         
         // Stage 2: Data Format Analysis and Conversion Planning
-        IOLog("    Stage 2: Data format analysis and intelligent conversion planning\n");
+        VMLOG_DEBUG("    Stage 2: Data format analysis and intelligent conversion planning\n");
         
         struct FormatConversionPlan {
             uint32_t source_pixel_format;
@@ -1315,19 +1343,19 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         conversion_plan.supports_simd_conversion = conversion_plan.conversion_required;
         conversion_plan.conversion_efficiency = conversion_plan.conversion_required ? 0.85f : 1.0f; // 85% if converting
         
-        IOLog("      Format Conversion Plan:\n");
-        IOLog("        Source Pixel Format: %d\n", conversion_plan.source_pixel_format);
-        IOLog("        Destination Pixel Format: %d\n", conversion_plan.destination_pixel_format);
-        IOLog("        Conversion Required: %s\n", conversion_plan.conversion_required ? "YES" : "NO");
-        IOLog("        Conversion Method: %d\n", conversion_plan.conversion_method);
-        IOLog("        Conversion Overhead: %llu KB\n", conversion_plan.conversion_overhead_bytes / 1024);
-        IOLog("        Conversion Passes: %d\n", conversion_plan.conversion_passes);
-        IOLog("        Hardware Conversion: %s\n", conversion_plan.supports_hardware_conversion ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("        SIMD Conversion: %s\n", conversion_plan.supports_simd_conversion ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("        Conversion Efficiency: %.1f%%\n", conversion_plan.conversion_efficiency * 100.0f);
+        VMLOG_DEBUG("      Format Conversion Plan:\n");
+        VMLOG_DEBUG("        Source Pixel Format: %d\n", conversion_plan.source_pixel_format);
+        VMLOG_DEBUG("        Destination Pixel Format: %d\n", conversion_plan.destination_pixel_format);
+        VMLOG_DEBUG("        Conversion Required: %s\n", conversion_plan.conversion_required ? "YES" : "NO");
+        VMLOG_DEBUG("        Conversion Method: %d\n", conversion_plan.conversion_method);
+        VMLOG_DEBUG("        Conversion Overhead: %llu KB\n", conversion_plan.conversion_overhead_bytes / 1024);
+        VMLOG_DEBUG("        Conversion Passes: %d\n", conversion_plan.conversion_passes);
+        VMLOG_DEBUG("        Hardware Conversion: %s\n", conversion_plan.supports_hardware_conversion ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("        SIMD Conversion: %s\n", conversion_plan.supports_simd_conversion ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("        Conversion Efficiency: %.1f%%\n", conversion_plan.conversion_efficiency * 100.0f);
         
         // Stage 3: Advanced Data Transfer Execution with Progress Tracking
-        IOLog("    Stage 3: Advanced data transfer execution with comprehensive progress tracking\n");
+        VMLOG_DEBUG("    Stage 3: Advanced data transfer execution with comprehensive progress tracking\n");
         
         struct DataTransferExecution {
             uint64_t transfer_start_time;
@@ -1350,11 +1378,11 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         transfer_execution.transfer_method_selected = transform_pipeline.processing_method;
         transfer_execution.transfer_efficiency_score = 0.92f; // Target 92% efficiency
         
-        IOLog("      Data Transfer Execution:\n");
-        IOLog("        Transfer Rate: %llu MB/s\n", transfer_execution.transfer_bytes_per_second / (1024 * 1024));
-        IOLog("        Estimated Time: %llu seconds\n", transfer_execution.estimated_completion_time);
-        IOLog("        Transfer Method: %s\n", transfer_execution.transfer_method_selected == 2 ? "DMA" : "Copy");
-        IOLog("        Efficiency Target: %.1f%%\n", transfer_execution.transfer_efficiency_score * 100.0f);
+        VMLOG_DEBUG("      Data Transfer Execution:\n");
+        VMLOG_DEBUG("        Transfer Rate: %llu MB/s\n", transfer_execution.transfer_bytes_per_second / (1024 * 1024));
+        VMLOG_DEBUG("        Estimated Time: %llu seconds\n", transfer_execution.estimated_completion_time);
+        VMLOG_DEBUG("        Transfer Method: %s\n", transfer_execution.transfer_method_selected == 2 ? "DMA" : "Copy");
+        VMLOG_DEBUG("        Efficiency Target: %.1f%%\n", transfer_execution.transfer_efficiency_score * 100.0f);
         
         // Execute the data transfer with comprehensive monitoring
         transfer_execution.transfer_in_progress = true;
@@ -1389,11 +1417,11 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         progress_monitor.performance_samples_collected = 0;
         progress_monitor.adaptive_optimization_enabled = true;
         
-        IOLog("      Advanced Progress Monitoring Configuration:\n");
-        IOLog("        Monitoring Stages: %d\n", progress_monitor.monitoring_stages);
-        IOLog("        Expected Bandwidth: %llu MB/s\n", progress_monitor.real_time_bandwidth / (1024 * 1024));
-        IOLog("        Adaptive Optimization: %s\n", progress_monitor.adaptive_optimization_enabled ? "ENABLED" : "DISABLED");
-        IOLog("        Performance Sampling: %s\n", progress_monitor.performance_samples_collected == 0 ? "READY" : "IN PROGRESS");
+        VMLOG_DEBUG("      Advanced Progress Monitoring Configuration:\n");
+        VMLOG_DEBUG("        Monitoring Stages: %d\n", progress_monitor.monitoring_stages);
+        VMLOG_DEBUG("        Expected Bandwidth: %llu MB/s\n", progress_monitor.real_time_bandwidth / (1024 * 1024));
+        VMLOG_DEBUG("        Adaptive Optimization: %s\n", progress_monitor.adaptive_optimization_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("        Performance Sampling: %s\n", progress_monitor.performance_samples_collected == 0 ? "READY" : "IN PROGRESS");
         
         // Execute comprehensive data transfer with real-time analytics
         for (uint32_t progress = 0; progress <= 100; progress += 25) {
@@ -1512,7 +1540,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                         (adaptive_opt.burst_mode_activated ? 0.2f : 0.0f);
                     
                     // Advanced Real-Time Optimization Implementation System
-                    IOLog("          === Applying Advanced Performance Optimizations ===\n");
+                    VMLOG_DEBUG("          === Applying Advanced Performance Optimizations ===\n");
                     
                     // Comprehensive Optimization Strategy Implementation
                     struct OptimizationExecutionPlan {
@@ -1542,14 +1570,14 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                     execution_plan.actual_performance_gain = 0.0f;
                     execution_plan.optimization_successful = false;
                     
-                    IOLog("          Optimization Execution Plan:\n");
-                    IOLog("            Sequence ID: %d\n", execution_plan.optimization_sequence_id);
-                    IOLog("            Total Steps: %d\n", execution_plan.total_optimization_steps);
-                    IOLog("            Expected Gain: %.1f%%\n", execution_plan.expected_performance_gain * 100.0f);
-                    IOLog("            Optimization Method: %d (1=Minor, 2=Moderate, 3=Aggressive)\n", adaptive_opt.optimization_method);
+                    VMLOG_DEBUG("          Optimization Execution Plan:\n");
+                    VMLOG_DEBUG("            Sequence ID: %d\n", execution_plan.optimization_sequence_id);
+                    VMLOG_DEBUG("            Total Steps: %d\n", execution_plan.total_optimization_steps);
+                    VMLOG_DEBUG("            Expected Gain: %.1f%%\n", execution_plan.expected_performance_gain * 100.0f);
+                    VMLOG_DEBUG("            Optimization Method: %d (1=Minor, 2=Moderate, 3=Aggressive)\n", adaptive_opt.optimization_method);
                     
                     // Step 1: Advanced Buffer Size Optimization
-                    IOLog("          Step 1/5: Advanced buffer size optimization\n");
+                    VMLOG_DEBUG("          Step 1/5: Advanced buffer size optimization\n");
                     struct BufferSizeOptimization {
                         uint64_t original_buffer_size;
                         uint64_t optimized_buffer_size;
@@ -1570,22 +1598,22 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                     buffer_opt.buffer_fragmentation_optimization = (adaptive_opt.optimization_method >= 2);
                     buffer_opt.buffer_efficiency_improvement = ((float)buffer_opt.optimized_buffer_size / (float)buffer_opt.original_buffer_size) - 1.0f;
                     
-                    IOLog("            Buffer Size Optimization:\n");
-                    IOLog("              Original Size: %llu KB\n", buffer_opt.original_buffer_size / 1024);
-                    IOLog("              Optimized Size: %llu KB (+%.1f%%)\n", 
+                    VMLOG_DEBUG("            Buffer Size Optimization:\n");
+                    VMLOG_DEBUG("              Original Size: %llu KB\n", buffer_opt.original_buffer_size / 1024);
+                    VMLOG_DEBUG("              Optimized Size: %llu KB (+%.1f%%)\n", 
                           buffer_opt.optimized_buffer_size / 1024, buffer_opt.buffer_efficiency_improvement * 100.0f);
-                    IOLog("              Adjustment: %d%%\n", buffer_opt.buffer_adjustment_percentage);
-                    IOLog("              Memory Alignment: %d bytes\n", buffer_opt.memory_alignment_optimization);
-                    IOLog("              Variable Sizing: %s\n", buffer_opt.supports_variable_buffer_sizing ? "ENABLED" : "DISABLED");
-                    IOLog("              Adaptive Scaling: %s\n", buffer_opt.supports_adaptive_buffer_scaling ? "ENABLED" : "DISABLED");
-                    IOLog("              Fragmentation Opt: %s\n", buffer_opt.buffer_fragmentation_optimization ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Adjustment: %d%%\n", buffer_opt.buffer_adjustment_percentage);
+                    VMLOG_DEBUG("              Memory Alignment: %d bytes\n", buffer_opt.memory_alignment_optimization);
+                    VMLOG_DEBUG("              Variable Sizing: %s\n", buffer_opt.supports_variable_buffer_sizing ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Adaptive Scaling: %s\n", buffer_opt.supports_adaptive_buffer_scaling ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Fragmentation Opt: %s\n", buffer_opt.buffer_fragmentation_optimization ? "ENABLED" : "DISABLED");
                     
                     execution_plan.buffer_optimization_applied = true;
                     execution_plan.completed_optimization_steps++;
                     execution_plan.optimization_execution_progress = (float)execution_plan.completed_optimization_steps / (float)execution_plan.total_optimization_steps;
                     
                     // Step 2: Advanced Transfer Method Optimization
-                    IOLog("          Step 2/5: Advanced transfer method optimization\n");
+                    VMLOG_DEBUG("          Step 2/5: Advanced transfer method optimization\n");
                     struct TransferMethodOptimization {
                         uint32_t original_transfer_method;
                         uint32_t optimized_transfer_method;
@@ -1621,15 +1649,15 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                     transfer_method_opt.transfer_efficiency_improvement = 
                         ((float)transfer_method_opt.optimized_transfer_rate / (float)transfer_execution.transfer_bytes_per_second) - 1.0f;
                     
-                    IOLog("            Transfer Method Optimization:\n");
-                    IOLog("              Original Method: %s\n", transfer_method_opt.original_transfer_method == 2 ? "DMA" : "Copy");
-                    IOLog("              Optimized Method: %s\n", transfer_method_opt.optimized_transfer_method == 2 ? "DMA" : "Copy");
-                    IOLog("              DMA Optimization: %s\n", transfer_method_opt.dma_optimization_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Scatter-Gather: %s\n", transfer_method_opt.scatter_gather_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Parallel Transfer: %s\n", transfer_method_opt.parallel_transfer_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Transfer Pipelining: %s\n", transfer_method_opt.transfer_pipelining_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Concurrent Channels: %d\n", transfer_method_opt.concurrent_transfer_channels);
-                    IOLog("              Optimized Rate: %llu MB/s (+%.1f%%)\n", 
+                    VMLOG_DEBUG("            Transfer Method Optimization:\n");
+                    VMLOG_DEBUG("              Original Method: %s\n", transfer_method_opt.original_transfer_method == 2 ? "DMA" : "Copy");
+                    VMLOG_DEBUG("              Optimized Method: %s\n", transfer_method_opt.optimized_transfer_method == 2 ? "DMA" : "Copy");
+                    VMLOG_DEBUG("              DMA Optimization: %s\n", transfer_method_opt.dma_optimization_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Scatter-Gather: %s\n", transfer_method_opt.scatter_gather_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Parallel Transfer: %s\n", transfer_method_opt.parallel_transfer_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Transfer Pipelining: %s\n", transfer_method_opt.transfer_pipelining_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Concurrent Channels: %d\n", transfer_method_opt.concurrent_transfer_channels);
+                    VMLOG_DEBUG("              Optimized Rate: %llu MB/s (+%.1f%%)\n", 
                           transfer_method_opt.optimized_transfer_rate / (1024 * 1024), 
                           transfer_method_opt.transfer_efficiency_improvement * 100.0f);
                     
@@ -1638,7 +1666,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                     execution_plan.optimization_execution_progress = (float)execution_plan.completed_optimization_steps / (float)execution_plan.total_optimization_steps;
                     
                     // Step 3: Advanced Memory Layout Optimization
-                    IOLog("          Step 3/5: Advanced memory layout optimization\n");
+                    VMLOG_DEBUG("          Step 3/5: Advanced memory layout optimization\n");
                     struct MemoryLayoutOptimization {
                         uint32_t memory_alignment_strategy;
                         uint32_t cache_line_optimization;
@@ -1669,21 +1697,21 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                     }
                     memory_layout_opt.memory_access_efficiency_improvement = alignment_improvement - 1.0f;
                     
-                    IOLog("            Memory Layout Optimization:\n");
-                    IOLog("              Alignment Strategy: %d bytes\n", memory_layout_opt.memory_alignment_strategy);
-                    IOLog("              Cache Line Optimization: %d bytes\n", memory_layout_opt.cache_line_optimization);
-                    IOLog("              NUMA Aware: %s\n", memory_layout_opt.numa_aware_allocation ? "ENABLED" : "DISABLED");
-                    IOLog("              Memory Prefaulting: %s\n", memory_layout_opt.memory_prefaulting_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Large Pages: %s\n", memory_layout_opt.large_page_allocation ? "ENABLED" : "DISABLED");
-                    IOLog("              Memory Interleaving: %s\n", memory_layout_opt.memory_interleaving_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Access Efficiency Gain: +%.1f%%\n", memory_layout_opt.memory_access_efficiency_improvement * 100.0f);
+                    VMLOG_DEBUG("            Memory Layout Optimization:\n");
+                    VMLOG_DEBUG("              Alignment Strategy: %d bytes\n", memory_layout_opt.memory_alignment_strategy);
+                    VMLOG_DEBUG("              Cache Line Optimization: %d bytes\n", memory_layout_opt.cache_line_optimization);
+                    VMLOG_DEBUG("              NUMA Aware: %s\n", memory_layout_opt.numa_aware_allocation ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Memory Prefaulting: %s\n", memory_layout_opt.memory_prefaulting_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Large Pages: %s\n", memory_layout_opt.large_page_allocation ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Memory Interleaving: %s\n", memory_layout_opt.memory_interleaving_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Access Efficiency Gain: +%.1f%%\n", memory_layout_opt.memory_access_efficiency_improvement * 100.0f);
                     
                     execution_plan.memory_layout_optimization_applied = true;
                     execution_plan.completed_optimization_steps++;
                     execution_plan.optimization_execution_progress = (float)execution_plan.completed_optimization_steps / (float)execution_plan.total_optimization_steps;
                     
                     // Step 4: Advanced Cache Optimization System
-                    IOLog("          Step 4/5: Advanced cache optimization system\n");
+                    VMLOG_DEBUG("          Step 4/5: Advanced cache optimization system\n");
                     struct CacheOptimizationSystem {
                         bool l1_cache_optimization;
                         bool l2_cache_optimization;
@@ -1715,24 +1743,24 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                     if (cache_opt.l3_cache_optimization) cache_opt.cache_hit_rate_improvement += 0.08f; // 8%
                     if (cache_opt.write_combining_enabled) cache_opt.cache_hit_rate_improvement += 0.05f; // 5%
                     
-                    IOLog("            Cache Optimization System:\n");
-                    IOLog("              L1 Cache Optimization: %s\n", cache_opt.l1_cache_optimization ? "ENABLED" : "DISABLED");
-                    IOLog("              L2 Cache Optimization: %s\n", cache_opt.l2_cache_optimization ? "ENABLED" : "DISABLED");
-                    IOLog("              L3 Cache Optimization: %s\n", cache_opt.l3_cache_optimization ? "ENABLED" : "DISABLED");
-                    IOLog("              Cache Prefetch: %s\n", cache_opt.cache_prefetch_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Large Transfer Bypass: %s\n", cache_opt.cache_bypass_for_large_transfers ? "ENABLED" : "DISABLED");
-                    IOLog("              Prefetch Distance: %d lines\n", cache_opt.prefetch_distance);
-                    IOLog("              Prefetch Stride: %d bytes\n", cache_opt.prefetch_stride);
-                    IOLog("              Write Combining: %s\n", cache_opt.write_combining_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Coherency Optimization: %s\n", cache_opt.cache_coherency_optimization ? "ENABLED" : "DISABLED");
-                    IOLog("              Cache Hit Rate Improvement: +%.1f%%\n", cache_opt.cache_hit_rate_improvement * 100.0f);
+                    VMLOG_DEBUG("            Cache Optimization System:\n");
+                    VMLOG_DEBUG("              L1 Cache Optimization: %s\n", cache_opt.l1_cache_optimization ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              L2 Cache Optimization: %s\n", cache_opt.l2_cache_optimization ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              L3 Cache Optimization: %s\n", cache_opt.l3_cache_optimization ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Cache Prefetch: %s\n", cache_opt.cache_prefetch_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Large Transfer Bypass: %s\n", cache_opt.cache_bypass_for_large_transfers ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Prefetch Distance: %d lines\n", cache_opt.prefetch_distance);
+                    VMLOG_DEBUG("              Prefetch Stride: %d bytes\n", cache_opt.prefetch_stride);
+                    VMLOG_DEBUG("              Write Combining: %s\n", cache_opt.write_combining_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Coherency Optimization: %s\n", cache_opt.cache_coherency_optimization ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Cache Hit Rate Improvement: +%.1f%%\n", cache_opt.cache_hit_rate_improvement * 100.0f);
                     
                     execution_plan.cache_optimization_applied = true;
                     execution_plan.completed_optimization_steps++;
                     execution_plan.optimization_execution_progress = (float)execution_plan.completed_optimization_steps / (float)execution_plan.total_optimization_steps;
                     
                     // Step 5: Advanced Hardware Acceleration Optimization
-                    IOLog("          Step 5/5: Advanced hardware acceleration optimization\n");
+                    VMLOG_DEBUG("          Step 5/5: Advanced hardware acceleration optimization\n");
                     struct HardwareAccelerationOptimization {
                         bool gpu_acceleration_enabled;
                         bool simd_acceleration_enabled;
@@ -1772,17 +1800,17 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                     hw_accel_opt.hardware_acceleration_efficiency = 
                         ((float)hw_accel_opt.hardware_accelerated_bandwidth / (float)transfer_execution.transfer_bytes_per_second) - 1.0f;
                     
-                    IOLog("            Hardware Acceleration Optimization:\n");
-                    IOLog("              GPU Acceleration: %s\n", hw_accel_opt.gpu_acceleration_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              SIMD Acceleration: %s\n", hw_accel_opt.simd_acceleration_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Vector Processing: %s\n", hw_accel_opt.vector_processing_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Burst Mode: %s\n", hw_accel_opt.burst_mode_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Hardware Compression: %s\n", hw_accel_opt.hardware_compression_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Dedicated Transfer Engine: %s\n", hw_accel_opt.dedicated_transfer_engine_enabled ? "ENABLED" : "DISABLED");
-                    IOLog("              Processing Units: %d\n", hw_accel_opt.parallel_processing_units);
-                    IOLog("              Hardware Queue Depth: %d\n", hw_accel_opt.hardware_queue_depth);
-                    IOLog("              Accelerated Bandwidth: %llu MB/s\n", hw_accel_opt.hardware_accelerated_bandwidth / (1024 * 1024));
-                    IOLog("              Hardware Efficiency Gain: +%.1f%%\n", hw_accel_opt.hardware_acceleration_efficiency * 100.0f);
+                    VMLOG_DEBUG("            Hardware Acceleration Optimization:\n");
+                    VMLOG_DEBUG("              GPU Acceleration: %s\n", hw_accel_opt.gpu_acceleration_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              SIMD Acceleration: %s\n", hw_accel_opt.simd_acceleration_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Vector Processing: %s\n", hw_accel_opt.vector_processing_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Burst Mode: %s\n", hw_accel_opt.burst_mode_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Hardware Compression: %s\n", hw_accel_opt.hardware_compression_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Dedicated Transfer Engine: %s\n", hw_accel_opt.dedicated_transfer_engine_enabled ? "ENABLED" : "DISABLED");
+                    VMLOG_DEBUG("              Processing Units: %d\n", hw_accel_opt.parallel_processing_units);
+                    VMLOG_DEBUG("              Hardware Queue Depth: %d\n", hw_accel_opt.hardware_queue_depth);
+                    VMLOG_DEBUG("              Accelerated Bandwidth: %llu MB/s\n", hw_accel_opt.hardware_accelerated_bandwidth / (1024 * 1024));
+                    VMLOG_DEBUG("              Hardware Efficiency Gain: +%.1f%%\n", hw_accel_opt.hardware_acceleration_efficiency * 100.0f);
                     
                     execution_plan.hardware_acceleration_optimization_applied = true;
                     execution_plan.completed_optimization_steps++;
@@ -1802,21 +1830,21 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                     adaptive_opt.optimization_impact_score = execution_plan.actual_performance_gain;
                     
                     // Final Optimization Results Summary
-                    IOLog("          === Optimization Execution Complete ===\n");
-                    IOLog("            Total Steps Completed: %d/%d (%.1f%%)\n", 
+                    VMLOG_DEBUG("          === Optimization Execution Complete ===\n");
+                    VMLOG_DEBUG("            Total Steps Completed: %d/%d (%.1f%%)\n", 
                           execution_plan.completed_optimization_steps, execution_plan.total_optimization_steps,
                           execution_plan.optimization_execution_progress * 100.0f);
-                    IOLog("            Expected Performance Gain: +%.1f%%\n", execution_plan.expected_performance_gain * 100.0f);
-                    IOLog("            Actual Performance Gain: +%.1f%%\n", execution_plan.actual_performance_gain * 100.0f);
-                    IOLog("            Optimization Success: %s\n", execution_plan.optimization_successful ? "YES" : "NO");
-                    IOLog("            Buffer Optimization: %s\n", execution_plan.buffer_optimization_applied ? "APPLIED" : "SKIPPED");
-                    IOLog("            Transfer Method Optimization: %s\n", execution_plan.transfer_method_optimization_applied ? "APPLIED" : "SKIPPED");
-                    IOLog("            Memory Layout Optimization: %s\n", execution_plan.memory_layout_optimization_applied ? "APPLIED" : "SKIPPED");
-                    IOLog("            Cache Optimization: %s\n", execution_plan.cache_optimization_applied ? "APPLIED" : "SKIPPED");
-                    IOLog("            Hardware Acceleration: %s\n", execution_plan.hardware_acceleration_optimization_applied ? "APPLIED" : "SKIPPED");
-                    IOLog("            Final Bandwidth: %llu MB/s\n", hw_accel_opt.hardware_accelerated_bandwidth / (1024 * 1024));
-                    IOLog("            Optimization Impact Score: %.3f\n", adaptive_opt.optimization_impact_score);
-                    IOLog("          =========================================\n");
+                    VMLOG_DEBUG("            Expected Performance Gain: +%.1f%%\n", execution_plan.expected_performance_gain * 100.0f);
+                    VMLOG_DEBUG("            Actual Performance Gain: +%.1f%%\n", execution_plan.actual_performance_gain * 100.0f);
+                    VMLOG_DEBUG("            Optimization Success: %s\n", execution_plan.optimization_successful ? "YES" : "NO");
+                    VMLOG_DEBUG("            Buffer Optimization: %s\n", execution_plan.buffer_optimization_applied ? "APPLIED" : "SKIPPED");
+                    VMLOG_DEBUG("            Transfer Method Optimization: %s\n", execution_plan.transfer_method_optimization_applied ? "APPLIED" : "SKIPPED");
+                    VMLOG_DEBUG("            Memory Layout Optimization: %s\n", execution_plan.memory_layout_optimization_applied ? "APPLIED" : "SKIPPED");
+                    VMLOG_DEBUG("            Cache Optimization: %s\n", execution_plan.cache_optimization_applied ? "APPLIED" : "SKIPPED");
+                    VMLOG_DEBUG("            Hardware Acceleration: %s\n", execution_plan.hardware_acceleration_optimization_applied ? "APPLIED" : "SKIPPED");
+                    VMLOG_DEBUG("            Final Bandwidth: %llu MB/s\n", hw_accel_opt.hardware_accelerated_bandwidth / (1024 * 1024));
+                    VMLOG_DEBUG("            Optimization Impact Score: %.3f\n", adaptive_opt.optimization_impact_score);
+                    VMLOG_DEBUG("          =========================================\n");
                     
                     // Apply the optimization results to the current stage
                     stage_analytics.stage_optimization_applied = execution_plan.optimization_successful;
@@ -1835,68 +1863,68 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                             stage_analytics.stage_efficiency_percentage = 200; // Cap at 200% (2x improvement)
                         }
                         
-                        IOLog("          Post-Optimization Performance Update:\n");
-                        IOLog("            Optimized Stage Bandwidth: %llu MB/s\n", optimized_stage_bandwidth / (1024 * 1024));
-                        IOLog("            Updated Efficiency: %llu%%\n", stage_analytics.stage_efficiency_percentage);
-                        IOLog("            Performance Acceptable: %s\n", stage_analytics.stage_performance_acceptable ? "YES" : "NO");
+                        VMLOG_DEBUG("          Post-Optimization Performance Update:\n");
+                        VMLOG_DEBUG("            Optimized Stage Bandwidth: %llu MB/s\n", optimized_stage_bandwidth / (1024 * 1024));
+                        VMLOG_DEBUG("            Updated Efficiency: %llu%%\n", stage_analytics.stage_efficiency_percentage);
+                        VMLOG_DEBUG("            Performance Acceptable: %s\n", stage_analytics.stage_performance_acceptable ? "YES" : "NO");
                     }
                 }
             }
             
             // Comprehensive Progress Reporting with Performance Metrics
             if (progress < 100) {
-                IOLog("        ========== Transfer Progress Stage %d ==========\n", (progress / 25) + 1);
-                IOLog("        Overall Progress: %.1f%% (%llu KB processed, %llu KB remaining)\n",
+                VMLOG_DEBUG("        ========== Transfer Progress Stage %d ==========\n", (progress / 25) + 1);
+                VMLOG_DEBUG("        Overall Progress: %.1f%% (%llu KB processed, %llu KB remaining)\n",
                       transfer_execution.transfer_progress_percentage * 100.0f,
                       transform_pipeline.bytes_processed / 1024,
                       transform_pipeline.bytes_remaining / 1024);
                 
                 if (progress > 0) {
-                    IOLog("        Stage Performance Analytics:\n");
-                    IOLog("          Stage Bytes: %llu KB\n", stage_analytics.stage_bytes_transferred / 1024);
-                    IOLog("          Stage Time: %llu ms\n", stage_analytics.stage_transfer_time_us / 1000);
-                    IOLog("          Stage Bandwidth: %llu MB/s\n", stage_analytics.stage_bandwidth / (1024 * 1024));
-                    IOLog("          Stage Efficiency: %llu%%\n", stage_analytics.stage_efficiency_percentage);
-                    IOLog("          Performance Acceptable: %s\n", stage_analytics.stage_performance_acceptable ? "YES" : "NO");
-                    IOLog("          Stability Coefficient: %.3f\n", stage_analytics.stage_stability_coefficient);
-                    IOLog("          Retry Count: %d\n", stage_analytics.stage_retry_count);
+                    VMLOG_DEBUG("        Stage Performance Analytics:\n");
+                    VMLOG_DEBUG("          Stage Bytes: %llu KB\n", stage_analytics.stage_bytes_transferred / 1024);
+                    VMLOG_DEBUG("          Stage Time: %llu ms\n", stage_analytics.stage_transfer_time_us / 1000);
+                    VMLOG_DEBUG("          Stage Bandwidth: %llu MB/s\n", stage_analytics.stage_bandwidth / (1024 * 1024));
+                    VMLOG_DEBUG("          Stage Efficiency: %llu%%\n", stage_analytics.stage_efficiency_percentage);
+                    VMLOG_DEBUG("          Performance Acceptable: %s\n", stage_analytics.stage_performance_acceptable ? "YES" : "NO");
+                    VMLOG_DEBUG("          Stability Coefficient: %.3f\n", stage_analytics.stage_stability_coefficient);
+                    VMLOG_DEBUG("          Retry Count: %d\n", stage_analytics.stage_retry_count);
                     
-                    IOLog("        Global Performance Metrics:\n");
-                    IOLog("          Average Bandwidth: %llu MB/s\n", progress_monitor.average_bandwidth / (1024 * 1024));
-                    IOLog("          Peak Bandwidth: %llu MB/s\n", progress_monitor.peak_bandwidth / (1024 * 1024));
-                    IOLog("          Minimum Bandwidth: %llu MB/s\n", 
+                    VMLOG_DEBUG("        Global Performance Metrics:\n");
+                    VMLOG_DEBUG("          Average Bandwidth: %llu MB/s\n", progress_monitor.average_bandwidth / (1024 * 1024));
+                    VMLOG_DEBUG("          Peak Bandwidth: %llu MB/s\n", progress_monitor.peak_bandwidth / (1024 * 1024));
+                    VMLOG_DEBUG("          Minimum Bandwidth: %llu MB/s\n", 
                           progress_monitor.minimum_bandwidth == UINT64_MAX ? 0 : 
                           progress_monitor.minimum_bandwidth / (1024 * 1024));
-                    IOLog("          Bandwidth Efficiency: %.1f%%\n", progress_monitor.bandwidth_efficiency * 100.0f);
-                    IOLog("          Transfer Stability: %.1f%%\n", progress_monitor.transfer_stability_score * 100.0f);
-                    IOLog("          Performance Samples: %d\n", progress_monitor.performance_samples_collected);
+                    VMLOG_DEBUG("          Bandwidth Efficiency: %.1f%%\n", progress_monitor.bandwidth_efficiency * 100.0f);
+                    VMLOG_DEBUG("          Transfer Stability: %.1f%%\n", progress_monitor.transfer_stability_score * 100.0f);
+                    VMLOG_DEBUG("          Performance Samples: %d\n", progress_monitor.performance_samples_collected);
                     
                     if (adaptive_opt.optimization_triggered) {
-                        IOLog("        Adaptive Optimization Applied:\n");
-                        IOLog("          Optimization Method: %d (1=Minor, 2=Moderate, 3=Aggressive)\n", 
+                        VMLOG_DEBUG("        Adaptive Optimization Applied:\n");
+                        VMLOG_DEBUG("          Optimization Method: %d (1=Minor, 2=Moderate, 3=Aggressive)\n", 
                               adaptive_opt.optimization_method);
-                        IOLog("          Buffer Size Adjustment: %d%%\n", adaptive_opt.buffer_size_adjustment);
-                        IOLog("          DMA Optimization: %s\n", adaptive_opt.dma_optimization_applied ? "APPLIED" : "SKIP");
-                        IOLog("          Cache Prefetch: %s\n", adaptive_opt.cache_prefetch_enabled ? "ENABLED" : "DISABLED");
-                        IOLog("          Burst Mode: %s\n", adaptive_opt.burst_mode_activated ? "ACTIVATED" : "DISABLED");
-                        IOLog("          Optimization Impact: %.3f\n", adaptive_opt.optimization_impact_score);
+                        VMLOG_DEBUG("          Buffer Size Adjustment: %d%%\n", adaptive_opt.buffer_size_adjustment);
+                        VMLOG_DEBUG("          DMA Optimization: %s\n", adaptive_opt.dma_optimization_applied ? "APPLIED" : "SKIP");
+                        VMLOG_DEBUG("          Cache Prefetch: %s\n", adaptive_opt.cache_prefetch_enabled ? "ENABLED" : "DISABLED");
+                        VMLOG_DEBUG("          Burst Mode: %s\n", adaptive_opt.burst_mode_activated ? "ACTIVATED" : "DISABLED");
+                        VMLOG_DEBUG("          Optimization Impact: %.3f\n", adaptive_opt.optimization_impact_score);
                     }
                 }
-                IOLog("        =============================================\n");
+                VMLOG_DEBUG("        =============================================\n");
             } else {
                 // Final stage summary
-                IOLog("        ========== Transfer Completion Summary ==========\n");
-                IOLog("        Final Progress: 100.0%% (%llu KB total transferred)\n",
+                VMLOG_DEBUG("        ========== Transfer Completion Summary ==========\n");
+                VMLOG_DEBUG("        Final Progress: 100.0%% (%llu KB total transferred)\n",
                       transform_pipeline.bytes_processed / 1024);
-                IOLog("        Total Transfer Time: %llu ms\n", progress_monitor.cumulative_transfer_time / 1000);
-                IOLog("        Final Average Bandwidth: %llu MB/s\n", progress_monitor.average_bandwidth / (1024 * 1024));
-                IOLog("        Peak Performance: %llu MB/s\n", progress_monitor.peak_bandwidth / (1024 * 1024));
-                IOLog("        Overall Bandwidth Efficiency: %.1f%%\n", progress_monitor.bandwidth_efficiency * 100.0f);
-                IOLog("        Transfer Stability Score: %.1f%%\n", progress_monitor.transfer_stability_score * 100.0f);
-                IOLog("        Performance Samples Collected: %d\n", progress_monitor.performance_samples_collected);
-                IOLog("        Adaptive Optimizations Used: %s\n", 
+                VMLOG_DEBUG("        Total Transfer Time: %llu ms\n", progress_monitor.cumulative_transfer_time / 1000);
+                VMLOG_DEBUG("        Final Average Bandwidth: %llu MB/s\n", progress_monitor.average_bandwidth / (1024 * 1024));
+                VMLOG_DEBUG("        Peak Performance: %llu MB/s\n", progress_monitor.peak_bandwidth / (1024 * 1024));
+                VMLOG_DEBUG("        Overall Bandwidth Efficiency: %.1f%%\n", progress_monitor.bandwidth_efficiency * 100.0f);
+                VMLOG_DEBUG("        Transfer Stability Score: %.1f%%\n", progress_monitor.transfer_stability_score * 100.0f);
+                VMLOG_DEBUG("        Performance Samples Collected: %d\n", progress_monitor.performance_samples_collected);
+                VMLOG_DEBUG("        Adaptive Optimizations Used: %s\n", 
                       progress_monitor.adaptive_optimization_enabled ? "YES" : "NO");
-                IOLog("        ==============================================\n");
+                VMLOG_DEBUG("        ==============================================\n");
             }
             
             // Update monitoring stage counter
@@ -1912,12 +1940,12 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         // Update final transfer execution metrics with monitoring results
         transfer_execution.transfer_efficiency_score = progress_monitor.bandwidth_efficiency;
         
-        IOLog("        Transfer Status: %s\n", transfer_execution.transfer_completed ? "COMPLETED" : "IN PROGRESS");
-        IOLog("        Transfer Validation: %s\n", transfer_execution.transfer_validated ? "PASSED" : "FAILED");
-        IOLog("        Final Progress: %.1f%%\n", transfer_execution.transfer_progress_percentage * 100.0f);
+        VMLOG_DEBUG("        Transfer Status: %s\n", transfer_execution.transfer_completed ? "COMPLETED" : "IN PROGRESS");
+        VMLOG_DEBUG("        Transfer Validation: %s\n", transfer_execution.transfer_validated ? "PASSED" : "FAILED");
+        VMLOG_DEBUG("        Final Progress: %.1f%%\n", transfer_execution.transfer_progress_percentage * 100.0f);
         
         // Stage 4: Data Integrity Validation and Final Processing
-        IOLog("    Stage 4: Data integrity validation and comprehensive final processing\n");
+        VMLOG_DEBUG("    Stage 4: Data integrity validation and comprehensive final processing\n");
         
         struct DataIntegrityValidation {
             uint64_t data_checksum_calculated;
@@ -1944,40 +1972,50 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         integrity_validation.final_processing_score = integrity_validation.data_quality_score * 
             transfer_execution.transfer_efficiency_score;
         
-        IOLog("      Data Integrity Validation:\n");
-        IOLog("        Calculated Checksum: 0x%08llX\n", integrity_validation.data_checksum_calculated);
-        IOLog("        Expected Checksum: 0x%08llX\n", integrity_validation.data_checksum_expected);
-        IOLog("        Checksum Match: %s\n", integrity_validation.checksum_validation_passed ? "YES" : "NO");
-        IOLog("        Corruption Checks: %d performed, %d detected\n", 
+        VMLOG_DEBUG("      Data Integrity Validation:\n");
+        VMLOG_DEBUG("        Calculated Checksum: 0x%08llX\n", integrity_validation.data_checksum_calculated);
+        VMLOG_DEBUG("        Expected Checksum: 0x%08llX\n", integrity_validation.data_checksum_expected);
+        VMLOG_DEBUG("        Checksum Match: %s\n", integrity_validation.checksum_validation_passed ? "YES" : "NO");
+        VMLOG_DEBUG("        Corruption Checks: %d performed, %d detected\n", 
               integrity_validation.data_corruption_checks, integrity_validation.data_corruption_detected);
-        IOLog("        Integrity Validation: %s\n", integrity_validation.integrity_validation_passed ? "PASSED" : "FAILED");
-        IOLog("        Data Quality Score: %.3f\n", integrity_validation.data_quality_score);
-        IOLog("        Final Processing Score: %.3f\n", integrity_validation.final_processing_score);
+        VMLOG_DEBUG("        Integrity Validation: %s\n", integrity_validation.integrity_validation_passed ? "PASSED" : "FAILED");
+        VMLOG_DEBUG("        Data Quality Score: %.3f\n", integrity_validation.data_quality_score);
+        VMLOG_DEBUG("        Final Processing Score: %.3f\n", integrity_validation.final_processing_score);
         
         if (!integrity_validation.integrity_validation_passed) {
-            IOLog("      ERROR: Data integrity validation failed\n");
+            VMLOG_ERROR("      ERROR: Data integrity validation failed\n");
             delete managed_texture;
             IOLockUnlock(m_texture_lock);
             return kIOReturnIOError;
         }
         
         // Final data assignment with comprehensive validation
-        IOLog("    Final data assignment with comprehensive resource management\n");
+        VMLOG_DEBUG("    Final data assignment with comprehensive resource management\n");
         managed_texture->data = initial_data; // Store reference to initial data
         managed_texture->data->retain(); // Retain the data
+        
+        // A compressed upload the host cannot sample is kept expanded to RGBA8
+        uint32_t block_virgl_format = blockTextureVirglFormat(descriptor->pixel_format);
+        if (block_virgl_format && !(m_gpu_device && m_gpu_device->hostSamplesFormat(block_virgl_format))) {
+            IOReturn expand_ret = expandBlockTexture(managed_texture);
+            if (expand_ret != kIOReturnSuccess) {
+                VMLOG_WARN("VMTextureManager::createTexture: host cannot sample format %u and expanding it failed (0x%x)\n",
+                      (uint32_t)descriptor->pixel_format, expand_ret);
+            }
+        }
         managed_texture->last_accessed = 0; // Would use mach_absolute_time()
         managed_texture->ref_count = 1; // Initial reference
         managed_texture->is_render_target = allocation_plan.requires_gpu_memory;
         
-        IOLog("      Data Assignment Results:\n");
-        IOLog("        Data Reference: %s\n", managed_texture->data ? "ASSIGNED" : "NULL");
-        IOLog("        Data Retained: %s\n", managed_texture->data ? "YES" : "NO");
-        IOLog("        Integrity Score: %.3f\n", integrity_validation.data_quality_score);
-        IOLog("        Processing Complete: %s\n", transfer_execution.transfer_completed ? "YES" : "NO");
-        IOLog("        GPU Resident: %s\n", managed_texture->is_render_target ? "YES" : "NO");
+        VMLOG_DEBUG("      Data Assignment Results:\n");
+        VMLOG_DEBUG("        Data Reference: %s\n", managed_texture->data ? "ASSIGNED" : "NULL");
+        VMLOG_DEBUG("        Data Retained: %s\n", managed_texture->data ? "YES" : "NO");
+        VMLOG_DEBUG("        Integrity Score: %.3f\n", integrity_validation.data_quality_score);
+        VMLOG_DEBUG("        Processing Complete: %s\n", transfer_execution.transfer_completed ? "YES" : "NO");
+        VMLOG_DEBUG("        GPU Resident: %s\n", managed_texture->is_render_target ? "YES" : "NO");
         
     } else {
-        IOLog("    No initial data provided - texture will be initialized empty\n");
+        VMLOG_DEBUG("    No initial data provided - texture will be initialized empty\n");
         
         // Advanced Empty Texture Initialization System
         struct EmptyTextureConfiguration {
@@ -1997,38 +2035,38 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         empty_config.optimized_for_rendering = true;
         empty_config.initialization_efficiency = 0.98f; // 98% efficiency for empty
         
-        IOLog("    Empty Texture Configuration:\n");
-        IOLog("      Empty Buffer Size: %llu MB\n", empty_config.empty_buffer_size / (1024 * 1024));
-        IOLog("      Fill Pattern: 0x%08X\n", empty_config.fill_pattern);
-        IOLog("      Zero Initialization: %s\n", empty_config.requires_zero_initialization ? "REQUIRED" : "SKIP");
-        IOLog("      Lazy Allocation: %s\n", empty_config.supports_lazy_allocation ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("      Rendering Optimized: %s\n", empty_config.optimized_for_rendering ? "YES" : "NO");
-        IOLog("      Initialization Efficiency: %.1f%%\n", empty_config.initialization_efficiency * 100.0f);
+        VMLOG_DEBUG("    Empty Texture Configuration:\n");
+        VMLOG_DEBUG("      Empty Buffer Size: %llu MB\n", empty_config.empty_buffer_size / (1024 * 1024));
+        VMLOG_DEBUG("      Fill Pattern: 0x%08X\n", empty_config.fill_pattern);
+        VMLOG_DEBUG("      Zero Initialization: %s\n", empty_config.requires_zero_initialization ? "REQUIRED" : "SKIP");
+        VMLOG_DEBUG("      Lazy Allocation: %s\n", empty_config.supports_lazy_allocation ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("      Rendering Optimized: %s\n", empty_config.optimized_for_rendering ? "YES" : "NO");
+        VMLOG_DEBUG("      Initialization Efficiency: %.1f%%\n", empty_config.initialization_efficiency * 100.0f);
         
         managed_texture->data = nullptr;
         managed_texture->last_accessed = 0; // Would use mach_absolute_time()
         managed_texture->ref_count = 1; // Initial reference
         managed_texture->is_render_target = false; // Not a render target until data added
         
-        IOLog("      Empty Texture Initialization Complete\n");
-        IOLog("        Data Integrity Score: %.1f%% (perfect for empty)\n", empty_config.initialization_efficiency * 100.0f);
-        IOLog("        Processing Complete: YES\n");
-        IOLog("        GPU Resident: NO (will be allocated on first use)\n");
+        VMLOG_DEBUG("      Empty Texture Initialization Complete\n");
+        VMLOG_DEBUG("        Data Integrity Score: %.1f%% (perfect for empty)\n", empty_config.initialization_efficiency * 100.0f);
+        VMLOG_DEBUG("        Processing Complete: YES\n");
+        VMLOG_DEBUG("        GPU Resident: NO (will be allocated on first use)\n");
     }
     
     // Phase 5: Registration and Memory Tracking Update
-    IOLog("  Phase 5: System registration and comprehensive memory tracking update\n");
+    VMLOG_DEBUG("  Phase 5: System registration and comprehensive memory tracking update\n");
     
     // Add texture to managed array
     if (!m_textures) {
-        IOLog("    ERROR: Texture array not initialized\n");
+        VMLOG_ERROR("    ERROR: Texture array not initialized\n");
         delete managed_texture;
         IOLockUnlock(m_texture_lock);
         return kIOReturnNotReady;
     }
     
     // Advanced Texture Object Wrapper System - Comprehensive OSObject Integration
-    IOLog("    Advanced texture object wrapper creation and comprehensive system integration\n");
+    VMLOG_DEBUG("    Advanced texture object wrapper creation and comprehensive system integration\n");
     
     struct TextureWrapperConfiguration {
         uint32_t wrapper_type;
@@ -2057,21 +2095,21 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     wrapper_config.supports_thread_safety = true;
     wrapper_config.wrapper_efficiency_target = 0.98f; // 98% efficiency target
     
-    IOLog("      Texture Wrapper Configuration:\n");
-    IOLog("        Wrapper Type: 0x%02X (Standard Texture Wrapper)\n", wrapper_config.wrapper_type);
-    IOLog("        Wrapper Version: 0x%04X (v3.0)\n", wrapper_config.wrapper_version);
-    IOLog("        Capabilities: 0x%02X (Full Feature Set)\n", wrapper_config.wrapper_capabilities);
-    IOLog("        Security Level: 0x%02X (Standard Protection)\n", wrapper_config.wrapper_security_level);
-    IOLog("        Reference Counting: %s\n", wrapper_config.supports_reference_counting ? "ENABLED" : "DISABLED");
-    IOLog("        Serialization Support: %s\n", wrapper_config.supports_serialization ? "ENABLED" : "DISABLED");
-    IOLog("        Copy Semantics: %s\n", wrapper_config.supports_copy_semantics ? "ENABLED" : "DISABLED");
-    IOLog("        Runtime Inspection: %s\n", wrapper_config.supports_runtime_inspection ? "ENABLED" : "DISABLED");
-    IOLog("        Memory Management: %s\n", wrapper_config.supports_memory_management ? "ENABLED" : "DISABLED");
-    IOLog("        Thread Safety: %s\n", wrapper_config.supports_thread_safety ? "ENABLED" : "DISABLED");
-    IOLog("        Efficiency Target: %.1f%%\n", wrapper_config.wrapper_efficiency_target * 100.0f);
+    VMLOG_DEBUG("      Texture Wrapper Configuration:\n");
+    VMLOG_DEBUG("        Wrapper Type: 0x%02X (Standard Texture Wrapper)\n", wrapper_config.wrapper_type);
+    VMLOG_DEBUG("        Wrapper Version: 0x%04X (v3.0)\n", wrapper_config.wrapper_version);
+    VMLOG_DEBUG("        Capabilities: 0x%02X (Full Feature Set)\n", wrapper_config.wrapper_capabilities);
+    VMLOG_DEBUG("        Security Level: 0x%02X (Standard Protection)\n", wrapper_config.wrapper_security_level);
+    VMLOG_DEBUG("        Reference Counting: %s\n", wrapper_config.supports_reference_counting ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("        Serialization Support: %s\n", wrapper_config.supports_serialization ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("        Copy Semantics: %s\n", wrapper_config.supports_copy_semantics ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("        Runtime Inspection: %s\n", wrapper_config.supports_runtime_inspection ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("        Memory Management: %s\n", wrapper_config.supports_memory_management ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("        Thread Safety: %s\n", wrapper_config.supports_thread_safety ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("        Efficiency Target: %.1f%%\n", wrapper_config.wrapper_efficiency_target * 100.0f);
     
     // Phase 1: Advanced OSObject Allocation with Validation
-    IOLog("      Phase 1: Advanced OSObject allocation with comprehensive validation\n");
+    VMLOG_DEBUG("      Phase 1: Advanced OSObject allocation with comprehensive validation\n");
     
     struct OSObjectAllocationStrategy {
         uint32_t allocation_method;
@@ -2096,15 +2134,15 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     allocation_strategy.estimated_overhead_bytes = 256; // Estimated OSObject overhead
     allocation_strategy.allocation_efficiency = 0.95f; // 95% efficiency target
     
-    IOLog("        OSObject Allocation Strategy:\n");
-    IOLog("          Allocation Method: 0x%02X (OSTypeAlloc)\n", allocation_strategy.allocation_method);
-    IOLog("          Allocation Flags: 0x%02X\n", allocation_strategy.allocation_flags);
-    IOLog("          Memory Pool: 0x%02X (Kernel Pool)\n", allocation_strategy.memory_pool_selection);
-    IOLog("          Zero Initialization: %s\n", allocation_strategy.requires_zero_initialization ? "REQUIRED" : "OPTIONAL");
-    IOLog("          Lazy Allocation: %s\n", allocation_strategy.supports_lazy_allocation ? "SUPPORTED" : "IMMEDIATE");
-    IOLog("          Alignment Required: %s (%d bytes)\n", allocation_strategy.requires_alignment ? "YES" : "NO", allocation_strategy.alignment_boundary);
-    IOLog("          Estimated Overhead: %llu bytes\n", allocation_strategy.estimated_overhead_bytes);
-    IOLog("          Allocation Efficiency: %.1f%%\n", allocation_strategy.allocation_efficiency * 100.0f);
+    VMLOG_DEBUG("        OSObject Allocation Strategy:\n");
+    VMLOG_DEBUG("          Allocation Method: 0x%02X (OSTypeAlloc)\n", allocation_strategy.allocation_method);
+    VMLOG_DEBUG("          Allocation Flags: 0x%02X\n", allocation_strategy.allocation_flags);
+    VMLOG_DEBUG("          Memory Pool: 0x%02X (Kernel Pool)\n", allocation_strategy.memory_pool_selection);
+    VMLOG_DEBUG("          Zero Initialization: %s\n", allocation_strategy.requires_zero_initialization ? "REQUIRED" : "OPTIONAL");
+    VMLOG_DEBUG("          Lazy Allocation: %s\n", allocation_strategy.supports_lazy_allocation ? "SUPPORTED" : "IMMEDIATE");
+    VMLOG_DEBUG("          Alignment Required: %s (%d bytes)\n", allocation_strategy.requires_alignment ? "YES" : "NO", allocation_strategy.alignment_boundary);
+    VMLOG_DEBUG("          Estimated Overhead: %llu bytes\n", allocation_strategy.estimated_overhead_bytes);
+    VMLOG_DEBUG("          Allocation Efficiency: %.1f%%\n", allocation_strategy.allocation_efficiency * 100.0f);
     
     // Perform advanced OSObject allocation with comprehensive error handling
     OSObject* texture_obj = nullptr;
@@ -2143,19 +2181,19 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     if (alloc_validation.current_object_count < alloc_validation.maximum_object_limit) validation_checks_passed++;
     alloc_validation.allocation_confidence = (float)validation_checks_passed / (float)total_validation_checks;
     
-    IOLog("        Pre-Allocation Validation:\n");
-    IOLog("          System Memory Available: %s\n", alloc_validation.system_memory_available ? "YES" : "NO");
-    IOLog("          Kernel Pool Accessible: %s\n", alloc_validation.kernel_pool_accessible ? "YES" : "NO");
-    IOLog("          Allocation Permissions: %s\n", alloc_validation.allocation_permissions_valid ? "VALID" : "INVALID");
-    IOLog("          Available Memory: %llu MB\n", alloc_validation.available_kernel_memory / (1024 * 1024));
-    IOLog("          Current Object Count: %d\n", alloc_validation.current_object_count);
-    IOLog("          Maximum Object Limit: %d\n", alloc_validation.maximum_object_limit);
-    IOLog("          Allocation Feasible: %s\n", alloc_validation.allocation_feasible ? "YES" : "NO");
-    IOLog("          Allocation Confidence: %.1f%% (%d/%d checks passed)\n", 
+    VMLOG_DEBUG("        Pre-Allocation Validation:\n");
+    VMLOG_DEBUG("          System Memory Available: %s\n", alloc_validation.system_memory_available ? "YES" : "NO");
+    VMLOG_DEBUG("          Kernel Pool Accessible: %s\n", alloc_validation.kernel_pool_accessible ? "YES" : "NO");
+    VMLOG_DEBUG("          Allocation Permissions: %s\n", alloc_validation.allocation_permissions_valid ? "VALID" : "INVALID");
+    VMLOG_DEBUG("          Available Memory: %llu MB\n", alloc_validation.available_kernel_memory / (1024 * 1024));
+    VMLOG_DEBUG("          Current Object Count: %d\n", alloc_validation.current_object_count);
+    VMLOG_DEBUG("          Maximum Object Limit: %d\n", alloc_validation.maximum_object_limit);
+    VMLOG_DEBUG("          Allocation Feasible: %s\n", alloc_validation.allocation_feasible ? "YES" : "NO");
+    VMLOG_DEBUG("          Allocation Confidence: %.1f%% (%d/%d checks passed)\n", 
           alloc_validation.allocation_confidence * 100.0f, validation_checks_passed, total_validation_checks);
     
     if (!alloc_validation.allocation_feasible || alloc_validation.allocation_confidence < 0.75f) {
-        IOLog("        ERROR: Pre-allocation validation failed (confidence: %.1f%%)\n", 
+        VMLOG_ERROR("        ERROR: Pre-allocation validation failed (confidence: %.1f%%)\n", 
               alloc_validation.allocation_confidence * 100.0f);
         delete managed_texture;
         IOLockUnlock(m_texture_lock);
@@ -2163,14 +2201,14 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     }
     
     // Execute OSObject allocation with monitoring
-    IOLog("        Executing OSObject allocation...\n");
+    VMLOG_DEBUG("        Executing OSObject allocation...\n");
     texture_obj = OSTypeAlloc(OSObject); // Standard OSObject allocation
     
     // Phase 2: Post-Allocation Validation and Enhancement
-    IOLog("      Phase 2: Post-allocation validation and comprehensive enhancement\n");
+    VMLOG_DEBUG("      Phase 2: Post-allocation validation and comprehensive enhancement\n");
     
     if (!texture_obj) {
-        IOLog("        ERROR: OSObject allocation failed\n");
+        VMLOG_ERROR("        ERROR: OSObject allocation failed\n");
         
         // Advanced Allocation Failure Analysis
         struct AllocationFailureAnalysis {
@@ -2194,14 +2232,14 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         failure_analysis.retry_feasible = failure_analysis.memory_exhaustion; // Can retry if memory issue
         failure_analysis.recovery_probability = failure_analysis.retry_feasible ? 0.3f : 0.0f; // 30% if retryable
         
-        IOLog("        Allocation Failure Analysis:\n");
-        IOLog("          Failure Reason: 0x%02X\n", failure_analysis.failure_reason);
-        IOLog("          Memory Exhaustion: %s\n", failure_analysis.memory_exhaustion ? "YES" : "NO");
-        IOLog("          Permission Denied: %s\n", failure_analysis.permission_denied ? "YES" : "NO");
-        IOLog("          System Limit Reached: %s\n", failure_analysis.system_limit_reached ? "YES" : "NO");
-        IOLog("          Invalid Parameters: %s\n", failure_analysis.invalid_parameters ? "YES" : "NO");
-        IOLog("          Retry Feasible: %s\n", failure_analysis.retry_feasible ? "YES" : "NO");
-        IOLog("          Recovery Probability: %.1f%%\n", failure_analysis.recovery_probability * 100.0f);
+        VMLOG_DEBUG("        Allocation Failure Analysis:\n");
+        VMLOG_DEBUG("          Failure Reason: 0x%02X\n", failure_analysis.failure_reason);
+        VMLOG_DEBUG("          Memory Exhaustion: %s\n", failure_analysis.memory_exhaustion ? "YES" : "NO");
+        VMLOG_DEBUG("          Permission Denied: %s\n", failure_analysis.permission_denied ? "YES" : "NO");
+        VMLOG_DEBUG("          System Limit Reached: %s\n", failure_analysis.system_limit_reached ? "YES" : "NO");
+        VMLOG_DEBUG("          Invalid Parameters: %s\n", failure_analysis.invalid_parameters ? "YES" : "NO");
+        VMLOG_DEBUG("          Retry Feasible: %s\n", failure_analysis.retry_feasible ? "YES" : "NO");
+        VMLOG_DEBUG("          Recovery Probability: %.1f%%\n", failure_analysis.recovery_probability * 100.0f);
         
         delete managed_texture;
         IOLockUnlock(m_texture_lock);
@@ -2228,16 +2266,16 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     object_validation.object_reference_count = object_validation.object_allocated_successfully ? 1 : 0;
     object_validation.object_supports_required_operations = object_validation.object_allocated_successfully;
     
-    IOLog("        Object Validation Results:\n");
-    IOLog("          Allocation Success: %s\n", object_validation.object_allocated_successfully ? "YES" : "NO");
-    IOLog("          Proper Initialization: %s\n", object_validation.object_properly_initialized ? "YES" : "NO");
-    IOLog("          Memory Valid: %s\n", object_validation.object_memory_valid ? "YES" : "NO");
-    IOLog("          Memory Address: 0x%016llX\n", object_validation.object_memory_address);
-    IOLog("          Reference Count: %d\n", object_validation.object_reference_count);
-    IOLog("          Required Operations: %s\n", object_validation.object_supports_required_operations ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Object Validation Results:\n");
+    VMLOG_DEBUG("          Allocation Success: %s\n", object_validation.object_allocated_successfully ? "YES" : "NO");
+    VMLOG_DEBUG("          Proper Initialization: %s\n", object_validation.object_properly_initialized ? "YES" : "NO");
+    VMLOG_DEBUG("          Memory Valid: %s\n", object_validation.object_memory_valid ? "YES" : "NO");
+    VMLOG_DEBUG("          Memory Address: 0x%016llX\n", object_validation.object_memory_address);
+    VMLOG_DEBUG("          Reference Count: %d\n", object_validation.object_reference_count);
+    VMLOG_DEBUG("          Required Operations: %s\n", object_validation.object_supports_required_operations ? "SUPPORTED" : "UNSUPPORTED");
     
     // Phase 3: Advanced Object Enhancement and Metadata Integration
-    IOLog("      Phase 3: Advanced object enhancement and comprehensive metadata integration\n");
+    VMLOG_DEBUG("      Phase 3: Advanced object enhancement and comprehensive metadata integration\n");
     
     struct ObjectEnhancementSystem {
         bool metadata_integration_enabled;
@@ -2261,18 +2299,18 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     enhancement_system.metadata_size_bytes = 128; // 128 bytes of metadata
     enhancement_system.enhancement_overhead_percentage = 5.0f; // 5% overhead
     
-    IOLog("        Object Enhancement Configuration:\n");
-    IOLog("          Metadata Integration: %s\n", enhancement_system.metadata_integration_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Performance Optimization: %s\n", enhancement_system.performance_optimization_applied ? "APPLIED" : "SKIPPED");
-    IOLog("          Security Hardening: %s\n", enhancement_system.security_hardening_applied ? "APPLIED" : "SKIPPED");
-    IOLog("          Debugging Support: %s\n", enhancement_system.debugging_support_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Runtime Inspection: %s\n", enhancement_system.runtime_inspection_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Enhancement Flags: 0x%02X\n", enhancement_system.enhancement_flags);
-    IOLog("          Metadata Size: %d bytes\n", enhancement_system.metadata_size_bytes);
-    IOLog("          Enhancement Overhead: %.1f%%\n", enhancement_system.enhancement_overhead_percentage);
+    VMLOG_DEBUG("        Object Enhancement Configuration:\n");
+    VMLOG_DEBUG("          Metadata Integration: %s\n", enhancement_system.metadata_integration_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Performance Optimization: %s\n", enhancement_system.performance_optimization_applied ? "APPLIED" : "SKIPPED");
+    VMLOG_DEBUG("          Security Hardening: %s\n", enhancement_system.security_hardening_applied ? "APPLIED" : "SKIPPED");
+    VMLOG_DEBUG("          Debugging Support: %s\n", enhancement_system.debugging_support_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Runtime Inspection: %s\n", enhancement_system.runtime_inspection_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Enhancement Flags: 0x%02X\n", enhancement_system.enhancement_flags);
+    VMLOG_DEBUG("          Metadata Size: %d bytes\n", enhancement_system.metadata_size_bytes);
+    VMLOG_DEBUG("          Enhancement Overhead: %.1f%%\n", enhancement_system.enhancement_overhead_percentage);
     
     // Advanced Object Enhancement Implementation System - Comprehensive Property Modification
-    IOLog("          === Executing Advanced Object Enhancement Implementation ===\n");
+    VMLOG_DEBUG("          === Executing Advanced Object Enhancement Implementation ===\n");
     
     struct EnhancementExecutionPlan {
         uint32_t enhancement_sequence_id;
@@ -2296,15 +2334,15 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     execution_plan.enhancement_impact_score = 0.0f;
     execution_plan.enhancement_execution_successful = false;
     
-    IOLog("            Enhancement Execution Plan:\n");
-    IOLog("              Sequence ID: 0x%04X\n", execution_plan.enhancement_sequence_id);
-    IOLog("              Total Phases: %d\n", execution_plan.total_enhancement_phases);
-    IOLog("              Enhancement Flags: 0x%02X\n", enhancement_system.enhancement_flags);
-    IOLog("              Target Overhead: %.1f%%\n", enhancement_system.enhancement_overhead_percentage);
+    VMLOG_DEBUG("            Enhancement Execution Plan:\n");
+    VMLOG_DEBUG("              Sequence ID: 0x%04X\n", execution_plan.enhancement_sequence_id);
+    VMLOG_DEBUG("              Total Phases: %d\n", execution_plan.total_enhancement_phases);
+    VMLOG_DEBUG("              Enhancement Flags: 0x%02X\n", enhancement_system.enhancement_flags);
+    VMLOG_DEBUG("              Target Overhead: %.1f%%\n", enhancement_system.enhancement_overhead_percentage);
     
     // Apply object enhancements (comprehensive implementation with real property modifications)
     if (enhancement_system.metadata_integration_enabled) {
-        IOLog("          Phase 1/5: Advanced metadata integration implementation\n");
+        VMLOG_DEBUG("          Phase 1/5: Advanced metadata integration implementation\n");
         
         struct MetadataIntegrationSystem {
             uint32_t metadata_version;
@@ -2332,16 +2370,16 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         metadata_system.metadata_creation_timestamp = 0; // Would use mach_absolute_time()
         metadata_system.metadata_integration_efficiency = 0.92f; // 92% efficiency target
         
-        IOLog("            Metadata Integration Configuration:\n");
-        IOLog("              Version: 0x%04X (v1.3)\n", metadata_system.metadata_version);
-        IOLog("              Format: 0x%02X (Binary)\n", metadata_system.metadata_format);
-        IOLog("              Compression: 0x%02X (LZ4)\n", metadata_system.metadata_compression_type);
-        IOLog("              Memory Allocation: %llu bytes\n", metadata_system.metadata_memory_allocation);
-        IOLog("              Encryption: %s\n", metadata_system.metadata_encryption_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Checksum: %s\n", metadata_system.metadata_checksum_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Versioning: %s\n", metadata_system.metadata_versioning_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Access Permissions: 0x%02X\n", metadata_system.metadata_access_permissions);
-        IOLog("              Efficiency Target: %.1f%%\n", metadata_system.metadata_integration_efficiency * 100.0f);
+        VMLOG_DEBUG("            Metadata Integration Configuration:\n");
+        VMLOG_DEBUG("              Version: 0x%04X (v1.3)\n", metadata_system.metadata_version);
+        VMLOG_DEBUG("              Format: 0x%02X (Binary)\n", metadata_system.metadata_format);
+        VMLOG_DEBUG("              Compression: 0x%02X (LZ4)\n", metadata_system.metadata_compression_type);
+        VMLOG_DEBUG("              Memory Allocation: %llu bytes\n", metadata_system.metadata_memory_allocation);
+        VMLOG_DEBUG("              Encryption: %s\n", metadata_system.metadata_encryption_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Checksum: %s\n", metadata_system.metadata_checksum_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Versioning: %s\n", metadata_system.metadata_versioning_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Access Permissions: 0x%02X\n", metadata_system.metadata_access_permissions);
+        VMLOG_DEBUG("              Efficiency Target: %.1f%%\n", metadata_system.metadata_integration_efficiency * 100.0f);
         
         // Execute metadata attachment process
         struct MetadataAttachmentProcess {
@@ -2354,10 +2392,10 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             float attachment_efficiency;
         } attachment_process = {0};
         
-        IOLog("              Executing metadata attachment...\n");
+        VMLOG_DEBUG("              Executing metadata attachment...\n");
         
         // Advanced Metadata Allocation and Management System - Enterprise Implementation
-        IOLog("              === Advanced Metadata Allocation and Management System ===\n");
+        VMLOG_DEBUG("              === Advanced Metadata Allocation and Management System ===\n");
         
         struct MetadataAllocationSubsystem {
             uint32_t subsystem_version;
@@ -2396,23 +2434,23 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         metadata_allocation.allocation_timeout_ms = 100; // 100ms timeout
         metadata_allocation.allocation_subsystem_ready = true;
         
-        IOLog("                Metadata Allocation Subsystem Configuration:\n");
-        IOLog("                  Subsystem Version: 0x%04X (v2.4)\n", metadata_allocation.subsystem_version);
-        IOLog("                  Allocation Strategy: 0x%02X (Optimized + Caching)\n", metadata_allocation.allocation_strategy);
-        IOLog("                  Memory Pool Type: 0x%02X (Dedicated Pool)\n", metadata_allocation.memory_pool_type);
-        IOLog("                  Requested Size: %llu bytes\n", metadata_allocation.requested_metadata_size);
-        IOLog("                  Aligned Size: %llu bytes (alignment: %d)\n", metadata_allocation.aligned_metadata_size, metadata_allocation.alignment_boundary);
-        IOLog("                  Dynamic Expansion: %s\n", metadata_allocation.supports_dynamic_expansion ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                  Compression Support: %s\n", metadata_allocation.supports_metadata_compression ? "ENABLED" : "DISABLED");
-        IOLog("                  Encryption Support: %s\n", metadata_allocation.supports_metadata_encryption ? "ENABLED" : "DISABLED");
-        IOLog("                  Versioning Support: %s\n", metadata_allocation.supports_metadata_versioning ? "ENABLED" : "DISABLED");
-        IOLog("                  Migration Support: %s\n", metadata_allocation.supports_metadata_migration ? "ENABLED" : "DISABLED");
-        IOLog("                  Efficiency Target: %.1f%%\n", metadata_allocation.allocation_efficiency_target * 100.0f);
-        IOLog("                  Retry Limit: %d attempts\n", metadata_allocation.allocation_retry_limit);
-        IOLog("                  Allocation Timeout: %d ms\n", metadata_allocation.allocation_timeout_ms);
+        VMLOG_DEBUG("                Metadata Allocation Subsystem Configuration:\n");
+        VMLOG_DEBUG("                  Subsystem Version: 0x%04X (v2.4)\n", metadata_allocation.subsystem_version);
+        VMLOG_DEBUG("                  Allocation Strategy: 0x%02X (Optimized + Caching)\n", metadata_allocation.allocation_strategy);
+        VMLOG_DEBUG("                  Memory Pool Type: 0x%02X (Dedicated Pool)\n", metadata_allocation.memory_pool_type);
+        VMLOG_DEBUG("                  Requested Size: %llu bytes\n", metadata_allocation.requested_metadata_size);
+        VMLOG_DEBUG("                  Aligned Size: %llu bytes (alignment: %d)\n", metadata_allocation.aligned_metadata_size, metadata_allocation.alignment_boundary);
+        VMLOG_DEBUG("                  Dynamic Expansion: %s\n", metadata_allocation.supports_dynamic_expansion ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                  Compression Support: %s\n", metadata_allocation.supports_metadata_compression ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("                  Encryption Support: %s\n", metadata_allocation.supports_metadata_encryption ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("                  Versioning Support: %s\n", metadata_allocation.supports_metadata_versioning ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("                  Migration Support: %s\n", metadata_allocation.supports_metadata_migration ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("                  Efficiency Target: %.1f%%\n", metadata_allocation.allocation_efficiency_target * 100.0f);
+        VMLOG_DEBUG("                  Retry Limit: %d attempts\n", metadata_allocation.allocation_retry_limit);
+        VMLOG_DEBUG("                  Allocation Timeout: %d ms\n", metadata_allocation.allocation_timeout_ms);
         
         // Phase 1: Advanced Memory Pool Management and Allocation Planning
-        IOLog("                Phase 1: Advanced memory pool management and allocation planning\n");
+        VMLOG_DEBUG("                Phase 1: Advanced memory pool management and allocation planning\n");
         
         struct MemoryPoolManagement {
             uint32_t pool_manager_version;
@@ -2451,22 +2489,22 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             (pool_management.pool_utilization_percentage < 0.85f) &&
             (pool_management.active_allocations_count < (pool_management.maximum_allocations_supported * 0.8f));
         
-        IOLog("                  Memory Pool Management Status:\n");
-        IOLog("                    Pool Manager Version: 0x%04X (v1.5)\n", pool_management.pool_manager_version);
-        IOLog("                    Total Pool Size: %llu MB\n", pool_management.total_pool_size / (1024 * 1024));
-        IOLog("                    Available Size: %llu MB\n", pool_management.available_pool_size / (1024 * 1024));
-        IOLog("                    Reserved Size: %llu MB\n", pool_management.reserved_pool_size / (1024 * 1024));
-        IOLog("                    Fragmentation Level: %d%% (%s)\n", pool_management.pool_fragmentation_level, 
+        VMLOG_DEBUG("                  Memory Pool Management Status:\n");
+        VMLOG_DEBUG("                    Pool Manager Version: 0x%04X (v1.5)\n", pool_management.pool_manager_version);
+        VMLOG_DEBUG("                    Total Pool Size: %llu MB\n", pool_management.total_pool_size / (1024 * 1024));
+        VMLOG_DEBUG("                    Available Size: %llu MB\n", pool_management.available_pool_size / (1024 * 1024));
+        VMLOG_DEBUG("                    Reserved Size: %llu MB\n", pool_management.reserved_pool_size / (1024 * 1024));
+        VMLOG_DEBUG("                    Fragmentation Level: %d%% (%s)\n", pool_management.pool_fragmentation_level, 
               pool_management.pool_fragmentation_level < 20 ? "GOOD" : "NEEDS DEFRAG");
-        IOLog("                    Active Allocations: %d / %d (%.1f%%)\n", 
+        VMLOG_DEBUG("                    Active Allocations: %d / %d (%.1f%%)\n", 
               pool_management.active_allocations_count, pool_management.maximum_allocations_supported,
               ((float)pool_management.active_allocations_count / (float)pool_management.maximum_allocations_supported) * 100.0f);
-        IOLog("                    Defragmentation: %s\n", pool_management.pool_defragmentation_available ? "AVAILABLE" : "UNAVAILABLE");
-        IOLog("                    Pool Expansion: %s\n", pool_management.pool_expansion_supported ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                    Compression: %s\n", pool_management.pool_compression_enabled ? "ENABLED" : "DISABLED");
-        IOLog("                    Utilization: %.1f%%\n", pool_management.pool_utilization_percentage * 100.0f);
-        IOLog("                    Efficiency Score: %.1f%%\n", pool_management.pool_efficiency_score * 100.0f);
-        IOLog("                    Pool Health: %s\n", pool_management.pool_health_optimal ? "OPTIMAL" : "NEEDS ATTENTION");
+        VMLOG_DEBUG("                    Defragmentation: %s\n", pool_management.pool_defragmentation_available ? "AVAILABLE" : "UNAVAILABLE");
+        VMLOG_DEBUG("                    Pool Expansion: %s\n", pool_management.pool_expansion_supported ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                    Compression: %s\n", pool_management.pool_compression_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("                    Utilization: %.1f%%\n", pool_management.pool_utilization_percentage * 100.0f);
+        VMLOG_DEBUG("                    Efficiency Score: %.1f%%\n", pool_management.pool_efficiency_score * 100.0f);
+        VMLOG_DEBUG("                    Pool Health: %s\n", pool_management.pool_health_optimal ? "OPTIMAL" : "NEEDS ATTENTION");
         
         // Check if allocation is feasible
         bool allocation_feasible = 
@@ -2475,18 +2513,18 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             (pool_management.active_allocations_count < pool_management.maximum_allocations_supported);
         
         if (!allocation_feasible) {
-            IOLog("                    WARNING: Allocation feasibility check failed\n");
-            IOLog("                      Pool Health: %s\n", pool_management.pool_health_optimal ? "OPTIMAL" : "SUBOPTIMAL");
-            IOLog("                      Size Check: %s (requested: %llu, available: %llu)\n", 
+            VMLOG_ERROR("                    WARNING: Allocation feasibility check failed\n");
+            VMLOG_DEBUG("                      Pool Health: %s\n", pool_management.pool_health_optimal ? "OPTIMAL" : "SUBOPTIMAL");
+            VMLOG_DEBUG("                      Size Check: %s (requested: %llu, available: %llu)\n", 
                   (metadata_allocation.aligned_metadata_size <= pool_management.available_pool_size) ? "PASS" : "FAIL",
                   metadata_allocation.aligned_metadata_size, pool_management.available_pool_size);
-            IOLog("                      Allocation Limit: %s (%d / %d)\n",
+            VMLOG_DEBUG("                      Allocation Limit: %s (%d / %d)\n",
                   (pool_management.active_allocations_count < pool_management.maximum_allocations_supported) ? "PASS" : "FAIL",
                   pool_management.active_allocations_count, pool_management.maximum_allocations_supported);
         }
         
         // Phase 2: Advanced Metadata Structure Creation and Initialization
-        IOLog("                Phase 2: Advanced metadata structure creation and initialization\n");
+        VMLOG_DEBUG("                Phase 2: Advanced metadata structure creation and initialization\n");
         
         struct MetadataStructureDefinition {
             uint32_t structure_format_version;
@@ -2521,20 +2559,20 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         structure_definition.structure_complexity_level = 4; // Level 4 (High complexity)
         structure_definition.structure_access_efficiency = 0.93f; // 93% access efficiency
         
-        IOLog("                  Metadata Structure Definition:\n");
-        IOLog("                    Format Version: 0x%04X (v1.7)\n", structure_definition.structure_format_version);
-        IOLog("                    Structure Type ID: 0x%04X (Texture Metadata)\n", structure_definition.structure_type_id);
-        IOLog("                    Base Structure Size: %llu bytes\n", structure_definition.base_structure_size);
-        IOLog("                    Extended Structure Size: %llu bytes\n", structure_definition.extended_structure_size);
-        IOLog("                    Field Count: %d fields\n", structure_definition.field_count);
-        IOLog("                    Field Alignment: %d bytes\n", structure_definition.field_alignment_boundary);
-        IOLog("                    Variable Length Fields: %s\n", structure_definition.supports_variable_length_fields ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                    Nested Structures: %s\n", structure_definition.supports_nested_structures ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                    Field Validation: %s\n", structure_definition.supports_field_validation ? "ENABLED" : "DISABLED");
-        IOLog("                    Structure Inheritance: %s\n", structure_definition.supports_structure_inheritance ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                    Custom Serialization: %s\n", structure_definition.supports_custom_serialization ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                    Complexity Level: %d (High)\n", structure_definition.structure_complexity_level);
-        IOLog("                    Access Efficiency: %.1f%%\n", structure_definition.structure_access_efficiency * 100.0f);
+        VMLOG_DEBUG("                  Metadata Structure Definition:\n");
+        VMLOG_DEBUG("                    Format Version: 0x%04X (v1.7)\n", structure_definition.structure_format_version);
+        VMLOG_DEBUG("                    Structure Type ID: 0x%04X (Texture Metadata)\n", structure_definition.structure_type_id);
+        VMLOG_DEBUG("                    Base Structure Size: %llu bytes\n", structure_definition.base_structure_size);
+        VMLOG_DEBUG("                    Extended Structure Size: %llu bytes\n", structure_definition.extended_structure_size);
+        VMLOG_DEBUG("                    Field Count: %d fields\n", structure_definition.field_count);
+        VMLOG_DEBUG("                    Field Alignment: %d bytes\n", structure_definition.field_alignment_boundary);
+        VMLOG_DEBUG("                    Variable Length Fields: %s\n", structure_definition.supports_variable_length_fields ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                    Nested Structures: %s\n", structure_definition.supports_nested_structures ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                    Field Validation: %s\n", structure_definition.supports_field_validation ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("                    Structure Inheritance: %s\n", structure_definition.supports_structure_inheritance ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                    Custom Serialization: %s\n", structure_definition.supports_custom_serialization ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                    Complexity Level: %d (High)\n", structure_definition.structure_complexity_level);
+        VMLOG_DEBUG("                    Access Efficiency: %.1f%%\n", structure_definition.structure_access_efficiency * 100.0f);
         
         // Execute metadata structure allocation with comprehensive monitoring
         void* metadata_structure_ptr = nullptr;
@@ -2543,11 +2581,11 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         uint64_t allocation_start_time = 0; // Would use mach_absolute_time()
         uint64_t allocation_end_time = 0;
         
-        IOLog("                  Executing metadata structure allocation...\n");
+        VMLOG_DEBUG("                  Executing metadata structure allocation...\n");
         
         // Advanced allocation loop with retry logic and monitoring
         for (allocation_attempts = 1; allocation_attempts <= metadata_allocation.allocation_retry_limit; allocation_attempts++) {
-            IOLog("                    Allocation attempt %d/%d\n", allocation_attempts, metadata_allocation.allocation_retry_limit);
+            VMLOG_DEBUG("                    Allocation attempt %d/%d\n", allocation_attempts, metadata_allocation.allocation_retry_limit);
             
             // Simulate allocation attempt (in real implementation, would use IOMalloc or similar)
             allocation_start_time = 0; // mach_absolute_time()
@@ -2589,47 +2627,47 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                 allocation_successful = true;
                 attempt_context.attempt_error_code = 0x00; // Success
                 
-                IOLog("                      Allocation SUCCESS on attempt %d\n", allocation_attempts);
-                IOLog("                        Memory Address: 0x%016llX\n", attempt_context.attempt_memory_address);
-                IOLog("                        Memory Valid: %s\n", attempt_context.attempt_memory_valid ? "YES" : "NO");
-                IOLog("                        Alignment Correct: %s\n", attempt_context.attempt_alignment_correct ? "YES" : "NO");
-                IOLog("                        Pool Sufficient: %s\n", attempt_context.attempt_pool_sufficient ? "YES" : "NO");
-                IOLog("                        Permissions Valid: %s\n", attempt_context.attempt_permissions_valid ? "YES" : "NO");
-                IOLog("                        Success Probability: %.1f%%\n", attempt_context.attempt_success_probability * 100.0f);
+                VMLOG_DEBUG("                      Allocation SUCCESS on attempt %d\n", allocation_attempts);
+                VMLOG_DEBUG("                        Memory Address: 0x%016llX\n", attempt_context.attempt_memory_address);
+                VMLOG_DEBUG("                        Memory Valid: %s\n", attempt_context.attempt_memory_valid ? "YES" : "NO");
+                VMLOG_DEBUG("                        Alignment Correct: %s\n", attempt_context.attempt_alignment_correct ? "YES" : "NO");
+                VMLOG_DEBUG("                        Pool Sufficient: %s\n", attempt_context.attempt_pool_sufficient ? "YES" : "NO");
+                VMLOG_DEBUG("                        Permissions Valid: %s\n", attempt_context.attempt_permissions_valid ? "YES" : "NO");
+                VMLOG_DEBUG("                        Success Probability: %.1f%%\n", attempt_context.attempt_success_probability * 100.0f);
                 break;
             } else {
                 // Analyze failure reasons
                 if (!attempt_context.attempt_memory_valid) {
                     attempt_context.attempt_error_code = 0x01; // Memory allocation failure
-                    IOLog("                      Allocation FAILED: Memory allocation failure\n");
+                    VMLOG_WARN("                      Allocation FAILED: Memory allocation failure\n");
                 } else if (!attempt_context.attempt_alignment_correct) {
                     attempt_context.attempt_error_code = 0x02; // Alignment failure
-                    IOLog("                      Allocation FAILED: Alignment requirement not met\n");
+                    VMLOG_WARN("                      Allocation FAILED: Alignment requirement not met\n");
                 } else if (!attempt_context.attempt_pool_sufficient) {
                     attempt_context.attempt_error_code = 0x03; // Insufficient pool memory
-                    IOLog("                      Allocation FAILED: Insufficient pool memory\n");
+                    VMLOG_WARN("                      Allocation FAILED: Insufficient pool memory\n");
                 } else if (!attempt_context.attempt_permissions_valid) {
                     attempt_context.attempt_error_code = 0x04; // Permission denied
-                    IOLog("                      Allocation FAILED: Permission denied\n");
+                    VMLOG_WARN("                      Allocation FAILED: Permission denied\n");
                 } else {
                     attempt_context.attempt_error_code = 0x05; // Low success probability
-                    IOLog("                      Allocation FAILED: Success probability too low (%.1f%%)\n", 
+                    VMLOG_WARN("                      Allocation FAILED: Success probability too low (%.1f%%)\n", 
                           attempt_context.attempt_success_probability * 100.0f);
                 }
                 
                 // Wait before retry (in real implementation, would implement exponential backoff)
-                IOLog("                      Waiting before retry attempt %d...\n", allocation_attempts + 1);
+                VMLOG_DEBUG("                      Waiting before retry attempt %d...\n", allocation_attempts + 1);
                 
                 // Attempt recovery strategies for next iteration
                 if (attempt_context.attempt_error_code == 0x03) {
                     // Try pool defragmentation if available
                     if (pool_management.pool_defragmentation_available) {
-                        IOLog("                        Attempting pool defragmentation...\n");
+                        VMLOG_DEBUG("                        Attempting pool defragmentation...\n");
                         pool_management.pool_fragmentation_level = 
                             pool_management.pool_fragmentation_level > 5 ? 
                             pool_management.pool_fragmentation_level - 5 : 0; // Reduce fragmentation by 5%
                         pool_management.available_pool_size += (pool_management.total_pool_size / 20); // Recover 5% more space
-                        IOLog("                          Defragmentation complete: fragmentation reduced to %d%%\n", 
+                        VMLOG_DEBUG("                          Defragmentation complete: fragmentation reduced to %d%%\n", 
                               pool_management.pool_fragmentation_level);
                     }
                 }
@@ -2639,14 +2677,14 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         allocation_end_time = 0; // mach_absolute_time()
         
         // Phase 3: Post-Allocation Validation and Structure Initialization
-        IOLog("                Phase 3: Post-allocation validation and structure initialization\n");
+        VMLOG_DEBUG("                Phase 3: Post-allocation validation and structure initialization\n");
         
         attachment_process.metadata_allocation_successful = allocation_successful;
         
         if (allocation_successful) {
-            IOLog("                  Metadata allocation completed successfully after %d attempts\n", allocation_attempts);
-            IOLog("                    Final memory address: 0x%016llX\n", (uint64_t)metadata_structure_ptr);
-            IOLog("                    Allocated size: %llu bytes (aligned)\n", metadata_allocation.aligned_metadata_size);
+            VMLOG_DEBUG("                  Metadata allocation completed successfully after %d attempts\n", allocation_attempts);
+            VMLOG_DEBUG("                    Final memory address: 0x%016llX\n", (uint64_t)metadata_structure_ptr);
+            VMLOG_DEBUG("                    Allocated size: %llu bytes (aligned)\n", metadata_allocation.aligned_metadata_size);
             
             // Advanced Structure Initialization System
             struct StructureInitializationSystem {
@@ -2672,44 +2710,44 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             init_system.initialization_progress = 0.0f;
             init_system.initialization_successful = false;
             
-            IOLog("                    Structure Initialization Configuration:\n");
-            IOLog("                      Zero Memory Init: %s\n", init_system.zero_memory_initialization ? "ENABLED" : "DISABLED");
-            IOLog("                      Default Values Setup: %s\n", init_system.field_default_value_setup ? "ENABLED" : "DISABLED");
-            IOLog("                      Header Creation: %s\n", init_system.structure_header_creation ? "ENABLED" : "DISABLED");
-            IOLog("                      Validation Markers: %s\n", init_system.validation_markers_insertion ? "ENABLED" : "DISABLED");
-            IOLog("                      Checksum Calculation: %s\n", init_system.checksum_calculation ? "ENABLED" : "DISABLED");
-            IOLog("                      Total Phases: %d\n", init_system.initialization_phases_count);
+            VMLOG_DEBUG("                    Structure Initialization Configuration:\n");
+            VMLOG_DEBUG("                      Zero Memory Init: %s\n", init_system.zero_memory_initialization ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                      Default Values Setup: %s\n", init_system.field_default_value_setup ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                      Header Creation: %s\n", init_system.structure_header_creation ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                      Validation Markers: %s\n", init_system.validation_markers_insertion ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                      Checksum Calculation: %s\n", init_system.checksum_calculation ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                      Total Phases: %d\n", init_system.initialization_phases_count);
             
             // Execute initialization phases
-            IOLog("                    Executing structure initialization phases...\n");
+            VMLOG_DEBUG("                    Executing structure initialization phases...\n");
             
             // Phase 1: Zero memory initialization
             if (init_system.zero_memory_initialization) {
-                IOLog("                      Phase 1/5: Zero memory initialization\n");
+                VMLOG_DEBUG("                      Phase 1/5: Zero memory initialization\n");
                 // In real implementation: memset(metadata_structure_ptr, 0, metadata_allocation.aligned_metadata_size);
                 init_system.completed_initialization_phases++;
-                IOLog("                        Memory zeroed: %llu bytes\n", metadata_allocation.aligned_metadata_size);
+                VMLOG_DEBUG("                        Memory zeroed: %llu bytes\n", metadata_allocation.aligned_metadata_size);
             }
             
             // Phase 2: Field default value setup
             if (init_system.field_default_value_setup) {
-                IOLog("                      Phase 2/5: Field default value setup\n");
+                VMLOG_DEBUG("                      Phase 2/5: Field default value setup\n");
                 // In real implementation: Set up default values for each field in the structure
                 for (uint32_t field_idx = 0; field_idx < structure_definition.field_count; field_idx++) {
                     // Would set default values for each field
                     if ((field_idx % 8) == 0) { // Progress update every 8 fields
-                        IOLog("                        Setting default values: %d/%d fields (%.1f%%)\n", 
+                        VMLOG_DEBUG("                        Setting default values: %d/%d fields (%.1f%%)\n", 
                               field_idx + 1, structure_definition.field_count,
                               ((float)(field_idx + 1) / (float)structure_definition.field_count) * 100.0f);
                     }
                 }
                 init_system.completed_initialization_phases++;
-                IOLog("                        Default values configured: %d fields\n", structure_definition.field_count);
+                VMLOG_DEBUG("                        Default values configured: %d fields\n", structure_definition.field_count);
             }
             
             // Phase 3: Structure header creation
             if (init_system.structure_header_creation) {
-                IOLog("                      Phase 3/5: Structure header creation\n");
+                VMLOG_DEBUG("                      Phase 3/5: Structure header creation\n");
                 // In real implementation: Create and populate structure header
                 struct MetadataStructureHeader {
                     uint32_t magic_number;
@@ -2731,15 +2769,15 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                 
                 // In real implementation: Copy header to metadata_structure_ptr
                 init_system.completed_initialization_phases++;
-                IOLog("                        Header created: Magic=0x%08X, Version=0x%04X, Type=0x%04X\n", 
+                VMLOG_DEBUG("                        Header created: Magic=0x%08X, Version=0x%04X, Type=0x%04X\n", 
                       header.magic_number, header.structure_version, header.structure_type);
-                IOLog("                        Header size: %llu bytes, Fields: %d, Checksum: 0x%08X\n",
+                VMLOG_DEBUG("                        Header size: %llu bytes, Fields: %d, Checksum: 0x%08X\n",
                       header.structure_size, header.field_count, header.header_checksum);
             }
             
             // Phase 4: Validation markers insertion
             if (init_system.validation_markers_insertion) {
-                IOLog("                      Phase 4/5: Validation markers insertion\n");
+                VMLOG_DEBUG("                      Phase 4/5: Validation markers insertion\n");
                 // In real implementation: Insert validation markers throughout structure
                 uint32_t validation_markers_inserted = 0;
                 uint32_t validation_marker_interval = (uint32_t)(structure_definition.base_structure_size / 8); // Every 32 bytes
@@ -2752,19 +2790,19 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                 }
                 
                 init_system.completed_initialization_phases++;
-                IOLog("                        Validation markers inserted: %d markers\n", validation_markers_inserted);
-                IOLog("                        Marker interval: %d bytes\n", validation_marker_interval);
+                VMLOG_DEBUG("                        Validation markers inserted: %d markers\n", validation_markers_inserted);
+                VMLOG_DEBUG("                        Marker interval: %d bytes\n", validation_marker_interval);
             }
             
             // Phase 5: Checksum calculation
             if (init_system.checksum_calculation) {
-                IOLog("                      Phase 5/5: Structure checksum calculation\n");
+                VMLOG_DEBUG("                      Phase 5/5: Structure checksum calculation\n");
                 // In real implementation: Calculate checksum of entire structure
                 uint32_t calculated_checksum = 0x12345678; // Simulated checksum calculation
                 
                 init_system.completed_initialization_phases++;
-                IOLog("                        Structure checksum calculated: 0x%08X\n", calculated_checksum);
-                IOLog("                        Checksum algorithm: %s\n", 
+                VMLOG_DEBUG("                        Structure checksum calculated: 0x%08X\n", calculated_checksum);
+                VMLOG_DEBUG("                        Checksum algorithm: %s\n", 
                       (metadata_system.metadata_checksum_enabled) ? "SHA-256" : "CRC32");
             }
             
@@ -2773,16 +2811,16 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                 (float)init_system.completed_initialization_phases / (float)init_system.initialization_phases_count;
             init_system.initialization_successful = (init_system.initialization_progress >= 1.0f);
             
-            IOLog("                    Structure Initialization Results:\n");
-            IOLog("                      Completed Phases: %d/%d (%.1f%%)\n", 
+            VMLOG_DEBUG("                    Structure Initialization Results:\n");
+            VMLOG_DEBUG("                      Completed Phases: %d/%d (%.1f%%)\n", 
                   init_system.completed_initialization_phases, init_system.initialization_phases_count,
                   init_system.initialization_progress * 100.0f);
-            IOLog("                      Initialization Success: %s\n", init_system.initialization_successful ? "YES" : "NO");
+            VMLOG_DEBUG("                      Initialization Success: %s\n", init_system.initialization_successful ? "YES" : "NO");
             
             attachment_process.metadata_structure_created = init_system.initialization_successful;
             
         } else {
-            IOLog("                  ERROR: Metadata allocation failed after %d attempts\n", allocation_attempts);
+            VMLOG_ERROR("                  ERROR: Metadata allocation failed after %d attempts\n", allocation_attempts);
             attachment_process.metadata_structure_created = false;
         }
         
@@ -2799,14 +2837,14 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             attachment_process.metadata_properties_configured &&
             attachment_process.metadata_linked_to_object;
         
-        IOLog("                Metadata Attachment Results:\n");
-        IOLog("                  Allocation: %s\n", attachment_process.metadata_allocation_successful ? "SUCCESS" : "FAILED");
-        IOLog("                  Structure Creation: %s\n", attachment_process.metadata_structure_created ? "SUCCESS" : "FAILED");
-        IOLog("                  Properties Configuration: %s\n", attachment_process.metadata_properties_configured ? "SUCCESS" : "FAILED");
-        IOLog("                  Object Linking: %s\n", attachment_process.metadata_linked_to_object ? "SUCCESS" : "FAILED");
-        IOLog("                  Validation: %s\n", attachment_process.metadata_validation_passed ? "PASSED" : "FAILED");
-        IOLog("                  Checksum: 0x%08X\n", attachment_process.metadata_checksum);
-        IOLog("                  Efficiency: %.1f%%\n", attachment_process.attachment_efficiency * 100.0f);
+        VMLOG_DEBUG("                Metadata Attachment Results:\n");
+        VMLOG_DEBUG("                  Allocation: %s\n", attachment_process.metadata_allocation_successful ? "SUCCESS" : "FAILED");
+        VMLOG_DEBUG("                  Structure Creation: %s\n", attachment_process.metadata_structure_created ? "SUCCESS" : "FAILED");
+        VMLOG_DEBUG("                  Properties Configuration: %s\n", attachment_process.metadata_properties_configured ? "SUCCESS" : "FAILED");
+        VMLOG_DEBUG("                  Object Linking: %s\n", attachment_process.metadata_linked_to_object ? "SUCCESS" : "FAILED");
+        VMLOG_DEBUG("                  Validation: %s\n", attachment_process.metadata_validation_passed ? "PASSED" : "FAILED");
+        VMLOG_DEBUG("                  Checksum: 0x%08X\n", attachment_process.metadata_checksum);
+        VMLOG_DEBUG("                  Efficiency: %.1f%%\n", attachment_process.attachment_efficiency * 100.0f);
         
         metadata_system.metadata_attachment_successful = attachment_process.metadata_validation_passed;
         execution_plan.metadata_integration_complete = metadata_system.metadata_attachment_successful;
@@ -2814,14 +2852,14 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         if (execution_plan.metadata_integration_complete) {
             execution_plan.completed_enhancement_phases++;
             execution_plan.enhancement_impact_score += 0.2f; // 20% impact
-            IOLog("              Metadata integration: COMPLETE\n");
+            VMLOG_DEBUG("              Metadata integration: COMPLETE\n");
         } else {
-            IOLog("              ERROR: Metadata integration failed\n");
+            VMLOG_ERROR("              ERROR: Metadata integration failed\n");
         }
     }
     
     if (enhancement_system.performance_optimization_applied) {
-        IOLog("          Phase 2/5: Advanced performance optimization implementation\n");
+        VMLOG_DEBUG("          Phase 2/5: Advanced performance optimization implementation\n");
         
         struct PerformanceOptimizationSystem {
             uint32_t optimization_level;
@@ -2848,15 +2886,15 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         performance_system.memory_alignment_boundary = 64; // 64-byte alignment
         performance_system.performance_improvement_target = 0.25f; // 25% improvement target
         
-        IOLog("            Performance Optimization Configuration:\n");
-        IOLog("              Optimization Level: %d (Aggressive)\n", performance_system.optimization_level);
-        IOLog("              Cache Optimization: %s\n", performance_system.cache_optimization_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Memory Alignment: %s (%d bytes)\n", performance_system.memory_alignment_optimization ? "ENABLED" : "DISABLED", performance_system.memory_alignment_boundary);
-        IOLog("              Access Pattern Opt: %s\n", performance_system.access_pattern_optimization ? "ENABLED" : "DISABLED");
-        IOLog("              Branch Prediction: %s\n", performance_system.branch_prediction_optimization ? "ENABLED" : "DISABLED");
-        IOLog("              Vectorization: %s\n", performance_system.vectorization_optimization ? "ENABLED" : "DISABLED");
-        IOLog("              Cache Prefetch Distance: %d lines\n", performance_system.cache_prefetch_distance);
-        IOLog("              Performance Target: +%.1f%%\n", performance_system.performance_improvement_target * 100.0f);
+        VMLOG_DEBUG("            Performance Optimization Configuration:\n");
+        VMLOG_DEBUG("              Optimization Level: %d (Aggressive)\n", performance_system.optimization_level);
+        VMLOG_DEBUG("              Cache Optimization: %s\n", performance_system.cache_optimization_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Memory Alignment: %s (%d bytes)\n", performance_system.memory_alignment_optimization ? "ENABLED" : "DISABLED", performance_system.memory_alignment_boundary);
+        VMLOG_DEBUG("              Access Pattern Opt: %s\n", performance_system.access_pattern_optimization ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Branch Prediction: %s\n", performance_system.branch_prediction_optimization ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Vectorization: %s\n", performance_system.vectorization_optimization ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Cache Prefetch Distance: %d lines\n", performance_system.cache_prefetch_distance);
+        VMLOG_DEBUG("              Performance Target: +%.1f%%\n", performance_system.performance_improvement_target * 100.0f);
         
         // Execute performance optimization process
         struct PerformanceOptimizationExecution {
@@ -2872,39 +2910,39 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             bool execution_successful;
         } perf_execution = {0};
         
-        IOLog("              Executing performance optimizations...\n");
+        VMLOG_DEBUG("              Executing performance optimizations...\n");
         
         // Apply cache optimization
         if (performance_system.cache_optimization_enabled) {
-            IOLog("                Applying cache optimization...\n");
+            VMLOG_DEBUG("                Applying cache optimization...\n");
             perf_execution.cache_optimization_applied = true;
             perf_execution.cache_performance_gain = 0.08f; // 8% cache improvement
         }
         
         // Apply memory alignment optimization
         if (performance_system.memory_alignment_optimization) {
-            IOLog("                Applying memory alignment optimization...\n");
+            VMLOG_DEBUG("                Applying memory alignment optimization...\n");
             perf_execution.alignment_optimization_applied = true;
             perf_execution.alignment_performance_gain = 0.06f; // 6% alignment improvement
         }
         
         // Apply access pattern optimization
         if (performance_system.access_pattern_optimization) {
-            IOLog("                Applying access pattern optimization...\n");
+            VMLOG_DEBUG("                Applying access pattern optimization...\n");
             perf_execution.pattern_optimization_applied = true;
             perf_execution.pattern_performance_gain = 0.10f; // 10% pattern improvement
         }
         
         // Apply branch prediction optimization
         if (performance_system.branch_prediction_optimization) {
-            IOLog("                Applying branch prediction optimization...\n");
+            VMLOG_DEBUG("                Applying branch prediction optimization...\n");
             perf_execution.branch_optimization_applied = true;
             // Branch prediction gains included in pattern optimization
         }
         
         // Apply vectorization if supported
         if (performance_system.vectorization_optimization) {
-            IOLog("                Applying vectorization optimization...\n");
+            VMLOG_DEBUG("                Applying vectorization optimization...\n");
             perf_execution.vectorization_applied = true;
             // Vectorization gains included in overall calculation
         }
@@ -2921,29 +2959,29 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         performance_system.achieved_performance_improvement = perf_execution.total_performance_gain;
         performance_system.optimization_successful = perf_execution.execution_successful;
         
-        IOLog("                Performance Optimization Results:\n");
-        IOLog("                  Cache Optimization: %s (+%.1f%%)\n", perf_execution.cache_optimization_applied ? "APPLIED" : "SKIPPED", perf_execution.cache_performance_gain * 100.0f);
-        IOLog("                  Alignment Optimization: %s (+%.1f%%)\n", perf_execution.alignment_optimization_applied ? "APPLIED" : "SKIPPED", perf_execution.alignment_performance_gain * 100.0f);
-        IOLog("                  Pattern Optimization: %s (+%.1f%%)\n", perf_execution.pattern_optimization_applied ? "APPLIED" : "SKIPPED", perf_execution.pattern_performance_gain * 100.0f);
-        IOLog("                  Branch Optimization: %s\n", perf_execution.branch_optimization_applied ? "APPLIED" : "SKIPPED");
-        IOLog("                  Vectorization: %s\n", perf_execution.vectorization_applied ? "APPLIED" : "SKIPPED");
-        IOLog("                  Total Performance Gain: +%.1f%%\n", perf_execution.total_performance_gain * 100.0f);
-        IOLog("                  Target Achievement: %.1f%%\n", (perf_execution.total_performance_gain / performance_system.performance_improvement_target) * 100.0f);
-        IOLog("                  Optimization Success: %s\n", perf_execution.execution_successful ? "YES" : "NO");
+        VMLOG_DEBUG("                Performance Optimization Results:\n");
+        VMLOG_DEBUG("                  Cache Optimization: %s (+%.1f%%)\n", perf_execution.cache_optimization_applied ? "APPLIED" : "SKIPPED", perf_execution.cache_performance_gain * 100.0f);
+        VMLOG_DEBUG("                  Alignment Optimization: %s (+%.1f%%)\n", perf_execution.alignment_optimization_applied ? "APPLIED" : "SKIPPED", perf_execution.alignment_performance_gain * 100.0f);
+        VMLOG_DEBUG("                  Pattern Optimization: %s (+%.1f%%)\n", perf_execution.pattern_optimization_applied ? "APPLIED" : "SKIPPED", perf_execution.pattern_performance_gain * 100.0f);
+        VMLOG_DEBUG("                  Branch Optimization: %s\n", perf_execution.branch_optimization_applied ? "APPLIED" : "SKIPPED");
+        VMLOG_DEBUG("                  Vectorization: %s\n", perf_execution.vectorization_applied ? "APPLIED" : "SKIPPED");
+        VMLOG_DEBUG("                  Total Performance Gain: +%.1f%%\n", perf_execution.total_performance_gain * 100.0f);
+        VMLOG_DEBUG("                  Target Achievement: %.1f%%\n", (perf_execution.total_performance_gain / performance_system.performance_improvement_target) * 100.0f);
+        VMLOG_DEBUG("                  Optimization Success: %s\n", perf_execution.execution_successful ? "YES" : "NO");
         
         execution_plan.performance_optimization_complete = performance_system.optimization_successful;
         
         if (execution_plan.performance_optimization_complete) {
             execution_plan.completed_enhancement_phases++;
             execution_plan.enhancement_impact_score += performance_system.achieved_performance_improvement;
-            IOLog("              Performance optimization: COMPLETE (+%.1f%% improvement)\n", performance_system.achieved_performance_improvement * 100.0f);
+            VMLOG_DEBUG("              Performance optimization: COMPLETE (+%.1f%% improvement)\n", performance_system.achieved_performance_improvement * 100.0f);
         } else {
-            IOLog("              WARNING: Performance optimization below target\n");
+            VMLOG_WARN("              WARNING: Performance optimization below target\n");
         }
     }
     
     if (enhancement_system.security_hardening_applied) {
-        IOLog("          Phase 3/5: Advanced security hardening implementation\n");
+        VMLOG_DEBUG("          Phase 3/5: Advanced security hardening implementation\n");
         
         struct SecurityHardeningSystem {
             uint32_t security_level;
@@ -2971,14 +3009,14 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         security_system.access_control_flags = 0x07; // Full access control
         security_system.security_overhead_percentage = 3.0f; // 3% overhead
         
-        IOLog("            Security Hardening Configuration:\n");
-        IOLog("              Security Level: 0x%02X\n", security_system.security_level);
-        IOLog("              Memory Protection: %s\n", security_system.memory_protection_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Access Control: %s (0x%02X)\n", security_system.access_control_enabled ? "ENABLED" : "DISABLED", security_system.access_control_flags);
-        IOLog("              Encryption: %s (Algorithm: 0x%02X)\n", security_system.encryption_enabled ? "ENABLED" : "DISABLED", security_system.encryption_algorithm);
-        IOLog("              Integrity Checking: %s (Algorithm: 0x%02X)\n", security_system.integrity_checking_enabled ? "ENABLED" : "DISABLED", security_system.integrity_algorithm);
-        IOLog("              Audit Logging: %s\n", security_system.audit_logging_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Security Overhead: %.1f%%\n", security_system.security_overhead_percentage);
+        VMLOG_DEBUG("            Security Hardening Configuration:\n");
+        VMLOG_DEBUG("              Security Level: 0x%02X\n", security_system.security_level);
+        VMLOG_DEBUG("              Memory Protection: %s\n", security_system.memory_protection_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Access Control: %s (0x%02X)\n", security_system.access_control_enabled ? "ENABLED" : "DISABLED", security_system.access_control_flags);
+        VMLOG_DEBUG("              Encryption: %s (Algorithm: 0x%02X)\n", security_system.encryption_enabled ? "ENABLED" : "DISABLED", security_system.encryption_algorithm);
+        VMLOG_DEBUG("              Integrity Checking: %s (Algorithm: 0x%02X)\n", security_system.integrity_checking_enabled ? "ENABLED" : "DISABLED", security_system.integrity_algorithm);
+        VMLOG_DEBUG("              Audit Logging: %s\n", security_system.audit_logging_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Security Overhead: %.1f%%\n", security_system.security_overhead_percentage);
         
         // Execute security hardening process
         struct SecurityHardeningExecution {
@@ -2992,36 +3030,36 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             bool execution_successful;
         } security_execution = {0};
         
-        IOLog("              Executing security hardening...\n");
+        VMLOG_DEBUG("              Executing security hardening...\n");
         
         // Apply memory protection
         if (security_system.memory_protection_enabled) {
-            IOLog("                Applying memory protection...\n");
+            VMLOG_DEBUG("                Applying memory protection...\n");
             security_execution.memory_protection_applied = true;
         }
         
         // Apply access control
         if (security_system.access_control_enabled) {
-            IOLog("                Applying access control...\n");
+            VMLOG_DEBUG("                Applying access control...\n");
             security_execution.access_control_applied = true;
         }
         
         // Apply encryption if enabled
         if (security_system.encryption_enabled) {
-            IOLog("                Applying encryption (AES-256)...\n");
+            VMLOG_DEBUG("                Applying encryption (AES-256)...\n");
             security_execution.encryption_applied = true;
         }
         
         // Apply integrity checking
         if (security_system.integrity_checking_enabled) {
-            IOLog("                Applying integrity checking (SHA-256)...\n");
+            VMLOG_DEBUG("                Applying integrity checking (SHA-256)...\n");
             security_execution.integrity_checking_applied = true;
             security_execution.security_validation_checksum = 0x87654321; // Simulated checksum
         }
         
         // Apply audit logging if enabled
         if (security_system.audit_logging_enabled) {
-            IOLog("                Applying audit logging...\n");
+            VMLOG_DEBUG("                Applying audit logging...\n");
             security_execution.audit_logging_applied = true;
         }
         
@@ -3039,29 +3077,29 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         
         security_system.hardening_successful = security_execution.execution_successful;
         
-        IOLog("                Security Hardening Results:\n");
-        IOLog("                  Memory Protection: %s\n", security_execution.memory_protection_applied ? "APPLIED" : "SKIPPED");
-        IOLog("                  Access Control: %s\n", security_execution.access_control_applied ? "APPLIED" : "SKIPPED");
-        IOLog("                  Encryption: %s\n", security_execution.encryption_applied ? "APPLIED" : "SKIPPED");
-        IOLog("                  Integrity Checking: %s\n", security_execution.integrity_checking_applied ? "APPLIED" : "SKIPPED");
-        IOLog("                  Audit Logging: %s\n", security_execution.audit_logging_applied ? "APPLIED" : "SKIPPED");
-        IOLog("                  Validation Checksum: 0x%08X\n", security_execution.security_validation_checksum);
-        IOLog("                  Hardening Efficiency: %.1f%% (%d/%d features)\n", security_execution.hardening_efficiency * 100.0f, security_features_applied, total_security_features);
-        IOLog("                  Hardening Success: %s\n", security_execution.execution_successful ? "YES" : "NO");
+        VMLOG_DEBUG("                Security Hardening Results:\n");
+        VMLOG_DEBUG("                  Memory Protection: %s\n", security_execution.memory_protection_applied ? "APPLIED" : "SKIPPED");
+        VMLOG_DEBUG("                  Access Control: %s\n", security_execution.access_control_applied ? "APPLIED" : "SKIPPED");
+        VMLOG_DEBUG("                  Encryption: %s\n", security_execution.encryption_applied ? "APPLIED" : "SKIPPED");
+        VMLOG_DEBUG("                  Integrity Checking: %s\n", security_execution.integrity_checking_applied ? "APPLIED" : "SKIPPED");
+        VMLOG_DEBUG("                  Audit Logging: %s\n", security_execution.audit_logging_applied ? "APPLIED" : "SKIPPED");
+        VMLOG_DEBUG("                  Validation Checksum: 0x%08X\n", security_execution.security_validation_checksum);
+        VMLOG_DEBUG("                  Hardening Efficiency: %.1f%% (%d/%d features)\n", security_execution.hardening_efficiency * 100.0f, security_features_applied, total_security_features);
+        VMLOG_DEBUG("                  Hardening Success: %s\n", security_execution.execution_successful ? "YES" : "NO");
         
         execution_plan.security_hardening_complete = security_system.hardening_successful;
         
         if (execution_plan.security_hardening_complete) {
             execution_plan.completed_enhancement_phases++;
             execution_plan.enhancement_impact_score += 0.15f; // 15% security impact
-            IOLog("              Security hardening: COMPLETE (%.1f%% efficiency)\n", security_execution.hardening_efficiency * 100.0f);
+            VMLOG_DEBUG("              Security hardening: COMPLETE (%.1f%% efficiency)\n", security_execution.hardening_efficiency * 100.0f);
         } else {
-            IOLog("              WARNING: Security hardening below threshold\n");
+            VMLOG_WARN("              WARNING: Security hardening below threshold\n");
         }
     }
     
     if (enhancement_system.debugging_support_enabled) {
-        IOLog("          Phase 4/5: Advanced debugging support integration\n");
+        VMLOG_DEBUG("          Phase 4/5: Advanced debugging support integration\n");
         
         struct DebuggingSupportSystem {
             bool breakpoint_support_enabled;
@@ -3083,19 +3121,19 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         debug_system.debug_information_level = 3; // Level 3 (Verbose)
         debug_system.profiling_granularity = 2; // Medium granularity
         
-        IOLog("            Debugging Support Configuration:\n");
-        IOLog("              Breakpoint Support: %s\n", debug_system.breakpoint_support_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Memory Inspection: %s\n", debug_system.memory_inspection_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Call Stack Tracking: %s\n", debug_system.call_stack_tracking_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Performance Profiling: %s\n", debug_system.performance_profiling_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Enhanced Error Reporting: %s\n", debug_system.error_reporting_enhanced ? "ENABLED" : "DISABLED");
-        IOLog("              Debug Information Level: %d (Verbose)\n", debug_system.debug_information_level);
-        IOLog("              Profiling Granularity: %d (Medium)\n", debug_system.profiling_granularity);
+        VMLOG_DEBUG("            Debugging Support Configuration:\n");
+        VMLOG_DEBUG("              Breakpoint Support: %s\n", debug_system.breakpoint_support_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Memory Inspection: %s\n", debug_system.memory_inspection_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Call Stack Tracking: %s\n", debug_system.call_stack_tracking_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Performance Profiling: %s\n", debug_system.performance_profiling_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Enhanced Error Reporting: %s\n", debug_system.error_reporting_enhanced ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Debug Information Level: %d (Verbose)\n", debug_system.debug_information_level);
+        VMLOG_DEBUG("              Profiling Granularity: %d (Medium)\n", debug_system.profiling_granularity);
         
-        IOLog("              Integrating debugging support...\n");
+        VMLOG_DEBUG("              Integrating debugging support...\n");
         
         // Advanced Debugging Features Integration System - Comprehensive Diagnostic Architecture
-        IOLog("                === Advanced Debugging Features Integration System ===\n");
+        VMLOG_DEBUG("                === Advanced Debugging Features Integration System ===\n");
         
         struct AdvancedDebuggingArchitecture {
             uint32_t debugging_framework_version;
@@ -3132,24 +3170,24 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         debug_architecture.debugging_performance_impact_percentage = 5.0f; // 5% performance impact
         debug_architecture.debugging_architecture_initialized = false;
         
-        IOLog("                Advanced Debugging Architecture Configuration:\n");
-        IOLog("                  Framework Version: 0x%04X (v2.5 Enterprise)\n", debug_architecture.debugging_framework_version);
-        IOLog("                  Architecture Type: 0x%02X (Enterprise Debugging)\n", debug_architecture.debugging_architecture_type);
-        IOLog("                  Real-time Breakpoints: %s\n", debug_architecture.supports_real_time_breakpoints ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                  Memory Watchpoints: %s\n", debug_architecture.supports_memory_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                  Execution Tracing: %s\n", debug_architecture.supports_execution_tracing ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                  Performance Profiling: %s\n", debug_architecture.supports_performance_profiling ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                  Call Stack Unwinding: %s\n", debug_architecture.supports_call_stack_unwinding ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                  Symbol Resolution: %s\n", debug_architecture.supports_symbol_resolution ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                  Crash Dump Generation: %s\n", debug_architecture.supports_crash_dump_generation ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                  Live Debugging Session: %s\n", debug_architecture.supports_live_debugging_session ? "SUPPORTED" : "UNSUPPORTED");
-        IOLog("                  Maximum Breakpoints: %d\n", debug_architecture.maximum_breakpoints_supported);
-        IOLog("                  Maximum Watchpoints: %d\n", debug_architecture.maximum_watchpoints_supported);
-        IOLog("                  Memory Overhead: %llu bytes (%.1f KB)\n", debug_architecture.debugging_memory_overhead_bytes, debug_architecture.debugging_memory_overhead_bytes / 1024.0f);
-        IOLog("                  Performance Impact: %.1f%%\n", debug_architecture.debugging_performance_impact_percentage);
+        VMLOG_DEBUG("                Advanced Debugging Architecture Configuration:\n");
+        VMLOG_DEBUG("                  Framework Version: 0x%04X (v2.5 Enterprise)\n", debug_architecture.debugging_framework_version);
+        VMLOG_DEBUG("                  Architecture Type: 0x%02X (Enterprise Debugging)\n", debug_architecture.debugging_architecture_type);
+        VMLOG_DEBUG("                  Real-time Breakpoints: %s\n", debug_architecture.supports_real_time_breakpoints ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                  Memory Watchpoints: %s\n", debug_architecture.supports_memory_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                  Execution Tracing: %s\n", debug_architecture.supports_execution_tracing ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                  Performance Profiling: %s\n", debug_architecture.supports_performance_profiling ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                  Call Stack Unwinding: %s\n", debug_architecture.supports_call_stack_unwinding ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                  Symbol Resolution: %s\n", debug_architecture.supports_symbol_resolution ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                  Crash Dump Generation: %s\n", debug_architecture.supports_crash_dump_generation ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                  Live Debugging Session: %s\n", debug_architecture.supports_live_debugging_session ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("                  Maximum Breakpoints: %d\n", debug_architecture.maximum_breakpoints_supported);
+        VMLOG_DEBUG("                  Maximum Watchpoints: %d\n", debug_architecture.maximum_watchpoints_supported);
+        VMLOG_DEBUG("                  Memory Overhead: %llu bytes (%.1f KB)\n", debug_architecture.debugging_memory_overhead_bytes, debug_architecture.debugging_memory_overhead_bytes / 1024.0f);
+        VMLOG_DEBUG("                  Performance Impact: %.1f%%\n", debug_architecture.debugging_performance_impact_percentage);
         
         // Phase 1: Advanced Breakpoint Management System
-        IOLog("                Phase 1: Advanced breakpoint management system initialization\n");
+        VMLOG_DEBUG("                Phase 1: Advanced breakpoint management system initialization\n");
         
         struct BreakpointManagementSystem {
             uint32_t breakpoint_system_version;
@@ -3179,18 +3217,18 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             breakpoint_system.breakpoint_system_efficiency = 0.97f; // 97% efficiency target
             breakpoint_system.breakpoint_system_operational = true;
             
-            IOLog("                  Breakpoint Management System Configuration:\n");
-            IOLog("                    System Version: 0x%04X (v1.3)\n", breakpoint_system.breakpoint_system_version);
-            IOLog("                    Active Breakpoints: %d\n", breakpoint_system.active_breakpoints_count);
-            IOLog("                    Hardware Breakpoints Available: %d\n", breakpoint_system.hardware_breakpoints_available);
-            IOLog("                    Software Breakpoints Available: %d\n", breakpoint_system.software_breakpoints_available);
-            IOLog("                    Conditional Breakpoints: %s\n", breakpoint_system.supports_conditional_breakpoints ? "SUPPORTED" : "UNSUPPORTED");
-            IOLog("                    Temporary Breakpoints: %s\n", breakpoint_system.supports_temporary_breakpoints ? "SUPPORTED" : "UNSUPPORTED");
-            IOLog("                    Thread-Specific Breakpoints: %s\n", breakpoint_system.supports_thread_specific_breakpoints ? "SUPPORTED" : "UNSUPPORTED");
-            IOLog("                    Address Range Breakpoints: %s\n", breakpoint_system.supports_address_range_breakpoints ? "SUPPORTED" : "UNSUPPORTED");
-            IOLog("                    Hit Count Tracking: %d hits\n", breakpoint_system.breakpoint_hit_count_tracking);
-            IOLog("                    System Efficiency: %.1f%%\n", breakpoint_system.breakpoint_system_efficiency * 100.0f);
-            IOLog("                    System Status: %s\n", breakpoint_system.breakpoint_system_operational ? "OPERATIONAL" : "INACTIVE");
+            VMLOG_DEBUG("                  Breakpoint Management System Configuration:\n");
+            VMLOG_DEBUG("                    System Version: 0x%04X (v1.3)\n", breakpoint_system.breakpoint_system_version);
+            VMLOG_DEBUG("                    Active Breakpoints: %d\n", breakpoint_system.active_breakpoints_count);
+            VMLOG_DEBUG("                    Hardware Breakpoints Available: %d\n", breakpoint_system.hardware_breakpoints_available);
+            VMLOG_DEBUG("                    Software Breakpoints Available: %d\n", breakpoint_system.software_breakpoints_available);
+            VMLOG_DEBUG("                    Conditional Breakpoints: %s\n", breakpoint_system.supports_conditional_breakpoints ? "SUPPORTED" : "UNSUPPORTED");
+            VMLOG_DEBUG("                    Temporary Breakpoints: %s\n", breakpoint_system.supports_temporary_breakpoints ? "SUPPORTED" : "UNSUPPORTED");
+            VMLOG_DEBUG("                    Thread-Specific Breakpoints: %s\n", breakpoint_system.supports_thread_specific_breakpoints ? "SUPPORTED" : "UNSUPPORTED");
+            VMLOG_DEBUG("                    Address Range Breakpoints: %s\n", breakpoint_system.supports_address_range_breakpoints ? "SUPPORTED" : "UNSUPPORTED");
+            VMLOG_DEBUG("                    Hit Count Tracking: %d hits\n", breakpoint_system.breakpoint_hit_count_tracking);
+            VMLOG_DEBUG("                    System Efficiency: %.1f%%\n", breakpoint_system.breakpoint_system_efficiency * 100.0f);
+            VMLOG_DEBUG("                    System Status: %s\n", breakpoint_system.breakpoint_system_operational ? "OPERATIONAL" : "INACTIVE");
             
             // Initialize breakpoint tables and handlers
             struct BreakpointInitialization {
@@ -3203,7 +3241,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                 bool initialization_successful;
             } bp_init = {0};
             
-            IOLog("                    Initializing breakpoint management infrastructure...\n");
+            VMLOG_DEBUG("                    Initializing breakpoint management infrastructure...\n");
             
             // Initialize breakpoint tables
             bp_init.breakpoint_tables_allocated = true; // Simulated allocation
@@ -3211,19 +3249,19 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             // Install hardware breakpoint handlers
             if (breakpoint_system.hardware_breakpoints_available > 0) {
                 bp_init.hardware_breakpoint_handlers_installed = true; // Simulated installation
-                IOLog("                      Hardware breakpoint handlers: INSTALLED (%d handlers)\n", breakpoint_system.hardware_breakpoints_available);
+                VMLOG_DEBUG("                      Hardware breakpoint handlers: INSTALLED (%d handlers)\n", breakpoint_system.hardware_breakpoints_available);
             }
             
             // Install software breakpoint handlers
             if (breakpoint_system.software_breakpoints_available > 0) {
                 bp_init.software_breakpoint_handlers_installed = true; // Simulated installation
-                IOLog("                      Software breakpoint handlers: INSTALLED (%d handlers)\n", breakpoint_system.software_breakpoints_available);
+                VMLOG_DEBUG("                      Software breakpoint handlers: INSTALLED (%d handlers)\n", breakpoint_system.software_breakpoints_available);
             }
             
             // Initialize conditional evaluation engine
             if (breakpoint_system.supports_conditional_breakpoints) {
                 bp_init.conditional_evaluation_engine_initialized = true; // Simulated initialization
-                IOLog("                      Conditional evaluation engine: INITIALIZED\n");
+                VMLOG_DEBUG("                      Conditional evaluation engine: INITIALIZED\n");
             }
             
             // Initialize breakpoint notification system
@@ -3240,21 +3278,21 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             
             breakpoint_system.breakpoint_system_operational = bp_init.initialization_successful;
             
-            IOLog("                    Breakpoint System Initialization Results:\n");
-            IOLog("                      Breakpoint Tables: %s\n", bp_init.breakpoint_tables_allocated ? "ALLOCATED" : "FAILED");
-            IOLog("                      Hardware Handlers: %s\n", bp_init.hardware_breakpoint_handlers_installed ? "INSTALLED" : (breakpoint_system.hardware_breakpoints_available > 0 ? "FAILED" : "SKIPPED"));
-            IOLog("                      Software Handlers: %s\n", bp_init.software_breakpoint_handlers_installed ? "INSTALLED" : (breakpoint_system.software_breakpoints_available > 0 ? "FAILED" : "SKIPPED"));
-            IOLog("                      Conditional Engine: %s\n", bp_init.conditional_evaluation_engine_initialized ? "INITIALIZED" : (breakpoint_system.supports_conditional_breakpoints ? "FAILED" : "SKIPPED"));
-            IOLog("                      Notification System: %s\n", bp_init.breakpoint_notification_system_initialized ? "INITIALIZED" : "FAILED");
-            IOLog("                      Handler Checksum: 0x%08X\n", bp_init.breakpoint_handler_checksum);
-            IOLog("                      Initialization Status: %s\n", bp_init.initialization_successful ? "SUCCESS" : "FAILED");
+            VMLOG_DEBUG("                    Breakpoint System Initialization Results:\n");
+            VMLOG_DEBUG("                      Breakpoint Tables: %s\n", bp_init.breakpoint_tables_allocated ? "ALLOCATED" : "FAILED");
+            VMLOG_DEBUG("                      Hardware Handlers: %s\n", bp_init.hardware_breakpoint_handlers_installed ? "INSTALLED" : (breakpoint_system.hardware_breakpoints_available > 0 ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Software Handlers: %s\n", bp_init.software_breakpoint_handlers_installed ? "INSTALLED" : (breakpoint_system.software_breakpoints_available > 0 ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Conditional Engine: %s\n", bp_init.conditional_evaluation_engine_initialized ? "INITIALIZED" : (breakpoint_system.supports_conditional_breakpoints ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Notification System: %s\n", bp_init.breakpoint_notification_system_initialized ? "INITIALIZED" : "FAILED");
+            VMLOG_DEBUG("                      Handler Checksum: 0x%08X\n", bp_init.breakpoint_handler_checksum);
+            VMLOG_DEBUG("                      Initialization Status: %s\n", bp_init.initialization_successful ? "SUCCESS" : "FAILED");
         } else {
-            IOLog("                  Breakpoint Management System: DISABLED (breakpoint support not enabled)\n");
+            VMLOG_DEBUG("                  Breakpoint Management System: DISABLED (breakpoint support not enabled)\n");
             breakpoint_system.breakpoint_system_operational = false;
         }
         
         // Phase 2: Advanced Memory Watchpoint System
-        IOLog("                Phase 2: Advanced memory watchpoint system initialization\n");
+        VMLOG_DEBUG("                Phase 2: Advanced memory watchpoint system initialization\n");
         
         struct MemoryWatchpointSystem {
             uint32_t watchpoint_system_version;
@@ -3286,19 +3324,19 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             watchpoint_system.watchpoint_system_efficiency = 0.95f; // 95% efficiency target
             watchpoint_system.watchpoint_system_operational = true;
             
-            IOLog("                  Memory Watchpoint System Configuration:\n");
-            IOLog("                    System Version: 0x%04X (v1.2)\n", watchpoint_system.watchpoint_system_version);
-            IOLog("                    Active Watchpoints: %d\n", watchpoint_system.active_watchpoints_count);
-            IOLog("                    Hardware Watchpoints Available: %d\n", watchpoint_system.hardware_watchpoints_available);
-            IOLog("                    Virtual Watchpoints Available: %d\n", watchpoint_system.virtual_watchpoints_available);
-            IOLog("                    Read Watchpoints: %s\n", watchpoint_system.supports_read_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
-            IOLog("                    Write Watchpoints: %s\n", watchpoint_system.supports_write_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
-            IOLog("                    Execute Watchpoints: %s\n", watchpoint_system.supports_execute_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
-            IOLog("                    Range Watchpoints: %s\n", watchpoint_system.supports_range_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
-            IOLog("                    Data Comparison Watchpoints: %s\n", watchpoint_system.supports_data_comparison_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
-            IOLog("                    Trigger Count: %d triggers\n", watchpoint_system.watchpoint_trigger_count);
-            IOLog("                    System Efficiency: %.1f%%\n", watchpoint_system.watchpoint_system_efficiency * 100.0f);
-            IOLog("                    System Status: %s\n", watchpoint_system.watchpoint_system_operational ? "OPERATIONAL" : "INACTIVE");
+            VMLOG_DEBUG("                  Memory Watchpoint System Configuration:\n");
+            VMLOG_DEBUG("                    System Version: 0x%04X (v1.2)\n", watchpoint_system.watchpoint_system_version);
+            VMLOG_DEBUG("                    Active Watchpoints: %d\n", watchpoint_system.active_watchpoints_count);
+            VMLOG_DEBUG("                    Hardware Watchpoints Available: %d\n", watchpoint_system.hardware_watchpoints_available);
+            VMLOG_DEBUG("                    Virtual Watchpoints Available: %d\n", watchpoint_system.virtual_watchpoints_available);
+            VMLOG_DEBUG("                    Read Watchpoints: %s\n", watchpoint_system.supports_read_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
+            VMLOG_DEBUG("                    Write Watchpoints: %s\n", watchpoint_system.supports_write_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
+            VMLOG_DEBUG("                    Execute Watchpoints: %s\n", watchpoint_system.supports_execute_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
+            VMLOG_DEBUG("                    Range Watchpoints: %s\n", watchpoint_system.supports_range_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
+            VMLOG_DEBUG("                    Data Comparison Watchpoints: %s\n", watchpoint_system.supports_data_comparison_watchpoints ? "SUPPORTED" : "UNSUPPORTED");
+            VMLOG_DEBUG("                    Trigger Count: %d triggers\n", watchpoint_system.watchpoint_trigger_count);
+            VMLOG_DEBUG("                    System Efficiency: %.1f%%\n", watchpoint_system.watchpoint_system_efficiency * 100.0f);
+            VMLOG_DEBUG("                    System Status: %s\n", watchpoint_system.watchpoint_system_operational ? "OPERATIONAL" : "INACTIVE");
             
             // Initialize watchpoint management infrastructure
             struct WatchpointInitialization {
@@ -3311,7 +3349,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                 bool initialization_successful;
             } wp_init = {0};
             
-            IOLog("                    Initializing memory watchpoint infrastructure...\n");
+            VMLOG_DEBUG("                    Initializing memory watchpoint infrastructure...\n");
             
             // Initialize watchpoint tables
             wp_init.watchpoint_tables_allocated = true; // Simulated allocation
@@ -3319,23 +3357,23 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             // Install hardware watchpoint handlers
             if (watchpoint_system.hardware_watchpoints_available > 0) {
                 wp_init.hardware_watchpoint_handlers_installed = true; // Simulated installation
-                IOLog("                      Hardware watchpoint handlers: INSTALLED (%d handlers)\n", watchpoint_system.hardware_watchpoints_available);
+                VMLOG_DEBUG("                      Hardware watchpoint handlers: INSTALLED (%d handlers)\n", watchpoint_system.hardware_watchpoints_available);
             }
             
             // Install virtual watchpoint handlers
             if (watchpoint_system.virtual_watchpoints_available > 0) {
                 wp_init.virtual_watchpoint_handlers_installed = true; // Simulated installation
-                IOLog("                      Virtual watchpoint handlers: INSTALLED (%d handlers)\n", watchpoint_system.virtual_watchpoints_available);
+                VMLOG_DEBUG("                      Virtual watchpoint handlers: INSTALLED (%d handlers)\n", watchpoint_system.virtual_watchpoints_available);
             }
             
             // Install memory access interceptors
             wp_init.memory_access_interceptors_installed = true; // Simulated installation
-            IOLog("                      Memory access interceptors: INSTALLED\n");
+            VMLOG_DEBUG("                      Memory access interceptors: INSTALLED\n");
             
             // Initialize data comparison engine
             if (watchpoint_system.supports_data_comparison_watchpoints) {
                 wp_init.data_comparison_engine_initialized = true; // Simulated initialization
-                IOLog("                      Data comparison engine: INITIALIZED\n");
+                VMLOG_DEBUG("                      Data comparison engine: INITIALIZED\n");
             }
             
             wp_init.watchpoint_handler_checksum = 0xFACE5678; // Simulated checksum
@@ -3350,21 +3388,21 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             
             watchpoint_system.watchpoint_system_operational = wp_init.initialization_successful;
             
-            IOLog("                    Watchpoint System Initialization Results:\n");
-            IOLog("                      Watchpoint Tables: %s\n", wp_init.watchpoint_tables_allocated ? "ALLOCATED" : "FAILED");
-            IOLog("                      Hardware Handlers: %s\n", wp_init.hardware_watchpoint_handlers_installed ? "INSTALLED" : (watchpoint_system.hardware_watchpoints_available > 0 ? "FAILED" : "SKIPPED"));
-            IOLog("                      Virtual Handlers: %s\n", wp_init.virtual_watchpoint_handlers_installed ? "INSTALLED" : (watchpoint_system.virtual_watchpoints_available > 0 ? "FAILED" : "SKIPPED"));
-            IOLog("                      Access Interceptors: %s\n", wp_init.memory_access_interceptors_installed ? "INSTALLED" : "FAILED");
-            IOLog("                      Comparison Engine: %s\n", wp_init.data_comparison_engine_initialized ? "INITIALIZED" : (watchpoint_system.supports_data_comparison_watchpoints ? "FAILED" : "SKIPPED"));
-            IOLog("                      Handler Checksum: 0x%08X\n", wp_init.watchpoint_handler_checksum);
-            IOLog("                      Initialization Status: %s\n", wp_init.initialization_successful ? "SUCCESS" : "FAILED");
+            VMLOG_DEBUG("                    Watchpoint System Initialization Results:\n");
+            VMLOG_DEBUG("                      Watchpoint Tables: %s\n", wp_init.watchpoint_tables_allocated ? "ALLOCATED" : "FAILED");
+            VMLOG_DEBUG("                      Hardware Handlers: %s\n", wp_init.hardware_watchpoint_handlers_installed ? "INSTALLED" : (watchpoint_system.hardware_watchpoints_available > 0 ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Virtual Handlers: %s\n", wp_init.virtual_watchpoint_handlers_installed ? "INSTALLED" : (watchpoint_system.virtual_watchpoints_available > 0 ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Access Interceptors: %s\n", wp_init.memory_access_interceptors_installed ? "INSTALLED" : "FAILED");
+            VMLOG_DEBUG("                      Comparison Engine: %s\n", wp_init.data_comparison_engine_initialized ? "INITIALIZED" : (watchpoint_system.supports_data_comparison_watchpoints ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Handler Checksum: 0x%08X\n", wp_init.watchpoint_handler_checksum);
+            VMLOG_DEBUG("                      Initialization Status: %s\n", wp_init.initialization_successful ? "SUCCESS" : "FAILED");
         } else {
-            IOLog("                  Memory Watchpoint System: DISABLED (watchpoint support not enabled)\n");
+            VMLOG_DEBUG("                  Memory Watchpoint System: DISABLED (watchpoint support not enabled)\n");
             watchpoint_system.watchpoint_system_operational = false;
         }
         
         // Phase 3: Advanced Execution Tracing and Call Stack System
-        IOLog("                Phase 3: Advanced execution tracing and call stack system initialization\n");
+        VMLOG_DEBUG("                Phase 3: Advanced execution tracing and call stack system initialization\n");
         
         struct ExecutionTracingSystem {
             uint32_t tracing_system_version;
@@ -3398,20 +3436,20 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             tracing_system.tracing_system_efficiency = 0.92f; // 92% efficiency target
             tracing_system.tracing_system_operational = true;
             
-            IOLog("                  Execution Tracing System Configuration:\n");
-            IOLog("                    System Version: 0x%04X (v1.4)\n", tracing_system.tracing_system_version);
-            IOLog("                    Execution Tracing: %s\n", tracing_system.execution_tracing_active ? "ACTIVE" : "INACTIVE");
-            IOLog("                    Call Stack Tracking: %s\n", tracing_system.call_stack_tracking_active ? "ACTIVE" : "INACTIVE");
-            IOLog("                    Function Entry/Exit Logging: %s\n", tracing_system.function_entry_exit_logging ? "ENABLED" : "DISABLED");
-            IOLog("                    Instruction Level Tracing: %s\n", tracing_system.instruction_level_tracing ? "ENABLED" : "DISABLED");
-            IOLog("                    Branch Prediction Tracking: %s\n", tracing_system.branch_prediction_tracking ? "ENABLED" : "DISABLED");
-            IOLog("                    Performance Counter Integration: %s\n", tracing_system.performance_counter_integration ? "ENABLED" : "DISABLED");
-            IOLog("                    Maximum Call Stack Depth: %d levels\n", tracing_system.maximum_call_stack_depth);
-            IOLog("                    Trace Buffer Size: %d KB\n", tracing_system.trace_buffer_size_kb);
-            IOLog("                    Instructions Traced: %llu\n", tracing_system.instructions_traced);
-            IOLog("                    Function Calls Traced: %llu\n", tracing_system.function_calls_traced);
-            IOLog("                    System Efficiency: %.1f%%\n", tracing_system.tracing_system_efficiency * 100.0f);
-            IOLog("                    System Status: %s\n", tracing_system.tracing_system_operational ? "OPERATIONAL" : "INACTIVE");
+            VMLOG_DEBUG("                  Execution Tracing System Configuration:\n");
+            VMLOG_DEBUG("                    System Version: 0x%04X (v1.4)\n", tracing_system.tracing_system_version);
+            VMLOG_DEBUG("                    Execution Tracing: %s\n", tracing_system.execution_tracing_active ? "ACTIVE" : "INACTIVE");
+            VMLOG_DEBUG("                    Call Stack Tracking: %s\n", tracing_system.call_stack_tracking_active ? "ACTIVE" : "INACTIVE");
+            VMLOG_DEBUG("                    Function Entry/Exit Logging: %s\n", tracing_system.function_entry_exit_logging ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Instruction Level Tracing: %s\n", tracing_system.instruction_level_tracing ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Branch Prediction Tracking: %s\n", tracing_system.branch_prediction_tracking ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Performance Counter Integration: %s\n", tracing_system.performance_counter_integration ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Maximum Call Stack Depth: %d levels\n", tracing_system.maximum_call_stack_depth);
+            VMLOG_DEBUG("                    Trace Buffer Size: %d KB\n", tracing_system.trace_buffer_size_kb);
+            VMLOG_DEBUG("                    Instructions Traced: %llu\n", tracing_system.instructions_traced);
+            VMLOG_DEBUG("                    Function Calls Traced: %llu\n", tracing_system.function_calls_traced);
+            VMLOG_DEBUG("                    System Efficiency: %.1f%%\n", tracing_system.tracing_system_efficiency * 100.0f);
+            VMLOG_DEBUG("                    System Status: %s\n", tracing_system.tracing_system_operational ? "OPERATIONAL" : "INACTIVE");
             
             // Initialize execution tracing infrastructure
             struct TracingInitialization {
@@ -3425,34 +3463,34 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                 bool initialization_successful;
             } trace_init = {0};
             
-            IOLog("                    Initializing execution tracing infrastructure...\n");
+            VMLOG_DEBUG("                    Initializing execution tracing infrastructure...\n");
             
             // Allocate trace buffers
             trace_init.trace_buffers_allocated = true; // Simulated allocation
-            IOLog("                      Trace buffers (%d KB): ALLOCATED\n", tracing_system.trace_buffer_size_kb);
+            VMLOG_DEBUG("                      Trace buffers (%d KB): ALLOCATED\n", tracing_system.trace_buffer_size_kb);
             
             // Allocate call stack buffers
             if (tracing_system.call_stack_tracking_active) {
                 trace_init.call_stack_buffers_allocated = true; // Simulated allocation
-                IOLog("                      Call stack buffers (%d levels): ALLOCATED\n", tracing_system.maximum_call_stack_depth);
+                VMLOG_DEBUG("                      Call stack buffers (%d levels): ALLOCATED\n", tracing_system.maximum_call_stack_depth);
             }
             
             // Install function hooks
             if (tracing_system.function_entry_exit_logging) {
                 trace_init.function_hooks_installed = true; // Simulated installation
-                IOLog("                      Function entry/exit hooks: INSTALLED\n");
+                VMLOG_DEBUG("                      Function entry/exit hooks: INSTALLED\n");
             }
             
             // Install instruction hooks
             if (tracing_system.instruction_level_tracing) {
                 trace_init.instruction_hooks_installed = true; // Simulated installation
-                IOLog("                      Instruction-level hooks: INSTALLED\n");
+                VMLOG_DEBUG("                      Instruction-level hooks: INSTALLED\n");
             }
             
             // Configure performance counters
             if (tracing_system.performance_counter_integration) {
                 trace_init.performance_counters_configured = true; // Simulated configuration
-                IOLog("                      Performance counters: CONFIGURED\n");
+                VMLOG_DEBUG("                      Performance counters: CONFIGURED\n");
             }
             
             // Initialize trace collection engine
@@ -3470,22 +3508,22 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             
             tracing_system.tracing_system_operational = trace_init.initialization_successful;
             
-            IOLog("                    Execution Tracing System Initialization Results:\n");
-            IOLog("                      Trace Buffers: %s\n", trace_init.trace_buffers_allocated ? "ALLOCATED" : "FAILED");
-            IOLog("                      Call Stack Buffers: %s\n", trace_init.call_stack_buffers_allocated ? "ALLOCATED" : (tracing_system.call_stack_tracking_active ? "FAILED" : "SKIPPED"));
-            IOLog("                      Function Hooks: %s\n", trace_init.function_hooks_installed ? "INSTALLED" : (tracing_system.function_entry_exit_logging ? "FAILED" : "SKIPPED"));
-            IOLog("                      Instruction Hooks: %s\n", trace_init.instruction_hooks_installed ? "INSTALLED" : (tracing_system.instruction_level_tracing ? "FAILED" : "SKIPPED"));
-            IOLog("                      Performance Counters: %s\n", trace_init.performance_counters_configured ? "CONFIGURED" : (tracing_system.performance_counter_integration ? "FAILED" : "SKIPPED"));
-            IOLog("                      Collection Engine: %s\n", trace_init.trace_collection_engine_initialized ? "INITIALIZED" : "FAILED");
-            IOLog("                      Infrastructure Checksum: 0x%08X\n", trace_init.tracing_infrastructure_checksum);
-            IOLog("                      Initialization Status: %s\n", trace_init.initialization_successful ? "SUCCESS" : "FAILED");
+            VMLOG_DEBUG("                    Execution Tracing System Initialization Results:\n");
+            VMLOG_DEBUG("                      Trace Buffers: %s\n", trace_init.trace_buffers_allocated ? "ALLOCATED" : "FAILED");
+            VMLOG_DEBUG("                      Call Stack Buffers: %s\n", trace_init.call_stack_buffers_allocated ? "ALLOCATED" : (tracing_system.call_stack_tracking_active ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Function Hooks: %s\n", trace_init.function_hooks_installed ? "INSTALLED" : (tracing_system.function_entry_exit_logging ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Instruction Hooks: %s\n", trace_init.instruction_hooks_installed ? "INSTALLED" : (tracing_system.instruction_level_tracing ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Performance Counters: %s\n", trace_init.performance_counters_configured ? "CONFIGURED" : (tracing_system.performance_counter_integration ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Collection Engine: %s\n", trace_init.trace_collection_engine_initialized ? "INITIALIZED" : "FAILED");
+            VMLOG_DEBUG("                      Infrastructure Checksum: 0x%08X\n", trace_init.tracing_infrastructure_checksum);
+            VMLOG_DEBUG("                      Initialization Status: %s\n", trace_init.initialization_successful ? "SUCCESS" : "FAILED");
         } else {
-            IOLog("                  Execution Tracing System: DISABLED (tracing support not enabled)\n");
+            VMLOG_DEBUG("                  Execution Tracing System: DISABLED (tracing support not enabled)\n");
             tracing_system.tracing_system_operational = false;
         }
         
         // Phase 4: Advanced Performance Profiling and Metrics System
-        IOLog("                Phase 4: Advanced performance profiling and metrics system initialization\n");
+        VMLOG_DEBUG("                Phase 4: Advanced performance profiling and metrics system initialization\n");
         
         struct PerformanceProfilingSystem {
             uint32_t profiling_system_version;
@@ -3520,20 +3558,20 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             profiling_system.profiling_system_efficiency = 0.94f; // 94% efficiency target
             profiling_system.profiling_system_operational = true;
             
-            IOLog("                  Performance Profiling System Configuration:\n");
-            IOLog("                    System Version: 0x%04X (v2.1)\n", profiling_system.profiling_system_version);
-            IOLog("                    Real-time Profiling: %s\n", profiling_system.real_time_profiling_active ? "ACTIVE" : "INACTIVE");
-            IOLog("                    CPU Utilization Tracking: %s\n", profiling_system.cpu_utilization_tracking ? "ENABLED" : "DISABLED");
-            IOLog("                    Memory Usage Tracking: %s\n", profiling_system.memory_usage_tracking ? "ENABLED" : "DISABLED");
-            IOLog("                    I/O Performance Tracking: %s\n", profiling_system.io_performance_tracking ? "ENABLED" : "DISABLED");
-            IOLog("                    Cache Performance Tracking: %s\n", profiling_system.cache_performance_tracking ? "ENABLED" : "DISABLED");
-            IOLog("                    Thermal Monitoring: %s\n", profiling_system.thermal_monitoring ? "ENABLED" : "DISABLED");
-            IOLog("                    Power Consumption Tracking: %s\n", profiling_system.power_consumption_tracking ? "ENABLED" : "DISABLED");
-            IOLog("                    Sample Rate: %d Hz\n", profiling_system.profiling_sample_rate_hz);
-            IOLog("                    Metrics History Depth: %d samples\n", profiling_system.metrics_history_depth);
-            IOLog("                    Samples Collected: %llu\n", profiling_system.profiling_samples_collected);
-            IOLog("                    System Efficiency: %.1f%%\n", profiling_system.profiling_system_efficiency * 100.0f);
-            IOLog("                    System Status: %s\n", profiling_system.profiling_system_operational ? "OPERATIONAL" : "INACTIVE");
+            VMLOG_DEBUG("                  Performance Profiling System Configuration:\n");
+            VMLOG_DEBUG("                    System Version: 0x%04X (v2.1)\n", profiling_system.profiling_system_version);
+            VMLOG_DEBUG("                    Real-time Profiling: %s\n", profiling_system.real_time_profiling_active ? "ACTIVE" : "INACTIVE");
+            VMLOG_DEBUG("                    CPU Utilization Tracking: %s\n", profiling_system.cpu_utilization_tracking ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Memory Usage Tracking: %s\n", profiling_system.memory_usage_tracking ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    I/O Performance Tracking: %s\n", profiling_system.io_performance_tracking ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Cache Performance Tracking: %s\n", profiling_system.cache_performance_tracking ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Thermal Monitoring: %s\n", profiling_system.thermal_monitoring ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Power Consumption Tracking: %s\n", profiling_system.power_consumption_tracking ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Sample Rate: %d Hz\n", profiling_system.profiling_sample_rate_hz);
+            VMLOG_DEBUG("                    Metrics History Depth: %d samples\n", profiling_system.metrics_history_depth);
+            VMLOG_DEBUG("                    Samples Collected: %llu\n", profiling_system.profiling_samples_collected);
+            VMLOG_DEBUG("                    System Efficiency: %.1f%%\n", profiling_system.profiling_system_efficiency * 100.0f);
+            VMLOG_DEBUG("                    System Status: %s\n", profiling_system.profiling_system_operational ? "OPERATIONAL" : "INACTIVE");
             
             // Initialize performance profiling infrastructure
             struct ProfilingInitialization {
@@ -3547,27 +3585,27 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                 bool initialization_successful;
             } prof_init = {0};
             
-            IOLog("                    Initializing performance profiling infrastructure...\n");
+            VMLOG_DEBUG("                    Initializing performance profiling infrastructure...\n");
             
             // Allocate metrics buffers
             prof_init.metrics_buffers_allocated = true; // Simulated allocation
-            IOLog("                      Metrics buffers (%d samples): ALLOCATED\n", profiling_system.metrics_history_depth);
+            VMLOG_DEBUG("                      Metrics buffers (%d samples): ALLOCATED\n", profiling_system.metrics_history_depth);
             
             // Configure sampling timers
             prof_init.sampling_timers_configured = true; // Simulated configuration
-            IOLog("                      Sampling timers (%d Hz): CONFIGURED\n", profiling_system.profiling_sample_rate_hz);
+            VMLOG_DEBUG("                      Sampling timers (%d Hz): CONFIGURED\n", profiling_system.profiling_sample_rate_hz);
             
             // Initialize hardware performance counters
             prof_init.hardware_counters_initialized = true; // Simulated initialization
-            IOLog("                      Hardware performance counters: INITIALIZED\n");
+            VMLOG_DEBUG("                      Hardware performance counters: INITIALIZED\n");
             
             // Start profiling collection engine
             prof_init.profiling_collection_engine_started = true; // Simulated start
-            IOLog("                      Profiling collection engine: STARTED\n");
+            VMLOG_DEBUG("                      Profiling collection engine: STARTED\n");
             
             // Initialize metrics analysis engine
             prof_init.metrics_analysis_engine_initialized = true; // Simulated initialization
-            IOLog("                      Metrics analysis engine: INITIALIZED\n");
+            VMLOG_DEBUG("                      Metrics analysis engine: INITIALIZED\n");
             
             // Activate real-time reporting system
             prof_init.real_time_reporting_system_active = true; // Simulated activation
@@ -3584,22 +3622,22 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             
             profiling_system.profiling_system_operational = prof_init.initialization_successful;
             
-            IOLog("                    Performance Profiling System Initialization Results:\n");
-            IOLog("                      Metrics Buffers: %s\n", prof_init.metrics_buffers_allocated ? "ALLOCATED" : "FAILED");
-            IOLog("                      Sampling Timers: %s\n", prof_init.sampling_timers_configured ? "CONFIGURED" : "FAILED");
-            IOLog("                      Hardware Counters: %s\n", prof_init.hardware_counters_initialized ? "INITIALIZED" : "FAILED");
-            IOLog("                      Collection Engine: %s\n", prof_init.profiling_collection_engine_started ? "STARTED" : "FAILED");
-            IOLog("                      Analysis Engine: %s\n", prof_init.metrics_analysis_engine_initialized ? "INITIALIZED" : "FAILED");
-            IOLog("                      Real-time Reporting: %s\n", prof_init.real_time_reporting_system_active ? "ACTIVE" : "FAILED");
-            IOLog("                      Infrastructure Checksum: 0x%08X\n", prof_init.profiling_infrastructure_checksum);
-            IOLog("                      Initialization Status: %s\n", prof_init.initialization_successful ? "SUCCESS" : "FAILED");
+            VMLOG_DEBUG("                    Performance Profiling System Initialization Results:\n");
+            VMLOG_DEBUG("                      Metrics Buffers: %s\n", prof_init.metrics_buffers_allocated ? "ALLOCATED" : "FAILED");
+            VMLOG_DEBUG("                      Sampling Timers: %s\n", prof_init.sampling_timers_configured ? "CONFIGURED" : "FAILED");
+            VMLOG_DEBUG("                      Hardware Counters: %s\n", prof_init.hardware_counters_initialized ? "INITIALIZED" : "FAILED");
+            VMLOG_DEBUG("                      Collection Engine: %s\n", prof_init.profiling_collection_engine_started ? "STARTED" : "FAILED");
+            VMLOG_DEBUG("                      Analysis Engine: %s\n", prof_init.metrics_analysis_engine_initialized ? "INITIALIZED" : "FAILED");
+            VMLOG_DEBUG("                      Real-time Reporting: %s\n", prof_init.real_time_reporting_system_active ? "ACTIVE" : "FAILED");
+            VMLOG_DEBUG("                      Infrastructure Checksum: 0x%08X\n", prof_init.profiling_infrastructure_checksum);
+            VMLOG_DEBUG("                      Initialization Status: %s\n", prof_init.initialization_successful ? "SUCCESS" : "FAILED");
         } else {
-            IOLog("                  Performance Profiling System: DISABLED (profiling support not enabled)\n");
+            VMLOG_DEBUG("                  Performance Profiling System: DISABLED (profiling support not enabled)\n");
             profiling_system.profiling_system_operational = false;
         }
         
         // Phase 5: Advanced Error Reporting and Crash Analysis System
-        IOLog("                Phase 5: Advanced error reporting and crash analysis system initialization\n");
+        VMLOG_DEBUG("                Phase 5: Advanced error reporting and crash analysis system initialization\n");
         
         struct ErrorReportingSystem {
             uint32_t error_system_version;
@@ -3635,21 +3673,21 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             error_system.error_system_efficiency = 0.96f; // 96% efficiency target
             error_system.error_system_operational = true;
             
-            IOLog("                  Error Reporting System Configuration:\n");
-            IOLog("                    System Version: 0x%04X (v2.3)\n", error_system.error_system_version);
-            IOLog("                    Enhanced Error Reporting: %s\n", error_system.enhanced_error_reporting_active ? "ACTIVE" : "INACTIVE");
-            IOLog("                    Crash Dump Generation: %s\n", error_system.crash_dump_generation_enabled ? "ENABLED" : "DISABLED");
-            IOLog("                    Stack Trace Analysis: %s\n", error_system.stack_trace_analysis_enabled ? "ENABLED" : "DISABLED");
-            IOLog("                    Symbol Resolution: %s\n", error_system.symbol_resolution_enabled ? "ENABLED" : "DISABLED");
-            IOLog("                    Memory Corruption Detection: %s\n", error_system.memory_corruption_detection ? "ENABLED" : "DISABLED");
-            IOLog("                    Automated Crash Analysis: %s\n", error_system.automated_crash_analysis ? "ENABLED" : "DISABLED");
-            IOLog("                    Error Pattern Recognition: %s\n", error_system.error_pattern_recognition ? "ENABLED" : "DISABLED");
-            IOLog("                    Maximum Crash Dumps: %d\n", error_system.maximum_crash_dumps);
-            IOLog("                    Crash Dump Size Limit: %llu MB\n", error_system.crash_dump_size_limit_mb);
-            IOLog("                    Error Reports Generated: %d\n", error_system.error_reports_generated);
-            IOLog("                    Crash Dumps Generated: %d\n", error_system.crash_dumps_generated);
-            IOLog("                    System Efficiency: %.1f%%\n", error_system.error_system_efficiency * 100.0f);
-            IOLog("                    System Status: %s\n", error_system.error_system_operational ? "OPERATIONAL" : "INACTIVE");
+            VMLOG_DEBUG("                  Error Reporting System Configuration:\n");
+            VMLOG_DEBUG("                    System Version: 0x%04X (v2.3)\n", error_system.error_system_version);
+            VMLOG_DEBUG("                    Enhanced Error Reporting: %s\n", error_system.enhanced_error_reporting_active ? "ACTIVE" : "INACTIVE");
+            VMLOG_DEBUG("                    Crash Dump Generation: %s\n", error_system.crash_dump_generation_enabled ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Stack Trace Analysis: %s\n", error_system.stack_trace_analysis_enabled ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Symbol Resolution: %s\n", error_system.symbol_resolution_enabled ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Memory Corruption Detection: %s\n", error_system.memory_corruption_detection ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Automated Crash Analysis: %s\n", error_system.automated_crash_analysis ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Error Pattern Recognition: %s\n", error_system.error_pattern_recognition ? "ENABLED" : "DISABLED");
+            VMLOG_DEBUG("                    Maximum Crash Dumps: %d\n", error_system.maximum_crash_dumps);
+            VMLOG_DEBUG("                    Crash Dump Size Limit: %llu MB\n", error_system.crash_dump_size_limit_mb);
+            VMLOG_DEBUG("                    Error Reports Generated: %d\n", error_system.error_reports_generated);
+            VMLOG_DEBUG("                    Crash Dumps Generated: %d\n", error_system.crash_dumps_generated);
+            VMLOG_DEBUG("                    System Efficiency: %.1f%%\n", error_system.error_system_efficiency * 100.0f);
+            VMLOG_DEBUG("                    System Status: %s\n", error_system.error_system_operational ? "OPERATIONAL" : "INACTIVE");
             
             // Initialize error reporting infrastructure
             struct ErrorReportingInitialization {
@@ -3663,38 +3701,38 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
                 bool initialization_successful;
             } err_init = {0};
             
-            IOLog("                    Initializing error reporting infrastructure...\n");
+            VMLOG_DEBUG("                    Initializing error reporting infrastructure...\n");
             
             // Install enhanced error handlers
             err_init.error_handlers_installed = true; // Simulated installation
-            IOLog("                      Enhanced error handlers: INSTALLED\n");
+            VMLOG_DEBUG("                      Enhanced error handlers: INSTALLED\n");
             
             // Allocate crash dump storage
             err_init.crash_dump_storage_allocated = true; // Simulated allocation
-            IOLog("                      Crash dump storage (%llu MB): ALLOCATED\n", error_system.crash_dump_size_limit_mb * error_system.maximum_crash_dumps);
+            VMLOG_DEBUG("                      Crash dump storage (%llu MB): ALLOCATED\n", error_system.crash_dump_size_limit_mb * error_system.maximum_crash_dumps);
             
             // Load symbol table
             if (error_system.symbol_resolution_enabled) {
                 err_init.symbol_table_loaded = true; // Simulated loading
-                IOLog("                      Symbol table: LOADED\n");
+                VMLOG_DEBUG("                      Symbol table: LOADED\n");
             }
             
             // Initialize stack unwinding engine
             if (error_system.stack_trace_analysis_enabled) {
                 err_init.stack_unwinding_engine_initialized = true; // Simulated initialization
-                IOLog("                      Stack unwinding engine: INITIALIZED\n");
+                VMLOG_DEBUG("                      Stack unwinding engine: INITIALIZED\n");
             }
             
             // Initialize crash analysis engine
             if (error_system.automated_crash_analysis) {
                 err_init.crash_analysis_engine_initialized = true; // Simulated initialization
-                IOLog("                      Crash analysis engine: INITIALIZED\n");
+                VMLOG_DEBUG("                      Crash analysis engine: INITIALIZED\n");
             }
             
             // Load error pattern database
             if (error_system.error_pattern_recognition) {
                 err_init.error_pattern_database_loaded = true; // Simulated loading
-                IOLog("                      Error pattern database: LOADED\n");
+                VMLOG_ERROR("                      Error pattern database: LOADED\n");
             }
             
             err_init.error_reporting_infrastructure_checksum = 0xBEEF8901; // Simulated checksum
@@ -3710,17 +3748,17 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
             
             error_system.error_system_operational = err_init.initialization_successful;
             
-            IOLog("                    Error Reporting System Initialization Results:\n");
-            IOLog("                      Error Handlers: %s\n", err_init.error_handlers_installed ? "INSTALLED" : "FAILED");
-            IOLog("                      Crash Dump Storage: %s\n", err_init.crash_dump_storage_allocated ? "ALLOCATED" : "FAILED");
-            IOLog("                      Symbol Table: %s\n", err_init.symbol_table_loaded ? "LOADED" : (error_system.symbol_resolution_enabled ? "FAILED" : "SKIPPED"));
-            IOLog("                      Stack Unwinding Engine: %s\n", err_init.stack_unwinding_engine_initialized ? "INITIALIZED" : (error_system.stack_trace_analysis_enabled ? "FAILED" : "SKIPPED"));
-            IOLog("                      Crash Analysis Engine: %s\n", err_init.crash_analysis_engine_initialized ? "INITIALIZED" : (error_system.automated_crash_analysis ? "FAILED" : "SKIPPED"));
-            IOLog("                      Error Pattern Database: %s\n", err_init.error_pattern_database_loaded ? "LOADED" : (error_system.error_pattern_recognition ? "FAILED" : "SKIPPED"));
-            IOLog("                      Infrastructure Checksum: 0x%08X\n", err_init.error_reporting_infrastructure_checksum);
-            IOLog("                      Initialization Status: %s\n", err_init.initialization_successful ? "SUCCESS" : "FAILED");
+            VMLOG_DEBUG("                    Error Reporting System Initialization Results:\n");
+            VMLOG_DEBUG("                      Error Handlers: %s\n", err_init.error_handlers_installed ? "INSTALLED" : "FAILED");
+            VMLOG_DEBUG("                      Crash Dump Storage: %s\n", err_init.crash_dump_storage_allocated ? "ALLOCATED" : "FAILED");
+            VMLOG_DEBUG("                      Symbol Table: %s\n", err_init.symbol_table_loaded ? "LOADED" : (error_system.symbol_resolution_enabled ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Stack Unwinding Engine: %s\n", err_init.stack_unwinding_engine_initialized ? "INITIALIZED" : (error_system.stack_trace_analysis_enabled ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Crash Analysis Engine: %s\n", err_init.crash_analysis_engine_initialized ? "INITIALIZED" : (error_system.automated_crash_analysis ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Error Pattern Database: %s\n", err_init.error_pattern_database_loaded ? "LOADED" : (error_system.error_pattern_recognition ? "FAILED" : "SKIPPED"));
+            VMLOG_DEBUG("                      Infrastructure Checksum: 0x%08X\n", err_init.error_reporting_infrastructure_checksum);
+            VMLOG_DEBUG("                      Initialization Status: %s\n", err_init.initialization_successful ? "SUCCESS" : "FAILED");
         } else {
-            IOLog("                  Error Reporting System: DISABLED (error reporting not enabled)\n");
+            VMLOG_DEBUG("                  Error Reporting System: DISABLED (error reporting not enabled)\n");
             error_system.error_system_operational = false;
         }
         
@@ -3763,21 +3801,21 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         
         float overall_debugging_efficiency = (efficiency_contributors > 0) ? (combined_efficiency / efficiency_contributors) : 0.0f;
         
-        IOLog("                === Advanced Debugging Features Integration Results ===\n");
-        IOLog("                  Framework Version: 0x%04X (v2.5 Enterprise)\n", debug_architecture.debugging_framework_version);
-        IOLog("                  Architecture Type: 0x%02X (Enterprise Debugging)\n", debug_architecture.debugging_architecture_type);
-        IOLog("                  Operational Systems: %d/%d (%.1f%%)\n", operational_systems, total_systems, (float)operational_systems / (float)total_systems * 100.0f);
-        IOLog("                  System Status Summary:\n");
-        IOLog("                    Breakpoint Management: %s\n", breakpoint_system.breakpoint_system_operational ? "OPERATIONAL" : "INACTIVE");
-        IOLog("                    Memory Watchpoints: %s\n", watchpoint_system.watchpoint_system_operational ? "OPERATIONAL" : "INACTIVE");
-        IOLog("                    Execution Tracing: %s\n", tracing_system.tracing_system_operational ? "OPERATIONAL" : "INACTIVE");
-        IOLog("                    Performance Profiling: %s\n", profiling_system.profiling_system_operational ? "OPERATIONAL" : "INACTIVE");
-        IOLog("                    Error Reporting: %s\n", error_system.error_system_operational ? "OPERATIONAL" : "INACTIVE");
-        IOLog("                  Overall Debugging Efficiency: %.1f%%\n", overall_debugging_efficiency * 100.0f);
-        IOLog("                  Total Memory Overhead: %llu bytes (%.1f KB)\n", debug_architecture.debugging_memory_overhead_bytes, debug_architecture.debugging_memory_overhead_bytes / 1024.0f);
-        IOLog("                  Performance Impact: %.1f%%\n", debug_architecture.debugging_performance_impact_percentage);
-        IOLog("                  Architecture Initialization: %s\n", debug_architecture.debugging_architecture_initialized ? "SUCCESS" : "FAILED");
-        IOLog("                ========================================\n");
+        VMLOG_DEBUG("                === Advanced Debugging Features Integration Results ===\n");
+        VMLOG_DEBUG("                  Framework Version: 0x%04X (v2.5 Enterprise)\n", debug_architecture.debugging_framework_version);
+        VMLOG_DEBUG("                  Architecture Type: 0x%02X (Enterprise Debugging)\n", debug_architecture.debugging_architecture_type);
+        VMLOG_DEBUG("                  Operational Systems: %d/%d (%.1f%%)\n", operational_systems, total_systems, (float)operational_systems / (float)total_systems * 100.0f);
+        VMLOG_DEBUG("                  System Status Summary:\n");
+        VMLOG_DEBUG("                    Breakpoint Management: %s\n", breakpoint_system.breakpoint_system_operational ? "OPERATIONAL" : "INACTIVE");
+        VMLOG_DEBUG("                    Memory Watchpoints: %s\n", watchpoint_system.watchpoint_system_operational ? "OPERATIONAL" : "INACTIVE");
+        VMLOG_DEBUG("                    Execution Tracing: %s\n", tracing_system.tracing_system_operational ? "OPERATIONAL" : "INACTIVE");
+        VMLOG_DEBUG("                    Performance Profiling: %s\n", profiling_system.profiling_system_operational ? "OPERATIONAL" : "INACTIVE");
+        VMLOG_DEBUG("                    Error Reporting: %s\n", error_system.error_system_operational ? "OPERATIONAL" : "INACTIVE");
+        VMLOG_DEBUG("                  Overall Debugging Efficiency: %.1f%%\n", overall_debugging_efficiency * 100.0f);
+        VMLOG_DEBUG("                  Total Memory Overhead: %llu bytes (%.1f KB)\n", debug_architecture.debugging_memory_overhead_bytes, debug_architecture.debugging_memory_overhead_bytes / 1024.0f);
+        VMLOG_DEBUG("                  Performance Impact: %.1f%%\n", debug_architecture.debugging_performance_impact_percentage);
+        VMLOG_DEBUG("                  Architecture Initialization: %s\n", debug_architecture.debugging_architecture_initialized ? "SUCCESS" : "FAILED");
+        VMLOG_DEBUG("                ========================================\n");
         
         struct DebuggingIntegration {
             bool debug_hooks_installed;
@@ -3823,35 +3861,35 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         
         debug_system.debugging_integration_successful = debug_integration.integration_successful;
         
-        IOLog("                Debugging Integration Results:\n");
-        IOLog("                  Integration Status Summary:\n");
-        IOLog("                    Debug Hooks: %s\n", debug_integration.debug_hooks_installed ? "INSTALLED" : "SKIPPED");
-        IOLog("                    Profiling Hooks: %s\n", debug_integration.profiling_hooks_installed ? "INSTALLED" : "SKIPPED");
-        IOLog("                    Enhanced Error Handlers: %s\n", debug_integration.error_handlers_enhanced ? "INSTALLED" : "SKIPPED");
-        IOLog("                    Inspection Interface: %s\n", debug_integration.inspection_interface_created ? "CREATED" : "SKIPPED");
-        IOLog("                  Advanced Debugging Systems Status:\n");
-        IOLog("                    Breakpoint Management System: %s\n", debug_integration.breakpoint_system_integrated ? "INTEGRATED" : "INACTIVE");
-        IOLog("                    Memory Watchpoint System: %s\n", debug_integration.watchpoint_system_integrated ? "INTEGRATED" : "INACTIVE");
-        IOLog("                    Execution Tracing System: %s\n", debug_integration.tracing_system_integrated ? "INTEGRATED" : "INACTIVE");
-        IOLog("                    Performance Profiling System: %s\n", debug_integration.profiling_system_integrated ? "INTEGRATED" : "INACTIVE");
-        IOLog("                    Error Reporting System: %s\n", debug_integration.error_reporting_system_integrated ? "INTEGRATED" : "INACTIVE");
-        IOLog("                  Integration Metrics:\n");
-        IOLog("                    Active Debugging Features: %d/5\n", debug_integration.debugging_features_active);
-        IOLog("                    Overall Integration Efficiency: %.1f%%\n", debug_integration.overall_integration_efficiency * 100.0f);
-        IOLog("                    Total Memory Overhead: %llu bytes (%.1f KB)\n", debug_integration.total_debugging_memory_overhead, debug_integration.total_debugging_memory_overhead / 1024.0f);
-        IOLog("                    Integration Success: %s\n", debug_integration.integration_successful ? "YES" : "NO");
+        VMLOG_DEBUG("                Debugging Integration Results:\n");
+        VMLOG_DEBUG("                  Integration Status Summary:\n");
+        VMLOG_DEBUG("                    Debug Hooks: %s\n", debug_integration.debug_hooks_installed ? "INSTALLED" : "SKIPPED");
+        VMLOG_DEBUG("                    Profiling Hooks: %s\n", debug_integration.profiling_hooks_installed ? "INSTALLED" : "SKIPPED");
+        VMLOG_DEBUG("                    Enhanced Error Handlers: %s\n", debug_integration.error_handlers_enhanced ? "INSTALLED" : "SKIPPED");
+        VMLOG_DEBUG("                    Inspection Interface: %s\n", debug_integration.inspection_interface_created ? "CREATED" : "SKIPPED");
+        VMLOG_DEBUG("                  Advanced Debugging Systems Status:\n");
+        VMLOG_DEBUG("                    Breakpoint Management System: %s\n", debug_integration.breakpoint_system_integrated ? "INTEGRATED" : "INACTIVE");
+        VMLOG_DEBUG("                    Memory Watchpoint System: %s\n", debug_integration.watchpoint_system_integrated ? "INTEGRATED" : "INACTIVE");
+        VMLOG_DEBUG("                    Execution Tracing System: %s\n", debug_integration.tracing_system_integrated ? "INTEGRATED" : "INACTIVE");
+        VMLOG_DEBUG("                    Performance Profiling System: %s\n", debug_integration.profiling_system_integrated ? "INTEGRATED" : "INACTIVE");
+        VMLOG_DEBUG("                    Error Reporting System: %s\n", debug_integration.error_reporting_system_integrated ? "INTEGRATED" : "INACTIVE");
+        VMLOG_DEBUG("                  Integration Metrics:\n");
+        VMLOG_DEBUG("                    Active Debugging Features: %d/5\n", debug_integration.debugging_features_active);
+        VMLOG_DEBUG("                    Overall Integration Efficiency: %.1f%%\n", debug_integration.overall_integration_efficiency * 100.0f);
+        VMLOG_DEBUG("                    Total Memory Overhead: %llu bytes (%.1f KB)\n", debug_integration.total_debugging_memory_overhead, debug_integration.total_debugging_memory_overhead / 1024.0f);
+        VMLOG_DEBUG("                    Integration Success: %s\n", debug_integration.integration_successful ? "YES" : "NO");
         
         execution_plan.debugging_integration_complete = debug_system.debugging_integration_successful;
         
         if (execution_plan.debugging_integration_complete) {
             execution_plan.completed_enhancement_phases++;
             execution_plan.enhancement_impact_score += 0.10f; // 10% debugging impact
-            IOLog("              Debugging support integration: COMPLETE\n");
+            VMLOG_DEBUG("              Debugging support integration: COMPLETE\n");
         }
     }
     
     if (enhancement_system.runtime_inspection_enabled) {
-        IOLog("          Phase 5/5: Advanced runtime inspection system integration\n");
+        VMLOG_DEBUG("          Phase 5/5: Advanced runtime inspection system integration\n");
         
         struct RuntimeInspectionSystem {
             bool property_inspection_enabled;
@@ -3873,16 +3911,16 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         inspection_system.inspection_update_frequency = 100; // 100ms intervals
         inspection_system.metrics_collection_level = 2; // Standard level
         
-        IOLog("            Runtime Inspection Configuration:\n");
-        IOLog("              Property Inspection: %s\n", inspection_system.property_inspection_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              State Monitoring: %s\n", inspection_system.state_monitoring_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Performance Metrics: %s\n", inspection_system.performance_metrics_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Dynamic Analysis: %s\n", inspection_system.dynamic_analysis_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Real-time Reporting: %s\n", inspection_system.real_time_reporting_enabled ? "ENABLED" : "DISABLED");
-        IOLog("              Update Frequency: %d ms\n", inspection_system.inspection_update_frequency);
-        IOLog("              Metrics Level: %d (Standard)\n", inspection_system.metrics_collection_level);
+        VMLOG_DEBUG("            Runtime Inspection Configuration:\n");
+        VMLOG_DEBUG("              Property Inspection: %s\n", inspection_system.property_inspection_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              State Monitoring: %s\n", inspection_system.state_monitoring_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Performance Metrics: %s\n", inspection_system.performance_metrics_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Dynamic Analysis: %s\n", inspection_system.dynamic_analysis_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Real-time Reporting: %s\n", inspection_system.real_time_reporting_enabled ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("              Update Frequency: %d ms\n", inspection_system.inspection_update_frequency);
+        VMLOG_DEBUG("              Metrics Level: %d (Standard)\n", inspection_system.metrics_collection_level);
         
-        IOLog("              Integrating runtime inspection system...\n");
+        VMLOG_DEBUG("              Integrating runtime inspection system...\n");
         
         // Integrate runtime inspection (in real implementation, would set up inspection framework)
         struct InspectionIntegration {
@@ -3905,21 +3943,21 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         
         inspection_system.inspection_integration_successful = inspection_integration.integration_successful;
         
-        IOLog("                Runtime Inspection Integration Results:\n");
-        IOLog("                  Framework Initialized: %s\n", inspection_integration.inspection_framework_initialized ? "YES" : "NO");
-        IOLog("                  Metrics Collection: %s\n", inspection_integration.metrics_collection_started ? "STARTED" : "INACTIVE");
-        IOLog("                  Reporting System: %s\n", inspection_integration.reporting_system_active ? "ACTIVE" : "INACTIVE");
-        IOLog("                  Analysis Engine: %s\n", inspection_integration.analysis_engine_running ? "RUNNING" : "INACTIVE");
-        IOLog("                  Enabled Capabilities: %d\n", inspection_integration.inspection_capabilities_enabled);
-        IOLog("                  Inspection Overhead: %.1f%%\n", inspection_integration.inspection_overhead_percentage);
-        IOLog("                  Integration Success: %s\n", inspection_integration.integration_successful ? "YES" : "NO");
+        VMLOG_DEBUG("                Runtime Inspection Integration Results:\n");
+        VMLOG_DEBUG("                  Framework Initialized: %s\n", inspection_integration.inspection_framework_initialized ? "YES" : "NO");
+        VMLOG_DEBUG("                  Metrics Collection: %s\n", inspection_integration.metrics_collection_started ? "STARTED" : "INACTIVE");
+        VMLOG_DEBUG("                  Reporting System: %s\n", inspection_integration.reporting_system_active ? "ACTIVE" : "INACTIVE");
+        VMLOG_DEBUG("                  Analysis Engine: %s\n", inspection_integration.analysis_engine_running ? "RUNNING" : "INACTIVE");
+        VMLOG_DEBUG("                  Enabled Capabilities: %d\n", inspection_integration.inspection_capabilities_enabled);
+        VMLOG_DEBUG("                  Inspection Overhead: %.1f%%\n", inspection_integration.inspection_overhead_percentage);
+        VMLOG_DEBUG("                  Integration Success: %s\n", inspection_integration.integration_successful ? "YES" : "NO");
         
         execution_plan.runtime_inspection_complete = inspection_system.inspection_integration_successful;
         
         if (execution_plan.runtime_inspection_complete) {
             execution_plan.completed_enhancement_phases++;
             execution_plan.enhancement_impact_score += 0.05f; // 5% inspection impact
-            IOLog("              Runtime inspection integration: COMPLETE (%.1f%% overhead)\n", inspection_integration.inspection_overhead_percentage);
+            VMLOG_DEBUG("              Runtime inspection integration: COMPLETE (%.1f%% overhead)\n", inspection_integration.inspection_overhead_percentage);
         }
     }
     
@@ -3930,19 +3968,19 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         (execution_plan.enhancement_execution_progress >= 0.8f); // 80% completion threshold
     
     // Final Enhancement Summary
-    IOLog("          === Enhancement Implementation Complete ===\n");
-    IOLog("            Sequence ID: 0x%04X\n", execution_plan.enhancement_sequence_id);
-    IOLog("            Completed Phases: %d/%d (%.1f%%)\n", 
+    VMLOG_DEBUG("          === Enhancement Implementation Complete ===\n");
+    VMLOG_DEBUG("            Sequence ID: 0x%04X\n", execution_plan.enhancement_sequence_id);
+    VMLOG_DEBUG("            Completed Phases: %d/%d (%.1f%%)\n", 
           execution_plan.completed_enhancement_phases, execution_plan.total_enhancement_phases,
           execution_plan.enhancement_execution_progress * 100.0f);
-    IOLog("            Enhancement Impact Score: %.3f\n", execution_plan.enhancement_impact_score);
-    IOLog("            Metadata Integration: %s\n", execution_plan.metadata_integration_complete ? "COMPLETE" : "INCOMPLETE");
-    IOLog("            Performance Optimization: %s\n", execution_plan.performance_optimization_complete ? "COMPLETE" : "INCOMPLETE");
-    IOLog("            Security Hardening: %s\n", execution_plan.security_hardening_complete ? "COMPLETE" : "INCOMPLETE");
-    IOLog("            Debugging Integration: %s\n", execution_plan.debugging_integration_complete ? "COMPLETE" : "INCOMPLETE");
-    IOLog("            Runtime Inspection: %s\n", execution_plan.runtime_inspection_complete ? "COMPLETE" : "INCOMPLETE");
-    IOLog("            Execution Success: %s\n", execution_plan.enhancement_execution_successful ? "YES" : "NO");
-    IOLog("          ==========================================\n");
+    VMLOG_DEBUG("            Enhancement Impact Score: %.3f\n", execution_plan.enhancement_impact_score);
+    VMLOG_DEBUG("            Metadata Integration: %s\n", execution_plan.metadata_integration_complete ? "COMPLETE" : "INCOMPLETE");
+    VMLOG_DEBUG("            Performance Optimization: %s\n", execution_plan.performance_optimization_complete ? "COMPLETE" : "INCOMPLETE");
+    VMLOG_DEBUG("            Security Hardening: %s\n", execution_plan.security_hardening_complete ? "COMPLETE" : "INCOMPLETE");
+    VMLOG_DEBUG("            Debugging Integration: %s\n", execution_plan.debugging_integration_complete ? "COMPLETE" : "INCOMPLETE");
+    VMLOG_DEBUG("            Runtime Inspection: %s\n", execution_plan.runtime_inspection_complete ? "COMPLETE" : "INCOMPLETE");
+    VMLOG_DEBUG("            Execution Success: %s\n", execution_plan.enhancement_execution_successful ? "YES" : "NO");
+    VMLOG_DEBUG("          ==========================================\n");
     
     enhancement_system.enhancement_successful = execution_plan.enhancement_execution_successful;
     object_validation.object_enhancement_successful = enhancement_system.enhancement_successful;
@@ -3958,13 +3996,13 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     if (object_validation.object_reference_count > 0) validation_criteria_met++;
     object_validation.object_validation_score = (float)validation_criteria_met / (float)total_validation_criteria;
     
-    IOLog("        Enhancement Results:\n");
-    IOLog("          Enhancement Success: %s\n", enhancement_system.enhancement_successful ? "YES" : "NO");
-    IOLog("          Overall Validation Score: %.1f%% (%d/%d criteria met)\n", 
+    VMLOG_DEBUG("        Enhancement Results:\n");
+    VMLOG_DEBUG("          Enhancement Success: %s\n", enhancement_system.enhancement_successful ? "YES" : "NO");
+    VMLOG_DEBUG("          Overall Validation Score: %.1f%% (%d/%d criteria met)\n", 
           object_validation.object_validation_score * 100.0f, validation_criteria_met, total_validation_criteria);
     
     // Phase 4: Advanced Wrapper Integration and Binding
-    IOLog("      Phase 4: Advanced wrapper integration and comprehensive texture binding\n");
+    VMLOG_DEBUG("      Phase 4: Advanced wrapper integration and comprehensive texture binding\n");
     
     struct WrapperIntegrationSystem {
         bool texture_binding_successful;
@@ -3986,16 +4024,16 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     wrapper_integration.integration_checksum = 0xABCD1234; // Simulated checksum
     wrapper_integration.integration_efficiency = wrapper_config.wrapper_efficiency_target;
     
-    IOLog("        Wrapper Integration Configuration:\n");
-    IOLog("          Metadata Attached: %s\n", wrapper_integration.wrapper_metadata_attached ? "YES" : "NO");
-    IOLog("          Lifecycle Management: %s\n", wrapper_integration.lifecycle_management_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Error Handling: %s\n", wrapper_integration.error_handling_integrated ? "INTEGRATED" : "BASIC");
-    IOLog("          Performance Monitoring: %s\n", wrapper_integration.performance_monitoring_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Integration Checksum: 0x%08X\n", wrapper_integration.integration_checksum);
-    IOLog("          Target Efficiency: %.1f%%\n", wrapper_integration.integration_efficiency * 100.0f);
+    VMLOG_DEBUG("        Wrapper Integration Configuration:\n");
+    VMLOG_DEBUG("          Metadata Attached: %s\n", wrapper_integration.wrapper_metadata_attached ? "YES" : "NO");
+    VMLOG_DEBUG("          Lifecycle Management: %s\n", wrapper_integration.lifecycle_management_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Error Handling: %s\n", wrapper_integration.error_handling_integrated ? "INTEGRATED" : "BASIC");
+    VMLOG_DEBUG("          Performance Monitoring: %s\n", wrapper_integration.performance_monitoring_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Integration Checksum: 0x%08X\n", wrapper_integration.integration_checksum);
+    VMLOG_DEBUG("          Target Efficiency: %.1f%%\n", wrapper_integration.integration_efficiency * 100.0f);
     
     // Advanced Texture Binding System - Comprehensive OSObject Integration Architecture
-    IOLog("        === Advanced Texture Binding System - Enterprise OSObject Integration ===\n");
+    VMLOG_DEBUG("        === Advanced Texture Binding System - Enterprise OSObject Integration ===\n");
     
     struct TextureBindingArchitecture {
         uint32_t binding_system_version;
@@ -4026,21 +4064,21 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     binding_architecture.binding_memory_overhead_bytes = 2048; // 2KB overhead per binding
     binding_architecture.binding_system_initialized = false;
     
-    IOLog("        Advanced Texture Binding Architecture Configuration:\n");
-    IOLog("          Binding System Version: 0x%04X (v3.0 Enterprise)\n", binding_architecture.binding_system_version);
-    IOLog("          Architecture Type: 0x%02X (Enterprise Architecture)\n", binding_architecture.binding_architecture_type);
-    IOLog("          Complexity Level: %d (Maximum)\n", binding_architecture.integration_complexity_level);
-    IOLog("          Managed Texture Storage: %s\n", binding_architecture.supports_managed_texture_storage ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("          Reference Lifecycle Management: %s\n", binding_architecture.supports_reference_lifecycle_management ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("          Cross-Object Linking: %s\n", binding_architecture.supports_cross_object_linking ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("          Persistent Binding State: %s\n", binding_architecture.supports_persistent_binding_state ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("          Transactional Operations: %s\n", binding_architecture.supports_transactional_operations ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("          Efficiency Target: %.1f%%\n", binding_architecture.binding_system_efficiency_target * 100.0f);
-    IOLog("          Maximum Concurrent Bindings: %d\n", binding_architecture.maximum_concurrent_bindings);
-    IOLog("          Memory Overhead per Binding: %llu bytes\n", binding_architecture.binding_memory_overhead_bytes);
+    VMLOG_DEBUG("        Advanced Texture Binding Architecture Configuration:\n");
+    VMLOG_DEBUG("          Binding System Version: 0x%04X (v3.0 Enterprise)\n", binding_architecture.binding_system_version);
+    VMLOG_DEBUG("          Architecture Type: 0x%02X (Enterprise Architecture)\n", binding_architecture.binding_architecture_type);
+    VMLOG_DEBUG("          Complexity Level: %d (Maximum)\n", binding_architecture.integration_complexity_level);
+    VMLOG_DEBUG("          Managed Texture Storage: %s\n", binding_architecture.supports_managed_texture_storage ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("          Reference Lifecycle Management: %s\n", binding_architecture.supports_reference_lifecycle_management ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("          Cross-Object Linking: %s\n", binding_architecture.supports_cross_object_linking ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("          Persistent Binding State: %s\n", binding_architecture.supports_persistent_binding_state ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("          Transactional Operations: %s\n", binding_architecture.supports_transactional_operations ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("          Efficiency Target: %.1f%%\n", binding_architecture.binding_system_efficiency_target * 100.0f);
+    VMLOG_DEBUG("          Maximum Concurrent Bindings: %d\n", binding_architecture.maximum_concurrent_bindings);
+    VMLOG_DEBUG("          Memory Overhead per Binding: %llu bytes\n", binding_architecture.binding_memory_overhead_bytes);
     
     // Phase 1: Advanced OSObject Storage Container Creation
-    IOLog("        Phase 1: Advanced OSObject storage container creation and initialization\n");
+    VMLOG_DEBUG("        Phase 1: Advanced OSObject storage container creation and initialization\n");
     
     struct OSObjectStorageContainer {
         uint32_t container_type;
@@ -4070,19 +4108,19 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     storage_container.container_reference_count = 1; // Initial reference
     storage_container.container_efficiency = 0.95f; // 95% efficiency target
     
-    IOLog("          OSObject Storage Container Configuration:\n");
-    IOLog("            Container Type: 0x%02X (ManagedTexture Storage)\n", storage_container.container_type);
-    IOLog("            Container Version: 0x%04X (v1.2)\n", storage_container.container_version);
-    IOLog("            Storage Capacity: %d bytes (%.1f KB)\n", storage_container.storage_capacity_bytes, storage_container.storage_capacity_bytes / 1024.0f);
-    IOLog("            Dynamic Expansion: %s\n", storage_container.supports_dynamic_expansion ? "SUPPORTED" : "FIXED");
-    IOLog("            Compression Support: %s\n", storage_container.supports_compression ? "ENABLED" : "DISABLED");
-    IOLog("            Encryption Support: %s\n", storage_container.supports_encryption ? "ENABLED" : "DISABLED");
-    IOLog("            Access Permissions: 0x%02X\n", storage_container.container_access_permissions);
-    IOLog("            Reference Count: %d\n", storage_container.container_reference_count);
-    IOLog("            Efficiency Target: %.1f%%\n", storage_container.container_efficiency * 100.0f);
+    VMLOG_DEBUG("          OSObject Storage Container Configuration:\n");
+    VMLOG_DEBUG("            Container Type: 0x%02X (ManagedTexture Storage)\n", storage_container.container_type);
+    VMLOG_DEBUG("            Container Version: 0x%04X (v1.2)\n", storage_container.container_version);
+    VMLOG_DEBUG("            Storage Capacity: %d bytes (%.1f KB)\n", storage_container.storage_capacity_bytes, storage_container.storage_capacity_bytes / 1024.0f);
+    VMLOG_DEBUG("            Dynamic Expansion: %s\n", storage_container.supports_dynamic_expansion ? "SUPPORTED" : "FIXED");
+    VMLOG_DEBUG("            Compression Support: %s\n", storage_container.supports_compression ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("            Encryption Support: %s\n", storage_container.supports_encryption ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("            Access Permissions: 0x%02X\n", storage_container.container_access_permissions);
+    VMLOG_DEBUG("            Reference Count: %d\n", storage_container.container_reference_count);
+    VMLOG_DEBUG("            Efficiency Target: %.1f%%\n", storage_container.container_efficiency * 100.0f);
     
     // Create storage container within OSObject
-    IOLog("            Creating OSObject storage container...\n");
+    VMLOG_DEBUG("            Creating OSObject storage container...\n");
     
     struct StorageContainerCreation {
         bool memory_allocation_successful;
@@ -4117,19 +4155,19 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     storage_container.container_initialization_successful = container_creation.creation_validation_passed;
     storage_container.container_efficiency = container_creation.creation_efficiency_achieved;
     
-    IOLog("              Storage Container Creation Results:\n");
-    IOLog("                Memory Allocation: %s\n", container_creation.memory_allocation_successful ? "SUCCESS" : "FAILED");
-    IOLog("                Structure Initialization: %s\n", container_creation.container_structure_initialized ? "SUCCESS" : "FAILED");
-    IOLog("                Access Control Configuration: %s\n", container_creation.access_control_configured ? "SUCCESS" : "FAILED");
-    IOLog("                Compression System: %s\n", container_creation.compression_system_initialized ? "INITIALIZED" : (storage_container.supports_compression ? "FAILED" : "SKIPPED"));
-    IOLog("                Encryption System: %s\n", container_creation.encryption_system_initialized ? "INITIALIZED" : (storage_container.supports_encryption ? "FAILED" : "SKIPPED"));
-    IOLog("                Allocated Memory Address: 0x%016llX\n", container_creation.allocated_memory_address);
-    IOLog("                Creation Checksum: 0x%08X\n", container_creation.container_creation_checksum);
-    IOLog("                Creation Validation: %s\n", container_creation.creation_validation_passed ? "PASSED" : "FAILED");
-    IOLog("                Creation Efficiency: %.1f%%\n", container_creation.creation_efficiency_achieved * 100.0f);
+    VMLOG_DEBUG("              Storage Container Creation Results:\n");
+    VMLOG_DEBUG("                Memory Allocation: %s\n", container_creation.memory_allocation_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("                Structure Initialization: %s\n", container_creation.container_structure_initialized ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("                Access Control Configuration: %s\n", container_creation.access_control_configured ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("                Compression System: %s\n", container_creation.compression_system_initialized ? "INITIALIZED" : (storage_container.supports_compression ? "FAILED" : "SKIPPED"));
+    VMLOG_DEBUG("                Encryption System: %s\n", container_creation.encryption_system_initialized ? "INITIALIZED" : (storage_container.supports_encryption ? "FAILED" : "SKIPPED"));
+    VMLOG_DEBUG("                Allocated Memory Address: 0x%016llX\n", container_creation.allocated_memory_address);
+    VMLOG_DEBUG("                Creation Checksum: 0x%08X\n", container_creation.container_creation_checksum);
+    VMLOG_DEBUG("                Creation Validation: %s\n", container_creation.creation_validation_passed ? "PASSED" : "FAILED");
+    VMLOG_DEBUG("                Creation Efficiency: %.1f%%\n", container_creation.creation_efficiency_achieved * 100.0f);
     
     if (!storage_container.container_initialization_successful) {
-        IOLog("            ERROR: Storage container creation failed\n");
+        VMLOG_ERROR("            ERROR: Storage container creation failed\n");
         if (texture_obj) texture_obj->release();
         delete managed_texture;
         IOLockUnlock(m_texture_lock);
@@ -4137,7 +4175,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     }
     
     // Phase 2: Advanced ManagedTexture Serialization and Storage
-    IOLog("        Phase 2: Advanced ManagedTexture serialization and comprehensive storage\n");
+    VMLOG_DEBUG("        Phase 2: Advanced ManagedTexture serialization and comprehensive storage\n");
     
     struct ManagedTextureSerializationSystem {
         uint32_t serialization_format_version;
@@ -4164,21 +4202,21 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     serialization_system.serialization_flags = 0x0F; // All features enabled
     serialization_system.serialization_efficiency = 0.93f; // 93% efficiency target
     
-    IOLog("          ManagedTexture Serialization Configuration:\n");
-    IOLog("            Serialization Format: v%d.%d\n", 
+    VMLOG_DEBUG("          ManagedTexture Serialization Configuration:\n");
+    VMLOG_DEBUG("            Serialization Format: v%d.%d\n", 
           (serialization_system.serialization_format_version >> 8) & 0xFF, 
           serialization_system.serialization_format_version & 0xFF);
-    IOLog("            Serialization Method: 0x%02X (Binary with Metadata)\n", serialization_system.serialization_method);
-    IOLog("            Compression Ratio: %d%%\n", serialization_system.data_compression_ratio);
-    IOLog("            Incremental Serialization: %s\n", serialization_system.supports_incremental_serialization ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("            Delta Compression: %s\n", serialization_system.supports_delta_compression ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("            Metadata Embedding: %s\n", serialization_system.supports_metadata_embedding ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("            Estimated Size: %llu bytes\n", serialization_system.estimated_serialized_size_bytes);
-    IOLog("            Serialization Flags: 0x%02X\n", serialization_system.serialization_flags);
-    IOLog("            Efficiency Target: %.1f%%\n", serialization_system.serialization_efficiency * 100.0f);
+    VMLOG_DEBUG("            Serialization Method: 0x%02X (Binary with Metadata)\n", serialization_system.serialization_method);
+    VMLOG_DEBUG("            Compression Ratio: %d%%\n", serialization_system.data_compression_ratio);
+    VMLOG_DEBUG("            Incremental Serialization: %s\n", serialization_system.supports_incremental_serialization ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("            Delta Compression: %s\n", serialization_system.supports_delta_compression ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("            Metadata Embedding: %s\n", serialization_system.supports_metadata_embedding ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("            Estimated Size: %llu bytes\n", serialization_system.estimated_serialized_size_bytes);
+    VMLOG_DEBUG("            Serialization Flags: 0x%02X\n", serialization_system.serialization_flags);
+    VMLOG_DEBUG("            Efficiency Target: %.1f%%\n", serialization_system.serialization_efficiency * 100.0f);
     
     // Execute ManagedTexture serialization
-    IOLog("            Executing ManagedTexture serialization...\n");
+    VMLOG_DEBUG("            Executing ManagedTexture serialization...\n");
     
     struct SerializationExecution {
         bool texture_data_serialized;
@@ -4199,7 +4237,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     
     // Serialize metadata if enabled
     if (serialization_system.supports_metadata_embedding && enhancement_system.metadata_integration_enabled) {
-        IOLog("              Serializing embedded metadata...\n");
+        VMLOG_DEBUG("              Serializing embedded metadata...\n");
         serialization_execution.metadata_serialized = true;
         serialization_execution.serialized_data_size += 256; // Additional metadata size
     } else {
@@ -4208,7 +4246,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     
     // Apply compression if supported
     if (serialization_system.supports_delta_compression) {
-        IOLog("              Applying delta compression...\n");
+        VMLOG_DEBUG("              Applying delta compression...\n");
         serialization_execution.compression_applied = true;
         serialization_execution.achieved_compression_ratio = (float)serialization_system.data_compression_ratio / 100.0f;
         serialization_execution.serialized_data_size = (uint64_t)(serialization_execution.serialized_data_size * serialization_execution.achieved_compression_ratio);
@@ -4232,20 +4270,20 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     serialization_system.actual_serialized_size_bytes = serialization_execution.serialized_data_size;
     serialization_system.serialization_successful = serialization_execution.execution_successful;
     
-    IOLog("              Serialization Execution Results:\n");
-    IOLog("                Texture Data Serialized: %s\n", serialization_execution.texture_data_serialized ? "SUCCESS" : "FAILED");
-    IOLog("                Metadata Serialized: %s\n", serialization_execution.metadata_serialized ? "SUCCESS" : (serialization_system.supports_metadata_embedding ? "FAILED" : "SKIPPED"));
-    IOLog("                Compression Applied: %s\n", serialization_execution.compression_applied ? "SUCCESS" : (serialization_system.supports_delta_compression ? "FAILED" : "SKIPPED"));
-    IOLog("                Validation Checksums: %s\n", serialization_execution.validation_checksums_generated ? "GENERATED" : "FAILED");
-    IOLog("                Serialized Data Size: %llu bytes (%.1f KB)\n", serialization_execution.serialized_data_size, serialization_execution.serialized_data_size / 1024.0f);
-    IOLog("                Serialization Checksum: 0x%08X\n", serialization_execution.serialization_checksum);
-    IOLog("                Compression Ratio: %.1f%%\n", serialization_execution.achieved_compression_ratio * 100.0f);
-    IOLog("                Serialization Performance: %.1f%%\n", serialization_execution.serialization_performance * 100.0f);
-    IOLog("                Integrity Verification: %s\n", serialization_execution.serialization_integrity_verified ? "VERIFIED" : "FAILED");
-    IOLog("                Execution Success: %s\n", serialization_execution.execution_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("              Serialization Execution Results:\n");
+    VMLOG_DEBUG("                Texture Data Serialized: %s\n", serialization_execution.texture_data_serialized ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("                Metadata Serialized: %s\n", serialization_execution.metadata_serialized ? "SUCCESS" : (serialization_system.supports_metadata_embedding ? "FAILED" : "SKIPPED"));
+    VMLOG_DEBUG("                Compression Applied: %s\n", serialization_execution.compression_applied ? "SUCCESS" : (serialization_system.supports_delta_compression ? "FAILED" : "SKIPPED"));
+    VMLOG_DEBUG("                Validation Checksums: %s\n", serialization_execution.validation_checksums_generated ? "GENERATED" : "FAILED");
+    VMLOG_DEBUG("                Serialized Data Size: %llu bytes (%.1f KB)\n", serialization_execution.serialized_data_size, serialization_execution.serialized_data_size / 1024.0f);
+    VMLOG_DEBUG("                Serialization Checksum: 0x%08X\n", serialization_execution.serialization_checksum);
+    VMLOG_DEBUG("                Compression Ratio: %.1f%%\n", serialization_execution.achieved_compression_ratio * 100.0f);
+    VMLOG_DEBUG("                Serialization Performance: %.1f%%\n", serialization_execution.serialization_performance * 100.0f);
+    VMLOG_DEBUG("                Integrity Verification: %s\n", serialization_execution.serialization_integrity_verified ? "VERIFIED" : "FAILED");
+    VMLOG_DEBUG("                Execution Success: %s\n", serialization_execution.execution_successful ? "SUCCESS" : "FAILED");
     
     if (!serialization_system.serialization_successful) {
-        IOLog("            ERROR: ManagedTexture serialization failed\n");
+        VMLOG_ERROR("            ERROR: ManagedTexture serialization failed\n");
         if (texture_obj) texture_obj->release();
         delete managed_texture;
         IOLockUnlock(m_texture_lock);
@@ -4253,7 +4291,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     }
     
     // Phase 3: Advanced Reference Lifecycle Management Integration
-    IOLog("        Phase 3: Advanced reference lifecycle management and binding state persistence\n");
+    VMLOG_DEBUG("        Phase 3: Advanced reference lifecycle management and binding state persistence\n");
     
     struct ReferenceLifecycleManager {
         uint32_t lifecycle_management_version;
@@ -4283,20 +4321,20 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     lifecycle_manager.lifecycle_state_flags = 0x07; // Active, monitored, callback-enabled
     lifecycle_manager.lifecycle_management_efficiency = 0.98f; // 98% efficiency target
     
-    IOLog("          Reference Lifecycle Manager Configuration:\n");
-    IOLog("            Lifecycle Version: 0x%04X (v1.3)\n", lifecycle_manager.lifecycle_management_version);
-    IOLog("            Automatic Reference Counting: %s\n", lifecycle_manager.supports_automatic_reference_counting ? "SUPPORTED" : "MANUAL");
-    IOLog("            Weak References: %s\n", lifecycle_manager.supports_weak_references ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("            Strong References: %s\n", lifecycle_manager.supports_strong_references ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("            Circular Reference Detection: %s\n", lifecycle_manager.supports_circular_reference_detection ? "ENABLED" : "DISABLED");
-    IOLog("            Lifecycle Callbacks: %s\n", lifecycle_manager.supports_lifecycle_callbacks ? "ENABLED" : "DISABLED");
-    IOLog("            Initial Reference Count: %d\n", lifecycle_manager.initial_reference_count);
-    IOLog("            Maximum Reference Count: %d\n", lifecycle_manager.maximum_reference_count);
-    IOLog("            State Flags: 0x%02X\n", lifecycle_manager.lifecycle_state_flags);
-    IOLog("            Efficiency Target: %.1f%%\n", lifecycle_manager.lifecycle_management_efficiency * 100.0f);
+    VMLOG_DEBUG("          Reference Lifecycle Manager Configuration:\n");
+    VMLOG_DEBUG("            Lifecycle Version: 0x%04X (v1.3)\n", lifecycle_manager.lifecycle_management_version);
+    VMLOG_DEBUG("            Automatic Reference Counting: %s\n", lifecycle_manager.supports_automatic_reference_counting ? "SUPPORTED" : "MANUAL");
+    VMLOG_DEBUG("            Weak References: %s\n", lifecycle_manager.supports_weak_references ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("            Strong References: %s\n", lifecycle_manager.supports_strong_references ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("            Circular Reference Detection: %s\n", lifecycle_manager.supports_circular_reference_detection ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("            Lifecycle Callbacks: %s\n", lifecycle_manager.supports_lifecycle_callbacks ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("            Initial Reference Count: %d\n", lifecycle_manager.initial_reference_count);
+    VMLOG_DEBUG("            Maximum Reference Count: %d\n", lifecycle_manager.maximum_reference_count);
+    VMLOG_DEBUG("            State Flags: 0x%02X\n", lifecycle_manager.lifecycle_state_flags);
+    VMLOG_DEBUG("            Efficiency Target: %.1f%%\n", lifecycle_manager.lifecycle_management_efficiency * 100.0f);
     
     // Initialize reference lifecycle management
-    IOLog("            Initializing reference lifecycle management...\n");
+    VMLOG_DEBUG("            Initializing reference lifecycle management...\n");
     
     struct LifecycleInitialization {
         bool reference_counter_initialized;
@@ -4315,25 +4353,25 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     
     // Create weak reference table if supported
     if (lifecycle_manager.supports_weak_references) {
-        IOLog("              Creating weak reference table...\n");
+        VMLOG_DEBUG("              Creating weak reference table...\n");
         lifecycle_init.weak_reference_table_created = true;
     }
     
     // Create strong reference table if supported
     if (lifecycle_manager.supports_strong_references) {
-        IOLog("              Creating strong reference table...\n");
+        VMLOG_DEBUG("              Creating strong reference table...\n");
         lifecycle_init.strong_reference_table_created = true;
     }
     
     // Activate circular reference detection if supported
     if (lifecycle_manager.supports_circular_reference_detection) {
-        IOLog("              Activating circular reference detection...\n");
+        VMLOG_DEBUG("              Activating circular reference detection...\n");
         lifecycle_init.circular_detection_system_active = true;
     }
     
     // Register lifecycle callbacks if supported
     if (lifecycle_manager.supports_lifecycle_callbacks) {
-        IOLog("              Registering lifecycle callbacks...\n");
+        VMLOG_DEBUG("              Registering lifecycle callbacks...\n");
         lifecycle_init.callback_system_registered = true;
     }
     
@@ -4347,18 +4385,18 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     
     lifecycle_manager.lifecycle_manager_initialized = lifecycle_init.initialization_successful;
     
-    IOLog("              Lifecycle Initialization Results:\n");
-    IOLog("                Reference Counter: %s\n", lifecycle_init.reference_counter_initialized ? "INITIALIZED" : "FAILED");
-    IOLog("                Weak Reference Table: %s\n", lifecycle_init.weak_reference_table_created ? "CREATED" : (lifecycle_manager.supports_weak_references ? "FAILED" : "SKIPPED"));
-    IOLog("                Strong Reference Table: %s\n", lifecycle_init.strong_reference_table_created ? "CREATED" : (lifecycle_manager.supports_strong_references ? "FAILED" : "SKIPPED"));
-    IOLog("                Circular Detection: %s\n", lifecycle_init.circular_detection_system_active ? "ACTIVE" : (lifecycle_manager.supports_circular_reference_detection ? "FAILED" : "DISABLED"));
-    IOLog("                Callback System: %s\n", lifecycle_init.callback_system_registered ? "REGISTERED" : (lifecycle_manager.supports_lifecycle_callbacks ? "FAILED" : "DISABLED"));
-    IOLog("                Active Reference Count: %d\n", lifecycle_init.active_reference_count);
-    IOLog("                Initialization Checksum: 0x%08X\n", lifecycle_init.lifecycle_initialization_checksum);
-    IOLog("                Initialization Success: %s\n", lifecycle_init.initialization_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("              Lifecycle Initialization Results:\n");
+    VMLOG_DEBUG("                Reference Counter: %s\n", lifecycle_init.reference_counter_initialized ? "INITIALIZED" : "FAILED");
+    VMLOG_DEBUG("                Weak Reference Table: %s\n", lifecycle_init.weak_reference_table_created ? "CREATED" : (lifecycle_manager.supports_weak_references ? "FAILED" : "SKIPPED"));
+    VMLOG_DEBUG("                Strong Reference Table: %s\n", lifecycle_init.strong_reference_table_created ? "CREATED" : (lifecycle_manager.supports_strong_references ? "FAILED" : "SKIPPED"));
+    VMLOG_DEBUG("                Circular Detection: %s\n", lifecycle_init.circular_detection_system_active ? "ACTIVE" : (lifecycle_manager.supports_circular_reference_detection ? "FAILED" : "DISABLED"));
+    VMLOG_DEBUG("                Callback System: %s\n", lifecycle_init.callback_system_registered ? "REGISTERED" : (lifecycle_manager.supports_lifecycle_callbacks ? "FAILED" : "DISABLED"));
+    VMLOG_DEBUG("                Active Reference Count: %d\n", lifecycle_init.active_reference_count);
+    VMLOG_DEBUG("                Initialization Checksum: 0x%08X\n", lifecycle_init.lifecycle_initialization_checksum);
+    VMLOG_DEBUG("                Initialization Success: %s\n", lifecycle_init.initialization_successful ? "SUCCESS" : "FAILED");
     
     if (!lifecycle_manager.lifecycle_manager_initialized) {
-        IOLog("            ERROR: Reference lifecycle management initialization failed\n");
+        VMLOG_ERROR("            ERROR: Reference lifecycle management initialization failed\n");
         if (texture_obj) texture_obj->release();
         delete managed_texture;
         IOLockUnlock(m_texture_lock);
@@ -4366,7 +4404,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     }
     
     // Phase 4: Advanced Cross-Object Linking and Binding Completion
-    IOLog("        Phase 4: Advanced cross-object linking and comprehensive binding finalization\n");
+    VMLOG_DEBUG("        Phase 4: Advanced cross-object linking and comprehensive binding finalization\n");
     
     struct CrossObjectLinkingSystem {
         bool supports_bidirectional_linking;
@@ -4392,17 +4430,17 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     linking_system.active_link_count = 0; // Will be incremented during linking
     linking_system.linking_efficiency = 0.96f; // 96% efficiency target
     
-    IOLog("          Cross-Object Linking System Configuration:\n");
-    IOLog("            Bidirectional Linking: %s\n", linking_system.supports_bidirectional_linking ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("            Hierarchical Relationships: %s\n", linking_system.supports_hierarchical_relationships ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("            Dependency Tracking: %s\n", linking_system.supports_dependency_tracking ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("            Link Validation: %s\n", linking_system.supports_link_validation ? "ENABLED" : "DISABLED");
-    IOLog("            Protocol Version: 0x%04X (v2.1)\n", linking_system.linking_protocol_version);
-    IOLog("            Maximum Link Depth: %d levels\n", linking_system.maximum_link_depth);
-    IOLog("            Efficiency Target: %.1f%%\n", linking_system.linking_efficiency * 100.0f);
+    VMLOG_DEBUG("          Cross-Object Linking System Configuration:\n");
+    VMLOG_DEBUG("            Bidirectional Linking: %s\n", linking_system.supports_bidirectional_linking ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("            Hierarchical Relationships: %s\n", linking_system.supports_hierarchical_relationships ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("            Dependency Tracking: %s\n", linking_system.supports_dependency_tracking ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("            Link Validation: %s\n", linking_system.supports_link_validation ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("            Protocol Version: 0x%04X (v2.1)\n", linking_system.linking_protocol_version);
+    VMLOG_DEBUG("            Maximum Link Depth: %d levels\n", linking_system.maximum_link_depth);
+    VMLOG_DEBUG("            Efficiency Target: %.1f%%\n", linking_system.linking_efficiency * 100.0f);
     
     // Execute comprehensive binding process
-    IOLog("            Executing comprehensive OSObject-ManagedTexture binding...\n");
+    VMLOG_DEBUG("            Executing comprehensive OSObject-ManagedTexture binding...\n");
     
     struct ComprehensiveBindingProcess {
         bool pre_binding_validation_passed;
@@ -4425,27 +4463,27 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         serialization_system.serialization_successful &&
         lifecycle_manager.lifecycle_manager_initialized;
     
-    IOLog("              Pre-binding validation: %s\n", comprehensive_binding.pre_binding_validation_passed ? "PASSED" : "FAILED");
+    VMLOG_DEBUG("              Pre-binding validation: %s\n", comprehensive_binding.pre_binding_validation_passed ? "PASSED" : "FAILED");
     
     if (comprehensive_binding.pre_binding_validation_passed) {
         comprehensive_binding.binding_transaction_id = (uint32_t)(object_validation.object_memory_address & 0xFFFFFFFF);
         
         // Link storage container
-        IOLog("              Linking storage container to OSObject...\n");
+        VMLOG_DEBUG("              Linking storage container to OSObject...\n");
         comprehensive_binding.storage_container_linked = true; // Simulated success
         
         // Store serialized data
-        IOLog("              Storing serialized ManagedTexture data...\n");
+        VMLOG_DEBUG("              Storing serialized ManagedTexture data...\n");
         comprehensive_binding.serialized_data_stored = true; // Simulated success
         storage_container.current_storage_usage_bytes = (uint32_t)serialization_system.actual_serialized_size_bytes;
         
         // Integrate reference lifecycle
-        IOLog("              Integrating reference lifecycle management...\n");
+        VMLOG_DEBUG("              Integrating reference lifecycle management...\n");
         comprehensive_binding.reference_lifecycle_integrated = true; // Simulated success
         
         // Establish cross-object links
         if (linking_system.supports_bidirectional_linking) {
-            IOLog("              Establishing bidirectional cross-object links...\n");
+            VMLOG_DEBUG("              Establishing bidirectional cross-object links...\n");
             comprehensive_binding.cross_object_links_established = true; // Simulated success
             linking_system.active_link_count = 2; // OSObject <-> ManagedTexture
         } else {
@@ -4454,7 +4492,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         
         // Persist binding state
         if (binding_architecture.supports_persistent_binding_state) {
-            IOLog("              Persisting binding state...\n");
+            VMLOG_DEBUG("              Persisting binding state...\n");
             comprehensive_binding.binding_state_persisted = true; // Simulated success
         } else {
             comprehensive_binding.binding_state_persisted = false;
@@ -4477,28 +4515,28 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     linking_system.linking_system_active = comprehensive_binding.binding_process_successful;
     binding_architecture.binding_system_initialized = comprehensive_binding.binding_process_successful;
     
-    IOLog("              Comprehensive Binding Process Results:\n");
-    IOLog("                Pre-binding Validation: %s\n", comprehensive_binding.pre_binding_validation_passed ? "PASSED" : "FAILED");
-    IOLog("                Storage Container Linked: %s\n", comprehensive_binding.storage_container_linked ? "SUCCESS" : "FAILED");
-    IOLog("                Serialized Data Stored: %s (%d bytes)\n", comprehensive_binding.serialized_data_stored ? "SUCCESS" : "FAILED", storage_container.current_storage_usage_bytes);
-    IOLog("                Reference Lifecycle Integrated: %s\n", comprehensive_binding.reference_lifecycle_integrated ? "SUCCESS" : "FAILED");
-    IOLog("                Cross-Object Links Established: %s (%d links)\n", comprehensive_binding.cross_object_links_established ? "SUCCESS" : (linking_system.supports_bidirectional_linking ? "FAILED" : "SKIPPED"), linking_system.active_link_count);
-    IOLog("                Binding State Persisted: %s\n", comprehensive_binding.binding_state_persisted ? "SUCCESS" : (binding_architecture.supports_persistent_binding_state ? "FAILED" : "SKIPPED"));
-    IOLog("                Post-binding Validation: %s\n", comprehensive_binding.post_binding_validation_passed ? "PASSED" : "FAILED");
-    IOLog("                Binding Transaction ID: 0x%08X\n", comprehensive_binding.binding_transaction_id);
-    IOLog("                Binding Efficiency Achieved: %.1f%%\n", comprehensive_binding.binding_efficiency_achieved * 100.0f);
-    IOLog("                Binding Process Success: %s\n", comprehensive_binding.binding_process_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("              Comprehensive Binding Process Results:\n");
+    VMLOG_DEBUG("                Pre-binding Validation: %s\n", comprehensive_binding.pre_binding_validation_passed ? "PASSED" : "FAILED");
+    VMLOG_DEBUG("                Storage Container Linked: %s\n", comprehensive_binding.storage_container_linked ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("                Serialized Data Stored: %s (%d bytes)\n", comprehensive_binding.serialized_data_stored ? "SUCCESS" : "FAILED", storage_container.current_storage_usage_bytes);
+    VMLOG_DEBUG("                Reference Lifecycle Integrated: %s\n", comprehensive_binding.reference_lifecycle_integrated ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("                Cross-Object Links Established: %s (%d links)\n", comprehensive_binding.cross_object_links_established ? "SUCCESS" : (linking_system.supports_bidirectional_linking ? "FAILED" : "SKIPPED"), linking_system.active_link_count);
+    VMLOG_DEBUG("                Binding State Persisted: %s\n", comprehensive_binding.binding_state_persisted ? "SUCCESS" : (binding_architecture.supports_persistent_binding_state ? "FAILED" : "SKIPPED"));
+    VMLOG_DEBUG("                Post-binding Validation: %s\n", comprehensive_binding.post_binding_validation_passed ? "PASSED" : "FAILED");
+    VMLOG_DEBUG("                Binding Transaction ID: 0x%08X\n", comprehensive_binding.binding_transaction_id);
+    VMLOG_DEBUG("                Binding Efficiency Achieved: %.1f%%\n", comprehensive_binding.binding_efficiency_achieved * 100.0f);
+    VMLOG_DEBUG("                Binding Process Success: %s\n", comprehensive_binding.binding_process_successful ? "SUCCESS" : "FAILED");
     
     // Final binding system validation and summary
-    IOLog("        === Advanced Texture Binding System Complete ===\n");
-    IOLog("          System Version: 0x%04X (Enterprise Architecture)\n", binding_architecture.binding_system_version);
-    IOLog("          Storage Container: %s (%d/%d bytes used)\n", storage_container.container_initialization_successful ? "ACTIVE" : "FAILED", storage_container.current_storage_usage_bytes, storage_container.storage_capacity_bytes);
-    IOLog("          Serialization System: %s (%.1f KB serialized)\n", serialization_system.serialization_successful ? "ACTIVE" : "FAILED", serialization_system.actual_serialized_size_bytes / 1024.0f);
-    IOLog("          Lifecycle Manager: %s (%d active references)\n", lifecycle_manager.lifecycle_manager_initialized ? "ACTIVE" : "FAILED", lifecycle_init.active_reference_count);
-    IOLog("          Linking System: %s (%d active links)\n", linking_system.linking_system_active ? "ACTIVE" : "FAILED", linking_system.active_link_count);
-    IOLog("          Overall Binding Success: %s\n", binding_architecture.binding_system_initialized ? "SUCCESS" : "FAILED");
-    IOLog("          System Efficiency: %.1f%%\n", comprehensive_binding.binding_efficiency_achieved * 100.0f);
-    IOLog("        ==============================================\n");
+    VMLOG_DEBUG("        === Advanced Texture Binding System Complete ===\n");
+    VMLOG_DEBUG("          System Version: 0x%04X (Enterprise Architecture)\n", binding_architecture.binding_system_version);
+    VMLOG_DEBUG("          Storage Container: %s (%d/%d bytes used)\n", storage_container.container_initialization_successful ? "ACTIVE" : "FAILED", storage_container.current_storage_usage_bytes, storage_container.storage_capacity_bytes);
+    VMLOG_DEBUG("          Serialization System: %s (%.1f KB serialized)\n", serialization_system.serialization_successful ? "ACTIVE" : "FAILED", serialization_system.actual_serialized_size_bytes / 1024.0f);
+    VMLOG_DEBUG("          Lifecycle Manager: %s (%d active references)\n", lifecycle_manager.lifecycle_manager_initialized ? "ACTIVE" : "FAILED", lifecycle_init.active_reference_count);
+    VMLOG_DEBUG("          Linking System: %s (%d active links)\n", linking_system.linking_system_active ? "ACTIVE" : "FAILED", linking_system.active_link_count);
+    VMLOG_DEBUG("          Overall Binding Success: %s\n", binding_architecture.binding_system_initialized ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("          System Efficiency: %.1f%%\n", comprehensive_binding.binding_efficiency_achieved * 100.0f);
+    VMLOG_DEBUG("        ==============================================\n");
     
     // Legacy compatibility bridge for existing binding process structure
     struct TextureBindingProcess {
@@ -4520,20 +4558,20 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     binding_process.binding_efficiency = 0.97f; // 97% efficiency
     binding_process.binding_complete = binding_process.binding_validation_passed;
     
-    IOLog("          Texture Binding Process:\n");
-    IOLog("            Binding Validation: %s\n", binding_process.binding_validation_passed ? "PASSED" : "FAILED");
-    IOLog("            Memory Mapping: %s\n", binding_process.memory_mapping_successful ? "SUCCESSFUL" : "FAILED");
-    IOLog("            Reference Linking: %s\n", binding_process.reference_linking_successful ? "SUCCESSFUL" : "FAILED");
-    IOLog("            Access Validation: %s\n", binding_process.access_validation_passed ? "PASSED" : "FAILED");
-    IOLog("            Binding Flags: 0x%02X\n", binding_process.binding_flags);
-    IOLog("            Binding Efficiency: %.1f%%\n", binding_process.binding_efficiency * 100.0f);
-    IOLog("            Binding Complete: %s\n", binding_process.binding_complete ? "YES" : "NO");
+    VMLOG_DEBUG("          Texture Binding Process:\n");
+    VMLOG_DEBUG("            Binding Validation: %s\n", binding_process.binding_validation_passed ? "PASSED" : "FAILED");
+    VMLOG_DEBUG("            Memory Mapping: %s\n", binding_process.memory_mapping_successful ? "SUCCESSFUL" : "FAILED");
+    VMLOG_DEBUG("            Reference Linking: %s\n", binding_process.reference_linking_successful ? "SUCCESSFUL" : "FAILED");
+    VMLOG_DEBUG("            Access Validation: %s\n", binding_process.access_validation_passed ? "PASSED" : "FAILED");
+    VMLOG_DEBUG("            Binding Flags: 0x%02X\n", binding_process.binding_flags);
+    VMLOG_DEBUG("            Binding Efficiency: %.1f%%\n", binding_process.binding_efficiency * 100.0f);
+    VMLOG_DEBUG("            Binding Complete: %s\n", binding_process.binding_complete ? "YES" : "NO");
     
     wrapper_integration.texture_binding_successful = binding_process.binding_complete;
     wrapper_integration.integration_complete = wrapper_integration.texture_binding_successful;
     
     if (!wrapper_integration.integration_complete) {
-        IOLog("        ERROR: Wrapper integration failed\n");
+        VMLOG_ERROR("        ERROR: Wrapper integration failed\n");
         if (texture_obj) {
             texture_obj->release();
         }
@@ -4543,7 +4581,7 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     }
     
     // Final Wrapper System Validation
-    IOLog("        Final wrapper system validation...\n");
+    VMLOG_DEBUG("        Final wrapper system validation...\n");
     
     struct FinalWrapperValidation {
         bool wrapper_object_valid;
@@ -4574,18 +4612,18 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     final_validation.final_validation_score = (float)final_criteria_met / (float)total_final_criteria;
     final_validation.ready_for_use = (final_validation.final_validation_score >= 0.9f); // 90% threshold
     
-    IOLog("          Final Validation Results:\n");
-    IOLog("            Wrapper Object Valid: %s\n", final_validation.wrapper_object_valid ? "YES" : "NO");
-    IOLog("            Texture Binding Intact: %s\n", final_validation.texture_binding_intact ? "YES" : "NO");
-    IOLog("            All Enhancements Applied: %s\n", final_validation.all_enhancements_applied ? "YES" : "NO");
-    IOLog("            System Integration Complete: %s\n", final_validation.system_integration_complete ? "YES" : "NO");
-    IOLog("            Performance Targets Met: %s\n", final_validation.performance_targets_met ? "YES" : "NO");
-    IOLog("            Final Validation Score: %.1f%% (%d/%d criteria met)\n", 
+    VMLOG_DEBUG("          Final Validation Results:\n");
+    VMLOG_DEBUG("            Wrapper Object Valid: %s\n", final_validation.wrapper_object_valid ? "YES" : "NO");
+    VMLOG_DEBUG("            Texture Binding Intact: %s\n", final_validation.texture_binding_intact ? "YES" : "NO");
+    VMLOG_DEBUG("            All Enhancements Applied: %s\n", final_validation.all_enhancements_applied ? "YES" : "NO");
+    VMLOG_DEBUG("            System Integration Complete: %s\n", final_validation.system_integration_complete ? "YES" : "NO");
+    VMLOG_DEBUG("            Performance Targets Met: %s\n", final_validation.performance_targets_met ? "YES" : "NO");
+    VMLOG_DEBUG("            Final Validation Score: %.1f%% (%d/%d criteria met)\n", 
           final_validation.final_validation_score * 100.0f, final_criteria_met, total_final_criteria);
-    IOLog("            Ready for Use: %s\n", final_validation.ready_for_use ? "YES" : "NO");
+    VMLOG_DEBUG("            Ready for Use: %s\n", final_validation.ready_for_use ? "YES" : "NO");
     
     if (!final_validation.ready_for_use) {
-        IOLog("        ERROR: Final validation failed (score: %.1f%%)\n", 
+        VMLOG_ERROR("        ERROR: Final validation failed (score: %.1f%%)\n", 
               final_validation.final_validation_score * 100.0f);
         if (texture_obj) {
             texture_obj->release();
@@ -4595,27 +4633,41 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
         return kIOReturnError;
     }
     
-    IOLog("    Advanced texture object wrapper creation complete\n");
-    IOLog("      Wrapper Type: 0x%02X (v3.0 Standard Texture Wrapper)\n", wrapper_config.wrapper_type);
-    IOLog("      Object Address: 0x%016llX\n", object_validation.object_memory_address);
-    IOLog("      Enhancement Score: %.1f%%\n", enhancement_system.enhancement_successful ? 100.0f : 0.0f);
-    IOLog("      Integration Efficiency: %.1f%%\n", wrapper_integration.integration_efficiency * 100.0f);
-    IOLog("      Final Validation Score: %.1f%%\n", final_validation.final_validation_score * 100.0f);
-    IOLog("      System Status: OPERATIONAL\n");
+    VMLOG_DEBUG("    Advanced texture object wrapper creation complete\n");
+    VMLOG_DEBUG("      Wrapper Type: 0x%02X (v3.0 Standard Texture Wrapper)\n", wrapper_config.wrapper_type);
+    VMLOG_DEBUG("      Object Address: 0x%016llX\n", object_validation.object_memory_address);
+    VMLOG_DEBUG("      Enhancement Score: %.1f%%\n", enhancement_system.enhancement_successful ? 100.0f : 0.0f);
+    VMLOG_DEBUG("      Integration Efficiency: %.1f%%\n", wrapper_integration.integration_efficiency * 100.0f);
+    VMLOG_DEBUG("      Final Validation Score: %.1f%%\n", final_validation.final_validation_score * 100.0f);
+    VMLOG_DEBUG("      System Status: OPERATIONAL\n");
     
     // Texture object wrapper is now ready for array registration
     if (!texture_obj) {
-        IOLog("    ERROR: Failed to create texture object wrapper\n");
+        VMLOG_ERROR("    ERROR: Failed to create texture object wrapper\n");
         delete managed_texture;
         IOLockUnlock(m_texture_lock);
         return kIOReturnNoMemory;
     }
     
+    // Register the texture; its handle is the client's texture id
+    texture_object.assigned_texture_id = m_texture_table.insert(managed_texture);
+    if (!texture_object.assigned_texture_id) {
+        VMLOG_ERROR("    ERROR: Texture table full (%u textures)\n", m_texture_table.count());
+        texture_obj->release();
+        if (managed_texture->data) managed_texture->data->release();
+        delete managed_texture;
+        IOLockUnlock(m_texture_lock);
+        return kIOReturnNoResources;
+    }
+    managed_texture->texture_id = texture_object.assigned_texture_id;
+    
     // Add to texture array
     bool added_to_array = m_textures->setObject(texture_obj);
     if (!added_to_array) {
-        IOLog("    ERROR: Failed to add texture to managed array\n");
+        VMLOG_ERROR("    ERROR: Failed to add texture to managed array\n");
+        m_texture_table.remove(texture_object.assigned_texture_id);
         texture_obj->release();
+        if (managed_texture->data) managed_texture->data->release();
         delete managed_texture;
         IOLockUnlock(m_texture_lock);
         return kIOReturnNoMemory;
@@ -4626,42 +4678,39 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
     if (texture_key && m_texture_map) {
         bool added_to_map = m_texture_map->setObject(texture_key, texture_obj);
         if (!added_to_map) {
-            IOLog("    WARNING: Failed to add texture to mapping dictionary\n");
+            VMLOG_ERROR("    WARNING: Failed to add texture to mapping dictionary\n");
         }
         texture_key->release();
     }
     
     // Update memory tracking
-    m_texture_memory_usage += allocation_plan.total_allocation_size;
+    m_texture_memory_usage += managed_texture->data_size;
     
     // Calculate current memory utilization
     float current_utilization = (float)m_texture_memory_usage / (float)m_max_texture_memory;
     
-    IOLog("    Registration and Memory Tracking:\n");
-    IOLog("      Texture Array Size: %d textures\n", m_textures->getCount());
-    IOLog("      Texture Map Size: %d mappings\n", m_texture_map ? m_texture_map->getCount() : 0);
-    IOLog("      Memory Usage: %llu MB / %llu MB (%.1f%%)\n", 
+    VMLOG_DEBUG("    Registration and Memory Tracking:\n");
+    VMLOG_DEBUG("      Texture Array Size: %d textures\n", m_textures->getCount());
+    VMLOG_DEBUG("      Texture Map Size: %d mappings\n", m_texture_map ? m_texture_map->getCount() : 0);
+    VMLOG_DEBUG("      Memory Usage: %llu MB / %llu MB (%.1f%%)\n", 
           m_texture_memory_usage / (1024 * 1024),
           m_max_texture_memory / (1024 * 1024),
           current_utilization * 100.0f);
-    IOLog("      Memory Allocation: +%llu MB\n", allocation_plan.total_allocation_size / (1024 * 1024));
+    VMLOG_DEBUG("      Memory Allocation: +%llu MB\n", allocation_plan.total_allocation_size / (1024 * 1024));
     
     // Set output texture ID
     *texture_id = texture_object.assigned_texture_id;
     
-    // Clean up temporary managed texture object (in real implementation, would store it)
-    delete managed_texture;
-    
-    IOLog("VMTextureManager::createTexture: ========== Texture Creation Complete ==========\n");
-    IOLog("  Created Texture ID: %d\n", texture_object.assigned_texture_id);
-    IOLog("  Texture Dimensions: %dx%dx%d\n", descriptor->width, descriptor->height, descriptor->depth);
-    IOLog("  Pixel Format: %d\n", descriptor->pixel_format);
-    IOLog("  Memory Allocated: %llu MB\n", allocation_plan.total_allocation_size / (1024 * 1024));
-    IOLog("  Mipmap Levels: %d\n", validation.calculated_mip_levels);
-    IOLog("  Has Initial Data: %s\n", initial_data ? "YES" : "NO");
-    IOLog("  GPU Resident: %s\n", allocation_plan.requires_gpu_memory ? "YES" : "NO");
-    IOLog("  System Memory Usage: %.1f%%\n", current_utilization * 100.0f);
-    IOLog("========================================================================\n");
+    VMLOG_DEBUG("VMTextureManager::createTexture: ========== Texture Creation Complete ==========\n");
+    VMLOG_DEBUG("  Created Texture ID: %d\n", texture_object.assigned_texture_id);
+    VMLOG_DEBUG("  Texture Dimensions: %dx%dx%d\n", descriptor->width, descriptor->height, descriptor->depth);
+    VMLOG_DEBUG("  Pixel Format: %d\n", descriptor->pixel_format);
+    VMLOG_DEBUG("  Memory Allocated: %llu MB\n", allocation_plan.total_allocation_size / (1024 * 1024));
+    VMLOG_DEBUG("  Mipmap Levels: %d\n", validation.calculated_mip_levels);
+    VMLOG_DEBUG("  Has Initial Data: %s\n", initial_data ? "YES" : "NO");
+    VMLOG_DEBUG("  GPU Resident: %s\n", allocation_plan.requires_gpu_memory ? "YES" : "NO");
+    VMLOG_DEBUG("  System Memory Usage: %.1f%%\n", current_utilization * 100.0f);
+    VMLOG_DEBUG("========================================================================\n");
     
     IOLockUnlock(m_texture_lock);
     return kIOReturnSuccess;
@@ -4669,6 +4718,24 @@ IOReturn CLASS::createTexture(const VMTextureDescriptor* descriptor,
 
 IOReturn CLASS::destroyTexture(uint32_t texture_id)
 {
+    IOLockLock(m_texture_lock);
+    
+    ManagedTexture* texture = m_texture_table.remove(texture_id);
+    if (!texture) {
+        IOLockUnlock(m_texture_lock);
+        return kIOReturnNotFound;
+    }
+    
+    if (m_texture_memory_usage >= texture->data_size) {
+        m_texture_memory_usage -= texture->data_size;
+    }
+    releaseHostTexture(texture);
+    if (texture->data) {
+        texture->data->release();
+    }
+    delete texture;
+    
+    IOLockUnlock(m_texture_lock);
     return kIOReturnSuccess;
 }
 
@@ -4676,22 +4743,22 @@ IOReturn CLASS::getTextureDescriptor(uint32_t texture_id, VMTextureDescriptor* d
 {
     // Advanced Texture Descriptor Retrieval System - Comprehensive Resource Query and Validation
     if (!descriptor) {
-        IOLog("VMTextureManager::getTextureDescriptor: Invalid descriptor parameter (null pointer)\n");
+        VMLOG_WARN("VMTextureManager::getTextureDescriptor: Invalid descriptor parameter (null pointer)\n");
         return kIOReturnBadArgument;
     }
     
     // Acquire texture management lock for thread safety
     if (!m_texture_lock) {
-        IOLog("VMTextureManager::getTextureDescriptor: Texture lock not initialized\n");
+        VMLOG_DEBUG("VMTextureManager::getTextureDescriptor: Texture lock not initialized\n");
         return kIOReturnNotReady;
     }
     
     IOLockLock(m_texture_lock);
     
-    IOLog("VMTextureManager::getTextureDescriptor: Initiating advanced texture descriptor retrieval (ID: %d)\n", texture_id);
+    VMLOG_DEBUG("VMTextureManager::getTextureDescriptor: Initiating advanced texture descriptor retrieval (ID: %d)\n", texture_id);
     
     // Phase 1: Advanced Texture ID Validation and Existence Verification
-    IOLog("  Phase 1: Advanced texture ID validation and comprehensive existence verification\n");
+    VMLOG_DEBUG("  Phase 1: Advanced texture ID validation and comprehensive existence verification\n");
     
     struct TextureValidationContext {
         uint32_t requested_texture_id;
@@ -4707,25 +4774,17 @@ IOReturn CLASS::getTextureDescriptor(uint32_t texture_id, VMTextureDescriptor* d
     
     // Validate texture ID range and format
     validation_context.requested_texture_id = texture_id;
-    validation_context.texture_id_valid_range = (texture_id > 0) && (texture_id < 0xFFFF0000); // Valid range
+    validation_context.texture_id_valid_range = (texture_id != 0); // 0 is never a handle
     
     // Check if texture exists in our management systems
     bool found_in_array = false;
     bool found_in_map = false;
     uint32_t array_index = 0;
     
-    // Search in texture array
-    if (m_textures && validation_context.texture_id_valid_range) {
-        uint32_t texture_count = m_textures->getCount();
-        for (uint32_t i = 0; i < texture_count; i++) {
-            OSObject* texture_obj = m_textures->getObject(i);
-            if (texture_obj) {
-                // In real implementation, would check texture ID from wrapped ManagedTexture
-                found_in_array = true;
-                array_index = i;
-                break; // For demonstration, assume first object matches
-            }
-        }
+    // Resolve the handle
+    if (validation_context.texture_id_valid_range && findTexture(texture_id)) {
+        found_in_array = true;
+        array_index = VMHandleIndex(texture_id);
     }
     
     // Search in texture mapping dictionary
@@ -4758,35 +4817,35 @@ IOReturn CLASS::getTextureDescriptor(uint32_t texture_id, VMTextureDescriptor* d
     if (validation_context.access_permissions > 0) validation_checks_passed++;
     validation_context.validation_confidence = (float)validation_checks_passed / (float)total_validation_checks;
     
-    IOLog("    Texture Validation Context:\n");
-    IOLog("      Requested Texture ID: %d\n", validation_context.requested_texture_id);
-    IOLog("      ID Range Valid: %s\n", validation_context.texture_id_valid_range ? "YES" : "NO");
-    IOLog("      Exists in System: %s\n", validation_context.texture_exists_in_system ? "YES" : "NO");
-    IOLog("      Found in Array: %s (Index: %d)\n", found_in_array ? "YES" : "NO", array_index);
-    IOLog("      Found in Map: %s\n", found_in_map ? "YES" : "NO");
-    IOLog("      Accessible: %s\n", validation_context.texture_accessible ? "YES" : "NO");
-    IOLog("      Initialized: %s\n", validation_context.texture_initialized ? "YES" : "NO");
-    IOLog("      Reference Count: %d\n", validation_context.texture_reference_count);
-    IOLog("      Access Permissions: 0x%02X\n", validation_context.access_permissions);
-    IOLog("      Validation Confidence: %.1f%% (%d/%d checks passed)\n", 
+    VMLOG_DEBUG("    Texture Validation Context:\n");
+    VMLOG_DEBUG("      Requested Texture ID: %d\n", validation_context.requested_texture_id);
+    VMLOG_DEBUG("      ID Range Valid: %s\n", validation_context.texture_id_valid_range ? "YES" : "NO");
+    VMLOG_DEBUG("      Exists in System: %s\n", validation_context.texture_exists_in_system ? "YES" : "NO");
+    VMLOG_DEBUG("      Found in Array: %s (Index: %d)\n", found_in_array ? "YES" : "NO", array_index);
+    VMLOG_DEBUG("      Found in Map: %s\n", found_in_map ? "YES" : "NO");
+    VMLOG_DEBUG("      Accessible: %s\n", validation_context.texture_accessible ? "YES" : "NO");
+    VMLOG_DEBUG("      Initialized: %s\n", validation_context.texture_initialized ? "YES" : "NO");
+    VMLOG_DEBUG("      Reference Count: %d\n", validation_context.texture_reference_count);
+    VMLOG_DEBUG("      Access Permissions: 0x%02X\n", validation_context.access_permissions);
+    VMLOG_DEBUG("      Validation Confidence: %.1f%% (%d/%d checks passed)\n", 
           validation_context.validation_confidence * 100.0f, validation_checks_passed, total_validation_checks);
     
     // Check if texture exists and is accessible
     if (!validation_context.texture_exists_in_system) {
-        IOLog("    ERROR: Texture ID %d not found in system\n", texture_id);
+        VMLOG_ERROR("    ERROR: Texture ID %d not found in system\n", texture_id);
         IOLockUnlock(m_texture_lock);
         return kIOReturnNotFound;
     }
     
     if (validation_context.validation_confidence < 0.8f) { // Require 80% confidence
-        IOLog("    ERROR: Texture validation failed (%.1f%% confidence)\n", 
+        VMLOG_ERROR("    ERROR: Texture validation failed (%.1f%% confidence)\n", 
               validation_context.validation_confidence * 100.0f);
         IOLockUnlock(m_texture_lock);
         return kIOReturnNotPermitted;
     }
     
     // Phase 2: Advanced Descriptor Construction and Data Population
-    IOLog("  Phase 2: Advanced descriptor construction and comprehensive data population\n");
+    VMLOG_DEBUG("  Phase 2: Advanced descriptor construction and comprehensive data population\n");
     
     struct DescriptorConstructionPlan {
         bool use_cached_descriptor;
@@ -4809,22 +4868,22 @@ IOReturn CLASS::getTextureDescriptor(uint32_t texture_id, VMTextureDescriptor* d
     construction_plan.descriptor_version = 3; // Version 3 descriptor
     construction_plan.construction_efficiency = 0.95f; // Target 95% efficiency
     
-    IOLog("    Descriptor Construction Plan:\n");
-    IOLog("      Use Cached Descriptor: %s\n", construction_plan.use_cached_descriptor ? "YES" : "NO");
-    IOLog("      Format Analysis Required: %s\n", construction_plan.requires_format_analysis ? "YES" : "NO");
-    IOLog("      Memory Analysis Required: %s\n", construction_plan.requires_memory_analysis ? "YES" : "NO");
-    IOLog("      Mipmap Analysis Required: %s\n", construction_plan.requires_mipmap_analysis ? "YES" : "NO");
-    IOLog("      Usage Analysis Required: %s\n", construction_plan.requires_usage_analysis ? "YES" : "NO");
-    IOLog("      Advanced Features Support: %s\n", construction_plan.supports_advanced_features ? "YES" : "NO");
-    IOLog("      Descriptor Version: %d\n", construction_plan.descriptor_version);
-    IOLog("      Construction Efficiency Target: %.1f%%\n", construction_plan.construction_efficiency * 100.0f);
+    VMLOG_DEBUG("    Descriptor Construction Plan:\n");
+    VMLOG_DEBUG("      Use Cached Descriptor: %s\n", construction_plan.use_cached_descriptor ? "YES" : "NO");
+    VMLOG_DEBUG("      Format Analysis Required: %s\n", construction_plan.requires_format_analysis ? "YES" : "NO");
+    VMLOG_DEBUG("      Memory Analysis Required: %s\n", construction_plan.requires_memory_analysis ? "YES" : "NO");
+    VMLOG_DEBUG("      Mipmap Analysis Required: %s\n", construction_plan.requires_mipmap_analysis ? "YES" : "NO");
+    VMLOG_DEBUG("      Usage Analysis Required: %s\n", construction_plan.requires_usage_analysis ? "YES" : "NO");
+    VMLOG_DEBUG("      Advanced Features Support: %s\n", construction_plan.supports_advanced_features ? "YES" : "NO");
+    VMLOG_DEBUG("      Descriptor Version: %d\n", construction_plan.descriptor_version);
+    VMLOG_DEBUG("      Construction Efficiency Target: %.1f%%\n", construction_plan.construction_efficiency * 100.0f);
     
     // Initialize descriptor with comprehensive default values
-    IOLog("    Initializing comprehensive texture descriptor\n");
+    VMLOG_DEBUG("    Initializing comprehensive texture descriptor\n");
     bzero(descriptor, sizeof(VMTextureDescriptor));
     
     // Phase 3: Advanced Texture Properties Analysis and Determination
-    IOLog("  Phase 3: Advanced texture properties analysis and intelligent determination\n");
+    VMLOG_DEBUG("  Phase 3: Advanced texture properties analysis and intelligent determination\n");
     
     struct TexturePropertiesAnalysis {
         // Dimensional properties
@@ -4897,28 +4956,28 @@ IOReturn CLASS::getTextureDescriptor(uint32_t texture_id, VMTextureDescriptor* d
         properties_analysis.analysis_confidence = 0.5f; // Low confidence for fallback
     }
     
-    IOLog("    Texture Properties Analysis Results:\n");
-    IOLog("      Dimensions: %dx%dx%d\n", properties_analysis.analyzed_width, 
+    VMLOG_DEBUG("    Texture Properties Analysis Results:\n");
+    VMLOG_DEBUG("      Dimensions: %dx%dx%d\n", properties_analysis.analyzed_width, 
           properties_analysis.analyzed_height, properties_analysis.analyzed_depth);
-    IOLog("      Array Length: %d\n", properties_analysis.analyzed_array_length);
-    IOLog("      Texture Type: %d\n", properties_analysis.texture_type_classification);
-    IOLog("      Pixel Format: %d (%d bpp, %d bytes/pixel)\n", properties_analysis.determined_pixel_format,
+    VMLOG_DEBUG("      Array Length: %d\n", properties_analysis.analyzed_array_length);
+    VMLOG_DEBUG("      Texture Type: %d\n", properties_analysis.texture_type_classification);
+    VMLOG_DEBUG("      Pixel Format: %d (%d bpp, %d bytes/pixel)\n", properties_analysis.determined_pixel_format,
           properties_analysis.bits_per_pixel, properties_analysis.bytes_per_pixel);
-    IOLog("      Has Alpha Channel: %s\n", properties_analysis.has_alpha_channel ? "YES" : "NO");
-    IOLog("      Compression Support: %s\n", properties_analysis.supports_compression ? "YES" : "NO");
-    IOLog("      Storage Mode: %d\n", properties_analysis.storage_mode_analysis);
-    IOLog("      Usage Pattern: %d\n", properties_analysis.usage_pattern_analysis);
-    IOLog("      Memory Footprint: %d KB\n", properties_analysis.memory_footprint_bytes / 1024);
-    IOLog("      GPU Memory Alignment: %d bytes\n", properties_analysis.gpu_memory_alignment);
-    IOLog("      Mipmap Levels: %d\n", properties_analysis.mipmap_levels_detected);
-    IOLog("      Sample Count: %d\n", properties_analysis.sample_count_analysis);
-    IOLog("      Auto Mipmap Generation: %s\n", properties_analysis.auto_mipmap_generation ? "YES" : "NO");
-    IOLog("      Hardware Acceleration: %s\n", properties_analysis.supports_hardware_acceleration ? "YES" : "NO");
-    IOLog("      Rendering Optimized: %s\n", properties_analysis.optimized_for_rendering ? "YES" : "NO");
-    IOLog("      Analysis Confidence: %.1f%%\n", properties_analysis.analysis_confidence * 100.0f);
+    VMLOG_DEBUG("      Has Alpha Channel: %s\n", properties_analysis.has_alpha_channel ? "YES" : "NO");
+    VMLOG_DEBUG("      Compression Support: %s\n", properties_analysis.supports_compression ? "YES" : "NO");
+    VMLOG_DEBUG("      Storage Mode: %d\n", properties_analysis.storage_mode_analysis);
+    VMLOG_DEBUG("      Usage Pattern: %d\n", properties_analysis.usage_pattern_analysis);
+    VMLOG_DEBUG("      Memory Footprint: %d KB\n", properties_analysis.memory_footprint_bytes / 1024);
+    VMLOG_DEBUG("      GPU Memory Alignment: %d bytes\n", properties_analysis.gpu_memory_alignment);
+    VMLOG_DEBUG("      Mipmap Levels: %d\n", properties_analysis.mipmap_levels_detected);
+    VMLOG_DEBUG("      Sample Count: %d\n", properties_analysis.sample_count_analysis);
+    VMLOG_DEBUG("      Auto Mipmap Generation: %s\n", properties_analysis.auto_mipmap_generation ? "YES" : "NO");
+    VMLOG_DEBUG("      Hardware Acceleration: %s\n", properties_analysis.supports_hardware_acceleration ? "YES" : "NO");
+    VMLOG_DEBUG("      Rendering Optimized: %s\n", properties_analysis.optimized_for_rendering ? "YES" : "NO");
+    VMLOG_DEBUG("      Analysis Confidence: %.1f%%\n", properties_analysis.analysis_confidence * 100.0f);
     
     // Phase 4: Comprehensive Descriptor Population and Validation
-    IOLog("  Phase 4: Comprehensive descriptor population and advanced validation\n");
+    VMLOG_DEBUG("  Phase 4: Comprehensive descriptor population and advanced validation\n");
     
     // Populate core dimensional properties
     descriptor->texture_type = properties_analysis.texture_type_classification;
@@ -4966,25 +5025,25 @@ IOReturn CLASS::getTextureDescriptor(uint32_t texture_id, VMTextureDescriptor* d
     if (descriptor_validation.storage_mode_appropriate) validity_checks_passed++;
     descriptor_validation.overall_validity = (float)validity_checks_passed / (float)total_validity_checks;
     
-    IOLog("    Descriptor Population and Validation:\n");
-    IOLog("      Dimensions Consistent: %s\n", descriptor_validation.dimensions_consistent ? "YES" : "NO");
-    IOLog("      Format Supported: %s\n", descriptor_validation.format_supported ? "YES" : "NO");
-    IOLog("      Memory Requirements Valid: %s\n", descriptor_validation.memory_requirements_valid ? "YES" : "NO");
-    IOLog("      Mipmap Configuration Valid: %s\n", descriptor_validation.mipmap_configuration_valid ? "YES" : "NO");
-    IOLog("      Usage Flags Consistent: %s\n", descriptor_validation.usage_flags_consistent ? "YES" : "NO");
-    IOLog("      Storage Mode Appropriate: %s\n", descriptor_validation.storage_mode_appropriate ? "YES" : "NO");
-    IOLog("      Overall Validity: %.1f%% (%d/%d checks passed)\n", 
+    VMLOG_DEBUG("    Descriptor Population and Validation:\n");
+    VMLOG_DEBUG("      Dimensions Consistent: %s\n", descriptor_validation.dimensions_consistent ? "YES" : "NO");
+    VMLOG_DEBUG("      Format Supported: %s\n", descriptor_validation.format_supported ? "YES" : "NO");
+    VMLOG_DEBUG("      Memory Requirements Valid: %s\n", descriptor_validation.memory_requirements_valid ? "YES" : "NO");
+    VMLOG_DEBUG("      Mipmap Configuration Valid: %s\n", descriptor_validation.mipmap_configuration_valid ? "YES" : "NO");
+    VMLOG_DEBUG("      Usage Flags Consistent: %s\n", descriptor_validation.usage_flags_consistent ? "YES" : "NO");
+    VMLOG_DEBUG("      Storage Mode Appropriate: %s\n", descriptor_validation.storage_mode_appropriate ? "YES" : "NO");
+    VMLOG_DEBUG("      Overall Validity: %.1f%% (%d/%d checks passed)\n", 
           descriptor_validation.overall_validity * 100.0f, validity_checks_passed, total_validity_checks);
     
     if (descriptor_validation.overall_validity < 0.9f) { // Require 90% validity
-        IOLog("    ERROR: Descriptor validation failed (%.1f%% validity)\n", 
+        VMLOG_ERROR("    ERROR: Descriptor validation failed (%.1f%% validity)\n", 
               descriptor_validation.overall_validity * 100.0f);
         IOLockUnlock(m_texture_lock);
         return kIOReturnInvalid;
     }
     
     // Phase 5: Access Tracking and System State Update
-    IOLog("  Phase 5: Access tracking and comprehensive system state update\n");
+    VMLOG_DEBUG("  Phase 5: Access tracking and comprehensive system state update\n");
     
     struct AccessTrackingUpdate {
         uint64_t access_timestamp;
@@ -5005,35 +5064,35 @@ IOReturn CLASS::getTextureDescriptor(uint32_t texture_id, VMTextureDescriptor* d
     access_tracking.cache_descriptor = (descriptor_validation.overall_validity >= 0.95f);
     access_tracking.tracking_efficiency = 0.98f; // Target 98% efficiency
     
-    IOLog("    Access Tracking Configuration:\n");
-    IOLog("      Access Timestamp: %llu\n", access_tracking.access_timestamp);
-    IOLog("      Access Count Increment: %d\n", access_tracking.access_count_increment);
-    IOLog("      Total Access Count: %d\n", access_tracking.total_access_count);
-    IOLog("      Update Last Access Time: %s\n", access_tracking.update_last_access_time ? "YES" : "NO");
-    IOLog("      Update Access Statistics: %s\n", access_tracking.update_access_statistics ? "YES" : "NO");
-    IOLog("      Cache Descriptor: %s\n", access_tracking.cache_descriptor ? "YES" : "NO");
-    IOLog("      Tracking Efficiency Target: %.1f%%\n", access_tracking.tracking_efficiency * 100.0f);
+    VMLOG_DEBUG("    Access Tracking Configuration:\n");
+    VMLOG_DEBUG("      Access Timestamp: %llu\n", access_tracking.access_timestamp);
+    VMLOG_DEBUG("      Access Count Increment: %d\n", access_tracking.access_count_increment);
+    VMLOG_DEBUG("      Total Access Count: %d\n", access_tracking.total_access_count);
+    VMLOG_DEBUG("      Update Last Access Time: %s\n", access_tracking.update_last_access_time ? "YES" : "NO");
+    VMLOG_DEBUG("      Update Access Statistics: %s\n", access_tracking.update_access_statistics ? "YES" : "NO");
+    VMLOG_DEBUG("      Cache Descriptor: %s\n", access_tracking.cache_descriptor ? "YES" : "NO");
+    VMLOG_DEBUG("      Tracking Efficiency Target: %.1f%%\n", access_tracking.tracking_efficiency * 100.0f);
     
     // Update system access statistics (in real implementation, would update ManagedTexture)
     if (access_tracking.update_access_statistics) {
-        IOLog("    Updating texture access statistics\n");
+        VMLOG_DEBUG("    Updating texture access statistics\n");
         // Would update managed texture access count and timestamp
     }
     
-    IOLog("VMTextureManager::getTextureDescriptor: ========== Descriptor Retrieval Complete ==========\n");
-    IOLog("  Texture ID: %d\n", texture_id);
-    IOLog("  Retrieved Dimensions: %dx%dx%d\n", descriptor->width, descriptor->height, descriptor->depth);
-    IOLog("  Pixel Format: %d\n", descriptor->pixel_format);
-    IOLog("  Mipmap Levels: %d\n", descriptor->mipmap_level_count);
-    IOLog("  Sample Count: %d\n", descriptor->sample_count);
-    IOLog("  Array Length: %d\n", descriptor->array_length);
-    IOLog("  Storage Mode: %d\n", descriptor->storage_mode);
-    IOLog("  Usage Pattern: %d\n", descriptor->usage);
-    IOLog("  Memory Footprint: %d KB\n", properties_analysis.memory_footprint_bytes / 1024);
-    IOLog("  Validation Confidence: %.1f%%\n", validation_context.validation_confidence * 100.0f);
-    IOLog("  Descriptor Validity: %.1f%%\n", descriptor_validation.overall_validity * 100.0f);
-    IOLog("  Analysis Confidence: %.1f%%\n", properties_analysis.analysis_confidence * 100.0f);
-    IOLog("==================================================================================\n");
+    VMLOG_DEBUG("VMTextureManager::getTextureDescriptor: ========== Descriptor Retrieval Complete ==========\n");
+    VMLOG_DEBUG("  Texture ID: %d\n", texture_id);
+    VMLOG_DEBUG("  Retrieved Dimensions: %dx%dx%d\n", descriptor->width, descriptor->height, descriptor->depth);
+    VMLOG_DEBUG("  Pixel Format: %d\n", descriptor->pixel_format);
+    VMLOG_DEBUG("  Mipmap Levels: %d\n", descriptor->mipmap_level_count);
+    VMLOG_DEBUG("  Sample Count: %d\n", descriptor->sample_count);
+    VMLOG_DEBUG("  Array Length: %d\n", descriptor->array_length);
+    VMLOG_DEBUG("  Storage Mode: %d\n", descriptor->storage_mode);
+    VMLOG_DEBUG("  Usage Pattern: %d\n", descriptor->usage);
+    VMLOG_DEBUG("  Memory Footprint: %d KB\n", properties_analysis.memory_footprint_bytes / 1024);
+    VMLOG_DEBUG("  Validation Confidence: %.1f%%\n", validation_context.validation_confidence * 100.0f);
+    VMLOG_DEBUG("  Descriptor Validity: %.1f%%\n", descriptor_validation.overall_validity * 100.0f);
+    VMLOG_DEBUG("  Analysis Confidence: %.1f%%\n", properties_analysis.analysis_confidence * 100.0f);
+    VMLOG_DEBUG("==================================================================================\n");
     
     IOLockUnlock(m_texture_lock);
     return kIOReturnSuccess;
@@ -5045,34 +5104,34 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
 {
     // Advanced Texture Update System - Comprehensive Memory Transfer and Validation Engine
     if (texture_id == 0) {
-        IOLog("VMTextureManager::updateTexture: Invalid texture ID (zero)\n");
+        VMLOG_WARN("VMTextureManager::updateTexture: Invalid texture ID (zero)\n");
         return kIOReturnBadArgument;
     }
     
     if (!data) {
-        IOLog("VMTextureManager::updateTexture: Invalid data parameter (null pointer)\n");
+        VMLOG_WARN("VMTextureManager::updateTexture: Invalid data parameter (null pointer)\n");
         return kIOReturnBadArgument;
     }
     
     if (!region) {
-        IOLog("VMTextureManager::updateTexture: Invalid region parameter (null pointer)\n");
+        VMLOG_WARN("VMTextureManager::updateTexture: Invalid region parameter (null pointer)\n");
         return kIOReturnBadArgument;
     }
     
     // Acquire texture management lock for thread safety
     if (!m_texture_lock) {
-        IOLog("VMTextureManager::updateTexture: Texture lock not initialized\n");
+        VMLOG_DEBUG("VMTextureManager::updateTexture: Texture lock not initialized\n");
         return kIOReturnNotReady;
     }
     
     IOLockLock(m_texture_lock);
     
-    IOLog("VMTextureManager::updateTexture: Initiating advanced texture update operation\n");
-    IOLog("  Target Texture ID: %d\n", texture_id);
-    IOLog("  Target Mip Level: %d\n", mip_level);
+    VMLOG_DEBUG("VMTextureManager::updateTexture: Initiating advanced texture update operation\n");
+    VMLOG_DEBUG("  Target Texture ID: %d\n", texture_id);
+    VMLOG_DEBUG("  Target Mip Level: %d\n", mip_level);
     
     // Phase 1: Advanced Texture Validation and Existence Verification
-    IOLog("  Phase 1: Advanced texture validation and comprehensive existence verification\n");
+    VMLOG_DEBUG("  Phase 1: Advanced texture validation and comprehensive existence verification\n");
     
     struct TextureUpdateValidation {
         uint32_t target_texture_id;
@@ -5109,10 +5168,10 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         update_validation.texture_max_mip_levels = 10;
         update_validation.texture_pixel_format = VMTextureFormatRGBA8Unorm;
         
-        IOLog("    Target texture located successfully\n");
+        VMLOG_DEBUG("    Target texture located successfully\n");
     } else {
         update_validation.texture_exists = false;
-        IOLog("    Target texture not found in system\n");
+        VMLOG_DEBUG("    Target texture not found in system\n");
     }
     
     // Validate mip level
@@ -5137,34 +5196,34 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
     if (update_validation.data_descriptor_valid) validation_checks_passed++;
     update_validation.validation_confidence = (float)validation_checks_passed / (float)total_validation_checks;
     
-    IOLog("    Texture Update Validation Results:\n");
-    IOLog("      Texture Exists: %s\n", update_validation.texture_exists ? "YES" : "NO");
-    IOLog("      Texture Accessible: %s\n", update_validation.texture_accessible ? "YES" : "NO");
-    IOLog("      Texture Writable: %s\n", update_validation.texture_writable ? "YES" : "NO");
-    IOLog("      Mip Level Valid: %s (Level %d / Max %d)\n", 
+    VMLOG_DEBUG("    Texture Update Validation Results:\n");
+    VMLOG_DEBUG("      Texture Exists: %s\n", update_validation.texture_exists ? "YES" : "NO");
+    VMLOG_DEBUG("      Texture Accessible: %s\n", update_validation.texture_accessible ? "YES" : "NO");
+    VMLOG_DEBUG("      Texture Writable: %s\n", update_validation.texture_writable ? "YES" : "NO");
+    VMLOG_DEBUG("      Mip Level Valid: %s (Level %d / Max %d)\n", 
           update_validation.mip_level_valid ? "YES" : "NO", 
           update_validation.target_mip_level, update_validation.texture_max_mip_levels);
-    IOLog("      Region Bounds Valid: %s\n", update_validation.region_bounds_valid ? "YES" : "NO");
-    IOLog("      Data Descriptor Valid: %s (%llu bytes)\n", 
+    VMLOG_DEBUG("      Region Bounds Valid: %s\n", update_validation.region_bounds_valid ? "YES" : "NO");
+    VMLOG_DEBUG("      Data Descriptor Valid: %s (%llu bytes)\n", 
           update_validation.data_descriptor_valid ? "YES" : "NO", data->getLength());
-    IOLog("      Current Texture Size: %dx%dx%d\n", 
+    VMLOG_DEBUG("      Current Texture Size: %dx%dx%d\n", 
           update_validation.texture_current_width, update_validation.texture_current_height, update_validation.texture_current_depth);
-    IOLog("      Update Region: %dx%dx%d at offset (%d,%d,%d)\n", 
+    VMLOG_DEBUG("      Update Region: %dx%dx%d at offset (%d,%d,%d)\n", 
           region->width, region->height, region->depth, region->x, region->y, region->z);
-    IOLog("      Pixel Format: %d\n", update_validation.texture_pixel_format);
-    IOLog("      Validation Confidence: %.1f%% (%d/%d checks passed)\n", 
+    VMLOG_DEBUG("      Pixel Format: %d\n", update_validation.texture_pixel_format);
+    VMLOG_DEBUG("      Validation Confidence: %.1f%% (%d/%d checks passed)\n", 
           update_validation.validation_confidence * 100.0f, validation_checks_passed, total_validation_checks);
     
     // Early validation failure check
     if (update_validation.validation_confidence < 0.83f) { // Require 83% confidence (5/6 checks)
-        IOLog("    ERROR: Texture update validation failed (%.1f%% confidence)\n", 
+        VMLOG_ERROR("    ERROR: Texture update validation failed (%.1f%% confidence)\n", 
               update_validation.validation_confidence * 100.0f);
         IOLockUnlock(m_texture_lock);
         return kIOReturnBadArgument;
     }
     
     // Phase 2: Advanced Data Transfer Analysis and Planning
-    IOLog("  Phase 2: Advanced data transfer analysis and comprehensive planning\n");
+    VMLOG_DEBUG("  Phase 2: Advanced data transfer analysis and comprehensive planning\n");
     
     struct DataTransferPlan {
         uint64_t source_data_size;
@@ -5230,24 +5289,24 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
     transfer_plan.estimated_transfer_time_microseconds = transfer_plan.target_region_size / 1024; // ~1GB/s estimation
     transfer_plan.transfer_efficiency = transfer_plan.supports_direct_copy ? 0.95f : 0.80f;
     
-    IOLog("    Data Transfer Plan:\n");
-    IOLog("      Source Data Size: %llu bytes (%.2f MB)\n", 
+    VMLOG_DEBUG("    Data Transfer Plan:\n");
+    VMLOG_DEBUG("      Source Data Size: %llu bytes (%.2f MB)\n", 
           transfer_plan.source_data_size, (float)transfer_plan.source_data_size / (1024.0f * 1024.0f));
-    IOLog("      Target Region Size: %llu bytes (%.2f MB)\n", 
+    VMLOG_DEBUG("      Target Region Size: %llu bytes (%.2f MB)\n", 
           transfer_plan.target_region_size, (float)transfer_plan.target_region_size / (1024.0f * 1024.0f));
-    IOLog("      Bytes per Pixel: %d\n", transfer_plan.bytes_per_pixel);
-    IOLog("      Source Row Bytes: %d\n", transfer_plan.source_row_bytes);
-    IOLog("      Target Row Bytes: %d\n", transfer_plan.target_row_bytes);
-    IOLog("      Transfer Alignment: %d bytes\n", transfer_plan.transfer_alignment);
-    IOLog("      Requires Format Conversion: %s\n", transfer_plan.requires_format_conversion ? "YES" : "NO");
-    IOLog("      Requires Byte Swapping: %s\n", transfer_plan.requires_byte_swapping ? "YES" : "NO");
-    IOLog("      Supports Direct Copy: %s\n", transfer_plan.supports_direct_copy ? "YES" : "NO");
-    IOLog("      Requires Staging Buffer: %s\n", transfer_plan.requires_staging_buffer ? "YES" : "NO");
-    IOLog("      Estimated Transfer Time: %llu μs\n", transfer_plan.estimated_transfer_time_microseconds);
-    IOLog("      Transfer Efficiency: %.1f%%\n", transfer_plan.transfer_efficiency * 100.0f);
+    VMLOG_DEBUG("      Bytes per Pixel: %d\n", transfer_plan.bytes_per_pixel);
+    VMLOG_DEBUG("      Source Row Bytes: %d\n", transfer_plan.source_row_bytes);
+    VMLOG_DEBUG("      Target Row Bytes: %d\n", transfer_plan.target_row_bytes);
+    VMLOG_DEBUG("      Transfer Alignment: %d bytes\n", transfer_plan.transfer_alignment);
+    VMLOG_DEBUG("      Requires Format Conversion: %s\n", transfer_plan.requires_format_conversion ? "YES" : "NO");
+    VMLOG_DEBUG("      Requires Byte Swapping: %s\n", transfer_plan.requires_byte_swapping ? "YES" : "NO");
+    VMLOG_DEBUG("      Supports Direct Copy: %s\n", transfer_plan.supports_direct_copy ? "YES" : "NO");
+    VMLOG_DEBUG("      Requires Staging Buffer: %s\n", transfer_plan.requires_staging_buffer ? "YES" : "NO");
+    VMLOG_DEBUG("      Estimated Transfer Time: %llu μs\n", transfer_plan.estimated_transfer_time_microseconds);
+    VMLOG_DEBUG("      Transfer Efficiency: %.1f%%\n", transfer_plan.transfer_efficiency * 100.0f);
     
     // Phase 3: Advanced Memory Transfer Execution with Optimization
-    IOLog("  Phase 3: Advanced memory transfer execution with comprehensive optimization\n");
+    VMLOG_DEBUG("  Phase 3: Advanced memory transfer execution with comprehensive optimization\n");
     
     struct TransferExecution {
         bool transfer_initiated;
@@ -5264,13 +5323,13 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
     // Initiate memory transfer (simulated for demonstration)
     transfer_execution.transfer_initiated = true;
     
-    IOLog("    Initiating optimized memory transfer operation\n");
-    IOLog("      Transfer Method: %s\n", 
+    VMLOG_DEBUG("    Initiating optimized memory transfer operation\n");
+    VMLOG_DEBUG("      Transfer Method: %s\n", 
           transfer_plan.supports_direct_copy ? "Direct Copy" : "Staged Transfer");
     
     if (transfer_plan.supports_direct_copy) {
         // Advanced High-Performance SIMD-Optimized Memory Copy System
-        IOLog("      === Advanced High-Performance SIMD-Optimized Memory Copy System ===\n");
+        VMLOG_DEBUG("      === Advanced High-Performance SIMD-Optimized Memory Copy System ===\n");
         
         struct AdvancedMemoryCopyEngine {
             uint32_t engine_version;
@@ -5294,7 +5353,7 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         copy_engine.optimization_level = 4; // Maximum optimization
         
         // Advanced CPU Feature Detection System - Safe Compatibility Layer
-        IOLog("        === Advanced CPU Feature Detection System ===\n");
+        VMLOG_DEBUG("        === Advanced CPU Feature Detection System ===\n");
         
         struct CPUFeatureDetection {
             uint32_t detection_system_version;
@@ -5332,7 +5391,7 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         cpu_detection.detection_system_version = 0x0103; // Version 1.3
         cpu_detection.cpuid_instruction_available = true; // Assume CPUID available on modern systems
         
-        IOLog("          CPU Feature Detection System v1.3 Initializing...\n");
+        VMLOG_DEBUG("          CPU Feature Detection System v1.3 Initializing...\n");
         
         // Simulate CPU feature detection (in real implementation, would use CPUID instruction)
         // This is a safe simulation that prevents crashes by detecting actual CPU capabilities
@@ -5345,7 +5404,7 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         
         // Progressive feature detection with fallback safety
         if (cpu_detection.cpuid_instruction_available) {
-            IOLog("            Executing progressive CPUID feature detection...\n");
+            VMLOG_DEBUG("            Executing progressive CPUID feature detection...\n");
             
             // Level 1: Basic MMX/SSE detection (universally supported)
             cpu_detection.mmx_supported = true; // MMX supported on all modern CPUs
@@ -5405,7 +5464,7 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
             cpu_detection.detection_successful = true;
         } else {
             // CPUID not available - use safest possible feature set
-            IOLog("            WARNING: CPUID not available, using minimal feature set\n");
+            VMLOG_WARN("            WARNING: CPUID not available, using minimal feature set\n");
             cpu_detection.mmx_supported = false;
             cpu_detection.sse_supported = false;
             cpu_detection.sse2_supported = false;
@@ -5442,34 +5501,34 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         if (cpu_detection.avx512f_supported) performance_score += 6.0f;
         cpu_detection.cpu_performance_rating = performance_score;
         
-        IOLog("          CPU Feature Detection Results:\n");
-        IOLog("            CPU Vendor: 0x%08X (%s)\n", cpu_detection.cpu_vendor_id,
+        VMLOG_DEBUG("          CPU Feature Detection Results:\n");
+        VMLOG_DEBUG("            CPU Vendor: 0x%08X (%s)\n", cpu_detection.cpu_vendor_id,
               (cpu_detection.cpu_vendor_id == 0x756E6547) ? "Intel" :
               (cpu_detection.cpu_vendor_id == 0x68747541) ? "AMD" : "Unknown");
-        IOLog("            CPU Family/Model/Stepping: %d/%d/%d\n", 
+        VMLOG_DEBUG("            CPU Family/Model/Stepping: %d/%d/%d\n", 
               cpu_detection.cpu_family, cpu_detection.cpu_model, cpu_detection.cpu_stepping);
-        IOLog("            MMX Support: %s\n", cpu_detection.mmx_supported ? "YES" : "NO");
-        IOLog("            SSE Support: %s\n", cpu_detection.sse_supported ? "YES" : "NO");
-        IOLog("            SSE2 Support: %s\n", cpu_detection.sse2_supported ? "YES" : "NO");
-        IOLog("            SSE3 Support: %s\n", cpu_detection.sse3_supported ? "YES" : "NO");
-        IOLog("            SSSE3 Support: %s\n", cpu_detection.ssse3_supported ? "YES" : "NO");
-        IOLog("            SSE4.1 Support: %s\n", cpu_detection.sse41_supported ? "YES" : "NO");
-        IOLog("            SSE4.2 Support: %s\n", cpu_detection.sse42_supported ? "YES" : "NO");
-        IOLog("            AVX Support: %s\n", cpu_detection.avx_supported ? "YES" : "NO");
-        IOLog("            AVX2 Support: %s\n", cpu_detection.avx2_supported ? "YES" : "NO");
-        IOLog("            AVX-512F Support: %s\n", cpu_detection.avx512f_supported ? "YES" : "NO");
-        IOLog("            FMA Support: %s\n", cpu_detection.fma_supported ? "YES" : "NO");
-        IOLog("            AES-NI Support: %s\n", cpu_detection.aes_ni_supported ? "YES" : "NO");
-        IOLog("            RDRAND Support: %s\n", cpu_detection.rdrand_supported ? "YES" : "NO");
-        IOLog("            Prefetch Support: %s\n", cpu_detection.prefetch_supported ? "YES" : "NO");
-        IOLog("            Non-Temporal Stores: %s\n", cpu_detection.non_temporal_supported ? "YES" : "NO");
-        IOLog("            Cache Line Size: %d bytes\n", cpu_detection.cpu_cache_line_size);
-        IOLog("            Feature Flags: 0x%02X\n", cpu_detection.detected_feature_flags);
-        IOLog("            Performance Rating: %.1f\n", cpu_detection.cpu_performance_rating);
-        IOLog("            Detection Status: %s\n", cpu_detection.detection_successful ? "SUCCESS" : "FALLBACK");
+        VMLOG_DEBUG("            MMX Support: %s\n", cpu_detection.mmx_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            SSE Support: %s\n", cpu_detection.sse_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            SSE2 Support: %s\n", cpu_detection.sse2_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            SSE3 Support: %s\n", cpu_detection.sse3_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            SSSE3 Support: %s\n", cpu_detection.ssse3_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            SSE4.1 Support: %s\n", cpu_detection.sse41_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            SSE4.2 Support: %s\n", cpu_detection.sse42_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            AVX Support: %s\n", cpu_detection.avx_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            AVX2 Support: %s\n", cpu_detection.avx2_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            AVX-512F Support: %s\n", cpu_detection.avx512f_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            FMA Support: %s\n", cpu_detection.fma_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            AES-NI Support: %s\n", cpu_detection.aes_ni_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            RDRAND Support: %s\n", cpu_detection.rdrand_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            Prefetch Support: %s\n", cpu_detection.prefetch_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            Non-Temporal Stores: %s\n", cpu_detection.non_temporal_supported ? "YES" : "NO");
+        VMLOG_DEBUG("            Cache Line Size: %d bytes\n", cpu_detection.cpu_cache_line_size);
+        VMLOG_DEBUG("            Feature Flags: 0x%02X\n", cpu_detection.detected_feature_flags);
+        VMLOG_DEBUG("            Performance Rating: %.1f\n", cpu_detection.cpu_performance_rating);
+        VMLOG_DEBUG("            Detection Status: %s\n", cpu_detection.detection_successful ? "SUCCESS" : "FALLBACK");
         
         // Configure memory copy engine based on actual CPU capabilities
-        IOLog("        Configuring copy engine based on detected CPU features...\n");
+        VMLOG_DEBUG("        Configuring copy engine based on detected CPU features...\n");
         
         // Safe feature assignment based on detection results
         copy_engine.supports_avx512 = cpu_detection.avx512f_supported;
@@ -5531,25 +5590,25 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
             copy_strategy_name = "Scalar (Safe Fallback)";
         }
         
-        IOLog("        Advanced Memory Copy Engine Configuration (CPU-Optimized):\n");
-        IOLog("          Engine Version: 0x%04X (v3.2)\n", copy_engine.engine_version);
-        IOLog("          Optimization Level: %d (Maximum Safe)\n", copy_engine.optimization_level);
-        IOLog("          Selected Strategy: %s\n", copy_strategy_name);
-        IOLog("          SIMD Instruction Set: 0x%02X\n", copy_engine.simd_instruction_set);
-        IOLog("          AVX-512 Support: %s\n", copy_engine.supports_avx512 ? "ENABLED" : "DISABLED");
-        IOLog("          AVX2 Support: %s\n", copy_engine.supports_avx2 ? "ENABLED" : "DISABLED");
-        IOLog("          SSE4.2 Support: %s\n", copy_engine.supports_sse42 ? "ENABLED" : "DISABLED");
-        IOLog("          ARM64 NEON Support: %s\n", copy_engine.supports_neon ? "ENABLED" : "DISABLED");
-        IOLog("          Prefetch Support: %s\n", copy_engine.supports_prefetch ? "ENABLED" : "DISABLED");
-        IOLog("          Non-Temporal Stores: %s\n", copy_engine.supports_non_temporal_stores ? "ENABLED" : "DISABLED");
-        IOLog("          Cache Line Size: %d bytes\n", copy_engine.cache_line_size);
-        IOLog("          Optimal Block Size: %d KB\n", copy_engine.optimal_block_size / 1024);
-        IOLog("          Alignment Requirement: %d bytes\n", copy_engine.alignment_requirement);
-        IOLog("          Performance Multiplier: %.1fx\n", copy_engine.performance_multiplier);
-        IOLog("          Capabilities Flags: 0x%02X\n", copy_engine.engine_capabilities_flags);
+        VMLOG_DEBUG("        Advanced Memory Copy Engine Configuration (CPU-Optimized):\n");
+        VMLOG_DEBUG("          Engine Version: 0x%04X (v3.2)\n", copy_engine.engine_version);
+        VMLOG_DEBUG("          Optimization Level: %d (Maximum Safe)\n", copy_engine.optimization_level);
+        VMLOG_DEBUG("          Selected Strategy: %s\n", copy_strategy_name);
+        VMLOG_DEBUG("          SIMD Instruction Set: 0x%02X\n", copy_engine.simd_instruction_set);
+        VMLOG_DEBUG("          AVX-512 Support: %s\n", copy_engine.supports_avx512 ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("          AVX2 Support: %s\n", copy_engine.supports_avx2 ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("          SSE4.2 Support: %s\n", copy_engine.supports_sse42 ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("          ARM64 NEON Support: %s\n", copy_engine.supports_neon ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("          Prefetch Support: %s\n", copy_engine.supports_prefetch ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("          Non-Temporal Stores: %s\n", copy_engine.supports_non_temporal_stores ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("          Cache Line Size: %d bytes\n", copy_engine.cache_line_size);
+        VMLOG_DEBUG("          Optimal Block Size: %d KB\n", copy_engine.optimal_block_size / 1024);
+        VMLOG_DEBUG("          Alignment Requirement: %d bytes\n", copy_engine.alignment_requirement);
+        VMLOG_DEBUG("          Performance Multiplier: %.1fx\n", copy_engine.performance_multiplier);
+        VMLOG_DEBUG("          Capabilities Flags: 0x%02X\n", copy_engine.engine_capabilities_flags);
         
         // Phase 1: Advanced Memory Alignment Analysis and Optimization Planning
-        IOLog("        Phase 1: Advanced memory alignment analysis and optimization planning\n");
+        VMLOG_DEBUG("        Phase 1: Advanced memory alignment analysis and optimization planning\n");
         
         struct MemoryAlignmentAnalysis {
             uint64_t source_memory_address;
@@ -5612,24 +5671,24 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         alignment_analysis.alignment_efficiency_score = 
             (float)alignment_factors_optimal / (float)total_alignment_factors;
         
-        IOLog("          Memory Alignment Analysis:\n");
-        IOLog("            Source Address: 0x%016llX (offset: %d)\n", 
+        VMLOG_DEBUG("          Memory Alignment Analysis:\n");
+        VMLOG_DEBUG("            Source Address: 0x%016llX (offset: %d)\n", 
               alignment_analysis.source_memory_address, alignment_analysis.source_alignment_offset);
-        IOLog("            Destination Address: 0x%016llX (offset: %d)\n", 
+        VMLOG_DEBUG("            Destination Address: 0x%016llX (offset: %d)\n", 
               alignment_analysis.destination_memory_address, alignment_analysis.destination_alignment_offset);
-        IOLog("            Transfer Size: %llu bytes (remainder: %d)\n", 
+        VMLOG_DEBUG("            Transfer Size: %llu bytes (remainder: %d)\n", 
               alignment_analysis.transfer_size_bytes, alignment_analysis.size_alignment_remainder);
-        IOLog("            Source Aligned: %s\n", alignment_analysis.source_properly_aligned ? "YES" : "NO");
-        IOLog("            Destination Aligned: %s\n", alignment_analysis.destination_properly_aligned ? "YES" : "NO");
-        IOLog("            Size Aligned: %s\n", alignment_analysis.size_properly_aligned ? "YES" : "NO");
-        IOLog("            Can Use Aligned Copy: %s\n", alignment_analysis.can_use_aligned_copy ? "YES" : "NO");
-        IOLog("            Requires Alignment Fixup: %s\n", alignment_analysis.requires_alignment_fixup ? "YES" : "NO");
-        IOLog("            Optimal Copy Strategy: %d\n", alignment_analysis.optimal_copy_strategy);
-        IOLog("            Alignment Efficiency: %.1f%% (%d/3 factors optimal)\n", 
+        VMLOG_DEBUG("            Source Aligned: %s\n", alignment_analysis.source_properly_aligned ? "YES" : "NO");
+        VMLOG_DEBUG("            Destination Aligned: %s\n", alignment_analysis.destination_properly_aligned ? "YES" : "NO");
+        VMLOG_DEBUG("            Size Aligned: %s\n", alignment_analysis.size_properly_aligned ? "YES" : "NO");
+        VMLOG_DEBUG("            Can Use Aligned Copy: %s\n", alignment_analysis.can_use_aligned_copy ? "YES" : "NO");
+        VMLOG_DEBUG("            Requires Alignment Fixup: %s\n", alignment_analysis.requires_alignment_fixup ? "YES" : "NO");
+        VMLOG_DEBUG("            Optimal Copy Strategy: %d\n", alignment_analysis.optimal_copy_strategy);
+        VMLOG_DEBUG("            Alignment Efficiency: %.1f%% (%d/3 factors optimal)\n", 
               alignment_analysis.alignment_efficiency_score * 100.0f, alignment_factors_optimal);
         
         // Phase 2: High-Performance Block Transfer Strategy Implementation
-        IOLog("        Phase 2: High-performance block transfer strategy implementation\n");
+        VMLOG_DEBUG("        Phase 2: High-performance block transfer strategy implementation\n");
         
         struct BlockTransferStrategy {
             uint32_t strategy_version;
@@ -5692,23 +5751,23 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         block_strategy.block_processing_efficiency = 
             0.5f + alignment_bonus + simd_bonus + prefetch_bonus + parallel_bonus;
         
-        IOLog("          Block Transfer Strategy:\n");
-        IOLog("            Strategy Version: 0x%04X (v2.1)\n", block_strategy.strategy_version);
-        IOLog("            Block Size: %d KB\n", block_strategy.block_size_bytes / 1024);
-        IOLog("            Total Blocks: %llu blocks\n", block_strategy.total_blocks_to_process);
-        IOLog("            Aligned Blocks: %llu blocks\n", block_strategy.aligned_blocks);
-        IOLog("            Partial Blocks: %llu blocks\n", block_strategy.partial_blocks);
-        IOLog("            Tail Bytes: %llu bytes\n", block_strategy.tail_bytes);
-        IOLog("            Blocks per Iteration: %d blocks\n", block_strategy.blocks_per_iteration);
-        IOLog("            Prefetch Optimization: %s (distance: %d cache lines)\n", 
+        VMLOG_DEBUG("          Block Transfer Strategy:\n");
+        VMLOG_DEBUG("            Strategy Version: 0x%04X (v2.1)\n", block_strategy.strategy_version);
+        VMLOG_DEBUG("            Block Size: %d KB\n", block_strategy.block_size_bytes / 1024);
+        VMLOG_DEBUG("            Total Blocks: %llu blocks\n", block_strategy.total_blocks_to_process);
+        VMLOG_DEBUG("            Aligned Blocks: %llu blocks\n", block_strategy.aligned_blocks);
+        VMLOG_DEBUG("            Partial Blocks: %llu blocks\n", block_strategy.partial_blocks);
+        VMLOG_DEBUG("            Tail Bytes: %llu bytes\n", block_strategy.tail_bytes);
+        VMLOG_DEBUG("            Blocks per Iteration: %d blocks\n", block_strategy.blocks_per_iteration);
+        VMLOG_DEBUG("            Prefetch Optimization: %s (distance: %d cache lines)\n", 
               block_strategy.use_prefetch_optimization ? "ENABLED" : "DISABLED", block_strategy.prefetch_distance);
-        IOLog("            Non-Temporal Stores: %s\n", block_strategy.use_non_temporal_stores ? "ENABLED" : "DISABLED");
-        IOLog("            Parallel Processing: %s (%d threads)\n", 
+        VMLOG_DEBUG("            Non-Temporal Stores: %s\n", block_strategy.use_non_temporal_stores ? "ENABLED" : "DISABLED");
+        VMLOG_DEBUG("            Parallel Processing: %s (%d threads)\n", 
               block_strategy.use_parallel_processing ? "ENABLED" : "DISABLED", block_strategy.processing_threads);
-        IOLog("            Block Processing Efficiency: %.1f%%\n", block_strategy.block_processing_efficiency * 100.0f);
+        VMLOG_DEBUG("            Block Processing Efficiency: %.1f%%\n", block_strategy.block_processing_efficiency * 100.0f);
         
         // Phase 3: Advanced SIMD Copy Engine Execution with Real-Time Monitoring
-        IOLog("        Phase 3: Advanced SIMD copy engine execution with real-time monitoring\n");
+        VMLOG_DEBUG("        Phase 3: Advanced SIMD copy engine execution with real-time monitoring\n");
         
         struct SIMDCopyExecution {
             uint64_t execution_start_time;
@@ -5732,10 +5791,10 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         simd_execution.bytes_copied = 0;
         simd_execution.copy_errors_encountered = 0;
         
-        IOLog("          Executing advanced SIMD copy engine...\n");
+        VMLOG_DEBUG("          Executing advanced SIMD copy engine...\n");
         
         // Main SIMD Copy Loop - Process aligned blocks first
-        IOLog("          Processing aligned blocks with optimized SIMD instructions\n");
+        VMLOG_DEBUG("          Processing aligned blocks with optimized SIMD instructions\n");
         
         for (uint64_t block_idx = 0; block_idx < block_strategy.aligned_blocks; block_idx += block_strategy.blocks_per_iteration) {
             uint64_t blocks_in_this_iteration = 
@@ -5800,7 +5859,7 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
                 if ((current_block % 1000) == 999) {
                     float progress_percentage = 
                         ((float)current_block / (float)block_strategy.aligned_blocks) * 100.0f;
-                    IOLog("            Aligned block progress: %.1f%% (%llu/%llu blocks)\n", 
+                    VMLOG_DEBUG("            Aligned block progress: %.1f%% (%llu/%llu blocks)\n", 
                           progress_percentage, current_block + 1, block_strategy.aligned_blocks);
                 }
             }
@@ -5808,7 +5867,7 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         
         // Process partial blocks with alignment correction
         if (block_strategy.partial_blocks > 0) {
-            IOLog("          Processing partial blocks with alignment correction\n");
+            VMLOG_DEBUG("          Processing partial blocks with alignment correction\n");
             
             for (uint64_t partial_idx = 0; partial_idx < block_strategy.partial_blocks; partial_idx++) {
                 // Simulate alignment correction
@@ -5828,7 +5887,7 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         
         // Handle tail bytes (less than one block)
         if (block_strategy.tail_bytes > 0) {
-            IOLog("          Processing tail bytes with scalar operations\n");
+            VMLOG_DEBUG("          Processing tail bytes with scalar operations\n");
             
             // Use scalar copy for remaining bytes
             simd_execution.bytes_copied += block_strategy.tail_bytes;
@@ -5857,24 +5916,24 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         simd_execution.execution_successful = (simd_execution.copy_errors_encountered == 0) && 
                                             (simd_execution.bytes_copied == alignment_analysis.transfer_size_bytes);
         
-        IOLog("          SIMD Copy Engine Execution Results:\n");
-        IOLog("            Execution Time: %llu μs\n", execution_time_microseconds);
-        IOLog("            Blocks Processed: %llu / %llu\n", simd_execution.blocks_processed, 
+        VMLOG_DEBUG("          SIMD Copy Engine Execution Results:\n");
+        VMLOG_DEBUG("            Execution Time: %llu μs\n", execution_time_microseconds);
+        VMLOG_DEBUG("            Blocks Processed: %llu / %llu\n", simd_execution.blocks_processed, 
               block_strategy.aligned_blocks + block_strategy.partial_blocks);
-        IOLog("            Bytes Copied: %llu bytes (%.2f MB)\n", simd_execution.bytes_copied, 
+        VMLOG_DEBUG("            Bytes Copied: %llu bytes (%.2f MB)\n", simd_execution.bytes_copied, 
               (float)simd_execution.bytes_copied / (1024.0f * 1024.0f));
-        IOLog("            SIMD Instructions Executed: %d\n", simd_execution.simd_instructions_executed);
-        IOLog("            Cache Prefetches: %d\n", simd_execution.cache_prefetches_performed);
-        IOLog("            Non-Temporal Stores: %d\n", simd_execution.non_temporal_stores_executed);
-        IOLog("            Alignment Corrections: %d\n", simd_execution.alignment_corrections_applied);
-        IOLog("            Copy Errors: %d\n", simd_execution.copy_errors_encountered);
-        IOLog("            Average Bandwidth: %.1f MB/s\n", simd_execution.average_bandwidth_mbps);
-        IOLog("            Peak Bandwidth: %.1f MB/s\n", simd_execution.instantaneous_bandwidth_mbps);
-        IOLog("            CPU Utilization: %.1f%%\n", simd_execution.cpu_utilization_percentage);
-        IOLog("            Execution Success: %s\n", simd_execution.execution_successful ? "SUCCESS" : "FAILED");
+        VMLOG_DEBUG("            SIMD Instructions Executed: %d\n", simd_execution.simd_instructions_executed);
+        VMLOG_DEBUG("            Cache Prefetches: %d\n", simd_execution.cache_prefetches_performed);
+        VMLOG_DEBUG("            Non-Temporal Stores: %d\n", simd_execution.non_temporal_stores_executed);
+        VMLOG_DEBUG("            Alignment Corrections: %d\n", simd_execution.alignment_corrections_applied);
+        VMLOG_DEBUG("            Copy Errors: %d\n", simd_execution.copy_errors_encountered);
+        VMLOG_DEBUG("            Average Bandwidth: %.1f MB/s\n", simd_execution.average_bandwidth_mbps);
+        VMLOG_DEBUG("            Peak Bandwidth: %.1f MB/s\n", simd_execution.instantaneous_bandwidth_mbps);
+        VMLOG_DEBUG("            CPU Utilization: %.1f%%\n", simd_execution.cpu_utilization_percentage);
+        VMLOG_DEBUG("            Execution Success: %s\n", simd_execution.execution_successful ? "SUCCESS" : "FAILED");
         
         // Phase 4: Post-Copy Validation and Performance Analysis
-        IOLog("        Phase 4: Post-copy validation and comprehensive performance analysis\n");
+        VMLOG_DEBUG("        Phase 4: Post-copy validation and comprehensive performance analysis\n");
         
         struct PostCopyAnalysis {
             bool data_integrity_verified;
@@ -5930,17 +5989,17 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
             simd_execution.execution_successful &&
             (post_analysis.data_integrity_confidence >= 0.95f);
         
-        IOLog("          Post-Copy Analysis Results:\n");
-        IOLog("            Data Integrity Verified: %s\n", post_analysis.data_integrity_verified ? "YES" : "NO");
-        IOLog("            Memory Coherency Maintained: %s\n", post_analysis.memory_coherency_maintained ? "YES" : "NO");
-        IOLog("            Cache State Optimal: %s\n", post_analysis.cache_state_optimal ? "YES" : "NO");
-        IOLog("            Integrity Check Samples: %d\n", post_analysis.integrity_check_samples);
-        IOLog("            Integrity Failures: %d\n", post_analysis.integrity_failures_detected);
-        IOLog("            Integrity Confidence: %.3f (%.1f%%)\n", post_analysis.data_integrity_confidence, 
+        VMLOG_DEBUG("          Post-Copy Analysis Results:\n");
+        VMLOG_DEBUG("            Data Integrity Verified: %s\n", post_analysis.data_integrity_verified ? "YES" : "NO");
+        VMLOG_DEBUG("            Memory Coherency Maintained: %s\n", post_analysis.memory_coherency_maintained ? "YES" : "NO");
+        VMLOG_DEBUG("            Cache State Optimal: %s\n", post_analysis.cache_state_optimal ? "YES" : "NO");
+        VMLOG_DEBUG("            Integrity Check Samples: %d\n", post_analysis.integrity_check_samples);
+        VMLOG_DEBUG("            Integrity Failures: %d\n", post_analysis.integrity_failures_detected);
+        VMLOG_DEBUG("            Integrity Confidence: %.3f (%.1f%%)\n", post_analysis.data_integrity_confidence, 
               post_analysis.data_integrity_confidence * 100.0f);
-        IOLog("            Performance Improvement: %.1fx vs baseline\n", post_analysis.performance_improvement_factor);
-        IOLog("            Efficiency vs Theoretical: %.1f%%\n", post_analysis.efficiency_vs_baseline * 100.0f);
-        IOLog("            Copy Validation: %s\n", post_analysis.copy_validation_passed ? "PASSED" : "FAILED");
+        VMLOG_DEBUG("            Performance Improvement: %.1fx vs baseline\n", post_analysis.performance_improvement_factor);
+        VMLOG_DEBUG("            Efficiency vs Theoretical: %.1f%%\n", post_analysis.efficiency_vs_baseline * 100.0f);
+        VMLOG_DEBUG("            Copy Validation: %s\n", post_analysis.copy_validation_passed ? "PASSED" : "FAILED");
         
         // Update transfer execution results with SIMD copy results
         transfer_execution.bytes_transferred = simd_execution.bytes_copied;
@@ -5949,42 +6008,42 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         transfer_execution.actual_transfer_time_microseconds = execution_time_microseconds;
         
         // Final High-Performance Copy System Summary
-        IOLog("        === High-Performance SIMD Copy System Complete ===\n");
-        IOLog("          Engine Version: 0x%04X (v3.2 Advanced)\n", copy_engine.engine_version);
-        IOLog("          SIMD Instruction Set: %s\n", 
+        VMLOG_DEBUG("        === High-Performance SIMD Copy System Complete ===\n");
+        VMLOG_DEBUG("          Engine Version: 0x%04X (v3.2 Advanced)\n", copy_engine.engine_version);
+        VMLOG_DEBUG("          SIMD Instruction Set: %s\n", 
               copy_engine.supports_avx2 ? "AVX2" : (copy_engine.supports_sse42 ? "SSE4.2" : "Scalar"));
-        IOLog("          Data Transferred: %.2f MB in %llu μs\n", 
+        VMLOG_DEBUG("          Data Transferred: %.2f MB in %llu μs\n", 
               (float)simd_execution.bytes_copied / (1024.0f * 1024.0f), execution_time_microseconds);
-        IOLog("          Average Bandwidth: %.1f MB/s (%.1fx improvement)\n", 
+        VMLOG_DEBUG("          Average Bandwidth: %.1f MB/s (%.1fx improvement)\n", 
               simd_execution.average_bandwidth_mbps, post_analysis.performance_improvement_factor);
-        IOLog("          Alignment Efficiency: %.1f%%\n", alignment_analysis.alignment_efficiency_score * 100.0f);
-        IOLog("          Block Processing Efficiency: %.1f%%\n", block_strategy.block_processing_efficiency * 100.0f);
-        IOLog("          Data Integrity: %.1f%% (%d/%d samples verified)\n", 
+        VMLOG_DEBUG("          Alignment Efficiency: %.1f%%\n", alignment_analysis.alignment_efficiency_score * 100.0f);
+        VMLOG_DEBUG("          Block Processing Efficiency: %.1f%%\n", block_strategy.block_processing_efficiency * 100.0f);
+        VMLOG_DEBUG("          Data Integrity: %.1f%% (%d/%d samples verified)\n", 
               post_analysis.data_integrity_confidence * 100.0f,
               post_analysis.integrity_check_samples - post_analysis.integrity_failures_detected,
               post_analysis.integrity_check_samples);
-        IOLog("          CPU Utilization: %.1f%% (%s processing)\n", simd_execution.cpu_utilization_percentage,
+        VMLOG_DEBUG("          CPU Utilization: %.1f%% (%s processing)\n", simd_execution.cpu_utilization_percentage,
               block_strategy.use_parallel_processing ? "parallel" : "single-threaded");
-        IOLog("          Copy Status: %s\n", post_analysis.copy_validation_passed ? "SUCCESS" : "FAILED");
-        IOLog("        =============================================\n");
+        VMLOG_DEBUG("          Copy Status: %s\n", post_analysis.copy_validation_passed ? "SUCCESS" : "FAILED");
+        VMLOG_DEBUG("        =============================================\n");
         
         if (!post_analysis.copy_validation_passed) {
-            IOLog("      ERROR: High-performance SIMD copy validation failed\n");
+            VMLOG_ERROR("      ERROR: High-performance SIMD copy validation failed\n");
             transfer_execution.bytes_transferred = 0;
             transfer_execution.transfer_chunks_processed = 0;
             transfer_execution.transfer_errors_encountered = 1;
         } else {
-            IOLog("      High-performance SIMD memory copy completed successfully\n");
-            IOLog("        Performance: %.1f MB/s (%.1fx faster than baseline)\n", 
+            VMLOG_DEBUG("      High-performance SIMD memory copy completed successfully\n");
+            VMLOG_DEBUG("        Performance: %.1f MB/s (%.1fx faster than baseline)\n", 
                   simd_execution.average_bandwidth_mbps, post_analysis.performance_improvement_factor);
-            IOLog("        Data Integrity: %.3f confidence with %d verification samples\n", 
+            VMLOG_DEBUG("        Data Integrity: %.3f confidence with %d verification samples\n", 
                   post_analysis.data_integrity_confidence, post_analysis.integrity_check_samples);
         }
         
-        IOLog("      Direct copy completed: %llu bytes transferred\n", transfer_execution.bytes_transferred);
+        VMLOG_DEBUG("      Direct copy completed: %llu bytes transferred\n", transfer_execution.bytes_transferred);
     } else {
         // Simulate staged transfer with row-by-row copy
-        IOLog("      Performing staged transfer with row-by-row processing\n");
+        VMLOG_DEBUG("      Performing staged transfer with row-by-row processing\n");
         
         uint32_t rows_to_process = region->height * region->depth;
         transfer_execution.transfer_chunks_processed = rows_to_process;
@@ -6001,7 +6060,7 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         }
         
         transfer_execution.actual_transfer_time_microseconds = transfer_plan.estimated_transfer_time_microseconds * 1.2f; // 20% overhead
-        IOLog("      Staged transfer completed: %llu bytes in %d chunks\n", 
+        VMLOG_DEBUG("      Staged transfer completed: %llu bytes in %d chunks\n", 
               transfer_execution.bytes_transferred, transfer_execution.transfer_chunks_processed);
     }
     
@@ -6015,28 +6074,28 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
         (transfer_plan.estimated_transfer_time_microseconds > 0 ? 
          (float)transfer_plan.estimated_transfer_time_microseconds / (float)transfer_execution.actual_transfer_time_microseconds : 1.0f) : 0.0f;
     
-    IOLog("    Memory Transfer Execution Results:\n");
-    IOLog("      Transfer Initiated: %s\n", transfer_execution.transfer_initiated ? "YES" : "NO");
-    IOLog("      Transfer Completed: %s\n", transfer_execution.transfer_completed ? "YES" : "NO");
-    IOLog("      Bytes Transferred: %llu / %llu\n", 
+    VMLOG_DEBUG("    Memory Transfer Execution Results:\n");
+    VMLOG_DEBUG("      Transfer Initiated: %s\n", transfer_execution.transfer_initiated ? "YES" : "NO");
+    VMLOG_DEBUG("      Transfer Completed: %s\n", transfer_execution.transfer_completed ? "YES" : "NO");
+    VMLOG_DEBUG("      Bytes Transferred: %llu / %llu\n", 
           transfer_execution.bytes_transferred, transfer_plan.target_region_size);
-    IOLog("      Actual Transfer Time: %llu μs (estimated %llu μs)\n", 
+    VMLOG_DEBUG("      Actual Transfer Time: %llu μs (estimated %llu μs)\n", 
           transfer_execution.actual_transfer_time_microseconds, transfer_plan.estimated_transfer_time_microseconds);
-    IOLog("      Transfer Chunks Processed: %d\n", transfer_execution.transfer_chunks_processed);
-    IOLog("      Transfer Errors Encountered: %d\n", transfer_execution.transfer_errors_encountered);
-    IOLog("      Cache Coherency Maintained: %s\n", transfer_execution.cache_coherency_maintained ? "YES" : "NO");
-    IOLog("      GPU Synchronization Required: %s\n", transfer_execution.gpu_synchronization_required ? "YES" : "NO");
-    IOLog("      Actual Transfer Efficiency: %.1f%%\n", transfer_execution.actual_transfer_efficiency * 100.0f);
+    VMLOG_DEBUG("      Transfer Chunks Processed: %d\n", transfer_execution.transfer_chunks_processed);
+    VMLOG_DEBUG("      Transfer Errors Encountered: %d\n", transfer_execution.transfer_errors_encountered);
+    VMLOG_DEBUG("      Cache Coherency Maintained: %s\n", transfer_execution.cache_coherency_maintained ? "YES" : "NO");
+    VMLOG_DEBUG("      GPU Synchronization Required: %s\n", transfer_execution.gpu_synchronization_required ? "YES" : "NO");
+    VMLOG_DEBUG("      Actual Transfer Efficiency: %.1f%%\n", transfer_execution.actual_transfer_efficiency * 100.0f);
     
     // Check for transfer errors
     if (!transfer_execution.transfer_completed || transfer_execution.transfer_errors_encountered > 0) {
-        IOLog("    ERROR: Memory transfer failed or completed with errors\n");
+        VMLOG_ERROR("    ERROR: Memory transfer failed or completed with errors\n");
         IOLockUnlock(m_texture_lock);
         return kIOReturnIOError;
     }
     
     // Phase 4: Post-Transfer Validation and System State Update
-    IOLog("  Phase 4: Post-transfer validation and comprehensive system state update\n");
+    VMLOG_DEBUG("  Phase 4: Post-transfer validation and comprehensive system state update\n");
     
     struct PostTransferValidation {
         bool data_integrity_verified;
@@ -6070,38 +6129,38 @@ IOReturn CLASS::updateTexture(uint32_t texture_id, uint32_t mip_level,
     post_validation.validation_confidence = (float)post_checks_passed / (float)total_post_checks;
     post_validation.update_successful = (post_validation.validation_confidence >= 0.9f);
     
-    IOLog("    Post-Transfer Validation Results:\n");
-    IOLog("      Data Integrity Verified: %s\n", post_validation.data_integrity_verified ? "YES" : "NO");
-    IOLog("      Texture State Consistent: %s\n", post_validation.texture_state_consistent ? "YES" : "NO");
-    IOLog("      GPU State Synchronized: %s\n", post_validation.gpu_state_synchronized ? "YES" : "NO");
-    IOLog("      Mip Chain Coherent: %s\n", post_validation.mip_chain_coherent ? "YES" : "NO");
-    IOLog("      Memory Layout Valid: %s\n", post_validation.memory_layout_valid ? "YES" : "NO");
-    IOLog("      Texture Revision Number: %d\n", post_validation.texture_revision_number);
-    IOLog("      Update Timestamp: %llu\n", post_validation.update_timestamp);
-    IOLog("      Validation Confidence: %.1f%% (%d/%d checks passed)\n", 
+    VMLOG_DEBUG("    Post-Transfer Validation Results:\n");
+    VMLOG_DEBUG("      Data Integrity Verified: %s\n", post_validation.data_integrity_verified ? "YES" : "NO");
+    VMLOG_DEBUG("      Texture State Consistent: %s\n", post_validation.texture_state_consistent ? "YES" : "NO");
+    VMLOG_DEBUG("      GPU State Synchronized: %s\n", post_validation.gpu_state_synchronized ? "YES" : "NO");
+    VMLOG_DEBUG("      Mip Chain Coherent: %s\n", post_validation.mip_chain_coherent ? "YES" : "NO");
+    VMLOG_DEBUG("      Memory Layout Valid: %s\n", post_validation.memory_layout_valid ? "YES" : "NO");
+    VMLOG_DEBUG("      Texture Revision Number: %d\n", post_validation.texture_revision_number);
+    VMLOG_DEBUG("      Update Timestamp: %llu\n", post_validation.update_timestamp);
+    VMLOG_DEBUG("      Validation Confidence: %.1f%% (%d/%d checks passed)\n", 
           post_validation.validation_confidence * 100.0f, post_checks_passed, total_post_checks);
-    IOLog("      Update Successful: %s\n", post_validation.update_successful ? "YES" : "NO");
+    VMLOG_DEBUG("      Update Successful: %s\n", post_validation.update_successful ? "YES" : "NO");
     
     // Update texture system state (in real implementation, would update ManagedTexture)
     if (post_validation.update_successful && transfer_execution.gpu_synchronization_required) {
-        IOLog("    Updating texture system state and GPU synchronization\n");
+        VMLOG_DEBUG("    Updating texture system state and GPU synchronization\n");
         // Would update ManagedTexture properties, increment revision, update timestamps
         // Would flush GPU caches if necessary
     }
     
-    IOLog("VMTextureManager::updateTexture: ========== Texture Update Complete ==========\n");
-    IOLog("  Texture ID: %d\n", texture_id);
-    IOLog("  Mip Level: %d\n", mip_level);
-    IOLog("  Update Region: %dx%dx%d at (%d,%d,%d)\n", 
+    VMLOG_DEBUG("VMTextureManager::updateTexture: ========== Texture Update Complete ==========\n");
+    VMLOG_DEBUG("  Texture ID: %d\n", texture_id);
+    VMLOG_DEBUG("  Mip Level: %d\n", mip_level);
+    VMLOG_DEBUG("  Update Region: %dx%dx%d at (%d,%d,%d)\n", 
           region->width, region->height, region->depth, region->x, region->y, region->z);
-    IOLog("  Data Transferred: %llu bytes (%.2f MB)\n", 
+    VMLOG_DEBUG("  Data Transferred: %llu bytes (%.2f MB)\n", 
           transfer_execution.bytes_transferred, (float)transfer_execution.bytes_transferred / (1024.0f * 1024.0f));
-    IOLog("  Transfer Time: %llu μs\n", transfer_execution.actual_transfer_time_microseconds);
-    IOLog("  Transfer Efficiency: %.1f%%\n", transfer_execution.actual_transfer_efficiency * 100.0f);
-    IOLog("  Validation Confidence: %.1f%%\n", update_validation.validation_confidence * 100.0f);
-    IOLog("  Post-Validation Confidence: %.1f%%\n", post_validation.validation_confidence * 100.0f);
-    IOLog("  Update Status: %s\n", post_validation.update_successful ? "SUCCESSFUL" : "FAILED");
-    IOLog("====================================================================================\n");
+    VMLOG_DEBUG("  Transfer Time: %llu μs\n", transfer_execution.actual_transfer_time_microseconds);
+    VMLOG_DEBUG("  Transfer Efficiency: %.1f%%\n", transfer_execution.actual_transfer_efficiency * 100.0f);
+    VMLOG_DEBUG("  Validation Confidence: %.1f%%\n", update_validation.validation_confidence * 100.0f);
+    VMLOG_DEBUG("  Post-Validation Confidence: %.1f%%\n", post_validation.validation_confidence * 100.0f);
+    VMLOG_DEBUG("  Update Status: %s\n", post_validation.update_successful ? "SUCCESSFUL" : "FAILED");
+    VMLOG_DEBUG("====================================================================================\n");
     
     IOLockUnlock(m_texture_lock);
     return post_validation.update_successful ? kIOReturnSuccess : kIOReturnIOError;
@@ -6113,23 +6172,23 @@ IOReturn CLASS::readTexture(uint32_t texture_id, uint32_t mip_level,
 {
     // Advanced Texture Reading System - Comprehensive Data Retrieval and Transfer Engine
     if (!output_data) {
-        IOLog("VMTextureManager::readTexture: Invalid output_data parameter (null pointer)\n");
+        VMLOG_WARN("VMTextureManager::readTexture: Invalid output_data parameter (null pointer)\n");
         return kIOReturnBadArgument;
     }
     
     // Acquire texture management lock for thread safety
     if (!m_texture_lock) {
-        IOLog("VMTextureManager::readTexture: Texture lock not initialized\n");
+        VMLOG_DEBUG("VMTextureManager::readTexture: Texture lock not initialized\n");
         return kIOReturnNotReady;
     }
     
     IOLockLock(m_texture_lock);
     
-    IOLog("VMTextureManager::readTexture: Initiating advanced texture reading process (ID: %d, Mip: %d)\n", 
+    VMLOG_DEBUG("VMTextureManager::readTexture: Initiating advanced texture reading process (ID: %d, Mip: %d)\n", 
           texture_id, mip_level);
     
     // Phase 1: Comprehensive Texture Validation and Read Access Verification
-    IOLog("  Phase 1: Comprehensive texture validation and read access verification\n");
+    VMLOG_DEBUG("  Phase 1: Comprehensive texture validation and read access verification\n");
     
     struct ReadValidationContext {
         uint32_t target_texture_id;
@@ -6154,7 +6213,7 @@ IOReturn CLASS::readTexture(uint32_t texture_id, uint32_t mip_level,
     // Validate texture existence and accessibility
     read_validation.target_texture_id = texture_id;
     read_validation.requested_mip_level = mip_level;
-    read_validation.texture_exists = (texture_id > 0) && (texture_id < m_next_texture_id);
+    read_validation.texture_exists = (findTexture(texture_id) != nullptr);
     read_validation.texture_readable = read_validation.texture_exists; // Assume readable if exists
     
     // Validate mip level (basic validation)
@@ -6211,41 +6270,41 @@ IOReturn CLASS::readTexture(uint32_t texture_id, uint32_t mip_level,
     if (!read_validation.requires_format_conversion) validation_checks_passed++;
     read_validation.validation_confidence = (float)validation_checks_passed / (float)total_validation_checks;
     
-    IOLog("    Read Validation Results:\n");
-    IOLog("      Texture ID: %d - %s\n", read_validation.target_texture_id,
+    VMLOG_DEBUG("    Read Validation Results:\n");
+    VMLOG_DEBUG("      Texture ID: %d - %s\n", read_validation.target_texture_id,
           read_validation.texture_exists ? "EXISTS" : "NOT FOUND");
-    IOLog("      Mip Level: %d - %s\n", read_validation.requested_mip_level,
+    VMLOG_DEBUG("      Mip Level: %d - %s\n", read_validation.requested_mip_level,
           read_validation.mip_level_valid ? "VALID" : "INVALID");
-    IOLog("      Texture Readable: %s\n", read_validation.texture_readable ? "YES" : "NO");
-    IOLog("      Texture Dimensions: %dx%dx%d\n", read_validation.texture_width,
+    VMLOG_DEBUG("      Texture Readable: %s\n", read_validation.texture_readable ? "YES" : "NO");
+    VMLOG_DEBUG("      Texture Dimensions: %dx%dx%d\n", read_validation.texture_width,
           read_validation.texture_height, read_validation.texture_depth);
-    IOLog("      Pixel Format: %d (%d bytes/pixel)\n", read_validation.texture_format,
+    VMLOG_DEBUG("      Pixel Format: %d (%d bytes/pixel)\n", read_validation.texture_format,
           read_validation.bytes_per_pixel);
-    IOLog("      Region Valid: %s\n", read_validation.region_valid ? "YES" : "NO");
-    IOLog("      Partial Reads: %s\n", read_validation.supports_partial_reads ? "SUPPORTED" : "FULL ONLY");
-    IOLog("      Texture Data Size: %llu KB\n", read_validation.texture_data_size / 1024);
-    IOLog("      Output Buffer Size: %llu KB\n", read_validation.output_buffer_size / 1024);
-    IOLog("      Buffer Adequate: %s\n", read_validation.output_buffer_valid ? "YES" : "NO");
-    IOLog("      Format Conversion: %s\n", read_validation.requires_format_conversion ? "REQUIRED" : "NOT REQUIRED");
-    IOLog("      Validation Confidence: %.1f%% (%d/%d checks passed)\n", 
+    VMLOG_DEBUG("      Region Valid: %s\n", read_validation.region_valid ? "YES" : "NO");
+    VMLOG_DEBUG("      Partial Reads: %s\n", read_validation.supports_partial_reads ? "SUPPORTED" : "FULL ONLY");
+    VMLOG_DEBUG("      Texture Data Size: %llu KB\n", read_validation.texture_data_size / 1024);
+    VMLOG_DEBUG("      Output Buffer Size: %llu KB\n", read_validation.output_buffer_size / 1024);
+    VMLOG_DEBUG("      Buffer Adequate: %s\n", read_validation.output_buffer_valid ? "YES" : "NO");
+    VMLOG_DEBUG("      Format Conversion: %s\n", read_validation.requires_format_conversion ? "REQUIRED" : "NOT REQUIRED");
+    VMLOG_DEBUG("      Validation Confidence: %.1f%% (%d/%d checks passed)\n", 
           read_validation.validation_confidence * 100.0f, validation_checks_passed, total_validation_checks);
     
     // Validate minimum requirements for read operation
     if (!read_validation.texture_exists) {
-        IOLog("    ERROR: Texture ID %d not found\n", texture_id);
+        VMLOG_ERROR("    ERROR: Texture ID %d not found\n", texture_id);
         IOLockUnlock(m_texture_lock);
         return kIOReturnNotFound;
     }
     
     if (read_validation.validation_confidence < 0.85f) { // Require 85% confidence
-        IOLog("    ERROR: Read validation failed (%.1f%% confidence)\n", 
+        VMLOG_ERROR("    ERROR: Read validation failed (%.1f%% confidence)\n", 
               read_validation.validation_confidence * 100.0f);
         IOLockUnlock(m_texture_lock);
         return kIOReturnBadArgument;
     }
     
     // Phase 2: Advanced Read Strategy Planning and Optimization
-    IOLog("  Phase 2: Advanced read strategy planning and transfer optimization\n");
+    VMLOG_DEBUG("  Phase 2: Advanced read strategy planning and transfer optimization\n");
     
     struct ReadStrategyPlan {
         uint32_t read_strategy_type;
@@ -6296,21 +6355,21 @@ IOReturn CLASS::readTexture(uint32_t texture_id, uint32_t mip_level,
     read_strategy.estimated_read_time_us = 
         (uint32_t)((float)read_strategy.estimated_read_time_us / read_strategy.transfer_efficiency);
     
-    IOLog("    Read Strategy Plan:\n");
-    IOLog("      Strategy Type: %d\n", read_strategy.read_strategy_type);
-    IOLog("      Bytes to Read: %llu KB\n", read_strategy.bytes_to_read / 1024);
-    IOLog("      Block Size: %d bytes\n", read_strategy.read_block_size);
-    IOLog("      Alignment: %d bytes\n", read_strategy.read_alignment);
-    IOLog("      Direct Copy: %s\n", read_strategy.use_direct_copy ? "YES" : "NO");
-    IOLog("      DMA Transfer: %s\n", read_strategy.use_dma_transfer ? "YES" : "NO");
-    IOLog("      Row-by-Row: %s\n", read_strategy.requires_row_by_row ? "YES" : "NO");
-    IOLog("      Async Support: %s\n", read_strategy.supports_async_read ? "YES" : "NO");
-    IOLog("      Transfer Efficiency: %.1f%%\n", read_strategy.transfer_efficiency * 100.0f);
-    IOLog("      Estimated Read Time: %d μs\n", read_strategy.estimated_read_time_us);
-    IOLog("      Cache Optimization: 0x%02llX\n", read_strategy.cache_optimization_flags);
+    VMLOG_DEBUG("    Read Strategy Plan:\n");
+    VMLOG_DEBUG("      Strategy Type: %d\n", read_strategy.read_strategy_type);
+    VMLOG_DEBUG("      Bytes to Read: %llu KB\n", read_strategy.bytes_to_read / 1024);
+    VMLOG_DEBUG("      Block Size: %d bytes\n", read_strategy.read_block_size);
+    VMLOG_DEBUG("      Alignment: %d bytes\n", read_strategy.read_alignment);
+    VMLOG_DEBUG("      Direct Copy: %s\n", read_strategy.use_direct_copy ? "YES" : "NO");
+    VMLOG_DEBUG("      DMA Transfer: %s\n", read_strategy.use_dma_transfer ? "YES" : "NO");
+    VMLOG_DEBUG("      Row-by-Row: %s\n", read_strategy.requires_row_by_row ? "YES" : "NO");
+    VMLOG_DEBUG("      Async Support: %s\n", read_strategy.supports_async_read ? "YES" : "NO");
+    VMLOG_DEBUG("      Transfer Efficiency: %.1f%%\n", read_strategy.transfer_efficiency * 100.0f);
+    VMLOG_DEBUG("      Estimated Read Time: %d μs\n", read_strategy.estimated_read_time_us);
+    VMLOG_DEBUG("      Cache Optimization: 0x%02llX\n", read_strategy.cache_optimization_flags);
     
     // Phase 3: Advanced Data Read Execution and Transfer Management
-    IOLog("  Phase 3: Advanced data read execution and comprehensive transfer management\n");
+    VMLOG_DEBUG("  Phase 3: Advanced data read execution and comprehensive transfer management\n");
     
     struct ReadExecutionContext {
         uint64_t total_bytes_read;
@@ -6331,7 +6390,7 @@ IOReturn CLASS::readTexture(uint32_t texture_id, uint32_t mip_level,
     
     if (read_strategy.use_direct_copy) {
         // Direct copy execution
-        IOLog("    Executing direct copy read operation\n");
+        VMLOG_DEBUG("    Executing direct copy read operation\n");
         read_execution.read_operations_count = 1;
         read_execution.successful_reads = 1;
         read_execution.total_bytes_read = read_strategy.bytes_to_read;
@@ -6342,7 +6401,7 @@ IOReturn CLASS::readTexture(uint32_t texture_id, uint32_t mip_level,
         
     } else if (read_strategy.use_dma_transfer && !read_strategy.requires_row_by_row) {
         // Block DMA transfer execution
-        IOLog("    Executing block DMA transfer read operation\n");
+        VMLOG_DEBUG("    Executing block DMA transfer read operation\n");
         uint32_t blocks = (uint32_t)((read_strategy.bytes_to_read + read_strategy.read_block_size - 1) / 
                                    read_strategy.read_block_size);
         read_execution.read_operations_count = blocks;
@@ -6353,7 +6412,7 @@ IOReturn CLASS::readTexture(uint32_t texture_id, uint32_t mip_level,
         
     } else {
         // Row-by-row staged transfer execution
-        IOLog("    Executing row-by-row staged transfer read operation\n");
+        VMLOG_DEBUG("    Executing row-by-row staged transfer read operation\n");
         uint32_t rows_to_read = read_validation.supports_partial_reads ? 
             (region ? region->height : read_validation.texture_height) : read_validation.texture_height;
         read_execution.read_operations_count = rows_to_read;
@@ -6378,22 +6437,22 @@ IOReturn CLASS::readTexture(uint32_t texture_id, uint32_t mip_level,
             ((float)read_execution.actual_read_time_us * 1024.0f * 1024.0f);
     }
     
-    IOLog("    Read Execution Results:\n");
-    IOLog("      Total Bytes Read: %llu KB\n", read_execution.total_bytes_read / 1024);
-    IOLog("      Bytes Remaining: %llu\n", read_execution.bytes_remaining);
-    IOLog("      Read Operations: %d (Success: %d, Failed: %d)\n", 
+    VMLOG_DEBUG("    Read Execution Results:\n");
+    VMLOG_DEBUG("      Total Bytes Read: %llu KB\n", read_execution.total_bytes_read / 1024);
+    VMLOG_DEBUG("      Bytes Remaining: %llu\n", read_execution.bytes_remaining);
+    VMLOG_DEBUG("      Read Operations: %d (Success: %d, Failed: %d)\n", 
           read_execution.read_operations_count, read_execution.successful_reads, read_execution.failed_reads);
-    IOLog("      Read Time: %llu μs\n", read_execution.actual_read_time_us);
-    IOLog("      Transfer Rate: %.1f MB/s\n", read_execution.actual_transfer_rate_mb_s);
-    IOLog("      Cache Performance: %d hits, %d misses (%.1f%% hit rate)\n", 
+    VMLOG_DEBUG("      Read Time: %llu μs\n", read_execution.actual_read_time_us);
+    VMLOG_DEBUG("      Transfer Rate: %.1f MB/s\n", read_execution.actual_transfer_rate_mb_s);
+    VMLOG_DEBUG("      Cache Performance: %d hits, %d misses (%.1f%% hit rate)\n", 
           read_execution.cache_hits, read_execution.cache_misses,
           read_execution.read_operations_count > 0 ? 
           ((float)read_execution.cache_hits / (float)read_execution.read_operations_count * 100.0f) : 0.0f);
-    IOLog("      Read Completed: %s\n", read_execution.read_completed_successfully ? "YES" : "NO");
-    IOLog("      Data Integrity: %s\n", read_execution.data_integrity_verified ? "VERIFIED" : "UNVERIFIED");
+    VMLOG_DEBUG("      Read Completed: %s\n", read_execution.read_completed_successfully ? "YES" : "NO");
+    VMLOG_DEBUG("      Data Integrity: %s\n", read_execution.data_integrity_verified ? "VERIFIED" : "UNVERIFIED");
     
     // Phase 4: Post-Read Validation and System State Update
-    IOLog("  Phase 4: Post-read validation and comprehensive system state update\n");
+    VMLOG_DEBUG("  Phase 4: Post-read validation and comprehensive system state update\n");
     
     struct PostReadValidation {
         bool output_data_populated;
@@ -6425,41 +6484,41 @@ IOReturn CLASS::readTexture(uint32_t texture_id, uint32_t mip_level,
     float performance_success = post_read.performance_acceptable ? 1.0f : 0.8f;
     post_read.overall_success_rate = (validation_success + execution_success + performance_success) / 3.0f;
     
-    IOLog("    Post-Read Validation Results:\n");
-    IOLog("      Output Data Populated: %s\n", post_read.output_data_populated ? "YES" : "NO");
-    IOLog("      Read Metrics Valid: %s\n", post_read.read_metrics_valid ? "YES" : "NO");
-    IOLog("      Data Checksum: 0x%08X\n", post_read.data_checksum);
-    IOLog("      Performance Acceptable: %s (%.1f MB/s)\n", 
+    VMLOG_DEBUG("    Post-Read Validation Results:\n");
+    VMLOG_DEBUG("      Output Data Populated: %s\n", post_read.output_data_populated ? "YES" : "NO");
+    VMLOG_DEBUG("      Read Metrics Valid: %s\n", post_read.read_metrics_valid ? "YES" : "NO");
+    VMLOG_DEBUG("      Data Checksum: 0x%08X\n", post_read.data_checksum);
+    VMLOG_DEBUG("      Performance Acceptable: %s (%.1f MB/s)\n", 
           post_read.performance_acceptable ? "YES" : "NO", read_execution.actual_transfer_rate_mb_s);
-    IOLog("      System State Consistent: %s\n", post_read.system_state_consistent ? "YES" : "NO");
-    IOLog("      Memory Usage: %llu MB (unchanged)\n", post_read.memory_usage_after_read / (1024 * 1024));
-    IOLog("      Cache Utilization: %d%%\n", post_read.cache_utilization_percent);
-    IOLog("      Cleanup Required: %s\n", post_read.requires_cleanup ? "YES" : "NO");
-    IOLog("      Overall Success Rate: %.1f%%\n", post_read.overall_success_rate * 100.0f);
+    VMLOG_DEBUG("      System State Consistent: %s\n", post_read.system_state_consistent ? "YES" : "NO");
+    VMLOG_DEBUG("      Memory Usage: %llu MB (unchanged)\n", post_read.memory_usage_after_read / (1024 * 1024));
+    VMLOG_DEBUG("      Cache Utilization: %d%%\n", post_read.cache_utilization_percent);
+    VMLOG_DEBUG("      Cleanup Required: %s\n", post_read.requires_cleanup ? "YES" : "NO");
+    VMLOG_DEBUG("      Overall Success Rate: %.1f%%\n", post_read.overall_success_rate * 100.0f);
     
     // Final validation check
     if (!read_execution.read_completed_successfully) {
-        IOLog("    ERROR: Read operation failed to complete successfully\n");
+        VMLOG_ERROR("    ERROR: Read operation failed to complete successfully\n");
         IOLockUnlock(m_texture_lock);
         return kIOReturnIOError;
     }
     
     if (post_read.overall_success_rate < 0.80f) { // Require 80% overall success
-        IOLog("    WARNING: Read operation completed with suboptimal performance (%.1f%% success rate)\n",
+        VMLOG_WARN("    WARNING: Read operation completed with suboptimal performance (%.1f%% success rate)\n",
               post_read.overall_success_rate * 100.0f);
     }
     
-    IOLog("VMTextureManager::readTexture: ========== Texture Read Complete ==========\n");
-    IOLog("  Read Texture ID: %d (Mip Level: %d)\n", texture_id, mip_level);
-    IOLog("  Data Read: %llu KB\n", read_execution.total_bytes_read / 1024);
-    IOLog("  Transfer Rate: %.1f MB/s\n", read_execution.actual_transfer_rate_mb_s);
-    IOLog("  Read Time: %llu μs\n", read_execution.actual_read_time_us);
-    IOLog("  Cache Hit Rate: %.1f%%\n", read_execution.read_operations_count > 0 ? 
+    VMLOG_DEBUG("VMTextureManager::readTexture: ========== Texture Read Complete ==========\n");
+    VMLOG_DEBUG("  Read Texture ID: %d (Mip Level: %d)\n", texture_id, mip_level);
+    VMLOG_DEBUG("  Data Read: %llu KB\n", read_execution.total_bytes_read / 1024);
+    VMLOG_DEBUG("  Transfer Rate: %.1f MB/s\n", read_execution.actual_transfer_rate_mb_s);
+    VMLOG_DEBUG("  Read Time: %llu μs\n", read_execution.actual_read_time_us);
+    VMLOG_DEBUG("  Cache Hit Rate: %.1f%%\n", read_execution.read_operations_count > 0 ? 
           ((float)read_execution.cache_hits / (float)read_execution.read_operations_count * 100.0f) : 0.0f);
-    IOLog("  Region Read: %s\n", read_validation.supports_partial_reads ? "PARTIAL" : "FULL");
-    IOLog("  Data Integrity: %s\n", post_read.output_data_populated ? "VERIFIED" : "FAILED");
-    IOLog("  Overall Performance: %.1f%%\n", post_read.overall_success_rate * 100.0f);
-    IOLog("====================================================================\n");
+    VMLOG_DEBUG("  Region Read: %s\n", read_validation.supports_partial_reads ? "PARTIAL" : "FULL");
+    VMLOG_DEBUG("  Data Integrity: %s\n", post_read.output_data_populated ? "VERIFIED" : "FAILED");
+    VMLOG_DEBUG("  Overall Performance: %.1f%%\n", post_read.overall_success_rate * 100.0f);
+    VMLOG_DEBUG("====================================================================\n");
     
     IOLockUnlock(m_texture_lock);
     return kIOReturnSuccess;
@@ -6471,23 +6530,23 @@ IOReturn CLASS::copyTexture(uint32_t source_texture_id, uint32_t dest_texture_id
 {
     // Advanced Texture Copy System - Comprehensive Inter-Texture Transfer Engine
     if (source_texture_id == dest_texture_id) {
-        IOLog("VMTextureManager::copyTexture: Cannot copy texture to itself (ID: %d)\n", source_texture_id);
+        VMLOG_WARN("VMTextureManager::copyTexture: Cannot copy texture to itself (ID: %d)\n", source_texture_id);
         return kIOReturnBadArgument;
     }
     
     // Acquire texture management lock for thread safety
     if (!m_texture_lock) {
-        IOLog("VMTextureManager::copyTexture: Texture lock not initialized\n");
+        VMLOG_DEBUG("VMTextureManager::copyTexture: Texture lock not initialized\n");
         return kIOReturnNotReady;
     }
     
     IOLockLock(m_texture_lock);
     
-    IOLog("VMTextureManager::copyTexture: Initiating advanced texture copy operation (Source: %d, Dest: %d)\n", 
+    VMLOG_DEBUG("VMTextureManager::copyTexture: Initiating advanced texture copy operation (Source: %d, Dest: %d)\n", 
           source_texture_id, dest_texture_id);
     
     // Phase 1: Comprehensive Source and Destination Texture Validation
-    IOLog("  Phase 1: Comprehensive source and destination texture validation\n");
+    VMLOG_DEBUG("  Phase 1: Comprehensive source and destination texture validation\n");
     
     struct CopyValidationContext {
         uint32_t source_texture_id;
@@ -6516,8 +6575,8 @@ IOReturn CLASS::copyTexture(uint32_t source_texture_id, uint32_t dest_texture_id
     // Validate source and destination texture existence
     copy_validation.source_texture_id = source_texture_id;
     copy_validation.dest_texture_id = dest_texture_id;
-    copy_validation.source_exists = (source_texture_id > 0) && (source_texture_id < m_next_texture_id);
-    copy_validation.dest_exists = (dest_texture_id > 0) && (dest_texture_id < m_next_texture_id);
+    copy_validation.source_exists = (findTexture(source_texture_id) != nullptr);
+    copy_validation.dest_exists = (findTexture(dest_texture_id) != nullptr);
     copy_validation.source_readable = copy_validation.source_exists; // Assume readable if exists
     copy_validation.dest_writable = copy_validation.dest_exists; // Assume writable if exists
     
@@ -6596,50 +6655,50 @@ IOReturn CLASS::copyTexture(uint32_t source_texture_id, uint32_t dest_texture_id
     if (copy_validation.copy_feasible) validation_checks_passed++;
     copy_validation.validation_confidence = (float)validation_checks_passed / (float)total_validation_checks;
     
-    IOLog("    Copy Validation Results:\n");
-    IOLog("      Source Texture ID: %d - %s\n", copy_validation.source_texture_id,
+    VMLOG_DEBUG("    Copy Validation Results:\n");
+    VMLOG_DEBUG("      Source Texture ID: %d - %s\n", copy_validation.source_texture_id,
           copy_validation.source_exists ? "EXISTS" : "NOT FOUND");
-    IOLog("      Dest Texture ID: %d - %s\n", copy_validation.dest_texture_id,
+    VMLOG_DEBUG("      Dest Texture ID: %d - %s\n", copy_validation.dest_texture_id,
           copy_validation.dest_exists ? "EXISTS" : "NOT FOUND");
-    IOLog("      Source Readable: %s\n", copy_validation.source_readable ? "YES" : "NO");
-    IOLog("      Dest Writable: %s\n", copy_validation.dest_writable ? "YES" : "NO");
-    IOLog("      Source Dimensions: %dx%dx%d\n", copy_validation.source_width,
+    VMLOG_DEBUG("      Source Readable: %s\n", copy_validation.source_readable ? "YES" : "NO");
+    VMLOG_DEBUG("      Dest Writable: %s\n", copy_validation.dest_writable ? "YES" : "NO");
+    VMLOG_DEBUG("      Source Dimensions: %dx%dx%d\n", copy_validation.source_width,
           copy_validation.source_height, copy_validation.source_depth);
-    IOLog("      Dest Dimensions: %dx%dx%d\n", copy_validation.dest_width,
+    VMLOG_DEBUG("      Dest Dimensions: %dx%dx%d\n", copy_validation.dest_width,
           copy_validation.dest_height, copy_validation.dest_depth);
-    IOLog("      Source Format: %d (%d bytes/pixel)\n", copy_validation.source_format,
+    VMLOG_DEBUG("      Source Format: %d (%d bytes/pixel)\n", copy_validation.source_format,
           copy_validation.source_bytes_per_pixel);
-    IOLog("      Dest Format: %d (%d bytes/pixel)\n", copy_validation.dest_format,
+    VMLOG_DEBUG("      Dest Format: %d (%d bytes/pixel)\n", copy_validation.dest_format,
           copy_validation.dest_bytes_per_pixel);
-    IOLog("      Regions Compatible: %s\n", copy_validation.regions_compatible ? "YES" : "NO");
-    IOLog("      Formats Compatible: %s\n", copy_validation.formats_compatible ? "YES" : "NO");
-    IOLog("      Copy Feasible: %s\n", copy_validation.copy_feasible ? "YES" : "NO");
-    IOLog("      Copy Region Size: %llu KB\n", copy_validation.copy_region_size_bytes / 1024);
-    IOLog("      Validation Confidence: %.1f%% (%d/%d checks passed)\n", 
+    VMLOG_DEBUG("      Regions Compatible: %s\n", copy_validation.regions_compatible ? "YES" : "NO");
+    VMLOG_DEBUG("      Formats Compatible: %s\n", copy_validation.formats_compatible ? "YES" : "NO");
+    VMLOG_DEBUG("      Copy Feasible: %s\n", copy_validation.copy_feasible ? "YES" : "NO");
+    VMLOG_DEBUG("      Copy Region Size: %llu KB\n", copy_validation.copy_region_size_bytes / 1024);
+    VMLOG_DEBUG("      Validation Confidence: %.1f%% (%d/%d checks passed)\n", 
           copy_validation.validation_confidence * 100.0f, validation_checks_passed, total_validation_checks);
     
     // Validate minimum requirements for copy operation
     if (!copy_validation.source_exists) {
-        IOLog("    ERROR: Source texture ID %d not found\n", source_texture_id);
+        VMLOG_ERROR("    ERROR: Source texture ID %d not found\n", source_texture_id);
         IOLockUnlock(m_texture_lock);
         return kIOReturnNotFound;
     }
     
     if (!copy_validation.dest_exists) {
-        IOLog("    ERROR: Destination texture ID %d not found\n", dest_texture_id);
+        VMLOG_ERROR("    ERROR: Destination texture ID %d not found\n", dest_texture_id);
         IOLockUnlock(m_texture_lock);
         return kIOReturnNotFound;
     }
     
     if (copy_validation.validation_confidence < 0.85f) { // Require 85% confidence
-        IOLog("    ERROR: Copy validation failed (%.1f%% confidence)\n", 
+        VMLOG_ERROR("    ERROR: Copy validation failed (%.1f%% confidence)\n", 
               copy_validation.validation_confidence * 100.0f);
         IOLockUnlock(m_texture_lock);
         return kIOReturnBadArgument;
     }
     
     // Phase 2: Advanced Copy Strategy Planning and Optimization
-    IOLog("  Phase 2: Advanced copy strategy planning and transfer optimization\n");
+    VMLOG_DEBUG("  Phase 2: Advanced copy strategy planning and transfer optimization\n");
     
     struct CopyStrategyPlan {
         uint32_t copy_strategy_type;
@@ -6694,22 +6753,22 @@ IOReturn CLASS::copyTexture(uint32_t source_texture_id, uint32_t dest_texture_id
         (uint32_t)(((copy_strategy.bytes_to_copy * 1000000) / (copy_rate_mb_per_s * 1024 * 1024)) / 
                   copy_strategy.copy_efficiency);
     
-    IOLog("    Copy Strategy Plan:\n");
-    IOLog("      Strategy Type: %d\n", copy_strategy.copy_strategy_type);
-    IOLog("      Bytes to Copy: %llu KB\n", copy_strategy.bytes_to_copy / 1024);
-    IOLog("      Block Size: %d bytes\n", copy_strategy.copy_block_size);
-    IOLog("      Alignment: %d bytes\n", copy_strategy.copy_alignment);
-    IOLog("      Direct Copy: %s\n", copy_strategy.use_direct_copy ? "YES" : "NO");
-    IOLog("      GPU Copy: %s\n", copy_strategy.use_gpu_copy ? "YES" : "NO");
-    IOLog("      Format Conversion: %s\n", copy_strategy.requires_format_conversion ? "REQUIRED" : "NOT REQUIRED");
-    IOLog("      Staging Buffer: %s\n", copy_strategy.requires_staging_buffer ? "REQUIRED" : "NOT REQUIRED");
-    IOLog("      Async Support: %s\n", copy_strategy.supports_async_copy ? "YES" : "NO");
-    IOLog("      Copy Efficiency: %.1f%%\n", copy_strategy.copy_efficiency * 100.0f);
-    IOLog("      Estimated Copy Time: %d μs\n", copy_strategy.estimated_copy_time_us);
-    IOLog("      Memory Overhead: %llu KB\n", copy_strategy.memory_overhead_bytes / 1024);
+    VMLOG_DEBUG("    Copy Strategy Plan:\n");
+    VMLOG_DEBUG("      Strategy Type: %d\n", copy_strategy.copy_strategy_type);
+    VMLOG_DEBUG("      Bytes to Copy: %llu KB\n", copy_strategy.bytes_to_copy / 1024);
+    VMLOG_DEBUG("      Block Size: %d bytes\n", copy_strategy.copy_block_size);
+    VMLOG_DEBUG("      Alignment: %d bytes\n", copy_strategy.copy_alignment);
+    VMLOG_DEBUG("      Direct Copy: %s\n", copy_strategy.use_direct_copy ? "YES" : "NO");
+    VMLOG_DEBUG("      GPU Copy: %s\n", copy_strategy.use_gpu_copy ? "YES" : "NO");
+    VMLOG_DEBUG("      Format Conversion: %s\n", copy_strategy.requires_format_conversion ? "REQUIRED" : "NOT REQUIRED");
+    VMLOG_DEBUG("      Staging Buffer: %s\n", copy_strategy.requires_staging_buffer ? "REQUIRED" : "NOT REQUIRED");
+    VMLOG_DEBUG("      Async Support: %s\n", copy_strategy.supports_async_copy ? "YES" : "NO");
+    VMLOG_DEBUG("      Copy Efficiency: %.1f%%\n", copy_strategy.copy_efficiency * 100.0f);
+    VMLOG_DEBUG("      Estimated Copy Time: %d μs\n", copy_strategy.estimated_copy_time_us);
+    VMLOG_DEBUG("      Memory Overhead: %llu KB\n", copy_strategy.memory_overhead_bytes / 1024);
     
     // Phase 3: Advanced Copy Execution and Transfer Management
-    IOLog("  Phase 3: Advanced copy execution and comprehensive transfer management\n");
+    VMLOG_DEBUG("  Phase 3: Advanced copy execution and comprehensive transfer management\n");
     
     struct CopyExecutionContext {
         uint64_t total_bytes_copied;
@@ -6731,7 +6790,7 @@ IOReturn CLASS::copyTexture(uint32_t source_texture_id, uint32_t dest_texture_id
     
     if (copy_strategy.use_direct_copy) {
         // Direct memory copy execution
-        IOLog("    Executing direct memory copy operation\n");
+        VMLOG_DEBUG("    Executing direct memory copy operation\n");
         copy_execution.copy_operations_count = 1;
         copy_execution.successful_copies = 1;
         copy_execution.total_bytes_copied = copy_strategy.bytes_to_copy;
@@ -6742,7 +6801,7 @@ IOReturn CLASS::copyTexture(uint32_t source_texture_id, uint32_t dest_texture_id
         
     } else if (copy_strategy.use_gpu_copy && !copy_strategy.requires_staging_buffer) {
         // GPU block copy execution
-        IOLog("    Executing GPU block copy operation\n");
+        VMLOG_DEBUG("    Executing GPU block copy operation\n");
         uint32_t blocks = (uint32_t)((copy_strategy.bytes_to_copy + copy_strategy.copy_block_size - 1) / 
                                    copy_strategy.copy_block_size);
         copy_execution.copy_operations_count = blocks;
@@ -6752,11 +6811,11 @@ IOReturn CLASS::copyTexture(uint32_t source_texture_id, uint32_t dest_texture_id
         
     } else {
         // GPU-accelerated copy with staging buffer
-        IOLog("    Executing GPU-accelerated copy with staging buffer\n");
+        VMLOG_DEBUG("    Executing GPU-accelerated copy with staging buffer\n");
         copy_execution.staging_buffer_allocated = true;
         
         // Staging buffer allocation
-        IOLog("      Allocating staging buffer (%llu KB)\n", copy_strategy.memory_overhead_bytes / 1024);
+        VMLOG_DEBUG("      Allocating staging buffer (%llu KB)\n", copy_strategy.memory_overhead_bytes / 1024);
         
         uint32_t staged_blocks = (uint32_t)((copy_strategy.bytes_to_copy + copy_strategy.copy_block_size - 1) / 
                                           copy_strategy.copy_block_size);
@@ -6782,21 +6841,21 @@ IOReturn CLASS::copyTexture(uint32_t source_texture_id, uint32_t dest_texture_id
             ((float)copy_execution.actual_copy_time_us * 1024.0f * 1024.0f);
     }
     
-    IOLog("    Copy Execution Results:\n");
-    IOLog("      Total Bytes Copied: %llu KB\n", copy_execution.total_bytes_copied / 1024);
-    IOLog("      Bytes Remaining: %llu\n", copy_execution.bytes_remaining);
-    IOLog("      Copy Operations: %d (Success: %d, Failed: %d)\n", 
+    VMLOG_DEBUG("    Copy Execution Results:\n");
+    VMLOG_DEBUG("      Total Bytes Copied: %llu KB\n", copy_execution.total_bytes_copied / 1024);
+    VMLOG_DEBUG("      Bytes Remaining: %llu\n", copy_execution.bytes_remaining);
+    VMLOG_DEBUG("      Copy Operations: %d (Success: %d, Failed: %d)\n", 
           copy_execution.copy_operations_count, copy_execution.successful_copies, copy_execution.failed_copies);
-    IOLog("      Copy Time: %llu μs\n", copy_execution.actual_copy_time_us);
-    IOLog("      Copy Rate: %.1f MB/s\n", copy_execution.actual_copy_rate_mb_s);
-    IOLog("      GPU Utilization: %d%%\n", copy_execution.gpu_utilization_percent);
-    IOLog("      Format Conversions: %d\n", copy_execution.format_conversions_performed);
-    IOLog("      Staging Buffer: %s\n", copy_execution.staging_buffer_allocated ? "ALLOCATED" : "NOT USED");
-    IOLog("      Copy Completed: %s\n", copy_execution.copy_completed_successfully ? "YES" : "NO");
-    IOLog("      Data Integrity: %s\n", copy_execution.data_integrity_verified ? "VERIFIED" : "UNVERIFIED");
+    VMLOG_DEBUG("      Copy Time: %llu μs\n", copy_execution.actual_copy_time_us);
+    VMLOG_DEBUG("      Copy Rate: %.1f MB/s\n", copy_execution.actual_copy_rate_mb_s);
+    VMLOG_DEBUG("      GPU Utilization: %d%%\n", copy_execution.gpu_utilization_percent);
+    VMLOG_DEBUG("      Format Conversions: %d\n", copy_execution.format_conversions_performed);
+    VMLOG_DEBUG("      Staging Buffer: %s\n", copy_execution.staging_buffer_allocated ? "ALLOCATED" : "NOT USED");
+    VMLOG_DEBUG("      Copy Completed: %s\n", copy_execution.copy_completed_successfully ? "YES" : "NO");
+    VMLOG_DEBUG("      Data Integrity: %s\n", copy_execution.data_integrity_verified ? "VERIFIED" : "UNVERIFIED");
     
     // Phase 4: Post-Copy Validation and System State Update
-    IOLog("  Phase 4: Post-copy validation and comprehensive system state update\n");
+    VMLOG_DEBUG("  Phase 4: Post-copy validation and comprehensive system state update\n");
     
     struct PostCopyValidation {
         bool destination_updated;
@@ -6829,905 +6888,762 @@ IOReturn CLASS::copyTexture(uint32_t source_texture_id, uint32_t dest_texture_id
     float performance_success = post_copy.performance_acceptable ? 1.0f : 0.8f;
     post_copy.overall_success_rate = (validation_success + execution_success + performance_success) / 3.0f;
     
-    IOLog("    Post-Copy Validation Results:\n");
-    IOLog("      Destination Updated: %s\n", post_copy.destination_updated ? "YES" : "NO");
-    IOLog("      Source Unchanged: %s\n", post_copy.source_unchanged ? "YES" : "NO");
-    IOLog("      Copy Metrics Valid: %s\n", post_copy.copy_metrics_valid ? "YES" : "NO");
-    IOLog("      Data Checksum: 0x%08X\n", post_copy.data_checksum);
-    IOLog("      Performance Acceptable: %s (%.1f MB/s)\n", 
+    VMLOG_DEBUG("    Post-Copy Validation Results:\n");
+    VMLOG_DEBUG("      Destination Updated: %s\n", post_copy.destination_updated ? "YES" : "NO");
+    VMLOG_DEBUG("      Source Unchanged: %s\n", post_copy.source_unchanged ? "YES" : "NO");
+    VMLOG_DEBUG("      Copy Metrics Valid: %s\n", post_copy.copy_metrics_valid ? "YES" : "NO");
+    VMLOG_DEBUG("      Data Checksum: 0x%08X\n", post_copy.data_checksum);
+    VMLOG_DEBUG("      Performance Acceptable: %s (%.1f MB/s)\n", 
           post_copy.performance_acceptable ? "YES" : "NO", copy_execution.actual_copy_rate_mb_s);
-    IOLog("      System State Consistent: %s\n", post_copy.system_state_consistent ? "YES" : "NO");
-    IOLog("      Memory Usage: %llu MB (unchanged)\n", post_copy.memory_usage_after_copy / (1024 * 1024));
-    IOLog("      Cleanup Required: %s\n", post_copy.cleanup_required ? "YES" : "NO");
-    IOLog("      Staging Buffer Released: %s\n", post_copy.staging_buffer_released ? "YES" : "NO");
-    IOLog("      Overall Success Rate: %.1f%%\n", post_copy.overall_success_rate * 100.0f);
+    VMLOG_DEBUG("      System State Consistent: %s\n", post_copy.system_state_consistent ? "YES" : "NO");
+    VMLOG_DEBUG("      Memory Usage: %llu MB (unchanged)\n", post_copy.memory_usage_after_copy / (1024 * 1024));
+    VMLOG_DEBUG("      Cleanup Required: %s\n", post_copy.cleanup_required ? "YES" : "NO");
+    VMLOG_DEBUG("      Staging Buffer Released: %s\n", post_copy.staging_buffer_released ? "YES" : "NO");
+    VMLOG_DEBUG("      Overall Success Rate: %.1f%%\n", post_copy.overall_success_rate * 100.0f);
     
     // Final validation check
     if (!copy_execution.copy_completed_successfully) {
-        IOLog("    ERROR: Copy operation failed to complete successfully\n");
+        VMLOG_ERROR("    ERROR: Copy operation failed to complete successfully\n");
         IOLockUnlock(m_texture_lock);
         return kIOReturnIOError;
     }
     
     if (post_copy.overall_success_rate < 0.80f) { // Require 80% overall success
-        IOLog("    WARNING: Copy operation completed with suboptimal performance (%.1f%% success rate)\n",
+        VMLOG_WARN("    WARNING: Copy operation completed with suboptimal performance (%.1f%% success rate)\n",
               post_copy.overall_success_rate * 100.0f);
     }
     
-    IOLog("VMTextureManager::copyTexture: ========== Texture Copy Complete ==========\n");
-    IOLog("  Source Texture ID: %d\n", source_texture_id);
-    IOLog("  Dest Texture ID: %d\n", dest_texture_id);
-    IOLog("  Data Copied: %llu KB\n", copy_execution.total_bytes_copied / 1024);
-    IOLog("  Copy Rate: %.1f MB/s\n", copy_execution.actual_copy_rate_mb_s);
-    IOLog("  Copy Time: %llu μs\n", copy_execution.actual_copy_time_us);
-    IOLog("  GPU Utilization: %d%%\n", copy_execution.gpu_utilization_percent);
-    IOLog("  Format Conversions: %d\n", copy_execution.format_conversions_performed);
-    IOLog("  Data Integrity: %s\n", post_copy.destination_updated ? "VERIFIED" : "FAILED");
-    IOLog("  Overall Performance: %.1f%%\n", post_copy.overall_success_rate * 100.0f);
-    IOLog("===================================================================\n");
+    VMLOG_DEBUG("VMTextureManager::copyTexture: ========== Texture Copy Complete ==========\n");
+    VMLOG_DEBUG("  Source Texture ID: %d\n", source_texture_id);
+    VMLOG_DEBUG("  Dest Texture ID: %d\n", dest_texture_id);
+    VMLOG_DEBUG("  Data Copied: %llu KB\n", copy_execution.total_bytes_copied / 1024);
+    VMLOG_DEBUG("  Copy Rate: %.1f MB/s\n", copy_execution.actual_copy_rate_mb_s);
+    VMLOG_DEBUG("  Copy Time: %llu μs\n", copy_execution.actual_copy_time_us);
+    VMLOG_DEBUG("  GPU Utilization: %d%%\n", copy_execution.gpu_utilization_percent);
+    VMLOG_DEBUG("  Format Conversions: %d\n", copy_execution.format_conversions_performed);
+    VMLOG_DEBUG("  Data Integrity: %s\n", post_copy.destination_updated ? "VERIFIED" : "FAILED");
+    VMLOG_DEBUG("  Overall Performance: %.1f%%\n", post_copy.overall_success_rate * 100.0f);
+    VMLOG_DEBUG("===================================================================\n");
     
     IOLockUnlock(m_texture_lock);
     return kIOReturnSuccess;
 }
 
+// ---- Mipmap generation -----------------------------------------------------
+//
+// Supported textures are 2D, one of the 8-bit formats VMMipmap filters, with
+// every level packed tightly one after another in `data`, level 0 first.
+
+struct MipmapFormat {
+    uint32_t channels;
+    bool srgb;
+    uint32_t virgl_format;
+};
+
+static bool mipmapFormat(VMTextureFormat format, MipmapFormat* out)
+{
+    switch (format) {
+        case VMTextureFormatR8Unorm:         *out = { 1, false, VIRGL_FORMAT_R8_UNORM }; return true;
+        case VMTextureFormatRG8Unorm:        *out = { 2, false, VIRGL_FORMAT_R8G8_UNORM }; return true;
+        case VMTextureFormatRGBA8Unorm:      *out = { 4, false, VIRGL_FORMAT_R8G8B8A8_UNORM }; return true;
+        case VMTextureFormatRGBA8Unorm_sRGB: *out = { 4, true, VIRGL_FORMAT_R8G8B8A8_SRGB }; return true;
+        case VMTextureFormatBGRA8Unorm:      *out = { 4, false, VIRGL_FORMAT_B8G8R8A8_UNORM }; return true;
+        case VMTextureFormatBGRA8Unorm_sRGB: *out = { 4, true, VIRGL_FORMAT_B8G8R8A8_SRGB }; return true;
+        default: return false;
+    }
+}
+
+static uint32_t mipExtent(uint32_t size, uint32_t level)
+{
+    size >>= level;
+    return size ? size : 1;
+}
+
+static uint32_t mipLastLevel(const VMTextureDescriptor* desc)
+{
+    uint32_t largest = desc->width > desc->height ? desc->width : desc->height;
+    uint32_t chain = 0;
+    while (largest > 1) {
+        largest >>= 1;
+        chain++;
+    }
+    uint32_t last = desc->mipmap_level_count ? desc->mipmap_level_count - 1 : 0;
+    return last < chain ? last : chain;
+}
+
+static uint64_t mipLevelOffset(const VMTextureDescriptor* desc, uint32_t channels, uint32_t level)
+{
+    uint64_t offset = 0;
+    for (uint32_t l = 0; l < level; l++) {
+        offset += (uint64_t)mipExtent(desc->width, l) * mipExtent(desc->height, l) * channels;
+    }
+    return offset;
+}
+
 IOReturn CLASS::generateMipmaps(uint32_t texture_id)
 {
-    // Advanced Mipmap Generation System - Comprehensive Automatic Multi-Level Creation
     if (texture_id == 0) {
-        IOLog("VMTextureManager::generateMipmaps: Invalid texture ID (zero)\n");
+        VMLOG_WARN("VMTextureManager::generateMipmaps: Invalid texture ID (zero)\n");
         return kIOReturnBadArgument;
     }
     
-    // Acquire texture management lock for thread safety
     if (!m_texture_lock) {
-        IOLog("VMTextureManager::generateMipmaps: Texture lock not initialized\n");
+        VMLOG_DEBUG("VMTextureManager::generateMipmaps: Texture lock not initialized\n");
         return kIOReturnNotReady;
     }
     
     IOLockLock(m_texture_lock);
+    ManagedTexture* texture = findTexture(texture_id);
+    IOReturn ret = texture ? generateMipmaps(texture, 0, mipLastLevel(&texture->descriptor))
+                           : kIOReturnNotFound;
+    IOLockUnlock(m_texture_lock);
+    return ret;
+}
+
+IOReturn CLASS::generateMipmaps(uint32_t texture_id, uint32_t base_level, uint32_t max_level)
+{
+    if (texture_id == 0) {
+        VMLOG_WARN("VMTextureManager::generateMipmaps(range): Invalid texture ID (zero)\n");
+        return kIOReturnBadArgument;
+    }
     
-    IOLog("VMTextureManager::generateMipmaps: Initiating automatic mipmap generation (Texture ID: %d)\n", texture_id);
-    
-    // Phase 1: Comprehensive Texture Analysis and Mipmap Feasibility Assessment
-    IOLog("  Phase 1: Comprehensive texture analysis and mipmap feasibility assessment\n");
+    if (base_level >= max_level) {
+        VMLOG_WARN("VMTextureManager::generateMipmaps(range): Invalid level range (base: %d, max: %d)\n", 
+              base_level, max_level);
+        return kIOReturnBadArgument;
+    }
     
-    struct MipmapAnalysisContext {
-        uint32_t target_texture_id;
-        bool texture_exists;
-        bool texture_mipmap_capable;
-        bool texture_power_of_two;
-        uint32_t texture_width;
-        uint32_t texture_height;
-        uint32_t texture_depth;
-        VMTextureFormat texture_format;
-        uint32_t bytes_per_pixel;
-        uint32_t current_mip_levels;
-        uint32_t max_possible_mip_levels;
-        uint32_t optimal_mip_levels;
-        uint64_t base_texture_size_bytes;
-        uint64_t total_mipmap_size_bytes;
-        bool supports_hardware_generation;
-        bool requires_format_support_check;
-        float generation_feasibility_score;
-    } mipmap_analysis = {0};
-    
-    // Validate texture existence and properties
-    mipmap_analysis.target_texture_id = texture_id;
-    mipmap_analysis.texture_exists = (texture_id > 0) && (texture_id < m_next_texture_id);
-    
-    if (mipmap_analysis.texture_exists) {
-        // In real implementation, would extract from ManagedTexture
-        mipmap_analysis.texture_width = 512;
-        mipmap_analysis.texture_height = 512;
-        mipmap_analysis.texture_depth = 1;
-        mipmap_analysis.texture_format = VMTextureFormatRGBA8Unorm;
-        mipmap_analysis.bytes_per_pixel = 4;
-        mipmap_analysis.current_mip_levels = 1; // Assume single level initially
-        
-        // Calculate mipmap properties
-        mipmap_analysis.texture_power_of_two = 
-            ((mipmap_analysis.texture_width & (mipmap_analysis.texture_width - 1)) == 0) &&
-            ((mipmap_analysis.texture_height & (mipmap_analysis.texture_height - 1)) == 0);
-        
-        mipmap_analysis.base_texture_size_bytes = mipmap_analysis.texture_width * 
-                                                mipmap_analysis.texture_height * 
-                                                mipmap_analysis.texture_depth * 
-                                                mipmap_analysis.bytes_per_pixel;
-        
-        // Calculate maximum possible mip levels
-        uint32_t max_dimension = (mipmap_analysis.texture_width > mipmap_analysis.texture_height) ? 
-                               mipmap_analysis.texture_width : mipmap_analysis.texture_height;
-        mipmap_analysis.max_possible_mip_levels = 1;
-        while (max_dimension > 1) {
-            max_dimension >>= 1;
-            mipmap_analysis.max_possible_mip_levels++;
-        }
-        
-        // Determine optimal mip levels (limit to practical maximum)
-        mipmap_analysis.optimal_mip_levels = (mipmap_analysis.max_possible_mip_levels > 12) ? 
-                                           12 : mipmap_analysis.max_possible_mip_levels;
-        
-        // Calculate total mipmap memory requirements
-        mipmap_analysis.total_mipmap_size_bytes = mipmap_analysis.base_texture_size_bytes;
-        uint32_t mip_width = mipmap_analysis.texture_width;
-        uint32_t mip_height = mipmap_analysis.texture_height;
-        for (uint32_t i = 1; i < mipmap_analysis.optimal_mip_levels; i++) {
-            mip_width = (mip_width > 1) ? (mip_width >> 1) : 1;
-            mip_height = (mip_height > 1) ? (mip_height >> 1) : 1;
-            mipmap_analysis.total_mipmap_size_bytes += mip_width * mip_height * 
-                                                     mipmap_analysis.texture_depth * 
-                                                     mipmap_analysis.bytes_per_pixel;
-        }
-        
-        // Assess mipmap generation capabilities
-        mipmap_analysis.texture_mipmap_capable = true; // Most formats support mipmapping
-        mipmap_analysis.supports_hardware_generation = true; // GPU can generate mipmaps
-        mipmap_analysis.requires_format_support_check = (mipmap_analysis.texture_format >= VMTextureFormatRGBA32Float);
-    }
-    
-    // Calculate generation feasibility score
-    uint32_t feasibility_checks_passed = 0;
-    uint32_t total_feasibility_checks = 6;
-    if (mipmap_analysis.texture_exists) feasibility_checks_passed++;
-    if (mipmap_analysis.texture_mipmap_capable) feasibility_checks_passed++;
-    if (mipmap_analysis.texture_power_of_two) feasibility_checks_passed++;
-    if (mipmap_analysis.supports_hardware_generation) feasibility_checks_passed++;
-    if (mipmap_analysis.optimal_mip_levels > 1) feasibility_checks_passed++;
-    if (mipmap_analysis.total_mipmap_size_bytes <= (64 * 1024 * 1024)) feasibility_checks_passed++; // <= 64MB
-    mipmap_analysis.generation_feasibility_score = (float)feasibility_checks_passed / (float)total_feasibility_checks;
-    
-    IOLog("    Mipmap Analysis Results:\n");
-    IOLog("      Texture ID: %d - %s\n", mipmap_analysis.target_texture_id,
-          mipmap_analysis.texture_exists ? "EXISTS" : "NOT FOUND");
-    IOLog("      Texture Dimensions: %dx%dx%d\n", mipmap_analysis.texture_width,
-          mipmap_analysis.texture_height, mipmap_analysis.texture_depth);
-    IOLog("      Pixel Format: %d (%d bytes/pixel)\n", mipmap_analysis.texture_format,
-          mipmap_analysis.bytes_per_pixel);
-    IOLog("      Power of Two: %s\n", mipmap_analysis.texture_power_of_two ? "YES" : "NO");
-    IOLog("      Mipmap Capable: %s\n", mipmap_analysis.texture_mipmap_capable ? "YES" : "NO");
-    IOLog("      Current Mip Levels: %d\n", mipmap_analysis.current_mip_levels);
-    IOLog("      Max Possible Levels: %d\n", mipmap_analysis.max_possible_mip_levels);
-    IOLog("      Optimal Levels: %d\n", mipmap_analysis.optimal_mip_levels);
-    IOLog("      Base Texture Size: %llu KB\n", mipmap_analysis.base_texture_size_bytes / 1024);
-    IOLog("      Total Mipmap Size: %llu KB\n", mipmap_analysis.total_mipmap_size_bytes / 1024);
-    IOLog("      Hardware Generation: %s\n", mipmap_analysis.supports_hardware_generation ? "SUPPORTED" : "NOT SUPPORTED");
-    IOLog("      Generation Feasibility: %.1f%% (%d/%d checks passed)\n", 
-          mipmap_analysis.generation_feasibility_score * 100.0f, feasibility_checks_passed, total_feasibility_checks);
-    
-    // Validate minimum requirements for mipmap generation
-    if (!mipmap_analysis.texture_exists) {
-        IOLog("    ERROR: Texture ID %d not found\n", texture_id);
-        IOLockUnlock(m_texture_lock);
-        return kIOReturnNotFound;
+    if (!m_texture_lock) {
+        VMLOG_DEBUG("VMTextureManager::generateMipmaps(range): Texture lock not initialized\n");
+        return kIOReturnNotReady;
     }
     
-    if (mipmap_analysis.generation_feasibility_score < 0.70f) { // Require 70% feasibility
-        IOLog("    ERROR: Mipmap generation not feasible (%.1f%% score)\n", 
-              mipmap_analysis.generation_feasibility_score * 100.0f);
-        IOLockUnlock(m_texture_lock);
+    IOLockLock(m_texture_lock);
+    ManagedTexture* texture = findTexture(texture_id);
+    IOReturn ret = texture ? generateMipmaps(texture, base_level, max_level) : kIOReturnNotFound;
+    IOLockUnlock(m_texture_lock);
+    return ret;
+}
+
+// Called with m_texture_lock held. max_level is clamped to the texture's
+// chain; a range with nothing below the base succeeds without work.
+IOReturn CLASS::generateMipmaps(ManagedTexture* texture, uint32_t base_level, uint32_t max_level)
+{
+    const VMTextureDescriptor* desc = &texture->descriptor;
+    MipmapFormat format;
+    if (desc->texture_type != VM_TEXTURE_TYPE_2D || desc->array_length > 1 ||
+        !mipmapFormat(desc->pixel_format, &format)) {
+        VMLOG_DEBUG("VMTextureManager::generateMipmaps: texture %u type %u format %u not supported\n",
+              texture->texture_id, desc->texture_type, (uint32_t)desc->pixel_format);
         return kIOReturnUnsupported;
     }
     
-    // Phase 2: Advanced Generation Strategy Planning and Resource Allocation
-    IOLog("  Phase 2: Advanced generation strategy planning and resource allocation\n");
-    
-    struct MipmapGenerationStrategy {
-        uint32_t generation_method;
-        uint32_t levels_to_generate;
-        uint64_t memory_required_bytes;
-        uint32_t generation_passes;
-        bool use_hardware_acceleration;
-        bool requires_temporary_buffers;
-        bool supports_parallel_generation;
-        uint32_t filter_algorithm;
-        uint32_t estimated_generation_time_us;
-        float generation_efficiency;
-        uint64_t temp_memory_overhead_bytes;
-    } generation_strategy = {0};
-    
-    // Determine optimal generation strategy
-    generation_strategy.levels_to_generate = mipmap_analysis.optimal_mip_levels - mipmap_analysis.current_mip_levels;
-    generation_strategy.memory_required_bytes = mipmap_analysis.total_mipmap_size_bytes - mipmap_analysis.base_texture_size_bytes;
-    
-    if (mipmap_analysis.supports_hardware_generation && mipmap_analysis.texture_power_of_two) {
-        generation_strategy.generation_method = 1; // GPU hardware generation
-        generation_strategy.use_hardware_acceleration = true;
-        generation_strategy.requires_temporary_buffers = false;
-        generation_strategy.supports_parallel_generation = true;
-        generation_strategy.filter_algorithm = 1; // Linear filtering
-        generation_strategy.generation_efficiency = 0.95f; // 95% efficiency
-        generation_strategy.generation_passes = 1; // Single pass
-        generation_strategy.temp_memory_overhead_bytes = 0;
-    } else if (mipmap_analysis.supports_hardware_generation) {
-        generation_strategy.generation_method = 2; // GPU compute generation
-        generation_strategy.use_hardware_acceleration = true;
-        generation_strategy.requires_temporary_buffers = true;
-        generation_strategy.supports_parallel_generation = false;
-        generation_strategy.filter_algorithm = 2; // Box filtering
-        generation_strategy.generation_efficiency = 0.85f; // 85% efficiency
-        generation_strategy.generation_passes = generation_strategy.levels_to_generate;
-        generation_strategy.temp_memory_overhead_bytes = mipmap_analysis.base_texture_size_bytes / 2;
-    } else {
-        generation_strategy.generation_method = 3; // CPU software generation
-        generation_strategy.use_hardware_acceleration = false;
-        generation_strategy.requires_temporary_buffers = true;
-        generation_strategy.supports_parallel_generation = false;
-        generation_strategy.filter_algorithm = 3; // Bilinear filtering
-        generation_strategy.generation_efficiency = 0.70f; // 70% efficiency
-        generation_strategy.generation_passes = generation_strategy.levels_to_generate;
-        generation_strategy.temp_memory_overhead_bytes = mipmap_analysis.base_texture_size_bytes;
-    }
-    
-    // Estimate generation time
-    uint64_t processing_rate_pixels_per_s = generation_strategy.use_hardware_acceleration ? 
-        50000000 : 10000000; // 50M vs 10M pixels/sec
-    uint64_t total_pixels_to_process = (mipmap_analysis.total_mipmap_size_bytes - mipmap_analysis.base_texture_size_bytes) / 
-                                     mipmap_analysis.bytes_per_pixel;
-    generation_strategy.estimated_generation_time_us = 
-        (uint32_t)((total_pixels_to_process * 1000000) / processing_rate_pixels_per_s / 
-                  generation_strategy.generation_efficiency);
-    
-    IOLog("    Generation Strategy Plan:\n");
-    IOLog("      Generation Method: %d\n", generation_strategy.generation_method);
-    IOLog("      Levels to Generate: %d\n", generation_strategy.levels_to_generate);
-    IOLog("      Memory Required: %llu KB\n", generation_strategy.memory_required_bytes / 1024);
-    IOLog("      Generation Passes: %d\n", generation_strategy.generation_passes);
-    IOLog("      Hardware Acceleration: %s\n", generation_strategy.use_hardware_acceleration ? "YES" : "NO");
-    IOLog("      Temporary Buffers: %s\n", generation_strategy.requires_temporary_buffers ? "REQUIRED" : "NOT REQUIRED");
-    IOLog("      Parallel Generation: %s\n", generation_strategy.supports_parallel_generation ? "SUPPORTED" : "SEQUENTIAL");
-    IOLog("      Filter Algorithm: %d\n", generation_strategy.filter_algorithm);
-    IOLog("      Generation Efficiency: %.1f%%\n", generation_strategy.generation_efficiency * 100.0f);
-    IOLog("      Estimated Time: %d μs\n", generation_strategy.estimated_generation_time_us);
-    IOLog("      Temp Memory Overhead: %llu KB\n", generation_strategy.temp_memory_overhead_bytes / 1024);
-    
-    // Phase 3: Advanced Mipmap Level Generation and Processing
-    IOLog("  Phase 3: Advanced mipmap level generation and comprehensive processing\n");
-    
-    struct MipmapGenerationExecution {
-        uint32_t levels_generated;
-        uint32_t successful_generations;
-        uint32_t failed_generations;
-        uint64_t total_memory_allocated;
-        uint64_t actual_generation_time_us;
-        bool hardware_acceleration_used;
-        bool temporary_buffers_allocated;
-        uint32_t filter_operations_performed;
-        uint32_t gpu_utilization_percent;
-        bool all_levels_generated_successfully;
-        float actual_generation_efficiency;
-        uint64_t total_pixels_processed;
-    } generation_execution = {0};
-    
-    // Simulate mipmap generation execution
-    uint64_t generation_start_time = 0; // Would use mach_absolute_time() in real implementation
-    
-    if (generation_strategy.generation_method == 1) {
-        // Hardware GPU generation
-        IOLog("    Executing hardware GPU mipmap generation\n");
-        generation_execution.hardware_acceleration_used = true;
-        generation_execution.temporary_buffers_allocated = false;
-        generation_execution.levels_generated = generation_strategy.levels_to_generate;
-        generation_execution.successful_generations = generation_execution.levels_generated;
-        generation_execution.gpu_utilization_percent = 90; // 90% GPU utilization
-        generation_execution.filter_operations_performed = generation_execution.levels_generated;
-        
-        // Single-pass hardware generation
-        IOLog("      Single-pass hardware generation completed\n");
-        
-    } else if (generation_strategy.generation_method == 2) {
-        // GPU compute generation
-        IOLog("    Executing GPU compute mipmap generation\n");
-        generation_execution.hardware_acceleration_used = true;
-        generation_execution.temporary_buffers_allocated = true;
-        generation_execution.gpu_utilization_percent = 75; // 75% GPU utilization
-        
-        // Multi-pass compute generation
-        for (uint32_t level = 1; level < mipmap_analysis.optimal_mip_levels; level++) {
-            IOLog("      Generating mip level %d\n", level);
-            generation_execution.levels_generated++;
-            generation_execution.successful_generations++;
-            generation_execution.filter_operations_performed++;
-        }
-        
-    } else {
-        // CPU software generation
-        IOLog("    Executing CPU software mipmap generation\n");
-        generation_execution.hardware_acceleration_used = false;
-        generation_execution.temporary_buffers_allocated = true;
-        generation_execution.gpu_utilization_percent = 0; // CPU only
-        
-        // Sequential CPU generation
-        for (uint32_t level = 1; level < mipmap_analysis.optimal_mip_levels; level++) {
-            IOLog("      CPU generating mip level %d with bilinear filtering\n", level);
-            generation_execution.levels_generated++;
-            generation_execution.successful_generations++;
-            generation_execution.filter_operations_performed++;
-        }
+    uint32_t last_level = mipLastLevel(desc);
+    if (max_level > last_level) {
+        max_level = last_level;
+    }
+    if (base_level >= max_level) {
+        return kIOReturnSuccess;
+    }
+    if (!texture->data) {
+        return kIOReturnNotReady;
+    }
+    if (texture->data->getLength() < mipLevelOffset(desc, format.channels, last_level + 1)) {
+        VMLOG_WARN("VMTextureManager::generateMipmaps: texture %u data holds %llu bytes, chain needs %llu\n",
+              texture->texture_id, (uint64_t)texture->data->getLength(),
+              mipLevelOffset(desc, format.channels, last_level + 1));
+        return kIOReturnNoSpace;
     }
     
-    // Calculate execution metrics
-    generation_execution.total_memory_allocated = generation_strategy.memory_required_bytes + 
-                                                generation_strategy.temp_memory_overhead_bytes;
-    uint64_t generation_end_time = generation_start_time + generation_strategy.estimated_generation_time_us;
-    generation_execution.actual_generation_time_us = generation_end_time - generation_start_time;
-    generation_execution.all_levels_generated_successfully = 
-        (generation_execution.successful_generations == generation_strategy.levels_to_generate);
-    
-    // Calculate actual efficiency
-    generation_execution.total_pixels_processed = (mipmap_analysis.total_mipmap_size_bytes - mipmap_analysis.base_texture_size_bytes) / 
-                                                mipmap_analysis.bytes_per_pixel;
-    if (generation_execution.actual_generation_time_us > 0) {
-        generation_execution.actual_generation_efficiency = 
-            ((float)generation_execution.total_pixels_processed * 1000000.0f) / 
-            ((float)generation_execution.actual_generation_time_us * 10000000.0f); // vs 10M baseline
-    }
-    
-    IOLog("    Generation Execution Results:\n");
-    IOLog("      Levels Generated: %d\n", generation_execution.levels_generated);
-    IOLog("      Successful Generations: %d\n", generation_execution.successful_generations);
-    IOLog("      Failed Generations: %d\n", generation_execution.failed_generations);
-    IOLog("      Total Memory Allocated: %llu KB\n", generation_execution.total_memory_allocated / 1024);
-    IOLog("      Generation Time: %llu μs\n", generation_execution.actual_generation_time_us);
-    IOLog("      Hardware Acceleration: %s\n", generation_execution.hardware_acceleration_used ? "USED" : "NOT USED");
-    IOLog("      Temporary Buffers: %s\n", generation_execution.temporary_buffers_allocated ? "ALLOCATED" : "NOT USED");
-    IOLog("      Filter Operations: %d\n", generation_execution.filter_operations_performed);
-    IOLog("      GPU Utilization: %d%%\n", generation_execution.gpu_utilization_percent);
-    IOLog("      Total Pixels Processed: %llu\n", generation_execution.total_pixels_processed);
-    IOLog("      All Levels Generated: %s\n", generation_execution.all_levels_generated_successfully ? "YES" : "NO");
-    IOLog("      Actual Generation Efficiency: %.1f%%\n", generation_execution.actual_generation_efficiency * 100.0f);
-    
-    // Phase 4: Post-Generation Validation and System State Update
-    IOLog("  Phase 4: Post-generation validation and comprehensive system state update\n");
-    
-    struct PostGenerationValidation {
-        bool mipmaps_created_successfully;
-        bool texture_mipmap_count_updated;
-        bool memory_usage_updated;
-        uint32_t final_mip_level_count;
-        bool mipmap_data_integrity_verified;
-        bool performance_acceptable;
-        bool system_state_consistent;
-        uint64_t memory_usage_after_generation;
-        bool cleanup_required;
-        bool temporary_buffers_released;
-        float overall_success_rate;
-    } post_generation = {0};
-    
-    // Validate generation success
-    post_generation.mipmaps_created_successfully = generation_execution.all_levels_generated_successfully;
-    post_generation.texture_mipmap_count_updated = post_generation.mipmaps_created_successfully;
-    post_generation.final_mip_level_count = mipmap_analysis.current_mip_levels + generation_execution.successful_generations;
-    post_generation.mipmap_data_integrity_verified = post_generation.mipmaps_created_successfully;
-    post_generation.performance_acceptable = (generation_execution.actual_generation_efficiency >= 0.60f); // >= 60%
-    post_generation.system_state_consistent = true;
-    post_generation.memory_usage_after_generation = m_texture_memory_usage + generation_strategy.memory_required_bytes;
-    post_generation.cleanup_required = generation_execution.temporary_buffers_allocated;
-    post_generation.temporary_buffers_released = post_generation.cleanup_required; // Assume cleanup successful
-    post_generation.memory_usage_updated = true;
+    IOReturn ret;
+    if (m_gpu_device && m_gpu_device->supports3D()) {
+        ret = blitMipmapsOnHost(texture, format.virgl_format, format.channels,
+                                base_level, max_level, last_level);
+        if (ret == kIOReturnSuccess) {
+            texture->has_mipmaps = true;
+            return ret;
+        }
+        VMLOG_WARN("VMTextureManager::generateMipmaps: host blit for texture %u failed (0x%x), filtering on the CPU\n",
+              texture->texture_id, ret);
+    }
     
-    // Update memory tracking if successful
-    if (post_generation.mipmaps_created_successfully) {
-        m_texture_memory_usage += generation_strategy.memory_required_bytes;
+    ret = downsampleMipmapsOnCPU(texture, format.channels, format.srgb, base_level, max_level);
+    if (ret == kIOReturnSuccess) {
+        texture->has_mipmaps = true;
+    }
+    return ret;
+}
+
+// Host copy of the texture with room for the whole chain, backed by `data`
+// and attached to the blit context. `data` stays prepared for as long as the
+// host holds its addresses; attachBacking's own prepare is balanced on return.
+IOReturn CLASS::ensureHostTexture(ManagedTexture* texture, uint32_t virgl_format, uint32_t last_level)
+{
+    if (texture->gpu_resource_id) {
+        return kIOReturnSuccess;
     }
     
-    // Calculate overall success rate
-    float analysis_success = mipmap_analysis.generation_feasibility_score;
-    float execution_success = generation_execution.all_levels_generated_successfully ? 1.0f : 0.0f;
-    float performance_success = post_generation.performance_acceptable ? 1.0f : 0.8f;
-    post_generation.overall_success_rate = (analysis_success + execution_success + performance_success) / 3.0f;
-    
-    IOLog("    Post-Generation Validation Results:\n");
-    IOLog("      Mipmaps Created: %s\n", post_generation.mipmaps_created_successfully ? "YES" : "NO");
-    IOLog("      Mipmap Count Updated: %s\n", post_generation.texture_mipmap_count_updated ? "YES" : "NO");
-    IOLog("      Final Mip Level Count: %d\n", post_generation.final_mip_level_count);
-    IOLog("      Data Integrity Verified: %s\n", post_generation.mipmap_data_integrity_verified ? "YES" : "NO");
-    IOLog("      Performance Acceptable: %s (%.1f%% efficiency)\n", 
-          post_generation.performance_acceptable ? "YES" : "NO", generation_execution.actual_generation_efficiency * 100.0f);
-    IOLog("      System State Consistent: %s\n", post_generation.system_state_consistent ? "YES" : "NO");
-    IOLog("      Memory Usage: %llu MB (+%llu KB)\n", 
-          post_generation.memory_usage_after_generation / (1024 * 1024),
-          generation_strategy.memory_required_bytes / 1024);
-    IOLog("      Cleanup Required: %s\n", post_generation.cleanup_required ? "YES" : "NO");
-    IOLog("      Temporary Buffers Released: %s\n", post_generation.temporary_buffers_released ? "YES" : "NO");
-    IOLog("      Overall Success Rate: %.1f%%\n", post_generation.overall_success_rate * 100.0f);
+    IOReturn ret;
+    if (!m_blit_context_id) {
+        ret = m_gpu_device->createRenderContext(&m_blit_context_id);
+        if (ret != kIOReturnSuccess) {
+            m_blit_context_id = 0;
+            return ret;
+        }
+    }
     
-    // Final validation check
-    if (!generation_execution.all_levels_generated_successfully) {
-        IOLog("    ERROR: Mipmap generation failed to complete successfully\n");
-        IOLockUnlock(m_texture_lock);
-        return kIOReturnIOError;
+    ret = texture->data->prepare(kIODirectionInOut);
+    if (ret != kIOReturnSuccess) {
+        return ret;
     }
     
-    if (post_generation.overall_success_rate < 0.75f) { // Require 75% overall success
-        IOLog("    WARNING: Mipmap generation completed with suboptimal performance (%.1f%% success rate)\n",
-              post_generation.overall_success_rate * 100.0f);
+    const VMTextureDescriptor* desc = &texture->descriptor;
+    uint32_t id = m_gpu_device->allocateUserResourceId();
+    ret = m_gpu_device->createResource3D(id, VIRGL_TARGET_2D, virgl_format,
+                                         VIRGL_BIND_SAMPLER_VIEW | VIRGL_BIND_RENDER_TARGET,
+                                         desc->width, desc->height, 1, last_level);
+    if (ret != kIOReturnSuccess) {
+        texture->data->complete(kIODirectionInOut);
+        return ret;
     }
     
-    IOLog("VMTextureManager::generateMipmaps: ========== Mipmap Generation Complete ==========\n");
-    IOLog("  Texture ID: %d\n", texture_id);
-    IOLog("  Mip Levels Generated: %d\n", generation_execution.successful_generations);
-    IOLog("  Total Mip Levels: %d\n", post_generation.final_mip_level_count);
-    IOLog("  Memory Allocated: %llu KB\n", generation_strategy.memory_required_bytes / 1024);
-    IOLog("  Generation Time: %llu μs\n", generation_execution.actual_generation_time_us);
-    IOLog("  Hardware Accelerated: %s\n", generation_execution.hardware_acceleration_used ? "YES" : "NO");
-    IOLog("  GPU Utilization: %d%%\n", generation_execution.gpu_utilization_percent);
-    IOLog("  Filter Algorithm: %d\n", generation_strategy.filter_algorithm);
-    IOLog("  Generation Efficiency: %.1f%%\n", generation_execution.actual_generation_efficiency * 100.0f);
-    IOLog("  Overall Performance: %.1f%%\n", post_generation.overall_success_rate * 100.0f);
-    IOLog("===============================================================================\n");
+    ret = m_gpu_device->attachBacking(id, texture->data);
+    if (ret == kIOReturnSuccess) {
+        struct virtio_gpu_ctx_resource cmd = {};
+        m_gpu_device->initializeCommandHeader(&cmd.hdr, VIRTIO_GPU_CMD_CTX_ATTACH_RESOURCE,
+                                              m_blit_context_id, false);
+        cmd.resource_id = id;
+        struct virtio_gpu_ctrl_hdr resp = {};
+        ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
+    }
+    if (ret != kIOReturnSuccess) {
+        m_gpu_device->deallocateResource(id);
+        texture->data->complete(kIODirectionInOut);
+        return ret;
+    }
     
-    IOLockUnlock(m_texture_lock);
+    texture->gpu_resource_id = id;
     return kIOReturnSuccess;
 }
 
-IOReturn CLASS::generateMipmaps(uint32_t texture_id, uint32_t base_level, uint32_t max_level)
+void CLASS::releaseHostTexture(ManagedTexture* texture)
 {
-    // Advanced Range-Based Mipmap Generation System - Comprehensive Level-Specific Creation
-    if (texture_id == 0) {
-        IOLog("VMTextureManager::generateMipmaps(range): Invalid texture ID (zero)\n");
-        return kIOReturnBadArgument;
+    if (!texture->gpu_resource_id) {
+        return;
     }
-    
-    if (base_level >= max_level) {
-        IOLog("VMTextureManager::generateMipmaps(range): Invalid level range (base: %d, max: %d)\n", 
-              base_level, max_level);
-        return kIOReturnBadArgument;
+    if (m_gpu_device) {
+        m_gpu_device->deallocateResource(texture->gpu_resource_id);
     }
-    
-    // Acquire texture management lock for thread safety
-    if (!m_texture_lock) {
-        IOLog("VMTextureManager::generateMipmaps(range): Texture lock not initialized\n");
-        return kIOReturnNotReady;
+    if (texture->data) {
+        texture->data->complete(kIODirectionInOut);
     }
-    
-    IOLockLock(m_texture_lock);
-    
-    IOLog("VMTextureManager::generateMipmaps(range): Initiating range-based mipmap generation (Texture ID: %d, Levels: %d-%d)\n", 
-          texture_id, base_level, max_level);
-    
-    // Phase 1: Comprehensive Range Validation and Texture Analysis
-    IOLog("  Phase 1: Comprehensive range validation and texture analysis\n");
-    
-    struct RangeMipmapContext {
-        uint32_t target_texture_id;
-        uint32_t requested_base_level;
-        uint32_t requested_max_level;
-        bool texture_exists;
-        bool range_valid;
-        bool levels_within_texture_bounds;
-        uint32_t texture_width;
-        uint32_t texture_height;
-        uint32_t texture_depth;
-        VMTextureFormat texture_format;
-        uint32_t bytes_per_pixel;
-        uint32_t texture_max_mip_levels;
-        uint32_t levels_to_generate;
-        uint32_t base_level_width;
-        uint32_t base_level_height;
-        uint64_t range_memory_requirements;
-        bool supports_partial_generation;
-        bool requires_base_level_data;
-        float range_validation_score;
-    } range_context = {0};
-    
-    // Validate texture existence and range parameters
-    range_context.target_texture_id = texture_id;
-    range_context.requested_base_level = base_level;
-    range_context.requested_max_level = max_level;
-    range_context.texture_exists = (texture_id > 0) && (texture_id < m_next_texture_id);
-    range_context.range_valid = (base_level < max_level) && (base_level < 16) && (max_level <= 16);
-    
-    if (range_context.texture_exists) {
-        // In real implementation, would extract from ManagedTexture
-        range_context.texture_width = 1024; // Larger texture for range demonstration
-        range_context.texture_height = 1024;
-        range_context.texture_depth = 1;
-        range_context.texture_format = VMTextureFormatRGBA8Unorm;
-        range_context.bytes_per_pixel = 4;
-        
-        // Calculate maximum possible mip levels for this texture
-        uint32_t max_dimension = (range_context.texture_width > range_context.texture_height) ? 
-                               range_context.texture_width : range_context.texture_height;
-        range_context.texture_max_mip_levels = 1;
-        while (max_dimension > 1) {
-            max_dimension >>= 1;
-            range_context.texture_max_mip_levels++;
+    texture->gpu_resource_id = 0;
+}
+
+// Uploads the base level, then one BLIT per level, each reading the level
+// the one before it wrote; the host runs them in order. The generated
+// levels exist only on the host afterwards: the guest copy above the base
+// is not read back.
+IOReturn CLASS::blitMipmapsOnHost(ManagedTexture* texture, uint32_t virgl_format, uint32_t channels,
+                                  uint32_t base_level, uint32_t max_level, uint32_t last_level)
+{
+    IOReturn ret = ensureHostTexture(texture, virgl_format, last_level);
+    if (ret != kIOReturnSuccess) {
+        return ret;
+    }
+    
+    const VMTextureDescriptor* desc = &texture->descriptor;
+    const uint32_t res = texture->gpu_resource_id;
+    ret = m_gpu_device->transferToHost3D(res, base_level, 0, 0, 0,
+                                         mipExtent(desc->width, base_level),
+                                         mipExtent(desc->height, base_level), 1,
+                                         m_blit_context_id,
+                                         mipLevelOffset(desc, channels, base_level));
+    if (ret != kIOReturnSuccess) {
+        return ret;
+    }
+    
+    // Room for a 64K chain in one submission; longer ones go out in batches
+    uint32_t commands[16 * (1 + VIRGL_CMD_BLIT_SIZE)];
+    struct virgl_encoder enc;
+    virgl_encoder_init(&enc, commands, sizeof(commands) / sizeof(commands[0]));
+    for (uint32_t level = base_level + 1; level <= max_level; level++) {
+        const struct virgl_blit_box dst = { res, level, virgl_format, 0, 0, 0,
+                                            mipExtent(desc->width, level), mipExtent(desc->height, level), 1 };
+        const struct virgl_blit_box src = { res, level - 1, virgl_format, 0, 0, 0,
+                                            mipExtent(desc->width, level - 1), mipExtent(desc->height, level - 1), 1 };
+        if (!virgl_encode_blit(&enc, &dst, &src, PIPE_MASK_RGBA, PIPE_TEX_FILTER_LINEAR)) {
+            ret = m_gpu_device->executeCommandBytes(m_blit_context_id, commands, enc.len * sizeof(uint32_t));
+            if (ret != kIOReturnSuccess) {
+                return ret;
+            }
+            virgl_encoder_reset(&enc);
+            virgl_encode_blit(&enc, &dst, &src, PIPE_MASK_RGBA, PIPE_TEX_FILTER_LINEAR);
         }
-        
-        // Validate range against texture capabilities
-        range_context.levels_within_texture_bounds = 
-            (range_context.requested_base_level < range_context.texture_max_mip_levels) &&
-            (range_context.requested_max_level <= range_context.texture_max_mip_levels);
-        
-        // Calculate base level dimensions
-        range_context.base_level_width = range_context.texture_width >> range_context.requested_base_level;
-        range_context.base_level_height = range_context.texture_height >> range_context.requested_base_level;
-        range_context.base_level_width = (range_context.base_level_width > 0) ? range_context.base_level_width : 1;
-        range_context.base_level_height = (range_context.base_level_height > 0) ? range_context.base_level_height : 1;
-        
-        // Calculate levels to generate and memory requirements
-        range_context.levels_to_generate = range_context.requested_max_level - range_context.requested_base_level;
-        range_context.range_memory_requirements = 0;
-        
-        uint32_t mip_width = range_context.base_level_width;
-        uint32_t mip_height = range_context.base_level_height;
-        for (uint32_t level = range_context.requested_base_level + 1; level <= range_context.requested_max_level; level++) {
-            mip_width = (mip_width > 1) ? (mip_width >> 1) : 1;
-            mip_height = (mip_height > 1) ? (mip_height >> 1) : 1;
-            range_context.range_memory_requirements += mip_width * mip_height * 
-                                                     range_context.texture_depth * 
-                                                     range_context.bytes_per_pixel;
+    }
+    return m_gpu_device->executeCommandBytes(m_blit_context_id, commands, enc.len * sizeof(uint32_t));
+}
+
+IOReturn CLASS::downsampleMipmapsOnCPU(ManagedTexture* texture, uint32_t channels, bool srgb,
+                                       uint32_t base_level, uint32_t max_level)
+{
+    IOMemoryMap* map = texture->data->map();
+    if (!map) {
+        return kIOReturnNoMemory;
+    }
+    
+    const VMTextureDescriptor* desc = &texture->descriptor;
+    uint8_t* texels = (uint8_t*)map->getVirtualAddress();
+    IOReturn ret = kIOReturnSuccess;
+    for (uint32_t level = base_level + 1; level <= max_level; level++) {
+        uint32_t sw = mipExtent(desc->width, level - 1), sh = mipExtent(desc->height, level - 1);
+        uint32_t dw = mipExtent(desc->width, level), dh = mipExtent(desc->height, level);
+        VMMipmapImage src = { texels + mipLevelOffset(desc, channels, level - 1), sw * channels, sw, sh };
+        VMMipmapImage dst = { texels + mipLevelOffset(desc, channels, level), dw * channels, dw, dh };
+        if (!VMMipmapDownsample(&dst, &src, channels, srgb)) {
+            ret = kIOReturnInternalError;
+            break;
         }
-        
-        // Additional range-specific checks
-        range_context.supports_partial_generation = true; // Range generation supported
-        range_context.requires_base_level_data = (range_context.requested_base_level > 0); // Need source data
-    }
-    
-    // Calculate range validation score
-    uint32_t range_checks_passed = 0;
-    uint32_t total_range_checks = 7;
-    if (range_context.texture_exists) range_checks_passed++;
-    if (range_context.range_valid) range_checks_passed++;
-    if (range_context.levels_within_texture_bounds) range_checks_passed++;
-    if (range_context.supports_partial_generation) range_checks_passed++;
-    if (range_context.levels_to_generate > 0) range_checks_passed++;
-    if (range_context.range_memory_requirements <= (32 * 1024 * 1024)) range_checks_passed++; // <= 32MB
-    if (range_context.base_level_width > 0 && range_context.base_level_height > 0) range_checks_passed++;
-    range_context.range_validation_score = (float)range_checks_passed / (float)total_range_checks;
-    
-    IOLog("    Range Mipmap Analysis Results:\n");
-    IOLog("      Texture ID: %d - %s\n", range_context.target_texture_id,
-          range_context.texture_exists ? "EXISTS" : "NOT FOUND");
-    IOLog("      Requested Range: Levels %d-%d\n", range_context.requested_base_level, range_context.requested_max_level);
-    IOLog("      Texture Dimensions: %dx%dx%d\n", range_context.texture_width,
-          range_context.texture_height, range_context.texture_depth);
-    IOLog("      Texture Max Mip Levels: %d\n", range_context.texture_max_mip_levels);
-    IOLog("      Range Valid: %s\n", range_context.range_valid ? "YES" : "NO");
-    IOLog("      Levels Within Bounds: %s\n", range_context.levels_within_texture_bounds ? "YES" : "NO");
-    IOLog("      Base Level Dimensions: %dx%d\n", range_context.base_level_width, range_context.base_level_height);
-    IOLog("      Levels to Generate: %d\n", range_context.levels_to_generate);
-    IOLog("      Range Memory Required: %llu KB\n", range_context.range_memory_requirements / 1024);
-    IOLog("      Partial Generation Support: %s\n", range_context.supports_partial_generation ? "YES" : "NO");
-    IOLog("      Requires Base Level Data: %s\n", range_context.requires_base_level_data ? "YES" : "NO");
-    IOLog("      Range Validation Score: %.1f%% (%d/%d checks passed)\n", 
-          range_context.range_validation_score * 100.0f, range_checks_passed, total_range_checks);
-    
-    // Validate minimum requirements for range generation
-    if (!range_context.texture_exists) {
-        IOLog("    ERROR: Texture ID %d not found\n", texture_id);
-        IOLockUnlock(m_texture_lock);
-        return kIOReturnNotFound;
     }
+    map->release();
     
-    if (!range_context.range_valid || !range_context.levels_within_texture_bounds) {
-        IOLog("    ERROR: Invalid mipmap level range\n");
-        IOLockUnlock(m_texture_lock);
+    // A host copy left by an earlier blit still has the old levels
+    for (uint32_t level = base_level + 1; ret == kIOReturnSuccess && texture->gpu_resource_id &&
+                                          level <= max_level; level++) {
+        ret = m_gpu_device->transferToHost3D(texture->gpu_resource_id, level, 0, 0, 0,
+                                             mipExtent(desc->width, level), mipExtent(desc->height, level), 1,
+                                             m_blit_context_id, mipLevelOffset(desc, channels, level));
+    }
+    return ret;
+}
+
+// ---- Format conversion -----------------------------------------------------
+
+// Uncompressed formats VMPixelConvert handles. sRGB variants share the byte
+// layout of their linear counterparts and convert as stored.
+static VMPixelFormat texturePixelFormat(VMTextureFormat format)
+{
+    switch (format) {
+        case VMTextureFormatRGBA8Unorm:
+        case VMTextureFormatRGBA8Unorm_sRGB:    return kVMPixelFormatRGBA8;
+        case VMTextureFormatBGRA8Unorm:
+        case VMTextureFormatBGRA8Unorm_sRGB:    return kVMPixelFormatBGRA8;
+        case VMTextureFormatB5G6R5Unorm:        return kVMPixelFormatB5G6R5;
+        case VMTextureFormatBGR5A1Unorm:        return kVMPixelFormatB5G5R5A1;
+        case VMTextureFormatRGB10A2Unorm:       return kVMPixelFormatR10G10B10A2;
+        default:                                return kVMPixelFormatInvalid;
+    }
+}
+
+IOReturn CLASS::convertTextureFormat(IOMemoryDescriptor* source_data,
+                                     VMTextureFormat source_format,
+                                     VMTextureFormat target_format,
+                                     uint32_t width, uint32_t height,
+                                     IOMemoryDescriptor** converted_data)
+{
+    if (!source_data || !converted_data || width == 0 || height == 0) {
         return kIOReturnBadArgument;
     }
+    *converted_data = nullptr;
     
-    if (range_context.range_validation_score < 0.75f) { // Require 75% validation for range
-        IOLog("    ERROR: Range validation failed (%.1f%% score)\n", 
-              range_context.range_validation_score * 100.0f);
-        IOLockUnlock(m_texture_lock);
+    VMPixelFormat source = texturePixelFormat(source_format);
+    VMPixelFormat target = texturePixelFormat(target_format);
+    if (source == kVMPixelFormatInvalid || target == kVMPixelFormatInvalid) {
+        VMLOG_DEBUG("VMTextureManager::convertTextureFormat: %u -> %u not supported\n",
+              (uint32_t)source_format, (uint32_t)target_format);
         return kIOReturnUnsupported;
     }
     
-    // Phase 2: Advanced Range Generation Strategy and Resource Planning
-    IOLog("  Phase 2: Advanced range generation strategy and resource planning\n");
-    
-    struct RangeGenerationStrategy {
-        uint32_t range_generation_method;
-        uint32_t generation_order;
-        bool requires_level_dependencies;
-        bool supports_parallel_levels;
-        bool uses_incremental_filtering;
-        uint32_t base_data_source_method;
-        uint64_t working_memory_required;
-        uint32_t filter_precision_level;
-        bool requires_intermediate_storage;
-        uint32_t estimated_range_time_us;
-        float range_generation_efficiency;
-        uint64_t memory_optimization_flags;
-    } range_strategy = {0};
-    
-    // Determine optimal range generation strategy
-    if (range_context.levels_to_generate <= 3 && range_context.base_level_width >= 64) {
-        range_strategy.range_generation_method = 1; // Direct cascade generation
-        range_strategy.generation_order = 1; // Sequential order
-        range_strategy.requires_level_dependencies = true; // Each level depends on previous
-        range_strategy.supports_parallel_levels = false;
-        range_strategy.uses_incremental_filtering = true;
-        range_strategy.base_data_source_method = 1; // Use existing level data
-        range_strategy.range_generation_efficiency = 0.90f; // 90% efficiency
-        range_strategy.requires_intermediate_storage = false;
-        range_strategy.filter_precision_level = 2; // High precision
-    } else if (range_context.levels_to_generate <= 6) {
-        range_strategy.range_generation_method = 2; // Batched level generation
-        range_strategy.generation_order = 2; // Batch order
-        range_strategy.requires_level_dependencies = true;
-        range_strategy.supports_parallel_levels = true; // Can parallelize some operations
-        range_strategy.uses_incremental_filtering = false; // Batch filtering
-        range_strategy.base_data_source_method = 2; // Read from texture
-        range_strategy.range_generation_efficiency = 0.85f; // 85% efficiency
-        range_strategy.requires_intermediate_storage = true;
-        range_strategy.filter_precision_level = 2; // High precision
-    } else {
-        range_strategy.range_generation_method = 3; // Staged hierarchical generation
-        range_strategy.generation_order = 3; // Hierarchical order
-        range_strategy.requires_level_dependencies = false; // Independent stages
-        range_strategy.supports_parallel_levels = true;
-        range_strategy.uses_incremental_filtering = false; // Staged filtering
-        range_strategy.base_data_source_method = 3; // Multi-stage sourcing
-        range_strategy.range_generation_efficiency = 0.80f; // 80% efficiency
-        range_strategy.requires_intermediate_storage = true;
-        range_strategy.filter_precision_level = 1; // Standard precision for efficiency
-    }
-    
-    // Calculate memory requirements and timing
-    range_strategy.working_memory_required = range_context.range_memory_requirements;
-    if (range_strategy.requires_intermediate_storage) {
-        range_strategy.working_memory_required += range_context.base_level_width * 
-                                                range_context.base_level_height * 
-                                                range_context.bytes_per_pixel; // Base level buffer
-    }
-    
-    // Estimate generation time for range
-    uint64_t range_processing_rate = 30000000; // 30M pixels/sec for range operations
-    uint64_t total_pixels_in_range = range_context.range_memory_requirements / range_context.bytes_per_pixel;
-    range_strategy.estimated_range_time_us = 
-        (uint32_t)((total_pixels_in_range * 1000000) / range_processing_rate / 
-                  range_strategy.range_generation_efficiency);
-    
-    range_strategy.memory_optimization_flags = 0x02; // Range-specific optimizations
-    
-    IOLog("    Range Generation Strategy:\n");
-    IOLog("      Generation Method: %d\n", range_strategy.range_generation_method);
-    IOLog("      Generation Order: %d\n", range_strategy.generation_order);
-    IOLog("      Level Dependencies: %s\n", range_strategy.requires_level_dependencies ? "REQUIRED" : "INDEPENDENT");
-    IOLog("      Parallel Levels: %s\n", range_strategy.supports_parallel_levels ? "SUPPORTED" : "SEQUENTIAL");
-    IOLog("      Incremental Filtering: %s\n", range_strategy.uses_incremental_filtering ? "YES" : "NO");
-    IOLog("      Base Data Source: %d\n", range_strategy.base_data_source_method);
-    IOLog("      Working Memory: %llu KB\n", range_strategy.working_memory_required / 1024);
-    IOLog("      Filter Precision: %d\n", range_strategy.filter_precision_level);
-    IOLog("      Intermediate Storage: %s\n", range_strategy.requires_intermediate_storage ? "REQUIRED" : "NOT NEEDED");
-    IOLog("      Generation Efficiency: %.1f%%\n", range_strategy.range_generation_efficiency * 100.0f);
-    IOLog("      Estimated Time: %d μs\n", range_strategy.estimated_range_time_us);
-    IOLog("      Memory Optimization: 0x%02llX\n", range_strategy.memory_optimization_flags);
-    
-    // Phase 3: Advanced Range-Based Level Generation Execution
-    IOLog("  Phase 3: Advanced range-based level generation execution\n");
-    
-    struct RangeGenerationExecution {
-        uint32_t levels_processed;
-        uint32_t levels_generated_successfully;
-        uint32_t levels_failed;
-        uint32_t cascade_operations_performed;
-        uint32_t batch_operations_performed;
-        uint64_t intermediate_memory_allocated;
-        uint64_t actual_range_generation_time_us;
-        bool base_level_data_accessed;
-        bool intermediate_buffers_used;
-        uint32_t filtering_operations_count;
-        float level_generation_uniformity;
-        bool all_range_levels_completed;
-        uint64_t total_range_pixels_processed;
-        float actual_range_efficiency;
-    } range_execution = {0};
-    
-    // Simulate range generation execution
-    uint64_t range_start_time = 0; // Would use mach_absolute_time() in real implementation
-    
-    if (range_strategy.range_generation_method == 1) {
-        // Direct cascade generation
-        IOLog("    Executing direct cascade generation\n");
-        range_execution.base_level_data_accessed = true;
-        range_execution.intermediate_buffers_used = false;
-        
-        for (uint32_t level = range_context.requested_base_level + 1; 
-             level <= range_context.requested_max_level; level++) {
-            IOLog("      Cascading level %d from level %d\n", level, level - 1);
-            range_execution.levels_processed++;
-            range_execution.levels_generated_successfully++;
-            range_execution.cascade_operations_performed++;
-            range_execution.filtering_operations_count++;
-        }
-        
-    } else if (range_strategy.range_generation_method == 2) {
-        // Batched level generation
-        IOLog("    Executing batched level generation\n");
-        range_execution.base_level_data_accessed = true;
-        range_execution.intermediate_buffers_used = true;
-        range_execution.intermediate_memory_allocated = range_strategy.working_memory_required;
-        
-        uint32_t batch_size = 3; // Process 3 levels per batch
-        for (uint32_t batch_start = range_context.requested_base_level + 1; 
-             batch_start <= range_context.requested_max_level; 
-             batch_start += batch_size) {
-            uint32_t batch_end = (batch_start + batch_size - 1 > range_context.requested_max_level) ? 
-                                range_context.requested_max_level : batch_start + batch_size - 1;
-            IOLog("      Processing batch: levels %d-%d\n", batch_start, batch_end);
-            
-            for (uint32_t level = batch_start; level <= batch_end; level++) {
-                range_execution.levels_processed++;
-                range_execution.levels_generated_successfully++;
-                range_execution.filtering_operations_count++;
-            }
-            range_execution.batch_operations_performed++;
-        }
-        
-    } else {
-        // Staged hierarchical generation
-        IOLog("    Executing staged hierarchical generation\n");
-        range_execution.base_level_data_accessed = true;
-        range_execution.intermediate_buffers_used = true;
-        range_execution.intermediate_memory_allocated = range_strategy.working_memory_required;
-        
-        // Generate in hierarchical stages
-        uint32_t stage_count = 0;
-        for (uint32_t level = range_context.requested_base_level + 1; 
-             level <= range_context.requested_max_level; level++) {
-            if ((level - range_context.requested_base_level) % 2 == 1) {
-                IOLog("      Stage %d: Generating level %d\n", stage_count++, level);
-            }
-            range_execution.levels_processed++;
-            range_execution.levels_generated_successfully++;
-            range_execution.filtering_operations_count++;
-        }
-        range_execution.batch_operations_performed = stage_count;
+    uint64_t source_size = (uint64_t)width * height * VMPixelFormatBytes(source);
+    uint64_t target_size = (uint64_t)width * height * VMPixelFormatBytes(target);
+    if (source_data->getLength() < source_size || target_size > m_max_texture_memory) {
+        return kIOReturnBadArgument;
     }
     
-    // Calculate execution metrics
-    uint64_t range_end_time = range_start_time + range_strategy.estimated_range_time_us;
-    range_execution.actual_range_generation_time_us = range_end_time - range_start_time;
-    range_execution.all_range_levels_completed = 
-        (range_execution.levels_generated_successfully == range_context.levels_to_generate);
-    
-    // Calculate uniformity and efficiency
-    range_execution.level_generation_uniformity = 
-        (float)range_execution.levels_generated_successfully / (float)range_execution.levels_processed;
-    
-    range_execution.total_range_pixels_processed = range_context.range_memory_requirements / 
-                                                 range_context.bytes_per_pixel;
-    
-    if (range_execution.actual_range_generation_time_us > 0) {
-        range_execution.actual_range_efficiency = 
-            ((float)range_execution.total_range_pixels_processed * 1000000.0f) / 
-            ((float)range_execution.actual_range_generation_time_us * 30000000.0f); // vs 30M baseline
-    }
-    
-    IOLog("    Range Generation Execution Results:\n");
-    IOLog("      Levels Processed: %d\n", range_execution.levels_processed);
-    IOLog("      Levels Generated Successfully: %d\n", range_execution.levels_generated_successfully);
-    IOLog("      Levels Failed: %d\n", range_execution.levels_failed);
-    IOLog("      Cascade Operations: %d\n", range_execution.cascade_operations_performed);
-    IOLog("      Batch Operations: %d\n", range_execution.batch_operations_performed);
-    IOLog("      Intermediate Memory: %llu KB\n", range_execution.intermediate_memory_allocated / 1024);
-    IOLog("      Generation Time: %llu μs\n", range_execution.actual_range_generation_time_us);
-    IOLog("      Base Level Data Accessed: %s\n", range_execution.base_level_data_accessed ? "YES" : "NO");
-    IOLog("      Intermediate Buffers: %s\n", range_execution.intermediate_buffers_used ? "USED" : "NOT USED");
-    IOLog("      Filtering Operations: %d\n", range_execution.filtering_operations_count);
-    IOLog("      Level Generation Uniformity: %.1f%%\n", range_execution.level_generation_uniformity * 100.0f);
-    IOLog("      All Range Levels Completed: %s\n", range_execution.all_range_levels_completed ? "YES" : "NO");
-    IOLog("      Range Pixels Processed: %llu\n", range_execution.total_range_pixels_processed);
-    IOLog("      Actual Range Efficiency: %.1f%%\n", range_execution.actual_range_efficiency * 100.0f);
-    
-    // Phase 4: Range Generation Validation and Memory Management
-    IOLog("  Phase 4: Range generation validation and memory management\n");
-    
-    struct RangeValidationResults {
-        bool range_generation_successful;
-        bool level_consistency_verified;
-        bool memory_tracking_updated;
-        uint32_t final_texture_mip_count;
-        bool intermediate_buffers_released;
-        bool range_data_integrity_verified;
-        uint64_t memory_usage_delta;
-        bool performance_targets_met;
-        bool system_consistency_maintained;
-        float overall_range_success_rate;
-        uint32_t quality_validation_score;
-    } range_validation = {0};
-    
-    // Validate range generation results
-    range_validation.range_generation_successful = range_execution.all_range_levels_completed;
-    range_validation.level_consistency_verified = (range_execution.level_generation_uniformity >= 0.95f);
-    range_validation.range_data_integrity_verified = range_validation.range_generation_successful;
-    range_validation.performance_targets_met = (range_execution.actual_range_efficiency >= 0.65f); // >= 65%
-    range_validation.system_consistency_maintained = true;
-    range_validation.intermediate_buffers_released = range_execution.intermediate_buffers_used; // Assume cleanup
-    range_validation.memory_usage_delta = range_context.range_memory_requirements;
-    range_validation.memory_tracking_updated = range_validation.range_generation_successful;
-    
-    // Update texture mip count
-    if (range_validation.range_generation_successful) {
-        range_validation.final_texture_mip_count = range_context.requested_max_level + 1;
-        m_texture_memory_usage += range_validation.memory_usage_delta;
-    }
-    
-    // Calculate quality validation score (advanced metric for range generation)
-    range_validation.quality_validation_score = 0;
-    if (range_execution.level_generation_uniformity >= 0.90f) range_validation.quality_validation_score += 25;
-    if (range_execution.actual_range_efficiency >= 0.70f) range_validation.quality_validation_score += 25;
-    if (range_execution.filtering_operations_count == range_context.levels_to_generate) range_validation.quality_validation_score += 25;
-    if (range_validation.intermediate_buffers_released) range_validation.quality_validation_score += 25;
-    
-    // Calculate overall success rate
-    float validation_success = range_context.range_validation_score;
-    float execution_success = range_execution.all_range_levels_completed ? 1.0f : 0.0f;
-    float performance_success = range_validation.performance_targets_met ? 1.0f : 0.8f;
-    range_validation.overall_range_success_rate = (validation_success + execution_success + performance_success) / 3.0f;
-    
-    IOLog("    Range Validation Results:\n");
-    IOLog("      Range Generation Successful: %s\n", range_validation.range_generation_successful ? "YES" : "NO");
-    IOLog("      Level Consistency Verified: %s\n", range_validation.level_consistency_verified ? "YES" : "NO");
-    IOLog("      Memory Tracking Updated: %s\n", range_validation.memory_tracking_updated ? "YES" : "NO");
-    IOLog("      Final Texture Mip Count: %d\n", range_validation.final_texture_mip_count);
-    IOLog("      Intermediate Buffers Released: %s\n", range_validation.intermediate_buffers_released ? "YES" : "NO");
-    IOLog("      Range Data Integrity: %s\n", range_validation.range_data_integrity_verified ? "VERIFIED" : "FAILED");
-    IOLog("      Memory Usage Delta: +%llu KB\n", range_validation.memory_usage_delta / 1024);
-    IOLog("      Performance Targets Met: %s (%.1f%% efficiency)\n", 
-          range_validation.performance_targets_met ? "YES" : "NO", range_execution.actual_range_efficiency * 100.0f);
-    IOLog("      System Consistency: %s\n", range_validation.system_consistency_maintained ? "MAINTAINED" : "COMPROMISED");
-    IOLog("      Quality Validation Score: %d/100\n", range_validation.quality_validation_score);
-    IOLog("      Overall Range Success Rate: %.1f%%\n", range_validation.overall_range_success_rate * 100.0f);
-    
-    // Final validation check
-    if (!range_execution.all_range_levels_completed) {
-        IOLog("    ERROR: Range generation failed to complete successfully\n");
-        IOLockUnlock(m_texture_lock);
-        return kIOReturnIOError;
+    IOBufferMemoryDescriptor* buffer = IOBufferMemoryDescriptor::withCapacity(target_size, kIODirectionInOut);
+    if (!buffer) {
+        return kIOReturnNoMemory;
     }
+    buffer->setLength(target_size);
     
-    if (range_validation.overall_range_success_rate < 0.75f) { // Require 75% success for range
-        IOLog("    WARNING: Range generation completed with suboptimal performance (%.1f%% success rate)\n",
-              range_validation.overall_range_success_rate * 100.0f);
+    IOMemoryMap* map = source_data->map();
+    if (!map) {
+        buffer->release();
+        return kIOReturnNoMemory;
     }
     
-    IOLog("VMTextureManager::generateMipmaps(range): ========== Range Mipmap Generation Complete ==========\n");
-    IOLog("  Texture ID: %d\n", texture_id);
-    IOLog("  Level Range: %d-%d (%d levels generated)\n", base_level, max_level, range_context.levels_to_generate);
-    IOLog("  Generation Method: %d\n", range_strategy.range_generation_method);
-    IOLog("  Memory Allocated: %llu KB\n", range_context.range_memory_requirements / 1024);
-    IOLog("  Generation Time: %llu μs\n", range_execution.actual_range_generation_time_us);
-    IOLog("  Filter Operations: %d\n", range_execution.filtering_operations_count);
-    IOLog("  Level Uniformity: %.1f%%\n", range_execution.level_generation_uniformity * 100.0f);
-    IOLog("  Range Efficiency: %.1f%%\n", range_execution.actual_range_efficiency * 100.0f);
-    IOLog("  Quality Score: %d/100\n", range_validation.quality_validation_score);
-    IOLog("  Overall Performance: %.1f%%\n", range_validation.overall_range_success_rate * 100.0f);
-    IOLog("====================================================================================\n");
+    VMPixelImage src = { (uint8_t*)map->getVirtualAddress(), width * VMPixelFormatBytes(source), source };
+    VMPixelImage dst = { (uint8_t*)buffer->getBytesNoCopy(), width * VMPixelFormatBytes(target), target };
+    bool converted = VMPixelConvert(&dst, &src, width, height, 0);
+    map->release();
     
+    if (!converted) {
+        buffer->release();
+        return kIOReturnInternalError;
+    }
+    *converted_data = buffer;
+    return kIOReturnSuccess;
+}
+
+// ---- Block compression -----------------------------------------------------
+//
+// BC1-BC5 textures are 2D with every level packed tightly after the one
+// before it, like the mipmapped formats above. Compression reads RGBA8 or
+// BGRA8 levels; expansion writes RGBA8, keeping sRGB for BC1-BC3. BC4 and
+// BC5 expand to R,0,0,1 and R,G,0,1, which is how the host samples them.
+
+struct BlockTextureFormat {
+    VMBlockFormat block;
+    bool srgb;
+    uint32_t virgl_format;
+};
+
+static bool blockTextureFormat(VMTextureFormat format, BlockTextureFormat* out)
+{
+    switch (format) {
+        case VMTextureFormatBC1_RGBA:       *out = { kVMBlockFormatBC1, false, VIRGL_FORMAT_DXT1_RGBA }; return true;
+        case VMTextureFormatBC1_RGBA_sRGB:  *out = { kVMBlockFormatBC1, true, VIRGL_FORMAT_DXT1_SRGBA }; return true;
+        case VMTextureFormatBC2_RGBA:       *out = { kVMBlockFormatBC2, false, VIRGL_FORMAT_DXT3_RGBA }; return true;
+        case VMTextureFormatBC2_RGBA_sRGB:  *out = { kVMBlockFormatBC2, true, VIRGL_FORMAT_DXT3_SRGBA }; return true;
+        case VMTextureFormatBC3_RGBA:       *out = { kVMBlockFormatBC3, false, VIRGL_FORMAT_DXT5_RGBA }; return true;
+        case VMTextureFormatBC3_RGBA_sRGB:  *out = { kVMBlockFormatBC3, true, VIRGL_FORMAT_DXT5_SRGBA }; return true;
+        case VMTextureFormatBC4_RUnorm:     *out = { kVMBlockFormatBC4, false, VIRGL_FORMAT_RGTC1_UNORM }; return true;
+        case VMTextureFormatBC5_RGUnorm:    *out = { kVMBlockFormatBC5, false, VIRGL_FORMAT_RGTC2_UNORM }; return true;
+        default: return false;
+    }
+}
+
+static uint32_t blockTextureVirglFormat(VMTextureFormat format)
+{
+    BlockTextureFormat block;
+    return blockTextureFormat(format, &block) ? block.virgl_format : 0;
+}
+
+static VMBlockFormat compressionBlockFormat(VMTextureCompression compression)
+{
+    switch (compression) {
+        case VM_TEXTURE_COMPRESSION_DXT1:   return kVMBlockFormatBC1;
+        case VM_TEXTURE_COMPRESSION_DXT3:   return kVMBlockFormatBC2;
+        case VM_TEXTURE_COMPRESSION_DXT5:   return kVMBlockFormatBC3;
+        case VM_TEXTURE_COMPRESSION_BC4:    return kVMBlockFormatBC4;
+        case VM_TEXTURE_COMPRESSION_BC5:    return kVMBlockFormatBC5;
+        default:                            return kVMBlockFormatInvalid;
+    }
+}
+
+static VMTextureFormat compressedTextureFormat(VMBlockFormat block, bool srgb)
+{
+    switch (block) {
+        case kVMBlockFormatBC1: return srgb ? VMTextureFormatBC1_RGBA_sRGB : VMTextureFormatBC1_RGBA;
+        case kVMBlockFormatBC2: return srgb ? VMTextureFormatBC2_RGBA_sRGB : VMTextureFormatBC2_RGBA;
+        case kVMBlockFormatBC3: return srgb ? VMTextureFormatBC3_RGBA_sRGB : VMTextureFormatBC3_RGBA;
+        case kVMBlockFormatBC4: return VMTextureFormatBC4_RUnorm;
+        default:                return VMTextureFormatBC5_RGUnorm;
+    }
+}
+
+static uint64_t blockLevelOffset(const VMTextureDescriptor* desc, VMBlockFormat block, uint32_t level)
+{
+    uint64_t offset = 0;
+    for (uint32_t l = 0; l < level; l++) {
+        offset += VMBlockImageBytes(block, mipExtent(desc->width, l), mipExtent(desc->height, l));
+    }
+    return offset;
+}
+
+// Levels of the chain that `length` bytes hold completely, counted in
+// 4-byte pixels when block is kVMBlockFormatInvalid
+static uint32_t levelsHeld(const VMTextureDescriptor* desc, uint64_t length, VMBlockFormat block)
+{
+    uint32_t levels = 0;
+    uint32_t last_level = mipLastLevel(desc);
+    while (levels <= last_level) {
+        uint64_t end = block == kVMBlockFormatInvalid ? mipLevelOffset(desc, 4, levels + 1)
+                                                      : blockLevelOffset(desc, block, levels + 1);
+        if (end > length) {
+            break;
+        }
+        levels++;
+    }
+    return levels;
+}
+
+IOReturn CLASS::compressTexture(uint32_t texture_id, VMTextureCompression compression, uint32_t quality)
+{
+    if (texture_id == 0) {
+        VMLOG_WARN("VMTextureManager::compressTexture: Invalid texture ID (zero)\n");
+        return kIOReturnBadArgument;
+    }
+
+    if (!m_texture_lock) {
+        VMLOG_DEBUG("VMTextureManager::compressTexture: Texture lock not initialized\n");
+        return kIOReturnNotReady;
+    }
+
+    IOLockLock(m_texture_lock);
+    ManagedTexture* texture = findTexture(texture_id);
+    IOReturn ret = texture ? compressTexture(texture, compression, quality) : kIOReturnNotFound;
     IOLockUnlock(m_texture_lock);
+    return ret;
+}
+
+// Called with m_texture_lock held. The host copy, if any, is dropped with
+// the old data; the next mip blit recreates it in the new format.
+IOReturn CLASS::compressTexture(ManagedTexture* texture, VMTextureCompression compression, uint32_t quality)
+{
+    VMTextureDescriptor* desc = &texture->descriptor;
+    VMBlockFormat block = compressionBlockFormat(compression);
+    VMPixelFormat source = texturePixelFormat(desc->pixel_format);
+    if (block == kVMBlockFormatInvalid || texture->is_compressed ||
+        desc->texture_type != VM_TEXTURE_TYPE_2D || desc->array_length > 1 ||
+        (source != kVMPixelFormatRGBA8 && source != kVMPixelFormatBGRA8)) {
+        VMLOG_DEBUG("VMTextureManager::compressTexture: texture %u format %u to compression %u not supported\n",
+              texture->texture_id, (uint32_t)desc->pixel_format, (uint32_t)compression);
+        return kIOReturnUnsupported;
+    }
+    if (!texture->data) {
+        return kIOReturnNotReady;
+    }
+
+    uint32_t levels = levelsHeld(desc, texture->data->getLength(), kVMBlockFormatInvalid);
+    if (levels == 0) {
+        return kIOReturnNoSpace;
+    }
+    uint64_t size = blockLevelOffset(desc, block, levels);
+    IOBufferMemoryDescriptor* buffer = IOBufferMemoryDescriptor::withCapacity(size, kIODirectionInOut);
+    if (!buffer) {
+        return kIOReturnNoMemory;
+    }
+    buffer->setLength(size);
+
+    IOMemoryMap* map = texture->data->map();
+    if (!map) {
+        buffer->release();
+        return kIOReturnNoMemory;
+    }
+
+    const uint8_t* texels = (const uint8_t*)map->getVirtualAddress();
+    uint8_t* blocks = (uint8_t*)buffer->getBytesNoCopy();
+    VMBlockQuality level_quality = VMBlockQualityFromPercent(quality);
+    bool compressed = true;
+    for (uint32_t level = 0; compressed && level < levels; level++) {
+        uint32_t w = mipExtent(desc->width, level), h = mipExtent(desc->height, level);
+        VMPixelImage src = { (uint8_t*)texels + mipLevelOffset(desc, 4, level), w * 4, source };
+        VMBlockImage dst = { blocks + blockLevelOffset(desc, block, level),
+                             ((w + 3) / 4) * VMBlockFormatBytes(block), block };
+        compressed = VMBlockCompress(&dst, &src, w, h, level_quality);
+    }
+    map->release();
+    if (!compressed) {
+        buffer->release();
+        return kIOReturnInternalError;
+    }
+
+    releaseHostTexture(texture);
+    texture->data->release();
+    texture->data = buffer;
+    m_texture_memory_usage = m_texture_memory_usage - texture->data_size + size;
+    texture->data_size = (uint32_t)size;
+
+    bool srgb = desc->pixel_format == VMTextureFormatRGBA8Unorm_sRGB ||
+                desc->pixel_format == VMTextureFormatBGRA8Unorm_sRGB;
+    desc->pixel_format = compressedTextureFormat(block, srgb);
+    desc->mipmap_level_count = levels;
+    texture->has_mipmaps = levels > 1;
+    texture->is_compressed = true;
     return kIOReturnSuccess;
 }
 
+// Called with m_texture_lock held. Levels the guest copy lacks are left
+// zeroed for generateMipmaps to fill. Memory accounting is the caller's.
+IOReturn CLASS::expandBlockTexture(ManagedTexture* texture)
+{
+    VMTextureDescriptor* desc = &texture->descriptor;
+    BlockTextureFormat format;
+    if (desc->texture_type != VM_TEXTURE_TYPE_2D || desc->array_length > 1 ||
+        !blockTextureFormat(desc->pixel_format, &format)) {
+        VMLOG_DEBUG("VMTextureManager::expandBlockTexture: texture %u type %u format %u not supported\n",
+              texture->texture_id, desc->texture_type, (uint32_t)desc->pixel_format);
+        return kIOReturnUnsupported;
+    }
+    if (!texture->data) {
+        return kIOReturnNotReady;
+    }
+
+    uint32_t levels = levelsHeld(desc, texture->data->getLength(), format.block);
+    if (levels == 0) {
+        return kIOReturnNoSpace;
+    }
+    uint64_t size = mipLevelOffset(desc, 4, mipLastLevel(desc) + 1);
+    if (size > m_max_texture_memory || size > UINT32_MAX) {
+        return kIOReturnNoSpace;
+    }
+    IOBufferMemoryDescriptor* buffer = IOBufferMemoryDescriptor::withCapacity(size, kIODirectionInOut);
+    if (!buffer) {
+        return kIOReturnNoMemory;
+    }
+    buffer->setLength(size);
+
+    IOMemoryMap* map = texture->data->map();
+    if (!map) {
+        buffer->release();
+        return kIOReturnNoMemory;
+    }
+
+    const uint8_t* blocks = (const uint8_t*)map->getVirtualAddress();
+    uint8_t* texels = (uint8_t*)buffer->getBytesNoCopy();
+    bzero(texels, size);
+    bool expanded = true;
+    for (uint32_t level = 0; expanded && level < levels; level++) {
+        uint32_t w = mipExtent(desc->width, level), h = mipExtent(desc->height, level);
+        VMBlockImage src = { (uint8_t*)blocks + blockLevelOffset(desc, format.block, level),
+                             ((w + 3) / 4) * VMBlockFormatBytes(format.block), format.block };
+        VMPixelImage dst = { texels + mipLevelOffset(desc, 4, level), w * 4, kVMPixelFormatRGBA8 };
+        expanded = VMBlockDecompress(&dst, &src, w, h);
+    }
+    map->release();
+    if (!expanded) {
+        buffer->release();
+        return kIOReturnInternalError;
+    }
+
+    releaseHostTexture(texture);
+    texture->data->release();
+    texture->data = buffer;
+    texture->data_size = (uint32_t)size;
+    desc->pixel_format = format.srgb ? VMTextureFormatRGBA8Unorm_sRGB : VMTextureFormatRGBA8Unorm;
+    texture->is_compressed = false;
+    return kIOReturnSuccess;
+}
+
+IOReturn CLASS::decompressTexture(uint32_t texture_id)
+{
+    if (texture_id == 0) {
+        VMLOG_WARN("VMTextureManager::decompressTexture: Invalid texture ID (zero)\n");
+        return kIOReturnBadArgument;
+    }
+
+    if (!m_texture_lock) {
+        VMLOG_DEBUG("VMTextureManager::decompressTexture: Texture lock not initialized\n");
+        return kIOReturnNotReady;
+    }
+
+    IOLockLock(m_texture_lock);
+    ManagedTexture* texture = findTexture(texture_id);
+    IOReturn ret = kIOReturnNotFound;
+    if (texture) {
+        uint32_t old_size = texture->data_size;
+        ret = texture->is_compressed ? expandBlockTexture(texture) : kIOReturnSuccess;
+        m_texture_memory_usage = m_texture_memory_usage - old_size + texture->data_size;
+    }
+    IOLockUnlock(m_texture_lock);
+    return ret;
+}
+
+bool CLASS::isTextureCompressed(uint32_t texture_id)
+{
+    if (!m_texture_lock) {
+        return false;
+    }
+    IOLockLock(m_texture_lock);
+    ManagedTexture* texture = findTexture(texture_id);
+    bool compressed = texture && texture->is_compressed;
+    IOLockUnlock(m_texture_lock);
+    return compressed;
+}
+
+VMTextureCompression CLASS::getTextureCompression(uint32_t texture_id)
+{
+    if (!m_texture_lock) {
+        return VM_TEXTURE_COMPRESSION_NONE;
+    }
+    IOLockLock(m_texture_lock);
+    ManagedTexture* texture = findTexture(texture_id);
+    VMTextureFormat format = texture ? texture->descriptor.pixel_format : VMTextureFormatInvalid;
+    IOLockUnlock(m_texture_lock);
+
+    switch (format) {
+        case VMTextureFormatBC1_RGBA:
+        case VMTextureFormatBC1_RGBA_sRGB:      return VM_TEXTURE_COMPRESSION_DXT1;
+        case VMTextureFormatBC2_RGBA:
+        case VMTextureFormatBC2_RGBA_sRGB:      return VM_TEXTURE_COMPRESSION_DXT3;
+        case VMTextureFormatBC3_RGBA:
+        case VMTextureFormatBC3_RGBA_sRGB:      return VM_TEXTURE_COMPRESSION_DXT5;
+        case VMTextureFormatBC4_RUnorm:
+        case VMTextureFormatBC4_RSnorm:         return VM_TEXTURE_COMPRESSION_BC4;
+        case VMTextureFormatBC5_RGUnorm:
+        case VMTextureFormatBC5_RGSnorm:        return VM_TEXTURE_COMPRESSION_BC5;
+        case VMTextureFormatBC6H_RGBFloat:
+        case VMTextureFormatBC6H_RGBUfloat:     return VM_TEXTURE_COMPRESSION_BC6H;
+        case VMTextureFormatBC7_RGBAUnorm:
+        case VMTextureFormatBC7_RGBAUnorm_sRGB: return VM_TEXTURE_COMPRESSION_BC7;
+        default:                                return VM_TEXTURE_COMPRESSION_NONE;
+    }
+}
+
+// What compressTexture can produce
+bool CLASS::isCompressionSupported(VMTextureCompression compression) const
+{
+    return compressionBlockFormat(compression) != kVMBlockFormatInvalid;
+}
+
+bool CLASS::isFormatCompressed(VMTextureFormat format)
+{
+    return getCompressionBlockSize(format) != 0;
+}
+
+// Bytes per 4x4 block, 0 for an uncompressed format
+uint32_t CLASS::getCompressionBlockSize(VMTextureFormat format)
+{
+    switch (format) {
+        case VMTextureFormatBC1_RGBA:
+        case VMTextureFormatBC1_RGBA_sRGB:
+        case VMTextureFormatBC4_RUnorm:
+        case VMTextureFormatBC4_RSnorm:
+            return 8;
+        case VMTextureFormatBC2_RGBA:
+        case VMTextureFormatBC2_RGBA_sRGB:
+        case VMTextureFormatBC3_RGBA:
+        case VMTextureFormatBC3_RGBA_sRGB:
+        case VMTextureFormatBC5_RGUnorm:
+        case VMTextureFormatBC5_RGSnorm:
+        case VMTextureFormatBC6H_RGBFloat:
+        case VMTextureFormatBC6H_RGBUfloat:
+        case VMTextureFormatBC7_RGBAUnorm:
+        case VMTextureFormatBC7_RGBAUnorm_sRGB:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
 IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
 {
     // Advanced Mipmap Mode Management System - Comprehensive Texture Filtering Configuration
     if (texture_id == 0) {
-        IOLog("VMTextureManager::setMipmapMode: Invalid texture ID (zero)\n");
+        VMLOG_WARN("VMTextureManager::setMipmapMode: Invalid texture ID (zero)\n");
         return kIOReturnBadArgument;
     }
     
     // Validate mipmap mode parameter
     if (mode > VM_MIPMAP_MODE_AUTO_GENERATE_ON_WRITE) {
-        IOLog("VMTextureManager::setMipmapMode: Invalid mipmap mode (%d)\n", mode);
+        VMLOG_WARN("VMTextureManager::setMipmapMode: Invalid mipmap mode (%d)\n", mode);
         return kIOReturnBadArgument;
     }
     
     // Acquire texture management lock for thread safety
     if (!m_texture_lock) {
-        IOLog("VMTextureManager::setMipmapMode: Texture lock not initialized\n");
+        VMLOG_DEBUG("VMTextureManager::setMipmapMode: Texture lock not initialized\n");
         return kIOReturnNotReady;
     }
     
     IOLockLock(m_texture_lock);
     
-    IOLog("VMTextureManager::setMipmapMode: Configuring mipmap mode (Texture ID: %d, Mode: %d)\n", 
+    VMLOG_DEBUG("VMTextureManager::setMipmapMode: Configuring mipmap mode (Texture ID: %d, Mode: %d)\n", 
           texture_id, mode);
     
     // Phase 1: Comprehensive Texture Analysis and Mode Compatibility Assessment
-    IOLog("  Phase 1: Comprehensive texture analysis and mode compatibility assessment\n");
+    VMLOG_DEBUG("  Phase 1: Comprehensive texture analysis and mode compatibility assessment\n");
     
     struct MipmapModeContext {
         uint32_t target_texture_id;
@@ -7753,7 +7669,7 @@ IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
     // Validate texture existence and current state
     mode_context.target_texture_id = texture_id;
     mode_context.requested_mode = mode;
-    mode_context.texture_exists = (texture_id > 0) && (texture_id < m_next_texture_id);
+    mode_context.texture_exists = (findTexture(texture_id) != nullptr);
     
     if (mode_context.texture_exists) {
         // In real implementation, would extract from ManagedTexture
@@ -7825,48 +7741,48 @@ IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
     if (mode_context.texture_width >= 4 && mode_context.texture_height >= 4) compatibility_checks_passed++; // Minimum size
     mode_context.mode_compatibility_score = (float)compatibility_checks_passed / (float)total_compatibility_checks;
     
-    IOLog("    Mipmap Mode Analysis Results:\n");
-    IOLog("      Texture ID: %d - %s\n", mode_context.target_texture_id,
+    VMLOG_DEBUG("    Mipmap Mode Analysis Results:\n");
+    VMLOG_DEBUG("      Texture ID: %d - %s\n", mode_context.target_texture_id,
           mode_context.texture_exists ? "EXISTS" : "NOT FOUND");
-    IOLog("      Requested Mode: %d\n", mode_context.requested_mode);
-    IOLog("      Current Mode: %d\n", mode_context.current_mode);
-    IOLog("      Texture Dimensions: %dx%dx%d\n", mode_context.texture_width,
+    VMLOG_DEBUG("      Requested Mode: %d\n", mode_context.requested_mode);
+    VMLOG_DEBUG("      Current Mode: %d\n", mode_context.current_mode);
+    VMLOG_DEBUG("      Texture Dimensions: %dx%dx%d\n", mode_context.texture_width,
           mode_context.texture_height, mode_context.texture_depth);
-    IOLog("      Pixel Format: %d\n", mode_context.texture_format);
-    IOLog("      Current Mip Levels: %d\n", mode_context.current_mip_levels);
-    IOLog("      Max Supported Levels: %d\n", mode_context.max_supported_mip_levels);
-    IOLog("      Texture Supports Mipmaps: %s\n", mode_context.texture_supports_mipmaps ? "YES" : "NO");
-    IOLog("      Has Existing Mipmaps: %s\n", mode_context.texture_has_existing_mipmaps ? "YES" : "NO");
-    IOLog("      Mode Change Required: %s\n", mode_context.mode_change_required ? "YES" : "NO");
-    IOLog("      Mode Compatible: %s\n", mode_context.mode_compatible_with_texture ? "YES" : "NO");
-    IOLog("      Requires Regeneration: %s\n", mode_context.requires_mipmap_regeneration ? "YES" : "NO");
-    IOLog("      Auto Generation Support: %s\n", mode_context.supports_auto_generation ? "YES" : "NO");
-    IOLog("      Write-Triggered Support: %s\n", mode_context.supports_write_triggered_generation ? "YES" : "NO");
-    IOLog("      Compatibility Score: %.1f%% (%d/%d checks passed)\n", 
+    VMLOG_DEBUG("      Pixel Format: %d\n", mode_context.texture_format);
+    VMLOG_DEBUG("      Current Mip Levels: %d\n", mode_context.current_mip_levels);
+    VMLOG_DEBUG("      Max Supported Levels: %d\n", mode_context.max_supported_mip_levels);
+    VMLOG_DEBUG("      Texture Supports Mipmaps: %s\n", mode_context.texture_supports_mipmaps ? "YES" : "NO");
+    VMLOG_DEBUG("      Has Existing Mipmaps: %s\n", mode_context.texture_has_existing_mipmaps ? "YES" : "NO");
+    VMLOG_DEBUG("      Mode Change Required: %s\n", mode_context.mode_change_required ? "YES" : "NO");
+    VMLOG_DEBUG("      Mode Compatible: %s\n", mode_context.mode_compatible_with_texture ? "YES" : "NO");
+    VMLOG_DEBUG("      Requires Regeneration: %s\n", mode_context.requires_mipmap_regeneration ? "YES" : "NO");
+    VMLOG_DEBUG("      Auto Generation Support: %s\n", mode_context.supports_auto_generation ? "YES" : "NO");
+    VMLOG_DEBUG("      Write-Triggered Support: %s\n", mode_context.supports_write_triggered_generation ? "YES" : "NO");
+    VMLOG_DEBUG("      Compatibility Score: %.1f%% (%d/%d checks passed)\n", 
           mode_context.mode_compatibility_score * 100.0f, compatibility_checks_passed, total_compatibility_checks);
     
     // Validate minimum requirements for mode setting
     if (!mode_context.texture_exists) {
-        IOLog("    ERROR: Texture ID %d not found\n", texture_id);
+        VMLOG_ERROR("    ERROR: Texture ID %d not found\n", texture_id);
         IOLockUnlock(m_texture_lock);
         return kIOReturnNotFound;
     }
     
     if (!mode_context.mode_compatible_with_texture) {
-        IOLog("    ERROR: Mipmap mode %d not compatible with texture\n", mode);
+        VMLOG_ERROR("    ERROR: Mipmap mode %d not compatible with texture\n", mode);
         IOLockUnlock(m_texture_lock);
         return kIOReturnUnsupported;
     }
     
     if (mode_context.mode_compatibility_score < 0.70f) { // Require 70% compatibility
-        IOLog("    ERROR: Mode compatibility failed (%.1f%% score)\n", 
+        VMLOG_ERROR("    ERROR: Mode compatibility failed (%.1f%% score)\n", 
               mode_context.mode_compatibility_score * 100.0f);
         IOLockUnlock(m_texture_lock);
         return kIOReturnBadArgument;
     }
     
     // Phase 2: Advanced Mode Configuration Strategy and System Integration
-    IOLog("  Phase 2: Advanced mode configuration strategy and system integration\n");
+    VMLOG_DEBUG("  Phase 2: Advanced mode configuration strategy and system integration\n");
     
     struct MipmapModeStrategy {
         uint32_t configuration_method;
@@ -7953,23 +7869,23 @@ IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
     
     mode_strategy.system_integration_flags = 0x04; // Mode-specific integration
     
-    IOLog("    Mode Configuration Strategy:\n");
-    IOLog("      Configuration Method: %d\n", mode_strategy.configuration_method);
-    IOLog("      Requires Immediate Action: %s\n", mode_strategy.requires_immediate_action ? "YES" : "NO");
-    IOLog("      System State Update: %s\n", mode_strategy.requires_system_state_update ? "YES" : "NO");
-    IOLog("      Triggers Mipmap Generation: %s\n", mode_strategy.triggers_mipmap_generation ? "YES" : "NO");
-    IOLog("      Auto Generation Triggers: %d\n", mode_strategy.auto_generation_trigger_conditions);
-    IOLog("      Filtering Algorithm: %d\n", mode_strategy.filtering_algorithm_selection);
-    IOLog("      Quality vs Performance: %d\n", mode_strategy.quality_vs_performance_balance);
-    IOLog("      Runtime Optimization: %s\n", mode_strategy.enables_runtime_optimization ? "ENABLED" : "DISABLED");
-    IOLog("      Shader Pipeline Update: %s\n", mode_strategy.requires_shader_pipeline_update ? "REQUIRED" : "NOT REQUIRED");
-    IOLog("      Memory Management Policy: %d\n", mode_strategy.memory_management_policy);
-    IOLog("      Configuration Efficiency: %.1f%%\n", mode_strategy.configuration_efficiency * 100.0f);
-    IOLog("      Estimated Configuration Time: %d μs\n", mode_strategy.estimated_configuration_time_us);
-    IOLog("      System Integration Flags: 0x%02llX\n", mode_strategy.system_integration_flags);
+    VMLOG_DEBUG("    Mode Configuration Strategy:\n");
+    VMLOG_DEBUG("      Configuration Method: %d\n", mode_strategy.configuration_method);
+    VMLOG_DEBUG("      Requires Immediate Action: %s\n", mode_strategy.requires_immediate_action ? "YES" : "NO");
+    VMLOG_DEBUG("      System State Update: %s\n", mode_strategy.requires_system_state_update ? "YES" : "NO");
+    VMLOG_DEBUG("      Triggers Mipmap Generation: %s\n", mode_strategy.triggers_mipmap_generation ? "YES" : "NO");
+    VMLOG_DEBUG("      Auto Generation Triggers: %d\n", mode_strategy.auto_generation_trigger_conditions);
+    VMLOG_DEBUG("      Filtering Algorithm: %d\n", mode_strategy.filtering_algorithm_selection);
+    VMLOG_DEBUG("      Quality vs Performance: %d\n", mode_strategy.quality_vs_performance_balance);
+    VMLOG_DEBUG("      Runtime Optimization: %s\n", mode_strategy.enables_runtime_optimization ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("      Shader Pipeline Update: %s\n", mode_strategy.requires_shader_pipeline_update ? "REQUIRED" : "NOT REQUIRED");
+    VMLOG_DEBUG("      Memory Management Policy: %d\n", mode_strategy.memory_management_policy);
+    VMLOG_DEBUG("      Configuration Efficiency: %.1f%%\n", mode_strategy.configuration_efficiency * 100.0f);
+    VMLOG_DEBUG("      Estimated Configuration Time: %d μs\n", mode_strategy.estimated_configuration_time_us);
+    VMLOG_DEBUG("      System Integration Flags: 0x%02llX\n", mode_strategy.system_integration_flags);
     
     // Phase 3: Advanced Mode Configuration Execution and System Update
-    IOLog("  Phase 3: Advanced mode configuration execution and system update\n");
+    VMLOG_DEBUG("  Phase 3: Advanced mode configuration execution and system update\n");
     
     struct ModeConfigurationExecution {
         bool mode_update_successful;
@@ -7993,7 +7909,7 @@ IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
     // Execute configuration based on method
     if (mode_strategy.configuration_method == 1) {
         // Disable mipmapping
-        IOLog("    Disabling mipmap functionality\n");
+        VMLOG_DEBUG("    Disabling mipmap functionality\n");
         mode_execution.mode_update_successful = true;
         mode_execution.system_state_updated = true;
         mode_execution.shader_pipeline_updated = mode_strategy.requires_shader_pipeline_update;
@@ -8003,13 +7919,13 @@ IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
         if (mode_context.texture_has_existing_mipmaps) {
             mode_execution.memory_released_bytes = 
                 mode_context.texture_width * mode_context.texture_height * 4 / 3; // Estimate 33% memory
-            IOLog("      Released existing mipmap memory: %llu KB\n", 
+            VMLOG_DEBUG("      Released existing mipmap memory: %llu KB\n", 
                   mode_execution.memory_released_bytes / 1024);
         }
         
     } else if (mode_strategy.configuration_method == 2) {
         // Enable manual control
-        IOLog("    Configuring manual mipmap control\n");
+        VMLOG_DEBUG("    Configuring manual mipmap control\n");
         mode_execution.mode_update_successful = true;
         mode_execution.system_state_updated = true;
         mode_execution.shader_pipeline_updated = mode_strategy.requires_shader_pipeline_update;
@@ -8020,7 +7936,7 @@ IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
         
     } else if (mode_strategy.configuration_method == 3) {
         // Enable auto generation with immediate trigger
-        IOLog("    Configuring auto-generation with immediate mipmap creation\n");
+        VMLOG_DEBUG("    Configuring auto-generation with immediate mipmap creation\n");
         mode_execution.mode_update_successful = true;
         mode_execution.system_state_updated = true;
         mode_execution.shader_pipeline_updated = true;
@@ -8032,13 +7948,13 @@ IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
         mode_execution.configuration_operations_performed = 5; // Full configuration
         mode_execution.memory_allocated_bytes = 
             mode_context.texture_width * mode_context.texture_height * 4 / 3; // Mipmap chain
-        IOLog("      Generated %d mipmap levels\n", mode_execution.mipmap_levels_created);
-        IOLog("      Allocated mipmap memory: %llu KB\n", 
+        VMLOG_DEBUG("      Generated %d mipmap levels\n", mode_execution.mipmap_levels_created);
+        VMLOG_DEBUG("      Allocated mipmap memory: %llu KB\n", 
               mode_execution.memory_allocated_bytes / 1024);
         
     } else {
         // Enable write-triggered generation
-        IOLog("    Configuring write-triggered auto-generation\n");
+        VMLOG_DEBUG("    Configuring write-triggered auto-generation\n");
         mode_execution.mode_update_successful = true;
         mode_execution.system_state_updated = true;
         mode_execution.shader_pipeline_updated = true;
@@ -8047,7 +7963,7 @@ IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
         mode_execution.runtime_optimizations_enabled = true;
         mode_execution.auto_generation_triggers_configured = true;
         mode_execution.configuration_operations_performed = 4; // Mode + pipeline + optimization + triggers
-        IOLog("      Configured write triggers for future mipmap generation\n");
+        VMLOG_DEBUG("      Configured write triggers for future mipmap generation\n");
     }
     
     // Calculate execution metrics
@@ -8060,23 +7976,23 @@ IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
             ((float)mode_execution.actual_configuration_time_us * 10.0f); // vs 10 ops/us baseline
     }
     
-    IOLog("    Mode Configuration Execution Results:\n");
-    IOLog("      Mode Update Successful: %s\n", mode_execution.mode_update_successful ? "YES" : "NO");
-    IOLog("      System State Updated: %s\n", mode_execution.system_state_updated ? "YES" : "NO");
-    IOLog("      Shader Pipeline Updated: %s\n", mode_execution.shader_pipeline_updated ? "YES" : "NO");
-    IOLog("      Mipmaps Generated: %s\n", mode_execution.mipmaps_generated ? "YES" : "NO");
-    IOLog("      Memory Policy Applied: %s\n", mode_execution.memory_policy_applied ? "YES" : "NO");
-    IOLog("      Configuration Operations: %d\n", mode_execution.configuration_operations_performed);
-    IOLog("      Configuration Time: %llu μs\n", mode_execution.actual_configuration_time_us);
-    IOLog("      Mipmap Levels Created: %d\n", mode_execution.mipmap_levels_created);
-    IOLog("      Memory Allocated: %llu KB\n", mode_execution.memory_allocated_bytes / 1024);
-    IOLog("      Memory Released: %llu KB\n", mode_execution.memory_released_bytes / 1024);
-    IOLog("      Runtime Optimizations: %s\n", mode_execution.runtime_optimizations_enabled ? "ENABLED" : "DISABLED");
-    IOLog("      Auto Triggers Configured: %s\n", mode_execution.auto_generation_triggers_configured ? "YES" : "NO");
-    IOLog("      Configuration Efficiency: %.1f%%\n", mode_execution.actual_configuration_efficiency * 100.0f);
+    VMLOG_DEBUG("    Mode Configuration Execution Results:\n");
+    VMLOG_DEBUG("      Mode Update Successful: %s\n", mode_execution.mode_update_successful ? "YES" : "NO");
+    VMLOG_DEBUG("      System State Updated: %s\n", mode_execution.system_state_updated ? "YES" : "NO");
+    VMLOG_DEBUG("      Shader Pipeline Updated: %s\n", mode_execution.shader_pipeline_updated ? "YES" : "NO");
+    VMLOG_DEBUG("      Mipmaps Generated: %s\n", mode_execution.mipmaps_generated ? "YES" : "NO");
+    VMLOG_DEBUG("      Memory Policy Applied: %s\n", mode_execution.memory_policy_applied ? "YES" : "NO");
+    VMLOG_DEBUG("      Configuration Operations: %d\n", mode_execution.configuration_operations_performed);
+    VMLOG_DEBUG("      Configuration Time: %llu μs\n", mode_execution.actual_configuration_time_us);
+    VMLOG_DEBUG("      Mipmap Levels Created: %d\n", mode_execution.mipmap_levels_created);
+    VMLOG_DEBUG("      Memory Allocated: %llu KB\n", mode_execution.memory_allocated_bytes / 1024);
+    VMLOG_DEBUG("      Memory Released: %llu KB\n", mode_execution.memory_released_bytes / 1024);
+    VMLOG_DEBUG("      Runtime Optimizations: %s\n", mode_execution.runtime_optimizations_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("      Auto Triggers Configured: %s\n", mode_execution.auto_generation_triggers_configured ? "YES" : "NO");
+    VMLOG_DEBUG("      Configuration Efficiency: %.1f%%\n", mode_execution.actual_configuration_efficiency * 100.0f);
     
     // Phase 4: Post-Configuration Validation and Memory Management
-    IOLog("  Phase 4: Post-configuration validation and memory management\n");
+    VMLOG_DEBUG("  Phase 4: Post-configuration validation and memory management\n");
     
     struct ModeValidationResults {
         bool configuration_successful;
@@ -8130,46 +8046,46 @@ IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
     float performance_success = mode_validation.performance_targets_achieved ? 1.0f : 0.8f;
     mode_validation.overall_configuration_success_rate = (compatibility_success + execution_success + performance_success) / 3.0f;
     
-    IOLog("    Mode Validation Results:\n");
-    IOLog("      Configuration Successful: %s\n", mode_validation.configuration_successful ? "YES" : "NO");
-    IOLog("      Texture Mode Updated: %s\n", mode_validation.texture_mode_updated ? "YES" : "NO");
-    IOLog("      Final Texture Mode: %d\n", mode_validation.final_texture_mode);
-    IOLog("      System Consistency: %s\n", mode_validation.system_consistency_maintained ? "MAINTAINED" : "COMPROMISED");
-    IOLog("      Memory Tracking Updated: %s\n", mode_validation.memory_tracking_updated ? "YES" : "NO");
-    IOLog("      Performance Targets: %s (%.1f%% efficiency)\n", 
+    VMLOG_DEBUG("    Mode Validation Results:\n");
+    VMLOG_DEBUG("      Configuration Successful: %s\n", mode_validation.configuration_successful ? "YES" : "NO");
+    VMLOG_DEBUG("      Texture Mode Updated: %s\n", mode_validation.texture_mode_updated ? "YES" : "NO");
+    VMLOG_DEBUG("      Final Texture Mode: %d\n", mode_validation.final_texture_mode);
+    VMLOG_DEBUG("      System Consistency: %s\n", mode_validation.system_consistency_maintained ? "MAINTAINED" : "COMPROMISED");
+    VMLOG_DEBUG("      Memory Tracking Updated: %s\n", mode_validation.memory_tracking_updated ? "YES" : "NO");
+    VMLOG_DEBUG("      Performance Targets: %s (%.1f%% efficiency)\n", 
           mode_validation.performance_targets_achieved ? "ACHIEVED" : "MISSED", mode_execution.actual_configuration_efficiency * 100.0f);
-    IOLog("      Net Memory Change: %+lld KB\n", (int64_t)mode_validation.net_memory_change_bytes / 1024);
-    IOLog("      Shader Integration: %s\n", mode_validation.shader_integration_verified ? "VERIFIED" : "PENDING");
-    IOLog("      Trigger System: %s\n", mode_validation.trigger_system_operational ? "OPERATIONAL" : "INACTIVE");
-    IOLog("      Optimization Features: %s\n", mode_validation.optimization_features_active ? "ACTIVE" : "INACTIVE");
-    IOLog("      System Integration Score: %d/100\n", mode_validation.system_integration_score);
-    IOLog("      Overall Success Rate: %.1f%%\n", mode_validation.overall_configuration_success_rate * 100.0f);
+    VMLOG_DEBUG("      Net Memory Change: %+lld KB\n", (int64_t)mode_validation.net_memory_change_bytes / 1024);
+    VMLOG_DEBUG("      Shader Integration: %s\n", mode_validation.shader_integration_verified ? "VERIFIED" : "PENDING");
+    VMLOG_DEBUG("      Trigger System: %s\n", mode_validation.trigger_system_operational ? "OPERATIONAL" : "INACTIVE");
+    VMLOG_DEBUG("      Optimization Features: %s\n", mode_validation.optimization_features_active ? "ACTIVE" : "INACTIVE");
+    VMLOG_DEBUG("      System Integration Score: %d/100\n", mode_validation.system_integration_score);
+    VMLOG_DEBUG("      Overall Success Rate: %.1f%%\n", mode_validation.overall_configuration_success_rate * 100.0f);
     
     // Final validation check
     if (!mode_execution.mode_update_successful) {
-        IOLog("    ERROR: Mode configuration failed\n");
+        VMLOG_ERROR("    ERROR: Mode configuration failed\n");
         IOLockUnlock(m_texture_lock);
         return kIOReturnIOError;
     }
     
     if (mode_validation.overall_configuration_success_rate < 0.75f) { // Require 75% success
-        IOLog("    WARNING: Mode configuration completed with suboptimal performance (%.1f%% success rate)\n",
+        VMLOG_DEBUG("    WARNING: Mode configuration completed with suboptimal performance (%.1f%% success rate)\n",
               mode_validation.overall_configuration_success_rate * 100.0f);
     }
     
-    IOLog("VMTextureManager::setMipmapMode: ========== Mipmap Mode Configuration Complete ==========\n");
-    IOLog("  Texture ID: %d\n", texture_id);
-    IOLog("  Previous Mode: %d\n", mode_context.current_mode);
-    IOLog("  New Mode: %d\n", mode_validation.final_texture_mode);
-    IOLog("  Configuration Method: %d\n", mode_strategy.configuration_method);
-    IOLog("  Configuration Time: %llu μs\n", mode_execution.actual_configuration_time_us);
-    IOLog("  Memory Change: %+lld KB\n", (int64_t)mode_validation.net_memory_change_bytes / 1024);
-    IOLog("  Mipmaps Generated: %d levels\n", mode_execution.mipmap_levels_created);
-    IOLog("  Runtime Optimizations: %s\n", mode_validation.optimization_features_active ? "ACTIVE" : "INACTIVE");
-    IOLog("  Auto Generation: %s\n", mode_validation.trigger_system_operational ? "CONFIGURED" : "DISABLED");
-    IOLog("  Integration Score: %d/100\n", mode_validation.system_integration_score);
-    IOLog("  Overall Performance: %.1f%%\n", mode_validation.overall_configuration_success_rate * 100.0f);
-    IOLog("====================================================================================\n");
+    VMLOG_DEBUG("VMTextureManager::setMipmapMode: ========== Mipmap Mode Configuration Complete ==========\n");
+    VMLOG_DEBUG("  Texture ID: %d\n", texture_id);
+    VMLOG_DEBUG("  Previous Mode: %d\n", mode_context.current_mode);
+    VMLOG_DEBUG("  New Mode: %d\n", mode_validation.final_texture_mode);
+    VMLOG_DEBUG("  Configuration Method: %d\n", mode_strategy.configuration_method);
+    VMLOG_DEBUG("  Configuration Time: %llu μs\n", mode_execution.actual_configuration_time_us);
+    VMLOG_DEBUG("  Memory Change: %+lld KB\n", (int64_t)mode_validation.net_memory_change_bytes / 1024);
+    VMLOG_DEBUG("  Mipmaps Generated: %d levels\n", mode_execution.mipmap_levels_created);
+    VMLOG_DEBUG("  Runtime Optimizations: %s\n", mode_validation.optimization_features_active ? "ACTIVE" : "INACTIVE");
+    VMLOG_DEBUG("  Auto Generation: %s\n", mode_validation.trigger_system_operational ? "CONFIGURED" : "DISABLED");
+    VMLOG_DEBUG("  Integration Score: %d/100\n", mode_validation.system_integration_score);
+    VMLOG_DEBUG("  Overall Performance: %.1f%%\n", mode_validation.overall_configuration_success_rate * 100.0f);
+    VMLOG_DEBUG("====================================================================================\n");
     
     IOLockUnlock(m_texture_lock);
     return kIOReturnSuccess;
@@ -8177,707 +8093,77 @@ IOReturn CLASS::setMipmapMode(uint32_t texture_id, VMMipmapMode mode)
 
 // Advanced Private Methods Implementation - Comprehensive Resource Lookup and Management
 
+// Texture and sampler ids are handles: one slot read, no lock, and a
+// destroyed id stays invalid even after its slot is reused
 VMTextureManager::ManagedTexture* CLASS::findTexture(uint32_t texture_id)
 {
-    // Advanced Texture Lookup System - Comprehensive Search and Validation Engine
-    if (texture_id == 0) {
-        IOLog("VMTextureManager::findTexture: Invalid texture ID (zero)\n");
-        return nullptr;
+    return m_texture_table.lookup(texture_id);
+}
+
+VMTextureManager::TextureSampler* CLASS::findSampler(uint32_t sampler_id)
+{
+    return m_sampler_table.lookup(sampler_id);
+}
+
+IOReturn CLASS::createSampler(VMTextureFilter min_filter, VMTextureFilter mag_filter,
+                             VMTextureWrap wrap_s, VMTextureWrap wrap_t, VMTextureWrap wrap_r,
+                             uint32_t* sampler_id)
+{
+    if (!sampler_id) {
+        return kIOReturnBadArgument;
     }
     
-    // Thread safety validation - ensure we have proper locking context
-    if (!m_texture_lock) {
-        IOLog("VMTextureManager::findTexture: Texture lock not initialized\n");
-        return nullptr;
+    TextureSampler* sampler = new TextureSampler;
+    if (!sampler) {
+        return kIOReturnNoMemory;
     }
+    bzero(sampler, sizeof(TextureSampler));
+    sampler->min_filter = min_filter;
+    sampler->mag_filter = mag_filter;
+    sampler->wrap_s = wrap_s;
+    sampler->wrap_t = wrap_t;
+    sampler->wrap_r = wrap_r;
+    sampler->max_lod = 1000.0f;
+    sampler->max_anisotropy = 1;
+    sampler->ref_count = 1;
     
-    IOLog("VMTextureManager::findTexture: Initiating advanced texture lookup (ID: %d)\n", texture_id);
-    
-    // Phase 1: Advanced Search Strategy Configuration and Analysis
-    IOLog("  Phase 1: Advanced search strategy configuration and performance analysis\n");
-    
-    struct TextureLookupStrategy {
-        uint32_t target_texture_id;
-        bool use_array_search;
-        bool use_dictionary_search;
-        bool use_cache_search;
-        bool enable_deep_validation;
-        bool enable_access_tracking;
-        uint32_t search_optimization_level;
-        uint32_t expected_search_operations;
-        float search_efficiency_target;
-        bool supports_parallel_search;
-    } lookup_strategy = {0};
-    
-    // Configure comprehensive search strategy
-    lookup_strategy.target_texture_id = texture_id;
-    lookup_strategy.use_array_search = (m_textures != nullptr);
-    lookup_strategy.use_dictionary_search = (m_texture_map != nullptr);
-    lookup_strategy.use_cache_search = (m_texture_cache != nullptr);
-    lookup_strategy.enable_deep_validation = true;
-    lookup_strategy.enable_access_tracking = true;
-    lookup_strategy.search_optimization_level = 3; // High optimization
-    lookup_strategy.expected_search_operations = 1; // Single texture lookup
-    lookup_strategy.search_efficiency_target = 0.98f; // Target 98% efficiency
-    lookup_strategy.supports_parallel_search = false; // Sequential for now
-    
-    IOLog("    Texture Lookup Strategy Configuration:\n");
-    IOLog("      Target Texture ID: %d\n", lookup_strategy.target_texture_id);
-    IOLog("      Array Search: %s\n", lookup_strategy.use_array_search ? "ENABLED" : "DISABLED");
-    IOLog("      Dictionary Search: %s\n", lookup_strategy.use_dictionary_search ? "ENABLED" : "DISABLED");
-    IOLog("      Cache Search: %s\n", lookup_strategy.use_cache_search ? "ENABLED" : "DISABLED");
-    IOLog("      Deep Validation: %s\n", lookup_strategy.enable_deep_validation ? "ENABLED" : "DISABLED");
-    IOLog("      Access Tracking: %s\n", lookup_strategy.enable_access_tracking ? "ENABLED" : "DISABLED");
-    IOLog("      Optimization Level: %d\n", lookup_strategy.search_optimization_level);
-    IOLog("      Expected Operations: %d\n", lookup_strategy.expected_search_operations);
-    IOLog("      Efficiency Target: %.1f%%\n", lookup_strategy.search_efficiency_target * 100.0f);
-    IOLog("      Parallel Search: %s\n", lookup_strategy.supports_parallel_search ? "ENABLED" : "DISABLED");
-    
-    // Phase 2: Primary Dictionary-Based Lookup with Hash Optimization
-    IOLog("  Phase 2: Primary dictionary-based lookup with advanced hash optimization\n");
-    
-    ManagedTexture* found_texture = nullptr;
-    struct DictionarySearchResult {
-        bool search_attempted;
-        bool texture_found_in_dictionary;
-        uint32_t dictionary_entries_searched;
-        uint32_t hash_collisions_encountered;
-        uint64_t search_time_microseconds;
-        float dictionary_search_efficiency;
-        bool requires_validation;
-    } dict_result = {0};
-    
-    if (lookup_strategy.use_dictionary_search) {
-        dict_result.search_attempted = true;
-        
-        // Create texture ID key for dictionary lookup
-        char texture_key_buffer[32];
-        snprintf(texture_key_buffer, sizeof(texture_key_buffer), "texture_%d", texture_id);
-        OSString* texture_key = OSString::withCString(texture_key_buffer);
-        
-        if (texture_key) {
-            // Perform dictionary lookup
-            OSObject* texture_obj = m_texture_map->getObject(texture_key);
-            if (texture_obj) {
-                dict_result.texture_found_in_dictionary = true;
-                dict_result.dictionary_entries_searched = 1; // Direct hash lookup
-                dict_result.hash_collisions_encountered = 0; // No collisions in direct lookup
-                dict_result.requires_validation = true;
-                
-                // In real implementation, would extract ManagedTexture from OSObject wrapper
-                // For now, simulate successful dictionary lookup
-                IOLog("    Dictionary lookup: SUCCESSFUL (simulated)\n");
-            } else {
-                dict_result.texture_found_in_dictionary = false;
-                dict_result.dictionary_entries_searched = 1;
-                IOLog("    Dictionary lookup: NOT FOUND\n");
-            }
-            
-            texture_key->release();
-        } else {
-            IOLog("    Dictionary lookup: FAILED (key creation error)\n");
-            dict_result.search_attempted = false;
-        }
-        
-        // Calculate dictionary search efficiency
-        dict_result.search_time_microseconds = 50; // Simulated fast lookup time
-        dict_result.dictionary_search_efficiency = dict_result.texture_found_in_dictionary ? 1.0f : 0.8f;
-        
-        IOLog("    Dictionary Search Results:\n");
-        IOLog("      Search Attempted: %s\n", dict_result.search_attempted ? "YES" : "NO");
-        IOLog("      Texture Found: %s\n", dict_result.texture_found_in_dictionary ? "YES" : "NO");
-        IOLog("      Entries Searched: %d\n", dict_result.dictionary_entries_searched);
-        IOLog("      Hash Collisions: %d\n", dict_result.hash_collisions_encountered);
-        IOLog("      Search Time: %llu μs\n", dict_result.search_time_microseconds);
-        IOLog("      Search Efficiency: %.1f%%\n", dict_result.dictionary_search_efficiency * 100.0f);
-        IOLog("      Requires Validation: %s\n", dict_result.requires_validation ? "YES" : "NO");
-    }
-    
-    // Phase 3: Secondary Array-Based Linear Search with Optimization
-    IOLog("  Phase 3: Secondary array-based linear search with comprehensive optimization\n");
-    
-    struct ArraySearchResult {
-        bool search_attempted;
-        bool texture_found_in_array;
-        uint32_t array_entries_searched;
-        uint32_t total_array_entries;
-        uint32_t found_at_index;
-        uint64_t linear_search_time_microseconds;
-        float array_search_efficiency;
-        bool early_termination_used;
-    } array_result = {0};
-    
-    if (lookup_strategy.use_array_search && !dict_result.texture_found_in_dictionary) {
-        array_result.search_attempted = true;
-        array_result.total_array_entries = m_textures->getCount();
-        array_result.early_termination_used = true; // Stop on first match
-        
-        IOLog("    Performing optimized linear array search\n");
-        IOLog("      Total Array Entries: %d\n", array_result.total_array_entries);
-        
-        // Perform linear search through texture array
-        for (uint32_t i = 0; i < array_result.total_array_entries; i++) {
-            array_result.array_entries_searched++;
-            
-            OSObject* texture_obj = m_textures->getObject(i);
-            if (texture_obj) {
-                // In real implementation, would extract and compare texture ID from ManagedTexture
-                // For demonstration, assume texture found at middle of array
-                if (i == (array_result.total_array_entries / 2)) {
-                    array_result.texture_found_in_array = true;
-                    array_result.found_at_index = i;
-                    found_texture = reinterpret_cast<ManagedTexture*>(texture_obj); // Simulated cast
-                    IOLog("      Texture found at array index: %d\n", i);
-                    break; // Early termination
-                }
-            }
-        }
-        
-        // Calculate array search efficiency
-        array_result.linear_search_time_microseconds = array_result.array_entries_searched * 10; // 10μs per entry
-        array_result.array_search_efficiency = array_result.texture_found_in_array ? 
-            (1.0f - ((float)array_result.array_entries_searched / (float)array_result.total_array_entries)) : 0.5f;
-        
-        IOLog("    Array Search Results:\n");
-        IOLog("      Search Attempted: %s\n", array_result.search_attempted ? "YES" : "NO");
-        IOLog("      Texture Found: %s\n", array_result.texture_found_in_array ? "YES" : "NO");
-        IOLog("      Entries Searched: %d / %d\n", array_result.array_entries_searched, array_result.total_array_entries);
-        IOLog("      Found at Index: %d\n", array_result.found_at_index);
-        IOLog("      Search Time: %llu μs\n", array_result.linear_search_time_microseconds);
-        IOLog("      Search Efficiency: %.1f%%\n", array_result.array_search_efficiency * 100.0f);
-        IOLog("      Early Termination: %s\n", array_result.early_termination_used ? "USED" : "NOT USED");
-    }
-    
-    // Phase 4: Tertiary Cache-Based Search with LRU Analysis
-    IOLog("  Phase 4: Tertiary cache-based search with advanced LRU analysis\n");
-    
-    struct CacheSearchResult {
-        bool search_attempted;
-        bool texture_found_in_cache;
-        uint32_t cache_entries_searched;
-        uint32_t cache_hit_count;
-        uint32_t cache_miss_count;
-        bool cache_entry_recently_accessed;
-        uint64_t cache_search_time_microseconds;
-        float cache_search_efficiency;
-        bool cache_promotion_required;
-    } cache_result = {0};
-    
-    if (lookup_strategy.use_cache_search && !dict_result.texture_found_in_dictionary && !array_result.texture_found_in_array) {
-        cache_result.search_attempted = true;
-        cache_result.cache_entries_searched = m_texture_cache ? m_texture_cache->getCount() : 0;
-        
-        IOLog("    Performing advanced cache search with LRU analysis\n");
-        IOLog("      Cache Entries Available: %d\n", cache_result.cache_entries_searched);
-        
-        if (cache_result.cache_entries_searched > 0) {
-            // Simulate cache search (in real implementation, would search cache)
-            // For demonstration, assume 25% cache hit rate
-            if ((texture_id % 4) == 0) {
-                cache_result.texture_found_in_cache = true;
-                cache_result.cache_hit_count = 1;
-                cache_result.cache_entry_recently_accessed = true;
-                cache_result.cache_promotion_required = false; // Already at front
-                IOLog("      Cache hit: Texture found in cache\n");
-            } else {
-                cache_result.texture_found_in_cache = false;
-                cache_result.cache_miss_count = 1;
-                IOLog("      Cache miss: Texture not in cache\n");
-            }
-        }
-        
-        // Calculate cache search efficiency
-        cache_result.cache_search_time_microseconds = 25; // Fast cache access
-        cache_result.cache_search_efficiency = cache_result.texture_found_in_cache ? 1.0f : 0.0f;
-        
-        IOLog("    Cache Search Results:\n");
-        IOLog("      Search Attempted: %s\n", cache_result.search_attempted ? "YES" : "NO");
-        IOLog("      Texture Found: %s\n", cache_result.texture_found_in_cache ? "YES" : "NO");
-        IOLog("      Entries Searched: %d\n", cache_result.cache_entries_searched);
-        IOLog("      Cache Hits: %d\n", cache_result.cache_hit_count);
-        IOLog("      Cache Misses: %d\n", cache_result.cache_miss_count);
-        IOLog("      Recently Accessed: %s\n", cache_result.cache_entry_recently_accessed ? "YES" : "NO");
-        IOLog("      Search Time: %llu μs\n", cache_result.cache_search_time_microseconds);
-        IOLog("      Search Efficiency: %.1f%%\n", cache_result.cache_search_efficiency * 100.0f);
-        IOLog("      Promotion Required: %s\n", cache_result.cache_promotion_required ? "YES" : "NO");
-    }
-    
-    // Phase 5: Comprehensive Result Validation and Integrity Verification
-    IOLog("  Phase 5: Comprehensive result validation and advanced integrity verification\n");
-    
-    bool texture_located = dict_result.texture_found_in_dictionary || 
-                          array_result.texture_found_in_array || 
-                          cache_result.texture_found_in_cache;
-    
-    if (texture_located && lookup_strategy.enable_deep_validation) {
-        struct TextureValidationResult {
-            bool texture_object_valid;
-            bool texture_id_matches;
-            bool texture_descriptor_valid;
-            bool memory_references_valid;
-            bool access_permissions_valid;
-            uint32_t validation_flags;
-            float validation_confidence;
-            bool safe_to_return;
-        } validation_result = {0};
-        
-        // In real implementation, would perform comprehensive validation
-        // For now, simulate successful validation
-        validation_result.texture_object_valid = true;
-        validation_result.texture_id_matches = true;
-        validation_result.texture_descriptor_valid = true;
-        validation_result.memory_references_valid = true;
-        validation_result.access_permissions_valid = true;
-        validation_result.validation_flags = 0xFF; // All validations passed
-        validation_result.validation_confidence = 0.95f; // 95% confidence
-        validation_result.safe_to_return = (validation_result.validation_confidence >= 0.9f);
-        
-        IOLog("    Deep Validation Results:\n");
-        IOLog("      Texture Object Valid: %s\n", validation_result.texture_object_valid ? "YES" : "NO");
-        IOLog("      Texture ID Matches: %s\n", validation_result.texture_id_matches ? "YES" : "NO");
-        IOLog("      Descriptor Valid: %s\n", validation_result.texture_descriptor_valid ? "YES" : "NO");
-        IOLog("      Memory References Valid: %s\n", validation_result.memory_references_valid ? "YES" : "NO");
-        IOLog("      Access Permissions Valid: %s\n", validation_result.access_permissions_valid ? "YES" : "NO");
-        IOLog("      Validation Flags: 0x%02X\n", validation_result.validation_flags);
-        IOLog("      Validation Confidence: %.1f%%\n", validation_result.validation_confidence * 100.0f);
-        IOLog("      Safe to Return: %s\n", validation_result.safe_to_return ? "YES" : "NO");
-        
-        if (!validation_result.safe_to_return) {
-            IOLog("    ERROR: Texture validation failed - unsafe to return\n");
-            texture_located = false;
-            found_texture = nullptr;
-        }
-    }
+    IOLockLock(m_texture_lock);
+    sampler->sampler_id = m_sampler_table.insert(sampler);
+    IOLockUnlock(m_texture_lock);
     
-    // Phase 6: Access Statistics Update and Performance Metrics
-    IOLog("  Phase 6: Access statistics update and comprehensive performance metrics\n");
-    
-    if (texture_located && lookup_strategy.enable_access_tracking) {
-        struct AccessStatisticsUpdate {
-            uint64_t lookup_timestamp;
-            uint32_t access_count_increment;
-            uint32_t total_lookup_operations;
-            uint64_t cumulative_search_time;
-            float average_search_efficiency;
-            bool update_lru_position;
-            bool cache_promotion_performed;
-        } stats_update = {0};
-        
-        // Configure access statistics update
-        stats_update.lookup_timestamp = 0; // Would use mach_absolute_time() in real implementation
-        stats_update.access_count_increment = 1;
-        stats_update.total_lookup_operations = 1;
-        stats_update.cumulative_search_time = dict_result.search_time_microseconds + 
-                                             array_result.linear_search_time_microseconds + 
-                                             cache_result.cache_search_time_microseconds;
-        stats_update.average_search_efficiency = (dict_result.dictionary_search_efficiency + 
-                                                 array_result.array_search_efficiency + 
-                                                 cache_result.cache_search_efficiency) / 3.0f;
-        stats_update.update_lru_position = true;
-        stats_update.cache_promotion_performed = cache_result.cache_promotion_required;
-        
-        IOLog("    Access Statistics Update:\n");
-        IOLog("      Lookup Timestamp: %llu\n", stats_update.lookup_timestamp);
-        IOLog("      Access Count Increment: %d\n", stats_update.access_count_increment);
-        IOLog("      Total Lookup Operations: %d\n", stats_update.total_lookup_operations);
-        IOLog("      Cumulative Search Time: %llu μs\n", stats_update.cumulative_search_time);
-        IOLog("      Average Search Efficiency: %.1f%%\n", stats_update.average_search_efficiency * 100.0f);
-        IOLog("      LRU Position Update: %s\n", stats_update.update_lru_position ? "YES" : "NO");
-        IOLog("      Cache Promotion Performed: %s\n", stats_update.cache_promotion_performed ? "YES" : "NO");
-        
-        // In real implementation, would update ManagedTexture access statistics
-        IOLog("    Updating texture access tracking data\n");
-    }
-    
-    // Generate comprehensive search summary
-    IOLog("VMTextureManager::findTexture: ========== Texture Lookup Complete ==========\n");
-    IOLog("  Search Target: Texture ID %d\n", texture_id);
-    IOLog("  Search Result: %s\n", texture_located ? "FOUND" : "NOT FOUND");
-    if (texture_located) {
-        IOLog("  Found Via: %s\n", 
-              dict_result.texture_found_in_dictionary ? "DICTIONARY" :
-              array_result.texture_found_in_array ? "ARRAY" :
-              cache_result.texture_found_in_cache ? "CACHE" : "UNKNOWN");
-        IOLog("  Search Operations: D:%d A:%d C:%d\n", 
-              dict_result.dictionary_entries_searched,
-              array_result.array_entries_searched, 
-              cache_result.cache_entries_searched);
-        IOLog("  Total Search Time: %llu μs\n", 
-              dict_result.search_time_microseconds + 
-              array_result.linear_search_time_microseconds + 
-              cache_result.cache_search_time_microseconds);
-        IOLog("  Overall Efficiency: %.1f%%\n", 
-              ((dict_result.dictionary_search_efficiency + 
-                array_result.array_search_efficiency + 
-                cache_result.cache_search_efficiency) / 3.0f) * 100.0f);
-    } else {
-        IOLog("  Searches Performed: Dictionary:%s Array:%s Cache:%s\n",
-              dict_result.search_attempted ? "YES" : "NO",
-              array_result.search_attempted ? "YES" : "NO", 
-              cache_result.search_attempted ? "YES" : "NO");
+    if (!sampler->sampler_id) {
+        delete sampler;
+        return kIOReturnNoResources;
     }
-    IOLog("==============================================================================\n");
-    
-    return found_texture; // Return located texture or nullptr if not found
+    *sampler_id = sampler->sampler_id;
+    return kIOReturnSuccess;
 }
 
-VMTextureManager::TextureSampler* CLASS::findSampler(uint32_t sampler_id)
+IOReturn CLASS::destroySampler(uint32_t sampler_id)
 {
-    // Advanced Sampler Lookup System - Comprehensive Search and Resource Management Engine
-    if (sampler_id == 0) {
-        IOLog("VMTextureManager::findSampler: Invalid sampler ID (zero)\n");
-        return nullptr;
-    }
-    
-    // Thread safety validation - ensure we have proper locking context
-    if (!m_texture_lock) {
-        IOLog("VMTextureManager::findSampler: Texture lock not initialized\n");
-        return nullptr;
-    }
-    
-    IOLog("VMTextureManager::findSampler: Initiating advanced sampler lookup (ID: %d)\n", sampler_id);
-    
-    // Phase 1: Advanced Sampler Search Strategy Configuration and Analysis
-    IOLog("  Phase 1: Advanced sampler search strategy configuration and performance analysis\n");
-    
-    struct SamplerLookupStrategy {
-        uint32_t target_sampler_id;
-        bool use_sampler_array_search;
-        bool use_sampler_dictionary_search;
-        bool use_sampler_cache_search;
-        bool enable_sampler_validation;
-        bool enable_sampler_access_tracking;
-        uint32_t sampler_search_optimization_level;
-        uint32_t expected_sampler_operations;
-        float sampler_search_efficiency_target;
-        bool supports_concurrent_sampler_access;
-    } sampler_lookup_strategy = {0};
-    
-    // Configure comprehensive sampler search strategy
-    sampler_lookup_strategy.target_sampler_id = sampler_id;
-    sampler_lookup_strategy.use_sampler_array_search = (m_samplers != nullptr);
-    sampler_lookup_strategy.use_sampler_dictionary_search = true; // Assume sampler dictionary exists
-    sampler_lookup_strategy.use_sampler_cache_search = true; // Assume sampler caching
-    sampler_lookup_strategy.enable_sampler_validation = true;
-    sampler_lookup_strategy.enable_sampler_access_tracking = true;
-    sampler_lookup_strategy.sampler_search_optimization_level = 3; // High optimization
-    sampler_lookup_strategy.expected_sampler_operations = 1; // Single sampler lookup
-    sampler_lookup_strategy.sampler_search_efficiency_target = 0.97f; // Target 97% efficiency
-    sampler_lookup_strategy.supports_concurrent_sampler_access = false; // Sequential for now
-    
-    IOLog("    Sampler Lookup Strategy Configuration:\n");
-    IOLog("      Target Sampler ID: %d\n", sampler_lookup_strategy.target_sampler_id);
-    IOLog("      Sampler Array Search: %s\n", sampler_lookup_strategy.use_sampler_array_search ? "ENABLED" : "DISABLED");
-    IOLog("      Sampler Dictionary Search: %s\n", sampler_lookup_strategy.use_sampler_dictionary_search ? "ENABLED" : "DISABLED");
-    IOLog("      Sampler Cache Search: %s\n", sampler_lookup_strategy.use_sampler_cache_search ? "ENABLED" : "DISABLED");
-    IOLog("      Sampler Validation: %s\n", sampler_lookup_strategy.enable_sampler_validation ? "ENABLED" : "DISABLED");
-    IOLog("      Access Tracking: %s\n", sampler_lookup_strategy.enable_sampler_access_tracking ? "ENABLED" : "DISABLED");
-    IOLog("      Optimization Level: %d\n", sampler_lookup_strategy.sampler_search_optimization_level);
-    IOLog("      Expected Operations: %d\n", sampler_lookup_strategy.expected_sampler_operations);
-    IOLog("      Efficiency Target: %.1f%%\n", sampler_lookup_strategy.sampler_search_efficiency_target * 100.0f);
-    IOLog("      Concurrent Access: %s\n", sampler_lookup_strategy.supports_concurrent_sampler_access ? "ENABLED" : "DISABLED");
-    
-    // Phase 2: Primary Sampler Array-Based Search with Optimization
-    IOLog("  Phase 2: Primary sampler array-based search with advanced optimization\n");
-    
-    TextureSampler* found_sampler = nullptr;
-    struct SamplerArraySearchResult {
-        bool sampler_search_attempted;
-        bool sampler_found_in_array;
-        uint32_t sampler_array_entries_searched;
-        uint32_t total_sampler_array_entries;
-        uint32_t sampler_found_at_index;
-        uint64_t sampler_search_time_microseconds;
-        float sampler_array_search_efficiency;
-        bool sampler_early_termination_used;
-    } sampler_array_result = {0};
-    
-    if (sampler_lookup_strategy.use_sampler_array_search) {
-        sampler_array_result.sampler_search_attempted = true;
-        sampler_array_result.total_sampler_array_entries = m_samplers->getCount();
-        sampler_array_result.sampler_early_termination_used = true; // Stop on first match
-        
-        IOLog("    Performing optimized sampler array search\n");
-        IOLog("      Total Sampler Array Entries: %d\n", sampler_array_result.total_sampler_array_entries);
-        
-        // Perform linear search through sampler array
-        for (uint32_t i = 0; i < sampler_array_result.total_sampler_array_entries; i++) {
-            sampler_array_result.sampler_array_entries_searched++;
-            
-            OSObject* sampler_obj = m_samplers->getObject(i);
-            if (sampler_obj) {
-                // In real implementation, would extract and compare sampler ID from TextureSampler
-                // For demonstration, assume sampler found at 1/3 position for variety
-                if (i == (sampler_array_result.total_sampler_array_entries / 3)) {
-                    sampler_array_result.sampler_found_in_array = true;
-                    sampler_array_result.sampler_found_at_index = i;
-                    found_sampler = reinterpret_cast<TextureSampler*>(sampler_obj); // Simulated cast
-                    IOLog("      Sampler found at array index: %d\n", i);
-                    break; // Early termination
-                }
-            }
-        }
-        
-        // Calculate sampler array search efficiency
-        sampler_array_result.sampler_search_time_microseconds = sampler_array_result.sampler_array_entries_searched * 8; // 8μs per entry
-        sampler_array_result.sampler_array_search_efficiency = sampler_array_result.sampler_found_in_array ? 
-            (1.0f - ((float)sampler_array_result.sampler_array_entries_searched / (float)sampler_array_result.total_sampler_array_entries)) : 0.6f;
-        
-        IOLog("    Sampler Array Search Results:\n");
-        IOLog("      Search Attempted: %s\n", sampler_array_result.sampler_search_attempted ? "YES" : "NO");
-        IOLog("      Sampler Found: %s\n", sampler_array_result.sampler_found_in_array ? "YES" : "NO");
-        IOLog("      Entries Searched: %d / %d\n", sampler_array_result.sampler_array_entries_searched, sampler_array_result.total_sampler_array_entries);
-        IOLog("      Found at Index: %d\n", sampler_array_result.sampler_found_at_index);
-        IOLog("      Search Time: %llu μs\n", sampler_array_result.sampler_search_time_microseconds);
-        IOLog("      Search Efficiency: %.1f%%\n", sampler_array_result.sampler_array_search_efficiency * 100.0f);
-        IOLog("      Early Termination: %s\n", sampler_array_result.sampler_early_termination_used ? "USED" : "NOT USED");
-    }
-    
-    // Phase 3: Secondary Dictionary-Based Sampler Lookup with Hash Optimization
-    IOLog("  Phase 3: Secondary dictionary-based sampler lookup with hash optimization\n");
-    
-    struct SamplerDictionarySearchResult {
-        bool sampler_dict_search_attempted;
-        bool sampler_found_in_dictionary;
-        uint32_t sampler_dictionary_entries_searched;
-        uint32_t sampler_hash_collisions_encountered;
-        uint64_t sampler_dict_search_time_microseconds;
-        float sampler_dictionary_search_efficiency;
-        bool sampler_requires_validation;
-    } sampler_dict_result = {0};
-    
-    if (sampler_lookup_strategy.use_sampler_dictionary_search && !sampler_array_result.sampler_found_in_array) {
-        sampler_dict_result.sampler_dict_search_attempted = true;
-        
-        // Create sampler ID key for dictionary lookup
-        char sampler_key_buffer[32];
-        snprintf(sampler_key_buffer, sizeof(sampler_key_buffer), "sampler_%d", sampler_id);
-        OSString* sampler_key = OSString::withCString(sampler_key_buffer);
-        
-        if (sampler_key) {
-            // Simulate dictionary lookup (in real implementation, would have sampler dictionary)
-            // For demonstration, assume 40% success rate for samplers
-            if ((sampler_id % 5) < 2) { // 2/5 = 40% success rate
-                sampler_dict_result.sampler_found_in_dictionary = true;
-                sampler_dict_result.sampler_dictionary_entries_searched = 1; // Direct hash lookup
-                sampler_dict_result.sampler_hash_collisions_encountered = 0; // No collisions in direct lookup
-                sampler_dict_result.sampler_requires_validation = true;
-                IOLog("      Sampler dictionary lookup: SUCCESSFUL (simulated)\n");
-            } else {
-                sampler_dict_result.sampler_found_in_dictionary = false;
-                sampler_dict_result.sampler_dictionary_entries_searched = 1;
-                IOLog("      Sampler dictionary lookup: NOT FOUND\n");
-            }
-            
-            sampler_key->release();
-        } else {
-            IOLog("      Sampler dictionary lookup: FAILED (key creation error)\n");
-            sampler_dict_result.sampler_dict_search_attempted = false;
-        }
-        
-        // Calculate sampler dictionary search efficiency
-        sampler_dict_result.sampler_dict_search_time_microseconds = 40; // Simulated fast lookup time
-        sampler_dict_result.sampler_dictionary_search_efficiency = sampler_dict_result.sampler_found_in_dictionary ? 1.0f : 0.7f;
-        
-        IOLog("    Sampler Dictionary Search Results:\n");
-        IOLog("      Search Attempted: %s\n", sampler_dict_result.sampler_dict_search_attempted ? "YES" : "NO");
-        IOLog("      Sampler Found: %s\n", sampler_dict_result.sampler_found_in_dictionary ? "YES" : "NO");
-        IOLog("      Entries Searched: %d\n", sampler_dict_result.sampler_dictionary_entries_searched);
-        IOLog("      Hash Collisions: %d\n", sampler_dict_result.sampler_hash_collisions_encountered);
-        IOLog("      Search Time: %llu μs\n", sampler_dict_result.sampler_dict_search_time_microseconds);
-        IOLog("      Search Efficiency: %.1f%%\n", sampler_dict_result.sampler_dictionary_search_efficiency * 100.0f);
-        IOLog("      Requires Validation: %s\n", sampler_dict_result.sampler_requires_validation ? "YES" : "NO");
-    }
-    
-    // Phase 4: Tertiary Cache-Based Sampler Search with LRU Management
-    IOLog("  Phase 4: Tertiary cache-based sampler search with advanced LRU management\n");
-    
-    struct SamplerCacheSearchResult {
-        bool sampler_cache_search_attempted;
-        bool sampler_found_in_cache;
-        uint32_t sampler_cache_entries_searched;
-        uint32_t sampler_cache_hit_count;
-        uint32_t sampler_cache_miss_count;
-        bool sampler_cache_entry_recently_accessed;
-        uint64_t sampler_cache_search_time_microseconds;
-        float sampler_cache_search_efficiency;
-        bool sampler_cache_promotion_required;
-    } sampler_cache_result = {0};
-    
-    if (sampler_lookup_strategy.use_sampler_cache_search && 
-        !sampler_array_result.sampler_found_in_array && 
-        !sampler_dict_result.sampler_found_in_dictionary) {
-        
-        sampler_cache_result.sampler_cache_search_attempted = true;
-        sampler_cache_result.sampler_cache_entries_searched = 16; // Simulated cache size
-        
-        IOLog("    Performing advanced sampler cache search with LRU management\n");
-        IOLog("      Sampler Cache Entries Available: %d\n", sampler_cache_result.sampler_cache_entries_searched);
-        
-        // Simulate sampler cache search (in real implementation, would search sampler cache)
-        // For demonstration, assume 30% cache hit rate for samplers
-        if ((sampler_id % 10) < 3) { // 3/10 = 30% cache hit rate
-            sampler_cache_result.sampler_found_in_cache = true;
-            sampler_cache_result.sampler_cache_hit_count = 1;
-            sampler_cache_result.sampler_cache_entry_recently_accessed = true;
-            sampler_cache_result.sampler_cache_promotion_required = false; // Already at front
-            IOLog("      Sampler cache hit: Sampler found in cache\n");
-        } else {
-            sampler_cache_result.sampler_found_in_cache = false;
-            sampler_cache_result.sampler_cache_miss_count = 1;
-            IOLog("      Sampler cache miss: Sampler not in cache\n");
-        }
-        
-        // Calculate sampler cache search efficiency
-        sampler_cache_result.sampler_cache_search_time_microseconds = 20; // Fast cache access
-        sampler_cache_result.sampler_cache_search_efficiency = sampler_cache_result.sampler_found_in_cache ? 1.0f : 0.0f;
-        
-        IOLog("    Sampler Cache Search Results:\n");
-        IOLog("      Search Attempted: %s\n", sampler_cache_result.sampler_cache_search_attempted ? "YES" : "NO");
-        IOLog("      Sampler Found: %s\n", sampler_cache_result.sampler_found_in_cache ? "YES" : "NO");
-        IOLog("      Entries Searched: %d\n", sampler_cache_result.sampler_cache_entries_searched);
-        IOLog("      Cache Hits: %d\n", sampler_cache_result.sampler_cache_hit_count);
-        IOLog("      Cache Misses: %d\n", sampler_cache_result.sampler_cache_miss_count);
-        IOLog("      Recently Accessed: %s\n", sampler_cache_result.sampler_cache_entry_recently_accessed ? "YES" : "NO");
-        IOLog("      Search Time: %llu μs\n", sampler_cache_result.sampler_cache_search_time_microseconds);
-        IOLog("      Search Efficiency: %.1f%%\n", sampler_cache_result.sampler_cache_search_efficiency * 100.0f);
-        IOLog("      Promotion Required: %s\n", sampler_cache_result.sampler_cache_promotion_required ? "YES" : "NO");
-    }
-    
-    // Phase 5: Comprehensive Sampler Validation and Integrity Verification
-    IOLog("  Phase 5: Comprehensive sampler validation and advanced integrity verification\n");
-    
-    bool sampler_located = sampler_array_result.sampler_found_in_array || 
-                          sampler_dict_result.sampler_found_in_dictionary || 
-                          sampler_cache_result.sampler_found_in_cache;
-    
-    if (sampler_located && sampler_lookup_strategy.enable_sampler_validation) {
-        struct SamplerValidationResult {
-            bool sampler_object_valid;
-            bool sampler_id_matches;
-            bool sampler_state_valid;
-            bool sampler_filter_settings_valid;
-            bool sampler_wrap_mode_valid;
-            bool sampler_anisotropy_valid;
-            uint32_t sampler_validation_flags;
-            float sampler_validation_confidence;
-            bool sampler_safe_to_return;
-        } sampler_validation_result = {0};
-        
-        // In real implementation, would perform comprehensive sampler validation
-        // For now, simulate successful validation
-        sampler_validation_result.sampler_object_valid = true;
-        sampler_validation_result.sampler_id_matches = true;
-        sampler_validation_result.sampler_state_valid = true;
-        sampler_validation_result.sampler_filter_settings_valid = true;
-        sampler_validation_result.sampler_wrap_mode_valid = true;
-        sampler_validation_result.sampler_anisotropy_valid = true;
-        sampler_validation_result.sampler_validation_flags = 0xFF; // All validations passed
-        sampler_validation_result.sampler_validation_confidence = 0.93f; // 93% confidence
-        sampler_validation_result.sampler_safe_to_return = (sampler_validation_result.sampler_validation_confidence >= 0.9f);
-        
-        IOLog("    Sampler Deep Validation Results:\n");
-        IOLog("      Sampler Object Valid: %s\n", sampler_validation_result.sampler_object_valid ? "YES" : "NO");
-        IOLog("      Sampler ID Matches: %s\n", sampler_validation_result.sampler_id_matches ? "YES" : "NO");
-        IOLog("      Sampler State Valid: %s\n", sampler_validation_result.sampler_state_valid ? "YES" : "NO");
-        IOLog("      Filter Settings Valid: %s\n", sampler_validation_result.sampler_filter_settings_valid ? "YES" : "NO");
-        IOLog("      Wrap Mode Valid: %s\n", sampler_validation_result.sampler_wrap_mode_valid ? "YES" : "NO");
-        IOLog("      Anisotropy Valid: %s\n", sampler_validation_result.sampler_anisotropy_valid ? "YES" : "NO");
-        IOLog("      Validation Flags: 0x%02X\n", sampler_validation_result.sampler_validation_flags);
-        IOLog("      Validation Confidence: %.1f%%\n", sampler_validation_result.sampler_validation_confidence * 100.0f);
-        IOLog("      Safe to Return: %s\n", sampler_validation_result.sampler_safe_to_return ? "YES" : "NO");
-        
-        if (!sampler_validation_result.sampler_safe_to_return) {
-            IOLog("    ERROR: Sampler validation failed - unsafe to return\n");
-            sampler_located = false;
-            found_sampler = nullptr;
-        }
-    }
+    IOLockLock(m_texture_lock);
+    TextureSampler* sampler = m_sampler_table.remove(sampler_id);
+    IOLockUnlock(m_texture_lock);
     
-    // Phase 6: Sampler Access Statistics Update and Performance Metrics
-    IOLog("  Phase 6: Sampler access statistics update and comprehensive performance metrics\n");
-    
-    if (sampler_located && sampler_lookup_strategy.enable_sampler_access_tracking) {
-        struct SamplerAccessStatisticsUpdate {
-            uint64_t sampler_lookup_timestamp;
-            uint32_t sampler_access_count_increment;
-            uint32_t sampler_total_lookup_operations;
-            uint64_t sampler_cumulative_search_time;
-            float sampler_average_search_efficiency;
-            bool sampler_update_lru_position;
-            bool sampler_cache_promotion_performed;
-        } sampler_stats_update = {0};
-        
-        // Configure sampler access statistics update
-        sampler_stats_update.sampler_lookup_timestamp = 0; // Would use mach_absolute_time() in real implementation
-        sampler_stats_update.sampler_access_count_increment = 1;
-        sampler_stats_update.sampler_total_lookup_operations = 1;
-        sampler_stats_update.sampler_cumulative_search_time = sampler_array_result.sampler_search_time_microseconds + 
-                                                             sampler_dict_result.sampler_dict_search_time_microseconds + 
-                                                             sampler_cache_result.sampler_cache_search_time_microseconds;
-        sampler_stats_update.sampler_average_search_efficiency = (sampler_array_result.sampler_array_search_efficiency + 
-                                                                 sampler_dict_result.sampler_dictionary_search_efficiency + 
-                                                                 sampler_cache_result.sampler_cache_search_efficiency) / 3.0f;
-        sampler_stats_update.sampler_update_lru_position = true;
-        sampler_stats_update.sampler_cache_promotion_performed = sampler_cache_result.sampler_cache_promotion_required;
-        
-        IOLog("    Sampler Access Statistics Update:\n");
-        IOLog("      Lookup Timestamp: %llu\n", sampler_stats_update.sampler_lookup_timestamp);
-        IOLog("      Access Count Increment: %d\n", sampler_stats_update.sampler_access_count_increment);
-        IOLog("      Total Lookup Operations: %d\n", sampler_stats_update.sampler_total_lookup_operations);
-        IOLog("      Cumulative Search Time: %llu μs\n", sampler_stats_update.sampler_cumulative_search_time);
-        IOLog("      Average Search Efficiency: %.1f%%\n", sampler_stats_update.sampler_average_search_efficiency * 100.0f);
-        IOLog("      LRU Position Update: %s\n", sampler_stats_update.sampler_update_lru_position ? "YES" : "NO");
-        IOLog("      Cache Promotion Performed: %s\n", sampler_stats_update.sampler_cache_promotion_performed ? "YES" : "NO");
-        
-        // In real implementation, would update TextureSampler access statistics
-        IOLog("    Updating sampler access tracking data\n");
-    }
-    
-    // Generate comprehensive sampler search summary
-    IOLog("VMTextureManager::findSampler: ========== Sampler Lookup Complete ==========\n");
-    IOLog("  Search Target: Sampler ID %d\n", sampler_id);
-    IOLog("  Search Result: %s\n", sampler_located ? "FOUND" : "NOT FOUND");
-    if (sampler_located) {
-        IOLog("  Found Via: %s\n", 
-              sampler_array_result.sampler_found_in_array ? "ARRAY" :
-              sampler_dict_result.sampler_found_in_dictionary ? "DICTIONARY" :
-              sampler_cache_result.sampler_found_in_cache ? "CACHE" : "UNKNOWN");
-        IOLog("  Search Operations: A:%d D:%d C:%d\n", 
-              sampler_array_result.sampler_array_entries_searched,
-              sampler_dict_result.sampler_dictionary_entries_searched, 
-              sampler_cache_result.sampler_cache_entries_searched);
-        IOLog("  Total Search Time: %llu μs\n", 
-              sampler_array_result.sampler_search_time_microseconds + 
-              sampler_dict_result.sampler_dict_search_time_microseconds + 
-              sampler_cache_result.sampler_cache_search_time_microseconds);
-        IOLog("  Overall Efficiency: %.1f%%\n", 
-              ((sampler_array_result.sampler_array_search_efficiency + 
-                sampler_dict_result.sampler_dictionary_search_efficiency + 
-                sampler_cache_result.sampler_cache_search_efficiency) / 3.0f) * 100.0f);
-    } else {
-        IOLog("  Searches Performed: Array:%s Dictionary:%s Cache:%s\n",
-              sampler_array_result.sampler_search_attempted ? "YES" : "NO",
-              sampler_dict_result.sampler_dict_search_attempted ? "YES" : "NO", 
-              sampler_cache_result.sampler_cache_search_attempted ? "YES" : "NO");
+    if (!sampler) {
+        return kIOReturnNotFound;
     }
-    IOLog("==============================================================================\n");
-    
-    return found_sampler; // Return located sampler or nullptr if not found
+    delete sampler;
+    return kIOReturnSuccess;
 }
 
 uint32_t CLASS::calculateTextureSize(const VMTextureDescriptor* descriptor)
 {
     // Advanced Texture Size Calculation System - Comprehensive Memory Analysis and Optimization
     if (!descriptor) {
-        IOLog("VMTextureManager::calculateTextureSize: Invalid descriptor parameter (null pointer)\n");
+        VMLOG_WARN("VMTextureManager::calculateTextureSize: Invalid descriptor parameter (null pointer)\n");
         return 0;
     }
     
-    IOLog("VMTextureManager::calculateTextureSize: Initiating advanced texture size calculation\n");
+    VMLOG_DEBUG("VMTextureManager::calculateTextureSize: Initiating advanced texture size calculation\n");
     
     // Phase 1: Advanced Descriptor Analysis and Validation
-    IOLog("  Phase 1: Advanced descriptor analysis and comprehensive validation\n");
+    VMLOG_DEBUG("  Phase 1: Advanced descriptor analysis and comprehensive validation\n");
     
     struct TextureSizeAnalysis {
         uint32_t texture_width;
@@ -8924,29 +8210,29 @@ uint32_t CLASS::calculateTextureSize(const VMTextureDescriptor* descriptor)
     if (size_analysis.requires_alignment) analysis_checks_passed++;
     size_analysis.analysis_confidence = (float)analysis_checks_passed / (float)total_analysis_checks;
     
-    IOLog("    Texture Size Analysis Results:\n");
-    IOLog("      Dimensions: %dx%dx%d - %s\n", 
+    VMLOG_DEBUG("    Texture Size Analysis Results:\n");
+    VMLOG_DEBUG("      Dimensions: %dx%dx%d - %s\n", 
           size_analysis.texture_width, size_analysis.texture_height, size_analysis.texture_depth,
           size_analysis.has_valid_dimensions ? "VALID" : "INVALID");
-    IOLog("      Array Length: %d\n", size_analysis.texture_array_length);
-    IOLog("      Mipmap Levels: %d\n", size_analysis.texture_mipmap_levels);
-    IOLog("      Sample Count: %d\n", size_analysis.texture_sample_count);
-    IOLog("      Pixel Format: %d - %s\n", size_analysis.texture_pixel_format,
+    VMLOG_DEBUG("      Array Length: %d\n", size_analysis.texture_array_length);
+    VMLOG_DEBUG("      Mipmap Levels: %d\n", size_analysis.texture_mipmap_levels);
+    VMLOG_DEBUG("      Sample Count: %d\n", size_analysis.texture_sample_count);
+    VMLOG_DEBUG("      Pixel Format: %d - %s\n", size_analysis.texture_pixel_format,
           size_analysis.has_valid_format ? "VALID" : "INVALID");
-    IOLog("      Requires Alignment: %s\n", size_analysis.requires_alignment ? "YES" : "NO");
-    IOLog("      Supports Compression: %s\n", size_analysis.supports_compression ? "YES" : "NO");
-    IOLog("      Analysis Confidence: %.1f%% (%d/%d checks passed)\n", 
+    VMLOG_DEBUG("      Requires Alignment: %s\n", size_analysis.requires_alignment ? "YES" : "NO");
+    VMLOG_DEBUG("      Supports Compression: %s\n", size_analysis.supports_compression ? "YES" : "NO");
+    VMLOG_DEBUG("      Analysis Confidence: %.1f%% (%d/%d checks passed)\n", 
           size_analysis.analysis_confidence * 100.0f, analysis_checks_passed, total_analysis_checks);
     
     // Early return for invalid descriptors
     if (size_analysis.analysis_confidence < 0.66f) { // Require 66% confidence minimum
-        IOLog("    ERROR: Texture descriptor validation failed (%.1f%% confidence)\n", 
+        VMLOG_ERROR("    ERROR: Texture descriptor validation failed (%.1f%% confidence)\n", 
               size_analysis.analysis_confidence * 100.0f);
         return 0;
     }
     
     // Phase 2: Advanced Pixel Format Analysis and Byte Size Calculation
-    IOLog("  Phase 2: Advanced pixel format analysis and comprehensive byte size calculation\n");
+    VMLOG_DEBUG("  Phase 2: Advanced pixel format analysis and comprehensive byte size calculation\n");
     
     struct PixelFormatAnalysis {
         uint32_t bytes_per_pixel;
@@ -9057,23 +8343,23 @@ uint32_t CLASS::calculateTextureSize(const VMTextureDescriptor* descriptor)
             format_analysis.is_normalized_format = true;
             format_analysis.requires_special_handling = true;
             format_analysis.format_efficiency_factor = 1.0f;
-            IOLog("    WARNING: Unknown pixel format %d, using safe defaults\n", size_analysis.texture_pixel_format);
+            VMLOG_DEBUG("    WARNING: Unknown pixel format %d, using safe defaults\n", size_analysis.texture_pixel_format);
             break;
     }
     
-    IOLog("    Pixel Format Analysis Results:\n");
-    IOLog("      Bytes per Pixel: %d\n", format_analysis.bytes_per_pixel);
-    IOLog("      Bits per Pixel: %d\n", format_analysis.bits_per_pixel);
-    IOLog("      Component Count: %d\n", format_analysis.component_count);
-    IOLog("      Has Alpha Channel: %s\n", format_analysis.has_alpha_channel ? "YES" : "NO");
-    IOLog("      Is Floating Point: %s\n", format_analysis.is_floating_point ? "YES" : "NO");
-    IOLog("      Is Compressed: %s\n", format_analysis.is_compressed_format ? "YES" : "NO");
-    IOLog("      Is Normalized: %s\n", format_analysis.is_normalized_format ? "YES" : "NO");
-    IOLog("      Requires Special Handling: %s\n", format_analysis.requires_special_handling ? "YES" : "NO");
-    IOLog("      Format Efficiency Factor: %.2f\n", format_analysis.format_efficiency_factor);
+    VMLOG_DEBUG("    Pixel Format Analysis Results:\n");
+    VMLOG_DEBUG("      Bytes per Pixel: %d\n", format_analysis.bytes_per_pixel);
+    VMLOG_DEBUG("      Bits per Pixel: %d\n", format_analysis.bits_per_pixel);
+    VMLOG_DEBUG("      Component Count: %d\n", format_analysis.component_count);
+    VMLOG_DEBUG("      Has Alpha Channel: %s\n", format_analysis.has_alpha_channel ? "YES" : "NO");
+    VMLOG_DEBUG("      Is Floating Point: %s\n", format_analysis.is_floating_point ? "YES" : "NO");
+    VMLOG_DEBUG("      Is Compressed: %s\n", format_analysis.is_compressed_format ? "YES" : "NO");
+    VMLOG_DEBUG("      Is Normalized: %s\n", format_analysis.is_normalized_format ? "YES" : "NO");
+    VMLOG_DEBUG("      Requires Special Handling: %s\n", format_analysis.requires_special_handling ? "YES" : "NO");
+    VMLOG_DEBUG("      Format Efficiency Factor: %.2f\n", format_analysis.format_efficiency_factor);
     
     // Phase 3: Comprehensive Memory Size Calculation with Optimization
-    IOLog("  Phase 3: Comprehensive memory size calculation with advanced optimization\n");
+    VMLOG_DEBUG("  Phase 3: Comprehensive memory size calculation with advanced optimization\n");
     
     struct MemorySizeCalculation {
         uint64_t base_texture_size;
@@ -9097,7 +8383,7 @@ uint32_t CLASS::calculateTextureSize(const VMTextureDescriptor* descriptor)
     // Calculate mipmap overhead (approximately 33% additional memory)
     if (size_analysis.texture_mipmap_levels > 1) {
         memory_calc.mipmap_overhead_size = memory_calc.base_texture_size / 3; // ~33% overhead
-        IOLog("      Mipmap overhead calculated: %llu bytes for %d levels\n", 
+        VMLOG_DEBUG("      Mipmap overhead calculated: %llu bytes for %d levels\n", 
               memory_calc.mipmap_overhead_size, size_analysis.texture_mipmap_levels);
     }
     
@@ -9107,7 +8393,7 @@ uint32_t CLASS::calculateTextureSize(const VMTextureDescriptor* descriptor)
     // Calculate multisampling overhead
     if (size_analysis.texture_sample_count > 1) {
         memory_calc.multisampling_overhead = memory_calc.base_texture_size * (size_analysis.texture_sample_count - 1);
-        IOLog("      Multisampling overhead: %llu bytes for %dx samples\n", 
+        VMLOG_DEBUG("      Multisampling overhead: %llu bytes for %dx samples\n", 
               memory_calc.multisampling_overhead, size_analysis.texture_sample_count);
     }
     
@@ -9137,22 +8423,22 @@ uint32_t CLASS::calculateTextureSize(const VMTextureDescriptor* descriptor)
     memory_calc.memory_efficiency_ratio = (float)memory_calc.base_texture_size / 
                                          (float)memory_calc.total_calculated_size;
     
-    IOLog("    Memory Size Calculation Results:\n");
-    IOLog("      Base Texture Size: %llu bytes (%.2f MB)\n", 
+    VMLOG_DEBUG("    Memory Size Calculation Results:\n");
+    VMLOG_DEBUG("      Base Texture Size: %llu bytes (%.2f MB)\n", 
           memory_calc.base_texture_size, (float)memory_calc.base_texture_size / (1024.0f * 1024.0f));
-    IOLog("      Mipmap Overhead: %llu bytes\n", memory_calc.mipmap_overhead_size);
-    IOLog("      Array Factor: %llu\n", memory_calc.array_multiplication_factor);
-    IOLog("      Multisampling Overhead: %llu bytes\n", memory_calc.multisampling_overhead);
-    IOLog("      Alignment Requirement: %d bytes\n", memory_calc.memory_alignment_requirement);
-    IOLog("      Alignment Padding: %llu bytes\n", memory_calc.alignment_padding);
-    IOLog("      Metadata Overhead: %llu bytes\n", memory_calc.metadata_overhead);
-    IOLog("      Total Calculated Size: %llu bytes (%.2f MB)\n", 
+    VMLOG_DEBUG("      Mipmap Overhead: %llu bytes\n", memory_calc.mipmap_overhead_size);
+    VMLOG_DEBUG("      Array Factor: %llu\n", memory_calc.array_multiplication_factor);
+    VMLOG_DEBUG("      Multisampling Overhead: %llu bytes\n", memory_calc.multisampling_overhead);
+    VMLOG_DEBUG("      Alignment Requirement: %d bytes\n", memory_calc.memory_alignment_requirement);
+    VMLOG_DEBUG("      Alignment Padding: %llu bytes\n", memory_calc.alignment_padding);
+    VMLOG_DEBUG("      Metadata Overhead: %llu bytes\n", memory_calc.metadata_overhead);
+    VMLOG_DEBUG("      Total Calculated Size: %llu bytes (%.2f MB)\n", 
           memory_calc.total_calculated_size, (float)memory_calc.total_calculated_size / (1024.0f * 1024.0f));
-    IOLog("      Exceeds Size Limits: %s\n", memory_calc.exceeds_size_limits ? "YES" : "NO");
-    IOLog("      Memory Efficiency Ratio: %.2f%%\n", memory_calc.memory_efficiency_ratio * 100.0f);
+    VMLOG_DEBUG("      Exceeds Size Limits: %s\n", memory_calc.exceeds_size_limits ? "YES" : "NO");
+    VMLOG_DEBUG("      Memory Efficiency Ratio: %.2f%%\n", memory_calc.memory_efficiency_ratio * 100.0f);
     
     // Phase 4: Size Validation and Optimization Recommendations
-    IOLog("  Phase 4: Size validation and advanced optimization recommendations\n");
+    VMLOG_DEBUG("  Phase 4: Size validation and advanced optimization recommendations\n");
     
     struct SizeValidationResult {
         bool size_within_limits;
@@ -9174,43 +8460,43 @@ uint32_t CLASS::calculateTextureSize(const VMTextureDescriptor* descriptor)
     
     // Calculate final validated size (ensure it fits in uint32_t)
     if (memory_calc.total_calculated_size > UINT32_MAX) {
-        IOLog("    WARNING: Calculated size exceeds uint32_t maximum, clamping to maximum value\n");
+        VMLOG_DEBUG("    WARNING: Calculated size exceeds uint32_t maximum, clamping to maximum value\n");
         validation_result.final_validated_size = UINT32_MAX;
     } else {
         validation_result.final_validated_size = (uint32_t)memory_calc.total_calculated_size;
     }
     
-    IOLog("    Size Validation Results:\n");
-    IOLog("      Size Within Limits: %s\n", validation_result.size_within_limits ? "YES" : "NO");
-    IOLog("      Efficiently Calculated: %s\n", validation_result.size_efficiently_calculated ? "YES" : "NO");
-    IOLog("      Requires Compression: %s\n", validation_result.requires_compression ? "YES" : "NO");
-    IOLog("      Benefits from Optimization: %s\n", validation_result.benefits_from_optimization ? "YES" : "NO");
-    IOLog("      Recommended Alignment: %d bytes\n", validation_result.recommended_alignment);
-    IOLog("      Compression Potential: %.1f%%\n", validation_result.compression_potential * 100.0f);
-    IOLog("      Final Validated Size: %u bytes (%.2f MB)\n", 
+    VMLOG_DEBUG("    Size Validation Results:\n");
+    VMLOG_DEBUG("      Size Within Limits: %s\n", validation_result.size_within_limits ? "YES" : "NO");
+    VMLOG_DEBUG("      Efficiently Calculated: %s\n", validation_result.size_efficiently_calculated ? "YES" : "NO");
+    VMLOG_DEBUG("      Requires Compression: %s\n", validation_result.requires_compression ? "YES" : "NO");
+    VMLOG_DEBUG("      Benefits from Optimization: %s\n", validation_result.benefits_from_optimization ? "YES" : "NO");
+    VMLOG_DEBUG("      Recommended Alignment: %d bytes\n", validation_result.recommended_alignment);
+    VMLOG_DEBUG("      Compression Potential: %.1f%%\n", validation_result.compression_potential * 100.0f);
+    VMLOG_DEBUG("      Final Validated Size: %u bytes (%.2f MB)\n", 
           validation_result.final_validated_size, 
           (float)validation_result.final_validated_size / (1024.0f * 1024.0f));
     
     // Generate comprehensive calculation summary
-    IOLog("VMTextureManager::calculateTextureSize: ========== Size Calculation Complete ==========\n");
-    IOLog("  Input Dimensions: %dx%dx%d\n", 
+    VMLOG_DEBUG("VMTextureManager::calculateTextureSize: ========== Size Calculation Complete ==========\n");
+    VMLOG_DEBUG("  Input Dimensions: %dx%dx%d\n", 
           size_analysis.texture_width, size_analysis.texture_height, size_analysis.texture_depth);
-    IOLog("  Pixel Format: %d (%d bytes/pixel)\n", 
+    VMLOG_DEBUG("  Pixel Format: %d (%d bytes/pixel)\n", 
           size_analysis.texture_pixel_format, format_analysis.bytes_per_pixel);
-    IOLog("  Mipmap Levels: %d\n", size_analysis.texture_mipmap_levels);
-    IOLog("  Array Length: %d\n", size_analysis.texture_array_length);
-    IOLog("  Sample Count: %d\n", size_analysis.texture_sample_count);
-    IOLog("  Base Size: %.2f MB\n", (float)memory_calc.base_texture_size / (1024.0f * 1024.0f));
-    IOLog("  Total Overhead: %.2f MB\n", 
+    VMLOG_DEBUG("  Mipmap Levels: %d\n", size_analysis.texture_mipmap_levels);
+    VMLOG_DEBUG("  Array Length: %d\n", size_analysis.texture_array_length);
+    VMLOG_DEBUG("  Sample Count: %d\n", size_analysis.texture_sample_count);
+    VMLOG_DEBUG("  Base Size: %.2f MB\n", (float)memory_calc.base_texture_size / (1024.0f * 1024.0f));
+    VMLOG_DEBUG("  Total Overhead: %.2f MB\n", 
           (float)(memory_calc.mipmap_overhead_size + memory_calc.multisampling_overhead + 
                  memory_calc.alignment_padding + memory_calc.metadata_overhead) / (1024.0f * 1024.0f));
-    IOLog("  Final Calculated Size: %u bytes (%.2f MB)\n", 
+    VMLOG_DEBUG("  Final Calculated Size: %u bytes (%.2f MB)\n", 
           validation_result.final_validated_size,
           (float)validation_result.final_validated_size / (1024.0f * 1024.0f));
-    IOLog("  Memory Efficiency: %.1f%%\n", memory_calc.memory_efficiency_ratio * 100.0f);
-    IOLog("  Optimization Status: %s\n", 
+    VMLOG_DEBUG("  Memory Efficiency: %.1f%%\n", memory_calc.memory_efficiency_ratio * 100.0f);
+    VMLOG_DEBUG("  Optimization Status: %s\n", 
           validation_result.benefits_from_optimization ? "RECOMMENDED" : "OPTIMAL");
-    IOLog("==================================================================================\n");
+    VMLOG_DEBUG("==================================================================================\n");
     
     return validation_result.final_validated_size;
 }
@@ -9224,7 +8510,7 @@ IOReturn CLASS::unbindTexture(uint32_t context_id, uint32_t binding_point)
     
     IOLockLock(m_texture_lock);
     
-    IOLog("VMTextureManager: Unbinding texture from context %u, binding point %u\n", 
+    VMLOG_DEBUG("VMTextureManager: Unbinding texture from context %u, binding point %u\n", 
           context_id, binding_point);
     
     // Find and unbind the texture if bound
@@ -9243,14 +8529,14 @@ IOReturn CLASS::bindTexture(uint32_t context_id, uint32_t binding_point, uint32_
     
     IOLockLock(m_texture_lock);
     
-    IOLog("VMTextureManager: Binding texture %u to context %u, binding point %u\n", 
+    VMLOG_DEBUG("VMTextureManager: Binding texture %u to context %u, binding point %u\n", 
           texture_id, context_id, binding_point);
     
     // Validate texture exists
     ManagedTexture* texture = findTexture(texture_id);
     if (!texture && texture_id != 0) {
         IOLockUnlock(m_texture_lock);
-        IOLog("VMTextureManager::bindTexture: Texture %u not found\n", texture_id);
+        VMLOG_DEBUG("VMTextureManager::bindTexture: Texture %u not found\n", texture_id);
         return kIOReturnBadArgument;
     }
     
@@ -9278,6 +8564,6 @@ void CLASS::updateAccessTime(ManagedTexture* texture)
     // Update texture access time (would use mach_absolute_time() in real implementation)
     texture->last_accessed = 0; // Simulated timestamp
     
-    IOLog("VMTextureManager::updateAccessTime: Updated access time for texture %u\n", 
+    VMLOG_DEBUG("VMTextureManager::updateAccessTime: Updated access time for texture %u\n", 
           texture->texture_id);
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <IOKit/IOService.h>
 #include <IOKit/IOMemoryDescriptor.h>
 #include "VMQemuVGAMetal.h"
+#include "VMHandleTable.h"
 
 // Texture types
 enum VMTextureType {
@@ -133,12 +134,15 @@ class VMTextureManager : public OSObject
 private:
     VMQemuVGAAccelerator* m_accelerator;
     VMVirtIOGPU* m_gpu_device;
+    uint32_t m_blit_context_id;     // virgl context for mip blits, created on first use
     
-    // Texture storage
+    // Texture storage: texture and sampler ids are handles into the tables
+    struct ManagedTexture;
+    struct TextureSampler;
     OSArray* m_textures;
     OSArray* m_samplers;
-    uint32_t m_next_texture_id;
-    uint32_t m_next_sampler_id;
+    VMHandleTable<ManagedTexture> m_texture_table;
+    VMHandleTable<TextureSampler> m_sampler_table;
     
     IOLock* m_texture_lock;
     
@@ -155,7 +159,7 @@ private:
     // Texture entry
     struct ManagedTexture {
         uint32_t texture_id;
-        uint32_t gpu_resource_id;
+        uint32_t gpu_resource_id;   // host copy for mip blits; 0 until the first one
         VMTextureDescriptor descriptor;
         IOMemoryDescriptor* data;
         uint32_t data_size;
@@ -193,8 +197,20 @@ private:
     IOReturn uploadTextureData(ManagedTexture* texture, uint32_t mip_level,
                               const VMTextureRegion* region, 
                               IOMemoryDescriptor* data);
-    IOReturn generateMipmaps(ManagedTexture* texture);
-    IOReturn compressTexture(ManagedTexture* texture, VMTextureCompression compression);
+    // Fills levels base_level+1..max_level from base_level: virgl blits on
+    // the host when 3D is up, VMMipmap on the guest copy otherwise
+    IOReturn generateMipmaps(ManagedTexture* texture, uint32_t base_level, uint32_t max_level);
+    IOReturn ensureHostTexture(ManagedTexture* texture, uint32_t virgl_format, uint32_t last_level);
+    void releaseHostTexture(ManagedTexture* texture);
+    IOReturn blitMipmapsOnHost(ManagedTexture* texture, uint32_t virgl_format, uint32_t channels,
+                               uint32_t base_level, uint32_t max_level, uint32_t last_level);
+    IOReturn downsampleMipmapsOnCPU(ManagedTexture* texture, uint32_t channels, bool srgb,
+                                    uint32_t base_level, uint32_t max_level);
+    // Encodes every level the guest copy holds with VMBlockCompress;
+    // quality is the 0-100 setting of VMTextureManagerDescriptor
+    IOReturn compressTexture(ManagedTexture* texture, VMTextureCompression compression, uint32_t quality);
+    // Replaces a BC1-BC5 texture's guest copy with an RGBA8 chain
+    IOReturn expandBlockTexture(ManagedTexture* texture);
     
     uint32_t calculateTextureSize(const VMTextureDescriptor* descriptor);
     uint32_t calculateMipSize(uint32_t width, uint32_t height, uint32_t depth,
@@ -1,6 +1,7 @@
 #include "VMVirtIOAGDC.h"
 #include "VMVirtIOFramebuffer.h"
 #include "VMVirtIOGPU.h"
+#include "VMLog.h"
 
 OSDefineMetaClassAndStructors(VMVirtIOAGDC, IOService);
 OSDefineMetaClassAndStructors(VMVirtIOAGDCUserClient, IOUserClient);
@@ -9,10 +10,10 @@ OSDefineMetaClassAndStructors(VMVirtIOAGDCUserClient, IOUserClient);
 
 bool VMVirtIOAGDC::init(OSDictionary* properties)
 {
-    IOLog("VMVirtIOAGDC::init() - Initializing AGDC service\n");
+    VMLOG_INFO("VMVirtIOAGDC::init() - Initializing AGDC service\n");
     
     if (!IOService::init(properties)) {
-        IOLog("VMVirtIOAGDC::init() - Super init failed\n");
+        VMLOG_ERROR("VMVirtIOAGDC::init() - Super init failed\n");
         return false;
     }
     
@@ -32,17 +33,17 @@ bool VMVirtIOAGDC::init(OSDictionary* properties)
     // Create thread safety lock
     m_lock = IOLockAlloc();
     if (!m_lock) {
-        IOLog("VMVirtIOAGDC::init() - Failed to allocate lock\n");
+        VMLOG_ERROR("VMVirtIOAGDC::init() - Failed to allocate lock\n");
         return false;
     }
     
-    IOLog("VMVirtIOAGDC::init() - AGDC service initialized successfully\n");
+    VMLOG_INFO("VMVirtIOAGDC::init() - AGDC service initialized successfully\n");
     return true;
 }
 
 void VMVirtIOAGDC::free()
 {
-    IOLog("VMVirtIOAGDC::free() - Cleaning up AGDC service\n");
+    VMLOG_INFO("VMVirtIOAGDC::free() - Cleaning up AGDC service\n");
     
     if (m_lock) {
         IOLockFree(m_lock);
@@ -54,10 +55,10 @@ void VMVirtIOAGDC::free()
 
 bool VMVirtIOAGDC::start(IOService* provider)
 {
-    IOLog("VMVirtIOAGDC::start() - Starting AGDC service\n");
+    VMLOG_INFO("VMVirtIOAGDC::start() - Starting AGDC service\n");
     
     if (!IOService::start(provider)) {
-        IOLog("VMVirtIOAGDC::start() - Super start failed\n");
+        VMLOG_ERROR("VMVirtIOAGDC::start() - Super start failed\n");
         return false;
     }
     
@@ -66,28 +67,28 @@ bool VMVirtIOAGDC::start(IOService* provider)
     m_gpu_device = OSDynamicCast(VMVirtIOGPU, provider);
     
     if (!m_framebuffer && !m_gpu_device) {
-        IOLog("VMVirtIOAGDC::start() - Provider is neither VMVirtIOFramebuffer nor VMVirtIOGPU\n");
+        VMLOG_INFO("VMVirtIOAGDC::start() - Provider is neither VMVirtIOFramebuffer nor VMVirtIOGPU\n");
         return false;
     }
     
     // If provider is GPU device, we need to find the framebuffer
     if (m_gpu_device && !m_framebuffer) {
-        IOLog("VMVirtIOAGDC::start() - AGDC attached to GPU device, will discover framebuffer dynamically\n");
+        VMLOG_INFO("VMVirtIOAGDC::start() - AGDC attached to GPU device, will discover framebuffer dynamically\n");
     }
     
-    IOLog("VMVirtIOAGDC::start() - AGDC provider: framebuffer=%p, gpu=%p\n", m_framebuffer, m_gpu_device);
+    VMLOG_INFO("VMVirtIOAGDC::start() - AGDC provider: framebuffer=%p, gpu=%p\n", m_framebuffer, m_gpu_device);
     
     // Initialize AGDC service
     IOReturn result = initializeAGDCService();
     if (result != kIOReturnSuccess) {
-        IOLog("VMVirtIOAGDC::start() - Failed to initialize AGDC service: 0x%x\n", result);
+        VMLOG_ERROR("VMVirtIOAGDC::start() - Failed to initialize AGDC service: 0x%x\n", result);
         return false;
     }
     
     // Register with GPU Wrangler
     result = registerWithGPUWrangler();
     if (result != kIOReturnSuccess) {
-        IOLog("VMVirtIOAGDC::start() - Failed to register with GPU Wrangler: 0x%x\n", result);
+        VMLOG_ERROR("VMVirtIOAGDC::start() - Failed to register with GPU Wrangler: 0x%x\n", result);
         // Continue anyway - some VM environments may not have full GPU Wrangler support
     }
     
@@ -105,15 +106,15 @@ bool VMVirtIOAGDC::start(IOService* provider)
     // Try to attach to AppleGraphicsDeviceControlPlugin for GPU Wrangler visibility
     IOService *agdcPlugin = IOService::waitForMatchingService(IOService::nameMatching("AppleGraphicsDeviceControlPlugin"), 2000000000ULL);
     if (agdcPlugin) {
-        IOLog("VMVirtIOAGDC::start() - Found AppleGraphicsDeviceControlPlugin, attaching as child\n");
+        VMLOG_INFO("VMVirtIOAGDC::start() - Found AppleGraphicsDeviceControlPlugin, attaching as child\n");
         if (attach(agdcPlugin)) {
-            IOLog("VMVirtIOAGDC::start() - Successfully attached to AppleGraphicsDeviceControlPlugin\n");
+            VMLOG_INFO("VMVirtIOAGDC::start() - Successfully attached to AppleGraphicsDeviceControlPlugin\n");
         } else {
-            IOLog("VMVirtIOAGDC::start() - Failed to attach to AppleGraphicsDeviceControlPlugin\n");
+            VMLOG_ERROR("VMVirtIOAGDC::start() - Failed to attach to AppleGraphicsDeviceControlPlugin\n");
         }
         agdcPlugin->release();
     } else {
-        IOLog("VMVirtIOAGDC::start() - AppleGraphicsDeviceControlPlugin not found or timeout\n");
+        VMLOG_WARN("VMVirtIOAGDC::start() - AppleGraphicsDeviceControlPlugin not found or timeout\n");
     }
     
     // DO NOT register service - Apple AGDC services show as !registered in IORegistry
@@ -127,7 +128,7 @@ bool VMVirtIOAGDC::start(IOService* provider)
     char agdc_resource_name[64];
     snprintf(agdc_resource_name, sizeof(agdc_resource_name), "AGDC-1AF4-1050");
     publishResource(agdc_resource_name, this);
-    IOLog("VMVirtIOAGDC::start() - Published AGDC resource: %s\n", agdc_resource_name);
+    VMLOG_INFO("VMVirtIOAGDC::start() - Published AGDC resource: %s\n", agdc_resource_name);
     
     // Also try GPU Wrangler specific format using registry ID  
     if (m_gpu_device) {
@@ -135,11 +136,11 @@ bool VMVirtIOAGDC::start(IOService* provider)
         snprintf(gpu_agdc_name, sizeof(gpu_agdc_name), "AGDC-GPU-%llx", 
                  m_gpu_device->getRegistryEntryID());
         publishResource(gpu_agdc_name, this);
-        IOLog("VMVirtIOAGDC::start() - Published GPU-specific AGDC resource: %s\n", gpu_agdc_name);
+        VMLOG_INFO("VMVirtIOAGDC::start() - Published GPU-specific AGDC resource: %s\n", gpu_agdc_name);
         
         // And the generic AGDC service name
         publishResource("AGDCService", this);
-        IOLog("VMVirtIOAGDC::start() - Published generic AGDC service resource\n");
+        VMLOG_INFO("VMVirtIOAGDC::start() - Published generic AGDC service resource\n");
     }
     
     // Also publish with GPU registry ID for direct association
@@ -148,16 +149,16 @@ bool VMVirtIOAGDC::start(IOService* provider)
         char gpu_agdc_name[64]; 
         snprintf(gpu_agdc_name, sizeof(gpu_agdc_name), "AGDC-GPU-%llx", gpu_for_resource->getRegistryEntryID());
         publishResource(gpu_agdc_name, this);
-        IOLog("VMVirtIOAGDC::start() - Published GPU-specific AGDC resource: %s\n", gpu_agdc_name);
+        VMLOG_INFO("VMVirtIOAGDC::start() - Published GPU-specific AGDC resource: %s\n", gpu_agdc_name);
     }
     
-    IOLog("VMVirtIOAGDC::start() - AGDC service started successfully\n");
+    VMLOG_INFO("VMVirtIOAGDC::start() - AGDC service started successfully\n");
     return true;
 }
 
 void VMVirtIOAGDC::stop(IOService* provider)
 {
-    IOLog("VMVirtIOAGDC::stop() - Stopping AGDC service\n");
+    VMLOG_INFO("VMVirtIOAGDC::stop() - Stopping AGDC service\n");
     
     // Unregister from GPU Wrangler
     if (m_agdc_registered) {
@@ -170,41 +171,41 @@ void VMVirtIOAGDC::stop(IOService* provider)
 IOReturn VMVirtIOAGDC::newUserClient(task_t owningTask, void* securityID, UInt32 type,
                                      OSDictionary* properties, IOUserClient** handler)
 {
-    IOLog("VMVirtIOAGDC::newUserClient() - IOPresentment requesting AGDC user client, type=%d\n", type);
+    VMLOG_INFO("VMVirtIOAGDC::newUserClient() - IOPresentment requesting AGDC user client, type=%d\n", type);
     
     VMVirtIOAGDCUserClient* client = new VMVirtIOAGDCUserClient;
     if (!client) {
-        IOLog("VMVirtIOAGDC::newUserClient() - Failed to allocate AGDC user client\n");
+        VMLOG_ERROR("VMVirtIOAGDC::newUserClient() - Failed to allocate AGDC user client\n");
         return kIOReturnNoMemory;
     }
     
     if (!client->initWithTask(owningTask, securityID, type, properties)) {
-        IOLog("VMVirtIOAGDC::newUserClient() - Failed to initialize AGDC user client\n");
+        VMLOG_ERROR("VMVirtIOAGDC::newUserClient() - Failed to initialize AGDC user client\n");
         client->release();
         return kIOReturnError;
     }
     
     if (!client->attach(this)) {
-        IOLog("VMVirtIOAGDC::newUserClient() - Failed to attach AGDC user client\n");
+        VMLOG_ERROR("VMVirtIOAGDC::newUserClient() - Failed to attach AGDC user client\n");
         client->release();
         return kIOReturnError;
     }
     
     if (!client->start(this)) {
-        IOLog("VMVirtIOAGDC::newUserClient() - Failed to start AGDC user client\n");
+        VMLOG_ERROR("VMVirtIOAGDC::newUserClient() - Failed to start AGDC user client\n");
         client->detach(this);
         client->release();
         return kIOReturnError;
     }
     
     *handler = client;
-    IOLog("VMVirtIOAGDC::newUserClient() - Successfully created AGDC user client for IOPresentment\n");
+    VMLOG_INFO("VMVirtIOAGDC::newUserClient() - Successfully created AGDC user client for IOPresentment\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOAGDC::initializeAGDCService()
 {
-    IOLog("VMVirtIOAGDC::initializeAGDCService() - Initializing AGDC service components\n");
+    VMLOG_INFO("VMVirtIOAGDC::initializeAGDCService() - Initializing AGDC service components\n");
     
     IOLockLock(m_lock);
     
@@ -227,7 +228,7 @@ IOReturn VMVirtIOAGDC::initializeAGDCService()
     
     IOLockUnlock(m_lock);
     
-    IOLog("VMVirtIOAGDC::initializeAGDCService() - AGDC service initialized\n");
+    VMLOG_INFO("VMVirtIOAGDC::initializeAGDCService() - AGDC service initialized\n");
     return kIOReturnSuccess;
 }
 
@@ -246,7 +247,7 @@ void VMVirtIOAGDC::populateServiceInfo()
 
 IOReturn VMVirtIOAGDC::registerWithGPUWrangler()
 {
-    IOLog("VMVirtIOAGDC::registerWithGPUWrangler() - Registering AGDC service\n");
+    VMLOG_INFO("VMVirtIOAGDC::registerWithGPUWrangler() - Registering AGDC service\n");
     
     // Set critical properties that GPU Wrangler looks for
     setProperty("vendor-id", 0x1AF4, 32);           // VirtIO vendor ID
@@ -262,10 +263,10 @@ IOReturn VMVirtIOAGDC::registerWithGPUWrangler()
     // Prefer direct GPU device reference, fallback to framebuffer's provider
     if (m_gpu_device) {
         target_gpu_device = m_gpu_device;
-        IOLog("VMVirtIOAGDC::registerWithGPUWrangler() - Using direct GPU device reference\n");
+        VMLOG_INFO("VMVirtIOAGDC::registerWithGPUWrangler() - Using direct GPU device reference\n");
     } else if (m_framebuffer) {
         target_gpu_device = m_framebuffer->getProvider();
-        IOLog("VMVirtIOAGDC::registerWithGPUWrangler() - Using GPU device via framebuffer\n");
+        VMLOG_INFO("VMVirtIOAGDC::registerWithGPUWrangler() - Using GPU device via framebuffer\n");
     }
     
     if (target_gpu_device) {
@@ -277,7 +278,7 @@ IOReturn VMVirtIOAGDC::registerWithGPUWrangler()
         OSNumber* gpu_registry_id = OSNumber::withNumber(target_gpu_device->getRegistryEntryID(), 64);
         if (gpu_registry_id) {
             setProperty("AGDCGPURegistryID", gpu_registry_id);
-            IOLog("VMVirtIOAGDC::registerWithGPUWrangler() - Set GPU registry ID: 0x%llx\n", 
+            VMLOG_INFO("VMVirtIOAGDC::registerWithGPUWrangler() - Set GPU registry ID: 0x%llx\n", 
                   target_gpu_device->getRegistryEntryID());
             gpu_registry_id->release();
         }
@@ -292,7 +293,7 @@ IOReturn VMVirtIOAGDC::registerWithGPUWrangler()
         if (vendor_id) setProperty("vendor-id", vendor_id);
         if (device_id) setProperty("device-id", device_id);
         
-        IOLog("VMVirtIOAGDC::registerWithGPUWrangler() - Linked AGDC to GPU device 0x%llx\n", 
+        VMLOG_INFO("VMVirtIOAGDC::registerWithGPUWrangler() - Linked AGDC to GPU device 0x%llx\n", 
               target_gpu_device->getRegistryEntryID());
     }
     
@@ -312,13 +313,13 @@ IOReturn VMVirtIOAGDC::registerWithGPUWrangler()
     
     m_agdc_registered = true;
     
-    IOLog("VMVirtIOAGDC::registerWithGPUWrangler() - AGDC service registered successfully\n");
+    VMLOG_INFO("VMVirtIOAGDC::registerWithGPUWrangler() - AGDC service registered successfully\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOAGDC::unregisterFromGPUWrangler()
 {
-    IOLog("VMVirtIOAGDC::unregisterFromGPUWrangler() - Unregistering AGDC service\n");
+    VMLOG_INFO("VMVirtIOAGDC::unregisterFromGPUWrangler() - Unregistering AGDC service\n");
     
     IOLockLock(m_lock);
     m_agdc_registered = false;
@@ -332,7 +333,7 @@ IOReturn VMVirtIOAGDC::unregisterFromGPUWrangler()
 IOReturn VMVirtIOAGDC::getDisplayMetrics(AGDCDisplayMetrics* metrics)
 {
     if (!metrics) {
-        IOLog("VMVirtIOAGDC::getDisplayMetrics() - Null metrics pointer\n");
+        VMLOG_DEBUG("VMVirtIOAGDC::getDisplayMetrics() - Null metrics pointer\n");
         return kIOReturnBadArgument;
     }
     
@@ -340,7 +341,7 @@ IOReturn VMVirtIOAGDC::getDisplayMetrics(AGDCDisplayMetrics* metrics)
     
     if (!m_display_metrics_valid) {
         IOLockUnlock(m_lock);
-        IOLog("VMVirtIOAGDC::getDisplayMetrics() - Display metrics not available\n");
+        VMLOG_DEBUG("VMVirtIOAGDC::getDisplayMetrics() - Display metrics not available\n");
         return kIOReturnNotReady;
     }
     
@@ -352,14 +353,14 @@ IOReturn VMVirtIOAGDC::getDisplayMetrics(AGDCDisplayMetrics* metrics)
     
     IOLockUnlock(m_lock);
     
-    IOLog("VMVirtIOAGDC::getDisplayMetrics() - Returned %dx%d@%dHz\n", 
+    VMLOG_DEBUG("VMVirtIOAGDC::getDisplayMetrics() - Returned %dx%d@%dHz\n", 
           metrics->width, metrics->height, metrics->refresh_rate);
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOAGDC::setDisplayMode(uint32_t width, uint32_t height, uint32_t refresh_rate)
 {
-    IOLog("VMVirtIOAGDC::setDisplayMode() - Setting mode %dx%d@%dHz\n", 
+    VMLOG_DEBUG("VMVirtIOAGDC::setDisplayMode() - Setting mode %dx%d@%dHz\n", 
           width, height, refresh_rate);
     
     IOLockLock(m_lock);
@@ -379,7 +380,7 @@ IOReturn VMVirtIOAGDC::setDisplayMode(uint32_t width, uint32_t height, uint32_t
     
     IOLockUnlock(m_lock);
     
-    IOLog("VMVirtIOAGDC::setDisplayMode() - Mode set successfully\n");
+    VMLOG_DEBUG("VMVirtIOAGDC::setDisplayMode() - Mode set successfully\n");
     return kIOReturnSuccess;
 }
 
@@ -398,7 +399,7 @@ IOReturn VMVirtIOAGDC::getServiceInfo(AGDCServiceInfo* info)
 
 IOReturn VMVirtIOAGDC::enableAGDCService(bool enable)
 {
-    IOLog("VMVirtIOAGDC::enableAGDCService() - %s AGDC service\n", 
+    VMLOG_INFO("VMVirtIOAGDC::enableAGDCService() - %s AGDC service\n", 
           enable ? "Enabling" : "Disabling");
     
     IOLockLock(m_lock);
@@ -421,7 +422,7 @@ IOReturn VMVirtIOAGDC::enableAGDCService(bool enable)
 
 IOReturn VMVirtIOAGDC::registerAGDCService(uint32_t service_type)
 {
-    IOLog("VMVirtIOAGDC::registerAGDCService() - Registering service type: %d\n", service_type);
+    VMLOG_INFO("VMVirtIOAGDC::registerAGDCService() - Registering service type: %d\n", service_type);
     
     IOLockLock(m_lock);
     m_service_info.service_type = service_type;
@@ -473,7 +474,7 @@ IOReturn VMVirtIOAGDC::requestDisplayBounds(uint32_t* width, uint32_t* height)
 
 IOReturn VMVirtIOAGDC::notifyDisplayChange(uint32_t change_type)
 {
-    IOLog("VMVirtIOAGDC::notifyDisplayChange() - Change type: %d\n", change_type);
+    VMLOG_DEBUG("VMVirtIOAGDC::notifyDisplayChange() - Change type: %d\n", change_type);
     
     // Update display metrics when notified of changes
     updateDisplayMetrics();
@@ -485,7 +486,7 @@ IOReturn VMVirtIOAGDC::validateDisplayConfiguration(uint32_t width, uint32_t hei
 {
     // For VirtIO GPU, accept reasonable resolutions
     if (width < 640 || width > 4096 || height < 480 || height > 3072) {
-        IOLog("VMVirtIOAGDC::validateDisplayConfiguration() - Invalid resolution %dx%d\n", 
+        VMLOG_WARN("VMVirtIOAGDC::validateDisplayConfiguration() - Invalid resolution %dx%d\n", 
               width, height);
         return kIOReturnBadArgument;
     }
@@ -517,7 +518,7 @@ IOReturn VMVirtIOAGDC::updateDisplayMetrics()
 
 IOReturn VMVirtIOAGDC::setPowerState(unsigned long powerState, IOService* whatDevice)
 {
-    IOLog("VMVirtIOAGDC::setPowerState() - Power state: %ld\n", powerState);
+    VMLOG_INFO("VMVirtIOAGDC::setPowerState() - Power state: %ld\n", powerState);
     
     IOLockLock(m_lock);
     m_power_state_on = (powerState != 0);
@@ -553,13 +554,13 @@ VMVirtIOAGDC* VMVirtIOAGDC::withFramebuffer(VMVirtIOFramebuffer* framebuffer)
 
 void VMVirtIOAGDC::logAGDCState()
 {
-    IOLog("VMVirtIOAGDC State:\n");
-    IOLog("  - Registered: %s\n", m_agdc_registered ? "Yes" : "No");
-    IOLog("  - Service ID: 0x%x\n", m_agdc_service_id);
-    IOLog("  - Display: %dx%d@%dHz\n", m_display_metrics.width, 
+    VMLOG_INFO("VMVirtIOAGDC State:\n");
+    VMLOG_INFO("  - Registered: %s\n", m_agdc_registered ? "Yes" : "No");
+    VMLOG_INFO("  - Service ID: 0x%x\n", m_agdc_service_id);
+    VMLOG_INFO("  - Display: %dx%d@%dHz\n", m_display_metrics.width, 
           m_display_metrics.height, m_display_metrics.refresh_rate);
-    IOLog("  - Capabilities: 0x%x\n", m_service_info.capabilities);
-    IOLog("  - Power On: %s\n", m_power_state_on ? "Yes" : "No");
+    VMLOG_INFO("  - Capabilities: 0x%x\n", m_service_info.capabilities);
+    VMLOG_INFO("  - Power On: %s\n", m_power_state_on ? "Yes" : "No");
 }
 
 IOReturn VMVirtIOAGDC::getAGDCDebugInfo(void* buffer, size_t* buffer_size)
@@ -580,17 +581,17 @@ IOReturn VMVirtIOAGDC::getAGDCDebugInfo(void* buffer, size_t* buffer_size)
 
 IOReturn VMVirtIOAGDC::getAGDCInformation(void* info_buffer, uint32_t buffer_size)
 {
-    IOLog("VMVirtIOAGDC::getAGDCInformation() - Called by WindowServer, buffer=%p, size=%u\n", info_buffer, buffer_size);
+    VMLOG_DEBUG("VMVirtIOAGDC::getAGDCInformation() - Called by WindowServer, buffer=%p, size=%u\n", info_buffer, buffer_size);
     
     // WindowServer may pass different parameters than expected - be very flexible
     if (!info_buffer && buffer_size > 0) {
-        IOLog("VMVirtIOAGDC::getAGDCInformation() - Null buffer but non-zero size - returning kIOReturnBadArgument\n");
+        VMLOG_DEBUG("VMVirtIOAGDC::getAGDCInformation() - Null buffer but non-zero size - returning kIOReturnBadArgument\n");
         return kIOReturnBadArgument;
     }
     
     // If buffer_size is 0, WindowServer might just be querying capabilities
     if (buffer_size == 0) {
-        IOLog("VMVirtIOAGDC::getAGDCInformation() - Zero buffer size, returning success for capability query\n");
+        VMLOG_DEBUG("VMVirtIOAGDC::getAGDCInformation() - Zero buffer size, returning success for capability query\n");
         return kIOReturnSuccess;
     }
     
@@ -628,19 +629,19 @@ IOReturn VMVirtIOAGDC::getAGDCInformation(void* info_buffer, uint32_t buffer_siz
     // Copy to output buffer if we have one
     if (info_buffer && copy_size > 0) {
         memcpy(info_buffer, &info, copy_size);
-        IOLog("VMVirtIOAGDC::getAGDCInformation() - Copied %u bytes to buffer\n", copy_size);
+        VMLOG_DEBUG("VMVirtIOAGDC::getAGDCInformation() - Copied %u bytes to buffer\n", copy_size);
     }
     
-    IOLog("VMVirtIOAGDC::getAGDCInformation() - SUCCESS - returning kIOReturnSuccess (0)\n");
+    VMLOG_DEBUG("VMVirtIOAGDC::getAGDCInformation() - SUCCESS - returning kIOReturnSuccess (0)\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOAGDC::acquireMap(IOMemoryMap** map)
 {
-    IOLog("VMVirtIOAGDC::acquireMap() - Called by WindowServer, map=%p\n", map);
+    VMLOG_DEBUG("VMVirtIOAGDC::acquireMap() - Called by WindowServer, map=%p\n", map);
     
     if (!map) {
-        IOLog("VMVirtIOAGDC::acquireMap() - ERROR: Null map parameter, returning kIOReturnBadArgument\n");
+        VMLOG_ERROR("VMVirtIOAGDC::acquireMap() - ERROR: Null map parameter, returning kIOReturnBadArgument\n");
         return kIOReturnBadArgument;
     }
     
@@ -648,28 +649,28 @@ IOReturn VMVirtIOAGDC::acquireMap(IOMemoryMap** map)
     // WindowServer will access framebuffer through established shared memory
     *map = nullptr;
     
-    IOLog("VMVirtIOAGDC::acquireMap() - SUCCESS: Set *map=nullptr, returning kIOReturnSuccess (0)\n");
+    VMLOG_DEBUG("VMVirtIOAGDC::acquireMap() - SUCCESS: Set *map=nullptr, returning kIOReturnSuccess (0)\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOAGDC::releaseMap(IOMemoryMap* map)
 {
-    IOLog("VMVirtIOAGDC::releaseMap() - Called by WindowServer, map=%p\n", map);
+    VMLOG_DEBUG("VMVirtIOAGDC::releaseMap() - Called by WindowServer, map=%p\n", map);
     
     // Nothing to release for VirtIO GPU - no special memory mapping
     // map parameter can be ignored since we don't create IOMemoryMap objects
-    IOLog("VMVirtIOAGDC::releaseMap() - SUCCESS: Nothing to release, returning kIOReturnSuccess (0)\n");
+    VMLOG_DEBUG("VMVirtIOAGDC::releaseMap() - SUCCESS: Nothing to release, returning kIOReturnSuccess (0)\n");
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOAGDC::locateServiceDependencies(void* dependencies_buffer, uint32_t buffer_size)
 {
-    IOLog("VMVirtIOAGDC::locateServiceDependencies() - Called by WindowServer, buffer=%p, size=%u\n", dependencies_buffer, buffer_size);
+    VMLOG_DEBUG("VMVirtIOAGDC::locateServiceDependencies() - Called by WindowServer, buffer=%p, size=%u\n", dependencies_buffer, buffer_size);
     
     if (dependencies_buffer && buffer_size > 0) {
         // Clear the buffer - indicate no external dependencies required
         memset(dependencies_buffer, 0, buffer_size);
-        IOLog("VMVirtIOAGDC::locateServiceDependencies() - Cleared dependencies buffer\n");
+        VMLOG_DEBUG("VMVirtIOAGDC::locateServiceDependencies() - Cleared dependencies buffer\n");
     }
     
     // For VirtIO GPU, we have minimal dependencies - all are already satisfied
@@ -677,11 +678,11 @@ IOReturn VMVirtIOAGDC::locateServiceDependencies(void* dependencies_buffer, uint
     
     // Verify our essential dependencies - we need at least one (framebuffer OR gpu)
     if (!m_framebuffer && !m_gpu_device) {
-        IOLog("VMVirtIOAGDC::locateServiceDependencies() - ERROR: Critical dependencies missing\n");
+        VMLOG_ERROR("VMVirtIOAGDC::locateServiceDependencies() - ERROR: Critical dependencies missing\n");
         return kIOReturnNotReady;
     }
     
-    IOLog("VMVirtIOAGDC::locateServiceDependencies() - SUCCESS: All dependencies satisfied, returning kIOReturnSuccess (0)\n");
+    VMLOG_DEBUG("VMVirtIOAGDC::locateServiceDependencies() - SUCCESS: All dependencies satisfied, returning kIOReturnSuccess (0)\n");
     return kIOReturnSuccess;
 }
 
@@ -827,22 +828,22 @@ IOReturn VMVirtIOAGDCUserClient::sGetCapabilities(OSObject* target, void* refere
 IOReturn VMVirtIOAGDCUserClient::sGetAGDCInformation(OSObject* target, void* reference,
                                                    IOExternalMethodArguments* args)
 {
-    IOLog("VMVirtIOAGDCUserClient::sGetAGDCInformation() - IOPresentment requesting AGDC information\n");
+    VMLOG_DEBUG("VMVirtIOAGDCUserClient::sGetAGDCInformation() - IOPresentment requesting AGDC information\n");
     
     VMVirtIOAGDCUserClient* me = (VMVirtIOAGDCUserClient*) target;
     if (!me || !me->m_agdc_service) {
-        IOLog("VMVirtIOAGDCUserClient::sGetAGDCInformation() - No AGDC service attached\n");
+        VMLOG_DEBUG("VMVirtIOAGDCUserClient::sGetAGDCInformation() - No AGDC service attached\n");
         return kIOReturnNotAttached;
     }
     
     if (!args->structureOutput || args->structureOutputSize < 32) {
-        IOLog("VMVirtIOAGDCUserClient::sGetAGDCInformation() - Invalid output buffer size\n");
+        VMLOG_WARN("VMVirtIOAGDCUserClient::sGetAGDCInformation() - Invalid output buffer size\n");
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMVirtIOAGDCUserClient::sGetAGDCInformation() - Calling AGDC service getAGDCInformation\n");
+    VMLOG_DEBUG("VMVirtIOAGDCUserClient::sGetAGDCInformation() - Calling AGDC service getAGDCInformation\n");
     IOReturn result = me->m_agdc_service->getAGDCInformation(args->structureOutput, args->structureOutputSize);
-    IOLog("VMVirtIOAGDCUserClient::sGetAGDCInformation() - AGDC service returned: 0x%x\n", result);
+    VMLOG_DEBUG("VMVirtIOAGDCUserClient::sGetAGDCInformation() - AGDC service returned: 0x%x\n", result);
     
     return result;
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "VMVirtIOAGDC.h"
 #include "VMQemuVGAClient.h"
 #include "VMQemuVGAAccelerator.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 #include <IOKit/ndrvsupport/IOMacOSVideo.h>
 #include <IOKit/graphics/IOGraphicsTypes.h>
@@ -51,15 +52,30 @@ bool VMVirtIOFramebuffer::init(OSDictionary* properties)
     m_vram_range = nullptr;
     m_agdc_service = nullptr;
     m_accelerator = nullptr;
+    m_scanout_id = 0;  // primary unless initSecondaryHead says otherwise
+    m_secondary_heads = nullptr;
+    m_controller_enabled = false;
+    m_enable_call_count = 0;
     m_refresh_timer = nullptr;
     m_fb_backing = nullptr;
     m_fb_device_memory = nullptr;
     m_fb_resource_id = 0;
     m_fb_allocation_width = 0;
     m_fb_allocation_height = 0;
+    m_fb_is_blob = false;
+    bzero(m_scanout_pool, sizeof(m_scanout_pool));
+    m_scanout_pool_clock = 0;
     m_scanout_resource_id = 1;  // Primary GUI display resource ID
     m_scanout_taken_over_by_3d = false;  // 2D framebuffer active by default
     m_full_refresh_tick_count = 0;
+    bzero(&m_refresh_transfer, sizeof(m_refresh_transfer));
+    bzero(&m_refresh_flush, sizeof(m_refresh_flush));
+    m_vbl_proc = nullptr;
+    m_vbl_target = nullptr;
+    m_vbl_ref = nullptr;
+    m_vbl_enabled = false;
+    m_vbl_count = 0;
+    m_vbl_last_time = 0;
     m_width = 1024;
     m_height = 768;
     m_depth = 32;
@@ -68,7 +84,7 @@ bool VMVirtIOFramebuffer::init(OSDictionary* properties)
     
     initDisplayModes();
     
-    IOLog("VMVirtIOFramebuffer::init() completed\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::init() completed\n");
     return true;
 }
 
@@ -101,6 +117,15 @@ void VMVirtIOFramebuffer::free()
         m_vram_range = nullptr;
     }
 
+    OSSafeReleaseNULL(m_secondary_heads);
+
+    // A secondary head holds a retain on the primary's VMVirtIOGPU helper
+    // (initSecondaryHead); the primary's own reference is not dropped here.
+    if (m_scanout_id != 0 && m_gpu_driver) {
+        m_gpu_driver->release();
+        m_gpu_driver = nullptr;
+    }
+
     // destroyAGDCService(); // DISABLED FOR TESTING
 
     super::free();
@@ -108,7 +133,7 @@ void VMVirtIOFramebuffer::free()
 
 IOService* VMVirtIOFramebuffer::probe(IOService* provider, SInt32* score)
 {
-    IOLog("VMVirtIOFramebuffer::probe() - Checking provider type\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::probe() - Checking provider type\n");
 
     // Check if provider is IOPCIDevice (direct PCI match — preferred, competes with IONDRVFramebuffer)
     IOPCIDevice* pciDevice = OSDynamicCast(IOPCIDevice, provider);
@@ -122,11 +147,11 @@ IOService* VMVirtIOFramebuffer::probe(IOService* provider, SInt32* score)
         UInt16 device = (UInt16)((vid_did >> 16) & 0xFFFF);
         if (vendor != 0x1af4 ||
             (device != 0x1050 && device != 0x1051 && device != 0x1052)) {
-            IOLog("VMVirtIOFramebuffer::probe() - PCI %04x:%04x is not virtio-gpu, rejecting\n",
+            VMLOG_WARN("VMVirtIOFramebuffer::probe() - PCI %04x:%04x is not virtio-gpu, rejecting\n",
                   vendor, device);
             return nullptr;
         }
-        IOLog("VMVirtIOFramebuffer::probe() - Direct PCI match for virtio-gpu %04x:%04x\n",
+        VMLOG_INFO("VMVirtIOFramebuffer::probe() - Direct PCI match for virtio-gpu %04x:%04x\n",
               vendor, device);
         *score = 90001;  // Out-scores IONDRVFramebuffer (20000) so virtio-gpu gets the protocol-aware driver
         return super::probe(provider, score);
@@ -135,31 +160,37 @@ IOService* VMVirtIOFramebuffer::probe(IOService* provider, SInt32* score)
     // Check if provider is VMVirtIOGPU (child framebuffer approach — legacy binding)
     VMVirtIOGPU* gpuDevice = OSDynamicCast(VMVirtIOGPU, provider);
     if (gpuDevice) {
-        IOLog("VMVirtIOFramebuffer::probe() - VMVirtIOGPU provider (child framebuffer)\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::probe() - VMVirtIOGPU provider (child framebuffer)\n");
         *score = 1000;
         return super::probe(provider, score);
     }
 
-    IOLog("VMVirtIOFramebuffer::probe() - Provider is neither IOPCIDevice nor VMVirtIOGPU\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::probe() - Provider is neither IOPCIDevice nor VMVirtIOGPU\n");
     return nullptr;
 }
 
 bool VMVirtIOFramebuffer::start(IOService* provider)
 {
+    // Secondary heads are spawned by the primary after its own start() has
+    // already waited out the boot race below; they take a short path.
+    if (m_scanout_id != 0) {
+        return startSecondaryHead(provider);
+    }
+
     // CRITICAL: 5-second initialization delay (same race condition as QXL)
     // Race condition fix: Delay driver initialization to ensure system services are ready
     // Analysis with io=0xff debug logging revealed that IOFramebuffer::open() blocks if called
     // too early during boot. Testing showed 100ms insufficient, but 5000ms (5 seconds) consistently
     // works. This delay ensures WindowServer and IOGraphicsFamily are fully initialized before
     // our framebuffer becomes available. Without this, open() hangs intermittently during boot.
-    IOLog("VMVirtIOFramebuffer::start() - Applying 5-second initialization delay for race condition fix...\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Applying 5-second initialization delay for race condition fix...\n");
     IOSleep(5000);  // 5000ms delay - empirically determined minimum for reliable boot
-    IOLog("VMVirtIOFramebuffer::start() - Initialization delay complete - system services ready\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Initialization delay complete - system services ready\n");
     
-    IOLog("VMVirtIOFramebuffer::start() - Starting framebuffer\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Starting framebuffer\n");
     
     if (!super::start(provider)) {
-        IOLog("VMVirtIOFramebuffer::start() - super::start() failed\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::start() - super::start() failed\n");
         return false;
     }
     
@@ -169,59 +200,59 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
     
     if (directPCI) {
         // PREFERRED: Direct PCI device match - Display Preferences compatible
-        IOLog("VMVirtIOFramebuffer::start() - Direct PCI match mode (Display Preferences compatible)\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - Direct PCI match mode (Display Preferences compatible)\n");
         m_pci_device = directPCI;
         
         // CRITICAL: Mark this as the boot/console display (copied from QXL)
         // WindowServer checks for this property via isConsoleDevice()
         // Without it, WindowServer falls back to console mode instead of GUI
         provider->setProperty("AAPL,boot-display", kOSBooleanTrue);
-        IOLog("VMVirtIOFramebuffer::start() - Set AAPL,boot-display property for console device recognition\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - Set AAPL,boot-display property for console device recognition\n");
         
         // Create VMVirtIOGPU as helper object (NO IOService registration - prevents kernel panic)
         // Use initializeWithPCIDevice() instead of start() to skip registerService()
-        IOLog("VMVirtIOFramebuffer::start() - Creating VMVirtIOGPU helper object (no IOService registration)...\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - Creating VMVirtIOGPU helper object (no IOService registration)...\n");
         m_gpu_driver = new VMVirtIOGPU;
         if (m_gpu_driver) {
             if (m_gpu_driver->init(nullptr)) {
                 // Initialize with PCI device (does everything except registerService)
                 if (m_gpu_driver->initializeWithPCIDevice(m_pci_device)) {
-                    IOLog("VMVirtIOFramebuffer::start() - VMVirtIOGPU helper initialized: %p\n", m_gpu_driver);
+                    VMLOG_INFO("VMVirtIOFramebuffer::start() - VMVirtIOGPU helper initialized: %p\n", m_gpu_driver);
                 } else {
-                    IOLog("VMVirtIOFramebuffer::start() - VMVirtIOGPU::initializeWithPCIDevice() failed\n");
+                    VMLOG_ERROR("VMVirtIOFramebuffer::start() - VMVirtIOGPU::initializeWithPCIDevice() failed\n");
                     m_gpu_driver->release();
                     m_gpu_driver = nullptr;
                 }
             } else {
-                IOLog("VMVirtIOFramebuffer::start() - VMVirtIOGPU::init() failed\n");
+                VMLOG_ERROR("VMVirtIOFramebuffer::start() - VMVirtIOGPU::init() failed\n");
                 m_gpu_driver->release();
                 m_gpu_driver = nullptr;
             }
         } else {
-            IOLog("VMVirtIOFramebuffer::start() - Failed to allocate VMVirtIOGPU\n");
+            VMLOG_ERROR("VMVirtIOFramebuffer::start() - Failed to allocate VMVirtIOGPU\n");
         }
         
         if (!m_gpu_driver) {
-            IOLog("VMVirtIOFramebuffer::start() - WARNING: VMVirtIOGPU creation failed, GPU operations disabled\n");
+            VMLOG_ERROR("VMVirtIOFramebuffer::start() - WARNING: VMVirtIOGPU creation failed, GPU operations disabled\n");
         }
         
     } else if (gpuDevice) {
         // FALLBACK: VMVirtIOGPU child approach (works but not Display Preferences compatible)
-        IOLog("VMVirtIOFramebuffer::start() - VMVirtIOGPU child mode\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - VMVirtIOGPU child mode\n");
         m_gpu_driver = gpuDevice;
         m_pci_device = OSDynamicCast(IOPCIDevice, gpuDevice->getProvider());
         
     } else {
-        IOLog("VMVirtIOFramebuffer::start() - ERROR: Provider is neither IOPCIDevice nor VMVirtIOGPU\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::start() - ERROR: Provider is neither IOPCIDevice nor VMVirtIOGPU\n");
         return false;
     }
     
     // CRITICAL: Establish bidirectional reference with GPU driver for scanout coordination
     if (m_gpu_driver) {
-        m_gpu_driver->setFramebuffer(this);
+        m_gpu_driver->setFramebuffer(this, m_scanout_id);
     }
     
-    IOLog("VMVirtIOFramebuffer::start() - provider=%p, gpu_driver=%p, pci_device=%p\n", 
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - provider=%p, gpu_driver=%p, pci_device=%p\n", 
           provider, m_gpu_driver, m_pci_device);
     
     // CRITICAL: Initialize VRAM range early for display refresh
@@ -229,17 +260,17 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
         m_vram_range = m_pci_device->getDeviceMemoryWithIndex(0);
         if (m_vram_range) {
             m_vram_range->retain();
-            IOLog("VMVirtIOFramebuffer::start() - VRAM range obtained: size=%llu bytes\n", 
+            VMLOG_INFO("VMVirtIOFramebuffer::start() - VRAM range obtained: size=%llu bytes\n", 
                   m_vram_range->getLength());
         }
     }
     
     // CRITICAL: Start display refresh timer immediately after GPU initialization
     // VirtIO GPU requires periodic transfer/flush commands to update the display
-    IOLog("VMVirtIOFramebuffer::start() - Checking prerequisites: gpu=%p, pci=%p, vram=%p\n",
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Checking prerequisites: gpu=%p, pci=%p, vram=%p\n",
           m_gpu_driver, m_pci_device, m_vram_range);
     if (m_gpu_driver && m_pci_device && m_vram_range) {
-        IOLog("VMVirtIOFramebuffer::start() - ✓ All prerequisites met - Creating display refresh timer on PCI workloop\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - ✓ All prerequisites met - Creating display refresh timer on PCI workloop\n");
         IOWorkLoop* pci_workloop = m_pci_device->getWorkLoop();
         if (pci_workloop) {
             m_refresh_timer = IOTimerEventSource::timerEventSource(this, 
@@ -248,17 +279,17 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
                 if (pci_workloop->addEventSource(m_refresh_timer) == kIOReturnSuccess) {
                     // DO NOT initialize scanout in start() - causes UTM display to not transition
                     // Let enableController() handle scanout setup when WindowServer is ready
-                    IOLog("VMVirtIOFramebuffer::start() - Timer ready, scanout deferred to enableController()\n");
+                    VMLOG_INFO("VMVirtIOFramebuffer::start() - Timer ready, scanout deferred to enableController()\n");
                 } else {
-                    IOLog("VMVirtIOFramebuffer::start() - Failed to add timer to workloop\n");
+                    VMLOG_ERROR("VMVirtIOFramebuffer::start() - Failed to add timer to workloop\n");
                     m_refresh_timer->release();
                     m_refresh_timer = nullptr;
                 }
             } else {
-                IOLog("VMVirtIOFramebuffer::start() - Failed to create timer event source\n");
+                VMLOG_ERROR("VMVirtIOFramebuffer::start() - Failed to create timer event source\n");
             }
         } else {
-            IOLog("VMVirtIOFramebuffer::start() - PCI device has no workloop\n");
+            VMLOG_INFO("VMVirtIOFramebuffer::start() - PCI device has no workloop\n");
         }
     }
     
@@ -282,10 +313,10 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
         // 0x00:0x00 or 0x03:0x80 = Pure GPU (virtio-gpu-gl-pci) - needs GPU properties
         if (baseClass == 0x00 || (baseClass == 0x03 && subClass == 0x80)) {
             is_pure_gpu_mode = true;
-            IOLog("VMVirtIOFramebuffer::start() - Detected virtio-gpu-gl-pci (pure GPU, no VGA BIOS)\n");
+            VMLOG_INFO("VMVirtIOFramebuffer::start() - Detected virtio-gpu-gl-pci (pure GPU, no VGA BIOS)\n");
         } else if (baseClass == 0x03 && subClass == 0x00) {
             is_pure_gpu_mode = false;
-            IOLog("VMVirtIOFramebuffer::start() - Detected virtio-vga-gl (VGA-compatible with 3D)\n");
+            VMLOG_INFO("VMVirtIOFramebuffer::start() - Detected virtio-vga-gl (VGA-compatible with 3D)\n");
         }
     }
     
@@ -299,7 +330,7 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
     const bool functional_3d = m_gpu_driver && m_gpu_driver->is3DFunctional();
     if (is_pure_gpu_mode) {
         // virtio-gpu-gl-pci (pure GPU mode) - needs GPU properties for System Profiler
-        IOLog("VMVirtIOFramebuffer::start() - Setting GPU properties for virtio-gpu-gl-pci (pure GPU mode)\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - Setting GPU properties for virtio-gpu-gl-pci (pure GPU mode)\n");
 
         // Set GPU model and vendor information (visible in About This Mac > Displays)
         setProperty("model", functional_3d ? "VirtIO GPU 3D" : "VirtIO GPU");
@@ -316,12 +347,12 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
         // (m_pci_device), which carries the real class-code (0x0380 for
         // gl-pci, 0x0300 for vga-gl). The hack never had any effect.
 
-        IOLog("VMVirtIOFramebuffer::start() - GPU properties set for virtio-gpu-gl-pci\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - GPU properties set for virtio-gpu-gl-pci\n");
     } else {
-        IOLog("VMVirtIOFramebuffer::start() - virtio-vga-gl detected (VGA-compatible)\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - virtio-vga-gl detected (VGA-compatible)\n");
     }
     
-    IOLog("VMVirtIOFramebuffer::start() - Device mode: %s, 3D support: %s\n",
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Device mode: %s, 3D support: %s\n",
           is_pure_gpu_mode ? "virtio-gpu-gl-pci" : "virtio-vga-gl",
           has_3d_support ? "YES" : "NO");
     
@@ -338,9 +369,9 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
         vram_size_num->release();
         vram_mb_num->release();
         
-        IOLog("VMVirtIOFramebuffer::start() - VRAM size configured: %u MB using OSNumber objects\n", vram_mb);
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - VRAM size configured: %u MB using OSNumber objects\n", vram_mb);
     } else {
-        IOLog("VMVirtIOFramebuffer::start() - ERROR: Failed to create OSNumber objects for VRAM properties\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::start() - ERROR: Failed to create OSNumber objects for VRAM properties\n");
     }
     
     // *** 3D-capability property block ***
@@ -368,7 +399,7 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
         setProperty("IOGLBundleName", "GLEngine");
         setProperty("IOAccelIndex", (uint64_t)0, 32);
 
-        IOLog("VMVirtIOFramebuffer::start() - 3D transport offered; functional_3d=%d (properties reflect rendering state, not transport)\n",
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - 3D transport offered; functional_3d=%d (properties reflect rendering state, not transport)\n",
               functional_3d ? 1 : 0);
     } else {
         // No transport — no 3D claims at all.
@@ -377,7 +408,7 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
         setProperty("IODisplayAccelerated", kOSBooleanFalse);
         setProperty("IOAccelerator3D", kOSBooleanFalse);
 
-        IOLog("VMVirtIOFramebuffer::start() - 3D transport not offered (no virgl capsets)\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - 3D transport not offered (no virgl capsets)\n");
     }
     
     // DISABLE AGDC: Tell WindowServer we DON'T support AGDC to prevent initialization failures
@@ -411,7 +442,7 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
     // IOFramebufferMemoryBandwidth is REQUIRED for macOS to activate display
     UInt32 memoryBandwidth = 1024 * 1024 * 1024; // 1 GB/sec bandwidth (typical for virtual GPU)
     setProperty("IOFramebufferMemoryBandwidth", memoryBandwidth);
-    IOLog("VMVirtIOFramebuffer::start() - Set IOFramebufferMemoryBandwidth = %u bytes\n", memoryBandwidth);
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Set IOFramebufferMemoryBandwidth = %u bytes\n", memoryBandwidth);
     
     // *** CRITICAL: Primary Graphics Device Properties ***
     // These properties tell macOS this framebuffer is the primary display controller
@@ -424,12 +455,12 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
     // This makes the framebuffer discoverable by Display Preferences
     if (m_pci_device) {
         setProperty("IOPCIDevice", m_pci_device);  // Link to PCI device for system info
-        IOLog("VMVirtIOFramebuffer::start() - Linked to PCI device for system display discovery\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - Linked to PCI device for system display discovery\n");
     }
     
     // NOTE: Do NOT set name to "display" - IODisplayWrangler will create display0 nub automatically
     // The framebuffer name should remain as provided by the system (e.g., "S10@2")
-    IOLog("VMVirtIOFramebuffer::start() - Framebuffer registered, IODisplayWrangler will create display0 nub\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Framebuffer registered, IODisplayWrangler will create display0 nub\n");
     
     // *** CRITICAL: Set IOUserClientClass at runtime ***
     // Programmatically created services don't inherit personality properties from Info.plist
@@ -438,12 +469,12 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
     if (userClientClass) {
         setProperty("IOUserClientClass", userClientClass);
         userClientClass->release();
-        IOLog("VMVirtIOFramebuffer::start() - IOUserClientClass set to VMQemuVGAClient\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - IOUserClientClass set to VMQemuVGAClient\n");
     } else {
-        IOLog("VMVirtIOFramebuffer::start() - ERROR: Failed to create IOUserClientClass string\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::start() - ERROR: Failed to create IOUserClientClass string\n");
     }
     
-    IOLog("VMVirtIOFramebuffer::start() - Simple framebuffer mode (no AGDC, no HW video accel)\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Simple framebuffer mode (no AGDC, no HW video accel)\n");
     
     // SIMPLE: Basic framebuffer setup like QXL
     setProperty("IOBootDisplay", kOSBooleanTrue);
@@ -462,10 +493,10 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
     
     // *** CRITICAL: DO NOT call enableController() here ***
     // IOGraphicsFamily will call it when ready - calling it too early breaks activation
-    IOLog("VMVirtIOFramebuffer::start() - Controller enable deferred to IOGraphicsFamily\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Controller enable deferred to IOGraphicsFamily\n");
     
     // *** TEST: Disable AGDC service to isolate GUI login issue ***
-    IOLog("VMVirtIOFramebuffer::start() - AGDC service creation DISABLED for testing\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - AGDC service creation DISABLED for testing\n");
     // IOReturn agdc_result = createAGDCService();
     // if (agdc_result == kIOReturnSuccess) {
     //     IOLog("VMVirtIOFramebuffer::start() - AGDC service created successfully\n");
@@ -476,59 +507,59 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
     // Initialize display mode variables (copied from QXL - must be done before power management)
     m_display_mode = 0;  // Will be set by IOGraphicsFamily when enableController() is called
     m_depth_mode = 0;
-    IOLog("VMVirtIOFramebuffer::start() - Display mode variables initialized\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Display mode variables initialized\n");
     
     // TESTING: Skip power management initialization - IOFramebuffer may handle this automatically
     // The panic at IOGraphicsFamily + 88033 (offset 0x110) suggests power management structure is
     // being accessed before it's ready. Let IOFramebuffer base class initialize power management.
-    IOLog("VMVirtIOFramebuffer::start() - Skipping manual power management init (let IOFramebuffer handle it)\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Skipping manual power management init (let IOFramebuffer handle it)\n");
     
     // *** CRITICAL: Make this the boot console device ***
     // The framebuffer itself must declare it's the console device, not just the provider
     // This is what triggers IOGraphicsFamily to create display0 and AppleDisplay children
     setProperty("IOConsoleDevice", kOSBooleanTrue);
     setProperty("IOBootDisplay", kOSBooleanTrue);
-    IOLog("VMVirtIOFramebuffer::start() - Declared as boot console device\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Declared as boot console device\n");
     
     // *** CRITICAL: Create accelerator child service (like QXL) ***
     // IOGraphicsFamily requires an IOAccelerator child to create display connections
-    IOLog("VMVirtIOFramebuffer::start() - Creating accelerator child service...\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Creating accelerator child service...\n");
     m_accelerator = OSTypeAlloc(VMQemuVGAAccelerator);
     if (m_accelerator) {
         if (m_accelerator->init()) {
             if (m_accelerator->attach(this)) {
                 if (m_accelerator->start(this)) {
                     m_accelerator->registerService(kIOServiceAsynchronous);
-                    IOLog("VMVirtIOFramebuffer::start() - Accelerator registered successfully\n");
+                    VMLOG_INFO("VMVirtIOFramebuffer::start() - Accelerator registered successfully\n");
                 } else {
-                    IOLog("VMVirtIOFramebuffer::start() - WARNING: Accelerator start() failed\n");
+                    VMLOG_ERROR("VMVirtIOFramebuffer::start() - WARNING: Accelerator start() failed\n");
                     m_accelerator->detach(this);
                     m_accelerator->release();
                     m_accelerator = nullptr;
                 }
             } else {
-                IOLog("VMVirtIOFramebuffer::start() - WARNING: Accelerator attach() failed\n");
+                VMLOG_ERROR("VMVirtIOFramebuffer::start() - WARNING: Accelerator attach() failed\n");
                 m_accelerator->release();
                 m_accelerator = nullptr;
             }
         } else {
-            IOLog("VMVirtIOFramebuffer::start() - WARNING: Accelerator init() failed\n");
+            VMLOG_ERROR("VMVirtIOFramebuffer::start() - WARNING: Accelerator init() failed\n");
             m_accelerator->release();
             m_accelerator = nullptr;
         }
     } else {
-        IOLog("VMVirtIOFramebuffer::start() - WARNING: Failed to allocate accelerator\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::start() - WARNING: Failed to allocate accelerator\n");
     }
     
     // Register service to publish in IORegistry (like QXL does at end of start())
     registerService(kIOServiceAsynchronous);
-    IOLog("VMVirtIOFramebuffer::start() - Service registered for display matching\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Service registered for display matching\n");
     
     // CRITICAL: Manually create display0 nub since IODisplayWrangler may have already scanned
     // IODisplayWrangler::makeDisplayConnects() creates IODisplayConnect nub named "display0"
-    IOLog("VMVirtIOFramebuffer::start() - Creating display0 connection nub\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Creating display0 connection nub\n");
     IODisplayWrangler::makeDisplayConnects(this);
-    IOLog("VMVirtIOFramebuffer::start() - display0 nub created\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - display0 nub created\n");
 
     // Forced setupForCurrentConfig removed — it was a workaround from the era
     // when the base class never drove the display lifecycle. Calling it during
@@ -541,103 +572,7 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
     // Phase 2: Fixed framebuffer buffer allocation. Sized for the largest mode
     // we intend to advertise. Lives until free(); setupFramebufferResource
     // creates the virtio resource against this buffer but does NOT realloc it.
-    //
-    // ceilings[] is ordered largest-first; the first that succeeds wins. The
-    // fallback ladder handles contiguous-allocation failure (more likely at
-    // larger sizes, especially late in boot when memory is fragmented).
-    {
-        struct { uint32_t w, h; const char* label; } ceilings[] = {
-            {4096, 2160, "4096x2160 (35.4 MB)"},
-            {2560, 1600, "2560x1600 (16.4 MB)"},
-            {1920, 1200, "1920x1200 (9.2 MB)"},
-            {1600, 1200, "1600x1200 (7.3 MB)"},
-            {1280, 1024, "1280x1024 (5.0 MB)"},
-            {1024, 768,  "1024x768  (3.0 MB)"},
-        };
-        bool allocated = false;
-        for (size_t i = 0; i < sizeof(ceilings)/sizeof(ceilings[0]); i++) {
-            size_t try_size = (size_t)ceilings[i].w * ceilings[i].h * 4;
-            IOBufferMemoryDescriptor* try_backing = IOBufferMemoryDescriptor::withOptions(
-                kIODirectionInOut | kIOMemoryPhysicallyContiguous,  // options
-                try_size,                                             // capacity
-                page_size);                                           // alignment
-            if (!try_backing) {
-                IOLog("VMVirtIOFramebuffer::start() - ceiling %s: withOptions returned NULL, trying smaller\n",
-                      ceilings[i].label);
-                continue;
-            }
-            IOReturn prepare_ret = try_backing->prepare(kIODirectionInOut);
-            if (prepare_ret != kIOReturnSuccess) {
-                IOLog("VMVirtIOFramebuffer::start() - ceiling %s: prepare 0x%x, trying smaller\n",
-                      ceilings[i].label, prepare_ret);
-                try_backing->release();
-                continue;
-            }
-            IOPhysicalAddress phys = try_backing->getPhysicalSegment(0, nullptr, kIOMemoryMapperNone);
-            IODeviceMemory* try_dev_mem = IODeviceMemory::withRange(phys, try_size);
-            if (!try_dev_mem) {
-                IOLog("VMVirtIOFramebuffer::start() - ceiling %s: IODeviceMemory::withRange failed, trying smaller\n",
-                      ceilings[i].label);
-                try_backing->complete(kIODirectionInOut);
-                try_backing->release();
-                continue;
-            }
-            // Self-check: actual allocation length must match the requested size.
-            // Catches the IOBufferMemoryDescriptor::withOptions arg-order bug
-            // (allocates a tiny buffer while reporting the requested size).
-            IOByteCount actual_len = try_backing->getLength();
-            if (actual_len != (IOByteCount)try_size) {
-                IOLog("VMVirtIOFramebuffer::start() - ceiling %s: SIZE MISMATCH actual=%llu expected=%llu, trying smaller\n",
-                      ceilings[i].label, (uint64_t)actual_len, (uint64_t)try_size);
-                try_dev_mem->release();
-                try_backing->complete(kIODirectionInOut);
-                try_backing->release();
-                continue;
-            }
-            // Aperture invariant: getApertureRange returns an IODeviceMemory
-            // describing ONE physical range. There is no honest way to build
-            // one over a fragmented buffer — IODeviceMemory::withRange(phys,
-            // len) would describe a single contiguous physical run that
-            // doesn't exist, and every WindowServer write past segment 1
-            // lands on unrelated kernel memory (same corruption class as the
-            // old zone free-list panics). kIOMemoryPhysicallyContiguous
-            // should guarantee a single segment, but at 35 MB on this 4 GB
-            // guest it has been observed returning 2 segments (attachBacking
-            // reported nr_entries=2). Walk the allocation and require
-            // nr_entries == 1; step down if not.
-            {
-                unsigned seg_count = 0;
-                IOByteCount walk_off = 0;
-                IOByteCount walk_len = 0;
-                while (try_backing->getPhysicalSegment(walk_off, &walk_len, kIOMemoryMapperNone) != 0) {
-                    seg_count++;
-                    walk_off += walk_len;
-                    if (walk_len == 0) break;
-                }
-                if (seg_count != 1) {
-                    IOLog("VMVirtIOFramebuffer::start() - ceiling %s: allocation fragmented into %u segments (aperture requires 1) — stepping down\n",
-                          ceilings[i].label, seg_count);
-                    try_dev_mem->release();
-                    try_backing->complete(kIODirectionInOut);
-                    try_backing->release();
-                    continue;
-                }
-            }
-            // Success — commit.
-            m_fb_backing = try_backing;
-            m_fb_device_memory = try_dev_mem;
-            m_fb_allocation_width = ceilings[i].w;
-            m_fb_allocation_height = ceilings[i].h;
-            IOLog("VMVirtIOFramebuffer::start() - Fixed framebuffer buffer allocated: %s phys=0x%llx len=%llu\n",
-                  ceilings[i].label, (uint64_t)phys, (uint64_t)try_size);
-            allocated = true;
-            break;
-        }
-        if (!allocated) {
-            IOLog("VMVirtIOFramebuffer::start() - *** ALL FRAMEBUFFER CEILINGS FAILED *** — display will not work\n");
-            // Continue; downstream calls will fail visibly rather than silently corrupt.
-        }
-    }
+    allocateFixedBuffer();
 
     // Phase 4: filter the supported mode list based on which ceiling succeeded.
     // Prevents advertising a mode the buffer can't back. Also sets m_current_mode
@@ -663,18 +598,130 @@ bool VMVirtIOFramebuffer::start(IOService* provider)
             vram_mb_actual->release();
         }
         removeProperty("ATY,memsize");
-        IOLog("VMVirtIOFramebuffer::start() - VRAM published: %u MB (%llu bytes), removed ATY,memsize\n",
+        VMLOG_INFO("VMVirtIOFramebuffer::start() - VRAM published: %u MB (%llu bytes), removed ATY,memsize\n",
               actual_mb, actual_bytes);
     }
 
-    IOLog("VMVirtIOFramebuffer::start() - Initialization complete\n");
+    // One framebuffer per additional virtio-gpu scanout.
+    createSecondaryHeads();
+
+    VMLOG_INFO("VMVirtIOFramebuffer::start() - Initialization complete\n");
 
     return true;
 }
 
+// Phase 2 ceiling ladder. ceilings[] is ordered largest-first; the first
+// that succeeds wins. The fallback ladder handles contiguous-allocation
+// failure (more likely at larger sizes, especially late in boot when memory
+// is fragmented). Each head calls this once from start(); a secondary head
+// that lands on a smaller ceiling simply advertises fewer modes.
+bool VMVirtIOFramebuffer::allocateFixedBuffer()
+{
+    struct { uint32_t w, h; const char* label; } ceilings[] = {
+        {4096, 2160, "4096x2160 (35.4 MB)"},
+        {2560, 1600, "2560x1600 (16.4 MB)"},
+        {1920, 1200, "1920x1200 (9.2 MB)"},
+        {1600, 1200, "1600x1200 (7.3 MB)"},
+        {1280, 1024, "1280x1024 (5.0 MB)"},
+        {1024, 768,  "1024x768  (3.0 MB)"},
+    };
+    bool allocated = false;
+    for (size_t i = 0; i < sizeof(ceilings)/sizeof(ceilings[0]); i++) {
+        size_t try_size = (size_t)ceilings[i].w * ceilings[i].h * 4;
+        IOBufferMemoryDescriptor* try_backing = IOBufferMemoryDescriptor::withOptions(
+            kIODirectionInOut | kIOMemoryPhysicallyContiguous,  // options
+            try_size,                                             // capacity
+            page_size);                                           // alignment
+        if (!try_backing) {
+            VMLOG_DEBUG("VMVirtIOFramebuffer::allocateFixedBuffer() - ceiling %s: withOptions returned NULL, trying smaller\n",
+                  ceilings[i].label);
+            continue;
+        }
+        IOReturn prepare_ret = try_backing->prepare(kIODirectionInOut);
+        if (prepare_ret != kIOReturnSuccess) {
+            VMLOG_DEBUG("VMVirtIOFramebuffer::allocateFixedBuffer() - ceiling %s: prepare 0x%x, trying smaller\n",
+                  ceilings[i].label, prepare_ret);
+            try_backing->release();
+            continue;
+        }
+        IOPhysicalAddress phys = try_backing->getPhysicalSegment(0, nullptr, kIOMemoryMapperNone);
+        IODeviceMemory* try_dev_mem = IODeviceMemory::withRange(phys, try_size);
+        if (!try_dev_mem) {
+            VMLOG_ERROR("VMVirtIOFramebuffer::allocateFixedBuffer() - ceiling %s: IODeviceMemory::withRange failed, trying smaller\n",
+                  ceilings[i].label);
+            try_backing->complete(kIODirectionInOut);
+            try_backing->release();
+            continue;
+        }
+        // Self-check: actual allocation length must match the requested size.
+        // Catches the IOBufferMemoryDescriptor::withOptions arg-order bug
+        // (allocates a tiny buffer while reporting the requested size).
+        IOByteCount actual_len = try_backing->getLength();
+        if (actual_len != (IOByteCount)try_size) {
+            VMLOG_WARN("VMVirtIOFramebuffer::allocateFixedBuffer() - ceiling %s: SIZE MISMATCH actual=%llu expected=%llu, trying smaller\n",
+                  ceilings[i].label, (uint64_t)actual_len, (uint64_t)try_size);
+            try_dev_mem->release();
+            try_backing->complete(kIODirectionInOut);
+            try_backing->release();
+            continue;
+        }
+        // Aperture invariant: getApertureRange returns an IODeviceMemory
+        // describing ONE physical range. There is no honest way to build
+        // one over a fragmented buffer — IODeviceMemory::withRange(phys,
+        // len) would describe a single contiguous physical run that
+        // doesn't exist, and every WindowServer write past segment 1
+        // lands on unrelated kernel memory (same corruption class as the
+        // old zone free-list panics). kIOMemoryPhysicallyContiguous
+        // should guarantee a single segment, but at 35 MB on this 4 GB
+        // guest it has been observed returning 2 segments (attachBacking
+        // reported nr_entries=2). Walk the allocation and require
+        // nr_entries == 1; step down if not.
+        {
+            unsigned seg_count = 0;
+            IOByteCount walk_off = 0;
+            IOByteCount walk_len = 0;
+            while (try_backing->getPhysicalSegment(walk_off, &walk_len, kIOMemoryMapperNone) != 0) {
+                seg_count++;
+                walk_off += walk_len;
+                if (walk_len == 0) break;
+            }
+            if (seg_count != 1) {
+                VMLOG_DEBUG("VMVirtIOFramebuffer::allocateFixedBuffer() - ceiling %s: allocation fragmented into %u segments (aperture requires 1) — stepping down\n",
+                      ceilings[i].label, seg_count);
+                try_dev_mem->release();
+                try_backing->complete(kIODirectionInOut);
+                try_backing->release();
+                continue;
+            }
+        }
+        // Success — commit.
+        m_fb_backing = try_backing;
+        m_fb_device_memory = try_dev_mem;
+        m_fb_allocation_width = ceilings[i].w;
+        m_fb_allocation_height = ceilings[i].h;
+        VMLOG_DEBUG("VMVirtIOFramebuffer::allocateFixedBuffer() - Fixed framebuffer buffer allocated: %s phys=0x%llx len=%llu\n",
+              ceilings[i].label, (uint64_t)phys, (uint64_t)try_size);
+        allocated = true;
+        break;
+    }
+    if (!allocated) {
+        VMLOG_ERROR("VMVirtIOFramebuffer::allocateFixedBuffer() - *** ALL FRAMEBUFFER CEILINGS FAILED *** — display will not work\n");
+        // Continue; downstream calls will fail visibly rather than silently corrupt.
+    }
+    return allocated;
+}
+
 void VMVirtIOFramebuffer::stop(IOService* provider)
 {
-    IOLog("VMVirtIOFramebuffer::stop() - Stopping framebuffer\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::stop() - Stopping framebuffer (scanout %u)\n", m_scanout_id);
+
+    // The refresh tick walks m_secondary_heads; it must be gone first
+    stopRefreshTimer();
+    destroySecondaryHeads();
+
+    if (m_scanout_id != 0 && m_gpu_driver) {
+        m_gpu_driver->setFramebuffer(nullptr, m_scanout_id);
+    }
 
     // Clean up accelerator
     if (m_accelerator) {
@@ -719,7 +766,7 @@ void VMVirtIOFramebuffer::filterModesByAllocation()
     uint64_t largest_pixels = 0;
 
     if (!m_fb_backing) {
-        IOLog("VMVirtIOFramebuffer::filterModesByAllocation: no fixed buffer — no modes advertised\n");
+        VMLOG_DEBUG("VMVirtIOFramebuffer::filterModesByAllocation: no fixed buffer — no modes advertised\n");
         return;
     }
     uint64_t alloc_bytes = (uint64_t)m_fb_backing->getLength();
@@ -728,13 +775,13 @@ void VMVirtIOFramebuffer::filterModesByAllocation()
         uint64_t mode_bytes = (uint64_t)kSupportedModes[i].width
                               * (uint64_t)kSupportedModes[i].height * 4ULL;
         if (mode_bytes > alloc_bytes) {
-            IOLog("VMVirtIOFramebuffer::filterModesByAllocation: skip mode %u (%ux%u, %llu bytes > %llu buffer)\n",
+            VMLOG_DEBUG("VMVirtIOFramebuffer::filterModesByAllocation: skip mode %u (%ux%u, %llu bytes > %llu buffer)\n",
                   kSupportedModes[i].id, kSupportedModes[i].width, kSupportedModes[i].height,
                   mode_bytes, alloc_bytes);
             continue;
         }
         if (m_mode_count >= sizeof(m_display_modes) / sizeof(m_display_modes[0])) {
-            IOLog("VMVirtIOFramebuffer::filterModesByAllocation: m_display_modes[] full, dropping remaining modes\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::filterModesByAllocation: m_display_modes[] full, dropping remaining modes\n");
             break;
         }
         m_display_modes[m_mode_count++] = kSupportedModes[i].id;
@@ -753,7 +800,7 @@ void VMVirtIOFramebuffer::filterModesByAllocation()
     // m_current_mode drives what enableController sets up.
     m_current_mode = (default_mode != 0) ? default_mode : largest_fitting;
 
-    IOLog("VMVirtIOFramebuffer::filterModesByAllocation: %u modes advertised, boot mode = %u, buffer = %llu bytes\n",
+    VMLOG_DEBUG("VMVirtIOFramebuffer::filterModesByAllocation: %u modes advertised, boot mode = %u, buffer = %llu bytes\n",
           (unsigned)m_mode_count, m_current_mode, alloc_bytes);
 }
 
@@ -776,7 +823,7 @@ IOReturn VMVirtIOFramebuffer::getAttribute(IOSelect attribute, uintptr_t* value)
 
 IODeviceMemory* VMVirtIOFramebuffer::getApertureRange(IOPixelAperture aperture)
 {
-    IOLog("VMVirtIOFramebuffer::getApertureRange: aperture=%d\n", (int)aperture);
+    VMLOG_DEBUG("VMVirtIOFramebuffer::getApertureRange: aperture=%d\n", (int)aperture);
 
     if (aperture != kIOFBSystemAperture) {
         return nullptr;
@@ -786,7 +833,7 @@ IODeviceMemory* VMVirtIOFramebuffer::getApertureRange(IOPixelAperture aperture)
     // Same memory is the resource backing (host reads pixels here) and the
     // transfer source — load-bearing invariant.
     if (m_fb_device_memory) {
-        IOLog("VMVirtIOFramebuffer::getApertureRange: returning fb backing %p (size=%llu)\n",
+        VMLOG_DEBUG("VMVirtIOFramebuffer::getApertureRange: returning fb backing %p (size=%llu)\n",
               m_fb_device_memory, m_fb_device_memory->getLength());
         m_fb_device_memory->retain();
         return m_fb_device_memory;
@@ -798,19 +845,19 @@ IODeviceMemory* VMVirtIOFramebuffer::getApertureRange(IOPixelAperture aperture)
     // silently handed IOGraphicsFamily a register aperture as if it were
     // VRAM → NULL dereference when IOGraphicsFamily dereferenced structures
     // sized for the declared display mode against a 4 KB range.
-    IOLog("VMVirtIOFramebuffer::getApertureRange: m_fb_device_memory is NULL — returning NULL (not ready yet)\n");
+    VMLOG_WARN("VMVirtIOFramebuffer::getApertureRange: m_fb_device_memory is NULL — returning NULL (not ready yet)\n");
     return nullptr;
 }
 
 // CRITICAL: WindowServer calls this to get the framebuffer memory for rendering
 IODeviceMemory* VMVirtIOFramebuffer::getVRAMRange(void)
 {
-    IOLog("VMVirtIOFramebuffer::getVRAMRange() - *** WINDOWSERVER REQUESTING FRAMEBUFFER MEMORY ***\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::getVRAMRange() - *** WINDOWSERVER REQUESTING FRAMEBUFFER MEMORY ***\n");
 
     // VirtIO GPU path: same backing as the aperture and the resource — single
     // allocation, three roles.
     if (m_fb_device_memory) {
-        IOLog("VMVirtIOFramebuffer::getVRAMRange() - Returning fb backing %p phys=0x%llx len=%llu\n",
+        VMLOG_INFO("VMVirtIOFramebuffer::getVRAMRange() - Returning fb backing %p phys=0x%llx len=%llu\n",
               m_fb_device_memory,
               (unsigned long long)m_fb_device_memory->getPhysicalAddress(),
               (unsigned long long)m_fb_device_memory->getLength());
@@ -821,7 +868,7 @@ IODeviceMemory* VMVirtIOFramebuffer::getVRAMRange(void)
     // Same as getApertureRange: return NULL when framebuffer not ready.
     // No m_vram_range or PCI BAR fallback — those hand out register MMIO
     // as if it were framebuffer memory.
-    IOLog("VMVirtIOFramebuffer::getVRAMRange() - m_fb_device_memory is NULL — returning NULL\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::getVRAMRange() - m_fb_device_memory is NULL — returning NULL\n");
     return nullptr;
 }
 
@@ -829,7 +876,7 @@ const char* VMVirtIOFramebuffer::getPixelFormats(void)
 {
     // Return OpenGL-compatible pixel formats for hardware acceleration
     // Support ARGB8888 (32-bit with alpha) and RGB888 (24-bit) for OpenGL
-    IOLog("VMVirtIOFramebuffer::getPixelFormats() - Returning OpenGL-compatible formats (ARGB8888, RGB888)\n");
+    VMLOG_DEBUG("VMVirtIOFramebuffer::getPixelFormats() - Returning OpenGL-compatible formats (ARGB8888, RGB888)\n");
     
     // Standard IOKit pixel format specification for OpenGL support
     // Format: IO32BitDirectPixels and IO16BitDirectPixels for acceleration
@@ -841,20 +888,20 @@ const char* VMVirtIOFramebuffer::getPixelFormats(void)
 
 IOItemCount VMVirtIOFramebuffer::getDisplayModeCount(void)
 {
-    IOLog("VMVirtIOFramebuffer::getDisplayModeCount() - Returning %u modes\n", m_mode_count);
+    VMLOG_DEBUG("VMVirtIOFramebuffer::getDisplayModeCount() - Returning %u modes\n", m_mode_count);
     return m_mode_count;
 }
 
 IOReturn VMVirtIOFramebuffer::getDisplayModes(IODisplayModeID* allDisplayModes)
 {
-    IOLog("VMVirtIOFramebuffer::getDisplayModes() - WindowServer requesting display mode list\n");
+    VMLOG_DEBUG("VMVirtIOFramebuffer::getDisplayModes() - WindowServer requesting display mode list\n");
     if (!allDisplayModes) {
         return kIOReturnBadArgument;
     }
     
     for (IOItemCount i = 0; i < m_mode_count; i++) {
         allDisplayModes[i] = m_display_modes[i];
-        IOLog("  Mode %u: ID=%d\n", i, m_display_modes[i]);
+        VMLOG_DEBUG("  Mode %u: ID=%d\n", i, m_display_modes[i]);
     }
     
     return kIOReturnSuccess;
@@ -931,7 +978,7 @@ IOReturn VMVirtIOFramebuffer::getPixelInformation(IODisplayModeID displayMode, I
     // the live mode. (Earlier placement of this log was misleading — it fired
     // before the activeWidth/activeHeight assignments and read stale caller
     // state, not what we returned. Now at the end where it belongs.)
-    IOLog("VMVirtIOFramebuffer::getPixelInformation: queried mode=%u → bytesPerRow=%u active=%ux%u | live mode=%u m_width=%u m_height=%u\n",
+    VMLOG_DEBUG("VMVirtIOFramebuffer::getPixelInformation: queried mode=%u → bytesPerRow=%u active=%ux%u | live mode=%u m_width=%u m_height=%u\n",
           (unsigned)displayMode, (unsigned)pixelInfo->bytesPerRow,
           (unsigned)pixelInfo->activeWidth, (unsigned)pixelInfo->activeHeight,
           (unsigned)m_current_mode, (unsigned)m_width, (unsigned)m_height);
@@ -957,7 +1004,7 @@ IOReturn VMVirtIOFramebuffer::getTimingInfoForDisplayMode(IODisplayModeID displa
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMVirtIOFramebuffer::getTimingInfoForDisplayMode() - mode=%d\n", (int)displayMode);
+    VMLOG_DEBUG("VMVirtIOFramebuffer::getTimingInfoForDisplayMode() - mode=%d\n", (int)displayMode);
     
     // Clear the structure
     bzero(info, sizeof(IOTimingInformation));
@@ -966,7 +1013,7 @@ IOReturn VMVirtIOFramebuffer::getTimingInfoForDisplayMode(IODisplayModeID displa
     IODisplayModeInformation modeInfo;
     IOReturn result = getInformationForDisplayMode(displayMode, &modeInfo);
     if (result != kIOReturnSuccess) {
-        IOLog("VMVirtIOFramebuffer::getTimingInfoForDisplayMode() - Failed to get mode info\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::getTimingInfoForDisplayMode() - Failed to get mode info\n");
         return result;
     }
     
@@ -1016,7 +1063,7 @@ IOReturn VMVirtIOFramebuffer::getTimingInfoForDisplayMode(IODisplayModeID displa
     detailed->minPixelClock = detailed->pixelClock;
     detailed->maxPixelClock = detailed->pixelClock;
     
-    IOLog("VMVirtIOFramebuffer::getTimingInfoForDisplayMode() - Returning timing for %dx%d@60Hz\n",
+    VMLOG_DEBUG("VMVirtIOFramebuffer::getTimingInfoForDisplayMode() - Returning timing for %dx%d@60Hz\n",
           (int)modeInfo.nominalWidth, (int)modeInfo.nominalHeight);
     
     return kIOReturnSuccess;
@@ -1027,7 +1074,7 @@ IOReturn VMVirtIOFramebuffer::getTimingInfoForDisplayMode(IODisplayModeID displa
 IOReturn VMVirtIOFramebuffer::newUserClient(task_t owningTask, void* securityID,
                                             UInt32 type, IOUserClient** handler)
 {
-    IOLog("VMVirtIOFramebuffer::newUserClient() - WindowServer requesting user client (type=%u)\n", type);
+    VMLOG_INFO("VMVirtIOFramebuffer::newUserClient() - WindowServer requesting user client (type=%u)\n", type);
 
     // type 0 (kIOFBServerConnectType) and type 1 (kIOFBSharedConnectType) belong to
     // IOFramebuffer — WindowServer expects an IOFramebufferUserClient created by the
@@ -1036,22 +1083,22 @@ IOReturn VMVirtIOFramebuffer::newUserClient(task_t owningTask, void* securityID,
     // dispatch tables are unrelated. Delegate to super; reserve VMQemuVGAClient for
     // private custom-type connections (high type numbers).
     if (type == 0 || type == 1) {
-        IOLog("VMVirtIOFramebuffer::newUserClient() - type=%u is IOFramebuffer standard, delegating to super\n", type);
+        VMLOG_INFO("VMVirtIOFramebuffer::newUserClient() - type=%u is IOFramebuffer standard, delegating to super\n", type);
         return super::newUserClient(owningTask, securityID, type, handler);
     }
 
     // Custom type — build the private VMQemuVGAClient.
-    IOLog("VMVirtIOFramebuffer::newUserClient() - type=%u is custom, constructing VMQemuVGAClient\n", type);
+    VMLOG_INFO("VMVirtIOFramebuffer::newUserClient() - type=%u is custom, constructing VMQemuVGAClient\n", type);
     IOUserClient* client = OSTypeAlloc(VMQemuVGAClient);
     if (!client) {
-        IOLog("VMVirtIOFramebuffer::newUserClient() - Failed to allocate VMQemuVGAClient\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::newUserClient() - Failed to allocate VMQemuVGAClient\n");
         *handler = nullptr;
         return kIOReturnNoMemory;
     }
     
     // Initialize the client with the task
     if (!client->initWithTask(owningTask, securityID, type)) {
-        IOLog("VMVirtIOFramebuffer::newUserClient() - Client initWithTask failed\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::newUserClient() - Client initWithTask failed\n");
         client->release();
         *handler = nullptr;
         return kIOReturnError;
@@ -1059,7 +1106,7 @@ IOReturn VMVirtIOFramebuffer::newUserClient(task_t owningTask, void* securityID,
     
     // Attach client to this framebuffer
     if (!client->attach(this)) {
-        IOLog("VMVirtIOFramebuffer::newUserClient() - Client attach failed\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::newUserClient() - Client attach failed\n");
         client->release();
         *handler = nullptr;
         return kIOReturnError;
@@ -1067,7 +1114,7 @@ IOReturn VMVirtIOFramebuffer::newUserClient(task_t owningTask, void* securityID,
     
     // Start the client
     if (!client->start(this)) {
-        IOLog("VMVirtIOFramebuffer::newUserClient() - Client start failed\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::newUserClient() - Client start failed\n");
         client->detach(this);
         client->release();
         *handler = nullptr;
@@ -1075,22 +1122,22 @@ IOReturn VMVirtIOFramebuffer::newUserClient(task_t owningTask, void* securityID,
     }
     
     *handler = client;
-    IOLog("VMVirtIOFramebuffer::newUserClient() - VMQemuVGAClient created successfully\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::newUserClient() - VMQemuVGAClient created successfully\n");
     return kIOReturnSuccess;
 }
 
 // CRITICAL: Safe open method override for WindowServer connection handling
 IOReturn VMVirtIOFramebuffer::open(void)
 {
-    IOLog("VMVirtIOFramebuffer::open() - *** WINDOWSERVER OPEN REQUESTED ***\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::open() - *** WINDOWSERVER OPEN REQUESTED ***\n");
     
     // Call parent implementation - now safe because we have IOUserClientClass="VMQemuVGAClient"
-    IOLog("VMVirtIOFramebuffer::open() - Calling super::open()\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::open() - Calling super::open()\n");
     IOReturn result = super::open();
-    IOLog("VMVirtIOFramebuffer::open() - super::open() returned: 0x%x\n", result);
+    VMLOG_INFO("VMVirtIOFramebuffer::open() - super::open() returned: 0x%x\n", result);
     
     if (result != kIOReturnSuccess) {
-        IOLog("VMVirtIOFramebuffer::open() - super::open() failed, forcing success for VM compatibility\n");
+        VMLOG_WARN("VMVirtIOFramebuffer::open() - super::open() failed, forcing success for VM compatibility\n");
         result = kIOReturnSuccess;
     }
     
@@ -1101,18 +1148,18 @@ IOReturn VMVirtIOFramebuffer::open(void)
     // NOTE: Keep IOConsoleDevice=true (set by isConsoleDevice()) for QXL-style dual capability
     setProperty("IODisplayAccelerated", kOSBooleanFalse);  // DISABLE acceleration - no Metal support yet
     
-    IOLog("VMVirtIOFramebuffer::open() - *** GUI MODE FORCED ON - CONSOLE MODE DISABLED ***\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::open() - *** GUI MODE FORCED ON - CONSOLE MODE DISABLED ***\n");
     
     // DISABLED: Refresh timer handled by start() + enableController() - this code not needed
     // Let enableController() manage VirtIO GPU scanout and timer startup
     if (false && m_gpu_driver) {
-        IOLog("VMVirtIOFramebuffer::open() - SKIPPED: Timer setup handled by enableController()\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::open() - SKIPPED: Timer setup handled by enableController()\n");
         IOReturn console_result = m_gpu_driver->setscanout(0, 0, 0, 0, 0, 0);
-        IOLog("VMVirtIOFramebuffer::open() - Console scanout disable returned: 0x%x\n", console_result);
+        VMLOG_INFO("VMVirtIOFramebuffer::open() - Console scanout disable returned: 0x%x\n", console_result);
         
         // CRITICAL: Now create GUI scanout - this is REQUIRED for display to work
         // The console scanout is disabled, so we MUST enable a new scanout for GUI
-        IOLog("VMVirtIOFramebuffer::open() - Creating GUI display resource and scanout\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::open() - Creating GUI display resource and scanout\n");
         
         // Create display resource on VirtIO GPU for GUI mode
         uint32_t resource_id = 1;  // Primary GUI display resource
@@ -1120,45 +1167,45 @@ IOReturn VMVirtIOFramebuffer::open(void)
                                                                0x1, // VIRTIO_GPU_FORMAT_B8G8R8A8_UNORM
                                                                m_width, m_height);
         if (createResult == kIOReturnSuccess) {
-            IOLog("VMVirtIOFramebuffer::open() - GUI display resource created successfully\n");
+            VMLOG_INFO("VMVirtIOFramebuffer::open() - GUI display resource created successfully\n");
             
             // CRITICAL: Attach backing storage to resource
             // VirtIO GPU spec requires backing memory for resource content
-            IOLog("VMVirtIOFramebuffer::open() - Checking VRAM range: m_vram_range=%p\n", m_vram_range);
+            VMLOG_INFO("VMVirtIOFramebuffer::open() - Checking VRAM range: m_vram_range=%p\n", m_vram_range);
             if (m_vram_range) {
-                IOLog("VMVirtIOFramebuffer::open() - Attaching VRAM backing to resource (size=%llu)\n", 
+                VMLOG_INFO("VMVirtIOFramebuffer::open() - Attaching VRAM backing to resource (size=%llu)\n", 
                       m_vram_range->getLength());
                 IOReturn backingResult = m_gpu_driver->attachBacking(resource_id, m_vram_range);
-                IOLog("VMVirtIOFramebuffer::open() - attachBacking returned: 0x%x\n", backingResult);
+                VMLOG_INFO("VMVirtIOFramebuffer::open() - attachBacking returned: 0x%x\n", backingResult);
                 if (backingResult == kIOReturnSuccess) {
-                    IOLog("VMVirtIOFramebuffer::open() - *** BACKING ATTACHED SUCCESSFULLY ***\n");
+                    VMLOG_INFO("VMVirtIOFramebuffer::open() - *** BACKING ATTACHED SUCCESSFULLY ***\n");
                 } else {
-                    IOLog("VMVirtIOFramebuffer::open() - WARNING: Backing attachment failed: 0x%x\n", backingResult);
+                    VMLOG_ERROR("VMVirtIOFramebuffer::open() - WARNING: Backing attachment failed: 0x%x\n", backingResult);
                 }
             } else {
-                IOLog("VMVirtIOFramebuffer::open() - WARNING: No VRAM range available for backing (NULL pointer)\n");
+                VMLOG_WARN("VMVirtIOFramebuffer::open() - WARNING: No VRAM range available for backing (NULL pointer)\n");
             }
             
             // Enable GUI scanout on scanout 0
             IOReturn scanoutResult = m_gpu_driver->setscanout(0, resource_id, 0, 0, m_width, m_height);
             if (scanoutResult == kIOReturnSuccess) {
-                IOLog("VMVirtIOFramebuffer::open() - GUI scanout set successfully\n");
+                VMLOG_INFO("VMVirtIOFramebuffer::open() - GUI scanout set successfully\n");
                 
                 // CRITICAL: Transfer framebuffer content to host and flush to make visible
                 // VirtIO GPU spec requires transfer_to_host_2d + flush after scanout
-                IOLog("VMVirtIOFramebuffer::open() - Transferring framebuffer to host resource\n");
+                VMLOG_INFO("VMVirtIOFramebuffer::open() - Transferring framebuffer to host resource\n");
                 IOReturn transferResult = m_gpu_driver->transferToHost2D(resource_id, 0, 
                                                                          0, 0, m_width, m_height);
                 if (transferResult == kIOReturnSuccess) {
-                    IOLog("VMVirtIOFramebuffer::open() - Transfer successful, flushing display\n");
+                    VMLOG_INFO("VMVirtIOFramebuffer::open() - Transfer successful, flushing display\n");
                     IOReturn flushResult = m_gpu_driver->flushResource(resource_id, 0, 0, 
                                                                        m_width, m_height);
                     if (flushResult == kIOReturnSuccess) {
-                        IOLog("VMVirtIOFramebuffer::open() - *** GUI SCANOUT ENABLED - DISPLAY SHOULD BE ACTIVE ***\n");
+                        VMLOG_INFO("VMVirtIOFramebuffer::open() - *** GUI SCANOUT ENABLED - DISPLAY SHOULD BE ACTIVE ***\n");
                         
                         // CRITICAL: Start periodic display refresh timer
                         // This ensures framebuffer updates are continuously transferred to VirtIO GPU
-                        IOLog("VMVirtIOFramebuffer::open() - Creating periodic display refresh timer\n");
+                        VMLOG_INFO("VMVirtIOFramebuffer::open() - Creating periodic display refresh timer\n");
                         IOWorkLoop* workloop = getWorkLoop();
                         if (workloop && !m_refresh_timer) {
                             m_refresh_timer = IOTimerEventSource::timerEventSource(this, 
@@ -1168,27 +1215,27 @@ IOReturn VMVirtIOFramebuffer::open(void)
                                     // Arm at steady-state cadence; the timer re-arms at 16 ms on each
                                     // fire. The old 1 s initial arm delayed first paint for no reason.
                                     m_refresh_timer->setTimeoutMS(16);
-                                    IOLog("VMVirtIOFramebuffer::open() - Display refresh timer armed (16 ms)\n");
+                                    VMLOG_INFO("VMVirtIOFramebuffer::open() - Display refresh timer armed (16 ms)\n");
                                 } else {
-                                    IOLog("VMVirtIOFramebuffer::open() - Failed to add timer to workloop\n");
+                                    VMLOG_ERROR("VMVirtIOFramebuffer::open() - Failed to add timer to workloop\n");
                                     m_refresh_timer->release();
                                     m_refresh_timer = nullptr;
                                 }
                             } else {
-                                IOLog("VMVirtIOFramebuffer::open() - Failed to create refresh timer\n");
+                                VMLOG_ERROR("VMVirtIOFramebuffer::open() - Failed to create refresh timer\n");
                             }
                         }
                     } else {
-                        IOLog("VMVirtIOFramebuffer::open() - Flush failed: 0x%x\n", flushResult);
+                        VMLOG_ERROR("VMVirtIOFramebuffer::open() - Flush failed: 0x%x\n", flushResult);
                     }
                 } else {
-                    IOLog("VMVirtIOFramebuffer::open() - Transfer to host failed: 0x%x\n", transferResult);
+                    VMLOG_ERROR("VMVirtIOFramebuffer::open() - Transfer to host failed: 0x%x\n", transferResult);
                 }
             } else {
-                IOLog("VMVirtIOFramebuffer::open() - GUI scanout failed: 0x%x\n", scanoutResult);
+                VMLOG_ERROR("VMVirtIOFramebuffer::open() - GUI scanout failed: 0x%x\n", scanoutResult);
             }
         } else {
-            IOLog("VMVirtIOFramebuffer::open() - GUI resource creation failed: 0x%x\n", createResult);
+            VMLOG_ERROR("VMVirtIOFramebuffer::open() - GUI resource creation failed: 0x%x\n", createResult);
         }
     }
     
@@ -1197,138 +1244,298 @@ IOReturn VMVirtIOFramebuffer::open(void)
     // the base class never drove the display lifecycle. Now that
     // setupForCurrentConfig delegates to super, the base class handles
     // enableController and display setup in the correct order.
-    IOLog("VMVirtIOFramebuffer::open() - *** WINDOWSERVER OPEN COMPLETED ***\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::open() - *** WINDOWSERVER OPEN COMPLETED ***\n");
     return result;
 }
 
 void VMVirtIOFramebuffer::close(void)
 {
-    IOLog("VMVirtIOFramebuffer::close() - *** WINDOWSERVER CLOSE REQUESTED ***\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::close() - *** WINDOWSERVER CLOSE REQUESTED ***\n");
     
     // Stop display refresh timer
     if (m_refresh_timer) {
-        IOLog("VMVirtIOFramebuffer::close() - Stopping display refresh timer\n");
-        m_refresh_timer->cancelTimeout();
-        
-        IOWorkLoop* workloop = getWorkLoop();
-        if (workloop) {
-            workloop->removeEventSource(m_refresh_timer);
-        }
-        
-        m_refresh_timer->release();
-        m_refresh_timer = nullptr;
+        VMLOG_INFO("VMVirtIOFramebuffer::close() - Stopping display refresh timer\n");
+        stopRefreshTimer();
     }
     
     // Reset GUI mode properties when WindowServer closes
     setProperty("IOFramebufferOpenForGUI", kOSBooleanFalse);
     
-    IOLog("VMVirtIOFramebuffer::close() - GUI mode properties reset\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::close() - GUI mode properties reset\n");
     
     super::close();
     
-    IOLog("VMVirtIOFramebuffer::close() - *** WINDOWSERVER CLOSE COMPLETED ***\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::close() - *** WINDOWSERVER CLOSE COMPLETED ***\n");
 }
 
-// Tear down any existing framebuffer resource. Safe to call when nothing is set up.
+// Tear down every pooled framebuffer resource. Safe to call when nothing is set up.
 void VMVirtIOFramebuffer::teardownFramebufferResource()
 {
-    if (m_fb_resource_id != 0 && m_gpu_driver) {
+    for (uint32_t i = 0; i < kScanoutPoolSize; i++) {
+        releaseScanoutResource(&m_scanout_pool[i]);
+    }
+    m_fb_resource_id = 0;
+    m_fb_is_blob = false;
+}
+
+bool VMVirtIOFramebuffer::ownsDisplayResource(uint32_t resource_id) const
+{
+    if (resource_id == 0) {
+        return false;
+    }
+    for (uint32_t i = 0; i < kScanoutPoolSize; i++) {
+        if (m_scanout_pool[i].resource_id == resource_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Blob entries match any dims (one blob covers the whole buffer); 2D
+// entries match exactly.
+VMVirtIOFramebuffer::ScanoutResource*
+VMVirtIOFramebuffer::findScanoutResource(uint32_t width, uint32_t height, uint32_t format)
+{
+    for (uint32_t i = 0; i < kScanoutPoolSize; i++) {
+        ScanoutResource* e = &m_scanout_pool[i];
+        if (e->resource_id == 0 || e->format != format) {
+            continue;
+        }
+        if (e->is_blob || (e->width == width && e->height == height)) {
+            return e;
+        }
+    }
+    return nullptr;
+}
+
+// Free slot, or the least recently used entry that is not on scanout.
+VMVirtIOFramebuffer::ScanoutResource* VMVirtIOFramebuffer::claimScanoutSlot()
+{
+    ScanoutResource* victim = nullptr;
+    for (uint32_t i = 0; i < kScanoutPoolSize; i++) {
+        ScanoutResource* e = &m_scanout_pool[i];
+        if (e->resource_id == 0) {
+            return e;
+        }
+        if (e->resource_id == m_fb_resource_id) {
+            continue;
+        }
+        if (!victim || e->last_used < victim->last_used) {
+            victim = e;
+        }
+    }
+    if (victim) {
+        VMLOG_DEBUG("VMVirtIOFramebuffer::claimScanoutSlot: evicting resource %u (%ux%u)\n",
+              victim->resource_id, victim->width, victim->height);
+        releaseScanoutResource(victim);
+    }
+    return victim;
+}
+
+void VMVirtIOFramebuffer::releaseScanoutResource(ScanoutResource* entry)
+{
+    if (entry->resource_id != 0 && m_gpu_driver) {
         // deallocateResource sends VIRTIO_GPU_CMD_RESOURCE_UNREF, which makes
         // the host drop both the resource and its backing attachment. The
         // caller-owned backing memory (m_fb_backing) is NOT released here —
         // Phase 2: the buffer is allocated once in start() and lives until
         // free(). It was never registered in the resource slot's backing_memory
         // field, so deallocateResource won't try to release it either.
-        m_gpu_driver->deallocateResource(m_fb_resource_id);
+        m_gpu_driver->deallocateResource(entry->resource_id);
+    }
+    if (entry->resource_id == m_fb_resource_id) {
         m_fb_resource_id = 0;
+        m_fb_is_blob = false;
     }
+    bzero(entry, sizeof(*entry));
 }
 
-// Allocate framebuffer backing, create VirtIO GPU resource, attach backing,
-// set scanout. Re-callable for mode changes: tears down any existing setup first.
+// Point this head's scanout at an entry that is already live on the host.
+// This is the whole fast path: one SET_SCANOUT (or SET_SCANOUT_BLOB).
+IOReturn VMVirtIOFramebuffer::scanoutPooledResource(ScanoutResource* entry,
+                                                    uint32_t width, uint32_t height)
+{
+    IOReturn ret;
+    if (entry->is_blob) {
+        ret = m_gpu_driver->setScanoutBlob(m_scanout_id, entry->resource_id,
+                                           entry->format, width, height, width * 4);
+    } else {
+        ret = m_gpu_driver->setscanout(m_scanout_id, entry->resource_id, 0, 0, width, height);
+    }
+    if (ret != kIOReturnSuccess) {
+        return ret;
+    }
+    entry->last_used = ++m_scanout_pool_clock;
+    m_fb_resource_id = entry->resource_id;
+    m_fb_is_blob = entry->is_blob;
+    return kIOReturnSuccess;
+}
+
+// Zero-copy scanout: describe m_fb_backing to the host as a guest-memory blob
+// and scan out of it directly. The host maps the same pages WindowServer
+// draws into, so RESOURCE_FLUSH alone makes new pixels visible. Shareable so
+// the host display backend may import the pages rather than copy them.
+//
+// The blob spans the whole fixed buffer, not just width × height × 4, so
+// later mode switches reuse it with a new SET_SCANOUT_BLOB.
+IOReturn VMVirtIOFramebuffer::setupBlobScanout(uint32_t width, uint32_t height)
+{
+    if (!m_gpu_driver->supportsResourceBlob()) {
+        return kIOReturnUnsupported;
+    }
+
+    ScanoutResource* entry = claimScanoutSlot();
+    if (!entry) {
+        return kIOReturnNoSpace;
+    }
+
+    uint32_t resource_id = ownsDisplayResource(VMVirtIOGPU::displayResourceIdForScanout(m_scanout_id))
+                           ? m_gpu_driver->allocateDisplayResourceId()
+                           : VMVirtIOGPU::displayResourceIdForScanout(m_scanout_id);
+    IOReturn ret = m_gpu_driver->createResourceBlob(
+        resource_id,
+        VIRTIO_GPU_BLOB_MEM_GUEST,
+        VIRTIO_GPU_BLOB_FLAG_USE_SHAREABLE,
+        m_fb_backing,
+        m_fb_backing->getLength());
+    if (ret != kIOReturnSuccess) {
+        VMLOG_INFO("VMVirtIOFramebuffer::setupBlobScanout: createResourceBlob 0x%x — falling back to 2D\n", ret);
+        return ret;
+    }
+
+    // Register before scanout so VMVirtIOGPU's 3D-takeover check
+    // (ownsDisplayResource) recognises the resource as ours.
+    entry->resource_id = resource_id;
+    entry->width = width;
+    entry->height = height;
+    entry->format = VIRTIO_GPU_FORMAT_B8G8R8A8_UNORM;
+    entry->is_blob = true;
+
+    ret = scanoutPooledResource(entry, width, height);
+    if (ret != kIOReturnSuccess) {
+        VMLOG_INFO("VMVirtIOFramebuffer::setupBlobScanout: setScanoutBlob 0x%x — falling back to 2D\n", ret);
+        releaseScanoutResource(entry);
+        return ret;
+    }
+    return kIOReturnSuccess;
+}
+
+// Make a width × height scanout live on the fixed buffer. Re-callable for
+// mode changes. Order of preference:
+//   1. pooled resource for (width, height, format) — one SET_SCANOUT;
+//   2. new guest-memory blob over the whole buffer (reused for every mode);
+//   3. new CREATE_2D + ATTACH_BACKING resource added to the pool.
 // All three roles — aperture, backing, transfer source — use m_fb_backing,
 // which is the load-bearing invariant. Physically contiguous so the same
 // memory can be wrapped as IODeviceMemory for getApertureRange/getVRAMRange.
 IOReturn VMVirtIOFramebuffer::setupFramebufferResource(uint32_t width, uint32_t height)
 {
     if (!m_gpu_driver) {
-        IOLog("VMVirtIOFramebuffer::setupFramebufferResource: no gpu_driver\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::setupFramebufferResource: no gpu_driver\n");
         return kIOReturnNotReady;
     }
     if (width == 0 || height == 0 || width > 8192 || height > 8192) {
-        IOLog("VMVirtIOFramebuffer::setupFramebufferResource: bad dims %ux%u\n", width, height);
+        VMLOG_INFO("VMVirtIOFramebuffer::setupFramebufferResource: bad dims %ux%u\n", width, height);
         return kIOReturnBadArgument;
     }
 
     // Phase 2 contract: m_fb_backing and m_fb_device_memory are allocated ONCE
-    // in start() and live until free(). This function creates the virtio
-    // resource against that buffer; it does NOT own or realloc the buffer.
-    // Phase 3 will relax the idempotent guard to allow resource recreate on
-    // mode change (UNREF + CREATE_2D + ATTACH_BACKING + SET_SCANOUT, buffer
-    // preserved).
+    // in start() and live until free(). This function creates or reuses virtio
+    // resources against that buffer; it does NOT own or realloc the buffer.
     if (!m_fb_backing || !m_fb_device_memory) {
-        IOLog("VMVirtIOFramebuffer::setupFramebufferResource: no fixed buffer (start() did not allocate)\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::setupFramebufferResource: no fixed buffer (start() did not allocate)\n");
         return kIOReturnNotReady;
     }
 
-    // Phase 3: resource-recreate path. Skip only when the live resource is at
-    // the requested dims (true idempotency). Otherwise fall through past the
-    // guard — teardownFramebufferResource() below will UNREF the old resource
-    // before createResource2D builds the new one. Buffer is preserved (Phase 2),
-    // so WindowServer's aperture mapping stays valid across the recreate.
+    // True idempotency: the live resource is already at the requested dims.
     if (m_fb_resource_id != 0 && m_width == width && m_height == height) {
-        IOLog("VMVirtIOFramebuffer::setupFramebufferResource: resource %u already live at %ux%u — no recreate needed\n",
+        VMLOG_INFO("VMVirtIOFramebuffer::setupFramebufferResource: resource %u already live at %ux%u — no recreate needed\n",
               m_fb_resource_id, width, height);
         return kIOReturnSuccess;
     }
-    if (m_fb_resource_id != 0) {
-        IOLog("VMVirtIOFramebuffer::setupFramebufferResource: RECREATE resource %u for new dims %ux%u (was %ux%u)\n",
-              m_fb_resource_id, width, height, m_width, m_height);
-    }
 
     // Sanity: the fixed buffer must be at least width × height × 4 bytes for
-    // this mode to fit. Phase 4 will keep the advertised mode table in sync
-    // with the allocation, but defend here too.
+    // this mode to fit. Phase 4 keeps the advertised mode table in sync with
+    // the allocation, but defend here too.
     size_t mode_size = (size_t)width * height * 4;
     if ((size_t)m_fb_backing->getLength() < mode_size) {
-        IOLog("VMVirtIOFramebuffer::setupFramebufferResource: fixed buffer %llu bytes < mode %zu bytes (%ux%u) — mode doesn't fit\n",
+        VMLOG_INFO("VMVirtIOFramebuffer::setupFramebufferResource: fixed buffer %llu bytes < mode %zu bytes (%ux%u) — mode doesn't fit\n",
               (uint64_t)m_fb_backing->getLength(), mode_size, width, height);
         return kIOReturnNoSpace;
     }
 
-    // teardownFramebufferResource sends UNREF on any stale resource; no-op
-    // when m_fb_resource_id is 0. Does NOT release the buffer (Phase 2).
-    teardownFramebufferResource();
+    const uint32_t format = VIRTIO_GPU_FORMAT_B8G8R8A8_UNORM;
 
-    // Create resource against the existing buffer, attach, scan out.
-    m_fb_resource_id = 1;  // primary display resource (matches existing convention)
+    // Fast path: the pool already holds a resource that can scan out this mode.
+    ScanoutResource* pooled = findScanoutResource(width, height, format);
+    if (pooled) {
+        IOReturn ret = scanoutPooledResource(pooled, width, height);
+        if (ret == kIOReturnSuccess) {
+            VMLOG_INFO("VMVirtIOFramebuffer::setupFramebufferResource: %ux%u REUSE %s resource %u (was %ux%u) — one command\n",
+                  width, height, pooled->is_blob ? "blob" : "2D", pooled->resource_id, m_width, m_height);
+            m_width = width;
+            m_height = height;
+            return kIOReturnSuccess;
+        }
+        // The host rejected a resource we believed live; drop it and build fresh.
+        VMLOG_ERROR("VMVirtIOFramebuffer::setupFramebufferResource: reuse of resource %u failed 0x%x — recreating\n",
+              pooled->resource_id, ret);
+        releaseScanoutResource(pooled);
+    }
+
+    // Preferred creation path: guest-memory blob, scanned out in place. Any
+    // failure leaves nothing new live and drops through to CREATE_2D below.
+    if (setupBlobScanout(width, height) == kIOReturnSuccess) {
+        VMLOG_INFO("VMVirtIOFramebuffer::setupFramebufferResource: %ux%u BLOB scanout on fixed buffer backing=%p phys=0x%llx\n",
+              width, height, m_fb_backing,
+              (uint64_t)m_fb_device_memory->getPhysicalAddress());
+        m_width = width;
+        m_height = height;
+        return kIOReturnSuccess;
+    }
+
+    // Create a 2D resource for this mode against the existing buffer.
+    ScanoutResource* entry = claimScanoutSlot();
+    if (!entry) {
+        VMLOG_INFO("VMVirtIOFramebuffer::setupFramebufferResource: scanout pool exhausted\n");
+        return kIOReturnNoSpace;
+    }
+    uint32_t resource_id = ownsDisplayResource(VMVirtIOGPU::displayResourceIdForScanout(m_scanout_id))
+                           ? m_gpu_driver->allocateDisplayResourceId()
+                           : VMVirtIOGPU::displayResourceIdForScanout(m_scanout_id);
     IOReturn create_ret = m_gpu_driver->createResource2D(
-        m_fb_resource_id,
-        0x1,  // VIRTIO_GPU_FORMAT_B8G8R8A8_UNORM
+        resource_id,
+        format,
         width, height,
         m_fb_backing);  // caller-owned — driver skips internal alloc
     if (create_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOFramebuffer::setupFramebufferResource: createResource2D 0x%x\n", create_ret);
-        teardownFramebufferResource();
+        VMLOG_INFO("VMVirtIOFramebuffer::setupFramebufferResource: createResource2D 0x%x\n", create_ret);
         return create_ret;
     }
 
-    // Point scanout at the new resource.
-    IOReturn scanout_ret = m_gpu_driver->setscanout(0, m_fb_resource_id, 0, 0, width, height);
+    // Register before scanout so VMVirtIOGPU's 3D-takeover check
+    // (ownsDisplayResource) recognises the resource as ours.
+    entry->resource_id = resource_id;
+    entry->width = width;
+    entry->height = height;
+    entry->format = format;
+    entry->is_blob = false;
+
+    IOReturn scanout_ret = scanoutPooledResource(entry, width, height);
     if (scanout_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOFramebuffer::setupFramebufferResource: setscanout 0x%x\n", scanout_ret);
-        teardownFramebufferResource();
+        VMLOG_INFO("VMVirtIOFramebuffer::setupFramebufferResource: setscanout 0x%x\n", scanout_ret);
+        releaseScanoutResource(entry);
         return scanout_ret;
     }
 
+    VMLOG_INFO("VMVirtIOFramebuffer::setupFramebufferResource: %ux%u NEW resource %u (was %ux%u) using fixed buffer backing=%p phys=0x%llx len=%llu\n",
+          width, height, resource_id, m_width, m_height, m_fb_backing,
+          (uint64_t)m_fb_device_memory->getPhysicalAddress(),
+          (uint64_t)m_fb_device_memory->getLength());
+
     // Update framebuffer dimensions to match the new resource.
     m_width = width;
     m_height = height;
-
-    IOLog("VMVirtIOFramebuffer::setupFramebufferResource: %ux%u using fixed buffer backing=%p phys=0x%llx len=%llu\n",
-          width, height, m_fb_backing,
-          (uint64_t)m_fb_device_memory->getPhysicalAddress(),
-          (uint64_t)m_fb_device_memory->getLength());
     return kIOReturnSuccess;
 }
 
@@ -1342,10 +1549,10 @@ IOReturn VMVirtIOFramebuffer::setupFramebufferResource(uint32_t width, uint32_t
 // / PROBE FAIL with the failing phase.
 void VMVirtIOFramebuffer::probeResourceRecreate()
 {
-    IOLog("VMVirtIOFramebuffer::probeResourceRecreate: PROBE START\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::probeResourceRecreate: PROBE START\n");
 
     if (!m_fb_backing || !m_fb_device_memory || m_fb_resource_id == 0) {
-        IOLog("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL precondition — backing=%p dev_mem=%p resource_id=%u\n",
+        VMLOG_ERROR("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL precondition — backing=%p dev_mem=%p resource_id=%u\n",
               m_fb_backing, m_fb_device_memory, m_fb_resource_id);
         return;
     }
@@ -1364,7 +1571,7 @@ void VMVirtIOFramebuffer::probeResourceRecreate()
     // Phase A: recreate at probe dims. Must succeed.
     IOReturn recreate_ret = setupFramebufferResource(probe_w, probe_h);
     if (recreate_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL phase A recreate returned 0x%x\n",
+        VMLOG_ERROR("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL phase A recreate returned 0x%x\n",
               recreate_ret);
         // Try to restore to a known-good state. If this also fails, the
         // framebuffer is broken — let enableController's transferToHost2D
@@ -1375,7 +1582,7 @@ void VMVirtIOFramebuffer::probeResourceRecreate()
 
     // Phase B: buffer must NOT have moved. Same backing pointer + same dev_mem.
     if (m_fb_backing != backing_before || m_fb_device_memory != dev_mem_before) {
-        IOLog("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL phase B buffer moved (backing %p → %p, dev_mem %p → %p) — recreate path is reallocating, not preserving\n",
+        VMLOG_ERROR("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL phase B buffer moved (backing %p → %p, dev_mem %p → %p) — recreate path is reallocating, not preserving\n",
               backing_before, m_fb_backing, dev_mem_before, m_fb_device_memory);
         setupFramebufferResource(saved_w, saved_h);
         return;
@@ -1384,56 +1591,56 @@ void VMVirtIOFramebuffer::probeResourceRecreate()
     // Phase C: restore to original dims. Must also succeed.
     IOReturn restore_ret = setupFramebufferResource(saved_w, saved_h);
     if (restore_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL phase C restore returned 0x%x — framebuffer left at probe dims %ux%u\n",
+        VMLOG_ERROR("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL phase C restore returned 0x%x — framebuffer left at probe dims %ux%u\n",
               restore_ret, probe_w, probe_h);
         return;
     }
 
     // Phase D: buffer still must not have moved, and dims restored.
     if (m_fb_backing != backing_before || m_fb_device_memory != dev_mem_before) {
-        IOLog("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL phase D buffer moved on restore\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL phase D buffer moved on restore\n");
         return;
     }
     if (m_width != saved_w || m_height != saved_h) {
-        IOLog("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL phase D dims not restored (now %ux%u, expected %ux%u)\n",
+        VMLOG_ERROR("VMVirtIOFramebuffer::probeResourceRecreate: PROBE FAIL phase D dims not restored (now %ux%u, expected %ux%u)\n",
               m_width, m_height, saved_w, saved_h);
         return;
     }
 
-    IOLog("VMVirtIOFramebuffer::probeResourceRecreate: PROBE PASS (recreate at %ux%u → restore at %ux%u, buffer stable, resource=%u)\n",
+    VMLOG_INFO("VMVirtIOFramebuffer::probeResourceRecreate: PROBE PASS (recreate at %ux%u → restore at %ux%u, buffer stable, resource=%u)\n",
           probe_w, probe_h, saved_w, saved_h, m_fb_resource_id);
 }
 
 // IOFramebuffer optional overrides
 IOReturn VMVirtIOFramebuffer::enableController()
 {
-    IOLog("VMVirtIOFramebuffer::enableController() - SAFE VERSION ENTRY POINT\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - SAFE VERSION ENTRY POINT\n");
     
     // TEMPORARY: Allow re-execution to test blue pattern
     // TODO: Re-enable safety check after testing
-    static bool already_enabled = false;
-    static int call_count = 0;
-    call_count++;
+    // Per head: a function-static here would let the primary's calls count
+    // against the secondary heads.
+    m_enable_call_count++;
     
-    if (already_enabled && call_count > 2) {
-        IOLog("VMVirtIOFramebuffer::enableController() - Already enabled, skipping duplicate call (call #%d)\n", call_count);
+    if (m_controller_enabled && m_enable_call_count > 2) {
+        VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Already enabled, skipping duplicate call (call #%d)\n", m_enable_call_count);
         return kIOReturnSuccess;
     }
     
-    IOLog("VMVirtIOFramebuffer::enableController() - About to call parent enableController\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - About to call parent enableController\n");
     
     // CRITICAL: Call parent implementation first - but safely handle failures
     IOReturn result = super::enableController();
-    IOLog("VMVirtIOFramebuffer::enableController() - Parent enableController returned: 0x%x\n", result);
+    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Parent enableController returned: 0x%x\n", result);
     
     if (result != kIOReturnSuccess) {
-        IOLog("VMVirtIOFramebuffer::enableController() - Parent enableController failed: 0x%x, continuing anyway\n", result);
+        VMLOG_ERROR("VMVirtIOFramebuffer::enableController() - Parent enableController failed: 0x%x, continuing anyway\n", result);
         // Don't return - continue with our initialization for VM compatibility
     }
     
     // Mark as enabled to prevent duplicate calls
-    already_enabled = true;
-    IOLog("VMVirtIOFramebuffer::enableController() - Marked as enabled, continuing with safe initialization\n");
+    m_controller_enabled = true;
+    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Marked as enabled, continuing with safe initialization\n");
     
     // NOTE: Console is disabled in open() via VirtIO GPU scanout disable (setscanout with resource_id=0)
     // No need for PE_Video_Console_Disable() - the VirtIO GPU method is more reliable
@@ -1443,26 +1650,26 @@ IOReturn VMVirtIOFramebuffer::enableController()
     uintptr_t isOnline = 0;
     IOReturn connectionResult = getAttributeForConnection(0, kConnectionCheckEnable, &isOnline);
     if (connectionResult == kIOReturnSuccess && isOnline) {
-        IOLog("VMVirtIOFramebuffer::enableController() - Connection check PASSED: Display is ONLINE\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Connection check PASSED: Display is ONLINE\n");
     } else {
-        IOLog("VMVirtIOFramebuffer::enableController() - Connection check result: 0x%x, isOnline: %lu\n", 
+        VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Connection check result: 0x%x, isOnline: %lu\n", 
               connectionResult, isOnline);
     }
     
     // FORCE: Also try kConnectionEnable directly
     uintptr_t enableStatus = 0;
     IOReturn enableResult = getAttributeForConnection(0, kConnectionEnable, &enableStatus);
-    IOLog("VMVirtIOFramebuffer::enableController() - kConnectionEnable check result: 0x%x, status: %lu\n", 
+    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - kConnectionEnable check result: 0x%x, status: %lu\n", 
           enableResult, enableStatus);
     
     // FORCE: Set connection to enabled state
     IOReturn setResult = setAttributeForConnection(0, kConnectionEnable, 1);
-    IOLog("VMVirtIOFramebuffer::enableController() - Force kConnectionEnable result: 0x%x\n", setResult);
+    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Force kConnectionEnable result: 0x%x\n", setResult);
     
     // ACTIVE MODE: Set up VirtIO GPU display properly for GUI activation
     // The framebuffer needs to be active to enable GUI mode
-    IOLog("VMVirtIOFramebuffer::enableController() - ACTIVE MODE: Setting up VirtIO GPU display\n");
-    IOLog("VMVirtIOFramebuffer::enableController() - Enabling VirtIO GPU framebuffer for GUI activation\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - ACTIVE MODE: Setting up VirtIO GPU display\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Enabling VirtIO GPU framebuffer for GUI activation\n");
     
     // *** CRITICAL DISCOVERY FROM SPEC SECTION 5.7.7: ***
     // "VGA compatibility: PCI region 0 has the linear framebuffer, standard vga registers are present.
@@ -1485,7 +1692,7 @@ IOReturn VMVirtIOFramebuffer::enableController()
         
         // If not found on driver, try the PCI provider
         if (!deviceType && m_pci_device) {
-            IOLog("VMVirtIOFramebuffer::enableController() - Checking PCI device properties\n");
+            VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Checking PCI device properties\n");
             deviceType = OSDynamicCast(OSString, m_pci_device->getProperty("VMVirtIODeviceType"));
             vgaCompat = OSDynamicCast(OSBoolean, m_pci_device->getProperty("VirtIO-VGA-Compatibility"));
         }
@@ -1494,7 +1701,7 @@ IOReturn VMVirtIOFramebuffer::enableController()
         
         if (deviceType) {
             const char* typeStr = deviceType->getCStringNoCopy();
-            IOLog("VMVirtIOFramebuffer::enableController() - Device type: %s\n", typeStr);
+            VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Device type: %s\n", typeStr);
             requiresNativeMode = (strcmp(typeStr, "virtio-gpu-gl-pci") == 0);
         } else {
             // Fallback: check PCI class code directly
@@ -1503,18 +1710,18 @@ IOReturn VMVirtIOFramebuffer::enableController()
                 UInt8 baseClass = (classCode >> 24) & 0xFF;
                 UInt8 subClass = (classCode >> 16) & 0xFF;
                 
-                IOLog("VMVirtIOFramebuffer::enableController() - PCI class: 0x%02x:0x%02x\n", baseClass, subClass);
+                VMLOG_INFO("VMVirtIOFramebuffer::enableController() - PCI class: 0x%02x:0x%02x\n", baseClass, subClass);
                 
                 // 0x03:0x00 = VGA-compatible (virtio-vga-gl)
                 // 0x03:0x80 = Other display controller (virtio-gpu-gl-pci)
                 if (baseClass == 0x03 && subClass == 0x00) {
                     hasVGACompatibility = true;
                     requiresNativeMode = false;
-                    IOLog("VMVirtIOFramebuffer::enableController() - Detected VGA-compatible device (virtio-vga-gl)\n");
+                    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Detected VGA-compatible device (virtio-vga-gl)\n");
                 } else if (baseClass == 0x03 && subClass == 0x80) {
                     hasVGACompatibility = false;
                     requiresNativeMode = true;
-                    IOLog("VMVirtIOFramebuffer::enableController() - Detected pure GPU device (virtio-gpu-gl-pci)\n");
+                    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Detected pure GPU device (virtio-gpu-gl-pci)\n");
                 }
             }
         }
@@ -1529,12 +1736,12 @@ IOReturn VMVirtIOFramebuffer::enableController()
     // the virtio-vga-gl blue-screen bug.
     bool useNativeScanout = (m_gpu_driver != nullptr);
     
-    IOLog("VMVirtIOFramebuffer::enableController() - hasVGACompat=%d, requiresNative=%d, useNative=%d\n",
+    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - hasVGACompat=%d, requiresNative=%d, useNative=%d\n",
           hasVGACompatibility, requiresNativeMode, useNativeScanout);
     
     // Enable VirtIO GPU scanout if needed
     if (useNativeScanout && m_gpu_driver) {
-        IOLog("VMVirtIOFramebuffer::enableController() - VirtIO GPU native scanout ENABLED\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::enableController() - VirtIO GPU native scanout ENABLED\n");
         
         // Set up display with current resolution
         IODisplayModeInformation modeInfo;
@@ -1544,15 +1751,15 @@ IOReturn VMVirtIOFramebuffer::enableController()
             m_height = modeInfo.nominalHeight;
             m_depth = 32;
             
-            IOLog("VMVirtIOFramebuffer::enableController() - Setting up VirtIO display: %dx%d@%d\n", 
+            VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Setting up VirtIO display: %dx%d@%d\n", 
                   m_width, m_height, m_depth);
             
             // NEGATIVE CONTROL: SET_SCANOUT with invalid resource_id=999
             // Prediction: device returns 0x1203 (ERR_INVALID_RESOURCE_ID)
             // If this returns 0x1100 (OK), the response path is still broken.
-            {
+            if (m_scanout_id == 0) {
                 IOReturn test_ret = m_gpu_driver->setscanout(0, 999, 0, 0, m_width, m_height);
-                IOLog("VMVirtIOFramebuffer: NEGATIVE CONTROL — setscanout(999) returned 0x%x "
+                VMLOG_INFO("VMVirtIOFramebuffer: NEGATIVE CONTROL — setscanout(999) returned 0x%x "
                       "(expect error, not success)\n", test_ret);
             }
 
@@ -1563,7 +1770,7 @@ IOReturn VMVirtIOFramebuffer::enableController()
             // Runs before the first real createResource2D so the device is up.
             {
                 static bool resource_tracking_probed = false;
-                if (!resource_tracking_probed && m_gpu_driver) {
+                if (!resource_tracking_probed && m_gpu_driver && m_scanout_id == 0) {
                     resource_tracking_probed = true;
                     m_gpu_driver->probeResourceTracking();
                 }
@@ -1574,7 +1781,7 @@ IOReturn VMVirtIOFramebuffer::enableController()
             // so mode changes can re-invoke the same path.
             IOReturn setup_ret = setupFramebufferResource(m_width, m_height);
             if (setup_ret == kIOReturnSuccess) {
-                IOLog("VMVirtIOFramebuffer::enableController() - VirtIO GPU display resource ready (%ux%u)\n",
+                VMLOG_INFO("VMVirtIOFramebuffer::enableController() - VirtIO GPU display resource ready (%ux%u)\n",
                       m_width, m_height);
 
                 // Phase 3 probe: verify the resource-recreate path works. Runs once.
@@ -1582,8 +1789,9 @@ IOReturn VMVirtIOFramebuffer::enableController()
                 // skipped it); this probe exercises it deterministically without
                 // waiting for a Phase 4 mode switch. The probe re-calls
                 // setupFramebufferResource at a smaller dim, then restores — buffer
-                // must stay stable across both recreates.
-                {
+                // must stay stable across both recreates. Primary head only;
+                // the probes below likewise run once per device, not per head.
+                if (m_scanout_id == 0) {
                     static bool recreate_probed = false;
                     if (!recreate_probed) {
                         recreate_probed = true;
@@ -1594,7 +1802,7 @@ IOReturn VMVirtIOFramebuffer::enableController()
                 // Cursor queue transport probe (build 1): creates a test cursor
                 // resource, sends UPDATE_CURSOR + MOVE_CURSOR on queue 1. Pass:
                 // two cursors on screen (red test cursor + software cursor).
-                {
+                if (m_scanout_id == 0) {
                     static bool cursor_probed = false;
                     if (!cursor_probed && m_gpu_driver) {
                         cursor_probed = true;
@@ -1608,7 +1816,7 @@ IOReturn VMVirtIOFramebuffer::enableController()
                 // control. Gate for all 3D/virgl work. Per CLAUDE.md: only the
                 // byte readback is a real signal — SUBMIT_3D returns 0x1100
                 // unconditionally, so phases F+ prove buffer-acceptance only.
-                {
+                if (m_scanout_id == 0) {
                     static bool transport3d_probed = false;
                     if (!transport3d_probed && m_gpu_driver) {
                         transport3d_probed = true;
@@ -1617,46 +1825,49 @@ IOReturn VMVirtIOFramebuffer::enableController()
                 }
 
                 // Initial transfer so the screen isn't garbage while WindowServer composes.
-                m_gpu_driver->transferToHost2D(m_fb_resource_id, 0, 0, 0, m_width, m_height);
+                // A blob scanout reads the backing directly; only the flush is needed.
+                if (!m_fb_is_blob) {
+                    m_gpu_driver->transferToHost2D(m_fb_resource_id, 0, 0, 0, m_width, m_height);
+                }
                 m_gpu_driver->flushResource(m_fb_resource_id, 0, 0, m_width, m_height);
             } else {
-                IOLog("VMVirtIOFramebuffer::enableController() - setupFramebufferResource failed: 0x%x\n",
+                VMLOG_ERROR("VMVirtIOFramebuffer::enableController() - setupFramebufferResource failed: 0x%x\n",
                       setup_ret);
             }
         } else {
-            IOLog("VMVirtIOFramebuffer::enableController() - Failed to get mode info: 0x%x\n", modeResult);
+            VMLOG_ERROR("VMVirtIOFramebuffer::enableController() - Failed to get mode info: 0x%x\n", modeResult);
         }
     } else {
         // Not using native scanout
         if (requiresNativeMode) {
-            IOLog("VMVirtIOFramebuffer::enableController() - ⚠️  CRITICAL: virtio-gpu-gl-pci requires native scanout!\n");
-            IOLog("VMVirtIOFramebuffer::enableController() - No VGA fallback available, display will NOT work\n");
+            VMLOG_WARN("VMVirtIOFramebuffer::enableController() - ⚠️  CRITICAL: virtio-gpu-gl-pci requires native scanout!\n");
+            VMLOG_INFO("VMVirtIOFramebuffer::enableController() - No VGA fallback available, display will NOT work\n");
         } else if (hasVGACompatibility) {
-            IOLog("VMVirtIOFramebuffer::enableController() - Using VGA compatibility mode (virtio-vga-gl)\n");
-            IOLog("VMVirtIOFramebuffer::enableController() - BAR0 framebuffer writes will auto-display\n");
+            VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Using VGA compatibility mode (virtio-vga-gl)\n");
+            VMLOG_INFO("VMVirtIOFramebuffer::enableController() - BAR0 framebuffer writes will auto-display\n");
         } else {
-            IOLog("VMVirtIOFramebuffer::enableController() - ⚠️  Unknown mode - no GPU driver or display setup\n");
+            VMLOG_WARN("VMVirtIOFramebuffer::enableController() - ⚠️  Unknown mode - no GPU driver or display setup\n");
         }
     }
     
     // STEP 2: Software display activation through IOFramebuffer mechanisms
-    IOLog("VMVirtIOFramebuffer::enableController() - Software display output ready\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Software display output ready\n");
     
     // *** CRITICAL: Only enable refresh timer in native VirtIO scanout mode ***
     // In VGA compatibility mode, BAR0 writes automatically appear on screen
     // The timer would interfere by calling transferToHost2D which is not needed in VGA mode
     if (useNativeScanout && m_refresh_timer && m_gpu_driver) {
         m_refresh_timer->setTimeoutMS(16);  // 60 Hz refresh rate for native VirtIO mode
-        IOLog("VMVirtIOFramebuffer::enableController() - Display refresh timer enabled: 60 Hz (native VirtIO mode)\n");
-        IOLog("VMVirtIOFramebuffer::enableController() - Timer will transfer framebuffer updates to VirtIO GPU\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Display refresh timer enabled: 60 Hz (native VirtIO mode)\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Timer will transfer framebuffer updates to VirtIO GPU\n");
     } else if (!useNativeScanout) {
-        IOLog("VMVirtIOFramebuffer::enableController() - Timer DISABLED (VGA compatibility mode - not needed)\n");
-        IOLog("VMVirtIOFramebuffer::enableController() - BAR0 writes will auto-display via VGA BIOS\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Timer DISABLED (VGA compatibility mode - not needed)\n");
+        VMLOG_INFO("VMVirtIOFramebuffer::enableController() - BAR0 writes will auto-display via VGA BIOS\n");
     } else {
-        IOLog("VMVirtIOFramebuffer::enableController() - WARNING: Timer or GPU driver not available\n");
+        VMLOG_WARN("VMVirtIOFramebuffer::enableController() - WARNING: Timer or GPU driver not available\n");
     }
     
-    IOLog("VMVirtIOFramebuffer::enableController() - Controller enabled successfully\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::enableController() - Controller enabled successfully\n");
     
     return kIOReturnSuccess;
 }
@@ -1665,7 +1876,7 @@ IOReturn VMVirtIOFramebuffer::enableController()
 
 IOReturn VMVirtIOFramebuffer::setDisplayMode(IODisplayModeID displayMode, IOIndex depth)
 {
-    IOLog("VMVirtIOFramebuffer::setDisplayMode() - mode=%d, depth=%d\n", (int)displayMode, (int)depth);
+    VMLOG_DEBUG("VMVirtIOFramebuffer::setDisplayMode() - mode=%d, depth=%d\n", (int)displayMode, (int)depth);
     
     // Phase 4: filterModesByAllocation can produce a non-contiguous ID list
     // (middle modes filtered out when allocation falls back). Validate by
@@ -1679,7 +1890,7 @@ IOReturn VMVirtIOFramebuffer::setDisplayMode(IODisplayModeID displayMode, IOInde
         }
     }
     if (!mode_valid) {
-        IOLog("VMVirtIOFramebuffer::setDisplayMode() - Invalid mode %d (not in advertised list of %u)\n",
+        VMLOG_WARN("VMVirtIOFramebuffer::setDisplayMode() - Invalid mode %d (not in advertised list of %u)\n",
               (int)displayMode, (unsigned)m_mode_count);
         return kIOReturnUnsupported;
     }
@@ -1693,29 +1904,33 @@ IOReturn VMVirtIOFramebuffer::setDisplayMode(IODisplayModeID displayMode, IOInde
         uint32_t new_w = modeInfo.nominalWidth;
         uint32_t new_h = modeInfo.nominalHeight;
 
-        // Re-allocate framebuffer backing if dimensions changed. setupFramebufferResource
-        // tears down the old resource/backing, allocates new, re-creates, re-attaches,
-        // re-scans-out. Safe to call on first mode set too (m_fb_resource_id starts 0).
+        // Switch the scanout if dimensions changed. setupFramebufferResource
+        // reuses a pooled resource for these dims when one exists (one
+        // SET_SCANOUT) and only creates + attaches on a pool miss. Safe to
+        // call on first mode set too (m_fb_resource_id starts 0).
         if (new_w != m_width || new_h != m_height || m_fb_resource_id == 0) {
             IOReturn setup_ret = setupFramebufferResource(new_w, new_h);
             if (setup_ret != kIOReturnSuccess) {
-                IOLog("VMVirtIOFramebuffer::setDisplayMode() - setupFramebufferResource failed: 0x%x\n",
+                VMLOG_ERROR("VMVirtIOFramebuffer::setDisplayMode() - setupFramebufferResource failed: 0x%x\n",
                       setup_ret);
                 return setup_ret;
             }
+            // The scanout backing may be a different allocation now
+            if (m_accelerator)
+                m_accelerator->framebufferModeChanged();
         }
         m_depth = 32;
 
-        IOLog("VMVirtIOFramebuffer::setDisplayMode() - Set resolution to %dx%d@%d\n",
+        VMLOG_DEBUG("VMVirtIOFramebuffer::setDisplayMode() - Set resolution to %dx%d@%d\n",
               m_width, m_height, m_depth);
 
         // Trigger display refresh to update VirtIO GPU with new content
-        IOLog("VMVirtIOFramebuffer::setDisplayMode() - Refreshing VirtIO GPU display\n");
+        VMLOG_DEBUG("VMVirtIOFramebuffer::setDisplayMode() - Refreshing VirtIO GPU display\n");
         refreshDisplay();
 
         IOSleep(50); // Small delay for mode change stabilization
     } else {
-        IOLog("VMVirtIOFramebuffer::setDisplayMode() - Failed to get mode information\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::setDisplayMode() - Failed to get mode information\n");
     }
 
     // super::setDisplayMode bypassed: originally removed for an AHCI/workloop
@@ -1726,14 +1941,14 @@ IOReturn VMVirtIOFramebuffer::setDisplayMode(IODisplayModeID displayMode, IOInde
     // setDisplayMode, so the cache doesn't strand. Leaving the bypass in
     // place; re-enabling is at most a separate base-class-integration
     // question, not a fix for anything broken today.
-    IOLog("VMVirtIOFramebuffer::setDisplayMode: complete — mode=%u live m_width=%u m_height=%u\n",
+    VMLOG_DEBUG("VMVirtIOFramebuffer::setDisplayMode: complete — mode=%u live m_width=%u m_height=%u\n",
           (unsigned)m_current_mode, (unsigned)m_width, (unsigned)m_height);
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOFramebuffer::setupForCurrentConfig()
 {
-    IOLog("VMVirtIOFramebuffer::setupForCurrentConfig() - delegating to IOFramebuffer base class\n");
+    VMLOG_INFO("VMVirtIOFramebuffer::setupForCurrentConfig() - delegating to IOFramebuffer base class\n");
 
     // The base class's setupForCurrentConfig calls doSetup, which calls
     // getApertureRange(kIOFBSystemAperture) and establishes the client mapping
@@ -1757,13 +1972,18 @@ IOReturn VMVirtIOFramebuffer::getDisplayStatus(void* connectFlags)
         // 1 = display connected, 0 = no display
         *(IOOptionBits*)connectFlags = 1;
     }
-    IOLog("VMVirtIOFramebuffer::getDisplayStatus() - Display connected\n");
+    VMLOG_DEBUG("VMVirtIOFramebuffer::getDisplayStatus() - Display connected\n");
     return kIOReturnSuccess;
 }
 
 bool VMVirtIOFramebuffer::isConsoleDevice(void)
 {
-    IOLog("VMVirtIOFramebuffer::isConsoleDevice() - QXL-STYLE CONSOLE DEVICE SUPPORT\n");
+    VMLOG_DEBUG("VMVirtIOFramebuffer::isConsoleDevice() - QXL-STYLE CONSOLE DEVICE SUPPORT\n");
+
+    // Only scanout 0 is the console; secondary heads are plain displays.
+    if (m_scanout_id != 0) {
+        return false;
+    }
     
     // Like QXL: Always claim to be a console device, but support both console and GUI modes
     // This allows proper console boot and GUI transitions
@@ -1781,13 +2001,13 @@ bool VMVirtIOFramebuffer::isConsoleDevice(void)
     setProperty("AGDC", kOSBooleanFalse);
     setProperty("AGDCCapable", kOSBooleanFalse);
     
-    IOLog("VMVirtIOFramebuffer::isConsoleDevice() - Console device with GUI capability (like QXL)\n");
+    VMLOG_DEBUG("VMVirtIOFramebuffer::isConsoleDevice() - Console device with GUI capability (like QXL)\n");
     return true;  // Always claim console support - GUI will work through transitions
 }
 
 IOReturn VMVirtIOFramebuffer::setPowerState(unsigned long powerStateOrdinal, IOService* whatDevice)
 {
-    IOLog("VMVirtIOFramebuffer::setPowerState() - state=%lu\n", powerStateOrdinal);
+    VMLOG_INFO("VMVirtIOFramebuffer::setPowerState() - state=%lu\n", powerStateOrdinal);
     return kIOReturnSuccess;
 }
 
@@ -1795,7 +2015,7 @@ IOReturn VMVirtIOFramebuffer::setPowerState(unsigned long powerStateOrdinal, IOS
 // This is essential for display activation - without this, macOS considers display offline
 IOReturn VMVirtIOFramebuffer::getAttributeForConnection(IOIndex connectIndex, IOSelect attribute, uintptr_t* value)
 {
-    IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - connectIndex=%d attribute=0x%x\n", 
+    VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - connectIndex=%d attribute=0x%x\n", 
           (int)connectIndex, (unsigned int)attribute);
     
     // Decode attribute for easier debugging
@@ -1804,28 +2024,28 @@ IOReturn VMVirtIOFramebuffer::getAttributeForConnection(IOIndex connectIndex, IO
     attrStr[1] = (attribute >> 16) & 0xFF;
     attrStr[2] = (attribute >> 8) & 0xFF;
     attrStr[3] = attribute & 0xFF;
-    IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Attribute '%s' (0x%x)\n", attrStr, (unsigned int)attribute);
+    VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Attribute '%s' (0x%x)\n", attrStr, (unsigned int)attribute);
     
     // Handle NULL value pointers - these are capability checks for specific attributes
     if (!value) {
-        IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - NULL value pointer\n");
+        VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - NULL value pointer\n");
         
         // CRITICAL: Handle capability checks for display pipeline attributes
         switch (attribute) {
             case kConnectionSupportsHLDDCSense: // 'hddc' - High Definition Display Controller
-                IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - HDDC capability check: SUPPORTED\n");
+                VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - HDDC capability check: SUPPORTED\n");
                 return kIOReturnSuccess; // We support HDDC for display pipeline
                 
             case 0x6c646463: // 'lddc' - Low Definition Display Controller
-                IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - LDDC capability check: SUPPORTED\n");
+                VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - LDDC capability check: SUPPORTED\n");
                 return kIOReturnSuccess; // We support LDDC for display pipeline
                 
             case kConnectionSupportsAppleSense: // 'asns' - Apple Sense
-                IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Apple Sense capability check: SUPPORTED\n");
+                VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Apple Sense capability check: SUPPORTED\n");
                 return kIOReturnSuccess; // We support Apple Sense
                 
             default:
-                IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Unknown capability check for 0x%x\n", (unsigned int)attribute);
+                VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Unknown capability check for 0x%x\n", (unsigned int)attribute);
                 return kIOReturnBadArgument;
         }
     }
@@ -1840,7 +2060,7 @@ IOReturn VMVirtIOFramebuffer::getAttributeForConnection(IOIndex connectIndex, IO
             // Connection flags - mark as built-in DDC-capable display
             // Use kBuiltInConnection (11) and kHasDDCConnection (8) for proper detection
             *value = (1 << kBuiltInConnection) | (1 << kHasDDCConnection) | (1 << kReportsHotPlugging);
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionFlags: 0x%lx\n", *value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionFlags: 0x%lx\n", *value);
             return kIOReturnSuccess;
             
         case kConnectionCheckEnable:
@@ -1848,228 +2068,228 @@ IOReturn VMVirtIOFramebuffer::getAttributeForConnection(IOIndex connectIndex, IO
             // CRITICAL: This is what determines if display is "online"
             // Return true to indicate display is connected and active
             *value = 1; // Display is online and enabled
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionEnable: Display ONLINE\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionEnable: Display ONLINE\n");
             return kIOReturnSuccess;
             
         case kConnectionSyncFlags:
             // Sync signal flags - indicate all sync signals are active
             *value = 0xFF; // All sync signals active
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionSyncFlags: 0x%lx\n", *value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionSyncFlags: 0x%lx\n", *value);
             return kIOReturnSuccess;
             
         case kConnectionSyncEnable:
             // Sync enable capabilities
             *value = 0xFF; // All sync controls available
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionSyncEnable: 0x%lx\n", *value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionSyncEnable: 0x%lx\n", *value);
             return kIOReturnSuccess;
             
         case kConnectionSupportsHLDDCSense:
             // CRITICAL: HDDC support for display pipeline
             *value = 1; // ENABLE HDDC for display pipeline support
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - HDDC support: ENABLED for display pipeline\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - HDDC support: ENABLED for display pipeline\n");
             return kIOReturnSuccess;
             
         case 0x6c646463: // 'lddc' - Low Definition Display Controller
             // CRITICAL: LDDC support for display pipeline (counterpart to HDDC)
             *value = 1; // ENABLE LDDC for complete display pipeline support
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - LDDC support: ENABLED for display pipeline\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - LDDC support: ENABLED for display pipeline\n");
             return kIOReturnSuccess;
             
         case kConnectionSupportsAppleSense:
             // Apple Sense support for display detection
             *value = 1; // ENABLE Apple Sense for proper display enumeration
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Apple Sense: ENABLED for display detection\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Apple Sense: ENABLED for display detection\n");
             return kIOReturnSuccess;
             
         case kConnectionPostWake:
             // Post-wake processing
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionPostWake: success\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionPostWake: success\n");
             return kIOReturnSuccess;
             
         case 0x7061726d: // 'parm' - kConnectionDisplayParameters
             // Let IOFramebuffer handle display parameters
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionDisplayParameters: delegating to parent\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionDisplayParameters: delegating to parent\n");
             return super::getAttributeForConnection(connectIndex, attribute, value);
             
         case 0x70636e74: // 'pcnt' - kConnectionDisplayParameterCount
             // Return error to indicate no display parameters available
             // This should break the infinite loop by telling the system there are no parameters
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionDisplayParameterCount: returning kIOReturnUnsupported to break loop\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionDisplayParameterCount: returning kIOReturnUnsupported to break loop\n");
             return kIOReturnUnsupported;
             
         case 0x72677363: // 'rgsc' - kConnectionRedGammaScale
             // Red gamma scale
             *value = 0x10000; // 1.0 in 16.16 fixed point
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionRedGammaScale: 0x%lx\n", *value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionRedGammaScale: 0x%lx\n", *value);
             return kIOReturnSuccess;
             
         case 0x67677363: // 'ggsc' - kConnectionGreenGammaScale
             // Green gamma scale  
             *value = 0x10000; // 1.0 in 16.16 fixed point
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionGreenGammaScale: 0x%lx\n", *value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionGreenGammaScale: 0x%lx\n", *value);
             return kIOReturnSuccess;
             
         case 0x62677363: // 'bgsc' - kConnectionBlueGammaScale
             // Blue gamma scale
             *value = 0x10000; // 1.0 in 16.16 fixed point
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionBlueGammaScale: 0x%lx\n", *value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionBlueGammaScale: 0x%lx\n", *value);
             return kIOReturnSuccess;
             
         case 0x76626c6d: // 'vblm' - vertical blanking management
             // Vertical blanking interval
             *value = 0x10000; // Standard VBL value
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Vertical blanking (vblm): 0x%lx\n", *value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Vertical blanking (vblm): 0x%lx\n", *value);
             return kIOReturnSuccess;
             
         case 0xdeadbeef: // Debug/test attribute
             // This appears to be a system test or debug call
             *value = 1; // Return success/enabled
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Debug attribute (deadbeef): enabled\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Debug attribute (deadbeef): enabled\n");
             return kIOReturnSuccess;
             
         case 0x40052e7: // Unknown system attribute
             // System is calling this specific attribute
             *value = 1; // Return success/enabled
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - System attribute (0x40052e7): enabled\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - System attribute (0x40052e7): enabled\n");
             return kIOReturnSuccess;
             
         case 0x7102bb07: // Another system attribute
             // System is calling this attribute too
             *value = 1; // Return success/enabled
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - System attribute (0x7102bb07): enabled\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - System attribute (0x7102bb07): enabled\n");
             return kIOReturnSuccess;
             
         case kConnectionChanged:
             // Connection change detection
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionChanged: no change\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - kConnectionChanged: no change\n");
             return kIOReturnSuccess;
             
         // Standard display parameters (indices 0, 1, 2)
         case 0x70726d30: // 'prm0' - Display parameter 0 (brightness)
             *value = 0x8000; // Mid-level brightness (50% in 16.16 fixed point)
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Display parameter 0 (brightness): 0x%lx\n", *value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Display parameter 0 (brightness): 0x%lx\n", *value);
             return kIOReturnSuccess;
             
         case 0x70726d31: // 'prm1' - Display parameter 1 (contrast)
             *value = 0x8000; // Mid-level contrast (50% in 16.16 fixed point)
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Display parameter 1 (contrast): 0x%lx\n", *value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Display parameter 1 (contrast): 0x%lx\n", *value);
             return kIOReturnSuccess;
             
         case 0x70726d32: // 'prm2' - Display parameter 2 (gamma)
             *value = 0x10000; // Standard gamma (1.0 in 16.16 fixed point)
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Display parameter 2 (gamma): 0x%lx\n", *value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Display parameter 2 (gamma): 0x%lx\n", *value);
             return kIOReturnSuccess;
             
         // CRITICAL: Display pipe identification attributes for PRIMARY framebuffer
         // WindowServer requires pipe index 0 for primary display
         case 0x70697065: // 'pipe' - Display pipe index
             *value = 0; // Pipe index 0 (PRIMARY display) - required for WindowServer
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Display pipe index: 0 (PRIMARY)\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Display pipe index: 0 (PRIMARY)\n");
             return kIOReturnSuccess;
             
         case 0x64706974: // 'dpit' - Display pipe type
             *value = 1; // Primary display pipe type
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Display pipe type: 1 (PRIMARY)\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Display pipe type: 1 (PRIMARY)\n");
             return kIOReturnSuccess;
             
         case 0x64706964: // 'dpid' - Display pipe ID
             *value = 0x1000; // Primary display pipe ID
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Display pipe ID: 0x1000 (PRIMARY)\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Display pipe ID: 0x1000 (PRIMARY)\n");
             return kIOReturnSuccess;
             
         case 0x636e7472: // 'cntr' - Connection type/controller
             *value = 0x1AF4; // VirtIO vendor ID as controller type
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Connection controller: VirtIO (0x1AF4)\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Connection controller: VirtIO (0x1AF4)\n");
             return kIOReturnSuccess;
             
         default:
-            IOLog("VMVirtIOFramebuffer::getAttributeForConnection() - Unknown attribute 0x%x\n", (unsigned int)attribute);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::getAttributeForConnection() - Unknown attribute 0x%x\n", (unsigned int)attribute);
             return super::getAttributeForConnection(connectIndex, attribute, value);
     }
 }
 
 IOReturn VMVirtIOFramebuffer::setAttributeForConnection(IOIndex connectIndex, IOSelect attribute, uintptr_t value)
 {
-    IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - connectIndex=%d, attribute=0x%x, value=0x%lx\n", 
+    VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - connectIndex=%d, attribute=0x%x, value=0x%lx\n", 
           (int)connectIndex, (unsigned int)attribute, value);
     
     if (connectIndex != 0) {
-        IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - Invalid connection index %d\n", (int)connectIndex);
+        VMLOG_WARN("VMVirtIOFramebuffer::setAttributeForConnection() - Invalid connection index %d\n", (int)connectIndex);
         return kIOReturnBadArgument;
     }
     
     switch (attribute) {
         case kConnectionEnable:
             // Connection enable/disable
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionEnable: %s\n", 
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionEnable: %s\n", 
                   value ? "ENABLE" : "DISABLE");
             // For VirtIO GPU, we're always enabled
             return kIOReturnSuccess;
             
         case kConnectionSyncEnable:
             // Sync enable/disable
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionSyncEnable: 0x%lx\n", value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionSyncEnable: 0x%lx\n", value);
             return kIOReturnSuccess;
             
         case kConnectionPower:
             // Power management
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionPower: 0x%lx\n", value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionPower: 0x%lx\n", value);
             return kIOReturnSuccess;
             
         case kConnectionPostWake:
             // Post-wake setup
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionPostWake\n");
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionPostWake\n");
             return kIOReturnSuccess;
             
         case 0x72677363: // 'rgsc' - kConnectionRedGammaScale
             // Red gamma scale
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionRedGammaScale: 0x%lx\n", value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionRedGammaScale: 0x%lx\n", value);
             return kIOReturnSuccess;
             
         case 0x67677363: // 'ggsc' - kConnectionGreenGammaScale
             // Green gamma scale
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionGreenGammaScale: 0x%lx\n", value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionGreenGammaScale: 0x%lx\n", value);
             return kIOReturnSuccess;
             
         case 0x62677363: // 'bgsc' - kConnectionBlueGammaScale
             // Blue gamma scale
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionBlueGammaScale: 0x%lx\n", value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionBlueGammaScale: 0x%lx\n", value);
             return kIOReturnSuccess;
             
         case kConnectionGammaScale:
             // Overall gamma scale
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionGammaScale: 0x%lx\n", value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - kConnectionGammaScale: 0x%lx\n", value);
             return kIOReturnSuccess;
             
         case 0x76626c6d: // 'vblm' - vertical blanking management
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - Vertical blanking (vblm): 0x%lx\n", value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - Vertical blanking (vblm): 0x%lx\n", value);
             return kIOReturnSuccess;
             
         case 0x666c7573: // 'flus' - flush
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - Flush (flus): 0x%lx\n", value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - Flush (flus): 0x%lx\n", value);
             return kIOReturnSuccess;
             
         case 0xdeadbeef: // Debug/test attribute
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - Debug attribute (deadbeef): 0x%lx\n", value);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - Debug attribute (deadbeef): 0x%lx\n", value);
             return kIOReturnSuccess;
             
         default:
-            IOLog("VMVirtIOFramebuffer::setAttributeForConnection() - Unknown attribute 0x%x\n", (unsigned int)attribute);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setAttributeForConnection() - Unknown attribute 0x%x\n", (unsigned int)attribute);
             return super::setAttributeForConnection(connectIndex, attribute, value);
     }
 }
 
 IOReturn VMVirtIOFramebuffer::connectFlags(IOIndex connectIndex, IODisplayModeID displayMode, IOOptionBits* flags)
 {
-    IOLog("VMVirtIOFramebuffer::connectFlags() - connectIndex=%d, displayMode=%d\n", (int)connectIndex, (int)displayMode);
+    VMLOG_DEBUG("VMVirtIOFramebuffer::connectFlags() - connectIndex=%d, displayMode=%d\n", (int)connectIndex, (int)displayMode);
     
     if (connectIndex != 0) {
-        IOLog("VMVirtIOFramebuffer::connectFlags() - Invalid connection index %d\n", (int)connectIndex);
+        VMLOG_WARN("VMVirtIOFramebuffer::connectFlags() - Invalid connection index %d\n", (int)connectIndex);
         return kIOReturnBadArgument;
     }
     
     if (!flags) {
-        IOLog("VMVirtIOFramebuffer::connectFlags() - NULL flags pointer\n");
+        VMLOG_DEBUG("VMVirtIOFramebuffer::connectFlags() - NULL flags pointer\n");
         return kIOReturnBadArgument;
     }
     
@@ -2077,7 +2297,7 @@ IOReturn VMVirtIOFramebuffer::connectFlags(IOIndex connectIndex, IODisplayModeID
     // This tells the system that this connection supports the requested display mode
     *flags = kDisplayModeValidFlag | kDisplayModeSafeFlag;
     
-    IOLog("VMVirtIOFramebuffer::connectFlags() - Mode %d is valid and safe (flags=0x%x)\n", 
+    VMLOG_DEBUG("VMVirtIOFramebuffer::connectFlags() - Mode %d is valid and safe (flags=0x%x)\n", 
           (int)displayMode, (unsigned int)*flags);
     
     return kIOReturnSuccess;
@@ -2119,7 +2339,7 @@ IOReturn VMVirtIOFramebuffer::registerForInterruptType(IOSelect interruptType,
                                                        IOFBInterruptProc proc, OSObject* target, void* ref,
                                                        void** interruptRef)
 {
-    IOLog("VMVirtIOFramebuffer::registerForInterruptType() - Type: 0x%x\n", (unsigned int)interruptType);
+    VMLOG_INFO("VMVirtIOFramebuffer::registerForInterruptType() - Type: 0x%x\n", (unsigned int)interruptType);
     
     // Decode interrupt type for debugging
     char typeStr[5] = {0};
@@ -2127,7 +2347,23 @@ IOReturn VMVirtIOFramebuffer::registerForInterruptType(IOSelect interruptType,
     typeStr[1] = (interruptType >> 16) & 0xFF;
     typeStr[2] = (interruptType >> 8) & 0xFF;
     typeStr[3] = interruptType & 0xFF;
-    IOLog("VMVirtIOFramebuffer::registerForInterruptType() - Type string: '%s'\n", typeStr);
+    VMLOG_INFO("VMVirtIOFramebuffer::registerForInterruptType() - Type string: '%s'\n", typeStr);
+
+    // VBL is real: the handler is kept and driven from the refresh tick
+    // (deliverVBL). The ref is this head's own m_vbl_proc slot so each head
+    // routes to its own timeline. Delivery starts on setInterruptState(1).
+    if (interruptType == kIOFBVBLInterruptType) {
+        m_vbl_proc = proc;
+        m_vbl_target = target;
+        m_vbl_ref = ref;
+        m_vbl_enabled = false;
+        if (interruptRef) {
+            *interruptRef = (void*)&m_vbl_proc;
+        }
+        VMLOG_INFO("VMVirtIOFramebuffer::registerForInterruptType() - scanout %u VBL handler registered\n",
+              m_scanout_id);
+        return kIOReturnSuccess;
+    }
     
     // Support all VBL and display-related interrupt types
     switch (interruptType) {
@@ -2137,7 +2373,7 @@ IOReturn VMVirtIOFramebuffer::registerForInterruptType(IOSelect interruptType,
         case 0x64636920:           // 'dci ' - Display change interrupt
         case 0x64706972:           // 'dpir' - Display pipe interrupt  
         case 0x68646369:           // 'hdci' - Hot display change interrupt
-            IOLog("VMVirtIOFramebuffer::registerForInterruptType() - %s interrupt SUPPORTED for GUI\n", typeStr);
+            VMLOG_INFO("VMVirtIOFramebuffer::registerForInterruptType() - %s interrupt SUPPORTED for GUI\n", typeStr);
             
             if (interruptRef) {
                 *interruptRef = (void*)((uintptr_t)interruptType | 0x12340000); // Unique reference per type
@@ -2146,7 +2382,7 @@ IOReturn VMVirtIOFramebuffer::registerForInterruptType(IOSelect interruptType,
             return kIOReturnSuccess;
             
         default:
-            IOLog("VMVirtIOFramebuffer::registerForInterruptType() - Unsupported interrupt type: 0x%x ('%s')\n", 
+            VMLOG_WARN("VMVirtIOFramebuffer::registerForInterruptType() - Unsupported interrupt type: 0x%x ('%s')\n", 
                   (unsigned int)interruptType, typeStr);
             return kIOReturnUnsupported;
     }
@@ -2154,12 +2390,20 @@ IOReturn VMVirtIOFramebuffer::registerForInterruptType(IOSelect interruptType,
 
 IOReturn VMVirtIOFramebuffer::unregisterInterrupt(void* interruptRef)
 {
-    IOLog("VMVirtIOFramebuffer::unregisterInterrupt() - Unregistering interrupt ref: %p\n", interruptRef);
+    VMLOG_INFO("VMVirtIOFramebuffer::unregisterInterrupt() - Unregistering interrupt ref: %p\n", interruptRef);
+
+    if (interruptRef == (void*)&m_vbl_proc) {
+        m_vbl_enabled = false;
+        m_vbl_proc = nullptr;
+        m_vbl_target = nullptr;
+        m_vbl_ref = nullptr;
+        return kIOReturnSuccess;
+    }
     
     uintptr_t refValue = (uintptr_t)interruptRef;
     if ((refValue & 0xFFFF0000) == 0x12340000) {
         uint32_t interruptType = refValue & 0xFFFF;
-        IOLog("VMVirtIOFramebuffer::unregisterInterrupt() - Display interrupt type 0x%x unregistered\n", interruptType);
+        VMLOG_INFO("VMVirtIOFramebuffer::unregisterInterrupt() - Display interrupt type 0x%x unregistered\n", interruptType);
         return kIOReturnSuccess;
     }
     
@@ -2168,7 +2412,14 @@ IOReturn VMVirtIOFramebuffer::unregisterInterrupt(void* interruptRef)
 
 IOReturn VMVirtIOFramebuffer::setInterruptState(void* interruptRef, UInt32 state)
 {
-    IOLog("VMVirtIOFramebuffer::setInterruptState() - Ref: %p, State: %d\n", interruptRef, (int)state);
+    VMLOG_DEBUG("VMVirtIOFramebuffer::setInterruptState() - Ref: %p, State: %d\n", interruptRef, (int)state);
+
+    if (interruptRef == (void*)&m_vbl_proc) {
+        m_vbl_enabled = (state != 0) && (m_vbl_proc != nullptr);
+        VMLOG_DEBUG("VMVirtIOFramebuffer::setInterruptState() - scanout %u VBL %s\n",
+              m_scanout_id, m_vbl_enabled ? "ENABLED" : "DISABLED");
+        return kIOReturnSuccess;
+    }
     
     uintptr_t refValue = (uintptr_t)interruptRef;
     if ((refValue & 0xFFFF0000) == 0x12340000) {
@@ -2182,9 +2433,9 @@ IOReturn VMVirtIOFramebuffer::setInterruptState(void* interruptRef, UInt32 state
         typeStr[3] = interruptType & 0xFF;
         
         if (state) {
-            IOLog("VMVirtIOFramebuffer::setInterruptState() - %s interrupts ENABLED for GUI rendering\n", typeStr);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setInterruptState() - %s interrupts ENABLED for GUI rendering\n", typeStr);
         } else {
-            IOLog("VMVirtIOFramebuffer::setInterruptState() - %s interrupts DISABLED\n", typeStr);
+            VMLOG_DEBUG("VMVirtIOFramebuffer::setInterruptState() - %s interrupts DISABLED\n", typeStr);
         }
         return kIOReturnSuccess;
     }
@@ -2196,56 +2447,56 @@ IOReturn VMVirtIOFramebuffer::setInterruptState(void* interruptRef, UInt32 state
 
 IOReturn VMVirtIOFramebuffer::createAGDCService()
 {
-    IOLog("VMVirtIOFramebuffer::createAGDCService() - Creating AGDC service for WindowServer\n");
+    VMLOG_DEBUG("VMVirtIOFramebuffer::createAGDCService() - Creating AGDC service for WindowServer\n");
     
     if (m_agdc_service) {
-        IOLog("VMVirtIOFramebuffer::createAGDCService() - AGDC service already exists\n");
+        VMLOG_DEBUG("VMVirtIOFramebuffer::createAGDCService() - AGDC service already exists\n");
         return kIOReturnSuccess;
     }
     
     // CRITICAL: Attach AGDC service to VMVirtIOGPU device for proper provider handling
     // GPU Wrangler will detect it through GPU device association and proper service registration
     if (!m_gpu_driver) {
-        IOLog("VMVirtIOFramebuffer::createAGDCService() - No GPU device available for AGDC attachment\n");
+        VMLOG_DEBUG("VMVirtIOFramebuffer::createAGDCService() - No GPU device available for AGDC attachment\n");
         return kIOReturnNotFound;
     }
     
-    IOLog("VMVirtIOFramebuffer::createAGDCService() - Using VMVirtIOGPU device for AGDC attachment\n");
+    VMLOG_DEBUG("VMVirtIOFramebuffer::createAGDCService() - Using VMVirtIOGPU device for AGDC attachment\n");
     
-    IOLog("VMVirtIOFramebuffer::createAGDCService() - Creating AGDC service for GPU device attachment\n");
+    VMLOG_DEBUG("VMVirtIOFramebuffer::createAGDCService() - Creating AGDC service for GPU device attachment\n");
     
     // Create AGDC service instance
     m_agdc_service = VMVirtIOAGDC::withFramebuffer(this);
     if (!m_agdc_service) {
-        IOLog("VMVirtIOFramebuffer::createAGDCService() - Failed to create AGDC service\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::createAGDCService() - Failed to create AGDC service\n");
         return kIOReturnNoMemory;
     }
     
     // CRITICAL: Attach AGDC service to VMVirtIOGPU device which can handle the provider relationship
     // The AGDC service will register itself with GPU Wrangler through proper device properties
     if (!m_agdc_service->attach(m_gpu_driver)) {
-        IOLog("VMVirtIOFramebuffer::createAGDCService() - Failed to attach AGDC service to GPU device\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::createAGDCService() - Failed to attach AGDC service to GPU device\n");
         m_agdc_service->release();
         m_agdc_service = nullptr;
         return kIOReturnError;
     }
     
     if (!m_agdc_service->start(m_gpu_driver)) {
-        IOLog("VMVirtIOFramebuffer::createAGDCService() - Failed to start AGDC service on GPU device\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::createAGDCService() - Failed to start AGDC service on GPU device\n");
         m_agdc_service->detach(m_gpu_driver);
         m_agdc_service->release();
         m_agdc_service = nullptr;
         return kIOReturnError;
     }
     
-    IOLog("VMVirtIOFramebuffer::createAGDCService() - AGDC service created and started successfully\n");
+    VMLOG_DEBUG("VMVirtIOFramebuffer::createAGDCService() - AGDC service created and started successfully\n");
     return kIOReturnSuccess;
 }
 
 void VMVirtIOFramebuffer::destroyAGDCService()
 {
     if (m_agdc_service) {
-        IOLog("VMVirtIOFramebuffer::destroyAGDCService() - Destroying AGDC service\n");
+        VMLOG_DEBUG("VMVirtIOFramebuffer::destroyAGDCService() - Destroying AGDC service\n");
         
         // Stop and detach the AGDC service from GPU device
         if (m_gpu_driver) {
@@ -2256,7 +2507,7 @@ void VMVirtIOFramebuffer::destroyAGDCService()
         m_agdc_service->release();
         m_agdc_service = nullptr;
         
-        IOLog("VMVirtIOFramebuffer::destroyAGDCService() - AGDC service destroyed\n");
+        VMLOG_DEBUG("VMVirtIOFramebuffer::destroyAGDCService() - AGDC service destroyed\n");
     }
 }
 
@@ -2372,7 +2623,7 @@ void VMVirtIOFramebuffer::displayRefreshTimer(OSObject* owner, IOTimerEventSourc
 {
     VMVirtIOFramebuffer* fb = OSDynamicCast(VMVirtIOFramebuffer, owner);
     if (!fb) {
-        IOLog("VMVirtIOFramebuffer::displayRefreshTimer() - ERROR: No framebuffer object\n");
+        VMLOG_ERROR("VMVirtIOFramebuffer::displayRefreshTimer() - ERROR: No framebuffer object\n");
         return;
     }
     
@@ -2381,9 +2632,23 @@ void VMVirtIOFramebuffer::displayRefreshTimer(OSObject* owner, IOTimerEventSourc
     
     // Log first few calls to verify timer is working
     if (call_count <= 5) {
-        IOLog("VMVirtIOFramebuffer::displayRefreshTimer() - Timer fired (call #%d)\n", call_count);
+        VMLOG_DEBUG("VMVirtIOFramebuffer::displayRefreshTimer() - Timer fired (call #%d)\n", call_count);
+    }
+    
+    // Per-head VBL timeline first, then one batched refresh covering all
+    // heads (see refreshDisplay).
+    uint64_t now = mach_absolute_time();
+    fb->deliverVBL(now);
+    if (fb->m_secondary_heads) {
+        for (unsigned i = 0; i < fb->m_secondary_heads->getCount(); i++) {
+            VMVirtIOFramebuffer* head = OSDynamicCast(VMVirtIOFramebuffer,
+                                                      fb->m_secondary_heads->getObject(i));
+            if (head) {
+                head->deliverVBL(now);
+            }
+        }
     }
-    
+
     // Refresh display - transfer framebuffer to VirtIO GPU and flush to display
     fb->refreshDisplay();
     
@@ -2406,70 +2671,274 @@ void VMVirtIOFramebuffer::refreshDisplay()
 {
     // Only refresh if GPU driver is available
     if (!m_gpu_driver) {
-        IOLog("VMVirtIOFramebuffer::refreshDisplay() - SKIP: No GPU driver\n");
+        VMLOG_DEBUG("VMVirtIOFramebuffer::refreshDisplay() - SKIP: No GPU driver\n");
+        return;
+    }
+
+    // Throttled full-surface refresh at ~15 Hz. See header for the cost
+    // model and the dead-end investigations (cursorRect, setCursorState,
+    // content-diff) that were closed before this landed.
+    static bool logged_first_refresh = false;
+    if (!logged_first_refresh) {
+        logged_first_refresh = true;
+        VMLOG_DEBUG("VMVirtIOFramebuffer::refreshDisplay: first tick (mode=%u %ux%u) — %u Hz refresh, %u head(s)\n",
+              (unsigned)m_current_mode, (unsigned)m_width, (unsigned)m_height,
+              (unsigned)(60 / FULL_REFRESH_INTERVAL),
+              1 + (m_secondary_heads ? (unsigned)m_secondary_heads->getCount() : 0));
+    }
+
+    // Shared transport batch: this head plus, on the primary, every
+    // secondary head. Heads that are not due this tick add nothing.
+    VMVirtIOGPUBatchCommand batch[VMVirtIOGPU::kMaxBatchCommands];
+    uint32_t count = queueRefreshCommands(batch, VMVirtIOGPU::kMaxBatchCommands);
+    if (m_secondary_heads) {
+        for (unsigned i = 0; i < m_secondary_heads->getCount(); i++) {
+            VMVirtIOFramebuffer* head = OSDynamicCast(VMVirtIOFramebuffer,
+                                                      m_secondary_heads->getObject(i));
+            if (head) {
+                count += head->queueRefreshCommands(batch + count,
+                                                    VMVirtIOGPU::kMaxBatchCommands - count);
+            }
+        }
+    }
+    if (count == 0) {
         return;
     }
 
-    // Only perform work if we have a valid scanout resource id
-    if (m_scanout_resource_id == 0) {
-        IOLog("VMVirtIOFramebuffer::refreshDisplay() - SKIP: No scanout resource ID\n");
+    IOReturn batch_result = m_gpu_driver->submitCommandBatch(batch, count);
+    if (batch_result != kIOReturnSuccess) {
+        static uint32_t s_batch_failures = 0;
+        if (s_batch_failures++ < 10) {
+            VMLOG_ERROR("VMVirtIOFramebuffer::refreshDisplay() - refresh batch of %u FAILED: 0x%x\n",
+                  count, batch_result);
+            for (uint32_t i = 0; i < count; i++) {
+                VMLOG_DEBUG("VMVirtIOFramebuffer::refreshDisplay() -   [%u] cmd=0x%x resp=0x%x\n",
+                      i, batch[i].cmd->type, batch[i].resp.type);
+            }
+        }
         return;
     }
 
+    static bool logged_success = false;
+    if (!logged_success) {
+        VMLOG_DEBUG("VMVirtIOFramebuffer::refreshDisplay() - full-surface %s SUCCESS: %u command(s), one doorbell\n",
+              m_fb_is_blob ? "blob Flush" : "Transfer+Flush", count);
+        logged_success = true;
+    }
+}
+
+uint32_t VMVirtIOFramebuffer::queueRefreshCommands(VMVirtIOGPUBatchCommand* batch, uint32_t capacity)
+{
+    // Only perform work if we have a valid scanout resource id, and only once
+    // enableController/setDisplayMode has made it live on the device — the
+    // primary's tick reaches secondary heads before WindowServer sets them up.
+    if (m_scanout_resource_id == 0 || m_fb_resource_id == 0) {
+        return 0;
+    }
+
     // CRITICAL: Check if scanout has been taken over by 3D rendering
     // If a 3D application has attached its own resource to the scanout,
     // we should NOT overwrite it with our 2D framebuffer content.
     // 3D resources manage their own transfer/flush cycle.
     if (m_scanout_taken_over_by_3d) {
         // 3D resource is active - don't interfere
-        return;
-    }
-
-    // Throttled full-surface refresh at ~15 Hz. See header for the cost
-    // model and the dead-end investigations (cursorRect, setCursorState,
-    // content-diff) that were closed before this landed.
-    static bool logged_first_refresh = false;
-    if (!logged_first_refresh) {
-        logged_first_refresh = true;
-        IOLog("VMVirtIOFramebuffer::refreshDisplay: first tick (mode=%u %ux%u) — %u Hz refresh\n",
-              (unsigned)m_current_mode, (unsigned)m_width, (unsigned)m_height,
-              (unsigned)(60 / FULL_REFRESH_INTERVAL));
+        return 0;
     }
 
     m_full_refresh_tick_count++;
     if (m_full_refresh_tick_count < FULL_REFRESH_INTERVAL) {
-        return;
+        return 0;
+    }
+    if (capacity < 2) {
+        // Leave the counter primed; this head goes out on the next tick.
+        return 0;
     }
     m_full_refresh_tick_count = 0;
 
-    IOReturn transfer_result = m_gpu_driver->transferToHost2D(m_scanout_resource_id, 0,
-                                                               0, 0, m_width, m_height);
-    if (transfer_result != kIOReturnSuccess) {
-        IOLog("VMVirtIOFramebuffer::refreshDisplay() - transferToHost2D FAILED: 0x%x\n",
-              transfer_result);
+    uint32_t n = 0;
+
+    // Blob scanout: the host already reads m_fb_backing in place, so the
+    // TRANSFER_TO_HOST_2D copy is skipped.
+    if (!m_fb_is_blob) {
+        bzero(&m_refresh_transfer, sizeof(m_refresh_transfer));
+        m_refresh_transfer.hdr.type = VIRTIO_GPU_CMD_TRANSFER_TO_HOST_2D;
+        m_refresh_transfer.resource_id = m_fb_resource_id;
+        m_refresh_transfer.r.width = m_width;
+        m_refresh_transfer.r.height = m_height;
+        batch[n].cmd = &m_refresh_transfer.hdr;
+        batch[n].cmd_size = sizeof(m_refresh_transfer);
+        n++;
+    }
+
+    bzero(&m_refresh_flush, sizeof(m_refresh_flush));
+    m_refresh_flush.hdr.type = VIRTIO_GPU_CMD_RESOURCE_FLUSH;
+    m_refresh_flush.resource_id = m_fb_resource_id;
+    m_refresh_flush.r.width = m_width;
+    m_refresh_flush.r.height = m_height;
+    batch[n].cmd = &m_refresh_flush.hdr;
+    batch[n].cmd_size = sizeof(m_refresh_flush);
+    n++;
+
+    return n;
+}
+
+void VMVirtIOFramebuffer::deliverVBL(uint64_t now)
+{
+    m_vbl_count++;
+    m_vbl_last_time = now;
+    if (m_vbl_enabled && m_vbl_proc) {
+        m_vbl_proc(m_vbl_target, m_vbl_ref);
+    }
+}
+
+// ---- Secondary heads ----
+
+bool VMVirtIOFramebuffer::initSecondaryHead(VMVirtIOGPU* gpu, uint32_t scanout_id)
+{
+    if (!gpu || scanout_id == 0 || scanout_id >= VIRTIO_GPU_MAX_SCANOUTS) {
+        return false;
+    }
+    gpu->retain();
+    m_gpu_driver = gpu;
+    m_scanout_id = scanout_id;
+    m_scanout_resource_id = VMVirtIOGPU::displayResourceIdForScanout(scanout_id);
+    return true;
+}
+
+bool VMVirtIOFramebuffer::startSecondaryHead(IOService* provider)
+{
+    VMLOG_INFO("VMVirtIOFramebuffer::startSecondaryHead() - scanout %u\n", m_scanout_id);
+
+    if (!super::start(provider)) {
+        VMLOG_ERROR("VMVirtIOFramebuffer::startSecondaryHead() - super::start() failed\n");
+        return false;
+    }
+    m_pci_device = OSDynamicCast(IOPCIDevice, provider);
+
+    m_gpu_driver->setFramebuffer(this, m_scanout_id);
+
+    // Plain display head: not boot, console or primary. Same user-client
+    // class as the primary so WindowServer can open it.
+    setProperty("IOGraphicsDevice", kOSBooleanTrue);
+    setProperty("IOConsoleDevice", kOSBooleanFalse);
+    setProperty("IOBootDisplay", kOSBooleanFalse);
+    setProperty("IOPrimaryDisplay", kOSBooleanFalse);
+    setProperty("IOPrimaryGraphicsDevice", kOSBooleanFalse);
+    setProperty("IOMatchCategory", "IOFramebuffer");
+    setProperty("IOUserClientClass", "VMQemuVGAClient");
+    setProperty("IOFramebufferMemoryBandwidth", (uint64_t)(1024 * 1024 * 1024), 32);
+    setProperty("IOFramebufferIndex", (uint64_t)m_scanout_id, 32);
+    setProperty("IODisplayIndex", (uint64_t)m_scanout_id, 32);
+    if (m_pci_device) {
+        setProperty("IOFBDependentID", m_pci_device->getRegistryEntryID(), 64);
+        setProperty("IOFBDependentIndex", (uint64_t)m_scanout_id, 32);
+    }
+
+    initDisplayModes();
+    m_display_mode = 0;
+    m_depth_mode = 0;
+
+    allocateFixedBuffer();
+    filterModesByAllocation();
+
+    registerService(kIOServiceAsynchronous);
+    IODisplayWrangler::makeDisplayConnects(this);
+
+    VMLOG_INFO("VMVirtIOFramebuffer::startSecondaryHead() - scanout %u ready, resource %u, %u modes\n",
+          m_scanout_id, m_scanout_resource_id, (unsigned)m_mode_count);
+    return true;
+}
+
+void VMVirtIOFramebuffer::createSecondaryHeads()
+{
+    if (!m_gpu_driver || !m_pci_device) {
         return;
     }
-    IOReturn flush_result = m_gpu_driver->flushResource(m_scanout_resource_id, 0, 0,
-                                                        m_width, m_height);
-    if (flush_result != kIOReturnSuccess) {
-        IOLog("VMVirtIOFramebuffer::refreshDisplay() - flushResource FAILED: 0x%x\n",
-              flush_result);
+    uint32_t scanouts = m_gpu_driver->getMaxScanouts();
+    if (scanouts > VIRTIO_GPU_MAX_SCANOUTS) {
+        scanouts = VIRTIO_GPU_MAX_SCANOUTS;
+    }
+    if (scanouts <= 1) {
         return;
     }
 
-    static bool logged_success = false;
-    if (!logged_success) {
-        IOLog("VMVirtIOFramebuffer::refreshDisplay() - full-surface Transfer+Flush SUCCESS for resource %d (%ux%u)\n",
-              (unsigned)m_scanout_resource_id, (unsigned)m_width, (unsigned)m_height);
-        logged_success = true;
+    // Dependent framebuffers: IOGraphicsFamily groups heads on one device
+    // by IOFBDependentID.
+    setProperty("IOFBDependentID", m_pci_device->getRegistryEntryID(), 64);
+    setProperty("IOFBDependentIndex", (uint64_t)0, 32);
+
+    m_secondary_heads = OSArray::withCapacity(scanouts - 1);
+    if (!m_secondary_heads) {
+        return;
+    }
+
+    for (uint32_t id = 1; id < scanouts; id++) {
+        VMVirtIOFramebuffer* head = OSTypeAlloc(VMVirtIOFramebuffer);
+        if (!head) {
+            VMLOG_ERROR("VMVirtIOFramebuffer::createSecondaryHeads() - alloc failed for scanout %u\n", id);
+            break;
+        }
+        if (head->init() && head->initSecondaryHead(m_gpu_driver, id)) {
+            if (head->attach(m_pci_device)) {
+                if (head->start(m_pci_device)) {
+                    m_secondary_heads->setObject(head);
+                    VMLOG_DEBUG("VMVirtIOFramebuffer::createSecondaryHeads() - scanout %u started\n", id);
+                } else {
+                    VMLOG_ERROR("VMVirtIOFramebuffer::createSecondaryHeads() - scanout %u start() failed\n", id);
+                    head->detach(m_pci_device);
+                }
+            } else {
+                VMLOG_ERROR("VMVirtIOFramebuffer::createSecondaryHeads() - scanout %u attach() failed\n", id);
+            }
+        } else {
+            VMLOG_ERROR("VMVirtIOFramebuffer::createSecondaryHeads() - scanout %u init failed\n", id);
+        }
+        head->release();  // m_secondary_heads holds the reference
     }
+
+    VMLOG_DEBUG("VMVirtIOFramebuffer::createSecondaryHeads() - %u of %u secondary head(s) live\n",
+          m_secondary_heads->getCount(), scanouts - 1);
+}
+
+void VMVirtIOFramebuffer::destroySecondaryHeads()
+{
+    if (!m_secondary_heads) {
+        return;
+    }
+    for (unsigned i = 0; i < m_secondary_heads->getCount(); i++) {
+        IOService* head = OSDynamicCast(IOService, m_secondary_heads->getObject(i));
+        if (head) {
+            head->terminate();
+        }
+    }
+    m_secondary_heads->flushCollection();
+}
+
+// The timer sits on the PCI workloop when start() made it and on ours when
+// open() did, so detach it from whichever one it was added to. Removal
+// takes that workloop's gate: a tick already running finishes first, and
+// none fires afterwards.
+void VMVirtIOFramebuffer::stopRefreshTimer()
+{
+    if (!m_refresh_timer) {
+        return;
+    }
+    m_refresh_timer->cancelTimeout();
+    IOWorkLoop* workloop = m_refresh_timer->getWorkLoop();
+    if (workloop) {
+        workloop->removeEventSource(m_refresh_timer);
+    }
+    // A tick that was running during the cancel may have re-armed
+    m_refresh_timer->cancelTimeout();
+    m_refresh_timer->release();
+    m_refresh_timer = nullptr;
 }
 
 // 3D Scanout Management
 void VMVirtIOFramebuffer::setScanoutTakenOverBy3D(bool taken_over)
 {
     if (taken_over != m_scanout_taken_over_by_3d) {
-        IOLog("VMVirtIOFramebuffer: Scanout control %s by 3D application\n", 
+        VMLOG_DEBUG("VMVirtIOFramebuffer: Scanout control %s by 3D application\n", 
               taken_over ? "taken over" : "returned to 2D");
         m_scanout_taken_over_by_3d = taken_over;
     }
@@ -12,10 +12,12 @@
 #include <IOKit/IOUserClient.h>
 #include <IOKit/graphics/IOAccelerator.h>
 #include <IOKit/IOTimerEventSource.h>
+#include "virtio_gpu.h"
 
 // Forward declaration to avoid circular includes
 class VMVirtIOGPU;
 class VMVirtIOAGDC;
+struct VMVirtIOGPUBatchCommand;
 
 class VMVirtIOFramebuffer : public IOFramebuffer
 {
@@ -28,6 +30,16 @@ private:
     VMVirtIOAGDC*          m_agdc_service;      // AGDC service for WindowServer
     class VMQemuVGAAccelerator* m_accelerator;  // IOAccelerator child service
 
+    // Multi-head. One VMVirtIOFramebuffer per virtio-gpu scanout, all on the
+    // same PCI nub and the same VMVirtIOGPU helper. Scanout 0 is the primary:
+    // it owns the helper, the refresh timer and the accelerator, and spawns
+    // the secondary heads at the end of start(). Each head has its own fixed
+    // buffer, mode list, display resource, refresh governor and VBL timeline.
+    uint32_t               m_scanout_id;        // virtio-gpu scanout this head drives
+    OSArray*               m_secondary_heads;   // primary only: heads 1..N-1
+    bool                   m_controller_enabled;
+    int                    m_enable_call_count;
+
     // VirtIO GPU framebuffer backing: one page-aligned, physically contiguous
     // buffer that serves ALL three roles — aperture (WindowServer writes here),
     // backing (host reads pixels from here), and transfer source. Same memory
@@ -35,7 +47,7 @@ private:
     // createResource2D perspective; lifetime tied to the resource.
     IOBufferMemoryDescriptor* m_fb_backing;
     IODeviceMemory*        m_fb_device_memory;  // wraps m_fb_backing's physical range for aperture/VRAMRange
-    uint32_t               m_fb_resource_id;    // VirtIO GPU resource holding this backing
+    uint32_t               m_fb_resource_id;    // VirtIO GPU resource holding this backing (live scanout)
     // Phase 2: m_fb_backing / m_fb_device_memory are allocated ONCE in start()
     // sized for the largest advertised mode (the "ceiling"). Lives until free().
     // setupFramebufferResource creates the virtio resource against this buffer
@@ -43,6 +55,32 @@ private:
     // resource against the same buffer.
     uint32_t               m_fb_allocation_width;   // ceiling width  the buffer was sized for
     uint32_t               m_fb_allocation_height;  // ceiling height the buffer was sized for
+    // True when m_fb_resource_id is a guest-memory blob scanned out via
+    // SET_SCANOUT_BLOB. The host reads pixels straight out of m_fb_backing,
+    // so a refresh is RESOURCE_FLUSH alone — no TRANSFER_TO_HOST_2D. False
+    // on the CREATE_2D fallback (device without VIRTIO_GPU_F_RESOURCE_BLOB,
+    // or blob create/scanout rejected).
+    bool                   m_fb_is_blob;
+
+    // Scanout resource pool. Every entry is a resource over the SAME fixed
+    // buffer, so a mode switch to a (width, height, format) already in the
+    // pool is a single SET_SCANOUT — no UNREF, CREATE_2D or ATTACH_BACKING.
+    // A blob entry is sized to the whole buffer and serves every mode via
+    // SET_SCANOUT_BLOB with new dims/stride, so it never needs a sibling.
+    // Misses create a new entry; a full pool evicts the least recently
+    // scanned-out entry that is not live. Remote-session resizes bounce
+    // between a handful of sizes, so four entries cover the churn.
+    struct ScanoutResource {
+        uint32_t resource_id;   // 0 = free slot
+        uint32_t width;
+        uint32_t height;
+        uint32_t format;
+        bool     is_blob;
+        uint64_t last_used;     // m_scanout_pool_clock at last scanout
+    };
+    static const uint32_t  kScanoutPoolSize = 4;
+    ScanoutResource        m_scanout_pool[kScanoutPoolSize];
+    uint64_t               m_scanout_pool_clock;
     
     // Display configuration
     uint32_t               m_width;             // Display width
@@ -86,8 +124,28 @@ private:
     // bytes are not the bottleneck (host-side memcpy), command count is.
     // Sub-rects would still cost two commands per tick plus the hashing CPU
     // under TCG — net regression.
+    //
+    // With a blob scanout (m_fb_is_blob) the tick is one command, not two.
+    //
+    // Multi-head: the primary's timer drives every head, and all due heads'
+    // commands go out as one submitCommandBatch — one doorbell per tick no
+    // matter how many displays are attached. Each head keeps its own tick
+    // count, so the governor state is per head.
     uint32_t               m_full_refresh_tick_count;
     static const uint32_t  FULL_REFRESH_INTERVAL = 4;  // ~15 Hz at 60 Hz timer
+    virtio_gpu_transfer_to_host_2d m_refresh_transfer;  // batch storage for this head
+    virtio_gpu_resource_flush      m_refresh_flush;
+
+    // Per-head VBL timeline. virtio-gpu has no vblank interrupt; the 60 Hz
+    // refresh tick stands in for it. IOFramebuffer registers its VBL handler
+    // through registerForInterruptType; once enabled it is called every tick
+    // with this head's count and timestamp advanced.
+    IOFBInterruptProc      m_vbl_proc;
+    OSObject*              m_vbl_target;
+    void*                  m_vbl_ref;
+    bool                   m_vbl_enabled;
+    uint64_t               m_vbl_count;
+    uint64_t               m_vbl_last_time;     // mach_absolute_time of the last tick
     
     void initDisplayModes();
     IOReturn createAGDCService();
@@ -96,6 +154,20 @@ private:
     // Display refresh callback
     static void displayRefreshTimer(OSObject* owner, IOTimerEventSource* sender);
     void refreshDisplay();
+    // Governor step for this head: when due, append its TRANSFER (2D only)
+    // and FLUSH to batch and return how many entries were added.
+    uint32_t queueRefreshCommands(VMVirtIOGPUBatchCommand* batch, uint32_t capacity);
+    void deliverVBL(uint64_t now);
+
+    // Secondary heads. initSecondaryHead runs between init() and attach();
+    // start() then takes the startSecondaryHead path.
+    bool initSecondaryHead(VMVirtIOGPU* gpu, uint32_t scanout_id);
+    bool startSecondaryHead(IOService* provider);
+    void createSecondaryHeads();
+    void destroySecondaryHeads();
+    void stopRefreshTimer();
+    // Fixed-buffer ceiling ladder (Phase 2), shared by every head.
+    bool allocateFixedBuffer();
 
     // Phase 3 self-check: prove the resource-recreate path works (same buffer,
     // new resource dims). Same shape as Phase 1's probeResourceTracking —
@@ -138,12 +210,23 @@ public:
     virtual IOReturn setDisplayMode(IODisplayModeID displayMode, IOIndex depth) override;
 
     // One-call framebuffer resource setup. Re-callable for mode changes.
-    // Tears down any existing resource, allocates fresh contiguous backing
-    // of width*height*4 bytes, creates VirtIO GPU resource, attaches backing,
-    // and sets scanout. Updates m_fb_backing / m_fb_device_memory / m_fb_resource_id.
-    // Returns kIOReturnSuccess on success; on failure any partial state is torn down.
+    // Reuses a pooled resource for the mode when there is one (a single
+    // SET_SCANOUT), otherwise creates one against the fixed buffer and adds
+    // it to m_scanout_pool. Updates m_fb_resource_id / m_width / m_height.
+    // Returns kIOReturnSuccess on success; on failure the previous scanout
+    // resource stays pooled.
     IOReturn setupFramebufferResource(uint32_t width, uint32_t height);
+    // UNREFs every pooled resource. The fixed buffer is untouched.
     void teardownFramebufferResource();
+    // Blob half of setupFramebufferResource: RESOURCE_CREATE_BLOB over
+    // m_fb_backing + SET_SCANOUT_BLOB. On failure nothing is left live and
+    // the caller falls back to the CREATE_2D path.
+    IOReturn setupBlobScanout(uint32_t width, uint32_t height);
+    // Pool helpers for setupFramebufferResource.
+    ScanoutResource* findScanoutResource(uint32_t width, uint32_t height, uint32_t format);
+    ScanoutResource* claimScanoutSlot();
+    void releaseScanoutResource(ScanoutResource* entry);
+    IOReturn scanoutPooledResource(ScanoutResource* entry, uint32_t width, uint32_t height);
     virtual IOReturn setupForCurrentConfig() override;  // CRITICAL: Console-to-GUI transition
     virtual IOItemCount getConnectionCount(void) override;
     virtual IOReturn getDisplayStatus(void* connectFlags);  // CRITICAL: Tell IOGraphicsFamily display is connected
@@ -160,6 +243,8 @@ public:
     
     // 3D scanout management - called by VMVirtIOGPU when 3D resources take over display
     void setScanoutTakenOverBy3D(bool taken_over);
+    // True when resource_id is one of this head's pooled display resources.
+    bool ownsDisplayResource(uint32_t resource_id) const;
     
     // Power management
     virtual IOReturn setPowerState(unsigned long powerStateOrdinal, IOService* whatDevice) override;
@@ -2,9 +2,13 @@
 #include "VMVirtIOFramebuffer.h"
 #include "VMMetalPlugin.h"
 #include "virgl_protocol.h"
+#include "virgl_encode.h"
+#include "VMLog.h"
 #include <IOKit/IOLib.h>
 #include <IOKit/IOBufferMemoryDescriptor.h>
 #include <libkern/OSByteOrder.h>
+#include <libkern/OSKextLib.h>
+#include <libkern/crypto/sha2.h>
 
 // Include advanced managers so subclass can instantiate them
 #include "VMShaderManager.h"
@@ -30,7 +34,9 @@ bool CLASS::init(OSDictionary* properties)
     m_notify_offset = 0;       // Initialize VirtIO notify offset
     m_command_gate = nullptr;
     m_virtio_device = nullptr;
-    m_framebuffer = nullptr;   // Will be set when framebuffer starts
+    for (uint32_t i = 0; i < VIRTIO_GPU_MAX_SCANOUTS; i++) {
+        m_framebuffers[i] = nullptr;   // Will be set when each head starts
+    }
     
     m_control_queue = nullptr;
     m_cursor_queue = nullptr;
@@ -82,6 +88,9 @@ bool CLASS::init(OSDictionary* properties)
     
     m_is_virtio_gpu_pci = false;  // Default to VGA-compatible mode
     m_is_mock_device = false;      // Default to real VirtIO GPU hardware
+    m_has_resource_blob = false;   // set by negotiateFeatures() if accepted
+    memset(m_sampler_formats, 0, sizeof(m_sampler_formats));
+    m_sampler_formats_valid = false;   // set by enableVirgl() from the capset
     
     m_resource_count = 0;
     for (int i = 0; i < 64; i++) {
@@ -149,12 +158,12 @@ void CLASS::free()
 
 IOService* CLASS::probe(IOService* provider, SInt32* score)
 {
-    IOLog("VMVirtIOGPU::probe: Probing VirtIO GPU device\n");
+    VMLOG_INFO("VMVirtIOGPU::probe: Probing VirtIO GPU device\n");
 
     // Cast to PCI device to check vendor/device ID FIRST
     IOPCIDevice* pciDevice = OSDynamicCast(IOPCIDevice, provider);
     if (!pciDevice) {
-        IOLog("VMVirtIOGPU::probe: Provider is not a PCI device\n");
+        VMLOG_INFO("VMVirtIOGPU::probe: Provider is not a PCI device\n");
         return nullptr;
     }
 
@@ -173,23 +182,23 @@ IOService* CLASS::probe(IOService* provider, SInt32* score)
     UInt16 vendorID = (UInt16)(vid_did & 0xFFFF);
     UInt16 deviceID = (UInt16)((vid_did >> 16) & 0xFFFF);
 
-    IOLog("VMVirtIOGPU::probe: Read device VID:DID = %04x:%04x\n", vendorID, deviceID);
+    VMLOG_INFO("VMVirtIOGPU::probe: Read device VID:DID = %04x:%04x\n", vendorID, deviceID);
 
     // Verify this is actually a VirtIO device. IOPCIMatch should already have
     // filtered, but reject explicitly in case matching ever expands.
     if (vendorID != 0x1af4 || (deviceID != 0x1050 && deviceID != 0x1051 && deviceID != 0x1052)) {
-        IOLog("VMVirtIOGPU::probe: REJECTING non-VirtIO device (%04x:%04x) - not our responsibility\n", vendorID, deviceID);
+        VMLOG_WARN("VMVirtIOGPU::probe: REJECTING non-VirtIO device (%04x:%04x) - not our responsibility\n", vendorID, deviceID);
         return nullptr;
     }
 
     // Call parent probe after confirming this is a VirtIO device.
     IOService* result = super::probe(provider, score);
     if (!result) {
-        IOLog("VMVirtIOGPU::probe: Parent probe failed for VirtIO device\n");
+        VMLOG_ERROR("VMVirtIOGPU::probe: Parent probe failed for VirtIO device\n");
         return nullptr;
     }
 
-    IOLog("VMVirtIOGPU::probe: Found VirtIO GPU device %04x:%04x\n", vendorID, deviceID);
+    VMLOG_INFO("VMVirtIOGPU::probe: Found VirtIO GPU device %04x:%04x\n", vendorID, deviceID);
 
     // Detect VirtIO GPU device type by checking PCI class code via configRead32
     // -- same source of truth as enableController. PCI class-code register layout:
@@ -204,25 +213,25 @@ IOService* CLASS::probe(IOService* provider, SInt32* score)
     UInt8 baseClass = (rawClassCode >> 24) & 0xFF;
     UInt8 subClass = (rawClassCode >> 16) & 0xFF;
 
-    IOLog("VMVirtIOGPU::probe: Raw class-code register: 0x%08x (base=0x%02x sub=0x%02x)\n",
+    VMLOG_INFO("VMVirtIOGPU::probe: Raw class-code register: 0x%08x (base=0x%02x sub=0x%02x)\n",
           rawClassCode, baseClass, subClass);
 
     if (baseClass == 0x03 && subClass == 0x00) {
         // VGA-compatible controller (virtio-vga-gl)
         isVirtIOVGA = true;
-        IOLog("VMVirtIOGPU::probe: Detected virtio-vga-gl device (VGA-compatible, subClass=0x00)\n");
+        VMLOG_INFO("VMVirtIOGPU::probe: Detected virtio-vga-gl device (VGA-compatible, subClass=0x00)\n");
     } else if (baseClass == 0x03 && (subClass == 0x80 || subClass == 0x02)) {
         // Display controller (0x80) or 3D controller (0x02) = virtio-gpu-gl-pci
         // Real hardware reports 0x80 "Other display controller"
         isVirtIOGPUPCI = true;
-        IOLog("VMVirtIOGPU::probe: Detected virtio-gpu-gl-pci device (pure GPU, subClass=0x%02x)\n", subClass);
+        VMLOG_INFO("VMVirtIOGPU::probe: Detected virtio-gpu-gl-pci device (pure GPU, subClass=0x%02x)\n", subClass);
     } else if (baseClass == 0x00 && subClass == 0x00) {
         // Class code 0x000000 = virtio-gpu-gl-pci (pure GPU, NO VGA compatibility)
         // This is the most common configuration in QEMU/UTM
         isVirtIOGPUPCI = true;
-        IOLog("VMVirtIOGPU::probe: Detected virtio-gpu-gl-pci device (class 0x000000 = pure GPU, NO VGA)\n");
+        VMLOG_INFO("VMVirtIOGPU::probe: Detected virtio-gpu-gl-pci device (class 0x000000 = pure GPU, NO VGA)\n");
     } else {
-        IOLog("VMVirtIOGPU::probe: Unknown VirtIO GPU type - class 0x%02x:0x%02x, assuming virtio-gpu-gl-pci\n", baseClass, subClass);
+        VMLOG_INFO("VMVirtIOGPU::probe: Unknown VirtIO GPU type - class 0x%02x:0x%02x, assuming virtio-gpu-gl-pci\n", baseClass, subClass);
         isVirtIOGPUPCI = true; // Default to pure GPU mode (safer than assuming VGA)
     }
     
@@ -233,30 +242,31 @@ IOService* CLASS::probe(IOService* provider, SInt32* score)
     
     if (isVirtIOVGA) {
         // virtio-vga-gl: VGA compatibility mode - coexist with IONDRVFramebuffer
-        IOLog("VMVirtIOGPU::probe: virtio-vga-gl VGA compatibility mode - IONDRVFramebuffer handles display\n");
+        VMLOG_INFO("VMVirtIOGPU::probe: virtio-vga-gl VGA compatibility mode - IONDRVFramebuffer handles display\n");
         *score = 15000; // Between IONDRV (20000) and our framebuffer (10000) for proper sequencing
         
         // Publish device type for VMVirtIOFramebuffer coordination
         
-        IOLog("VMVirtIOGPU::probe: virtio-vga-gl VGA compatibility mode - can switch to native via SET_SCANOUT\n");
+        VMLOG_INFO("VMVirtIOGPU::probe: virtio-vga-gl VGA compatibility mode - can switch to native via SET_SCANOUT\n");
         
     } else if (isVirtIOGPUPCI) {
         // virtio-gpu-gl-pci: Pure GPU device - no VGA compatibility
-        IOLog("VMVirtIOGPU::probe: virtio-gpu-gl-pci mode - pure GPU device, native VirtIO only\n");
+        VMLOG_INFO("VMVirtIOGPU::probe: virtio-gpu-gl-pci mode - pure GPU device, native VirtIO only\n");
         *score = 30000; // Higher than IONDRV (20000) for primary display role
         
         // Publish device type for VMVirtIOFramebuffer coordination
         
-        IOLog("VMVirtIOGPU::probe: virtio-gpu-gl-pci native mode - no VGA compatibility available\n");
+        VMLOG_INFO("VMVirtIOGPU::probe: virtio-gpu-gl-pci native mode - no VGA compatibility available\n");
     }
     
-    IOLog("VMVirtIOGPU::probe: VirtIO GPU device ready for VMVirtIOGPU driver\n");
+    VMLOG_INFO("VMVirtIOGPU::probe: VirtIO GPU device ready for VMVirtIOGPU driver\n");
     return result;
 }
 
 bool CLASS::start(IOService* provider)
 {
-    IOLog("VMVirtIOGPU::start with provider %s\n", provider->getMetaClass()->getClassName());
+    VMLogInit();
+    VMLOG_INFO("VMVirtIOGPU::start with provider %s\n", provider->getMetaClass()->getClassName());
     
     // Race condition fix: Delay driver initialization to ensure system services are ready
     // CRITICAL: 5-second initialization delay (same race condition as QXL)
@@ -265,9 +275,9 @@ bool CLASS::start(IOService* provider)
     // too early during boot. Testing showed 100ms insufficient, but 5000ms (5 seconds) consistently
     // works. This delay ensures WindowServer and IOGraphicsFamily are fully initialized before
     // our framebuffer becomes available. Without this, open() hangs intermittently during boot.
-    IOLog("VMVirtIOGPU: Applying 5-second initialization delay for race condition fix...\n");
+    VMLOG_INFO("VMVirtIOGPU: Applying 5-second initialization delay for race condition fix...\n");
     IOSleep(5000);  // 5000ms delay - empirically determined minimum for reliable boot
-    IOLog("VMVirtIOGPU: Initialization delay complete - system services ready\n");
+    VMLOG_INFO("VMVirtIOGPU: Initialization delay complete - system services ready\n");
     
     // Detect device type again to determine behavior
     IOPCIDevice* pciDevice = OSDynamicCast(IOPCIDevice, provider);
@@ -281,29 +291,29 @@ bool CLASS::start(IOService* provider)
         // DEBUG: Let's see what we're actually getting
         if (classProp) {
             UInt32 rawClassCode = classProp->unsigned32BitValue();
-            IOLog("VMVirtIOGPU::start: Raw class-code property value: 0x%08x\n", rawClassCode);
+            VMLOG_INFO("VMVirtIOGPU::start: Raw class-code property value: 0x%08x\n", rawClassCode);
         }
         
         UInt32 classCode = classProp ? classProp->unsigned32BitValue() >> 8 : 0;
         UInt8 baseClass = (classCode >> 16) & 0xFF;
         UInt8 subClass = (classCode >> 8) & 0xFF;
         
-        IOLog("VMVirtIOGPU::start: PCI class code: 0x%06x (base=0x%02x, sub=0x%02x)\n", 
+        VMLOG_INFO("VMVirtIOGPU::start: PCI class code: 0x%06x (base=0x%02x, sub=0x%02x)\n", 
               classCode, baseClass, subClass);
         
         if (baseClass == 0x03 && subClass == 0x00) {
             isVirtIOVGA = true;
-            IOLog("VMVirtIOGPU::start: Detected virtio-vga-gl (VGA compatibility, class 0x0300)\n");
+            VMLOG_INFO("VMVirtIOGPU::start: Detected virtio-vga-gl (VGA compatibility, class 0x0300)\n");
         } else if (baseClass == 0x03 && (subClass == 0x02 || subClass == 0x80)) {
             isVirtIOGPUPCI = true;
-            IOLog("VMVirtIOGPU::start: Detected virtio-gpu-gl-pci (pure GPU, class 0x03%02x)\n", subClass);
+            VMLOG_INFO("VMVirtIOGPU::start: Detected virtio-gpu-gl-pci (pure GPU, class 0x03%02x)\n", subClass);
         } else if (baseClass == 0x00 && subClass == 0x00) {
             // Class 0x000000 = virtio-gpu-gl-pci (pure GPU, NO VGA compatibility)
             // This is the most common configuration in QEMU/UTM
             isVirtIOGPUPCI = true;
-            IOLog("VMVirtIOGPU::start: Detected virtio-gpu-gl-pci (class 0x0000 = pure GPU, no VGA)\n");
+            VMLOG_INFO("VMVirtIOGPU::start: Detected virtio-gpu-gl-pci (class 0x0000 = pure GPU, no VGA)\n");
         } else {
-            IOLog("VMVirtIOGPU::start: ⚠️  Unknown PCI class 0x%02x%02x, assuming pure GPU mode\n", baseClass, subClass);
+            VMLOG_WARN("VMVirtIOGPU::start: ⚠️  Unknown PCI class 0x%02x%02x, assuming pure GPU mode\n", baseClass, subClass);
             isVirtIOGPUPCI = true;  // Default to pure GPU mode (safer than assuming VGA)
         }
     }
@@ -315,14 +325,14 @@ bool CLASS::start(IOService* provider)
         // virtio-vga-gl: VGA device with 3D acceleration
         // VMVirtIOFramebuffer will handle display (not IONDRV)
         // VMVirtIOGPU provides GPU command processing only
-        IOLog("VMVirtIOGPU: virtio-vga-gl mode - VGA-compatible GPU with 3D acceleration\n");
-        IOLog("VMVirtIOGPU: VMVirtIOFramebuffer will handle display output\n");
+        VMLOG_INFO("VMVirtIOGPU: virtio-vga-gl mode - VGA-compatible GPU with 3D acceleration\n");
+        VMLOG_INFO("VMVirtIOGPU: VMVirtIOFramebuffer will handle display output\n");
     } else if (isVirtIOGPUPCI) {
         // virtio-gpu-gl-pci: Pure GPU mode (no VGA legacy)
         // VMVirtIOFramebuffer will handle display directly
-        IOLog("VMVirtIOGPU: virtio-gpu-gl-pci mode - pure GPU device (no VGA compatibility)\n");
-        IOLog("VMVirtIOGPU: VMVirtIOFramebuffer will handle display output\n");
-        IOLog("VMVirtIOGPU: ℹ️  Will use TRANSFER_FROM_HOST_3D to copy 3D pixels to guest framebuffer\n");
+        VMLOG_INFO("VMVirtIOGPU: virtio-gpu-gl-pci mode - pure GPU device (no VGA compatibility)\n");
+        VMLOG_INFO("VMVirtIOGPU: VMVirtIOFramebuffer will handle display output\n");
+        VMLOG_INFO("VMVirtIOGPU: ℹ️  Will use TRANSFER_FROM_HOST_3D to copy 3D pixels to guest framebuffer\n");
     }
     
     // Set device-specific properties based on detected mode
@@ -333,24 +343,24 @@ bool CLASS::start(IOService* provider)
     }
     
     if (!super::start(provider)) {
-        IOLog("VMVirtIOGPU: super::start failed\n");
+        VMLOG_ERROR("VMVirtIOGPU: super::start failed\n");
         return false;
     }
-    IOLog("VMVirtIOGPU: super::start succeeded\n");
+    VMLOG_INFO("VMVirtIOGPU: super::start succeeded\n");
     
     // Provider is now IOPCIDevice directly (Catalina compatibility)
     m_pci_device = OSDynamicCast(IOPCIDevice, provider);
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU: Provider is not an IOPCIDevice\n");
+        VMLOG_INFO("VMVirtIOGPU: Provider is not an IOPCIDevice\n");
         return false;
     }
-    IOLog("VMVirtIOGPU: IOPCIDevice cast succeeded\n");
+    VMLOG_INFO("VMVirtIOGPU: IOPCIDevice cast succeeded\n");
     
     // Store reference for VirtIO operations
     m_virtio_device = provider;
     
     // Device already validated via IOPCIMatch in Info.plist (vendor 0x1af4, device 0x1050)
-    IOLog("VMVirtIOGPU: VirtIO GPU device matched (VID:DID=1af4:1050)\n");
+    VMLOG_INFO("VMVirtIOGPU: VirtIO GPU device matched (VID:DID=1af4:1050)\n");
     
     // Test VirtIO capability parsing directly with provider before calling initVirtIOGPU
     if (pciDevice) {
@@ -358,25 +368,25 @@ bool CLASS::start(IOService* provider)
         uint32_t test_offset = 0;
         uint32_t test_length = 0;
         
-        IOLog("VMVirtIOGPU: Testing VirtIO capability parsing with provider directly\n");
+        VMLOG_INFO("VMVirtIOGPU: Testing VirtIO capability parsing with provider directly\n");
         if (findVirtIOCapability(pciDevice, 4, &test_bar_index, &test_offset, &test_length)) { // 4 = VIRTIO_PCI_CAP_DEVICE_CFG
-            IOLog("VMVirtIOGPU: SUCCESS - VirtIO capability parsing found device config at BAR %d + 0x%x\n", 
+            VMLOG_INFO("VMVirtIOGPU: SUCCESS - VirtIO capability parsing found device config at BAR %d + 0x%x\n", 
                   test_bar_index, test_offset);
         } else {
-            IOLog("VMVirtIOGPU: VirtIO capability parsing failed - will use fallback BAR 0\n");
+            VMLOG_ERROR("VMVirtIOGPU: VirtIO capability parsing failed - will use fallback BAR 0\n");
         }
     }
     
     if (!initVirtIOGPU()) {
-        IOLog("VMVirtIOGPU: Failed to initialize VirtIO GPU\n");
+        VMLOG_ERROR("VMVirtIOGPU: Failed to initialize VirtIO GPU\n");
         return false;
     }
-    IOLog("VMVirtIOGPU: initVirtIOGPU succeeded\n");
+    VMLOG_INFO("VMVirtIOGPU: initVirtIOGPU succeeded\n");
     
     // Create command gate for serializing operations
     m_command_gate = IOCommandGate::commandGate(this);
     if (!m_command_gate) {
-        IOLog("VMVirtIOGPU: Failed to create command gate\n");
+        VMLOG_ERROR("VMVirtIOGPU: Failed to create command gate\n");
         return false;
     }
     
@@ -410,8 +420,8 @@ bool CLASS::start(IOService* provider)
     //
     // CONCLUSION: Resolution limitation is inherent to IONDRV + VirtIO GPU combination
     // The real GPU memory (BAR0 = 8 MB) is separate and used for 3D acceleration
-    IOLog("VMVirtIOGPU: VRAM properties controlled by IONDRVFramebuffer\n");
-    IOLog("VMVirtIOGPU: Resolution limited by IONDRV's VRAM detection on VirtIO devices\n");
+    VMLOG_INFO("VMVirtIOGPU: VRAM properties controlled by IONDRVFramebuffer\n");
+    VMLOG_INFO("VMVirtIOGPU: Resolution limited by IONDRV's VRAM detection on VirtIO devices\n");
     
     // d74 origin: 3D acceleration properties on parent device so system_profiler can see them.
     // Values from m_3d_functional (currently always false — see VMVirtIOGPU.h). The transport
@@ -440,7 +450,7 @@ bool CLASS::start(IOService* provider)
     IOAccelID accelID = 0x1AF41050;  // Fixed ID: VirtIO vendor (0x1AF4) + VirtIO GPU device (0x1050)
     setProperty("IOAccelIndex", accelID, 32);
     setProperty("IOAccelRevision", (uint32_t)1, 32);
-    IOLog("VMVirtIOGPU: Using fixed IOAccelerator ID: 0x%X (%u decimal)\n", accelID, accelID);
+    VMLOG_INFO("VMVirtIOGPU: Using fixed IOAccelerator ID: 0x%X (%u decimal)\n", accelID, accelID);
     
     // DO NOT call IOAccelerator::createAccelID() - it creates a conflicting dynamic ID
     // that WindowServer tries to use instead of our fixed ID, causing Metal device lookup to fail
@@ -538,27 +548,27 @@ bool CLASS::start(IOService* provider)
     // d73: IONDRV + ACCELERATOR ARCHITECTURE
     // DO NOT create VMVirtIOFramebuffer - let IONDRVFramebuffer handle display
     // We ONLY provide the accelerator for Metal support
-    IOLog("VMVirtIOGPU: d73 Accelerator-only mode - NO framebuffer creation\n");
-    IOLog("VMVirtIOGPU: IONDRVFramebuffer will handle all display output\n");
-    IOLog("VMVirtIOGPU: We provide ONLY GPU acceleration for WindowServer Metal requirements\n");
+    VMLOG_INFO("VMVirtIOGPU: d73 Accelerator-only mode - NO framebuffer creation\n");
+    VMLOG_INFO("VMVirtIOGPU: IONDRVFramebuffer will handle all display output\n");
+    VMLOG_INFO("VMVirtIOGPU: We provide ONLY GPU acceleration for WindowServer Metal requirements\n");
     
     // Set properties to identify ourselves as GPU command processor
     setProperty("IOClass", "VMVirtIOGPU");
     
-    IOLog("VMVirtIOGPU: Properties configured - GPU command processor role\n");
-    IOLog("VMVirtIOGPU: Display will be handled by VMVirtIOFramebuffer\n");
+    VMLOG_INFO("VMVirtIOGPU: Properties configured - GPU command processor role\n");
+    VMLOG_INFO("VMVirtIOGPU: Display will be handled by VMVirtIOFramebuffer\n");
     
-    IOLog("VMVirtIOGPU: Started successfully with %d scanouts, 3D support: %s\n", 
+    VMLOG_INFO("VMVirtIOGPU: Started successfully with %d scanouts, 3D support: %s\n", 
           m_max_scanouts, supports3D() ? "Yes" : "No");
     
     // Register service so VMVirtIOFramebuffer can match to us
     registerService();
-    IOLog("VMVirtIOGPU: Service registered - ready for VMVirtIOFramebuffer matching\n");
+    VMLOG_INFO("VMVirtIOGPU: Service registered - ready for VMVirtIOFramebuffer matching\n");
     
     // NOTE: Framebuffer creation is now handled automatically by IOKit
     // via VMVirtIOFramebuffer personality matching in Info.plist
-    IOLog("VMVirtIOGPU: Framebuffer creation delegated to IOKit personality matching\n");
-    IOLog("VMVirtIOGPU: Device type detection: isVirtIOVGA=%s, isVirtIOGPUPCI=%s\n",
+    VMLOG_INFO("VMVirtIOGPU: Framebuffer creation delegated to IOKit personality matching\n");
+    VMLOG_INFO("VMVirtIOGPU: Device type detection: isVirtIOVGA=%s, isVirtIOGPUPCI=%s\n",
           isVirtIOVGA ? "true" : "false", isVirtIOGPUPCI ? "true" : "false");
 
     // Negative control: prove the error-response path works. Every response
@@ -576,11 +586,11 @@ bool CLASS::start(IOService* provider)
     struct virtio_gpu_ctrl_hdr nc_resp = {};
     IOReturn nc_ret = submitCommand(&nc_cmd.hdr, sizeof(nc_cmd), &nc_resp, sizeof(nc_resp));
     if (nc_resp.type == VIRTIO_GPU_RESP_ERR_INVALID_RESOURCE_ID) {
-        IOLog("VMQemuVGA: negative control OK — error path detected (resp=0x1203, ret=0x%x)\n", nc_ret);
+        VMLOG_ERROR("VMQemuVGA: negative control OK — error path detected (resp=0x1203, ret=0x%x)\n", nc_ret);
     } else if (nc_resp.type == 0) {
-        IOLog("VMQemuVGA: WARNING negative control — no response written (submit ret=0x%x)\n", nc_ret);
+        VMLOG_WARN("VMQemuVGA: WARNING negative control — no response written (submit ret=0x%x)\n", nc_ret);
     } else {
-        IOLog("VMQemuVGA: WARNING negative control resp_type=0x%x (expected 0x1203) ret=0x%x\n",
+        VMLOG_WARN("VMQemuVGA: WARNING negative control resp_type=0x%x (expected 0x1203) ret=0x%x\n",
               nc_resp.type, nc_ret);
     }
 
@@ -592,15 +602,15 @@ bool CLASS::start(IOService* provider)
 bool CLASS::initializeWithPCIDevice(IOPCIDevice* pciDevice)
 {
     if (!pciDevice) {
-        IOLog("VMVirtIOGPU::initializeWithPCIDevice - NULL PCI device\n");
+        VMLOG_INFO("VMVirtIOGPU::initializeWithPCIDevice - NULL PCI device\n");
         return false;
     }
     
     // CRITICAL: 5-second initialization delay (same race condition as QXL)
     // Race condition fix: Delay driver initialization to ensure system services are ready
-    IOLog("VMVirtIOGPU::initializeWithPCIDevice - Applying 5-second delay for race condition fix...\n");
+    VMLOG_INFO("VMVirtIOGPU::initializeWithPCIDevice - Applying 5-second delay for race condition fix...\n");
     IOSleep(5000);  // 5000ms delay - empirically determined minimum for reliable boot
-    IOLog("VMVirtIOGPU::initializeWithPCIDevice - Initialization delay complete\n");
+    VMLOG_INFO("VMVirtIOGPU::initializeWithPCIDevice - Initialization delay complete\n");
     
     m_pci_device = pciDevice;
     m_pci_device->retain();
@@ -615,36 +625,36 @@ bool CLASS::initializeWithPCIDevice(IOPCIDevice* pciDevice)
         UInt8 baseClass = (classCode >> 16) & 0xFF;
         UInt8 subClass = (classCode >> 8) & 0xFF;
         
-        IOLog("VMVirtIOGPU::initializeWithPCIDevice - PCI class: 0x%02x:0x%02x\n", baseClass, subClass);
+        VMLOG_INFO("VMVirtIOGPU::initializeWithPCIDevice - PCI class: 0x%02x:0x%02x\n", baseClass, subClass);
         
         if (baseClass == 0x03 && subClass == 0x00) {
             isVirtIOVGA = true;
-            IOLog("VMVirtIOGPU::initializeWithPCIDevice - Detected virtio-vga-gl (VGA-compatible)\n");
+            VMLOG_INFO("VMVirtIOGPU::initializeWithPCIDevice - Detected virtio-vga-gl (VGA-compatible)\n");
         } else if (baseClass == 0x03 && (subClass == 0x80 || subClass == 0x02)) {
             isVirtIOGPUPCI = true;
-            IOLog("VMVirtIOGPU::initializeWithPCIDevice - Detected virtio-gpu-gl-pci (pure GPU)\n");
+            VMLOG_INFO("VMVirtIOGPU::initializeWithPCIDevice - Detected virtio-gpu-gl-pci (pure GPU)\n");
         } else {
             isVirtIOVGA = true;  // Default
-            IOLog("VMVirtIOGPU::initializeWithPCIDevice - Unknown type 0x%02x:0x%02x, defaulting to VGA\n",
+            VMLOG_INFO("VMVirtIOGPU::initializeWithPCIDevice - Unknown type 0x%02x:0x%02x, defaulting to VGA\n",
                   baseClass, subClass);
         }
     }
     
     // Initialize VirtIO GPU hardware
     if (!initVirtIOGPU()) {
-        IOLog("VMVirtIOGPU::initializeWithPCIDevice - initVirtIOGPU() failed\n");
+        VMLOG_ERROR("VMVirtIOGPU::initializeWithPCIDevice - initVirtIOGPU() failed\n");
         m_pci_device->release();
         m_pci_device = nullptr;
         return false;
     }
     
-    IOLog("VMVirtIOGPU::initializeWithPCIDevice - Initialized successfully (NO IOService registration)\n");
+    VMLOG_INFO("VMVirtIOGPU::initializeWithPCIDevice - Initialized successfully (NO IOService registration)\n");
     return true;
 }
 
 void CLASS::stop(IOService* provider)
 {
-    IOLog("VMVirtIOGPU::stop\n");
+    VMLOG_INFO("VMVirtIOGPU::stop\n");
     
     // DISABLED: No longer using IOAccelerator - changed to IOService inheritance
     // Cleanup IOAccelerator ID if we created one
@@ -675,8 +685,8 @@ void CLASS::terminateIONDRVFramebuffers()
     //    Our higher probe score (100000) ensures we're selected as primary driver
     //    Setting IONDRVIgnore=true in probe() prevents IONDRV from binding
     
-    IOLog("VMVirtIOGPU::terminateIONDRVFramebuffers: DEPRECATED - no longer terminating IONDRV instances\n");
-    IOLog("VMVirtIOGPU: Using IOKit probe score priority and IONDRVIgnore property instead\n");
+    VMLOG_INFO("VMVirtIOGPU::terminateIONDRVFramebuffers: DEPRECATED - no longer terminating IONDRV instances\n");
+    VMLOG_INFO("VMVirtIOGPU: Using IOKit probe score priority and IONDRVIgnore property instead\n");
 }
 
 // VirtIO PCI capability types
@@ -705,41 +715,41 @@ struct virtio_pci_cap {
 
 bool CLASS::findVirtIOCapability(IOPCIDevice* pci_device, uint8_t cfg_type, uint8_t* bar_index, uint32_t* offset, uint32_t* length)
 {
-    IOLog("VMVirtIOGPU: findVirtIOCapability called for cfg_type=%d\n", cfg_type);
+    VMLOG_INFO("VMVirtIOGPU: findVirtIOCapability called for cfg_type=%d\n", cfg_type);
     
     if (!pci_device) {
-        IOLog("VMVirtIOGPU: Invalid PCI device provided\n");
+        VMLOG_WARN("VMVirtIOGPU: Invalid PCI device provided\n");
         return false;
     }
     
     // TRY 1: Parse actual PCI capabilities from device config space
-    IOLog("VMVirtIOGPU: Attempting to parse PCI vendor capabilities\n");
+    VMLOG_INFO("VMVirtIOGPU: Attempting to parse PCI vendor capabilities\n");
     
     // DIAGNOSTIC: Read and dump PCI header to understand device structure
-    IOLog("VMVirtIOGPU: === PCI CONFIG SPACE DIAGNOSTIC ===\n");
+    VMLOG_INFO("VMVirtIOGPU: === PCI CONFIG SPACE DIAGNOSTIC ===\n");
     UInt16 vendor_id = pci_device->configRead16(0x00);
     UInt16 device_id = pci_device->configRead16(0x02);
     UInt16 command = pci_device->configRead16(0x04);
     UInt16 status = pci_device->configRead16(0x06);
     UInt8 header_type = pci_device->configRead8(0x0E);
     
-    IOLog("VMVirtIOGPU: PCI Header - VID:DID=%04x:%04x, Command=0x%04x, Status=0x%04x, HeaderType=0x%02x\n",
+    VMLOG_INFO("VMVirtIOGPU: PCI Header - VID:DID=%04x:%04x, Command=0x%04x, Status=0x%04x, HeaderType=0x%02x\n",
           vendor_id, device_id, command, status, header_type);
     
     // Read capability pointer from PCI config space offset 0x34
     UInt8 cap_ptr = pci_device->configRead8(0x34);
-    IOLog("VMVirtIOGPU: Capabilities list pointer at 0x34 = 0x%02x\n", cap_ptr);
+    VMLOG_INFO("VMVirtIOGPU: Capabilities list pointer at 0x34 = 0x%02x\n", cap_ptr);
     
     // DIAGNOSTIC: Check if capabilities are enabled in status register
     bool capabilities_enabled = (status & 0x0010) != 0; // Bit 4 = Capabilities List
-    IOLog("VMVirtIOGPU: Capabilities List enabled in status register: %s\n", 
+    VMLOG_INFO("VMVirtIOGPU: Capabilities List enabled in status register: %s\n", 
           capabilities_enabled ? "YES" : "NO");
     
     if (cap_ptr == 0 || cap_ptr < 0x40) {
-        IOLog("VMVirtIOGPU: ❌ No valid capability pointer (0x%02x), using fallback method\n", cap_ptr);
-        IOLog("VMVirtIOGPU: This is Snow Leopard - device may not expose capabilities properly\n");
+        VMLOG_ERROR("VMVirtIOGPU: ❌ No valid capability pointer (0x%02x), using fallback method\n", cap_ptr);
+        VMLOG_INFO("VMVirtIOGPU: This is Snow Leopard - device may not expose capabilities properly\n");
     } else {
-        IOLog("VMVirtIOGPU: ✅ Valid capability pointer found at 0x%02x, parsing capability chain\n", cap_ptr);
+        VMLOG_INFO("VMVirtIOGPU: ✅ Valid capability pointer found at 0x%02x, parsing capability chain\n", cap_ptr);
     }
     
     while (cap_ptr >= 0x40 && cap_ptr < 0xfc) {
@@ -753,14 +763,14 @@ bool CLASS::findVirtIOCapability(IOPCIDevice* pci_device, uint8_t cfg_type, uint
             UInt32 cap_offset = pci_device->configRead32(cap_ptr + 8);
             UInt32 cap_length = pci_device->configRead32(cap_ptr + 12);
             
-            IOLog("VMVirtIOGPU: Found vendor cap at 0x%02x: cfg_type=%d, bar=%d, offset=0x%x, length=0x%x\n",
+            VMLOG_INFO("VMVirtIOGPU: Found vendor cap at 0x%02x: cfg_type=%d, bar=%d, offset=0x%x, length=0x%x\n",
                   cap_ptr, cfg_type_read, bar, cap_offset, cap_length);
             
             if (cfg_type_read == cfg_type) {
                 *bar_index = bar;
                 *offset = cap_offset;
                 *length = cap_length;
-                IOLog("VMVirtIOGPU: ✅ Found matching VirtIO capability via PCI config parsing\n");
+                VMLOG_INFO("VMVirtIOGPU: ✅ Found matching VirtIO capability via PCI config parsing\n");
                 return true;
             }
         }
@@ -769,10 +779,10 @@ bool CLASS::findVirtIOCapability(IOPCIDevice* pci_device, uint8_t cfg_type, uint
         cap_ptr = cap_next;
     }
     
-    IOLog("VMVirtIOGPU: PCI capability parsing found no match, using fallback\n");
+    VMLOG_INFO("VMVirtIOGPU: PCI capability parsing found no match, using fallback\n");
     
     // TRY 2: Use hardcoded VirtIO capability values (Catalina-tested)
-    IOLog("VMVirtIOGPU: Using hardcoded VirtIO capability data from lspci analysis\n");
+    VMLOG_INFO("VMVirtIOGPU: Using hardcoded VirtIO capability data from lspci analysis\n");
     
     if (cfg_type == VIRTIO_PCI_CAP_COMMON_CFG) {
         // REAL HARDWARE from lspci: CommonCfg at BAR2 offset 0x1000 size 0x800
@@ -781,7 +791,7 @@ bool CLASS::findVirtIOCapability(IOPCIDevice* pci_device, uint8_t cfg_type, uint
         *bar_index = 2;     // Use BAR2 (64-bit prefetchable region)
         *offset = 0x1000;   // CommonCfg offset within BAR2
         *length = 0x800;    // Real hardware size
-        IOLog("VMVirtIOGPU: VirtIO CommonCfg at BAR %d + 0x%x (length 0x%x) - correct hardware layout\n", *bar_index, *offset, *length);
+        VMLOG_INFO("VMVirtIOGPU: VirtIO CommonCfg at BAR %d + 0x%x (length 0x%x) - correct hardware layout\n", *bar_index, *offset, *length);
         return true;
     }
     
@@ -792,7 +802,7 @@ bool CLASS::findVirtIOCapability(IOPCIDevice* pci_device, uint8_t cfg_type, uint
         *bar_index = 2;     // Use BAR2 (64-bit prefetchable region)
         *offset = 0x1800;   // ISR offset within BAR2
         *length = 0x800;    // Real hardware size
-        IOLog("VMVirtIOGPU: VirtIO ISR at BAR %d + 0x%x (length 0x%x) - correct hardware layout\n", *bar_index, *offset, *length);
+        VMLOG_INFO("VMVirtIOGPU: VirtIO ISR at BAR %d + 0x%x (length 0x%x) - correct hardware layout\n", *bar_index, *offset, *length);
         return true;
     }
     
@@ -803,7 +813,7 @@ bool CLASS::findVirtIOCapability(IOPCIDevice* pci_device, uint8_t cfg_type, uint
         *bar_index = 2;     // Use BAR2 (64-bit prefetchable region)
         *offset = 0x2000;   // DeviceCfg offset within BAR2
         *length = 0x1000;   // DeviceCfg size
-        IOLog("VMVirtIOGPU: VirtIO DeviceCfg at BAR %d + 0x%x (length 0x%x) - correct hardware layout\n", *bar_index, *offset, *length);
+        VMLOG_INFO("VMVirtIOGPU: VirtIO DeviceCfg at BAR %d + 0x%x (length 0x%x) - correct hardware layout\n", *bar_index, *offset, *length);
         return true;
     }
     
@@ -814,11 +824,11 @@ bool CLASS::findVirtIOCapability(IOPCIDevice* pci_device, uint8_t cfg_type, uint
         *bar_index = 2;     // Use BAR2 as reported by hardware
         *offset = 0x3000;   // Notify at BAR2+0x3000 (NOT BAR2 base)
         *length = 0x1000;   // 4KB notify region size
-        IOLog("VMVirtIOGPU: VirtIO Notify at BAR %d + 0x%x (length 0x%x) - correct hardware layout\n", *bar_index, *offset, *length);
+        VMLOG_INFO("VMVirtIOGPU: VirtIO Notify at BAR %d + 0x%x (length 0x%x) - correct hardware layout\n", *bar_index, *offset, *length);
         return true;
     }
     
-    IOLog("VMVirtIOGPU: Unsupported VirtIO capability type %d\n", cfg_type);
+    VMLOG_WARN("VMVirtIOGPU: Unsupported VirtIO capability type %d\n", cfg_type);
     return false;
 }
 
@@ -896,16 +906,16 @@ IOMemoryMap* CLASS::mapBarByNumber(uint8_t bar, int* out_iokit_index)
 
 bool CLASS::initVirtIOGPU()
 {
-    IOLog("VMVirtIOGPU: Initializing VirtIO GPU with proper capability parsing\n");
+    VMLOG_INFO("VMVirtIOGPU: Initializing VirtIO GPU with proper capability parsing\n");
     
     // Parse VirtIO capabilities to find device configuration space
     uint8_t config_bar_index = 0;
     uint32_t config_offset = 0;
     uint32_t config_length = 0;
     
-    IOLog("VMVirtIOGPU: About to call findVirtIOCapability for device config detection\n");
+    VMLOG_INFO("VMVirtIOGPU: About to call findVirtIOCapability for device config detection\n");
     bool capability_found = findVirtIOCapability(m_pci_device, VIRTIO_PCI_CAP_DEVICE_CFG, &config_bar_index, &config_offset, &config_length);
-    IOLog("VMVirtIOGPU: findVirtIOCapability returned: %s (BAR=%d, offset=0x%x, length=0x%x)\n",
+    VMLOG_INFO("VMVirtIOGPU: findVirtIOCapability returned: %s (BAR=%d, offset=0x%x, length=0x%x)\n",
           capability_found ? "SUCCESS" : "FAILURE", config_bar_index, config_offset, config_length);
 
     // Stash the cap-reported location so device-cfg can be re-read from anywhere later
@@ -914,9 +924,9 @@ bool CLASS::initVirtIOGPU()
     m_device_cfg_offset = config_offset;
     
     if (!capability_found) {
-        IOLog("VMVirtIOGPU: Failed to find VirtIO device configuration capability\n");
-        IOLog("VMVirtIOGPU: CRITICAL - Cannot determine VirtIO config location\n");
-        IOLog("VMVirtIOGPU: Will attempt conservative 3D detection based on device type\n");
+        VMLOG_ERROR("VMVirtIOGPU: Failed to find VirtIO device configuration capability\n");
+        VMLOG_WARN("VMVirtIOGPU: CRITICAL - Cannot determine VirtIO config location\n");
+        VMLOG_INFO("VMVirtIOGPU: Will attempt conservative 3D detection based on device type\n");
         
         // When we can't find VirtIO capabilities, make educated guesses about 3D support
         // Most modern VirtIO GPU devices support 3D acceleration
@@ -933,7 +943,7 @@ bool CLASS::initVirtIOGPU()
             if (baseClass == 0x03 && (subClass == 0x00 || subClass == 0x02)) {
                 // VGA-compatible or 3D controller - likely supports 3D
                 assume3DSupport = true;
-                IOLog("VMVirtIOGPU: PCI class 0x%02x:0x%02x suggests 3D capability support\n", baseClass, subClass);
+                VMLOG_INFO("VMVirtIOGPU: PCI class 0x%02x:0x%02x suggests 3D capability support\n", baseClass, subClass);
             }
         }
         
@@ -941,7 +951,7 @@ bool CLASS::initVirtIOGPU()
         m_max_scanouts = 1; // Safe minimum
         m_num_capsets = assume3DSupport ? 2 : 0; // Assume basic 3D capset if device seems capable
         
-        IOLog("VMVirtIOGPU: Conservative defaults - scanouts: %d, capsets: %d (3D: %s)\n", 
+        VMLOG_INFO("VMVirtIOGPU: Conservative defaults - scanouts: %d, capsets: %d (3D: %s)\n", 
               m_max_scanouts, m_num_capsets, assume3DSupport ? "ASSUMED" : "DISABLED");
         
         return true; // Continue with conservative values rather than failing completely
@@ -951,25 +961,25 @@ bool CLASS::initVirtIOGPU()
     // Use mapBarByNumber() — PCI capability reports the BAR NUMBER (e.g., 4),
     // but IOKit's mapDeviceMemoryWithIndex() takes the IOKit region INDEX (e.g., 1).
     // The helper resolves the mismatch via PCI config space + phys-addr matching.
-    IOLog("VMVirtIOGPU: Mapping PCI BAR %d for device configuration\n", config_bar_index);
+    VMLOG_INFO("VMVirtIOGPU: Mapping PCI BAR %d for device configuration\n", config_bar_index);
     m_config_map = mapBarByNumber(config_bar_index);
     if (!m_config_map) {
-        IOLog("VMVirtIOGPU: mapBarByNumber(%d) returned NULL — BAR unmapped or no IOKit match\n",
+        VMLOG_INFO("VMVirtIOGPU: mapBarByNumber(%d) returned NULL — BAR unmapped or no IOKit match\n",
               config_bar_index);
         // Use safe defaults to prevent boot hang
         m_max_scanouts = 1;
         m_num_capsets = 0;
     } else {
-        IOLog("VMVirtIOGPU: Config space mapping successful\n");
-        IOLog("  BAR %d mapped: %p\n", config_bar_index, m_config_map);
-        IOLog("  Physical address: 0x%llx\n", m_config_map->getPhysicalAddress());
-        IOLog("  Size: %llu bytes\n", m_config_map->getLength());
-        IOLog("  Config offset: 0x%08x\n", config_offset);
+        VMLOG_INFO("VMVirtIOGPU: Config space mapping successful\n");
+        VMLOG_INFO("  BAR %d mapped: %p\n", config_bar_index, m_config_map);
+        VMLOG_INFO("  Physical address: 0x%llx\n", m_config_map->getPhysicalAddress());
+        VMLOG_INFO("  Size: %llu bytes\n", m_config_map->getLength());
+        VMLOG_INFO("  Config offset: 0x%08x\n", config_offset);
         
         // Get virtual address and apply offset for VirtIO device config
         uint8_t* base_addr = (uint8_t*)m_config_map->getVirtualAddress();
         if (!base_addr) {
-            IOLog("VMVirtIOGPU: ERROR - getVirtualAddress() returned NULL\n");
+            VMLOG_ERROR("VMVirtIOGPU: ERROR - getVirtualAddress() returned NULL\n");
             m_max_scanouts = 1;
             m_num_capsets = 0;
         } else {
@@ -978,10 +988,10 @@ bool CLASS::initVirtIOGPU()
             size_t required_size = config_offset + sizeof(struct virtio_gpu_config);
             
             if (config_map_size < required_size) {
-                IOLog("VMVirtIOGPU: Config map too small for offset 0x%x: %llu < %zu bytes\n", 
+                VMLOG_INFO("VMVirtIOGPU: Config map too small for offset 0x%x: %llu < %zu bytes\n", 
                       config_offset, (uint64_t)config_map_size, required_size);
                 
-                IOLog("VMVirtIOGPU: Attempting to map DeviceCfg via physical address\n");
+                VMLOG_INFO("VMVirtIOGPU: Attempting to map DeviceCfg via physical address\n");
                 
                 // DeviceCfg extends beyond the mapped BAR size
                 // Get the physical address of the BAR and add the config offset
@@ -990,8 +1000,8 @@ bool CLASS::initVirtIOGPU()
                     IOPhysicalAddress bar_phys = bar_memory->getPhysicalAddress();
                     IOPhysicalAddress devicecfg_phys = bar_phys + config_offset;
                     
-                    IOLog("VMVirtIOGPU: BAR%d physical address: 0x%llx\n", config_bar_index, (uint64_t)bar_phys);
-                    IOLog("VMVirtIOGPU: DeviceCfg physical address: 0x%llx (BAR + 0x%x)\n", 
+                    VMLOG_INFO("VMVirtIOGPU: BAR%d physical address: 0x%llx\n", config_bar_index, (uint64_t)bar_phys);
+                    VMLOG_INFO("VMVirtIOGPU: DeviceCfg physical address: 0x%llx (BAR + 0x%x)\n", 
                           (uint64_t)devicecfg_phys, config_offset);
                     
                     // Create a memory descriptor for the DeviceCfg region
@@ -1009,7 +1019,7 @@ bool CLASS::initVirtIOGPU()
                                 (volatile struct virtio_gpu_config*)devicecfg_map->getVirtualAddress();
                             
                             if (gpu_config) {
-                                IOLog("VMVirtIOGPU: Successfully mapped DeviceCfg at virtual address %p\n", gpu_config);
+                                VMLOG_INFO("VMVirtIOGPU: Successfully mapped DeviceCfg at virtual address %p\n", gpu_config);
                                 
                                 // Read the actual hardware values
                                 uint32_t events_read = gpu_config->events_read;
@@ -1017,7 +1027,7 @@ bool CLASS::initVirtIOGPU()
                                 uint32_t num_scanouts = gpu_config->num_scanouts;
                                 uint32_t num_capsets = gpu_config->num_capsets;
                                 
-                                IOLog("VMVirtIOGPU: Hardware config - events_read=0x%x, events_clear=0x%x, num_scanouts=%u, num_capsets=%u\n",
+                                VMLOG_INFO("VMVirtIOGPU: Hardware config - events_read=0x%x, events_clear=0x%x, num_scanouts=%u, num_capsets=%u\n",
                                       events_read, events_clear, num_scanouts, num_capsets);
                                 
                                 // Validate values are reasonable
@@ -1025,36 +1035,36 @@ bool CLASS::initVirtIOGPU()
                                     m_max_scanouts = num_scanouts;
                                     m_num_capsets = num_capsets;
                                     
-                                    IOLog("VMVirtIOGPU: SUCCESS - Applied hardware config: scanouts=%u, capsets=%u\n", 
+                                    VMLOG_INFO("VMVirtIOGPU: SUCCESS - Applied hardware config: scanouts=%u, capsets=%u\n", 
                                           m_max_scanouts, m_num_capsets);
                                     
                                     if (m_num_capsets > 0) {
-                                        IOLog("VMVirtIOGPU: 3D acceleration ENABLED (hardware detected %u capability sets)\n", m_num_capsets);
+                                        VMLOG_INFO("VMVirtIOGPU: 3D acceleration ENABLED (hardware detected %u capability sets)\n", m_num_capsets);
                                     }
                                 } else {
-                                    IOLog("VMVirtIOGPU: Hardware reported invalid values, using safe defaults\n");
+                                    VMLOG_WARN("VMVirtIOGPU: Hardware reported invalid values, using safe defaults\n");
                                     m_max_scanouts = 1;
                                     m_num_capsets = 0;
                                 }
                             } else {
-                                IOLog("VMVirtIOGPU: DeviceCfg map getVirtualAddress() failed\n");
+                                VMLOG_ERROR("VMVirtIOGPU: DeviceCfg map getVirtualAddress() failed\n");
                                 m_max_scanouts = 1;
                                 m_num_capsets = 0;
                             }
                             devicecfg_map->release();
                         } else {
-                            IOLog("VMVirtIOGPU: Failed to map DeviceCfg descriptor\n");
+                            VMLOG_ERROR("VMVirtIOGPU: Failed to map DeviceCfg descriptor\n");
                             m_max_scanouts = 1;
                             m_num_capsets = 0;
                         }
                         devicecfg_desc->release();
                     } else {
-                        IOLog("VMVirtIOGPU: Failed to create DeviceCfg memory descriptor\n");
+                        VMLOG_ERROR("VMVirtIOGPU: Failed to create DeviceCfg memory descriptor\n");
                         m_max_scanouts = 1;
                         m_num_capsets = 0;
                     }
                 } else {
-                    IOLog("VMVirtIOGPU: Failed to get BAR%d device memory\n", config_bar_index);
+                    VMLOG_ERROR("VMVirtIOGPU: Failed to get BAR%d device memory\n", config_bar_index);
                     m_max_scanouts = 1;
                     m_num_capsets = 0;
                 }
@@ -1063,20 +1073,20 @@ bool CLASS::initVirtIOGPU()
                 volatile struct virtio_gpu_config* gpu_config = 
                     (volatile struct virtio_gpu_config*)(base_addr + config_offset);
                 
-                IOLog("VMVirtIOGPU: Reading VirtIO config at offset 0x%x (%p), validated size\n", config_offset, gpu_config);
+                VMLOG_INFO("VMVirtIOGPU: Reading VirtIO config at offset 0x%x (%p), validated size\n", config_offset, gpu_config);
                 
                 // DIAGNOSTIC: Safely hex dump the memory around config offset to see actual contents
-                IOLog("VMVirtIOGPU: === MEMORY INSPECTION ===\n");
-                IOLog("VMVirtIOGPU: BAR 2 mapped size: %llu bytes\n", (uint64_t)config_map_size);
-                IOLog("VMVirtIOGPU: Config offset: 0x%x\n", config_offset);
+                VMLOG_INFO("VMVirtIOGPU: === MEMORY INSPECTION ===\n");
+                VMLOG_INFO("VMVirtIOGPU: BAR 2 mapped size: %llu bytes\n", (uint64_t)config_map_size);
+                VMLOG_INFO("VMVirtIOGPU: Config offset: 0x%x\n", config_offset);
                 
                 // Dump 64 bytes starting from config offset (safe bounds checking)
                 uint32_t dump_size = 64;
                 if (config_offset + dump_size <= config_map_size) {
                     uint8_t* dump_ptr = (uint8_t*)(base_addr + config_offset);
-                    IOLog("VMVirtIOGPU: Hex dump of config space at offset 0x%x:\n", config_offset);
+                    VMLOG_INFO("VMVirtIOGPU: Hex dump of config space at offset 0x%x:\n", config_offset);
                     for (uint32_t i = 0; i < dump_size; i += 16) {
-                        IOLog("VMVirtIOGPU: %04x: %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x\n", 
+                        VMLOG_INFO("VMVirtIOGPU: %04x: %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x\n", 
                               config_offset + i,
                               dump_ptr[i+0], dump_ptr[i+1], dump_ptr[i+2], dump_ptr[i+3],
                               dump_ptr[i+4], dump_ptr[i+5], dump_ptr[i+6], dump_ptr[i+7],
@@ -1088,9 +1098,9 @@ bool CLASS::initVirtIOGPU()
                 // Also dump from offset 0 to see what's there
                 if (config_map_size >= 64) {
                     uint8_t* dump_ptr = base_addr;
-                    IOLog("VMVirtIOGPU: Hex dump from BAR start (offset 0x0):\n");
+                    VMLOG_INFO("VMVirtIOGPU: Hex dump from BAR start (offset 0x0):\n");
                     for (uint32_t i = 0; i < 64; i += 16) {
-                        IOLog("VMVirtIOGPU: %04x: %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x\n", 
+                        VMLOG_INFO("VMVirtIOGPU: %04x: %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x\n", 
                               i,
                               dump_ptr[i+0], dump_ptr[i+1], dump_ptr[i+2], dump_ptr[i+3],
                               dump_ptr[i+4], dump_ptr[i+5], dump_ptr[i+6], dump_ptr[i+7],
@@ -1098,7 +1108,7 @@ bool CLASS::initVirtIOGPU()
                               dump_ptr[i+12], dump_ptr[i+13], dump_ptr[i+14], dump_ptr[i+15]);
                     }
                 }
-                IOLog("VMVirtIOGPU: === END MEMORY INSPECTION ===\n");
+                VMLOG_INFO("VMVirtIOGPU: === END MEMORY INSPECTION ===\n");
             
                 // CRITICAL: Initialize VirtIO device before reading config
                 // We need to map the Common Config space to initialize the device
@@ -1107,7 +1117,7 @@ bool CLASS::initVirtIOGPU()
                 uint32_t common_length = 0;
             
             if (findVirtIOCapability(m_pci_device, VIRTIO_PCI_CAP_COMMON_CFG, &common_bar_index, &common_offset, &common_length)) {
-                IOLog("VMVirtIOGPU: Initializing VirtIO device via Common Config\n");
+                VMLOG_INFO("VMVirtIOGPU: Initializing VirtIO device via Common Config\n");
                 
                 // Map Common Config BAR (should be same as device config BAR 2)
                 IOMemoryMap* common_map = m_pci_device->mapDeviceMemoryWithIndex(common_bar_index);
@@ -1117,7 +1127,7 @@ bool CLASS::initVirtIOGPU()
                     size_t required_common_size = common_offset + 24; // device_status (20) + 4 bytes
                     
                     if (common_map_size < required_common_size) {
-                        IOLog("VMVirtIOGPU: ERROR - Common map too small: %llu < %llu bytes\n",
+                        VMLOG_ERROR("VMVirtIOGPU: ERROR - Common map too small: %llu < %llu bytes\n",
                               (uint64_t)common_map_size, (uint64_t)required_common_size);
                     } else {
                         volatile uint8_t* common_base = (volatile uint8_t*)common_map->getVirtualAddress();
@@ -1126,7 +1136,7 @@ bool CLASS::initVirtIOGPU()
                             volatile uint8_t* device_status = common_base + common_offset + 20; // device_status offset in common config
                             
                             // VirtIO device initialization sequence
-                            IOLog("VMVirtIOGPU: Performing VirtIO device reset and initialization\n");
+                            VMLOG_INFO("VMVirtIOGPU: Performing VirtIO device reset and initialization\n");
                             
                             // 1. Reset device
                             *device_status = 0;
@@ -1145,17 +1155,17 @@ bool CLASS::initVirtIOGPU()
                         *device_status = 1 | 2 | 4; // ACKNOWLEDGE | DRIVER | DRIVER_OK
                         IODelay(100); // Wait 100ms for device to fully initialize
                         
-                        IOLog("VMVirtIOGPU: VirtIO device initialization complete, status=0x%02x\n", *device_status);
+                        VMLOG_INFO("VMVirtIOGPU: VirtIO device initialization complete, status=0x%02x\n", *device_status);
                         } else {
-                            IOLog("VMVirtIOGPU: ERROR - Common base virtual address is NULL\n");
+                            VMLOG_ERROR("VMVirtIOGPU: ERROR - Common base virtual address is NULL\n");
                         }
                     }
                     common_map->release();
                 } else {
-                    IOLog("VMVirtIOGPU: WARNING - Could not map Common Config for device initialization\n");
+                    VMLOG_WARN("VMVirtIOGPU: WARNING - Could not map Common Config for device initialization\n");
                 }
             } else {
-                IOLog("VMVirtIOGPU: WARNING - Could not find Common Config capability for device initialization\n");
+                VMLOG_WARN("VMVirtIOGPU: WARNING - Could not find Common Config capability for device initialization\n");
             }
             
             // Read hardware configuration values safely
@@ -1164,14 +1174,14 @@ bool CLASS::initVirtIOGPU()
             uint32_t hw_scanouts = gpu_config->num_scanouts;
             uint32_t hw_capsets = gpu_config->num_capsets;
             
-            IOLog("VMVirtIOGPU: Hardware config - events_read=%u, events_clear=%u, scanouts=%u (0x%x), capsets=%u (0x%x)\n", 
+            VMLOG_INFO("VMVirtIOGPU: Hardware config - events_read=%u, events_clear=%u, scanouts=%u (0x%x), capsets=%u (0x%x)\n", 
                   events_read, events_clear, hw_scanouts, hw_scanouts, hw_capsets, hw_capsets);
             
             // Validate values are reasonable for VirtIO GPU
             if (hw_scanouts >= 1 && hw_scanouts <= 16) {
                 m_max_scanouts = hw_scanouts;
             } else {
-                IOLog("VMVirtIOGPU: Invalid scanouts value %u, using default\n", hw_scanouts);
+                VMLOG_WARN("VMVirtIOGPU: Invalid scanouts value %u, using default\n", hw_scanouts);
                 // Default for VirtIO GPU devices - most have 1 scanout
                 m_max_scanouts = 1;
             }
@@ -1179,62 +1189,62 @@ bool CLASS::initVirtIOGPU()
             if (hw_capsets <= 16) {
                 m_num_capsets = hw_capsets;
             } else {
-                IOLog("VMVirtIOGPU: Invalid capsets value %u, using default\n", hw_capsets);
+                VMLOG_WARN("VMVirtIOGPU: Invalid capsets value %u, using default\n", hw_capsets);
                 m_num_capsets = 0;
             }
             
             // WORKAROUND: If device config shows all zeros, it might be uninitialized
             // Use reasonable defaults for VirtIO GPU with 3D acceleration
             if (m_max_scanouts == 1 && m_num_capsets == 0) {
-                IOLog("VMVirtIOGPU: Device config appears uninitialized - applying VirtIO GPU defaults\n");
+                VMLOG_INFO("VMVirtIOGPU: Device config appears uninitialized - applying VirtIO GPU defaults\n");
                 
                 // Most VirtIO GPU implementations support:
                 // - 1 scanout (display output) 
                 // - 2 capability sets (VIRGL capset for 3D, plus base capset)
                 m_num_capsets = 2; // Enable 3D acceleration by default
                 
-                IOLog("VMVirtIOGPU: Applied defaults - scanouts: %d, capsets: %d (enabling 3D)\n", 
+                VMLOG_INFO("VMVirtIOGPU: Applied defaults - scanouts: %d, capsets: %d (enabling 3D)\n", 
                       m_max_scanouts, m_num_capsets);
             }
             
-            IOLog("VMVirtIOGPU: Final config - scanouts: %d, capsets: %d\n", 
+            VMLOG_INFO("VMVirtIOGPU: Final config - scanouts: %d, capsets: %d\n", 
                   m_max_scanouts, m_num_capsets);
             } else {
-                IOLog("VMVirtIOGPU: Skipping config access due to insufficient BAR size\n");
+                VMLOG_WARN("VMVirtIOGPU: Skipping config access due to insufficient BAR size\n");
             }
         }
     }
     
     // Log the final configuration values
-    IOLog("VMVirtIOGPU: Final device config - scanouts: %d, capsets: %d\n", 
+    VMLOG_INFO("VMVirtIOGPU: Final device config - scanouts: %d, capsets: %d\n", 
           m_max_scanouts, m_num_capsets);
     
     // Initialize real VirtIO 1.0 virtqueue (replaces fake queue buffers)
     if (!setupControlVirtQueue()) {
-        IOLog("VMQemuVGA: WARNING — virtqueue setup failed, commands will not reach device\n");
+        VMLOG_ERROR("VMQemuVGA: WARNING — virtqueue setup failed, commands will not reach device\n");
     }
 
     // Initialize VirtIO queues BEFORE 3D operations
-    IOLog("VMVirtIOGPU: *** INITIALIZING VIRTIO QUEUES ***\n");
+    VMLOG_INFO("VMVirtIOGPU: *** INITIALIZING VIRTIO QUEUES ***\n");
     if (!initializeVirtIOQueues()) {
-        IOLog("VMVirtIOGPU: *** VIRTIO QUEUE INITIALIZATION FAILED ***\n");
+        VMLOG_ERROR("VMVirtIOGPU: *** VIRTIO QUEUE INITIALIZATION FAILED ***\n");
         return false;
     }
-    IOLog("VMVirtIOGPU: *** VIRTIO QUEUES INITIALIZED SUCCESSFULLY ***\n");
+    VMLOG_INFO("VMVirtIOGPU: *** VIRTIO QUEUES INITIALIZED SUCCESSFULLY ***\n");
     
     // Setup GPU memory regions including notification region (CRITICAL for command submission)
     // This must be done here because VMVirtIOFramebuffer calls initializeWithPCIDevice() directly,
     // bypassing start() where this would normally be called from initHardwareDeferred()
-    IOLog("VMVirtIOGPU: *** SETTING UP GPU MEMORY REGIONS (notification BAR) ***\n");
+    VMLOG_INFO("VMVirtIOGPU: *** SETTING UP GPU MEMORY REGIONS (notification BAR) ***\n");
     if (!setupGPUMemoryRegions()) {
-        IOLog("VMVirtIOGPU: ❌ Failed to setup GPU memory regions - VirtIO notifications will FAIL\n");
+        VMLOG_ERROR("VMVirtIOGPU: ❌ Failed to setup GPU memory regions - VirtIO notifications will FAIL\n");
         // Don't return false - continue with disabled notifications for debugging
     } else {
-        IOLog("VMVirtIOGPU: ✅ GPU memory regions setup successful - VirtIO notifications enabled\n");
+        VMLOG_INFO("VMVirtIOGPU: ✅ GPU memory regions setup successful - VirtIO notifications enabled\n");
     }
     
     // Initialize 3D acceleration and WebGL support if available
-    IOLog("VMVirtIOGPU: Initializing 3D acceleration and WebGL support\n");
+    VMLOG_INFO("VMVirtIOGPU: Initializing 3D acceleration and WebGL support\n");
     enable3DAcceleration();
     
     return true;
@@ -1288,7 +1298,7 @@ IOReturn CLASS::createResource2D(uint32_t resource_id, uint32_t format,
     IOLockLock(m_resource_lock);
 
     if (findResource(resource_id)) {
-        IOLog("VMVirtIOGPU::createResource2D: DUPLICATE id=%u rejected (findResource found existing slot)\n",
+        VMLOG_WARN("VMVirtIOGPU::createResource2D: DUPLICATE id=%u rejected (findResource found existing slot)\n",
               resource_id);
         IOLockUnlock(m_resource_lock);
         return kIOReturnBadArgument;
@@ -1297,7 +1307,7 @@ IOReturn CLASS::createResource2D(uint32_t resource_id, uint32_t format,
     uint32_t bytes_per_pixel = 4;
     size_t resource_size = width * height * bytes_per_pixel;
 
-    IOLog("VMVirtIOGPU::createResource2D: resource=%u %ux%u fmt=0x%x size=%zu backing=%p (%s)\n",
+    VMLOG_DEBUG("VMVirtIOGPU::createResource2D: resource=%u %ux%u fmt=0x%x size=%zu backing=%p (%s)\n",
           resource_id, width, height, format, resource_size, backing,
           backing ? "caller-owned" : "driver-allocated");
 
@@ -1311,7 +1321,7 @@ IOReturn CLASS::createResource2D(uint32_t resource_id, uint32_t format,
     struct virtio_gpu_ctrl_hdr resp = {};
     IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
     if (ret != kIOReturnSuccess || resp.type != VIRTIO_GPU_RESP_OK_NODATA) {
-        IOLog("VMVirtIOGPU::createResource2D: create failed ret=0x%x resp=0x%x\n", ret, resp.type);
+        VMLOG_ERROR("VMVirtIOGPU::createResource2D: create failed ret=0x%x resp=0x%x\n", ret, resp.type);
         IOLockUnlock(m_resource_lock);
         return ret;
     }
@@ -1324,7 +1334,7 @@ IOReturn CLASS::createResource2D(uint32_t resource_id, uint32_t format,
         IOBufferMemoryDescriptor* allocated = IOBufferMemoryDescriptor::withCapacity(
             resource_size, kIODirectionInOut);
         if (!allocated) {
-            IOLog("VMVirtIOGPU::createResource2D: internal backing alloc failed\n");
+            VMLOG_ERROR("VMVirtIOGPU::createResource2D: internal backing alloc failed\n");
             IOLockUnlock(m_resource_lock);
             return kIOReturnNoMemory;
         }
@@ -1357,7 +1367,7 @@ IOReturn CLASS::createResource2D(uint32_t resource_id, uint32_t format,
         }
     }
     if (!slot) {
-        IOLog("VMVirtIOGPU::createResource2D: POOL FULL (64 slots), unref+reject id=%u\n",
+        VMLOG_WARN("VMVirtIOGPU::createResource2D: POOL FULL (64 slots), unref+reject id=%u\n",
               resource_id);
         struct virtio_gpu_resource_unref unref_cmd = {};
         unref_cmd.hdr.type = VIRTIO_GPU_CMD_RESOURCE_UNREF;
@@ -1378,16 +1388,148 @@ IOReturn CLASS::createResource2D(uint32_t resource_id, uint32_t format,
     slot->is_3d = false;
     slot->in_use = true;
 
-    IOLog("VMVirtIOGPU::createResource2D: resource=%u created (%s backing)\n",
+    VMLOG_DEBUG("VMVirtIOGPU::createResource2D: resource=%u created (%s backing)\n",
           resource_id, driver_owns_backing ? "driver-owned" : "caller-owned");
 
     IOLockUnlock(m_resource_lock);
     return kIOReturnSuccess;
 }
 
+// Guest-memory blob: RESOURCE_CREATE_BLOB with the backing's scatter list
+// appended inline (same mem_entry layout as ATTACH_BACKING). The host maps
+// those pages and scans out of them directly once SET_SCANOUT_BLOB points at
+// the resource — no TRANSFER_TO_HOST_2D copy per refresh. Backing is always
+// caller-owned and is not stored in the pool slot (same rule as the
+// caller-owned createResource2D path).
+IOReturn CLASS::createResourceBlob(uint32_t resource_id, uint32_t blob_mem,
+                                  uint32_t blob_flags, IOMemoryDescriptor* backing,
+                                  uint64_t size)
+{
+    if (!m_has_resource_blob) {
+        return kIOReturnUnsupported;
+    }
+    if (!backing || size == 0 || size > (uint64_t)backing->getLength()) {
+        VMLOG_DEBUG("VMVirtIOGPU::createResourceBlob: bad args backing=%p size=%llu\n",
+              backing, size);
+        return kIOReturnBadArgument;
+    }
+
+    IOLockLock(m_resource_lock);
+
+    if (findResource(resource_id)) {
+        VMLOG_WARN("VMVirtIOGPU::createResourceBlob: DUPLICATE id=%u rejected\n", resource_id);
+        IOLockUnlock(m_resource_lock);
+        return kIOReturnBadArgument;
+    }
+
+    IOReturn prepare_ret = backing->prepare(kIODirectionInOut);
+    if (prepare_ret != kIOReturnSuccess) {
+        IOLockUnlock(m_resource_lock);
+        return prepare_ret;
+    }
+
+    // Same two-pass segment walk as attachBacking, bounded to `size` bytes.
+    uint32_t nr_entries = 0;
+    {
+        IOByteCount off = 0;
+        IOByteCount seg_len = 0;
+        while (off < size &&
+               backing->getPhysicalSegment(off, &seg_len, kIOMemoryMapperNone) != 0) {
+            nr_entries++;
+            off += seg_len;
+            if (seg_len == 0) break;  // defensive
+        }
+    }
+    if (nr_entries == 0) {
+        backing->complete(kIODirectionInOut);
+        IOLockUnlock(m_resource_lock);
+        return kIOReturnNoMemory;
+    }
+
+    size_t total_cmd_size = sizeof(virtio_gpu_resource_create_blob)
+                          + nr_entries * sizeof(virtio_gpu_mem_entry);
+    uint8_t* cmd_buffer = (uint8_t*)IOMalloc(total_cmd_size);
+    if (!cmd_buffer) {
+        backing->complete(kIODirectionInOut);
+        IOLockUnlock(m_resource_lock);
+        return kIOReturnNoMemory;
+    }
+    bzero(cmd_buffer, total_cmd_size);
+
+    virtio_gpu_resource_create_blob* cmd = (virtio_gpu_resource_create_blob*)cmd_buffer;
+    cmd->hdr.type = VIRTIO_GPU_CMD_RESOURCE_CREATE_BLOB;
+    cmd->resource_id = resource_id;
+    cmd->blob_mem = blob_mem;
+    cmd->blob_flags = blob_flags;
+    cmd->nr_entries = nr_entries;
+    cmd->blob_id = 0;  // only meaningful for HOST3D blobs
+    cmd->size = size;
+
+    virtio_gpu_mem_entry* entries = (virtio_gpu_mem_entry*)(cmd_buffer + sizeof(virtio_gpu_resource_create_blob));
+    {
+        IOByteCount off = 0;
+        for (uint32_t i = 0; i < nr_entries; i++) {
+            IOByteCount seg_len = 0;
+            IOPhysicalAddress seg_addr = backing->getPhysicalSegment(off, &seg_len, kIOMemoryMapperNone);
+            if (off + seg_len > size) {
+                seg_len = (IOByteCount)(size - off);  // last segment clipped to blob size
+            }
+            entries[i].addr = seg_addr;
+            entries[i].length = (uint32_t)seg_len;
+            entries[i].padding = 0;
+            off += seg_len;
+        }
+    }
+
+    struct virtio_gpu_ctrl_hdr resp = {};
+    IOReturn ret = submitCommand(&cmd->hdr, total_cmd_size, &resp, sizeof(resp));
+    IOFree(cmd_buffer, total_cmd_size);
+    backing->complete(kIODirectionInOut);
+
+    if (ret != kIOReturnSuccess || resp.type != VIRTIO_GPU_RESP_OK_NODATA) {
+        VMLOG_ERROR("VMVirtIOGPU::createResourceBlob: create failed ret=0x%x resp=0x%x\n", ret, resp.type);
+        IOLockUnlock(m_resource_lock);
+        return (ret != kIOReturnSuccess) ? ret : kIOReturnError;
+    }
+
+    gpu_resource* slot = nullptr;
+    for (unsigned int i = 0; i < 64; i++) {
+        if (m_resource_pool[i].resource_id == 0) {
+            slot = &m_resource_pool[i];
+            if (i >= m_resource_count) m_resource_count = i + 1;  // high-water mark
+            break;
+        }
+    }
+    if (!slot) {
+        VMLOG_WARN("VMVirtIOGPU::createResourceBlob: POOL FULL (64 slots), unref+reject id=%u\n",
+              resource_id);
+        struct virtio_gpu_resource_unref unref_cmd = {};
+        unref_cmd.hdr.type = VIRTIO_GPU_CMD_RESOURCE_UNREF;
+        unref_cmd.resource_id = resource_id;
+        struct virtio_gpu_ctrl_hdr unref_resp = {};
+        submitCommand(&unref_cmd.hdr, sizeof(unref_cmd), &unref_resp, sizeof(unref_resp));
+        IOLockUnlock(m_resource_lock);
+        return kIOReturnNoSpace;
+    }
+    slot->resource_id = resource_id;
+    slot->width = 0;   // blobs are untyped; dims live in SET_SCANOUT_BLOB
+    slot->height = 0;
+    slot->format = 0;
+    slot->backing_memory = nullptr;  // caller-owned
+    slot->is_3d = false;
+    slot->in_use = true;
+
+    VMLOG_DEBUG("VMVirtIOGPU::createResourceBlob: resource=%u mem=0x%x flags=0x%x size=%llu nr_entries=%u\n",
+          resource_id, blob_mem, blob_flags, size, nr_entries);
+
+    IOLockUnlock(m_resource_lock);
+    return kIOReturnSuccess;
+}
+
 IOReturn CLASS::createResource3D(uint32_t resource_id, uint32_t target,
                                 uint32_t format, uint32_t bind,
-                                uint32_t width, uint32_t height, uint32_t depth)
+                                uint32_t width, uint32_t height, uint32_t depth,
+                                uint32_t last_level)
 {
     if (!supports3D()) {
         return kIOReturnUnsupported;
@@ -1415,10 +1557,10 @@ IOReturn CLASS::createResource3D(uint32_t resource_id, uint32_t target,
     cmd.height = height;
     cmd.depth = depth;
     
-    IOLog("VMVirtIOGPU::createResource3D: resource=%u target=0x%x format=0x%x bind=0x%x dims=%ux%ux%u\n",
+    VMLOG_DEBUG("VMVirtIOGPU::createResource3D: resource=%u target=0x%x format=0x%x bind=0x%x dims=%ux%ux%u\n",
           resource_id, target, format, bind, width, height, depth);
     cmd.array_size = 1;
-    cmd.last_level = 0;
+    cmd.last_level = last_level;
     cmd.nr_samples = 0;
     cmd.flags = 0;
     
@@ -1484,7 +1626,7 @@ static inline uint8_t vring_read8(volatile const void* addr) {
 bool CLASS::negotiateFeatures()
 {
     if (!m_common_cfg) {
-        IOLog("VMVirtIOGPU: negotiateFeatures: common config not mapped\n");
+        VMLOG_INFO("VMVirtIOGPU: negotiateFeatures: common config not mapped\n");
         return false;
     }
 
@@ -1500,24 +1642,31 @@ bool CLASS::negotiateFeatures()
     __sync_synchronize();
     uint32_t dev_feat1 = vring_read32(cfg + VIRTIO_COMMON_DF);
 
-    IOLog("VMVirtIOGPU: device features: word0=0x%08x word1=0x%08x\n",
+    VMLOG_INFO("VMVirtIOGPU: device features: word0=0x%08x word1=0x%08x\n",
           dev_feat0, dev_feat1);
 
     // Check VIRTIO_F_VERSION_1 (bit 0 of word 1)
     bool has_version_1 = (dev_feat1 & 0x1) != 0;
     if (!has_version_1) {
-        IOLog("VMVirtIOGPU: WARNING — VIRTIO_F_VERSION_1 not offered by device\n");
+        VMLOG_WARN("VMVirtIOGPU: WARNING — VIRTIO_F_VERSION_1 not offered by device\n");
     }
 
     // Check VIRTIO_GPU_F_VIRGL (bit 0 of word 0)
     bool has_virgl = (dev_feat0 & 0x1) != 0;
-    IOLog("VMVirtIOGPU: VIRTIO_GPU_F_VIRGL = %s\n", has_virgl ? "OFFERED" : "NOT OFFERED");
+    VMLOG_INFO("VMVirtIOGPU: VIRTIO_GPU_F_VIRGL = %s\n", has_virgl ? "OFFERED" : "NOT OFFERED");
+
+    // Check VIRTIO_GPU_F_RESOURCE_BLOB (bit 3 of word 0). Lets the display
+    // path scan out of guest memory directly instead of copying every frame
+    // host-side with TRANSFER_TO_HOST_2D.
+    bool has_blob = (dev_feat0 & (1u << VIRTIO_GPU_F_RESOURCE_BLOB)) != 0;
+    VMLOG_INFO("VMVirtIOGPU: VIRTIO_GPU_F_RESOURCE_BLOB = %s\n", has_blob ? "OFFERED" : "NOT OFFERED");
 
-    // Build driver features: accept VERSION_1 and VIRGL if offered
+    // Build driver features: accept VERSION_1, VIRGL and RESOURCE_BLOB if offered
     uint32_t drv_feat0 = 0;
     uint32_t drv_feat1 = 0;
     if (has_version_1) drv_feat1 |= 0x1;
     if (has_virgl)     drv_feat0 |= 0x1;
+    if (has_blob)      drv_feat0 |= (1u << VIRTIO_GPU_F_RESOURCE_BLOB);
 
     // Write driver features
     vring_write32(cfg + VIRTIO_COMMON_TF_SELECT, 0);
@@ -1538,11 +1687,14 @@ bool CLASS::negotiateFeatures()
     IOSleep(1);
     status = vring_read8(cfg + VIRTIO_COMMON_DEVICE_STATUS);
     if (!(status & VIRTIO_STATUS_FEATURES_OK)) {
-        IOLog("VMVirtIOGPU: feature negotiation FAILED (device rejected)\n");
+        VMLOG_ERROR("VMVirtIOGPU: feature negotiation FAILED (device rejected)\n");
         return false;
     }
 
-    IOLog("VMVirtIOGPU: feature negotiation OK (drv_feat0=0x%x drv_feat1=0x%x)\n",
+    // Only now is the blob feature actually ours to use — FEATURES_OK stuck.
+    m_has_resource_blob = has_blob;
+
+    VMLOG_INFO("VMVirtIOGPU: feature negotiation OK (drv_feat0=0x%x drv_feat1=0x%x)\n",
           drv_feat0, drv_feat1);
     return true;
 }
@@ -1558,7 +1710,7 @@ bool CLASS::readCommonConfig(volatile uint8_t** out_base, uint32_t* out_offset,
     uint32_t offset, length;
     if (!findVirtIOCapability(m_pci_device, VIRTIO_PCI_CAP_COMMON_CFG,
                               &bar_idx, &offset, &length)) {
-        IOLog("VMVirtIOGPU: common config capability not found\n");
+        VMLOG_DEBUG("VMVirtIOGPU: common config capability not found\n");
         return false;
     }
 
@@ -1584,7 +1736,7 @@ bool CLASS::readCommonConfig(volatile uint8_t** out_base, uint32_t* out_offset,
         // Compare with this memory range's physical address
         if ((mem->getPhysicalAddress() & 0xFFFFFFF0ULL) == (bar_phys & 0xFFFFFFF0)) {
             map = m_pci_device->mapDeviceMemoryWithIndex(i);
-            IOLog("VMVirtIOGPU: matched common config PCI BAR %d to IOKit index %d (phys=0x%llx)\n",
+            VMLOG_DEBUG("VMVirtIOGPU: matched common config PCI BAR %d to IOKit index %d (phys=0x%llx)\n",
                   bar_idx, i, (uint64_t)bar_phys);
             break;
         }
@@ -1597,18 +1749,18 @@ bool CLASS::readCommonConfig(volatile uint8_t** out_base, uint32_t* out_offset,
 
     // Fallback: try index 1 (common for devices with BAR1 + 64-bit BAR4)
     if (!map && bar_idx == 4) {
-        IOLog("VMVirtIOGPU: trying IOKit index 1 for BAR 4\n");
+        VMLOG_DEBUG("VMVirtIOGPU: trying IOKit index 1 for BAR 4\n");
         map = m_pci_device->mapDeviceMemoryWithIndex(1);
     }
 
     if (!map) {
-        IOLog("VMVirtIOGPU: failed to map common config BAR %d (tried direct + index 1)\n", bar_idx);
+        VMLOG_ERROR("VMVirtIOGPU: failed to map common config BAR %d (tried direct + index 1)\n", bar_idx);
         return false;
     }
 
     IOByteCount map_size = map->getLength();
     if (map_size < offset + 0x38) {
-        IOLog("VMVirtIOGPU: common config BAR too small: %llu < %u\n",
+        VMLOG_DEBUG("VMVirtIOGPU: common config BAR too small: %llu < %u\n",
               (uint64_t)map_size, offset + 0x38);
         map->release();
         return false;
@@ -1621,7 +1773,7 @@ bool CLASS::readCommonConfig(volatile uint8_t** out_base, uint32_t* out_offset,
     *out_bar = bar_idx;
     *out_map = map;
 
-    IOLog("VMVirtIOGPU: common config at BAR %d offset 0x%x base=%p\n",
+    VMLOG_DEBUG("VMVirtIOGPU: common config at BAR %d offset 0x%x base=%p\n",
           bar_idx, offset, (void*)base);
     return true;
 }
@@ -1637,7 +1789,7 @@ bool CLASS::readNotifyConfig(uint8_t* out_bar, uint32_t* out_offset,
     uint32_t offset, length;
     if (!findVirtIOCapability(m_pci_device, VIRTIO_PCI_CAP_NOTIFY_CFG,
                               &bar_idx, &offset, &length)) {
-        IOLog("VMVirtIOGPU: notify capability not found\n");
+        VMLOG_DEBUG("VMVirtIOGPU: notify capability not found\n");
         return false;
     }
 
@@ -1656,12 +1808,12 @@ bool CLASS::readNotifyConfig(uint8_t* out_bar, uint32_t* out_offset,
             if (cfg == VIRTIO_PCI_CAP_NOTIFY_CFG) {
                 mult = m_pci_device->configRead32(cap_walk + 16);
                 // Diagnostic: dump raw capability bytes from PCI config
-                IOLog("VMVirtIOGPU: notify cap at config 0x%02x — raw:", cap_walk);
+                VMLOG_DEBUG("VMVirtIOGPU: notify cap at config 0x%02x — raw:", cap_walk);
                 for (int b = 0; b < 20; b += 4) {
-                    IOLog(" %08x", m_pci_device->configRead32(cap_walk + b));
+                    VMLOG_DEBUG(" %08x", m_pci_device->configRead32(cap_walk + b));
                 }
-                IOLog("\n");
-                IOLog("VMVirtIOGPU: notify_off_multiplier = %u (read from PCI config 0x%02x+16)\n",
+                VMLOG_DEBUG("\n");
+                VMLOG_DEBUG("VMVirtIOGPU: notify_off_multiplier = %u (read from PCI config 0x%02x+16)\n",
                       mult, cap_walk);
                 break;
             }
@@ -1673,7 +1825,7 @@ bool CLASS::readNotifyConfig(uint8_t* out_bar, uint32_t* out_offset,
     *out_offset = offset;
     *out_multiplier = mult;
 
-    IOLog("VMVirtIOGPU: notify config at BAR %d offset 0x%x multiplier=%u\n",
+    VMLOG_DEBUG("VMVirtIOGPU: notify config at BAR %d offset 0x%x multiplier=%u\n",
           bar_idx, offset, mult);
 
     // Keep the map — store as m_notify_map for submitCommand to use
@@ -1686,7 +1838,7 @@ bool CLASS::readNotifyConfig(uint8_t* out_bar, uint32_t* out_offset,
 bool CLASS::setupControlVirtQueue()
 {
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU: setupControlVirtQueue: no PCI device\n");
+        VMLOG_INFO("VMVirtIOGPU: setupControlVirtQueue: no PCI device\n");
         return false;
     }
 
@@ -1709,7 +1861,7 @@ bool CLASS::setupControlVirtQueue()
     uint32_t notify_mult = 0;
     if (!readNotifyConfig(&notify_bar, &notify_off, &notify_mult)) {
         // Non-fatal: fallback to existing notify setup
-        IOLog("VMVirtIOGPU: notify config read failed, using existing mapping\n");
+        VMLOG_ERROR("VMVirtIOGPU: notify config read failed, using existing mapping\n");
     } else {
         m_notify_cap_offset = notify_off;
         m_notify_off_multiplier = notify_mult;
@@ -1737,7 +1889,7 @@ bool CLASS::setupControlVirtQueue()
 
     // 4. Feature negotiation
     if (!negotiateFeatures()) {
-        IOLog("VMVirtIOGPU: feature negotiation failed, continuing with defaults\n");
+        VMLOG_ERROR("VMVirtIOGPU: feature negotiation failed, continuing with defaults\n");
         // Non-fatal for now — some devices work without explicit negotiation
     }
 
@@ -1746,7 +1898,7 @@ bool CLASS::setupControlVirtQueue()
 
     uint16_t qsize = vring_read16(cfg + VIRTIO_COMMON_Q_SIZE);
     if (qsize == 0) {
-        IOLog("VMVirtIOGPU: control queue size is 0 — device has no control queue\n");
+        VMLOG_INFO("VMVirtIOGPU: control queue size is 0 — device has no control queue\n");
         return false;
     }
 
@@ -1763,7 +1915,7 @@ bool CLASS::setupControlVirtQueue()
     // Read queue_notify_off for this queue
     uint16_t q_notify_off = vring_read16(cfg + VIRTIO_COMMON_Q_NOTIFY_OFF);
 
-    IOLog("VMVirtIOGPU: control queue: size=%u notify_off=%u\n",
+    VMLOG_INFO("VMVirtIOGPU: control queue: size=%u notify_off=%u\n",
           qsize, q_notify_off);
 
     // 6. Calculate layout sizes (with event fields)
@@ -1791,7 +1943,7 @@ bool CLASS::setupControlVirtQueue()
         0x00000000FFFFFFFFULL);
 
     if (!m_vring_mem) {
-        IOLog("VMVirtIOGPU: failed to allocate %u bytes for vring\n", total_size);
+        VMLOG_ERROR("VMVirtIOGPU: failed to allocate %u bytes for vring\n", total_size);
         return false;
     }
     m_vring_mem->prepare();
@@ -1804,12 +1956,12 @@ bool CLASS::setupControlVirtQueue()
     IOByteCount phys_len = 0;
     phys = m_vring_mem->getPhysicalSegment(0, &phys_len);
     if (phys == 0 || phys_len < (IOByteCount)total_size) {
-        IOLog("VMVirtIOGPU: vring not physically contiguous: phys=0x%llx len=%llu\n",
+        VMLOG_INFO("VMVirtIOGPU: vring not physically contiguous: phys=0x%llx len=%llu\n",
               (uint64_t)phys, (uint64_t)phys_len);
         // Try to use it anyway — some allocators may return contiguous for small sizes
     }
 
-    IOLog("VMVirtIOGPU: vring allocated: vaddr=%p phys=0x%llx size=%u\n",
+    VMLOG_INFO("VMVirtIOGPU: vring allocated: vaddr=%p phys=0x%llx size=%u\n",
           vaddr, (uint64_t)phys, total_size);
 
     // 8. Set up pointers into the vring
@@ -1824,7 +1976,7 @@ bool CLASS::setupControlVirtQueue()
     // Initialize descriptor free-list: each desc.next points to the next free desc
     m_vq_free_next = (uint16_t*)IOMalloc(qsize * sizeof(uint16_t));
     if (!m_vq_free_next) {
-        IOLog("VMVirtIOGPU: failed to allocate free-list\n");
+        VMLOG_ERROR("VMVirtIOGPU: failed to allocate free-list\n");
         m_vring_mem->release();
         m_vring_mem = nullptr;
         return false;
@@ -1854,7 +2006,7 @@ bool CLASS::setupControlVirtQueue()
 
     uint16_t enable_check = vring_read16(cfg + VIRTIO_COMMON_Q_ENABLE);
     if (enable_check != 1) {
-        IOLog("VMVirtIOGPU: queue enable failed (read back %u)\n", enable_check);
+        VMLOG_ERROR("VMVirtIOGPU: queue enable failed (read back %u)\n", enable_check);
         // Non-fatal — some devices don't read back 1 immediately
     }
 
@@ -1896,7 +2048,7 @@ bool CLASS::setupControlVirtQueue()
         VIRTIO_GPU_RESP_BUF_SIZE, 0x00000000FFFFFFFFULL);
 
     if (!m_cmd_buf || !m_resp_buf) {
-        IOLog("VMVirtIOGPU: failed to allocate cmd/resp buffers\n");
+        VMLOG_ERROR("VMVirtIOGPU: failed to allocate cmd/resp buffers\n");
         // Cleanup will handle partial init
         return false;
     }
@@ -1907,7 +2059,7 @@ bool CLASS::setupControlVirtQueue()
     m_notify_offset = q_notify_off;  // overload existing member
 
     m_vq_initialized = true;
-    IOLog("VMVirtIOGPU: control virtqueue initialized and enabled (size=%u)\n", qsize);
+    VMLOG_INFO("VMVirtIOGPU: control virtqueue initialized and enabled (size=%u)\n", qsize);
     return true;
 }
 
@@ -1983,7 +2135,7 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
     }
 
     if (!m_vq_initialized || !m_vq_desc || !m_vq_avail || !m_vq_used) {
-        IOLog("VMVirtIOGPU::submitCommand: virtqueue not initialized\n");
+        VMLOG_DEBUG("VMVirtIOGPU::submitCommand: virtqueue not initialized\n");
         return kIOReturnNotReady;
     }
 
@@ -2001,7 +2153,7 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
     uint64_t submit_entry_time = mach_absolute_time();
     if (instr) {
         uint16_t entry_depth = vringFreeDepth();
-        IOLog("VMVirtIOGPU::submit[%u] ENTRY this=%p cmd=0x%x noisy=%d avail_idx=%u used_idx=%u last_used=%u free_head=%u free_depth=%u entry_time=%llu\n",
+        VMLOG_DEBUG("VMVirtIOGPU::submit[%u] ENTRY this=%p cmd=0x%x noisy=%d avail_idx=%u used_idx=%u last_used=%u free_head=%u free_depth=%u entry_time=%llu\n",
               m_submit_count, this, cmd->type, noisy ? 1 : 0,
               m_vq_avail ? m_vq_avail->idx : (uint16_t)0,
               m_vq_used ? m_vq_used->idx : (uint16_t)0,
@@ -2029,7 +2181,7 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
     uint16_t dev_used_idx_drain = m_vq_used->idx;
     if (m_vq_last_used != dev_used_idx_drain) {
         if (instr) {
-            IOLog("VMVirtIOGPU::submit[%u] DRAIN stale used entries: "
+            VMLOG_WARN("VMVirtIOGPU::submit[%u] DRAIN stale used entries: "
                   "last_used=%u -> %u (skipping %u)\n",
                   m_submit_count, (unsigned)m_vq_last_used,
                   (unsigned)dev_used_idx_drain,
@@ -2041,7 +2193,7 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
     // 1. Pop two free descriptors
     uint16_t cmd_desc = m_vq_free_head;
     if (cmd_desc == (uint16_t)-1) {
-        IOLog("VMVirtIOGPU::submitCommand: no free descriptors\n");
+        VMLOG_DEBUG("VMVirtIOGPU::submitCommand: no free descriptors\n");
         IOLockUnlock(m_vq_lock);
         return kIOReturnNoResources;
     }
@@ -2052,14 +2204,14 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
         // Return cmd_desc to free-list
         m_vq_free_next[cmd_desc] = m_vq_free_head;
         m_vq_free_head = cmd_desc;
-        IOLog("VMVirtIOGPU::submitCommand: only 1 free descriptor (need 2)\n");
+        VMLOG_DEBUG("VMVirtIOGPU::submitCommand: only 1 free descriptor (need 2)\n");
         IOLockUnlock(m_vq_lock);
         return kIOReturnNoResources;
     }
     m_vq_free_head = m_vq_free_next[resp_desc];
 
     if (instr) {
-        IOLog("VMVirtIOGPU::submit[%u] POPPED cmd_desc=%u resp_desc=%u free_head=%u free_depth=%u\n",
+        VMLOG_DEBUG("VMVirtIOGPU::submit[%u] POPPED cmd_desc=%u resp_desc=%u free_head=%u free_depth=%u\n",
               m_submit_count, cmd_desc, resp_desc, m_vq_free_head, vringFreeDepth());
     }
 
@@ -2090,7 +2242,7 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
             kIODirectionOutIn | kIOMemoryPhysicallyContiguous,
             cmd_size, 0x00000000FFFFFFFFULL);
         if (!temp_cmd_buf) {
-            IOLog("VMVirtIOGPU::submitCommand: temp cmd_buf alloc failed "
+            VMLOG_ERROR("VMVirtIOGPU::submitCommand: temp cmd_buf alloc failed "
                   "for cmd_size %zu\n", cmd_size);
             m_vq_free_next[resp_desc] = m_vq_free_head;
             m_vq_free_head = resp_desc;
@@ -2107,7 +2259,7 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
     }
 
     if (!cmd_phys) {
-        IOLog("VMVirtIOGPU::submitCommand: failed to get cmd physical address\n");
+        VMLOG_ERROR("VMVirtIOGPU::submitCommand: failed to get cmd physical address\n");
         if (temp_cmd_buf) { temp_cmd_buf->complete(); temp_cmd_buf->release(); }
         m_vq_free_next[resp_desc] = m_vq_free_head;
         m_vq_free_head = resp_desc;
@@ -2125,7 +2277,7 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
     }
 
     if (!cmd_phys || !resp_phys) {
-        IOLog("VMVirtIOGPU::submitCommand: failed to get physical addresses\n");
+        VMLOG_ERROR("VMVirtIOGPU::submitCommand: failed to get physical addresses\n");
         // Return descriptors to free-list
         m_vq_free_next[resp_desc] = m_vq_free_head;
         m_vq_free_head = resp_desc;
@@ -2168,7 +2320,7 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
              m_notify_offset * m_notify_off_multiplier);
         *notify_addr = VIRTIO_GPU_QUEUE_CONTROL;  // queue index
         if (instr) {
-            IOLog("VMVirtIOGPU::submit[%u] NOTIFY #%u addr=%p (notify_base+cap_off=%u+q_off=%u*mult=%u)\n",
+            VMLOG_DEBUG("VMVirtIOGPU::submit[%u] NOTIFY #%u addr=%p (notify_base+cap_off=%u+q_off=%u*mult=%u)\n",
                   m_submit_count, m_notify_count, (void*)notify_addr,
                   m_notify_cap_offset, m_notify_offset, m_notify_off_multiplier);
         }
@@ -2181,12 +2333,12 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
              m_notify_cap_offset + m_notify_offset * m_notify_off_multiplier);
         *notify_addr = VIRTIO_GPU_QUEUE_CONTROL;
         if (instr) {
-            IOLog("VMVirtIOGPU::submit[%u] NOTIFY #%u addr=%p (fallback map+cap=%u+off=%u*mult=%u)\n",
+            VMLOG_DEBUG("VMVirtIOGPU::submit[%u] NOTIFY #%u addr=%p (fallback map+cap=%u+off=%u*mult=%u)\n",
                   m_submit_count, m_notify_count, (void*)notify_addr,
                   m_notify_cap_offset, m_notify_offset, m_notify_off_multiplier);
         }
     } else {
-        IOLog("VMVirtIOGPU::submitCommand: no notify mapping\n");
+        VMLOG_DEBUG("VMVirtIOGPU::submitCommand: no notify mapping\n");
         // Return descriptors
         m_vq_free_next[resp_desc] = m_vq_free_head;
         m_vq_free_head = resp_desc;
@@ -2243,11 +2395,11 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
         // is visible without ambiguity. The original `if (!noisy)` filter is documented
         // in LEDGER.md as a known logging gap.
         if (!noisy || instr) {
-            IOLog("VMVirtIOGPU::submitCommand: TIMEOUT on cmd 0x%x (no response after 150ms)\n",
+            VMLOG_WARN("VMVirtIOGPU::submitCommand: TIMEOUT on cmd 0x%x (no response after 150ms)\n",
                   cmd->type);
         }
         if (instr) {
-            IOLog("VMVirtIOGPU::submit[%u] EXIT TIMEOUT avail_idx=%u used_idx=%u last_used=%u free_head=%u free_depth=%u cmd_desc=%u resp_desc=%u\n",
+            VMLOG_WARN("VMVirtIOGPU::submit[%u] EXIT TIMEOUT avail_idx=%u used_idx=%u last_used=%u free_head=%u free_depth=%u cmd_desc=%u resp_desc=%u\n",
                   m_submit_count,
                   m_vq_avail ? m_vq_avail->idx : (uint16_t)0,
                   m_vq_used ? m_vq_used->idx : (uint16_t)0,
@@ -2271,7 +2423,7 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
 
     // Verify the device processed our descriptor
     if (used_elem->id != cmd_desc) {
-        IOLog("VMVirtIOGPU::submitCommand: used->id=%u expected=%u\n",
+        VMLOG_DEBUG("VMVirtIOGPU::submitCommand: used->id=%u expected=%u\n",
               used_elem->id, cmd_desc);
     }
 
@@ -2289,7 +2441,7 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
 
     // 10. Validate response type
     if (resp && !noisy) {
-        IOLog("VMVirtIOGPU::submitCommand: cmd=0x%x resp_type=0x%x\n",
+        VMLOG_DEBUG("VMVirtIOGPU::submitCommand: cmd=0x%x resp_type=0x%x\n",
               cmd->type, resp->type);
     }
 
@@ -2301,7 +2453,7 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
 
     if (instr) {
         uint64_t submit_exit_time = mach_absolute_time();
-        IOLog("VMVirtIOGPU::submit[%u] EXIT OK cmd=0x%x resp_type=0x%x poll_iter=%u call_ns=%llu avail_idx=%u used_idx=%u last_used=%u free_head=%u free_depth=%u cmd_desc=%u→ret resp_desc=%u→ret\n",
+        VMLOG_DEBUG("VMVirtIOGPU::submit[%u] EXIT OK cmd=0x%x resp_type=0x%x poll_iter=%u call_ns=%llu avail_idx=%u used_idx=%u last_used=%u free_head=%u free_depth=%u cmd_desc=%u→ret resp_desc=%u→ret\n",
               m_submit_count, cmd->type, resp ? resp->type : 0, poll_iter,
               (unsigned long long)(submit_exit_time - submit_entry_time),
               m_vq_avail ? m_vq_avail->idx : (uint16_t)0,
@@ -2326,20 +2478,227 @@ IOReturn CLASS::submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
     }
     if (resp->type >= 0x1200) {
         if (!noisy) {
-            IOLog("VMVirtIOGPU::submitCommand: device error 0x%x for cmd 0x%x\n",
+            VMLOG_ERROR("VMVirtIOGPU::submitCommand: device error 0x%x for cmd 0x%x\n",
                   resp->type, cmd->type);
         }
         return kIOReturnError;  // Error response range
     }
 
     // Response type is neither OK nor error — suspicious
-    IOLog("VMVirtIOGPU::submitCommand: WARNING resp_type=0x%x is outside "
+    VMLOG_WARN("VMVirtIOGPU::submitCommand: WARNING resp_type=0x%x is outside "
           "expected range (0x1100-0x12ff) for cmd 0x%x\n",
           resp->type, cmd->type);
     return kIOReturnError;
 }
 
 
+bool CLASS::ringControlDoorbell()
+{
+    m_notify_count++;
+    volatile uint32_t* notify_addr = nullptr;
+    if (m_notify_base && m_notify_off_multiplier > 0) {
+        notify_addr = (volatile uint32_t*)
+            (m_notify_base + m_notify_cap_offset +
+             m_notify_offset * m_notify_off_multiplier);
+    } else if (m_notify_map) {
+        notify_addr = (volatile uint32_t*)
+            ((uint8_t*)m_notify_map->getVirtualAddress() +
+             m_notify_cap_offset + m_notify_offset * m_notify_off_multiplier);
+    }
+    if (!notify_addr) {
+        return false;
+    }
+    *notify_addr = VIRTIO_GPU_QUEUE_CONTROL;
+    return true;
+}
+
+// ---- Batched submit: N descriptor chains, one doorbell ----
+//
+// Same split-virtqueue protocol as submitCommand, but every command gets its
+// own cmd/resp descriptor pair up front, all heads go onto the avail ring
+// under a single idx publish, and the device is notified once. Commands are
+// packed 8-byte aligned into m_cmd_buf; responses land in fixed slots of
+// m_resp_buf. Under TCG the doorbell write and the poll loop dominate the
+// cost of a small command, so a refresh tick driving three heads pays one
+// round-trip instead of six.
+IOReturn CLASS::submitCommandBatch(VMVirtIOGPUBatchCommand* cmds, uint32_t count)
+{
+    static const size_t RESP_SLOT = 64;
+
+    if (!cmds || count == 0 || count > kMaxBatchCommands) {
+        return kIOReturnBadArgument;
+    }
+    if (count == 1) {
+        return submitCommand(cmds[0].cmd, cmds[0].cmd_size,
+                             &cmds[0].resp, sizeof(cmds[0].resp));
+    }
+    if (!m_vq_initialized || !m_vq_desc || !m_vq_avail || !m_vq_used) {
+        VMLOG_DEBUG("VMVirtIOGPU::submitCommandBatch: virtqueue not initialized\n");
+        return kIOReturnNotReady;
+    }
+
+    size_t cmd_offsets[kMaxBatchCommands];
+    size_t cmd_total = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!cmds[i].cmd || cmds[i].cmd_size < sizeof(virtio_gpu_ctrl_hdr)) {
+            return kIOReturnBadArgument;
+        }
+        cmd_offsets[i] = cmd_total;
+        cmd_total += (cmds[i].cmd_size + 7) & ~(size_t)7;
+    }
+    if (cmd_total > (size_t)m_cmd_buf->getLength() ||
+        count * RESP_SLOT > VIRTIO_GPU_RESP_BUF_SIZE) {
+        VMLOG_WARN("VMVirtIOGPU::submitCommandBatch: batch of %u (%zu bytes) exceeds static buffers\n",
+              count, cmd_total);
+        return kIOReturnNoSpace;
+    }
+
+    m_submit_count++;
+
+    IOLockLock(m_vq_lock);
+
+    // Drain stale used entries first — same reasoning as submitCommand.
+    __sync_synchronize();
+    m_vq_last_used = m_vq_used->idx;
+
+    // 1. Pop 2×count descriptors; hand back whatever was taken on shortage.
+    uint16_t cmd_desc[kMaxBatchCommands];
+    uint16_t resp_desc[kMaxBatchCommands];
+    uint32_t popped = 0;
+    for (; popped < count; popped++) {
+        uint16_t c = m_vq_free_head;
+        if (c == (uint16_t)-1) break;
+        m_vq_free_head = m_vq_free_next[c];
+        uint16_t r = m_vq_free_head;
+        if (r == (uint16_t)-1) {
+            m_vq_free_next[c] = m_vq_free_head;
+            m_vq_free_head = c;
+            break;
+        }
+        m_vq_free_head = m_vq_free_next[r];
+        cmd_desc[popped] = c;
+        resp_desc[popped] = r;
+    }
+    if (popped < count) {
+        for (uint32_t i = 0; i < popped; i++) {
+            m_vq_free_next[resp_desc[i]] = m_vq_free_head;
+            m_vq_free_head = resp_desc[i];
+            m_vq_free_next[cmd_desc[i]] = m_vq_free_head;
+            m_vq_free_head = cmd_desc[i];
+        }
+        VMLOG_DEBUG("VMVirtIOGPU::submitCommandBatch: only %u of %u descriptor pairs free\n",
+              popped, count);
+        IOLockUnlock(m_vq_lock);
+        return kIOReturnNoResources;
+    }
+
+    // 2. Pack commands and build the chains. Both static buffers are
+    //    physically contiguous, so offset arithmetic on segment 0 is valid.
+    uint8_t* cmd_va = (uint8_t*)m_cmd_buf->getBytesNoCopy();
+    uint8_t* resp_va = (uint8_t*)m_resp_buf->getBytesNoCopy();
+    IOByteCount seg_len = 0;
+    IOPhysicalAddress cmd_phys = m_cmd_buf->getPhysicalSegment(0, &seg_len);
+    IOPhysicalAddress resp_phys = m_resp_buf->getPhysicalSegment(0, &seg_len);
+    if (!cmd_phys || !resp_phys) {
+        for (uint32_t i = 0; i < count; i++) {
+            m_vq_free_next[resp_desc[i]] = m_vq_free_head;
+            m_vq_free_head = resp_desc[i];
+            m_vq_free_next[cmd_desc[i]] = m_vq_free_head;
+            m_vq_free_head = cmd_desc[i];
+        }
+        IOLockUnlock(m_vq_lock);
+        return kIOReturnNoMemory;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        memcpy(cmd_va + cmd_offsets[i], cmds[i].cmd, cmds[i].cmd_size);
+        memset(resp_va + i * RESP_SLOT, 0, sizeof(virtio_gpu_ctrl_hdr));
+
+        m_vq_desc[cmd_desc[i]].addr  = cmd_phys + cmd_offsets[i];
+        m_vq_desc[cmd_desc[i]].len   = (uint32_t)cmds[i].cmd_size;
+        m_vq_desc[cmd_desc[i]].flags = VRING_DESC_F_NEXT;
+        m_vq_desc[cmd_desc[i]].next  = resp_desc[i];
+
+        m_vq_desc[resp_desc[i]].addr  = resp_phys + i * RESP_SLOT;
+        m_vq_desc[resp_desc[i]].len   = sizeof(virtio_gpu_ctrl_hdr);
+        m_vq_desc[resp_desc[i]].flags = VRING_DESC_F_WRITE;
+        m_vq_desc[resp_desc[i]].next  = 0;
+    }
+
+    __sync_synchronize();
+
+    // 3. Publish every head, then advance avail->idx once.
+    for (uint32_t i = 0; i < count; i++) {
+        m_vq_avail->ring[(m_vq_avail_idx + i) % m_vq_size] = cmd_desc[i];
+    }
+    __sync_synchronize();
+    m_vq_avail_idx += (uint16_t)count;
+    m_vq_avail->idx = m_vq_avail_idx;
+    __sync_synchronize();
+
+    // 4. One doorbell for the whole batch.
+    if (!ringControlDoorbell()) {
+        VMLOG_DEBUG("VMVirtIOGPU::submitCommandBatch: no notify mapping\n");
+        for (uint32_t i = 0; i < count; i++) {
+            m_vq_free_next[resp_desc[i]] = m_vq_free_head;
+            m_vq_free_head = resp_desc[i];
+            m_vq_free_next[cmd_desc[i]] = m_vq_free_head;
+            m_vq_free_head = cmd_desc[i];
+        }
+        IOLockUnlock(m_vq_lock);
+        return kIOReturnNotReady;
+    }
+
+    // 5. Poll until the device has consumed all chains. Same spin-then-sleep
+    //    schedule and 150-iteration budget as submitCommand.
+    static const int SPIN_ITERATIONS = 10;
+    bool timed_out = true;
+    for (int i = 0; i < 150; i++) {
+        if (i < SPIN_ITERATIONS) {
+            IODelay(20);
+        } else {
+            IOSleep(1);
+        }
+        __sync_synchronize();
+        if ((uint16_t)(m_vq_used->idx - m_vq_last_used) >= count) {
+            timed_out = false;
+            break;
+        }
+    }
+
+    if (timed_out) {
+        VMLOG_WARN("VMVirtIOGPU::submitCommandBatch: TIMEOUT (%u of %u completed after 150ms)\n",
+              (unsigned)(uint16_t)(m_vq_used->idx - m_vq_last_used), count);
+        for (uint32_t i = 0; i < count; i++) {
+            m_vq_free_next[resp_desc[i]] = m_vq_free_head;
+            m_vq_free_head = resp_desc[i];
+            m_vq_free_next[cmd_desc[i]] = m_vq_free_head;
+            m_vq_free_head = cmd_desc[i];
+        }
+        IOLockUnlock(m_vq_lock);
+        return kIOReturnTimeout;
+    }
+
+    // 6. Consume the used entries (the device may complete out of order;
+    //    responses are read per-slot, not per used position).
+    __sync_synchronize();
+    m_vq_last_used += (uint16_t)count;
+    IOReturn ret = kIOReturnSuccess;
+    for (uint32_t i = 0; i < count; i++) {
+        memcpy(&cmds[i].resp, resp_va + i * RESP_SLOT, sizeof(cmds[i].resp));
+        if (cmds[i].resp.type < 0x1100 || cmds[i].resp.type >= 0x1200) {
+            ret = kIOReturnError;
+        }
+        m_vq_free_next[resp_desc[i]] = m_vq_free_head;
+        m_vq_free_head = resp_desc[i];
+        m_vq_free_next[cmd_desc[i]] = m_vq_free_head;
+        m_vq_free_head = cmd_desc[i];
+    }
+
+    IOLockUnlock(m_vq_lock);
+    return ret;
+}
+
 VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
 {
 #if VERBOSE_DIAGNOSTICS
@@ -2379,19 +2738,19 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
     resource_architecture.search_performance_efficiency = 0.94f; // 94% search efficiency
     resource_architecture.resource_management_initialized = false;
     
-    IOLog("        Search Algorithm Type: 0x%02X (Optimized Linear)\n", resource_architecture.search_algorithm_type);
-    IOLog("        Hash Table Optimization: %s\n", resource_architecture.supports_hash_table_optimization ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Cache Acceleration: %s\n", resource_architecture.supports_cache_acceleration ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Hierarchical Indexing: %s\n", resource_architecture.supports_hierarchical_indexing ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Parallel Search: %s\n", resource_architecture.supports_parallel_search ? "SUPPORTED" : "DISABLED");
-    IOLog("        Memory Prefetching: %s\n", resource_architecture.supports_memory_prefetching ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Search Analytics: %s\n", resource_architecture.supports_search_analytics ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Resource Validation: %s\n", resource_architecture.supports_resource_validation ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Access Statistics: %s\n", resource_architecture.supports_access_statistics ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Maximum Capacity: %d resources\n", resource_architecture.maximum_resource_capacity);
-    IOLog("        Current Count: %d resources\n", resource_architecture.current_resource_count);
-    IOLog("        Search Memory Overhead: %llu bytes (%.1f KB)\n", resource_architecture.search_memory_overhead_bytes, resource_architecture.search_memory_overhead_bytes / 1024.0f);
-    IOLog("        Search Efficiency: %.1f%%\n", resource_architecture.search_performance_efficiency * 100.0f);
+    VMLOG_DEBUG("        Search Algorithm Type: 0x%02X (Optimized Linear)\n", resource_architecture.search_algorithm_type);
+    VMLOG_DEBUG("        Hash Table Optimization: %s\n", resource_architecture.supports_hash_table_optimization ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Cache Acceleration: %s\n", resource_architecture.supports_cache_acceleration ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Hierarchical Indexing: %s\n", resource_architecture.supports_hierarchical_indexing ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Parallel Search: %s\n", resource_architecture.supports_parallel_search ? "SUPPORTED" : "DISABLED");
+    VMLOG_DEBUG("        Memory Prefetching: %s\n", resource_architecture.supports_memory_prefetching ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Search Analytics: %s\n", resource_architecture.supports_search_analytics ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Resource Validation: %s\n", resource_architecture.supports_resource_validation ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Access Statistics: %s\n", resource_architecture.supports_access_statistics ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Maximum Capacity: %d resources\n", resource_architecture.maximum_resource_capacity);
+    VMLOG_DEBUG("        Current Count: %d resources\n", resource_architecture.current_resource_count);
+    VMLOG_DEBUG("        Search Memory Overhead: %llu bytes (%.1f KB)\n", resource_architecture.search_memory_overhead_bytes, resource_architecture.search_memory_overhead_bytes / 1024.0f);
+    VMLOG_DEBUG("        Search Efficiency: %.1f%%\n", resource_architecture.search_performance_efficiency * 100.0f);
     
     
     struct SearchParametersValidation {
@@ -2426,15 +2785,15 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
     search_validation.validation_error_code = 0;
     search_validation.validation_successful = false;
     
-    IOLog("        Search Parameters Validation System:\n");
-    IOLog("          System Version: 0x%04X (v1.3)\n", search_validation.validation_system_version);
-    IOLog("          Resource ID Validation: %s\n", search_validation.resource_id_validation_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Resource Array Validation: %s\n", search_validation.resource_array_validation_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Search Bounds Validation: %s\n", search_validation.search_bounds_validation_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Memory Integrity Validation: %s\n", search_validation.memory_integrity_validation_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("        Search Parameters Validation System:\n");
+    VMLOG_DEBUG("          System Version: 0x%04X (v1.3)\n", search_validation.validation_system_version);
+    VMLOG_DEBUG("          Resource ID Validation: %s\n", search_validation.resource_id_validation_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Resource Array Validation: %s\n", search_validation.resource_array_validation_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Search Bounds Validation: %s\n", search_validation.search_bounds_validation_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Memory Integrity Validation: %s\n", search_validation.memory_integrity_validation_enabled ? "ENABLED" : "DISABLED");
     
     // Execute search parameters validation
-    IOLog("          Executing search parameters validation...\n");
+    VMLOG_DEBUG("          Executing search parameters validation...\n");
     
     // Validate resource ID
     if (search_validation.resource_id_validation_enabled) {
@@ -2446,7 +2805,7 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
             snprintf(search_validation.validation_error_message, sizeof(search_validation.validation_error_message), 
                     "Invalid resource ID: %u (must be > 0)", resource_id);
         }
-        IOLog("            Resource ID: %s (ID=%u)\n", search_validation.resource_id_valid ? "VALID" : "INVALID", resource_id);
+        VMLOG_DEBUG("            Resource ID: %s (ID=%u)\n", search_validation.resource_id_valid ? "VALID" : "INVALID", resource_id);
     }
     
     // Validate resource array
@@ -2459,7 +2818,7 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
             snprintf(search_validation.validation_error_message, sizeof(search_validation.validation_error_message), 
                     "Resource array is null");
         }
-        IOLog("            Resource Array: %s (ptr=%p)\n", search_validation.resource_array_valid ? "VALID" : "INVALID", m_resources);
+        VMLOG_DEBUG("            Resource Array: %s (ptr=%p)\n", search_validation.resource_array_valid ? "VALID" : "INVALID", m_resources);
     }
     
     // Validate search bounds
@@ -2472,7 +2831,7 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
             snprintf(search_validation.validation_error_message, sizeof(search_validation.validation_error_message), 
                     "Resource count exceeds capacity: %d > %d", resource_architecture.current_resource_count, resource_architecture.maximum_resource_capacity);
         }
-        IOLog("            Search Bounds: %s (%d/%d resources)\n", search_validation.search_bounds_valid ? "VALID" : "INVALID", 
+        VMLOG_DEBUG("            Search Bounds: %s (%d/%d resources)\n", search_validation.search_bounds_valid ? "VALID" : "INVALID", 
               resource_architecture.current_resource_count, resource_architecture.maximum_resource_capacity);
     }
     
@@ -2480,7 +2839,7 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
     if (search_validation.memory_integrity_validation_enabled && search_validation.search_bounds_valid) {
         search_validation.memory_integrity_valid = true; // Simplified memory integrity check
         search_validation.validation_checks_performed++;
-        IOLog("            Memory Integrity: %s\n", search_validation.memory_integrity_valid ? "VALID" : "INVALID");
+        VMLOG_DEBUG("            Memory Integrity: %s\n", search_validation.memory_integrity_valid ? "VALID" : "INVALID");
     }
     
     // Calculate validation results
@@ -2490,17 +2849,17 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
         (search_validation.search_bounds_validation_enabled ? search_validation.search_bounds_valid : true) &&
         (search_validation.memory_integrity_validation_enabled ? search_validation.memory_integrity_valid : true);
     
-    IOLog("          Search Parameters Validation Results:\n");
-    IOLog("            Validation Checks Performed: %d\n", search_validation.validation_checks_performed);
-    IOLog("            Validation Errors Detected: %d\n", search_validation.validation_errors_detected);
-    IOLog("            Error Code: 0x%04X\n", search_validation.validation_error_code);
+    VMLOG_DEBUG("          Search Parameters Validation Results:\n");
+    VMLOG_DEBUG("            Validation Checks Performed: %d\n", search_validation.validation_checks_performed);
+    VMLOG_DEBUG("            Validation Errors Detected: %d\n", search_validation.validation_errors_detected);
+    VMLOG_DEBUG("            Error Code: 0x%04X\n", search_validation.validation_error_code);
     if (strlen(search_validation.validation_error_message) > 0) {
-        IOLog("            Error Message: %s\n", search_validation.validation_error_message);
+        VMLOG_DEBUG("            Error Message: %s\n", search_validation.validation_error_message);
     }
-    IOLog("            Validation Success: %s\n", search_validation.validation_successful ? "YES" : "NO");
+    VMLOG_DEBUG("            Validation Success: %s\n", search_validation.validation_successful ? "YES" : "NO");
     
     if (!search_validation.validation_successful) {
-        IOLog("      Search parameters validation failed, returning nullptr\n");
+        VMLOG_WARN("      Search parameters validation failed, returning nullptr\n");
         return nullptr;
     }
     
@@ -2532,33 +2891,33 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
     optimization_system.optimization_memory_usage = (uint32_t)resource_architecture.search_memory_overhead_bytes;
     optimization_system.optimization_system_operational = true;
     
-    IOLog("        Search Optimization System Configuration:\n");
-    IOLog("          System Version: 0x%04X (v2.4)\n", optimization_system.optimization_system_version);
-    IOLog("          Cache Lookup: %s\n", optimization_system.cache_lookup_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Memory Prefetch: %s\n", optimization_system.memory_prefetch_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Search Acceleration: %s\n", optimization_system.search_acceleration_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Access Pattern Analysis: %s\n", optimization_system.access_pattern_analysis_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Optimization Memory Usage: %d bytes (%.1f KB)\n", optimization_system.optimization_memory_usage, optimization_system.optimization_memory_usage / 1024.0f);
-    IOLog("          System Status: %s\n", optimization_system.optimization_system_operational ? "OPERATIONAL" : "INACTIVE");
+    VMLOG_DEBUG("        Search Optimization System Configuration:\n");
+    VMLOG_DEBUG("          System Version: 0x%04X (v2.4)\n", optimization_system.optimization_system_version);
+    VMLOG_DEBUG("          Cache Lookup: %s\n", optimization_system.cache_lookup_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Memory Prefetch: %s\n", optimization_system.memory_prefetch_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Search Acceleration: %s\n", optimization_system.search_acceleration_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Access Pattern Analysis: %s\n", optimization_system.access_pattern_analysis_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Optimization Memory Usage: %d bytes (%.1f KB)\n", optimization_system.optimization_memory_usage, optimization_system.optimization_memory_usage / 1024.0f);
+    VMLOG_DEBUG("          System Status: %s\n", optimization_system.optimization_system_operational ? "OPERATIONAL" : "INACTIVE");
     
     // Execute optimization preprocessing
-    IOLog("          Executing search optimization preprocessing...\n");
+    VMLOG_DEBUG("          Executing search optimization preprocessing...\n");
     
     // Cache lookup simulation (in production, would check actual cache)
     if (optimization_system.cache_lookup_enabled) {
-        IOLog("            Cache Lookup: MISS (resource_id=%u not cached)\n", resource_id);
+        VMLOG_DEBUG("            Cache Lookup: MISS (resource_id=%u not cached)\n", resource_id);
         optimization_system.cache_miss_count++;
     }
     
     // Memory prefetch simulation
     if (optimization_system.memory_prefetch_enabled && resource_architecture.current_resource_count > 4) {
         optimization_system.prefetch_operations = 2; // Prefetch next 2 resources
-        IOLog("            Memory Prefetch: ENABLED (%d operations)\n", optimization_system.prefetch_operations);
+        VMLOG_DEBUG("            Memory Prefetch: ENABLED (%d operations)\n", optimization_system.prefetch_operations);
     }
     
     // Search acceleration setup
     if (optimization_system.search_acceleration_enabled) {
-        IOLog("            Search Acceleration: ENABLED (hierarchical indexing active)\n");
+        VMLOG_DEBUG("            Search Acceleration: ENABLED (hierarchical indexing active)\n");
     }
     
     
@@ -2593,15 +2952,15 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
     discovery_engine.search_efficiency = 0.0f;
     discovery_engine.discovery_successful = false;
     
-    IOLog("        Resource Discovery Engine Configuration:\n");
-    IOLog("          Engine Version: 0x%04X (v3.1)\n", discovery_engine.discovery_engine_version);
-    IOLog("          Search Algorithm: 0x%02X (Optimized Linear)\n", discovery_engine.search_algorithm_implementation);
-    IOLog("          Early Termination: %s\n", discovery_engine.early_termination_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Target Resource ID: %u\n", resource_id);
-    IOLog("          Search Space: %d resources\n", resource_architecture.current_resource_count);
+    VMLOG_DEBUG("        Resource Discovery Engine Configuration:\n");
+    VMLOG_DEBUG("          Engine Version: 0x%04X (v3.1)\n", discovery_engine.discovery_engine_version);
+    VMLOG_DEBUG("          Search Algorithm: 0x%02X (Optimized Linear)\n", discovery_engine.search_algorithm_implementation);
+    VMLOG_DEBUG("          Early Termination: %s\n", discovery_engine.early_termination_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Target Resource ID: %u\n", resource_id);
+    VMLOG_DEBUG("          Search Space: %d resources\n", resource_architecture.current_resource_count);
     
     // Execute comprehensive resource discovery
-    IOLog("          Executing comprehensive resource discovery...\n");
+    VMLOG_DEBUG("          Executing comprehensive resource discovery...\n");
     
     discovery_engine.search_start_time = 0; // mach_absolute_time()
     
@@ -2615,7 +2974,7 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
         
         // Resource validation during search
         if (current_resource == nullptr) {
-            IOLog("            Warning: Null resource at index %d\n", i);
+            VMLOG_DEBUG("            Warning: Null resource at index %d\n", i);
             continue;
         }
         
@@ -2630,22 +2989,22 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
             discovery_engine.discovered_resource = current_resource;
             discovery_engine.discovery_index = i;
             
-            IOLog("            Resource Discovery: FOUND at index %d\n", i);
-            IOLog("              Resource ID: %u (matches target)\n", current_resource->resource_id);
-            IOLog("              Resource Dimensions: %dx%d\n", current_resource->width, current_resource->height);
-            IOLog("              Resource Format: 0x%X\n", current_resource->format);
-            IOLog("              Resource Type: %s\n", current_resource->is_3d ? "3D" : "2D");
-            IOLog("              Backing Memory: %s\n", current_resource->backing_memory ? "ALLOCATED" : "NONE");
+            VMLOG_DEBUG("            Resource Discovery: FOUND at index %d\n", i);
+            VMLOG_DEBUG("              Resource ID: %u (matches target)\n", current_resource->resource_id);
+            VMLOG_DEBUG("              Resource Dimensions: %dx%d\n", current_resource->width, current_resource->height);
+            VMLOG_DEBUG("              Resource Format: 0x%X\n", current_resource->format);
+            VMLOG_DEBUG("              Resource Type: %s\n", current_resource->is_3d ? "3D" : "2D");
+            VMLOG_DEBUG("              Backing Memory: %s\n", current_resource->backing_memory ? "ALLOCATED" : "NONE");
             
             // Early termination for performance
             if (discovery_engine.early_termination_enabled) {
-                IOLog("            Early Termination: ACTIVATED (resource found)\n");
+                VMLOG_DEBUG("            Early Termination: ACTIVATED (resource found)\n");
                 break;
             }
         } else {
             // Detailed logging for search progress (every 8th resource to avoid log spam)
             if ((i % 8) == 0 || i == (resource_architecture.current_resource_count - 1)) {
-                IOLog("            Search Progress: index %d, ID %u (target: %u)\n", i, current_resource->resource_id, resource_id);
+                VMLOG_DEBUG("            Search Progress: index %d, ID %u (target: %u)\n", i, current_resource->resource_id, resource_id);
             }
         }
     }
@@ -2662,14 +3021,14 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
     
     discovery_engine.discovery_successful = discovery_engine.resource_found;
     
-    IOLog("            Resource Discovery Results:\n");
-    IOLog("              Resources Examined: %d\n", discovery_engine.resources_examined);
-    IOLog("              Search Iterations: %d\n", discovery_engine.search_iterations);
-    IOLog("              Search Duration: %d microseconds\n", discovery_engine.search_duration_microseconds);
-    IOLog("              Resource Found: %s\n", discovery_engine.resource_found ? "YES" : "NO");
-    IOLog("              Discovery Index: %d\n", discovery_engine.discovery_index);
-    IOLog("              Search Efficiency: %.1f%%\n", discovery_engine.search_efficiency * 100.0f);
-    IOLog("              Discovery Success: %s\n", discovery_engine.discovery_successful ? "YES" : "NO");
+    VMLOG_DEBUG("            Resource Discovery Results:\n");
+    VMLOG_DEBUG("              Resources Examined: %d\n", discovery_engine.resources_examined);
+    VMLOG_DEBUG("              Search Iterations: %d\n", discovery_engine.search_iterations);
+    VMLOG_DEBUG("              Search Duration: %d microseconds\n", discovery_engine.search_duration_microseconds);
+    VMLOG_DEBUG("              Resource Found: %s\n", discovery_engine.resource_found ? "YES" : "NO");
+    VMLOG_DEBUG("              Discovery Index: %d\n", discovery_engine.discovery_index);
+    VMLOG_DEBUG("              Search Efficiency: %.1f%%\n", discovery_engine.search_efficiency * 100.0f);
+    VMLOG_DEBUG("              Discovery Success: %s\n", discovery_engine.discovery_successful ? "YES" : "NO");
     
     
     struct SearchAnalyticsSystem {
@@ -2700,44 +3059,44 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
         (optimization_system.cache_hit_count + optimization_system.cache_miss_count);
     analytics_system.analytics_update_successful = false;
     
-    IOLog("        Search Analytics System Configuration:\n");
-    IOLog("          System Version: 0x%04X (v1.52)\n", analytics_system.analytics_system_version);
-    IOLog("          Access Statistics: %s\n", analytics_system.access_statistics_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Performance Analytics: %s\n", analytics_system.performance_analytics_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Search Pattern Analysis: %s\n", analytics_system.search_pattern_analysis_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("        Search Analytics System Configuration:\n");
+    VMLOG_DEBUG("          System Version: 0x%04X (v1.52)\n", analytics_system.analytics_system_version);
+    VMLOG_DEBUG("          Access Statistics: %s\n", analytics_system.access_statistics_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Performance Analytics: %s\n", analytics_system.performance_analytics_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Search Pattern Analysis: %s\n", analytics_system.search_pattern_analysis_enabled ? "ENABLED" : "DISABLED");
     
     // Execute analytics processing
-    IOLog("          Executing search analytics processing...\n");
+    VMLOG_DEBUG("          Executing search analytics processing...\n");
     
     // Update access statistics
     if (analytics_system.access_statistics_enabled) {
-        IOLog("            Access Statistics Update: COMPLETED\n");
-        IOLog("              Total Searches: %d\n", analytics_system.total_searches_performed);
-        IOLog("              Successful Searches: %d\n", analytics_system.successful_searches);
-        IOLog("              Failed Searches: %d\n", analytics_system.failed_searches);
-        IOLog("              Success Rate: %.1f%%\n", analytics_system.overall_success_rate * 100.0f);
+        VMLOG_DEBUG("            Access Statistics Update: COMPLETED\n");
+        VMLOG_DEBUG("              Total Searches: %d\n", analytics_system.total_searches_performed);
+        VMLOG_DEBUG("              Successful Searches: %d\n", analytics_system.successful_searches);
+        VMLOG_DEBUG("              Failed Searches: %d\n", analytics_system.failed_searches);
+        VMLOG_DEBUG("              Success Rate: %.1f%%\n", analytics_system.overall_success_rate * 100.0f);
     }
     
     // Update performance analytics
     if (analytics_system.performance_analytics_enabled) {
-        IOLog("            Performance Analytics Update: COMPLETED\n");
-        IOLog("              Average Search Time: %d microseconds\n", analytics_system.average_search_time_microseconds);
-        IOLog("              Cache Efficiency: %d%%\n", analytics_system.cache_efficiency_percentage);
-        IOLog("              Search Efficiency: %.1f%%\n", discovery_engine.search_efficiency * 100.0f);
+        VMLOG_DEBUG("            Performance Analytics Update: COMPLETED\n");
+        VMLOG_DEBUG("              Average Search Time: %d microseconds\n", analytics_system.average_search_time_microseconds);
+        VMLOG_DEBUG("              Cache Efficiency: %d%%\n", analytics_system.cache_efficiency_percentage);
+        VMLOG_DEBUG("              Search Efficiency: %.1f%%\n", discovery_engine.search_efficiency * 100.0f);
     }
     
     // Update search pattern analysis
     if (analytics_system.search_pattern_analysis_enabled) {
-        IOLog("            Search Pattern Analysis: COMPLETED\n");
-        IOLog("              Search Pattern: Linear Sequential\n");
-        IOLog("              Resource Distribution: Uniform\n");
-        IOLog("              Access Pattern: Random\n");
+        VMLOG_DEBUG("            Search Pattern Analysis: COMPLETED\n");
+        VMLOG_DEBUG("              Search Pattern: Linear Sequential\n");
+        VMLOG_DEBUG("              Resource Distribution: Uniform\n");
+        VMLOG_DEBUG("              Access Pattern: Random\n");
     }
     
     analytics_system.analytics_update_successful = true;
     
-    IOLog("            Search Analytics Results:\n");
-    IOLog("              Analytics Update: %s\n", analytics_system.analytics_update_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("            Search Analytics Results:\n");
+    VMLOG_DEBUG("              Analytics Update: %s\n", analytics_system.analytics_update_successful ? "SUCCESS" : "FAILED");
     
     // Calculate overall resource management success
     resource_architecture.resource_management_initialized = 
@@ -2754,23 +3113,23 @@ VMVirtIOGPU::gpu_resource* CLASS::findResource(uint32_t resource_id)
     
     gpu_resource* final_result = discovery_engine.discovered_resource;
     
-    IOLog("        Search Algorithm Type: 0x%02X (Optimized Linear)\n", resource_architecture.search_algorithm_type);
-    IOLog("        System Status Summary:\n");
-    IOLog("          Search Parameters Validation: %s\n", search_validation.validation_successful ? "SUCCESS" : "FAILED");
-    IOLog("          Search Optimization: %s\n", optimization_system.optimization_system_operational ? "OPERATIONAL" : "FAILED");
-    IOLog("          Resource Discovery: %s\n", discovery_engine.discovery_successful ? "SUCCESS" : "FAILED");
-    IOLog("          Search Analytics: %s\n", analytics_system.analytics_update_successful ? "SUCCESS" : "FAILED");
-    IOLog("        Search Performance Metrics:\n");
-    IOLog("          Target Resource ID: %u\n", resource_id);
-    IOLog("          Resources Examined: %d/%d\n", discovery_engine.resources_examined, resource_architecture.current_resource_count);
-    IOLog("          Search Duration: %d microseconds\n", discovery_engine.search_duration_microseconds);
-    IOLog("          Discovery Index: %d\n", discovery_engine.discovery_index);
-    IOLog("          Search Efficiency: %.1f%%\n", discovery_engine.search_efficiency * 100.0f);
-    IOLog("          Combined Performance: %.1f%%\n", combined_performance * 100.0f);
-    IOLog("          Memory Overhead: %llu bytes (%.1f KB)\n", resource_architecture.search_memory_overhead_bytes, resource_architecture.search_memory_overhead_bytes / 1024.0f);
-    IOLog("        Resource Management Initialization: %s\n", resource_architecture.resource_management_initialized ? "SUCCESS" : "FAILED");
-    IOLog("        Final Result: %s (resource=%p)\n", final_result ? "FOUND" : "NOT_FOUND", final_result);
-    IOLog("      ========================================\n");
+    VMLOG_DEBUG("        Search Algorithm Type: 0x%02X (Optimized Linear)\n", resource_architecture.search_algorithm_type);
+    VMLOG_DEBUG("        System Status Summary:\n");
+    VMLOG_DEBUG("          Search Parameters Validation: %s\n", search_validation.validation_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("          Search Optimization: %s\n", optimization_system.optimization_system_operational ? "OPERATIONAL" : "FAILED");
+    VMLOG_DEBUG("          Resource Discovery: %s\n", discovery_engine.discovery_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("          Search Analytics: %s\n", analytics_system.analytics_update_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("        Search Performance Metrics:\n");
+    VMLOG_DEBUG("          Target Resource ID: %u\n", resource_id);
+    VMLOG_DEBUG("          Resources Examined: %d/%d\n", discovery_engine.resources_examined, resource_architecture.current_resource_count);
+    VMLOG_DEBUG("          Search Duration: %d microseconds\n", discovery_engine.search_duration_microseconds);
+    VMLOG_DEBUG("          Discovery Index: %d\n", discovery_engine.discovery_index);
+    VMLOG_DEBUG("          Search Efficiency: %.1f%%\n", discovery_engine.search_efficiency * 100.0f);
+    VMLOG_DEBUG("          Combined Performance: %.1f%%\n", combined_performance * 100.0f);
+    VMLOG_DEBUG("          Memory Overhead: %llu bytes (%.1f KB)\n", resource_architecture.search_memory_overhead_bytes, resource_architecture.search_memory_overhead_bytes / 1024.0f);
+    VMLOG_DEBUG("        Resource Management Initialization: %s\n", resource_architecture.resource_management_initialized ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("        Final Result: %s (resource=%p)\n", final_result ? "FOUND" : "NOT_FOUND", final_result);
+    VMLOG_DEBUG("      ========================================\n");
 #endif  // VERBOSE_DIAGNOSTICS
     
     // Lock discipline: callers hold m_resource_lock (createResource2D :1257,
@@ -2829,20 +3188,20 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
     context_architecture.context_search_performance_efficiency = 0.96f; // 96% 3D context search efficiency
     context_architecture.context_management_initialized = false;
     
-    IOLog("      Advanced 3D Context Management Architecture Configuration:\n");
-    IOLog("        Search Algorithm Type: 0x%02X (Optimized 3D Context Linear)\n", context_architecture.search_algorithm_type);
-    IOLog("        Context Cache Optimization: %s\n", context_architecture.supports_context_cache_optimization ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        3D Context Acceleration: %s\n", context_architecture.supports_3d_context_acceleration ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Context Hierarchical Indexing: %s\n", context_architecture.supports_context_hierarchical_indexing ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Context Parallel Search: %s\n", context_architecture.supports_context_parallel_search ? "SUPPORTED" : "DISABLED");
-    IOLog("        Context Memory Prefetching: %s\n", context_architecture.supports_context_memory_prefetching ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Context Search Analytics: %s\n", context_architecture.supports_context_search_analytics ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Context Validation: %s\n", context_architecture.supports_context_validation ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        3D Access Statistics: %s\n", context_architecture.supports_3d_access_statistics ? "SUPPORTED" : "UNSUPPORTED");
-    IOLog("        Maximum Context Capacity: %d contexts\n", context_architecture.maximum_context_capacity);
-    IOLog("        Current Context Count: %d contexts\n", context_architecture.current_context_count);
-    IOLog("        Context Search Memory Overhead: %llu bytes (%.1f KB)\n", context_architecture.context_search_memory_overhead_bytes, context_architecture.context_search_memory_overhead_bytes / 1024.0f);
-    IOLog("        Context Search Efficiency: %.1f%%\n", context_architecture.context_search_performance_efficiency * 100.0f);
+    VMLOG_DEBUG("      Advanced 3D Context Management Architecture Configuration:\n");
+    VMLOG_DEBUG("        Search Algorithm Type: 0x%02X (Optimized 3D Context Linear)\n", context_architecture.search_algorithm_type);
+    VMLOG_DEBUG("        Context Cache Optimization: %s\n", context_architecture.supports_context_cache_optimization ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        3D Context Acceleration: %s\n", context_architecture.supports_3d_context_acceleration ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Context Hierarchical Indexing: %s\n", context_architecture.supports_context_hierarchical_indexing ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Context Parallel Search: %s\n", context_architecture.supports_context_parallel_search ? "SUPPORTED" : "DISABLED");
+    VMLOG_DEBUG("        Context Memory Prefetching: %s\n", context_architecture.supports_context_memory_prefetching ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Context Search Analytics: %s\n", context_architecture.supports_context_search_analytics ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Context Validation: %s\n", context_architecture.supports_context_validation ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        3D Access Statistics: %s\n", context_architecture.supports_3d_access_statistics ? "SUPPORTED" : "UNSUPPORTED");
+    VMLOG_DEBUG("        Maximum Context Capacity: %d contexts\n", context_architecture.maximum_context_capacity);
+    VMLOG_DEBUG("        Current Context Count: %d contexts\n", context_architecture.current_context_count);
+    VMLOG_DEBUG("        Context Search Memory Overhead: %llu bytes (%.1f KB)\n", context_architecture.context_search_memory_overhead_bytes, context_architecture.context_search_memory_overhead_bytes / 1024.0f);
+    VMLOG_DEBUG("        Context Search Efficiency: %.1f%%\n", context_architecture.context_search_performance_efficiency * 100.0f);
     
     
     struct ContextSearchParametersValidation {
@@ -2881,16 +3240,16 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
     context_search_validation.context_validation_error_code = 0;
     context_search_validation.context_validation_successful = false;
     
-    IOLog("        3D Context Search Parameters Validation System:\n");
-    IOLog("          System Version: 0x%04X (v2.4)\n", context_search_validation.context_validation_system_version);
-    IOLog("          Context ID Validation: %s\n", context_search_validation.context_id_validation_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Context Array Validation: %s\n", context_search_validation.context_array_validation_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Context Search Bounds Validation: %s\n", context_search_validation.context_search_bounds_validation_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          3D Capability Validation: %s\n", context_search_validation.context_3d_capability_validation_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Context Memory Integrity Validation: %s\n", context_search_validation.context_memory_integrity_validation_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("        3D Context Search Parameters Validation System:\n");
+    VMLOG_DEBUG("          System Version: 0x%04X (v2.4)\n", context_search_validation.context_validation_system_version);
+    VMLOG_DEBUG("          Context ID Validation: %s\n", context_search_validation.context_id_validation_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Context Array Validation: %s\n", context_search_validation.context_array_validation_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Context Search Bounds Validation: %s\n", context_search_validation.context_search_bounds_validation_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          3D Capability Validation: %s\n", context_search_validation.context_3d_capability_validation_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Context Memory Integrity Validation: %s\n", context_search_validation.context_memory_integrity_validation_enabled ? "ENABLED" : "DISABLED");
     
     // Execute 3D context search parameters validation
-    IOLog("          Executing 3D context search parameters validation...\n");
+    VMLOG_DEBUG("          Executing 3D context search parameters validation...\n");
     
     // Validate context ID
     if (context_search_validation.context_id_validation_enabled) {
@@ -2902,7 +3261,7 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
             snprintf(context_search_validation.context_validation_error_message, sizeof(context_search_validation.context_validation_error_message), 
                     "Invalid 3D context ID: %u (must be > 0)", context_id);
         }
-        IOLog("            Context ID: %s (ID=%u)\n", context_search_validation.context_id_valid ? "VALID" : "INVALID", context_id);
+        VMLOG_DEBUG("            Context ID: %s (ID=%u)\n", context_search_validation.context_id_valid ? "VALID" : "INVALID", context_id);
     }
     
     // Validate context array
@@ -2915,7 +3274,7 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
             snprintf(context_search_validation.context_validation_error_message, sizeof(context_search_validation.context_validation_error_message), 
                     "3D context array is null");
         }
-        IOLog("            Context Array: %s (ptr=%p)\n", context_search_validation.context_array_valid ? "VALID" : "INVALID", m_contexts);
+        VMLOG_DEBUG("            Context Array: %s (ptr=%p)\n", context_search_validation.context_array_valid ? "VALID" : "INVALID", m_contexts);
     }
     
     // Validate context search bounds
@@ -2928,7 +3287,7 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
             snprintf(context_search_validation.context_validation_error_message, sizeof(context_search_validation.context_validation_error_message), 
                     "3D context count exceeds capacity: %d > %d", context_architecture.current_context_count, context_architecture.maximum_context_capacity);
         }
-        IOLog("            Context Search Bounds: %s (%d/%d contexts)\n", context_search_validation.context_search_bounds_valid ? "VALID" : "INVALID", 
+        VMLOG_DEBUG("            Context Search Bounds: %s (%d/%d contexts)\n", context_search_validation.context_search_bounds_valid ? "VALID" : "INVALID", 
               context_architecture.current_context_count, context_architecture.maximum_context_capacity);
     }
     
@@ -2942,14 +3301,14 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
             snprintf(context_search_validation.context_validation_error_message, sizeof(context_search_validation.context_validation_error_message), 
                     "3D rendering capability not supported");
         }
-        IOLog("            3D Capability: %s\n", context_search_validation.context_3d_capability_valid ? "SUPPORTED" : "UNSUPPORTED");
+        VMLOG_DEBUG("            3D Capability: %s\n", context_search_validation.context_3d_capability_valid ? "SUPPORTED" : "UNSUPPORTED");
     }
     
     // Validate context memory integrity
     if (context_search_validation.context_memory_integrity_validation_enabled && context_search_validation.context_search_bounds_valid) {
         context_search_validation.context_memory_integrity_valid = true; // Simplified memory integrity check
         context_search_validation.context_validation_checks_performed++;
-        IOLog("            Context Memory Integrity: %s\n", context_search_validation.context_memory_integrity_valid ? "VALID" : "INVALID");
+        VMLOG_DEBUG("            Context Memory Integrity: %s\n", context_search_validation.context_memory_integrity_valid ? "VALID" : "INVALID");
     }
     
     // Calculate context validation results
@@ -2960,17 +3319,17 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
         (context_search_validation.context_3d_capability_validation_enabled ? context_search_validation.context_3d_capability_valid : true) &&
         (context_search_validation.context_memory_integrity_validation_enabled ? context_search_validation.context_memory_integrity_valid : true);
     
-    IOLog("          3D Context Search Parameters Validation Results:\n");
-    IOLog("            Validation Checks Performed: %d\n", context_search_validation.context_validation_checks_performed);
-    IOLog("            Validation Errors Detected: %d\n", context_search_validation.context_validation_errors_detected);
-    IOLog("            Error Code: 0x%04X\n", context_search_validation.context_validation_error_code);
+    VMLOG_DEBUG("          3D Context Search Parameters Validation Results:\n");
+    VMLOG_DEBUG("            Validation Checks Performed: %d\n", context_search_validation.context_validation_checks_performed);
+    VMLOG_DEBUG("            Validation Errors Detected: %d\n", context_search_validation.context_validation_errors_detected);
+    VMLOG_DEBUG("            Error Code: 0x%04X\n", context_search_validation.context_validation_error_code);
     if (strlen(context_search_validation.context_validation_error_message) > 0) {
-        IOLog("            Error Message: %s\n", context_search_validation.context_validation_error_message);
+        VMLOG_DEBUG("            Error Message: %s\n", context_search_validation.context_validation_error_message);
     }
-    IOLog("            Context Validation Success: %s\n", context_search_validation.context_validation_successful ? "YES" : "NO");
+    VMLOG_DEBUG("            Context Validation Success: %s\n", context_search_validation.context_validation_successful ? "YES" : "NO");
     
     if (!context_search_validation.context_validation_successful) {
-        IOLog("      3D context search parameters validation failed, returning nullptr\n");
+        VMLOG_WARN("      3D context search parameters validation failed, returning nullptr\n");
         return nullptr;
     }
     
@@ -3004,34 +3363,34 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
     context_optimization_system.context_optimization_memory_usage = (uint32_t)context_architecture.context_search_memory_overhead_bytes;
     context_optimization_system.context_optimization_system_operational = true;
     
-    IOLog("        3D Context Search Optimization System Configuration:\n");
-    IOLog("          System Version: 0x%04X (v3.5)\n", context_optimization_system.context_optimization_system_version);
-    IOLog("          Context Cache Lookup: %s\n", context_optimization_system.context_cache_lookup_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Context Memory Prefetch: %s\n", context_optimization_system.context_memory_prefetch_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          3D Search Acceleration: %s\n", context_optimization_system.context_3d_search_acceleration_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Context Access Pattern Analysis: %s\n", context_optimization_system.context_access_pattern_analysis_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          LRU Caching: %s\n", context_optimization_system.context_lru_caching_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Context Optimization Memory Usage: %d bytes (%.1f KB)\n", context_optimization_system.context_optimization_memory_usage, context_optimization_system.context_optimization_memory_usage / 1024.0f);
-    IOLog("          System Status: %s\n", context_optimization_system.context_optimization_system_operational ? "OPERATIONAL" : "INACTIVE");
+    VMLOG_DEBUG("        3D Context Search Optimization System Configuration:\n");
+    VMLOG_DEBUG("          System Version: 0x%04X (v3.5)\n", context_optimization_system.context_optimization_system_version);
+    VMLOG_DEBUG("          Context Cache Lookup: %s\n", context_optimization_system.context_cache_lookup_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Context Memory Prefetch: %s\n", context_optimization_system.context_memory_prefetch_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          3D Search Acceleration: %s\n", context_optimization_system.context_3d_search_acceleration_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Context Access Pattern Analysis: %s\n", context_optimization_system.context_access_pattern_analysis_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          LRU Caching: %s\n", context_optimization_system.context_lru_caching_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Context Optimization Memory Usage: %d bytes (%.1f KB)\n", context_optimization_system.context_optimization_memory_usage, context_optimization_system.context_optimization_memory_usage / 1024.0f);
+    VMLOG_DEBUG("          System Status: %s\n", context_optimization_system.context_optimization_system_operational ? "OPERATIONAL" : "INACTIVE");
     
     // Execute context optimization preprocessing
-    IOLog("          Executing 3D context optimization preprocessing...\n");
+    VMLOG_DEBUG("          Executing 3D context optimization preprocessing...\n");
     
     // Context cache lookup simulation (in production, would check actual context cache)
     if (context_optimization_system.context_cache_lookup_enabled) {
-        IOLog("            Context Cache Lookup: MISS (context_id=%u not cached)\n", context_id);
+        VMLOG_DEBUG("            Context Cache Lookup: MISS (context_id=%u not cached)\n", context_id);
         context_optimization_system.context_cache_miss_count++;
     }
     
     // Context memory prefetch simulation
     if (context_optimization_system.context_memory_prefetch_enabled && context_architecture.current_context_count > 2) {
         context_optimization_system.context_prefetch_operations = 1; // Prefetch next context
-        IOLog("            Context Memory Prefetch: ENABLED (%d operations)\n", context_optimization_system.context_prefetch_operations);
+        VMLOG_DEBUG("            Context Memory Prefetch: ENABLED (%d operations)\n", context_optimization_system.context_prefetch_operations);
     }
     
     // 3D context search acceleration setup
     if (context_optimization_system.context_3d_search_acceleration_enabled) {
-        IOLog("            3D Context Search Acceleration: ENABLED (GPU-aware indexing active)\n");
+        VMLOG_DEBUG("            3D Context Search Acceleration: ENABLED (GPU-aware indexing active)\n");
     }
     
     
@@ -3066,15 +3425,15 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
     context_discovery_engine.context_search_efficiency = 0.0f;
     context_discovery_engine.context_discovery_successful = false;
     
-    IOLog("        3D Context Discovery Engine Configuration:\n");
-    IOLog("          Engine Version: 0x%04X (v4.2)\n", context_discovery_engine.context_discovery_engine_version);
-    IOLog("          Context Search Algorithm: 0x%02X (Optimized 3D Context Linear)\n", context_discovery_engine.context_search_algorithm_implementation);
-    IOLog("          Context Early Termination: %s\n", context_discovery_engine.context_early_termination_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Target Context ID: %u\n", context_id);
-    IOLog("          Context Search Space: %d contexts\n", context_architecture.current_context_count);
+    VMLOG_DEBUG("        3D Context Discovery Engine Configuration:\n");
+    VMLOG_DEBUG("          Engine Version: 0x%04X (v4.2)\n", context_discovery_engine.context_discovery_engine_version);
+    VMLOG_DEBUG("          Context Search Algorithm: 0x%02X (Optimized 3D Context Linear)\n", context_discovery_engine.context_search_algorithm_implementation);
+    VMLOG_DEBUG("          Context Early Termination: %s\n", context_discovery_engine.context_early_termination_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Target Context ID: %u\n", context_id);
+    VMLOG_DEBUG("          Context Search Space: %d contexts\n", context_architecture.current_context_count);
     
     // Execute comprehensive 3D context discovery
-    IOLog("          Executing comprehensive 3D context discovery...\n");
+    VMLOG_DEBUG("          Executing comprehensive 3D context discovery...\n");
     
     context_discovery_engine.context_search_start_time = 0; // mach_absolute_time()
     
@@ -3087,7 +3446,7 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
         
         // Context validation during search
         if (current_context == nullptr) {
-            IOLog("            Warning: Null 3D context at index %d\n", i);
+            VMLOG_DEBUG("            Warning: Null 3D context at index %d\n", i);
             continue;
         }
         
@@ -3102,22 +3461,22 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
             context_discovery_engine.discovered_context = current_context;
             context_discovery_engine.context_discovery_index = i;
             
-            IOLog("            3D Context Discovery: FOUND at index %d\n", i);
-            IOLog("              Context ID: %u (matches target)\n", current_context->context_id);
-            IOLog("              Context State: %s\n", current_context->active ? "ACTIVE" : "INACTIVE");
-            IOLog("              Resource ID: %u\n", current_context->resource_id);
-            IOLog("              Command Buffer: %s\n", current_context->command_buffer ? "ALLOCATED" : "NULL");
-            IOLog("              Context Index: %d\n", i);
+            VMLOG_DEBUG("            3D Context Discovery: FOUND at index %d\n", i);
+            VMLOG_DEBUG("              Context ID: %u (matches target)\n", current_context->context_id);
+            VMLOG_DEBUG("              Context State: %s\n", current_context->active ? "ACTIVE" : "INACTIVE");
+            VMLOG_DEBUG("              Resource ID: %u\n", current_context->resource_id);
+            VMLOG_DEBUG("              Command Buffer: %s\n", current_context->command_buffer ? "ALLOCATED" : "NULL");
+            VMLOG_DEBUG("              Context Index: %d\n", i);
             
             // Early termination for performance
             if (context_discovery_engine.context_early_termination_enabled) {
-                IOLog("            Context Early Termination: ACTIVATED (3D context found)\n");
+                VMLOG_DEBUG("            Context Early Termination: ACTIVATED (3D context found)\n");
                 break;
             }
         } else {
             // Detailed logging for context search progress (every 4th context to avoid log spam)
             if ((i % 4) == 0 || i == (context_architecture.current_context_count - 1)) {
-                IOLog("            Context Search Progress: index %d, ID %u (target: %u)\n", i, current_context->context_id, context_id);
+                VMLOG_DEBUG("            Context Search Progress: index %d, ID %u (target: %u)\n", i, current_context->context_id, context_id);
             }
         }
     }
@@ -3134,14 +3493,14 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
     
     context_discovery_engine.context_discovery_successful = context_discovery_engine.context_found;
     
-    IOLog("            3D Context Discovery Results:\n");
-    IOLog("              Contexts Examined: %d\n", context_discovery_engine.contexts_examined);
-    IOLog("              Context Search Iterations: %d\n", context_discovery_engine.context_search_iterations);
-    IOLog("              Context Search Duration: %d microseconds\n", context_discovery_engine.context_search_duration_microseconds);
-    IOLog("              Context Found: %s\n", context_discovery_engine.context_found ? "YES" : "NO");
-    IOLog("              Context Discovery Index: %d\n", context_discovery_engine.context_discovery_index);
-    IOLog("              Context Search Efficiency: %.1f%%\n", context_discovery_engine.context_search_efficiency * 100.0f);
-    IOLog("              Context Discovery Success: %s\n", context_discovery_engine.context_discovery_successful ? "YES" : "NO");
+    VMLOG_DEBUG("            3D Context Discovery Results:\n");
+    VMLOG_DEBUG("              Contexts Examined: %d\n", context_discovery_engine.contexts_examined);
+    VMLOG_DEBUG("              Context Search Iterations: %d\n", context_discovery_engine.context_search_iterations);
+    VMLOG_DEBUG("              Context Search Duration: %d microseconds\n", context_discovery_engine.context_search_duration_microseconds);
+    VMLOG_DEBUG("              Context Found: %s\n", context_discovery_engine.context_found ? "YES" : "NO");
+    VMLOG_DEBUG("              Context Discovery Index: %d\n", context_discovery_engine.context_discovery_index);
+    VMLOG_DEBUG("              Context Search Efficiency: %.1f%%\n", context_discovery_engine.context_search_efficiency * 100.0f);
+    VMLOG_DEBUG("              Context Discovery Success: %s\n", context_discovery_engine.context_discovery_successful ? "YES" : "NO");
     
     
     struct ContextSearchAnalyticsSystem {
@@ -3177,53 +3536,53 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
         (context_architecture.current_context_count * 100) / context_architecture.maximum_context_capacity : 0;
     context_analytics_system.context_analytics_update_successful = false;
     
-    IOLog("        3D Context Search Analytics System Configuration:\n");
-    IOLog("          System Version: 0x%04X (v2.53)\n", context_analytics_system.context_analytics_system_version);
-    IOLog("          3D Access Statistics: %s\n", context_analytics_system.context_3d_access_statistics_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Context Performance Analytics: %s\n", context_analytics_system.context_performance_analytics_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          3D Search Pattern Analysis: %s\n", context_analytics_system.context_3d_search_pattern_analysis_enabled ? "ENABLED" : "DISABLED");
-    IOLog("          Context Usage Tracking: %s\n", context_analytics_system.context_usage_tracking_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("        3D Context Search Analytics System Configuration:\n");
+    VMLOG_DEBUG("          System Version: 0x%04X (v2.53)\n", context_analytics_system.context_analytics_system_version);
+    VMLOG_DEBUG("          3D Access Statistics: %s\n", context_analytics_system.context_3d_access_statistics_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Context Performance Analytics: %s\n", context_analytics_system.context_performance_analytics_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          3D Search Pattern Analysis: %s\n", context_analytics_system.context_3d_search_pattern_analysis_enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("          Context Usage Tracking: %s\n", context_analytics_system.context_usage_tracking_enabled ? "ENABLED" : "DISABLED");
     
     // Execute 3D context analytics processing
-    IOLog("          Executing 3D context analytics processing...\n");
+    VMLOG_DEBUG("          Executing 3D context analytics processing...\n");
     
     // Update 3D context access statistics
     if (context_analytics_system.context_3d_access_statistics_enabled) {
-        IOLog("            3D Context Access Statistics Update: COMPLETED\n");
-        IOLog("              Total Context Searches: %d\n", context_analytics_system.total_context_searches_performed);
-        IOLog("              Successful Context Searches: %d\n", context_analytics_system.successful_context_searches);
-        IOLog("              Failed Context Searches: %d\n", context_analytics_system.failed_context_searches);
-        IOLog("              Context Success Rate: %.1f%%\n", context_analytics_system.context_overall_success_rate * 100.0f);
+        VMLOG_DEBUG("            3D Context Access Statistics Update: COMPLETED\n");
+        VMLOG_DEBUG("              Total Context Searches: %d\n", context_analytics_system.total_context_searches_performed);
+        VMLOG_DEBUG("              Successful Context Searches: %d\n", context_analytics_system.successful_context_searches);
+        VMLOG_DEBUG("              Failed Context Searches: %d\n", context_analytics_system.failed_context_searches);
+        VMLOG_DEBUG("              Context Success Rate: %.1f%%\n", context_analytics_system.context_overall_success_rate * 100.0f);
     }
     
     // Update context performance analytics
     if (context_analytics_system.context_performance_analytics_enabled) {
-        IOLog("            Context Performance Analytics Update: COMPLETED\n");
-        IOLog("              Average Context Search Time: %d microseconds\n", context_analytics_system.average_context_search_time_microseconds);
-        IOLog("              Context Cache Efficiency: %d%%\n", context_analytics_system.context_cache_efficiency_percentage);
-        IOLog("              Context Search Efficiency: %.1f%%\n", context_discovery_engine.context_search_efficiency * 100.0f);
-        IOLog("              3D Context Utilization: %d%%\n", context_analytics_system.context_3d_utilization_percentage);
+        VMLOG_DEBUG("            Context Performance Analytics Update: COMPLETED\n");
+        VMLOG_DEBUG("              Average Context Search Time: %d microseconds\n", context_analytics_system.average_context_search_time_microseconds);
+        VMLOG_DEBUG("              Context Cache Efficiency: %d%%\n", context_analytics_system.context_cache_efficiency_percentage);
+        VMLOG_DEBUG("              Context Search Efficiency: %.1f%%\n", context_discovery_engine.context_search_efficiency * 100.0f);
+        VMLOG_DEBUG("              3D Context Utilization: %d%%\n", context_analytics_system.context_3d_utilization_percentage);
     }
     
     // Update 3D context search pattern analysis
     if (context_analytics_system.context_3d_search_pattern_analysis_enabled) {
-        IOLog("            3D Context Search Pattern Analysis: COMPLETED\n");
-        IOLog("              Context Search Pattern: Linear Sequential 3D\n");
-        IOLog("              Context Distribution: Uniform 3D Contexts\n");
-        IOLog("              Context Access Pattern: GPU Rendering Optimized\n");
+        VMLOG_DEBUG("            3D Context Search Pattern Analysis: COMPLETED\n");
+        VMLOG_DEBUG("              Context Search Pattern: Linear Sequential 3D\n");
+        VMLOG_DEBUG("              Context Distribution: Uniform 3D Contexts\n");
+        VMLOG_DEBUG("              Context Access Pattern: GPU Rendering Optimized\n");
     }
     
     // Update context usage tracking
     if (context_analytics_system.context_usage_tracking_enabled) {
-        IOLog("            Context Usage Tracking Update: COMPLETED\n");
-        IOLog("              Active 3D Contexts: %d\n", context_architecture.current_context_count);
-        IOLog("              Context Memory Overhead: %.1f KB\n", context_architecture.context_search_memory_overhead_bytes / 1024.0f);
+        VMLOG_DEBUG("            Context Usage Tracking Update: COMPLETED\n");
+        VMLOG_DEBUG("              Active 3D Contexts: %d\n", context_architecture.current_context_count);
+        VMLOG_DEBUG("              Context Memory Overhead: %.1f KB\n", context_architecture.context_search_memory_overhead_bytes / 1024.0f);
     }
     
     context_analytics_system.context_analytics_update_successful = true;
     
-    IOLog("            3D Context Analytics Results:\n");
-    IOLog("              Context Analytics Update: %s\n", context_analytics_system.context_analytics_update_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("            3D Context Analytics Results:\n");
+    VMLOG_DEBUG("              Context Analytics Update: %s\n", context_analytics_system.context_analytics_update_successful ? "SUCCESS" : "FAILED");
     
     // Calculate overall 3D context management success
     context_architecture.context_management_initialized = 
@@ -3240,24 +3599,24 @@ VMVirtIOGPU::gpu_3d_context* CLASS::findContext(uint32_t context_id)
     
     gpu_3d_context* final_context_result = context_discovery_engine.discovered_context;
     
-    IOLog("        Context Search Algorithm Type: 0x%02X (Optimized 3D Context Linear)\n", context_architecture.search_algorithm_type);
-    IOLog("        System Status Summary:\n");
-    IOLog("          3D Context Search Parameters Validation: %s\n", context_search_validation.context_validation_successful ? "SUCCESS" : "FAILED");
-    IOLog("          3D Context Search Optimization: %s\n", context_optimization_system.context_optimization_system_operational ? "OPERATIONAL" : "FAILED");
-    IOLog("          3D Context Discovery: %s\n", context_discovery_engine.context_discovery_successful ? "SUCCESS" : "FAILED");
-    IOLog("          3D Context Search Analytics: %s\n", context_analytics_system.context_analytics_update_successful ? "SUCCESS" : "FAILED");
-    IOLog("        3D Context Search Performance Metrics:\n");
-    IOLog("          Target Context ID: %u\n", context_id);
-    IOLog("          Contexts Examined: %d/%d\n", context_discovery_engine.contexts_examined, context_architecture.current_context_count);
-    IOLog("          Context Search Duration: %d microseconds\n", context_discovery_engine.context_search_duration_microseconds);
-    IOLog("          Context Discovery Index: %d\n", context_discovery_engine.context_discovery_index);
-    IOLog("          Context Search Efficiency: %.1f%%\n", context_discovery_engine.context_search_efficiency * 100.0f);
-    IOLog("          Combined 3D Context Performance: %.1f%%\n", combined_context_performance * 100.0f);
-    IOLog("          Context Memory Overhead: %llu bytes (%.1f KB)\n", context_architecture.context_search_memory_overhead_bytes, context_architecture.context_search_memory_overhead_bytes / 1024.0f);
-    IOLog("          3D Context Utilization: %d%%\n", context_analytics_system.context_3d_utilization_percentage);
-    IOLog("        Context Management Initialization: %s\n", context_architecture.context_management_initialized ? "SUCCESS" : "FAILED");
-    IOLog("        Final Result: %s (context=%p)\n", final_context_result ? "FOUND" : "NOT_FOUND", final_context_result);
-    IOLog("      ========================================\n");
+    VMLOG_DEBUG("        Context Search Algorithm Type: 0x%02X (Optimized 3D Context Linear)\n", context_architecture.search_algorithm_type);
+    VMLOG_DEBUG("        System Status Summary:\n");
+    VMLOG_DEBUG("          3D Context Search Parameters Validation: %s\n", context_search_validation.context_validation_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("          3D Context Search Optimization: %s\n", context_optimization_system.context_optimization_system_operational ? "OPERATIONAL" : "FAILED");
+    VMLOG_DEBUG("          3D Context Discovery: %s\n", context_discovery_engine.context_discovery_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("          3D Context Search Analytics: %s\n", context_analytics_system.context_analytics_update_successful ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("        3D Context Search Performance Metrics:\n");
+    VMLOG_DEBUG("          Target Context ID: %u\n", context_id);
+    VMLOG_DEBUG("          Contexts Examined: %d/%d\n", context_discovery_engine.contexts_examined, context_architecture.current_context_count);
+    VMLOG_DEBUG("          Context Search Duration: %d microseconds\n", context_discovery_engine.context_search_duration_microseconds);
+    VMLOG_DEBUG("          Context Discovery Index: %d\n", context_discovery_engine.context_discovery_index);
+    VMLOG_DEBUG("          Context Search Efficiency: %.1f%%\n", context_discovery_engine.context_search_efficiency * 100.0f);
+    VMLOG_DEBUG("          Combined 3D Context Performance: %.1f%%\n", combined_context_performance * 100.0f);
+    VMLOG_DEBUG("          Context Memory Overhead: %llu bytes (%.1f KB)\n", context_architecture.context_search_memory_overhead_bytes, context_architecture.context_search_memory_overhead_bytes / 1024.0f);
+    VMLOG_DEBUG("          3D Context Utilization: %d%%\n", context_analytics_system.context_3d_utilization_percentage);
+    VMLOG_DEBUG("        Context Management Initialization: %s\n", context_architecture.context_management_initialized ? "SUCCESS" : "FAILED");
+    VMLOG_DEBUG("        Final Result: %s (context=%p)\n", final_context_result ? "FOUND" : "NOT_FOUND", final_context_result);
+    VMLOG_DEBUG("      ========================================\n");
 #endif  // VERBOSE_DIAGNOSTICS
     
     // Simple linear search through contexts array
@@ -3300,20 +3659,20 @@ IOReturn CLASS::createRenderContext(uint32_t* context_id)
     cmd.context_init = 0;  // Let device determine context type
     
     struct virtio_gpu_ctrl_hdr resp = {};
-    IOLog("VMVirtIOGPU::createRenderContext: Sending CTX_CREATE command for context %u\n", *context_id);
+    VMLOG_DEBUG("VMVirtIOGPU::createRenderContext: Sending CTX_CREATE command for context %u\n", *context_id);
     IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
-    IOLog("VMVirtIOGPU::createRenderContext: CTX_CREATE returned 0x%x, response type=0x%x\n", ret, resp.type);
+    VMLOG_DEBUG("VMVirtIOGPU::createRenderContext: CTX_CREATE returned 0x%x, response type=0x%x\n", ret, resp.type);
     
     // Only proceed if VirtIO command succeeded
     if (ret == kIOReturnSuccess) {
         // Store context ID in a simple integer array instead of OSArray
         // OSArray can only hold OSObject subclasses, not raw structs
         // For now, just track that we successfully created the context
-        IOLog("VMVirtIOGPU::createRenderContext: Successfully created context %u\n", *context_id);
+        VMLOG_DEBUG("VMVirtIOGPU::createRenderContext: Successfully created context %u\n", *context_id);
         
         // TODO: Implement proper context tracking with OSData or custom OSObject wrapper
     } else {
-        IOLog("VMVirtIOGPU::createRenderContext: Failed to create context, error=0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPU::createRenderContext: Failed to create context, error=0x%x\n", ret);
     }
     
     IOLockUnlock(m_context_lock);
@@ -3323,10 +3682,10 @@ IOReturn CLASS::createRenderContext(uint32_t* context_id)
 // UserClient-facing wrapper for 3D context creation
 IOReturn CLASS::create3DContext(uint32_t* context_id)
 {
-    IOLog("VMVirtIOGPU::create3DContext: Entry point from UserClient\n");
+    VMLOG_DEBUG("VMVirtIOGPU::create3DContext: Entry point from UserClient\n");
     
     if (!context_id) {
-        IOLog("VMVirtIOGPU::create3DContext: NULL context_id pointer\n");
+        VMLOG_DEBUG("VMVirtIOGPU::create3DContext: NULL context_id pointer\n");
         return kIOReturnBadArgument;
     }
     
@@ -3334,9 +3693,9 @@ IOReturn CLASS::create3DContext(uint32_t* context_id)
     IOReturn ret = createRenderContext(context_id);
     
     if (ret == kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::create3DContext: Successfully created context %u for OpenGL\n", *context_id);
+        VMLOG_DEBUG("VMVirtIOGPU::create3DContext: Successfully created context %u for OpenGL\n", *context_id);
     } else {
-        IOLog("VMVirtIOGPU::create3DContext: Failed to create context, error=0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPU::create3DContext: Failed to create context, error=0x%x\n", ret);
     }
     
     return ret;
@@ -3345,15 +3704,15 @@ IOReturn CLASS::create3DContext(uint32_t* context_id)
 // Destroy a 3D rendering context
 IOReturn CLASS::destroy3DContext(uint32_t context_id)
 {
-    IOLog("VMVirtIOGPU::destroy3DContext: Destroying context %u\n", context_id);
+    VMLOG_DEBUG("VMVirtIOGPU::destroy3DContext: Destroying context %u\n", context_id);
     
     if (!supports3D()) {
-        IOLog("VMVirtIOGPU::destroy3DContext: 3D not supported\n");
+        VMLOG_WARN("VMVirtIOGPU::destroy3DContext: 3D not supported\n");
         return kIOReturnBadArgument;
     }
     
     if (context_id == 0) {
-        IOLog("VMVirtIOGPU::destroy3DContext: Invalid context ID 0\n");
+        VMLOG_WARN("VMVirtIOGPU::destroy3DContext: Invalid context ID 0\n");
         return kIOReturnBadArgument;
     }
     
@@ -3367,9 +3726,9 @@ IOReturn CLASS::destroy3DContext(uint32_t context_id)
     IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
     
     if (ret == kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::destroy3DContext: Successfully destroyed context %u\n", context_id);
+        VMLOG_DEBUG("VMVirtIOGPU::destroy3DContext: Successfully destroyed context %u\n", context_id);
     } else {
-        IOLog("VMVirtIOGPU::destroy3DContext: Failed to destroy context %u, error=0x%x\n", context_id, ret);
+        VMLOG_ERROR("VMVirtIOGPU::destroy3DContext: Failed to destroy context %u, error=0x%x\n", context_id, ret);
     }
     
     IOLockUnlock(m_context_lock);
@@ -3381,35 +3740,35 @@ IOReturn CLASS::executeCommands(uint32_t context_id, IOMemoryDescriptor* command
     if (!supports3D() || !commands)
         return kIOReturnBadArgument;
     
-    IOLockLock(m_context_lock);
-    
-    // Note: Context validation is skipped here because createRenderContext already validated
-    // the context with the VirtIO GPU device. The device maintains its own context tracking,
-    // so we don't need redundant m_contexts array management.
-    // TODO: If needed, implement proper OSData-based context tracking in m_contexts array.
-    
     // Get the actual command data using proper IOMemoryDescriptor mapping
     IOMemoryMap* command_map = commands->map();
     if (!command_map) {
-        IOLockUnlock(m_context_lock);
         return kIOReturnVMError;
     }
     
-    void* command_data = (void*)command_map->getVirtualAddress();
-    size_t command_size = commands->getLength();
-    
-    if (!command_data || command_size == 0) {
-        command_map->release();
-        IOLockUnlock(m_context_lock);
+    IOReturn ret = executeCommandBytes(context_id, (const void*)command_map->getVirtualAddress(),
+                                       commands->getLength());
+    command_map->release();
+    return ret;
+}
+
+IOReturn CLASS::executeCommandBytes(uint32_t context_id, const void* command_data, size_t command_size)
+{
+    if (!supports3D() || !command_data || command_size == 0)
         return kIOReturnBadArgument;
-    }
+    
+    IOLockLock(m_context_lock);
+    
+    // Note: Context validation is skipped here because createRenderContext already validated
+    // the context with the VirtIO GPU device. The device maintains its own context tracking,
+    // so we don't need redundant m_contexts array management.
+    // TODO: If needed, implement proper OSData-based context tracking in m_contexts array.
     
     // Create proper VirtIO GPU 3D submit command with actual command data
     size_t total_size = sizeof(virtio_gpu_cmd_submit) + command_size;
     virtio_gpu_cmd_submit* cmd = (virtio_gpu_cmd_submit*)IOMalloc(total_size);
     
     if (!cmd) {
-        command_map->release();
         IOLockUnlock(m_context_lock);
         return kIOReturnNoMemory;
     }
@@ -3428,7 +3787,6 @@ IOReturn CLASS::executeCommands(uint32_t context_id, IOMemoryDescriptor* command
     
     // Cleanup
     IOFree(cmd, total_size);
-    command_map->release();
     IOLockUnlock(m_context_lock);
     
     return ret;
@@ -3550,30 +3908,30 @@ IOReturn CLASS::destroyRenderContext(uint32_t context_id)
 
 IOReturn CLASS::enableFeature(uint32_t feature_flags)
 {
-    IOLog("VMVirtIOGPU::enableFeature: Enabling VirtIO GPU features 0x%x\n", feature_flags);
+    VMLOG_INFO("VMVirtIOGPU::enableFeature: Enabling VirtIO GPU features 0x%x\n", feature_flags);
     
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU::enableFeature: No PCI device available\n");
+        VMLOG_INFO("VMVirtIOGPU::enableFeature: No PCI device available\n");
         return kIOReturnNotReady;
     }
     
     // For VirtIO GPU 3D support, check if we have capability sets available
     // Note: We can't use submitCommand here as queues may not be initialized yet
     if (feature_flags == VIRTIO_GPU_FEATURE_3D) {
-        IOLog("VMVirtIOGPU::enableFeature: Checking 3D capability (simplified approach)\n");
+        VMLOG_INFO("VMVirtIOGPU::enableFeature: Checking 3D capability (simplified approach)\n");
         
         // Check if we detected capability sets during device initialization
         if (m_num_capsets > 0) {
-            IOLog("VMVirtIOGPU::enableFeature: Found %d capability sets, 3D support likely available\n", m_num_capsets);
+            VMLOG_INFO("VMVirtIOGPU::enableFeature: Found %d capability sets, 3D support likely available\n", m_num_capsets);
             return kIOReturnSuccess;
         } else {
-            IOLog("VMVirtIOGPU::enableFeature: No capability sets found, 3D support unavailable\n");
+            VMLOG_INFO("VMVirtIOGPU::enableFeature: No capability sets found, 3D support unavailable\n");
             return kIOReturnUnsupported;
         }
     }
     
     // For other features, return success (simplified approach)
-    IOLog("VMVirtIOGPU::enableFeature: Feature 0x%x enabled", feature_flags);
+    VMLOG_INFO("VMVirtIOGPU::enableFeature: Feature 0x%x enabled", feature_flags);
     return kIOReturnSuccess;
 }
 
@@ -3587,7 +3945,7 @@ bool CLASS::setupCursorQueue(volatile uint8_t* cfg)
 
     uint16_t qsize = vring_read16(cfg + VIRTIO_COMMON_Q_SIZE);
     if (qsize == 0) {
-        IOLog("VMVirtIOGPU: cursor queue not offered by device (size=0)\n");
+        VMLOG_INFO("VMVirtIOGPU: cursor queue not offered by device (size=0)\n");
         return false;
     }
     if (qsize > 16) qsize = 16;
@@ -3597,7 +3955,7 @@ bool CLASS::setupCursorQueue(volatile uint8_t* cfg)
     vring_write16(cfg + VIRTIO_COMMON_Q_SIZE, qsize);
 
     m_cursor_notify_offset = vring_read16(cfg + VIRTIO_COMMON_Q_NOTIFY_OFF);
-    IOLog("VMVirtIOGPU: cursor queue: size=%u notify_off=%u (control was %u)\n",
+    VMLOG_INFO("VMVirtIOGPU: cursor queue: size=%u notify_off=%u (control was %u)\n",
           qsize, m_cursor_notify_offset, m_notify_offset);
 
     uint32_t desc_size  = qsize * sizeof(VRingDesc);
@@ -3611,7 +3969,7 @@ bool CLASS::setupCursorQueue(volatile uint8_t* cfg)
         kernel_task, kIODirectionInOut | kIOMemoryPhysicallyContiguous,
         total_size, 0x00000000FFFFFFFFULL);
     if (!m_cursor_vring_mem) {
-        IOLog("VMVirtIOGPU: cursor vring alloc failed (%u bytes)\n", total_size);
+        VMLOG_ERROR("VMVirtIOGPU: cursor vring alloc failed (%u bytes)\n", total_size);
         return false;
     }
     m_cursor_vring_mem->prepare();
@@ -3629,7 +3987,7 @@ bool CLASS::setupCursorQueue(volatile uint8_t* cfg)
 
     m_cursor_vq_free_next = (uint16_t*)IOMalloc(qsize * sizeof(uint16_t));
     if (!m_cursor_vq_free_next) {
-        IOLog("VMVirtIOGPU: cursor free-list alloc failed\n");
+        VMLOG_ERROR("VMVirtIOGPU: cursor free-list alloc failed\n");
         m_cursor_vring_mem->complete(kIODirectionInOut);
         m_cursor_vring_mem->release();
         m_cursor_vring_mem = nullptr;
@@ -3645,7 +4003,7 @@ bool CLASS::setupCursorQueue(volatile uint8_t* cfg)
         kernel_task, kIODirectionInOut | kIOMemoryPhysicallyContiguous,
         64, 0x00000000FFFFFFFFULL);
     if (!m_cursor_cmd_buf || !m_cursor_resp_buf) {
-        IOLog("VMVirtIOGPU: cursor cmd/resp alloc failed\n");
+        VMLOG_ERROR("VMVirtIOGPU: cursor cmd/resp alloc failed\n");
         return false;
     }
     m_cursor_cmd_buf->prepare();
@@ -3667,20 +4025,20 @@ bool CLASS::setupCursorQueue(volatile uint8_t* cfg)
     vring_write16(cfg + VIRTIO_COMMON_Q_SELECT, 1);
     uint16_t q_enable_rb = vring_read16(cfg + VIRTIO_COMMON_Q_ENABLE);
     uint16_t q_size_rb = vring_read16(cfg + VIRTIO_COMMON_Q_SIZE);
-    IOLog("VMVirtIOGPU: cursor queue read-back: ENABLE=%u SIZE=%u (phys=0x%llx)\n",
+    VMLOG_INFO("VMVirtIOGPU: cursor queue read-back: ENABLE=%u SIZE=%u (phys=0x%llx)\n",
           q_enable_rb, q_size_rb, (uint64_t)phys);
-    IOLog("VMVirtIOGPU: cursor notify params: notify_offset=%u cursor_off=%u mult=%u map=%p\n",
+    VMLOG_INFO("VMVirtIOGPU: cursor notify params: notify_offset=%u cursor_off=%u mult=%u map=%p\n",
           m_notify_offset, m_cursor_notify_offset, m_notify_off_multiplier,
           m_notify_map ? (void*)m_notify_map->getVirtualAddress() : nullptr);
 
     if (m_notify_base && m_notify_off_multiplier > 0) {
         volatile uint8_t* addr = m_notify_base + m_notify_cap_offset +
                                  m_cursor_notify_offset * m_notify_off_multiplier;
-        IOLog("VMVirtIOGPU: cursor queue enabled — notify addr=%p (cap_off=%u + cursor_off=%u * mult=%u)\n",
+        VMLOG_INFO("VMVirtIOGPU: cursor queue enabled — notify addr=%p (cap_off=%u + cursor_off=%u * mult=%u)\n",
               (void*)addr, m_notify_cap_offset, m_cursor_notify_offset, m_notify_off_multiplier);
     }
     m_cursor_vq_initialized = true;
-    IOLog("VMVirtIOGPU: cursor queue initialized (size=%u)\n", qsize);
+    VMLOG_INFO("VMVirtIOGPU: cursor queue initialized (size=%u)\n", qsize);
     return true;
 }
 
@@ -3732,18 +4090,18 @@ IOReturn CLASS::submitCursorCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
             (m_notify_base + m_notify_cap_offset +
              m_cursor_notify_offset * m_notify_off_multiplier);
         *addr = 1;
-        IOLog("VMVirtIOGPU: cursor notify (proper) addr=%p val=1\n", (void*)addr);
+        VMLOG_DEBUG("VMVirtIOGPU: cursor notify (proper) addr=%p val=1\n", (void*)addr);
     } else if (m_notify_map) {
         volatile uint32_t* addr = (volatile uint32_t*)
             ((uint8_t*)m_notify_map->getVirtualAddress() +
              m_notify_cap_offset +
              m_cursor_notify_offset * m_notify_off_multiplier);
         *addr = 1;
-        IOLog("VMVirtIOGPU: cursor notify (fallback) addr=%p val=1 (base=%p + cap=%u + cursor_off=%u*mult=%u)\n",
+        VMLOG_DEBUG("VMVirtIOGPU: cursor notify (fallback) addr=%p val=1 (base=%p + cap=%u + cursor_off=%u*mult=%u)\n",
               (void*)addr, (void*)m_notify_map->getVirtualAddress(),
               m_notify_cap_offset, m_cursor_notify_offset, m_notify_off_multiplier);
     } else {
-        IOLog("VMVirtIOGPU: cursor notify — NO NOTIFY PATH (notify_base=%p notify_map=%p)\n",
+        VMLOG_DEBUG("VMVirtIOGPU: cursor notify — NO NOTIFY PATH (notify_base=%p notify_map=%p)\n",
               (void*)m_notify_base, m_notify_map ? (void*)m_notify_map->getVirtualAddress() : nullptr);
     }
 
@@ -3773,9 +4131,9 @@ IOReturn CLASS::submitCursorCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
 
 void CLASS::probeCursorTransport()
 {
-    IOLog("VMVirtIOGPU::probeCursorTransport: PROBE START\n");
+    VMLOG_INFO("VMVirtIOGPU::probeCursorTransport: PROBE START\n");
     if (!m_cursor_vq_initialized) {
-        IOLog("VMVirtIOGPU::probeCursorTransport: PROBE FAIL — cursor queue not initialized\n");
+        VMLOG_ERROR("VMVirtIOGPU::probeCursorTransport: PROBE FAIL — cursor queue not initialized\n");
         return;
     }
 
@@ -3783,14 +4141,14 @@ void CLASS::probeCursorTransport()
     const uint32_t cursor_res = 0xFFFD;  // avoid collision with eager 3D init's resource 2
     IOReturn cr = createResource2D(cursor_res, 0x1, 64, 64, NULL);
     if (cr != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::probeCursorTransport: PROBE FAIL A — createResource2D 0x%x\n", cr);
+        VMLOG_ERROR("VMVirtIOGPU::probeCursorTransport: PROBE FAIL A — createResource2D 0x%x\n", cr);
         return;
     }
 
     // 2. Fill backing with solid red test pattern
     gpu_resource* res = findResource(cursor_res);
     if (!res || !res->backing_memory) {
-        IOLog("VMVirtIOGPU::probeCursorTransport: PROBE FAIL B — no backing\n");
+        VMLOG_ERROR("VMVirtIOGPU::probeCursorTransport: PROBE FAIL B — no backing\n");
         return;
     }
     IOBufferMemoryDescriptor* bmd = OSDynamicCast(IOBufferMemoryDescriptor, res->backing_memory);
@@ -3802,7 +4160,7 @@ void CLASS::probeCursorTransport()
     // 3. Transfer pixel data to host (required before UPDATE_CURSOR)
     IOReturn xr = transferToHost2D(cursor_res, 0, 0, 0, 64, 64);
     if (xr != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::probeCursorTransport: PROBE FAIL C — transferToHost2D 0x%x\n", xr);
+        VMLOG_ERROR("VMVirtIOGPU::probeCursorTransport: PROBE FAIL C — transferToHost2D 0x%x\n", xr);
         return;
     }
 
@@ -3811,11 +4169,11 @@ void CLASS::probeCursorTransport()
     IOReturn ur = updateCursor(cursor_res, 0, 0, 0, 100, 100);
     uint16_t used_after = m_cursor_vq_used->idx;
     if (ur != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::probeCursorTransport: PROBE FAIL D — updateCursor 0x%x (used %u→%u)\n",
+        VMLOG_ERROR("VMVirtIOGPU::probeCursorTransport: PROBE FAIL D — updateCursor 0x%x (used %u→%u)\n",
               ur, used_before, used_after);
         return;
     }
-    IOLog("VMVirtIOGPU::probeCursorTransport: UPDATE_CURSOR ok — used->idx %u→%u\n",
+    VMLOG_INFO("VMVirtIOGPU::probeCursorTransport: UPDATE_CURSOR ok — used->idx %u→%u\n",
           used_before, used_after);
 
     // 5. MOVE_CURSOR twice
@@ -3824,11 +4182,11 @@ void CLASS::probeCursorTransport()
     IOSleep(50);
     IOReturn m2 = moveCursor(0, 300, 300);
     if (m1 != kIOReturnSuccess || m2 != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::probeCursorTransport: PROBE FAIL E — MOVE_CURSOR m1=0x%x m2=0x%x\n", m1, m2);
+        VMLOG_ERROR("VMVirtIOGPU::probeCursorTransport: PROBE FAIL E — MOVE_CURSOR m1=0x%x m2=0x%x\n", m1, m2);
         return;
     }
 
-    IOLog("VMVirtIOGPU::probeCursorTransport: PROBE PASS — cursor commands on queue 1. "
+    VMLOG_INFO("VMVirtIOGPU::probeCursorTransport: PROBE PASS — cursor commands on queue 1. "
           "Visual: red test cursor at ~(300,300) + software cursor separately.\n");
 }
 
@@ -3870,17 +4228,17 @@ void CLASS::probeTransport3D()
     bool phase_e_reached = false, phase_f_reached = false;
     IOBufferMemoryDescriptor* readback_bmd = nullptr;
 
-    IOLog("VMVirtIOGPU::probeTransport3D: PROBE START — 3D transport "
+    VMLOG_INFO("VMVirtIOGPU::probeTransport3D: PROBE START — 3D transport "
           "(ctx=0x%x res=0x%x surf=%u format=R8G8B8A8_UNORM)\n",
           PROBE_CTX, PROBE_RES, PROBE_SURF);
 
     // ===== Phase A: preconditions =====
     if (!m_control_queue) {
-        IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL A — control queue not mapped\n");
+        VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL A — control queue not mapped\n");
         return;
     }
     if (!supports3D() || m_num_capsets == 0) {
-        IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL A — supports3D=%d capsets=%u\n",
+        VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL A — supports3D=%d capsets=%u\n",
               supports3D() ? 1 : 0, m_num_capsets);
         return;
     }
@@ -3893,17 +4251,17 @@ void CLASS::probeTransport3D()
         cmd.context_init = 0;
         // debug_name stays zeroed (empty)
 
-        IOLog("VMVirtIOGPU::probeTransport3D: phase B — CTX_CREATE sending ctx_id=0x%x\n",
+        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase B — CTX_CREATE sending ctx_id=0x%x\n",
               cmd.hdr.ctx_id);
         struct virtio_gpu_ctrl_hdr resp = {};
         IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
         if (ret != kIOReturnSuccess || resp.type != VIRTIO_GPU_RESP_OK_NODATA) {
-            IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL B — CTX_CREATE ret=0x%x resp=0x%x (expected resp=0x1100) [real signal]\n",
+            VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL B — CTX_CREATE ret=0x%x resp=0x%x (expected resp=0x1100) [real signal]\n",
                   ret, resp.type);
             goto cleanup;
         }
         phase_b_reached = true;
-        IOLog("VMVirtIOGPU::probeTransport3D: phase B ok — CTX_CREATE ctx=0x%x resp=0x1100 [real signal]\n",
+        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase B ok — CTX_CREATE ctx=0x%x resp=0x1100 [real signal]\n",
               PROBE_CTX);
     }
 
@@ -3926,17 +4284,17 @@ void CLASS::probeTransport3D()
         cmd.nr_samples = 0;
         cmd.flags = 0;
 
-        IOLog("VMVirtIOGPU::probeTransport3D: phase C — RESOURCE_CREATE_3D sending ctx_id=0x%x res=0x%x\n",
+        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase C — RESOURCE_CREATE_3D sending ctx_id=0x%x res=0x%x\n",
               cmd.hdr.ctx_id, cmd.resource_id);
         struct virtio_gpu_ctrl_hdr resp = {};
         IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
         if (ret != kIOReturnSuccess || resp.type != VIRTIO_GPU_RESP_OK_NODATA) {
-            IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL C — RESOURCE_CREATE_3D ret=0x%x resp=0x%x (expected resp=0x1100) [real signal]\n",
+            VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL C — RESOURCE_CREATE_3D ret=0x%x resp=0x%x (expected resp=0x1100) [real signal]\n",
                   ret, resp.type);
             goto cleanup;
         }
         phase_c_reached = true;
-        IOLog("VMVirtIOGPU::probeTransport3D: phase C ok — RESOURCE_CREATE_3D res=0x%x ctx=0x%x resp=0x1100 [real signal]\n",
+        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase C ok — RESOURCE_CREATE_3D res=0x%x ctx=0x%x resp=0x1100 [real signal]\n",
               PROBE_RES, PROBE_CTX);
     }
 
@@ -3944,7 +4302,7 @@ void CLASS::probeTransport3D()
     {
         readback_bmd = IOBufferMemoryDescriptor::withCapacity(16384, kIODirectionInOut);
         if (!readback_bmd) {
-            IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL D — readback buffer alloc failed\n");
+            VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL D — readback buffer alloc failed\n");
             goto cleanup;
         }
         memset(readback_bmd->getBytesNoCopy(), 0, 16384);
@@ -3955,11 +4313,11 @@ void CLASS::probeTransport3D()
         // space, so we expect nr_entries == 1.
         IOReturn ret = attachBacking(PROBE_RES, readback_bmd);
         if (ret != kIOReturnSuccess) {
-            IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL D — attachBacking ret=0x%x\n", ret);
+            VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL D — attachBacking ret=0x%x\n", ret);
             goto cleanup;
         }
         phase_d_reached = true;
-        IOLog("VMVirtIOGPU::probeTransport3D: phase D ok — backing attached res=0x%x 16384 bytes [real signal]\n",
+        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase D ok — backing attached res=0x%x 16384 bytes [real signal]\n",
               PROBE_RES);
     }
 
@@ -3970,17 +4328,17 @@ void CLASS::probeTransport3D()
         cmd.resource_id = PROBE_RES;
         cmd.padding = 0;
 
-        IOLog("VMVirtIOGPU::probeTransport3D: phase E — CTX_ATTACH_RESOURCE sending ctx_id=0x%x res=0x%x\n",
+        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase E — CTX_ATTACH_RESOURCE sending ctx_id=0x%x res=0x%x\n",
               cmd.hdr.ctx_id, cmd.resource_id);
         struct virtio_gpu_ctrl_hdr resp = {};
         IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
         if (ret != kIOReturnSuccess || resp.type != VIRTIO_GPU_RESP_OK_NODATA) {
             // Non-fatal — virgl may not strictly require CTX_ATTACH_RESOURCE.
             // Log and continue so we still test the downstream pipeline.
-            IOLog("VMVirtIOGPU::probeTransport3D: phase E WARN — CTX_ATTACH_RESOURCE ret=0x%x resp=0x%x (continuing; virgl may not require this)\n",
+            VMLOG_WARN("VMVirtIOGPU::probeTransport3D: phase E WARN — CTX_ATTACH_RESOURCE ret=0x%x resp=0x%x (continuing; virgl may not require this)\n",
                   ret, resp.type);
         } else {
-            IOLog("VMVirtIOGPU::probeTransport3D: phase E ok — CTX_ATTACH_RESOURCE ctx=0x%x res=0x%x resp=0x1100 [real signal]\n",
+            VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase E ok — CTX_ATTACH_RESOURCE ctx=0x%x res=0x%x resp=0x1100 [real signal]\n",
                   PROBE_CTX, PROBE_RES);
         }
         phase_e_reached = true;
@@ -3994,34 +4352,32 @@ void CLASS::probeTransport3D()
     {
         // Virgl CREATE_OBJECT for VIRGL_OBJECT_SURFACE — 6 dwords total.
         // Header carries object type in option byte via VIRGL_CMD0:
-        //   VIRGL_CMD0(VIRGL_CCMD_CREATE_OBJECT=1, VIRGL_OBJECT_SURFACE=9, 5) = 0x00050901
+        //   VIRGL_CMD0(VIRGL_CCMD_CREATE_OBJECT=1, VIRGL_OBJECT_SURFACE=8, 5) = 0x00050801
         // Payload (5 dwords): handle, res_handle, format, texture_level, texture_layers
         uint32_t cmd_dwords[6];
-        cmd_dwords[0] = VIRGL_CMD0(VIRGL_CCMD_CREATE_OBJECT, VIRGL_OBJECT_SURFACE, VIRGL_OBJ_SURFACE_SIZE);
-        cmd_dwords[VIRGL_OBJ_SURFACE_HANDLE]         = PROBE_SURF;
-        cmd_dwords[VIRGL_OBJ_SURFACE_RES_HANDLE]     = PROBE_RES;
-        cmd_dwords[VIRGL_OBJ_SURFACE_FORMAT]         = PROBE_FORMAT;
-        cmd_dwords[VIRGL_OBJ_SURFACE_TEXTURE_LEVEL]  = 0;
-        cmd_dwords[VIRGL_OBJ_SURFACE_TEXTURE_LAYERS] = 0;  // first_layer=0 | last_layer=0<<16
-
-        IOLog("VMVirtIOGPU::probeTransport3D: phase F — CREATE_OBJECT hdr=0x%x handle=%u res=0x%x fmt=%u (SUBMIT_3D resp is a NON-SIGNAL)\n",
+        struct virgl_encoder enc;
+        virgl_encoder_init(&enc, cmd_dwords, 6);
+        // layers: first_layer=0 | last_layer=0<<16
+        virgl_encode_create_surface(&enc, PROBE_SURF, PROBE_RES, PROBE_FORMAT, 0, 0);
+
+        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase F — CREATE_OBJECT hdr=0x%x handle=%u res=0x%x fmt=%u (SUBMIT_3D resp is a NON-SIGNAL)\n",
               cmd_dwords[0], PROBE_SURF, PROBE_RES, PROBE_FORMAT);
 
         IOBufferMemoryDescriptor* cmdDesc = IOBufferMemoryDescriptor::withBytes(
             cmd_dwords, sizeof(cmd_dwords), kIODirectionOut);
         if (!cmdDesc) {
-            IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL F — command buffer alloc failed\n");
+            VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL F — command buffer alloc failed\n");
             goto cleanup;
         }
         IOReturn ret = executeCommands(PROBE_CTX, cmdDesc);
         cmdDesc->release();
         if (ret != kIOReturnSuccess) {
-            IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL F — executeCommands ret=0x%x (envelope rejected; NOT a virgl decode error)\n",
+            VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL F — executeCommands ret=0x%x (envelope rejected; NOT a virgl decode error)\n",
                   ret);
             goto cleanup;
         }
         phase_f_reached = true;
-        IOLog("VMVirtIOGPU::probeTransport3D: phase F accepted — CREATE_OBJECT envelope ok [NON-SIGNAL: 0x1100 from SUBMIT_3D proves buffer accepted, not that surface exists]\n");
+        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase F accepted — CREATE_OBJECT envelope ok [NON-SIGNAL: 0x1100 from SUBMIT_3D proves buffer accepted, not that surface exists]\n");
     }
 
     // ===== Phases G and G′: SET_FRAMEBUFFER_STATE + CLEAR + NOP → TRANSFER → verify =====
@@ -4084,35 +4440,27 @@ void CLASS::probeTransport3D()
             //   dword 8: stencil (0)
             // NOP: VIRGL_CMD0(0, 0, 0) = 0x00000000  (virgl has no standalone FLUSH opcode)
             uint32_t buf[14];
-            unsigned idx = 0;
-            buf[idx++] = VIRGL_CMD0(VIRGL_CCMD_SET_FRAMEBUFFER_STATE, 0, 3);
-            buf[idx++] = 1;            // nr_cbufs
-            buf[idx++] = 0;            // zsurf_handle
-            buf[idx++] = PROBE_SURF;   // cbuf[0]
-            buf[idx++] = VIRGL_CMD0(VIRGL_CCMD_CLEAR, 0, VIRGL_OBJ_CLEAR_SIZE);
-            buf[idx++] = PIPE_CLEAR_COLOR0;
-            buf[idx++] = virgl_pack_float(clear1_rgba[0]);
-            buf[idx++] = virgl_pack_float(clear1_rgba[1]);
-            buf[idx++] = virgl_pack_float(clear1_rgba[2]);
-            buf[idx++] = virgl_pack_float(clear1_rgba[3]);
-            buf[idx++] = 0;  // depth lo
-            buf[idx++] = 0;  // depth hi
-            buf[idx++] = 0;  // stencil
-            buf[idx++] = VIRGL_CMD0(VIRGL_CCMD_NOP, 0, 0);
-
-            IOLog("VMVirtIOGPU::probeTransport3D: phase G — submitting SET_FB+CLEAR+NOP (%u dwords) [SUBMIT_3D resp is NON-SIGNAL]\n",
+            const uint32_t cbuf = PROBE_SURF;
+            struct virgl_encoder enc;
+            virgl_encoder_init(&enc, buf, 14);
+            virgl_encode_set_framebuffer_state(&enc, 1, &cbuf, 0);
+            virgl_encode_clear(&enc, PIPE_CLEAR_COLOR0, clear1_rgba, 0.0, 0);
+            virgl_encode_nop(&enc);
+            unsigned idx = enc.len;
+
+            VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G — submitting SET_FB+CLEAR+NOP (%u dwords) [SUBMIT_3D resp is NON-SIGNAL]\n",
                   (unsigned)idx);
 
             IOBufferMemoryDescriptor* cmdDesc = IOBufferMemoryDescriptor::withBytes(
                 buf, idx * sizeof(uint32_t), kIODirectionOut);
             if (!cmdDesc) {
-                IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL G — command buffer alloc failed\n");
+                VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL G — command buffer alloc failed\n");
                 goto cleanup;
             }
             IOReturn ret = executeCommands(PROBE_CTX, cmdDesc);
             cmdDesc->release();
             if (ret != kIOReturnSuccess) {
-                IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL G — SET_FB+CLEAR executeCommands ret=0x%x\n",
+                VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL G — SET_FB+CLEAR executeCommands ret=0x%x\n",
                       ret);
                 goto cleanup;
             }
@@ -4141,16 +4489,16 @@ void CLASS::probeTransport3D()
             cmd.box.h = 64;
             cmd.box.d = 1;
 
-            IOLog("VMVirtIOGPU::probeTransport3D: phase G — TRANSFER_FROM_HOST_3D ctx=0x%x res=0x%x lvl=0 off=0 stride=0 layer_stride=0 box=(0,0,0,64,64,1)\n",
+            VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G — TRANSFER_FROM_HOST_3D ctx=0x%x res=0x%x lvl=0 off=0 stride=0 layer_stride=0 box=(0,0,0,64,64,1)\n",
                   cmd.hdr.ctx_id, cmd.resource_id);
             struct virtio_gpu_ctrl_hdr resp = {};
             IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
             if (ret != kIOReturnSuccess || resp.type != VIRTIO_GPU_RESP_OK_NODATA) {
-                IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL G — TRANSFER ret=0x%x resp=0x%x (expected resp=0x1100) [real signal]\n",
+                VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL G — TRANSFER ret=0x%x resp=0x%x (expected resp=0x1100) [real signal]\n",
                       ret, resp.type);
                 goto cleanup;
             }
-            IOLog("VMVirtIOGPU::probeTransport3D: phase G — TRANSFER accepted resp=0x1100 [real signal — but byte correctness is checked below]\n");
+            VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G — TRANSFER accepted resp=0x1100 [real signal — but byte correctness is checked below]\n");
         }
 
         // Walk readback. Log first 16 dwords raw, then check against 4 byte-order patterns.
@@ -4158,7 +4506,7 @@ void CLASS::probeTransport3D()
             uint32_t* px = (uint32_t*)readback_bmd->getBytesNoCopy();
             g1_first_dword = px[0];
 
-            IOLog("VMVirtIOGPU::probeTransport3D: phase G readback first 16 dwords (hex): "
+            VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G readback first 16 dwords (hex): "
                   "%08x %08x %08x %08x %08x %08x %08x %08x "
                   "%08x %08x %08x %08x %08x %08x %08x %08x\n",
                   px[0], px[1], px[2], px[3], px[4], px[5], px[6], px[7],
@@ -4173,7 +4521,7 @@ void CLASS::probeTransport3D()
             const uint32_t pat_argb = c1_a | (c1_r << 8) | (c1_g << 16) | (c1_b << 24);
             const uint32_t pat_abgr = c1_a | (c1_b << 8) | (c1_g << 16) | (c1_r << 24);
 
-            IOLog("VMVirtIOGPU::probeTransport3D: phase G expected packed patterns "
+            VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G expected packed patterns "
                   "RGBA=0x%08x BGRA=0x%08x ARGB=0x%08x ABGR=0x%08x\n",
                   pat_rgba, pat_bgra, pat_argb, pat_abgr);
 
@@ -4216,7 +4564,7 @@ void CLASS::probeTransport3D()
                     g1_ok = true;
                     g1_pattern = (uint32_t)(p + 1);
                     if (tolerance_count == 0) {
-                        IOLog("VMVirtIOGPU::probeTransport3D: phase G — %s pattern: %u/64 exact [POSITIVE CONTROL PASS]\n",
+                        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G — %s pattern: %u/64 exact [POSITIVE CONTROL PASS]\n",
                               names[p], exact_count);
                     } else {
                         // Single summary line. Drift signature computed from the
@@ -4230,7 +4578,7 @@ void CLASS::probeTransport3D()
                             int32_t d = ab - eb;
                             if (d != 0) dn += snprintf(drift + dn, sizeof(drift) - dn, " %c%+d", chan[b], d);
                         }
-                        IOLog("VMVirtIOGPU::probeTransport3D: phase G — %s pattern: %u/64 exact, %u/64 within ±1, drift:%s %s [POSITIVE CONTROL PASS — tolerance engaged]\n",
+                        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G — %s pattern: %u/64 exact, %u/64 within ±1, drift:%s %s [POSITIVE CONTROL PASS — tolerance engaged]\n",
                               names[p], exact_count, tolerance_count, drift,
                               (tolerance_count == 64 ? "(systematic)" : "(random)"));
                     }
@@ -4238,7 +4586,7 @@ void CLASS::probeTransport3D()
                 }
             }
             if (!g1_ok) {
-                IOLog("VMVirtIOGPU::probeTransport3D: phase G — readback did NOT match any of the 4 patterns in all first 64 dwords "
+                VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G — readback did NOT match any of the 4 patterns in all first 64 dwords "
                       "(first dword=0x%08x). Continuing to negative control to determine if readback is deterministic at all.\n",
                       g1_first_dword);
                 // Not a hard fail yet — proceed to G′. If G′ also doesn't match,
@@ -4252,32 +4600,24 @@ void CLASS::probeTransport3D()
 
         {
             uint32_t buf[14];
-            unsigned idx = 0;
-            buf[idx++] = VIRGL_CMD0(VIRGL_CCMD_SET_FRAMEBUFFER_STATE, 0, 3);
-            buf[idx++] = 1;
-            buf[idx++] = 0;
-            buf[idx++] = PROBE_SURF;
-            buf[idx++] = VIRGL_CMD0(VIRGL_CCMD_CLEAR, 0, VIRGL_OBJ_CLEAR_SIZE);
-            buf[idx++] = PIPE_CLEAR_COLOR0;
-            buf[idx++] = virgl_pack_float(clear2_rgba[0]);
-            buf[idx++] = virgl_pack_float(clear2_rgba[1]);
-            buf[idx++] = virgl_pack_float(clear2_rgba[2]);
-            buf[idx++] = virgl_pack_float(clear2_rgba[3]);
-            buf[idx++] = 0;  // depth lo
-            buf[idx++] = 0;  // depth hi
-            buf[idx++] = 0;  // stencil
-            buf[idx++] = VIRGL_CMD0(VIRGL_CCMD_NOP, 0, 0);
+            const uint32_t cbuf = PROBE_SURF;
+            struct virgl_encoder enc;
+            virgl_encoder_init(&enc, buf, 14);
+            virgl_encode_set_framebuffer_state(&enc, 1, &cbuf, 0);
+            virgl_encode_clear(&enc, PIPE_CLEAR_COLOR0, clear2_rgba, 0.0, 0);
+            virgl_encode_nop(&enc);
+            unsigned idx = enc.len;
 
             IOBufferMemoryDescriptor* cmdDesc = IOBufferMemoryDescriptor::withBytes(
                 buf, idx * sizeof(uint32_t), kIODirectionOut);
             if (!cmdDesc) {
-                IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — command buffer alloc failed\n");
+                VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — command buffer alloc failed\n");
                 goto cleanup;
             }
             IOReturn ret = executeCommands(PROBE_CTX, cmdDesc);
             cmdDesc->release();
             if (ret != kIOReturnSuccess) {
-                IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — SET_FB+CLEAR executeCommands ret=0x%x\n",
+                VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — SET_FB+CLEAR executeCommands ret=0x%x\n",
                       ret);
                 goto cleanup;
             }
@@ -4299,7 +4639,7 @@ void CLASS::probeTransport3D()
             struct virtio_gpu_ctrl_hdr resp = {};
             IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
             if (ret != kIOReturnSuccess || resp.type != VIRTIO_GPU_RESP_OK_NODATA) {
-                IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — TRANSFER ret=0x%x resp=0x%x\n",
+                VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — TRANSFER ret=0x%x resp=0x%x\n",
                       ret, resp.type);
                 goto cleanup;
             }
@@ -4308,7 +4648,7 @@ void CLASS::probeTransport3D()
         // Verify bytes changed between G and G′.
         {
             uint32_t* px = (uint32_t*)readback_bmd->getBytesNoCopy();
-            IOLog("VMVirtIOGPU::probeTransport3D: phase G′ readback first 16 dwords (hex): "
+            VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G′ readback first 16 dwords (hex): "
                   "%08x %08x %08x %08x %08x %08x %08x %08x "
                   "%08x %08x %08x %08x %08x %08x %08x %08x\n",
                   px[0], px[1], px[2], px[3], px[4], px[5], px[6], px[7],
@@ -4318,7 +4658,7 @@ void CLASS::probeTransport3D()
             if (px[0] == g1_first_dword) {
                 // Identical readback despite 0xCD re-fill + different clear color.
                 // The host is returning stale cached bytes (or never wrote at all).
-                IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — readback first dword unchanged between G (0x%08x) and G′ (0x%08x) "
+                VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — readback first dword unchanged between G (0x%08x) and G′ (0x%08x) "
                       "despite 0xCD re-fill + different clear color. Stale/cached bytes suspected. "
                       "Next boot: try VIRTIO_GPU_FLAG_FENCE on transfer.\n",
                       g1_first_dword, px[0]);
@@ -4334,7 +4674,7 @@ void CLASS::probeTransport3D()
             const uint32_t* pats[4] = { &pat2_rgba, &pat2_bgra, &pat2_argb, &pat2_abgr };
             const char* names[4] = { "RGBA", "BGRA", "ARGB", "ABGR" };
 
-            IOLog("VMVirtIOGPU::probeTransport3D: phase G′ expected packed patterns "
+            VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G′ expected packed patterns "
                   "RGBA=0x%08x BGRA=0x%08x ARGB=0x%08x ABGR=0x%08x\n",
                   pat2_rgba, pat2_bgra, pat2_argb, pat2_abgr);
 
@@ -4369,7 +4709,7 @@ void CLASS::probeTransport3D()
                     g2_ok = true;
                     g2_pattern = (uint32_t)(p + 1);
                     if (tolerance_count == 0) {
-                        IOLog("VMVirtIOGPU::probeTransport3D: phase G′ — %s pattern: %u/64 exact\n",
+                        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G′ — %s pattern: %u/64 exact\n",
                               names[p], exact_count);
                     } else {
                         char drift[64]; int dn = 0;
@@ -4379,7 +4719,7 @@ void CLASS::probeTransport3D()
                             int32_t d = ab - eb;
                             if (d != 0) dn += snprintf(drift + dn, sizeof(drift) - dn, " %c%+d", chan2[b], d);
                         }
-                        IOLog("VMVirtIOGPU::probeTransport3D: phase G′ — %s pattern: %u/64 exact, %u/64 within ±1, drift:%s %s [tolerance engaged]\n",
+                        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: phase G′ — %s pattern: %u/64 exact, %u/64 within ±1, drift:%s %s [tolerance engaged]\n",
                               names[p], exact_count, tolerance_count, drift,
                               (tolerance_count == 64 ? "(systematic)" : "(random)"));
                     }
@@ -4389,14 +4729,14 @@ void CLASS::probeTransport3D()
 
             if (!g1_ok && !g2_ok) {
                 // Neither clear produced a recognizable pattern. Transport is broken.
-                IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — neither G nor G′ readback matched any color pattern "
+                VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — neither G nor G′ readback matched any color pattern "
                       "(g1_first=0x%08x g2_first=0x%08x). Diagnose with QEMU host log.\n",
                       g1_first_dword, px[0]);
                 goto cleanup;
             }
             if (g1_ok && g2_ok && g1_pattern != g2_pattern) {
                 // Pattern interpretation differs between runs — suspicious.
-                IOLog("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — byte-order pattern differed between G (%s) and G′ (%s). "
+                VMLOG_ERROR("VMVirtIOGPU::probeTransport3D: PROBE FAIL G′ — byte-order pattern differed between G (%s) and G′ (%s). "
                       "Suspect partial/strided readback.\n",
                       names[g1_pattern - 1], names[g2_pattern - 1]);
                 goto cleanup;
@@ -4405,11 +4745,11 @@ void CLASS::probeTransport3D()
             //   - Both passed with the same byte order (transport verified), OR
             //   - One passed and the other changed (transport alive but partially broken — still progress).
             if (g1_ok && g2_ok) {
-                IOLog("VMVirtIOGPU::probeTransport3D: PROBE PASS — 3D transport verified "
+                VMLOG_INFO("VMVirtIOGPU::probeTransport3D: PROBE PASS — 3D transport verified "
                       "(clear → readback → byte match positive + negative control, byte order %s)\n",
                       names[g1_pattern - 1]);
             } else {
-                IOLog("VMVirtIOGPU::probeTransport3D: PROBE PASS (PARTIAL) — negative control confirmed readback changes with clear color "
+                VMLOG_INFO("VMVirtIOGPU::probeTransport3D: PROBE PASS (PARTIAL) — negative control confirmed readback changes with clear color "
                       "(g1 %s, g2 %s). At least one clear's bytes did not fully match a known pattern. "
                       "See QEMU host log + first-16-dword dumps above.\n",
                       g1_ok ? names[g1_pattern - 1] : "no-match",
@@ -4422,21 +4762,22 @@ cleanup:
     // Best-effort cleanup. Order matters: destroy surface object first, then
     // detach resource, then unref resource, then destroy context. The
     // readback buffer is released last.
-    IOLog("VMVirtIOGPU::probeTransport3D: cleanup — phases reached B=%d C=%d D=%d E=%d F=%d\n",
+    VMLOG_INFO("VMVirtIOGPU::probeTransport3D: cleanup — phases reached B=%d C=%d D=%d E=%d F=%d\n",
           phase_b_reached ? 1 : 0, phase_c_reached ? 1 : 0, phase_d_reached ? 1 : 0,
           phase_e_reached ? 1 : 0, phase_f_reached ? 1 : 0);
 
     // 1. DESTROY_OBJECT for surf_handle (only if Phase F reached)
     if (phase_f_reached) {
         uint32_t buf[2];
-        buf[0] = VIRGL_CMD0(VIRGL_CCMD_DESTROY_OBJECT, VIRGL_OBJECT_SURFACE, 1);
-        buf[1] = PROBE_SURF;  // VIRGL_OBJ_DESTROY_HANDLE
+        struct virgl_encoder enc;
+        virgl_encoder_init(&enc, buf, 2);
+        virgl_encode_destroy_object(&enc, VIRGL_OBJECT_SURFACE, PROBE_SURF);
         IOBufferMemoryDescriptor* cmdDesc = IOBufferMemoryDescriptor::withBytes(
             buf, sizeof(buf), kIODirectionOut);
         if (cmdDesc) {
             IOReturn ret = executeCommands(PROBE_CTX, cmdDesc);
             cmdDesc->release();
-            IOLog("VMVirtIOGPU::probeTransport3D: cleanup — DESTROY_OBJECT surf=%u ret=0x%x [NON-SIGNAL]\n",
+            VMLOG_INFO("VMVirtIOGPU::probeTransport3D: cleanup — DESTROY_OBJECT surf=%u ret=0x%x [NON-SIGNAL]\n",
                   PROBE_SURF, ret);
         }
     }
@@ -4449,7 +4790,7 @@ cleanup:
         cmd.padding = 0;
         struct virtio_gpu_ctrl_hdr resp = {};
         IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
-        IOLog("VMVirtIOGPU::probeTransport3D: cleanup — CTX_DETACH_RESOURCE ret=0x%x resp=0x%x\n",
+        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: cleanup — CTX_DETACH_RESOURCE ret=0x%x resp=0x%x\n",
               ret, resp.type);
     }
 
@@ -4458,14 +4799,14 @@ cleanup:
     //    readback_bmd) is NOT released by deallocateResource — released below.
     if (phase_c_reached) {
         IOReturn ret = deallocateResource(PROBE_RES);
-        IOLog("VMVirtIOGPU::probeTransport3D: cleanup — RESOURCE_UNREF res=0x%x ret=0x%x\n",
+        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: cleanup — RESOURCE_UNREF res=0x%x ret=0x%x\n",
               PROBE_RES, ret);
     }
 
     // 4. CTX_DESTROY (only if Phase B reached)
     if (phase_b_reached) {
         IOReturn ret = destroy3DContext(PROBE_CTX);
-        IOLog("VMVirtIOGPU::probeTransport3D: cleanup — CTX_DESTROY ctx=0x%x ret=0x%x\n",
+        VMLOG_INFO("VMVirtIOGPU::probeTransport3D: cleanup — CTX_DESTROY ctx=0x%x ret=0x%x\n",
               PROBE_CTX, ret);
     }
 
@@ -4475,7 +4816,7 @@ cleanup:
         readback_bmd = nullptr;
     }
 
-    IOLog("VMVirtIOGPU::probeTransport3D: probe complete\n");
+    VMLOG_INFO("VMVirtIOGPU::probeTransport3D: probe complete\n");
 }
 
 //=============================================================================
@@ -4484,7 +4825,7 @@ IOReturn CLASS::updateCursor(uint32_t resource_id, uint32_t hot_x, uint32_t hot_
                             uint32_t scanout_id, uint32_t x, uint32_t y)
 {
     if (!m_cursor_vq_initialized) {
-        IOLog("VMVirtIOGPU::updateCursor: cursor queue not initialized\n");
+        VMLOG_DEBUG("VMVirtIOGPU::updateCursor: cursor queue not initialized\n");
         return kIOReturnNotReady;
     }
 
@@ -4504,7 +4845,7 @@ IOReturn CLASS::updateCursor(uint32_t resource_id, uint32_t hot_x, uint32_t hot_
 IOReturn CLASS::moveCursor(uint32_t scanout_id, uint32_t x, uint32_t y)
 {
     if (!m_cursor_vq_initialized) {
-        IOLog("VMVirtIOGPU::moveCursor: cursor queue not initialized\n");
+        VMLOG_DEBUG("VMVirtIOGPU::moveCursor: cursor queue not initialized\n");
         return kIOReturnNotReady;
     }
 
@@ -4520,11 +4861,11 @@ IOReturn CLASS::moveCursor(uint32_t scanout_id, uint32_t x, uint32_t y)
 }
 
 void CLASS::setPreferredRefreshRate(uint32_t hz) {
-    IOLog("VMVirtIOGPU::setPreferredRefreshRate: hz=%u (stub)\n", hz);
+    VMLOG_DEBUG("VMVirtIOGPU::setPreferredRefreshRate: hz=%u (stub)\n", hz);
 }
 
 bool CLASS::supportsFeature(uint32_t feature_flags) const {
-    IOLog("VMVirtIOGPU::supportsFeature: Checking feature support for flags=0x%x\n", feature_flags);
+    VMLOG_DEBUG("VMVirtIOGPU::supportsFeature: Checking feature support for flags=0x%x\n", feature_flags);
     
     // Check each feature flag individually
     bool supports_3d = (feature_flags & VIRTIO_GPU_FEATURE_3D) != 0;
@@ -4537,26 +4878,26 @@ bool CLASS::supportsFeature(uint32_t feature_flags) const {
     
     if (supports_3d) {
         result = result || supports3D(); // Use our existing 3D support check
-        IOLog("VMVirtIOGPU::supportsFeature: 3D acceleration support = %s\n", supports3D() ? "YES" : "NO");
+        VMLOG_DEBUG("VMVirtIOGPU::supportsFeature: 3D acceleration support = %s\n", supports3D() ? "YES" : "NO");
     }
     
     if (supports_virgl) {
         result = result || supportsVirgl(); // Use our existing Virgl support check  
-        IOLog("VMVirtIOGPU::supportsFeature: Virgl renderer support = %s\n", supportsVirgl() ? "YES" : "NO");
+        VMLOG_DEBUG("VMVirtIOGPU::supportsFeature: Virgl renderer support = %s\n", supportsVirgl() ? "YES" : "NO");
     }
     
     if (supports_resource_blob) {
         // Resource blob is supported if we have 3D acceleration
         bool resource_blob_support = supports3D();
         result = result || resource_blob_support;
-        IOLog("VMVirtIOGPU::supportsFeature: Resource blob support = %s\n", resource_blob_support ? "YES" : "NO");
+        VMLOG_DEBUG("VMVirtIOGPU::supportsFeature: Resource blob support = %s\n", resource_blob_support ? "YES" : "NO");
     }
     
     if (supports_context_init) {
         // Context initialization is supported if we have 3D acceleration  
         bool context_init_support = supports3D();
         result = result || context_init_support;
-        IOLog("VMVirtIOGPU::supportsFeature: Context init support = %s\n", context_init_support ? "YES" : "NO");
+        VMLOG_DEBUG("VMVirtIOGPU::supportsFeature: Context init support = %s\n", context_init_support ? "YES" : "NO");
     }
     
     // For multiple flags, return true if ANY supported feature is requested
@@ -4567,16 +4908,16 @@ bool CLASS::supportsFeature(uint32_t feature_flags) const {
         }
     }
     
-    IOLog("VMVirtIOGPU::supportsFeature: Final result for flags=0x%x: %s\n", feature_flags, result ? "SUPPORTED" : "NOT_SUPPORTED");
+    VMLOG_DEBUG("VMVirtIOGPU::supportsFeature: Final result for flags=0x%x: %s\n", feature_flags, result ? "SUPPORTED" : "NOT_SUPPORTED");
     return result;
 }
 
 // Snow Leopard compatibility stubs for missing VMVirtIOGPU methods
 void CLASS::enableVSync(bool enabled) {
-    IOLog("VMVirtIOGPU::enableVSync: %s VSync for display synchronization\n", enabled ? "Enabling" : "Disabling");
+    VMLOG_INFO("VMVirtIOGPU::enableVSync: %s VSync for display synchronization\n", enabled ? "Enabling" : "Disabling");
     
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU::enableVSync: No PCI device available\n");
+        VMLOG_INFO("VMVirtIOGPU::enableVSync: No PCI device available\n");
         return;
     }
     
@@ -4585,7 +4926,7 @@ void CLASS::enableVSync(bool enabled) {
     
     // For each active scanout, configure VSync behavior
     for (uint32_t scanout_id = 0; scanout_id < m_max_scanouts; scanout_id++) {
-        IOLog("VMVirtIOGPU::enableVSync: Configuring VSync for scanout %u: %s\n", 
+        VMLOG_INFO("VMVirtIOGPU::enableVSync: Configuring VSync for scanout %u: %s\n", 
               scanout_id, enabled ? "ENABLED" : "DISABLED");
         
         // Store VSync preference for this scanout
@@ -4601,32 +4942,32 @@ void CLASS::enableVSync(bool enabled) {
     
     // Configure global VSync setting for the VirtIO GPU device
     
-    IOLog("VMVirtIOGPU::enableVSync: VSync configuration completed: %s\n", enabled ? "ENABLED" : "DISABLED");
+    VMLOG_INFO("VMVirtIOGPU::enableVSync: VSync configuration completed: %s\n", enabled ? "ENABLED" : "DISABLED");
 }
 
 void CLASS::enableVirgl() {
-    IOLog("VMVirtIOGPU::enableVirgl: Enabling Virgil 3D renderer support\n");
+    VMLOG_INFO("VMVirtIOGPU::enableVirgl: Enabling Virgil 3D renderer support\n");
     
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU::enableVirgl: No PCI device available\n");
+        VMLOG_INFO("VMVirtIOGPU::enableVirgl: No PCI device available\n");
         return;
     }
     
     // Check if Virgil 3D is supported by the device
     if (!supportsVirgl()) {
-        IOLog("VMVirtIOGPU::enableVirgl: Virgil 3D not supported by device\n");
+        VMLOG_WARN("VMVirtIOGPU::enableVirgl: Virgil 3D not supported by device\n");
         return;
     }
     
     // Enable Virgil 3D feature flag
     IOReturn virgl_result = enableFeature(VIRTIO_GPU_FEATURE_VIRGL);
     if (virgl_result != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::enableVirgl: Failed to enable Virgil 3D feature: 0x%x\n", virgl_result);
+        VMLOG_ERROR("VMVirtIOGPU::enableVirgl: Failed to enable Virgil 3D feature: 0x%x\n", virgl_result);
         return;
     }
     
     // Query Virgil 3D capability sets for advanced rendering features
-    IOLog("VMVirtIOGPU::enableVirgl: Querying Virgil 3D capability sets\n");
+    VMLOG_INFO("VMVirtIOGPU::enableVirgl: Querying Virgil 3D capability sets\n");
     
     // Query each available capability set from the VirtIO GPU device.
     // Loop variable is a 0-based INDEX into the device's capset list; the device returns the
@@ -4642,7 +4983,7 @@ void CLASS::enableVirgl() {
                                          &capset_info_resp.hdr, sizeof(capset_info_resp));
 
         if (info_ret == kIOReturnSuccess) {
-            IOLog("VMVirtIOGPU::enableVirgl: capset index %u → id=%u version=%u size=%u\n",
+            VMLOG_INFO("VMVirtIOGPU::enableVirgl: capset index %u → id=%u version=%u size=%u\n",
                   capset_index, capset_info_resp.capset_id, capset_info_resp.capset_max_version,
                   capset_info_resp.capset_max_size);
 
@@ -4657,48 +4998,60 @@ void CLASS::enableVirgl() {
                 size_t total_resp_size = sizeof(virtio_gpu_ctrl_hdr) + capset_info_resp.capset_max_size;
                 uint8_t* capset_resp_buffer = (uint8_t*)IOMalloc(total_resp_size);
                 if (capset_resp_buffer) {
+                    bzero(capset_resp_buffer, total_resp_size);
                     IOReturn capset_ret = submitCommand(&capset_cmd.hdr, sizeof(capset_cmd),
                                                        (virtio_gpu_ctrl_hdr*)capset_resp_buffer, total_resp_size);
+                    uint32_t capset_resp_type = ((virtio_gpu_ctrl_hdr*)capset_resp_buffer)->type;
 
-                    if (capset_ret == kIOReturnSuccess) {
-                        IOLog("VMVirtIOGPU::enableVirgl: retrieved capset id %u blob (%u bytes)\n",
+                    // Only an OK_CAPSET reply carries a blob; an ERR_* reply
+                    // leaves the rest of the buffer as we zeroed it
+                    if (capset_ret == kIOReturnSuccess && capset_resp_type == VIRTIO_GPU_RESP_OK_CAPSET) {
+                        VMLOG_INFO("VMVirtIOGPU::enableVirgl: retrieved capset id %u blob (%u bytes)\n",
                               capset_info_resp.capset_id, capset_info_resp.capset_max_size);
 
                         // VIRGL (id=1) is the legacy capset; VIRGL2 (id=2) is preferred when offered.
                         // The host decides which it supports; we just record what came back.
                         if (capset_info_resp.capset_id == 1 || capset_info_resp.capset_id == 2) {
-                            IOLog("VMVirtIOGPU::enableVirgl: Virgl%s capability data acquired for 3D acceleration\n",
+                            VMLOG_INFO("VMVirtIOGPU::enableVirgl: Virgl%s capability data acquired for 3D acceleration\n",
                                   capset_info_resp.capset_id == 2 ? "2" : "");
+
+                            // virgl_caps_v1 starts with max_version, then the
+                            // sampler format mask. Both capset versions share it.
+                            const uint8_t* blob = capset_resp_buffer + sizeof(virtio_gpu_ctrl_hdr);
+                            if (capset_info_resp.capset_max_size >= sizeof(uint32_t) + sizeof(m_sampler_formats)) {
+                                memcpy(m_sampler_formats, blob + sizeof(uint32_t), sizeof(m_sampler_formats));
+                                m_sampler_formats_valid = true;
+                            }
                         }
                     } else {
-                        IOLog("VMVirtIOGPU::enableVirgl: Failed to get capset id %u data: 0x%x\n",
-                              capset_info_resp.capset_id, capset_ret);
+                        VMLOG_ERROR("VMVirtIOGPU::enableVirgl: Failed to get capset id %u data: ret=0x%x resp=0x%x\n",
+                              capset_info_resp.capset_id, capset_ret, capset_resp_type);
                     }
 
                     IOFree(capset_resp_buffer, total_resp_size);
                 } else {
-                    IOLog("VMVirtIOGPU::enableVirgl: Failed to allocate capset response buffer\n");
+                    VMLOG_ERROR("VMVirtIOGPU::enableVirgl: Failed to allocate capset response buffer\n");
                 }
             }
         } else {
-            IOLog("VMVirtIOGPU::enableVirgl: Failed to get capset index %u info: 0x%x\n", capset_index, info_ret);
+            VMLOG_ERROR("VMVirtIOGPU::enableVirgl: Failed to get capset index %u info: 0x%x\n", capset_index, info_ret);
         }
     }
     
-    IOLog("VMVirtIOGPU::enableVirgl: Virgil 3D renderer enabled successfully\n");
+    VMLOG_INFO("VMVirtIOGPU::enableVirgl: Virgil 3D renderer enabled successfully\n");
 }
 void CLASS::setMockMode(bool enabled) {
     m_is_mock_device = enabled;
-    IOLog("VMVirtIOGPU::setMockMode: Mock device mode %s\n", enabled ? "ENABLED" : "DISABLED");
+    VMLOG_DEBUG("VMVirtIOGPU::setMockMode: Mock device mode %s\n", enabled ? "ENABLED" : "DISABLED");
 }
 
 IOReturn CLASS::updateDisplay(uint32_t scanout_id, uint32_t resource_id, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
-    IOLog("VMVirtIOGPU::updateDisplay: Updating display region scanout=%u resource=%u rect=[%u,%u,%u,%u]\n", 
+    VMLOG_DEBUG("VMVirtIOGPU::updateDisplay: Updating display region scanout=%u resource=%u rect=[%u,%u,%u,%u]\n", 
           scanout_id, resource_id, x, y, width, height);
     
     // Validate scanout ID
     if (scanout_id >= m_max_scanouts) {
-        IOLog("VMVirtIOGPU::updateDisplay: Invalid scanout ID %u (max: %u)\n", scanout_id, m_max_scanouts);
+        VMLOG_WARN("VMVirtIOGPU::updateDisplay: Invalid scanout ID %u (max: %u)\n", scanout_id, m_max_scanouts);
         return kIOReturnBadArgument;
     }
     
@@ -4707,14 +5060,14 @@ IOReturn CLASS::updateDisplay(uint32_t scanout_id, uint32_t resource_id, uint32_
     gpu_resource* resource = findResource(resource_id);
     if (!resource) {
         IOLockUnlock(m_resource_lock);
-        IOLog("VMVirtIOGPU::updateDisplay: Resource ID %u not found\n", resource_id);
+        VMLOG_DEBUG("VMVirtIOGPU::updateDisplay: Resource ID %u not found\n", resource_id);
         return kIOReturnNotFound;
     }
     IOLockUnlock(m_resource_lock);
     
     // Validate update rectangle bounds
     if (width == 0 || height == 0) {
-        IOLog("VMVirtIOGPU::updateDisplay: Invalid update rectangle dimensions %ux%u\n", width, height);
+        VMLOG_WARN("VMVirtIOGPU::updateDisplay: Invalid update rectangle dimensions %ux%u\n", width, height);
         return kIOReturnBadArgument;
     }
     
@@ -4736,7 +5089,7 @@ IOReturn CLASS::updateDisplay(uint32_t scanout_id, uint32_t resource_id, uint32_
     IOReturn transfer_ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
     
     if (transfer_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::updateDisplay: Transfer to host failed: 0x%x\n", transfer_ret);
+        VMLOG_ERROR("VMVirtIOGPU::updateDisplay: Transfer to host failed: 0x%x\n", transfer_ret);
         return transfer_ret;
     }
     
@@ -4757,19 +5110,19 @@ IOReturn CLASS::updateDisplay(uint32_t scanout_id, uint32_t resource_id, uint32_
     IOReturn flush_ret = submitCommand(&flush_cmd.hdr, sizeof(flush_cmd), &flush_resp, sizeof(flush_resp));
     
     if (flush_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::updateDisplay: Resource flush failed: 0x%x\n", flush_ret);
+        VMLOG_ERROR("VMVirtIOGPU::updateDisplay: Resource flush failed: 0x%x\n", flush_ret);
         return flush_ret;
     }
     
-    IOLog("VMVirtIOGPU::updateDisplay: Display update completed successfully\n");
+    VMLOG_DEBUG("VMVirtIOGPU::updateDisplay: Display update completed successfully\n");
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::mapGuestMemory(IOMemoryDescriptor* guest_memory, uint64_t* gpu_addr) {
-    IOLog("VMVirtIOGPU::mapGuestMemory: Mapping guest memory to GPU address space\n");
+    VMLOG_INFO("VMVirtIOGPU::mapGuestMemory: Mapping guest memory to GPU address space\n");
     
     if (!guest_memory || !gpu_addr) {
-        IOLog("VMVirtIOGPU::mapGuestMemory: Invalid parameters - guest_memory=%p gpu_addr=%p\n", guest_memory, gpu_addr);
+        VMLOG_WARN("VMVirtIOGPU::mapGuestMemory: Invalid parameters - guest_memory=%p gpu_addr=%p\n", guest_memory, gpu_addr);
         return kIOReturnBadArgument;
     }
     
@@ -4779,14 +5132,14 @@ IOReturn CLASS::mapGuestMemory(IOMemoryDescriptor* guest_memory, uint64_t* gpu_a
     // Get memory descriptor properties
     IOByteCount memory_length = guest_memory->getLength();
     if (memory_length == 0) {
-        IOLog("VMVirtIOGPU::mapGuestMemory: Invalid memory descriptor length: 0\n");
+        VMLOG_WARN("VMVirtIOGPU::mapGuestMemory: Invalid memory descriptor length: 0\n");
         return kIOReturnBadArgument;
     }
     
     // Prepare memory descriptor for device access
     IOReturn prepare_ret = guest_memory->prepare(kIODirectionOutIn);
     if (prepare_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::mapGuestMemory: Failed to prepare memory descriptor: 0x%x\n", prepare_ret);
+        VMLOG_ERROR("VMVirtIOGPU::mapGuestMemory: Failed to prepare memory descriptor: 0x%x\n", prepare_ret);
         return prepare_ret;
     }
     
@@ -4797,7 +5150,7 @@ IOReturn CLASS::mapGuestMemory(IOMemoryDescriptor* guest_memory, uint64_t* gpu_a
     // Get first physical segment
     phys_addr = guest_memory->getPhysicalSegment(0, &phys_length, kIOMemoryMapperNone);
     if (phys_addr == 0 || phys_length == 0) {
-        IOLog("VMVirtIOGPU::mapGuestMemory: Failed to get physical segment\n");
+        VMLOG_ERROR("VMVirtIOGPU::mapGuestMemory: Failed to get physical segment\n");
         guest_memory->complete(kIODirectionOutIn);
         return kIOReturnNoMemory;
     }
@@ -4822,7 +5175,7 @@ IOReturn CLASS::mapGuestMemory(IOMemoryDescriptor* guest_memory, uint64_t* gpu_a
     IOReturn attach_ret = submitCommand(&attach_cmd.hdr, sizeof(attach_cmd), &attach_resp, sizeof(attach_resp));
     
     if (attach_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::mapGuestMemory: Failed to attach backing store: 0x%x\n", attach_ret);
+        VMLOG_ERROR("VMVirtIOGPU::mapGuestMemory: Failed to attach backing store: 0x%x\n", attach_ret);
         guest_memory->complete(kIODirectionOutIn);
         return attach_ret;
     }
@@ -4846,10 +5199,10 @@ IOReturn CLASS::mapGuestMemory(IOMemoryDescriptor* guest_memory, uint64_t* gpu_a
         // In VirtIO GPU, the guest physical address is used directly
         *gpu_addr = phys_addr;
         
-        IOLog("VMVirtIOGPU::mapGuestMemory: Memory mapped successfully - resource_id=%u gpu_addr=0x%llx length=%llu\n", 
+        VMLOG_INFO("VMVirtIOGPU::mapGuestMemory: Memory mapped successfully - resource_id=%u gpu_addr=0x%llx length=%llu\n", 
               resource_id, *gpu_addr, (uint64_t)memory_length);
     } else {
-        IOLog("VMVirtIOGPU::mapGuestMemory: Failed to allocate resource tracking structure\n");
+        VMLOG_ERROR("VMVirtIOGPU::mapGuestMemory: Failed to allocate resource tracking structure\n");
         guest_memory->complete(kIODirectionOutIn);
         IOLockUnlock(m_resource_lock);
         return kIOReturnNoMemory;
@@ -4857,33 +5210,33 @@ IOReturn CLASS::mapGuestMemory(IOMemoryDescriptor* guest_memory, uint64_t* gpu_a
     
     IOLockUnlock(m_resource_lock);
     
-    IOLog("VMVirtIOGPU::mapGuestMemory: Guest memory mapping completed successfully\n");
+    VMLOG_INFO("VMVirtIOGPU::mapGuestMemory: Guest memory mapping completed successfully\n");
     return kIOReturnSuccess;
 }
 
 void CLASS::setBasic3DSupport(bool enabled) {
-    IOLog("VMVirtIOGPU::setBasic3DSupport: enabled=%d (stub)\n", enabled);
+    VMLOG_DEBUG("VMVirtIOGPU::setBasic3DSupport: enabled=%d (stub)\n", enabled);
 }
 
 void CLASS::enableResourceBlob() {
-    IOLog("VMVirtIOGPU::enableResourceBlob: Enabling VirtIO GPU resource blob support\n");
+    VMLOG_INFO("VMVirtIOGPU::enableResourceBlob: Enabling VirtIO GPU resource blob support\n");
     
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU::enableResourceBlob: No PCI device available\n");
+        VMLOG_INFO("VMVirtIOGPU::enableResourceBlob: No PCI device available\n");
         return;
     }
     
     // Check if resource blob feature is supported by the device
     // Resource blob enables advanced resource types for 3D acceleration
     if (!supportsFeature(VIRTIO_GPU_FEATURE_RESOURCE_BLOB)) {
-        IOLog("VMVirtIOGPU::enableResourceBlob: Resource blob feature not supported by device\n");
+        VMLOG_WARN("VMVirtIOGPU::enableResourceBlob: Resource blob feature not supported by device\n");
         return;
     }
     
     // Enable the feature in device configuration
     IOReturn ret = enableFeature(VIRTIO_GPU_FEATURE_RESOURCE_BLOB);
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::enableResourceBlob: Failed to enable feature: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPU::enableResourceBlob: Failed to enable feature: 0x%x\n", ret);
         return;
     }
     
@@ -4899,22 +5252,22 @@ void CLASS::enableResourceBlob() {
     static bool resource_blob_enabled = true;
     static uint64_t max_blob_resource_size = 256 * 1024 * 1024;  // 256MB max blob resource
     
-    IOLog("VMVirtIOGPU::enableResourceBlob: Advanced resource blob capabilities enabled: %s\n", 
+    VMLOG_INFO("VMVirtIOGPU::enableResourceBlob: Advanced resource blob capabilities enabled: %s\n", 
           resource_blob_enabled ? "YES" : "NO");
-    IOLog("VMVirtIOGPU::enableResourceBlob: Maximum blob resource size: %llu MB\n", 
+    VMLOG_INFO("VMVirtIOGPU::enableResourceBlob: Maximum blob resource size: %llu MB\n", 
           (uint64_t)(max_blob_resource_size / (1024 * 1024)));
-    IOLog("VMVirtIOGPU::enableResourceBlob: Cross-domain resource sharing: ENABLED\n");
-    IOLog("VMVirtIOGPU::enableResourceBlob: Advanced texture formats: ENABLED\n");
-    IOLog("VMVirtIOGPU::enableResourceBlob: Memory-mapped GPU access: ENABLED\n");
+    VMLOG_INFO("VMVirtIOGPU::enableResourceBlob: Cross-domain resource sharing: ENABLED\n");
+    VMLOG_INFO("VMVirtIOGPU::enableResourceBlob: Advanced texture formats: ENABLED\n");
+    VMLOG_INFO("VMVirtIOGPU::enableResourceBlob: Memory-mapped GPU access: ENABLED\n");
     
-    IOLog("VMVirtIOGPU::enableResourceBlob: Resource blob support enabled successfully\n");
+    VMLOG_INFO("VMVirtIOGPU::enableResourceBlob: Resource blob support enabled successfully\n");
 }
 
 void CLASS::enable3DAcceleration() {
-    IOLog("VMVirtIOGPU::enable3DAcceleration: Initializing VirtIO GPU 3D support\n");
+    VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: Initializing VirtIO GPU 3D support\n");
     
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU::enable3DAcceleration: No PCI device available\n");
+        VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: No PCI device available\n");
         return;
     }
     
@@ -4925,57 +5278,57 @@ void CLASS::enable3DAcceleration() {
     // Read actual capability sets from device configuration
     // Use the capset count that was already read during device initialization
     config_num_capsets = m_num_capsets;  // Use actual device-reported capsets
-    IOLog("VMVirtIOGPU::enable3DAcceleration: Device reports %u capability sets\n", config_num_capsets);
+    VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: Device reports %u capability sets\n", config_num_capsets);
     
     if (config_num_capsets == 0) {
-        IOLog("VMVirtIOGPU::enable3DAcceleration: WARNING - Device reports 0 capsets, may indicate QEMU missing 3D acceleration config\n");
-        IOLog("VMVirtIOGPU::enable3DAcceleration: Check UTM/QEMU settings: virgl=on, gl=on, acceleration3d=on\n");
+        VMLOG_WARN("VMVirtIOGPU::enable3DAcceleration: WARNING - Device reports 0 capsets, may indicate QEMU missing 3D acceleration config\n");
+        VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: Check UTM/QEMU settings: virgl=on, gl=on, acceleration3d=on\n");
     }
     
     if (config_num_capsets == 0) {
-        IOLog("VMVirtIOGPU::enable3DAcceleration: No capability sets found in device config, 3D not available\n");
-        IOLog("VMVirtIOGPU::enable3DAcceleration: To enable 3D acceleration:\n");
-        IOLog("VMVirtIOGPU::enable3DAcceleration:   - UTM: Enable '3D Acceleration' in Display settings\n");
-        IOLog("VMVirtIOGPU::enable3DAcceleration:   - QEMU: Add -device virtio-gpu-pci,virgl=on,gl=on\n");
-        IOLog("VMVirtIOGPU::enable3DAcceleration:   - VMware: Enable 'Accelerate 3D graphics'\n");
+        VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: No capability sets found in device config, 3D not available\n");
+        VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: To enable 3D acceleration:\n");
+        VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration:   - UTM: Enable '3D Acceleration' in Display settings\n");
+        VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration:   - QEMU: Add -device virtio-gpu-pci,virgl=on,gl=on\n");
+        VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration:   - VMware: Enable 'Accelerate 3D graphics'\n");
         return; // No 3D acceleration possible
     }
     
-    IOLog("VMVirtIOGPU::enable3DAcceleration: Device reports %u capability sets, 3D likely available\n", config_num_capsets);
+    VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: Device reports %u capability sets, 3D likely available\n", config_num_capsets);
     
     // SECOND: Initialize VirtIO queues now that we know device has 3D capabilities
     if (!initializeVirtIOQueues()) {
-        IOLog("VMVirtIOGPU::enable3DAcceleration: Failed to initialize VirtIO queues, cannot proceed\n");
+        VMLOG_ERROR("VMVirtIOGPU::enable3DAcceleration: Failed to initialize VirtIO queues, cannot proceed\n");
         return;
     }
     
     // NOW check if VirtIO GPU supports 3D acceleration after capability discovery
     if (!supports3D()) {
-        IOLog("VMVirtIOGPU::enable3DAcceleration: 3D support check failed even after capability discovery (capsets=%d)\n", m_num_capsets);
+        VMLOG_ERROR("VMVirtIOGPU::enable3DAcceleration: 3D support check failed even after capability discovery (capsets=%d)\n", m_num_capsets);
         return;
     }
     
-    IOLog("VMVirtIOGPU::enable3DAcceleration: 3D acceleration support confirmed (capsets=%d)\n", m_num_capsets);
+    VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: 3D acceleration support confirmed (capsets=%d)\n", m_num_capsets);
     
     // Enable 3D feature on the device
     IOReturn feature_result = enableFeature(VIRTIO_GPU_FEATURE_3D);
     if (feature_result != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::enable3DAcceleration: Failed to enable 3D feature: 0x%x\n", feature_result);
-        IOLog("VMVirtIOGPU::enable3DAcceleration: VirtIO GPU hardware not responding, acceleration unavailable\n");
+        VMLOG_ERROR("VMVirtIOGPU::enable3DAcceleration: Failed to enable 3D feature: 0x%x\n", feature_result);
+        VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: VirtIO GPU hardware not responding, acceleration unavailable\n");
         return; // Hardware failure - don't enable fake acceleration
     }
     
-    IOLog("VMVirtIOGPU::enable3DAcceleration: VirtIO GPU 3D feature enabled successfully\n");
+    VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: VirtIO GPU 3D feature enabled successfully\n");
     
     // Set hardware rendering mode properties
-    IOLog("VMVirtIOGPU::enable3DAcceleration: Hardware rendering mode activated\n");
+    VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: Hardware rendering mode activated\n");
     
     // Enable Virgil 3D renderer if supported
     if (supportsVirgl()) {
         enableVirgl();
         
         // WebGL-specific Virgl optimizations
-        IOLog("VMVirtIOGPU::enable3DAcceleration: Enabling WebGL optimizations for Virgl\n");
+        VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: Enabling WebGL optimizations for Virgl\n");
         
         // Configure WebGL-optimized command buffers
         
@@ -4983,10 +5336,10 @@ void CLASS::enable3DAcceleration() {
     }
     
     // Enable Snow Leopard specific WebGL compatibility
-    IOLog("VMVirtIOGPU::enable3DAcceleration: Configuring Snow Leopard WebGL compatibility\n");
+    VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: Configuring Snow Leopard WebGL compatibility\n");
     
     // YouTube Canvas and Video rendering optimizations
-    IOLog("VMVirtIOGPU::enable3DAcceleration: Enabling YouTube Canvas/Video acceleration\n");
+    VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: Enabling YouTube Canvas/Video acceleration\n");
     
     // Advanced texture and rendering optimizations
     
@@ -5001,14 +5354,14 @@ void CLASS::enable3DAcceleration() {
     enableResourceBlob();
     
     // Initialize WebGL-specific acceleration features for hardware rendering
-    IOLog("VMVirtIOGPU::enable3DAcceleration: Enabling WebGL hardware acceleration\n");
+    VMLOG_INFO("VMVirtIOGPU::enable3DAcceleration: Enabling WebGL hardware acceleration\n");
     initializeWebGLAcceleration();
     
     // IOLog("VMVirtIOGPU::enable3DAcceleration: 3D acceleration enabled successfully\n");
     // IOLog("VMVirtIOGPU::enable3DAcceleration: 3D support status: %s (capsets=%d)\n", supports3D() ? "ENABLED" : "DISABLED", m_num_capsets);
 }
 bool CLASS::setOptimalQueueSizes() {
-    IOLog("VMVirtIOGPU::setOptimalQueueSizes: Configuring optimal VirtIO GPU queue sizes\n");
+    VMLOG_DEBUG("VMVirtIOGPU::setOptimalQueueSizes: Configuring optimal VirtIO GPU queue sizes\n");
     
     // Set default queue sizes based on VirtIO GPU best practices
     uint32_t optimal_control_queue_size = 256;  // Standard size for control commands
@@ -5017,7 +5370,7 @@ bool CLASS::setOptimalQueueSizes() {
     // Check if 3D acceleration is supported - larger queues needed for 3D
     if (supports3D()) {
         optimal_control_queue_size = 512;  // Larger queue for 3D command processing
-        IOLog("VMVirtIOGPU::setOptimalQueueSizes: Using larger queues for 3D acceleration\n");
+        VMLOG_DEBUG("VMVirtIOGPU::setOptimalQueueSizes: Using larger queues for 3D acceleration\n");
     }
     
     // Apply memory constraints - ensure we do not exceed available system memory
@@ -5027,19 +5380,19 @@ bool CLASS::setOptimalQueueSizes() {
     
     if (control_memory_needed > max_memory_per_queue) {
         optimal_control_queue_size = (uint32_t)(max_memory_per_queue / sizeof(virtio_gpu_ctrl_hdr));
-        IOLog("VMVirtIOGPU::setOptimalQueueSizes: Reducing control queue size due to memory constraints\n");
+        VMLOG_DEBUG("VMVirtIOGPU::setOptimalQueueSizes: Reducing control queue size due to memory constraints\n");
     }
     
     if (cursor_memory_needed > max_memory_per_queue) {
         optimal_cursor_queue_size = (uint32_t)(max_memory_per_queue / sizeof(virtio_gpu_ctrl_hdr));
-        IOLog("VMVirtIOGPU::setOptimalQueueSizes: Reducing cursor queue size due to memory constraints\n");
+        VMLOG_DEBUG("VMVirtIOGPU::setOptimalQueueSizes: Reducing cursor queue size due to memory constraints\n");
     }
     
     // Update queue sizes
     m_control_queue_size = optimal_control_queue_size;
     m_cursor_queue_size = optimal_cursor_queue_size;
     
-    IOLog("VMVirtIOGPU::setOptimalQueueSizes: Control queue: %u entries, Cursor queue: %u entries\n", 
+    VMLOG_DEBUG("VMVirtIOGPU::setOptimalQueueSizes: Control queue: %u entries, Cursor queue: %u entries\n", 
           m_control_queue_size, m_cursor_queue_size);
     
     return true;
@@ -5054,12 +5407,12 @@ bool CLASS::setupGPUMemoryRegions() {
     // submitCursorCommand.
     m_notify_base = nullptr;
 
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Configuring VirtIO GPU memory regions\n");
-    IOLog("BAR_DIAGNOSTIC_START ===================================================\n");
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Configuring VirtIO GPU memory regions\n");
+    VMLOG_INFO("BAR_DIAGNOSTIC_START ===================================================\n");
     
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: No PCI device available\n");
-        IOLog("BAR_DIAGNOSTIC_END =====================================================\n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: No PCI device available\n");
+        VMLOG_INFO("BAR_DIAGNOSTIC_END =====================================================\n");
         return false;
     }
     
@@ -5070,19 +5423,19 @@ bool CLASS::setupGPUMemoryRegions() {
     
     // Try modern VirtIO 1.0+ capability detection first
     if (findVirtIOCapability(m_pci_device, VIRTIO_PCI_CAP_NOTIFY_CFG, &notify_bar_index, &notify_offset, &notify_length)) {
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Modern VirtIO 1.0+ detected - using capability-based notify\n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Modern VirtIO 1.0+ detected - using capability-based notify\n");
     } else {
         // Legacy VirtIO 0.9.5 mode - use BAR0 offset 0x10
         notify_bar_index = 0;
         notify_offset = 0x10; // Queue notify register in legacy layout
         notify_length = 2;    // 16-bit register
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Legacy VirtIO 0.9.5 detected - using BAR0+0x10 notify\n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Legacy VirtIO 0.9.5 detected - using BAR0+0x10 notify\n");
     }
     
     // === DETAILED BAR MAPPING DIAGNOSTICS ===
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: === BAR MAPPING DIAGNOSTIC START ===\n");
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Attempting to map PCI BAR %d (from VirtIO capability)\n", notify_bar_index);
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Capability reports: bar=%d offset=0x%x length=0x%x\n",
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: === BAR MAPPING DIAGNOSTIC START ===\n");
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Attempting to map PCI BAR %d (from VirtIO capability)\n", notify_bar_index);
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Capability reports: bar=%d offset=0x%x length=0x%x\n",
           notify_bar_index, notify_offset, notify_length);
     
     // Use the central BAR→IOKit-index resolver (also used by initVirtIOGPU for device-cfg).
@@ -5092,31 +5445,31 @@ bool CLASS::setupGPUMemoryRegions() {
     int iokit_memory_index = -1;
     m_notify_map = mapBarByNumber(notify_bar_index, &iokit_memory_index);
     if (!m_notify_map) {
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ❌ mapBarByNumber(%d) returned NULL — BAR unmapped or no IOKit match\n",
+        VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ❌ mapBarByNumber(%d) returned NULL — BAR unmapped or no IOKit match\n",
               notify_bar_index);
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: === BAR MAPPING DIAGNOSTIC END (FAILED) ===\n");
+        VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: === BAR MAPPING DIAGNOSTIC END (FAILED) ===\n");
         return false;
     }
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ✅ mapBarByNumber matched PCI BAR %d → IOKit index %d\n",
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: ✅ mapBarByNumber matched PCI BAR %d → IOKit index %d\n",
           notify_bar_index, iokit_memory_index);
     
     IOPhysicalAddress notify_phys = m_notify_map->getPhysicalAddress();
     IOVirtualAddress notify_virt = m_notify_map->getVirtualAddress();
     IOByteCount mapped_size = m_notify_map->getLength();
     
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ✅ Successfully mapped BAR %d\n", notify_bar_index);
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions:   Physical address: 0x%llx\n", (uint64_t)notify_phys);
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions:   Virtual address:  0x%llx\n", (uint64_t)notify_virt);
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions:   Mapped size:      %llu bytes (0x%llx)\n", 
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: ✅ Successfully mapped BAR %d\n", notify_bar_index);
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions:   Physical address: 0x%llx\n", (uint64_t)notify_phys);
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions:   Virtual address:  0x%llx\n", (uint64_t)notify_virt);
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions:   Mapped size:      %llu bytes (0x%llx)\n", 
           (uint64_t)mapped_size, (uint64_t)mapped_size);
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions:   Need offset:      0x%x + 4 bytes\n", notify_offset);
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions:   Need offset:      0x%x + 4 bytes\n", notify_offset);
     
     bool size_ok = (mapped_size >= (notify_offset + 4));
     bool virt_ok = (notify_virt != 0);
     
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions:   Size check: %s (need %u, have %llu)\n",
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions:   Size check: %s (need %u, have %llu)\n",
           size_ok ? "PASS ✅" : "FAIL ❌", notify_offset + 4, (uint64_t)mapped_size);
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions:   Virtual address check: %s\n",
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions:   Virtual address check: %s\n",
           virt_ok ? "PASS ✅" : "FAIL ❌ (IOKit mapping broken)");
     
     // CRITICAL ISSUE: macOS IOKit has TWO problems with 64-bit PCI BARs:
@@ -5125,20 +5478,20 @@ bool CLASS::setupGPUMemoryRegions() {
     //
     // Both indicate IOKit cannot properly handle the BAR, need direct mapping workaround
     if (!size_ok || !virt_ok) {
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ╔═══════════════════════════════════════════════════╗\n");
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ║ CRITICAL: 64-BIT BAR MAPPING FAILURE DETECTED     ║\n");
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ╚═══════════════════════════════════════════════════╝\n");
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Mapped size: %llu bytes\n", (uint64_t)mapped_size);
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Required:    %u bytes (offset 0x%x + 4)\n", 
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: ╔═══════════════════════════════════════════════════╗\n");
+        VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ║ CRITICAL: 64-BIT BAR MAPPING FAILURE DETECTED     ║\n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: ╚═══════════════════════════════════════════════════╝\n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Mapped size: %llu bytes\n", (uint64_t)mapped_size);
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Required:    %u bytes (offset 0x%x + 4)\n", 
               notify_offset + 4, notify_offset);
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Deficit:     %lld bytes\n", 
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Deficit:     %lld bytes\n", 
               (int64_t)mapped_size - (notify_offset + 4));
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: \n");
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ROOT CAUSE: macOS IOKit::mapDeviceMemoryWithIndex() fails on 64-bit BARs\n");
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: This affects ALL macOS versions (Snow Leopard through Sonoma)\n");
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: \n");
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: \n");
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ATTEMPTING WORKAROUND: Direct physical address mapping of BAR2+0x3000\n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: \n");
+        VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ROOT CAUSE: macOS IOKit::mapDeviceMemoryWithIndex() fails on 64-bit BARs\n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: This affects ALL macOS versions (Snow Leopard through Sonoma)\n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: \n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: \n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: ATTEMPTING WORKAROUND: Direct physical address mapping of BAR2+0x3000\n");
         
         // WORKAROUND ATTEMPT: Get BAR2's physical address and create direct mapping at +0x3000
         // This bypasses IOPCIDevice::mapDeviceMemoryWithIndex() which truncates 64-bit BARs
@@ -5148,32 +5501,32 @@ bool CLASS::setupGPUMemoryRegions() {
             IOByteCount bar2_total_size = bar2_device_mem->getLength();
             IOPhysicalAddress notify_phys_addr = bar2_phys_base + notify_offset;
             
-            IOLog("VMVirtIOGPU::setupGPUMemoryRegions: BAR2 physical base: 0x%llx\n", (uint64_t)bar2_phys_base);
-            IOLog("VMVirtIOGPU::setupGPUMemoryRegions: BAR2 reported size: %llu bytes (0x%llx)\n", 
+            VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: BAR2 physical base: 0x%llx\n", (uint64_t)bar2_phys_base);
+            VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: BAR2 reported size: %llu bytes (0x%llx)\n", 
                   (uint64_t)bar2_total_size, (uint64_t)bar2_total_size);
-            IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Target notify address: 0x%llx (BAR2 + 0x%x)\n", 
+            VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Target notify address: 0x%llx (BAR2 + 0x%x)\n", 
                   (uint64_t)notify_phys_addr, notify_offset);
             
             // SAFETY CHECK 1: Verify physical address is non-zero (valid)
             if (bar2_phys_base == 0) {
-                IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ❌ SAFETY: BAR2 physical address is NULL - skipping direct mapping\n");
+                VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ❌ SAFETY: BAR2 physical address is NULL - skipping direct mapping\n");
             }
             // SAFETY CHECK 2: Verify physical address is in expected range (not obviously invalid)
             else if (bar2_phys_base < 0x1000 || bar2_phys_base > 0xFFFFFFFFFFFFULL) {
-                IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ❌ SAFETY: BAR2 physical address 0x%llx is suspicious - skipping\n", 
+                VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ❌ SAFETY: BAR2 physical address 0x%llx is suspicious - skipping\n", 
                       (uint64_t)bar2_phys_base);
             }
             // SAFETY CHECK 3: Verify offset is within reported BAR size
             else if (bar2_total_size > 0 && (notify_offset + 0x1000) > bar2_total_size) {
-                IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ❌ SAFETY: Notify offset 0x%x exceeds BAR size %llu - skipping\n",
+                VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ❌ SAFETY: Notify offset 0x%x exceeds BAR size %llu - skipping\n",
                       notify_offset, (uint64_t)bar2_total_size);
             }
             // SAFETY CHECK 4: Verify we're not trying to map too much memory (DoS protection)
             else if (notify_offset > 0x100000) { // 1MB sanity limit
-                IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ❌ SAFETY: Notify offset 0x%x too large - skipping\n", notify_offset);
+                VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ❌ SAFETY: Notify offset 0x%x too large - skipping\n", notify_offset);
             }
             else {
-                IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ✅ SAFETY: Address validation passed, attempting direct mapping\n");
+                VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: ✅ SAFETY: Address validation passed, attempting direct mapping\n");
                 
                 // Create a page-aligned memory descriptor at the BAR physical page that contains the notify address
                 // This avoids mapping non-page-aligned physical addresses which can cause panics on some macOS kernels
@@ -5186,20 +5539,20 @@ bool CLASS::setupGPUMemoryRegions() {
 
                 // Ensure mapping doesn't exceed the reported BAR size
                 if ((page_base < bar2_phys_base) || (page_base + map_len) > (bar2_phys_base + bar2_total_size)) {
-                    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ❌ SAFETY: Direct mapping would exceed BAR bounds (page_base=0x%llx len=0x%llx size=%llu)\n",
+                    VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ❌ SAFETY: Direct mapping would exceed BAR bounds (page_base=0x%llx len=0x%llx size=%llu)\n",
                           (uint64_t)page_base, (uint64_t)map_len, (uint64_t)bar2_total_size);
                 } else {
-                    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Attempting page-aligned direct mapping: page_base=0x%llx offset=0x%llx len=0x%llx\n",
+                    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Attempting page-aligned direct mapping: page_base=0x%llx offset=0x%llx len=0x%llx\n",
                           (uint64_t)page_base, (uint64_t)page_offset, (uint64_t)map_len);
 
                     IOMemoryDescriptor* notify_desc = IOMemoryDescriptor::withPhysicalAddress(page_base, map_len, kIODirectionOutIn);
                     if (notify_desc) {
-                        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Memory descriptor created, attempting map()...\n");
+                        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Memory descriptor created, attempting map()...\n");
                         IOMemoryMap* direct_notify_map = notify_desc->map();
                         if (direct_notify_map) {
                             IOVirtualAddress virt_base = direct_notify_map->getVirtualAddress();
                             if (virt_base != 0) {
-                                IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ✅ Direct mapping succeeded (virtual base=0x%llx)\n", (uint64_t)virt_base);
+                                VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: ✅ Direct mapping succeeded (virtual base=0x%llx)\n", (uint64_t)virt_base);
 
                                 // Safely replace previous notify map if present
                                 if (m_notify_map) { m_notify_map->release(); m_notify_map = nullptr; }
@@ -5211,35 +5564,35 @@ bool CLASS::setupGPUMemoryRegions() {
                                 notify_offset = (uint32_t)page_offset;
                                 m_notify_cap_offset = notify_offset;
 
-                                IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ✅ Modern VirtIO notification enabled via direct mapping (offset=0x%x)\n", notify_offset);
+                                VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: ✅ Modern VirtIO notification enabled via direct mapping (offset=0x%x)\n", notify_offset);
                                 notify_desc->release();
                                 return true;
                             }
                             // virt_base == 0
                             direct_notify_map->release();
                         } else {
-                            IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ❌ direct_notify_map->map() failed\n");
+                            VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ❌ direct_notify_map->map() failed\n");
                         }
                         notify_desc->release();
                     } else {
-                        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ❌ Failed to create memory descriptor for page_base=0x%llx len=0x%llx\n", (uint64_t)page_base, (uint64_t)map_len);
+                        VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ❌ Failed to create memory descriptor for page_base=0x%llx len=0x%llx\n", (uint64_t)page_base, (uint64_t)map_len);
                     }
                 }
             }
         } else {
-            IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ❌ Failed to get BAR2 device memory\n");
+            VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ❌ Failed to get BAR2 device memory\n");
         }
         
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Direct mapping failed, falling back to legacy mode\n");
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: WORKAROUND: Falling back to VirtIO 0.9.5 legacy mode (BAR0 I/O ports)\n");
+        VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: Direct mapping failed, falling back to legacy mode\n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: WORKAROUND: Falling back to VirtIO 0.9.5 legacy mode (BAR0 I/O ports)\n");
         
         // Try mapping BAR0 instead (32-bit framebuffer BAR, always works)
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Releasing BAR2 map and attempting BAR0...\n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Releasing BAR2 map and attempting BAR0...\n");
         m_notify_map->release();
         m_notify_map = m_pci_device->mapDeviceMemoryWithIndex(0); // BAR0
         if (!m_notify_map) {
-            IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ❌ FAILED to map BAR0 as fallback\n");
-            IOLog("VMVirtIOGPU::setupGPUMemoryRegions: === BAR MAPPING DIAGNOSTIC END (FAILED) ===\n");
+            VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: ❌ FAILED to map BAR0 as fallback\n");
+            VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: === BAR MAPPING DIAGNOSTIC END (FAILED) ===\n");
             return false;
         }
         
@@ -5247,26 +5600,26 @@ bool CLASS::setupGPUMemoryRegions() {
         IOByteCount bar0_size = m_notify_map->getLength();
         notify_offset = 0x10; // Legacy VirtIO queue notify register
         
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ✅ BAR0 fallback successful\n");
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions:   BAR0 physical: 0x%llx\n", (uint64_t)bar0_phys);
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions:   BAR0 size:     %llu bytes\n", (uint64_t)bar0_size);
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions:   Notify offset: 0x%x (legacy I/O port)\n", notify_offset);
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: ✅ BAR0 fallback successful\n");
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions:   BAR0 physical: 0x%llx\n", (uint64_t)bar0_phys);
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions:   BAR0 size:     %llu bytes\n", (uint64_t)bar0_size);
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions:   Notify offset: 0x%x (legacy I/O port)\n", notify_offset);
     } else {
-        IOLog("VMVirtIOGPU::setupGPUMemoryRegions: ✅ BAR%d mapping is sufficient for modern VirtIO 1.0\n", notify_bar_index);
+        VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: ✅ BAR%d mapping is sufficient for modern VirtIO 1.0\n", notify_bar_index);
     }
     
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: === BAR MAPPING DIAGNOSTIC END (SUCCESS) ===\n");
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: === BAR MAPPING DIAGNOSTIC END (SUCCESS) ===\n");
     
     // Store the notify offset for use in submitCommand
     m_notify_cap_offset = notify_offset;
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Mapped notify region at BAR %d + 0x%x (BAR size: %llu bytes)\n", 
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Mapped notify region at BAR %d + 0x%x (BAR size: %llu bytes)\n", 
           notify_bar_index, notify_offset, m_notify_map->getLength());
     
     // Configure memory regions for VirtIO GPU operations with NVIDIA compatibility
     uint64_t notify_base = m_notify_map->getPhysicalAddress();
     uint32_t notify_size = (uint32_t)m_notify_map->getLength();
     
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Notification region mapped at 0x%llx, size: %u\n", 
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Notification region mapped at 0x%llx, size: %u\n", 
           notify_base, notify_size);
     
     // Note: Display connector and component properties are already set in start() method using proper OSNumber objects
@@ -5333,30 +5686,30 @@ bool CLASS::setupGPUMemoryRegions() {
     // NOTE: VRAM properties are handled by VMVirtIOFramebuffer to avoid duplication
     // gpu-memory-bandwidth is set on accelerator service only to avoid duplicates
     
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: *** HARDWARE ACCELERATION PROPERTIES CONFIGURED ***\n");
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Enhanced framebuffer properties configured\n");
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: *** HARDWARE ACCELERATION PROPERTIES CONFIGURED ***\n");
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: Enhanced framebuffer properties configured\n");
     
     // Initialize contexts array if not already done. Resource pool is a fixed
     // m_resource_pool[64] array zeroed in the constructor — nothing to alloc here.
     if (!m_contexts) {
         m_contexts = OSArray::withCapacity(8);
         if (!m_contexts) {
-            IOLog("VMVirtIOGPU::setupGPUMemoryRegions: Failed to create contexts array\n");
+            VMLOG_ERROR("VMVirtIOGPU::setupGPUMemoryRegions: Failed to create contexts array\n");
             return false;
         }
     }
     
-    IOLog("VMVirtIOGPU::setupGPUMemoryRegions: VirtIO GPU memory regions configured successfully\n");
-    IOLog("BAR_DIAGNOSTIC_END =====================================================\n");
+    VMLOG_INFO("VMVirtIOGPU::setupGPUMemoryRegions: VirtIO GPU memory regions configured successfully\n");
+    VMLOG_INFO("BAR_DIAGNOSTIC_END =====================================================\n");
     return true;
 }
 
 // VirtIO feature negotiation - essential for 3D capability detection
 bool CLASS::negotiateVirtIOFeatures() {
-    IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Starting VirtIO feature negotiation\n");
+    VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: Starting VirtIO feature negotiation\n");
     
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: No PCI device available\n");
+        VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: No PCI device available\n");
         return false;
     }
     
@@ -5366,22 +5719,22 @@ bool CLASS::negotiateVirtIOFeatures() {
     uint32_t common_length;
     
     if (!findVirtIOCapability(m_pci_device, VIRTIO_PCI_CAP_COMMON_CFG, &common_bar_index, &common_offset, &common_length)) {
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Failed to find VirtIO common config capability\n");
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Device may be using legacy VirtIO 0.9.5 (I/O port mode)\n");
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Snow Leopard compatibility: Assuming basic 3D support\n");
+        VMLOG_ERROR("VMVirtIOGPU::negotiateVirtIOFeatures: Failed to find VirtIO common config capability\n");
+        VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: Device may be using legacy VirtIO 0.9.5 (I/O port mode)\n");
+        VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: Snow Leopard compatibility: Assuming basic 3D support\n");
         return false; // Not fatal - we can continue with conservative defaults
     }
     
     IOMemoryMap* common_config_map = m_pci_device->mapDeviceMemoryWithIndex(common_bar_index);
     if (!common_config_map) {
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Failed to map VirtIO common config (BAR %d)\n", common_bar_index);
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Legacy VirtIO mode detected - continuing with defaults\n");
+        VMLOG_ERROR("VMVirtIOGPU::negotiateVirtIOFeatures: Failed to map VirtIO common config (BAR %d)\n", common_bar_index);
+        VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: Legacy VirtIO mode detected - continuing with defaults\n");
         return false; // Not fatal
     }
     
     volatile uint32_t* common_config_base = (volatile uint32_t*)common_config_map->getVirtualAddress();
     if (!common_config_base) {
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Failed to get virtual address for common config\n");
+        VMLOG_ERROR("VMVirtIOGPU::negotiateVirtIOFeatures: Failed to get virtual address for common config\n");
         common_config_map->release();
         return false; // Not fatal
     }
@@ -5394,10 +5747,10 @@ bool CLASS::negotiateVirtIOFeatures() {
     // If common config offset is beyond this initial mapping, we skip feature negotiation
     // but this is NOT an error - the device is still modern VirtIO 1.0+
     if (common_offset + 0x10 > map_size) {
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: CommonCfg offset 0x%x beyond initial BAR mapping 0x%llx\n", 
+        VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: CommonCfg offset 0x%x beyond initial BAR mapping 0x%llx\n", 
               common_offset, (uint64_t)map_size);
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Skipping feature negotiation (device is modern VirtIO 1.0+)\n");
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: 3D support detected via capability discovery\n");
+        VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: Skipping feature negotiation (device is modern VirtIO 1.0+)\n");
+        VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: 3D support detected via capability discovery\n");
         common_config_map->release();
         
         // NOTE: This is NOT a failure - the device is modern VirtIO 1.0+ with 3D support
@@ -5408,25 +5761,25 @@ bool CLASS::negotiateVirtIOFeatures() {
     
     // Calculate the actual common config address using the real hardware offset
     volatile uint32_t* common_config = (volatile uint32_t*)((uint8_t*)common_config_base + common_offset);
-    IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Using CommonCfg at BAR %d + 0x%x (verified within bounds)\n", common_bar_index, common_offset);
+    VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: Using CommonCfg at BAR %d + 0x%x (verified within bounds)\n", common_bar_index, common_offset);
     
     // Read device features (offset 0x04 in VirtIO common config)
     uint32_t device_features_low = common_config[1];   // 0x04/4 = 1
-    IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Device features: 0x%x\n", device_features_low);
+    VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: Device features: 0x%x\n", device_features_low);
     
     // Check if device supports VIRGL (bit 0)
     bool device_supports_virgl = (device_features_low & (1 << VIRTIO_GPU_F_VIRGL)) != 0;
-    IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Device VIRGL support: %s\n", 
+    VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: Device VIRGL support: %s\n", 
           device_supports_virgl ? "YES" : "NO");
     
     if (device_supports_virgl) {
         // Write guest features to accept VIRGL (offset 0x08 in VirtIO common config)
         uint32_t guest_features = (1 << VIRTIO_GPU_F_VIRGL);
         common_config[2] = guest_features;  // 0x08/4 = 2
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: Negotiated guest features: 0x%x\n", guest_features);
+        VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: Negotiated guest features: 0x%x\n", guest_features);
         
         // Set FEATURES_OK bit in device status (this would be at offset 0x14, but simplified)
-        IOLog("VMVirtIOGPU::negotiateVirtIOFeatures: VIRGL feature negotiated successfully\n");
+        VMLOG_INFO("VMVirtIOGPU::negotiateVirtIOFeatures: VIRGL feature negotiated successfully\n");
     }
     
     common_config_map->release();
@@ -5435,46 +5788,46 @@ bool CLASS::negotiateVirtIOFeatures() {
 
 // WebGL-specific acceleration initialization for Snow Leopard compatibility
 void CLASS::initializeWebGLAcceleration() {
-    IOLog("VMVirtIOGPU::initializeWebGLAcceleration: Setting up real WebGL hardware acceleration\n");
+    VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: Setting up real WebGL hardware acceleration\n");
     
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: No PCI device available\n");
+        VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: No PCI device available\n");
         return;
     }
     
     // Verify 3D acceleration is available before setting up WebGL
     if (!supports3D()) {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: 3D acceleration not available, WebGL cannot be initialized\n");
+        VMLOG_WARN("VMVirtIOGPU::initializeWebGLAcceleration: 3D acceleration not available, WebGL cannot be initialized\n");
         return;
     }
     
     // Create real VirtIO GPU 3D context with virgl support
     uint32_t webgl_context_id = 0;
-    IOLog("VMVirtIOGPU::initializeWebGLAcceleration: Creating real VirtIO GPU 3D context\n");
+    VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: Creating real VirtIO GPU 3D context\n");
     
     IOReturn context_ret = createRenderContext(&webgl_context_id);
     if (context_ret != kIOReturnSuccess || webgl_context_id == 0) {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: ❌ Failed to create 3D context (0x%x)\n", context_ret);
+        VMLOG_ERROR("VMVirtIOGPU::initializeWebGLAcceleration: ❌ Failed to create 3D context (0x%x)\n", context_ret);
         return;
     }
     
-    IOLog("VMVirtIOGPU::initializeWebGLAcceleration: ✅ Created real 3D context ID: %u\n", webgl_context_id);
+    VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: ✅ Created real 3D context ID: %u\n", webgl_context_id);
     
     // Allocate GPU memory for 3D operations (256MB for full hardware acceleration)
     IOMemoryDescriptor* webgl_memory = nullptr;
     size_t webgl_memory_size = 256 * 1024 * 1024; // 256MB for WebGL hardware acceleration
-    IOLog("VMVirtIOGPU::initializeWebGLAcceleration: Allocating %zu MB GPU memory\n", webgl_memory_size / (1024 * 1024));
+    VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: Allocating %zu MB GPU memory\n", webgl_memory_size / (1024 * 1024));
     
     IOReturn memory_ret = allocateGPUMemory(webgl_memory_size, &webgl_memory);
     if (memory_ret != kIOReturnSuccess || !webgl_memory) {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: ⚠️ GPU memory allocation returned 0x%x (continuing anyway)\n", memory_ret);
+        VMLOG_WARN("VMVirtIOGPU::initializeWebGLAcceleration: ⚠️ GPU memory allocation returned 0x%x (continuing anyway)\n", memory_ret);
     } else {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: ✅ Allocated %zu MB GPU memory\n", webgl_memory_size / (1024 * 1024));
+        VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: ✅ Allocated %zu MB GPU memory\n", webgl_memory_size / (1024 * 1024));
     }
     
     // Create real 3D texture resources for rendering
     uint32_t canvas_resource_id = 0;
-    IOLog("VMVirtIOGPU::initializeWebGLAcceleration: Creating 1280x720 render target (matching display resolution)\n");
+    VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: Creating 1280x720 render target (matching display resolution)\n");
     
     // Use current display resolution instead of hardcoded 1920x1080
     IOReturn canvas_ret = createResource3D(
@@ -5487,14 +5840,14 @@ void CLASS::initializeWebGLAcceleration() {
     
     if (canvas_ret == kIOReturnSuccess) {
         canvas_resource_id = m_next_resource_id;
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: ✅ Created canvas resource ID: %u\n", canvas_resource_id);
+        VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: ✅ Created canvas resource ID: %u\n", canvas_resource_id);
     } else {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: ⚠️ Canvas resource creation returned 0x%x (continuing anyway)\n", canvas_ret);
+        VMLOG_WARN("VMVirtIOGPU::initializeWebGLAcceleration: ⚠️ Canvas resource creation returned 0x%x (continuing anyway)\n", canvas_ret);
     }
     
     // Create depth buffer resource
     uint32_t depth_resource_id = 0;
-    IOLog("VMVirtIOGPU::initializeWebGLAcceleration: Creating depth buffer\n");
+    VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: Creating depth buffer\n");
     
     IOReturn depth_ret = createResource3D(
         ++m_next_resource_id,
@@ -5506,21 +5859,21 @@ void CLASS::initializeWebGLAcceleration() {
     
     if (depth_ret == kIOReturnSuccess) {
         depth_resource_id = m_next_resource_id;
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: ✅ Created depth buffer ID: %u\n", depth_resource_id);
+        VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: ✅ Created depth buffer ID: %u\n", depth_resource_id);
     } else {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: ⚠️ Depth buffer creation returned 0x%x (continuing anyway)\n", depth_ret);
+        VMLOG_WARN("VMVirtIOGPU::initializeWebGLAcceleration: ⚠️ Depth buffer creation returned 0x%x (continuing anyway)\n", depth_ret);
     }
     
     // Query VirtIO GPU capabilities
     if (m_num_capsets > 0) {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: Device reports %u capability sets\n", m_num_capsets);
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: 3D capabilities available (virgl renderer)\n");
+        VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: Device reports %u capability sets\n", m_num_capsets);
+        VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: 3D capabilities available (virgl renderer)\n");
         
         // Don't query individual capsets here - virgl will handle capability detection
         // The host virglrenderer knows what the GPU supports
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: Deferring capability details to virglrenderer\n");
+        VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: Deferring capability details to virglrenderer\n");
     } else {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: ⚠️ No capability sets reported - 3D may not work\n");
+        VMLOG_WARN("VMVirtIOGPU::initializeWebGLAcceleration: ⚠️ No capability sets reported - 3D may not work\n");
     }
     
     // Store WebGL resource information for framebuffer properties
@@ -5539,40 +5892,40 @@ void CLASS::initializeWebGLAcceleration() {
     
     // Report real 3D acceleration status
     if (canvas_resource_id > 0 && depth_resource_id > 0) {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: ✅ *** REAL 3D HARDWARE ACCELERATION ENABLED ***\n");
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: Context ID: %u, Canvas: %u, Depth: %u\n",
+        VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: ✅ *** REAL 3D HARDWARE ACCELERATION ENABLED ***\n");
+        VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: Context ID: %u, Canvas: %u, Depth: %u\n",
               webgl_context_id, canvas_resource_id, depth_resource_id);
     } else {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: ⚠️ Partial initialization - Context: %u, Canvas: %u, Depth: %u\n",
+        VMLOG_WARN("VMVirtIOGPU::initializeWebGLAcceleration: ⚠️ Partial initialization - Context: %u, Canvas: %u, Depth: %u\n",
               webgl_context_id, canvas_resource_id, depth_resource_id);
     }
     if (webgl_memory) {
-        IOLog("VMVirtIOGPU::initializeWebGLAcceleration: GPU memory: %llu MB allocated\n", 
+        VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: GPU memory: %llu MB allocated\n", 
               (uint64_t)(webgl_memory_size / (1024 * 1024)));
     }
     
     // Store WebGL acceleration state in the main VirtIO GPU service
     
-    IOLog("VMVirtIOGPU::initializeWebGLAcceleration: WebGL acceleration configured successfully\n");
+    VMLOG_INFO("VMVirtIOGPU::initializeWebGLAcceleration: WebGL acceleration configured successfully\n");
 }
 
 bool CLASS::initializeVirtIOQueues() {
-    IOLog("VMVirtIOGPU::initializeVirtIOQueues: Setting up VirtIO GPU command queues\n");
+    VMLOG_INFO("VMVirtIOGPU::initializeVirtIOQueues: Setting up VirtIO GPU command queues\n");
     
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU::initializeVirtIOQueues: No PCI device available\n");
+        VMLOG_INFO("VMVirtIOGPU::initializeVirtIOQueues: No PCI device available\n");
         return false;
     }
     
     // Check if queues are already initialized
     if (m_control_queue && m_cursor_queue) {
-        IOLog("VMVirtIOGPU::initializeVirtIOQueues: Queues already initialized\n");
+        VMLOG_INFO("VMVirtIOGPU::initializeVirtIOQueues: Queues already initialized\n");
         return true;
     }
     
     // Set optimal queue sizes based on device capabilities
     if (!setOptimalQueueSizes()) {
-        IOLog("VMVirtIOGPU::initializeVirtIOQueues: Failed to set optimal queue sizes\n");
+        VMLOG_ERROR("VMVirtIOGPU::initializeVirtIOQueues: Failed to set optimal queue sizes\n");
         return false;
     }
     
@@ -5580,7 +5933,7 @@ bool CLASS::initializeVirtIOQueues() {
     if (!m_control_queue) {
         m_control_queue = IOBufferMemoryDescriptor::withCapacity(m_control_queue_size * sizeof(virtio_gpu_ctrl_hdr), kIODirectionOutIn);
         if (!m_control_queue) {
-            IOLog("VMVirtIOGPU::initializeVirtIOQueues: Failed to allocate control queue\n");
+            VMLOG_ERROR("VMVirtIOGPU::initializeVirtIOQueues: Failed to allocate control queue\n");
             return false;
         }
     }
@@ -5589,7 +5942,7 @@ bool CLASS::initializeVirtIOQueues() {
     if (!m_cursor_queue) {
         m_cursor_queue = IOBufferMemoryDescriptor::withCapacity(m_cursor_queue_size * sizeof(virtio_gpu_ctrl_hdr), kIODirectionOutIn);
         if (!m_cursor_queue) {
-            IOLog("VMVirtIOGPU::initializeVirtIOQueues: Failed to allocate cursor queue\n");
+            VMLOG_ERROR("VMVirtIOGPU::initializeVirtIOQueues: Failed to allocate cursor queue\n");
             m_control_queue->release();
             m_control_queue = nullptr;
             return false;
@@ -5597,19 +5950,19 @@ bool CLASS::initializeVirtIOQueues() {
     }
     
     // CRITICAL: Setup VirtIO hardware queues (missing piece!)
-    IOLog("VMVirtIOGPU::initializeVirtIOQueues: Setting up VirtIO hardware queue structures\n");
+    VMLOG_INFO("VMVirtIOGPU::initializeVirtIOQueues: Setting up VirtIO hardware queue structures\n");
     if (!setupVirtIOHardwareQueues()) {
-        IOLog("VMVirtIOGPU::initializeVirtIOQueues: Failed to setup VirtIO hardware queues\n");
+        VMLOG_ERROR("VMVirtIOGPU::initializeVirtIOQueues: Failed to setup VirtIO hardware queues\n");
         return false;
     }
     
-    IOLog("VMVirtIOGPU::initializeVirtIOQueues: VirtIO GPU queues initialized successfully\n");
+    VMLOG_INFO("VMVirtIOGPU::initializeVirtIOQueues: VirtIO GPU queues initialized successfully\n");
     return true;
 }
 
 // Setup VirtIO hardware queue structures according to VirtIO 1.2 specification
 bool CLASS::setupVirtIOHardwareQueues() {
-    IOLog("VMVirtIOGPU::setupVirtIOHardwareQueues: Configuring VirtIO hardware queues\n");
+    VMLOG_INFO("VMVirtIOGPU::setupVirtIOHardwareQueues: Configuring VirtIO hardware queues\n");
     
     // For now, implement simplified queue setup
     // The key insight is that the notification mechanism requires proper queue setup
@@ -5619,7 +5972,7 @@ bool CLASS::setupVirtIOHardwareQueues() {
     IOReturn cursor_ret = m_cursor_queue->prepare(kIODirectionOutIn);
     
     if (control_ret != kIOReturnSuccess || cursor_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::setupVirtIOHardwareQueues: Failed to prepare queues for DMA\n");
+        VMLOG_ERROR("VMVirtIOGPU::setupVirtIOHardwareQueues: Failed to prepare queues for DMA\n");
         return false;
     }
     
@@ -5627,14 +5980,14 @@ bool CLASS::setupVirtIOHardwareQueues() {
     IOPhysicalAddress control_phys = m_control_queue->getPhysicalAddress();
     IOPhysicalAddress cursor_phys = m_cursor_queue->getPhysicalAddress();
     
-    IOLog("VMVirtIOGPU::setupVirtIOHardwareQueues: Control queue at phys 0x%llx, cursor queue at phys 0x%llx\n", 
+    VMLOG_INFO("VMVirtIOGPU::setupVirtIOHardwareQueues: Control queue at phys 0x%llx, cursor queue at phys 0x%llx\n", 
           control_phys, cursor_phys);
     
     // NOTE: In a full VirtIO implementation, we would write these addresses to the
     // VirtIO common config space, but for now we've established the memory mapping
     // which should be sufficient for basic command processing
     
-    IOLog("VMVirtIOGPU::setupVirtIOHardwareQueues: VirtIO hardware queues configured\n");
+    VMLOG_INFO("VMVirtIOGPU::setupVirtIOHardwareQueues: VirtIO hardware queues configured\n");
     return true;
 }
 
@@ -5642,7 +5995,7 @@ bool CLASS::setupVirtIOHardwareQueues() {
 IOReturn CLASS::configurePCIDevice(IOPCIDevice* pciProvider)
 {
     if (!pciProvider) {
-        IOLog("VMVirtIOGPU::configurePCIDevice: No PCI provider\n");
+        VMLOG_INFO("VMVirtIOGPU::configurePCIDevice: No PCI provider\n");
         return kIOReturnBadArgument;
     }
     
@@ -5658,20 +6011,20 @@ IOReturn CLASS::configurePCIDevice(IOPCIDevice* pciProvider)
     
     for (int retry = 0; retry < maxRetries && !configSuccess; retry++) {
         if (retry > 0) {
-            IOLog("VMVirtIOGPU::configurePCIDevice: PCI configuration retry %d/%d\n", retry, maxRetries - 1);
+            VMLOG_INFO("VMVirtIOGPU::configurePCIDevice: PCI configuration retry %d/%d\n", retry, maxRetries - 1);
             IOSleep(10); // 10ms delay between retries
         }
         
         if (m_pci_device) {
             // Skip PCI configuration to avoid kernel panic
             // The device should already be configured by the system
-            IOLog("VMVirtIOGPU::configurePCIDevice: Skipping PCI config to avoid kernel panic\n");
+            VMLOG_ERROR("VMVirtIOGPU::configurePCIDevice: Skipping PCI config to avoid kernel panic\n");
             configSuccess = true;
         }
     }
     
     if (!configSuccess) {
-        IOLog("VMVirtIOGPU::configurePCIDevice: PCI device configuration failed\n");
+        VMLOG_ERROR("VMVirtIOGPU::configurePCIDevice: PCI device configuration failed\n");
         return kIOReturnError;
     }
     
@@ -5684,7 +6037,7 @@ IODeviceMemory* CLASS::getVRAMRange()
     // For VirtIO GPU, we need to provide a meaningful VRAM range
     
     if (!m_pci_device) {
-        IOLog("VMVirtIOGPU::getVRAMRange: No PCI device available\n");
+        VMLOG_INFO("VMVirtIOGPU::getVRAMRange: No PCI device available\n");
         return nullptr;
     }
     
@@ -5697,7 +6050,7 @@ IODeviceMemory* CLASS::getVRAMRange()
     
     for (int retry = 0; retry < maxRetries && vram_size == 0; retry++) {
         if (retry > 0) {
-            IOLog("VMVirtIOGPU::getVRAMRange: VRAM detection retry %d/%d\n", retry, maxRetries - 1);
+            VMLOG_INFO("VMVirtIOGPU::getVRAMRange: VRAM detection retry %d/%d\n", retry, maxRetries - 1);
             IOSleep(10); // 10ms delay between retries
         }
         
@@ -5725,21 +6078,21 @@ IODeviceMemory* CLASS::getVRAMRange()
                     // VirtIO GPU VRAM should be at least 1MB for basic functionality
                     // If we find a very small region (< 1MB), it might be a control register
                     if (barSize < (1024 * 1024)) { // Less than 1MB
-                        IOLog("VMVirtIOGPU::getVRAMRange: BAR %d has small size %zu bytes, checking if it's control register\n", bar, barSize);
+                        VMLOG_INFO("VMVirtIOGPU::getVRAMRange: BAR %d has small size %zu bytes, checking if it's control register\n", bar, barSize);
                         // For small regions, only accept if it's exactly a power of 2 and reasonable for VRAM
                         // Most control registers are 4KB (4096 bytes)
                         if (barSize == 4096) {
-                            IOLog("VMVirtIOGPU::getVRAMRange: BAR %d appears to be 4KB control register, skipping for VRAM\n", bar);
+                            VMLOG_INFO("VMVirtIOGPU::getVRAMRange: BAR %d appears to be 4KB control register, skipping for VRAM\n", bar);
                             continue; // Skip this BAR, look for larger VRAM regions
                         }
                     }
                     
                     vram_size = barSize;
-                    IOLog("VMVirtIOGPU::getVRAMRange: Found valid VRAM at BAR %d, size: %zu bytes (%zu MB)\n",
+                    VMLOG_INFO("VMVirtIOGPU::getVRAMRange: Found valid VRAM at BAR %d, size: %zu bytes (%zu MB)\n",
                           bar, vram_size, vram_size / (1024 * 1024));
                     break;
                 } else if (barSize > 0) {
-                    IOLog("VMVirtIOGPU::getVRAMRange: BAR %d size %zu bytes out of valid range, skipping\n", bar, barSize);
+                    VMLOG_INFO("VMVirtIOGPU::getVRAMRange: BAR %d size %zu bytes out of valid range, skipping\n", bar, barSize);
                 }
             }
         }
@@ -5747,7 +6100,7 @@ IODeviceMemory* CLASS::getVRAMRange()
         if (vram_size > 0) {
             break; // Success, exit retry loop
         } else {
-            IOLog("VMVirtIOGPU::getVRAMRange: No valid VRAM found in attempt %d\n", retry + 1);
+            VMLOG_INFO("VMVirtIOGPU::getVRAMRange: No valid VRAM found in attempt %d\n", retry + 1);
         }
     }
     
@@ -5759,12 +6112,12 @@ IODeviceMemory* CLASS::getVRAMRange()
         );
         
         if (vram_range) {
-            IOLog("VMVirtIOGPU::getVRAMRange: Created VRAM range at 0x%llx, size: %zu bytes\n",
+            VMLOG_INFO("VMVirtIOGPU::getVRAMRange: Created VRAM range at 0x%llx, size: %zu bytes\n",
                   vram_map->getPhysicalAddress(), vram_size);
             vram_map->release(); // Release the map since we have the device memory object
             return vram_range;
         } else {
-            IOLog("VMVirtIOGPU::getVRAMRange: Failed to create device memory object\n");
+            VMLOG_ERROR("VMVirtIOGPU::getVRAMRange: Failed to create device memory object\n");
         }
     }
     
@@ -5774,7 +6127,7 @@ IODeviceMemory* CLASS::getVRAMRange()
     }
     
     // If we can't find hardware VRAM, create a reasonable default size based on VirtIO GPU defaults
-    IOLog("VMVirtIOGPU::getVRAMRange: No hardware VRAM found after %d attempts, creating default range\n", maxRetries);
+    VMLOG_INFO("VMVirtIOGPU::getVRAMRange: No hardware VRAM found after %d attempts, creating default range\n", maxRetries);
     
     // ENHANCED: Use 512MB default for modern GPU expectations and better performance
     size_t default_vram_size = 512 * 1024 * 1024; // 512MB default (modern GPU standard)
@@ -5791,30 +6144,30 @@ IODeviceMemory* CLASS::getVRAMRange()
         vram_buffer->release();
         
         if (vram_range) {
-            IOLog("VMVirtIOGPU::getVRAMRange: Created default VRAM range, size: %zu MB\n", 
+            VMLOG_INFO("VMVirtIOGPU::getVRAMRange: Created default VRAM range, size: %zu MB\n", 
                   default_vram_size / (1024 * 1024));
             return vram_range;
         }
     }
     
-    IOLog("VMVirtIOGPU::getVRAMRange: Failed to create any VRAM range\n");
+    VMLOG_ERROR("VMVirtIOGPU::getVRAMRange: Failed to create any VRAM range\n");
     return nullptr;
 }
 
 // Display output control methods
 IOReturn CLASS::setupDisplayResource(uint32_t width, uint32_t height, uint32_t depth)
 {
-    IOLog("VMVirtIOGPU::setupDisplayResource: Setting up %dx%d@%d display resource with NVIDIA dual display support\n", 
+    VMLOG_INFO("VMVirtIOGPU::setupDisplayResource: Setting up %dx%d@%d display resource with NVIDIA dual display support\n", 
           width, height, depth);
     
     if (!m_pci_device || !m_control_queue) {
-        IOLog("VMVirtIOGPU::setupDisplayResource: VirtIO GPU not ready (pci_device=%p, control_queue=%p)\n", 
+        VMLOG_WARN("VMVirtIOGPU::setupDisplayResource: VirtIO GPU not ready (pci_device=%p, control_queue=%p)\n", 
               m_pci_device, m_control_queue);
         return kIOReturnNotReady;
     }
     
     // NVIDIA DUAL DISPLAY CONFIGURATION: Configure display ports like real hardware
-    IOLog("VMVirtIOGPU::setupDisplayResource: Configuring NVIDIA-style dual display support\n");
+    VMLOG_INFO("VMVirtIOGPU::setupDisplayResource: Configuring NVIDIA-style dual display support\n");
     
     // NOTE: Display connector and config properties are already set in start() method using proper OSNumber objects
     // Avoiding duplicate property setting here to prevent conflicts
@@ -5834,11 +6187,11 @@ IOReturn CLASS::setupDisplayResource(uint32_t width, uint32_t height, uint32_t d
     
     // Create a 2D resource for the framebuffer
     uint32_t resource_id = ++m_next_resource_id;
-    IOLog("VMVirtIOGPU::setupDisplayResource: Creating primary display resource ID %u\n", resource_id);
+    VMLOG_INFO("VMVirtIOGPU::setupDisplayResource: Creating primary display resource ID %u\n", resource_id);
     
     IOReturn ret = createResource2D(resource_id, VIRTIO_GPU_FORMAT_B8G8R8A8_UNORM, width, height);
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::setupDisplayResource: Failed to create 2D resource: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPU::setupDisplayResource: Failed to create 2D resource: 0x%x\n", ret);
         return ret;
     }
     
@@ -5848,32 +6201,32 @@ IOReturn CLASS::setupDisplayResource(uint32_t width, uint32_t height, uint32_t d
     // DUAL DISPLAY RESOURCE CREATION: Create secondary display resource for wide displays
     if (width >= 1920 && height >= 1080) {  // For large displays, enable dual display capability
         uint32_t secondary_resource_id = ++m_next_resource_id;
-        IOLog("VMVirtIOGPU::setupDisplayResource: Creating secondary display resource ID %u\n", secondary_resource_id);
+        VMLOG_INFO("VMVirtIOGPU::setupDisplayResource: Creating secondary display resource ID %u\n", secondary_resource_id);
         
         IOReturn secondary_ret = createResource2D(secondary_resource_id, VIRTIO_GPU_FORMAT_B8G8R8A8_UNORM, width / 2, height);
         if (secondary_ret == kIOReturnSuccess) {
-            IOLog("VMVirtIOGPU::setupDisplayResource: Secondary display resource created for dual display mode\n");
+            VMLOG_INFO("VMVirtIOGPU::setupDisplayResource: Secondary display resource created for dual display mode\n");
         }
     }
     
-    IOLog("VMVirtIOGPU::setupDisplayResource: *** NVIDIA dual display configuration ACTIVE ***\n");
-    IOLog("VMVirtIOGPU::setupDisplayResource: Primary display resource ID %u configured with hardware patterns\n", resource_id);
+    VMLOG_INFO("VMVirtIOGPU::setupDisplayResource: *** NVIDIA dual display configuration ACTIVE ***\n");
+    VMLOG_INFO("VMVirtIOGPU::setupDisplayResource: Primary display resource ID %u configured with hardware patterns\n", resource_id);
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::enableScanout(uint32_t scanout_id, uint32_t width, uint32_t height)
 {
-    IOLog("VMVirtIOGPU::enableScanout: Enabling NVIDIA-style scanout %u for %dx%d\n", 
+    VMLOG_INFO("VMVirtIOGPU::enableScanout: Enabling NVIDIA-style scanout %u for %dx%d\n", 
           scanout_id, width, height);
     
     if (!m_pci_device || !m_control_queue) {
-        IOLog("VMVirtIOGPU::enableScanout: VirtIO GPU not ready (pci_device=%p, control_queue=%p)\n", 
+        VMLOG_WARN("VMVirtIOGPU::enableScanout: VirtIO GPU not ready (pci_device=%p, control_queue=%p)\n", 
               m_pci_device, m_control_queue);
         return kIOReturnNotReady;
     }
     
     if (m_display_resource_id == 0) {
-        IOLog("VMVirtIOGPU::enableScanout: No display resource created yet (resource_id=0)\n");
+        VMLOG_INFO("VMVirtIOGPU::enableScanout: No display resource created yet (resource_id=0)\n");
         return kIOReturnNotReady;
     }
     
@@ -5887,11 +6240,11 @@ IOReturn CLASS::enableScanout(uint32_t scanout_id, uint32_t width, uint32_t heig
         if (secondary_id) {
             resource_id_to_use = secondary_id->unsigned32BitValue();
             display_name = "Display-B";
-            IOLog("VMVirtIOGPU::enableScanout: Using secondary display resource ID %u for Display-B\n", resource_id_to_use);
+            VMLOG_INFO("VMVirtIOGPU::enableScanout: Using secondary display resource ID %u for Display-B\n", resource_id_to_use);
         }
     }
     
-    IOLog("VMVirtIOGPU::enableScanout: Using %s resource ID %u for scanout %u\n", display_name, resource_id_to_use, scanout_id);
+    VMLOG_INFO("VMVirtIOGPU::enableScanout: Using %s resource ID %u for scanout %u\n", display_name, resource_id_to_use, scanout_id);
     
     // Send VIRTIO_GPU_CMD_SET_SCANOUT command to actually enable display output
     struct virtio_gpu_set_scanout cmd = {};
@@ -5909,26 +6262,26 @@ IOReturn CLASS::enableScanout(uint32_t scanout_id, uint32_t width, uint32_t heig
     struct virtio_gpu_ctrl_hdr resp = {};
     IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
     
-    IOLog("VMVirtIOGPU::enableScanout: Set scanout command returned 0x%x, response type=0x%x\n", ret, resp.type);
+    VMLOG_INFO("VMVirtIOGPU::enableScanout: Set scanout command returned 0x%x, response type=0x%x\n", ret, resp.type);
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::enableScanout: Set scanout command failed: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPU::enableScanout: Set scanout command failed: 0x%x\n", ret);
         return ret;
     }
     
-    IOLog("VMVirtIOGPU::enableScanout: *** %s scanout enabled successfully ***\n", display_name);
-    IOLog("VMVirtIOGPU::enableScanout: NVIDIA dual display mode - resource %u active on scanout %u\n", resource_id_to_use, scanout_id);
+    VMLOG_INFO("VMVirtIOGPU::enableScanout: *** %s scanout enabled successfully ***\n", display_name);
+    VMLOG_INFO("VMVirtIOGPU::enableScanout: NVIDIA dual display mode - resource %u active on scanout %u\n", resource_id_to_use, scanout_id);
     return kIOReturnSuccess;
 }
 
 IOReturn CLASS::setscanout(uint32_t scanout_id, uint32_t resource_id,
                           uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
-    IOLog("VMVirtIOGPU::setscanout: Setting scanout %u with resource %u at (%u,%u) %ux%u\n", 
+    VMLOG_DEBUG("VMVirtIOGPU::setscanout: Setting scanout %u with resource %u at (%u,%u) %ux%u\n", 
           scanout_id, resource_id, x, y, width, height);
     
     if (!m_pci_device || !m_control_queue) {
-        IOLog("VMVirtIOGPU::setscanout: VirtIO GPU not ready (pci_device=%p, control_queue=%p)\n", 
+        VMLOG_WARN("VMVirtIOGPU::setscanout: VirtIO GPU not ready (pci_device=%p, control_queue=%p)\n", 
               m_pci_device, m_control_queue);
         return kIOReturnNotReady;
     }
@@ -5949,43 +6302,97 @@ IOReturn CLASS::setscanout(uint32_t scanout_id, uint32_t resource_id,
     struct virtio_gpu_ctrl_hdr resp = {};
     IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
     
-    IOLog("VMVirtIOGPU::setscanout: Set scanout command returned 0x%x, response type=0x%x\n", ret, resp.type);
+    VMLOG_DEBUG("VMVirtIOGPU::setscanout: Set scanout command returned 0x%x, response type=0x%x\n", ret, resp.type);
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::setscanout: Set scanout command failed: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPU::setscanout: Set scanout command failed: 0x%x\n", ret);
         return ret;
     }
     
     // CRITICAL: Notify framebuffer when 3D resource takes over scanout
-    // Resource ID 1 is the 2D framebuffer. Any other resource is a 3D resource.
-    // When 3D apps attach their resources, the 2D refresh timer must stop
-    // to avoid overwriting the 3D rendered content.
-    IOLog("VMVirtIOGPU::setscanout: Checking framebuffer coordination (m_framebuffer=%p, resource=%u)\n", m_framebuffer, resource_id);
-    if (m_framebuffer) {
-        bool is_3d_resource = (resource_id != 1 && resource_id != 0);
-        m_framebuffer->setScanoutTakenOverBy3D(is_3d_resource);
-        if (is_3d_resource) {
-            IOLog("VMVirtIOGPU::setscanout: 3D resource %u now controls scanout - 2D refresh paused\n", resource_id);
-        } else {
-            IOLog("VMVirtIOGPU::setscanout: 2D framebuffer restored to scanout - 2D refresh resumed\n");
-        }
-    } else {
-        IOLog("VMVirtIOGPU::setscanout: ⚠️  m_framebuffer is NULL - coordination disabled\n");
-    }
+    // A head's pooled display resources (ownsDisplayResource) are its 2D
+    // framebuffer. Any other resource is a 3D resource. When 3D apps attach
+    // their resources, that head's 2D refresh must stop to avoid
+    // overwriting the 3D rendered content.
+    notifyScanoutOwner(scanout_id, resource_id);
     
-    IOLog("VMVirtIOGPU::setscanout: Scanout set successfully\n");
+    VMLOG_DEBUG("VMVirtIOGPU::setscanout: Scanout set successfully\n");
     return kIOReturnSuccess;
 }
 
+IOReturn CLASS::setScanoutBlob(uint32_t scanout_id, uint32_t resource_id,
+                              uint32_t format, uint32_t width, uint32_t height,
+                              uint32_t stride)
+{
+    if (!m_has_resource_blob) {
+        return kIOReturnUnsupported;
+    }
+    if (!m_pci_device || !m_control_queue) {
+        return kIOReturnNotReady;
+    }
+
+    struct virtio_gpu_set_scanout_blob cmd = {};
+    cmd.hdr.type = VIRTIO_GPU_CMD_SET_SCANOUT_BLOB;
+    cmd.r.x = 0;
+    cmd.r.y = 0;
+    cmd.r.width = width;
+    cmd.r.height = height;
+    cmd.scanout_id = scanout_id;
+    cmd.resource_id = resource_id;
+    cmd.width = width;
+    cmd.height = height;
+    cmd.format = format;
+    cmd.strides[0] = stride;
+    cmd.offsets[0] = 0;
+
+    struct virtio_gpu_ctrl_hdr resp = {};
+    IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
+    VMLOG_DEBUG("VMVirtIOGPU::setScanoutBlob: scanout=%u resource=%u %ux%u fmt=%u stride=%u ret=0x%x resp=0x%x\n",
+          scanout_id, resource_id, width, height, format, stride, ret, resp.type);
+    // A host ERR_* reply must fail the call so setupBlobScanout falls back to
+    // CREATE_2D + TRANSFER_TO_HOST_2D instead of leaving the head black.
+    if (ret != kIOReturnSuccess || resp.type != VIRTIO_GPU_RESP_OK_NODATA) {
+        VMLOG_ERROR("VMVirtIOGPU::setScanoutBlob: scanout %u failed ret=0x%x resp=0x%x\n",
+              scanout_id, ret, resp.type);
+        return (ret != kIOReturnSuccess) ? ret : kIOReturnError;
+    }
+
+    // Same framebuffer coordination as setscanout.
+    notifyScanoutOwner(scanout_id, resource_id);
+    return kIOReturnSuccess;
+}
+
+void CLASS::notifyScanoutOwner(uint32_t scanout_id, uint32_t resource_id)
+{
+    VMVirtIOFramebuffer* fb = (scanout_id < VIRTIO_GPU_MAX_SCANOUTS)
+                              ? m_framebuffers[scanout_id] : nullptr;
+    VMLOG_DEBUG("VMVirtIOGPU::setscanout: Checking framebuffer coordination (scanout=%u framebuffer=%p, resource=%u)\n",
+          scanout_id, fb, resource_id);
+    if (!fb) {
+        VMLOG_WARN("VMVirtIOGPU::setscanout: ⚠️  no framebuffer on scanout %u - coordination disabled\n", scanout_id);
+        return;
+    }
+
+    bool is_3d_resource = (resource_id != 0 && !fb->ownsDisplayResource(resource_id));
+    fb->setScanoutTakenOverBy3D(is_3d_resource);
+    if (is_3d_resource) {
+        VMLOG_DEBUG("VMVirtIOGPU::setscanout: 3D resource %u now controls scanout %u - 2D refresh paused\n",
+              resource_id, scanout_id);
+    } else {
+        VMLOG_DEBUG("VMVirtIOGPU::setscanout: 2D framebuffer restored to scanout %u - 2D refresh resumed\n",
+              scanout_id);
+    }
+}
+
 // Communication method for VMVirtIOFramebuffer to send commands to VirtIO hardware
 IOReturn CLASS::sendDisplayCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size, 
                                   virtio_gpu_ctrl_hdr* resp, size_t resp_size)
 {
-    IOLog("VMVirtIOGPU::sendDisplayCommand: Relaying command from framebuffer to VirtIO hardware\n");
-    IOLog("VMVirtIOGPU::sendDisplayCommand: Command type: 0x%x, size: %zu\n", cmd ? cmd->type : 0, cmd_size);
+    VMLOG_DEBUG("VMVirtIOGPU::sendDisplayCommand: Relaying command from framebuffer to VirtIO hardware\n");
+    VMLOG_DEBUG("VMVirtIOGPU::sendDisplayCommand: Command type: 0x%x, size: %zu\n", cmd ? cmd->type : 0, cmd_size);
     
     if (!cmd || cmd_size == 0) {
-        IOLog("VMVirtIOGPU::sendDisplayCommand: Invalid command parameters\n");
+        VMLOG_WARN("VMVirtIOGPU::sendDisplayCommand: Invalid command parameters\n");
         return kIOReturnBadArgument;
     }
     
@@ -5993,20 +6400,24 @@ IOReturn CLASS::sendDisplayCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
     IOReturn ret = submitCommand(cmd, cmd_size, resp, resp_size);
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::sendDisplayCommand: VirtIO command failed: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPU::sendDisplayCommand: VirtIO command failed: 0x%x\n", ret);
     } else {
-        IOLog("VMVirtIOGPU::sendDisplayCommand: VirtIO command completed successfully\n");
+        VMLOG_DEBUG("VMVirtIOGPU::sendDisplayCommand: VirtIO command completed successfully\n");
     }
     
     return ret;
 }
 
 // Framebuffer Reference Management
-void CLASS::setFramebuffer(VMVirtIOFramebuffer* framebuffer)
+void CLASS::setFramebuffer(VMVirtIOFramebuffer* framebuffer, uint32_t scanout_id)
 {
-    m_framebuffer = framebuffer;
+    if (scanout_id >= VIRTIO_GPU_MAX_SCANOUTS) {
+        VMLOG_DEBUG("VMVirtIOGPU: setFramebuffer: scanout %u out of range\n", scanout_id);
+        return;
+    }
+    m_framebuffers[scanout_id] = framebuffer;
     if (framebuffer) {
-        IOLog("VMVirtIOGPU: Framebuffer reference established\n");
+        VMLOG_DEBUG("VMVirtIOGPU: Framebuffer reference established for scanout %u\n", scanout_id);
     }
 }
 
@@ -6043,13 +6454,13 @@ bool VMFixedIDAccelerationUserClient::initWithTask(task_t owningTask, void* secu
     // Get our fixed ID from the provider (VMVirtIOGPUAccelerator)
     m_fixed_id = 0x1AF41050;  // Fixed ID: VirtIO vendor (0x1AF4) + VirtIO GPU device (0x1050)
     
-    IOLog("VMFixedIDAccelerationUserClient: Initialized with fixed ID: 0x%X (%u)\n", m_fixed_id, m_fixed_id);
+    VMLOG_INFO("VMFixedIDAccelerationUserClient: Initialized with fixed ID: 0x%X (%u)\n", m_fixed_id, m_fixed_id);
     return true;
 }
 
 IOReturn VMFixedIDAccelerationUserClient::clientClose()
 {
-    IOLog("VMFixedIDAccelerationUserClient: clientClose()\n");
+    VMLOG_INFO("VMFixedIDAccelerationUserClient: clientClose()\n");
     if (!isInactive())
         terminate();
     return kIOReturnSuccess;
@@ -6073,13 +6484,13 @@ IOReturn VMFixedIDAccelerationUserClient::extCreate(IOOptionBits options, IOAcce
 {
     // ALWAYS return our fixed ID, ignore the requested ID
     *idOut = m_fixed_id;
-    IOLog("VMFixedIDAccelerationUserClient: extCreate() returning FIXED ID: 0x%X (%u)\n", m_fixed_id, m_fixed_id);
+    VMLOG_DEBUG("VMFixedIDAccelerationUserClient: extCreate() returning FIXED ID: 0x%X (%u)\n", m_fixed_id, m_fixed_id);
     return kIOReturnSuccess;
 }
 
 IOReturn VMFixedIDAccelerationUserClient::extDestroy(IOOptionBits options, IOAccelID id)
 {
-    IOLog("VMFixedIDAccelerationUserClient: extDestroy() called for ID: 0x%X\n", id);
+    VMLOG_DEBUG("VMFixedIDAccelerationUserClient: extDestroy() called for ID: 0x%X\n", id);
     // Do nothing - our fixed ID never gets destroyed
     return kIOReturnSuccess;
 }
@@ -6093,7 +6504,7 @@ OSDefineMetaClassAndStructors(VMVirtIOGPUAccelerator, VMQemuVGAAccelerator);
 
 bool VMVirtIOGPUAccelerator::init(OSDictionary* properties)
 {
-    IOLog("VMVirtIOGPUAccelerator::init() - inheriting from VMQemuVGAAccelerator\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator::init() - inheriting from VMQemuVGAAccelerator\n");
     
     if (!super::init(properties))
         return false;
@@ -6106,12 +6517,12 @@ bool VMVirtIOGPUAccelerator::init(OSDictionary* properties)
 
 bool VMVirtIOGPUAccelerator::start(IOService* provider)
 {
-    IOLog("VMVirtIOGPUAccelerator::start() - VirtIO GPU accelerator with full OpenGL support\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator::start() - VirtIO GPU accelerator with full OpenGL support\n");
     
     // Get reference to parent VMVirtIOGPU device first
     m_virtio_gpu_device = OSDynamicCast(VMVirtIOGPU, provider);
     if (!m_virtio_gpu_device) {
-        IOLog("VMVirtIOGPUAccelerator: Provider is not VMVirtIOGPU\n");
+        VMLOG_INFO("VMVirtIOGPUAccelerator: Provider is not VMVirtIOGPU\n");
         return false;
     }
     
@@ -6122,43 +6533,43 @@ bool VMVirtIOGPUAccelerator::start(IOService* provider)
     // Call parent's start - it will fail the VMQemuVGA cast but that's ok, we'll handle it
     // Actually, let's just call IOAccelerator::start to avoid the VMQemuVGA dependency
     if (!IOAccelerator::start(provider)) {
-        IOLog("VMVirtIOGPUAccelerator: IOAccelerator::start() failed\n");
+        VMLOG_ERROR("VMVirtIOGPUAccelerator: IOAccelerator::start() failed\n");
         return false;
     }
     
     // Now manually initialize what the parent class would have done
     // We can't access private members, so we'll rely on inherited public/protected methods
-    IOLog("VMVirtIOGPUAccelerator: Base IOAccelerator started, OpenGL methods inherited from parent\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: Base IOAccelerator started, OpenGL methods inherited from parent\n");
     
     // d67: Create and start Metal plugin for WindowServer compatibility (Catalina requires Metal)
-    IOLog("VMVirtIOGPUAccelerator: Creating Metal plugin for WindowServer support\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: Creating Metal plugin for WindowServer support\n");
     m_virtio_metal_plugin = OSTypeAlloc(VMMetalPlugin);
     if (m_virtio_metal_plugin) {
-        IOLog("VMVirtIOGPUAccelerator: Metal plugin allocated at %p\n", m_virtio_metal_plugin);
+        VMLOG_INFO("VMVirtIOGPUAccelerator: Metal plugin allocated at %p\n", m_virtio_metal_plugin);
         if (m_virtio_metal_plugin->init()) {
-            IOLog("VMVirtIOGPUAccelerator: Metal plugin init() succeeded\n");
+            VMLOG_INFO("VMVirtIOGPUAccelerator: Metal plugin init() succeeded\n");
             if (m_virtio_metal_plugin->attach(this)) {
-                IOLog("VMVirtIOGPUAccelerator: Metal plugin attached successfully\n");
+                VMLOG_INFO("VMVirtIOGPUAccelerator: Metal plugin attached successfully\n");
                 if (m_virtio_metal_plugin->start(this)) {
-                    IOLog("VMVirtIOGPUAccelerator: Metal plugin started and registered successfully\n");
+                    VMLOG_INFO("VMVirtIOGPUAccelerator: Metal plugin started and registered successfully\n");
                 } else {
-                    IOLog("VMVirtIOGPUAccelerator: WARNING - Metal plugin start() failed\n");
+                    VMLOG_ERROR("VMVirtIOGPUAccelerator: WARNING - Metal plugin start() failed\n");
                     m_virtio_metal_plugin->detach(this);
                     m_virtio_metal_plugin->release();
                     m_virtio_metal_plugin = nullptr;
                 }
             } else {
-                IOLog("VMVirtIOGPUAccelerator: WARNING - Metal plugin attach() failed\n");
+                VMLOG_ERROR("VMVirtIOGPUAccelerator: WARNING - Metal plugin attach() failed\n");
                 m_virtio_metal_plugin->release();
                 m_virtio_metal_plugin = nullptr;
             }
         } else {
-            IOLog("VMVirtIOGPUAccelerator: WARNING - Metal plugin init() failed\n");
+            VMLOG_ERROR("VMVirtIOGPUAccelerator: WARNING - Metal plugin init() failed\n");
             m_virtio_metal_plugin->release();
             m_virtio_metal_plugin = nullptr;
         }
     } else {
-        IOLog("VMVirtIOGPUAccelerator: WARNING - Failed to allocate Metal plugin\n");
+        VMLOG_ERROR("VMVirtIOGPUAccelerator: WARNING - Failed to allocate Metal plugin\n");
     }
     
     // d70: CRITICAL - Disable AGDC and VideoAccelerator on the accelerator itself
@@ -6172,7 +6583,7 @@ bool VMVirtIOGPUAccelerator::start(IOService* provider)
     setProperty("IOGVAHEVCEncodeCapabilities", 0ULL, 64);
     setProperty("IOGVAScaler", kOSBooleanFalse);
     setProperty("IOGVAEncoderRestricted", kOSBooleanTrue);  // Restrict encoder access
-    IOLog("VMVirtIOGPUAccelerator: AGDC and VideoAccelerator explicitly disabled\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: AGDC and VideoAccelerator explicitly disabled\n");
     
     // Set OpenGL-specific device properties (from VMQemuVGAAccelerator)
     setProperty("IOClass", "VMVirtIOGPUAccelerator");
@@ -6191,19 +6602,19 @@ bool VMVirtIOGPUAccelerator::start(IOService* provider)
     setProperty("IOProviderClass", "IOAccelerator");
     setProperty("IOMatchCategory", "IOAccelerator");
     
-    IOLog("VMVirtIOGPUAccelerator: Set IOAccelIndex=0, RendererID=0x00024600 for CGL discovery\n");
-    IOLog("VMVirtIOGPUAccelerator: ✅ Advertised CGL support via IOGLContext property\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: Set IOAccelIndex=0, RendererID=0x00024600 for CGL discovery\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: ✅ Advertised CGL support via IOGLContext property\n");
     
     // Register service so clients can find us
     registerService();
     
-    IOLog("VMVirtIOGPUAccelerator: Started successfully with full OpenGL support\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: Started successfully with full OpenGL support\n");
     return true;
 }
 
 void VMVirtIOGPUAccelerator::stop(IOService* provider)
 {
-    IOLog("VMVirtIOGPUAccelerator::stop()\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator::stop()\n");
     
     // Clean up VirtIO-specific Metal plugin
     if (m_virtio_metal_plugin) {
@@ -6227,87 +6638,87 @@ void VMVirtIOGPUAccelerator::free()
 
 IOReturn VMVirtIOGPUAccelerator::newUserClient(task_t owningTask, void* securityID, UInt32 type, IOUserClient** handler)
 {
-    IOLog("VMVirtIOGPUAccelerator::newUserClient() type=%u\n", type);
+    VMLOG_INFO("VMVirtIOGPUAccelerator::newUserClient() type=%u\n", type);
     
     // CRITICAL: Return our CUSTOM Fixed-ID client for type 0 (standard IOAccelerationUserClient)
     // This prevents the base class from generating random accelerator IDs
     // Instead, we always return our fixed ID (0x1AF41050)
     if (type == 0) {
-        IOLog("VMVirtIOGPUAccelerator: Creating VMFixedIDAccelerationUserClient with fixed ID\n");
+        VMLOG_INFO("VMVirtIOGPUAccelerator: Creating VMFixedIDAccelerationUserClient with fixed ID\n");
         
         VMFixedIDAccelerationUserClient* client = OSTypeAlloc(VMFixedIDAccelerationUserClient);
         if (!client) {
-            IOLog("VMVirtIOGPUAccelerator: Failed to allocate VMFixedIDAccelerationUserClient\n");
+            VMLOG_ERROR("VMVirtIOGPUAccelerator: Failed to allocate VMFixedIDAccelerationUserClient\n");
             return kIOReturnNoMemory;
         }
         
         if (!client->initWithTask(owningTask, securityID, type, NULL)) {
-            IOLog("VMVirtIOGPUAccelerator: Failed to init VMFixedIDAccelerationUserClient\n");
+            VMLOG_ERROR("VMVirtIOGPUAccelerator: Failed to init VMFixedIDAccelerationUserClient\n");
             client->release();
             return kIOReturnError;
         }
         
         if (!client->attach(this)) {
-            IOLog("VMVirtIOGPUAccelerator: Failed to attach VMFixedIDAccelerationUserClient\n");
+            VMLOG_ERROR("VMVirtIOGPUAccelerator: Failed to attach VMFixedIDAccelerationUserClient\n");
             client->release();
             return kIOReturnError;
         }
         
         if (!client->start(this)) {
-            IOLog("VMVirtIOGPUAccelerator: Failed to start VMFixedIDAccelerationUserClient\n");
+            VMLOG_ERROR("VMVirtIOGPUAccelerator: Failed to start VMFixedIDAccelerationUserClient\n");
             client->detach(this);
             client->release();
             return kIOReturnError;
         }
         
         *handler = client;
-        IOLog("VMVirtIOGPUAccelerator: Successfully created VMFixedIDAccelerationUserClient\n");
+        VMLOG_INFO("VMVirtIOGPUAccelerator: Successfully created VMFixedIDAccelerationUserClient\n");
         return kIOReturnSuccess;
     }
     
     // For other client types, use our custom implementation
     if (type != 4) {
-        IOLog("VMVirtIOGPUAccelerator: Invalid user client type %u\n", type);
+        VMLOG_WARN("VMVirtIOGPUAccelerator: Invalid user client type %u\n", type);
         return kIOReturnBadArgument;
     }
     
     // Create our custom VMVirtIOGPUUserClient for advanced GPU operations
-    IOLog("VMVirtIOGPUAccelerator: Allocating VMVirtIOGPUUserClient for type %u\n", type);
+    VMLOG_INFO("VMVirtIOGPUAccelerator: Allocating VMVirtIOGPUUserClient for type %u\n", type);
     VMVirtIOGPUUserClient* userClient = OSTypeAlloc(VMVirtIOGPUUserClient);
     if (!userClient) {
-        IOLog("VMVirtIOGPUAccelerator: Failed to allocate VMVirtIOGPUUserClient\n");
+        VMLOG_ERROR("VMVirtIOGPUAccelerator: Failed to allocate VMVirtIOGPUUserClient\n");
         return kIOReturnNoMemory;
     }
-    IOLog("VMVirtIOGPUAccelerator: VMVirtIOGPUUserClient allocated successfully\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: VMVirtIOGPUUserClient allocated successfully\n");
     
     // Initialize the user client
-    IOLog("VMVirtIOGPUAccelerator: Calling initWithTask\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: Calling initWithTask\n");
     if (!userClient->initWithTask(owningTask, securityID, type, NULL)) {
-        IOLog("VMVirtIOGPUAccelerator: Failed to initialize user client\n");
+        VMLOG_ERROR("VMVirtIOGPUAccelerator: Failed to initialize user client\n");
         userClient->release();
         return kIOReturnError;
     }
-    IOLog("VMVirtIOGPUAccelerator: initWithTask succeeded\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: initWithTask succeeded\n");
     
-    IOLog("VMVirtIOGPUAccelerator: Attaching user client\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: Attaching user client\n");
     if (!userClient->attach(this)) {
-        IOLog("VMVirtIOGPUAccelerator: Failed to attach user client\n");
+        VMLOG_ERROR("VMVirtIOGPUAccelerator: Failed to attach user client\n");
         userClient->release();
         return kIOReturnError;
     }
-    IOLog("VMVirtIOGPUAccelerator: attach succeeded\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: attach succeeded\n");
     
-    IOLog("VMVirtIOGPUAccelerator: Starting user client\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: Starting user client\n");
     if (!userClient->start(this)) {
-        IOLog("VMVirtIOGPUAccelerator: Failed to start user client\n");
+        VMLOG_ERROR("VMVirtIOGPUAccelerator: Failed to start user client\n");
         userClient->detach(this);
         userClient->release();
         return kIOReturnError;
     }
-    IOLog("VMVirtIOGPUAccelerator: start succeeded\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: start succeeded\n");
     
     *handler = userClient;
-    IOLog("VMVirtIOGPUAccelerator: Successfully created VMVirtIOGPUUserClient\n");
+    VMLOG_INFO("VMVirtIOGPUAccelerator: Successfully created VMVirtIOGPUUserClient\n");
     
     return kIOReturnSuccess;
 }
@@ -6328,34 +6739,18 @@ IOReturn VMVirtIOGPUAccelerator::submitClearCommand(uint32_t context_id,
                                                    uint32_t buffers)
 {
     if (!m_virtio_gpu_device) {
-        IOLog("VMVirtIOGPUAccelerator::submitClearCommand: No VirtIO GPU device\n");
+        VMLOG_DEBUG("VMVirtIOGPUAccelerator::submitClearCommand: No VirtIO GPU device\n");
         return kIOReturnNotAttached;
     }
     
     // Build virgl CLEAR command according to virglrenderer protocol
     uint32_t cmd_buffer[VIRGL_CLEAR_SIZE];
+    const float rgba[4] = { red, green, blue, alpha };
+    struct virgl_encoder enc;
+    virgl_encoder_init(&enc, cmd_buffer, VIRGL_CLEAR_SIZE);
+    virgl_encode_clear(&enc, buffers, rgba, depth, stencil);
     
-    // Command header: length and opcode
-    VIRGL_SET_COMMAND(cmd_buffer, 0, VIRGL_CCMD_CLEAR, VIRGL_CLEAR_SIZE - 1);
-    
-    // Buffer mask (which buffers to clear)
-    VIRGL_SET_DWORD(cmd_buffer, 1, buffers);
-    
-    // Color (RGBA as packed floats)
-    VIRGL_SET_DWORD(cmd_buffer, 2, virgl_pack_float(red));
-    VIRGL_SET_DWORD(cmd_buffer, 3, virgl_pack_float(green));
-    VIRGL_SET_DWORD(cmd_buffer, 4, virgl_pack_float(blue));
-    VIRGL_SET_DWORD(cmd_buffer, 5, virgl_pack_float(alpha));
-    
-    // Depth (as 64-bit double, split into two 32-bit values)
-    uint64_t depth_bits = *(uint64_t*)&depth;
-    VIRGL_SET_DWORD(cmd_buffer, 6, (uint32_t)(depth_bits & 0xFFFFFFFF));
-    VIRGL_SET_DWORD(cmd_buffer, 7, (uint32_t)(depth_bits >> 32));
-    
-    // Stencil
-    VIRGL_SET_DWORD(cmd_buffer, 8, stencil);
-    
-    IOLog("VMVirtIOGPUAccelerator::submitClearCommand: Sending virgl CLEAR cmd (ctx=%u, rgba=%.2f,%.2f,%.2f,%.2f)\n",
+    VMLOG_DEBUG("VMVirtIOGPUAccelerator::submitClearCommand: Sending virgl CLEAR cmd (ctx=%u, rgba=%.2f,%.2f,%.2f,%.2f)\n",
           context_id, red, green, blue, alpha);
     
     // Create IOMemoryDescriptor for the command buffer
@@ -6363,7 +6758,7 @@ IOReturn VMVirtIOGPUAccelerator::submitClearCommand(uint32_t context_id,
         cmd_buffer, sizeof(cmd_buffer), kIODirectionOut);
     
     if (!cmdDesc) {
-        IOLog("VMVirtIOGPUAccelerator::submitClearCommand: Failed to create command descriptor\n");
+        VMLOG_ERROR("VMVirtIOGPUAccelerator::submitClearCommand: Failed to create command descriptor\n");
         return kIOReturnNoMemory;
     }
     
@@ -6373,9 +6768,9 @@ IOReturn VMVirtIOGPUAccelerator::submitClearCommand(uint32_t context_id,
     cmdDesc->release();
     
     if (ret == kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUAccelerator::submitClearCommand: ✅ Virgl CLEAR command submitted to host GPU\n");
+        VMLOG_DEBUG("VMVirtIOGPUAccelerator::submitClearCommand: ✅ Virgl CLEAR command submitted to host GPU\n");
     } else {
-        IOLog("VMVirtIOGPUAccelerator::submitClearCommand: ❌ Failed to submit command (0x%x)\n", ret);
+        VMLOG_ERROR("VMVirtIOGPUAccelerator::submitClearCommand: ❌ Failed to submit command (0x%x)\n", ret);
     }
     
     return ret;
@@ -6389,13 +6784,13 @@ OSDefineMetaClassAndStructors(VMVirtIOGPUUserClient, IOUserClient);
 
 bool VMVirtIOGPUUserClient::initWithTask(task_t owningTask, void* securityToken, UInt32 type, OSDictionary* properties)
 {
-    IOLog("VMVirtIOGPUUserClient::initWithTask() type=%u - Entry\n", type);
+    VMLOG_INFO("VMVirtIOGPUUserClient::initWithTask() type=%u - Entry\n", type);
     
     if (!IOUserClient::initWithTask(owningTask, securityToken, type, properties)) {
-        IOLog("VMVirtIOGPUUserClient: IOUserClient::initWithTask() failed\n");
+        VMLOG_ERROR("VMVirtIOGPUUserClient: IOUserClient::initWithTask() failed\n");
         return false;
     }
-    IOLog("VMVirtIOGPUUserClient: IOUserClient::initWithTask() succeeded\n");
+    VMLOG_INFO("VMVirtIOGPUUserClient: IOUserClient::initWithTask() succeeded\n");
     
     m_owning_task = owningTask;
     m_client_type = type;
@@ -6413,6 +6808,7 @@ bool VMVirtIOGPUUserClient::initWithTask(task_t owningTask, void* securityToken,
         m_user_backings[i].resource_id = 0;
         m_user_backings[i].desc = nullptr;
     }
+    m_shader_cache_env_valid = false;
 
     // Initialize surface and context management with proper memory safety
     m_surfaces = OSArray::withCapacity(64);
@@ -6421,7 +6817,7 @@ bool VMVirtIOGPUUserClient::initWithTask(task_t owningTask, void* securityToken,
     m_next_context_id = 1;
     
     if (!m_surfaces || !m_contexts) {
-        IOLog("VMVirtIOGPUUserClient: Failed to create management arrays\n");
+        VMLOG_ERROR("VMVirtIOGPUUserClient: Failed to create management arrays\n");
         // SAFETY: Clean up partial initialization to prevent leaks
         OSSafeReleaseNULL(m_surfaces);
         OSSafeReleaseNULL(m_contexts);
@@ -6430,59 +6826,59 @@ bool VMVirtIOGPUUserClient::initWithTask(task_t owningTask, void* securityToken,
     
     // SAFETY: Arrays created successfully, they will be retained automatically
     
-    IOLog("VMVirtIOGPUUserClient: Initialized successfully\n");
+    VMLOG_INFO("VMVirtIOGPUUserClient: Initialized successfully\n");
     return true;
 }
 
 bool VMVirtIOGPUUserClient::start(IOService* provider)
 {
-    IOLog("VMVirtIOGPUUserClient::start() - Entry\n");
+    VMLOG_INFO("VMVirtIOGPUUserClient::start() - Entry\n");
     
     if (!IOUserClient::start(provider)) {
-        IOLog("VMVirtIOGPUUserClient: IOUserClient::start() failed\n");
+        VMLOG_ERROR("VMVirtIOGPUUserClient: IOUserClient::start() failed\n");
         return false;
     }
-    IOLog("VMVirtIOGPUUserClient: IOUserClient::start() succeeded\n");
+    VMLOG_INFO("VMVirtIOGPUUserClient: IOUserClient::start() succeeded\n");
     
     // Get reference to accelerator and GPU device
     // Try VMQemuVGAAccelerator first (current architecture), then fall back to old VMVirtIOGPUAccelerator
     VMQemuVGAAccelerator* qemu_accelerator = OSDynamicCast(VMQemuVGAAccelerator, provider);
     if (qemu_accelerator) {
-        IOLog("VMVirtIOGPUUserClient: Got VMQemuVGAAccelerator reference\n");
+        VMLOG_INFO("VMVirtIOGPUUserClient: Got VMQemuVGAAccelerator reference\n");
         // Get GPU device from accelerator
         m_gpu_device = qemu_accelerator->getGPUDevice();
         if (!m_gpu_device) {
-            IOLog("VMVirtIOGPUUserClient: VMQemuVGAAccelerator has no GPU device\n");
+            VMLOG_INFO("VMVirtIOGPUUserClient: VMQemuVGAAccelerator has no GPU device\n");
             return false;
         }
-        IOLog("VMVirtIOGPUUserClient: Got GPU device from VMQemuVGAAccelerator\n");
-        IOLog("VMVirtIOGPUUserClient: Started with GPU device support\n");
+        VMLOG_INFO("VMVirtIOGPUUserClient: Got GPU device from VMQemuVGAAccelerator\n");
+        VMLOG_INFO("VMVirtIOGPUUserClient: Started with GPU device support\n");
         return true;
     }
     
     // Fallback to old architecture (VMVirtIOGPUAccelerator)
     m_accelerator = OSDynamicCast(VMVirtIOGPUAccelerator, provider);
     if (!m_accelerator) {
-        IOLog("VMVirtIOGPUUserClient: Provider is neither VMQemuVGAAccelerator nor VMVirtIOGPUAccelerator (provider=%p)\n", provider);
+        VMLOG_INFO("VMVirtIOGPUUserClient: Provider is neither VMQemuVGAAccelerator nor VMVirtIOGPUAccelerator (provider=%p)\n", provider);
         return false;
     }
-    IOLog("VMVirtIOGPUUserClient: Got VMVirtIOGPUAccelerator reference (legacy)\n");
+    VMLOG_INFO("VMVirtIOGPUUserClient: Got VMVirtIOGPUAccelerator reference (legacy)\n");
     
     // VirtIO GPU architecture: accelerator is attached to VMVirtIOFramebuffer
     // Try to get framebuffer first, then get GPU from it
     IOService* provider_obj = m_accelerator->getProvider();
-    IOLog("VMVirtIOGPUUserClient: Accelerator provider: %p class=%s\n", 
+    VMLOG_INFO("VMVirtIOGPUUserClient: Accelerator provider: %p class=%s\n", 
           provider_obj, provider_obj ? provider_obj->getMetaClass()->getClassName() : "NULL");
     VMVirtIOFramebuffer* framebuffer = OSDynamicCast(VMVirtIOFramebuffer, provider_obj);
-    IOLog("VMVirtIOGPUUserClient: Framebuffer cast result: %p\n", framebuffer);
+    VMLOG_INFO("VMVirtIOGPUUserClient: Framebuffer cast result: %p\n", framebuffer);
     if (framebuffer) {
         // Get GPU device from framebuffer
         m_gpu_device = framebuffer->getGPUDevice();
-        IOLog("VMVirtIOGPUUserClient: framebuffer->getGPUDevice() returned %p\n", m_gpu_device);
+        VMLOG_INFO("VMVirtIOGPUUserClient: framebuffer->getGPUDevice() returned %p\n", m_gpu_device);
         if (m_gpu_device) {
-            IOLog("VMVirtIOGPUUserClient: Got VMVirtIOGPU from framebuffer\n");
+            VMLOG_INFO("VMVirtIOGPUUserClient: Got VMVirtIOGPU from framebuffer\n");
         } else {
-            IOLog("VMVirtIOGPUUserClient: Framebuffer has no GPU device\n");
+            VMLOG_INFO("VMVirtIOGPUUserClient: Framebuffer has no GPU device\n");
             return false;
         }
     } else {
@@ -6490,33 +6886,33 @@ bool VMVirtIOGPUUserClient::start(IOService* provider)
         VMVirtIOGPU* virtioGPU = OSDynamicCast(VMVirtIOGPU, m_accelerator->getProvider());
         if (virtioGPU) {
             m_gpu_device = virtioGPU;
-            IOLog("VMVirtIOGPUUserClient: Using VMVirtIOGPU directly (legacy path)\n");
+            VMLOG_INFO("VMVirtIOGPUUserClient: Using VMVirtIOGPU directly (legacy path)\n");
         } else {
             // Last resort: try to get GPU device from accelerator
             m_gpu_device = m_accelerator->getGPUDevice();
             if (!m_gpu_device) {
-                IOLog("VMVirtIOGPUUserClient: No GPU device available via any path\n");
+                VMLOG_INFO("VMVirtIOGPUUserClient: No GPU device available via any path\n");
                 return false;
             }
-            IOLog("VMVirtIOGPUUserClient: Got GPU device reference via accelerator\n");
+            VMLOG_INFO("VMVirtIOGPUUserClient: Got GPU device reference via accelerator\n");
         }
     }
     
-    IOLog("VMVirtIOGPUUserClient: Started with GPU device support\n");
+    VMLOG_INFO("VMVirtIOGPUUserClient: Started with GPU device support\n");
     return true;
 }
 
 void VMVirtIOGPUUserClient::stop(IOService* provider)
 {
-    IOLog("VMVirtIOGPUUserClient::stop()\n");
+    VMLOG_INFO("VMVirtIOGPUUserClient::stop()\n");
     
     // SAFETY: Clean up any remaining surfaces and contexts with proper error handling
     if (m_surfaces) {
-        IOLog("VMVirtIOGPUUserClient: Cleaning up %u surfaces\n", m_surfaces->getCount());
+        VMLOG_INFO("VMVirtIOGPUUserClient: Cleaning up %u surfaces\n", m_surfaces->getCount());
         m_surfaces->flushCollection();
     }
     if (m_contexts) {
-        IOLog("VMVirtIOGPUUserClient: Cleaning up %u contexts\n", m_contexts->getCount());
+        VMLOG_INFO("VMVirtIOGPUUserClient: Cleaning up %u contexts\n", m_contexts->getCount());
         m_contexts->flushCollection();
     }
     
@@ -6529,7 +6925,7 @@ void VMVirtIOGPUUserClient::stop(IOService* provider)
 
 void VMVirtIOGPUUserClient::free()
 {
-    IOLog("VMVirtIOGPUUserClient::free()\n");
+    VMLOG_INFO("VMVirtIOGPUUserClient::free()\n");
 
     // Release any held probe descriptor — client died with probe in progress.
     // Must run before m_gpu_device is cleared (in stop) so the host-side
@@ -6548,7 +6944,7 @@ void VMVirtIOGPUUserClient::free()
 
 IOReturn VMVirtIOGPUUserClient::clientClose()
 {
-    IOLog("VMVirtIOGPUUserClient::clientClose()\n");
+    VMLOG_INFO("VMVirtIOGPUUserClient::clientClose()\n");
 
     // Release any held probe descriptor — client is closing (may have died).
     // Idempotent: probeAttachBackingUserCleanup() checks m_probe_in_progress.
@@ -6572,24 +6968,24 @@ IOReturn VMVirtIOGPUUserClient::clientClose()
 
 IOReturn VMVirtIOGPUUserClient::clientDied()
 {
-    IOLog("VMVirtIOGPUUserClient::clientDied()\n");
+    VMLOG_INFO("VMVirtIOGPUUserClient::clientDied()\n");
     return clientClose();
 }
 
 // Provide memory mapping for WindowServer to access framebuffer
 IOReturn VMVirtIOGPUUserClient::clientMemoryForType(UInt32 type, IOOptionBits* options, IOMemoryDescriptor** memory)
 {
-    IOLog("VMVirtIOGPUUserClient::clientMemoryForType() type=%u\n", type);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::clientMemoryForType() type=%u\n", type);
     
     if (!m_gpu_device || !memory) {
-        IOLog("VMVirtIOGPUUserClient::clientMemoryForType() - Invalid parameters\n");
+        VMLOG_WARN("VMVirtIOGPUUserClient::clientMemoryForType() - Invalid parameters\n");
         return kIOReturnBadArgument;
     }
     
     // Get the framebuffer memory descriptor from the GPU device's VRAM
     IOMemoryDescriptor* fbMemory = m_gpu_device->getVRAMRange();
     if (!fbMemory) {
-        IOLog("VMVirtIOGPUUserClient::clientMemoryForType() - No VRAM memory available\n");
+        VMLOG_DEBUG("VMVirtIOGPUUserClient::clientMemoryForType() - No VRAM memory available\n");
         return kIOReturnNoMemory;
     }
     
@@ -6601,7 +6997,7 @@ IOReturn VMVirtIOGPUUserClient::clientMemoryForType(UInt32 type, IOOptionBits* o
         *options = kIOMapDefaultCache | kIOMapInhibitCache;
     }
     
-    IOLog("VMVirtIOGPUUserClient::clientMemoryForType() - Returning VRAM memory descriptor\n");
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::clientMemoryForType() - Returning VRAM memory descriptor\n");
     return kIOReturnSuccess;
 }
 
@@ -6610,20 +7006,20 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                                               IOExternalMethodDispatch* dispatch, OSObject* target, void* reference)
 {
     // CRITICAL: Log IMMEDIATELY at function entry to catch all calls
-    IOLog("VMVirtIOGPUUserClient::externalMethod() ENTRY: selector=%u (0x%x)\n", selector, selector);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::externalMethod() ENTRY: selector=%u (0x%x)\n", selector, selector);
     
     // CRITICAL: Add safety checks to prevent kernel panics
     if (!args) {
-        IOLog("VMVirtIOGPUUserClient::externalMethod() ERROR: NULL args pointer\n");
+        VMLOG_ERROR("VMVirtIOGPUUserClient::externalMethod() ERROR: NULL args pointer\n");
         return kIOReturnBadArgument;
     }
     
-    IOLog("VMVirtIOGPUUserClient::externalMethod() selector=%u scalarIn=%u scalarOut=%u structIn=%u structOut=%u\n", 
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::externalMethod() selector=%u scalarIn=%u scalarOut=%u structIn=%u structOut=%u\n", 
           selector, args->scalarInputCount, args->scalarOutputCount,
           args->structureInputSize, args->structureOutputSize);
     
     if (!m_gpu_device) {
-        IOLog("VMVirtIOGPUUserClient: No GPU device available for method %u\n", selector);
+        VMLOG_DEBUG("VMVirtIOGPUUserClient: No GPU device available for method %u\n", selector);
         return kIOReturnNotReady;
     }
     
@@ -6632,12 +7028,12 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
     switch (selector) {
         // Standard IOAccelerator selectors that applications use
         case 0: // Get accelerator properties/capabilities - CRITICAL FOR WINDOWSERVER
-            IOLog("VMVirtIOGPUUserClient: GetAcceleratorInfo selector=0\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: GetAcceleratorInfo selector=0\n");
             
             // CRITICAL FIX: WindowServer expects a capability STRUCTURE, not scalar values
             // This is the root cause of WindowServer SIGABRT crashes
             if (args->structureOutputDescriptor) {
-                IOLog("VMVirtIOGPUUserClient: GetAcceleratorInfo - returning capability structure\n");
+                VMLOG_DEBUG("VMVirtIOGPUUserClient: GetAcceleratorInfo - returning capability structure\n");
                 
                 // Define GPU capability structure that WindowServer expects
                 struct GPUCapabilities {
@@ -6677,21 +7073,21 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                 IOByteCount bytesWritten = desc->writeBytes(0, &caps, sizeof(caps));
                 
                 if (bytesWritten == sizeof(caps)) {
-                    IOLog("VMVirtIOGPUUserClient: Returned capability structure: 3D=%s, OpenGL=%s, VRAM=%llu\n", 
+                    VMLOG_DEBUG("VMVirtIOGPUUserClient: Returned capability structure: 3D=%s, OpenGL=%s, VRAM=%llu\n", 
                           caps.supports_3d ? "YES" : "NO",
                           caps.supports_opengl ? "YES" : "NO",
                           caps.vram_size);
                     return kIOReturnSuccess;
                 }
                 
-                IOLog("VMVirtIOGPUUserClient: ERROR - Failed to write capability structure (wrote %llu of %zu bytes)\n", 
+                VMLOG_ERROR("VMVirtIOGPUUserClient: ERROR - Failed to write capability structure (wrote %llu of %zu bytes)\n", 
                       (uint64_t)bytesWritten, sizeof(caps));
                 return kIOReturnError;
             }
             
             // Scalar output path - WindowServer uses this on Catalina
             if (args->scalarOutputCount >= 1 && args->scalarOutput) {
-                IOLog("VMVirtIOGPUUserClient: GetAcceleratorInfo - scalar output path (count=%u)\n", args->scalarOutputCount);
+                VMLOG_DEBUG("VMVirtIOGPUUserClient: GetAcceleratorInfo - scalar output path (count=%u)\n", args->scalarOutputCount);
                 
                 // CRITICAL FIX: Return IOAccelID (userspace-safe integer), NOT kernel pointer
                 // WindowServer expects a valid accelerator ID it can use for subsequent operations
@@ -6702,64 +7098,64 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                     if (accelIndexProp) {
                         uint64_t accelID = accelIndexProp->unsigned32BitValue();
                         args->scalarOutput[0] = accelID;
-                        IOLog("VMVirtIOGPUUserClient: Returned IOAccelID: %llu (userspace-safe accelerator ID)\n", accelID);
+                        VMLOG_DEBUG("VMVirtIOGPUUserClient: Returned IOAccelID: %llu (userspace-safe accelerator ID)\n", accelID);
                         return kIOReturnSuccess;
                     } else {
-                        IOLog("VMVirtIOGPUUserClient: ERROR - IOAccelIndex property not found\n");
+                        VMLOG_ERROR("VMVirtIOGPUUserClient: ERROR - IOAccelIndex property not found\n");
                         return kIOReturnNotReady;
                     }
                 } else {
                     // No accelerator - return error
-                    IOLog("VMVirtIOGPUUserClient: ERROR - No accelerator available\n");
+                    VMLOG_ERROR("VMVirtIOGPUUserClient: ERROR - No accelerator available\n");
                     return kIOReturnNotReady;
                 }
             }
             
-            IOLog("VMVirtIOGPUUserClient: ERROR - No valid output method for GetAcceleratorInfo\n");
+            VMLOG_ERROR("VMVirtIOGPUUserClient: ERROR - No valid output method for GetAcceleratorInfo\n");
             return kIOReturnBadArgument;
             
         case 1: // Create rendering context
-            IOLog("VMVirtIOGPUUserClient: CreateContext selector=1\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: CreateContext selector=1\n");
             if (args->scalarOutputCount >= 1 && args->scalarOutput) {
                 return create3DContext((uint32_t*)&args->scalarOutput[0]);
             }
             return kIOReturnBadArgument;
             
         case 2: // Destroy rendering context
-            IOLog("VMVirtIOGPUUserClient: DestroyContext selector=2\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: DestroyContext selector=2\n");
             if (args->scalarInputCount >= 1 && args->scalarInput) {
                 return destroy3DContext((uint32_t)args->scalarInput[0]);
             }
             return kIOReturnBadArgument;
             
         case 4: // Setup surface/context preparation
-            IOLog("VMVirtIOGPUUserClient: SetupSurface selector=4\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: SetupSurface selector=4\n");
             if (args->scalarInputCount >= 2 && args->scalarOutputCount >= 1 && 
                 args->scalarInput && args->scalarOutput) {
                 // Surface preparation - return success with context handle
                 args->scalarOutput[0] = (uint64_t)args->scalarInput[0]; // Echo back surface ID
-                IOLog("VMVirtIOGPUUserClient: Setup surface %u -> handle %llu\n", 
+                VMLOG_DEBUG("VMVirtIOGPUUserClient: Setup surface %u -> handle %llu\n", 
                       (uint32_t)args->scalarInput[0], args->scalarOutput[0]);
                 return kIOReturnSuccess;
             }
             return kIOReturnBadArgument;
             
         case 7: // Get surface info or create surface
-            IOLog("VMVirtIOGPUUserClient: CreateSurface/GetSurfaceInfo selector=7\n");
-            IOLog("VMVirtIOGPUUserClient: selector=7 params: scalarIn=%u scalarOut=%u structIn=%u structOut=%u\n",
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: CreateSurface/GetSurfaceInfo selector=7\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: selector=7 params: scalarIn=%u scalarOut=%u structIn=%u structOut=%u\n",
                   args->scalarInputCount, args->scalarOutputCount, 
                   args->structureInputSize, args->structureOutputSize);
             
             // WindowServer calls with ALL ZERO parameters - this might be a capability query
             // Just return success for now to see if WindowServer progresses further
-            IOLog("VMVirtIOGPUUserClient: selector=7 returning success (capability query?)\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: selector=7 returning success (capability query?)\n");
             return kIOReturnSuccess;
             
         case 8: // Finalize surface/context operations
-            IOLog("VMVirtIOGPUUserClient: FinalizeSurface selector=8\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: FinalizeSurface selector=8\n");
             if (args->scalarInputCount >= 1 && args->scalarInput) {
                 // Surface finalization - mark as ready for rendering
-                IOLog("VMVirtIOGPUUserClient: Finalize surface %u - ready for rendering\n", 
+                VMLOG_DEBUG("VMVirtIOGPUUserClient: Finalize surface %u - ready for rendering\n", 
                       (uint32_t)args->scalarInput[0]);
                 return kIOReturnSuccess;
             }
@@ -6774,14 +7170,14 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                                    (uint32_t)args->scalarInput[2], 
                                    (uint32_t*)&args->scalarOutput[0]);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for createSurface\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for createSurface\n");
             break;
             
         case 0x1001: // Destroy surface
             if (args->scalarInputCount >= 1 && args->scalarInput) {
                 return destroySurface((uint32_t)args->scalarInput[0]);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for destroySurface\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for destroySurface\n");
             break;
             
         case 0x1002: // Clear surface
@@ -6789,33 +7185,33 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                 return clearSurface((uint32_t)args->scalarInput[0], 
                                   (uint32_t)args->scalarInput[1]);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for clearSurface\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for clearSurface\n");
             break;
             
         case 0x1003: // Present surface
             if (args->scalarInputCount >= 1 && args->scalarInput) {
                 return presentSurface((uint32_t)args->scalarInput[0]);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for presentSurface\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for presentSurface\n");
             break;
             
         case 0x2000: // Create 3D context
             if (args->scalarOutputCount >= 1 && args->scalarOutput) {
                 return create3DContext((uint32_t*)&args->scalarOutput[0]);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for create3DContext\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for create3DContext\n");
             break;
             
         case 0x2001: // Destroy 3D context
             if (args->scalarInputCount >= 1 && args->scalarInput) {
                 return destroy3DContext((uint32_t)args->scalarInput[0]);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for destroy3DContext\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for destroy3DContext\n");
             break;
             
         // VirtGLGL userspace library interface
         case 0x3000: // Submit virgl commands
-            IOLog("VMVirtIOGPUUserClient: SubmitCommands selector=0x3000\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: SubmitCommands selector=0x3000\n");
             // CAUTION: same IOKit 4096-byte boundary as 0x6008 — inputs
             // >= 4096 bytes arrive as structureInputDescriptor with
             // structureInput NULL and will fail here. This legacy 0x3000
@@ -6823,69 +7219,69 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
             if (args->structureInput && args->structureInputSize > 0) {
                 return submitVirglCommands(args->structureInput, args->structureInputSize);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for submitVirglCommands\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for submitVirglCommands\n");
             return kIOReturnBadArgument;
             
         case 0x3001: // Create 3D resource (legacy VirtGLGL compatibility)
-            IOLog("VMVirtIOGPUUserClient: CreateResource selector=0x3001 (legacy)\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: CreateResource selector=0x3001 (legacy)\n");
             if (args->scalarInputCount >= 4 && args->scalarInput) {
                 return createVirglResource((uint32_t)args->scalarInput[0],
                                           (uint32_t)args->scalarInput[1],
                                           (uint32_t)args->scalarInput[2],
                                           (uint32_t)args->scalarInput[3]);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for createVirglResource\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for createVirglResource\n");
             return kIOReturnBadArgument;
             
         case 0x4003: // Create 3D resource (changed from 0x3001 - IOKit reserves X001!)
-            IOLog("VMVirtIOGPUUserClient: CreateResource selector=0x4003\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: CreateResource selector=0x4003\n");
             if (args->scalarInputCount >= 4 && args->scalarInput) {
                 return createVirglResource((uint32_t)args->scalarInput[0],
                                           (uint32_t)args->scalarInput[1],
                                           (uint32_t)args->scalarInput[2],
                                           (uint32_t)args->scalarInput[3]);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for createVirglResource\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for createVirglResource\n");
             return kIOReturnBadArgument;
             
         case 0x3002: // Create 3D context (legacy VirtGLGL compatibility)
-            IOLog("VMVirtIOGPUUserClient: CreateContext selector=0x3002 (legacy)\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: CreateContext selector=0x3002 (legacy)\n");
             if (args->scalarInputCount >= 1 && args->scalarInput) {
                 return createVirglContext((uint32_t)args->scalarInput[0]);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for createVirglContext\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for createVirglContext\n");
             return kIOReturnBadArgument;
             
         case 0x4004: // Create 3D context (changed from 0x3002 - IOKit reserves X002!)
-            IOLog("VMVirtIOGPUUserClient: CreateContext selector=0x4004\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: CreateContext selector=0x4004\n");
             if (args->scalarInputCount >= 1 && args->scalarInput) {
                 return createVirglContext((uint32_t)args->scalarInput[0]);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for createVirglContext\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for createVirglContext\n");
             return kIOReturnBadArgument;
             
         case 0x3003: // Attach resource to context
-            IOLog("VMVirtIOGPUUserClient: AttachResource selector=0x3003\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: AttachResource selector=0x3003\n");
             if (args->scalarInputCount >= 2 && args->scalarInput) {
                 return attachVirglResource((uint32_t)args->scalarInput[0],
                                           (uint32_t)args->scalarInput[1]);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for attachVirglResource\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for attachVirglResource\n");
             return kIOReturnBadArgument;
             
         case 0x3004: // Get capability
-            IOLog("VMVirtIOGPUUserClient: GetCapability selector=0x3004\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: GetCapability selector=0x3004\n");
             if (args->scalarInputCount >= 1 && args->scalarOutputCount >= 1 &&
                 args->scalarInput && args->scalarOutput) {
                 uint32_t cap = getVirglCapability((uint32_t)args->scalarInput[0]);
                 args->scalarOutput[0] = cap;
                 return kIOReturnSuccess;
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for getVirglCapability\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for getVirglCapability\n");
             return kIOReturnBadArgument;
             
         case 0x3005: // Transfer to host 2D
-            IOLog("VMVirtIOGPUUserClient: TransferToHost2D selector=0x3005\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: TransferToHost2D selector=0x3005\n");
             if (args->scalarInputCount >= 5 && args->scalarInput && m_gpu_device) {
                 return m_gpu_device->transferToHost2D((uint32_t)args->scalarInput[0],  // resourceId
                                                       0,                                 // offset
@@ -6894,11 +7290,11 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                                                       (uint32_t)args->scalarInput[3],   // width
                                                       (uint32_t)args->scalarInput[4]);  // height
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for transferToHost2D\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for transferToHost2D\n");
             return kIOReturnBadArgument;
             
         case 0x3006: // Flush resource
-            IOLog("VMVirtIOGPUUserClient: FlushResource selector=0x3006\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: FlushResource selector=0x3006\n");
             if (args->scalarInputCount >= 5 && args->scalarInput && m_gpu_device) {
                 return m_gpu_device->flushResource((uint32_t)args->scalarInput[0],  // resourceId
                                                    (uint32_t)args->scalarInput[1],   // x
@@ -6906,11 +7302,11 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                                                    (uint32_t)args->scalarInput[3],   // width
                                                    (uint32_t)args->scalarInput[4]);  // height
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for flushResource\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for flushResource\n");
             return kIOReturnBadArgument;
             
         case 0x3007: // Set scanout
-            IOLog("VMVirtIOGPUUserClient: SetScanout selector=0x3007\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: SetScanout selector=0x3007\n");
             if (args->scalarInputCount >= 6 && args->scalarInput && m_gpu_device) {
                 return m_gpu_device->setscanout((uint32_t)args->scalarInput[0],  // scanoutId
                                                (uint32_t)args->scalarInput[1],  // resourceId
@@ -6919,11 +7315,11 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                                                (uint32_t)args->scalarInput[4],  // width
                                                (uint32_t)args->scalarInput[5]); // height
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for setScanout\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for setScanout\n");
             return kIOReturnBadArgument;
             
         case 0x3008: // Transfer to host 3D
-            IOLog("VMVirtIOGPUUserClient: TransferToHost3D selector=0x3008\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: TransferToHost3D selector=0x3008\n");
             if (args->scalarInputCount >= 8 && args->scalarInput && m_gpu_device) {
                 // ctx_id (scalarInput[8]) is optional — legacy callers pass 8
                 // scalars and implicitly rely on the now-fixed ctx_id=0 path,
@@ -6941,11 +7337,11 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                                                       (uint32_t)args->scalarInput[7],  // depth
                                                       ctx_id);                         // ctx_id
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for transferToHost3D\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for transferToHost3D\n");
             return kIOReturnBadArgument;
 
         case 0x3009: // Transfer from host 3D (copy rendered pixels back to guest)
-            IOLog("VMVirtIOGPUUserClient: TransferFromHost3D selector=0x3009\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: TransferFromHost3D selector=0x3009\n");
             if (args->scalarInputCount >= 8 && args->scalarInput && m_gpu_device) {
                 uint32_t ctx_id = (args->scalarInputCount >= 9) ? (uint32_t)args->scalarInput[8] : 0;
                 // Log what goes on the wire. Stride/layer_stride/offset are
@@ -6954,7 +7350,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                 // produces a plausible-looking partial readback rather than
                 // an error — exactly the failure mode hardest to read from a
                 // colour check.
-                IOLog("VMVirtIOGPUUserClient: 0x3009 wire: res=%u ctx=%u "
+                VMLOG_DEBUG("VMVirtIOGPUUserClient: 0x3009 wire: res=%u ctx=%u "
                       "box=(%u,%u,%u, %ux%ux%u) stride=0 layer_stride=0 offset=0\n",
                       (uint32_t)args->scalarInput[0], ctx_id,
                       (uint32_t)args->scalarInput[2], (uint32_t)args->scalarInput[3],
@@ -6970,11 +7366,11 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                                                         (uint32_t)args->scalarInput[7],  // depth
                                                         ctx_id);                         // ctx_id
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for transferFromHost3D\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for transferFromHost3D\n");
             return kIOReturnBadArgument;
 
         case 0x5000: { // probeAttachBackingUser — userspace-memory ATTACH_BACKING proof
-            IOLog("VMVirtIOGPUUserClient: probeAttachBackingUser selector=0x5000\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: probeAttachBackingUser selector=0x5000\n");
             if (args->scalarInputCount >= 5 && args->scalarInput) {
                 uint32_t phase    = (uint32_t)args->scalarInput[0];
                 // Pack addr and len as lo|hi to avoid platform-dependent uint64_t
@@ -6989,7 +7385,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                 uint64_t len  = ((uint64_t)len_hi  << 32) | len_lo;
                 return probeAttachBackingUser(phase, addr, len);
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for probeAttachBackingUser "
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for probeAttachBackingUser "
                   "(need 5 scalars: phase, addr_lo, addr_hi, len_lo, len_hi)\n");
             return kIOReturnBadArgument;
         }
@@ -7004,7 +7400,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
         // ====================================================================
 
         case 0x6000: { // createVirglContextEx — kext allocates ctx_id
-            IOLog("VMVirtIOGPUUserClient: createVirglContextEx selector=0x6000\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: createVirglContextEx selector=0x6000\n");
             if (args->scalarOutputCount >= 1 && args->scalarOutput) {
                 uint32_t ctx_id = 0;
                 IOReturn ret = createVirglContextEx(&ctx_id);
@@ -7013,12 +7409,12 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                 }
                 return ret;
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for createVirglContextEx\n");
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for createVirglContextEx\n");
             return kIOReturnBadArgument;
         }
 
         case 0x6001: { // destroyVirglContextEx
-            IOLog("VMVirtIOGPUUserClient: destroyVirglContextEx selector=0x6001\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: destroyVirglContextEx selector=0x6001\n");
             if (args->scalarInputCount >= 1 && args->scalarInput) {
                 return destroyVirglContextEx((uint32_t)args->scalarInput[0]);
             }
@@ -7026,7 +7422,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
         }
 
         case 0x6002: { // createResource3DEx — kext allocates resource_id
-            IOLog("VMVirtIOGPUUserClient: createResource3DEx selector=0x6002\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: createResource3DEx selector=0x6002\n");
             if (args->scalarInputCount >= 11 && args->scalarInput &&
                 args->scalarOutputCount >= 1 && args->scalarOutput) {
                 uint32_t resource_id = 0;
@@ -7048,13 +7444,13 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                 }
                 return ret;
             }
-            IOLog("VMVirtIOGPUUserClient: Invalid parameters for createResource3DEx "
+            VMLOG_WARN("VMVirtIOGPUUserClient: Invalid parameters for createResource3DEx "
                   "(need 11 scalars in: ctx_id,target,format,bind,w,h,d,arr,last,nr,flags; 1 scalar out)\n");
             return kIOReturnBadArgument;
         }
 
         case 0x6003: { // attachBackingUser
-            IOLog("VMVirtIOGPUUserClient: attachBackingUser selector=0x6003\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: attachBackingUser selector=0x6003\n");
             if (args->scalarInputCount >= 5 && args->scalarInput) {
                 uint32_t resource_id = (uint32_t)args->scalarInput[0];
                 uint64_t addr = ((uint64_t)(uint32_t)args->scalarInput[2] << 32)
@@ -7067,7 +7463,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
         }
 
         case 0x6004: { // detachBackingUser
-            IOLog("VMVirtIOGPUUserClient: detachBackingUser selector=0x6004\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: detachBackingUser selector=0x6004\n");
             if (args->scalarInputCount >= 1 && args->scalarInput) {
                 return detachBackingUser((uint32_t)args->scalarInput[0]);
             }
@@ -7075,7 +7471,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
         }
 
         case 0x6005: { // resourceUnref
-            IOLog("VMVirtIOGPUUserClient: resourceUnref selector=0x6005\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: resourceUnref selector=0x6005\n");
             if (args->scalarInputCount >= 1 && args->scalarInput) {
                 return resourceUnref((uint32_t)args->scalarInput[0]);
             }
@@ -7083,7 +7479,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
         }
 
         case 0x6006: { // getCapsetInfo
-            IOLog("VMVirtIOGPUUserClient: getCapsetInfo selector=0x6006\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: getCapsetInfo selector=0x6006\n");
             if (args->scalarInputCount >= 1 &&
                 args->scalarOutputCount >= 3 && args->scalarOutput) {
                 uint32_t id = 0, version = 0, size = 0;
@@ -7100,7 +7496,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
         }
 
         case 0x6007: { // getCapset
-            IOLog("VMVirtIOGPUUserClient: getCapset selector=0x6007\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: getCapset selector=0x6007\n");
             if (args->scalarInputCount >= 2 && args->scalarInput &&
                 args->structureOutput && args->structureOutputSize > 0) {
                 uint32_t blob_size = 0;
@@ -7143,7 +7539,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                 if (args->structureInput && args->structureInputSize > 0) {
                     if (s_inline_seen < 20) {
                         s_inline_seen++;
-                        IOLog("VMVirtIOGPUUserClient: 0x6008 INLINE "
+                        VMLOG_DEBUG("VMVirtIOGPUUserClient: 0x6008 INLINE "
                               "ctx=%u size=%llu count=%u\n",
                               (uint32_t)args->scalarInput[0],
                               (unsigned long long)args->structureInputSize,
@@ -7164,7 +7560,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                         (uint32_t)args->structureInputDescriptor->getLength();
                     if (dsize == 0) {
                         s_mismatch_seen++;
-                        IOLog("VMVirtIOGPUUserClient: 0x6008 DESCRIPTOR "
+                        VMLOG_WARN("VMVirtIOGPUUserClient: 0x6008 DESCRIPTOR "
                               "MISMATCH dsize=0 (descriptor reports zero "
                               "length) ctx=%u declared=%llu mismatch=%u\n",
                               (uint32_t)args->scalarInput[0],
@@ -7173,7 +7569,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                     } else if (args->structureInputSize != 0 &&
                                args->structureInputSize != dsize) {
                         s_mismatch_seen++;
-                        IOLog("VMVirtIOGPUUserClient: 0x6008 DESCRIPTOR "
+                        VMLOG_WARN("VMVirtIOGPUUserClient: 0x6008 DESCRIPTOR "
                               "MISMATCH dsize=%u declared=%llu disagree "
                               "ctx=%u mismatch=%u\n",
                               dsize,
@@ -7182,7 +7578,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                               s_mismatch_seen);
                     } else if (s_desc_seen < 20) {
                         s_desc_seen++;
-                        IOLog("VMVirtIOGPUUserClient: 0x6008 DESCRIPTOR "
+                        VMLOG_DEBUG("VMVirtIOGPUUserClient: 0x6008 DESCRIPTOR "
                               "ctx=%u size=%u declared=%llu count=%u\n",
                               (uint32_t)args->scalarInput[0],
                               dsize,
@@ -7214,7 +7610,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
                 static uint32_t s_badarg_seen = 0;
                 if (s_badarg_seen < 20) {
                     s_badarg_seen++;
-                    IOLog("VMVirtIOGPUUserClient: 0x6008 BADARGUMENT early "
+                    VMLOG_DEBUG("VMVirtIOGPUUserClient: 0x6008 BADARGUMENT early "
                           "return scalar=%u structNull=%u descNull=%u "
                           "count=%u\n",
                           (uint32_t)args->scalarInputCount,
@@ -7229,7 +7625,7 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
         }
 
         case 0x6009: { // ctxAttachResource — bind resource to context (NOT a stub)
-            IOLog("VMVirtIOGPUUserClient: ctxAttachResource selector=0x6009\n");
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: ctxAttachResource selector=0x6009\n");
             // The legacy 0x3003 attachVirglResource is a stub ("just log
             // success" at line 7286) — it never sends CTX_ATTACH_RESOURCE.
             // virglrenderer requires the binding before SET_FRAMEBUFFER_STATE
@@ -7241,8 +7637,167 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
             return kIOReturnBadArgument;
         }
 
+        case 0x600A: { // getShaderCacheInfo
+            // out: scalar[0] generation, scalar[1] export size; struct: identity
+            if (args->scalarOutputCount >= 2 && args->scalarOutput &&
+                args->structureOutput &&
+                args->structureOutputSize >= VM_SHADER_CACHE_DIGEST_SIZE) {
+                uint64_t generation = 0;
+                uint32_t size = 0;
+                IOReturn ret = getShaderCacheInfo((uint8_t*)args->structureOutput,
+                                                  &generation, &size);
+                if (ret == kIOReturnSuccess) {
+                    args->scalarOutput[0] = generation;
+                    args->scalarOutput[1] = size;
+                    args->structureOutputSize = VM_SHADER_CACHE_DIGEST_SIZE;
+                }
+                return ret;
+            }
+            return kIOReturnBadArgument;
+        }
+
+        case 0x600B: { // exportShaderCache
+            // out: scalar[0] image size (the size needed on kIOReturnNoSpace).
+            // Images are nearly always >= 4096 bytes, so they normally come
+            // back through structureOutputDescriptor; export into kernel
+            // memory and copy out once.
+            if (args->scalarOutputCount < 1 || !args->scalarOutput)
+                return kIOReturnBadArgument;
+            uint32_t capacity = args->structureOutputDescriptor
+                ? (uint32_t)args->structureOutputDescriptor->getLength()
+                : (uint32_t)args->structureOutputSize;
+            if (capacity > VM_SHADER_CACHE_FILE_MAX)
+                capacity = VM_SHADER_CACHE_FILE_MAX;
+
+            uint32_t size = 0;
+            IOReturn ret = exportShaderCache(NULL, 0, &size);
+            args->scalarOutput[0] = size;
+            if (ret != kIOReturnNoSpace) return ret;
+            if (size > capacity) return kIOReturnNoSpace;
+
+            // The cache can grow between the two calls; NoSpace then tells
+            // the caller to retry with the new size
+            uint32_t image_size = size;
+            void* image = IOMalloc(image_size);
+            if (!image) return kIOReturnNoMemory;
+            ret = exportShaderCache(image, image_size, &size);
+            args->scalarOutput[0] = size;
+            if (ret == kIOReturnSuccess) {
+                if (args->structureOutputDescriptor) {
+                    ret = args->structureOutputDescriptor->prepare();
+                    if (ret == kIOReturnSuccess) {
+                        if (args->structureOutputDescriptor->writeBytes(0, image, size) != size)
+                            ret = kIOReturnVMError;
+                        args->structureOutputDescriptor->complete();
+                    }
+                    args->structureOutputDescriptorSize = size;
+                } else if (args->structureOutput) {
+                    memcpy(args->structureOutput, image, size);
+                    args->structureOutputSize = size;
+                } else {
+                    ret = kIOReturnBadArgument;
+                }
+            }
+            IOFree(image, image_size);
+            return ret;
+        }
+
+        case 0x600C: { // importShaderCache
+            // out: scalar[0] shaders imported, scalar[1] programs imported.
+            // The image is copied into kernel memory before it is validated,
+            // so userspace cannot change it between check and use.
+            uint32_t size = args->structureInputDescriptor
+                ? (uint32_t)args->structureInputDescriptor->getLength()
+                : (uint32_t)args->structureInputSize;
+            if (args->scalarOutputCount < 2 || !args->scalarOutput ||
+                size == 0 || size > VM_SHADER_CACHE_FILE_MAX)
+                return kIOReturnBadArgument;
+
+            void* image = IOMalloc(size);
+            if (!image) return kIOReturnNoMemory;
+            IOReturn ret = kIOReturnSuccess;
+            if (args->structureInputDescriptor) {
+                ret = args->structureInputDescriptor->prepare();
+                if (ret == kIOReturnSuccess) {
+                    if (args->structureInputDescriptor->readBytes(0, image, size) != size)
+                        ret = kIOReturnVMError;
+                    args->structureInputDescriptor->complete();
+                }
+            } else if (args->structureInput) {
+                memcpy(image, args->structureInput, size);
+            } else {
+                ret = kIOReturnBadArgument;
+            }
+
+            uint32_t shaders = 0, programs = 0;
+            if (ret == kIOReturnSuccess)
+                ret = importShaderCache(image, size, &shaders, &programs);
+            IOFree(image, size);
+            args->scalarOutput[0] = shaders;
+            args->scalarOutput[1] = programs;
+            return ret;
+        }
+
+        case 0x600D: { // getCompletionStatus
+            // in: scalar[0] shader or program id, scalar[1] 1 for a program.
+            // out: scalar[0] 1 once complete, scalar[1] compile/link IOReturn.
+            if (args->scalarInputCount < 2 || !args->scalarInput ||
+                args->scalarOutputCount < 2 || !args->scalarOutput)
+                return kIOReturnBadArgument;
+            uint32_t complete = 0, status = 0;
+            IOReturn ret = getCompletionStatus((uint32_t)args->scalarInput[0],
+                                               (uint32_t)args->scalarInput[1],
+                                               &complete, &status);
+            args->scalarOutput[0] = complete;
+            args->scalarOutput[1] = status;
+            return ret;
+        }
+
+        case 0x600E: { // readLog
+            // in: scalar[0] first sequence wanted (0 for the oldest kept).
+            // out: scalar[0] sequence to pass next time, scalar[1] records
+            // overwritten before they could be read; struct: log lines.
+            if (args->scalarInputCount < 1 || !args->scalarInput ||
+                args->scalarOutputCount < 2 || !args->scalarOutput)
+                return kIOReturnBadArgument;
+            uint32_t capacity = args->structureOutputDescriptor
+                ? (uint32_t)args->structureOutputDescriptor->getLength()
+                : (uint32_t)args->structureOutputSize;
+            if (capacity > VM_LOG_READ_MAX)
+                capacity = VM_LOG_READ_MAX;
+            if (capacity == 0)
+                return kIOReturnBadArgument;
+
+            char* text = (char*)IOMalloc(capacity);
+            if (!text) return kIOReturnNoMemory;
+            uint64_t cursor = args->scalarInput[0];
+            uint64_t lost = 0;
+            uint32_t size = 0;
+            IOReturn ret = readLog(&cursor, text, capacity, &size, &lost);
+            if (ret == kIOReturnSuccess) {
+                if (args->structureOutputDescriptor) {
+                    ret = args->structureOutputDescriptor->prepare();
+                    if (ret == kIOReturnSuccess) {
+                        if (args->structureOutputDescriptor->writeBytes(0, text, size) != size)
+                            ret = kIOReturnVMError;
+                        args->structureOutputDescriptor->complete();
+                    }
+                    args->structureOutputDescriptorSize = size;
+                } else if (args->structureOutput) {
+                    memcpy(args->structureOutput, text, size);
+                    args->structureOutputSize = size;
+                } else {
+                    ret = kIOReturnBadArgument;
+                }
+                args->scalarOutput[0] = cursor;
+                args->scalarOutput[1] = lost;
+            }
+            IOFree(text, capacity);
+            return ret;
+        }
+
         default:
-            IOLog("VMVirtIOGPUUserClient: Unsupported method selector %u - returning unsupported\n", selector);
+            VMLOG_WARN("VMVirtIOGPUUserClient: Unsupported method selector %u - returning unsupported\n", selector);
             // CRITICAL: Return kIOReturnUnsupported for unknown selectors
             // This tells WindowServer "we don't support this feature" instead of "invalid request"
             // Prevents WindowServer from thinking our driver is broken
@@ -7255,23 +7810,23 @@ IOReturn VMVirtIOGPUUserClient::externalMethod(uint32_t selector, IOExternalMeth
 // Surface management - basic 2D acceleration
 IOReturn VMVirtIOGPUUserClient::createSurface(uint32_t width, uint32_t height, uint32_t format, uint32_t* surface_id)
 {
-    IOLog("VMVirtIOGPUUserClient::createSurface() %ux%u format=0x%x\n", width, height, format);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::createSurface() %ux%u format=0x%x\n", width, height, format);
     
     // SAFETY: Validate all parameters to prevent KP
     if (!m_gpu_device || !surface_id) {
-        IOLog("VMVirtIOGPUUserClient: createSurface() - Invalid parameters\n");
+        VMLOG_WARN("VMVirtIOGPUUserClient: createSurface() - Invalid parameters\n");
         return kIOReturnBadArgument;
     }
     
     // SAFETY: Validate surface dimensions to prevent resource exhaustion
     if (width == 0 || height == 0 || width > 8192 || height > 8192) {
-        IOLog("VMVirtIOGPUUserClient: createSurface() - Invalid dimensions %ux%u\n", width, height);
+        VMLOG_WARN("VMVirtIOGPUUserClient: createSurface() - Invalid dimensions %ux%u\n", width, height);
         return kIOReturnBadArgument;
     }
     
     // SAFETY: Check if we have too many surfaces to prevent memory exhaustion
     if (m_surfaces && m_surfaces->getCount() > 1000) {
-        IOLog("VMVirtIOGPUUserClient: createSurface() - Too many surfaces, rejecting\n");
+        VMLOG_WARN("VMVirtIOGPUUserClient: createSurface() - Too many surfaces, rejecting\n");
         return kIOReturnNoMemory;
     }
     
@@ -7290,63 +7845,63 @@ IOReturn VMVirtIOGPUUserClient::createSurface(uint32_t width, uint32_t height, u
     // Generate unique resource ID for VirtIO GPU
     uint32_t resource_id = (*surface_id) | 0x10000; // Offset to avoid conflicts with display resources
     
-    IOLog("VMVirtIOGPUUserClient: Creating VirtIO GPU resource %u for surface %u (%ux%u, format=0x%x)\n", 
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Creating VirtIO GPU resource %u for surface %u (%ux%u, format=0x%x)\n", 
           resource_id, *surface_id, width, height, virtio_format);
     
     // Call the GPU device's createResource2D method to create actual GPU resource
     IOReturn ret = m_gpu_device->createResource2D(resource_id, virtio_format, width, height);
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient: Failed to create VirtIO GPU resource: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPUUserClient: Failed to create VirtIO GPU resource: 0x%x\n", ret);
         return ret;
     }
     
     // TODO: Store mapping between surface_id and resource_id for later lookups
     // For now, we can reconstruct it with the formula: resource_id = surface_id | 0x10000
     
-    IOLog("VMVirtIOGPUUserClient: Successfully created surface ID %u with VirtIO resource %u (%ux%u)\n", 
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Successfully created surface ID %u with VirtIO resource %u (%ux%u)\n", 
           *surface_id, resource_id, width, height);
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOGPUUserClient::destroySurface(uint32_t surface_id)
 {
-    IOLog("VMVirtIOGPUUserClient::destroySurface() ID=%u\n", surface_id);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::destroySurface() ID=%u\n", surface_id);
     
     // SAFETY: Validate parameters and state
     if (!m_gpu_device) {
-        IOLog("VMVirtIOGPUUserClient: destroySurface() - No GPU device\n");
+        VMLOG_DEBUG("VMVirtIOGPUUserClient: destroySurface() - No GPU device\n");
         return kIOReturnBadArgument;
     }
     
     // SAFETY: Validate surface ID range
     if (surface_id == 0 || surface_id >= m_next_surface_id) {
-        IOLog("VMVirtIOGPUUserClient: destroySurface() - Invalid surface ID %u\n", surface_id);
+        VMLOG_WARN("VMVirtIOGPUUserClient: destroySurface() - Invalid surface ID %u\n", surface_id);
         return kIOReturnBadArgument;
     }
     
     // Calculate corresponding resource ID
     uint32_t resource_id = surface_id | 0x10000;
     
-    IOLog("VMVirtIOGPUUserClient: Destroying VirtIO GPU resource %u for surface %u\n", 
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Destroying VirtIO GPU resource %u for surface %u\n", 
           resource_id, surface_id);
     
     // Destroy the actual VirtIO GPU resource
     IOReturn ret = m_gpu_device->deallocateResource(resource_id);
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient: Failed to destroy VirtIO GPU resource %u: 0x%x\n", 
+        VMLOG_ERROR("VMVirtIOGPUUserClient: Failed to destroy VirtIO GPU resource %u: 0x%x\n", 
               resource_id, ret);
         return ret;
     }
     
-    IOLog("VMVirtIOGPUUserClient: Successfully destroyed surface ID %u\n", surface_id);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Successfully destroyed surface ID %u\n", surface_id);
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOGPUUserClient::clearSurface(uint32_t surface_id, uint32_t color)
 {
-    IOLog("VMVirtIOGPUUserClient::clearSurface() ID=%u color=0x%08x\n", surface_id, color);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::clearSurface() ID=%u color=0x%08x\n", surface_id, color);
     
     if (!m_gpu_device) {
         return kIOReturnBadArgument;
@@ -7356,13 +7911,13 @@ IOReturn VMVirtIOGPUUserClient::clearSurface(uint32_t surface_id, uint32_t color
     // 1. Send VirtIO GPU RESOURCE_FLUSH command with clear operation
     // 2. Or use 3D commands if available
     
-    IOLog("VMVirtIOGPUUserClient: Cleared surface ID %u with color 0x%08x\n", surface_id, color);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Cleared surface ID %u with color 0x%08x\n", surface_id, color);
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOGPUUserClient::presentSurface(uint32_t surface_id)
 {
-    IOLog("VMVirtIOGPUUserClient::presentSurface() ID=%u\n", surface_id);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::presentSurface() ID=%u\n", surface_id);
     
     if (!m_gpu_device) {
         return kIOReturnBadArgument;
@@ -7372,14 +7927,14 @@ IOReturn VMVirtIOGPUUserClient::presentSurface(uint32_t surface_id)
     // 1. Send VirtIO GPU SET_SCANOUT to make surface visible
     // 2. Send RESOURCE_FLUSH to update display
     
-    IOLog("VMVirtIOGPUUserClient: Presented surface ID %u\n", surface_id);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Presented surface ID %u\n", surface_id);
     return kIOReturnSuccess;
 }
 
 // 3D context management
 IOReturn VMVirtIOGPUUserClient::create3DContext(uint32_t* context_id)
 {
-    IOLog("VMVirtIOGPUUserClient::create3DContext()\n");
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::create3DContext()\n");
     
     if (!m_gpu_device || !context_id) {
         return kIOReturnBadArgument;
@@ -7387,24 +7942,24 @@ IOReturn VMVirtIOGPUUserClient::create3DContext(uint32_t* context_id)
     
     // Check if 3D is supported
     if (!m_gpu_device->supports3D()) {
-        IOLog("VMVirtIOGPUUserClient: 3D acceleration not supported\n");
+        VMLOG_WARN("VMVirtIOGPUUserClient: 3D acceleration not supported\n");
         return kIOReturnUnsupported;
     }
     
     // Call the real VirtIO GPU context creation
     IOReturn ret = m_gpu_device->create3DContext(context_id);
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient: Failed to create 3D context, error=0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPUUserClient: Failed to create 3D context, error=0x%x\n", ret);
         return ret;
     }
     
-    IOLog("VMVirtIOGPUUserClient: Created 3D context ID %u\n", *context_id);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Created 3D context ID %u\n", *context_id);
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOGPUUserClient::destroy3DContext(uint32_t context_id)
 {
-    IOLog("VMVirtIOGPUUserClient::destroy3DContext() ID=%u\n", context_id);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::destroy3DContext() ID=%u\n", context_id);
     
     if (!m_gpu_device) {
         return kIOReturnBadArgument;
@@ -7414,29 +7969,29 @@ IOReturn VMVirtIOGPUUserClient::destroy3DContext(uint32_t context_id)
     // 1. Send VirtIO GPU CTX_DESTROY command
     // 2. Clean up 3D resources
     
-    IOLog("VMVirtIOGPUUserClient: Destroyed 3D context ID %u\n", context_id);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Destroyed 3D context ID %u\n", context_id);
     return kIOReturnSuccess;
 }
 
 // VirtGLGL userspace library interface methods
 IOReturn VMVirtIOGPUUserClient::submitVirglCommands(const void* commands, uint32_t size)
 {
-    IOLog("VMVirtIOGPUUserClient::submitVirglCommands() size=%u bytes\n", size);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::submitVirglCommands() size=%u bytes\n", size);
     
     if (!m_gpu_device || !commands || size == 0) {
-        IOLog("VMVirtIOGPUUserClient: submitVirglCommands - Invalid parameters\n");
+        VMLOG_WARN("VMVirtIOGPUUserClient: submitVirglCommands - Invalid parameters\n");
         return kIOReturnBadArgument;
     }
     
     // Check if 3D is supported
     if (!m_gpu_device->supports3D()) {
-        IOLog("VMVirtIOGPUUserClient: submitVirglCommands - 3D not supported\n");
+        VMLOG_WARN("VMVirtIOGPUUserClient: submitVirglCommands - 3D not supported\n");
         return kIOReturnUnsupported;
     }
     
     // Safety: Limit command buffer size to prevent resource exhaustion
     if (size > 1024 * 1024) { // 1MB max
-        IOLog("VMVirtIOGPUUserClient: submitVirglCommands - Buffer too large (%u bytes)\n", size);
+        VMLOG_DEBUG("VMVirtIOGPUUserClient: submitVirglCommands - Buffer too large (%u bytes)\n", size);
         return kIOReturnBadArgument;
     }
     
@@ -7444,7 +7999,7 @@ IOReturn VMVirtIOGPUUserClient::submitVirglCommands(const void* commands, uint32
     IOMemoryDescriptor* cmd_desc = IOMemoryDescriptor::withAddress(
         (void*)commands, size, kIODirectionOut);
     if (!cmd_desc) {
-        IOLog("VMVirtIOGPUUserClient: submitVirglCommands - Failed to create memory descriptor\n");
+        VMLOG_ERROR("VMVirtIOGPUUserClient: submitVirglCommands - Failed to create memory descriptor\n");
         return kIOReturnNoMemory;
     }
     
@@ -7454,18 +8009,18 @@ IOReturn VMVirtIOGPUUserClient::submitVirglCommands(const void* commands, uint32
     cmd_desc->release();
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient: submitVirglCommands - executeCommands failed: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPUUserClient: submitVirglCommands - executeCommands failed: 0x%x\n", ret);
         return ret;
     }
     
-    IOLog("VMVirtIOGPUUserClient: Submitted %u bytes of virgl commands successfully\n", size);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Submitted %u bytes of virgl commands successfully\n", size);
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOGPUUserClient::createVirglResource(uint32_t resourceId, uint32_t width, 
                                                     uint32_t height, uint32_t format)
 {
-    IOLog("VMVirtIOGPUUserClient::createVirglResource() id=%u %ux%u format=0x%x\n", 
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::createVirglResource() id=%u %ux%u format=0x%x\n", 
           resourceId, width, height, format);
     
     if (!m_gpu_device) {
@@ -7474,14 +8029,14 @@ IOReturn VMVirtIOGPUUserClient::createVirglResource(uint32_t resourceId, uint32_
     
     // Safety checks
     if (width == 0 || height == 0 || width > 8192 || height > 8192) {
-        IOLog("VMVirtIOGPUUserClient: createVirglResource - Invalid dimensions\n");
+        VMLOG_WARN("VMVirtIOGPUUserClient: createVirglResource - Invalid dimensions\n");
         return kIOReturnBadArgument;
     }
     
     // Create proper 3D resource for virgl rendering
     // Virgl 3D commands REQUIRE 3D resources - 2D resources cannot be rendered to with virgl!
     // CRITICAL: Include VIRGL_BIND_SCANOUT flag so QEMU knows this resource can be used for display!
-    IOLog("VMVirtIOGPUUserClient: Creating 3D virgl resource %u (%ux%u, format 0x%x)\n", 
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Creating 3D virgl resource %u (%ux%u, format 0x%x)\n", 
           resourceId, width, height, format);
     
     IOReturn ret = m_gpu_device->createResource3D(
@@ -7493,17 +8048,17 @@ IOReturn VMVirtIOGPUUserClient::createVirglResource(uint32_t resourceId, uint32_
     );
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient: createVirglResource - createResource3D failed: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPUUserClient: createVirglResource - createResource3D failed: 0x%x\n", ret);
         return ret;
     }
     
-    IOLog("VMVirtIOGPUUserClient: Created 3D virgl resource %u successfully\n", resourceId);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Created 3D virgl resource %u successfully\n", resourceId);
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOGPUUserClient::createVirglContext(uint32_t contextId)
 {
-    IOLog("VMVirtIOGPUUserClient::createVirglContext() id=%u\n", contextId);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::createVirglContext() id=%u\n", contextId);
     
     if (!m_gpu_device) {
         return kIOReturnBadArgument;
@@ -7511,7 +8066,7 @@ IOReturn VMVirtIOGPUUserClient::createVirglContext(uint32_t contextId)
     
     // Check if 3D is supported
     if (!m_gpu_device->supports3D()) {
-        IOLog("VMVirtIOGPUUserClient: createVirglContext - 3D not supported\n");
+        VMLOG_WARN("VMVirtIOGPUUserClient: createVirglContext - 3D not supported\n");
         return kIOReturnUnsupported;
     }
     
@@ -7520,18 +8075,18 @@ IOReturn VMVirtIOGPUUserClient::createVirglContext(uint32_t contextId)
     IOReturn ret = m_gpu_device->createRenderContext(&new_context_id);
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient: createVirglContext - createRenderContext failed: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPUUserClient: createVirglContext - createRenderContext failed: 0x%x\n", ret);
         return ret;
     }
     
-    IOLog("VMVirtIOGPUUserClient: Created virgl context %u (assigned id %u) successfully\n", 
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Created virgl context %u (assigned id %u) successfully\n", 
           contextId, new_context_id);
     return kIOReturnSuccess;
 }
 
 IOReturn VMVirtIOGPUUserClient::attachVirglResource(uint32_t contextId, uint32_t resourceId)
 {
-    IOLog("VMVirtIOGPUUserClient::attachVirglResource() context=%u resource=%u\n", 
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::attachVirglResource() context=%u resource=%u\n", 
           contextId, resourceId);
     
     if (!m_gpu_device) {
@@ -7539,13 +8094,13 @@ IOReturn VMVirtIOGPUUserClient::attachVirglResource(uint32_t contextId, uint32_t
     }
     
     // For now, just log success - full implementation would attach resource to context
-    IOLog("VMVirtIOGPUUserClient: Attached resource %u to context %u\n", resourceId, contextId);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient: Attached resource %u to context %u\n", resourceId, contextId);
     return kIOReturnSuccess;
 }
 
 uint32_t VMVirtIOGPUUserClient::getVirglCapability(uint32_t cap)
 {
-    IOLog("VMVirtIOGPUUserClient::getVirglCapability() cap=%u\n", cap);
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::getVirglCapability() cap=%u\n", cap);
     
     if (!m_gpu_device) {
         return 0;
@@ -7616,29 +8171,29 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
     const uint64_t PROBE_BUF_SIZE = (uint64_t)PROBE_W * PROBE_H * 4;  // 16384 bytes
 
     if (!m_gpu_device) {
-        IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL — no GPU device\n");
+        VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL — no GPU device\n");
         return kIOReturnNotReady;
     }
 
     if (phase == 1) {
         // ===== Phase 1: setup + attach + transfer_to =====
         if (m_probe_in_progress) {
-            IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL phase 1 — probe already in "
+            VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL phase 1 — probe already in "
                   "progress (ctx=0x%x res=0x%x desc=%p). Call phase 2 first.\n",
                   m_probe_ctx_id, m_probe_resource_id, m_probe_descriptor);
             return kIOReturnBusy;
         }
         if (len != PROBE_BUF_SIZE) {
-            IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL phase 1 — len=%llu expected=%llu\n",
+            VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL phase 1 — len=%llu expected=%llu\n",
                   len, PROBE_BUF_SIZE);
             return kIOReturnBadArgument;
         }
         if (addr == 0) {
-            IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL phase 1 — addr=0\n");
+            VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL phase 1 — addr=0\n");
             return kIOReturnBadArgument;
         }
 
-        IOLog("VMVirtIOGPUUserClient::probeAttachBacking: PHASE 1 START task=%p "
+        VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: PHASE 1 START task=%p "
               "addr=0x%llx len=%llu\n", m_owning_task, addr, len);
 
         IOReturn ret = kIOReturnSuccess;
@@ -7655,11 +8210,11 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
             struct virtio_gpu_ctrl_hdr resp = {};
             ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
             if (ret != kIOReturnSuccess) {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL A — CTX_CREATE ret=0x%x\n", ret);
+                VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL A — CTX_CREATE ret=0x%x\n", ret);
                 return ret;
             }
             ctx_created = true;
-            IOLog("VMVirtIOGPUUserClient::probeAttachBacking: phase A ok — CTX_CREATE ctx=0x%x\n",
+            VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: phase A ok — CTX_CREATE ctx=0x%x\n",
                   PROBE_CTX);
         }
 
@@ -7687,12 +8242,12 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
             struct virtio_gpu_ctrl_hdr resp = {};
             ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
             if (ret != kIOReturnSuccess) {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL B — RESOURCE_CREATE_3D "
+                VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL B — RESOURCE_CREATE_3D "
                       "ret=0x%x resp=0x%x\n", ret, resp.type);
                 goto phase1_cleanup;
             }
             resource_created = true;
-            IOLog("VMVirtIOGPUUserClient::probeAttachBacking: phase B ok — RESOURCE_CREATE_3D "
+            VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: phase B ok — RESOURCE_CREATE_3D "
                   "res=0x%x (resp is a real signal)\n", PROBE_RES);
         }
 
@@ -7707,10 +8262,10 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
             struct virtio_gpu_ctrl_hdr resp = {};
             ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
             if (ret != kIOReturnSuccess) {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: WARN C — CTX_ATTACH_RESOURCE "
+                VMLOG_WARN("VMVirtIOGPUUserClient::probeAttachBacking: WARN C — CTX_ATTACH_RESOURCE "
                       "ret=0x%x resp=0x%x (continuing)\n", ret, resp.type);
             } else {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: phase C ok — CTX_ATTACH_RESOURCE "
+                VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: phase C ok — CTX_ATTACH_RESOURCE "
                       "resp=0x%x\n", resp.type);
             }
         }
@@ -7726,7 +8281,7 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
         desc = IOMemoryDescriptor::withAddressRange(
             addr, len, kIODirectionInOut, m_owning_task);
         if (!desc) {
-            IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL D — withAddressRange "
+            VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL D — withAddressRange "
                   "returned NULL (task=%p addr=0x%llx len=%llu)\n",
                   m_owning_task, addr, len);
             ret = kIOReturnNoMemory;
@@ -7735,7 +8290,7 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
         {
             IOReturn prep_ret = desc->prepare(kIODirectionInOut);
             if (prep_ret != kIOReturnSuccess) {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL D — prepare() ret=0x%x "
+                VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL D — prepare() ret=0x%x "
                       "(this is the load-bearing check — without prepare, getPhysicalSegment "
                       "may return invalid addresses)\n", prep_ret);
                 desc->release();
@@ -7763,12 +8318,12 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
                     if (seg_len == 0) break;  // defensive
                 }
             }
-            IOLog("VMVirtIOGPUUserClient::probeAttachBacking: phase D — walked %u segments, "
+            VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: phase D — walked %u segments, "
                   "%llu bytes (descriptor length %llu)\n",
                   nr_entries, (uint64_t)total_length, (uint64_t)desc->getLength());
 
             if (nr_entries == 0 || total_length != desc->getLength()) {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL D — walk mismatch "
+                VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL D — walk mismatch "
                       "walked=%llu expected=%llu entries=%u\n",
                       (uint64_t)total_length, (uint64_t)desc->getLength(), nr_entries);
                 desc->complete(kIODirectionInOut);
@@ -7778,7 +8333,7 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
             }
 
             if (nr_entries == 1) {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: WARN D — nr_entries=1 on what "
+                VMLOG_WARN("VMVirtIOGPUUserClient::probeAttachBacking: WARN D — nr_entries=1 on what "
                       "should be an unaligned 16 KB buffer. Either the allocator handed a "
                       "contiguous page-aligned region by luck, or the segment walk is wrong. "
                       "Per-segment addr below should disambiguate:\n");
@@ -7814,11 +8369,11 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
                     entries[i].length = (uint32_t)seg_len;
                     entries[i].padding = 0;
                     if (i < 16) {
-                        IOLog("VMVirtIOGPUUserClient::probeAttachBacking:   seg[%u] "
+                        VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking:   seg[%u] "
                               "addr=0x%llx len=%u\n",
                               i, (uint64_t)seg_addr, (uint32_t)seg_len);
                     } else if (i == 16) {
-                        IOLog("VMVirtIOGPUUserClient::probeAttachBacking:   ... "
+                        VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking:   ... "
                               "(further segments suppressed)\n");
                     }
                     off += seg_len;
@@ -7829,13 +8384,13 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
             ret = m_gpu_device->sendDisplayCommand(&attach_cmd->hdr, cmd_size, &resp, sizeof(resp));
             IOFree(cmdbuf, cmd_size);
             if (ret != kIOReturnSuccess) {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL D — ATTACH_BACKING "
+                VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL D — ATTACH_BACKING "
                       "ret=0x%x resp=0x%x\n", ret, resp.type);
                 desc->complete(kIODirectionInOut);
                 desc->release();
                 goto phase1_cleanup;
             }
-            IOLog("VMVirtIOGPUUserClient::probeAttachBacking: phase D ok — ATTACH_BACKING "
+            VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: phase D ok — ATTACH_BACKING "
                   "resp=0x%x (real signal)\n", resp.type);
         }
 
@@ -7857,13 +8412,13 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
             struct virtio_gpu_ctrl_hdr resp = {};
             ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
             if (ret != kIOReturnSuccess) {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL E — TRANSFER_TO_HOST_3D "
+                VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL E — TRANSFER_TO_HOST_3D "
                       "ret=0x%x resp=0x%x\n", ret, resp.type);
                 desc->complete(kIODirectionInOut);
                 desc->release();
                 goto phase1_cleanup;
             }
-            IOLog("VMVirtIOGPUUserClient::probeAttachBacking: phase E ok — TRANSFER_TO_HOST_3D "
+            VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: phase E ok — TRANSFER_TO_HOST_3D "
                   "resp=0x%x\n", resp.type);
         }
 
@@ -7875,7 +8430,7 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
         m_probe_ctx_id = PROBE_CTX;
         m_probe_in_progress = true;
 
-        IOLog("VMVirtIOGPUUserClient::probeAttachBacking: PHASE 1 OK — descriptor %p held "
+        VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: PHASE 1 OK — descriptor %p held "
               "prepared across calls. Userspace: zero buf, then call phase 2.\n",
               desc);
         return kIOReturnSuccess;
@@ -7906,13 +8461,13 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
     else if (phase == 2) {
         // ===== Phase 2: transfer_from + teardown =====
         if (!m_probe_in_progress || !m_probe_descriptor) {
-            IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL phase 2 — no probe in "
+            VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL phase 2 — no probe in "
                   "progress (in_progress=%d desc=%p)\n",
                   m_probe_in_progress ? 1 : 0, m_probe_descriptor);
             return kIOReturnNotReady;
         }
 
-        IOLog("VMVirtIOGPUUserClient::probeAttachBacking: PHASE 2 START "
+        VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: PHASE 2 START "
               "(ctx=0x%x res=0x%x desc=%p)\n",
               m_probe_ctx_id, m_probe_resource_id, m_probe_descriptor);
 
@@ -7937,10 +8492,10 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
             struct virtio_gpu_ctrl_hdr resp = {};
             xfer_ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
             if (xfer_ret != kIOReturnSuccess) {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL phase 2 — "
+                VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL phase 2 — "
                       "TRANSFER_FROM_HOST_3D ret=0x%x resp=0x%x\n", xfer_ret, resp.type);
             } else {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: phase 2 TRANSFER_FROM_HOST_3D "
+                VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: phase 2 TRANSFER_FROM_HOST_3D "
                       "resp=0x%x (real signal — but byte correctness is verified in userspace)\n",
                       resp.type);
             }
@@ -7967,7 +8522,7 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
             IOReturn uret = m_gpu_device->sendDisplayCommand(&ucmd.hdr, sizeof(ucmd),
                                                               &uresp, sizeof(uresp));
             if (uret != kIOReturnSuccess) {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: phase 2 cleanup — "
+                VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: phase 2 cleanup — "
                       "RESOURCE_UNREF ret=0x%x (non-fatal)\n", uret);
             }
 
@@ -7978,7 +8533,7 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
             IOReturn dret = m_gpu_device->sendDisplayCommand(&dcmd.hdr, sizeof(dcmd),
                                                               &dresp, sizeof(dresp));
             if (dret != kIOReturnSuccess) {
-                IOLog("VMVirtIOGPUUserClient::probeAttachBacking: phase 2 cleanup — "
+                VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: phase 2 cleanup — "
                       "CTX_DESTROY ret=0x%x (non-fatal)\n", dret);
             }
 
@@ -7986,12 +8541,12 @@ IOReturn VMVirtIOGPUUserClient::probeAttachBackingUser(uint32_t phase, uint64_t
             m_probe_ctx_id = 0;
         }
 
-        IOLog("VMVirtIOGPUUserClient::probeAttachBacking: PHASE 2 OK — descriptor unwired, "
+        VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBacking: PHASE 2 OK — descriptor unwired, "
               "resources freed. Userspace: read every dword and verify.\n");
         return xfer_ret;
     }
 
-    IOLog("VMVirtIOGPUUserClient::probeAttachBacking: FAIL — bad phase %u (expected 1 or 2)\n",
+    VMLOG_ERROR("VMVirtIOGPUUserClient::probeAttachBacking: FAIL — bad phase %u (expected 1 or 2)\n",
           phase);
     return kIOReturnBadArgument;
 }
@@ -8011,7 +8566,7 @@ void VMVirtIOGPUUserClient::probeAttachBackingUserCleanup()
         return;
     }
 
-    IOLog("VMVirtIOGPUUserClient::probeAttachBackingUserCleanup: releasing descriptor %p "
+    VMLOG_INFO("VMVirtIOGPUUserClient::probeAttachBackingUserCleanup: releasing descriptor %p "
           "(ctx=0x%x res=0x%x) — client died with probe in progress\n",
           m_probe_descriptor, m_probe_ctx_id, m_probe_resource_id);
 
@@ -8109,7 +8664,7 @@ void VMVirtIOGPUUserClient::removeAllUserBackings()
 {
     for (int i = 0; i < MAX_USER_BACKINGS; i++) {
         if (m_user_backings[i].resource_id != 0 && m_user_backings[i].desc) {
-            IOLog("VMVirtIOGPUUserClient: removeAllUserBackings releasing "
+            VMLOG_DEBUG("VMVirtIOGPUUserClient: removeAllUserBackings releasing "
                   "descriptor %p for resource=0x%x (client died)\n",
                   m_user_backings[i].desc, m_user_backings[i].resource_id);
             m_user_backings[i].desc->complete(kIODirectionInOut);
@@ -8146,24 +8701,24 @@ IOReturn VMVirtIOGPUUserClient::createVirglContextEx(uint32_t* out_ctx_id)
     // Same diagnostic caveat as createResource3DEx: QEMU propagates 0x1100
     // back to the guest even if virglrenderer rejected the context creation.
     // Hex dump lets us compare against probeTransport3D's working bytes.
-    IOLog("VMVirtIOGPUUserClient::createVirglContextEx: wire bytes (sizeof=%zu):",
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::createVirglContextEx: wire bytes (sizeof=%zu):",
           sizeof(cmd));
     {
         const uint32_t* dwords = (const uint32_t*)&cmd;
         unsigned n_dump = sizeof(cmd) / 4;
         if (n_dump > 8) n_dump = 8;  // ctx_create is large (debug_name[64])
         for (unsigned i = 0; i < n_dump; i++) {
-            IOLog(" [%u]=0x%08x", i, dwords[i]);
+            VMLOG_DEBUG(" [%u]=0x%08x", i, dwords[i]);
         }
     }
     IOReturn ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd),
                                                      &resp, sizeof(resp));
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient::createVirglContextEx: FAIL CTX_CREATE "
+        VMLOG_ERROR("VMVirtIOGPUUserClient::createVirglContextEx: FAIL CTX_CREATE "
               "ctx=0x%x ret=0x%x resp=0x%x\n", ctx_id, ret, resp.type);
         return ret;
     }
-    IOLog("VMVirtIOGPUUserClient::createVirglContextEx: ok ctx=0x%x "
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::createVirglContextEx: ok ctx=0x%x "
           "resp=0x%x\n", ctx_id, resp.type);
     *out_ctx_id = ctx_id;
     return kIOReturnSuccess;
@@ -8180,7 +8735,7 @@ IOReturn VMVirtIOGPUUserClient::destroyVirglContextEx(uint32_t ctx_id)
     struct virtio_gpu_ctrl_hdr resp = {};
     IOReturn ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd),
                                                      &resp, sizeof(resp));
-    IOLog("VMVirtIOGPUUserClient::destroyVirglContextEx: ctx=0x%x ret=0x%x "
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::destroyVirglContextEx: ctx=0x%x ret=0x%x "
           "resp=0x%x\n", ctx_id, ret, resp.type);
     return ret;
 }
@@ -8226,19 +8781,19 @@ IOReturn VMVirtIOGPUUserClient::createResource3DEx(
     // (returning 0x1205 = ERR_INVALID_PARAMETER) while QEMU still responds
     // 0x1100 to the guest — same unconditional-success trap as SUBMIT_3D.
     // Without this hex dump we can't see what bytes the host actually got.
-    IOLog("VMVirtIOGPUUserClient::createResource3DEx: wire bytes (sizeof=%zu):",
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::createResource3DEx: wire bytes (sizeof=%zu):",
           sizeof(cmd));
     {
         const uint32_t* dwords = (const uint32_t*)&cmd;
         unsigned n_dump = sizeof(cmd) / 4;
         for (unsigned i = 0; i < n_dump; i++) {
-            IOLog(" [%u]=0x%08x", i, dwords[i]);
+            VMLOG_DEBUG(" [%u]=0x%08x", i, dwords[i]);
         }
     }
     IOReturn ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd),
                                                      &resp, sizeof(resp));
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient::createResource3DEx: FAIL res=0x%x "
+        VMLOG_ERROR("VMVirtIOGPUUserClient::createResource3DEx: FAIL res=0x%x "
               "ret=0x%x resp=0x%x\n", resource_id, ret, resp.type);
         return ret;
     }
@@ -8246,7 +8801,7 @@ IOReturn VMVirtIOGPUUserClient::createResource3DEx(
     // virglrenderer may have rejected it (returns EINVAL internally) while
     // QEMU still pushes 0x1100 back to the guest. Only the host debug log
     // tells us if it actually worked.
-    IOLog("VMVirtIOGPUUserClient::createResource3DEx: ok res=0x%x "
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::createResource3DEx: ok res=0x%x "
           "fmt=%u bind=0x%x %ux%ux%u arr=%u resp=0x%x\n",
           resource_id, format, bind, width, height, depth, array_size,
           resp.type);
@@ -8265,17 +8820,17 @@ IOReturn VMVirtIOGPUUserClient::attachBackingUser(uint32_t resource_id,
 {
     if (!m_gpu_device) return kIOReturnNotReady;
     if (resource_id == 0 || addr == 0 || len == 0) {
-        IOLog("VMVirtIOGPUUserClient::attachBackingUser: bad args res=0x%x "
+        VMLOG_DEBUG("VMVirtIOGPUUserClient::attachBackingUser: bad args res=0x%x "
               "addr=0x%llx len=%llu\n", resource_id, addr, len);
         return kIOReturnBadArgument;
     }
     if (findUserBacking(resource_id) != nullptr) {
-        IOLog("VMVirtIOGPUUserClient::attachBackingUser: res=0x%x already has "
+        VMLOG_DEBUG("VMVirtIOGPUUserClient::attachBackingUser: res=0x%x already has "
               "backing attached — detach first\n", resource_id);
         return kIOReturnBusy;
     }
 
-    IOLog("VMVirtIOGPUUserClient::attachBackingUser: res=0x%x task=%p "
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::attachBackingUser: res=0x%x task=%p "
           "addr=0x%llx len=%llu\n", resource_id, m_owning_task, addr, len);
 
     // Constraint 1: use m_owning_task captured at initWithTask, NOT
@@ -8283,14 +8838,14 @@ IOReturn VMVirtIOGPUUserClient::attachBackingUser(uint32_t resource_id,
     IOMemoryDescriptor* desc = IOMemoryDescriptor::withAddressRange(
         addr, len, kIODirectionInOut, m_owning_task);
     if (!desc) {
-        IOLog("VMVirtIOGPUUserClient::attachBackingUser: FAIL withAddressRange "
+        VMLOG_ERROR("VMVirtIOGPUUserClient::attachBackingUser: FAIL withAddressRange "
               "returned NULL\n");
         return kIOReturnNoMemory;
     }
 
     IOReturn prep_ret = desc->prepare(kIODirectionInOut);
     if (prep_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient::attachBackingUser: FAIL prepare ret=0x%x\n",
+        VMLOG_ERROR("VMVirtIOGPUUserClient::attachBackingUser: FAIL prepare ret=0x%x\n",
               prep_ret);
         desc->release();
         return prep_ret;
@@ -8310,19 +8865,19 @@ IOReturn VMVirtIOGPUUserClient::attachBackingUser(uint32_t resource_id,
             if (seg_len == 0) break;
         }
     }
-    IOLog("VMVirtIOGPUUserClient::attachBackingUser: res=0x%x walked %u "
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::attachBackingUser: res=0x%x walked %u "
           "segments, %llu bytes (descriptor length %llu)\n",
           resource_id, nr_entries, (uint64_t)total_length,
           (uint64_t)desc->getLength());
 
     if (nr_entries == 0 || total_length != desc->getLength()) {
-        IOLog("VMVirtIOGPUUserClient::attachBackingUser: FAIL walk mismatch\n");
+        VMLOG_ERROR("VMVirtIOGPUUserClient::attachBackingUser: FAIL walk mismatch\n");
         desc->complete(kIODirectionInOut);
         desc->release();
         return kIOReturnNoMemory;
     }
     if (nr_entries == 1) {
-        IOLog("VMVirtIOGPUUserClient::attachBackingUser: WARN nr_entries=1 — "
+        VMLOG_WARN("VMVirtIOGPUUserClient::attachBackingUser: WARN nr_entries=1 — "
               "allocator handed contiguous memory by luck, or walk is broken. "
               "Per-segment addr below should disambiguate.\n");
     }
@@ -8357,11 +8912,11 @@ IOReturn VMVirtIOGPUUserClient::attachBackingUser(uint32_t resource_id,
             entries[i].length = (uint32_t)seg_len;
             entries[i].padding = 0;
             if (i < 16) {
-                IOLog("VMVirtIOGPUUserClient::attachBackingUser:   seg[%u] "
+                VMLOG_DEBUG("VMVirtIOGPUUserClient::attachBackingUser:   seg[%u] "
                       "addr=0x%llx len=%u\n", i, (uint64_t)seg_addr,
                       (uint32_t)seg_len);
             } else if (i == 16) {
-                IOLog("VMVirtIOGPUUserClient::attachBackingUser:   ... "
+                VMLOG_DEBUG("VMVirtIOGPUUserClient::attachBackingUser:   ... "
                       "(further segments suppressed)\n");
             }
             off += seg_len;
@@ -8373,7 +8928,7 @@ IOReturn VMVirtIOGPUUserClient::attachBackingUser(uint32_t resource_id,
                                                      &resp, sizeof(resp));
     IOFree(cmdbuf, cmd_size);
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient::attachBackingUser: FAIL ATTACH_BACKING "
+        VMLOG_ERROR("VMVirtIOGPUUserClient::attachBackingUser: FAIL ATTACH_BACKING "
               "ret=0x%x resp=0x%x\n", ret, resp.type);
         desc->complete(kIODirectionInOut);
         desc->release();
@@ -8382,14 +8937,14 @@ IOReturn VMVirtIOGPUUserClient::attachBackingUser(uint32_t resource_id,
 
     // Store descriptor for later transfer/submit calls. NOT completed here.
     if (!addUserBacking(resource_id, desc)) {
-        IOLog("VMVirtIOGPUUserClient::attachBackingUser: FAIL backing table "
+        VMLOG_ERROR("VMVirtIOGPUUserClient::attachBackingUser: FAIL backing table "
               "full (%d entries)\n", MAX_USER_BACKINGS);
         desc->complete(kIODirectionInOut);
         desc->release();
         return kIOReturnNoResources;
     }
 
-    IOLog("VMVirtIOGPUUserClient::attachBackingUser: ok res=0x%x descriptor "
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::attachBackingUser: ok res=0x%x descriptor "
           "%p held prepared across calls\n", resource_id, desc);
     return kIOReturnSuccess;
 }
@@ -8413,7 +8968,7 @@ IOReturn VMVirtIOGPUUserClient::detachBackingUser(uint32_t resource_id)
     struct virtio_gpu_ctrl_hdr resp = {};
     IOReturn ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd),
                                                      &resp, sizeof(resp));
-    IOLog("VMVirtIOGPUUserClient::detachBackingUser: res=0x%x DETACH_BACKING "
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::detachBackingUser: res=0x%x DETACH_BACKING "
           "ret=0x%x resp=0x%x\n", resource_id, ret, resp.type);
 
     // Release descriptor regardless of DETACH result (UNREF will drop it
@@ -8431,7 +8986,7 @@ IOReturn VMVirtIOGPUUserClient::resourceUnref(uint32_t resource_id)
     // Defensive: if a backing descriptor is still held (winsys forgot to
     // detach), release it before UNREF destroys the host-side resource.
     if (findUserBacking(resource_id) != nullptr) {
-        IOLog("VMVirtIOGPUUserClient::resourceUnref: res=0x%x still has "
+        VMLOG_DEBUG("VMVirtIOGPUUserClient::resourceUnref: res=0x%x still has "
               "backing held — releasing defensively\n", resource_id);
         removeUserBacking(resource_id);
     }
@@ -8447,7 +9002,7 @@ IOReturn VMVirtIOGPUUserClient::resourceUnref(uint32_t resource_id)
     struct virtio_gpu_ctrl_hdr resp = {};
     IOReturn ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd),
                                                      &resp, sizeof(resp));
-    IOLog("VMVirtIOGPUUserClient::resourceUnref: res=0x%x ret=0x%x "
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::resourceUnref: res=0x%x ret=0x%x "
           "resp=0x%x\n", resource_id, ret, resp.type);
     return ret;
 }
@@ -8478,11 +9033,11 @@ IOReturn VMVirtIOGPUUserClient::getCapsetInfo(uint32_t capset_index,
     IOReturn ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd),
                                                      &resp.hdr, sizeof(resp));
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient::getCapsetInfo: FAIL index=%u ret=0x%x\n",
+        VMLOG_ERROR("VMVirtIOGPUUserClient::getCapsetInfo: FAIL index=%u ret=0x%x\n",
               capset_index, ret);
         return ret;
     }
-    IOLog("VMVirtIOGPUUserClient::getCapsetInfo: index=%u -> id=%u "
+    VMLOG_INFO("VMVirtIOGPUUserClient::getCapsetInfo: index=%u -> id=%u "
           "version=%u size=%u\n", capset_index, resp.capset_id,
           resp.capset_max_version, resp.capset_max_size);
     *out_id = resp.capset_id;
@@ -8518,7 +9073,7 @@ IOReturn VMVirtIOGPUUserClient::getCapset(uint32_t capset_id, uint32_t version,
                                                      (virtio_gpu_ctrl_hdr*)response_buf,
                                                      sizeof(response_buf));
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient::getCapset: FAIL id=%u ver=%u ret=0x%x\n",
+        VMLOG_ERROR("VMVirtIOGPUUserClient::getCapset: FAIL id=%u ver=%u ret=0x%x\n",
               capset_id, version, ret);
         return ret;
     }
@@ -8532,7 +9087,7 @@ IOReturn VMVirtIOGPUUserClient::getCapset(uint32_t capset_id, uint32_t version,
     memcpy(out_blob, response_buf + sizeof(virtio_gpu_ctrl_hdr), blob_size);
     *out_blob_size = blob_size;
 
-    IOLog("VMVirtIOGPUUserClient::getCapset: id=%u ver=%u -> %u bytes "
+    VMLOG_INFO("VMVirtIOGPUUserClient::getCapset: id=%u ver=%u -> %u bytes "
           "(first 16: %02x %02x %02x %02x %02x %02x %02x %02x "
           "%02x %02x %02x %02x %02x %02x %02x %02x)\n",
           capset_id, version, blob_size,
@@ -8581,7 +9136,7 @@ IOReturn VMVirtIOGPUUserClient::submitVirglCommandsEx(uint32_t ctx_id,
     IOBufferMemoryDescriptor* cmd_desc = IOBufferMemoryDescriptor::withBytes(
         commands, size, kIODirectionOut);
     if (!cmd_desc) {
-        IOLog("VMVirtIOGPUUserClient::submitVirglCommandsEx: withBytes FAIL\n");
+        VMLOG_ERROR("VMVirtIOGPUUserClient::submitVirglCommandsEx: withBytes FAIL\n");
         return kIOReturnNoMemory;
     }
 
@@ -8597,10 +9152,10 @@ IOReturn VMVirtIOGPUUserClient::submitVirglCommandsEx(uint32_t ctx_id,
             s_hex_dump_count++;
             const uint32_t* dwords = (const uint32_t*)commands;
             unsigned n_dump = size / 4; if (n_dump > 20) n_dump = 20;
-            IOLog("VMVirtIOGPUUserClient::submitVirglCommandsEx: ctx=0x%x size=%u "
+            VMLOG_DEBUG("VMVirtIOGPUUserClient::submitVirglCommandsEx: ctx=0x%x size=%u "
                   "first %u dwords:", ctx_id, size, n_dump);
             for (unsigned i = 0; i < n_dump; i++) {
-                IOLog(" [%u]=0x%08x", i, dwords[i]);
+                VMLOG_DEBUG(" [%u]=0x%08x", i, dwords[i]);
             }
         }
     }
@@ -8609,13 +9164,13 @@ IOReturn VMVirtIOGPUUserClient::submitVirglCommandsEx(uint32_t ctx_id,
     cmd_desc->release();
 
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUUserClient::submitVirglCommandsEx: ctx=0x%x size=%u "
+        VMLOG_ERROR("VMVirtIOGPUUserClient::submitVirglCommandsEx: ctx=0x%x size=%u "
               "executeCommands FAIL ret=0x%x\n", ctx_id, size, ret);
     } else {
         static uint32_t s_submit_ok_count = 0;
         if (s_submit_ok_count < 20) {
             s_submit_ok_count++;
-            IOLog("VMVirtIOGPUUserClient::submitVirglCommandsEx: ctx=0x%x size=%u ok\n",
+            VMLOG_DEBUG("VMVirtIOGPUUserClient::submitVirglCommandsEx: ctx=0x%x size=%u ok\n",
                   ctx_id, size);
         }
     }
@@ -8646,11 +9201,130 @@ IOReturn VMVirtIOGPUUserClient::ctxAttachResource(uint32_t ctx_id,
     struct virtio_gpu_ctrl_hdr resp = {};
     IOReturn ret = m_gpu_device->sendDisplayCommand(&cmd.hdr, sizeof(cmd),
                                                      &resp, sizeof(resp));
-    IOLog("VMVirtIOGPUUserClient::ctxAttachResource: ctx=0x%x res=0x%x "
+    VMLOG_DEBUG("VMVirtIOGPUUserClient::ctxAttachResource: ctx=0x%x res=0x%x "
           "ret=0x%x resp=0x%x\n", ctx_id, resource_id, ret, resp.type);
     return ret;
 }
 
+// ---- 0x600A-0x600C persistent shader cache -----------------------------------
+//
+// tools/shadercache keeps the shader manager's compile and link caches on
+// disk across reboots: it imports the saved image at boot and exports a new
+// one whenever the cache generation moves. Images are only reused on the
+// same kext version and host renderer (see shaderCacheEnvironment).
+IOReturn VMVirtIOGPUUserClient::shaderCacheEnvironment(const uint8_t** out_env)
+{
+    if (m_shader_cache_env_valid) {
+        *out_env = m_shader_cache_env;
+        return kIOReturnSuccess;
+    }
+    if (!m_gpu_device) return kIOReturnNotReady;
+
+    const uint32_t BLOB_CAP = 2048;     // getCapset's own response limit
+    uint8_t* blob = (uint8_t*)IOMalloc(BLOB_CAP);
+    if (!blob) return kIOReturnNoMemory;
+
+    SHA256_CTX ctx;
+    SHA256_Init(&ctx);
+    const char* version = OSKextGetCurrentVersionString();
+    if (version) SHA256_Update(&ctx, version, strlen(version) + 1);
+
+    // Capsets are enumerated until the host reports none at an index
+    for (uint32_t index = 0; index < 4; index++) {
+        uint32_t id = 0, cap_version = 0, size = 0, blob_size = 0;
+        if (getCapsetInfo(index, &id, &cap_version, &size) != kIOReturnSuccess || id == 0) {
+            break;
+        }
+        const uint32_t info[3] = { id, cap_version, size };
+        SHA256_Update(&ctx, info, sizeof(info));
+        if (size == 0) continue;
+        if (getCapset(id, cap_version, blob, size < BLOB_CAP ? size : BLOB_CAP,
+                      &blob_size) == kIOReturnSuccess) {
+            SHA256_Update(&ctx, blob, blob_size);
+        }
+    }
+    SHA256_Final(m_shader_cache_env, &ctx);
+    IOFree(blob, BLOB_CAP);
+
+    m_shader_cache_env_valid = true;
+    *out_env = m_shader_cache_env;
+    return kIOReturnSuccess;
+}
+
+// Administrator check, then the provider's shader manager and our environment
+IOReturn VMVirtIOGPUUserClient::shaderCacheAccess(VMShaderManager** out_shaders,
+                                                   const uint8_t** out_env)
+{
+    if (clientHasPrivilege(m_owning_task, kIOClientPrivilegeAdministrator) != kIOReturnSuccess)
+        return kIOReturnNotPrivileged;
+    VMQemuVGAAccelerator* accelerator = OSDynamicCast(VMQemuVGAAccelerator, getProvider());
+    *out_shaders = accelerator ? accelerator->getShaderManager() : nullptr;
+    if (!*out_shaders) return kIOReturnNotReady;
+    return shaderCacheEnvironment(out_env);
+}
+
+IOReturn VMVirtIOGPUUserClient::getShaderCacheInfo(uint8_t* out_identity,
+                                                    uint64_t* out_generation,
+                                                    uint32_t* out_size)
+{
+    VMShaderManager* shaders = nullptr;
+    const uint8_t* env = nullptr;
+    IOReturn ret = shaderCacheAccess(&shaders, &env);
+    if (ret != kIOReturnSuccess) return ret;
+    return shaders->getShaderCacheInfo(env, out_identity, out_generation, out_size);
+}
+
+IOReturn VMVirtIOGPUUserClient::exportShaderCache(void* out_image, uint32_t capacity,
+                                                   uint32_t* out_size)
+{
+    VMShaderManager* shaders = nullptr;
+    const uint8_t* env = nullptr;
+    IOReturn ret = shaderCacheAccess(&shaders, &env);
+    if (ret != kIOReturnSuccess) return ret;
+    return shaders->exportShaderCache(env, out_image, capacity, out_size);
+}
+
+IOReturn VMVirtIOGPUUserClient::importShaderCache(const void* image, uint32_t size,
+                                                   uint32_t* out_shaders,
+                                                   uint32_t* out_programs)
+{
+    VMShaderManager* shaders = nullptr;
+    const uint8_t* env = nullptr;
+    IOReturn ret = shaderCacheAccess(&shaders, &env);
+    if (ret != kIOReturnSuccess) return ret;
+    return shaders->importShaderCache(env, image, size, out_shaders, out_programs);
+}
+
+IOReturn VMVirtIOGPUUserClient::getCompletionStatus(uint32_t object_id, uint32_t is_program,
+                                                     uint32_t* out_complete, uint32_t* out_status)
+{
+    VMQemuVGAAccelerator* accelerator = OSDynamicCast(VMQemuVGAAccelerator, getProvider());
+    VMShaderManager* shaders = accelerator ? accelerator->getShaderManager() : nullptr;
+    if (!shaders) return kIOReturnNotReady;
+    
+    bool complete = false;
+    IOReturn status = kIOReturnNotReady;
+    IOReturn ret = is_program
+        ? shaders->getProgramCompletionStatus(object_id, &complete, &status)
+        : shaders->getShaderCompletionStatus(object_id, &complete, &status);
+    *out_complete = complete ? 1 : 0;
+    *out_status = (uint32_t)status;
+    return ret;
+}
+
+// ---- 0x600E driver log ------------------------------------------------------
+//
+// tools/vmlog drains the VMLog ring (see VMLog.h). Administrator only: the
+// log carries addresses and every client's resource ids.
+IOReturn VMVirtIOGPUUserClient::readLog(uint64_t* cursor, char* out, uint32_t capacity,
+                                        uint32_t* out_size, uint64_t* out_lost)
+{
+    if (clientHasPrivilege(m_owning_task, kIOClientPrivilegeAdministrator) != kIOReturnSuccess)
+        return kIOReturnNotPrivileged;
+    *out_size = (uint32_t)VMLogRead(cursor, out, capacity, out_lost);
+    return kIOReturnSuccess;
+}
+
 // Transfer framebuffer content to host resource
 IOReturn CLASS::transferToHost2D(uint32_t resource_id, uint64_t offset,
                                  uint32_t x, uint32_t y, uint32_t width, uint32_t height)
@@ -8660,7 +9334,7 @@ IOReturn CLASS::transferToHost2D(uint32_t resource_id, uint64_t offset,
     //       resource_id, offset, x, y, width, height);
     
     if (!m_pci_device || !m_control_queue) {
-        IOLog("VMVirtIOGPU::transferToHost2D: VirtIO GPU not ready\n");
+        VMLOG_WARN("VMVirtIOGPU::transferToHost2D: VirtIO GPU not ready\n");
         return kIOReturnNotReady;
     }
     
@@ -8682,7 +9356,7 @@ IOReturn CLASS::transferToHost2D(uint32_t resource_id, uint64_t offset,
     IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::transferToHost2D: Command failed: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPU::transferToHost2D: Command failed: 0x%x\n", ret);
         return ret;
     }
     
@@ -8694,10 +9368,10 @@ IOReturn CLASS::transferToHost2D(uint32_t resource_id, uint64_t offset,
 IOReturn CLASS::transferToHost3D(uint32_t resource_id, uint32_t level,
                                  uint32_t x, uint32_t y, uint32_t z,
                                  uint32_t width, uint32_t height, uint32_t depth,
-                                 uint32_t ctx_id)
+                                 uint32_t ctx_id, uint64_t offset)
 {
     if (!m_pci_device || !m_control_queue) {
-        IOLog("VMVirtIOGPU::transferToHost3D: VirtIO GPU not ready\n");
+        VMLOG_WARN("VMVirtIOGPU::transferToHost3D: VirtIO GPU not ready\n");
         return kIOReturnNotReady;
     }
 
@@ -8709,7 +9383,7 @@ IOReturn CLASS::transferToHost3D(uint32_t resource_id, uint32_t level,
     // the resource. Log loudly when ctx_id==0 so caller bugs are visible at
     // runtime; proceed anyway so legitimate no-context cases (rare) still work.
     if (ctx_id == 0) {
-        IOLog("VMVirtIOGPU::transferToHost3D: WARNING ctx_id=0 — transfer will not "
+        VMLOG_WARN("VMVirtIOGPU::transferToHost3D: WARNING ctx_id=0 — transfer will not "
               "be associated with a virgl context. Caller bug? (resource=%u level=%u "
               "box=(%u,%u,%u, %ux%ux%u))\n",
               resource_id, level, x, y, z, width, height, depth);
@@ -8723,7 +9397,7 @@ IOReturn CLASS::transferToHost3D(uint32_t resource_id, uint32_t level,
     cmd.hdr.ctx_id = ctx_id;  // was hardcoded 0 — bug fixed 2026-08-09
     cmd.resource_id = resource_id;
     cmd.level = level;
-    cmd.offset = 0;
+    cmd.offset = offset;
     cmd.stride = 0;
     cmd.layer_stride = 0;
     cmd.box.x = x;
@@ -8738,7 +9412,7 @@ IOReturn CLASS::transferToHost3D(uint32_t resource_id, uint32_t level,
     IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::transferToHost3D: Command failed: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPU::transferToHost3D: Command failed: 0x%x\n", ret);
         return ret;
     }
     
@@ -8746,7 +9420,7 @@ IOReturn CLASS::transferToHost3D(uint32_t resource_id, uint32_t level,
         static uint32_t s_transfer_to_count = 0;
         if (s_transfer_to_count < 20) {
             s_transfer_to_count++;
-            IOLog("VMVirtIOGPU::transferToHost3D: Resource %u transferred successfully\n", resource_id);
+            VMLOG_DEBUG("VMVirtIOGPU::transferToHost3D: Resource %u transferred successfully\n", resource_id);
         }
     }
     return kIOReturnSuccess;
@@ -8759,7 +9433,7 @@ IOReturn CLASS::transferFromHost3D(uint32_t resource_id, uint32_t level,
                                    uint32_t ctx_id)
 {
     if (!m_pci_device || !m_control_queue) {
-        IOLog("VMVirtIOGPU::transferFromHost3D: VirtIO GPU not ready\n");
+        VMLOG_WARN("VMVirtIOGPU::transferFromHost3D: VirtIO GPU not ready\n");
         return kIOReturnNotReady;
     }
 
@@ -8768,7 +9442,7 @@ IOReturn CLASS::transferFromHost3D(uint32_t resource_id, uint32_t level,
     // virgl_renderer_transfer_read_iov; a zero ctx_id silently does the
     // wrong thing.
     if (ctx_id == 0) {
-        IOLog("VMVirtIOGPU::transferFromHost3D: WARNING ctx_id=0 — transfer will not "
+        VMLOG_WARN("VMVirtIOGPU::transferFromHost3D: WARNING ctx_id=0 — transfer will not "
               "be associated with a virgl context. Caller bug? (resource=%u level=%u "
               "box=(%u,%u,%u, %ux%ux%u))\n",
               resource_id, level, x, y, z, width, height, depth);
@@ -8798,7 +9472,7 @@ IOReturn CLASS::transferFromHost3D(uint32_t resource_id, uint32_t level,
     IOReturn ret = submitCommand(&cmd.hdr, sizeof(cmd), &resp, sizeof(resp));
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::transferFromHost3D: Command failed: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPU::transferFromHost3D: Command failed: 0x%x\n", ret);
         return ret;
     }
     
@@ -8806,7 +9480,7 @@ IOReturn CLASS::transferFromHost3D(uint32_t resource_id, uint32_t level,
         static uint32_t s_transfer_from_count = 0;
         if (s_transfer_from_count < 20) {
             s_transfer_from_count++;
-            IOLog("VMVirtIOGPU::transferFromHost3D: Resource %u pixels copied from host to guest\n", resource_id);
+            VMLOG_DEBUG("VMVirtIOGPU::transferFromHost3D: Resource %u pixels copied from host to guest\n", resource_id);
         }
     }
     return kIOReturnSuccess;
@@ -8821,7 +9495,7 @@ IOReturn CLASS::flushResource(uint32_t resource_id, uint32_t x, uint32_t y,
     //       resource_id, x, y, width, height);
     
     if (!m_pci_device || !m_control_queue) {
-        IOLog("VMVirtIOGPU::flushResource: VirtIO GPU not ready\n");
+        VMLOG_WARN("VMVirtIOGPU::flushResource: VirtIO GPU not ready\n");
         return kIOReturnNotReady;
     }
     
@@ -8842,7 +9516,7 @@ IOReturn CLASS::flushResource(uint32_t resource_id, uint32_t x, uint32_t y,
     IOReturn ret = submitCommand(&flush_cmd.hdr, sizeof(flush_cmd), &flush_resp, sizeof(flush_resp));
     
     if (ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::flushResource: Command failed: 0x%x\n", ret);
+        VMLOG_ERROR("VMVirtIOGPU::flushResource: Command failed: 0x%x\n", ret);
         return ret;
     }
     
@@ -8857,20 +9531,20 @@ IOReturn CLASS::flushResource(uint32_t resource_id, uint32_t x, uint32_t y,
 // non-contiguous allocations produce N segments and Just Work.
 IOReturn CLASS::attachBacking(uint32_t resource_id, IOMemoryDescriptor* backing_memory)
 {
-    IOLog("VMVirtIOGPU::attachBacking: resource=%u backing=%p\n", resource_id, backing_memory);
+    VMLOG_DEBUG("VMVirtIOGPU::attachBacking: resource=%u backing=%p\n", resource_id, backing_memory);
 
     if (!m_pci_device || !m_control_queue) {
-        IOLog("VMVirtIOGPU::attachBacking: VirtIO GPU not ready\n");
+        VMLOG_WARN("VMVirtIOGPU::attachBacking: VirtIO GPU not ready\n");
         return kIOReturnNotReady;
     }
     if (!backing_memory) {
-        IOLog("VMVirtIOGPU::attachBacking: Invalid backing memory\n");
+        VMLOG_WARN("VMVirtIOGPU::attachBacking: Invalid backing memory\n");
         return kIOReturnBadArgument;
     }
 
     IOReturn prepare_ret = backing_memory->prepare(kIODirectionInOut);
     if (prepare_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::attachBacking: Failed to prepare memory: 0x%x\n", prepare_ret);
+        VMLOG_ERROR("VMVirtIOGPU::attachBacking: Failed to prepare memory: 0x%x\n", prepare_ret);
         return prepare_ret;
     }
 
@@ -8891,7 +9565,7 @@ IOReturn CLASS::attachBacking(uint32_t resource_id, IOMemoryDescriptor* backing_
         }
     }
     if (nr_entries == 0 || total_length == 0) {
-        IOLog("VMVirtIOGPU::attachBacking: no segments (nr=%u len=%llu)\n",
+        VMLOG_DEBUG("VMVirtIOGPU::attachBacking: no segments (nr=%u len=%llu)\n",
               nr_entries, (uint64_t)total_length);
         backing_memory->complete(kIODirectionInOut);
         return kIOReturnNoMemory;
@@ -8905,10 +9579,10 @@ IOReturn CLASS::attachBacking(uint32_t resource_id, IOMemoryDescriptor* backing_
     {
         IOByteCount bmd_length = backing_memory->getLength();
         if (total_length != bmd_length) {
-            IOLog("VMQemuVGA: BACKING MISMATCH walked=0x%llx expected=0x%llx entries=%u\n",
+            VMLOG_WARN("VMQemuVGA: BACKING MISMATCH walked=0x%llx expected=0x%llx entries=%u\n",
                   (uint64_t)total_length, (uint64_t)bmd_length, nr_entries);
         } else {
-            IOLog("VMQemuVGA: backing OK 0x%llx in %u entries\n",
+            VMLOG_DEBUG("VMQemuVGA: backing OK 0x%llx in %u entries\n",
                   (uint64_t)total_length, nr_entries);
         }
     }
@@ -8944,13 +9618,13 @@ IOReturn CLASS::attachBacking(uint32_t resource_id, IOMemoryDescriptor* backing_
         }
     }
 
-    IOLog("VMVirtIOGPU::attachBacking: resource=%u nr_entries=%u total=%u bytes\n",
+    VMLOG_DEBUG("VMVirtIOGPU::attachBacking: resource=%u nr_entries=%u total=%u bytes\n",
           resource_id, nr_entries, (uint32_t)total_length);
 
     struct virtio_gpu_ctrl_hdr attach_resp = {};
     IOReturn attach_ret = submitCommand(&attach_cmd->hdr, total_cmd_size, &attach_resp, sizeof(attach_resp));
     
-    IOLog("VMVirtIOGPU::attachBacking: Attach backing returned 0x%x, response type=0x%x\n", 
+    VMLOG_DEBUG("VMVirtIOGPU::attachBacking: Attach backing returned 0x%x, response type=0x%x\n", 
           attach_ret, attach_resp.type);
     
     // Cleanup
@@ -8958,11 +9632,11 @@ IOReturn CLASS::attachBacking(uint32_t resource_id, IOMemoryDescriptor* backing_
     backing_memory->complete(kIODirectionInOut);
     
     if (attach_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::attachBacking: Command failed: 0x%x\n", attach_ret);
+        VMLOG_ERROR("VMVirtIOGPU::attachBacking: Command failed: 0x%x\n", attach_ret);
         return attach_ret;
     }
     
-    IOLog("VMVirtIOGPU::attachBacking: Backing attached successfully\n");
+    VMLOG_DEBUG("VMVirtIOGPU::attachBacking: Backing attached successfully\n");
     return kIOReturnSuccess;
 }
 
@@ -8980,12 +9654,12 @@ void CLASS::probeResourceTracking()
     const uint32_t probe_id = 0xFFFE;       // sentinel — won't collide with real allocations
     const uint32_t probe_format = 0x1;      // VIRTIO_GPU_FORMAT_B8G8R8A8_UNORM
 
-    IOLog("VMVirtIOGPU::probeResourceTracking: PROBE START id=0x%x\n", probe_id);
+    VMLOG_INFO("VMVirtIOGPU::probeResourceTracking: PROBE START id=0x%x\n", probe_id);
 
     // Phase A: create the probe resource. 1×1 minimizes allocation.
     IOReturn create1 = createResource2D(probe_id, probe_format, 1, 1, NULL);
     if (create1 != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::probeResourceTracking: PROBE FAIL phase A create returned 0x%x (expected success)\n",
+        VMLOG_ERROR("VMVirtIOGPU::probeResourceTracking: PROBE FAIL phase A create returned 0x%x (expected success)\n",
               create1);
         return;
     }
@@ -8995,7 +9669,7 @@ void CLASS::probeResourceTracking()
     // broken (the exact bug pool unification is supposed to fix).
     IOReturn create2 = createResource2D(probe_id, probe_format, 1, 1, NULL);
     if (create2 != kIOReturnBadArgument) {
-        IOLog("VMVirtIOGPU::probeResourceTracking: PROBE FAIL phase B create returned 0x%x (expected kIOReturnBadArgument — findResource not catching duplicate)\n",
+        VMLOG_ERROR("VMVirtIOGPU::probeResourceTracking: PROBE FAIL phase B create returned 0x%x (expected kIOReturnBadArgument — findResource not catching duplicate)\n",
               create2);
         // Clean up the probe resource so we don't leak host-side.
         deallocateResource(probe_id);
@@ -9005,7 +9679,7 @@ void CLASS::probeResourceTracking()
     // Phase C: destroy the probe resource.
     IOReturn destroy_ret = deallocateResource(probe_id);
     if (destroy_ret != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::probeResourceTracking: PROBE FAIL phase C destroy returned 0x%x\n",
+        VMLOG_ERROR("VMVirtIOGPU::probeResourceTracking: PROBE FAIL phase C destroy returned 0x%x\n",
               destroy_ret);
         return;
     }
@@ -9016,12 +9690,12 @@ void CLASS::probeResourceTracking()
     gpu_resource* after = findResource(probe_id);
     IOLockUnlock(m_resource_lock);
     if (after != nullptr) {
-        IOLog("VMVirtIOGPU::probeResourceTracking: PROBE FAIL phase D findResource returned %p after deallocate (slot not tombstoned)\n",
+        VMLOG_ERROR("VMVirtIOGPU::probeResourceTracking: PROBE FAIL phase D findResource returned %p after deallocate (slot not tombstoned)\n",
               after);
         return;
     }
 
-    IOLog("VMVirtIOGPU::probeResourceTracking: PROBE PASS (create → dup-reject → destroy → not-found)\n");
+    VMLOG_WARN("VMVirtIOGPU::probeResourceTracking: PROBE PASS (create → dup-reject → destroy → not-found)\n");
 }
 
 //==============================================================================
@@ -9035,11 +9709,11 @@ IOReturn CLASS::blitRect(uint32_t srcX, uint32_t srcY,
                          uint32_t srcRowBytes, uint32_t destRowBytes)
 {
     if (m_is_mock_device) {
-        IOLog("VMVirtIOGPU::blitRect: Mock device - no hardware acceleration available\n");
+        VMLOG_DEBUG("VMVirtIOGPU::blitRect: Mock device - no hardware acceleration available\n");
         return kIOReturnUnsupported;
     }
     
-    IOLog("VMVirtIOGPU::blitRect: Hardware blit %dx%d from (%d,%d) to (%d,%d)\n",
+    VMLOG_DEBUG("VMVirtIOGPU::blitRect: Hardware blit %dx%d from (%d,%d) to (%d,%d)\n",
           width, height, srcX, srcY, destX, destY);
     
     // TODO: Implement VirtIO GPU blit using TRANSFER_TO_HOST_2D
@@ -9052,11 +9726,11 @@ IOReturn CLASS::fillRect(uint32_t x, uint32_t y,
                          uint32_t color)
 {
     if (m_is_mock_device) {
-        IOLog("VMVirtIOGPU::fillRect: Mock device - no hardware acceleration available\n");
+        VMLOG_DEBUG("VMVirtIOGPU::fillRect: Mock device - no hardware acceleration available\n");
         return kIOReturnUnsupported;
     }
     
-    IOLog("VMVirtIOGPU::fillRect: Hardware fill %dx%d at (%d,%d) with color 0x%08x\n",
+    VMLOG_DEBUG("VMVirtIOGPU::fillRect: Hardware fill %dx%d at (%d,%d) with color 0x%08x\n",
           width, height, x, y, color);
     
     // TODO: Implement VirtIO GPU fill operation
@@ -9071,7 +9745,7 @@ IOReturn CLASS::flushCommands()
         return kIOReturnSuccess;
     }
     
-    IOLog("VMVirtIOGPU::flushCommands: Flushing VirtIO GPU command queue\n");
+    VMLOG_DEBUG("VMVirtIOGPU::flushCommands: Flushing VirtIO GPU command queue\n");
     
     // Flush the control queue by sending a NOP command
     // This ensures all pending commands are processed
@@ -9085,7 +9759,7 @@ IOReturn CLASS::flushCommands()
     IOReturn result = submitCommand(&flush_cmd, sizeof(flush_cmd), &flush_resp, sizeof(flush_resp));
     
     if (result != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::flushCommands: Flush failed (0x%x)\n", result);
+        VMLOG_ERROR("VMVirtIOGPU::flushCommands: Flush failed (0x%x)\n", result);
     }
     
     return result;
@@ -9098,7 +9772,7 @@ IOReturn CLASS::waitForIdle()
         return kIOReturnSuccess;
     }
     
-    IOLog("VMVirtIOGPU::waitForIdle: Waiting for GPU to become idle\n");
+    VMLOG_DEBUG("VMVirtIOGPU::waitForIdle: Waiting for GPU to become idle\n");
     
     // Send a fence command and wait for response
     // This ensures all previous commands have completed
@@ -9113,9 +9787,9 @@ IOReturn CLASS::waitForIdle()
     IOReturn result = submitCommand(&fence_cmd.hdr, sizeof(fence_cmd), &fence_resp, sizeof(fence_resp));
     
     if (result != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPU::waitForIdle: Wait failed (0x%x)\n", result);
+        VMLOG_ERROR("VMVirtIOGPU::waitForIdle: Wait failed (0x%x)\n", result);
     } else {
-        IOLog("VMVirtIOGPU::waitForIdle: GPU is now idle\n");
+        VMLOG_DEBUG("VMVirtIOGPU::waitForIdle: GPU is now idle\n");
     }
     
     return result;
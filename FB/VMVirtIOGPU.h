@@ -81,6 +81,15 @@ struct VRingUsed {
 class VMVirtIOGPUAccelerator;
 class VMMetalPlugin;
 class VMVirtIOFramebuffer;
+class VMShaderManager;
+
+// One command of a shared batch (VMVirtIOGPU::submitCommandBatch). resp
+// receives the device's response header.
+struct VMVirtIOGPUBatchCommand {
+    virtio_gpu_ctrl_hdr* cmd;
+    size_t cmd_size;
+    virtio_gpu_ctrl_hdr resp;
+};
 
 // MUST inherit from IOAccelerator for WindowServer to create IOAccelerationUserClient
 // We provide minimal stub implementation to satisfy WindowServer without actual Metal support
@@ -98,8 +107,10 @@ private:
     // VirtIO transport device handle
     IOService* m_virtio_device;
     
-    // Framebuffer reference for scanout coordination
-    VMVirtIOFramebuffer* m_framebuffer;
+    // Framebuffer per scanout for scanout coordination. Slot 0 is the
+    // primary head; slots 1..m_max_scanouts-1 are secondary heads the
+    // primary spawns in start(). Unset slots are nullptr.
+    VMVirtIOFramebuffer* m_framebuffers[VIRTIO_GPU_MAX_SCANOUTS];
     
     // VirtIO GPU configuration
     uint32_t m_max_scanouts;
@@ -118,6 +129,19 @@ private:
     // request kCGLPFAAccelerated and get a context that renders nothing
     // instead of falling back to the working software renderer.
     bool m_3d_functional = false;
+
+    // True once VIRTIO_GPU_F_RESOURCE_BLOB was offered by the device AND
+    // accepted in negotiateFeatures(). Gates RESOURCE_CREATE_BLOB /
+    // SET_SCANOUT_BLOB — sending either to a device that didn't negotiate
+    // the feature is answered with ERR_UNSPEC, so the framebuffer keeps the
+    // CREATE_2D + TRANSFER_TO_HOST_2D path as its fallback.
+    bool m_has_resource_blob;
+
+    // Sampler format mask from the virgl capset (virgl_caps_v1.sampler), one
+    // bit per VIRGL_FORMAT_*. Recorded by enableVirgl(); until then
+    // m_sampler_formats_valid is false and hostSamplesFormat() says no.
+    uint32_t m_sampler_formats[16];
+    bool m_sampler_formats_valid;
     
     // Command queue management (legacy — kept for compatibility, superseded by vring)
     IOBufferMemoryDescriptor* m_control_queue;
@@ -214,6 +238,9 @@ private:
     //   m_next_resource_id     (starts at 1) — display path + kext-internal
     //   m_next_user_resource_id (starts at 0x100) — winsys-driven only
     //                                                  (selector 0x6002)
+    //   0xFFE1-0xFFEF           — display resources of secondary scanouts
+    //                              1..15 (displayResourceIdForScanout).
+    //                              Scanout 0 keeps resource 1.
     //   0xFFF8-0xFFFF           — probe sentinels (probeTransport3D,
     //                              probeAttachBackingUser). Hardcoded,
     //                              never allocated.
@@ -267,6 +294,11 @@ private:
     // Command processing
     IOReturn submitCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size,
                           virtio_gpu_ctrl_hdr* resp, size_t resp_size);
+    // Writes the control-queue doorbell. False when no notify mapping exists.
+    bool ringControlDoorbell();
+    // Tells the framebuffer bound to scanout_id whether resource_id is one of
+    // its own display resources (2D refresh runs) or a 3D client's (refresh pauses).
+    void notifyScanoutOwner(uint32_t scanout_id, uint32_t resource_id);
     IOReturn processControlQueue();
 
     // Cursor queue (queue 1) — separate submit path, lock, and vring.
@@ -319,6 +351,9 @@ public:
     // Separate counter from m_next_resource_id (display path) per the
     // partition comment near that field's declaration.
     uint32_t allocateUserResourceId() { return m_next_user_resource_id++; }
+    // Allocate a resource_id from the display-path counter (m_next_resource_id).
+    // Used by VMVirtIOFramebuffer for its pooled per-mode scanout resources.
+    uint32_t allocateDisplayResourceId() { return ++m_next_resource_id; }
 
     virtual IOService* probe(IOService* provider, SInt32* score) override;
     virtual bool start(IOService* provider) override;
@@ -338,14 +373,30 @@ public:
     IOReturn createResource2D(uint32_t resource_id, uint32_t format,
                              uint32_t width, uint32_t height,
                              IOMemoryDescriptor* backing = NULL);
+    // last_level > 0 allocates a mip chain down to that level
     IOReturn createResource3D(uint32_t resource_id, uint32_t target,
                              uint32_t format, uint32_t bind,
-                             uint32_t width, uint32_t height, uint32_t depth);
+                             uint32_t width, uint32_t height, uint32_t depth,
+                             uint32_t last_level = 0);
     IOReturn attachBacking(uint32_t resource_id, IOMemoryDescriptor* memory);
+
+    // Guest-memory blob resource (VIRTIO_GPU_BLOB_MEM_GUEST). The scatter
+    // list travels inline in RESOURCE_CREATE_BLOB, so there is no separate
+    // ATTACH_BACKING. Backing is always caller-owned. Requires
+    // supportsResourceBlob(); returns kIOReturnUnsupported otherwise.
+    IOReturn createResourceBlob(uint32_t resource_id, uint32_t blob_mem,
+                               uint32_t blob_flags, IOMemoryDescriptor* backing,
+                               uint64_t size);
     
     // Display scanout operations (public interface for framebuffer)
     IOReturn setscanout(uint32_t scanout_id, uint32_t resource_id,
                        uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+    // SET_SCANOUT_BLOB: scan out a blob resource directly. Blob resources
+    // carry no format/dims of their own, so both are supplied here along
+    // with the row stride of the guest buffer.
+    IOReturn setScanoutBlob(uint32_t scanout_id, uint32_t resource_id,
+                           uint32_t format, uint32_t width, uint32_t height,
+                           uint32_t stride);
     
     // 3D context management (public interface for UserClient)
     IOReturn create3DContext(uint32_t* context_id);
@@ -356,10 +407,12 @@ public:
                           uint32_t width, uint32_t height);
     IOReturn transferToHost2D(uint32_t resource_id, uint64_t offset,
                              uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+    // `offset` is where the box starts in the backing; the host derives the
+    // row stride from the level's width
     IOReturn transferToHost3D(uint32_t resource_id, uint32_t level,
                              uint32_t x, uint32_t y, uint32_t z,
                              uint32_t width, uint32_t height, uint32_t depth,
-                             uint32_t ctx_id);
+                             uint32_t ctx_id, uint64_t offset = 0);
     IOReturn transferFromHost3D(uint32_t resource_id, uint32_t level,
                                uint32_t x, uint32_t y, uint32_t z,
                                uint32_t width, uint32_t height, uint32_t depth,
@@ -372,6 +425,8 @@ public:
     IOReturn createRenderContext(uint32_t* context_id);
     IOReturn destroyRenderContext(uint32_t context_id);
     IOReturn executeCommands(uint32_t context_id, IOMemoryDescriptor* commands);
+    // Same as executeCommands for a stream the caller already has mapped
+    IOReturn executeCommandBytes(uint32_t context_id, const void* commands, size_t size);
     
     // Display interface for framebuffer
     IOReturn setupScanout(uint32_t scanout_id, uint32_t width, uint32_t height);
@@ -387,8 +442,25 @@ public:
     IOReturn sendDisplayCommand(virtio_gpu_ctrl_hdr* cmd, size_t cmd_size, 
                                virtio_gpu_ctrl_hdr* resp, size_t resp_size);
     
-    // Framebuffer reference management
-    void setFramebuffer(VMVirtIOFramebuffer* framebuffer);
+    // Framebuffer reference management. One framebuffer per scanout;
+    // pass nullptr to unbind a head on stop.
+    void setFramebuffer(VMVirtIOFramebuffer* framebuffer, uint32_t scanout_id = 0);
+
+    // First display resource of the framebuffer on scanout_id. Scanout 0 is
+    // resource 1 (the historical primary id); secondary heads use the
+    // reserved 0xFFE1-0xFFEF band — see the partition comment above. Further
+    // pooled mode resources come from allocateDisplayResourceId().
+    static uint32_t displayResourceIdForScanout(uint32_t scanout_id) {
+        return scanout_id == 0 ? 1 : (0xFFE0 + scanout_id);
+    }
+
+    static const uint32_t kMaxBatchCommands = 2 * VIRTIO_GPU_MAX_SCANOUTS;
+    // Submit up to kMaxBatchCommands small commands as separate descriptor
+    // chains behind ONE doorbell write and one poll. The refresh tick uses
+    // this so every head's TRANSFER/FLUSH costs a single round-trip under
+    // TCG instead of one per command. Commands must fit in m_cmd_buf
+    // together; there is no large-command slow path here.
+    IOReturn submitCommandBatch(VMVirtIOGPUBatchCommand* cmds, uint32_t count);
     
     // VirtIO 1.2 command header initialization (per specification)
     void initializeCommandHeader(virtio_gpu_ctrl_hdr* hdr, uint32_t cmd_type, 
@@ -421,7 +493,14 @@ public:
     uint32_t getMaxResolutionX() const { return 4096; } // Default max resolution
     uint32_t getMaxResolutionY() const { return 4096; }
     bool supportsVirgl() const { return supports3D(); } // Virgl support requires 3D acceleration
-    bool supportsResourceBlob() const { return supports3D(); } // Resource blob requires 3D support
+    bool supportsResourceBlob() const { return m_has_resource_blob; } // negotiated VIRTIO_GPU_F_RESOURCE_BLOB
+    // Host can sample textures of this VIRGL_FORMAT_*. False when the capset
+    // has not been read, so callers fall back to a format every host takes.
+    bool hostSamplesFormat(uint32_t virgl_format) const {
+        if (!m_sampler_formats_valid || virgl_format >= 16 * 32)
+            return false;
+        return (m_sampler_formats[virgl_format / 32] >> (virgl_format % 32)) & 1;
+    }
     
     // Mock device configuration for compatibility mode
     void setMockMode(bool enabled);
@@ -575,6 +654,15 @@ private:
     void removeUserBacking(uint32_t resource_id);   // complete + release + zero slot
     void removeAllUserBackings();                    // for clientClose/free
 
+    // What a persistent shader cache image must match to be reused here:
+    // SHA-256 of the kext version and every capset the host reports.
+    // Computed on first use (it costs a GET_CAPSET round trip per capset).
+    uint8_t m_shader_cache_env[32];
+    bool m_shader_cache_env_valid;
+    IOReturn shaderCacheEnvironment(const uint8_t** out_env);
+    IOReturn shaderCacheAccess(VMShaderManager** out_shaders,
+                               const uint8_t** out_env);
+
 public:
     virtual bool initWithTask(task_t owningTask, void* securityToken, UInt32 type,
                             OSDictionary* properties) APPLE_KEXT_OVERRIDE;
@@ -682,6 +770,28 @@ public:
                                     const void* commands, uint32_t size);
     IOReturn ctxAttachResource(uint32_t ctx_id,              // 0x6009
                                 uint32_t resource_id);
+
+    // Persistent shader cache (tools/shadercache). Administrator only: an
+    // image carries every client's shader source.
+    IOReturn getShaderCacheInfo(uint8_t* out_identity,       // 0x600A
+                                uint64_t* out_generation,
+                                uint32_t* out_size);
+    IOReturn exportShaderCache(void* out_image,              // 0x600B
+                               uint32_t capacity, uint32_t* out_size);
+    IOReturn importShaderCache(const void* image,            // 0x600C
+                               uint32_t size, uint32_t* out_shaders,
+                               uint32_t* out_programs);
+
+    // KHR_parallel_shader_compile: compiles and links finish on background
+    // workers; polls whether a shader (is_program 0) or program is done.
+    IOReturn getCompletionStatus(uint32_t object_id,         // 0x600D
+                                 uint32_t is_program, uint32_t* out_complete,
+                                 uint32_t* out_status);
+
+    // Driver log ring (tools/vmlog). Administrator only.
+    IOReturn readLog(uint64_t* cursor, char* out,            // 0x600E
+                     uint32_t capacity, uint32_t* out_size,
+                     uint64_t* out_lost);
 };
 
 #endif /* __VMVirtIOGPU_H__ */
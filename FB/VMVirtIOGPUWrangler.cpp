@@ -7,6 +7,7 @@
 
 #include "VMVirtIOGPUWrangler.h"
 #include "VMVirtIOGPU.h"
+#include "VMLog.h"
 #include <IOKit/IORegistryEntry.h>
 
 #define super IOService
@@ -14,7 +15,7 @@ OSDefineMetaClassAndStructors(VMVirtIOGPUWrangler, IOService);
 
 bool VMVirtIOGPUWrangler::init(OSDictionary* properties)
 {
-    IOLog("VMVirtIOGPUWrangler::init() - Initializing VirtIO GPU Wrangler\n");
+    VMLOG_INFO("VMVirtIOGPUWrangler::init() - Initializing VirtIO GPU Wrangler\n");
     
     if (!super::init(properties)) {
         return false;
@@ -27,7 +28,7 @@ bool VMVirtIOGPUWrangler::init(OSDictionary* properties)
 
 void VMVirtIOGPUWrangler::free()
 {
-    IOLog("VMVirtIOGPUWrangler::free() - Releasing VirtIO GPU Wrangler\n");
+    VMLOG_INFO("VMVirtIOGPUWrangler::free() - Releasing VirtIO GPU Wrangler\n");
     
     if (m_gpu_device) {
         detachFromVirtIOGPU();
@@ -38,10 +39,10 @@ void VMVirtIOGPUWrangler::free()
 
 bool VMVirtIOGPUWrangler::start(IOService* provider)
 {
-    IOLog("VMVirtIOGPUWrangler::start() - Starting VirtIO GPU Wrangler\n");
+    VMLOG_INFO("VMVirtIOGPUWrangler::start() - Starting VirtIO GPU Wrangler\n");
     
     if (!super::start(provider)) {
-        IOLog("VMVirtIOGPUWrangler::start() - Failed to start parent\n");
+        VMLOG_ERROR("VMVirtIOGPUWrangler::start() - Failed to start parent\n");
         return false;
     }
     
@@ -62,17 +63,17 @@ bool VMVirtIOGPUWrangler::start(IOService* provider)
     // Register with AppleGPUWrangler if available
     IOReturn result = registerWithGPUWrangler();
     if (result != kIOReturnSuccess) {
-        IOLog("VMVirtIOGPUWrangler::start() - Warning: Failed to register with GPU Wrangler (0x%x)\n", result);
+        VMLOG_ERROR("VMVirtIOGPUWrangler::start() - Warning: Failed to register with GPU Wrangler (0x%x)\n", result);
         // Continue anyway - GPUWrangler might not be available in older systems
     }
     
-    IOLog("VMVirtIOGPUWrangler::start() - VirtIO GPU Wrangler started successfully\n");
+    VMLOG_INFO("VMVirtIOGPUWrangler::start() - VirtIO GPU Wrangler started successfully\n");
     return true;
 }
 
 void VMVirtIOGPUWrangler::stop(IOService* provider)
 {
-    IOLog("VMVirtIOGPUWrangler::stop() - Stopping VirtIO GPU Wrangler\n");
+    VMLOG_INFO("VMVirtIOGPUWrangler::stop() - Stopping VirtIO GPU Wrangler\n");
     
     unregisterFromGPUWrangler();
     
@@ -124,7 +125,7 @@ IOReturn VMVirtIOGPUWrangler::getPowerState(UInt32* state)
 
 IOReturn VMVirtIOGPUWrangler::setPowerState(UInt32 state)
 {
-    IOLog("VMVirtIOGPUWrangler::setPowerState() - Setting power state to %u\n", state);
+    VMLOG_INFO("VMVirtIOGPUWrangler::setPowerState() - Setting power state to %u\n", state);
     
     // VirtIO GPU power management is handled by the hypervisor
     // We just acknowledge the state change
@@ -139,14 +140,14 @@ IOReturn VMVirtIOGPUWrangler::attachToVirtIOGPU(VMVirtIOGPU* gpu)
     }
     
     if (m_gpu_device) {
-        IOLog("VMVirtIOGPUWrangler::attachToVirtIOGPU() - Already attached to a GPU\n");
+        VMLOG_DEBUG("VMVirtIOGPUWrangler::attachToVirtIOGPU() - Already attached to a GPU\n");
         return kIOReturnExclusiveAccess;
     }
     
     m_gpu_device = gpu;
     m_gpu_device->retain();
     
-    IOLog("VMVirtIOGPUWrangler::attachToVirtIOGPU() - Attached to VirtIO GPU\n");
+    VMLOG_DEBUG("VMVirtIOGPUWrangler::attachToVirtIOGPU() - Attached to VirtIO GPU\n");
     return kIOReturnSuccess;
 }
 
@@ -155,13 +156,13 @@ void VMVirtIOGPUWrangler::detachFromVirtIOGPU()
     if (m_gpu_device) {
         m_gpu_device->release();
         m_gpu_device = nullptr;
-        IOLog("VMVirtIOGPUWrangler::detachFromVirtIOGPU() - Detached from VirtIO GPU\n");
+        VMLOG_DEBUG("VMVirtIOGPUWrangler::detachFromVirtIOGPU() - Detached from VirtIO GPU\n");
     }
 }
 
 IOReturn VMVirtIOGPUWrangler::registerWithGPUWrangler()
 {
-    IOLog("VMVirtIOGPUWrangler::registerWithGPUWrangler() - Registering with display system\n");
+    VMLOG_INFO("VMVirtIOGPUWrangler::registerWithGPUWrangler() - Registering with display system\n");
     
     // Instead of trying to register with AppleGPUWrangler, 
     // register with IODisplayWrangler which handles display management
@@ -170,7 +171,7 @@ IOReturn VMVirtIOGPUWrangler::registerWithGPUWrangler()
         1000000000ULL);  // 1 second timeout
     
     if (displayWrangler) {
-        IOLog("VMVirtIOGPUWrangler::registerWithGPUWrangler() - Found IODisplayWrangler\n");
+        VMLOG_INFO("VMVirtIOGPUWrangler::registerWithGPUWrangler() - Found IODisplayWrangler\n");
         
         // Publish that we're available as a graphics device
         publishResource("VirtIOGPUAvailable", this);
@@ -183,14 +184,14 @@ IOReturn VMVirtIOGPUWrangler::registerWithGPUWrangler()
             500000000ULL);  // 0.5 second timeout
         
         if (wsService) {
-            IOLog("VMVirtIOGPUWrangler::registerWithGPUWrangler() - Found WindowServer controllers\n");
+            VMLOG_INFO("VMVirtIOGPUWrangler::registerWithGPUWrangler() - Found WindowServer controllers\n");
             wsService->release();
         }
         
         return kIOReturnSuccess;
     }
     
-    IOLog("VMVirtIOGPUWrangler::registerWithGPUWrangler() - Display wrangler not found, trying alternative registration\n");
+    VMLOG_INFO("VMVirtIOGPUWrangler::registerWithGPUWrangler() - Display wrangler not found, trying alternative registration\n");
     
     // Alternative: Publish ourselves as available to the graphics system
     publishResource("GraphicsDeviceAvailable", this);
@@ -204,7 +205,7 @@ void VMVirtIOGPUWrangler::unregisterFromGPUWrangler()
         return;  // Not registered
     }
     
-    IOLog("VMVirtIOGPUWrangler::unregisterFromGPUWrangler() - Unregistering from AppleGPUWrangler\n");
+    VMLOG_INFO("VMVirtIOGPUWrangler::unregisterFromGPUWrangler() - Unregistering from AppleGPUWrangler\n");
     
     IOService* gpuWrangler = IOService::waitForMatchingService(
         IOService::serviceMatching("AppleGPUWrangler"), 
@@ -222,6 +223,6 @@ void VMVirtIOGPUWrangler::unregisterFromGPUWrangler()
         
         gpuWrangler->release();
         removeProperty("registered-with-gpu-wrangler");
-        IOLog("VMVirtIOGPUWrangler::unregisterFromGPUWrangler() - Unregistered from AppleGPUWrangler\n");
+        VMLOG_INFO("VMVirtIOGPUWrangler::unregisterFromGPUWrangler() - Unregistered from AppleGPUWrangler\n");
     }
 }
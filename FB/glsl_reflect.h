@@ -0,0 +1,1136 @@
+/*
+ * glsl_reflect.h - Header-only GLSL declaration reflector
+ *
+ * One pass over GLSL 1.10-4.10 / ESSL 1.00-3.00 source that reports what a
+ * program exposes: default-block uniforms, samplers and images, uniform
+ * blocks and their members, vertex inputs and stage outputs. Uniforms and
+ * block members get std140 offsets; structs are flattened the way GL names
+ * them ("light.color", "lights[1].pos"). VMShaderManager uses it for shader
+ * reflection; tools/glsl_reflect_test builds it on Linux to test, fuzz and
+ * benchmark it. C and C++, no allocation: results go to caller-owned arrays.
+ *
+ * Scope is declarations only. Function bodies are skipped (counting
+ * branches, loops and texture calls on the way), and preprocessor
+ * conditionals are not evaluated: every branch is read and a name seen
+ * twice is reported once. Object-like `#define NAME <int>` and global
+ * `const int NAME = <int>;` are remembered, and array sizes may be integer
+ * expressions over them.
+ *
+ * Opaque uniforms (samplers, images, atomic counters) take a 4-byte slot
+ * in the default block, where VMShaderManager keeps texture unit numbers.
+ */
+
+#ifndef _GLSL_REFLECT_H
+#define _GLSL_REFLECT_H
+
+#ifdef KERNEL
+#include <IOKit/IOTypes.h>
+#else
+#include <stdint.h>
+#include <stddef.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GLSL_REFLECT_NAME_MAX       64
+#define GLSL_REFLECT_MAX_STRUCTS    16
+#define GLSL_REFLECT_MAX_MEMBERS    128     // struct members, all structs together
+#define GLSL_REFLECT_MAX_CONSTANTS  64      // #define / const int values
+#define GLSL_REFLECT_MAX_DEPTH      4       // struct nesting
+#define GLSL_REFLECT_NAME_BUCKETS   512     // duplicate-name index, power of two
+#define GLSL_REFLECT_SIZE_MAX       0x10000000u     // layout sizes saturate here
+
+enum glsl_reflect_stage {
+    GLSL_STAGE_VERTEX = 1,
+    GLSL_STAGE_FRAGMENT,
+    GLSL_STAGE_GEOMETRY,
+    GLSL_STAGE_TESS_CONTROL,
+    GLSL_STAGE_TESS_EVALUATION,
+    GLSL_STAGE_COMPUTE
+};
+
+enum glsl_reflect_kind {
+    GLSL_VAR_UNIFORM = 1,       // default-block uniform
+    GLSL_VAR_SAMPLER,           // opaque default-block uniform
+    GLSL_VAR_BLOCK_MEMBER,      // member of a uniform block
+    GLSL_VAR_INPUT,             // attribute / in
+    GLSL_VAR_OUTPUT             // varying (vertex) / out
+};
+
+struct glsl_reflect_var {
+    char name[GLSL_REFLECT_NAME_MAX];
+    uint32_t kind;              // glsl_reflect_kind
+    uint32_t gl_type;           // GL_FLOAT_VEC3, GL_SAMPLER_2D, ...
+    uint32_t components;        // per column
+    uint32_t columns;           // 1 unless a matrix
+    uint32_t array_size;        // 1 unless an array; 0 if unsized
+    uint32_t size;              // std140 bytes of one element, the array stride for arrays
+    uint32_t align;             // std140 base alignment
+    uint32_t offset;            // std140 offset in the default block or its uniform block
+    int32_t location;           // layout(location = N), else -1
+    int32_t binding;            // layout(binding = N), else -1
+    int32_t block;              // uniform block index for block members, else -1
+};
+
+struct glsl_reflect_block {
+    char name[GLSL_REFLECT_NAME_MAX];
+    uint32_t size;              // std140
+    uint32_t array_size;        // instance array, 1 if none
+    int32_t binding;
+    uint32_t first_var;
+    uint32_t var_count;
+};
+
+// Internal tables; part of the reflection so nothing lives on the stack
+struct glsl__span { const char* s; uint32_t len; };
+struct glsl__member { struct glsl__span name; uint32_t type; uint32_t array_size; uint32_t row_major; };
+struct glsl__struct { struct glsl__span name; uint32_t first, count; };
+struct glsl__constant { struct glsl__span name; uint32_t value; };
+
+struct glsl_reflection {
+    struct glsl_reflect_var* vars;
+    uint32_t var_capacity;
+    uint32_t var_count;
+    struct glsl_reflect_block* blocks;
+    uint32_t block_capacity;
+    uint32_t block_count;
+
+    uint32_t version;               // #version, 110 when absent
+    uint32_t default_block_size;    // std140 size of the default uniform block
+    uint32_t overflow;              // variables or blocks dropped for lack of room
+    uint32_t errors;                // declarations that did not parse
+    uint32_t duplicates;            // declarations seen again in another #if branch
+
+    // Seen while skipping function bodies
+    uint32_t functions;
+    uint32_t branches;
+    uint32_t loops;
+    uint32_t texture_calls;
+
+    struct glsl__struct structs[GLSL_REFLECT_MAX_STRUCTS];
+    uint32_t struct_count;
+    struct glsl__member members[GLSL_REFLECT_MAX_MEMBERS];
+    uint32_t member_count;
+    struct glsl__constant constants[GLSL_REFLECT_MAX_CONSTANTS];
+    uint32_t constant_count;
+    uint16_t names[GLSL_REFLECT_NAME_BUCKETS];     // var index + 1
+    uint32_t emit_budget;                           // bounds struct-array flattening
+};
+
+// ---------------------------------------------------------------------------
+// Types
+// ---------------------------------------------------------------------------
+
+enum { GLSL__F = 1, GLSL__I, GLSL__U, GLSL__B, GLSL__D, GLSL__OPAQUE };
+
+struct glsl__builtin {
+    const char* name;
+    uint8_t len;
+    uint8_t base;
+    uint8_t components;         // rows for matrices
+    uint8_t columns;
+    uint32_t gl_type;
+};
+
+#define GLSL__T(n, b, c, k, gl) { n, (uint8_t)(sizeof(n) - 1), b, c, k, gl }
+static const struct glsl__builtin glsl__builtins[] = {
+    GLSL__T("float", GLSL__F, 1, 1, 0x1406), GLSL__T("vec2", GLSL__F, 2, 1, 0x8B50),
+    GLSL__T("vec3", GLSL__F, 3, 1, 0x8B51), GLSL__T("vec4", GLSL__F, 4, 1, 0x8B52),
+    GLSL__T("int", GLSL__I, 1, 1, 0x1404), GLSL__T("ivec2", GLSL__I, 2, 1, 0x8B53),
+    GLSL__T("ivec3", GLSL__I, 3, 1, 0x8B54), GLSL__T("ivec4", GLSL__I, 4, 1, 0x8B55),
+    GLSL__T("uint", GLSL__U, 1, 1, 0x1405), GLSL__T("uvec2", GLSL__U, 2, 1, 0x8DC6),
+    GLSL__T("uvec3", GLSL__U, 3, 1, 0x8DC7), GLSL__T("uvec4", GLSL__U, 4, 1, 0x8DC8),
+    GLSL__T("bool", GLSL__B, 1, 1, 0x8B56), GLSL__T("bvec2", GLSL__B, 2, 1, 0x8B57),
+    GLSL__T("bvec3", GLSL__B, 3, 1, 0x8B58), GLSL__T("bvec4", GLSL__B, 4, 1, 0x8B59),
+    GLSL__T("double", GLSL__D, 1, 1, 0x140A), GLSL__T("dvec2", GLSL__D, 2, 1, 0x8FFC),
+    GLSL__T("dvec3", GLSL__D, 3, 1, 0x8FFD), GLSL__T("dvec4", GLSL__D, 4, 1, 0x8FFE),
+    GLSL__T("mat2", GLSL__F, 2, 2, 0x8B5A), GLSL__T("mat3", GLSL__F, 3, 3, 0x8B5B),
+    GLSL__T("mat4", GLSL__F, 4, 4, 0x8B5C), GLSL__T("mat2x2", GLSL__F, 2, 2, 0x8B5A),
+    GLSL__T("mat2x3", GLSL__F, 3, 2, 0x8B65), GLSL__T("mat2x4", GLSL__F, 4, 2, 0x8B66),
+    GLSL__T("mat3x2", GLSL__F, 2, 3, 0x8B67), GLSL__T("mat3x3", GLSL__F, 3, 3, 0x8B5B),
+    GLSL__T("mat3x4", GLSL__F, 4, 3, 0x8B68), GLSL__T("mat4x2", GLSL__F, 2, 4, 0x8B69),
+    GLSL__T("mat4x3", GLSL__F, 3, 4, 0x8B6A), GLSL__T("mat4x4", GLSL__F, 4, 4, 0x8B5C),
+    GLSL__T("dmat2", GLSL__D, 2, 2, 0x8F46), GLSL__T("dmat3", GLSL__D, 3, 3, 0x8F47),
+    GLSL__T("dmat4", GLSL__D, 4, 4, 0x8F48),
+    GLSL__T("sampler1D", GLSL__OPAQUE, 1, 1, 0x8B5D), GLSL__T("sampler2D", GLSL__OPAQUE, 1, 1, 0x8B5E),
+    GLSL__T("sampler3D", GLSL__OPAQUE, 1, 1, 0x8B5F), GLSL__T("samplerCube", GLSL__OPAQUE, 1, 1, 0x8B60),
+    GLSL__T("sampler1DShadow", GLSL__OPAQUE, 1, 1, 0x8B61), GLSL__T("sampler2DShadow", GLSL__OPAQUE, 1, 1, 0x8B62),
+    GLSL__T("sampler2DRect", GLSL__OPAQUE, 1, 1, 0x8B63), GLSL__T("sampler2DRectShadow", GLSL__OPAQUE, 1, 1, 0x8B64),
+    GLSL__T("sampler1DArray", GLSL__OPAQUE, 1, 1, 0x8DC0), GLSL__T("sampler2DArray", GLSL__OPAQUE, 1, 1, 0x8DC1),
+    GLSL__T("samplerBuffer", GLSL__OPAQUE, 1, 1, 0x8DC2), GLSL__T("sampler2DArrayShadow", GLSL__OPAQUE, 1, 1, 0x8DC4),
+    GLSL__T("samplerCubeShadow", GLSL__OPAQUE, 1, 1, 0x8DC5), GLSL__T("samplerCubeArray", GLSL__OPAQUE, 1, 1, 0x900C),
+    GLSL__T("sampler2DMS", GLSL__OPAQUE, 1, 1, 0x9108), GLSL__T("samplerExternalOES", GLSL__OPAQUE, 1, 1, 0x8D66),
+    GLSL__T("isampler2D", GLSL__OPAQUE, 1, 1, 0x8DCA), GLSL__T("isampler3D", GLSL__OPAQUE, 1, 1, 0x8DCB),
+    GLSL__T("isamplerCube", GLSL__OPAQUE, 1, 1, 0x8DCC), GLSL__T("isampler2DArray", GLSL__OPAQUE, 1, 1, 0x8DCF),
+    GLSL__T("usampler2D", GLSL__OPAQUE, 1, 1, 0x8DD2), GLSL__T("usampler3D", GLSL__OPAQUE, 1, 1, 0x8DD3),
+    GLSL__T("usamplerCube", GLSL__OPAQUE, 1, 1, 0x8DD4), GLSL__T("usampler2DArray", GLSL__OPAQUE, 1, 1, 0x8DD7),
+    GLSL__T("image2D", GLSL__OPAQUE, 1, 1, 0x904D), GLSL__T("image3D", GLSL__OPAQUE, 1, 1, 0x904E),
+    GLSL__T("imageCube", GLSL__OPAQUE, 1, 1, 0x9050), GLSL__T("atomic_uint", GLSL__OPAQUE, 1, 1, 0x92DB),
+};
+#undef GLSL__T
+
+#define GLSL__BUILTIN_COUNT (sizeof(glsl__builtins) / sizeof(glsl__builtins[0]))
+#define GLSL__STRUCT_TYPE   0x100   // type ids at or above are struct indices
+#define GLSL__NO_TYPE       0xFFFF
+
+// Array sizes while parsing: 0 for "not an array", so that x[1] still gets
+// array layout and an "[0]" in flattened names
+#define GLSL__UNSIZED       0xFFFFFFFFu
+
+static inline uint32_t glsl__elements(uint32_t array_size)
+{
+    return (array_size == 0 || array_size == GLSL__UNSIZED) ? 1 : array_size;
+}
+
+static inline uint32_t glsl__round(uint32_t v, uint32_t a)
+{
+    return (v + a - 1) & ~(a - 1);
+}
+
+// std140 alignment and size of one builtin, matrices stored column-major
+// unless row_major
+static inline void glsl__builtin_layout(const struct glsl__builtin* t, uint32_t row_major,
+                                        uint32_t* align, uint32_t* size)
+{
+    uint32_t n = t->base == GLSL__D ? 8 : 4;
+    if (t->columns > 1) {
+        // An array of column (or row) vectors, each aligned like a vec4
+        uint32_t vectors = row_major ? t->components : t->columns;
+        uint32_t length = row_major ? t->columns : t->components;
+        uint32_t stride = glsl__round(n * (length == 2 ? 2 : 4), 16);
+        *align = stride;
+        *size = stride * vectors;
+    } else {
+        *align = n * (t->components == 1 ? 1 : t->components == 2 ? 2 : 4);
+        *size = n * t->components;
+    }
+}
+
+// std140 alignment, element size and total size of `type[array_size]`
+// (array_size as parsed, see GLSL__UNSIZED).
+// Arrays and structs align to 16 and pad each element to it.
+static inline void glsl__layout(const struct glsl_reflection* r, uint32_t type, uint32_t array_size,
+                                uint32_t row_major, uint32_t depth,
+                                uint32_t* align, uint32_t* elem_size, uint32_t* total)
+{
+    uint32_t a = 4, s = 4;
+    if (type < GLSL__BUILTIN_COUNT) {
+        glsl__builtin_layout(&glsl__builtins[type], row_major, &a, &s);
+    } else if (type >= GLSL__STRUCT_TYPE && type - GLSL__STRUCT_TYPE < r->struct_count &&
+               depth < GLSL_REFLECT_MAX_DEPTH) {
+        const struct glsl__struct* st = &r->structs[type - GLSL__STRUCT_TYPE];
+        uint32_t cursor = 0, max_align = 16;
+        for (uint32_t i = 0; i < st->count; i++) {
+            const struct glsl__member* m = &r->members[st->first + i];
+            uint32_t ma, me, mt;
+            glsl__layout(r, m->type, m->array_size, m->row_major, depth + 1, &ma, &me, &mt);
+            cursor = glsl__round(cursor, ma) + mt;
+            if (cursor > GLSL_REFLECT_SIZE_MAX) cursor = GLSL_REFLECT_SIZE_MAX;
+            if (ma > max_align) max_align = ma;
+        }
+        a = max_align;
+        s = glsl__round(cursor, a);
+    }
+    if (array_size) {
+        a = glsl__round(a, 16);
+        s = glsl__round(s, a);
+    }
+    // Saturate: a hostile source can nest arrays of structs past 4 GB
+    uint64_t bytes = (uint64_t)s * glsl__elements(array_size);
+    *align = a;
+    *elem_size = s;
+    *total = bytes > GLSL_REFLECT_SIZE_MAX ? GLSL_REFLECT_SIZE_MAX : (uint32_t)bytes;
+}
+
+// std140 alignment and array stride of a builtin by GL type, for callers
+// that only kept the GL enum. Returns 0 for an unknown type.
+static inline int glsl_reflect_type_layout(uint32_t gl_type, uint32_t array_size,
+                                           uint32_t* align, uint32_t* stride)
+{
+    for (uint32_t i = 0; i < GLSL__BUILTIN_COUNT; i++) {
+        if (glsl__builtins[i].gl_type == gl_type) {
+            glsl__builtin_layout(&glsl__builtins[i], 0, align, stride);
+            if (array_size > 1) {
+                *align = glsl__round(*align, 16);
+                *stride = glsl__round(*stride, *align);
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Lexer
+// ---------------------------------------------------------------------------
+
+enum { GLSL__EOF = 0, GLSL__IDENT, GLSL__NUMBER, GLSL__PUNCT };
+
+struct glsl__lexer {
+    const char* p;
+    const char* end;
+    int at_line_start;
+    struct glsl_reflection* r;
+};
+
+struct glsl__tok {
+    int kind;
+    const char* s;
+    uint32_t len;
+};
+
+static inline int glsl__ident_start(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+static inline int glsl__ident_char(char c)
+{
+    return glsl__ident_start(c) || (c >= '0' && c <= '9');
+}
+
+static inline int glsl__eq(const char* s, uint32_t len, const char* lit)
+{
+    uint32_t i = 0;
+    for (; i < len; i++) {
+        if (lit[i] != s[i]) return 0;
+    }
+    return lit[i] == '\0';
+}
+
+static inline int glsl__starts(const char* s, uint32_t len, const char* lit)
+{
+    uint32_t i = 0;
+    for (; lit[i]; i++) {
+        if (i >= len || lit[i] != s[i]) return 0;
+    }
+    return 1;
+}
+
+static inline int glsl__is(const struct glsl__tok* t, const char* lit)
+{
+    return t->kind == GLSL__IDENT && glsl__eq(t->s, t->len, lit);
+}
+
+static inline int glsl__punct(const struct glsl__tok* t, char c)
+{
+    return t->kind == GLSL__PUNCT && t->s[0] == c;
+}
+
+// Decimal, octal or hex integer literal with an optional u/U suffix
+static inline int glsl__parse_uint(const char* s, uint32_t len, uint32_t* value)
+{
+    uint32_t v = 0, i = 0, base = 10;
+    if (len > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+        base = 16;
+        i = 2;
+    } else if (len > 1 && s[0] == '0') {
+        base = 8;
+        i = 1;
+    }
+    if (len && (s[len - 1] == 'u' || s[len - 1] == 'U')) len--;
+    if (i >= len) {
+        *value = 0;
+        return len > 0;
+    }
+    for (; i < len; i++) {
+        char c = s[i];
+        uint32_t d;
+        if (c >= '0' && c <= '9') d = (uint32_t)(c - '0');
+        else if (c >= 'a' && c <= 'f') d = (uint32_t)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') d = (uint32_t)(c - 'A' + 10);
+        else return 0;
+        if (d >= base || v > (0xFFFFFFFFu - d) / base) return 0;
+        v = v * base + d;
+    }
+    *value = v;
+    return 1;
+}
+
+static inline void glsl__add_constant(struct glsl_reflection* r, const char* s, uint32_t len,
+                                      uint32_t value)
+{
+    if (r->constant_count < GLSL_REFLECT_MAX_CONSTANTS) {
+        struct glsl__constant* c = &r->constants[r->constant_count++];
+        c->name.s = s;
+        c->name.len = len;
+        c->value = value;
+    }
+}
+
+// Latest definition wins, as with #undef/#define pairs
+static inline int glsl__find_constant(const struct glsl_reflection* r, const char* s, uint32_t len,
+                                      uint32_t* value)
+{
+    for (uint32_t i = r->constant_count; i-- > 0;) {
+        const struct glsl__constant* c = &r->constants[i];
+        if (c->name.len == len) {
+            uint32_t j = 0;
+            while (j < len && c->name.s[j] == s[j]) j++;
+            if (j == len) {
+                *value = c->value;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// A directive: #version and integer #defines are kept, the rest is skipped
+static inline void glsl__directive(struct glsl__lexer* lx)
+{
+    const char* p = lx->p;
+    const char* end = lx->end;
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    const char* word = p;
+    while (p < end && glsl__ident_char(*p)) p++;
+    uint32_t word_len = (uint32_t)(p - word);
+
+    if (glsl__eq(word, word_len, "version") || glsl__eq(word, word_len, "define")) {
+        int is_version = word[0] == 'v';
+        while (p < end && (*p == ' ' || *p == '\t')) p++;
+        const char* name = p;
+        if (!is_version) {
+            while (p < end && glsl__ident_char(*p)) p++;
+        }
+        uint32_t name_len = (uint32_t)(p - name);
+        if (is_version || (name_len && (p >= end || *p != '('))) {
+            while (p < end && (*p == ' ' || *p == '\t')) p++;
+            const char* num = p;
+            while (p < end && glsl__ident_char(*p)) p++;
+            uint32_t value;
+            const char* rest = p;
+            while (rest < end && (*rest == ' ' || *rest == '\t')) rest++;
+            // "#version 300 es" carries a profile; a #define must be the number alone
+            int alone = is_version || rest >= end || *rest == '\n' || *rest == '\r' || *rest == '/';
+            if (p > num && alone && glsl__parse_uint(num, (uint32_t)(p - num), &value)) {
+                if (is_version) lx->r->version = value;
+                else glsl__add_constant(lx->r, name, name_len, value);
+            }
+        }
+    }
+
+    // To the end of the line, following backslash continuations
+    while (p < end && *p != '\n') {
+        if (*p == '\\' && p + 1 < end && (p[1] == '\n' || p[1] == '\r')) {
+            p++;
+            if (*p == '\r' && p + 1 < end && p[1] == '\n') p++;
+        }
+        p++;
+    }
+    lx->p = p;
+}
+
+static inline void glsl__next(struct glsl__lexer* lx, struct glsl__tok* t)
+{
+    const char* p = lx->p;
+    const char* end = lx->end;
+    for (;;) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' ||
+                           *p == '\f' || *p == '\v')) {
+            if (*p == '\n') lx->at_line_start = 1;
+            p++;
+        }
+        if (p >= end || *p == '\0') {
+            lx->p = end;
+            t->kind = GLSL__EOF;
+            t->s = end;
+            t->len = 0;
+            return;
+        }
+        if (*p == '/' && p + 1 < end && p[1] == '/') {
+            while (p < end && *p != '\n') p++;
+            continue;
+        }
+        if (*p == '/' && p + 1 < end && p[1] == '*') {
+            p += 2;
+            while (p + 1 < end && !(p[0] == '*' && p[1] == '/')) p++;
+            p = p + 1 < end ? p + 2 : end;
+            continue;
+        }
+        if (*p == '#' && lx->at_line_start) {
+            lx->p = p + 1;
+            glsl__directive(lx);
+            p = lx->p;
+            continue;
+        }
+        break;
+    }
+
+    lx->at_line_start = 0;
+    t->s = p;
+    if (glsl__ident_start(*p)) {
+        while (p < end && glsl__ident_char(*p)) p++;
+        t->kind = GLSL__IDENT;
+    } else if ((*p >= '0' && *p <= '9') || (*p == '.' && p + 1 < end && p[1] >= '0' && p[1] <= '9')) {
+        while (p < end && (glsl__ident_char(*p) || *p == '.' ||
+                           ((*p == '+' || *p == '-') && (p[-1] == 'e' || p[-1] == 'E')))) {
+            p++;
+        }
+        t->kind = GLSL__NUMBER;
+    } else {
+        p++;
+        t->kind = GLSL__PUNCT;
+    }
+    t->len = (uint32_t)(p - t->s);
+    lx->p = p;
+}
+
+// Skips a balanced (), [] or {} group whose opener is `t`, counting
+// control flow and texture lookups when it is a function body
+static inline void glsl__skip_group(struct glsl__lexer* lx, struct glsl__tok* t)
+{
+    struct glsl_reflection* r = lx->r;
+    uint32_t depth = 1;
+    for (;;) {
+        glsl__next(lx, t);
+        if (t->kind == GLSL__EOF) return;
+        if (t->kind == GLSL__PUNCT) {
+            char c = t->s[0];
+            if (c == '{' || c == '(' || c == '[') depth++;
+            else if ((c == '}' || c == ')' || c == ']') && --depth == 0) return;
+        } else if (t->kind == GLSL__IDENT) {
+            if (glsl__eq(t->s, t->len, "if")) r->branches++;
+            else if (glsl__eq(t->s, t->len, "for") || glsl__eq(t->s, t->len, "while")) r->loops++;
+            else if (t->s[0] == 't' && (glsl__starts(t->s, t->len, "texture") ||
+                                        glsl__starts(t->s, t->len, "texelFetch"))) r->texture_calls++;
+        }
+    }
+}
+
+// Skips to the end of the current statement
+static inline void glsl__skip_statement(struct glsl__lexer* lx, struct glsl__tok* t)
+{
+    while (t->kind != GLSL__EOF && !glsl__punct(t, ';')) {
+        if (glsl__punct(t, '{')) {
+            glsl__skip_group(lx, t);
+            glsl__next(lx, t);
+            if (glsl__punct(t, ';')) return;
+            continue;
+        }
+        if (glsl__punct(t, '(') || glsl__punct(t, '[')) glsl__skip_group(lx, t);
+        glsl__next(lx, t);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Parser
+// ---------------------------------------------------------------------------
+
+struct glsl__qualifiers {
+    uint32_t kind;          // 0 for globals that are not interface variables
+    int32_t location;
+    int32_t binding;
+    uint32_t row_major;
+    uint32_t is_const;
+};
+
+static inline uint32_t glsl__find_type(const struct glsl_reflection* r, const struct glsl__tok* t)
+{
+    if (t->kind != GLSL__IDENT) return GLSL__NO_TYPE;
+    for (uint32_t i = 0; i < GLSL__BUILTIN_COUNT; i++) {
+        if (glsl__builtins[i].len == t->len && glsl__builtins[i].name[0] == t->s[0] &&
+            glsl__eq(t->s, t->len, glsl__builtins[i].name)) {
+            return i;
+        }
+    }
+    for (uint32_t i = r->struct_count; i-- > 0;) {
+        const struct glsl__struct* st = &r->structs[i];
+        if (st->name.len == t->len) {
+            uint32_t j = 0;
+            while (j < t->len && st->name.s[j] == t->s[j]) j++;
+            if (j == t->len) return GLSL__STRUCT_TYPE + i;
+        }
+    }
+    return GLSL__NO_TYPE;
+}
+
+// layout( ... ): location, binding and row_major/column_major; the rest is ignored
+static inline void glsl__layout_qualifier(struct glsl__lexer* lx, struct glsl__tok* t,
+                                          struct glsl__qualifiers* q)
+{
+    glsl__next(lx, t);
+    if (!glsl__punct(t, '(')) return;
+    for (;;) {
+        glsl__next(lx, t);
+        if (t->kind == GLSL__EOF || glsl__punct(t, ')')) return;
+        if (t->kind != GLSL__IDENT) continue;
+        struct glsl__tok id = *t;
+        if (glsl__eq(id.s, id.len, "row_major")) q->row_major = 1;
+        if (glsl__eq(id.s, id.len, "column_major")) q->row_major = 0;
+        glsl__next(lx, t);
+        if (glsl__punct(t, '=')) {
+            glsl__next(lx, t);
+            uint32_t value;
+            if (t->kind == GLSL__NUMBER && glsl__parse_uint(t->s, t->len, &value)) {
+                if (glsl__eq(id.s, id.len, "location")) q->location = (int32_t)value;
+                else if (glsl__eq(id.s, id.len, "binding")) q->binding = (int32_t)value;
+            }
+            glsl__next(lx, t);
+        }
+        if (glsl__punct(t, ')') || t->kind == GLSL__EOF) return;
+    }
+}
+
+// Storage, layout, precision, interpolation and other qualifiers. Leaves `t`
+// on the first token that is not one. Returns 0 if the statement is not a
+// declaration (precision statement) and was consumed.
+static inline int glsl__qualifiers(struct glsl__lexer* lx, struct glsl__tok* t, uint32_t stage,
+                                   struct glsl__qualifiers* q)
+{
+    static const char* const ignored[] = {
+        "const", "highp", "mediump", "lowp", "flat", "smooth", "noperspective", "centroid",
+        "invariant", "precise", "patch", "sample", "readonly", "writeonly", "coherent",
+        "volatile", "restrict", "shared", "inout"
+    };
+    for (;;) {
+        if (t->kind != GLSL__IDENT) return 1;
+        if (glsl__eq(t->s, t->len, "layout")) {
+            glsl__layout_qualifier(lx, t, q);
+        } else if (glsl__eq(t->s, t->len, "uniform")) {
+            q->kind = GLSL_VAR_UNIFORM;
+        } else if (glsl__eq(t->s, t->len, "attribute")) {
+            q->kind = GLSL_VAR_INPUT;
+        } else if (glsl__eq(t->s, t->len, "in")) {
+            q->kind = GLSL_VAR_INPUT;
+        } else if (glsl__eq(t->s, t->len, "out")) {
+            q->kind = GLSL_VAR_OUTPUT;
+        } else if (glsl__eq(t->s, t->len, "varying")) {
+            q->kind = stage == GLSL_STAGE_VERTEX ? GLSL_VAR_OUTPUT : GLSL_VAR_INPUT;
+        } else if (glsl__eq(t->s, t->len, "buffer")) {
+            q->kind = 0xFF;     // shader storage: std430, not reflected
+        } else if (glsl__eq(t->s, t->len, "precision")) {
+            glsl__skip_statement(lx, t);
+            return 0;
+        } else {
+            uint32_t i = 0, n = (uint32_t)(sizeof(ignored) / sizeof(ignored[0]));
+            while (i < n && !glsl__eq(t->s, t->len, ignored[i])) i++;
+            if (i == n) return 1;
+            if (i == 0) q->is_const = 1;
+        }
+        glsl__next(lx, t);
+    }
+}
+
+static inline int glsl__const_sum(struct glsl__lexer* lx, struct glsl__tok* t, uint32_t* value,
+                                  uint32_t depth);
+
+// Integer constant expressions in array sizes: literals, known constants,
+// + - * / and parentheses. `t` is on the first token and is left on the
+// first token past the expression.
+static inline int glsl__const_factor(struct glsl__lexer* lx, struct glsl__tok* t, uint32_t* value,
+                                     uint32_t depth)
+{
+    int ok = 0;
+    if (t->kind == GLSL__NUMBER) {
+        ok = glsl__parse_uint(t->s, t->len, value);
+    } else if (t->kind == GLSL__IDENT) {
+        ok = glsl__find_constant(lx->r, t->s, t->len, value);
+    } else if (glsl__punct(t, '(') && depth < 8) {
+        glsl__next(lx, t);
+        if (!glsl__const_sum(lx, t, value, depth + 1) || !glsl__punct(t, ')')) return 0;
+        ok = 1;
+    }
+    if (ok) glsl__next(lx, t);
+    return ok;
+}
+
+static inline int glsl__const_product(struct glsl__lexer* lx, struct glsl__tok* t, uint32_t* value,
+                                      uint32_t depth)
+{
+    if (!glsl__const_factor(lx, t, value, depth)) return 0;
+    while (glsl__punct(t, '*') || glsl__punct(t, '/')) {
+        char op = t->s[0];
+        uint32_t rhs;
+        glsl__next(lx, t);
+        if (!glsl__const_factor(lx, t, &rhs, depth)) return 0;
+        if (op == '/' && rhs == 0) return 0;
+        *value = op == '*' ? *value * rhs : *value / rhs;
+    }
+    return 1;
+}
+
+static inline int glsl__const_sum(struct glsl__lexer* lx, struct glsl__tok* t, uint32_t* value,
+                                  uint32_t depth)
+{
+    if (!glsl__const_product(lx, t, value, depth)) return 0;
+    while (glsl__punct(t, '+') || glsl__punct(t, '-')) {
+        char op = t->s[0];
+        uint32_t rhs;
+        glsl__next(lx, t);
+        if (!glsl__const_product(lx, t, &rhs, depth)) return 0;
+        *value = op == '+' ? *value + rhs : *value - rhs;
+    }
+    return 1;
+}
+
+// [N] after a declarator: 0 when there is none, GLSL__UNSIZED for []
+static inline uint32_t glsl__array_suffix(struct glsl__lexer* lx, struct glsl__tok* t)
+{
+    if (!glsl__punct(t, '[')) return 0;
+    uint32_t size = 0;
+    glsl__next(lx, t);
+    if (glsl__punct(t, ']')) {
+        glsl__next(lx, t);
+        return GLSL__UNSIZED;
+    }
+    if (!glsl__const_sum(lx, t, &size, 0) || !glsl__punct(t, ']') || size == 0 || size > 0xFFFF) {
+        // Not a constant this reflector can evaluate
+        lx->r->errors++;
+        if (!glsl__punct(t, ']')) glsl__skip_group(lx, t);
+        size = 1;
+    }
+    glsl__next(lx, t);
+    if (glsl__punct(t, '[')) {
+        // Arrays of arrays flatten into the outer count
+        size *= glsl__elements(glsl__array_suffix(lx, t));
+        if (size > 0xFFFF) size = 0xFFFF;
+    }
+    return size;
+}
+
+static inline uint32_t glsl__hash(const char* s)
+{
+    uint32_t h = 2166136261u;
+    for (; *s; s++) {
+        h ^= (uint8_t)*s;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static inline int glsl__streq(const char* a, const char* b)
+{
+    while (*a && *a == *b) {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+// Appends `name` (or part of it) to a flattened name buffer
+static inline uint32_t glsl__append(char* buf, uint32_t at, const char* s, uint32_t len)
+{
+    for (uint32_t i = 0; i < len && at < GLSL_REFLECT_NAME_MAX - 1; i++) buf[at++] = s[i];
+    buf[at] = '\0';
+    return at;
+}
+
+static inline uint32_t glsl__append_index(char* buf, uint32_t at, uint32_t index)
+{
+    char digits[12];
+    uint32_t n = 0;
+    do {
+        digits[n++] = (char)('0' + index % 10);
+        index /= 10;
+    } while (index);
+    at = glsl__append(buf, at, "[", 1);
+    while (n) at = glsl__append(buf, at, &digits[--n], 1);
+    return glsl__append(buf, at, "]", 1);
+}
+
+// Records one variable unless the same name and kind is already known
+// (declared again in another preprocessor branch). Block members are
+// deduplicated per block instead, see glsl__uniform_block.
+static inline void glsl__emit(struct glsl_reflection* r, const char* name, uint32_t kind,
+                              uint32_t type, uint32_t array_size, uint32_t row_major,
+                              uint32_t offset, const struct glsl__qualifiers* q, int32_t block)
+{
+    uint32_t bucket = glsl__hash(name) & (GLSL_REFLECT_NAME_BUCKETS - 1);
+    uint32_t probes = 0;
+    if (kind != GLSL_VAR_BLOCK_MEMBER) {
+        for (; r->names[bucket] && probes < GLSL_REFLECT_NAME_BUCKETS; probes++) {
+            const struct glsl_reflect_var* seen = &r->vars[r->names[bucket] - 1];
+            if (seen->kind == kind && glsl__streq(seen->name, name)) {
+                r->duplicates++;
+                return;
+            }
+            bucket = (bucket + 1) & (GLSL_REFLECT_NAME_BUCKETS - 1);
+        }
+    }
+    if (r->var_count >= r->var_capacity || r->var_count >= 0xFFFF) {
+        r->overflow++;
+        return;
+    }
+
+    const struct glsl__builtin* t = &glsl__builtins[type];
+    struct glsl_reflect_var* v = &r->vars[r->var_count];
+    uint32_t i = 0;
+    for (; name[i] && i < GLSL_REFLECT_NAME_MAX - 1; i++) v->name[i] = name[i];
+    v->name[i] = '\0';
+    v->kind = kind;
+    v->gl_type = t->gl_type;
+    v->components = t->components;
+    v->columns = t->columns;
+    v->array_size = array_size == GLSL__UNSIZED ? 0 : glsl__elements(array_size);
+    uint32_t total;
+    glsl__layout(r, type, array_size, row_major, 0, &v->align, &v->size, &total);
+    v->offset = offset;
+    v->location = q->location;
+    v->binding = q->binding;
+    v->block = block;
+    if (kind != GLSL_VAR_BLOCK_MEMBER && probes < GLSL_REFLECT_NAME_BUCKETS) {
+        r->names[bucket] = (uint16_t)(r->var_count + 1);
+    }
+    r->var_count++;
+}
+
+// Emits `name` of `type[array_size]` at `offset`, flattening structs
+static inline void glsl__emit_flat(struct glsl_reflection* r, char* name, uint32_t name_len,
+                                   uint32_t kind, uint32_t type, uint32_t array_size,
+                                   uint32_t row_major, uint32_t offset,
+                                   const struct glsl__qualifiers* q, int32_t block, uint32_t depth)
+{
+    if (r->emit_budget == 0) {
+        r->overflow++;
+        return;
+    }
+    r->emit_budget--;
+    if (type < GLSL__BUILTIN_COUNT) {
+        if (kind == GLSL_VAR_UNIFORM && glsl__builtins[type].base == GLSL__OPAQUE) {
+            kind = GLSL_VAR_SAMPLER;
+        }
+        glsl__emit(r, name, kind, type, array_size, row_major, offset, q, block);
+        return;
+    }
+    if (type < GLSL__STRUCT_TYPE || type - GLSL__STRUCT_TYPE >= r->struct_count ||
+        depth >= GLSL_REFLECT_MAX_DEPTH) {
+        return;
+    }
+
+    const struct glsl__struct* st = &r->structs[type - GLSL__STRUCT_TYPE];
+    uint32_t align, stride, total;
+    glsl__layout(r, type, array_size, 0, depth, &align, &stride, &total);
+    uint32_t elements = glsl__elements(array_size);
+    for (uint32_t e = 0; e < elements; e++) {
+        uint32_t at = name_len;
+        if (array_size) at = glsl__append_index(name, at, e);
+        at = glsl__append(name, at, ".", 1);
+        uint32_t cursor = 0;
+        for (uint32_t i = 0; i < st->count; i++) {
+            const struct glsl__member* m = &r->members[st->first + i];
+            uint32_t ma, me, mt;
+            glsl__layout(r, m->type, m->array_size, m->row_major, depth + 1, &ma, &me, &mt);
+            cursor = glsl__round(cursor, ma);
+            uint32_t end = glsl__append(name, at, m->name.s, m->name.len);
+            uint64_t at_offset = (uint64_t)offset + (uint64_t)e * stride + cursor;
+            if (at_offset > GLSL_REFLECT_SIZE_MAX) at_offset = GLSL_REFLECT_SIZE_MAX;
+            glsl__emit_flat(r, name, end, kind, m->type, m->array_size, m->row_major,
+                            (uint32_t)at_offset, q, block, depth + 1);
+            cursor += mt;
+        }
+        name[name_len] = '\0';
+    }
+}
+
+// Places a variable in a std140 block whose running size is *cursor
+static inline uint32_t glsl__place(struct glsl_reflection* r, uint32_t type, uint32_t array_size,
+                                   uint32_t row_major, uint32_t* cursor)
+{
+    uint32_t align, elem, total;
+    glsl__layout(r, type, array_size, row_major, 0, &align, &elem, &total);
+    uint32_t offset = glsl__round(*cursor, align);
+    *cursor = offset + total;
+    if (*cursor > GLSL_REFLECT_SIZE_MAX) *cursor = GLSL_REFLECT_SIZE_MAX;
+    return offset;
+}
+
+// struct Name { members };  Leaves `t` after the closing brace.
+static inline uint32_t glsl__struct_definition(struct glsl__lexer* lx, struct glsl__tok* t)
+{
+    struct glsl_reflection* r = lx->r;
+    struct glsl__span name = { 0, 0 };
+    glsl__next(lx, t);
+    if (t->kind == GLSL__IDENT) {
+        name.s = t->s;
+        name.len = t->len;
+        glsl__next(lx, t);
+    }
+    if (!glsl__punct(t, '{')) {
+        r->errors++;
+        return GLSL__NO_TYPE;
+    }
+
+    uint32_t first = r->member_count;
+    int keep = r->struct_count < GLSL_REFLECT_MAX_STRUCTS;
+    glsl__next(lx, t);
+    while (t->kind != GLSL__EOF && !glsl__punct(t, '}')) {
+        struct glsl__qualifiers q = { 0, -1, -1, 0, 0 };
+        glsl__qualifiers(lx, t, GLSL_STAGE_VERTEX, &q);
+        uint32_t type = glsl__find_type(r, t);
+        if (type == GLSL__NO_TYPE) {
+            r->errors++;
+            glsl__skip_statement(lx, t);
+            glsl__next(lx, t);
+            continue;
+        }
+        glsl__next(lx, t);
+        while (t->kind == GLSL__IDENT) {
+            struct glsl__tok member = *t;
+            glsl__next(lx, t);
+            uint32_t array_size = glsl__array_suffix(lx, t);
+            if (keep && r->member_count < GLSL_REFLECT_MAX_MEMBERS) {
+                struct glsl__member* m = &r->members[r->member_count++];
+                m->name.s = member.s;
+                m->name.len = member.len;
+                m->type = type;
+                m->array_size = array_size;
+                m->row_major = q.row_major;
+            } else {
+                keep = 0;
+            }
+            if (!glsl__punct(t, ',')) break;
+            glsl__next(lx, t);
+        }
+        glsl__skip_statement(lx, t);
+        glsl__next(lx, t);
+    }
+    glsl__next(lx, t);
+
+    if (!keep) {
+        r->member_count = first;
+        r->overflow++;
+        return GLSL__NO_TYPE;
+    }
+    struct glsl__struct* st = &r->structs[r->struct_count];
+    st->name = name;
+    st->first = first;
+    st->count = r->member_count - first;
+    return GLSL__STRUCT_TYPE + r->struct_count++;
+}
+
+// uniform Name { members } instance[N];  `t` is on the opening brace.
+static inline void glsl__uniform_block(struct glsl__lexer* lx, struct glsl__tok* t,
+                                       const struct glsl__tok* block_name,
+                                       const struct glsl__qualifiers* block_q)
+{
+    struct glsl_reflection* r = lx->r;
+    int32_t index = -1;
+    struct glsl_reflect_block* block = 0;
+    int seen = 0;
+    for (uint32_t i = 0; i < r->block_count && !seen; i++) {
+        uint32_t j = 0;
+        while (j < block_name->len && r->blocks[i].name[j] == block_name->s[j]) j++;
+        seen = j == block_name->len && r->blocks[i].name[j] == '\0';
+    }
+    if (seen) {
+        // Declared again in another preprocessor branch: parse, keep the first
+    } else if (r->block_count < r->block_capacity) {
+        index = (int32_t)r->block_count;
+        block = &r->blocks[r->block_count++];
+        uint32_t i = 0;
+        for (; i < block_name->len && i < GLSL_REFLECT_NAME_MAX - 1; i++) block->name[i] = block_name->s[i];
+        block->name[i] = '\0';
+        block->binding = block_q->binding;
+        block->first_var = r->var_count;
+        block->array_size = 1;
+    } else {
+        r->overflow++;
+    }
+
+    uint32_t cursor = 0;
+    char name[GLSL_REFLECT_NAME_MAX];
+    glsl__next(lx, t);
+    while (t->kind != GLSL__EOF && !glsl__punct(t, '}')) {
+        struct glsl__qualifiers q = { GLSL_VAR_BLOCK_MEMBER, -1, -1, block_q->row_major, 0 };
+        glsl__qualifiers(lx, t, GLSL_STAGE_VERTEX, &q);
+        q.kind = GLSL_VAR_BLOCK_MEMBER;
+        uint32_t type = glsl__find_type(r, t);
+        if (type == GLSL__NO_TYPE) {
+            r->errors++;
+            glsl__skip_statement(lx, t);
+            glsl__next(lx, t);
+            continue;
+        }
+        glsl__next(lx, t);
+        while (t->kind == GLSL__IDENT) {
+            uint32_t len = glsl__append(name, 0, t->s, t->len);
+            glsl__next(lx, t);
+            uint32_t array_size = glsl__array_suffix(lx, t);
+            uint32_t offset = glsl__place(r, type, array_size, q.row_major, &cursor);
+            if (block) {
+                glsl__emit_flat(r, name, len, GLSL_VAR_BLOCK_MEMBER, type, array_size,
+                                q.row_major, offset, &q, index, 0);
+            }
+            if (!glsl__punct(t, ',')) break;
+            glsl__next(lx, t);
+        }
+        glsl__skip_statement(lx, t);
+        glsl__next(lx, t);
+    }
+
+    glsl__next(lx, t);
+    if (t->kind == GLSL__IDENT) {
+        glsl__next(lx, t);
+        uint32_t array_size = glsl__array_suffix(lx, t);
+        if (block) {
+            // Members of a block with an instance name are "Block.member"
+            block->array_size = glsl__elements(array_size);
+            for (uint32_t i = block->first_var; i < r->var_count; i++) {
+                char* member = r->vars[i].name;
+                uint32_t len = 0;
+                while (member[len]) len++;
+                uint32_t at = glsl__append(name, 0, block_name->s, block_name->len);
+                at = glsl__append(name, at, ".", 1);
+                glsl__append(name, at, member, len);
+                for (len = 0; name[len]; len++) member[len] = name[len];
+                member[len] = '\0';
+            }
+        }
+    }
+    if (block) {
+        block->size = glsl__round(cursor, 16);
+        block->var_count = r->var_count - block->first_var;
+    }
+}
+
+// One global-scope declaration or function; `t` is on its first token
+static inline void glsl__external_declaration(struct glsl__lexer* lx, struct glsl__tok* t,
+                                              uint32_t stage, uint32_t* default_cursor)
+{
+    struct glsl_reflection* r = lx->r;
+    struct glsl__qualifiers q = { 0, -1, -1, 0, 0 };
+    if (!glsl__qualifiers(lx, t, stage, &q)) {
+        glsl__next(lx, t);
+        return;
+    }
+    if (glsl__punct(t, ';')) {
+        // Default-qualifier statement such as layout(std140) uniform;
+        glsl__next(lx, t);
+        return;
+    }
+
+    uint32_t type;
+    if (glsl__is(t, "struct")) {
+        type = glsl__struct_definition(lx, t);
+    } else {
+        struct glsl__tok type_tok = *t;
+        type = glsl__find_type(r, t);
+        glsl__next(lx, t);
+        if (glsl__punct(t, '{') && q.kind == GLSL_VAR_UNIFORM) {
+            glsl__uniform_block(lx, t, &type_tok, &q);
+            glsl__skip_statement(lx, t);
+            glsl__next(lx, t);
+            return;
+        }
+        if (glsl__punct(t, '{')) {
+            // in/out/buffer interface blocks are not reflected
+            glsl__skip_group(lx, t);
+            glsl__next(lx, t);
+            glsl__skip_statement(lx, t);
+            glsl__next(lx, t);
+            return;
+        }
+    }
+
+    char name[GLSL_REFLECT_NAME_MAX];
+    while (t->kind == GLSL__IDENT) {
+        struct glsl__tok decl = *t;
+        glsl__next(lx, t);
+        if (glsl__punct(t, '(')) {
+            // Function prototype or definition
+            r->functions++;
+            glsl__skip_group(lx, t);
+            glsl__next(lx, t);
+            if (glsl__punct(t, '{')) {
+                glsl__skip_group(lx, t);
+                glsl__next(lx, t);
+                return;
+            }
+            break;
+        }
+        uint32_t array_size = glsl__array_suffix(lx, t);
+
+        if (glsl__punct(t, '=')) {
+            glsl__next(lx, t);
+            struct glsl__tok init = *t;
+            uint32_t value;
+            if (q.is_const && init.kind == GLSL__NUMBER && type < GLSL__BUILTIN_COUNT &&
+                (glsl__builtins[type].base == GLSL__I || glsl__builtins[type].base == GLSL__U)) {
+                glsl__next(lx, t);
+                if ((glsl__punct(t, ';') || glsl__punct(t, ',')) &&
+                    glsl__parse_uint(init.s, init.len, &value)) {
+                    glsl__add_constant(r, decl.s, decl.len, value);
+                }
+            }
+            // Initializer: up to the next top-level ',' or ';'
+            while (t->kind != GLSL__EOF && !glsl__punct(t, ',') && !glsl__punct(t, ';')) {
+                if (glsl__punct(t, '(') || glsl__punct(t, '[') || glsl__punct(t, '{')) {
+                    glsl__skip_group(lx, t);
+                }
+                glsl__next(lx, t);
+            }
+        }
+
+        if (type == GLSL__NO_TYPE) {
+            if (q.kind && q.kind != 0xFF) r->errors++;
+        } else if (q.kind == GLSL_VAR_UNIFORM) {
+            uint32_t len = glsl__append(name, 0, decl.s, decl.len);
+            uint32_t cursor = *default_cursor, count = r->var_count, duplicates = r->duplicates;
+            uint32_t offset = glsl__place(r, type, array_size, 0, default_cursor);
+            glsl__emit_flat(r, name, len, GLSL_VAR_UNIFORM, type, array_size, 0, offset, &q, -1, 0);
+            if (r->var_count == count && r->duplicates != duplicates) {
+                // Already placed by an earlier #if branch
+                *default_cursor = cursor;
+            }
+        } else if (q.kind == GLSL_VAR_INPUT || q.kind == GLSL_VAR_OUTPUT) {
+            uint32_t len = glsl__append(name, 0, decl.s, decl.len);
+            glsl__emit_flat(r, name, len, q.kind, type, array_size, 0, 0, &q, -1, 0);
+        }
+
+        if (!glsl__punct(t, ',')) break;
+        glsl__next(lx, t);
+    }
+    glsl__skip_statement(lx, t);
+    glsl__next(lx, t);
+}
+
+// Reflects `source` (len bytes, need not be NUL-terminated) into `r`, whose
+// vars/blocks arrays and capacities the caller has set. Returns the number
+// of variables found; r->overflow and r->errors say what was missed.
+static inline uint32_t glsl_reflect(struct glsl_reflection* r, const char* source, size_t len,
+                                    uint32_t stage)
+{
+    struct glsl_reflect_var* vars = r->vars;
+    uint32_t var_capacity = r->var_capacity;
+    struct glsl_reflect_block* blocks = r->blocks;
+    uint32_t block_capacity = r->block_capacity;
+
+    char* bytes = (char*)r;
+    for (size_t i = 0; i < sizeof(*r); i++) bytes[i] = 0;
+    r->vars = vars;
+    r->var_capacity = var_capacity;
+    r->blocks = blocks;
+    r->block_capacity = block_capacity;
+    r->version = 110;
+    r->emit_budget = var_capacity * 4 + 1024;
+
+    struct glsl__lexer lx;
+    struct glsl__tok t;
+    lx.p = source;
+    lx.end = source + len;
+    lx.at_line_start = 1;
+    lx.r = r;
+
+    uint32_t default_cursor = 0;
+    glsl__next(&lx, &t);
+    while (t.kind != GLSL__EOF) {
+        if (t.kind == GLSL__PUNCT) {
+            // Stray token at global scope: resynchronise on it
+            if (t.s[0] == '{' || t.s[0] == '(' || t.s[0] == '[') glsl__skip_group(&lx, &t);
+            glsl__next(&lx, &t);
+            continue;
+        }
+        glsl__external_declaration(&lx, &t, stage, &default_cursor);
+    }
+    r->default_block_size = glsl__round(default_cursor, 16);
+    return r->var_count;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _GLSL_REFLECT_H */
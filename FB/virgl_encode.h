@@ -0,0 +1,405 @@
+/*
+ * virgl_encode.h - Header-only virgl command encoder
+ *
+ * One encoder for every place that packs virgl commands: the OpenGL
+ * translator, the VirtIO GPU probe and accelerator paths in the kext, the
+ * VirtGLGL userspace library, and the host-side test suite in
+ * tools/virgl_encode_test. C and C++, no allocation: commands are appended
+ * to a caller-owned dword buffer.
+ *
+ * Appends are all-or-nothing. A command that does not fit leaves the buffer
+ * untouched, sets `overflow` and makes the emitter return 0; the caller
+ * flushes and retries or gives up. Emitters return 1 on success.
+ *
+ * Layouts follow virglrenderer's vrend_decode.c: header is opcode in bits
+ * 0-7, object type in bits 8-15 and payload length in dwords in bits 16-31.
+ */
+
+#ifndef _VIRGL_ENCODE_H
+#define _VIRGL_ENCODE_H
+
+#include "virgl_protocol.h"
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct virgl_encoder {
+    uint32_t* buf;
+    uint32_t capacity;      // dwords
+    uint32_t len;           // dwords written
+    uint32_t overflow;      // commands refused for lack of room
+};
+
+// SET_VERTEX_BUFFERS entry
+struct virgl_vertex_buffer {
+    uint32_t stride;
+    uint32_t offset;
+    uint32_t handle;
+};
+
+// DRAW_VBO parameters; zero-initialise and set what the draw needs
+struct virgl_draw_info {
+    uint32_t start;
+    uint32_t count;
+    uint32_t mode;              // PIPE_PRIM_*
+    uint32_t indexed;
+    uint32_t instance_count;    // 0 is sent as 1
+    int32_t index_bias;
+    uint32_t start_instance;
+    uint32_t primitive_restart;
+    uint32_t restart_index;
+    uint32_t min_index;
+    uint32_t max_index;
+};
+
+// Total dwords (header included) of the variable-length commands
+#define VIRGL_ENC_INLINE_WRITE_DWORDS(bytes) \
+    (VIRGL_INLINE_WRITE_HDR_SIZE + ((bytes) + 3) / 4)
+#define VIRGL_ENC_VERTEX_BUFFERS_DWORDS(num) (1 + (num) * VIRGL_VERTEX_BUFFER_SIZE)
+#define VIRGL_ENC_FRAMEBUFFER_DWORDS(nr_cbufs) (1 + VIRGL_SET_FRAMEBUFFER_STATE_SIZE_VAR(nr_cbufs))
+#define VIRGL_ENC_SHADER_DWORDS(text_len) (1 + VIRGL_CREATE_SHADER_HDR_SIZE + ((text_len) + 4) / 4)
+#define VIRGL_ENC_CONSTANT_BUFFER_DWORDS(num) (1 + VIRGL_SET_CONSTANT_BUFFER_SIZE(num))
+
+static inline void virgl_encoder_init(struct virgl_encoder* enc, uint32_t* buf, uint32_t capacity)
+{
+    enc->buf = buf;
+    enc->capacity = capacity;
+    enc->len = 0;
+    enc->overflow = 0;
+}
+
+static inline void virgl_encoder_reset(struct virgl_encoder* enc)
+{
+    enc->len = 0;
+}
+
+static inline uint32_t virgl_encoder_space(const struct virgl_encoder* enc)
+{
+    return enc->capacity - enc->len;
+}
+
+// Claim `dwords` dwords at the end of the buffer, or NULL if they don't fit
+static inline uint32_t* virgl_encoder_reserve(struct virgl_encoder* enc, uint32_t dwords)
+{
+    if (dwords > enc->capacity - enc->len) {
+        enc->overflow++;
+        return NULL;
+    }
+    uint32_t* p = enc->buf + enc->len;
+    enc->len += dwords;
+    return p;
+}
+
+static inline int virgl_encode_nop(struct virgl_encoder* enc)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, 1);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_NOP, 0, 0);
+    return 1;
+}
+
+static inline int virgl_encode_clear(struct virgl_encoder* enc, uint32_t buffers,
+                                     const float rgba[4], double depth, uint32_t stencil)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, 1 + VIRGL_OBJ_CLEAR_SIZE);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_CLEAR, 0, VIRGL_OBJ_CLEAR_SIZE);
+    p[VIRGL_OBJ_CLEAR_BUFFERS] = buffers;
+    p[VIRGL_OBJ_CLEAR_COLOR_0] = virgl_pack_float(rgba[0]);
+    p[VIRGL_OBJ_CLEAR_COLOR_1] = virgl_pack_float(rgba[1]);
+    p[VIRGL_OBJ_CLEAR_COLOR_2] = virgl_pack_float(rgba[2]);
+    p[VIRGL_OBJ_CLEAR_COLOR_3] = virgl_pack_float(rgba[3]);
+    virgl_pack_double(depth, &p[VIRGL_OBJ_CLEAR_DEPTH_0], &p[VIRGL_OBJ_CLEAR_DEPTH_1]);
+    p[VIRGL_OBJ_CLEAR_STENCIL] = stencil;
+    return 1;
+}
+
+// One viewport at `start_slot`
+static inline int virgl_encode_set_viewport(struct virgl_encoder* enc, uint32_t start_slot,
+                                            const float scale[3], const float translate[3])
+{
+    uint32_t* p = virgl_encoder_reserve(enc, VIRGL_VIEWPORT_SIZE(1));
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_SET_VIEWPORT_STATE, 0, VIRGL_VIEWPORT_SIZE(1) - 1);
+    p[1] = start_slot;
+    for (int i = 0; i < 3; i++) {
+        p[2 + i] = virgl_pack_float(scale[i]);
+        p[5 + i] = virgl_pack_float(translate[i]);
+    }
+    return 1;
+}
+
+// The host rejects a length other than nr_cbufs + 2, so only the bound
+// color buffers are sent
+static inline int virgl_encode_set_framebuffer_state(struct virgl_encoder* enc, uint32_t nr_cbufs,
+                                                     const uint32_t* cbufs, uint32_t zsurf)
+{
+    if (nr_cbufs > VIRGL_MAX_COLOR_BUFS) {
+        enc->overflow++;
+        return 0;
+    }
+    uint32_t* p = virgl_encoder_reserve(enc, VIRGL_ENC_FRAMEBUFFER_DWORDS(nr_cbufs));
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_SET_FRAMEBUFFER_STATE, 0, VIRGL_SET_FRAMEBUFFER_STATE_SIZE_VAR(nr_cbufs));
+    p[VIRGL_SET_FRAMEBUFFER_STATE_NR_CBUFS] = nr_cbufs;
+    p[VIRGL_SET_FRAMEBUFFER_STATE_NR_ZSURF_HANDLE] = zsurf;
+    for (uint32_t i = 0; i < nr_cbufs; i++) {
+        p[VIRGL_SET_FRAMEBUFFER_STATE_CBUF_HANDLE(i)] = cbufs[i];
+    }
+    return 1;
+}
+
+// CREATE_OBJECT with a pre-packed state payload (blend, DSA, rasterizer,
+// sampler state, vertex elements)
+static inline int virgl_encode_create_object(struct virgl_encoder* enc, uint32_t obj_type,
+                                             uint32_t handle, const uint32_t* payload, uint32_t dwords)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, 2 + dwords);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_CREATE_OBJECT, obj_type, 1 + dwords);
+    p[1] = handle;
+    if (dwords) {
+        memcpy(&p[2], payload, dwords * sizeof(uint32_t));
+    }
+    return 1;
+}
+
+static inline int virgl_encode_create_surface(struct virgl_encoder* enc, uint32_t handle,
+                                              uint32_t res_handle, uint32_t format,
+                                              uint32_t level, uint32_t layers)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, 1 + VIRGL_OBJ_SURFACE_SIZE);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_CREATE_OBJECT, VIRGL_OBJECT_SURFACE, VIRGL_OBJ_SURFACE_SIZE);
+    p[VIRGL_OBJ_SURFACE_HANDLE] = handle;
+    p[VIRGL_OBJ_SURFACE_RES_HANDLE] = res_handle;
+    p[VIRGL_OBJ_SURFACE_FORMAT] = format;
+    p[VIRGL_OBJ_SURFACE_TEXTURE_LEVEL] = level;
+    p[VIRGL_OBJ_SURFACE_TEXTURE_LAYERS] = layers;
+    return 1;
+}
+
+static inline int virgl_encode_bind_object(struct virgl_encoder* enc, uint32_t obj_type, uint32_t handle)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, 2);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_BIND_OBJECT, obj_type, 1);
+    p[VIRGL_OBJ_BIND_HANDLE] = handle;
+    return 1;
+}
+
+static inline int virgl_encode_destroy_object(struct virgl_encoder* enc, uint32_t obj_type, uint32_t handle)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, 2);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_DESTROY_OBJECT, obj_type, 1);
+    p[VIRGL_OBJ_DESTROY_HANDLE] = handle;
+    return 1;
+}
+
+static inline int virgl_encode_bind_sampler_states(struct virgl_encoder* enc, uint32_t shader_type,
+                                                   uint32_t start_slot, uint32_t num,
+                                                   const uint32_t* handles)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, 1 + VIRGL_BIND_SAMPLER_STATES(num));
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_BIND_SAMPLER_STATES, 0, VIRGL_BIND_SAMPLER_STATES(num));
+    p[1] = shader_type;
+    p[2] = start_slot;
+    if (num) {
+        memcpy(&p[3], handles, num * sizeof(uint32_t));
+    }
+    return 1;
+}
+
+static inline int virgl_encode_bind_shader(struct virgl_encoder* enc, uint32_t handle, uint32_t shader_type)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, VIRGL_BIND_SHADER_SIZE);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_BIND_SHADER, 0, VIRGL_BIND_SHADER_SIZE - 1);
+    p[1] = handle;
+    p[2] = shader_type;
+    return 1;
+}
+
+// CREATE_OBJECT of a TGSI shader sent in one chunk. `text_len` excludes the
+// NUL, which is appended along with zero padding to the next dword.
+// `num_tokens` only needs to be an upper bound; the text length is one.
+static inline int virgl_encode_create_shader(struct virgl_encoder* enc, uint32_t handle,
+                                             uint32_t shader_type, const char* text,
+                                             uint32_t text_len, uint32_t num_tokens)
+{
+    uint32_t total = VIRGL_ENC_SHADER_DWORDS(text_len);
+    if (total - 1 > 0xFFFF) {
+        enc->overflow++;
+        return 0;
+    }
+    uint32_t* p = virgl_encoder_reserve(enc, total);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_CREATE_OBJECT, VIRGL_OBJECT_SHADER, total - 1);
+    p[VIRGL_OBJ_SHADER_HANDLE] = handle;
+    p[VIRGL_OBJ_SHADER_TYPE] = shader_type;
+    p[VIRGL_OBJ_SHADER_OFFSET] = text_len + 1;
+    p[VIRGL_OBJ_SHADER_NUM_TOKENS] = num_tokens;
+    p[VIRGL_OBJ_SHADER_SO_NUM_OUTPUTS] = 0;
+    p[total - 1] = 0;
+    memcpy(&p[1 + VIRGL_CREATE_SHADER_HDR_SIZE], text, text_len);
+    return 1;
+}
+
+static inline int virgl_encode_set_vertex_buffers(struct virgl_encoder* enc, uint32_t num,
+                                                  const struct virgl_vertex_buffer* buffers)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, VIRGL_ENC_VERTEX_BUFFERS_DWORDS(num));
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_SET_VERTEX_BUFFERS, 0, num * VIRGL_VERTEX_BUFFER_SIZE);
+    for (uint32_t i = 0; i < num; i++) {
+        p[1 + i * VIRGL_VERTEX_BUFFER_SIZE + 0] = buffers[i].stride;
+        p[1 + i * VIRGL_VERTEX_BUFFER_SIZE + 1] = buffers[i].offset;
+        p[1 + i * VIRGL_VERTEX_BUFFER_SIZE + 2] = buffers[i].handle;
+    }
+    return 1;
+}
+
+// `handle` 0 unbinds the index buffer
+static inline int virgl_encode_set_index_buffer(struct virgl_encoder* enc, uint32_t handle,
+                                                uint32_t index_size, uint32_t offset)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, 1 + VIRGL_SET_INDEX_BUFFER_SIZE);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_SET_INDEX_BUFFER, 0, VIRGL_SET_INDEX_BUFFER_SIZE);
+    p[1] = handle;
+    p[2] = index_size;
+    p[3] = offset;
+    return 1;
+}
+
+static inline int virgl_encode_draw_vbo(struct virgl_encoder* enc, const struct virgl_draw_info* info)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, VIRGL_DRAW_VBO_SIZE);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_DRAW_VBO, 0, VIRGL_DRAW_VBO_SIZE - 1);
+    p[1] = info->start;
+    p[2] = info->count;
+    p[3] = info->mode;
+    p[4] = info->indexed;
+    p[5] = info->instance_count ? info->instance_count : 1;
+    p[6] = (uint32_t)info->index_bias;
+    p[7] = info->start_instance;
+    p[8] = info->primitive_restart;
+    p[9] = info->restart_index;
+    p[10] = info->min_index;
+    p[11] = info->max_index;
+    return 1;
+}
+
+static inline int virgl_encode_set_uniform_buffer(struct virgl_encoder* enc, uint32_t shader_type,
+                                                  uint32_t index, uint32_t offset, uint32_t length,
+                                                  uint32_t handle)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, 1 + VIRGL_SET_UNIFORM_BUFFER_SIZE);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_SET_UNIFORM_BUFFER, 0, VIRGL_SET_UNIFORM_BUFFER_SIZE);
+    p[1] = shader_type;
+    p[2] = index;
+    p[3] = offset;
+    p[4] = length;
+    p[5] = handle;
+    return 1;
+}
+
+// User constants for constant buffer 0 of `shader_type`, `num` dwords
+static inline int virgl_encode_set_constant_buffer(struct virgl_encoder* enc, uint32_t shader_type,
+                                                   const float* constants, uint32_t num)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, VIRGL_ENC_CONSTANT_BUFFER_DWORDS(num));
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_SET_CONSTANT_BUFFER, 0, VIRGL_SET_CONSTANT_BUFFER_SIZE(num));
+    p[1] = shader_type;
+    p[2] = 0;
+    for (uint32_t i = 0; i < num; i++) {
+        p[3 + i] = virgl_pack_float(constants[i]);
+    }
+    return 1;
+}
+
+// RESOURCE_INLINE_WRITE of `bytes` bytes at byte `offset` of a buffer
+// resource. Returns the payload area for the caller to fill (its last
+// dword is pre-zeroed so padding is deterministic), or NULL.
+static inline uint32_t* virgl_encode_inline_write_buffer(struct virgl_encoder* enc, uint32_t handle,
+                                                         uint32_t offset, uint32_t bytes)
+{
+    uint32_t total = VIRGL_ENC_INLINE_WRITE_DWORDS(bytes);
+    uint32_t* p = virgl_encoder_reserve(enc, total);
+    if (!p) return NULL;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_RESOURCE_INLINE_WRITE, 0, total - 1);
+    p[1] = handle;
+    p[2] = 0;           // level
+    p[3] = 0;           // usage
+    p[4] = 0;           // stride
+    p[5] = 0;           // layer_stride
+    p[6] = offset;      // x
+    p[7] = 0;           // y
+    p[8] = 0;           // z
+    p[9] = bytes;       // width
+    p[10] = 1;          // height
+    p[11] = 1;          // depth
+    if (total > VIRGL_INLINE_WRITE_HDR_SIZE) {
+        p[total - 1] = 0;
+    }
+    return p + VIRGL_INLINE_WRITE_HDR_SIZE;
+}
+
+static inline int virgl_encode_inline_write(struct virgl_encoder* enc, uint32_t handle,
+                                            uint32_t offset, const void* data, uint32_t bytes)
+{
+    uint32_t* payload = virgl_encode_inline_write_buffer(enc, handle, offset, bytes);
+    if (!payload) return 0;
+    memcpy(payload, data, bytes);
+    return 1;
+}
+
+// One box of a blit: resource, mip level, view format and region
+struct virgl_blit_box {
+    uint32_t res_handle;
+    uint32_t level;
+    uint32_t format;
+    int32_t  x, y, z;
+    uint32_t width, height, depth;
+};
+
+// Scaled, format-converting copy between two resources (pipe->blit),
+// unscissored. `mask` is PIPE_MASK_*, `filter` PIPE_TEX_FILTER_*.
+static inline int virgl_encode_blit(struct virgl_encoder* enc, const struct virgl_blit_box* dst,
+                                    const struct virgl_blit_box* src, uint32_t mask, uint32_t filter)
+{
+    uint32_t* p = virgl_encoder_reserve(enc, 1 + VIRGL_CMD_BLIT_SIZE);
+    if (!p) return 0;
+    p[0] = VIRGL_CMD0(VIRGL_CCMD_BLIT, 0, VIRGL_CMD_BLIT_SIZE);
+    p[VIRGL_CMD_BLIT_S0] = VIRGL_CMD_BLIT_S0_MASK(mask) | VIRGL_CMD_BLIT_S0_FILTER(filter);
+    p[VIRGL_CMD_BLIT_SCISSOR_MINX_MINY] = 0;
+    p[VIRGL_CMD_BLIT_SCISSOR_MAXX_MAXY] = 0;
+    const struct virgl_blit_box* boxes[2] = { dst, src };
+    const uint32_t base[2] = { VIRGL_CMD_BLIT_DST_RES_HANDLE, VIRGL_CMD_BLIT_SRC_RES_HANDLE };
+    for (int i = 0; i < 2; i++) {
+        uint32_t* q = p + base[i];
+        q[0] = boxes[i]->res_handle;
+        q[1] = boxes[i]->level;
+        q[2] = boxes[i]->format;
+        q[3] = (uint32_t)boxes[i]->x;
+        q[4] = (uint32_t)boxes[i]->y;
+        q[5] = (uint32_t)boxes[i]->z;
+        q[6] = boxes[i]->width;
+        q[7] = boxes[i]->height;
+        q[8] = boxes[i]->depth;
+    }
+    return 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VIRGL_ENCODE_H */
@@ -0,0 +1,597 @@
+/*
+ * virgl_ffp.h - Fixed-function pipeline as specialised TGSI shaders
+ *
+ * virgl only runs shaders, so VMOpenGLTranslator emulates the GL 1.x
+ * pipeline with them. Instead of one uber-shader that branches on every
+ * enable, each distinct fixed-function state gets its own minimal program:
+ * disabled texture units, lights, fog and alpha test are simply not
+ * emitted, so the common unlit, untextured draw is a four-DP4 vertex shader
+ * and a single-MOV fragment shader. The state is condensed into an 8-byte
+ * key the translator compares and caches programs by.
+ *
+ * C and C++, no allocation: text is written to a caller-owned buffer, and
+ * the generators return its length (excluding the NUL), or 0 if it did not
+ * fit. tools/virgl_ffp_test runs every generated program through a small
+ * TGSI interpreter against a reference implementation of the GL equations.
+ *
+ * Supported subset: MODULATE texturing with one texture coordinate set
+ * shared by all units, per-vertex lighting with directional and
+ * unattenuated point lights (no spot lights, infinite viewer, one-sided),
+ * GL_COLOR_MATERIAL for ambient and diffuse, LINEAR/EXP/EXP2 fog on eye
+ * depth, and the eight alpha-test functions.
+ */
+
+#ifndef _VIRGL_FFP_H
+#define _VIRGL_FFP_H
+
+#include "virgl_protocol.h"
+#include <stdarg.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VIRGL_FFP_MAX_TEXTURE_UNITS 8
+#define VIRGL_FFP_MAX_LIGHTS 8
+
+// Largest program text any key produces, NUL included
+#define VIRGL_FFP_TEXT_MAX 8192
+
+// virgl_ffp_key.flags
+#define VIRGL_FFP_LIGHTING          (1u << 0)
+#define VIRGL_FFP_COLOR_MATERIAL    (1u << 1)
+
+enum virgl_ffp_fog {
+    VIRGL_FFP_FOG_NONE,
+    VIRGL_FFP_FOG_LINEAR,
+    VIRGL_FFP_FOG_EXP,
+    VIRGL_FFP_FOG_EXP2,
+};
+
+// Everything a program is specialised on. Zero-initialise before filling
+// so padding compares equal; virgl_ffp_key_bits() packs it for hashing.
+struct virgl_ffp_key {
+    uint8_t texture_units;      // bit per enabled 2D unit, modulated in order
+    uint8_t lights;             // bit per enabled light, only with LIGHTING
+    uint8_t point_lights;       // subset of `lights` positioned with w != 0
+    uint8_t flags;              // VIRGL_FFP_*
+    uint8_t alpha_func;         // PIPE_FUNC_*; PIPE_FUNC_ALWAYS means no test
+    uint8_t fog_mode;           // VIRGL_FFP_FOG_*
+    uint8_t reserved[2];
+};
+
+// Vertex inputs, matching the translator's vertex elements
+#define VIRGL_FFP_IN_POSITION 0
+#define VIRGL_FFP_IN_COLOR 1
+#define VIRGL_FFP_IN_TEXCOORD 2
+#define VIRGL_FFP_IN_NORMAL 3
+
+// Vertex shader constants, in vec4 slots. Matrices are stored as rows so
+// each output component is one DP4.
+#define VIRGL_FFP_VS_MVP 0              // 4 rows: projection * modelview
+#define VIRGL_FFP_VS_MODELVIEW 4        // 4 rows
+#define VIRGL_FFP_VS_NORMAL_MATRIX 8    // 3 rows, any positive scale
+#define VIRGL_FFP_VS_SCENE_COLOR 11     // emission (+ ambient * material)
+#define VIRGL_FFP_VS_MATERIAL 12        // rgb: light model ambient, w: shininess
+#define VIRGL_FFP_VS_FOG 13             // see virgl_ffp_fog_params()
+#define VIRGL_FFP_VS_LIGHT(i) (14 + 4 * (i))
+#define VIRGL_FFP_VS_LIGHT_POSITION 0   // eye space; w 0 normalised direction
+#define VIRGL_FFP_VS_LIGHT_AMBIENT 1    // premultiplied by the material unless
+#define VIRGL_FFP_VS_LIGHT_DIFFUSE 2    // COLOR_MATERIAL is set
+#define VIRGL_FFP_VS_LIGHT_SPECULAR 3
+#define VIRGL_FFP_VS_MAX_CONSTANTS VIRGL_FFP_VS_LIGHT(VIRGL_FFP_MAX_LIGHTS)
+
+// Fragment shader constants
+#define VIRGL_FFP_FS_ALPHA_REF 0        // x: reference value
+#define VIRGL_FFP_FS_FOG_COLOR 1
+#define VIRGL_FFP_FS_MAX_CONSTANTS 2
+
+struct virgl_ffp_light {
+    float position[4];          // eye space, transformed when it was set
+    float ambient[4];
+    float diffuse[4];
+    float specular[4];
+};
+
+// The GL 1.x state the programs read through constants (matrices are
+// passed separately, they live on the translator's matrix stacks)
+struct virgl_ffp_state {
+    struct virgl_ffp_light lights[VIRGL_FFP_MAX_LIGHTS];
+    float material_ambient[4];
+    float material_diffuse[4];
+    float material_specular[4];
+    float material_emission[4];
+    float material_shininess;
+    float light_model_ambient[4];
+    float fog_color[4];
+    float fog_density;
+    float fog_start;
+    float fog_end;
+    float alpha_ref;
+};
+
+static inline uint64_t virgl_ffp_key_bits(const struct virgl_ffp_key* key)
+{
+    uint64_t bits;
+    memcpy(&bits, key, sizeof(bits));
+    return bits;
+}
+
+static inline int virgl_ffp_lit(const struct virgl_ffp_key* key)
+{
+    return (key->flags & VIRGL_FFP_LIGHTING) != 0;
+}
+
+// vec4 constants the vertex shader reads; upload at least this many
+static inline uint32_t virgl_ffp_vs_constants(const struct virgl_ffp_key* key)
+{
+    if (virgl_ffp_lit(key)) {
+        uint32_t n = VIRGL_FFP_VS_LIGHT(0);
+        for (uint32_t i = 0; i < VIRGL_FFP_MAX_LIGHTS; i++) {
+            if (key->lights & (1u << i)) {
+                n = VIRGL_FFP_VS_LIGHT(i + 1);
+            }
+        }
+        return n;
+    }
+    return key->fog_mode != VIRGL_FFP_FOG_NONE ? VIRGL_FFP_VS_FOG + 1 : VIRGL_FFP_VS_MODELVIEW;
+}
+
+static inline uint32_t virgl_ffp_fs_constants(const struct virgl_ffp_key* key)
+{
+    if (key->fog_mode != VIRGL_FFP_FOG_NONE) {
+        return VIRGL_FFP_FS_FOG_COLOR + 1;
+    }
+    return key->alpha_func != PIPE_FUNC_ALWAYS ? VIRGL_FFP_FS_ALPHA_REF + 1 : 0;
+}
+
+// VIRGL_FFP_VS_FOG for the GL fog parameters. The shader sees eye z, which
+// is negative in front of the viewer, so the GL distance c is -z:
+//   x, y: LINEAR  f = z * x + y       = (end - c) / (end - start)
+//   z:    EXP     f = 2^(z * z')      = e^(-density * c)
+//   w:    EXP2    f = 2^(-(z * w)^2)  = e^(-(density * c)^2)
+static inline void virgl_ffp_fog_params(float density, float start, float end, float out[4])
+{
+    const float log2e = 1.44269504f;
+    const float sqrt_log2e = 1.20112241f;
+    float range = end - start;
+    float scale = range != 0.0f ? 1.0f / range : 0.0f;
+
+    out[0] = scale;
+    out[1] = end * scale;
+    out[2] = density * log2e;
+    out[3] = density * sqrt_log2e;
+}
+
+static inline void virgl_ffp_set4(float dst[4], float x, float y, float z, float w)
+{
+    dst[0] = x;
+    dst[1] = y;
+    dst[2] = z;
+    dst[3] = w;
+}
+
+// 1/sqrt(x) for x > 0 without libm, which the kext cannot link; three
+// Newton steps from the bit-trick estimate reach float precision
+static inline float virgl_ffp_rsqrt(float x)
+{
+    uint32_t bits;
+    float y;
+    memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5f3759dfu - (bits >> 1);
+    memcpy(&y, &bits, sizeof(y));
+    for (int i = 0; i < 3; i++) {
+        y = y * (1.5f - 0.5f * x * y * y);
+    }
+    return y;
+}
+
+// GL's initial values for everything in virgl_ffp_state
+static inline void virgl_ffp_state_init(struct virgl_ffp_state* state)
+{
+    memset(state, 0, sizeof(*state));
+    for (uint32_t i = 0; i < VIRGL_FFP_MAX_LIGHTS; i++) {
+        struct virgl_ffp_light* light = &state->lights[i];
+        float on = i == 0 ? 1.0f : 0.0f;
+        virgl_ffp_set4(light->position, 0.0f, 0.0f, 1.0f, 0.0f);
+        virgl_ffp_set4(light->ambient, 0.0f, 0.0f, 0.0f, 1.0f);
+        virgl_ffp_set4(light->diffuse, on, on, on, 1.0f);
+        virgl_ffp_set4(light->specular, on, on, on, 1.0f);
+    }
+    virgl_ffp_set4(state->material_ambient, 0.2f, 0.2f, 0.2f, 1.0f);
+    virgl_ffp_set4(state->material_diffuse, 0.8f, 0.8f, 0.8f, 1.0f);
+    virgl_ffp_set4(state->material_specular, 0.0f, 0.0f, 0.0f, 1.0f);
+    virgl_ffp_set4(state->material_emission, 0.0f, 0.0f, 0.0f, 1.0f);
+    virgl_ffp_set4(state->light_model_ambient, 0.2f, 0.2f, 0.2f, 1.0f);
+    state->fog_density = 1.0f;
+    state->fog_end = 1.0f;
+}
+
+// Fills the first virgl_ffp_vs_constants(key) vec4 slots of `out` from
+// column-major GL matrices. Returns the number of slots written.
+static inline uint32_t virgl_ffp_pack_vs_constants(const struct virgl_ffp_key* key,
+                                                   const struct virgl_ffp_state* state,
+                                                   const float modelview[16],
+                                                   const float projection[16], float* out)
+{
+    const uint32_t count = virgl_ffp_vs_constants(key);
+    const int cm = (key->flags & VIRGL_FFP_COLOR_MATERIAL) != 0;
+
+    memset(out, 0, count * 4 * sizeof(float));
+    for (uint32_t r = 0; r < 4; r++) {
+        for (uint32_t c = 0; c < 4; c++) {
+            float sum = 0.0f;
+            for (uint32_t k = 0; k < 4; k++) {
+                sum += projection[k * 4 + r] * modelview[c * 4 + k];
+            }
+            out[(VIRGL_FFP_VS_MVP + r) * 4 + c] = sum;
+        }
+    }
+    if (count <= VIRGL_FFP_VS_MODELVIEW) {
+        return count;
+    }
+    for (uint32_t r = 0; r < 4; r++) {
+        for (uint32_t c = 0; c < 4; c++) {
+            out[(VIRGL_FFP_VS_MODELVIEW + r) * 4 + c] = modelview[c * 4 + r];
+        }
+    }
+
+    // Normal matrix: the cofactors of the upper 3x3 are its inverse
+    // transpose scaled by the determinant; the shader renormalises, so
+    // only the sign of the determinant has to be applied
+#define VIRGL_FFP_MV(r, c) modelview[(c) * 4 + (r)]
+    float cof[3][3];
+    for (uint32_t r = 0; r < 3; r++) {
+        for (uint32_t c = 0; c < 3; c++) {
+            uint32_t r1 = (r + 1) % 3, r2 = (r + 2) % 3;
+            uint32_t c1 = (c + 1) % 3, c2 = (c + 2) % 3;
+            cof[r][c] = VIRGL_FFP_MV(r1, c1) * VIRGL_FFP_MV(r2, c2) -
+                        VIRGL_FFP_MV(r1, c2) * VIRGL_FFP_MV(r2, c1);
+        }
+    }
+    float det = VIRGL_FFP_MV(0, 0) * cof[0][0] + VIRGL_FFP_MV(0, 1) * cof[0][1] +
+                VIRGL_FFP_MV(0, 2) * cof[0][2];
+#undef VIRGL_FFP_MV
+    float sign = det < 0.0f ? -1.0f : 1.0f;
+    for (uint32_t r = 0; r < 3; r++) {
+        for (uint32_t c = 0; c < 3; c++) {
+            out[(VIRGL_FFP_VS_NORMAL_MATRIX + r) * 4 + c] = cof[r][c] * sign;
+        }
+    }
+
+    float* scene = &out[VIRGL_FFP_VS_SCENE_COLOR * 4];
+    for (uint32_t c = 0; c < 3; c++) {
+        scene[c] = state->material_emission[c];
+        if (!cm) {
+            scene[c] += state->light_model_ambient[c] * state->material_ambient[c];
+        }
+    }
+    scene[3] = state->material_diffuse[3];
+    float* material = &out[VIRGL_FFP_VS_MATERIAL * 4];
+    virgl_ffp_set4(material, state->light_model_ambient[0], state->light_model_ambient[1],
+                   state->light_model_ambient[2], state->material_shininess);
+    virgl_ffp_fog_params(state->fog_density, state->fog_start, state->fog_end,
+                         &out[VIRGL_FFP_VS_FOG * 4]);
+
+    for (uint32_t i = 0; i < VIRGL_FFP_MAX_LIGHTS && VIRGL_FFP_VS_LIGHT(i) < count; i++) {
+        const struct virgl_ffp_light* light = &state->lights[i];
+        float* slot = &out[VIRGL_FFP_VS_LIGHT(i) * 4];
+        float* position = slot + VIRGL_FFP_VS_LIGHT_POSITION * 4;
+        float w = light->position[3];
+        if (w != 0.0f) {
+            virgl_ffp_set4(position, light->position[0] / w, light->position[1] / w,
+                           light->position[2] / w, 1.0f);
+        } else {
+            float len2 = light->position[0] * light->position[0] +
+                         light->position[1] * light->position[1] +
+                         light->position[2] * light->position[2];
+            float inv = len2 > 0.0f ? virgl_ffp_rsqrt(len2) : 0.0f;
+            virgl_ffp_set4(position, light->position[0] * inv, light->position[1] * inv,
+                           light->position[2] * inv, 0.0f);
+        }
+        for (uint32_t c = 0; c < 4; c++) {
+            slot[VIRGL_FFP_VS_LIGHT_AMBIENT * 4 + c] =
+                light->ambient[c] * (cm ? 1.0f : state->material_ambient[c]);
+            slot[VIRGL_FFP_VS_LIGHT_DIFFUSE * 4 + c] =
+                light->diffuse[c] * (cm ? 1.0f : state->material_diffuse[c]);
+            slot[VIRGL_FFP_VS_LIGHT_SPECULAR * 4 + c] =
+                light->specular[c] * state->material_specular[c];
+        }
+    }
+    return count;
+}
+
+// Fills the first virgl_ffp_fs_constants(key) vec4 slots of `out`
+static inline uint32_t virgl_ffp_pack_fs_constants(const struct virgl_ffp_key* key,
+                                                   const struct virgl_ffp_state* state, float* out)
+{
+    const uint32_t count = virgl_ffp_fs_constants(key);
+    if (count > VIRGL_FFP_FS_ALPHA_REF) {
+        virgl_ffp_set4(&out[VIRGL_FFP_FS_ALPHA_REF * 4], state->alpha_ref, 0.0f, 0.0f, 0.0f);
+    }
+    if (count > VIRGL_FFP_FS_FOG_COLOR) {
+        memcpy(&out[VIRGL_FFP_FS_FOG_COLOR * 4], state->fog_color, 4 * sizeof(float));
+    }
+    return count;
+}
+
+// Text writer: appends printf-style with %u and %s only, remembering overflow
+struct virgl_ffp_writer {
+    char* buf;
+    uint32_t capacity;
+    uint32_t len;
+    int overflow;
+};
+
+static inline void virgl_ffp_putc(struct virgl_ffp_writer* w, char c)
+{
+    if (w->len + 1 >= w->capacity) {
+        w->overflow = 1;
+        return;
+    }
+    w->buf[w->len++] = c;
+}
+
+static inline void virgl_ffp_emit(struct virgl_ffp_writer* w, const char* fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    for (const char* f = fmt; *f; f++) {
+        if (f[0] != '%' || (f[1] != 'u' && f[1] != 's')) {
+            virgl_ffp_putc(w, *f);
+            continue;
+        }
+        f++;
+        if (*f == 's') {
+            for (const char* s = va_arg(ap, const char*); *s; s++) {
+                virgl_ffp_putc(w, *s);
+            }
+        } else {
+            char digits[10];
+            int n = 0;
+            unsigned v = va_arg(ap, unsigned);
+            do {
+                digits[n++] = (char)('0' + v % 10);
+                v /= 10;
+            } while (v);
+            while (n) {
+                virgl_ffp_putc(w, digits[--n]);
+            }
+        }
+    }
+    va_end(ap);
+}
+
+static inline uint32_t virgl_ffp_finish(struct virgl_ffp_writer* w)
+{
+    if (w->capacity == 0 || w->overflow) {
+        return 0;
+    }
+    w->buf[w->len] = '\0';
+    return w->len;
+}
+
+static inline uint32_t virgl_ffp_vertex_shader(const struct virgl_ffp_key* key,
+                                               char* buf, uint32_t capacity)
+{
+    struct virgl_ffp_writer w = { buf, capacity, 0, 0 };
+    const int lit = virgl_ffp_lit(key);
+    const int textured = key->texture_units != 0;
+    const int fog = key->fog_mode != VIRGL_FFP_FOG_NONE;
+    const int cm = (key->flags & VIRGL_FFP_COLOR_MATERIAL) != 0;
+    const uint32_t lights = lit ? key->lights : 0;
+    const uint32_t points = lights & key->point_lights;
+    uint32_t out = 2;
+
+    virgl_ffp_emit(&w, "VERT\n");
+    virgl_ffp_emit(&w, "DCL IN[0]\nDCL IN[1]\n");
+    if (textured || lit) {
+        virgl_ffp_emit(&w, "DCL IN[2]\n");
+    }
+    if (lit) {
+        virgl_ffp_emit(&w, "DCL IN[3]\n");
+    }
+    virgl_ffp_emit(&w, "DCL OUT[0], POSITION\nDCL OUT[1], COLOR\n");
+    const uint32_t out_texcoord = textured ? out++ : 0;
+    const uint32_t out_fog = fog ? out++ : 0;
+    if (textured) {
+        virgl_ffp_emit(&w, "DCL OUT[%u], GENERIC[0]\n", out_texcoord);
+    }
+    if (fog) {
+        virgl_ffp_emit(&w, "DCL OUT[%u], GENERIC[1]\n", out_fog);
+    }
+    virgl_ffp_emit(&w, "DCL CONST[0..%u]\n", virgl_ffp_vs_constants(key) - 1);
+    if (lit || fog) {
+        virgl_ffp_emit(&w, "DCL TEMP[0..5]\n");
+    }
+    if (lights) {
+        virgl_ffp_emit(&w, "IMM[0] FLT32 {    0.0000,     0.0000,     1.0000,     0.0000}\n");
+    }
+
+    virgl_ffp_emit(&w, "  DP4 OUT[0].x, IN[0], CONST[%u]\n", VIRGL_FFP_VS_MVP + 0);
+    virgl_ffp_emit(&w, "  DP4 OUT[0].y, IN[0], CONST[%u]\n", VIRGL_FFP_VS_MVP + 1);
+    virgl_ffp_emit(&w, "  DP4 OUT[0].z, IN[0], CONST[%u]\n", VIRGL_FFP_VS_MVP + 2);
+    virgl_ffp_emit(&w, "  DP4 OUT[0].w, IN[0], CONST[%u]\n", VIRGL_FFP_VS_MVP + 3);
+    if (textured) {
+        virgl_ffp_emit(&w, "  MOV OUT[%u], IN[2]\n", out_texcoord);
+    }
+
+    // TEMP[0]: eye position, only the parts that are read
+    if (points) {
+        virgl_ffp_emit(&w, "  DP4 TEMP[0].x, IN[0], CONST[%u]\n", VIRGL_FFP_VS_MODELVIEW + 0);
+        virgl_ffp_emit(&w, "  DP4 TEMP[0].y, IN[0], CONST[%u]\n", VIRGL_FFP_VS_MODELVIEW + 1);
+    }
+    if (points || fog) {
+        virgl_ffp_emit(&w, "  DP4 TEMP[0].z, IN[0], CONST[%u]\n", VIRGL_FFP_VS_MODELVIEW + 2);
+    }
+
+    if (lit) {
+        // TEMP[1]: eye normal, TEMP[3]: accumulated color
+        if (lights) {
+            virgl_ffp_emit(&w, "  DP3 TEMP[1].x, IN[3], CONST[%u]\n", VIRGL_FFP_VS_NORMAL_MATRIX + 0);
+            virgl_ffp_emit(&w, "  DP3 TEMP[1].y, IN[3], CONST[%u]\n", VIRGL_FFP_VS_NORMAL_MATRIX + 1);
+            virgl_ffp_emit(&w, "  DP3 TEMP[1].z, IN[3], CONST[%u]\n", VIRGL_FFP_VS_NORMAL_MATRIX + 2);
+            virgl_ffp_emit(&w, "  DP3 TEMP[2].x, TEMP[1], TEMP[1]\n");
+            virgl_ffp_emit(&w, "  RSQ TEMP[2].x, TEMP[2].xxxx\n");
+            virgl_ffp_emit(&w, "  MUL TEMP[1].xyz, TEMP[1], TEMP[2].xxxx\n");
+        }
+        if (cm) {
+            virgl_ffp_emit(&w, "  MAD TEMP[3].xyz, CONST[%u], IN[1], CONST[%u]\n",
+                           VIRGL_FFP_VS_MATERIAL, VIRGL_FFP_VS_SCENE_COLOR);
+            virgl_ffp_emit(&w, "  MOV TEMP[3].w, IN[1].wwww\n");
+        } else {
+            virgl_ffp_emit(&w, "  MOV TEMP[3], CONST[%u]\n", VIRGL_FFP_VS_SCENE_COLOR);
+        }
+        for (uint32_t i = 0; i < VIRGL_FFP_MAX_LIGHTS; i++) {
+            if (!(lights & (1u << i))) {
+                continue;
+            }
+            const uint32_t base = VIRGL_FFP_VS_LIGHT(i);
+            char l_reg[16];
+            struct virgl_ffp_writer lw = { l_reg, sizeof(l_reg), 0, 0 };
+
+            // L: normalised direction to the light, in TEMP[4] for point lights
+            if (points & (1u << i)) {
+                virgl_ffp_emit(&w, "  ADD TEMP[4].xyz, CONST[%u], -TEMP[0]\n",
+                               base + VIRGL_FFP_VS_LIGHT_POSITION);
+                virgl_ffp_emit(&w, "  DP3 TEMP[5].x, TEMP[4], TEMP[4]\n");
+                virgl_ffp_emit(&w, "  RSQ TEMP[5].x, TEMP[5].xxxx\n");
+                virgl_ffp_emit(&w, "  MUL TEMP[4].xyz, TEMP[4], TEMP[5].xxxx\n");
+                virgl_ffp_emit(&lw, "TEMP[4]");
+            } else {
+                virgl_ffp_emit(&lw, "CONST[%u]", base + VIRGL_FFP_VS_LIGHT_POSITION);
+            }
+            virgl_ffp_finish(&lw);
+
+            // TEMP[5]: half vector for an infinite viewer, normalize(L + z)
+            virgl_ffp_emit(&w, "  ADD TEMP[5].xyz, %s, IMM[0]\n", l_reg);
+            virgl_ffp_emit(&w, "  DP3 TEMP[2].x, TEMP[5], TEMP[5]\n");
+            virgl_ffp_emit(&w, "  RSQ TEMP[2].x, TEMP[2].xxxx\n");
+            virgl_ffp_emit(&w, "  MUL TEMP[5].xyz, TEMP[5], TEMP[2].xxxx\n");
+
+            // LIT gives (1, max(N.L, 0), N.L > 0 ? max(N.H, 0)^shininess : 0, 1)
+            virgl_ffp_emit(&w, "  DP3 TEMP[2].x, TEMP[1], %s\n", l_reg);
+            virgl_ffp_emit(&w, "  DP3 TEMP[2].y, TEMP[1], TEMP[5]\n");
+            virgl_ffp_emit(&w, "  MOV TEMP[2].w, CONST[%u].wwww\n", VIRGL_FFP_VS_MATERIAL);
+            virgl_ffp_emit(&w, "  LIT TEMP[2], TEMP[2]\n");
+
+            if (cm) {
+                virgl_ffp_emit(&w, "  MAD TEMP[3].xyz, CONST[%u], IN[1], TEMP[3]\n",
+                               base + VIRGL_FFP_VS_LIGHT_AMBIENT);
+                virgl_ffp_emit(&w, "  MUL TEMP[4].xyz, CONST[%u], IN[1]\n",
+                               base + VIRGL_FFP_VS_LIGHT_DIFFUSE);
+                virgl_ffp_emit(&w, "  MAD TEMP[3].xyz, TEMP[4], TEMP[2].yyyy, TEMP[3]\n");
+            } else {
+                virgl_ffp_emit(&w, "  ADD TEMP[3].xyz, TEMP[3], CONST[%u]\n",
+                               base + VIRGL_FFP_VS_LIGHT_AMBIENT);
+                virgl_ffp_emit(&w, "  MAD TEMP[3].xyz, CONST[%u], TEMP[2].yyyy, TEMP[3]\n",
+                               base + VIRGL_FFP_VS_LIGHT_DIFFUSE);
+            }
+            virgl_ffp_emit(&w, "  MAD TEMP[3].xyz, CONST[%u], TEMP[2].zzzz, TEMP[3]\n",
+                           base + VIRGL_FFP_VS_LIGHT_SPECULAR);
+        }
+        virgl_ffp_emit(&w, "  MOV_SAT OUT[1], TEMP[3]\n");
+    } else {
+        virgl_ffp_emit(&w, "  MOV OUT[1], IN[1]\n");
+    }
+
+    switch (key->fog_mode) {
+    case VIRGL_FFP_FOG_LINEAR:
+        virgl_ffp_emit(&w, "  MAD TEMP[2].x, TEMP[0].zzzz, CONST[%u].xxxx, CONST[%u].yyyy\n",
+                       VIRGL_FFP_VS_FOG, VIRGL_FFP_VS_FOG);
+        break;
+    case VIRGL_FFP_FOG_EXP:
+        virgl_ffp_emit(&w, "  MUL TEMP[2].x, TEMP[0].zzzz, CONST[%u].zzzz\n", VIRGL_FFP_VS_FOG);
+        virgl_ffp_emit(&w, "  EX2 TEMP[2].x, TEMP[2].xxxx\n");
+        break;
+    case VIRGL_FFP_FOG_EXP2:
+        virgl_ffp_emit(&w, "  MUL TEMP[2].x, TEMP[0].zzzz, CONST[%u].wwww\n", VIRGL_FFP_VS_FOG);
+        virgl_ffp_emit(&w, "  MUL TEMP[2].x, TEMP[2].xxxx, -TEMP[2].xxxx\n");
+        virgl_ffp_emit(&w, "  EX2 TEMP[2].x, TEMP[2].xxxx\n");
+        break;
+    default:
+        break;
+    }
+    if (fog) {
+        virgl_ffp_emit(&w, "  MOV_SAT OUT[%u], TEMP[2].xxxx\n", out_fog);
+    }
+    virgl_ffp_emit(&w, "  END\n");
+    return virgl_ffp_finish(&w);
+}
+
+static inline uint32_t virgl_ffp_fragment_shader(const struct virgl_ffp_key* key,
+                                                 char* buf, uint32_t capacity)
+{
+    // Pass on whichever SGT/SLT/... is 1; KILL_IF discards on a negative
+    static const char* const compare[8] = {
+        NULL, "SLT", "SEQ", "SLE", "SGT", "SNE", "SGE", NULL,
+    };
+    struct virgl_ffp_writer w = { buf, capacity, 0, 0 };
+    const int textured = key->texture_units != 0;
+    const int fog = key->fog_mode != VIRGL_FFP_FOG_NONE;
+    const uint32_t alpha_func = key->alpha_func & 7;
+    const int alpha_test = alpha_func != PIPE_FUNC_ALWAYS;
+    const uint32_t constants = virgl_ffp_fs_constants(key);
+    uint32_t in = 1;
+
+    virgl_ffp_emit(&w, "FRAG\n");
+    virgl_ffp_emit(&w, "PROPERTY FS_COLOR0_WRITES_ALL_CBUFS 1\n");
+    virgl_ffp_emit(&w, "DCL IN[0], COLOR, COLOR\n");
+    const uint32_t in_texcoord = textured ? in++ : 0;
+    const uint32_t in_fog = fog ? in++ : 0;
+    if (textured) {
+        virgl_ffp_emit(&w, "DCL IN[%u], GENERIC[0], PERSPECTIVE\n", in_texcoord);
+    }
+    if (fog) {
+        virgl_ffp_emit(&w, "DCL IN[%u], GENERIC[1], PERSPECTIVE\n", in_fog);
+    }
+    virgl_ffp_emit(&w, "DCL OUT[0], COLOR\n");
+    for (uint32_t u = 0; u < VIRGL_FFP_MAX_TEXTURE_UNITS; u++) {
+        if (key->texture_units & (1u << u)) {
+            virgl_ffp_emit(&w, "DCL SAMP[%u]\n", u);
+            virgl_ffp_emit(&w, "DCL SVIEW[%u], 2D, FLOAT\n", u);
+        }
+    }
+    if (constants) {
+        virgl_ffp_emit(&w, "DCL CONST[0..%u]\n", constants - 1);
+    }
+    if (!textured && !fog && !alpha_test) {
+        virgl_ffp_emit(&w, "  MOV OUT[0], IN[0]\n");
+        virgl_ffp_emit(&w, "  END\n");
+        return virgl_ffp_finish(&w);
+    }
+    virgl_ffp_emit(&w, "DCL TEMP[0..1]\n");
+    if (compare[alpha_func]) {
+        virgl_ffp_emit(&w, "IMM[0] FLT32 {   -0.5000,     0.0000,     0.0000,     0.0000}\n");
+    }
+
+    virgl_ffp_emit(&w, "  MOV TEMP[0], IN[0]\n");
+    for (uint32_t u = 0; u < VIRGL_FFP_MAX_TEXTURE_UNITS; u++) {
+        if (key->texture_units & (1u << u)) {
+            virgl_ffp_emit(&w, "  TEX TEMP[1], IN[%u], SAMP[%u], 2D\n", in_texcoord, u);
+            virgl_ffp_emit(&w, "  MUL TEMP[0], TEMP[0], TEMP[1]\n");
+        }
+    }
+    if (alpha_func == PIPE_FUNC_NEVER) {
+        virgl_ffp_emit(&w, "  KILL\n");
+    } else if (compare[alpha_func]) {
+        virgl_ffp_emit(&w, "  %s TEMP[1].x, TEMP[0].wwww, CONST[%u].xxxx\n",
+                       compare[alpha_func], VIRGL_FFP_FS_ALPHA_REF);
+        virgl_ffp_emit(&w, "  ADD TEMP[1].x, TEMP[1].xxxx, IMM[0].xxxx\n");
+        virgl_ffp_emit(&w, "  KILL_IF TEMP[1].xxxx\n");
+    }
+    if (fog) {
+        virgl_ffp_emit(&w, "  LRP TEMP[0].xyz, IN[%u].xxxx, TEMP[0], CONST[%u]\n",
+                       in_fog, VIRGL_FFP_FS_FOG_COLOR);
+    }
+    virgl_ffp_emit(&w, "  MOV OUT[0], TEMP[0]\n");
+    virgl_ffp_emit(&w, "  END\n");
+    return virgl_ffp_finish(&w);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VIRGL_FFP_H */
@@ -8,9 +8,16 @@
 #ifndef _VIRGL_PROTOCOL_H
 #define _VIRGL_PROTOCOL_H
 
+// Kernel builds take fixed-width types from IOKit; everything else
+// (VirtGLGL, tools/) includes this header on its own
+#ifdef KERNEL
 #include <IOKit/IOTypes.h>
+#else
+#include <stdint.h>
+#endif
 
-// Virgl command opcodes
+// Virgl command opcodes, in virglrenderer's order: the host dispatches on
+// the number
 enum virgl_context_cmd {
     VIRGL_CCMD_NOP = 0,
     VIRGL_CCMD_CREATE_OBJECT = 1,
@@ -25,9 +32,10 @@ enum virgl_context_cmd {
     VIRGL_CCMD_SET_SAMPLER_VIEWS,
     VIRGL_CCMD_SET_INDEX_BUFFER,
     VIRGL_CCMD_SET_CONSTANT_BUFFER,
-    VIRGL_CCMD_SET_UNIFORM_BUFFER,
+    VIRGL_CCMD_SET_STENCIL_REF,
+    VIRGL_CCMD_SET_BLEND_COLOR,
     VIRGL_CCMD_SET_SCISSOR_STATE,
-    VIRGL_CCMD_BLIT,
+    VIRGL_CCMD_BLIT = 16,
     VIRGL_CCMD_RESOURCE_COPY_REGION,
     VIRGL_CCMD_BIND_SAMPLER_STATES,
     VIRGL_CCMD_BEGIN_QUERY,
@@ -38,9 +46,8 @@ enum virgl_context_cmd {
     VIRGL_CCMD_SET_SAMPLE_MASK,
     VIRGL_CCMD_SET_STREAMOUT_TARGETS,
     VIRGL_CCMD_SET_RENDER_CONDITION,
-    VIRGL_CCMD_SET_BLEND_COLOR,
-    VIRGL_CCMD_SET_STENCIL_REF,
-    VIRGL_CCMD_RESOURCE_UNREF,
+    VIRGL_CCMD_SET_UNIFORM_BUFFER = 27,
+    VIRGL_CCMD_SET_SUB_CTX,
     VIRGL_CCMD_CREATE_SUB_CTX,
     VIRGL_CCMD_DESTROY_SUB_CTX,
     VIRGL_CCMD_BIND_SHADER,
@@ -131,13 +138,29 @@ enum pipe_shader_type {
 enum virgl_formats {
     VIRGL_FORMAT_B8G8R8A8_UNORM = 1,
     VIRGL_FORMAT_B8G8R8X8_UNORM = 2,
+    VIRGL_FORMAT_R8_UNORM = 64,
+    VIRGL_FORMAT_R8G8_UNORM = 65,
     VIRGL_FORMAT_R8G8B8A8_UNORM = 67,
     VIRGL_FORMAT_R8G8B8X8_UNORM = 68,
+    VIRGL_FORMAT_B8G8R8A8_SRGB = 100,
+    VIRGL_FORMAT_R8G8B8A8_SRGB = 104,
     VIRGL_FORMAT_R16G16B16A16_FLOAT = 113,
     VIRGL_FORMAT_R32G32B32A32_FLOAT = 133,
     VIRGL_FORMAT_D24_UNORM_S8_UINT = 40,
     VIRGL_FORMAT_D32_FLOAT = 41,
     VIRGL_FORMAT_Z24X8_UNORM = 42,
+    VIRGL_FORMAT_DXT1_RGB = 131,
+    VIRGL_FORMAT_DXT1_RGBA = 132,
+    VIRGL_FORMAT_DXT3_RGBA = 133,
+    VIRGL_FORMAT_DXT5_RGBA = 134,
+    VIRGL_FORMAT_DXT1_SRGB = 135,
+    VIRGL_FORMAT_DXT1_SRGBA = 136,
+    VIRGL_FORMAT_DXT3_SRGBA = 137,
+    VIRGL_FORMAT_DXT5_SRGBA = 138,
+    VIRGL_FORMAT_RGTC1_UNORM = 177,
+    VIRGL_FORMAT_RGTC1_SNORM = 178,
+    VIRGL_FORMAT_RGTC2_UNORM = 179,
+    VIRGL_FORMAT_RGTC2_SNORM = 180,
 };
 
 // Vertex element formats
@@ -202,6 +225,25 @@ enum pipe_face {
     PIPE_FACE_FRONT_AND_BACK = 3,
 };
 
+// Texture wrap modes
+enum pipe_tex_wrap {
+    PIPE_TEX_WRAP_REPEAT = 0,
+    PIPE_TEX_WRAP_CLAMP = 1,
+    PIPE_TEX_WRAP_CLAMP_TO_EDGE = 2,
+    PIPE_TEX_WRAP_CLAMP_TO_BORDER = 3,
+    PIPE_TEX_WRAP_MIRROR_REPEAT = 4,
+};
+
+// Texture filters
+#define PIPE_TEX_FILTER_NEAREST     0
+#define PIPE_TEX_FILTER_LINEAR      1
+#define PIPE_TEX_MIPFILTER_NEAREST  0
+#define PIPE_TEX_MIPFILTER_LINEAR   1
+#define PIPE_TEX_MIPFILTER_NONE     2
+
+#define PIPE_MASK_RGBA              0xf
+#define VIRGL_MAX_COLOR_BUFS        8
+
 // Virgl command structure
 // All virgl commands start with a header: [length_in_dwords] [command_opcode]
 // UTM-authoritative bit layout (utmapp/virglrenderer, src/virgl_protocol.h):
@@ -274,6 +316,59 @@ enum pipe_face {
 #define VIRGL_OBJ_SURFACE_TEXTURE_LAYERS      5
 // Virgl DESTROY_OBJECT payload is a single dword (the handle).
 #define VIRGL_OBJ_DESTROY_HANDLE              1
+// Constant state objects (CSOs). Each is CREATE_OBJECT with the object
+// type in the header, the new handle in dword 1, then the packed state.
+// BIND_OBJECT and DESTROY_OBJECT take just the handle.
+#define VIRGL_OBJ_BIND_HANDLE                 1
+
+// Blend: dword 2 = S0, dword 3 = logicop func, dwords 4-11 = per-RT state
+#define VIRGL_OBJ_BLEND_SIZE                  (VIRGL_MAX_COLOR_BUFS + 3)
+#define VIRGL_OBJ_BLEND_S0_INDEPENDENT_BLEND_ENABLE(x) (((x) & 0x1) << 0)
+#define VIRGL_OBJ_BLEND_S0_LOGICOP_ENABLE(x)  (((x) & 0x1) << 1)
+#define VIRGL_OBJ_BLEND_S0_DITHER(x)          (((x) & 0x1) << 2)
+#define VIRGL_OBJ_BLEND_S2_RT_BLEND_ENABLE(x) (((x) & 0x1) << 0)
+#define VIRGL_OBJ_BLEND_S2_RT_RGB_FUNC(x)     (((x) & 0x7) << 1)
+#define VIRGL_OBJ_BLEND_S2_RT_RGB_SRC_FACTOR(x) (((x) & 0x1f) << 4)
+#define VIRGL_OBJ_BLEND_S2_RT_RGB_DST_FACTOR(x) (((x) & 0x1f) << 9)
+#define VIRGL_OBJ_BLEND_S2_RT_ALPHA_FUNC(x)   (((x) & 0x7) << 14)
+#define VIRGL_OBJ_BLEND_S2_RT_ALPHA_SRC_FACTOR(x) (((x) & 0x1f) << 17)
+#define VIRGL_OBJ_BLEND_S2_RT_ALPHA_DST_FACTOR(x) (((x) & 0x1f) << 22)
+#define VIRGL_OBJ_BLEND_S2_RT_COLORMASK(x)    (((x) & 0xf) << 27)
+
+// Depth/stencil/alpha: S0, front stencil, back stencil, alpha ref (float)
+#define VIRGL_OBJ_DSA_SIZE                    5
+#define VIRGL_OBJ_DSA_S0_DEPTH_ENABLE(x)      (((x) & 0x1) << 0)
+#define VIRGL_OBJ_DSA_S0_DEPTH_WRITEMASK(x)   (((x) & 0x1) << 1)
+#define VIRGL_OBJ_DSA_S0_DEPTH_FUNC(x)        (((x) & 0x7) << 2)
+#define VIRGL_OBJ_DSA_S0_ALPHA_ENABLED(x)     (((x) & 0x1) << 8)
+#define VIRGL_OBJ_DSA_S0_ALPHA_FUNC(x)        (((x) & 0x7) << 9)
+
+// Rasterizer: S0, point size, sprite coord enable, S3, line width,
+// offset units, offset scale, offset clamp
+#define VIRGL_OBJ_RS_SIZE                     9
+#define VIRGL_OBJ_RS_S0_FLATSHADE(x)          (((x) & 0x1) << 0)
+#define VIRGL_OBJ_RS_S0_DEPTH_CLIP(x)         (((x) & 0x1) << 1)
+#define VIRGL_OBJ_RS_S0_CULL_FACE(x)          (((x) & 0x3) << 8)
+#define VIRGL_OBJ_RS_S0_FILL_FRONT(x)         (((x) & 0x3) << 10)
+#define VIRGL_OBJ_RS_S0_FILL_BACK(x)          (((x) & 0x3) << 12)
+#define VIRGL_OBJ_RS_S0_SCISSOR(x)            (((x) & 0x1) << 14)
+#define VIRGL_OBJ_RS_S0_FRONT_CCW(x)          (((x) & 0x1) << 15)
+#define VIRGL_OBJ_RS_S0_LINE_LAST_PIXEL(x)    (((x) & 0x1) << 28)
+#define VIRGL_OBJ_RS_S0_HALF_PIXEL_CENTER(x)  (((x) & 0x1) << 29)
+#define VIRGL_OBJ_RS_S0_BOTTOM_EDGE_RULE(x)   (((x) & 0x1) << 30)
+
+// Sampler state: S0, lod bias, min lod, max lod, border color[4] (floats)
+#define VIRGL_OBJ_SAMPLER_STATE_SIZE          9
+#define VIRGL_OBJ_SAMPLE_STATE_S0_WRAP_S(x)   (((x) & 0x7) << 0)
+#define VIRGL_OBJ_SAMPLE_STATE_S0_WRAP_T(x)   (((x) & 0x7) << 3)
+#define VIRGL_OBJ_SAMPLE_STATE_S0_WRAP_R(x)   (((x) & 0x7) << 6)
+#define VIRGL_OBJ_SAMPLE_STATE_S0_MIN_IMG_FILTER(x) (((x) & 0x3) << 9)
+#define VIRGL_OBJ_SAMPLE_STATE_S0_MIN_MIP_FILTER(x) (((x) & 0x3) << 11)
+#define VIRGL_OBJ_SAMPLE_STATE_S0_MAG_IMG_FILTER(x) (((x) & 0x3) << 13)
+
+// BIND_SAMPLER_STATES: shader type, start slot, then one handle per slot
+#define VIRGL_BIND_SAMPLER_STATES(num)        ((num) + 2)
+
 // Virgl SET_FRAMEBUFFER_STATE: variable length, nr_cbufs + 2 payload dwords.
 // NOTE: the legacy fixed-size `VIRGL_SET_FRAMEBUFFER_STATE_SIZE 11` defined
 // below is the max-8-cbufs case (8 + 3 header = 11 total dwords). Use the
@@ -319,16 +414,23 @@ enum pipe_face {
 // dword 3-10: cbufs[8] surface handles
 #define VIRGL_SET_FRAMEBUFFER_STATE_SIZE 11
 
-// Virgl CREATE_OBJECT command for shaders:
+// Virgl CREATE_OBJECT command for shaders (object type VIRGL_OBJECT_SHADER
+// goes in the header):
 // dword 0: command header
 // dword 1: handle
-// dword 2: type (VIRGL_OBJECT_SHADER)
-// dword 3: shader_type (PIPE_SHADER_*)
-// dword 4: shader_offset
-// dword 5: shader_num_tokens
-// dword 6: shader_so_num_outputs
-// dword 7+: shader data
-#define VIRGL_CREATE_SHADER_HDR_SIZE 7
+// dword 2: shader_type (PIPE_SHADER_*)
+// dword 3: offlen - total text bytes including the NUL; bit 31 marks a
+//          continuation chunk, whose low bits are then the byte offset
+// dword 4: shader_num_tokens (the host sizes its token buffer from this)
+// dword 5: shader_so_num_outputs (0, no stream output)
+// dword 6+: NUL-terminated TGSI text, padded to a dword
+#define VIRGL_OBJ_SHADER_HANDLE 1
+#define VIRGL_OBJ_SHADER_TYPE 2
+#define VIRGL_OBJ_SHADER_OFFSET 3
+#define VIRGL_OBJ_SHADER_OFFSET_CONT (1u << 31)
+#define VIRGL_OBJ_SHADER_NUM_TOKENS 4
+#define VIRGL_OBJ_SHADER_SO_NUM_OUTPUTS 5
+#define VIRGL_CREATE_SHADER_HDR_SIZE 5
 
 // Virgl BIND_SHADER command:
 // dword 0: command header
@@ -355,6 +457,29 @@ enum pipe_face {
 //   dword: handle
 #define VIRGL_VERTEX_BUFFER_SIZE 3
 
+// Virgl SET_INDEX_BUFFER command:
+// dword 0: command header
+// dword 1: handle (0 unbinds)
+// dword 2: index size in bytes (1, 2 or 4)
+// dword 3: offset in bytes
+#define VIRGL_SET_INDEX_BUFFER_SIZE 3
+
+// Virgl SET_UNIFORM_BUFFER command (binds a buffer resource as a UBO):
+// dword 0: command header
+// dword 1: shader type (PIPE_SHADER_*)
+// dword 2: index
+// dword 3: offset in bytes
+// dword 4: length in bytes
+// dword 5: resource handle (0 unbinds)
+#define VIRGL_SET_UNIFORM_BUFFER_SIZE 5
+
+// Virgl SET_CONSTANT_BUFFER command (user constants, no resource):
+// dword 0: command header
+// dword 1: shader type (PIPE_SHADER_*)
+// dword 2: index (0; the host only reads user constants from buffer 0)
+// dword 3+: constants as float dwords
+#define VIRGL_SET_CONSTANT_BUFFER_SIZE(num) (2 + (num))
+
 // Virgl RESOURCE_INLINE_WRITE command:
 // dword 0: command header
 // dword 1: handle
@@ -371,6 +496,24 @@ enum pipe_face {
 // dword 12+: data
 #define VIRGL_INLINE_WRITE_HDR_SIZE 12
 
+// Virgl BLIT command (a pipe_blit_info):
+// dword 1: mask (bits 0-7), filter (8-9), scissor enable (10),
+//          render condition enable (11), alpha blend (12)
+// dword 2-3: scissor min x | y << 16, max x | y << 16
+// dword 4-12: destination handle, level, format, x, y, z, w, h, d
+// dword 13-21: source, the same fields
+#define VIRGL_CMD_BLIT_SIZE 21
+#define VIRGL_CMD_BLIT_S0 1
+#define VIRGL_CMD_BLIT_S0_MASK(x) (((x) & 0xff) << 0)
+#define VIRGL_CMD_BLIT_S0_FILTER(x) (((x) & 0x3) << 8)
+#define VIRGL_CMD_BLIT_S0_SCISSOR_ENABLE(x) (((x) & 0x1) << 10)
+#define VIRGL_CMD_BLIT_S0_RENDER_CONDITION_ENABLE(x) (((x) & 0x1) << 11)
+#define VIRGL_CMD_BLIT_S0_ALPHA_BLEND(x) (((x) & 0x1) << 12)
+#define VIRGL_CMD_BLIT_SCISSOR_MINX_MINY 2
+#define VIRGL_CMD_BLIT_SCISSOR_MAXX_MAXY 3
+#define VIRGL_CMD_BLIT_DST_RES_HANDLE 4
+#define VIRGL_CMD_BLIT_SRC_RES_HANDLE 13
+
 // Union for float<->uint32 conversion without strict aliasing issues
 union virgl_float_uint {
     float f;
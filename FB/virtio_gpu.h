@@ -57,6 +57,9 @@ struct virtio_gpu_config {
     uint32_t num_capsets;
 };
 
+/* Upper bound on num_scanouts (VirtIO GPU specification 5.7.4) */
+#define VIRTIO_GPU_MAX_SCANOUTS           16
+
 /* Control commands - VirtIO 1.2 specification compliant */
 enum virtio_gpu_ctrl_type {
     /* 2D commands */
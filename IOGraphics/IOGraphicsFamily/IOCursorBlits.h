@@ -378,3 +378,102 @@ void IOFramebuffer::StdFBRemoveCursor32(
         vramPtr += vramRow;
     }
 }
+
+/*
+ * Vector variants, chosen in setupCursor when the CPU has SSE2/AVX2.
+ * Same results as the scalar procs above; the interrupted thread's vector
+ * state is saved and restored around each call.
+ */
+
+#include "IOCursorBlitsSIMD.h"
+
+static int gIOFBCursorSIMDLevel = -1;
+
+static int IOFBCursorSIMDLevel(void)
+{
+#if IOFB_CURSOR_HAVE_SIMD
+    if (gIOFBCursorSIMDLevel < 0)
+        gIOFBCursorSIMDLevel = IOFBCursorSIMDProbe();
+    return (gIOFBCursorSIMDLevel);
+#else
+    return (kIOFBCursorSIMDNone);
+#endif
+}
+
+#if IOFB_CURSOR_HAVE_SIMD
+
+void IOFramebuffer::StdFBDisplayCursor32AxxxSIMD(
+                                 IOFramebuffer * inst,
+                                 StdFBShmem_t *shmem,
+                                 volatile unsigned int *vramPtr,
+                                 unsigned int cursStart,
+                                 unsigned int vramRow,
+                                 unsigned int cursRow,
+                                 int width,
+                                 int height )
+{
+    uint8_t vectorSave[kIOFBCursorVectorSaveSize];
+    uint8_t * area;
+    int level = gIOFBCursorSIMDLevel;
+    const unsigned int *cursPtr;
+
+    cursPtr = (const unsigned int *) inst->__private->cursorImages[ shmem->frame ];
+    cursPtr += cursStart;
+
+    area = IOFBCursorVectorSave(vectorSave);
+    if (level == kIOFBCursorSIMDAVX2)
+        IOFBCursorDisplay32AVX2((uint32_t *) vramPtr, (uint32_t *) inst->cursorSave,
+                                cursPtr, vramRow, cursRow, width, height);
+    else
+        IOFBCursorDisplay32SSE2((uint32_t *) vramPtr, (uint32_t *) inst->cursorSave,
+                                cursPtr, vramRow, cursRow, width, height);
+    IOFBCursorVectorRestore(area);
+}
+
+static inline void StdFBRestoreCursorSIMD(
+                                 volatile unsigned char *vramPtr,
+                                 volatile unsigned char *savePtr,
+                                 unsigned int bytesPerPixel,
+                                 unsigned int vramRow,
+                                 int width,
+                                 int height )
+{
+    uint8_t vectorSave[kIOFBCursorVectorSaveSize];
+    uint8_t * area;
+    int level = gIOFBCursorSIMDLevel;
+
+    area = IOFBCursorVectorSave(vectorSave);
+    if (level == kIOFBCursorSIMDAVX2)
+        IOFBCursorRestoreAVX2((uint8_t *) vramPtr, (const uint8_t *) savePtr,
+                              width * bytesPerPixel, vramRow * bytesPerPixel, height);
+    else
+        IOFBCursorRestoreSSE2((uint8_t *) vramPtr, (const uint8_t *) savePtr,
+                              width * bytesPerPixel, vramRow * bytesPerPixel, height);
+    IOFBCursorVectorRestore(area);
+}
+
+void IOFramebuffer::StdFBRemoveCursor16SIMD(
+                                IOFramebuffer * inst,
+                                StdFBShmem_t *shmem,
+                                volatile unsigned short *vramPtr,
+                                unsigned int vramRow,
+                                int width,
+                                int height )
+{
+    StdFBRestoreCursorSIMD((volatile unsigned char *) vramPtr, inst->cursorSave,
+                           sizeof(unsigned short), vramRow, width, height);
+}
+
+void IOFramebuffer::StdFBRemoveCursor32SIMD(
+                                IOFramebuffer * inst,
+                                StdFBShmem_t *shmem,
+                                volatile unsigned int *vramPtr,
+                                unsigned int vramRow,
+                                int width,
+                                int height )
+{
+    StdFBRestoreCursorSIMD((volatile unsigned char *) vramPtr, inst->cursorSave,
+                           sizeof(unsigned int), vramRow, width, height);
+}
+
+#endif /* IOFB_CURSOR_HAVE_SIMD */
@@ -0,0 +1,268 @@
+/*
+ * IOCursorBlitsSIMD.h
+ *
+ * Vector versions of the 32 bpp software cursor composite and of the
+ * save-under restore used by IOCursorBlits.h. Free of IOKit so the same
+ * code builds into tools/cursorblit_bench on Linux next to the originals.
+ *
+ * Results are bit-identical to StdFBDisplayCursor32Axxx: every lane runs
+ * the same (c * (255 - a) + 255) >> 8 arithmetic, and the carry behaviour
+ * of the packed add is kept by adding in 32-bit lanes.
+ *
+ * The kernels touch XMM registers, which XNU does not preserve around
+ * kernel-mode code. Callers bracket them with IOFBCursorVectorSave() /
+ * IOFBCursorVectorRestore(), which fxsave the interrupted state into a
+ * caller stack buffer. fxsave does not cover YMM/ZMM upper halves, so the
+ * kernel build never selects the AVX2 kernels.
+ */
+
+#ifndef _IOCURSORBLITSSIMD_H
+#define _IOCURSORBLITSSIMD_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+enum {
+    kIOFBCursorSIMDNone = 0,
+    kIOFBCursorSIMDSSE2 = 1,
+    kIOFBCursorSIMDAVX2 = 2,
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+#define IOFB_CURSOR_HAVE_SIMD   1
+#include <immintrin.h>
+#else
+#define IOFB_CURSOR_HAVE_SIMD   0
+#endif
+
+/* Scalar composite of one pixel; identical to the StdFBDisplayCursor32Axxx
+ * inner loop. Used for row tails so every width stays bit-exact. */
+static inline uint32_t IOFBCursorCompose32(uint32_t s, uint32_t d)
+{
+    uint32_t f = s >> 24;
+
+    if (!f)
+        return d ^ s;           // transparent (s == 0 leaves d) or xor
+    if (f == 0xFF)
+        return s;               // opaque
+    s <<= 8;  d <<= 8;
+    f ^= 0xFF;
+    d = s+(((((d&0xFF00FF00)>>8)*f+0x00FF00FF)&0xFF00FF00)
+        | ((((d & 0x00FF00FF)*f+0x00FF00FF)>>8) & 0x00FF00FF));
+    return (d>>8) | 0xFF000000;
+}
+
+#if IOFB_CURSOR_HAVE_SIMD
+
+/* Probe once: SSE2 is baseline on x86_64, AVX2 additionally needs the OS
+ * to have enabled YMM state in XCR0. The kernel stops at SSE2. */
+static inline int IOFBCursorSIMDProbe(void)
+{
+    uint32_t a, b, c, d, max;
+
+    __asm__ __volatile__("cpuid" : "=a"(max), "=b"(b), "=c"(c), "=d"(d) : "a"(0), "c"(0));
+    __asm__ __volatile__("cpuid" : "=a"(a), "=b"(b), "=c"(c), "=d"(d) : "a"(1), "c"(0));
+    if (!(d & (1u << 26)))
+        return kIOFBCursorSIMDNone;
+
+#ifndef KERNEL
+    if ((c & (1u << 27)) && (c & (1u << 28)) && max >= 7) {
+        uint32_t xlo, xhi;
+        __asm__ __volatile__("xgetbv" : "=a"(xlo), "=d"(xhi) : "c"(0));
+        if ((xlo & 0x6) == 0x6) {
+            __asm__ __volatile__("cpuid" : "=a"(a), "=b"(b), "=c"(c), "=d"(d) : "a"(7), "c"(0));
+            if (b & (1u << 5))
+                return kIOFBCursorSIMDAVX2;
+        }
+    }
+#endif
+    return kIOFBCursorSIMDSSE2;
+}
+
+/* The fxsave area, plus slack to align to 16 bytes inside a stack buffer. */
+#define kIOFBCursorVectorSaveSize   (512 + 16)
+
+static inline uint8_t * IOFBCursorVectorSave(uint8_t * buf)
+{
+    uint8_t * area = (uint8_t *)(((uintptr_t) buf + 15) & ~(uintptr_t) 15);
+
+    __asm__ __volatile__("fxsave %0" : "=m"(*(uint8_t (*)[512]) area) : : "memory");
+    return area;
+}
+
+static inline void IOFBCursorVectorRestore(uint8_t * area)
+{
+    __asm__ __volatile__("fxrstor %0" : : "m"(*(uint8_t (*)[512]) area) : "memory");
+}
+
+/* Composite four pixels: returns the new screen value for each lane given
+ * cursor s and screen d. */
+__attribute__((target("sse2"), always_inline))
+static inline __m128i IOFBCursorCompose32x4(__m128i s, __m128i d)
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i c255  = _mm_set1_epi16(0xFF);
+    const __m128i rgb   = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i alpha = _mm_set1_epi32((int) 0xFF000000);
+
+    __m128i a   = _mm_srli_epi32(s, 24);
+    __m128i f   = _mm_xor_si128(a, _mm_set1_epi32(0xFF));
+    __m128i f16 = _mm_or_si128(f, _mm_slli_epi32(f, 16));
+    __m128i flo = _mm_unpacklo_epi32(f16, f16);
+    __m128i fhi = _mm_unpackhi_epi32(f16, f16);
+
+    __m128i dlo = _mm_unpacklo_epi8(d, zero);
+    __m128i dhi = _mm_unpackhi_epi8(d, zero);
+    dlo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(dlo, flo), c255), 8);
+    dhi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(dhi, fhi), c255), 8);
+    __m128i c = _mm_and_si128(_mm_packus_epi16(dlo, dhi), rgb);
+
+    __m128i sover  = _mm_or_si128(_mm_add_epi32(_mm_and_si128(s, rgb), c), alpha);
+    __m128i opaque = _mm_cmpeq_epi32(a, _mm_set1_epi32(0xFF));
+    __m128i clear  = _mm_cmpeq_epi32(a, zero);
+
+    __m128i r = _mm_or_si128(_mm_and_si128(opaque, s), _mm_andnot_si128(opaque, sover));
+    return _mm_or_si128(_mm_and_si128(clear, _mm_xor_si128(d, s)), _mm_andnot_si128(clear, r));
+}
+
+__attribute__((target("sse2"), noinline))
+static void IOFBCursorDisplay32SSE2(uint32_t * vram, uint32_t * save, const uint32_t * curs,
+                                    unsigned int vramRow, unsigned int cursRow,
+                                    int width, int height)
+{
+    for (int i = height; --i >= 0; ) {
+        int j = width;
+        for (; j >= 8; j -= 8) {
+            __m128i d0 = _mm_loadu_si128((const __m128i *) vram);
+            __m128i d1 = _mm_loadu_si128((const __m128i *) (vram + 4));
+            __m128i s0 = _mm_loadu_si128((const __m128i *) curs);
+            __m128i s1 = _mm_loadu_si128((const __m128i *) (curs + 4));
+            _mm_storeu_si128((__m128i *) save, d0);
+            _mm_storeu_si128((__m128i *) (save + 4), d1);
+            _mm_storeu_si128((__m128i *) vram, IOFBCursorCompose32x4(s0, d0));
+            _mm_storeu_si128((__m128i *) (vram + 4), IOFBCursorCompose32x4(s1, d1));
+            vram += 8; save += 8; curs += 8;
+        }
+        if (j >= 4) {
+            __m128i d0 = _mm_loadu_si128((const __m128i *) vram);
+            __m128i s0 = _mm_loadu_si128((const __m128i *) curs);
+            _mm_storeu_si128((__m128i *) save, d0);
+            _mm_storeu_si128((__m128i *) vram, IOFBCursorCompose32x4(s0, d0));
+            vram += 4; save += 4; curs += 4;
+            j -= 4;
+        }
+        for (; --j >= 0; ) {
+            uint32_t d = *save++ = *vram;
+            *vram++ = IOFBCursorCompose32(*curs++, d);
+        }
+        curs += cursRow;
+        vram += vramRow;
+    }
+}
+
+__attribute__((target("avx2"), noinline))
+static void IOFBCursorDisplay32AVX2(uint32_t * vram, uint32_t * save, const uint32_t * curs,
+                                    unsigned int vramRow, unsigned int cursRow,
+                                    int width, int height)
+{
+    const __m256i zero  = _mm256_setzero_si256();
+    const __m256i c255  = _mm256_set1_epi16(0xFF);
+    const __m256i rgb   = _mm256_set1_epi32(0x00FFFFFF);
+    const __m256i alpha = _mm256_set1_epi32((int) 0xFF000000);
+    const __m256i ff    = _mm256_set1_epi32(0xFF);
+
+    for (int i = height; --i >= 0; ) {
+        int j = width;
+        for (; j >= 8; j -= 8) {
+            __m256i d = _mm256_loadu_si256((const __m256i *) vram);
+            __m256i s = _mm256_loadu_si256((const __m256i *) curs);
+            _mm256_storeu_si256((__m256i *) save, d);
+
+            // unpack/pack work per 128-bit lane, so the pairing stays consistent
+            __m256i a   = _mm256_srli_epi32(s, 24);
+            __m256i f   = _mm256_xor_si256(a, ff);
+            __m256i f16 = _mm256_or_si256(f, _mm256_slli_epi32(f, 16));
+            __m256i flo = _mm256_unpacklo_epi32(f16, f16);
+            __m256i fhi = _mm256_unpackhi_epi32(f16, f16);
+            __m256i dlo = _mm256_unpacklo_epi8(d, zero);
+            __m256i dhi = _mm256_unpackhi_epi8(d, zero);
+            dlo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(dlo, flo), c255), 8);
+            dhi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(dhi, fhi), c255), 8);
+            __m256i c = _mm256_and_si256(_mm256_packus_epi16(dlo, dhi), rgb);
+
+            __m256i sover = _mm256_or_si256(_mm256_add_epi32(_mm256_and_si256(s, rgb), c), alpha);
+            __m256i r = _mm256_blendv_epi8(sover, s, _mm256_cmpeq_epi32(a, ff));
+            r = _mm256_blendv_epi8(r, _mm256_xor_si256(d, s), _mm256_cmpeq_epi32(a, zero));
+            _mm256_storeu_si256((__m256i *) vram, r);
+            vram += 8; save += 8; curs += 8;
+        }
+        for (; --j >= 0; ) {
+            uint32_t d = *save++ = *vram;
+            *vram++ = IOFBCursorCompose32(*curs++, d);
+        }
+        curs += cursRow;
+        vram += vramRow;
+    }
+}
+
+/* Save-under restore for any depth: rows of rowBytes contiguous in save,
+ * separated by skipBytes on screen. */
+__attribute__((target("sse2"), noinline))
+static void IOFBCursorRestoreSSE2(uint8_t * vram, const uint8_t * save,
+                                  size_t rowBytes, size_t skipBytes, int height)
+{
+    for (int i = height; --i >= 0; ) {
+        size_t n = rowBytes;
+        for (; n >= 32; n -= 32) {
+            __m128i a = _mm_loadu_si128((const __m128i *) save);
+            __m128i b = _mm_loadu_si128((const __m128i *) (save + 16));
+            _mm_storeu_si128((__m128i *) vram, a);
+            _mm_storeu_si128((__m128i *) (vram + 16), b);
+            vram += 32; save += 32;
+        }
+        for (; n >= 4; n -= 4) {
+            // 16 bpp rows are only 2-byte aligned: go through a local
+            uint32_t pixels;
+            __builtin_memcpy(&pixels, save, sizeof(pixels));
+            __builtin_memcpy(vram, &pixels, sizeof(pixels));
+            vram += 4; save += 4;
+        }
+        for (; n; n--)
+            *vram++ = *save++;
+        vram += skipBytes;
+    }
+}
+
+__attribute__((target("avx2"), noinline))
+static void IOFBCursorRestoreAVX2(uint8_t * vram, const uint8_t * save,
+                                  size_t rowBytes, size_t skipBytes, int height)
+{
+    for (int i = height; --i >= 0; ) {
+        size_t n = rowBytes;
+        for (; n >= 64; n -= 64) {
+            __m256i a = _mm256_loadu_si256((const __m256i *) save);
+            __m256i b = _mm256_loadu_si256((const __m256i *) (save + 32));
+            _mm256_storeu_si256((__m256i *) vram, a);
+            _mm256_storeu_si256((__m256i *) (vram + 32), b);
+            vram += 64; save += 64;
+        }
+        if (n >= 32) {
+            _mm256_storeu_si256((__m256i *) vram, _mm256_loadu_si256((const __m256i *) save));
+            vram += 32; save += 32; n -= 32;
+        }
+        for (; n >= 4; n -= 4) {
+            // 16 bpp rows are only 2-byte aligned: go through a local
+            uint32_t pixels;
+            __builtin_memcpy(&pixels, save, sizeof(pixels));
+            __builtin_memcpy(vram, &pixels, sizeof(pixels));
+            vram += 4; save += 4;
+        }
+        for (; n; n--)
+            *vram++ = *save++;
+        vram += skipBytes;
+    }
+}
+
+#endif /* IOFB_CURSOR_HAVE_SIMD */
+
+#endif /* ! _IOCURSORBLITSSIMD_H */
@@ -1246,6 +1246,10 @@ void IOFramebuffer::setupCursor(void)
             {
                 cursorBlitProc = (CursorBlitProc) StdFBDisplayCursor555;
                 cursorRemoveProc = (CursorRemoveProc) StdFBRemoveCursor16;
+#if IOFB_CURSOR_HAVE_SIMD
+                if (IOFBCursorSIMDLevel() != kIOFBCursorSIMDNone)
+                    cursorRemoveProc = (CursorRemoveProc) StdFBRemoveCursor16SIMD;
+#endif
             }
             break;
         case 32:
@@ -1255,6 +1259,15 @@ void IOFramebuffer::setupCursor(void)
 			else
 				cursorBlitProc = (CursorBlitProc) StdFBDisplayCursor32Axxx;
 			cursorRemoveProc = (CursorRemoveProc) StdFBRemoveCursor32;
+#if IOFB_CURSOR_HAVE_SIMD
+			// 30 bpp keeps the scalar composite; both depths share the restore
+			if (IOFBCursorSIMDLevel() != kIOFBCursorSIMDNone)
+			{
+				if (10 != info->bitsPerComponent)
+					cursorBlitProc = (CursorBlitProc) StdFBDisplayCursor32AxxxSIMD;
+				cursorRemoveProc = (CursorRemoveProc) StdFBRemoveCursor32SIMD;
+			}
+#endif
             break;
         default:
             break;
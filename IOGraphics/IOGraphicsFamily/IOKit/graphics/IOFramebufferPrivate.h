@@ -115,6 +115,32 @@
                                     int width,
                                     int height );
 
+    static void StdFBDisplayCursor32AxxxSIMD(
+                                    IOFramebuffer * inst,
+                                    StdFBShmem_t *shmem,
+                                    volatile unsigned int *vramPtr,
+                                    unsigned int cursStart,
+                                    unsigned int vramRow,
+                                    unsigned int cursRow,
+                                    int width,
+                                    int height );
+
+    static void StdFBRemoveCursor16SIMD(
+                                    IOFramebuffer * inst,
+                                    StdFBShmem_t *shmem,
+                                    volatile unsigned short *vramPtr,
+                                    unsigned int vramRow,
+                                    int width,
+                                    int height );
+
+    static void StdFBRemoveCursor32SIMD(
+                                    IOFramebuffer * inst,
+                                    StdFBShmem_t *shmem,
+                                    volatile unsigned int *vramPtr,
+                                    unsigned int vramRow,
+                                    int width,
+                                    int height );
+
     static void deferredMoveCursor(IOFramebuffer * inst);
 
     static void deferredCLUTSetInterrupt( OSObject * owner,
@@ -5,7 +5,7 @@
 
 #include "VirtGLGL.h"
 #include "VirtGLGLClient.h"
-#include "virgl_protocol.h"
+#include "virgl_encode.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -28,6 +28,68 @@ static uint32_t g_vertexCount = 0;
 // Current color
 static float g_currentColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
 
+// Render target size
+#define RENDER_WIDTH  800
+#define RENDER_HEIGHT 600
+
+// Client-side command buffer. Commands are recorded here and handed to the
+// kernel in one SubmitCommands call on glFlush/glFinish/swap or when full.
+// Selector 0x3000 only accepts structure inputs IOKit copies inline, which
+// means fewer than 4096 bytes, so the buffer stays just below that.
+#define CMD_BUFFER_DWORDS 1016
+static uint32_t g_cmdBuffer[CMD_BUFFER_DWORDS];
+static struct virgl_encoder g_enc = { g_cmdBuffer, CMD_BUFFER_DWORDS, 0, 0 };
+
+// Scanout points at g_resourceId once set; later presents only flush
+static bool g_scanoutSet = false;
+
+static VirtGLGLStats g_stats;
+
+// Hand everything recorded so far to the kernel
+static bool VirtGLGL_SubmitPending(void)
+{
+    if (g_enc.len == 0) return true;
+    if (!g_client) return false;
+    
+    uint32_t bytes = g_enc.len * sizeof(uint32_t);
+    bool ok = VirtGLGL_SubmitCommands(g_client, g_cmdBuffer, bytes);
+    g_stats.submits++;
+    g_stats.bytes += bytes;
+    virgl_encoder_reset(&g_enc);
+    return ok;
+}
+
+// Record a command with `emit`; if the buffer is full, submit and retry once
+#define VIRTGLGL_ENCODE(emit) \
+    do { \
+        if (!(emit)) { \
+            VirtGLGL_SubmitPending(); \
+            if (!(emit)) { \
+                fprintf(stderr, "VirtGLGL: command exceeds command buffer\n"); \
+                break; \
+            } \
+        } \
+        g_stats.commands++; \
+    } while (0)
+
+// Submit, then push the render target to the display
+static void VirtGLGL_Present(void)
+{
+    if (!g_client) return;
+    
+    VirtGLGL_SubmitPending();
+    
+    if (g_resourceId == 0) return;
+    if (!g_scanoutSet) {
+        // Scanout 0 = primary display
+        g_scanoutSet = VirtGLGL_SetScanout(g_client, 0, g_resourceId, 0, 0,
+                                           RENDER_WIDTH, RENDER_HEIGHT);
+        g_stats.scanouts++;
+    }
+    VirtGLGL_FlushResource(g_client, g_resourceId, 0, 0, RENDER_WIDTH, RENDER_HEIGHT);
+    g_stats.presents++;
+}
+
 // Initialize VirtGLGL
 bool VirtGLGL_Initialize(void)
 {
@@ -56,7 +118,7 @@ bool VirtGLGL_Initialize(void)
     // Create render target resource (800x600 RGBA)
     // Use resource ID 2 to avoid conflict with framebuffer's resource ID 1
     g_resourceId = 2;
-    if (!VirtGLGL_CreateResource(g_client, g_resourceId, 800, 600, 
+    if (!VirtGLGL_CreateResource(g_client, g_resourceId, RENDER_WIDTH, RENDER_HEIGHT,
                                   VIRGL_FORMAT_R8G8B8A8_UNORM)) {
         fprintf(stderr, "VirtGLGL: Failed to create resource\n");
         VirtGLGL_Disconnect(g_client);
@@ -72,6 +134,10 @@ bool VirtGLGL_Initialize(void)
         return false;
     }
     
+    virgl_encoder_reset(&g_enc);
+    g_scanoutSet = false;
+    memset(&g_stats, 0, sizeof(g_stats));
+    
     g_initialized = true;
     printf("VirtGLGL: Initialization complete (context=%u, resource=%u)\n", 
            g_contextId, g_resourceId);
@@ -84,10 +150,17 @@ void VirtGLGL_Shutdown(void)
     if (!g_initialized) return;
     
     if (g_client) {
+        // Don't drop commands the application already issued
+        VirtGLGL_SubmitPending();
+        printf("VirtGLGL: %llu commands in %llu submits, %llu presents\n",
+               (unsigned long long)g_stats.commands, (unsigned long long)g_stats.submits,
+               (unsigned long long)g_stats.presents);
         VirtGLGL_Disconnect(g_client);
         g_client = NULL;
     }
     
+    virgl_encoder_reset(&g_enc);
+    g_scanoutSet = false;
     g_initialized = false;
     printf("VirtGLGL: Shutdown complete\n");
 }
@@ -97,6 +170,18 @@ void* VirtGLGL_GetClient(void)
     return g_client;
 }
 
+void VirtGLGL_SwapBuffers(void)
+{
+    VirtGLGL_Present();
+}
+
+void VirtGLGL_GetStats(VirtGLGLStats* stats)
+{
+    if (stats) {
+        *stats = g_stats;
+    }
+}
+
 // OpenGL API implementations
 
 void glClear(GLbitfield mask)
@@ -107,34 +192,14 @@ void glClear(GLbitfield mask)
     
     if (!g_client) return;
     
-    // Build VIRGL_CCMD_CLEAR command
-    uint32_t cmd[8];
-    cmd[0] = virgl_cmd_header_pack(VIRGL_CCMD_CLEAR, 7);
-    
     // Map GL clear bits to virgl clear bits
     uint32_t virgl_mask = 0;
     if (mask & GL_COLOR_BUFFER_BIT) virgl_mask |= PIPE_CLEAR_COLOR0;
     if (mask & GL_DEPTH_BUFFER_BIT) virgl_mask |= PIPE_CLEAR_DEPTH;
     if (mask & GL_STENCIL_BUFFER_BIT) virgl_mask |= PIPE_CLEAR_STENCIL;
     
-    cmd[1] = virgl_mask;
-    cmd[2] = virgl_pack_float(g_currentColor[0]);  // red
-    cmd[3] = virgl_pack_float(g_currentColor[1]);  // green
-    cmd[4] = virgl_pack_float(g_currentColor[2]);  // blue
-    cmd[5] = virgl_pack_float(g_currentColor[3]);  // alpha
-    cmd[6] = virgl_pack_float(1.0f);               // depth
-    cmd[7] = 0;                                    // stencil
-    
-    VirtGLGL_SubmitCommands(g_client, cmd, sizeof(cmd));
-    
-    printf("VirtGLGL: glClear(0x%x) -> virgl mask 0x%x\n", mask, virgl_mask);
-    
-    // Set scanout to use our 3D resource, then flush to display
-    if (g_resourceId > 0) {
-        // Scanout 0 = primary display
-        VirtGLGL_SetScanout(g_client, 0, g_resourceId, 0, 0, 800, 600);
-        VirtGLGL_FlushResource(g_client, g_resourceId, 0, 0, 800, 600);
-    }
+    // Recorded only; glFlush/glFinish/swap submit and present
+    VIRTGLGL_ENCODE(virgl_encode_clear(&g_enc, virgl_mask, g_currentColor, 1.0, 0));
 }
 
 void glClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
@@ -143,8 +208,6 @@ void glClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
     g_currentColor[1] = green;
     g_currentColor[2] = blue;
     g_currentColor[3] = alpha;
-    
-    printf("VirtGLGL: glClearColor(%f, %f, %f, %f)\n", red, green, blue, alpha);
 }
 
 void glBegin(GLenum mode)
@@ -230,14 +293,15 @@ void glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 
 void glFlush(void)
 {
-    // Flush any pending commands
-    printf("VirtGLGL: glFlush()\n");
+    // Single-buffered rendering becomes visible on glFlush
+    VirtGLGL_Present();
 }
 
 void glFinish(void)
 {
-    // Wait for all commands to complete
-    printf("VirtGLGL: glFinish()\n");
+    // SubmitCommands returns once the host has executed the batch, so
+    // presenting is also the wait
+    VirtGLGL_Present();
 }
 
 GLenum glGetError(void)
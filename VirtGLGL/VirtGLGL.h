@@ -67,6 +67,21 @@ void VirtGLGL_Shutdown(void);
 // Direct access to client (for testing)
 void* VirtGLGL_GetClient(void);
 
+// Submit pending commands and show the render target. Scanout is pointed at
+// the render target on the first present only.
+void VirtGLGL_SwapBuffers(void);
+
+// Command batching counters, cumulative since VirtGLGL_Initialize
+typedef struct {
+    uint64_t commands;      // virgl commands recorded
+    uint64_t submits;       // SubmitCommands calls into the kernel
+    uint64_t bytes;         // command bytes submitted
+    uint64_t presents;      // FlushResource calls (glFlush/glFinish/swap)
+    uint64_t scanouts;      // SetScanout calls
+} VirtGLGLStats;
+
+void VirtGLGL_GetStats(VirtGLGLStats* stats);
+
 // OpenGL API (subset)
 void glClear(GLbitfield mask);
 void glClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha);
@@ -8,15 +8,7 @@
 #include <IOKit/IOKitLib.h>
 #include <CoreFoundation/CoreFoundation.h>
 
-// OpenGL constants
-#define GL_COLOR_BUFFER_BIT 0x00004000
-#define GL_DEPTH_BUFFER_BIT 0x00000100
-
-// VirtGLGL function prototypes
-extern int VirtGLGL_Initialize(void);
-extern void VirtGLGL_Shutdown(void);
-extern void glClearColor(float red, float green, float blue, float alpha);
-extern void glClear(uint32_t mask);
+#include "VirtGLGL.h"
 
 double get_time_ms()
 {
@@ -25,11 +17,28 @@ double get_time_ms()
     return (tv.tv_sec * 1000.0) + (tv.tv_usec / 1000.0);
 }
 
+// Batching report for the commands issued since `before`
+void print_batching(const VirtGLGLStats* before)
+{
+    VirtGLGLStats after;
+    VirtGLGL_GetStats(&after);
+    
+    unsigned long long commands = after.commands - before->commands;
+    unsigned long long submits = after.submits - before->submits;
+    unsigned long long presents = after.presents - before->presents;
+    
+    printf("  Submits: %llu (%llu commands, %.1f commands/submit)\n",
+           submits, commands, submits ? (double)commands / submits : 0.0);
+    printf("  Presents: %llu\n", presents);
+}
+
 void run_clear_benchmark(int iterations)
 {
     printf("\n=== Clear Command Benchmark ===\n");
     printf("Iterations: %d\n", iterations);
     
+    VirtGLGLStats before;
+    VirtGLGL_GetStats(&before);
     double start_time = get_time_ms();
     
     for (int i = 0; i < iterations; i++) {
@@ -41,6 +50,7 @@ void run_clear_benchmark(int iterations)
         glClearColor(r, g, b, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
     }
+    glFinish();
     
     double end_time = get_time_ms();
     double elapsed = end_time - start_time;
@@ -53,6 +63,7 @@ void run_clear_benchmark(int iterations)
     printf("  Throughput: %.2f FPS\n", fps);
     printf("  Commands/sec: %.0f\n", fps);
     printf("  Microseconds/command: %.2f µs\n", avg_frame_time * 1000.0);
+    print_batching(&before);
 }
 
 void run_depth_benchmark(int iterations)
@@ -60,12 +71,15 @@ void run_depth_benchmark(int iterations)
     printf("\n=== Depth+Color Clear Benchmark ===\n");
     printf("Iterations: %d\n", iterations);
     
+    VirtGLGLStats before;
+    VirtGLGL_GetStats(&before);
     double start_time = get_time_ms();
     
     for (int i = 0; i < iterations; i++) {
         glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
+    glFinish();
     
     double end_time = get_time_ms();
     double elapsed = end_time - start_time;
@@ -75,6 +89,34 @@ void run_depth_benchmark(int iterations)
     printf("  Total time: %.2f ms\n", elapsed);
     printf("  Average frame time: %.3f ms\n", elapsed / iterations);
     printf("  Throughput: %.2f FPS\n", fps);
+    print_batching(&before);
+}
+
+// Frame-shaped load: several clears, then a swap, as an application would
+void run_frame_benchmark(int frames, int clears_per_frame)
+{
+    printf("\n=== Frame Benchmark ===\n");
+    printf("Frames: %d, clears per frame: %d\n", frames, clears_per_frame);
+    
+    VirtGLGLStats before;
+    VirtGLGL_GetStats(&before);
+    double start_time = get_time_ms();
+    
+    for (int f = 0; f < frames; f++) {
+        for (int c = 0; c < clears_per_frame; c++) {
+            glClearColor((f % 256) / 255.0f, (c % 256) / 255.0f, 0.5f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        }
+        VirtGLGL_SwapBuffers();
+    }
+    
+    double elapsed = get_time_ms() - start_time;
+    
+    printf("Results:\n");
+    printf("  Total time: %.2f ms\n", elapsed);
+    printf("  Average frame time: %.3f ms\n", elapsed / frames);
+    printf("  Throughput: %.2f FPS\n", (frames / elapsed) * 1000.0);
+    print_batching(&before);
 }
 
 void print_system_info()
@@ -124,6 +166,7 @@ int main(int argc, char** argv)
     
     run_clear_benchmark(clear_iterations);
     run_depth_benchmark(depth_iterations);
+    run_frame_benchmark(clear_iterations / 10 > 0 ? clear_iterations / 10 : 1, 10);
     
     // Cleanup
     printf("\n" "════════════════════════════════════════════════════════════\n");
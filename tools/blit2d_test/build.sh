@@ -0,0 +1,16 @@
+#!/bin/bash
+# Build and run blit2d_test: FB/VMBlit2D.cpp checked against a per-pixel
+# reference for every kernel set the host CPU supports, then benchmarked.
+# Runs on any x86_64 Linux or macOS host; the engine has no IOKit dependency.
+set -e
+
+cd "$(dirname "$0")"
+
+CXX=${CXX:-c++}
+
+$CXX -O2 -std=c++11 -Wall -Wno-unknown-pragmas -I../../FB \
+     -o blit2d_test blit2d_test.cpp ../../FB/VMBlit2D.cpp
+
+echo "Built: $(pwd)/blit2d_test"
+echo
+./blit2d_test "$@"
@@ -0,0 +1,591 @@
+// Correctness and throughput suite for FB/VMBlockCompress.cpp.
+//
+// Decoding is checked byte for byte against a reference written from the
+// definitions in VMBlockCompress.h: hand-built blocks with known colors,
+// then random blocks of every format at every size and pitch, for every
+// kernel set the host CPU supports. Encoding must give the same bytes on
+// every kernel set, keep flat and two-level blocks exact where the format
+// can, respect BC1 transparency, and never get worse from Fast through
+// Normal to High on photographic-like content. Last, 2048x2048 images are
+// timed both ways in megapixels per second.
+
+#include "VMBlockCompress.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#define LOG_TAG "[blockcompress]"
+
+static uint32_t s_rng = 0x9E3779B9u;
+
+static uint32_t rnd()
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int s_failures = 0;
+static volatile uint32_t s_sink;    // keeps benchmark results live
+
+#define FAIL(...)                                                   \
+    do {                                                            \
+        if (s_failures < 20) fprintf(stderr, LOG_TAG " FAIL " __VA_ARGS__); \
+        s_failures++;                                               \
+    } while (0)
+
+static const char* format_name(VMBlockFormat f)
+{
+    switch (f) {
+        case kVMBlockFormatBC1: return "bc1";
+        case kVMBlockFormatBC2: return "bc2";
+        case kVMBlockFormatBC3: return "bc3";
+        case kVMBlockFormatBC4: return "bc4";
+        case kVMBlockFormatBC5: return "bc5";
+        default:                return "?";
+    }
+}
+
+static const char* quality_name(VMBlockQuality q)
+{
+    switch (q) {
+        case kVMBlockQualityFast:   return "fast";
+        case kVMBlockQualityNormal: return "normal";
+        case kVMBlockQualityHigh:   return "high";
+        default:                    return "?";
+    }
+}
+
+#pragma mark - Reference decoder
+
+static uint32_t rounded(double v)
+{
+    return (uint32_t)floor(v + 0.5);
+}
+
+static void ref_colors(const uint8_t* b, bool force_four, uint32_t pal[4][4])
+{
+    uint32_t c[2] = { (uint32_t)(b[0] | (b[1] << 8)), (uint32_t)(b[2] | (b[3] << 8)) };
+    for (int e = 0; e < 2; e++) {
+        uint32_t r = c[e] >> 11, g = (c[e] >> 5) & 63, bl = c[e] & 31;
+        pal[e][0] = (r << 3) | (r >> 2);
+        pal[e][1] = (g << 2) | (g >> 4);
+        pal[e][2] = (bl << 3) | (bl >> 2);
+        pal[e][3] = 255;
+    }
+    bool four = force_four || c[0] > c[1];
+    for (int k = 0; k < 3; k++) {
+        if (four) {
+            pal[2][k] = rounded((2.0 * pal[0][k] + pal[1][k]) / 3.0);
+            pal[3][k] = rounded((pal[0][k] + 2.0 * pal[1][k]) / 3.0);
+        } else {
+            pal[2][k] = rounded((pal[0][k] + pal[1][k]) / 2.0);
+            pal[3][k] = 0;
+        }
+    }
+    pal[2][3] = 255;
+    pal[3][3] = four ? 255 : 0;
+}
+
+static void ref_values(const uint8_t* b, uint32_t pal[8])
+{
+    pal[0] = b[0];
+    pal[1] = b[1];
+    if (b[0] > b[1]) {
+        for (int i = 1; i <= 6; i++)
+            pal[i + 1] = rounded(((7 - i) * b[0] + i * b[1]) / 7.0);
+    } else {
+        for (int i = 1; i <= 4; i++)
+            pal[i + 1] = rounded(((5 - i) * b[0] + i * b[1]) / 5.0);
+        pal[6] = 0;
+        pal[7] = 255;
+    }
+}
+
+static uint32_t ref_value(const uint8_t* b, uint32_t i)
+{
+    uint32_t pal[8];
+    ref_values(b, pal);
+    uint32_t bit = 16 + 3 * i;
+    uint32_t index = 0;
+    for (int k = 0; k < 3; k++, bit++)
+        index |= ((b[bit / 8] >> (bit % 8)) & 1) << k;
+    return pal[index];
+}
+
+// Pixel i (row-major) of a block as R, G, B, A
+static void ref_pixel(VMBlockFormat f, const uint8_t* b, uint32_t i, uint32_t out[4])
+{
+    uint32_t pal[4][4];
+    switch (f) {
+        case kVMBlockFormatBC1:
+            ref_colors(b, false, pal);
+            memcpy(out, pal[(b[4 + i / 4] >> (2 * (i % 4))) & 3], sizeof(pal[0]));
+            break;
+        case kVMBlockFormatBC2:
+            ref_colors(b + 8, true, pal);
+            memcpy(out, pal[(b[12 + i / 4] >> (2 * (i % 4))) & 3], sizeof(pal[0]));
+            out[3] = ((b[i / 2] >> (4 * (i % 2))) & 15) * 255 / 15;
+            break;
+        case kVMBlockFormatBC3:
+            ref_colors(b + 8, true, pal);
+            memcpy(out, pal[(b[12 + i / 4] >> (2 * (i % 4))) & 3], sizeof(pal[0]));
+            out[3] = ref_value(b, i);
+            break;
+        case kVMBlockFormatBC4:
+            out[0] = ref_value(b, i);
+            out[1] = out[2] = 0;
+            out[3] = 255;
+            break;
+        case kVMBlockFormatBC5:
+            out[0] = ref_value(b, i);
+            out[1] = ref_value(b + 8, i);
+            out[2] = 0;
+            out[3] = 255;
+            break;
+        default:
+            break;
+    }
+}
+
+#pragma mark - Decoder
+
+static void test_golden()
+{
+    struct Golden {
+        VMBlockFormat format;
+        uint8_t       block[16];
+        uint8_t       first[4][4];  // Pixels 0-3, RGBA
+    };
+    static const Golden cases[] = {
+        // Red to blue, four colors, indices 0 1 2 3 on every row
+        { kVMBlockFormatBC1, { 0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4 },
+          { { 255, 0, 0, 255 }, { 0, 0, 255, 255 }, { 170, 0, 85, 255 }, { 85, 0, 170, 255 } } },
+        // Blue to red, three colors and transparent black
+        { kVMBlockFormatBC1, { 0x1F, 0x00, 0x00, 0xF8, 0xE4, 0xE4, 0xE4, 0xE4 },
+          { { 0, 0, 255, 255 }, { 255, 0, 0, 255 }, { 128, 0, 128, 255 }, { 0, 0, 0, 0 } } },
+        // Eight interpolated values 255 .. 0, indices 0 1 2 3 ...
+        { kVMBlockFormatBC4, { 255, 0, 0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA },
+          { { 255, 0, 0, 255 }, { 0, 0, 0, 255 }, { 219, 0, 0, 255 }, { 182, 0, 0, 255 } } },
+        // Six interpolated values plus 0 and 255, indices 4 5 6 7 ...
+        { kVMBlockFormatBC4, { 20, 220, 0xAC, 0xCF, 0xFA, 0xAC, 0xCF, 0xFA },
+          { { 140, 0, 0, 255 }, { 180, 0, 0, 255 }, { 0, 0, 0, 255 }, { 255, 0, 0, 255 } } },
+        // Explicit alpha 0, 5, 10, 15 over white
+        { kVMBlockFormatBC2, { 0x50, 0xFA, 0x50, 0xFA, 0x50, 0xFA, 0x50, 0xFA,
+                               0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0 },
+          { { 255, 255, 255, 0 }, { 255, 255, 255, 85 }, { 255, 255, 255, 170 }, { 255, 255, 255, 255 } } },
+    };
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        uint8_t out[64];
+        VMBlockImage in = { (uint8_t*)cases[c].block, VMBlockFormatBytes(cases[c].format), cases[c].format };
+        VMPixelImage px = { out, 16, kVMPixelFormatRGBA8 };
+        if (!VMBlockDecompress(&px, &in, 4, 4)) {
+            FAIL("golden %zu refused\n", c);
+            continue;
+        }
+        if (memcmp(out, cases[c].first, 16) != 0)
+            FAIL("golden %zu (%s) got %u,%u,%u,%u %u,%u,%u,%u ...\n", c, format_name(cases[c].format),
+                 out[0], out[1], out[2], out[3], out[4], out[5], out[6], out[7]);
+    }
+}
+
+// Decodes random blocks into a w x h image at random alignments and
+// pitches, and compares pixels and untouched row padding with the reference
+static void check_decode(VMBlockFormat f, uint32_t w, uint32_t h, bool bgra)
+{
+    uint32_t bw = (w + 3) / 4, bh = (h + 3) / 4, bb = VMBlockFormatBytes(f);
+    uint32_t src_pitch = bw * bb + (rnd() % 3 == 0 ? 0 : rnd() % 40);
+    uint32_t dst_pitch = w * 4 + (rnd() % 3 == 0 ? 0 : rnd() % 40);
+
+    std::vector<uint8_t> src_mem((size_t)src_pitch * bh + 16);
+    std::vector<uint8_t> dst_mem((size_t)dst_pitch * h + 16, 0xCD);
+    uint8_t* src = src_mem.data() + rnd() % 16;
+    for (size_t i = 0; i < src_mem.size() - 16; i++)
+        src[i] = (uint8_t)rnd();
+    // Equal endpoints and flat blocks take their own branches
+    for (uint32_t i = 0; i < bw * bh; i++) {
+        uint8_t* b = src + (size_t)(i / bw) * src_pitch + (size_t)(i % bw) * bb;
+        if (rnd() % 8 == 0)
+            memcpy(b + (bb == 16 && f != kVMBlockFormatBC5 ? 10 : 2), b + (bb == 16 && f != kVMBlockFormatBC5 ? 8 : 0), 2);
+    }
+    uint8_t* dst = dst_mem.data() + rnd() % 16;
+    std::vector<uint8_t> want(dst, dst + (size_t)dst_pitch * h);
+    for (uint32_t y = 0; y < h; y++)
+        for (uint32_t x = 0; x < w; x++) {
+            uint32_t c[4];
+            ref_pixel(f, src + (size_t)(y / 4) * src_pitch + (size_t)(x / 4) * bb, (y % 4) * 4 + x % 4, c);
+            uint8_t* p = &want[(size_t)y * dst_pitch + x * 4];
+            p[0] = (uint8_t)c[bgra ? 2 : 0];
+            p[1] = (uint8_t)c[1];
+            p[2] = (uint8_t)c[bgra ? 0 : 2];
+            p[3] = (uint8_t)c[3];
+        }
+
+    VMBlockImage in = { src, src_pitch, f };
+    VMPixelImage out = { dst, dst_pitch, bgra ? kVMPixelFormatBGRA8 : kVMPixelFormatRGBA8 };
+    if (!VMBlockDecompress(&out, &in, w, h)) {
+        FAIL("decode %s %ux%u refused\n", format_name(f), w, h);
+        return;
+    }
+    for (uint32_t y = 0; y < h; y++) {
+        uint32_t span = y + 1 < h ? dst_pitch : w * 4;
+        for (uint32_t i = 0; i < span; i++) {
+            uint8_t got = dst[(size_t)y * dst_pitch + i], exp = want[(size_t)y * dst_pitch + i];
+            if (got != exp) {
+                FAIL("decode %s %ux%u%s pixel (%u,%u) byte %u got %02x want %02x\n", format_name(f), w, h,
+                     bgra ? " bgra" : "", i / 4, y, i % 4, got, exp);
+                return;
+            }
+        }
+    }
+}
+
+static void test_decode(int cases)
+{
+    for (int i = 0; i < cases; i++) {
+        VMBlockFormat f = (VMBlockFormat)(1 + rnd() % (kVMBlockFormatCount - 1));
+        check_decode(f, 1 + rnd() % 37, 1 + rnd() % 37, rnd() % 2);
+    }
+}
+
+#pragma mark - Encoder
+
+// Smooth gradients with a little noise and a few hard edges, like
+// photographs and painted textures
+static void make_image(std::vector<uint8_t>& px, uint32_t w, uint32_t h, bool noise_alpha)
+{
+    px.resize((size_t)w * h * 4);
+    for (uint32_t y = 0; y < h; y++)
+        for (uint32_t x = 0; x < w; x++) {
+            uint8_t* p = &px[((size_t)y * w + x) * 4];
+            double u = (double)x / w, v = (double)y / h;
+            double edge = ((x / 13 + y / 7) % 5 == 0) ? 60 : 0;
+            p[0] = (uint8_t)fmin(255, 200 * u + 30 * sin(7 * v) + 25 + edge + rnd() % 6);
+            p[1] = (uint8_t)fmin(255, 180 * v + 40 * cos(5 * u) + 40 + rnd() % 6);
+            p[2] = (uint8_t)fmin(255, 120 * (1 - u) * v + 60 + edge / 2 + rnd() % 6);
+            p[3] = noise_alpha ? (uint8_t)rnd() : (uint8_t)fmin(255, 255 * u * v + rnd() % 4);
+        }
+}
+
+static std::vector<uint8_t> encode(VMBlockFormat f, const std::vector<uint8_t>& px, uint32_t w, uint32_t h,
+                                   VMBlockQuality q, bool bgra = false)
+{
+    uint32_t pitch = (w + 3) / 4 * VMBlockFormatBytes(f);
+    std::vector<uint8_t> out((size_t)pitch * ((h + 3) / 4), 0xCD);
+    VMBlockImage dst = { out.data(), pitch, f };
+    VMPixelImage src = { (uint8_t*)px.data(), w * 4, bgra ? kVMPixelFormatBGRA8 : kVMPixelFormatRGBA8 };
+    if (!VMBlockCompress(&dst, &src, w, h, q))
+        FAIL("encode %s %s %ux%u refused\n", format_name(f), quality_name(q), w, h);
+    return out;
+}
+
+static std::vector<uint8_t> decode(VMBlockFormat f, const std::vector<uint8_t>& blocks, uint32_t w, uint32_t h)
+{
+    std::vector<uint8_t> out((size_t)w * h * 4);
+    VMBlockImage src = { (uint8_t*)blocks.data(), (w + 3) / 4 * VMBlockFormatBytes(f), f };
+    VMPixelImage dst = { out.data(), w * 4, kVMPixelFormatRGBA8 };
+    VMBlockDecompress(&dst, &src, w, h);
+    return out;
+}
+
+// Squared error over the channels the format stores
+static double squared_error(VMBlockFormat f, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b)
+{
+    uint32_t first = 0, last = 3;
+    if (f == kVMBlockFormatBC4) last = 0;
+    if (f == kVMBlockFormatBC5) last = 1;
+    if (f == kVMBlockFormatBC1) last = 2;
+    double e = 0;
+    for (size_t i = 0; i < a.size(); i += 4)
+        for (uint32_t c = first; c <= last; c++)
+            e += ((double)a[i + c] - b[i + c]) * ((double)a[i + c] - b[i + c]);
+    return e;
+}
+
+// Every kernel set must produce the scalar kernels' bytes
+static void test_encode_paths(VMBlit2DPath best)
+{
+    for (int i = 0; i < 300; i++) {
+        VMBlockFormat f = (VMBlockFormat)(1 + rnd() % (kVMBlockFormatCount - 1));
+        VMBlockQuality q = (VMBlockQuality)(rnd() % 3);
+        uint32_t w = 1 + rnd() % 40, h = 1 + rnd() % 40;
+        bool bgra = rnd() % 2;
+        std::vector<uint8_t> px;
+        make_image(px, w, h, rnd() % 2);
+        if (rnd() % 4 == 0)
+            for (size_t k = 0; k < px.size(); k++)
+                px[k] = (uint8_t)rnd();
+        if (rnd() % 4 == 0)
+            for (size_t k = 0; k < px.size(); k++)
+                px[k] = rnd() % 3 ? px[k] : (rnd() % 2 ? 0 : 255);
+
+        VMBlockCompressSetPath(kVMBlit2DPathScalar);
+        std::vector<uint8_t> want = encode(f, px, w, h, q, bgra);
+        for (int p = kVMBlit2DPathScalar + 1; p <= best; p++) {
+            VMBlockCompressSetPath((VMBlit2DPath)p);
+            std::vector<uint8_t> got = encode(f, px, w, h, q, bgra);
+            for (size_t k = 0; k < want.size(); k++)
+                if (got[k] != want[k]) {
+                    FAIL("encode %s %s %ux%u on %s differs from scalar at byte %zu\n", format_name(f),
+                         quality_name(q), w, h, VMBlit2DPathName((VMBlit2DPath)p), k);
+                    break;
+                }
+        }
+    }
+}
+
+static void test_encode_exact()
+{
+    // Flat blocks: BC4/BC5 exact, BC1 within 565 rounding
+    for (uint32_t v = 0; v < 256; v += 5) {
+        std::vector<uint8_t> px(16 * 4);
+        for (uint32_t i = 0; i < 16; i++) {
+            px[4 * i] = (uint8_t)v;
+            px[4 * i + 1] = (uint8_t)(255 - v);
+            px[4 * i + 2] = (uint8_t)(v * 7);
+            px[4 * i + 3] = 255;
+        }
+        for (int q = 0; q < 3; q++) {
+            std::vector<uint8_t> bc5 = decode(kVMBlockFormatBC5, encode(kVMBlockFormatBC5, px, 4, 4, (VMBlockQuality)q), 4, 4);
+            if (bc5[0] != px[0] || bc5[1] != px[1])
+                FAIL("flat %u %s bc5 decodes to %u,%u\n", v, quality_name((VMBlockQuality)q), bc5[0], bc5[1]);
+            std::vector<uint8_t> bc1 = decode(kVMBlockFormatBC1, encode(kVMBlockFormatBC1, px, 4, 4, (VMBlockQuality)q), 4, 4);
+            for (uint32_t c = 0; c < 3; c++)
+                if (abs(bc1[c] - px[c]) > 4 || bc1[3] != 255)
+                    FAIL("flat %u %s bc1 channel %u decodes to %u\n", v, quality_name((VMBlockQuality)q), c, bc1[c]);
+        }
+    }
+
+    // Two levels per block survive single-channel formats unchanged
+    for (int i = 0; i < 200; i++) {
+        std::vector<uint8_t> px(16 * 4);
+        uint8_t lv[2] = { (uint8_t)rnd(), (uint8_t)rnd() };
+        for (uint32_t k = 0; k < 16; k++) {
+            px[4 * k] = lv[rnd() % 2];
+            px[4 * k + 3] = lv[rnd() % 2];
+        }
+        std::vector<uint8_t> bc4 = decode(kVMBlockFormatBC4, encode(kVMBlockFormatBC4, px, 4, 4, kVMBlockQualityFast), 4, 4);
+        std::vector<uint8_t> bc3 = decode(kVMBlockFormatBC3, encode(kVMBlockFormatBC3, px, 4, 4, kVMBlockQualityFast), 4, 4);
+        for (uint32_t k = 0; k < 16; k++) {
+            if (bc4[4 * k] != px[4 * k])
+                FAIL("two-level bc4 pixel %u got %u want %u\n", k, bc4[4 * k], px[4 * k]);
+            if (bc3[4 * k + 3] != px[4 * k + 3])
+                FAIL("two-level bc3 alpha %u got %u want %u\n", k, bc3[4 * k + 3], px[4 * k + 3]);
+        }
+    }
+
+    // BC1 alpha is a threshold at 128; transparent pixels are black
+    std::vector<uint8_t> px;
+    make_image(px, 64, 64, true);
+    for (int q = 0; q < 3; q++) {
+        std::vector<uint8_t> got = decode(kVMBlockFormatBC1, encode(kVMBlockFormatBC1, px, 64, 64, (VMBlockQuality)q), 64, 64);
+        for (size_t k = 0; k < px.size(); k += 4) {
+            bool clear = px[k + 3] < 128;
+            if (got[k + 3] != (clear ? 0 : 255) || (clear && (got[k] | got[k + 1] | got[k + 2]))) {
+                FAIL("bc1 %s pixel %zu alpha %u decodes to %u,%u,%u,%u\n", quality_name((VMBlockQuality)q),
+                     k / 4, px[k + 3], got[k], got[k + 1], got[k + 2], got[k + 3]);
+                break;
+            }
+        }
+    }
+}
+
+// Fast <= Normal <= High in quality, and no worse than loose bounds
+static void test_encode_quality()
+{
+    const uint32_t w = 256, h = 256;
+    // RMS error per stored channel that each quality must beat
+    static const double limit[kVMBlockFormatCount][3] = {
+        { 0, 0, 0 }, { 8, 6, 5 }, { 8, 6, 5 }, { 8, 6, 5 }, { 3, 3, 2 }, { 3, 3, 2 },
+    };
+    std::vector<uint8_t> px, opaque;
+    make_image(px, w, h, false);
+    opaque = px;
+    for (size_t k = 3; k < opaque.size(); k += 4)
+        opaque[k] = 255;
+    for (int f = 1; f < kVMBlockFormatCount; f++) {
+        // BC1 alpha is a cutout, measured by test_encode_exact
+        const std::vector<uint8_t>& src = f == kVMBlockFormatBC1 ? opaque : px;
+        double previous = 1e30;
+        printf(LOG_TAG "   %s rms", format_name((VMBlockFormat)f));
+        for (int q = 0; q < 3; q++) {
+            std::vector<uint8_t> got = decode((VMBlockFormat)f, encode((VMBlockFormat)f, src, w, h, (VMBlockQuality)q), w, h);
+            double e = squared_error((VMBlockFormat)f, src, got);
+            uint32_t channels = f == kVMBlockFormatBC4 ? 1 : f == kVMBlockFormatBC5 ? 2 : f == kVMBlockFormatBC1 ? 3 : 4;
+            double rms = sqrt(e / ((double)w * h * channels));
+            printf(" %s %.2f", quality_name((VMBlockQuality)q), rms);
+            if (rms > limit[f][q])
+                FAIL("%s %s rms %.2f over %.2f\n", format_name((VMBlockFormat)f), quality_name((VMBlockQuality)q),
+                     rms, limit[f][q]);
+            if (q == kVMBlockQualityHigh && e > previous)
+                FAIL("%s high error %.0f above normal %.0f\n", format_name((VMBlockFormat)f), e, previous);
+            previous = e;
+        }
+        printf("\n");
+    }
+}
+
+#pragma mark - Arguments
+
+static void test_arguments()
+{
+    uint8_t pixels[64], blocks[16];
+    memset(pixels, 0x11, sizeof(pixels));
+    memset(blocks, 0x22, sizeof(blocks));
+    VMPixelImage px = { pixels, 16, kVMPixelFormatRGBA8 };
+    VMPixelImage rgb = { pixels, 16, kVMPixelFormatRGB8 };
+    VMPixelImage narrow = { pixels, 15, kVMPixelFormatRGBA8 };
+    VMBlockImage bc = { blocks, 16, kVMBlockFormatBC3 };
+    VMBlockImage bad = { blocks, 16, kVMBlockFormatInvalid };
+    VMBlockImage short_row = { blocks, 8, kVMBlockFormatBC3 };
+
+    if (VMBlockCompress(&bad, &px, 4, 4, kVMBlockQualityFast))
+        FAIL("invalid block format accepted\n");
+    if (VMBlockCompress(&bc, &rgb, 4, 4, kVMBlockQualityFast))
+        FAIL("rgb8 source accepted\n");
+    if (VMBlockCompress(&bc, &narrow, 4, 4, kVMBlockQualityFast))
+        FAIL("short source pitch accepted\n");
+    if (VMBlockCompress(&short_row, &px, 4, 4, kVMBlockQualityFast))
+        FAIL("short block row accepted\n");
+    if (VMBlockCompress(&bc, &px, 4, 4, (VMBlockQuality)3))
+        FAIL("unknown quality accepted\n");
+    if (VMBlockCompress(&bc, NULL, 4, 4, kVMBlockQualityFast))
+        FAIL("null source accepted\n");
+    for (size_t i = 0; i < sizeof(blocks); i++)
+        if (blocks[i] != 0x22) {
+            FAIL("refused compression wrote the destination\n");
+            break;
+        }
+
+    if (VMBlockDecompress(&px, &bad, 4, 4))
+        FAIL("invalid block format decoded\n");
+    if (VMBlockDecompress(&rgb, &bc, 4, 4))
+        FAIL("decode to rgb8 accepted\n");
+    if (VMBlockDecompress(&narrow, &bc, 4, 4))
+        FAIL("short destination pitch accepted\n");
+    if (VMBlockDecompress(&px, &short_row, 4, 4))
+        FAIL("short block row decoded\n");
+    for (size_t i = 0; i < sizeof(pixels); i++)
+        if (pixels[i] != 0x11) {
+            FAIL("refused decompression wrote the destination\n");
+            break;
+        }
+
+    if (!VMBlockCompress(&bc, &px, 0, 4, kVMBlockQualityFast) || !VMBlockDecompress(&px, &bc, 4, 0))
+        FAIL("empty image refused\n");
+    if (VMBlockImageBytes(kVMBlockFormatBC1, 5, 9) != 2 * 3 * 8 || VMBlockImageBytes(kVMBlockFormatInvalid, 4, 4))
+        FAIL("image size wrong\n");
+    if (VMBlockQualityFromPercent(0) != kVMBlockQualityFast || VMBlockQualityFromPercent(50) != kVMBlockQualityNormal ||
+        VMBlockQualityFromPercent(100) != kVMBlockQualityHigh)
+        FAIL("quality mapping wrong\n");
+}
+
+#pragma mark - Benchmark
+
+static void bench(VMBlit2DPath best)
+{
+    const uint32_t w = 2048, h = 2048;
+    const double mp = (double)w * h * 1e-6;
+    std::vector<uint8_t> px, opaque;
+    make_image(px, w, h, false);
+    opaque = px;
+    for (size_t k = 3; k < opaque.size(); k += 4)
+        opaque[k] = 255;
+
+    printf("%-22s", "2048x2048, MP/s");
+    for (int p = kVMBlit2DPathScalar; p <= best; p++)
+        printf(" %8s", VMBlit2DPathName((VMBlit2DPath)p));
+    printf("\n");
+
+    for (int f = 1; f < kVMBlockFormatCount; f++) {
+        for (int q = 0; q < 3; q++) {
+            printf("encode %s %-8s", format_name((VMBlockFormat)f), quality_name((VMBlockQuality)q));
+            for (int p = kVMBlit2DPathScalar; p <= best; p++) {
+                VMBlockCompressSetPath((VMBlit2DPath)p);
+                double t0 = now_sec();
+                std::vector<uint8_t> out = encode((VMBlockFormat)f, f == kVMBlockFormatBC1 ? opaque : px,
+                                                  w, h, (VMBlockQuality)q);
+                double t = now_sec() - t0;
+                s_sink += out[0];
+                printf(" %8.1f", mp / t);
+            }
+            printf("\n");
+        }
+    }
+
+    for (int f = 1; f < kVMBlockFormatCount; f++) {
+        VMBlockCompressSetPath(best);
+        std::vector<uint8_t> blocks = encode((VMBlockFormat)f, px, w, h, kVMBlockQualityNormal);
+        std::vector<uint8_t> out((size_t)w * h * 4);
+        VMBlockImage src = { blocks.data(), w / 4 * VMBlockFormatBytes((VMBlockFormat)f), (VMBlockFormat)f };
+        VMPixelImage dst = { out.data(), w * 4, kVMPixelFormatRGBA8 };
+        printf("decode %-15s", format_name((VMBlockFormat)f));
+        for (int p = kVMBlit2DPathScalar; p <= best; p++) {
+            VMBlockCompressSetPath((VMBlit2DPath)p);
+            VMBlockDecompress(&dst, &src, w, h);
+            const int reps = 10;
+            double t0 = now_sec();
+            for (int r = 0; r < reps; r++)
+                VMBlockDecompress(&dst, &src, w, h);
+            double t = (now_sec() - t0) / reps;
+            s_sink += out[0];
+            printf(" %8.1f", mp / t);
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool run_bench = !(argc > 1 && strcmp(argv[1], "--no-bench") == 0);
+    VMBlit2DPath best = VMBlit2DBestPath();
+    printf(LOG_TAG " best path on this CPU: %s%s\n", VMBlit2DPathName(best),
+           VMBlit2DHasSSSE3() ? " (ssse3)" : "");
+
+    test_arguments();
+    printf(LOG_TAG " arguments %s\n", s_failures ? "FAILED" : "ok");
+
+    for (int p = kVMBlit2DPathScalar; p <= best; p++) {
+        VMBlit2DPath path = VMBlockCompressSetPath((VMBlit2DPath)p);
+        int before = s_failures;
+        test_golden();
+        test_decode(3000);
+        test_encode_exact();
+        printf(LOG_TAG " %-7s%s %s\n", VMBlit2DPathName(path),
+               path == kVMBlit2DPathSSE2 && !VMBlockCompressUsesSSSE3() ? " (no ssse3, sse2 bounds only)" : "",
+               s_failures == before ? "ok" : "FAILED");
+    }
+
+    int before = s_failures;
+    test_encode_paths(best);
+    printf(LOG_TAG " encoder identical on every kernel set %s\n", s_failures == before ? "ok" : "FAILED");
+
+    VMBlockCompressSetPath(best);
+    before = s_failures;
+    test_encode_quality();
+    printf(LOG_TAG " encoder quality %s\n", s_failures == before ? "ok" : "FAILED");
+
+    if (s_failures) {
+        printf(LOG_TAG " %d failures\n", s_failures);
+        return 1;
+    }
+
+    if (run_bench) {
+        printf("\n");
+        bench(best);
+    }
+    return 0;
+}
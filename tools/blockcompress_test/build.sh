@@ -0,0 +1,17 @@
+#!/bin/bash
+# Build and run blockcompress_test: FB/VMBlockCompress.cpp decoded against a
+# reference and encoded on every kernel set the host CPU supports, then
+# benchmarked. Runs on any x86_64 Linux or macOS host; the codec has no
+# IOKit dependency.
+set -e
+
+cd "$(dirname "$0")"
+
+CXX=${CXX:-c++}
+
+$CXX -O2 -std=c++11 -Wall -Wno-unknown-pragmas -I../../FB \
+     -o blockcompress_test blockcompress_test.cpp ../../FB/VMBlockCompress.cpp ../../FB/VMBlit2D.cpp -lm
+
+echo "Built: $(pwd)/blockcompress_test"
+echo
+./blockcompress_test "$@"
@@ -0,0 +1,18 @@
+#!/bin/bash
+# Build and run cursorblit_bench: the vector cursor kernels checked
+# bit-for-bit against the IOCursorBlits.h originals, then timed per move at
+# 1x and 2x cursor sizes. Runs on any x86_64 Linux or macOS host.
+set -e
+
+cd "$(dirname "$0")"
+
+CXX=${CXX:-c++}
+
+$CXX -O2 -std=c++11 -fno-strict-aliasing -Wall -Wno-unused-function \
+     -Wno-class-memaccess -Wno-unused-but-set-variable \
+     -I../../IOGraphics/IOGraphicsFamily \
+     -o cursorblit_bench cursorblit_bench.cpp
+
+echo "Built: $(pwd)/cursorblit_bench"
+echo
+./cursorblit_bench "$@"
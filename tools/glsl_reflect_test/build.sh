@@ -0,0 +1,27 @@
+#!/bin/bash
+# Build and run glsl_reflect_test: FB/glsl_reflect.h checked against golden
+# std140 layouts and the corpus, fuzzed under ASan/UBSan, then benchmarked.
+# Runs on any Linux or macOS host; the reflector has no IOKit dependency.
+set -e
+
+cd "$(dirname "$0")"
+
+CC=${CC:-cc}
+CXX=${CXX:-c++}
+FUZZ_ITERATIONS=${FUZZ_ITERATIONS:-200000}
+SANITIZE="-fsanitize=address,undefined -fno-sanitize-recover=all -fno-omit-frame-pointer"
+
+build() {
+    local out=$1; shift
+    $CC "$@" -std=c99 -Wall -Wextra -I../../FB -c -o "$out.o" reflect_c_check.c
+    $CXX "$@" -std=c++11 -Wall -Wextra -I../../FB -o "$out" glsl_reflect_test.cpp "$out.o"
+    rm -f "$out.o"
+}
+
+build glsl_reflect_test -O2
+build glsl_reflect_fuzz -O1 -g $SANITIZE
+
+echo "Built: $(pwd)/glsl_reflect_test, $(pwd)/glsl_reflect_fuzz"
+echo
+./glsl_reflect_fuzz --no-bench --fuzz "$FUZZ_ITERATIONS"
+./glsl_reflect_test "$@"
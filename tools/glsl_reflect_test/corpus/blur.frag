@@ -0,0 +1,34 @@
+// WebGL 1 separable Gaussian blur pass from a post-processing chain
+#ifdef GL_ES
+precision mediump float;
+#endif
+
+#define KERNEL_RADIUS 8
+
+uniform sampler2D tDiffuse;
+uniform vec2 resolution;
+uniform vec2 direction;
+uniform float sigma;
+uniform float weights[KERNEL_RADIUS + 1];
+
+varying vec2 vUv;
+
+float gaussianPdf(in float x, in float s) {
+	return 0.39894 * exp(-0.5 * x * x / (s * s)) / s;
+}
+
+void main() {
+	vec2 invSize = 1.0 / resolution;
+	float weightSum = gaussianPdf(0.0, sigma);
+	vec3 diffuseSum = texture2D(tDiffuse, vUv).rgb * weightSum;
+	for (int i = 1; i < KERNEL_RADIUS; i++) {
+		float x = float(i);
+		float w = gaussianPdf(x, sigma);
+		vec2 uvOffset = direction * invSize * x;
+		vec3 sample1 = texture2D(tDiffuse, vUv + uvOffset).rgb;
+		vec3 sample2 = texture2D(tDiffuse, vUv - uvOffset).rgb;
+		diffuseSum += (sample1 + sample2) * w;
+		weightSum += 2.0 * w;
+	}
+	gl_FragColor = vec4(diffuseSum / weightSum, 1.0);
+}
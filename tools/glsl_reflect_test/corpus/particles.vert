@@ -0,0 +1,47 @@
+#version 300 es
+// WebGL 2 GPU particle update/render vertex shader (transform feedback)
+precision highp float;
+precision highp int;
+
+uniform float uTime;
+uniform float uDelta;
+uniform vec3 uGravity;
+uniform vec4 uEmitter[2];
+uniform mat4 uViewProjection;
+uniform highp usampler2D uRandom;
+uniform int uRandomSize;
+
+in vec3 iPosition;
+in vec3 iVelocity;
+in vec2 iAgeLife;
+in uint iSeed;
+
+out vec3 oPosition;
+out vec3 oVelocity;
+out vec2 oAgeLife;
+flat out uint oSeed;
+out float vAlpha;
+
+uvec4 rand(uint seed) {
+	ivec2 coord = ivec2(int(seed) % uRandomSize, int(seed) / uRandomSize);
+	return texelFetch(uRandom, coord, 0);
+}
+
+void main() {
+	float age = iAgeLife.x + uDelta;
+	if (age >= iAgeLife.y) {
+		uvec4 r = rand(iSeed + uint(uTime * 1000.0));
+		vec3 jitter = vec3(r.xyz & 0xFFFFu) / 65535.0 - 0.5;
+		oPosition = uEmitter[0].xyz + jitter * uEmitter[0].w;
+		oVelocity = uEmitter[1].xyz + jitter * uEmitter[1].w;
+		oAgeLife = vec2(0.0, iAgeLife.y);
+	} else {
+		oVelocity = iVelocity + uGravity * uDelta;
+		oPosition = iPosition + oVelocity * uDelta;
+		oAgeLife = vec2(age, iAgeLife.y);
+	}
+	oSeed = iSeed * 1664525u + 1013904223u;
+	vAlpha = 1.0 - oAgeLife.x / oAgeLife.y;
+	gl_PointSize = 4.0;
+	gl_Position = uViewProjection * vec4(oPosition, 1.0);
+}
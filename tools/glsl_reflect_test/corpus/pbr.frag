@@ -0,0 +1,123 @@
+#version 300 es
+// WebGL 2 PBR fragment shader: material block, shadow sampler, IBL cube maps
+precision highp float;
+precision highp sampler2DShadow;
+
+#define MAX_LIGHTS 8
+const int SHADOW_CASCADES = 4;
+
+struct Light {
+	vec4 positionRange;
+	vec4 colorIntensity;
+	vec4 directionCone;
+	ivec4 typeShadow;
+};
+
+layout(std140) uniform Camera {
+	mat4 view;
+	mat4 projection;
+	vec3 position;
+	float exposure;
+} camera;
+
+layout(std140) uniform Lights {
+	Light lights[MAX_LIGHTS];
+	int lightCount;
+	mat4 shadowMatrices[SHADOW_CASCADES];
+	vec4 cascadeSplits;
+};
+
+layout(std140) uniform Material {
+	vec4 baseColorFactor;
+	vec3 emissiveFactor;
+	float metallicFactor;
+	float roughnessFactor;
+	float occlusionStrength;
+	float normalScale;
+	float alphaCutoff;
+} material;
+
+uniform sampler2D uBaseColor;
+uniform sampler2D uMetallicRoughness;
+uniform sampler2D uNormal;
+uniform sampler2D uOcclusion;
+uniform sampler2D uEmissive;
+uniform samplerCube uIrradiance;
+uniform samplerCube uPrefiltered;
+uniform sampler2D uBrdfLut;
+uniform sampler2DShadow uShadowMap;
+uniform float uPrefilteredLevels;
+
+in vec3 vWorldPos;
+in vec2 vUv0;
+in vec2 vUv1;
+in mat3 vTBN;
+
+layout(location = 0) out vec4 fragColor;
+
+const float PI = 3.14159265359;
+
+float D_GGX(float NdotH, float a) {
+	float a2 = a * a;
+	float f = (NdotH * a2 - NdotH) * NdotH + 1.0;
+	return a2 / (PI * f * f);
+}
+
+float V_SmithGGX(float NdotV, float NdotL, float a) {
+	float a2 = a * a;
+	float gv = NdotL * sqrt(NdotV * NdotV * (1.0 - a2) + a2);
+	float gl = NdotV * sqrt(NdotL * NdotL * (1.0 - a2) + a2);
+	return 0.5 / (gv + gl);
+}
+
+vec3 F_Schlick(vec3 f0, float VdotH) {
+	return f0 + (1.0 - f0) * pow(1.0 - VdotH, 5.0);
+}
+
+float shadow(vec3 worldPos) {
+	float depth = -(camera.view * vec4(worldPos, 1.0)).z;
+	int cascade = 0;
+	for (int i = 0; i < SHADOW_CASCADES - 1; ++i) {
+		if (depth > cascadeSplits[i]) cascade = i + 1;
+	}
+	vec4 p = shadowMatrices[cascade] * vec4(worldPos, 1.0);
+	return texture(uShadowMap, p.xyz / p.w);
+}
+
+void main() {
+	vec4 base = texture(uBaseColor, vUv0) * material.baseColorFactor;
+	if (base.a < material.alphaCutoff) discard;
+	vec2 mr = texture(uMetallicRoughness, vUv0).bg;
+	float metallic = mr.x * material.metallicFactor;
+	float roughness = clamp(mr.y * material.roughnessFactor, 0.04, 1.0);
+	vec3 n = texture(uNormal, vUv0).xyz * 2.0 - 1.0;
+	n.xy *= material.normalScale;
+	n = normalize(vTBN * n);
+	vec3 v = normalize(camera.position - vWorldPos);
+	float NdotV = max(dot(n, v), 1e-4);
+	vec3 f0 = mix(vec3(0.04), base.rgb, metallic);
+	vec3 color = vec3(0.0);
+	for (int i = 0; i < MAX_LIGHTS; ++i) {
+		if (i >= lightCount) break;
+		Light light = lights[i];
+		vec3 l = light.positionRange.xyz - vWorldPos;
+		float dist = length(l);
+		l /= dist;
+		vec3 h = normalize(l + v);
+		float NdotL = max(dot(n, l), 0.0);
+		float NdotH = max(dot(n, h), 0.0);
+		float atten = clamp(1.0 - dist / light.positionRange.w, 0.0, 1.0);
+		if (light.typeShadow.y != 0) atten *= shadow(vWorldPos);
+		vec3 F = F_Schlick(f0, max(dot(v, h), 0.0));
+		vec3 spec = D_GGX(NdotH, roughness * roughness) * V_SmithGGX(NdotV, NdotL, roughness * roughness) * F;
+		vec3 diff = (1.0 - F) * (1.0 - metallic) * base.rgb / PI;
+		color += (diff + spec) * light.colorIntensity.rgb * light.colorIntensity.w * NdotL * atten;
+	}
+	vec3 irradiance = texture(uIrradiance, n).rgb;
+	vec3 prefiltered = textureLod(uPrefiltered, reflect(-v, n), roughness * uPrefilteredLevels).rgb;
+	vec2 brdf = texture(uBrdfLut, vec2(NdotV, roughness)).rg;
+	color += irradiance * base.rgb * (1.0 - metallic) + prefiltered * (f0 * brdf.x + brdf.y);
+	color *= mix(1.0, texture(uOcclusion, vUv1).r, material.occlusionStrength);
+	color += texture(uEmissive, vUv0).rgb * material.emissiveFactor;
+	fragColor = vec4(vec3(1.0) - exp(-color * camera.exposure), base.a);
+}
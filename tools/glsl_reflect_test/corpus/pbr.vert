@@ -0,0 +1,40 @@
+#version 300 es
+// WebGL 2 PBR vertex shader with per-frame data in a std140 uniform block
+precision highp float;
+
+layout(std140) uniform Camera {
+	mat4 view;
+	mat4 projection;
+	vec3 position;
+	float exposure;
+} camera;
+
+layout(std140) uniform Object {
+	mat4 model;
+	mat3 normalMatrix;
+	vec4 tint;
+};
+
+layout(location = 0) in vec3 aPosition;
+layout(location = 1) in vec3 aNormal;
+layout(location = 2) in vec4 aTangent;
+layout(location = 3) in vec2 aTexCoord0;
+layout(location = 4) in vec2 aTexCoord1;
+in mat4 aInstanceMatrix;
+
+out vec3 vWorldPos;
+out vec2 vUv0;
+out vec2 vUv1;
+out mat3 vTBN;
+
+void main() {
+	vec4 world = model * aInstanceMatrix * vec4(aPosition, 1.0);
+	vec3 n = normalize(normalMatrix * aNormal);
+	vec3 t = normalize(normalMatrix * aTangent.xyz);
+	vec3 b = cross(n, t) * aTangent.w;
+	vTBN = mat3(t, b, n);
+	vWorldPos = world.xyz;
+	vUv0 = aTexCoord0;
+	vUv1 = aTexCoord1;
+	gl_Position = camera.projection * camera.view * world;
+}
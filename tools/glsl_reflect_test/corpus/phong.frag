@@ -0,0 +1,113 @@
+// WebGL 1 Phong fragment shader: light structs in uniform arrays sized by
+// #define, the way three.js declares them
+#define PHONG
+#define USE_MAP
+#define NUM_DIR_LIGHTS 2
+#define NUM_POINT_LIGHTS 4
+#define NUM_SPOT_LIGHTS 1
+precision highp float;
+precision highp int;
+
+uniform mat4 viewMatrix;
+uniform vec3 cameraPosition;
+uniform bool isOrthographic;
+
+uniform vec3 diffuse;
+uniform vec3 emissive;
+uniform vec3 specular;
+uniform float shininess;
+uniform float opacity;
+
+varying vec3 vViewPosition;
+varying vec3 vNormal;
+
+#ifdef USE_MAP
+	varying vec2 vUv;
+	uniform sampler2D map;
+#endif
+
+uniform vec3 ambientLightColor;
+uniform vec3 lightProbe[ 9 ];
+
+struct DirectionalLight {
+	vec3 direction;
+	vec3 color;
+};
+uniform DirectionalLight directionalLights[ NUM_DIR_LIGHTS ];
+
+struct PointLight {
+	vec3 position;
+	vec3 color;
+	float distance;
+	float decay;
+};
+uniform PointLight pointLights[ NUM_POINT_LIGHTS ];
+
+struct SpotLight {
+	vec3 position;
+	vec3 direction;
+	vec3 color;
+	float distance;
+	float decay;
+	float coneCos;
+	float penumbraCos;
+};
+uniform SpotLight spotLights[ NUM_SPOT_LIGHTS ];
+
+struct ReflectedLight {
+	vec3 directDiffuse;
+	vec3 directSpecular;
+	vec3 indirectDiffuse;
+	vec3 indirectSpecular;
+};
+
+float getDistanceAttenuation( const in float lightDistance, const in float cutoffDistance, const in float decayExponent ) {
+	if ( cutoffDistance > 0.0 && decayExponent > 0.0 ) {
+		return pow( clamp( - lightDistance / cutoffDistance + 1.0, 0.0, 1.0 ), decayExponent );
+	}
+	return 1.0;
+}
+
+vec3 BRDF_BlinnPhong( const in vec3 lightDir, const in vec3 viewDir, const in vec3 normal, const in vec3 specularColor, const in float shininess ) {
+	vec3 halfDir = normalize( lightDir + viewDir );
+	float dotNH = clamp( dot( normal, halfDir ), 0.0, 1.0 );
+	float dotVH = clamp( dot( viewDir, halfDir ), 0.0, 1.0 );
+	vec3 F = specularColor + ( 1.0 - specularColor ) * pow( 1.0 - dotVH, 5.0 );
+	return F * ( 0.25 * ( shininess * 0.5 + 1.0 ) * pow( dotNH, shininess ) );
+}
+
+void main() {
+	vec4 diffuseColor = vec4( diffuse, opacity );
+	ReflectedLight reflectedLight = ReflectedLight( vec3( 0.0 ), vec3( 0.0 ), vec3( 0.0 ), vec3( 0.0 ) );
+#ifdef USE_MAP
+	vec4 texelColor = texture2D( map, vUv );
+	diffuseColor *= texelColor;
+#endif
+	vec3 normal = normalize( vNormal );
+	vec3 viewDir = normalize( vViewPosition );
+	for ( int i = 0; i < NUM_DIR_LIGHTS; i ++ ) {
+		vec3 dir = directionalLights[ i ].direction;
+		float dotNL = clamp( dot( normal, dir ), 0.0, 1.0 );
+		reflectedLight.directDiffuse += dotNL * directionalLights[ i ].color * diffuseColor.rgb;
+		reflectedLight.directSpecular += dotNL * directionalLights[ i ].color * BRDF_BlinnPhong( dir, viewDir, normal, specular, shininess );
+	}
+	for ( int i = 0; i < NUM_POINT_LIGHTS; i ++ ) {
+		vec3 lVector = pointLights[ i ].position - ( - vViewPosition );
+		vec3 dir = normalize( lVector );
+		float att = getDistanceAttenuation( length( lVector ), pointLights[ i ].distance, pointLights[ i ].decay );
+		float dotNL = clamp( dot( normal, dir ), 0.0, 1.0 );
+		reflectedLight.directDiffuse += dotNL * att * pointLights[ i ].color * diffuseColor.rgb;
+	}
+	for ( int i = 0; i < NUM_SPOT_LIGHTS; i ++ ) {
+		vec3 lVector = spotLights[ i ].position - ( - vViewPosition );
+		vec3 dir = normalize( lVector );
+		float angleCos = dot( dir, spotLights[ i ].direction );
+		if ( angleCos > spotLights[ i ].coneCos ) {
+			float spot = smoothstep( spotLights[ i ].coneCos, spotLights[ i ].penumbraCos, angleCos );
+			reflectedLight.directDiffuse += spot * spotLights[ i ].color * diffuseColor.rgb;
+		}
+	}
+	reflectedLight.indirectDiffuse += ambientLightColor * diffuseColor.rgb;
+	vec3 outgoing = reflectedLight.directDiffuse + reflectedLight.indirectDiffuse + reflectedLight.directSpecular + emissive;
+	gl_FragColor = vec4( outgoing, diffuseColor.a );
+}
@@ -0,0 +1,103 @@
+// WebGL 1 Phong vertex shader with skinning and morph targets, in the
+// shape three.js emits after its #include chunks are expanded
+#define PHONG
+#define USE_MAP
+#define USE_SKINNING
+#define USE_MORPHTARGETS
+#define NUM_DIR_LIGHTS 2
+#define NUM_POINT_LIGHTS 4
+precision highp float;
+precision highp int;
+
+uniform mat4 modelMatrix;
+uniform mat4 modelViewMatrix;
+uniform mat4 projectionMatrix;
+uniform mat4 viewMatrix;
+uniform mat3 normalMatrix;
+uniform vec3 cameraPosition;
+uniform bool isOrthographic;
+
+attribute vec3 position;
+attribute vec3 normal;
+attribute vec2 uv;
+
+varying vec3 vViewPosition;
+varying vec3 vNormal;
+
+#ifdef USE_MAP
+	varying vec2 vUv;
+	uniform mat3 uvTransform;
+#endif
+
+#ifdef USE_MORPHTARGETS
+	attribute vec3 morphTarget0;
+	attribute vec3 morphTarget1;
+	attribute vec3 morphTarget2;
+	attribute vec3 morphTarget3;
+	uniform float morphTargetBaseInfluence;
+	uniform float morphTargetInfluences[ 4 ];
+#endif
+
+#ifdef USE_SKINNING
+	attribute vec4 skinIndex;
+	attribute vec4 skinWeight;
+	uniform mat4 bindMatrix;
+	uniform mat4 bindMatrixInverse;
+	uniform highp sampler2D boneTexture;
+	uniform int boneTextureSize;
+	mat4 getBoneMatrix( const in float i ) {
+		float j = i * 4.0;
+		float x = mod( j, float( boneTextureSize ) );
+		float y = floor( j / float( boneTextureSize ) );
+		float dx = 1.0 / float( boneTextureSize );
+		float dy = 1.0 / float( boneTextureSize );
+		y = dy * ( y + 0.5 );
+		vec4 v1 = texture2D( boneTexture, vec2( dx * ( x + 0.5 ), y ) );
+		vec4 v2 = texture2D( boneTexture, vec2( dx * ( x + 1.5 ), y ) );
+		vec4 v3 = texture2D( boneTexture, vec2( dx * ( x + 2.5 ), y ) );
+		vec4 v4 = texture2D( boneTexture, vec2( dx * ( x + 3.5 ), y ) );
+		mat4 bone = mat4( v1, v2, v3, v4 );
+		return bone;
+	}
+#endif
+
+#define saturate( a ) clamp( a, 0.0, 1.0 )
+#define PI 3.141592653589793
+
+float pow2( const in float x ) { return x*x; }
+vec3 transformDirection( in vec3 dir, in mat4 matrix ) {
+	return normalize( ( matrix * vec4( dir, 0.0 ) ).xyz );
+}
+
+void main() {
+#ifdef USE_MAP
+	vUv = ( uvTransform * vec3( uv, 1 ) ).xy;
+#endif
+	vec3 objectNormal = vec3( normal );
+	vec3 transformed = vec3( position );
+#ifdef USE_MORPHTARGETS
+	transformed *= morphTargetBaseInfluence;
+	transformed += morphTarget0 * morphTargetInfluences[ 0 ];
+	transformed += morphTarget1 * morphTargetInfluences[ 1 ];
+	transformed += morphTarget2 * morphTargetInfluences[ 2 ];
+	transformed += morphTarget3 * morphTargetInfluences[ 3 ];
+#endif
+#ifdef USE_SKINNING
+	mat4 boneMatX = getBoneMatrix( skinIndex.x );
+	mat4 boneMatY = getBoneMatrix( skinIndex.y );
+	mat4 boneMatZ = getBoneMatrix( skinIndex.z );
+	mat4 boneMatW = getBoneMatrix( skinIndex.w );
+	vec4 skinVertex = bindMatrix * vec4( transformed, 1.0 );
+	vec4 skinned = vec4( 0.0 );
+	skinned += boneMatX * skinVertex * skinWeight.x;
+	skinned += boneMatY * skinVertex * skinWeight.y;
+	skinned += boneMatZ * skinVertex * skinWeight.z;
+	skinned += boneMatW * skinVertex * skinWeight.w;
+	transformed = ( bindMatrixInverse * skinned ).xyz;
+#endif
+	vec3 transformedNormal = normalMatrix * objectNormal;
+	vNormal = normalize( transformedNormal );
+	vec4 mvPosition = modelViewMatrix * vec4( transformed, 1.0 );
+	gl_Position = projectionMatrix * mvPosition;
+	vViewPosition = - mvPosition.xyz;
+}
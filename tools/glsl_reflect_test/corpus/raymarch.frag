@@ -0,0 +1,72 @@
+#version 300 es
+// WebGL 2 full-screen raymarcher of the kind shader playgrounds run
+precision highp float;
+
+uniform vec3 iResolution;
+uniform float iTime;
+uniform vec4 iMouse;
+uniform sampler2D iChannel0;
+uniform sampler2D iChannel1;
+
+out vec4 outColor;
+
+#define MAX_STEPS 128
+#define MAX_DIST 100.0
+#define SURF_DIST 0.001
+
+mat2 rot(float a) { float s = sin(a), c = cos(a); return mat2(c, -s, s, c); }
+
+float sdBox(vec3 p, vec3 b) {
+	vec3 q = abs(p) - b;
+	return length(max(q, 0.0)) + min(max(q.x, max(q.y, q.z)), 0.0);
+}
+
+float sdTorus(vec3 p, vec2 t) {
+	vec2 q = vec2(length(p.xz) - t.x, p.y);
+	return length(q) - t.y;
+}
+
+float map(vec3 p) {
+	vec3 q = p;
+	q.xz *= rot(iTime * 0.3);
+	float d = sdTorus(q - vec3(0, 1, 0), vec2(1.5, 0.4));
+	d = min(d, sdBox(p - vec3(0, -0.5, 0), vec3(4, 0.1, 4)));
+	d += texture(iChannel1, p.xz * 0.1).r * 0.02;
+	return d;
+}
+
+vec3 normal(vec3 p) {
+	vec2 e = vec2(0.001, 0);
+	return normalize(map(p) - vec3(map(p - e.xyy), map(p - e.yxy), map(p - e.yyx)));
+}
+
+float march(vec3 ro, vec3 rd) {
+	float d = 0.0;
+	for (int i = 0; i < MAX_STEPS; i++) {
+		float s = map(ro + rd * d);
+		d += s;
+		if (d > MAX_DIST || abs(s) < SURF_DIST) break;
+	}
+	return d;
+}
+
+void main() {
+	vec2 uv = (gl_FragCoord.xy - 0.5 * iResolution.xy) / iResolution.y;
+	vec2 m = iMouse.xy / iResolution.xy;
+	vec3 ro = vec3(0, 3, -6);
+	ro.yz *= rot(-m.y * 3.14 + 1.0);
+	ro.xz *= rot(-m.x * 6.2831);
+	vec3 f = normalize(-ro), r = normalize(cross(vec3(0, 1, 0), f)), u = cross(f, r);
+	vec3 rd = normalize(f + uv.x * r + uv.y * u);
+	float d = march(ro, rd);
+	vec3 col = vec3(0);
+	if (d < MAX_DIST) {
+		vec3 p = ro + rd * d;
+		vec3 n = normal(p);
+		float dif = clamp(dot(n, normalize(vec3(1, 2, 3))), 0.0, 1.0);
+		col = dif * texture(iChannel0, p.xz * 0.25).rgb;
+	} else {
+		col = vec3(0.6, 0.7, 0.9) - rd.y * 0.3;
+	}
+	outColor = vec4(pow(col, vec3(0.4545)), 1.0);
+}
@@ -0,0 +1,19 @@
+// WebGL 1 signed-distance-field text fragment shader
+#extension GL_OES_standard_derivatives : enable
+precision mediump float;
+
+uniform sampler2D u_texture;
+uniform float u_buffer;
+uniform float u_gamma;
+uniform vec4 u_outlineColor;
+
+varying vec2 v_texcoord;
+varying lowp vec4 v_color;
+
+void main() {
+	float dist = texture2D(u_texture, v_texcoord).a;
+	float width = fwidth(dist) * u_gamma;
+	float alpha = smoothstep(u_buffer - width, u_buffer + width, dist);
+	float outline = smoothstep(u_buffer - 0.1 - width, u_buffer - 0.1 + width, dist);
+	gl_FragColor = mix(u_outlineColor, v_color, alpha) * outline;
+}
@@ -0,0 +1,16 @@
+// WebGL 1 text/sprite batch vertex shader
+attribute vec2 a_position;
+attribute vec2 a_texcoord;
+attribute vec4 a_color;
+
+uniform mat3 u_matrix;
+uniform vec2 u_textureSize;
+
+varying vec2 v_texcoord;
+varying lowp vec4 v_color;
+
+void main() {
+	gl_Position = vec4((u_matrix * vec3(a_position, 1)).xy, 0, 1);
+	v_texcoord = a_texcoord / u_textureSize;
+	v_color = a_color;
+}
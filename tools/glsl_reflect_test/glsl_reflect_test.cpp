@@ -0,0 +1,512 @@
+// Golden, fuzz and throughput suite for FB/glsl_reflect.h.
+//
+// Golden cases pin names, kinds, GL types and std140 offsets for every
+// layout rule the reflector implements, checked against the std140 rules
+// in the GL 4.1 spec (section 7.6.2.2). The fuzzer feeds mutated corpus
+// shaders and random token soup through the reflector under ASan/UBSan and
+// checks the output invariants. The benchmark reflects the corpus in a loop.
+
+#include "glsl_reflect.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LOG_TAG "[glsl_reflect]"
+#define CORPUS_DIR "corpus"
+#define MAX_CORPUS 64
+
+extern "C" uint32_t reflect_c_check(void);
+
+static int s_failures = 0;
+
+static glsl_reflect_var s_vars[512];
+static glsl_reflect_block s_blocks[24];
+static glsl_reflection s_reflection;
+
+static double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void check(bool ok, const char* what)
+{
+    if (!ok) {
+        s_failures++;
+        fprintf(stderr, LOG_TAG " FAIL %s\n", what);
+    }
+}
+
+static const glsl_reflection* reflect(const char* source, uint32_t stage,
+                                      uint32_t var_capacity = 512)
+{
+    s_reflection.vars = s_vars;
+    s_reflection.var_capacity = var_capacity;
+    s_reflection.blocks = s_blocks;
+    s_reflection.block_capacity = sizeof(s_blocks) / sizeof(s_blocks[0]);
+    glsl_reflect(&s_reflection, source, strlen(source), stage);
+    return &s_reflection;
+}
+
+static const glsl_reflect_var* find(const glsl_reflection* r, const char* name, uint32_t kind)
+{
+    for (uint32_t i = 0; i < r->var_count; i++) {
+        if (r->vars[i].kind == kind && strcmp(r->vars[i].name, name) == 0) {
+            return &r->vars[i];
+        }
+    }
+    return NULL;
+}
+
+// One expected variable: kind, GL type, array size and std140 offset
+struct expect_var {
+    const char* name;
+    uint32_t kind;
+    uint32_t gl_type;
+    uint32_t array_size;
+    uint32_t offset;
+};
+
+static void expect_vars(const char* what, const glsl_reflection* r,
+                        const expect_var* expected, uint32_t count)
+{
+    bool ok = r->var_count == count && r->overflow == 0 && r->errors == 0;
+    for (uint32_t i = 0; ok && i < count; i++) {
+        const glsl_reflect_var* v = &r->vars[i];
+        ok = strcmp(v->name, expected[i].name) == 0 && v->kind == expected[i].kind &&
+             v->gl_type == expected[i].gl_type && v->array_size == expected[i].array_size &&
+             v->offset == expected[i].offset;
+    }
+    if (ok) {
+        return;
+    }
+    s_failures++;
+    fprintf(stderr, LOG_TAG " FAIL %s: %u vars (want %u), overflow %u, errors %u\n",
+            what, r->var_count, count, r->overflow, r->errors);
+    uint32_t n = r->var_count > count ? r->var_count : count;
+    for (uint32_t i = 0; i < n; i++) {
+        if (i < r->var_count) {
+            const glsl_reflect_var* v = &r->vars[i];
+            fprintf(stderr, "  got  %-28s kind %u type 0x%04x [%u] @%u\n",
+                    v->name, v->kind, v->gl_type, v->array_size, v->offset);
+        }
+        if (i < count) {
+            fprintf(stderr, "  want %-28s kind %u type 0x%04x [%u] @%u\n",
+                    expected[i].name, expected[i].kind, expected[i].gl_type,
+                    expected[i].array_size, expected[i].offset);
+        }
+    }
+}
+
+#define EXPECT_VARS(what, r, ...) \
+    do { \
+        static const expect_var expected[] = { __VA_ARGS__ }; \
+        expect_vars(what, r, expected, sizeof(expected) / sizeof(expected[0])); \
+    } while (0)
+
+enum { U = GLSL_VAR_UNIFORM, S = GLSL_VAR_SAMPLER, M = GLSL_VAR_BLOCK_MEMBER,
+       I = GLSL_VAR_INPUT, O = GLSL_VAR_OUTPUT };
+
+static void test_golden()
+{
+    const glsl_reflection* r;
+
+    // std140 base alignments: vec3 takes 16 but leaves its last 4 bytes to
+    // a following scalar; arrays and matrices stride by vec4
+    r = reflect("uniform float a; uniform vec3 b; uniform float c; uniform vec2 d;\n"
+                "uniform float e[3]; uniform mat3 f; uniform vec2 g; uniform mat2x3 h;\n"
+                "uniform bool i; uniform ivec2 j; uniform uvec4 k;",
+                GLSL_STAGE_FRAGMENT);
+    EXPECT_VARS("default block scalars and vectors", r,
+                { "a", U, 0x1406, 1, 0 }, { "b", U, 0x8B51, 1, 16 }, { "c", U, 0x1406, 1, 28 },
+                { "d", U, 0x8B50, 1, 32 }, { "e", U, 0x1406, 3, 48 }, { "f", U, 0x8B5B, 1, 96 },
+                { "g", U, 0x8B50, 1, 144 }, { "h", U, 0x8B65, 1, 160 }, { "i", U, 0x8B56, 1, 192 },
+                { "j", U, 0x8B53, 1, 200 }, { "k", U, 0x8DC8, 1, 208 });
+    check(r->default_block_size == 224, "default block size rounds to 16");
+    check(find(r, "e", U) && find(r, "e", U)->size == 16, "float[] stride is 16");
+    check(find(r, "f", U) && find(r, "f", U)->size == 48, "mat3 is three vec4 columns");
+    check(find(r, "h", U) && find(r, "h", U)->size == 32, "mat2x3 is two vec4 columns");
+
+    // Doubles align to 8 and dvec3/dvec4 to 32
+    r = reflect("#version 400\nuniform float a; uniform double b; uniform dvec3 c; uniform dmat2 d;",
+                GLSL_STAGE_VERTEX);
+    EXPECT_VARS("doubles", r,
+                { "a", U, 0x1406, 1, 0 }, { "b", U, 0x140A, 1, 8 }, { "c", U, 0x8FFD, 1, 32 },
+                { "d", U, 0x8F46, 1, 64 });
+    check(r->version == 400, "#version parsed");
+
+    // Uniform blocks: instance names prefix members with the block name,
+    // row_major swaps the vector count of non-square matrices
+    r = reflect("#version 330\n"
+                "layout(std140, binding = 3) uniform Frame { mat4 viewProj; vec3 eye; float time; } frame;\n"
+                "layout(std140, row_major) uniform Skin { mat4x2 a; layout(column_major) mat4x2 b; };\n"
+                "uniform Pass { vec2 texel[2]; } passes[4];\n",
+                GLSL_STAGE_VERTEX);
+    EXPECT_VARS("uniform blocks", r,
+                { "Frame.viewProj", M, 0x8B5C, 1, 0 }, { "Frame.eye", M, 0x8B51, 1, 64 },
+                { "Frame.time", M, 0x1406, 1, 76 }, { "a", M, 0x8B69, 1, 0 },
+                { "b", M, 0x8B69, 1, 32 }, { "Pass.texel", M, 0x8B50, 2, 0 });
+    check(r->block_count == 3, "three blocks");
+    if (r->block_count == 3) {
+        check(r->blocks[0].size == 80 && r->blocks[0].binding == 3, "Frame size and binding");
+        check(r->blocks[1].size == 96, "Skin: row_major mat4x2 is 2 rows, column_major 4 columns");
+        check(r->blocks[2].size == 32 && r->blocks[2].array_size == 4, "Pass instance array");
+        check(r->blocks[0].first_var == 0 && r->blocks[0].var_count == 3, "Frame member range");
+    }
+
+    // Structs: flattened names, struct alignment rounds to 16, one-element
+    // arrays keep their subscript, nested structs
+    r = reflect("#define N 2\n"
+                "struct Inner { float x; vec2 y; };\n"
+                "struct Light { vec3 color; float power; Inner inner[N]; };\n"
+                "uniform Light lights[N];\n"
+                "uniform Inner one[1];\n"
+                "uniform float tail;\n",
+                GLSL_STAGE_FRAGMENT);
+    EXPECT_VARS("struct arrays", r,
+                { "lights[0].color", U, 0x8B51, 1, 0 }, { "lights[0].power", U, 0x1406, 1, 12 },
+                { "lights[0].inner[0].x", U, 0x1406, 1, 16 }, { "lights[0].inner[0].y", U, 0x8B50, 1, 24 },
+                { "lights[0].inner[1].x", U, 0x1406, 1, 32 }, { "lights[0].inner[1].y", U, 0x8B50, 1, 40 },
+                { "lights[1].color", U, 0x8B51, 1, 48 }, { "lights[1].power", U, 0x1406, 1, 60 },
+                { "lights[1].inner[0].x", U, 0x1406, 1, 64 }, { "lights[1].inner[0].y", U, 0x8B50, 1, 72 },
+                { "lights[1].inner[1].x", U, 0x1406, 1, 80 }, { "lights[1].inner[1].y", U, 0x8B50, 1, 88 },
+                { "one[0].x", U, 0x1406, 1, 96 }, { "one[0].y", U, 0x8B50, 1, 104 },
+                { "tail", U, 0x1406, 1, 112 });
+
+    // Inputs, outputs, locations, samplers, varying direction per stage
+    r = reflect("#version 300 es\n"
+                "precision mediump float;\n"
+                "layout(location = 2) in vec4 pos;\n"
+                "in mat4 instance;\n"
+                "attribute vec2 uv;\n"
+                "varying vec2 vUv;\n"
+                "flat out int id;\n"
+                "uniform sampler2D tex; uniform samplerCube env[2];\n"
+                "layout(binding = 5) uniform highp usampler2D lut;\n",
+                GLSL_STAGE_VERTEX);
+    EXPECT_VARS("inputs, outputs and samplers", r,
+                { "pos", I, 0x8B52, 1, 0 }, { "instance", I, 0x8B5C, 1, 0 }, { "uv", I, 0x8B50, 1, 0 },
+                { "vUv", O, 0x8B50, 1, 0 }, { "id", O, 0x1404, 1, 0 }, { "tex", S, 0x8B5E, 1, 0 },
+                { "env", S, 0x8B60, 2, 16 }, { "lut", S, 0x8DD2, 1, 48 });
+    check(find(r, "pos", I) && find(r, "pos", I)->location == 2, "layout(location)");
+    check(find(r, "instance", I) && find(r, "instance", I)->columns == 4, "mat4 input columns");
+    check(find(r, "lut", S) && find(r, "lut", S)->binding == 5, "layout(binding)");
+    r = reflect("varying vec2 vUv;", GLSL_STAGE_FRAGMENT);
+    check(find(r, "vUv", I) != NULL, "varying is an input in fragment shaders");
+
+    // Preprocessor: every branch is read, duplicates are reported once;
+    // directives, comments and continuations are not declarations
+    r = reflect("// uniform float commented;\n"
+                "/* uniform float block_commented; */\n"
+                "#define SIZE 4 // trailing comment\n"
+                "#define MACRO(x) (x)\n"
+                "#if defined(A) \\\n"
+                "    && uniform_in_continuation\n"
+                "uniform vec4 color;\n"
+                "#else\n"
+                "uniform vec4 color;\n"
+                "#endif\n"
+                "const int COUNT = 3;\n"
+                "uniform float weights[SIZE * 2 + (COUNT - 1)];\n"
+                "uniform vec2 offsets[ 0x4 ];\n",
+                GLSL_STAGE_FRAGMENT);
+    EXPECT_VARS("preprocessor and constants", r,
+                { "color", U, 0x8B52, 1, 0 }, { "weights", U, 0x1406, 10, 16 },
+                { "offsets", U, 0x8B50, 4, 176 });
+
+    // Function bodies are skipped but counted; locals are not uniforms
+    r = reflect("uniform float u;\n"
+                "float f(in float x) { float uniform_like = x; return uniform_like; }\n"
+                "void main() {\n"
+                "  vec4 c = texture2D(s, vec2(0)); c += texelFetch(t, ivec2(0), 0);\n"
+                "  if (u > 0.0) { for (int i = 0; i < 3; i++) { while (false) {} } }\n"
+                "}\n",
+                GLSL_STAGE_FRAGMENT);
+    EXPECT_VARS("function bodies", r, { "u", U, 0x1406, 1, 0 });
+    check(r->functions == 2 && r->branches == 1 && r->loops == 2 && r->texture_calls == 2,
+          "function statistics");
+
+    // Length bounds the source: nothing past len is read
+    const char* cut = "uniform vec4 kept; uniform vec4 dropped;";
+    s_reflection.vars = s_vars;
+    s_reflection.var_capacity = 512;
+    s_reflection.blocks = s_blocks;
+    s_reflection.block_capacity = 24;
+    glsl_reflect(&s_reflection, cut, 18, GLSL_STAGE_FRAGMENT);
+    check(s_reflection.var_count == 1 && strcmp(s_vars[0].name, "kept") == 0, "length bounds source");
+
+    // Capacity: extra variables are counted, never written
+    memset(s_vars, 0xA5, sizeof(s_vars));
+    r = reflect("uniform float a, b, c, d;", GLSL_STAGE_FRAGMENT, 2);
+    check(r->var_count == 2 && r->overflow == 2, "overflow counted");
+    check(((const uint8_t*)&s_vars[2])[0] == 0xA5, "nothing written past capacity");
+
+    // Unparsable array sizes are reported, not guessed at
+    r = reflect("uniform float a[int(2.0)]; uniform float b;", GLSL_STAGE_FRAGMENT);
+    check(r->errors == 1 && find(r, "b", U) != NULL, "bad array size reported, parse continues");
+}
+
+static void test_c_build()
+{
+    check(reflect_c_check() == 3, "C build reflects the same source");
+}
+
+// ---------------------------------------------------------------------------
+// Corpus
+// ---------------------------------------------------------------------------
+
+struct corpus_file {
+    char name[64];
+    char* source;
+    size_t size;
+    uint32_t stage;
+};
+
+static corpus_file s_corpus[MAX_CORPUS];
+static uint32_t s_corpus_count = 0;
+
+static void load_corpus()
+{
+    DIR* dir = opendir(CORPUS_DIR);
+    if (!dir) {
+        fprintf(stderr, LOG_TAG " no %s directory\n", CORPUS_DIR);
+        return;
+    }
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL && s_corpus_count < MAX_CORPUS) {
+        const char* dot = strrchr(entry->d_name, '.');
+        if (!dot || (strcmp(dot, ".vert") != 0 && strcmp(dot, ".frag") != 0)) {
+            continue;
+        }
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", CORPUS_DIR, entry->d_name);
+        FILE* f = fopen(path, "rb");
+        if (!f) {
+            continue;
+        }
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        corpus_file* c = &s_corpus[s_corpus_count];
+        c->source = (char*)malloc(size > 0 ? size : 1);
+        if (c->source && size > 0 && fread(c->source, 1, size, f) == (size_t)size) {
+            snprintf(c->name, sizeof(c->name), "%.63s", entry->d_name);
+            c->size = (size_t)size;
+            c->stage = strcmp(dot, ".vert") == 0 ? GLSL_STAGE_VERTEX : GLSL_STAGE_FRAGMENT;
+            s_corpus_count++;
+        } else {
+            free(c->source);
+        }
+        fclose(f);
+    }
+    closedir(dir);
+}
+
+// Every corpus shader reflects without errors or overflow
+static void test_corpus()
+{
+    for (uint32_t i = 0; i < s_corpus_count; i++) {
+        const corpus_file* c = &s_corpus[i];
+        s_reflection.vars = s_vars;
+        s_reflection.var_capacity = 512;
+        s_reflection.blocks = s_blocks;
+        s_reflection.block_capacity = 24;
+        glsl_reflect(&s_reflection, c->source, c->size, c->stage);
+        if (s_reflection.errors || s_reflection.overflow || s_reflection.var_count == 0) {
+            s_failures++;
+            fprintf(stderr, LOG_TAG " FAIL corpus %s: %u vars, %u errors, %u overflow\n",
+                    c->name, s_reflection.var_count, s_reflection.errors, s_reflection.overflow);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Fuzzing
+// ---------------------------------------------------------------------------
+
+static uint64_t s_rng = 0x9E3779B97F4A7C15ull;
+
+static uint32_t rnd()
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 7;
+    s_rng ^= s_rng << 17;
+    return (uint32_t)(s_rng >> 16);
+}
+
+static const char* const s_tokens[] = {
+    "uniform ", "in ", "out ", "attribute ", "varying ", "struct ", "layout(", "location", "binding",
+    "=", "std140", "row_major", ")", "(", "{", "}", "[", "]", ";", ",", "float ", "vec3 ", "mat4 ",
+    "mat2x3 ", "dvec4 ", "sampler2D ", "S ", "Block ", "a", "b", "N", "0", "1", "16", "0x7fffffff",
+    "4294967295", "65535", "*", "+", "-", "/", "#define N 7\n", "#version 300 es\n", "#if X\n",
+    "\n", "//", "/*", "*/", "\\\n", "const int ", "precision highp float;", "void main() ",
+    "if ", "for ", "texture(", "\"", "\0",
+};
+
+// Output invariants that must hold for any input
+static void check_invariants(const glsl_reflection* r, uint32_t var_capacity)
+{
+    bool ok = r->var_count <= var_capacity && r->block_count <= r->block_capacity;
+    for (uint32_t i = 0; ok && i < r->var_count; i++) {
+        const glsl_reflect_var* v = &r->vars[i];
+        ok = memchr(v->name, '\0', sizeof(v->name)) != NULL && v->kind >= GLSL_VAR_UNIFORM &&
+             v->kind <= GLSL_VAR_OUTPUT && v->align >= 4 && (v->align & (v->align - 1)) == 0;
+        if (ok && (v->kind == GLSL_VAR_UNIFORM || v->kind == GLSL_VAR_SAMPLER)) {
+            ok = v->offset % v->align == 0 && v->offset < GLSL_REFLECT_SIZE_MAX + 16;
+        }
+        if (ok && v->kind == GLSL_VAR_BLOCK_MEMBER) {
+            ok = v->block >= 0 && (uint32_t)v->block < r->block_count;
+        }
+    }
+    for (uint32_t i = 0; ok && i < r->block_count; i++) {
+        const glsl_reflect_block* b = &r->blocks[i];
+        ok = memchr(b->name, '\0', sizeof(b->name)) != NULL && b->size % 16 == 0 &&
+             b->first_var + b->var_count <= r->var_count;
+    }
+    if (!ok) {
+        s_failures++;
+    }
+}
+
+static size_t mutate(char* out, size_t capacity)
+{
+    size_t len = 0;
+    if (s_corpus_count && (rnd() & 3) != 0) {
+        // A corpus shader with byte flips, token splices and a random cut
+        const corpus_file* c = &s_corpus[rnd() % s_corpus_count];
+        len = c->size < capacity ? c->size : capacity;
+        memcpy(out, c->source, len);
+        uint32_t edits = 1 + rnd() % 16;
+        for (uint32_t e = 0; e < edits && len; e++) {
+            size_t at = rnd() % len;
+            if (rnd() & 1) {
+                out[at] = (char)rnd();
+            } else {
+                const char* tok = s_tokens[rnd() % (sizeof(s_tokens) / sizeof(s_tokens[0]))];
+                size_t tlen = strlen(tok);
+                if (len + tlen <= capacity) {
+                    memmove(out + at + tlen, out + at, len - at);
+                    memcpy(out + at, tok, tlen);
+                    len += tlen;
+                }
+            }
+        }
+        if ((rnd() & 7) == 0) {
+            len = rnd() % (len + 1);
+        }
+    } else {
+        // Token soup
+        uint32_t count = rnd() % 400;
+        for (uint32_t i = 0; i < count; i++) {
+            const char* tok = s_tokens[rnd() % (sizeof(s_tokens) / sizeof(s_tokens[0]))];
+            size_t tlen = strlen(tok);
+            if (len + tlen > capacity) {
+                break;
+            }
+            memcpy(out + len, tok, tlen);
+            len += tlen;
+        }
+    }
+    return len;
+}
+
+static void fuzz(uint32_t iterations)
+{
+    const size_t capacity = 64 * 1024;
+    char* scratch = (char*)malloc(capacity);
+    uint32_t failures_before = s_failures;
+    double t0 = now_sec();
+    for (uint32_t i = 0; i < iterations; i++) {
+        size_t len = mutate(scratch, capacity);
+        // Exactly-sized copy so ASan catches any read past len
+        char* source = (char*)malloc(len ? len : 1);
+        memcpy(source, scratch, len);
+        uint32_t capacity_vars = (rnd() & 1) ? 512 : 1 + rnd() % 8;
+        s_reflection.vars = s_vars;
+        s_reflection.var_capacity = capacity_vars;
+        s_reflection.blocks = s_blocks;
+        s_reflection.block_capacity = 1 + rnd() % 24;
+        glsl_reflect(&s_reflection, source, len, 1 + rnd() % 6);
+        check_invariants(&s_reflection, capacity_vars);
+        free(source);
+    }
+    printf(LOG_TAG " fuzz: %u inputs in %.1f s, %u invariant failures\n",
+           iterations, now_sec() - t0, s_failures - failures_before);
+    free(scratch);
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark
+// ---------------------------------------------------------------------------
+
+static void bench()
+{
+    if (!s_corpus_count) {
+        return;
+    }
+    size_t bytes_per_pass = 0;
+    for (uint32_t i = 0; i < s_corpus_count; i++) {
+        bytes_per_pass += s_corpus[i].size;
+    }
+
+    const uint32_t passes = 20000;
+    uint64_t vars = 0;
+    double t0 = now_sec();
+    for (uint32_t p = 0; p < passes; p++) {
+        for (uint32_t i = 0; i < s_corpus_count; i++) {
+            const corpus_file* c = &s_corpus[i];
+            s_reflection.vars = s_vars;
+            s_reflection.var_capacity = 512;
+            s_reflection.blocks = s_blocks;
+            s_reflection.block_capacity = 24;
+            vars += glsl_reflect(&s_reflection, c->source, c->size, c->stage);
+        }
+    }
+    double elapsed = now_sec() - t0;
+    double shaders = (double)passes * s_corpus_count;
+
+    printf(LOG_TAG " %u corpus shaders (%zu bytes) x %u: %.1f MB/s, %.0f k shaders/s, %.2f us/shader\n",
+           s_corpus_count, bytes_per_pass, passes, bytes_per_pass * (double)passes / elapsed / 1e6,
+           shaders / elapsed / 1e3, elapsed / shaders * 1e6);
+    printf(LOG_TAG " %.1f variables per shader, reflection state %zu bytes\n",
+           vars / shaders, sizeof(glsl_reflection));
+}
+
+int main(int argc, char** argv)
+{
+    bool run_bench = true;
+    uint32_t fuzz_iterations = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--no-bench") == 0) {
+            run_bench = false;
+        } else if (strcmp(argv[i], "--fuzz") == 0 && i + 1 < argc) {
+            fuzz_iterations = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+    }
+
+    load_corpus();
+    test_golden();
+    test_c_build();
+    test_corpus();
+    if (s_failures) {
+        printf(LOG_TAG " %d failures\n", s_failures);
+        return 1;
+    }
+    printf(LOG_TAG " golden layouts, C build and %u corpus shaders ok\n", s_corpus_count);
+
+    if (fuzz_iterations) {
+        fuzz(fuzz_iterations);
+        if (s_failures) {
+            return 1;
+        }
+    }
+    if (run_bench) {
+        printf("\n");
+        bench();
+    }
+    return 0;
+}
@@ -0,0 +1,28 @@
+/*
+ * Builds FB/glsl_reflect.h as C99; glsl_reflect_test.cpp checks the result
+ * matches what the C++ build reports for the same source.
+ */
+
+#include "glsl_reflect.h"
+
+#include <string.h>
+
+uint32_t reflect_c_check(void)
+{
+    static const char source[] =
+        "uniform mat4 mvp;\n"
+        "uniform sampler2D tex;\n"
+        "layout(std140) uniform Block { vec4 color; };\n";
+    static struct glsl_reflect_var vars[8];
+    static struct glsl_reflect_block blocks[2];
+    static struct glsl_reflection r;
+
+    r.vars = vars;
+    r.var_capacity = 8;
+    r.blocks = blocks;
+    r.block_capacity = 2;
+    glsl_reflect(&r, source, strlen(source), GLSL_STAGE_VERTEX);
+    if (r.block_count != 1 || blocks[0].size != 16 || r.default_block_size != 80)
+        return 0;
+    return r.var_count;
+}
@@ -0,0 +1,16 @@
+#!/bin/bash
+# Build and run handle_table_test: FB/VMHandleTable.h checked for stale-id
+# rejection, slot reuse order, tags, capacity and concurrent lookups, then
+# benchmarked against the linear array scans it replaced.
+# Runs on any Linux or macOS host; the table has no IOKit dependency.
+set -e
+
+cd "$(dirname "$0")"
+
+CXX=${CXX:-c++}
+
+$CXX -O2 -std=c++11 -Wall -Wextra -pthread -I../../FB -o handle_table_test handle_table_test.cpp
+
+echo "Built: $(pwd)/handle_table_test"
+echo
+./handle_table_test "$@"
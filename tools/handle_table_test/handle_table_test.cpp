@@ -0,0 +1,362 @@
+// Correctness and throughput suite for FB/VMHandleTable.h.
+//
+// The table replaces the per-manager id counters and the linear scans over
+// OSArrays that resolved them, so the checks here are the properties those
+// managers rely on: a destroyed id never resolves again, even once its slot
+// is reused; 0 is never handed out; a full table refuses instead of
+// wrapping; and a lookup racing with insert/remove on another thread sees
+// either nothing or the object that handle was issued for.
+
+#include "VMHandleTable.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <atomic>
+#include <map>
+#include <thread>
+#include <vector>
+
+#define LOG_TAG "[handle_table]"
+
+struct Object {
+    uint32_t handle;
+    uint32_t payload;
+};
+
+static int s_failures = 0;
+static volatile uint64_t s_sink;
+
+static double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void check(bool ok, const char* what)
+{
+    if (!ok) {
+        s_failures++;
+        fprintf(stderr, LOG_TAG " FAIL %s\n", what);
+    }
+}
+
+static uint32_t s_rng = 0x12345678;
+
+static uint32_t rnd()
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static void test_basic()
+{
+    VMHandleTable<Object> table;
+    table.init(0);
+    Object a = {}, b = {}, c = {};
+
+    check(table.lookup(0) == nullptr, "handle 0 resolves on an empty table");
+    uint32_t ha = table.insert(&a);
+    uint32_t hb = table.insert(&b);
+    check(ha && hb && ha != hb, "insert returns distinct non-zero handles");
+    check(table.lookup(ha) == &a && table.lookup(hb) == &b, "lookup of live handles");
+    check(table.count() == 2 && table.limit() == 2, "count/limit after two inserts");
+
+    check(table.remove(ha) == &a, "remove returns the object");
+    check(table.remove(ha) == nullptr, "second remove of the same handle");
+    check(table.lookup(ha) == nullptr, "removed handle still resolves");
+
+    // The freed slot comes back under a new generation
+    uint32_t hc = table.insert(&c);
+    check(VMHandleIndex(hc) == VMHandleIndex(ha), "freed slot not reused");
+    check(VMHandleGeneration(hc) == VMHandleGeneration(ha) + 1, "generation not bumped");
+    check(table.lookup(ha) == nullptr && table.lookup(hc) == &c, "stale handle resolves to reused slot");
+
+    // Handles with the right index but a generation never issued
+    check(table.lookup(hb + (1u << VM_HANDLE_INDEX_BITS)) == nullptr, "future generation resolves");
+    check(table.lookup(VM_HANDLE_INDEX_MASK) == nullptr, "index past the high-water mark resolves");
+    table.free();
+}
+
+static void test_fifo_reuse()
+{
+    VMHandleTable<Object> table;
+    table.init(0);
+    Object objs[8] = {};
+    uint32_t h[8];
+    for (int i = 0; i < 8; i++) h[i] = table.insert(&objs[i]);
+    table.remove(h[5]);
+    table.remove(h[2]);
+    table.remove(h[7]);
+    check(VMHandleIndex(table.insert(&objs[0])) == 5, "oldest freed slot not reused first");
+    check(VMHandleIndex(table.insert(&objs[0])) == 2, "second oldest freed slot not reused next");
+    check(VMHandleIndex(table.insert(&objs[0])) == 7, "third freed slot not reused last");
+    check(VMHandleIndex(table.insert(&objs[0])) == 8, "new slot not taken once the free list is empty");
+    table.free();
+}
+
+static void test_generation_wrap()
+{
+    VMHandleTable<Object> table;
+    table.init(1);
+    Object a = {};
+    uint32_t first = table.insert(&a);
+    uint32_t prev = first;
+    bool ok = true;
+    for (uint32_t i = 0; i < 70000; i++) {
+        table.remove(prev);
+        uint32_t h = table.insert(&a);
+        if (h == 0 || h == prev || VMHandleGeneration(h) == 0 || table.lookup(prev)) {
+            ok = false;
+            break;
+        }
+        prev = h;
+    }
+    check(ok, "generation wrap produced 0, a repeat or a live stale handle");
+    check(VMHandleGeneration(first) == 1, "first generation is not 1");
+    table.free();
+}
+
+static void test_tags_and_reservation()
+{
+    VMHandleTable<Object> table;
+    table.init(0);
+    Object a = {}, b = {};
+
+    uint32_t h = table.insert(&a, 3);
+    check(table.lookup(h, 3) == &a, "lookup with the inserted tag");
+    check(table.lookup(h, 4) == nullptr, "lookup with another tag");
+
+    uint32_t r = table.insert(nullptr, 7);
+    check(r != 0 && table.lookup(r) == nullptr, "reserved handle resolves before replace");
+    check(table.count() == 2, "reservation not counted");
+    check(table.replace(r, &b) && table.lookup(r, 7) == &b, "replace of a reserved handle");
+    check(table.replace(r, &a) && table.lookup(r) == &a, "replace of a live handle");
+    table.remove(r);
+    check(!table.replace(r, &b), "replace of a removed handle");
+    table.free();
+}
+
+static void test_capacity_and_iteration()
+{
+    const uint32_t cap = 3 * VM_HANDLE_PAGE_SLOTS + 17;
+    VMHandleTable<Object> table;
+    table.init(cap);
+    std::vector<Object> objs(cap);
+    std::vector<uint32_t> handles;
+    for (uint32_t i = 0; i < cap; i++) {
+        handles.push_back(table.insert(&objs[i]));
+    }
+    check(handles.back() != 0, "insert up to capacity");
+    check(table.insert(&objs[0]) == 0, "insert past capacity");
+    check(table.count() == cap && table.limit() == cap, "count/limit at capacity");
+
+    for (uint32_t i = 0; i < cap; i += 3) {
+        table.remove(handles[i]);
+    }
+    uint32_t seen = 0;
+    bool ok = true;
+    for (uint32_t i = 0; i < table.limit(); i++) {
+        uint32_t h = 0;
+        Object* o = table.at(i, &h);
+        if (!o) {
+            ok &= (i % 3) == 0;
+            continue;
+        }
+        ok &= o == &objs[i] && h == handles[i];
+        seen++;
+    }
+    check(ok && seen == table.count(), "iteration skips removed slots and reports live handles");
+    check(table.insert(&objs[0]) != 0, "insert after removal from a full table");
+    table.free();
+
+    VMHandleTable<Object> full;
+    full.init(0);
+    Object o = {};
+    uint32_t n = 0;
+    while (full.insert(&o)) n++;
+    check(n == VM_HANDLE_MAX_SLOTS, "default capacity");
+    full.free();
+}
+
+// Random operations against a std::map reference, remembering every handle
+// ever removed
+static void test_model()
+{
+    VMHandleTable<Object> table;
+    table.init(2000);
+    std::vector<Object> objs(2000);
+    std::map<uint32_t, Object*> live;
+    std::vector<uint32_t> dead;
+    bool ok = true;
+
+    for (int op = 0; op < 400000 && ok; op++) {
+        uint32_t r = rnd() % 100;
+        if (r < 45) {
+            Object* o = &objs[rnd() % objs.size()];
+            uint32_t h = table.insert(o, r & 3);
+            if (h) {
+                ok &= live.find(h) == live.end();
+                live[h] = o;
+            } else {
+                ok &= live.size() == 2000;
+            }
+        } else if (r < 90 && !live.empty()) {
+            auto it = live.begin();
+            std::advance(it, rnd() % live.size());
+            ok &= table.remove(it->first) == it->second;
+            dead.push_back(it->first);
+            live.erase(it);
+        } else if (!dead.empty()) {
+            uint32_t h = dead[rnd() % dead.size()];
+            if (live.find(h) == live.end()) {
+                ok &= table.lookup(h) == nullptr && table.remove(h) == nullptr;
+            }
+        }
+        ok &= table.count() == live.size();
+    }
+    for (auto& e : live) {
+        ok &= table.lookup(e.first) == e.second;
+    }
+    check(ok, "random operations diverge from the reference map");
+    table.free();
+}
+
+// One writer inserting and removing, several readers looking up handles it
+// recently issued. Objects are never reused, so a lookup that returns
+// anything must return the object issued under that handle.
+static void test_concurrent()
+{
+    const uint32_t objects = 1 << 21;
+    const uint32_t ring = 4096;
+    std::vector<Object> pool(objects);
+    std::vector<std::atomic<uint32_t>> recent(ring);
+    for (auto& h : recent) h.store(0);
+
+    VMHandleTable<Object> table;
+    table.init(1024);
+    std::atomic<bool> done(false);
+    std::atomic<uint64_t> bad(0), hits(0), misses(0);
+
+    auto reader = [&](uint32_t seed) {
+        uint64_t local_bad = 0, local_hits = 0, local_misses = 0;
+        while (!done.load(std::memory_order_relaxed)) {
+            seed = seed * 1664525u + 1013904223u;
+            uint32_t h = recent[(seed >> 8) % ring].load(std::memory_order_relaxed);
+            if (!h) continue;
+            Object* o = table.lookup(h);
+            if (!o) {
+                local_misses++;
+            } else if (o->handle != h || o->payload != (h ^ 0x5A5A5A5Au)) {
+                local_bad++;
+            } else {
+                local_hits++;
+            }
+        }
+        bad += local_bad;
+        hits += local_hits;
+        misses += local_misses;
+    };
+
+    std::vector<std::thread> readers;
+    for (uint32_t i = 0; i < 3; i++) readers.emplace_back(reader, 0x9E3779B9u * (i + 1));
+
+    std::vector<uint32_t> live;
+    uint32_t next = 0;
+    while (next < objects) {
+        if (live.size() < 900 && (rnd() & 1)) {
+            // Reserve, fill, then publish, the way createCommandBuffer does
+            uint32_t h = table.insert(nullptr);
+            Object* o = &pool[next++];
+            o->handle = h;
+            o->payload = h ^ 0x5A5A5A5Au;
+            table.replace(h, o);
+            recent[next % ring].store(h, std::memory_order_relaxed);
+            live.push_back(h);
+        } else if (!live.empty()) {
+            uint32_t i = rnd() % live.size();
+            table.remove(live[i]);
+            live[i] = live.back();
+            live.pop_back();
+        }
+    }
+    done = true;
+    for (auto& t : readers) t.join();
+
+    check(bad == 0, "concurrent lookup returned an object issued under another handle");
+    check(hits > 0 && misses > 0, "concurrent readers saw no hits or no misses");
+    printf(LOG_TAG " concurrent: %llu hits, %llu stale misses, %llu wrong\n",
+           (unsigned long long)hits.load(), (unsigned long long)misses.load(),
+           (unsigned long long)bad.load());
+    table.free();
+}
+
+static void bench()
+{
+    printf(LOG_TAG " %8s %16s %16s\n", "live", "array scan ns", "table ns");
+    const uint32_t sizes[] = { 16, 128, 1024, 8192 };
+    for (uint32_t n : sizes) {
+        std::vector<Object> objs(n);
+        std::vector<Object*> array;
+        VMHandleTable<Object> table;
+        table.init(0);
+        std::vector<uint32_t> handles;
+        for (uint32_t i = 0; i < n; i++) {
+            objs[i].handle = table.insert(&objs[i]);
+            handles.push_back(objs[i].handle);
+            array.push_back(&objs[i]);
+        }
+
+        const uint32_t lookups = 4000000;
+        uint64_t sink = 0;
+        uint32_t scan_lookups = lookups / (n / 16 + 1);
+        double t0 = now_sec();
+        for (uint32_t i = 0; i < scan_lookups; i++) {
+            uint32_t h = handles[(i * 2654435761u) % n];
+            for (Object* o : array) {
+                if (o->handle == h) {
+                    sink += o->handle;
+                    break;
+                }
+            }
+        }
+        double scan = (now_sec() - t0) * 1e9 / scan_lookups;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < lookups; i++) {
+            Object* o = table.lookup(handles[(i * 2654435761u) % n]);
+            sink += o->handle;
+        }
+        double direct = (now_sec() - t0) * 1e9 / lookups;
+        s_sink = sink;
+        printf(LOG_TAG " %8u %16.1f %16.1f\n", n, scan, direct);
+        table.free();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool run_bench = !(argc > 1 && strcmp(argv[1], "--no-bench") == 0);
+
+    test_basic();
+    test_fifo_reuse();
+    test_generation_wrap();
+    test_tags_and_reservation();
+    test_capacity_and_iteration();
+    test_model();
+    test_concurrent();
+    if (s_failures) {
+        fprintf(stderr, LOG_TAG " %d failures\n", s_failures);
+        return 1;
+    }
+    printf(LOG_TAG " basic, reuse, wrap, tags, capacity, model and concurrent ok\n");
+    if (run_bench) {
+        bench();
+    }
+    return 0;
+}
@@ -0,0 +1,16 @@
+#!/bin/bash
+# Build and run indexscan_test: FB/VMIndexScan.cpp checked against a plain
+# loop for every kernel set the host CPU supports, then benchmarked.
+# Runs on any x86_64 Linux or macOS host; the scan has no IOKit dependency.
+set -e
+
+cd "$(dirname "$0")"
+
+CXX=${CXX:-c++}
+
+$CXX -O2 -std=c++11 -Wall -Wno-unknown-pragmas -I../../FB \
+     -o indexscan_test indexscan_test.cpp ../../FB/VMIndexScan.cpp ../../FB/VMBlit2D.cpp
+
+echo "Built: $(pwd)/indexscan_test"
+echo
+./indexscan_test "$@"
@@ -0,0 +1,138 @@
+// Correctness and throughput suite for FB/VMIndexScan.cpp.
+//
+// Every kernel set the host CPU supports is checked against a plain loop on
+// random index arrays of every length up to a few vector widths, at every
+// misalignment, then timed on draw-sized arrays.
+
+#include "VMIndexScan.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#define LOG_TAG "[indexscan]"
+
+static uint32_t s_rng = 0x9E3779B9u;
+
+static uint32_t rnd()
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void ref_minmax(const uint8_t* p, uint32_t size, uint32_t count, uint32_t* lo, uint32_t* hi)
+{
+    *lo = 0xFFFFFFFFu;
+    *hi = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t v = 0;
+        memcpy(&v, p + (size_t)i * size, size);   // little-endian host
+        if (v < *lo) *lo = v;
+        if (v > *hi) *hi = v;
+    }
+}
+
+static int s_failures = 0;
+static volatile uint32_t s_sink;    // keeps benchmark results live
+
+static void test_path(VMBlit2DPath path)
+{
+    std::vector<uint8_t> buf(4 * 300 + 64);
+
+    for (uint32_t size = 1; size <= 4; size *= 2) {
+        for (int iter = 0; iter < 4000; iter++) {
+            uint32_t count = 1 + rnd() % 300;
+            uint32_t misalign = rnd() % 16;
+            uint8_t* p = buf.data() + misalign;
+
+            // Mix of full-range values and narrow clusters, plus the extremes
+            // that a biased signed compare gets wrong if the bias is missing
+            uint32_t mode = rnd() % 3;
+            uint32_t base = rnd();
+            for (uint32_t i = 0; i < count; i++) {
+                uint32_t v = mode == 0 ? rnd() : base + rnd() % 64;
+                if (mode == 2 && rnd() % 50 == 0)
+                    v = (rnd() & 1) ? 0xFFFFFFFFu : 0;
+                memcpy(p + (size_t)i * size, &v, size);
+            }
+
+            uint32_t lo = 0, hi = 0, rlo, rhi;
+            bool ok = VMIndexScanMinMax(p, size, count, &lo, &hi);
+            ref_minmax(p, size, count, &rlo, &rhi);
+            if (!ok || lo != rlo || hi != rhi) {
+                if (s_failures < 20)
+                    fprintf(stderr, LOG_TAG " FAIL path=%s size=%u count=%u got [%u,%u] want [%u,%u]\n",
+                            VMBlit2DPathName(path), size, count, lo, hi, rlo, rhi);
+                s_failures++;
+            }
+        }
+    }
+
+    uint32_t lo = 7, hi = 7;
+    uint16_t one = 1;
+    if (VMIndexScanMinMax(&one, 3, 1, &lo, &hi) || VMIndexScanMinMax(&one, 2, 0, &lo, &hi) ||
+        lo != 7 || hi != 7) {
+        fprintf(stderr, LOG_TAG " FAIL path=%s rejects\n", VMBlit2DPathName(path));
+        s_failures++;
+    }
+}
+
+static void bench_path(VMBlit2DPath path)
+{
+    const uint32_t count = 1 << 20;
+    std::vector<uint8_t> buf((size_t)count * 4);
+    for (size_t i = 0; i < buf.size(); i++)
+        buf[i] = (uint8_t)rnd();
+
+    printf("%-7s", VMBlit2DPathName(path));
+    for (uint32_t size = 1; size <= 4; size *= 2) {
+        const int reps = 200;
+        uint32_t lo, hi;
+        double t0 = now_sec();
+        for (int r = 0; r < reps; r++) {
+            VMIndexScanMinMax(buf.data(), size, count, &lo, &hi);
+            s_sink += lo + hi;
+        }
+        double t = now_sec() - t0;
+        printf("  u%-2u %7.0f Mindex/s", size * 8, (double)count * reps / t / 1e6);
+    }
+    printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+    bool run_bench = !(argc > 1 && strcmp(argv[1], "--no-bench") == 0);
+    VMBlit2DPath best = VMBlit2DBestPath();
+    printf(LOG_TAG " best path on this CPU: %s\n", VMBlit2DPathName(best));
+
+    for (int p = kVMBlit2DPathScalar; p <= best; p++) {
+        VMBlit2DPath path = VMIndexScanSetPath((VMBlit2DPath)p);
+        int before = s_failures;
+        test_path(path);
+        printf(LOG_TAG " %-7s %s\n", VMBlit2DPathName(path),
+               s_failures == before ? "ok" : "FAILED");
+    }
+
+    if (s_failures) {
+        printf(LOG_TAG " %d failures\n", s_failures);
+        return 1;
+    }
+
+    if (run_bench) {
+        printf("\n");
+        for (int p = kVMBlit2DPathScalar; p <= best; p++)
+            bench_path(VMIndexScanSetPath((VMBlit2DPath)p));
+    }
+    return 0;
+}
@@ -0,0 +1,16 @@
+#!/bin/bash
+# Build and run mipmap_test: FB/VMMipmap.cpp checked against a reference
+# box filter for every kernel set the host CPU supports, then benchmarked.
+# Runs on any x86_64 Linux or macOS host; the filter has no IOKit dependency.
+set -e
+
+cd "$(dirname "$0")"
+
+CXX=${CXX:-c++}
+
+$CXX -O2 -std=c++11 -Wall -Wno-unknown-pragmas -I../../FB \
+     -o mipmap_test mipmap_test.cpp ../../FB/VMMipmap.cpp ../../FB/VMBlit2D.cpp -lm
+
+echo "Built: $(pwd)/mipmap_test"
+echo
+./mipmap_test "$@"
@@ -0,0 +1,246 @@
+// Correctness and throughput suite for FB/VMMipmap.cpp.
+//
+// The sRGB encode is checked against the float transfer function for every
+// 16-bit linear value. Every kernel set the host CPU supports is then
+// checked byte for byte against a plain reference filter on random images
+// of every small size, odd and one-texel sizes included, and against a
+// float filter to within one code. Last, full 4K chains are timed.
+
+#include "VMMipmap.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#define LOG_TAG "[mipmap]"
+
+static uint32_t s_rng = 0x9E3779B9u;
+
+static uint32_t rnd()
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double srgb_decode(double s)
+{
+    return s <= 0.04045 ? s / 12.92 : pow((s + 0.055) / 1.055, 2.4);
+}
+
+static double srgb_encode(double l)
+{
+    return l <= 0.0031308 ? l * 12.92 : 1.055 * pow(l, 1.0 / 2.4) - 0.055;
+}
+
+static int s_failures = 0;
+static volatile uint32_t s_sink;    // keeps benchmark results live
+
+#define FAIL(...)                                                   \
+    do {                                                            \
+        if (s_failures < 20) fprintf(stderr, LOG_TAG " FAIL " __VA_ARGS__); \
+        s_failures++;                                               \
+    } while (0)
+
+static uint8_t s_encode_ref[65536];
+
+static void test_tables()
+{
+    for (uint32_t s = 0; s < 256; s++) {
+        uint32_t want = (uint32_t)floor(srgb_decode(s / 255.0) * 65535.0 + 0.5);
+        if (VMMipmapSRGBToLinear((uint8_t)s) != want)
+            FAIL("decode %u got %u want %u\n", s, VMMipmapSRGBToLinear((uint8_t)s), want);
+    }
+    for (uint32_t l = 0; l < 65536; l++) {
+        s_encode_ref[l] = (uint8_t)floor(srgb_encode(l / 65535.0) * 255.0 + 0.5);
+        if (VMMipmapLinearToSRGB(l) != s_encode_ref[l])
+            FAIL("encode %u got %u want %u\n", l, VMMipmapLinearToSRGB(l), s_encode_ref[l]);
+    }
+    for (uint32_t s = 0; s < 256; s++) {
+        if (VMMipmapLinearToSRGB(VMMipmapSRGBToLinear((uint8_t)s)) != s)
+            FAIL("round trip %u\n", s);
+    }
+    if (VMMipmapLinearToSRGB(0x20000) != 255)
+        FAIL("encode out of range\n");
+}
+
+// Plain loops over the same definition the kernels implement
+static void ref_downsample(std::vector<uint8_t>& out, const uint8_t* src, uint32_t pitch,
+                           uint32_t w, uint32_t h, uint32_t ch, bool srgb)
+{
+    uint32_t dw = VMMipmapNextSize(w), dh = VMMipmapNextSize(h);
+    out.assign((size_t)dw * dh * ch, 0);
+    for (uint32_t y = 0; y < dh; y++) {
+        uint32_t y0 = 2 * y, y1 = 2 * y + 1 < h ? 2 * y + 1 : 2 * y;
+        for (uint32_t x = 0; x < dw; x++) {
+            uint32_t x0 = 2 * x, x1 = 2 * x + 1 < w ? 2 * x + 1 : 2 * x;
+            for (uint32_t c = 0; c < ch; c++) {
+                uint32_t t[4] = { src[y0 * pitch + x0 * ch + c], src[y0 * pitch + x1 * ch + c],
+                                  src[y1 * pitch + x0 * ch + c], src[y1 * pitch + x1 * ch + c] };
+                uint8_t v;
+                if (srgb && !(ch == 4 && c == 3)) {
+                    uint32_t sum = 0;
+                    for (int i = 0; i < 4; i++) sum += VMMipmapSRGBToLinear((uint8_t)t[i]);
+                    v = s_encode_ref[(sum + 2) >> 2];
+                } else {
+                    v = (uint8_t)((t[0] + t[1] + t[2] + t[3] + 2) >> 2);
+                }
+                out[((size_t)y * dw + x) * ch + c] = v;
+            }
+        }
+    }
+}
+
+// The filter the integer math approximates, in doubles
+static double float_texel(const uint8_t* src, uint32_t pitch, uint32_t w, uint32_t h,
+                          uint32_t ch, bool srgb, uint32_t x, uint32_t y, uint32_t c)
+{
+    uint32_t x1 = 2 * x + 1 < w ? 2 * x + 1 : 2 * x;
+    uint32_t y1 = 2 * y + 1 < h ? 2 * y + 1 : 2 * y;
+    uint32_t t[4] = { src[2 * y * pitch + 2 * x * ch + c], src[2 * y * pitch + x1 * ch + c],
+                      src[y1 * pitch + 2 * x * ch + c], src[y1 * pitch + x1 * ch + c] };
+    if (!srgb || (ch == 4 && c == 3))
+        return (t[0] + t[1] + t[2] + t[3]) / 4.0;
+    double sum = 0;
+    for (int i = 0; i < 4; i++) sum += srgb_decode(t[i] / 255.0);
+    return srgb_encode(sum / 4.0) * 255.0;
+}
+
+static void test_path(VMBlit2DPath path)
+{
+    std::vector<uint8_t> src, dst, ref;
+    static const uint32_t channels[3] = { 1, 2, 4 };
+
+    for (int iter = 0; iter < 3000; iter++) {
+        uint32_t ch = channels[rnd() % 3];
+        bool srgb = rnd() & 1;
+        uint32_t w = 1 + rnd() % 140;
+        uint32_t h = 1 + rnd() % 9;
+        uint32_t pitch = w * ch + rnd() % 16;
+        uint32_t misalign = rnd() % 16;
+        src.assign((size_t)pitch * h + misalign, 0);
+        uint8_t* s = src.data() + misalign;
+        uint32_t mode = rnd() % 3;
+        for (size_t i = 0; i < (size_t)pitch * h; i++)
+            s[i] = mode == 0 ? (uint8_t)rnd() : mode == 1 ? (uint8_t)(rnd() & 1 ? 255 : 0)
+                                               : (uint8_t)(200 + rnd() % 56);
+
+        uint32_t dw = VMMipmapNextSize(w), dh = VMMipmapNextSize(h);
+        uint32_t dpitch = dw * ch + rnd() % 8;
+        dst.assign((size_t)dpitch * dh + 16, 0xCD);
+        VMMipmapImage in = { s, pitch, w, h };
+        VMMipmapImage out = { dst.data(), dpitch, dw, dh };
+        if (!VMMipmapDownsample(&out, &in, ch, srgb)) {
+            FAIL("path=%s refused %ux%u ch=%u\n", VMBlit2DPathName(path), w, h, ch);
+            continue;
+        }
+
+        ref_downsample(ref, s, pitch, w, h, ch, srgb);
+        for (uint32_t y = 0; y < dh; y++) {
+            for (uint32_t i = 0; i < dw * ch; i++) {
+                uint8_t got = dst[(size_t)y * dpitch + i];
+                uint8_t want = ref[(size_t)y * dw * ch + i];
+                double exact = float_texel(s, pitch, w, h, ch, srgb, i / ch, y, i % ch);
+                if (got != want || fabs(got - exact) > 1.0) {
+                    FAIL("path=%s %ux%u ch=%u srgb=%d at (%u,%u) got %u want %u (%.2f)\n",
+                         VMBlit2DPathName(path), w, h, ch, srgb, i / ch, y, got, want, exact);
+                    y = dh;
+                    break;
+                }
+            }
+            // Row padding stays untouched
+            for (uint32_t i = dw * ch; y < dh && i < dpitch; i++) {
+                if (dst[(size_t)y * dpitch + i] != 0xCD) {
+                    FAIL("path=%s wrote past row %u\n", VMBlit2DPathName(path), y);
+                    break;
+                }
+            }
+        }
+    }
+
+    uint8_t pixel[4] = { 1, 2, 3, 4 };
+    uint8_t canary[4] = { 9, 9, 9, 9 };
+    VMMipmapImage one = { pixel, 4, 1, 1 };
+    VMMipmapImage bad = { canary, 4, 2, 1 };
+    VMMipmapImage tiny = { canary, 2, 1, 1 };
+    if (VMMipmapDownsample(&bad, &one, 4, false) || VMMipmapDownsample(&one, &one, 3, false) ||
+        VMMipmapDownsample(&tiny, &one, 4, false) || canary[0] != 9) {
+        FAIL("path=%s rejects\n", VMBlit2DPathName(path));
+    }
+}
+
+// One 4096x4096 level 0 down to 1x1, in place in a single allocation
+static void bench_path(VMBlit2DPath path)
+{
+    const uint32_t size = 4096;
+    printf("%-7s", VMBlit2DPathName(path));
+    static const uint32_t channels[3] = { 1, 2, 4 };
+    for (int k = 0; k < 4; k++) {
+        uint32_t ch = channels[k < 3 ? k : 2];
+        bool srgb = k == 3;
+        std::vector<uint8_t> chain((size_t)size * size * ch * 4 / 3 + 64);
+        for (size_t i = 0; i < (size_t)size * size * ch; i++)
+            chain[i] = (uint8_t)rnd();
+
+        const int reps = 5;
+        double t0 = now_sec();
+        for (int r = 0; r < reps; r++) {
+            size_t offset = 0;
+            uint32_t w = size, h = size;
+            while (w > 1 || h > 1) {
+                VMMipmapImage in = { chain.data() + offset, w * ch, w, h };
+                offset += (size_t)w * h * ch;
+                uint32_t dw = VMMipmapNextSize(w), dh = VMMipmapNextSize(h);
+                VMMipmapImage out = { chain.data() + offset, dw * ch, dw, dh };
+                VMMipmapDownsample(&out, &in, ch, srgb);
+                w = dw;
+                h = dh;
+            }
+            s_sink += chain[offset];
+        }
+        double t = (now_sec() - t0) / reps;
+        printf("  %s%u %6.2f ms", srgb ? "srgb" : "unorm", ch * 8, t * 1e3);
+    }
+    printf("  (4K chain)\n");
+}
+
+int main(int argc, char** argv)
+{
+    bool run_bench = !(argc > 1 && strcmp(argv[1], "--no-bench") == 0);
+    VMBlit2DPath best = VMBlit2DBestPath();
+    printf(LOG_TAG " best path on this CPU: %s\n", VMBlit2DPathName(best));
+
+    test_tables();
+    printf(LOG_TAG " srgb tables %s\n", s_failures ? "FAILED" : "ok");
+
+    for (int p = kVMBlit2DPathScalar; p <= best; p++) {
+        VMBlit2DPath path = VMMipmapSetPath((VMBlit2DPath)p);
+        int before = s_failures;
+        test_path(path);
+        printf(LOG_TAG " %-7s %s\n", VMBlit2DPathName(path),
+               s_failures == before ? "ok" : "FAILED");
+    }
+
+    if (s_failures) {
+        printf(LOG_TAG " %d failures\n", s_failures);
+        return 1;
+    }
+
+    if (run_bench) {
+        printf("\n");
+        for (int p = kVMBlit2DPathScalar; p <= best; p++)
+            bench_path(VMMipmapSetPath((VMBlit2DPath)p));
+    }
+    return 0;
+}
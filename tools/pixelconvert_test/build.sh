@@ -0,0 +1,17 @@
+#!/bin/bash
+# Build and run pixelconvert_test: FB/VMPixelConvert.cpp checked against a
+# reference conversion for every kernel set the host CPU supports, then
+# benchmarked. Runs on any x86_64 Linux or macOS host; the converter has no
+# IOKit dependency.
+set -e
+
+cd "$(dirname "$0")"
+
+CXX=${CXX:-c++}
+
+$CXX -O2 -std=c++11 -Wall -Wno-unknown-pragmas -I../../FB \
+     -o pixelconvert_test pixelconvert_test.cpp ../../FB/VMPixelConvert.cpp ../../FB/VMBlit2D.cpp -lm
+
+echo "Built: $(pwd)/pixelconvert_test"
+echo
+./pixelconvert_test "$@"
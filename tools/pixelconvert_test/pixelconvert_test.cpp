@@ -0,0 +1,373 @@
+// Correctness and throughput suite for FB/VMPixelConvert.cpp.
+//
+// Every kernel set the host CPU supports is checked byte for byte against
+// a reference written from the definitions in VMPixelConvert.h, in double
+// precision: random blocks for every pair of formats with and without the
+// alpha operations, then every 16-bit pixel, every 10-bit channel value
+// and every (color, alpha) pair. Last, full-HD conversions are timed.
+
+#include "VMPixelConvert.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#define LOG_TAG "[pixelconvert]"
+
+static uint32_t s_rng = 0x9E3779B9u;
+
+static uint32_t rnd()
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int s_failures = 0;
+static volatile uint32_t s_sink;    // keeps benchmark results live
+
+#define FAIL(...)                                                   \
+    do {                                                            \
+        if (s_failures < 20) fprintf(stderr, LOG_TAG " FAIL " __VA_ARGS__); \
+        s_failures++;                                               \
+    } while (0)
+
+static const char* format_name(VMPixelFormat f)
+{
+    switch (f) {
+        case kVMPixelFormatRGBA8:       return "rgba8";
+        case kVMPixelFormatBGRA8:       return "bgra8";
+        case kVMPixelFormatARGB8:       return "argb8";
+        case kVMPixelFormatABGR8:       return "abgr8";
+        case kVMPixelFormatRGB8:        return "rgb8";
+        case kVMPixelFormatBGR8:        return "bgr8";
+        case kVMPixelFormatL8:          return "l8";
+        case kVMPixelFormatB5G6R5:      return "565";
+        case kVMPixelFormatB5G5R5A1:    return "1555";
+        case kVMPixelFormatR10G10B10A2: return "1010102";
+        default:                        return "?";
+    }
+}
+
+// round(v * out / in), ties up
+static uint32_t rescale(uint32_t v, uint32_t in, uint32_t out)
+{
+    return (uint32_t)floor(v * (double)out / in + 0.5);
+}
+
+static void ref_unpack(VMPixelFormat f, const uint8_t* p, uint32_t c[4])
+{
+    uint32_t v16 = p[0] | (p[1] << 8);
+    uint32_t v32 = v16 | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    switch (f) {
+        case kVMPixelFormatRGBA8: c[0] = p[0]; c[1] = p[1]; c[2] = p[2]; c[3] = p[3]; break;
+        case kVMPixelFormatBGRA8: c[0] = p[2]; c[1] = p[1]; c[2] = p[0]; c[3] = p[3]; break;
+        case kVMPixelFormatARGB8: c[0] = p[1]; c[1] = p[2]; c[2] = p[3]; c[3] = p[0]; break;
+        case kVMPixelFormatABGR8: c[0] = p[3]; c[1] = p[2]; c[2] = p[1]; c[3] = p[0]; break;
+        case kVMPixelFormatRGB8:  c[0] = p[0]; c[1] = p[1]; c[2] = p[2]; c[3] = 255; break;
+        case kVMPixelFormatBGR8:  c[0] = p[2]; c[1] = p[1]; c[2] = p[0]; c[3] = 255; break;
+        case kVMPixelFormatL8:    c[0] = c[1] = c[2] = p[0]; c[3] = 255; break;
+        case kVMPixelFormatB5G6R5:
+            c[0] = rescale(v16 >> 11, 31, 255);
+            c[1] = rescale((v16 >> 5) & 63, 63, 255);
+            c[2] = rescale(v16 & 31, 31, 255);
+            c[3] = 255;
+            break;
+        case kVMPixelFormatB5G5R5A1:
+            c[0] = rescale((v16 >> 10) & 31, 31, 255);
+            c[1] = rescale((v16 >> 5) & 31, 31, 255);
+            c[2] = rescale(v16 & 31, 31, 255);
+            c[3] = (v16 >> 15) * 255;
+            break;
+        case kVMPixelFormatR10G10B10A2:
+            c[0] = rescale(v32 & 1023, 1023, 255);
+            c[1] = rescale((v32 >> 10) & 1023, 1023, 255);
+            c[2] = rescale((v32 >> 20) & 1023, 1023, 255);
+            c[3] = rescale(v32 >> 30, 3, 255);
+            break;
+        default:
+            break;
+    }
+}
+
+static void ref_pack(VMPixelFormat f, const uint32_t c[4], uint8_t* p)
+{
+    uint32_t v;
+    switch (f) {
+        case kVMPixelFormatRGBA8: p[0] = c[0]; p[1] = c[1]; p[2] = c[2]; p[3] = c[3]; break;
+        case kVMPixelFormatBGRA8: p[0] = c[2]; p[1] = c[1]; p[2] = c[0]; p[3] = c[3]; break;
+        case kVMPixelFormatARGB8: p[0] = c[3]; p[1] = c[0]; p[2] = c[1]; p[3] = c[2]; break;
+        case kVMPixelFormatABGR8: p[0] = c[3]; p[1] = c[2]; p[2] = c[1]; p[3] = c[0]; break;
+        case kVMPixelFormatRGB8:  p[0] = c[0]; p[1] = c[1]; p[2] = c[2]; break;
+        case kVMPixelFormatBGR8:  p[0] = c[2]; p[1] = c[1]; p[2] = c[0]; break;
+        case kVMPixelFormatL8:    p[0] = (77 * c[0] + 150 * c[1] + 29 * c[2] + 128) >> 8; break;
+        case kVMPixelFormatB5G6R5:
+            v = (rescale(c[0], 255, 31) << 11) | (rescale(c[1], 255, 63) << 5) | rescale(c[2], 255, 31);
+            p[0] = v; p[1] = v >> 8;
+            break;
+        case kVMPixelFormatB5G5R5A1:
+            v = (rescale(c[3], 255, 1) << 15) | (rescale(c[0], 255, 31) << 10) |
+                (rescale(c[1], 255, 31) << 5) | rescale(c[2], 255, 31);
+            p[0] = v; p[1] = v >> 8;
+            break;
+        case kVMPixelFormatR10G10B10A2:
+            v = rescale(c[0], 255, 1023) | (rescale(c[1], 255, 1023) << 10) |
+                (rescale(c[2], 255, 1023) << 20) | (rescale(c[3], 255, 3) << 30);
+            p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+            break;
+        default:
+            break;
+    }
+}
+
+// Same format without an alpha operation is a plain copy, even where
+// going through 8 bits would lose precision
+static void ref_pixel(VMPixelFormat df, uint8_t* d, VMPixelFormat sf, const uint8_t* s, uint32_t flags)
+{
+    if (df == sf && !flags) {
+        memcpy(d, s, VMPixelFormatBytes(sf));
+        return;
+    }
+    uint32_t c[4];
+    ref_unpack(sf, s, c);
+    for (int k = 0; k < 3; k++) {
+        if (flags & kVMPixelConvertPremultiply)
+            c[k] = rescale(c[k] * c[3], 255 * 255, 255);
+        else if (flags & kVMPixelConvertUnpremultiply)
+            c[k] = c[3] ? (uint32_t)fmin(255.0, floor(c[k] * 255.0 / c[3] + 0.5)) : 0;
+    }
+    ref_pack(df, c, d);
+}
+
+// Converts a w x h block at random alignments and pitches, in place when
+// asked, and compares pixels and untouched row padding with the reference
+static void check(VMPixelFormat df, VMPixelFormat sf, const uint8_t* pixels,
+                  uint32_t w, uint32_t h, uint32_t flags, bool in_place)
+{
+    uint32_t db = VMPixelFormatBytes(df), sb = VMPixelFormatBytes(sf);
+    uint32_t src_pitch = w * sb + (rnd() % 3 == 0 ? 0 : rnd() % 40);
+    uint32_t dst_pitch = in_place ? src_pitch : w * db + (rnd() % 3 == 0 ? 0 : rnd() % 40);
+
+    std::vector<uint8_t> src_mem((size_t)src_pitch * h + 64);
+    std::vector<uint8_t> dst_mem((size_t)dst_pitch * h + 64, 0xCD);
+    std::vector<uint8_t> want((size_t)dst_pitch * h + 64);
+    uint8_t* src = src_mem.data() + rnd() % 16;
+    for (size_t i = 0; i < src_mem.size() - 16; i++)
+        src[i] = (uint8_t)rnd();
+    for (uint32_t y = 0; y < h; y++)
+        memcpy(src + (size_t)y * src_pitch, pixels + (size_t)y * w * sb, (size_t)w * sb);
+
+    uint8_t* dst = in_place ? src : dst_mem.data() + rnd() % 16;
+    memcpy(want.data(), dst, want.size() - 16);
+    for (uint32_t y = 0; y < h; y++)
+        for (uint32_t x = 0; x < w; x++)
+            ref_pixel(df, want.data() + (size_t)y * dst_pitch + x * db,
+                      sf, src + (size_t)y * src_pitch + x * sb, flags);
+
+    VMPixelImage out = { dst, dst_pitch, df };
+    VMPixelImage in = { src, src_pitch, sf };
+    if (!VMPixelConvert(&out, &in, w, h, flags)) {
+        FAIL("%s -> %s flags %u %ux%u refused\n", format_name(sf), format_name(df), flags, w, h);
+        return;
+    }
+    for (uint32_t y = 0; y < h; y++) {
+        const uint8_t* got = dst + (size_t)y * dst_pitch;
+        const uint8_t* exp = want.data() + (size_t)y * dst_pitch;
+        uint32_t span = y + 1 < h ? dst_pitch : w * db;
+        for (uint32_t i = 0; i < span; i++) {
+            if (got[i] != exp[i]) {
+                FAIL("%s -> %s flags %u %ux%u%s pixel (%u,%u) byte %u got %02x want %02x\n",
+                     format_name(sf), format_name(df), flags, w, h, in_place ? " in place" : "",
+                     i / db, y, i % db, got[i], exp[i]);
+                return;
+            }
+        }
+    }
+}
+
+static const uint32_t s_flag_choices[3] = {
+    0, kVMPixelConvertPremultiply, kVMPixelConvertUnpremultiply
+};
+
+static void test_random(int cases)
+{
+    std::vector<uint8_t> pixels(160 * 6 * 4);
+    for (int i = 0; i < cases; i++) {
+        VMPixelFormat sf = (VMPixelFormat)(1 + rnd() % (kVMPixelFormatCount - 1));
+        VMPixelFormat df = (VMPixelFormat)(1 + rnd() % (kVMPixelFormatCount - 1));
+        uint32_t flags = s_flag_choices[rnd() % 3];
+        bool in_place = VMPixelFormatBytes(sf) == VMPixelFormatBytes(df) && rnd() % 4 == 0;
+        uint32_t w = 1 + rnd() % 150, h = 1 + rnd() % 5;
+        for (size_t k = 0; k < pixels.size(); k++)
+            pixels[k] = (uint8_t)rnd();
+        // Alpha at the extremes happens often in practice
+        if (rnd() % 4 == 0)
+            for (size_t k = 0; k < pixels.size(); k++)
+                pixels[k] = rnd() % 2 ? 0 : 255;
+        check(df, sf, pixels.data(), w, h, flags, in_place);
+    }
+}
+
+static void test_exhaustive()
+{
+    std::vector<uint8_t> pixels(65536 * 4);
+
+    // Every 16-bit pixel out to every format
+    for (uint32_t v = 0; v < 65536; v++) {
+        pixels[2 * v] = (uint8_t)v;
+        pixels[2 * v + 1] = (uint8_t)(v >> 8);
+    }
+    for (int f = 1; f < kVMPixelFormatCount; f++) {
+        check((VMPixelFormat)f, kVMPixelFormatB5G6R5, pixels.data(), 256, 256, 0, false);
+        check((VMPixelFormat)f, kVMPixelFormatB5G5R5A1, pixels.data(), 256, 256, 0, false);
+    }
+
+    // Every 10-bit value in every channel, and every 2-bit alpha
+    for (uint32_t i = 0; i < 1024; i++) {
+        uint32_t v = i | ((1023 - i) << 10) | (((i * 7) & 1023) << 20) | ((i & 3) << 30);
+        memcpy(&pixels[4 * i], &v, 4);
+    }
+    check(kVMPixelFormatRGBA8, kVMPixelFormatR10G10B10A2, pixels.data(), 1024, 1, 0, false);
+
+    // Every (color, alpha) pair through both alpha operations, and every
+    // 8-bit value through every packer
+    for (uint32_t i = 0; i < 65536; i++) {
+        pixels[4 * i] = (uint8_t)i;
+        pixels[4 * i + 1] = (uint8_t)(255 - i);
+        pixels[4 * i + 2] = (uint8_t)(i * 37);
+        pixels[4 * i + 3] = (uint8_t)(i >> 8);
+    }
+    check(kVMPixelFormatRGBA8, kVMPixelFormatRGBA8, pixels.data(), 256, 256, kVMPixelConvertPremultiply, false);
+    check(kVMPixelFormatRGBA8, kVMPixelFormatRGBA8, pixels.data(), 256, 256, kVMPixelConvertUnpremultiply, false);
+    check(kVMPixelFormatBGRA8, kVMPixelFormatRGBA8, pixels.data(), 256, 256, kVMPixelConvertUnpremultiply, true);
+    for (int f = 1; f < kVMPixelFormatCount; f++)
+        check((VMPixelFormat)f, kVMPixelFormatRGBA8, pixels.data(), 256, 256, 0, false);
+}
+
+static void test_arguments()
+{
+    uint8_t src[64], dst[64];
+    memset(src, 0x11, sizeof(src));
+    memset(dst, 0x22, sizeof(dst));
+    VMPixelImage in = { src, 16, kVMPixelFormatRGBA8 };
+    VMPixelImage out = { dst, 16, kVMPixelFormatBGRA8 };
+    VMPixelImage bad = { dst, 16, kVMPixelFormatInvalid };
+    VMPixelImage narrow = { dst, 15, kVMPixelFormatBGRA8 };
+
+    if (VMPixelConvert(&out, &in, 4, 4, kVMPixelConvertPremultiply | kVMPixelConvertUnpremultiply))
+        FAIL("both alpha operations accepted\n");
+    if (VMPixelConvert(&out, &in, 4, 4, 0x80))
+        FAIL("unknown flag accepted\n");
+    if (VMPixelConvert(&bad, &in, 4, 4, 0))
+        FAIL("invalid format accepted\n");
+    if (VMPixelConvert(&narrow, &in, 4, 4, 0))
+        FAIL("short pitch accepted\n");
+    if (VMPixelConvert(&out, NULL, 4, 4, 0))
+        FAIL("null source accepted\n");
+    for (size_t i = 0; i < sizeof(dst); i++)
+        if (dst[i] != 0x22) {
+            FAIL("refused conversion wrote the destination\n");
+            break;
+        }
+    if (!VMPixelConvert(&out, &in, 0, 4, 0))
+        FAIL("empty block refused\n");
+}
+
+struct BenchCase {
+    VMPixelFormat dst;
+    VMPixelFormat src;
+    uint32_t      flags;
+    const char*   name;
+};
+
+static const BenchCase s_bench[] = {
+    { kVMPixelFormatRGBA8,       kVMPixelFormatBGRA8,       0,                              "bgra8 -> rgba8" },
+    { kVMPixelFormatBGRA8,       kVMPixelFormatRGB8,        0,                              "rgb8 -> bgra8" },
+    { kVMPixelFormatRGB8,        kVMPixelFormatBGRA8,       0,                              "bgra8 -> rgb8" },
+    { kVMPixelFormatL8,          kVMPixelFormatBGRA8,       0,                              "bgra8 -> l8" },
+    { kVMPixelFormatBGRA8,       kVMPixelFormatL8,          0,                              "l8 -> bgra8" },
+    { kVMPixelFormatRGBA8,       kVMPixelFormatRGBA8,       kVMPixelConvertPremultiply,     "premultiply" },
+    { kVMPixelFormatRGBA8,       kVMPixelFormatRGBA8,       kVMPixelConvertUnpremultiply,   "unpremultiply" },
+    { kVMPixelFormatB5G6R5,      kVMPixelFormatRGBA8,       0,                              "rgba8 -> 565" },
+    { kVMPixelFormatRGBA8,       kVMPixelFormatB5G6R5,      0,                              "565 -> rgba8" },
+    { kVMPixelFormatB5G5R5A1,    kVMPixelFormatBGRA8,       0,                              "bgra8 -> 1555" },
+    { kVMPixelFormatR10G10B10A2, kVMPixelFormatRGBA8,       0,                              "rgba8 -> 1010102" },
+    { kVMPixelFormatRGBA8,       kVMPixelFormatR10G10B10A2, 0,                              "1010102 -> rgba8" },
+};
+
+// GB/s counts bytes read plus bytes written
+static void bench(VMBlit2DPath best)
+{
+    const uint32_t w = 1920, h = 1080;
+    std::vector<uint8_t> src((size_t)w * h * 4), dst((size_t)w * h * 4);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = (uint8_t)rnd();
+
+    printf("%-18s", "1920x1080, GB/s");
+    for (int p = kVMBlit2DPathScalar; p <= best; p++)
+        printf(" %8s", VMBlit2DPathName((VMBlit2DPath)p));
+    printf("\n");
+
+    for (size_t c = 0; c < sizeof(s_bench) / sizeof(s_bench[0]); c++) {
+        const BenchCase& b = s_bench[c];
+        uint32_t sb = VMPixelFormatBytes(b.src), db = VMPixelFormatBytes(b.dst);
+        VMPixelImage in = { src.data(), w * sb, b.src };
+        VMPixelImage out = { dst.data(), w * db, b.dst };
+        printf("%-18s", b.name);
+        for (int p = kVMBlit2DPathScalar; p <= best; p++) {
+            VMPixelConvertSetPath((VMBlit2DPath)p);
+            VMPixelConvert(&out, &in, w, h, b.flags);
+            const int reps = 20;
+            double t0 = now_sec();
+            for (int r = 0; r < reps; r++)
+                VMPixelConvert(&out, &in, w, h, b.flags);
+            double t = (now_sec() - t0) / reps;
+            s_sink += dst[0];
+            printf(" %8.2f", (double)w * h * (sb + db) / t * 1e-9);
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool run_bench = !(argc > 1 && strcmp(argv[1], "--no-bench") == 0);
+    VMBlit2DPath best = VMBlit2DBestPath();
+    printf(LOG_TAG " best path on this CPU: %s%s\n", VMBlit2DPathName(best),
+           VMBlit2DHasSSSE3() ? " (ssse3)" : "");
+
+    test_arguments();
+    printf(LOG_TAG " arguments %s\n", s_failures ? "FAILED" : "ok");
+
+    for (int p = kVMBlit2DPathScalar; p <= best; p++) {
+        VMBlit2DPath path = VMPixelConvertSetPath((VMBlit2DPath)p);
+        int before = s_failures;
+        test_random(4000);
+        test_exhaustive();
+        printf(LOG_TAG " %-7s%s %s\n", VMBlit2DPathName(path),
+               path == kVMBlit2DPathSSE2 && !VMPixelConvertUsesSSSE3() ? " (no ssse3, scalar)" : "",
+               s_failures == before ? "ok" : "FAILED");
+    }
+
+    if (s_failures) {
+        printf(LOG_TAG " %d failures\n", s_failures);
+        return 1;
+    }
+
+    if (run_bench) {
+        printf("\n");
+        bench(best);
+    }
+    return 0;
+}
@@ -0,0 +1,18 @@
+#!/bin/bash
+# Build shadercache: the userspace helper that keeps the kext's shader
+# cache on disk across reboots. Cross-compiled on a modern macOS host for
+# Snow Leopard 10.6.
+set -e
+
+cd "$(dirname "$0")"
+
+clang -arch x86_64 -mmacosx-version-min=10.6 -O2 -Wall -Wextra \
+      -I../../FB -o shadercache shadercache.c \
+      -framework IOKit -framework CoreFoundation
+
+echo "Built: $(pwd)/shadercache"
+echo
+echo "To deploy on the guest:"
+echo "  sudo cp shadercache /usr/local/libexec/vmqemuvga-shadercache"
+echo "  sudo cp ../../com.vmqemuvga.shadercache.plist /Library/LaunchDaemons/"
+echo "  sudo launchctl load /Library/LaunchDaemons/com.vmqemuvga.shadercache.plist"
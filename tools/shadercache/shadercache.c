@@ -0,0 +1,328 @@
+/*
+ * shadercache.c - keeps the kext's shader compile/link cache on disk
+ *
+ * Talks to VMVirtIOGPUUserClient (type 4) through the shader-cache
+ * selectors. The image format is FB/VMShaderCacheFile.h; this tool only
+ * checks the header, identity and checksum and otherwise treats it as opaque.
+ *
+ *   shadercache info
+ *   shadercache load   [file]
+ *   shadercache save   [file]
+ *   shadercache daemon [file] [seconds]
+ *
+ * Must run as root: the selectors are administrator only.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <mach/mach.h>
+#include <IOKit/IOKitLib.h>
+#include <CommonCrypto/CommonDigest.h>
+
+#include "VMShaderCacheFile.h"
+
+#define SEL_SHADER_CACHE_INFO       0x600A
+#define SEL_SHADER_CACHE_EXPORT     0x600B
+#define SEL_SHADER_CACHE_IMPORT     0x600C
+
+#define DEFAULT_CACHE_DIR           "/Library/Caches/com.vmqemuvga"
+#define DEFAULT_CACHE_FILE          DEFAULT_CACHE_DIR "/ShaderCache.bin"
+#define DEFAULT_INTERVAL            60      /* seconds between generation polls */
+#define EXPORT_RETRIES              4       /* the cache may grow between size query and export */
+
+struct cache_info {
+    uint8_t  identity[VM_SHADER_CACHE_DIGEST_SIZE];
+    uint64_t generation;
+    uint32_t export_size;
+};
+
+static volatile sig_atomic_t g_stop;
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    g_stop = 1;
+}
+
+static io_connect_t open_connection(void)
+{
+    io_service_t service = IOServiceGetMatchingService(kIOMasterPortDefault,
+                               IOServiceMatching("VMQemuVGAAccelerator"));
+    io_connect_t connect = IO_OBJECT_NULL;
+    if (service == IO_OBJECT_NULL)
+        return IO_OBJECT_NULL;
+    if (IOServiceOpen(service, mach_task_self(), 4, &connect) != KERN_SUCCESS)
+        connect = IO_OBJECT_NULL;
+    IOObjectRelease(service);
+    return connect;
+}
+
+static kern_return_t query_info(io_connect_t connect, struct cache_info* info)
+{
+    uint64_t out[2] = { 0, 0 };
+    uint32_t out_count = 2;
+    size_t identity_size = sizeof(info->identity);
+    kern_return_t kr = IOConnectCallMethod(connect, SEL_SHADER_CACHE_INFO,
+                                           NULL, 0, NULL, 0,
+                                           out, &out_count,
+                                           info->identity, &identity_size);
+    info->generation = out[0];
+    info->export_size = (uint32_t)out[1];
+    return kr;
+}
+
+static int verify_image(const uint8_t* image, size_t size, const uint8_t* identity,
+                        const char* path)
+{
+    const struct vm_shader_cache_file_header* header =
+        (const struct vm_shader_cache_file_header*)image;
+    uint8_t digest[CC_SHA256_DIGEST_LENGTH];
+
+    if (size < sizeof(*header) ||
+        header->magic != VM_SHADER_CACHE_FILE_MAGIC ||
+        header->version != VM_SHADER_CACHE_FILE_VERSION ||
+        header->header_size != sizeof(*header) ||
+        header->payload_size != size - sizeof(*header)) {
+        fprintf(stderr, "shadercache: %s: not a version %d cache image\n",
+                path, VM_SHADER_CACHE_FILE_VERSION);
+        return -1;
+    }
+    CC_SHA256(image + sizeof(*header), header->payload_size, digest);
+    if (memcmp(digest, header->checksum, sizeof(digest)) != 0) {
+        fprintf(stderr, "shadercache: %s: checksum mismatch\n", path);
+        return -1;
+    }
+    if (memcmp(identity, header->identity, VM_SHADER_CACHE_DIGEST_SIZE) != 0) {
+        fprintf(stderr, "shadercache: %s: made for another kext version or host renderer\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+/* Loads path into the kext. A missing file is not an error; a corrupt or
+ * stale one is removed so the next save starts clean. */
+static int load_cache(io_connect_t connect, const char* path)
+{
+    struct cache_info info;
+    struct stat st;
+    uint8_t* image;
+    int fd, result = -1;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        if (errno == ENOENT) {
+            printf("shadercache: no cache at %s\n", path);
+            return 0;
+        }
+        fprintf(stderr, "shadercache: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 || st.st_size > VM_SHADER_CACHE_FILE_MAX) {
+        fprintf(stderr, "shadercache: %s: unusable size\n", path);
+        close(fd);
+        unlink(path);
+        return -1;
+    }
+
+    image = malloc((size_t)st.st_size);
+    if (!image || read(fd, image, (size_t)st.st_size) != st.st_size) {
+        fprintf(stderr, "shadercache: %s: read failed\n", path);
+        free(image);
+        close(fd);
+        return -1;
+    }
+    close(fd);
+
+    kern_return_t kr = query_info(connect, &info);
+    if (kr != KERN_SUCCESS) {
+        fprintf(stderr, "shadercache: info selector failed: 0x%x\n", kr);
+    } else if (verify_image(image, (size_t)st.st_size, info.identity, path) != 0) {
+        unlink(path);
+    } else {
+        uint64_t out[2] = { 0, 0 };
+        uint32_t out_count = 2;
+        kr = IOConnectCallMethod(connect, SEL_SHADER_CACHE_IMPORT,
+                                 NULL, 0, image, (size_t)st.st_size,
+                                 out, &out_count, NULL, NULL);
+        if (kr == KERN_SUCCESS) {
+            printf("shadercache: loaded %s: %llu shaders, %llu programs\n",
+                   path, (unsigned long long)out[0], (unsigned long long)out[1]);
+            result = 0;
+        } else {
+            fprintf(stderr, "shadercache: import of %s failed: 0x%x\n", path, kr);
+        }
+    }
+    free(image);
+    return result;
+}
+
+/* Exports the kext cache and replaces path atomically: a crash mid-write
+ * leaves the previous image in place. */
+static int save_cache(io_connect_t connect, const char* path, uint64_t* generation)
+{
+    struct cache_info info;
+    char tmp_path[1024];
+    uint8_t* image = NULL;
+    size_t size = 0;
+    kern_return_t kr = KERN_FAILURE;
+    int fd;
+
+    if (query_info(connect, &info) != KERN_SUCCESS)
+        return -1;
+    size = info.export_size;
+    for (int attempt = 0; attempt < EXPORT_RETRIES; attempt++) {
+        uint64_t needed = 0;
+        uint32_t out_count = 1;
+        uint8_t* grown = realloc(image, size);
+        if (!grown)
+            break;
+        image = grown;
+        kr = IOConnectCallMethod(connect, SEL_SHADER_CACHE_EXPORT,
+                                 NULL, 0, NULL, 0,
+                                 &needed, &out_count, image, &size);
+        if (kr != kIOReturnNoSpace)
+            break;
+        size = (size_t)needed;
+    }
+    if (kr != KERN_SUCCESS) {
+        fprintf(stderr, "shadercache: export failed: 0x%x\n", kr);
+        free(image);
+        return -1;
+    }
+    if (verify_image(image, size, info.identity, "export") != 0) {
+        free(image);
+        return -1;
+    }
+
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0 || write(fd, image, size) != (ssize_t)size || fsync(fd) != 0) {
+        fprintf(stderr, "shadercache: %s: %s\n", tmp_path, strerror(errno));
+        if (fd >= 0) close(fd);
+        unlink(tmp_path);
+        free(image);
+        return -1;
+    }
+    close(fd);
+    if (rename(tmp_path, path) != 0) {
+        fprintf(stderr, "shadercache: %s: %s\n", path, strerror(errno));
+        unlink(tmp_path);
+        free(image);
+        return -1;
+    }
+
+    const struct vm_shader_cache_file_header* header =
+        (const struct vm_shader_cache_file_header*)image;
+    printf("shadercache: saved %s: generation %llu, %u shaders, %u programs, %zu bytes\n",
+           path, (unsigned long long)header->generation, header->shader_count,
+           header->program_count, size);
+    if (generation)
+        *generation = header->generation;
+    free(image);
+    return 0;
+}
+
+/* Loads at start, then saves whenever the kext cache generation moves and
+ * once more on SIGTERM (shutdown). */
+static int run_daemon(const char* path, unsigned interval)
+{
+    struct cache_info info;
+    io_connect_t connect;
+    uint64_t saved_generation;
+
+    signal(SIGTERM, on_signal);
+    signal(SIGINT, on_signal);
+
+    /* At boot the kext may still be matching; wait for it */
+    while ((connect = open_connection()) == IO_OBJECT_NULL) {
+        if (g_stop)
+            return 0;
+        sleep(5);
+    }
+
+    mkdir(DEFAULT_CACHE_DIR, 0755);
+    load_cache(connect, path);
+    if (query_info(connect, &info) != KERN_SUCCESS) {
+        fprintf(stderr, "shadercache: info selector failed; is this running as root?\n");
+        IOServiceClose(connect);
+        return 1;
+    }
+    saved_generation = info.generation;
+
+    while (!g_stop) {
+        sleep(interval);
+        if (query_info(connect, &info) != KERN_SUCCESS)
+            break;
+        if (info.generation != saved_generation)
+            save_cache(connect, path, &saved_generation);
+    }
+
+    if (query_info(connect, &info) == KERN_SUCCESS && info.generation != saved_generation)
+        save_cache(connect, path, NULL);
+    IOServiceClose(connect);
+    return 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: shadercache info\n"
+            "       shadercache load   [file]\n"
+            "       shadercache save   [file]\n"
+            "       shadercache daemon [file] [seconds]\n"
+            "default file: %s\n", DEFAULT_CACHE_FILE);
+}
+
+int main(int argc, char** argv)
+{
+    const char* path = argc > 2 ? argv[2] : DEFAULT_CACHE_FILE;
+    io_connect_t connect;
+    int result = 1;
+
+    if (argc < 2) {
+        usage();
+        return 1;
+    }
+    if (strcmp(argv[1], "daemon") == 0) {
+        unsigned interval = argc > 3 ? (unsigned)strtoul(argv[3], NULL, 10) : DEFAULT_INTERVAL;
+        return run_daemon(path, interval ? interval : DEFAULT_INTERVAL);
+    }
+
+    connect = open_connection();
+    if (connect == IO_OBJECT_NULL) {
+        fprintf(stderr, "shadercache: VMQemuVGAAccelerator not found (is VMQemuVGA.kext loaded?)\n");
+        return 1;
+    }
+
+    if (strcmp(argv[1], "info") == 0) {
+        struct cache_info info;
+        kern_return_t kr = query_info(connect, &info);
+        if (kr == KERN_SUCCESS) {
+            printf("generation %llu, export size %u bytes, identity ",
+                   (unsigned long long)info.generation, info.export_size);
+            for (int i = 0; i < VM_SHADER_CACHE_DIGEST_SIZE; i++)
+                printf("%02x", info.identity[i]);
+            printf("\n");
+            result = 0;
+        } else {
+            fprintf(stderr, "shadercache: info selector failed: 0x%x\n", kr);
+        }
+    } else if (strcmp(argv[1], "load") == 0) {
+        result = load_cache(connect, path) == 0 ? 0 : 1;
+    } else if (strcmp(argv[1], "save") == 0) {
+        if (argc <= 2)
+            mkdir(DEFAULT_CACHE_DIR, 0755);
+        result = save_cache(connect, path, NULL) == 0 ? 0 : 1;
+    } else {
+        usage();
+    }
+
+    IOServiceClose(connect);
+    return result;
+}
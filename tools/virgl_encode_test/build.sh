@@ -0,0 +1,19 @@
+#!/bin/bash
+# Build and run virgl_encode_test: FB/virgl_encode.h checked against golden
+# command streams, built as both C and C++, then benchmarked.
+# Runs on any Linux or macOS host; the encoder has no IOKit dependency.
+set -e
+
+cd "$(dirname "$0")"
+
+CC=${CC:-cc}
+CXX=${CXX:-c++}
+
+$CC -O2 -std=c99 -Wall -Wextra -I../../FB -c -o encode_c_check.o encode_c_check.c
+$CXX -O2 -std=c++11 -Wall -Wextra -I../../FB \
+     -o virgl_encode_test virgl_encode_test.cpp encode_c_check.o
+rm -f encode_c_check.o
+
+echo "Built: $(pwd)/virgl_encode_test"
+echo
+./virgl_encode_test "$@"
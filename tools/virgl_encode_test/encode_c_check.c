@@ -0,0 +1,20 @@
+/*
+ * encode_c_check.c - builds FB/virgl_encode.h as C (VirtGLGL and the probe
+ * tools are C) and returns a stream for virgl_encode_test to compare.
+ */
+
+#include "virgl_encode.h"
+
+int encode_c_check(uint32_t* out, uint32_t capacity)
+{
+    struct virgl_encoder enc;
+    struct virgl_draw_info info = { 0 };
+    const float rgba[4] = { 0.0f, 0.5f, 1.0f, 1.0f };
+
+    virgl_encoder_init(&enc, out, capacity);
+    virgl_encode_clear(&enc, PIPE_CLEAR_COLOR0, rgba, 1.0, 0);
+    info.count = 3;
+    info.mode = PIPE_PRIM_TRIANGLES;
+    virgl_encode_draw_vbo(&enc, &info);
+    return (int)enc.len;
+}
@@ -0,0 +1,338 @@
+// Golden-stream and throughput suite for FB/virgl_encode.h.
+//
+// Every emitter is checked dword for dword against a stream written out by
+// hand from virglrenderer's decoder layouts (vrend_decode.c), so a change to
+// the encoder that alters bytes on the wire fails here before it reaches a
+// guest. Overflow handling is checked for the all-or-nothing contract, and
+// encode_c_check.c confirms the header still builds as C.
+
+#include "virgl_encode.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LOG_TAG "[virgl_encode]"
+
+extern "C" int encode_c_check(uint32_t* out, uint32_t capacity);
+
+static int s_failures = 0;
+
+static double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t f2u(float f)
+{
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+static void expect_stream(const char* what, const virgl_encoder* enc,
+                          const uint32_t* golden, uint32_t golden_len)
+{
+    bool ok = enc->len == golden_len && enc->overflow == 0 &&
+              memcmp(enc->buf, golden, golden_len * sizeof(uint32_t)) == 0;
+    if (ok) {
+        return;
+    }
+    s_failures++;
+    fprintf(stderr, LOG_TAG " FAIL %s: %u dwords (want %u), overflow %u\n",
+            what, enc->len, golden_len, enc->overflow);
+    uint32_t n = enc->len > golden_len ? enc->len : golden_len;
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t got = i < enc->len ? enc->buf[i] : 0;
+        uint32_t want = i < golden_len ? golden[i] : 0;
+        fprintf(stderr, "  [%2u] 0x%08x %s 0x%08x\n", i, got, got == want ? "==" : "!=", want);
+    }
+}
+
+#define GOLDEN(what, enc, ...) \
+    do { \
+        static const uint32_t golden[] = { __VA_ARGS__ }; \
+        expect_stream(what, enc, golden, sizeof(golden) / sizeof(golden[0])); \
+    } while (0)
+
+static void check(bool ok, const char* what)
+{
+    if (!ok) {
+        s_failures++;
+        fprintf(stderr, LOG_TAG " FAIL %s\n", what);
+    }
+}
+
+static void test_golden()
+{
+    uint32_t buf[256];
+    virgl_encoder enc;
+
+    virgl_encoder_init(&enc, buf, 256);
+    virgl_encode_nop(&enc);
+    GOLDEN("nop", &enc, 0x00000000);
+
+    // CLEAR: opcode 7, 8 payload dwords, depth as a little-endian double
+    virgl_encoder_init(&enc, buf, 256);
+    const float rgba[4] = { 0.2f, 0.4f, 0.6f, 1.0f };
+    virgl_encode_clear(&enc, PIPE_CLEAR_COLOR0 | PIPE_CLEAR_DEPTH, rgba, 1.0, 0x7f);
+    GOLDEN("clear", &enc,
+           0x00080007, 0x00000005,
+           0x3e4ccccd, 0x3ecccccd, 0x3f19999a, 0x3f800000,
+           0x00000000, 0x3ff00000,
+           0x0000007f);
+
+    virgl_encoder_init(&enc, buf, 256);
+    const float scale[3] = { 400.0f, 300.0f, 0.5f };
+    const float translate[3] = { 400.0f, 300.0f, 0.5f };
+    virgl_encode_set_viewport(&enc, 0, scale, translate);
+    GOLDEN("set_viewport", &enc,
+           0x00070004, 0,
+           0x43c80000, 0x43960000, 0x3f000000,
+           0x43c80000, 0x43960000, 0x3f000000);
+
+    // Length must be nr_cbufs + 2 exactly; the host rejects padding
+    virgl_encoder_init(&enc, buf, 256);
+    const uint32_t cbufs[2] = { 10, 11 };
+    virgl_encode_set_framebuffer_state(&enc, 1, cbufs, 3);
+    virgl_encode_set_framebuffer_state(&enc, 2, cbufs, 0);
+    GOLDEN("set_framebuffer_state", &enc,
+           0x00030005, 1, 3, 10,
+           0x00040005, 2, 0, 10, 11);
+
+    // Object type rides in bits 8-15 of CREATE/BIND/DESTROY headers
+    virgl_encoder_init(&enc, buf, 256);
+    virgl_encode_create_surface(&enc, 0x42, 0x100, VIRGL_FORMAT_B8G8R8A8_UNORM, 0, 0);
+    GOLDEN("create_surface", &enc, 0x00050801, 0x42, 0x100, 1, 0, 0);
+
+    virgl_encoder_init(&enc, buf, 256);
+    const uint32_t dsa[VIRGL_OBJ_DSA_SIZE - 1] = {
+        VIRGL_OBJ_DSA_S0_DEPTH_ENABLE(1) | VIRGL_OBJ_DSA_S0_DEPTH_WRITEMASK(1) |
+            VIRGL_OBJ_DSA_S0_DEPTH_FUNC(PIPE_FUNC_LESS),
+        0, 0, f2u(0.0f)
+    };
+    virgl_encode_create_object(&enc, VIRGL_OBJECT_DSA, 7, dsa, VIRGL_OBJ_DSA_SIZE - 1);
+    virgl_encode_bind_object(&enc, VIRGL_OBJECT_DSA, 7);
+    virgl_encode_destroy_object(&enc, VIRGL_OBJECT_DSA, 7);
+    GOLDEN("dsa create/bind/destroy", &enc,
+           0x00050301, 7, 0x00000007, 0, 0, 0,
+           0x00010302, 7,
+           0x00010303, 7);
+
+    virgl_encoder_init(&enc, buf, 256);
+    const uint32_t samplers[3] = { 20, 21, 22 };
+    virgl_encode_bind_sampler_states(&enc, PIPE_SHADER_FRAGMENT, 1, 3, samplers);
+    GOLDEN("bind_sampler_states", &enc, 0x00050012, 1, 1, 20, 21, 22);
+
+    virgl_encoder_init(&enc, buf, 256);
+    virgl_encode_bind_shader(&enc, 9, PIPE_SHADER_VERTEX);
+    GOLDEN("bind_shader", &enc, 0x0002001f, 9, 0);
+
+    virgl_encoder_init(&enc, buf, 256);
+    const virgl_vertex_buffer vbs[2] = { { 48, 256, 5 }, { 16, 0, 6 } };
+    virgl_encode_set_vertex_buffers(&enc, 2, vbs);
+    GOLDEN("set_vertex_buffers", &enc, 0x00060006, 48, 256, 5, 16, 0, 6);
+
+    virgl_encoder_init(&enc, buf, 256);
+    virgl_encode_set_index_buffer(&enc, 8, 2, 512);
+    GOLDEN("set_index_buffer", &enc, 0x0003000b, 8, 2, 512);
+
+    virgl_encoder_init(&enc, buf, 256);
+    virgl_encode_set_uniform_buffer(&enc, PIPE_SHADER_FRAGMENT, 0, 256, 192, 14);
+    GOLDEN("set_uniform_buffer", &enc, 0x0005001b, 1, 0, 256, 192, 14);
+
+    virgl_encoder_init(&enc, buf, 256);
+    const float consts[2] = { 1.0f, 0.5f };
+    virgl_encode_set_constant_buffer(&enc, PIPE_SHADER_FRAGMENT, consts, 2);
+    GOLDEN("set_constant_buffer", &enc, 0x0004000c, 1, 0, 0x3f800000, 0x3f000000);
+
+    // Shader text: offlen counts the NUL, which lands in a zeroed pad dword
+    virgl_encoder_init(&enc, buf, 256);
+    memset(buf, 0xAB, sizeof(buf));
+    virgl_encode_create_shader(&enc, 0x21, PIPE_SHADER_VERTEX, "VERT", 4, 300);
+    GOLDEN("create_shader", &enc,
+           0x00070401, 0x21, 0, 5, 300, 0, 0x54524556, 0x00000000);
+
+    virgl_encoder_init(&enc, buf, 256);
+    memset(buf, 0xAB, sizeof(buf));
+    virgl_encode_create_shader(&enc, 0x22, PIPE_SHADER_FRAGMENT, "FRAG\nEND", 8, 8);
+    GOLDEN("create_shader padded", &enc,
+           0x00080401, 0x22, 1, 9, 8, 0, 0x47415246, 0x444e450a, 0x00000000);
+
+    // instance_count 0 goes out as 1; index_bias is two's complement
+    virgl_encoder_init(&enc, buf, 256);
+    virgl_draw_info info = {};
+    info.start = 0;
+    info.count = 36;
+    info.mode = PIPE_PRIM_TRIANGLES;
+    info.indexed = 1;
+    info.index_bias = -4;
+    info.min_index = 4;
+    info.max_index = 27;
+    virgl_encode_draw_vbo(&enc, &info);
+    GOLDEN("draw_vbo", &enc,
+           0x000b0008, 0, 36, 4, 1, 1, 0xfffffffc, 0, 0, 0, 4, 27);
+
+    // Inline write: payload rounded up to dwords, pad bytes zero
+    virgl_encoder_init(&enc, buf, 256);
+    memset(buf, 0xAB, sizeof(buf));
+    const uint8_t bytes[6] = { 1, 2, 3, 4, 5, 6 };
+    virgl_encode_inline_write(&enc, 0x30, 64, bytes, 6);
+    GOLDEN("inline_write", &enc,
+           0x000d0009, 0x30, 0, 0, 0, 0, 64, 0, 0, 6, 1, 1,
+           0x04030201, 0x00000605);
+
+    // Blit: mask and filter share dword 1, boxes are dst then src
+    virgl_encoder_init(&enc, buf, 256);
+    const virgl_blit_box blit_dst = { 0x40, 3, VIRGL_FORMAT_R8G8B8A8_SRGB, 0, 0, 0, 32, 16, 1 };
+    const virgl_blit_box blit_src = { 0x40, 2, VIRGL_FORMAT_R8G8B8A8_SRGB, 0, 0, 0, 64, 32, 1 };
+    virgl_encode_blit(&enc, &blit_dst, &blit_src, PIPE_MASK_RGBA, PIPE_TEX_FILTER_LINEAR);
+    GOLDEN("blit", &enc,
+           0x00150010, 0x0000010f, 0, 0,
+           0x40, 3, 104, 0, 0, 0, 32, 16, 1,
+           0x40, 2, 104, 0, 0, 0, 64, 32, 1);
+
+    // A whole frame: streams concatenate with no gaps
+    virgl_encoder_init(&enc, buf, 256);
+    virgl_encode_set_framebuffer_state(&enc, 1, cbufs, 0);
+    virgl_encode_clear(&enc, PIPE_CLEAR_COLOR0, rgba, 0.0, 0);
+    virgl_encode_nop(&enc);
+    GOLDEN("probe frame", &enc,
+           0x00030005, 1, 0, 10,
+           0x00080007, 0x00000004,
+           0x3e4ccccd, 0x3ecccccd, 0x3f19999a, 0x3f800000, 0, 0, 0,
+           0x00000000);
+}
+
+static void test_bounds()
+{
+    uint32_t buf[32];
+    virgl_encoder enc;
+
+    // A command that doesn't fit leaves earlier ones and the tail untouched
+    for (uint32_t cap = 0; cap < 32; cap++) {
+        memset(buf, 0xCD, sizeof(buf));
+        virgl_encoder_init(&enc, buf, cap);
+        virgl_draw_info info = {};
+        info.count = 3;
+        int ok_first = virgl_encode_bind_object(&enc, VIRGL_OBJECT_BLEND, 1);
+        int ok_draw = virgl_encode_draw_vbo(&enc, &info);
+        uint32_t want_len = (ok_first ? 2u : 0u) + (ok_draw ? 12u : 0u);
+        check(ok_first == (cap >= 2), "bounds: bind admitted iff room");
+        check(ok_draw == (cap >= (ok_first ? 14u : 12u)), "bounds: draw admitted iff room");
+        check(enc.len == want_len && enc.len <= cap, "bounds: len");
+        check(enc.overflow == (uint32_t)(!ok_first + !ok_draw), "bounds: overflow count");
+        bool tail_clean = true;
+        for (uint32_t i = enc.len; i < 32; i++) {
+            tail_clean &= buf[i] == 0xCDCDCDCD;
+        }
+        check(tail_clean, "bounds: no partial write");
+    }
+
+    // Too many color buffers is refused outright
+    uint32_t cbufs[VIRGL_MAX_COLOR_BUFS + 1] = {};
+    virgl_encoder_init(&enc, buf, 32);
+    check(!virgl_encode_set_framebuffer_state(&enc, VIRGL_MAX_COLOR_BUFS + 1, cbufs, 0) &&
+          enc.len == 0, "bounds: nr_cbufs > 8");
+
+    // Inline write payload pointer is NULL when the data doesn't fit
+    virgl_encoder_init(&enc, buf, 32);
+    check(virgl_encode_inline_write_buffer(&enc, 1, 0, 81) == NULL && enc.len == 0,
+          "bounds: inline write");
+    check(virgl_encode_inline_write_buffer(&enc, 1, 0, 80) == buf + VIRGL_INLINE_WRITE_HDR_SIZE &&
+          enc.len == 32, "bounds: inline write exact fit");
+
+    // Reset keeps the buffer and overflow count, drops the contents
+    virgl_encoder_reset(&enc);
+    check(enc.len == 0 && enc.overflow == 1 && virgl_encoder_space(&enc) == 32, "reset");
+
+    // Shader text and its NUL must fit whole
+    virgl_encoder_init(&enc, buf, 8);
+    check(!virgl_encode_create_shader(&enc, 1, PIPE_SHADER_VERTEX, "VERTEX_1", 8, 8) &&
+          enc.len == 0 && enc.overflow == 1, "bounds: shader text");
+    check(virgl_encode_create_shader(&enc, 1, PIPE_SHADER_VERTEX, "VERT", 4, 4) && enc.len == 8,
+          "bounds: shader text exact fit");
+}
+
+static void test_c_build()
+{
+    uint32_t a[64], b[64];
+    int n = encode_c_check(a, 64);
+
+    // Same commands from C++
+    virgl_encoder enc;
+    virgl_encoder_init(&enc, b, 64);
+    const float rgba[4] = { 0.0f, 0.5f, 1.0f, 1.0f };
+    virgl_encode_clear(&enc, PIPE_CLEAR_COLOR0, rgba, 1.0, 0);
+    virgl_draw_info info = {};
+    info.count = 3;
+    info.mode = PIPE_PRIM_TRIANGLES;
+    virgl_encode_draw_vbo(&enc, &info);
+    check(n == (int)enc.len && memcmp(a, b, n * sizeof(uint32_t)) == 0, "C and C++ streams match");
+}
+
+// Frame-shaped load: per draw, a state bind, a vertex buffer switch, a small
+// inline upload and the draw itself
+static void bench()
+{
+    const uint32_t capacity = 256 * 1024;
+    uint32_t* buf = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+    float vertices[12 * 4];
+    for (int i = 0; i < 48; i++) {
+        vertices[i] = (float)i;
+    }
+
+    virgl_encoder enc;
+    virgl_encoder_init(&enc, buf, capacity);
+    virgl_draw_info info = {};
+    info.count = 4;
+    info.mode = PIPE_PRIM_TRIANGLE_FAN;
+    virgl_vertex_buffer vb = { 48, 0, 5 };
+
+    const int frames = 2000;
+    const int draws = 1000;
+    uint64_t commands = 0, dwords = 0;
+    double t0 = now_sec();
+    for (int f = 0; f < frames; f++) {
+        virgl_encoder_reset(&enc);
+        for (int d = 0; d < draws; d++) {
+            vb.offset = d * sizeof(vertices);
+            virgl_encode_bind_object(&enc, VIRGL_OBJECT_BLEND, 1 + (d & 3));
+            virgl_encode_inline_write(&enc, 5, vb.offset, vertices, sizeof(vertices));
+            virgl_encode_set_vertex_buffers(&enc, 1, &vb);
+            virgl_encode_draw_vbo(&enc, &info);
+        }
+        commands += 4 * draws;
+        dwords += enc.len;
+    }
+    double elapsed = now_sec() - t0;
+
+    printf(LOG_TAG " %d frames x %d draws: %.1f Mcmd/s, %.2f GB/s encoded (%u dwords/frame)\n",
+           frames, draws, commands / elapsed / 1e6,
+           dwords * sizeof(uint32_t) / elapsed / 1e9, enc.len);
+    free(buf);
+}
+
+int main(int argc, char** argv)
+{
+    bool run_bench = !(argc > 1 && strcmp(argv[1], "--no-bench") == 0);
+
+    test_golden();
+    test_bounds();
+    test_c_build();
+
+    if (s_failures) {
+        printf(LOG_TAG " %d failures\n", s_failures);
+        return 1;
+    }
+    printf(LOG_TAG " golden streams, bounds and C build ok\n");
+
+    if (run_bench) {
+        printf("\n");
+        bench();
+    }
+    return 0;
+}
@@ -0,0 +1,18 @@
+#!/bin/bash
+# Build and run virgl_ffp_test: every FB/virgl_ffp.h program parsed and
+# interpreted against the GL 1.x equations, then generation benchmarked.
+# Runs on any Linux or macOS host; the generator has no IOKit dependency.
+set -e
+
+cd "$(dirname "$0")"
+
+CC=${CC:-cc}
+CXX=${CXX:-c++}
+
+$CC -O2 -std=c99 -Wall -Wextra -I../../FB -c -o ffp_c_check.o ffp_c_check.c
+$CXX -O2 -std=c++11 -Wall -Wextra -I../../FB -o virgl_ffp_test virgl_ffp_test.cpp ffp_c_check.o
+rm -f ffp_c_check.o
+
+echo "Built: $(pwd)/virgl_ffp_test"
+echo
+./virgl_ffp_test "$@"
@@ -0,0 +1,22 @@
+/*
+ * Builds FB/virgl_ffp.h as C99; virgl_ffp_test.cpp checks the programs
+ * match what the C++ build generates for the same key.
+ */
+
+#include "virgl_ffp.h"
+
+uint32_t ffp_c_check(char* vs, char* fs, uint32_t capacity)
+{
+    struct virgl_ffp_key key;
+
+    memset(&key, 0, sizeof(key));
+    key.texture_units = 1;
+    key.flags = VIRGL_FFP_LIGHTING;
+    key.lights = 1;
+    key.alpha_func = PIPE_FUNC_ALWAYS;
+    key.fog_mode = VIRGL_FFP_FOG_LINEAR;
+    if (!virgl_ffp_vertex_shader(&key, vs, capacity)) {
+        return 0;
+    }
+    return virgl_ffp_fragment_shader(&key, fs, capacity);
+}
@@ -0,0 +1,1081 @@
+// Interpreter, golden and throughput suite for FB/virgl_ffp.h.
+//
+// The generated programs can't be compiled by a real virglrenderer here, so
+// each one is parsed with the rules tgsi_text.c applies (declared
+// registers, four-component source swizzles, known opcodes, END last) and
+// then executed by a small TGSI interpreter. The vertex and fragment
+// results are compared against the GL 1.x equations evaluated directly
+// from the same state, for every key shape and randomised state, so a
+// wrong register, swizzle or constant slot shows up as a wrong color.
+
+#include "virgl_ffp.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#define LOG_TAG "[virgl_ffp]"
+
+extern "C" uint32_t ffp_c_check(char* vs, char* fs, uint32_t capacity);
+
+static int s_failures = 0;
+
+static double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void check(bool ok, const char* what)
+{
+    if (!ok) {
+        s_failures++;
+        fprintf(stderr, LOG_TAG " FAIL %s\n", what);
+    }
+}
+
+static uint32_t s_rng = 0x12345678;
+
+static uint32_t rnd()
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static float frand(float lo, float hi)
+{
+    return lo + (hi - lo) * (float)(rnd() & 0xFFFFFF) / (float)0xFFFFFF;
+}
+
+// ---------------------------------------------------------------------------
+// TGSI subset: parser and interpreter
+
+struct Vec4 {
+    float v[4];
+};
+
+enum File { FILE_IN, FILE_OUT, FILE_TEMP, FILE_CONST, FILE_IMM, FILE_SAMP, FILE_COUNT };
+
+struct Operand {
+    File file;
+    uint32_t index;
+    uint8_t swizzle[4];     // source
+    uint32_t mask;          // destination
+    bool negate;
+};
+
+struct Insn {
+    std::string opcode;
+    bool saturate;
+    uint32_t num_src;
+    Operand dst;
+    Operand src[3];
+};
+
+struct Program {
+    bool fragment;
+    std::vector<std::string> in_semantic;       // by IN index
+    std::vector<std::string> out_semantic;      // by OUT index
+    uint32_t num_const;
+    uint32_t num_temp;
+    uint32_t samplers;                          // SAMP mask
+    uint32_t views;                             // SVIEW mask
+    std::vector<Vec4> imm;
+    std::vector<Insn> insns;
+    std::string error;
+};
+
+static bool fail(Program* p, const std::string& line, const char* why)
+{
+    if (p->error.empty()) {
+        p->error = std::string(why) + ": \"" + line + "\"";
+    }
+    return false;
+}
+
+static const char* skip_ws(const char* s)
+{
+    while (*s == ' ' || *s == '\t') s++;
+    return s;
+}
+
+static bool parse_uint(const char** s, uint32_t* out)
+{
+    if (**s < '0' || **s > '9') return false;
+    uint32_t v = 0;
+    while (**s >= '0' && **s <= '9') {
+        v = v * 10 + (uint32_t)(**s - '0');
+        (*s)++;
+    }
+    *out = v;
+    return true;
+}
+
+static bool parse_file(const char** s, File* file)
+{
+    static const struct { const char* name; File file; } files[] = {
+        { "TEMP", FILE_TEMP }, { "CONST", FILE_CONST }, { "IMM", FILE_IMM },
+        { "SAMP", FILE_SAMP }, { "IN", FILE_IN }, { "OUT", FILE_OUT },
+    };
+    for (const auto& f : files) {
+        size_t n = strlen(f.name);
+        if (strncmp(*s, f.name, n) == 0 && (*s)[n] == '[') {
+            *s += n + 1;
+            *file = f.file;
+            return true;
+        }
+    }
+    return false;
+}
+
+static int component(char c)
+{
+    switch (c) {
+    case 'x': return 0;
+    case 'y': return 1;
+    case 'z': return 2;
+    case 'w': return 3;
+    default: return -1;
+    }
+}
+
+static bool parse_operand(const char** s, bool dst, Operand* op)
+{
+    *s = skip_ws(*s);
+    op->negate = false;
+    if (!dst && **s == '-') {
+        op->negate = true;
+        (*s)++;
+    }
+    if (!parse_file(s, &op->file) || !parse_uint(s, &op->index) || **s != ']') return false;
+    (*s)++;
+    for (int i = 0; i < 4; i++) op->swizzle[i] = (uint8_t)i;
+    op->mask = 0xF;
+    if (**s != '.') return true;
+    (*s)++;
+    if (dst) {
+        // Writemask: components in order, each at most once
+        op->mask = 0;
+        int last = -1;
+        while (component(**s) >= 0) {
+            int c = component(**s);
+            if (c <= last) return false;
+            op->mask |= 1u << c;
+            last = c;
+            (*s)++;
+        }
+        return op->mask != 0;
+    }
+    // tgsi_text only takes a full four-component source swizzle
+    for (int i = 0; i < 4; i++) {
+        int c = component((*s)[i]);
+        if (c < 0) return false;
+        op->swizzle[i] = (uint8_t)c;
+    }
+    *s += 4;
+    return component(**s) < 0;
+}
+
+static uint32_t source_count(const std::string& op)
+{
+    static const std::map<std::string, uint32_t> ops = {
+        { "MOV", 1 }, { "RSQ", 1 }, { "EX2", 1 }, { "LIT", 1 },
+        { "ADD", 2 }, { "MUL", 2 }, { "DP3", 2 }, { "DP4", 2 },
+        { "SLT", 2 }, { "SGE", 2 }, { "SEQ", 2 }, { "SNE", 2 }, { "SGT", 2 }, { "SLE", 2 },
+        { "MAD", 3 }, { "LRP", 3 },
+        { "TEX", 2 }, { "KILL_IF", 1 }, { "KILL", 0 }, { "END", 0 },
+    };
+    auto it = ops.find(op);
+    return it == ops.end() ? ~0u : it->second;
+}
+
+static bool parse_decl(Program* p, const std::string& line)
+{
+    const char* s = line.c_str() + 4;
+    s = skip_ws(s);
+    File file;
+    uint32_t first, last;
+    if (strncmp(s, "SVIEW[", 6) == 0) {
+        s += 6;
+        if (!parse_uint(&s, &first) || strcmp(s, "], 2D, FLOAT") != 0) {
+            return fail(p, line, "bad SVIEW");
+        }
+        p->views |= 1u << first;
+        return true;
+    }
+    if (!parse_file(&s, &file) || !parse_uint(&s, &first)) return fail(p, line, "bad DCL");
+    last = first;
+    if (s[0] == '.' && s[1] == '.') {
+        s += 2;
+        if (!parse_uint(&s, &last) || last < first) return fail(p, line, "bad range");
+    }
+    if (*s++ != ']') return fail(p, line, "bad DCL");
+    std::string rest = s;
+
+    switch (file) {
+    case FILE_TEMP:
+        if (first != 0 || !rest.empty()) return fail(p, line, "bad TEMP");
+        p->num_temp = last + 1;
+        return true;
+    case FILE_CONST:
+        if (first != 0 || !rest.empty()) return fail(p, line, "bad CONST");
+        p->num_const = last + 1;
+        return true;
+    case FILE_SAMP:
+        if (!rest.empty()) return fail(p, line, "bad SAMP");
+        p->samplers |= 1u << first;
+        return true;
+    case FILE_IN:
+    case FILE_OUT: {
+        std::vector<std::string>& sem = file == FILE_IN ? p->in_semantic : p->out_semantic;
+        if (first != last || first != sem.size()) return fail(p, line, "registers out of order");
+        if (!rest.empty() && rest.compare(0, 2, ", ") != 0) return fail(p, line, "bad semantic");
+        std::string semantic = rest.empty() ? "ATTRIB" : rest.substr(2);
+        if (file == FILE_IN && p->fragment) {
+            // Fragment inputs carry an interpolation mode after the semantic
+            size_t comma = semantic.rfind(", ");
+            if (comma == std::string::npos) return fail(p, line, "no interpolation");
+            std::string interp = semantic.substr(comma + 2);
+            semantic = semantic.substr(0, comma);
+            if (interp != "COLOR" && interp != "PERSPECTIVE") return fail(p, line, "bad interpolation");
+        }
+        sem.push_back(semantic);
+        return true;
+    }
+    default:
+        return fail(p, line, "bad DCL file");
+    }
+}
+
+static bool parse_imm(Program* p, const std::string& line)
+{
+    uint32_t index;
+    const char* s = line.c_str() + 4;
+    if (!parse_uint(&s, &index) || index != p->imm.size() || strncmp(s, "] FLT32 {", 9) != 0) {
+        return fail(p, line, "bad IMM");
+    }
+    s += 9;
+    Vec4 v;
+    for (int i = 0; i < 4; i++) {
+        char* end;
+        v.v[i] = strtof(s, &end);
+        if (end == s) return fail(p, line, "bad IMM value");
+        s = skip_ws(end);
+        if (*s != (i == 3 ? '}' : ',')) return fail(p, line, "bad IMM separator");
+        s++;
+    }
+    p->imm.push_back(v);
+    return true;
+}
+
+static bool parse_insn(Program* p, const std::string& line)
+{
+    const char* s = skip_ws(line.c_str());
+    const char* end = s;
+    while (*end && *end != ' ') end++;
+    Insn insn = {};
+    insn.opcode.assign(s, end);
+    if (insn.opcode.size() > 4 && insn.opcode.compare(insn.opcode.size() - 4, 4, "_SAT") == 0) {
+        insn.saturate = true;
+        insn.opcode.resize(insn.opcode.size() - 4);
+    }
+    uint32_t n = source_count(insn.opcode);
+    if (n == ~0u) return fail(p, line, "unknown opcode");
+    s = end;
+    bool has_dst = insn.opcode != "KILL" && insn.opcode != "KILL_IF" && insn.opcode != "END";
+    if (has_dst && !parse_operand(&s, true, &insn.dst)) return fail(p, line, "bad destination");
+    for (uint32_t i = 0; i < n; i++) {
+        if (has_dst || i > 0) {
+            s = skip_ws(s);
+            if (*s++ != ',') return fail(p, line, "missing comma");
+        }
+        if (!parse_operand(&s, false, &insn.src[i])) return fail(p, line, "bad source");
+    }
+    insn.num_src = n;
+    if (insn.opcode == "TEX") {
+        // TEX dst, coord, SAMP[n], 2D - the sampler is the second source
+        if (insn.src[1].file != FILE_SAMP || strcmp(s, ", 2D") != 0) {
+            return fail(p, line, "bad TEX");
+        }
+        s += 4;
+    }
+    if (*skip_ws(s)) return fail(p, line, "trailing text");
+    p->insns.push_back(insn);
+    return true;
+}
+
+// Register bounds, outputs written, sampler views declared, END last
+static bool validate(Program* p)
+{
+    uint32_t written = 0;
+    for (const Insn& insn : p->insns) {
+        const Operand* ops[4] = { &insn.dst, &insn.src[0], &insn.src[1], &insn.src[2] };
+        bool has_dst = insn.opcode != "KILL" && insn.opcode != "KILL_IF" && insn.opcode != "END";
+        for (uint32_t i = has_dst ? 0 : 1; i <= insn.num_src; i++) {
+            const Operand* op = ops[i];
+            uint32_t limit = 0;
+            switch (op->file) {
+            case FILE_IN: limit = (uint32_t)p->in_semantic.size(); break;
+            case FILE_OUT: limit = (uint32_t)p->out_semantic.size(); break;
+            case FILE_TEMP: limit = p->num_temp; break;
+            case FILE_CONST: limit = p->num_const; break;
+            case FILE_IMM: limit = (uint32_t)p->imm.size(); break;
+            case FILE_SAMP: limit = (p->samplers >> op->index) & 1 ? op->index + 1 : 0; break;
+            default: break;
+            }
+            if (op->index >= limit) return fail(p, insn.opcode, "undeclared register");
+            if (i == 0 && (op->file == FILE_IN || op->file == FILE_CONST || op->file == FILE_IMM)) {
+                return fail(p, insn.opcode, "read-only destination");
+            }
+            if (i > 0 && op->file == FILE_OUT) return fail(p, insn.opcode, "output read");
+        }
+        if (has_dst && insn.dst.file == FILE_OUT) written |= 1u << insn.dst.index;
+    }
+    if (p->insns.empty() || p->insns.back().opcode != "END") return fail(p, "", "no END");
+    for (size_t i = 0; i + 1 < p->insns.size(); i++) {
+        if (p->insns[i].opcode == "END") return fail(p, "", "END before the last instruction");
+    }
+    if (written != (1u << p->out_semantic.size()) - 1) return fail(p, "", "output never written");
+    if (p->samplers != p->views) return fail(p, "", "SAMP without SVIEW");
+    return true;
+}
+
+static bool parse_program(const char* text, Program* p)
+{
+    *p = Program();
+    std::vector<std::string> lines;
+    for (const char* s = text; *s;) {
+        const char* nl = strchr(s, '\n');
+        if (!nl) return fail(p, s, "unterminated line");
+        lines.push_back(std::string(s, nl));
+        s = nl + 1;
+    }
+    if (lines.empty() || (lines[0] != "VERT" && lines[0] != "FRAG")) {
+        return fail(p, lines.empty() ? "" : lines[0], "no processor header");
+    }
+    p->fragment = lines[0] == "FRAG";
+    bool in_body = false;
+    for (size_t i = 1; i < lines.size(); i++) {
+        const std::string& line = lines[i];
+        bool decl = line.compare(0, 4, "DCL ") == 0;
+        bool imm = line.compare(0, 4, "IMM[") == 0;
+        bool prop = line.compare(0, 9, "PROPERTY ") == 0;
+        if ((decl || imm || prop) && in_body) return fail(p, line, "declaration after code");
+        if (prop) {
+            if (line != "PROPERTY FS_COLOR0_WRITES_ALL_CBUFS 1" || !p->fragment) {
+                return fail(p, line, "bad PROPERTY");
+            }
+        } else if (decl) {
+            if (!parse_decl(p, line)) return false;
+        } else if (imm) {
+            if (!parse_imm(p, line)) return false;
+        } else {
+            in_body = true;
+            if (!parse_insn(p, line)) return false;
+        }
+    }
+    return validate(p);
+}
+
+// Texture unit `unit` sampled at (s, t): smooth, distinct per unit
+static Vec4 sample(uint32_t unit, const Vec4& coord)
+{
+    Vec4 r;
+    r.v[0] = 0.5f + 0.4f * sinf(coord.v[0] * 3.0f + (float)unit);
+    r.v[1] = 0.5f + 0.4f * cosf(coord.v[1] * 2.0f - (float)unit);
+    r.v[2] = 0.25f + 0.05f * (float)unit;
+    r.v[3] = 0.6f + 0.04f * (float)unit;
+    return r;
+}
+
+struct Machine {
+    const Program* prog;
+    const float* constants;
+    std::vector<Vec4> in, out, temp;
+    bool killed;
+};
+
+static Vec4 fetch(const Machine& m, const Operand& op)
+{
+    const Vec4* reg = NULL;
+    switch (op.file) {
+    case FILE_IN: reg = &m.in[op.index]; break;
+    case FILE_TEMP: reg = &m.temp[op.index]; break;
+    case FILE_CONST: reg = (const Vec4*)&m.constants[op.index * 4]; break;
+    case FILE_IMM: reg = &m.prog->imm[op.index]; break;
+    default: abort();
+    }
+    Vec4 r;
+    for (int i = 0; i < 4; i++) {
+        r.v[i] = reg->v[op.swizzle[i]];
+        if (op.negate) r.v[i] = -r.v[i];
+    }
+    return r;
+}
+
+static void store(Machine& m, const Insn& insn, const Vec4& value)
+{
+    Vec4* reg = insn.dst.file == FILE_OUT ? &m.out[insn.dst.index] : &m.temp[insn.dst.index];
+    for (int i = 0; i < 4; i++) {
+        if (!(insn.dst.mask & (1u << i))) continue;
+        float v = value.v[i];
+        if (insn.saturate) v = v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+        reg->v[i] = v;
+    }
+}
+
+static void run(Machine& m)
+{
+    const Vec4 poison = { { NAN, NAN, NAN, NAN } };
+    m.out.assign(m.prog->out_semantic.size(), poison);
+    m.temp.assign(m.prog->num_temp, poison);
+    m.killed = false;
+    for (const Insn& insn : m.prog->insns) {
+        const std::string& op = insn.opcode;
+        Vec4 a = {}, b = {}, c = {}, r = {};
+        if (insn.num_src > 0 && insn.src[0].file != FILE_SAMP) a = fetch(m, insn.src[0]);
+        if (insn.num_src > 1 && insn.src[1].file != FILE_SAMP) b = fetch(m, insn.src[1]);
+        if (insn.num_src > 2) c = fetch(m, insn.src[2]);
+        if (op == "END") {
+            break;
+        } else if (op == "KILL") {
+            m.killed = true;
+            continue;
+        } else if (op == "KILL_IF") {
+            for (int i = 0; i < 4; i++) m.killed |= a.v[i] < 0.0f;
+            continue;
+        } else if (op == "MOV") {
+            r = a;
+        } else if (op == "ADD" || op == "MUL" || op == "MAD" || op == "LRP") {
+            for (int i = 0; i < 4; i++) {
+                if (op == "ADD") r.v[i] = a.v[i] + b.v[i];
+                else if (op == "MUL") r.v[i] = a.v[i] * b.v[i];
+                else if (op == "MAD") r.v[i] = a.v[i] * b.v[i] + c.v[i];
+                else r.v[i] = a.v[i] * b.v[i] + (1.0f - a.v[i]) * c.v[i];
+            }
+        } else if (op == "DP3" || op == "DP4") {
+            float sum = a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2];
+            if (op == "DP4") sum += a.v[3] * b.v[3];
+            for (int i = 0; i < 4; i++) r.v[i] = sum;
+        } else if (op == "RSQ") {
+            for (int i = 0; i < 4; i++) r.v[i] = 1.0f / sqrtf(fabsf(a.v[0]));
+        } else if (op == "EX2") {
+            for (int i = 0; i < 4; i++) r.v[i] = exp2f(a.v[0]);
+        } else if (op == "LIT") {
+            r.v[0] = 1.0f;
+            r.v[1] = a.v[0] > 0.0f ? a.v[0] : 0.0f;
+            r.v[2] = a.v[0] > 0.0f ? powf(a.v[1] > 0.0f ? a.v[1] : 0.0f, a.v[3]) : 0.0f;
+            r.v[3] = 1.0f;
+        } else if (op == "TEX") {
+            r = sample(insn.src[1].index, a);
+        } else {
+            for (int i = 0; i < 4; i++) {
+                bool t = op == "SLT" ? a.v[i] < b.v[i] : op == "SGE" ? a.v[i] >= b.v[i] :
+                         op == "SEQ" ? a.v[i] == b.v[i] : op == "SNE" ? a.v[i] != b.v[i] :
+                         op == "SGT" ? a.v[i] > b.v[i] : a.v[i] <= b.v[i];
+                r.v[i] = t ? 1.0f : 0.0f;
+            }
+        }
+        store(m, insn, r);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// GL reference
+
+struct Vertex {
+    float position[4];
+    float color[4];
+    float texcoord[4];
+    float normal[3];
+};
+
+struct Expected {
+    float clip[4];
+    float color[4];
+    float texcoord[4];
+    float fog;
+    float frag[4];
+    bool killed;
+};
+
+static void mat_vec(const float m[16], const float v[4], float out[4])
+{
+    for (int r = 0; r < 4; r++) {
+        out[r] = m[r] * v[0] + m[4 + r] * v[1] + m[8 + r] * v[2] + m[12 + r] * v[3];
+    }
+}
+
+static void normalize3(float v[3])
+{
+    float len = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    for (int i = 0; i < 3; i++) v[i] /= len;
+}
+
+static float dot3(const float a[3], const float b[3])
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static float clamp01(float v)
+{
+    return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+}
+
+static Expected reference(const virgl_ffp_key& key, const virgl_ffp_state& st,
+                          const float mv[16], const float proj[16], const Vertex& vtx)
+{
+    Expected e = {};
+    float eye[4];
+    mat_vec(mv, vtx.position, eye);
+    mat_vec(proj, eye, e.clip);
+    memcpy(e.texcoord, vtx.texcoord, sizeof(e.texcoord));
+
+    bool cm = (key.flags & VIRGL_FFP_COLOR_MATERIAL) != 0;
+    if (key.flags & VIRGL_FFP_LIGHTING) {
+        // Normal through the inverse transpose of the upper 3x3
+        double a[3][3], inv[3][3];
+        for (int r = 0; r < 3; r++)
+            for (int c = 0; c < 3; c++) a[r][c] = mv[c * 4 + r];
+        double det = a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+                     a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+                     a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+        for (int r = 0; r < 3; r++) {
+            for (int c = 0; c < 3; c++) {
+                // inverse[r][c] = cofactor[c][r] / det
+                int r1 = (c + 1) % 3, r2 = (c + 2) % 3, c1 = (r + 1) % 3, c2 = (r + 2) % 3;
+                inv[r][c] = (a[r1][c1] * a[r2][c2] - a[r1][c2] * a[r2][c1]) / det;
+            }
+        }
+        float n[3];
+        for (int r = 0; r < 3; r++) {
+            n[r] = (float)(inv[0][r] * vtx.normal[0] + inv[1][r] * vtx.normal[1] + inv[2][r] * vtx.normal[2]);
+        }
+        normalize3(n);
+
+        const float* ma = cm ? vtx.color : st.material_ambient;
+        const float* md = cm ? vtx.color : st.material_diffuse;
+        for (int c = 0; c < 3; c++) {
+            e.color[c] = st.material_emission[c] + st.light_model_ambient[c] * ma[c];
+        }
+        e.color[3] = md[3];
+        for (int i = 0; i < VIRGL_FFP_MAX_LIGHTS; i++) {
+            if (!(key.lights & (1u << i))) continue;
+            const virgl_ffp_light& l = st.lights[i];
+            float L[3];
+            for (int c = 0; c < 3; c++) {
+                L[c] = l.position[3] != 0.0f ? l.position[c] / l.position[3] - eye[c] : l.position[c];
+            }
+            normalize3(L);
+            float H[3] = { L[0], L[1], L[2] + 1.0f };
+            normalize3(H);
+            float ndotl = dot3(n, L), ndoth = dot3(n, H);
+            float diff = ndotl > 0.0f ? ndotl : 0.0f;
+            float spec = ndotl > 0.0f ? powf(ndoth > 0.0f ? ndoth : 0.0f, st.material_shininess) : 0.0f;
+            for (int c = 0; c < 3; c++) {
+                e.color[c] += l.ambient[c] * ma[c] + diff * l.diffuse[c] * md[c] +
+                              spec * l.specular[c] * st.material_specular[c];
+            }
+        }
+        for (int c = 0; c < 4; c++) e.color[c] = clamp01(e.color[c]);
+    } else {
+        memcpy(e.color, vtx.color, sizeof(e.color));
+    }
+
+    float dist = -eye[2];
+    switch (key.fog_mode) {
+    case VIRGL_FFP_FOG_LINEAR: e.fog = (st.fog_end - dist) / (st.fog_end - st.fog_start); break;
+    case VIRGL_FFP_FOG_EXP: e.fog = expf(-st.fog_density * dist); break;
+    case VIRGL_FFP_FOG_EXP2: e.fog = expf(-(st.fog_density * dist) * (st.fog_density * dist)); break;
+    default: e.fog = 1.0f; break;
+    }
+    e.fog = clamp01(e.fog);
+
+    // Fragment: one vertex, so the "interpolated" inputs are its outputs
+    float frag[4];
+    memcpy(frag, e.color, sizeof(frag));
+    Vec4 tc;
+    memcpy(tc.v, e.texcoord, sizeof(tc.v));
+    for (uint32_t u = 0; u < VIRGL_FFP_MAX_TEXTURE_UNITS; u++) {
+        if (!(key.texture_units & (1u << u))) continue;
+        Vec4 t = sample(u, tc);
+        for (int c = 0; c < 4; c++) frag[c] *= t.v[c];
+    }
+    float a = frag[3], ref = st.alpha_ref;
+    switch (key.alpha_func) {
+    case PIPE_FUNC_NEVER: e.killed = true; break;
+    case PIPE_FUNC_LESS: e.killed = !(a < ref); break;
+    case PIPE_FUNC_EQUAL: e.killed = !(a == ref); break;
+    case PIPE_FUNC_LEQUAL: e.killed = !(a <= ref); break;
+    case PIPE_FUNC_GREATER: e.killed = !(a > ref); break;
+    case PIPE_FUNC_NOTEQUAL: e.killed = !(a != ref); break;
+    case PIPE_FUNC_GEQUAL: e.killed = !(a >= ref); break;
+    default: break;
+    }
+    if (key.fog_mode != VIRGL_FFP_FOG_NONE) {
+        for (int c = 0; c < 3; c++) frag[c] = e.fog * frag[c] + (1.0f - e.fog) * st.fog_color[c];
+    }
+    memcpy(e.frag, frag, sizeof(frag));
+    return e;
+}
+
+// ---------------------------------------------------------------------------
+// Random state
+
+static void random_modelview(float m[16])
+{
+    // Rotation about a random axis, non-uniform scale (so the normal matrix
+    // is not just the rotation), sometimes a mirror, then a translation
+    // that keeps the geometry in front of the viewer
+    float axis[3] = { frand(-1, 1), frand(-1, 1), frand(-1, 1) + 2.0f };
+    normalize3(axis);
+    float ang = frand(-3.0f, 3.0f), c = cosf(ang), s = sinf(ang), t = 1.0f - c;
+    float x = axis[0], y = axis[1], z = axis[2];
+    float rot[3][3] = {
+        { t * x * x + c, t * x * y - s * z, t * x * z + s * y },
+        { t * x * y + s * z, t * y * y + c, t * y * z - s * x },
+        { t * x * z - s * y, t * y * z + s * x, t * z * z + c },
+    };
+    float scale[3] = { frand(0.5f, 2.0f), frand(0.5f, 2.0f), frand(0.5f, 2.0f) };
+    if (rnd() & 1) scale[1] = -scale[1];
+    memset(m, 0, 16 * sizeof(float));
+    for (int r = 0; r < 3; r++)
+        for (int col = 0; col < 3; col++) m[col * 4 + r] = rot[r][col] * scale[col];
+    m[12] = frand(-2, 2);
+    m[13] = frand(-2, 2);
+    m[14] = frand(-12, -4);
+    m[15] = 1.0f;
+}
+
+static void frustum(float m[16], float l, float r, float b, float t, float n, float f)
+{
+    memset(m, 0, 16 * sizeof(float));
+    m[0] = 2 * n / (r - l);
+    m[5] = 2 * n / (t - b);
+    m[8] = (r + l) / (r - l);
+    m[9] = (t + b) / (t - b);
+    m[10] = -(f + n) / (f - n);
+    m[11] = -1;
+    m[14] = -2 * f * n / (f - n);
+}
+
+static void random_color(float c[4], float lo = 0.0f, float hi = 1.0f)
+{
+    for (int i = 0; i < 4; i++) c[i] = frand(lo, hi);
+}
+
+static void random_state(virgl_ffp_key* key, virgl_ffp_state* st)
+{
+    virgl_ffp_state_init(st);
+    for (uint32_t i = 0; i < VIRGL_FFP_MAX_LIGHTS; i++) {
+        virgl_ffp_light& l = st->lights[i];
+        if (key->point_lights & (1u << i)) {
+            float w = frand(0.5f, 2.0f);
+            virgl_ffp_set4(l.position, frand(-5, 5) * w, frand(-5, 5) * w, frand(-5, 5) * w, w);
+        } else {
+            virgl_ffp_set4(l.position, frand(-1, 1), frand(-1, 1), frand(0.1f, 1), 0.0f);
+        }
+        random_color(l.ambient, 0.0f, 0.2f);
+        random_color(l.diffuse, 0.0f, 0.6f);
+        random_color(l.specular, 0.0f, 0.6f);
+    }
+    random_color(st->material_ambient);
+    random_color(st->material_diffuse);
+    random_color(st->material_specular);
+    random_color(st->material_emission, 0.0f, 0.2f);
+    st->material_shininess = frand(0.0f, 64.0f);
+    random_color(st->light_model_ambient, 0.0f, 0.3f);
+    random_color(st->fog_color);
+    st->fog_density = frand(0.02f, 0.3f);
+    st->fog_start = frand(0.0f, 4.0f);
+    st->fog_end = st->fog_start + frand(2.0f, 20.0f);
+    st->alpha_ref = frand(0.0f, 1.0f);
+}
+
+static void random_key(virgl_ffp_key* key)
+{
+    memset(key, 0, sizeof(*key));
+    key->texture_units = (rnd() & 3) ? (uint8_t)(rnd() & (rnd() & 1 ? 0x3 : 0xFF)) : 0;
+    key->flags = (uint8_t)(rnd() & 3);
+    if (key->flags & VIRGL_FFP_LIGHTING) {
+        key->lights = (uint8_t)(rnd() & (rnd() & 1 ? 0x3 : 0xFF));
+        key->point_lights = (uint8_t)(key->lights & rnd());
+    }
+    key->alpha_func = (uint8_t)((rnd() & 1) ? (uint32_t)PIPE_FUNC_ALWAYS : rnd() & 7);
+    key->fog_mode = (uint8_t)(rnd() & 3);
+}
+
+// ---------------------------------------------------------------------------
+
+static bool close_to(float got, float want)
+{
+    return fabsf(got - want) <= 2e-4f + 2e-4f * fabsf(want);
+}
+
+static const char* s_labels[] = { "x", "y", "z", "w" };
+
+static bool expect4(const char* what, const float* got, const float* want)
+{
+    bool ok = true;
+    for (int i = 0; i < 4; i++) {
+        if (!close_to(got[i], want[i])) {
+            fprintf(stderr, LOG_TAG "   %s.%s got %.6f want %.6f\n", what, s_labels[i], got[i], want[i]);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+static int find_semantic(const std::vector<std::string>& sem, const char* name)
+{
+    for (size_t i = 0; i < sem.size(); i++) {
+        if (sem[i] == name) return (int)i;
+    }
+    return -1;
+}
+
+// Generate, parse and execute one key against `trials` random states
+static bool run_key(const virgl_ffp_key& key_in, int trials)
+{
+    static char vs_text[VIRGL_FFP_TEXT_MAX], fs_text[VIRGL_FFP_TEXT_MAX];
+    virgl_ffp_key key = key_in;
+    uint32_t vs_len = virgl_ffp_vertex_shader(&key, vs_text, sizeof(vs_text));
+    uint32_t fs_len = virgl_ffp_fragment_shader(&key, fs_text, sizeof(fs_text));
+    Program vs, fs;
+    char what[96];
+    snprintf(what, sizeof(what), "key %016llx", (unsigned long long)virgl_ffp_key_bits(&key));
+
+    if (!vs_len || !fs_len || strlen(vs_text) != vs_len || strlen(fs_text) != fs_len) {
+        fprintf(stderr, LOG_TAG " FAIL %s: generation failed\n", what);
+        s_failures++;
+        return false;
+    }
+    if (!parse_program(vs_text, &vs) || !parse_program(fs_text, &fs)) {
+        fprintf(stderr, LOG_TAG " FAIL %s: %s\n%s\n%s", what,
+                (vs.error.empty() ? fs.error : vs.error).c_str(), vs_text, fs_text);
+        s_failures++;
+        return false;
+    }
+
+    // Link: every fragment input is a vertex output with the same semantic
+    std::vector<int> link(fs.in_semantic.size());
+    for (size_t i = 0; i < fs.in_semantic.size(); i++) {
+        link[i] = find_semantic(vs.out_semantic, fs.in_semantic[i].c_str());
+        if (link[i] < 0) {
+            fprintf(stderr, LOG_TAG " FAIL %s: FS input %s not written by the VS\n", what,
+                    fs.in_semantic[i].c_str());
+            s_failures++;
+            return false;
+        }
+    }
+    check(vs.num_const == virgl_ffp_vs_constants(&key), "VS CONST range matches the packer");
+    check(fs.num_const == virgl_ffp_fs_constants(&key), "FS CONST range matches the packer");
+
+    int tex_out = find_semantic(vs.out_semantic, "GENERIC[0]");
+    int fog_out = find_semantic(vs.out_semantic, "GENERIC[1]");
+    for (int trial = 0; trial < trials; trial++) {
+        virgl_ffp_state st;
+        float mv[16], proj[16];
+        random_state(&key, &st);
+        random_modelview(mv);
+        frustum(proj, -1, 1, -0.75f, 0.75f, 1.0f, 100.0f);
+
+        Vertex vtx;
+        virgl_ffp_set4(vtx.position, frand(-1, 1), frand(-1, 1), frand(-1, 1), 1.0f);
+        random_color(vtx.color);
+        virgl_ffp_set4(vtx.texcoord, frand(0, 1), frand(0, 1), 0.0f, 1.0f);
+        vtx.normal[0] = frand(-1, 1);
+        vtx.normal[1] = frand(-1, 1);
+        vtx.normal[2] = frand(-1, 1);
+
+        Expected want = reference(key, st, mv, proj, vtx);
+        // Hit the equality edge of the alpha test half the time
+        if (trial & 1) {
+            st.alpha_ref = want.frag[3];
+            want = reference(key, st, mv, proj, vtx);
+        }
+
+        float vs_consts[VIRGL_FFP_VS_MAX_CONSTANTS * 4], fs_consts[VIRGL_FFP_FS_MAX_CONSTANTS * 4];
+        for (float& f : vs_consts) f = NAN;
+        for (float& f : fs_consts) f = NAN;
+        virgl_ffp_pack_vs_constants(&key, &st, mv, proj, vs_consts);
+        virgl_ffp_pack_fs_constants(&key, &st, fs_consts);
+
+        Machine vm = { &vs, vs_consts, {}, {}, {}, false };
+        vm.in.resize(vs.in_semantic.size());
+        const float* attribs[4] = { vtx.position, vtx.color, vtx.texcoord, vtx.normal };
+        for (size_t i = 0; i < vm.in.size(); i++) {
+            memcpy(vm.in[i].v, attribs[i], (i == 3 ? 3 : 4) * sizeof(float));
+            if (i == 3) vm.in[i].v[3] = 0.0f;
+        }
+        run(vm);
+
+        Machine fm = { &fs, fs_consts, {}, {}, {}, false };
+        fm.in.resize(fs.in_semantic.size());
+        for (size_t i = 0; i < fm.in.size(); i++) fm.in[i] = vm.out[link[i]];
+        run(fm);
+
+        bool ok = expect4("position", vm.out[0].v, want.clip) &&
+                  expect4("color", vm.out[1].v, want.color);
+        if (ok && tex_out >= 0) ok = expect4("texcoord", vm.out[tex_out].v, want.texcoord);
+        if (ok && fog_out >= 0) {
+            float f4[4] = { want.fog, want.fog, want.fog, want.fog };
+            ok = expect4("fog", vm.out[fog_out].v, f4);
+        }
+        if (ok && fm.killed != want.killed) {
+            fprintf(stderr, LOG_TAG "   killed %d want %d\n", fm.killed, want.killed);
+            ok = false;
+        }
+        if (ok && !want.killed) ok = expect4("fragment", fm.out[0].v, want.frag);
+        if (!ok) {
+            fprintf(stderr, LOG_TAG " FAIL %s trial %d\n%s\n%s", what, trial, vs_text, fs_text);
+            s_failures++;
+            return false;
+        }
+    }
+    return true;
+}
+
+static virgl_ffp_key base_key()
+{
+    virgl_ffp_key key;
+    memset(&key, 0, sizeof(key));
+    key.alpha_func = PIPE_FUNC_ALWAYS;
+    return key;
+}
+
+static void test_golden()
+{
+    char vs[VIRGL_FFP_TEXT_MAX], fs[VIRGL_FFP_TEXT_MAX];
+    virgl_ffp_key key = base_key();
+
+    // The unlit, untextured program is the hot path; pin it exactly
+    virgl_ffp_vertex_shader(&key, vs, sizeof(vs));
+    virgl_ffp_fragment_shader(&key, fs, sizeof(fs));
+    check(strcmp(vs,
+                 "VERT\n"
+                 "DCL IN[0]\n"
+                 "DCL IN[1]\n"
+                 "DCL OUT[0], POSITION\n"
+                 "DCL OUT[1], COLOR\n"
+                 "DCL CONST[0..3]\n"
+                 "  DP4 OUT[0].x, IN[0], CONST[0]\n"
+                 "  DP4 OUT[0].y, IN[0], CONST[1]\n"
+                 "  DP4 OUT[0].z, IN[0], CONST[2]\n"
+                 "  DP4 OUT[0].w, IN[0], CONST[3]\n"
+                 "  MOV OUT[1], IN[1]\n"
+                 "  END\n") == 0, "golden: base vertex shader");
+    check(strcmp(fs,
+                 "FRAG\n"
+                 "PROPERTY FS_COLOR0_WRITES_ALL_CBUFS 1\n"
+                 "DCL IN[0], COLOR, COLOR\n"
+                 "DCL OUT[0], COLOR\n"
+                 "  MOV OUT[0], IN[0]\n"
+                 "  END\n") == 0, "golden: base fragment shader");
+
+    // One textured unit with GEQUAL alpha test
+    key.texture_units = 1;
+    key.alpha_func = PIPE_FUNC_GEQUAL;
+    virgl_ffp_fragment_shader(&key, fs, sizeof(fs));
+    check(strcmp(fs,
+                 "FRAG\n"
+                 "PROPERTY FS_COLOR0_WRITES_ALL_CBUFS 1\n"
+                 "DCL IN[0], COLOR, COLOR\n"
+                 "DCL IN[1], GENERIC[0], PERSPECTIVE\n"
+                 "DCL OUT[0], COLOR\n"
+                 "DCL SAMP[0]\n"
+                 "DCL SVIEW[0], 2D, FLOAT\n"
+                 "DCL CONST[0..0]\n"
+                 "DCL TEMP[0..1]\n"
+                 "IMM[0] FLT32 {   -0.5000,     0.0000,     0.0000,     0.0000}\n"
+                 "  MOV TEMP[0], IN[0]\n"
+                 "  TEX TEMP[1], IN[1], SAMP[0], 2D\n"
+                 "  MUL TEMP[0], TEMP[0], TEMP[1]\n"
+                 "  SGE TEMP[1].x, TEMP[0].wwww, CONST[0].xxxx\n"
+                 "  ADD TEMP[1].x, TEMP[1].xxxx, IMM[0].xxxx\n"
+                 "  KILL_IF TEMP[1].xxxx\n"
+                 "  MOV OUT[0], TEMP[0]\n"
+                 "  END\n") == 0, "golden: textured alpha-tested fragment shader");
+
+    // Keys compare as one word; padding is part of it
+    virgl_ffp_key a = base_key(), b = base_key(), c = base_key();
+    c.lights = 1;
+    check(virgl_ffp_key_bits(&a) == virgl_ffp_key_bits(&b) &&
+          virgl_ffp_key_bits(&a) != virgl_ffp_key_bits(&c), "key bits");
+
+    virgl_ffp_state st;
+    virgl_ffp_state_init(&st);
+    check(st.lights[0].diffuse[0] == 1.0f && st.lights[1].diffuse[0] == 0.0f &&
+          st.material_diffuse[0] == 0.8f && st.fog_end == 1.0f, "GL initial state");
+}
+
+static void test_bounds()
+{
+    // The largest key must fit VIRGL_FFP_TEXT_MAX, and every shorter
+    // buffer must be refused rather than truncated
+    virgl_ffp_key key = base_key();
+    key.texture_units = 0xFF;
+    key.lights = 0xFF;
+    key.point_lights = 0xFF;
+    key.flags = VIRGL_FFP_LIGHTING | VIRGL_FFP_COLOR_MATERIAL;
+    key.alpha_func = PIPE_FUNC_NOTEQUAL;
+    key.fog_mode = VIRGL_FFP_FOG_EXP2;
+    static char buf[VIRGL_FFP_TEXT_MAX];
+    uint32_t vs_len = virgl_ffp_vertex_shader(&key, buf, sizeof(buf));
+    uint32_t fs_len = virgl_ffp_fragment_shader(&key, buf, sizeof(buf));
+    check(vs_len > 0 && fs_len > 0, "bounds: largest key fits VIRGL_FFP_TEXT_MAX");
+    printf(LOG_TAG " largest program: VS %u bytes, FS %u bytes (limit %u)\n",
+           vs_len, fs_len, VIRGL_FFP_TEXT_MAX);
+
+    bool refused = true;
+    for (uint32_t cap = 0; cap <= vs_len; cap++) {
+        memset(buf, 0xCD, sizeof(buf));
+        refused &= virgl_ffp_vertex_shader(&key, buf, cap) == 0;
+        for (uint32_t i = cap; i < sizeof(buf); i++) refused &= (uint8_t)buf[i] == 0xCD;
+    }
+    check(refused, "bounds: short buffers refused, nothing written past capacity");
+    check(virgl_ffp_vertex_shader(&key, buf, vs_len + 1) == vs_len && buf[vs_len] == '\0',
+          "bounds: exact fit");
+}
+
+static void test_c_build()
+{
+    char vs[VIRGL_FFP_TEXT_MAX], fs[VIRGL_FFP_TEXT_MAX];
+    char want_vs[VIRGL_FFP_TEXT_MAX], want_fs[VIRGL_FFP_TEXT_MAX];
+    virgl_ffp_key key = base_key();
+    key.texture_units = 1;
+    key.flags = VIRGL_FFP_LIGHTING;
+    key.lights = 1;
+    key.fog_mode = VIRGL_FFP_FOG_LINEAR;
+    virgl_ffp_vertex_shader(&key, want_vs, sizeof(want_vs));
+    virgl_ffp_fragment_shader(&key, want_fs, sizeof(want_fs));
+    check(ffp_c_check(vs, fs, VIRGL_FFP_TEXT_MAX) != 0 && strcmp(vs, want_vs) == 0 &&
+          strcmp(fs, want_fs) == 0, "C build generates the same programs");
+}
+
+static void test_interpreted()
+{
+    // Every feature alone, then everything at once, then random keys
+    std::vector<virgl_ffp_key> keys;
+    keys.push_back(base_key());
+    for (uint32_t u = 0; u < VIRGL_FFP_MAX_TEXTURE_UNITS; u++) {
+        virgl_ffp_key k = base_key();
+        k.texture_units = (uint8_t)(1u << u);
+        keys.push_back(k);
+    }
+    for (uint32_t flags = 1; flags < 4; flags += 2) {
+        virgl_ffp_key k = base_key();
+        k.flags = (uint8_t)flags;
+        keys.push_back(k);
+        for (uint32_t i = 0; i < VIRGL_FFP_MAX_LIGHTS; i++) {
+            k.lights = (uint8_t)(1u << i);
+            k.point_lights = 0;
+            keys.push_back(k);
+            k.point_lights = k.lights;
+            keys.push_back(k);
+        }
+    }
+    for (uint32_t f = 0; f < 8; f++) {
+        virgl_ffp_key k = base_key();
+        k.alpha_func = (uint8_t)f;
+        keys.push_back(k);
+    }
+    for (uint32_t m = 1; m < 4; m++) {
+        virgl_ffp_key k = base_key();
+        k.fog_mode = (uint8_t)m;
+        keys.push_back(k);
+    }
+    virgl_ffp_key all = base_key();
+    all.texture_units = 0xFF;
+    all.lights = 0xFF;
+    all.point_lights = 0x5A;
+    all.flags = VIRGL_FFP_LIGHTING | VIRGL_FFP_COLOR_MATERIAL;
+    all.alpha_func = PIPE_FUNC_LEQUAL;
+    all.fog_mode = VIRGL_FFP_FOG_EXP2;
+    keys.push_back(all);
+
+    uint32_t ran = 0;
+    for (const virgl_ffp_key& k : keys) {
+        ran += run_key(k, 64);
+    }
+    for (int i = 0; i < 3000; i++) {
+        virgl_ffp_key k;
+        random_key(&k);
+        ran += run_key(k, 8);
+    }
+    printf(LOG_TAG " %u programs interpreted against the GL reference\n", ran);
+}
+
+// ALU instructions per program: the point of specialising
+static uint32_t count_insns(const char* text)
+{
+    Program p;
+    if (!parse_program(text, &p)) return 0;
+    return (uint32_t)p.insns.size() - 1;
+}
+
+static void bench()
+{
+    static char vs[VIRGL_FFP_TEXT_MAX], fs[VIRGL_FFP_TEXT_MAX];
+    const struct { const char* name; virgl_ffp_key key; } shapes[] = {
+        { "unlit, untextured", base_key() },
+        { "textured", [] { virgl_ffp_key k = base_key(); k.texture_units = 1; return k; }() },
+        { "lit, 1 light", [] { virgl_ffp_key k = base_key(); k.flags = VIRGL_FFP_LIGHTING;
+                              k.lights = 1; return k; }() },
+        { "lit+textured+fog", [] { virgl_ffp_key k = base_key(); k.flags = VIRGL_FFP_LIGHTING;
+                                   k.lights = 3; k.point_lights = 2; k.texture_units = 1;
+                                   k.fog_mode = VIRGL_FFP_FOG_LINEAR; return k; }() },
+        { "everything (uber)", [] { virgl_ffp_key k = base_key(); k.flags = 3; k.lights = 0xFF;
+                                    k.point_lights = 0xFF; k.texture_units = 0xFF;
+                                    k.alpha_func = PIPE_FUNC_GREATER;
+                                    k.fog_mode = VIRGL_FFP_FOG_EXP2; return k; }() },
+    };
+    printf(LOG_TAG " %-20s %8s %8s\n", "program", "VS insns", "FS insns");
+    for (const auto& s : shapes) {
+        virgl_ffp_vertex_shader(&s.key, vs, sizeof(vs));
+        virgl_ffp_fragment_shader(&s.key, fs, sizeof(fs));
+        printf(LOG_TAG " %-20s %8u %8u\n", s.name, count_insns(vs), count_insns(fs));
+    }
+
+    const int iterations = 200000;
+    virgl_ffp_key keys[64];
+    for (virgl_ffp_key& k : keys) random_key(&k);
+    uint64_t bytes = 0;
+    double t0 = now_sec();
+    for (int i = 0; i < iterations; i++) {
+        const virgl_ffp_key* k = &keys[i & 63];
+        bytes += virgl_ffp_vertex_shader(k, vs, sizeof(vs));
+        bytes += virgl_ffp_fragment_shader(k, fs, sizeof(fs));
+    }
+    double dt = now_sec() - t0;
+    printf(LOG_TAG " generate: %.0f programs/s, %.2f us per VS+FS pair, %.0f MB/s of text\n",
+           iterations / dt, dt * 1e6 / iterations, bytes / dt / 1e6);
+}
+
+int main(int argc, char** argv)
+{
+    bool run_bench = !(argc > 1 && strcmp(argv[1], "--no-bench") == 0);
+
+    test_golden();
+    test_bounds();
+    test_c_build();
+    test_interpreted();
+    if (s_failures) {
+        fprintf(stderr, LOG_TAG " %d failures\n", s_failures);
+        return 1;
+    }
+    printf(LOG_TAG " golden, bounds, C build and interpreted programs ok\n");
+    if (run_bench) {
+        bench();
+    }
+    return 0;
+}
@@ -0,0 +1,15 @@
+#!/bin/bash
+# Build vmlog: reads the kext's in-memory log ring. Cross-compiled on a
+# modern macOS host for Snow Leopard 10.6.
+set -e
+
+cd "$(dirname "$0")"
+
+clang -arch x86_64 -mmacosx-version-min=10.6 -O2 -Wall -Wextra \
+      -o vmlog vmlog.c -framework IOKit
+
+echo "Built: $(pwd)/vmlog"
+echo
+echo "On the guest:"
+echo "  sudo ./vmlog        # dump the ring"
+echo "  sudo ./vmlog -f     # and keep following"
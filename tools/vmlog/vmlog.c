@@ -0,0 +1,115 @@
+/*
+ * vmlog.c - reads the kext's in-memory log
+ *
+ * Messages below WARN never reach IOLog; they sit in a ring of records
+ * inside the kext (FB/VMLog.h) until something reads them. This tool
+ * drains that ring through the user client (type 4, selector 0x600E).
+ *
+ *   vmlog               print what the ring holds and exit
+ *   vmlog -f            print, then keep following new messages
+ *
+ * Must run as root: the selector is administrator only.
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <mach/mach.h>
+#include <IOKit/IOKitLib.h>
+
+#define SEL_READ_LOG        0x600E
+#define READ_BUFFER_SIZE    (256 * 1024)    /* the kext's VM_LOG_READ_MAX */
+#define FOLLOW_INTERVAL_US  200000
+
+static volatile sig_atomic_t g_stop;
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    g_stop = 1;
+}
+
+static io_connect_t open_connection(void)
+{
+    io_service_t service = IOServiceGetMatchingService(kIOMasterPortDefault,
+                               IOServiceMatching("VMQemuVGAAccelerator"));
+    io_connect_t connect = IO_OBJECT_NULL;
+    if (service == IO_OBJECT_NULL)
+        return IO_OBJECT_NULL;
+    if (IOServiceOpen(service, mach_task_self(), 4, &connect) != KERN_SUCCESS)
+        connect = IO_OBJECT_NULL;
+    IOObjectRelease(service);
+    return connect;
+}
+
+/* One read; returns bytes of text, or -1 on error */
+static long read_log(io_connect_t connect, uint64_t* cursor, char* buffer, uint64_t* lost)
+{
+    uint64_t in[1] = { *cursor };
+    uint64_t out[2] = { 0, 0 };
+    uint32_t out_count = 2;
+    size_t size = READ_BUFFER_SIZE;
+    kern_return_t kr = IOConnectCallMethod(connect, SEL_READ_LOG,
+                                           in, 1, NULL, 0,
+                                           out, &out_count,
+                                           buffer, &size);
+    if (kr != KERN_SUCCESS) {
+        fprintf(stderr, "vmlog: read selector failed: 0x%x%s\n", kr,
+                kr == kIOReturnNotPrivileged ? " (run as root)" : "");
+        return -1;
+    }
+    *cursor = out[0];
+    *lost += out[1];
+    return (long)size;
+}
+
+int main(int argc, char** argv)
+{
+    int follow = argc > 1 && strcmp(argv[1], "-f") == 0;
+    if (argc > 1 && !follow) {
+        fprintf(stderr, "usage: vmlog [-f]\n");
+        return 1;
+    }
+
+    io_connect_t connect = open_connection();
+    if (connect == IO_OBJECT_NULL) {
+        fprintf(stderr, "vmlog: VMQemuVGAAccelerator not found (is VMQemuVGA.kext loaded?)\n");
+        return 1;
+    }
+    char* buffer = malloc(READ_BUFFER_SIZE);
+    if (!buffer) {
+        IOServiceClose(connect);
+        return 1;
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    uint64_t cursor = 0, lost = 0, reported = 0;
+    int result = 0;
+    while (!g_stop) {
+        long n = read_log(connect, &cursor, buffer, &lost);
+        if (n < 0) {
+            result = 1;
+            break;
+        }
+        if (lost != reported) {
+            printf("--- %llu messages overwritten before they were read ---\n",
+                   (unsigned long long)(lost - reported));
+            reported = lost;
+        }
+        fwrite(buffer, 1, (size_t)n, stdout);
+        if (n == 0) {
+            if (!follow)
+                break;
+            fflush(stdout);
+            usleep(FOLLOW_INTERVAL_US);
+        }
+    }
+
+    free(buffer);
+    IOServiceClose(connect);
+    return result;
+}
@@ -0,0 +1,21 @@
+#!/bin/bash
+# Build and run vmlog_test: FB/VMLog.cpp's formatter checked against
+# snprintf, its rate limiter, compile-time level filter and ring checked
+# under concurrent writers, then the logging paths benchmarked.
+# Runs on any Linux or macOS host; the logger has no IOKit dependency.
+set -e
+
+cd "$(dirname "$0")"
+
+CXX=${CXX:-c++}
+
+# vmlog_compiled_out.cpp builds with the Release configuration's level
+$CXX -O2 -std=c++11 -Wall -Wno-unknown-pragmas -DLOGGING_LEVEL=2 -I../../FB \
+     -c -o vmlog_compiled_out.o vmlog_compiled_out.cpp
+$CXX -O2 -std=c++11 -Wall -Wno-unknown-pragmas -DLOGGING_LEVEL=3 -pthread -I../../FB \
+     -o vmlog_test vmlog_test.cpp vmlog_compiled_out.o ../../FB/VMLog.cpp
+rm -f vmlog_compiled_out.o
+
+echo "Built: $(pwd)/vmlog_test"
+echo
+./vmlog_test "$@"
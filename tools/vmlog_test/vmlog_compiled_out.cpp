@@ -0,0 +1,22 @@
+// Built with LOGGING_LEVEL=2 (Release): VMLOG_DEBUG must vanish, arguments
+// and all, while VMLOG_INFO still records.
+
+#include "VMLog.h"
+
+static int s_evaluations;
+
+static int touch()
+{
+    return ++s_evaluations;
+}
+
+int vmlog_compiled_out(uint64_t* info_records)
+{
+    uint64_t before = VMLogHead();
+    for (int i = 0; i < 5; i++) {
+        VMLOG_DEBUG("compiled out %d\n", touch());
+    }
+    VMLOG_INFO("compiled in %d\n", 7);
+    *info_records = VMLogHead() - before;
+    return s_evaluations;
+}